@@ -162,6 +162,7 @@ content = [
             'SaveFileConfig',
             'TimerNode',
             'AnchorPoint',
+            'FrustumCullingNode',
         ],
         'structs': [
             'AnimationChannel',
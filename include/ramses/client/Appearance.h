@@ -262,6 +262,31 @@ namespace ramses
         */
         bool getColorWriteMask(bool& writeRed, bool& writeGreen, bool& writeBlue, bool& writeAlpha) const;
 
+        /**
+        * @brief Sets the end of shader animation driven by semantic uniform #ramses::EEffectUniformSemantic::TimeMs.
+        * As long as a mesh using a semantic time uniform is rendered, the renderer has to re-render its scene every frame,
+        * because it cannot know whether the shader still animates. Declaring the time at which the animation of this appearance ends
+        * allows the renderer to stop re-rendering once the time uniform reached the end, from then on the uniform keeps
+        * the value \c timeMs and the scene is rendered again only when modified.
+        * The end is compared to the value of the time uniform (see #ramses::Scene::getUniformTimeMs), e.g. an animation
+        * starting now and lasting 2 seconds ends at getUniformTimeMs() + 2000. Resetting the uniform using
+        * #ramses::Scene::resetUniformTimeMs starts the animation window again.
+        * By default the animation never ends, i.e. std::numeric_limits<int32_t>::max().
+        * Declaring the animation end requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param[in] timeMs Value of time uniform in milliseconds at which the animation ends, must not be negative
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setUniformTimeAnimationEnd(int32_t timeMs);
+
+        /**
+        * @brief Gets the end of shader animation driven by semantic uniform #ramses::EEffectUniformSemantic::TimeMs.
+        * See #setUniformTimeAnimationEnd.
+        *
+        * @return value of time uniform in milliseconds at which the animation ends
+        */
+        [[nodiscard]] int32_t getUniformTimeAnimationEnd() const;
+
         /**
         * @brief Sets value to uniform input.
         * Value type must pass #ramses::IsUniformInputDataType.
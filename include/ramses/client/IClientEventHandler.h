@@ -12,6 +12,7 @@
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/RendererSceneState.h"
 
+#include <cstddef>
 #include <string_view>
 
 namespace ramses
@@ -49,6 +50,21 @@ namespace ramses
         */
         virtual void sceneFileLoadSucceeded(std::string_view filename, Scene* loadedScene) = 0;
 
+        /**
+        * @brief This method will be called while a scene file is loaded asynchronously, after parts of its scene data were read.
+        *        The scene data are read in chunks, large files report progress several times before
+        *        #sceneFileLoadSucceeded or #sceneFileLoadFailed is called for them.
+        *        Resources are read on demand after the scene was loaded and are not part of the reported bytes.
+        *        Default implementation ignores the progress.
+        *
+        * @param filename The filename of the scene file being loaded.
+        * @param bytesLoaded Number of scene data bytes read so far.
+        * @param bytesTotal Total number of scene data bytes in the file.
+        */
+        virtual void sceneFileLoadProgress([[maybe_unused]] std::string_view filename, [[maybe_unused]] size_t bytesLoaded, [[maybe_unused]] size_t bytesTotal)
+        {
+        }
+
         /**
         * @brief This method will be called when state on renderer side of a scene referenced
         *        using #ramses::SceneReference changed.
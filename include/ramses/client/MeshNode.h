@@ -18,6 +18,7 @@ namespace ramses
     }
 
     class Appearance;
+    class ArrayBuffer;
     class Geometry;
     class Effect;
 
@@ -128,6 +129,10 @@ namespace ramses
         * @brief Sets the number of instances that will be drawn for this
         *        mesh by the renderer.
         *
+        * Instanced vertex attributes are read from the first elements of their #ramses::ArrayBuffer only,
+        * so the buffers can be created for the maximum number of instances and the instance count changed
+        * (together with partial buffer updates) every frame without re-creating them.
+        *
         * @param[in] instanceCount Number of instances to be drawn (default: 1)
         * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
         */
@@ -140,6 +145,112 @@ namespace ramses
         */
         [[nodiscard]] uint32_t getInstanceCount() const;
 
+        /**
+        * @brief Sets a bounding sphere enclosing the mesh geometry in the local (model) space of the mesh.
+        *
+        * If a bounding sphere is set, the renderer will skip rendering of the mesh in a render pass
+        * if the sphere (transformed by the mesh's world matrix) is completely outside of the render pass camera's frustum.
+        * The bounding sphere must enclose all vertices as they are transformed by the vertex shader
+        * (apart from the model, view and projection transformations), otherwise the mesh might be culled
+        * although some of its parts are visible.
+        * By default there is no bounding sphere and the mesh is never culled.
+        * Bounding spheres require #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param[in] center Center of the bounding sphere in local space of the mesh
+        * @param[in] radius Radius of the bounding sphere, must not be negative
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setBoundingSphere(const vec3f& center, float radius);
+
+        /**
+        * @brief Removes the bounding sphere previously set by #setBoundingSphere, the mesh will not be culled anymore.
+        *
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool removeBoundingSphere();
+
+        /**
+        * @brief Gets the bounding sphere set by #setBoundingSphere.
+        *
+        * @param[out] center Center of the bounding sphere in local space of the mesh
+        * @param[out] radius Radius of the bounding sphere
+        * @return true if bounding sphere is set, false otherwise (output parameters are not modified then).
+        */
+        bool getBoundingSphere(vec3f& center, float& radius) const;
+
+        /**
+        * @brief Enables culling of individual instances of an instanced mesh by the renderer.
+        *
+        * The buffer provides translation of every instance in local space of the mesh (typically the same
+        * buffer as used for instanced position attribute). The bounding sphere set by #setBoundingSphere
+        * is then interpreted as sphere enclosing a single instance, the renderer tests it translated by each instance
+        * position and does not draw instances following the last one which is within the camera frustum,
+        * the mesh is not rendered at all if all its instances are outside. Sorting instances by importance
+        * (e.g. distance to camera) therefore maximizes the number of skipped instances.
+        * Instance culling requires a bounding sphere to be set and all instances to have their position
+        * in the buffer (see #ramses::ArrayBuffer::getUsedNumberOfElements), otherwise all instances are drawn.
+        * Destroying the buffer disables instance culling of all meshes using it.
+        * Instance culling requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param[in] instancePositions Buffer of type #ramses::EDataType::Vector3F with instance positions, nullptr to disable instance culling
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setInstanceCullingPositions(const ArrayBuffer* instancePositions);
+
+        /**
+        * @brief Gets the buffer with instance positions set by #setInstanceCullingPositions.
+        *
+        * @return buffer with instance positions, nullptr if instance culling is not enabled.
+        */
+        [[nodiscard]] const ArrayBuffer* getInstanceCullingPositions() const;
+
+        /**
+        * @brief Adds a level of detail, i.e. alternative (typically coarser) range of indices drawn instead of the range
+        *        given by #setStartIndex and #setIndexCount when the mesh appears small on screen.
+        *
+        * The renderer selects the level of detail for every render pass separately using the pass camera: the bounding sphere
+        * (see #setBoundingSphere) is projected and its diameter is compared, as fraction of viewport height, to screen sizes
+        * of the levels. The last level whose screen size is larger than the projected size is drawn, the full detail
+        * is drawn if the projected size is larger than or equal to screen sizes of all levels.
+        * The selection has a hysteresis of 10% around each screen size, so that the level does not flicker when the mesh
+        * is just at a threshold. Levels must be added in order of decreasing screen size, at most 4 levels can be added.
+        * Levels of detail require a bounding sphere to be set, otherwise the full detail is always drawn.
+        * The index ranges share the geometry of the mesh, all ranges of levels can be stored in one index array.
+        * Levels of detail require #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param[in] startIndex First index of the level in index array of the geometry
+        * @param[in] indexCount Number of indices of the level, must be greater than 0
+        * @param[in] screenSize Projected diameter of bounding sphere as fraction of viewport height below which the level is used,
+        *                       must be greater than 0 and smaller than screen size of the previously added level
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool addLevelOfDetail(uint32_t startIndex, uint32_t indexCount, float screenSize);
+
+        /**
+        * @brief Removes all levels of detail added by #addLevelOfDetail, the full detail is always drawn then.
+        *
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool removeLevelsOfDetail();
+
+        /**
+        * @brief Gets the number of levels of detail added by #addLevelOfDetail.
+        *
+        * @return number of levels of detail (not counting the full detail)
+        */
+        [[nodiscard]] size_t getLevelOfDetailCount() const;
+
+        /**
+        * @brief Gets the level of detail added by #addLevelOfDetail.
+        *
+        * @param[in] index Index of the level in order of adding, must be smaller than #getLevelOfDetailCount
+        * @param[out] startIndex First index of the level
+        * @param[out] indexCount Number of indices of the level
+        * @param[out] screenSize Screen size below which the level is used
+        * @return true if level exists, false otherwise (output parameters are not modified then).
+        */
+        bool getLevelOfDetail(size_t index, uint32_t& startIndex, uint32_t& indexCount, float& screenSize) const;
+
         /**
          * Get the internal data for implementation specifics of MeshNode.
          */
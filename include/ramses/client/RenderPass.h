@@ -221,6 +221,111 @@ namespace ramses
         */
         bool retriggerRenderOnce();
 
+        /**
+        * @brief Enable/disable sorting of the meshes in the render pass by their render state.
+        * @details By default the meshes of a render pass are rendered in the order given by
+        *          their render groups and their order within the render groups (see #ramses::RenderGroup::addMeshNode).
+        *          When state sorting is enabled the renderer is free to reorder all meshes of this render pass
+        *          so that meshes with the same effect, render state, textures and geometry are rendered one
+        *          after another. This reduces the number of state changes on the GPU, which can be significant
+        *          for render passes with many meshes. The render order of meshes is then only used to order
+        *          meshes which share all of these states.
+        *
+        *          State sorting should only be enabled for content whose visual result does not depend
+        *          on the rendering order, e.g. opaque meshes rendered with depth testing.
+        *          State sorting requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param enable The flag which indicates if the meshes of the render pass can be sorted by state (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setStateSorting(bool enable);
+
+        /**
+        * @brief Get the state sorting flag of the render pass
+        *
+        * @return Indicates if the meshes of the render pass are sorted by their render state, see #setStateSorting
+        */
+        [[nodiscard]] bool isStateSorting() const;
+
+        /**
+        * @brief Enable/disable sorting of the opaque meshes in the render pass front to back.
+        * @details When enabled the renderer orders the meshes of this render pass which write depth
+        *          (see #ramses::Appearance::setDepthWrite) by their distance to the camera, nearest first,
+        *          every frame their transformation or the camera changes. Meshes rendered front to back
+        *          let the GPU reject hidden fragments early by depth test, which reduces shading cost
+        *          for content with high overdraw. Only meshes which write depth and use a less or greater
+        *          depth function are reordered among themselves, all other meshes (e.g. transparent ones
+        *          or background without depth test) keep their position in the render order.
+        *
+        *          Distance is computed from the origin of the mesh bounding sphere if one is set
+        *          (see #ramses::MeshNode::setBoundingSphere), otherwise from the origin of the mesh node.
+        *          Front to back sorting takes precedence over state sorting (see #setStateSorting).
+        *          Front to back sorting requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param enable The flag which indicates if the opaque meshes of the render pass are sorted front to back (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setFrontToBackSorting(bool enable);
+
+        /**
+        * @brief Get the front to back sorting flag of the render pass
+        *
+        * @return Indicates if the opaque meshes of the render pass are sorted front to back, see #setFrontToBackSorting
+        */
+        [[nodiscard]] bool isFrontToBackSorting() const;
+
+        /**
+        * @brief Enable/disable sorting of the transparent meshes in the render pass back to front.
+        * @details When enabled the renderer orders the meshes of this render pass which have blending enabled
+        *          (see #ramses::Appearance::setBlendingOperations) by their distance to the camera, farthest first,
+        *          every frame their transformation or the camera changes. Blended meshes rendered back to front
+        *          compose correctly without the client having to reorder render groups whenever the camera moves.
+        *          Only blended meshes are reordered among themselves, all other meshes keep their position in the render order,
+        *          therefore back to front sorting can be combined with front to back sorting of opaque meshes (see #setFrontToBackSorting).
+        *
+        *          Distance is computed from the origin of the mesh bounding sphere if one is set
+        *          (see #ramses::MeshNode::setBoundingSphere), otherwise from the origin of the mesh node.
+        *          Meshes at equal distance keep their relative render order. Back to front sorting takes precedence
+        *          over state sorting (see #setStateSorting).
+        *          Back to front sorting requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param enable The flag which indicates if the transparent meshes of the render pass are sorted back to front (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setBackToFrontSorting(bool enable);
+
+        /**
+        * @brief Get the back to front sorting flag of the render pass
+        *
+        * @return Indicates if the transparent meshes of the render pass are sorted back to front, see #setBackToFrontSorting
+        */
+        [[nodiscard]] bool isBackToFrontSorting() const;
+
+        /**
+        * @brief Enable/disable a depth only pre-pass for the opaque meshes in the render pass.
+        * @details When enabled the renderer first renders all meshes of this render pass which write depth
+        *          and use a less or greater depth function with color and stencil writes disabled. Afterwards the render pass
+        *          is rendered as usual, but those meshes are tested with depth function 'equal' and do not write depth,
+        *          so that every pixel is shaded only once. Other meshes (e.g. transparent ones) are rendered unchanged.
+        *
+        *          The pre-pass doubles the vertex processing of the opaque meshes, it pays off only for content
+        *          with expensive fragment shading and high overdraw. The vertex positions of a mesh must be computed
+        *          identically in both passes, which is the case unless the vertex shader depends on values
+        *          changing in between (e.g. semantic time uniforms are fine, they are the same within a frame).
+        *          The depth pre-pass requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param enable The flag which indicates if a depth pre-pass is rendered for the render pass (Default:false)
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setDepthPrePass(bool enable);
+
+        /**
+        * @brief Get the depth pre-pass flag of the render pass
+        *
+        * @return Indicates if a depth pre-pass is rendered for the render pass, see #setDepthPrePass
+        */
+        [[nodiscard]] bool hasDepthPrePass() const;
+
         /**
          * Get the internal data for implementation specifics of RenderPass.
          */
@@ -20,8 +20,10 @@
 #include "ramses/framework/DataTypes.h"
 #include "ramses/framework/RamsesFrameworkTypes.h"
 
+#include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace ramses
 {
@@ -71,6 +73,9 @@ namespace ramses
      * @brief The Scene holds a scene graph.
      * It is the essential class for distributing
      * content to the ramses system.
+     *
+     * Different scenes of the same #ramses::RamsesClient can be built and flushed from different threads concurrently,
+     * a scene and objects created by it must be used only by one thread at a time.
      * @ingroup CoreAPI
     */
     class RAMSES_API Scene : public ClientObject
@@ -202,6 +207,27 @@ namespace ramses
         */
         MeshNode* createMeshNode(std::string_view name = {});
 
+        /**
+        * @brief Sets transformation of multiple nodes at once.
+        * Has the same effect as calling #ramses::Node::setTranslation, #ramses::Node::setRotation(const quat&)
+        * and #ramses::Node::setScaling for each of the nodes, but the values are written and sent to renderer
+        * as one compact scene update instead of one per node and component. Intended for updating large number
+        * of nodes every frame, e.g. from a physics or animation system.
+        * Each of the value arrays is optional, if nullptr is given the corresponding transformation component is not modified.
+        * Otherwise the array must contain numNodes elements, the i-th element is applied to the i-th node.
+        * Values are always set, even if they are the same as the current ones.
+        * Below #ramses::EFeatureLevel_03 the values are sent as one scene update per node and component.
+        *
+        * @param[in] numNodes Number of nodes to update.
+        * @param[in] nodes Array of numNodes nodes, all of them must belong to this scene.
+        * @param[in] translations Optional array of translations.
+        * @param[in] rotations Optional array of rotations given as quaternions.
+        * @param[in] scalings Optional array of scalings.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        *         If any of the nodes is invalid no node is modified.
+        */
+        bool setNodeTransforms(size_t numNodes, Node* const* nodes, const vec3f* translations, const quat* rotations, const vec3f* scalings);
+
         /**
         * @brief Destroys a previously created object using this scene
         * The object must be owned by this scene in order to be destroyed.
@@ -254,6 +280,16 @@ namespace ramses
         */
         bool flush(sceneVersionTag_t sceneVersionTag = InvalidSceneVersionTag);
 
+        /**
+        * @brief   Returns number of flushes which were captured but not sent to renderer(s) yet.
+        * @details Only scenes created with asynchronous flushing enabled (#ramses::SceneConfig::setAsyncFlushEnabled)
+        *          send their flushes in background, for other scenes this is always 0.
+        *          Can be used to throttle scene modifications or to check that all changes were handed over before e.g. saving.
+        *
+        * @return number of pending flushes
+        */
+        [[nodiscard]] uint32_t getPendingFlushCount() const;
+
         /**
          * @brief resets the semantic uniform #ramses::EEffectUniformSemantic::TimeMs
          * The uniform value will contain the time elapsed since this method was called for the last time.
@@ -291,6 +327,16 @@ namespace ramses
         **/
         template <typename T = SceneObject> [[nodiscard]] const T* findObject(std::string_view name) const;
 
+        /**
+        * @brief Get multiple objects from the scene by name
+        * Equivalent to calling #findObject(std::string_view) with #ramses::SceneObject type for each of the given names,
+        * objects are looked up using name index of the scene and therefore the cost does not depend on number of objects in scene.
+        *
+        * @param[in] names The names of the objects to get.
+        * @return Pointers to the found objects in the same order as given names, nullptr for each name no object was found for.
+        */
+        [[nodiscard]] std::vector<SceneObject*> findObjects(const std::vector<std::string_view>& names);
+
         /**
         * @brief Get an object from the scene by id
         * This will also search for logic objects in all existing #ramses::LogicEngine instances if used with #ramses::SceneObject or #ramses::LogicObject template type,
@@ -542,6 +588,27 @@ namespace ramses
             const T* arrayData,
             std::string_view name = {});
 
+        /**
+        * @brief Create a new #ramses::ArrayResource taking ownership of the given data instead of copying it.
+        *
+        * Ramses takes ownership of the memory buffer passed in via arrayData and will delete it via the provided deleter from
+        * unique_ptr when not used anymore. The caller may not modify the referenced memory anymore after this call.
+        * The behavior is undefined if arrayData does not hold at least numElements elements of given type.
+        * See #createArrayResource above for details on array resources.
+        *
+        * @param[in] type Data type of the array elements, must be valid for vertex or index data.
+        * @param[in] numElements The number of elements of the given data type to use for the resource.
+        * @param[in] arrayData Memory buffer holding the array data, size in bytes must be numElements * #ramses::GetSizeOfDataType of type.
+        * @param[in] name The optional name of the ArrayResource.
+        * @return A pointer to the created ArrayResource, null on failure
+        */
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+        ArrayResource* createArrayResource(
+            EDataType type,
+            size_t numElements,
+            std::unique_ptr<std::byte[], void (*)(const std::byte*)> arrayData,
+            std::string_view name = {});
+
         /**
         * @brief Create a new Texture2D. It makes a copy of the given data of a certain type as a resource, an immutable data object.
         *        See #ramses::Texture2D for more details. See #ramses::MipLevelData for more details on expected texel alignment.
@@ -568,6 +635,37 @@ namespace ramses
             const TextureSwizzle& swizzle = {},
             std::string_view name = {});
 
+        /**
+        * @brief Create a new Texture2D with a single mipmap level taking ownership of the given data instead of copying it.
+        *        See #ramses::Texture2D for more details. See #ramses::MipLevelData for more details on expected texel alignment.
+        *
+        * Ramses takes ownership of the memory buffer passed in via data and will delete it via the provided deleter from
+        * unique_ptr when not used anymore. The caller may not modify the referenced memory anymore after this call.
+        * Unlike #createTexture2D taking #ramses::MipLevelData the mipmap chain is never generated on client side when requested,
+        * because it would need a copy of the data. It is generated by renderer when texture gets uploaded instead.
+        *
+        * @param[in] format Pixel format of the Texture2D data.
+        * @param[in] width Width of the texture.
+        * @param[in] height Height of the texture.
+        * @param[in] data Memory buffer holding texel data of mipmap level 0.
+        * @param[in] size The size in bytes of the data memory.
+        * @param[in] generateMipChain Auto generate mipmap levels.
+        * @param[in] swizzle Describes how RGBA channels of the texture are swizzled,
+        *          where each member of the struct represents one destination channel that the source channel should get sampled from.
+        * @param[in] name The name of the Texture2D.
+        * @return A pointer to the created Texture2D, null on failure. Will fail with data == nullptr, width/height == 0 or size too small.
+        */
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+        Texture2D* createTexture2D(
+            ETextureFormat format,
+            uint32_t width,
+            uint32_t height,
+            std::unique_ptr<std::byte[], void (*)(const std::byte*)> data,
+            size_t size,
+            bool generateMipChain = false,
+            const TextureSwizzle& swizzle = {},
+            std::string_view name = {});
+
         /**
         * @brief Create a new Texture3D. It makes a copy of the given data of a certain type as a resource, an immutable data object.
         *        See #ramses::Texture3D for more details. See #ramses::MipLevelData for more details on expected texel alignment.
@@ -85,6 +85,96 @@ namespace ramses
          */
         void setRenderBackendCompatibility(ERenderBackendCompatibility renderBackendCompatibility);
 
+        /**
+         * Enables removal of redundant scene changes before they are sent to renderer(s) on #ramses::Scene::flush.
+         * If same property (e.g. translation of a node, uniform input of an appearance or value of a data object)
+         * is set multiple times between two flushes, only the last value is sent. This reduces amount of data transmitted
+         * and applied on renderer side, especially for content animated by logic which may update a property several times per frame.
+         * The coalescing itself costs additional processing time on every flush, therefore it is disabled by default.
+         *
+         * @param enabled flag to enable/disable coalescing of scene changes
+         */
+        void setSceneActionCoalescingEnabled(bool enabled);
+
+        /**
+         * Enables loading of the scene file through a read-only memory mapping instead of reading it via file stream.
+         * Scene data is then parsed directly from the mapped file and resources loaded later on demand are read from
+         * the mapping without any file read calls, which reduces load time especially for large scene files.
+         * Applies to #ramses::RamsesClient::loadSceneFromFile, #ramses::RamsesClient::loadSceneFromFileAsync and
+         * #ramses::RamsesClient::loadSceneFromFileDescriptor, it has no effect when loading from memory.
+         * The scene file must not be modified or truncated while the scene exists, otherwise the process may crash.
+         * Memory mapping is supported on POSIX platforms only, on other platforms or if mapping fails the scene is loaded
+         * via file stream as usual. Disabled by default.
+         *
+         * @param enabled flag to enable/disable memory mapped loading of scene file
+         */
+        void setMemoryMappedLoadingEnabled(bool enabled);
+
+        /**
+         * Enables asynchronous flushing of the scene. #ramses::Scene::flush then only captures the scene changes
+         * and returns, serialization and sending of the changes to renderer(s) is done by a framework worker thread
+         * (see #ramses::RamsesFrameworkConfig::setWorkerThreadCount). Flushed changes are still sent in flush order.
+         * If \p maxPendingFlushes flushes are captured but not sent yet, the next flush blocks until the oldest one is sent,
+         * #ramses::Scene::getPendingFlushCount can be used to check progress without blocking.
+         * Disabled by default.
+         *
+         * @param enabled flag to enable/disable asynchronous flushing
+         * @param maxPendingFlushes maximum number of flushes waiting to be sent, minimum is 1
+         */
+        void setAsyncFlushEnabled(bool enabled, uint32_t maxPendingFlushes = 2u);
+
+        /**
+         * Enables lazy loading of Lua scripts of logic engines contained in the scene. Scripts are then not compiled
+         * (or loaded from bytecode) when the scene is loaded, but only when they have to run for the first time,
+         * i.e. on the first #ramses::LogicEngine::update after their inputs changed (set by user or via link).
+         * Load time then scales with the scripts actually used rather than all scripts in the scene.
+         * Script properties are available and can be linked right after loading as usual.
+         * Note that a lazily loaded script starts with its serialized output values and is not run on first update,
+         * the scene should therefore be saved only after #ramses::LogicEngine::update so that outputs match inputs.
+         * Errors in Lua code of a lazily loaded script are reported by the update which compiles it.
+         * Disabled by default.
+         *
+         * @param enabled flag to enable/disable lazy loading of Lua scripts
+         */
+        void setLazyLuaScriptLoadingEnabled(bool enabled);
+
+        /**
+         * Sends scene updates of this scene with high priority to remote renderers.
+         * Messages of a high priority scene overtake messages of other scenes queued for the same connection,
+         * e.g. small flushes of a visible scene are not delayed by a large resource transfer of a scene being set up.
+         * Large scene updates are split into packets, packets of high priority scenes are sent in between the packets of other scenes.
+         * This should be used only for few latency critical scenes, all scenes with high priority share the same priority lane.
+         * Has no effect on local renderers. Disabled by default.
+         *
+         * @param enabled flag to enable/disable high priority of scene updates
+         */
+        void setHighPriorityUpdatesEnabled(bool enabled);
+
+        /**
+         * Loads the scene in background when using #ramses::RamsesClient::loadSceneFromFileAsync.
+         * Asynchronous loads are split into stages (reading scene data, creating the scene) which are executed by
+         * the framework worker threads interleaved with stages of other loads. Stages of background loads are
+         * executed only after pending stages of other asynchronous loads, e.g. to prefetch scenes which are not needed yet
+         * without delaying the scene the user waits for. Has no effect on synchronous loading. Disabled by default.
+         *
+         * @param enabled flag to enable/disable background loading
+         */
+        void setBackgroundLoadingEnabled(bool enabled);
+
+        /**
+         * Enables delta encoding of value changes sent to remote renderers. Translation, rotation, scaling and data values
+         * (float, integer, vector and matrix data) set on an object are sent only as the bytes which differ from the value
+         * sent previously for the same object, e.g. a matrix where only the translation changes is sent with few bytes only.
+         * Optionally transformation values (translation, rotation and scaling) can be quantized by dropping least significant
+         * mantissa bits which makes their changes shorter. Quantization is lossy, it is disabled by default (0 bits),
+         * at most 16 bits can be dropped. Data values are never quantized.
+         * Encoding costs additional processing time on every flush, it has no effect on local renderers. Disabled by default.
+         *
+         * @param enabled flag to enable/disable delta encoding of value changes
+         * @param transformQuantizationBits number of least significant mantissa bits dropped from transformation values
+         */
+        void setSceneActionDeltaEncodingEnabled(bool enabled, uint32_t transformQuantizationBits = 0u);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -75,6 +75,37 @@ namespace ramses
         */
         [[nodiscard]] RendererSceneState getRequestedState() const;
 
+        /**
+        * @brief   Set a hint to prepare the referenced scene in background ahead of its requested state.
+        * @details While the requested state (#requestState) is lower than \c preloadState the #ramses::RamsesRenderer
+        *          may bring the referenced scene to \c preloadState on its own, e.g. subscribe it and upload its resources,
+        *          so that a later #requestState to that state (or higher) can be fulfilled without delay.
+        *          Preloading has lower priority than state changes requested explicitly, the renderer prepares only a limited
+        *          number of referenced scenes at a time and picks them by \c priority (higher value first).
+        *          Same preconditions apply as for #requestState, a referenced scene is never preloaded beyond the state of
+        *          its master scene. Preloading changes the state of referenced scene on renderer side, the changes are reported
+        *          using #ramses::IClientEventHandler::sceneReferenceStateChanged.
+        *          Preloading is disabled by setting \c preloadState to #ramses::RendererSceneState::Available (default).
+        *          Preloading requires #ramses::EFeatureLevel_03 or higher.
+        *
+        * @param[in] preloadState State to preload the referenced scene to, can be either Available or Ready.
+        * @param[in] priority Higher value means that the scene is preloaded before scenes with lower value. Default is 0.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setPreloadHint(RendererSceneState preloadState, int32_t priority = 0);
+
+        /**
+        * @brief Get the currently set preload state for this scene reference, see #setPreloadHint.
+        * @return The preload state of the reference.
+        */
+        [[nodiscard]] RendererSceneState getPreloadState() const;
+
+        /**
+        * @brief Get the currently set preload priority for this scene reference, see #setPreloadHint.
+        * @return The preload priority of the reference.
+        */
+        [[nodiscard]] int32_t getPreloadPriority() const;
+
         /**
         * @brief Get the sceneId of the referenced scene.
         * @return The scene id of the referenced scene
@@ -0,0 +1,25 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+namespace ramses
+{
+    /**
+     * Modes of the Lua garbage collector shared by all #ramses::LuaScript and #ramses::LuaModule instances of a #ramses::LogicEngine,
+     * see #ramses::LogicEngine::setLuaGarbageCollectorMode.
+     */
+    enum class ELuaGarbageCollectorMode
+    {
+        /// Each collection cycle marks and sweeps all objects in interleaved steps, this is the Lua default.
+        Incremental,
+        /// Frequent minor collections traverse only recently created objects, major collection runs when memory grows beyond a threshold.
+        /// Usually lowers collection overhead for scripts creating many short-lived temporaries. Requires Lua 5.4.
+        Generational
+    };
+}
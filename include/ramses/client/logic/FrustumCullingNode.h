@@ -0,0 +1,115 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/client/logic/LogicNode.h"
+#include <memory>
+
+namespace ramses
+{
+    class MeshNode;
+    class Camera;
+}
+
+namespace ramses::internal
+{
+    class FrustumCullingNodeImpl;
+}
+
+namespace ramses
+{
+    /**
+    * @brief Frustum culling node is a #ramses::LogicNode which tests bounding spheres of a set of Ramses mesh nodes against the view frustum
+    * of a Ramses camera and makes the mesh nodes invisible when they are completely outside of it.
+    * Frustum culling node requires a #ramses::CameraBinding and a list of #ramses::MeshNodeBinding at creation time,
+    * see #ramses::LogicEngine::createFrustumCullingNode.
+    *
+    * The update logic retrieves the world matrices of all the mesh nodes in one batch, transforms their bounding spheres to world space
+    * and tests them against the six planes of the frustum given by projection and view matrix of the camera. Mesh nodes with bounding sphere
+    * outside of the frustum are set to ramses::EVisibilityMode::Invisible, all others to ramses::EVisibilityMode::Visible. Visibility is only
+    * set to Ramses when it changes, there is no Lua script or link needed to drive the visibility of the mesh nodes.
+    *
+    * - Property input:
+    *     - bounds (#ramses::EPropertyType::Array of #ramses::EPropertyType::Struct)
+    *         - one element for every mesh node in order as given at creation time, each with
+    *             - center (#ramses::EPropertyType::Vec3f) - center of bounding sphere in local space of the mesh node, (0, 0, 0) by default
+    *             - radius (float) - radius of bounding sphere in local space of the mesh node, 0 by default (only origin of mesh node is tested)
+    * - Property output:
+    *     - visible (#ramses::EPropertyType::Array of #ramses::EPropertyType::Bool)
+    *         - result of the culling test for every mesh node in order as given at creation time
+    *     - visibleCount (#ramses::EPropertyType::Int32)
+    *         - number of mesh nodes which are visible
+    *
+    * Note that the visibility of the mesh nodes is owned by the frustum culling node, it overrides any visibility set to them otherwise
+    * (e.g. via #ramses::NodeBinding of the same node) whenever the culling result changes. Use a #ramses::NodeBinding on a parent node
+    * to hide whole subtrees independently of the culling.
+    *
+    * Important note on update order dependency:
+    * Same as #ramses::AnchorPoint, the calculation does not depend only on input properties but also on states in Ramses scene - node transformations
+    * and camera settings. Transformation changes from #ramses::NodeBinding objects are applied before the culling is done, but dependencies
+    * outside of Ramses logic network (e.g. transformation of a parent node animated without binding) are not tracked,
+    * see #ramses::AnchorPoint for a workaround.
+    *
+    * Performance remark:
+    * Frustum culling node does not use dirtiness mechanism and is updated every time #ramses::LogicEngine::update is called.
+    * Culling many mesh nodes in one frustum culling node is much cheaper than doing the same test in Lua script,
+    * the world matrices are fetched in one batch and the plane tests are done on contiguous arrays.
+    * @ingroup LogicAPI
+    */
+    class RAMSES_API FrustumCullingNode : public LogicNode
+    {
+    public:
+        /**
+        * Returns given ramses camera which is used to calculate the view frustum.
+        *
+        * @return Ramses camera defining the view frustum
+        */
+        [[nodiscard]] const ramses::Camera& getRamsesCamera() const;
+
+        /**
+        * Returns number of mesh nodes tested by this frustum culling node.
+        *
+        * @return number of mesh nodes tested
+        */
+        [[nodiscard]] size_t getMeshNodeCount() const;
+
+        /**
+        * Returns ramses mesh node with given index, index corresponds to the index in input and output arrays.
+        *
+        * @param index index of the mesh node, must be smaller than #getMeshNodeCount
+        * @return Ramses mesh node with visibility controlled by this frustum culling node
+        */
+        [[nodiscard]] const ramses::MeshNode& getRamsesMeshNode(size_t index) const;
+
+        /**
+         * Get the internal data for implementation specifics of #FrustumCullingNode.
+         */
+        [[nodiscard]] internal::FrustumCullingNodeImpl& impl();
+
+        /**
+         * Get the internal data for implementation specifics of #FrustumCullingNode.
+         */
+        [[nodiscard]] const internal::FrustumCullingNodeImpl& impl() const;
+
+    protected:
+        /**
+        * Constructor of FrustumCullingNode. User is not supposed to call this - FrustumCullingNodes are created by other factory classes
+        *
+        * @param impl implementation details of the FrustumCullingNode
+        */
+        explicit FrustumCullingNode(std::unique_ptr<internal::FrustumCullingNodeImpl> impl) noexcept;
+
+        /**
+        * Implementation of FrustumCullingNode
+        */
+        internal::FrustumCullingNodeImpl& m_frustumCullingNodeImpl;
+
+        friend class internal::ApiObjects;
+    };
+}
@@ -18,10 +18,12 @@
 #include "ramses/client/logic/LuaConfig.h"
 #include "ramses/client/logic/PropertyLink.h"
 #include "ramses/client/logic/ELuaSavingMode.h"
+#include "ramses/client/logic/ELuaGarbageCollectorMode.h"
 #include "ramses/framework/DataTypes.h"
 #include "ramses/framework/EFeatureLevel.h"
 
 #include <vector>
+#include <string>
 #include <string_view>
 
 namespace ramses
@@ -68,6 +70,7 @@ namespace ramses
     class AnimationNodeConfig;
     class TimerNode;
     class AnchorPoint;
+    class FrustumCullingNode;
 
     /**
      * Logging mode for the periodic statistics.
@@ -417,6 +420,20 @@ namespace ramses
         */
         AnchorPoint* createAnchorPoint(NodeBinding& nodeBinding, CameraBinding& cameraBinding, std::string_view name ="");
 
+        /**
+        * Creates a new #ramses::FrustumCullingNode which sets visibility of given ramses::MeshNode objects depending on whether their bounding spheres
+        * are within the view frustum of given ramses::Camera.
+        * See #ramses::FrustumCullingNode for more details and usage of this special purpose logic node.
+        *
+        * @param cameraBinding binding referencing ramses::Camera to use for view and projection transformation defining the frustum.
+        * @param meshNodeBindings bindings referencing ramses::MeshNode objects to cull, must not be empty and at most #ramses::MaxArrayPropertySize elements.
+        * @param name a name for the the new #ramses::FrustumCullingNode.
+        * @return a pointer to the created object or nullptr if
+        * something went wrong during creation. In that case, use #ramses::RamsesFramework::getLastError.
+        * The #ramses::FrustumCullingNode can be destroyed by calling the #destroy method
+        */
+        FrustumCullingNode* createFrustumCullingNode(CameraBinding& cameraBinding, const std::vector<MeshNodeBinding*>& meshNodeBindings, std::string_view name ="");
+
         /**
          * Updates all #ramses::LogicNode's which were created by this #LogicEngine instance.
          * The order in which #ramses::LogicNode's are executed is determined by the links created
@@ -432,6 +449,21 @@ namespace ramses
          */
         bool update();
 
+        /**
+         * Updates only the given root #ramses::LogicNode's and all #ramses::LogicNode's linked (directly or indirectly)
+         * to their outputs, in the same order as #update would. This can be used to refresh a self-contained part of
+         * the logic (e.g. a single widget) without paying for the evaluation of unrelated nodes.
+         * Nodes outside of the updated subgraph are not executed, inputs changed on them are kept tracked and they
+         * are executed by the next #update or #updateSubgraph which includes them.
+         * Timer nodes and anchor points are only updated if they are part of the subgraph, skin bindings are always updated.
+         * Unlike #update this never updates nodes in parallel (see #enableParallelUpdate).
+         *
+         * @param rootNodes logic nodes of this #LogicEngine the update starts from
+         * @return true if the update was successful, false otherwise
+         * In case of an error, use #ramses::RamsesFramework::getLastError.
+         */
+        bool updateSubgraph(const std::vector<LogicNode*>& rootNodes);
+
         /**
         * Enables collecting of statistics during call to #update which can be obtained using #getLastUpdateReport.
         * Once enabled every subsequent call to #update will be instructed to collect various statistical data
@@ -460,6 +492,27 @@ namespace ramses
         */
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
 
+        /**
+        * Enables updating of independent #ramses::LogicNode's in parallel during #update.
+        * Logic nodes are grouped by the links between them into levels, nodes of one level do not depend on each other.
+        * #ramses::AnimationNode's of the same level are updated concurrently using worker threads of #ramses::RamsesFramework,
+        * all other logic nodes (i.e. scripts, interfaces and bindings) are still updated one after another in the same order in every #update,
+        * which also applies to the propagation of values via links.
+        * This can reduce the duration of #update if there are many independent animations, e.g. when every widget has its own set of animations.
+        * Parallel update has no effect while update report or profiling is enabled (see #enableUpdateReport, #enableProfiling).
+        * Parallel update is disabled by default.
+        *
+        * @param enable true or false to enable or disable parallel update.
+        */
+        void enableParallelUpdate(bool enable);
+
+        /**
+        * Returns whether parallel update is enabled, see #enableParallelUpdate.
+        *
+        * @return true if parallel update is enabled, false otherwise.
+        */
+        [[nodiscard]] bool isParallelUpdateEnabled() const;
+
         /**
         * Set the logging rate, i.e. how often statistics will be logged. Logging rate of \c N means
         * every \c Nth call to #update statistics will be logged.
@@ -483,6 +536,61 @@ namespace ramses
         */
         void setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode = EStatisticsLogMode::Compact);
 
+        /**
+        * Enables sampling profiler collecting where time is spent during every subsequent call to #update.
+        * Update time of #ramses::LuaScript's is attributed to the Lua functions running in them, which are sampled
+        * every \p luaSamplingPeriod executed Lua instructions, update time of all other logic nodes (bindings, animations, etc.)
+        * is aggregated per type of logic node. The overhead is small enough to use the profiler also in production builds
+        * to find hotspots in Lua code, it mostly depends on the sampling period.
+        * Enabling the profiler discards results collected before, disabling it keeps them available via #getProfilingResults.
+        * Parallel update has no effect while profiling is enabled (see #enableParallelUpdate).
+        *
+        * @param enable true or false to enable or disable profiling.
+        * @param luaSamplingPeriod number of executed Lua instructions between two samples of Lua call stack, lower value gives more precise results for higher overhead.
+        */
+        void enableProfiling(bool enable, uint32_t luaSamplingPeriod = 1000u);
+
+        /**
+        * Returns results collected by profiler (see #enableProfiling) accumulated over all calls to #update since profiling was enabled.
+        * Results are given in 'folded stacks' format which can be directly used to generate a flame graph (e.g. using flamegraph.pl):
+        * every line is one stack of frames separated by semicolon, followed by space and the total time in microseconds spent in the stack,
+        * e.g. \c "LuaScript;myScript;main;run:12;computeOffset:3 1520" or \c "NodeBinding 310".
+        *
+        * @return profiling results in folded stacks format, empty if nothing was collected.
+        */
+        [[nodiscard]] std::string getProfilingResults() const;
+
+        /**
+        * Sets mode and tuning parameters of the Lua garbage collector shared by all #ramses::LuaScript and #ramses::LuaModule instances
+        * of this #LogicEngine. The meaning of the parameters depends on the mode (see Lua 5.4 manual, section 2.5):
+        * - #ramses::ELuaGarbageCollectorMode::Incremental: \p parameter1 is the pause (in percent, memory growth after which a new cycle starts),
+        *   \p parameter2 is the step multiplier (in percent, speed of collection relative to memory allocation)
+        * - #ramses::ELuaGarbageCollectorMode::Generational: \p parameter1 is the minor multiplier (in percent, memory growth after which a minor
+        *   collection runs), \p parameter2 is the major multiplier (in percent, memory growth after which a major collection runs)
+        *
+        * Zero keeps the current value of a parameter. The settings are saved to file together with the logic content.
+        * Default is #ramses::ELuaGarbageCollectorMode::Incremental with Lua default parameters.
+        *
+        * @param mode garbage collector mode to use
+        * @param parameter1 pause or minor multiplier in percent, depending on \p mode
+        * @param parameter2 step multiplier or major multiplier in percent, depending on \p mode
+        * @return true if the mode was set, false if it is not supported by the Lua version used.
+        * In case of an error, use #ramses::RamsesFramework::getLastError.
+        */
+        bool setLuaGarbageCollectorMode(ELuaGarbageCollectorMode mode, uint32_t parameter1 = 0u, uint32_t parameter2 = 0u);
+
+        /**
+        * Moves Lua garbage collection to the end of every #update and limits its amount of work.
+        * With non-zero \p kilobytes the automatic collection (which can run at any allocation, i.e. in the middle of any script)
+        * is stopped and instead a single collection step is performed at the end of every #update (and #updateSubgraph),
+        * doing as much work as if \p kilobytes of memory were allocated. This gives a predictable frame time, but the budget must be large
+        * enough to keep up with the memory allocated by scripts, otherwise Lua memory keeps growing (see #ramses::LogicEngineReport::getLuaMemoryUsage).
+        * Zero (default) restores the automatic collection. The budget is saved to file together with the logic content.
+        *
+        * @param kilobytes work budget of the collection step done during every update, zero for automatic collection
+        */
+        void setLuaGarbageCollectorStepBudget(uint32_t kilobytes);
+
         /**
          * Links a property of a #ramses::LogicNode to another #ramses::Property of another #ramses::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
@@ -772,7 +880,8 @@ namespace ramses
             std::is_same_v<T, DataArray> ||
             std::is_same_v<T, AnimationNode> ||
             std::is_same_v<T, TimerNode> ||
-            std::is_same_v<T, AnchorPoint>,
+            std::is_same_v<T, AnchorPoint> ||
+            std::is_same_v<T, FrustumCullingNode>,
             "Attempting to retrieve invalid type of object.");
     }
 
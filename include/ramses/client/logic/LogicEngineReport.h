@@ -12,6 +12,7 @@
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <cstdint>
 
 namespace ramses::internal
 {
@@ -21,6 +22,7 @@ namespace ramses::internal
 namespace ramses
 {
     class LogicNode;
+    class LuaModule;
 
     /**
     * A collection of results from #ramses::LogicEngine::update which can be used
@@ -81,6 +83,38 @@ namespace ramses
         */
         [[nodiscard]] size_t getTotalLinkActivations() const;
 
+        /// LuaScript with change of Lua memory in bytes
+        using LogicNodeLuaMemory = std::pair<LogicNode*, int64_t>;
+
+        /**
+        * Gets change of Lua memory (in bytes) during execution of every #ramses::LuaScript which was updated,
+        * i.e. the amount of memory the script allocated and kept alive. Memory allocated by scripts is the main driver
+        * of Lua garbage collection, so this helps finding scripts causing collection pauses (see #ramses::LogicEngine::setLuaGarbageCollectorMode).
+        * The change can be negative if garbage collection ran during the script execution and freed memory allocated before.
+        * The order of the scripts in the list matches the order of their execution.
+        *
+        * @return list of updated scripts with change of Lua memory during their execution
+        */
+        [[nodiscard]] const std::vector<LogicNodeLuaMemory>& getLuaMemoryChangePerScript() const;
+
+        /// LuaModule with memory in bytes
+        using LuaModuleMemory = std::pair<LuaModule*, size_t>;
+
+        /**
+        * Gets estimated Lua memory (in bytes) used by every #ramses::LuaModule, measured when the module was created or loaded.
+        * This includes the compiled code of the module and all data it created when loading.
+        *
+        * @return list of all modules with their Lua memory
+        */
+        [[nodiscard]] const std::vector<LuaModuleMemory>& getLuaMemoryPerModule() const;
+
+        /**
+        * Total memory (in bytes) used by the Lua state shared by all scripts and modules at the end of update.
+        *
+        * @return Lua memory in bytes
+        */
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
+
         /**
         * Default constructor of LogicEngineReport.
         */
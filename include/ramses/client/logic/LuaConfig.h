@@ -72,6 +72,15 @@ namespace ramses
          */
         void enableDebugLogFunctions();
 
+        /**
+         * Values assigned to script outputs (numbers and vector tables) are converted without range and rounding checks.
+         * This speeds up scripts which write many numeric outputs, but the script must guarantee that all values fit into
+         * the output type (e.g. no fractional numbers assigned to integer outputs, no values out of range of Int32),
+         * otherwise the resulting value is undefined. Type checks (e.g. assigning a string to a number) are still done.
+         * Only applies to #ramses::LuaScript, the setting is not stored when saving the scene to file.
+         */
+        void enableTrustedNumericConversions();
+
         /**
          * Destructor of #LuaConfig
          */
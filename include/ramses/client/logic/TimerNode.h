@@ -36,11 +36,33 @@ namespace ramses
     * time unit agnostic mode, see inputs/outputs description above for details.
     * Note that unlike other logic nodes a TimerNode is always updated on every #ramses::LogicEngine::update call regardless of if any of its
     * inputs were modified or not.
+    *
+    * Optionally the timer node can advance its output in fixed timesteps (see #setFixedTimestep), this makes all nodes depending
+    * on the ticker (e.g. animations) deterministic regardless of how often and how regularly #ramses::LogicEngine::update is called.
     * @ingroup LogicAPI
     */
     class RAMSES_API TimerNode : public LogicNode
     {
     public:
+        /**
+        * Enables fixed timestep mode, where output 'ticker_us' advances only in whole multiples of given timestep
+        * instead of following the ticker source (system clock or user provided input) exactly.
+        * Every update the time elapsed since last update is accumulated and as many fixed steps as fit into it are taken,
+        * up to \p maxStepsPerUpdate. Any time exceeding this limit is dropped, i.e. on an overloaded system the output falls
+        * behind the ticker source instead of making ever growing jumps. Since the output only changes when a whole step
+        * is taken, nodes linked to it (e.g. animations) are not updated in between steps.
+        * If \p interpolate is enabled the remaining partial step is added to the output, giving smooth output
+        * which still respects the catch-up limit.
+        * The timestep is in the same units as the ticker (microseconds for the system clock).
+        * Note that these settings are not serialized, they have to be set again after loading.
+        *
+        * @param timestep fixed timestep, 0 disables fixed timestep mode (default)
+        * @param maxStepsPerUpdate maximum number of fixed steps taken in a single update, must be greater than 0
+        * @param interpolate whether to add the remaining partial step to the output
+        * @return true if successful, false if timestep is negative or \p maxStepsPerUpdate is 0
+        */
+        bool setFixedTimestep(int64_t timestep, uint32_t maxStepsPerUpdate = 4u, bool interpolate = false);
+
         /**
          * Get the internal data for implementation specifics of TimerNode.
          */
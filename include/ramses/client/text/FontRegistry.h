@@ -92,6 +92,23 @@ namespace ramses
         */
         FontInstanceId          createFreetype2FontInstanceWithHarfBuzz(FontId fontId, uint32_t size, bool forceAutohinting = false);
 
+        /**
+        * @brief Create Freetype2 font instance providing glyphs as signed distance fields
+        *
+        * Instead of coverage, glyph bitmaps store distance to the glyph outline, clamped to \p spread texels and mapped
+        * to [0, 255] with outline at the middle of the range and higher values inside of the glyph. Bitmaps and glyph
+        * metrics are enlarged by \p spread texels on each side. Text lines using such glyphs stay sharp when scaled,
+        * so a single font instance and its atlas entries can serve various text sizes and animated scaling.
+        * Use an effect thresholding the distance, see #ramses::TextCache::CreateDistanceFieldTextEffectDescription.
+        *
+        * @param[in] fontId The id of the font from which to create a font instance
+        * @param[in] size Size (height in rasterized texels of glyphs) of the font, layout of text is done in this size
+        * @param[in] spread Maximum distance (in texels) stored in distance field, must not be 0
+        * @param[in] withHarfBuzz Use Harfbuzz shaping for the font instance
+        * @return The font instance id, FontInstanceId::Invalid() on error
+        */
+        FontInstanceId          createFreetype2FontInstanceWithDistanceField(FontId fontId, uint32_t size, uint32_t spread = 4u, bool withHarfBuzz = false);
+
         /**
         * @brief Delete an existing font
         *
@@ -10,6 +10,7 @@
 
 #include "ramses/client/text/TextLine.h"
 #include "ramses/client/text/FontInstanceOffsets.h"
+#include "ramses/client/EffectDescription.h"
 #include <string>
 
 namespace ramses
@@ -158,6 +159,21 @@ namespace ramses
         */
         TextLineId createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect);
 
+        /**
+        * @brief Update an existing text line to show different glyphs (e.g. a label whose text changes often)
+        *
+        * Unlike deleting the text line and creating a new one, the scene objects of the text line (mesh node, appearance, geometry)
+        * are kept and only the content of its vertex and index buffers is updated. The buffers are replaced only if the new text
+        * needs more space than available, in that case they are created with some headroom for following updates.
+        * Texture of the appearance is changed if the glyphs are placed in a different atlas page.
+        * The same requirements as in createTextLine() apply to \p glyphs. On failure the text line is left unchanged.
+        *
+        * @param[in] textId Id of the text line to update
+        * @param[in] glyphs The glyph metrics to show in the text line
+        * @return True on success, false otherwise
+        */
+        bool updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
+
         /**
         * @brief Get a const pointer to a (previously created) text line object
         * @param[in] textId Id of the text line object to get
@@ -188,6 +204,19 @@ namespace ramses
         */
         static bool ContainsRenderableGlyphs(const GlyphMetricsVector& glyphMetrics);
 
+        /**
+        * @brief Create description of default effect for text lines using glyphs of a distance field font instance
+        *        (see #ramses::FontRegistry::createFreetype2FontInstanceWithDistanceField).
+        *
+        * The effect thresholds the distance at glyph outline with anti-aliasing adapted to current scale of the text,
+        * so the text stays sharp when its mesh node is scaled. It has all semantic inputs required by createTextLine()
+        * plus a uniform "u_color" (vec4) which must be set on appearance of the text line. Text lines need blending
+        * enabled (source alpha, one minus source alpha) as edges are rendered with partial alpha.
+        * The shaders require GLSL ES 3.00.
+        * @return The effect description
+        */
+        static EffectDescription CreateDistanceFieldTextEffectDescription();
+
         /**
         * @brief Apply character tracking (positive or negative) to each glyph in provided GlyphMetricsVector.
         * This means that that the space between the individual glyphs can be increased (positive tracking) or decreased (negative tracking).
@@ -52,9 +52,14 @@ namespace ramses
         /// Added features: Uniform buffer objects
         EFeatureLevel_02 = 2,
 
+        /// Added features: Render pass state sorting, mesh bounding sphere and instance culling,
+        /// render pass front to back and back to front sorting and depth pre-pass, bulk node transformation updates,
+        /// scene reference preloading, mesh levels of detail, end of time uniform animation
+        EFeatureLevel_03 = 3,
+
         /// Equals to the latest feature level
         /// Avoid using this enum in application code because it will change also in minor releases when new feature level is added!
         /// Use concrete feature level when instantiating Ramses framework, level which matches desired use case or supports certain asset.
-        EFeatureLevel_Latest = EFeatureLevel_02
+        EFeatureLevel_Latest = EFeatureLevel_03
     };
 }
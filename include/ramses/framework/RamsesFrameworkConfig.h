@@ -15,6 +15,8 @@
 #include <memory>
 #include <chrono>
 #include <string_view>
+#include <vector>
+#include <cstdint>
 
 namespace ramses
 {
@@ -184,6 +186,25 @@ namespace ramses
         */
         void setLoggingInstanceName(std::string_view instanceName);
 
+        /**
+        * @brief Enables dispatching of log messages on a background thread
+        *
+        * By default log messages are written to all log outputs (console, DLT, log handler set by #ramses::RamsesFramework::SetLogHandler)
+        * on the thread that logs them. With asynchronous logging every logging thread queues its messages and a background thread
+        * writes them, so that e.g. the render thread does not wait for slow log outputs. Fatal messages are still written immediately.
+        * The log handler is then called from the background thread.
+        * Asynchronous logging is shared by all framework instances of a process, it is enabled by the first framework created with it
+        * and stays active until the process exits.
+        * Default is disabled.
+        *
+        * @param[in] enable true to enable asynchronous logging
+        * @param[in] queueCapacity maximum number of messages queued per logging thread, must be greater than 0
+        * @param[in] dropOnOverflow if true, messages are dropped when the queue of a thread is full and the number of dropped messages is logged,
+        *                           if false, the logging thread waits until there is space in its queue
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsynchronousLogging(bool enable, uint32_t queueCapacity, bool dropOnOverflow);
+
         /**
         * @brief Sets the participant identifier
         *
@@ -256,6 +277,70 @@ namespace ramses
         */
         bool setConnectionKeepaliveSettings(std::chrono::milliseconds interval, std::chrono::milliseconds timeout);
 
+        /**
+        * @brief Enables LZ4 compression of large scene updates sent over TCP
+        *
+        * Scene actions of a flush are compressed before sending if they exceed a size threshold, resources are always sent compressed.
+        * Compression is only used towards participants which enabled it as well, others keep receiving uncompressed scene updates.
+        * This reduces network load for big scene updates at the expense of CPU time on both the client and the renderer side.
+        * Disabled by default.
+        *
+        * @param[in] enabled true to enable compression of scene updates
+        */
+        void setSceneUpdateCompressionForTCPCommunication(bool enabled);
+
+        /**
+        * @brief Limits the amount of data queued for sending to a single participant over TCP
+        *
+        * When a remote renderer receives scene updates slower than they are flushed, pending data is queued on the sender side.
+        * If the queued data for a participant would exceed the given limit, the participant is considered too slow and the
+        * connection to it is dropped, releasing the queued data. All pending flushes for it are discarded,
+        * after reconnecting the renderer receives the current state of the scenes it subscribes again.
+        * The connection status change is reported like any other disconnect.
+        * Default is 0, which means the queue is not limited.
+        *
+        * @param[in] limitInBytes maximum number of bytes queued for a participant, 0 for no limit
+        */
+        void setSendQueueLimitForTCPCommunication(size_t limitInBytes);
+
+        /**
+        * @brief Sets the number of worker threads executing background tasks of the framework
+        *
+        * Worker threads are used e.g. for asynchronous scene loading, resource compression and deferred deletion of scenes.
+        * Each worker has its own task queue and takes over tasks queued for other workers when it would otherwise be idle.
+        * Default is 3 threads.
+        *
+        * @param[in] threadCount number of worker threads, must be between 1 and 256
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setWorkerThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Restricts the worker threads to run only on the given CPUs
+        *
+        * The affinity is applied to all worker threads (see #setWorkerThreadCount), it is not supported on all platforms.
+        * If applying it fails, a warning is logged and the threads run without restriction.
+        * Default is an empty list, which means no restriction.
+        *
+        * @param[in] cpuIds indices of CPUs the worker threads may run on
+        */
+        void setWorkerThreadCpuAffinity(const std::vector<uint32_t>& cpuIds);
+
+        /**
+        * @brief Sets a file used to persist effects compiled by clients of the framework
+        *
+        * Creating an effect from GLSL sources requires parsing and compiling the shaders, which is expensive.
+        * Clients keep compiled effects in a cache, which is used when an effect is created again with same shader sources,
+        * compiler defines, semantics, render backend compatibility and feature level.
+        * When a file is set, the cache is loaded from it when a client is created and saved back to it when the client is destroyed,
+        * so that also effects created on previous start do not need to be compiled again.
+        * A file created by a different ramses version or a corrupt file is ignored and overwritten.
+        * Default is an empty path, which means compiled effects are cached only for the lifetime of a client.
+        *
+        * @param[in] filePath path of the cache file, should not be shared by multiple clients running at the same time
+        */
+        void setEffectCompilationCacheFile(std::string_view filePath);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
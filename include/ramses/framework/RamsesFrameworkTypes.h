@@ -261,4 +261,16 @@ namespace ramses
         TCP,
         Off
     };
+
+    /**
+    * @brief Scheduling policy of a thread
+    *
+    * Realtime policies (#Fifo, #RoundRobin) typically require elevated privileges of the process (e.g. CAP_SYS_NICE on Linux).
+    */
+    enum class EThreadSchedulingPolicy
+    {
+        Default,    ///< Default time sharing scheduling of the platform (SCHED_OTHER on POSIX), priority must be 0
+        Fifo,       ///< Realtime first in first out scheduling (SCHED_FIFO on POSIX)
+        RoundRobin  ///< Realtime round robin scheduling (SCHED_RR on POSIX)
+    };
 }
@@ -116,6 +116,28 @@ namespace ramses
         */
         bool loadFromFile(std::string_view filePath);
 
+        /**
+        * @brief Makes the cache persistent using the file with the given path
+        *
+        *  Binary shaders are loaded from the file and the cache is saved back to it when destroyed,
+        *  if any binary shader was stored or evicted meanwhile. The file is replaced atomically, a temporary file
+        *  next to it is written first, so an interrupted save never leaves a corrupt cache behind.
+        *
+        *  Cached binary shaders are discarded automatically if the file was created by a different version of Ramses
+        *  or on a device reporting different binary shader formats (see #deviceSupportsBinaryShaderFormats),
+        *  which is the case for a different GPU or driver. Single binary shaders which fail to upload are evicted
+        *  and replaced by newly compiled ones.
+        *
+        *  With \c warmUp enabled the file is loaded right away in a background thread, typically while the renderer
+        *  and its displays are being created, the first query to cache waits for the loading to finish.
+        *  Otherwise the file is loaded when the device reports its supported binary shader formats.
+        *
+        * @param filePath the path of the file to load and save binary shaders
+        * @param warmUp true to start loading the file in the background immediately
+        * @return true on success, false if persistence was already enabled or the file path is empty
+        */
+        bool enablePersistence(std::string_view filePath, bool warmUp);
+
         /**
         * @brief Used by RamsesRenderer to provide a callback with information on the result of a binary shader upload operation.
         *
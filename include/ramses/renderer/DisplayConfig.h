@@ -12,6 +12,7 @@
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/DataTypes.h"
 #include <memory>
+#include <vector>
 
 namespace ramses
 {
@@ -235,7 +236,8 @@ namespace ramses
         *        Uploaded resources are kept in GPU memory even if not in use by any scene anymore.
         *        They are only freed from memory in order to make space for new resources to be uploaded
         *        which would not fit in the cache otherwise.
-        *        First in first out method is used when deciding which unused resource to remove from cache.
+        *        Unused resources of scenes with less priority (#setScenePriority) are removed first, after that
+        *        resources which are cheap to upload again relative to how long they have been unused.
         *
         *        Note that the cache size does not act as hard limit, the renderer can still upload
         *        resources taking up more space. As long as cache limit is exceeded, newly unused resources are unloaded
@@ -451,6 +453,23 @@ namespace ramses
         */
         bool setWaylandEmbeddedCompositingSocketPermissions(uint32_t permissions);
 
+        /**
+        * @brief       Enables dispatching of embedded compositing client requests in a dedicated thread.
+        *
+        * @details     By default the embedded compositor handles requests of its clients (e.g. buffer attach and commit)
+        *              in the render loop of the display, once per frame. So a burst of client requests delays the frame
+        *              and a long frame delays handling of client requests.
+        *              If enabled, client requests are dispatched by a dedicated thread as soon as they arrive,
+        *              the display only picks up the committed buffers when rendering a frame.
+        *              Frame callbacks are still sent to clients after the frame was rendered.
+        *
+        *              Disabled by default. Only has effect if an embedded compositor is created for this display.
+        *
+        * @param[in]   enable true to dispatch client requests in a dedicated thread, false to dispatch them in render loop
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setWaylandEmbeddedCompositingEventThread(bool enable);
+
         /**
         * @brief Set the Wayland display name to connect system compositor to.
         *        This will override the default behavior which is to use WAYLAND_DISPLAY environment variable
@@ -498,7 +517,9 @@ namespace ramses
         * The renderer will apply scene updates according to scene priority so that there will be less latency between
         * client scene flush and rendering for scenes with higher priority. This could result in more latency for scenes with less priority.
         * This setting should be used in combination with time budgets for resource uploads (#ramses::RamsesRenderer::setFrameTimerLimits)
-        * to get the desired effect.
+        * to get the desired effect. Once the scene resources upload budget of a frame is exceeded, flushes of scenes with less
+        * than the highest priority are deferred to next frame. Deferred flushes are applied regardless of the budget once
+        * their count exceeds the force apply limit (#ramses::RamsesRenderer::setPendingFlushLimits), which is logged as warning.
         *
         * Default priority is 0. Higher values mean less priority.
         * (Use negative values to increase priority)
@@ -509,13 +530,53 @@ namespace ramses
         */
         bool setScenePriority(sceneId_t sceneId, int32_t priority);
 
+        /**
+        * @brief Enables prefetching of the scene's resources on this display
+        *
+        * Normally the resources of a scene are uploaded to this display only once the scene is requested to be
+        * at least #ramses::RendererSceneState::Ready, which delays showing the scene for the first time.
+        * If prefetching is enabled, the resources of a scene which is subscribed (#ramses::RendererSceneState::Available)
+        * but not yet ready are uploaded ahead of time, using time left in frame after all other updates.
+        * Prefetching always yields to scenes being made ready, so it does not delay them.
+        * Once the prefetched scene is requested to become #ramses::RendererSceneState::Ready, it can be mapped
+        * without waiting for its resources.
+        *
+        * Prefetched resources are kept in GPU memory as resources in use until the scene is mapped or unsubscribed.
+        * Prefetching is disabled by default for all scenes.
+        *
+        * @param[in] sceneId scene id of the scene to prefetch
+        * @param[in] enable true to enable prefetching, false to disable
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setScenePrefetch(sceneId_t sceneId, bool enable);
+
+        /**
+        * @brief Enables progressive mapping of the scene on this display
+        *
+        * Normally a scene requested to be #ramses::RendererSceneState::Ready is mapped only once all resources it uses
+        * are uploaded to this display, so that a large scene is shown all at once but late.
+        * If progressive mapping is enabled, the scene is mapped as soon as it has no pending flushes, regardless of its
+        * resources. Renderables whose resources are uploaded are drawn right away, renderables still waiting
+        * for any of their resources are skipped until these are uploaded.
+        * Once all resources in use by the scene are uploaded, #ramses::IRendererSceneControlEventHandler::sceneResourcesComplete
+        * is emitted for the scene.
+        *
+        * Progressive mapping is disabled by default for all scenes.
+        *
+        * @param[in] sceneId scene id of the scene to map progressively
+        * @param[in] enable true to enable progressive mapping, false to disable
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setSceneProgressiveMapping(sceneId_t sceneId, bool enable);
+
         /**
         * @brief Sets the batch size for resource uploads
         *
-        * The resource upload batch size defines the number of resources that should be uploaded in a single step.
-        * Time budgets (#ramses::RamsesRenderer::setFrameTimerLimits) are checked at the latest when a batch was uploaded.
-        * It should be safe to configure a batch size of 1 unless time measurement has a significant performance impact
-        * on the target device.
+        * The resource upload batch size defines the number of resources that are requested for upload in a single step
+        * for scenes being prefetched (see #setScenePrefetch).
+        * Resource uploads themselves are scheduled within the time budget (#ramses::RamsesRenderer::setFrameTimerLimits)
+        * regardless of batch size: a resource is uploaded only if its estimated upload time fits into the time left,
+        * estimates are based on resource type and size and adapt to upload times measured on the device.
         * The batch size may not be 0.
         *
         * @param[in] batchSize the number of resources to upload in a single step (default: 10)
@@ -523,6 +584,157 @@ namespace ramses
         */
         bool setResourceUploadBatchSize(uint32_t batchSize);
 
+        /**
+        * @brief Enables frame pacing and limits the number of frames the GPU may lag behind the renderer
+        *
+        * Without frame pacing the renderer relies on buffer swap and the framerate limit (#ramses::RamsesRenderer::setFramerateLimit)
+        * to control its loop, so it either blocks inside the driver's buffer swap or renders frames ahead of the GPU,
+        * both adding latency between content update and its presentation.
+        * With frame pacing the renderer inserts a GPU fence after every frame and waits before swapping if more
+        * than the given number of frames were not finished by the GPU yet. Additionally the renderer measures
+        * the cost of its frames and delays start of the next frame so that it finishes just in time for the frame period
+        * given by the framerate limit, instead of finishing early and waiting afterwards.
+        * Fences are only supported on EGL platforms providing EGL_KHR_fence_sync, on other platforms only the frame start is delayed.
+        * Late frame start only has effect in threaded mode (#ramses::RamsesRenderer::startThread).
+        *
+        * @param[in] maxFramesInFlight number of frames which may be processed by GPU at the same time, 0 disables frame pacing (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setMaxFramesInFlight(uint32_t maxFramesInFlight);
+
+        /**
+        * @brief Sets number of worker threads used to apply pending scene flushes of multiple scenes in parallel
+        *
+        * By default flushes of all scenes are applied one scene after another on the render thread of the display.
+        * With worker threads the scene updates of mutually independent scenes are applied concurrently, the render thread
+        * takes part in applying them. Bookkeeping of applied flushes (events, statistics, resources) stays serial.
+        * Scenes which have data links to or from other scenes or receive data slot changes in their flushes are always updated
+        * on the render thread. Flushes are also applied serially when scene priorities are set (#setScenePriority),
+        * because deferring flushes by priority depends on time spent on applying flushes of preceding scenes.
+        *
+        * @param[in] threadCount number of worker threads, 0 disables parallel flush application (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setFlushApplyThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables applying of large scene flushes on a background thread
+        *
+        * Applying a large flush (typically the initial content of a scene) on the render thread blocks rendering of all other
+        * scenes on the display. With this option pending flushes of a scene which contain at least the given number of scene actions
+        * are applied on a background thread and the scene is updated with them in one of the following frames,
+        * rendering of other scenes continues meanwhile. This is done only for scenes which are subscribed but not mapped
+        * (i.e. not used for rendering yet), have no data links to or from other scenes and receive no data slot changes
+        * in their flushes. Mapping of a scene is delayed until its flushes are applied.
+        *
+        * @param[in] minSceneActions minimum number of scene actions in pending flushes of a scene to be applied asynchronously,
+        *                            0 disables asynchronous flush application (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsyncFlushApplyThreshold(uint32_t minSceneActions);
+
+        /**
+        * @brief Enables rendering of scalable offscreen buffers at reduced resolution under GPU load
+        *
+        * When enabled, the renderer measures GPU time of every frame using GPU timer queries. When the GPU frame time exceeds the given threshold
+        * for several consecutive frames, offscreen buffers marked as scalable (see #ramses::RamsesRenderer::setOffscreenBufferScalable)
+        * are rendered at half of their resolution and scaled up into the offscreen buffer afterwards, consumers of the offscreen buffer
+        * are not affected otherwise. Full resolution is restored when the GPU frame time stays clearly below the threshold for a longer period.
+        * Measuring is only possible if the device supports GPU timer queries.
+        *
+        * @param[in] microseconds GPU frame time threshold in microseconds, 0 disables scaling (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setOffscreenBufferScalingGpuTimeThreshold(uint32_t microseconds);
+
+        /**
+        * @brief Enables waiting of the display's render thread while there is nothing to update or render
+        *
+        * By default the render thread of a display loops at the framerate limit (#ramses::RamsesRenderer::setFramerateLimit)
+        * also when nothing changes, unmodified scenes are only not re-rendered.
+        * If enabled, the render thread stops looping as soon as a frame leaves no work behind and waits until it receives
+        * a renderer command or scene flush, or until the embedded compositor dispatches requests of its clients
+        * (only if the embedded compositor dispatches them in its own thread, see #setWaylandEmbeddedCompositingEventThread,
+        * otherwise the render thread keeps looping while there are embedded compositing clients connected).
+        * The render thread keeps looping while any scene has pending flushes, an active shader animation, is monitored for expiration
+        * or while a screenshot or rendering interrupted by time budget is pending.
+        * The wait is only interrupted periodically to notify the watchdog (see #ramses::RamsesFrameworkConfig::setWatchdogNotificationInterval),
+        * window events (e.g. input or resize) are therefore handled with a delay of up to the watchdog notification interval while waiting.
+        * Only has effect in threaded mode (#ramses::RamsesRenderer::startThread).
+        *
+        * @param[in] enable true to wait while idle, false to loop at framerate limit (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setIdleWaitEnabled(bool enable);
+
+        /**
+        * @brief Limits the number of render once passes (#ramses::RenderPass::setRenderOnce) rendered per scene in a single frame
+        *
+        * Render once passes (e.g. baked shadow maps or reflections) are all rendered in the first frame after they were triggered,
+        * which is typically when a scene is shown and can result in a single very long frame.
+        * With a limit set the pending render once passes of a scene are spread over several frames, in their render order,
+        * so that a pass consuming the output of another render once pass is rendered together with or after it.
+        * When a scene is shown and has more pending render once passes than the limit, only these passes are rendered
+        * in the frames until the last of them is rendered, the scene is rendered completely and reported as shown
+        * (#ramses::IRendererSceneControlEventHandler::sceneStateChanged) only in that frame.
+        *
+        * @param[in] maxPasses maximum number of render once passes rendered per scene in a frame, 0 for no limit (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setRenderOncePassesPerFrameLimit(uint32_t maxPasses);
+
+        /**
+        * @brief Enables handling of pick events (#ramses::RendererSceneControl::handlePickEvent) on a background thread
+        *
+        * By default every pick event is checked for intersections with pickable objects of the scene on the render thread
+        * when the command is executed, continuous input (e.g. touch drag) with a pick event per input event can therefore
+        * add a considerable amount of work to the render thread.
+        * With this option enabled pick events are collected per frame and only the latest pick event of each scene is kept.
+        * The render thread takes a snapshot of the scene's pickable objects (camera and world matrices, geometry)
+        * and the intersections are checked against it on a background thread. The result is reported
+        * (#ramses::IRendererSceneControlEventHandler::objectsPicked) in one of the following frames.
+        *
+        * @param[in] enable true to handle pick events asynchronously, false to handle them on the render thread (default)
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setAsyncPickingEnabled(bool enable);
+
+        /**
+        * @brief Sets scheduling policy, priority and CPU affinity of the display's render thread
+        *
+        * Other processes running with same or higher priority may preempt the render thread and make it miss vsync,
+        * a realtime policy with a priority above them avoids that. Restricting the thread to dedicated CPUs additionally
+        * avoids migrating it between CPUs and competing with other threads for the same CPU.
+        * The scheduling is applied by the thread itself when it starts, if applying it fails (e.g. realtime policies usually require
+        * elevated privileges of the process, CPU affinity is not supported on all platforms) a warning is logged and the thread
+        * keeps running with the scheduling it was started with. The scheduling the thread actually runs with is logged at start.
+        * Only has effect in threaded mode (#ramses::RamsesRenderer::startThread).
+        * Default is #ramses::EThreadSchedulingPolicy::Default with priority 0 and no CPU restriction.
+        *
+        * @param[in] policy scheduling policy of the thread
+        * @param[in] priority priority of the thread, must be 0 for #ramses::EThreadSchedulingPolicy::Default and between 1 and 99 for realtime policies
+        * @param[in] cpuAffinity indices of CPUs the thread may run on, empty for no restriction
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setDisplayThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity);
+
+        /**
+        * @brief Sets scheduling policy, priority and CPU affinity of the display's asynchronous effect upload thread
+        *
+        * The effect upload thread compiles and uploads shaders in a shared context (see #setAsyncEffectUploadEnabled),
+        * typically it should run with lower priority than the render thread (see #setDisplayThreadScheduling) or on other CPUs
+        * so that compiling shaders does not delay rendering of frames.
+        * Same rules for applying the scheduling apply as for #setDisplayThreadScheduling, but the effect upload thread
+        * is used also when the renderer is not running in threaded mode.
+        * Default is #ramses::EThreadSchedulingPolicy::Default with priority 0 and no CPU restriction.
+        *
+        * @param[in] policy scheduling policy of the thread
+        * @param[in] priority priority of the thread, must be 0 for #ramses::EThreadSchedulingPolicy::Default and between 1 and 99 for realtime policies
+        * @param[in] cpuAffinity indices of CPUs the thread may run on, empty for no restriction
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setEffectUploadThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -138,6 +138,127 @@ namespace ramses
             (void)averageLooptime;
         }
 
+        /**
+        * @brief This method will be called together with #renderThreadLoopTimings and provides distribution of loop (frame) times
+        *        within the same measure period as percentiles.
+        *
+        * Percentiles are taken from a histogram with a resolution of 250 microseconds, i.e. reported value is the upper bound of the histogram bucket.
+        * Loop times above 100 milliseconds are all reported as the maximum loop time.
+        *
+        * @param[in] displayId The display the timing information is for
+        * @param[in] percentile50 Loop time not exceeded by 50% of loops (median) within the last measure period
+        * @param[in] percentile90 Loop time not exceeded by 90% of loops within the last measure period
+        * @param[in] percentile99 Loop time not exceeded by 99% of loops within the last measure period
+        */
+        virtual void renderThreadLoopTimingPercentiles(displayId_t displayId, std::chrono::microseconds percentile50, std::chrono::microseconds percentile90, std::chrono::microseconds percentile99)
+        {
+            (void)displayId;
+            (void)percentile50;
+            (void)percentile90;
+            (void)percentile99;
+        }
+
+        /**
+        * @brief This method will be called together with #renderThreadLoopTimings for every scene which has resources uploaded
+        *        to the display and provides estimated GPU memory used by the scene.
+        *
+        * Resources used by multiple scenes are split evenly among them, the share is also reported in #ramses::GpuMemoryUsage::shared.
+        *
+        * @param[in] displayId The display the scene resources are uploaded to
+        * @param[in] sceneId The scene the memory usage is for
+        * @param[in] usage Estimated GPU memory used by the scene
+        */
+        virtual void sceneGpuMemoryUsage(displayId_t displayId, sceneId_t sceneId, const GpuMemoryUsage& usage)
+        {
+            (void)displayId;
+            (void)sceneId;
+            (void)usage;
+        }
+
+        /**
+        * @brief This method will be called together with #renderThreadLoopTimings and provides estimated GPU memory used by the display in total,
+        *        i.e. sum of all scenes, offscreen buffers and resources which are not used by any scene but kept in GPU cache.
+        *
+        * @param[in] displayId The display the memory usage is for
+        * @param[in] totalUsage Estimated GPU memory used by the display in total
+        * @param[in] gpuCacheSize GPU cache size configured for the display (#ramses::DisplayConfig::setGPUMemoryCacheSize)
+        */
+        virtual void displayGpuMemoryUsage(displayId_t displayId, const GpuMemoryUsage& totalUsage, uint64_t gpuCacheSize)
+        {
+            (void)displayId;
+            (void)totalUsage;
+            (void)gpuCacheSize;
+        }
+
+        /**
+        * @brief This method will be called when a frame was presented on display which was the first frame containing a flush
+        *        with a valid scene version tag (see #ramses::Scene::flush). Only supported on Wayland when the system compositor
+        *        provides presentation time feedback (wp_presentation), other platforms never call this method.
+        *
+        * @param[in] displayId The display the frame was presented on
+        * @param[in] sceneId The scene the flush belongs to
+        * @param[in] sceneVersionTag The version tag of the presented flush
+        * @param[in] presentationTimestamp Time when the frame was presented, in the synchronized clock domain used for flush and expiration timestamps
+        * @param[in] flushLatency Time from flush of the scene on client side until presentation of the frame
+        */
+        virtual void sceneFlushPresented(displayId_t displayId, sceneId_t sceneId, sceneVersionTag_t sceneVersionTag, std::chrono::microseconds presentationTimestamp, std::chrono::microseconds flushLatency)
+        {
+            (void)displayId;
+            (void)sceneId;
+            (void)sceneVersionTag;
+            (void)presentationTimestamp;
+            (void)flushLatency;
+        }
+
+        /**
+        * @brief This method will be called after resources unused by any scene were unloaded from display
+        *        as a result of RamsesRenderer API \c trimMemory call. Called for every display.
+        *
+        * @param[in] displayId The display the resources were unloaded from
+        * @param[in] freedMemory Estimated size of GPU memory freed on the display in bytes
+        */
+        virtual void memoryTrimmed(displayId_t displayId, uint64_t freedMemory)
+        {
+            (void)displayId;
+            (void)freedMemory;
+        }
+
+        /**
+        * @brief This method will be called for every frame a DMA offscreen buffer was rendered in,
+        *        if enabled using RamsesRenderer API \c setDmaOffscreenBufferSyncFenceEnabled.
+        *
+        * @param[in] displayId The display the DMA offscreen buffer belongs to
+        * @param[in] offscreenBufferId The DMA offscreen buffer which was rendered
+        * @param[in] syncFenceFD Sync file descriptor which becomes readable once GPU finished rendering the frame into the buffer,
+        *                        ownership is passed to the application which has to close it. -1 if native fence sync is not supported.
+        */
+        virtual void dmaOffscreenBufferRendered(displayId_t displayId, displayBufferId_t offscreenBufferId, int syncFenceFD)
+        {
+            (void)displayId;
+            (void)offscreenBufferId;
+            (void)syncFenceFD;
+        }
+
+        /**
+        * @brief This method will be called when a DMA buffer provided using RamsesRenderer API \c updateExternalBufferFromDmaBuffer
+        *        is no longer used by the renderer, because it was replaced by another one, failed to be imported
+        *        or the external buffer was destroyed.
+        *
+        * @param[in] displayId The display the external buffer belongs to
+        * @param[in] externalBufferId The external buffer which used the DMA buffer
+        * @param[in] dmaBufferFD File descriptor of the released DMA buffer as provided by the application
+        * @param[in] releaseFenceFD Sync file descriptor which becomes readable once GPU finished sampling the DMA buffer, the DMA buffer
+        *                           must not be modified before. Ownership is passed to the application which has to close it.
+        *                           -1 if there is nothing to wait for or native fence sync is not supported.
+        */
+        virtual void externalBufferDmaBufferReleased(displayId_t displayId, externalBufferId_t externalBufferId, int dmaBufferFD, int releaseFenceFD)
+        {
+            (void)displayId;
+            (void)externalBufferId;
+            (void)dmaBufferFD;
+            (void)releaseFenceFD;
+        }
+
         /**
         * @brief This method will be called after an external buffer is created (or failed to be created) as a result of RamsesRenderer API \c createExternalBuffer call.
         *
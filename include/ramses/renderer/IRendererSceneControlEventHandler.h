@@ -140,6 +140,19 @@ namespace ramses
         */
         virtual void sceneFlushed(sceneId_t sceneId, sceneVersionTag_t sceneVersionTag) = 0;
 
+        /**
+        * @brief This method will be called for a scene mapped progressively (#ramses::DisplayConfig::setSceneProgressiveMapping)
+        *        once all resources in use by the scene are uploaded, i.e. from this point on all of its renderables are drawn.
+        *        The scene reached #ramses::RendererSceneState::Ready before this event already, possibly with renderables skipped
+        *        because their resources were still being uploaded.
+        *        This callback is called only once per mapping of the scene.
+        * @param sceneId The scene id of the scene which has all its resources uploaded
+        */
+        virtual void sceneResourcesComplete(sceneId_t sceneId)
+        {
+            (void)sceneId;
+        }
+
         /**
         * @brief This method will be called whenever a scene which was not previously monitored for expiration has requested expiration
         *        monitoring by sending a scene flush with valid expiration timestamp (#ramses::Scene::setExpirationTimestamp)
@@ -334,6 +347,14 @@ namespace ramses
             (void)sceneVersionTag;
         }
 
+        /**
+        * @copydoc ramses::IRendererSceneControlEventHandler::sceneResourcesComplete
+        */
+        void sceneResourcesComplete(sceneId_t sceneId) override
+        {
+            (void)sceneId;
+        }
+
         /**
         * @copydoc ramses::IRendererSceneControlEventHandler::sceneExpirationMonitoringEnabled
         */
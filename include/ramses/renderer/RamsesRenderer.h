@@ -172,6 +172,8 @@ namespace ramses
         * It is advisable to set forceUnsubscribeSceneLimit to higher number than forceApplyFlushLimit,
         * because re-subscribing a scene is causing a lot of network traffic and unnecessary memory operations, not to mention the
         * scene is then also not visible until re-subscribed, mapped and shown.
+        * The force apply limit also applies to flushes deferred because of an exceeded frame budget when scene priorities
+        * are used (#ramses::DisplayConfig::setScenePriority). Default limit is 120 flushes.
         *
         * @param[in] forceApplyFlushLimit Number of flushes that can be pending before force applying occurs.
         * @param[in] forceUnsubscribeSceneLimit Number of flushes that can be pending before force un-subscribe occurs.
@@ -192,6 +194,20 @@ namespace ramses
         */
         bool setSkippingOfUnmodifiedBuffers(bool enable = true);
 
+        /**
+        * @brief     Unload all resources which are not used by any scene from all displays.
+        *            Resources no longer used by any scene are kept uploaded up to the GPU cache size
+        *            (#ramses::DisplayConfig::setGPUMemoryCacheSize) so that they can be reused without upload.
+        *            This call unloads all of them regardless of the cache size, displays and resources used by scenes are not affected.
+        *            It is meant to be called when the platform reports low memory, e.g. from Android's \c onTrimMemory
+        *            or iOS's \c didReceiveMemoryWarning, as an alternative to destroying and re-creating displays.
+        *            The command is sent with next #flush, amount of memory freed on each display is reported
+        *            using #ramses::IRendererEventHandler::memoryTrimmed.
+        *
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool trimMemory();
+
         /**
          * @brief Creates a display based on provided display config.
          *        Creation of a display is an asynchronous action and the display will be created during the next render loop.
@@ -339,6 +355,24 @@ namespace ramses
         */
         bool getDmaOffscreenBufferFDAndStride(displayId_t display, displayBufferId_t displayBufferId, int& fd, uint32_t& stride) const;
 
+        /**
+        * @brief   Enables notification with a sync fence whenever a DMA offscreen buffer was rendered.
+        * @details When enabled, #ramses::IRendererEventHandler::dmaOffscreenBufferRendered is called for every frame
+        *          the DMA offscreen buffer was rendered in. The event provides a sync file descriptor which signals
+        *          once the GPU finished all rendering of that frame, so that the application can access the mapped buffer
+        *          memory (see #getDmaOffscreenBufferFDAndStride) from CPU without stalling the renderer, e.g. by polling the FD
+        *          for readability instead of waiting for the whole GPU pipeline.
+        *          Sync fences are available only on platforms supporting EGL_ANDROID_native_fence_sync, otherwise the event
+        *          provides -1 as FD and the application has to fall back to other means of synchronization.
+        *          The setting is disabled by default and is reset when the offscreen buffer is destroyed.
+        *
+        * @param[in] display Id of display that the DMA offscreen buffer belongs to.
+        * @param[in] offscreenBuffer Id of DMA offscreen buffer created using #createDmaOffscreenBuffer.
+        * @param[in] enable Whether to create a sync fence and event for every frame the buffer was rendered in.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setDmaOffscreenBufferSyncFenceEnabled(displayId_t display, displayBufferId_t offscreenBuffer, bool enable);
+
         /**
         * @brief Will destroy a previously created offscreen buffer.
         *        If there are any consumer texture samplers linked to this buffer, these links will be removed.
@@ -391,6 +425,56 @@ namespace ramses
         */
         bool destroyExternalBuffer(displayId_t display, externalBufferId_t externalBuffer);
 
+        /**
+        * @brief   Uses a DMA buffer provided by the application as content of an external buffer.
+        * @details The DMA buffer, e.g. a frame captured by a V4L2 camera or produced by a video decoder, is imported by the renderer
+        *          as EGL image and directly sampled by the texture sampler linked to the external buffer without any copy,
+        *          the application does not need to make any GL calls on the renderer's context.
+        *          The DMA buffer is used until it gets replaced by another call to this method or until the external buffer
+        *          or its display is destroyed, then #ramses::IRendererEventHandler::externalBufferDmaBufferReleased is called
+        *          with a release fence which signals when the GPU finished sampling it, so that the application can recycle
+        *          the buffer (e.g. queue it back to the producer) once fence is signaled.
+        *          The file descriptor stays owned by the application and must stay valid until the buffer is released.
+        *          If the DMA buffer cannot be imported, it is released right away and the previous content stays in use.
+        *
+        *          Only single plane buffer formats are supported (e.g. DRM_FORMAT_YUYV, DRM_FORMAT_XRGB8888),
+        *          the display must support DMA buffers (see #ramses::DisplayConfig::setPlatformRenderNode).
+        *
+        * @param[in] display Id of display that the external buffer belongs to.
+        * @param[in] externalBuffer Id of external buffer created using #createExternalBuffer.
+        * @param[in] dmaBufferFD File descriptor of the DMA buffer (dmabuf).
+        * @param[in] width Width of the DMA buffer in pixels.
+        * @param[in] height Height of the DMA buffer in pixels.
+        * @param[in] bufferFourccFormat Format of the DMA buffer as DRM fourcc code.
+        * @param[in] stride Stride of the DMA buffer in bytes.
+        * @param[in] modifier Format modifier of the DMA buffer, DRM_FORMAT_MOD_INVALID if not known.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool updateExternalBufferFromDmaBuffer(displayId_t display, externalBufferId_t externalBuffer, int dmaBufferFD, uint32_t width, uint32_t height, uint32_t bufferFourccFormat, uint32_t stride, uint64_t modifier);
+
+        /**
+        * @brief   Shares a DMA offscreen buffer of one display as content of an external buffer of another display.
+        * @details Allows to offload heavy offscreen rendering (e.g. 3D previews) to a secondary GPU: the producer display uses
+        *          the DRM render node of the secondary GPU (see #ramses::DisplayConfig::setPlatformRenderNode) and renders only into
+        *          DMA offscreen buffers, the consumer display on the primary GPU samples the result via texture sampler
+        *          linked to the external buffer (samplerExternalOES) without any copy.
+        *          The DMA buffer is imported into the external buffer once (see #updateExternalBufferFromDmaBuffer), every frame
+        *          rendered by the producer into the buffer is then directly visible to the consumer. Synchronization of access
+        *          of both GPUs relies on implicit fencing of DMA buffers by the kernel drivers.
+        *          The DMA offscreen buffer must be created already (#ramses::IRendererEventHandler::offscreenBufferCreated reported)
+        *          and its format and modifier must be supported by both GPUs (e.g. DRM_FORMAT_MOD_LINEAR).
+        *          When the external buffer gets other content or is destroyed, #ramses::IRendererEventHandler::externalBufferDmaBufferReleased
+        *          is called as for any other DMA buffer, the file descriptor is owned by the renderer though and must not be closed by the application.
+        *          The link is removed when the offscreen buffer or the external buffer is destroyed, the consumer keeps the last rendered content then.
+        *
+        * @param[in] offscreenBufferDisplay Id of display that the DMA offscreen buffer belongs to.
+        * @param[in] offscreenBuffer Id of DMA offscreen buffer created using #createDmaOffscreenBuffer.
+        * @param[in] externalBufferDisplay Id of display that the external buffer belongs to.
+        * @param[in] externalBuffer Id of external buffer created using #createExternalBuffer.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool linkDmaOffscreenBufferToExternalBuffer(displayId_t offscreenBufferDisplay, displayBufferId_t offscreenBuffer, displayId_t externalBufferDisplay, externalBufferId_t externalBuffer);
+
         /**
         * @brief   Creates a buffer for viewing wayland surfaces from the embedded compositor.
         *          The created buffer can be linked as input to a consumer texture sampler (see #ramses::RendererSceneControl::linkStreamBuffer).
@@ -442,6 +526,44 @@ namespace ramses
         */
         bool setDisplayBufferClearColor(displayId_t display, displayBufferId_t displayBuffer, const vec4f& color);
 
+        /**
+        * @brief   Reduces the rate at which an offscreen buffer is re-rendered.
+        * @details By default an offscreen buffer is re-rendered in every frame in which any of its assigned scenes changed
+        *          (or every frame, if skipping of unmodified buffers is disabled), just like the display's framebuffer.
+        *          Some offscreen buffers (e.g. reflections or thumbnails) do not need to follow changes at the display's frame rate,
+        *          with render rate divisor N such buffer is re-rendered at most in every N-th frame, changes in between
+        *          are collected and rendered all at once in its next render frame.
+        *          Render frames of offscreen buffers with the same divisor are spread over frames, so that they do not all render in
+        *          the same frame. Display's framebuffer is re-rendered whenever such offscreen buffer was rendered to show its new content.
+        *          There is no event callback for this operation, the change can be assumed to be effective
+        *          in the next frame rendered after flushed.
+        *
+        * @param[in] display Id of display that the offscreen buffer belongs to.
+        * @param[in] offscreenBuffer Id of offscreen buffer to set render rate of, cannot be display's framebuffer.
+        * @param[in] divisor Buffer is re-rendered at most every divisor-th frame, 1 to render whenever changed (default), must not be 0.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setOffscreenBufferRenderRateDivisor(displayId_t display, displayBufferId_t offscreenBuffer, uint32_t divisor);
+
+        /**
+        * @brief   Allows an offscreen buffer to be rendered at reduced resolution under GPU load.
+        * @details When GPU frame time of the display exceeds threshold set by #ramses::DisplayConfig::setOffscreenBufferScalingGpuTimeThreshold,
+        *          content of scalable offscreen buffers is rendered at reduced resolution and scaled up into the offscreen buffer,
+        *          so that its consumers (e.g. texture samplers linked to the buffer) sample the lower resolution content without any change on their side.
+        *          Camera viewports and scissor regions of passes rendering into the offscreen buffer are scaled accordingly,
+        *          render targets of the assigned scenes are not affected.
+        *          Only offscreen buffers which are neither interruptible nor DMA buffers can be scalable. Resources for reduced resolution
+        *          are allocated when buffer is made scalable the first time and released together with the buffer.
+        *          There is no event callback for this operation, the change can be assumed to be effective
+        *          in the next frame rendered after flushed.
+        *
+        * @param[in] display Id of display that the offscreen buffer belongs to.
+        * @param[in] offscreenBuffer Id of offscreen buffer to make scalable, cannot be display's framebuffer.
+        * @param[in] scalable Whether the offscreen buffer may be rendered at reduced resolution, offscreen buffers are not scalable by default.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        */
+        bool setOffscreenBufferScalable(displayId_t display, displayBufferId_t offscreenBuffer, bool scalable);
+
         /**
         * @brief   Updates display window size after a resize event on windows not owned by renderer.
         * @details Sets the new display window size after a resize event is externally handled for the window.
@@ -489,6 +611,29 @@ namespace ramses
         */
         bool readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
 
+        /**
+        * @brief Triggers a read back of a display buffer memory from GPU to system memory which does not stall rendering.
+        * @details Works the same way as #ramses::RamsesRenderer::readPixels, but the renderer does not wait
+        *          for the GPU to finish rendering the display buffer. Instead the read back is only scheduled after the buffer
+        *          was rendered and its result is collected once available, typically one or two frames later.
+        *          This is preferable when reading pixels periodically (e.g. frame capture for monitoring)
+        *          because it does not stall the rendering pipeline.
+        *
+        *          The pixel data are reported using the same renderer event as for #ramses::RamsesRenderer::readPixels.
+        *          On platforms where non-blocking read back is not supported the pixels are read same way as using #ramses::RamsesRenderer::readPixels.
+        * @param[in] displayId id of display to read pixels from.
+        * @param[in] displayBuffer Id of display buffer to read pixels from,
+        *                          if #ramses::displayBufferId_t::Invalid() is passed then pixels are read from the display's framebuffer.
+        * @param[in] x The starting offset in the original image (i.e. left border) in pixels.
+        * @param[in] y The starting offset in the original image (i.e. lower border) in pixels.
+        *          The origin of the image is supposed to be in the lower left corner.
+        * @param[in] width The width of the read image in pixels. Must be greater than Zero.
+        * @param[in] height The height of the read image in pixels. Must be greater than Zero.
+        * @return true for success, false otherwise (check log or #ramses::RamsesFramework::getLastError for details).
+        *         true does not guarantee successful read back, the result event has its own status.
+        */
+        bool readPixelsNonBlocking(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+
         /**
         * @brief Get scene control API
         * @details Typical application using Ramses has different components controlling the renderer
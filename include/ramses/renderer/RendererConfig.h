@@ -9,8 +9,10 @@
 #pragma once
 
 #include "ramses/renderer/Types.h"
+#include "ramses/framework/RamsesFrameworkTypes.h"
 #include <chrono>
 #include <memory>
+#include <vector>
 
 namespace ramses
 {
@@ -46,6 +48,47 @@ namespace ramses
         */
         bool setBinaryShaderCache(IBinaryShaderCache& cache);
 
+        /**
+        * @brief Enable sharing of compiled shaders between displays.
+        * @details When enabled, a shader compiled for one display is stored as binary program in memory
+        *          and other displays load the binary instead of compiling the same shader again.
+        *          This is useful for setups with multiple displays on the same GPU showing scenes with common effects.
+        *          Binary shader cache set via #setBinaryShaderCache takes precedence, it is shared between displays anyway.
+        *          Disabled by default.
+        * @param[in] enable true to enable sharing of compiled shaders between displays
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool enableCrossDisplayShaderSharing(bool enable);
+
+        /**
+        * @brief Get whether sharing of compiled shaders between displays is enabled,
+        *        see #enableCrossDisplayShaderSharing.
+        * @return true if sharing of compiled shaders between displays is enabled
+        */
+        [[nodiscard]] bool isCrossDisplayShaderSharingEnabled() const;
+
+        /**
+        * @brief Enable keeping of resource data and compiled shaders when a display is destroyed, to speed up creating it again.
+        * @details Displays release resource data once uploaded to GPU, so when a display is destroyed and created again
+        *          all resources of its scenes have to be received, decompressed and shaders compiled again before the scenes can be shown.
+        *          When enabled, renderer keeps data of received resources as long as the scene using them is published
+        *          and reuses it (also across displays) when the scene is subscribed again. Compiled shaders are kept as binary programs
+        *          in memory same as with #enableCrossDisplayShaderSharing, unless a binary shader cache is set via #setBinaryShaderCache.
+        *          This trades memory for faster restart of displays, resources of published scenes stay in memory even if
+        *          the scenes are not subscribed by any display.
+        *          Disabled by default.
+        * @param[in] enable true to enable keeping of resources across display restarts
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool enableDisplayRestartCache(bool enable);
+
+        /**
+        * @brief Get whether keeping of resources across display restarts is enabled,
+        *        see #enableDisplayRestartCache.
+        * @return true if keeping of resources across display restarts is enabled
+        */
+        [[nodiscard]] bool isDisplayRestartCacheEnabled() const;
+
         /**
         * @brief Enable the renderer to communicate with the system compositor.
         *        This flag needs to be enabled before calling any of the system compositor
@@ -104,6 +147,24 @@ namespace ramses
         */
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        /**
+        * @brief Sets scheduling policy, priority and CPU affinity of the resource decompression thread
+        *
+        * In threaded mode (#ramses::RamsesRenderer::startThread) resources received for scenes are decompressed ahead of their upload
+        * in a background thread shared by all displays. Running it with lower priority than the render threads
+        * (see #ramses::DisplayConfig::setDisplayThreadScheduling) or on other CPUs keeps decompression from delaying rendering of frames.
+        * The scheduling is applied by the thread itself when it starts, if applying it fails (e.g. realtime policies usually require
+        * elevated privileges of the process, CPU affinity is not supported on all platforms) a warning is logged and the thread
+        * keeps running with the scheduling it was started with. The scheduling the thread actually runs with is logged at start.
+        * Default is #ramses::EThreadSchedulingPolicy::Default with priority 0 and no CPU restriction.
+        *
+        * @param[in] policy scheduling policy of the thread
+        * @param[in] priority priority of the thread, must be 0 for #ramses::EThreadSchedulingPolicy::Default and between 1 and 99 for realtime policies
+        * @param[in] cpuAffinity indices of CPUs the thread may run on, empty for no restriction
+        * @return true on success, false if an error occurred (error is logged)
+        */
+        bool setResourceDecompressionThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -311,6 +311,27 @@ namespace ramses
         iOS
     };
 
+    /**
+    * @brief Estimated GPU memory usage in bytes, split by category
+    *
+    * Values are estimates the renderer uses internally (e.g. for GPU cache handling) and can differ from actual
+    * memory allocated by the driver.
+    */
+    struct GpuMemoryUsage
+    {
+        /// Client textures and texture buffers
+        uint64_t textures = 0u;
+        /// Vertex and index arrays and data buffers
+        uint64_t buffers = 0u;
+        /// Render buffers of render targets and offscreen buffers
+        uint64_t renderTargets = 0u;
+        /// Effects (uploaded shader programs)
+        uint64_t shaders = 0u;
+        /// Part of the categories above which belongs to resources shared with other scenes,
+        /// each scene is attributed an even share of such resource
+        uint64_t shared = 0u;
+    };
+
     /**
      * @}
      */
@@ -97,6 +97,7 @@ def test_cmake_configuration(cli_context, build_dir, expect_success, **cmake_opt
     check_expectations(tests, "ramses-framework-test", "ramses-client-test")
     check_expectations(tests and renderer, "ramses-renderer-internal-test", "ramses-renderer-test", "rendering-tests", "ramses-test-client")
     check_expectations(tests, "ramses-logic-benchmarks")
+    check_expectations(tests and renderer, "ramses-renderer-benchmarks")
     check_expectations(x11 and tests, "window-x11-test")
     check_expectations(wayland_ivi and tests, "window-wayland-ivi-test")
     check_expectations(wayland_shell and tests, "window-wayland-wl-shell-test")
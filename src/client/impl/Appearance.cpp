@@ -162,6 +162,18 @@ namespace ramses
         return m_impl.getColorWriteMask(writeRed, writeGreen, writeBlue, writeAlpha);
     }
 
+    bool Appearance::setUniformTimeAnimationEnd(int32_t timeMs)
+    {
+        const bool status = m_impl.setUniformTimeAnimationEnd(timeMs);
+        LOG_HL_CLIENT_API1(status, timeMs);
+        return status;
+    }
+
+    int32_t Appearance::getUniformTimeAnimationEnd() const
+    {
+        return m_impl.getUniformTimeAnimationEnd();
+    }
+
     bool Appearance::setInputTexture(const UniformInput& input, const TextureSampler& textureSampler)
     {
         const bool status = m_impl.setInputTexture(input.impl(), textureSampler.impl());
@@ -23,6 +23,8 @@
 #include "impl/AppearanceUtils.h"
 #include "impl/SerializationContext.h"
 #include "impl/SceneImpl.h"
+#include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include "impl/SceneObjectRegistryIterator.h"
 #include "impl/DataTypeUtils.h"
 #include "impl/ErrorReporting.h"
@@ -226,6 +228,30 @@ namespace ramses::internal
         return true;
     }
 
+    bool AppearanceImpl::setUniformTimeAnimationEnd(int32_t timeMs)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("Appearance::setUniformTimeAnimationEnd failed, supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        if (timeMs < 0)
+        {
+            getErrorReporting().set("Appearance::setUniformTimeAnimationEnd failed, time must not be negative.");
+            return false;
+        }
+
+        if (getIScene().getDataInstanceUniformTimeAnimationEnd(m_uniformInstance) != timeMs)
+            getIScene().setDataInstanceUniformTimeAnimationEnd(m_uniformInstance, timeMs);
+        return true;
+    }
+
+    int32_t AppearanceImpl::getUniformTimeAnimationEnd() const
+    {
+        return getIScene().getDataInstanceUniformTimeAnimationEnd(m_uniformInstance);
+    }
+
     bool AppearanceImpl::serialize(IOutputStream& outStream, SerializationContext& serializationContext) const
     {
         if (!SceneObjectImpl::serialize(outStream, serializationContext))
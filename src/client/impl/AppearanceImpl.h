@@ -72,6 +72,8 @@ namespace ramses::internal
         bool getDrawMode(EDrawMode& mode) const;
         bool setColorWriteMask(bool writeRed, bool writeGreen, bool writeBlue, bool writeAlpha);
         bool getColorWriteMask(bool& writeRed, bool& writeGreen, bool& writeBlue, bool& writeAlpha) const;
+        bool setUniformTimeAnimationEnd(int32_t timeMs);
+        [[nodiscard]] int32_t getUniformTimeAnimationEnd() const;
 
         template <typename T>
         bool setInputValue(const EffectInputImpl& input, size_t elementCount, const T* valuesIn);
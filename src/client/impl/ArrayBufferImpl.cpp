@@ -91,6 +91,12 @@ namespace ramses::internal
         return true;
     }
 
+    bool ArrayBufferImpl::canCacheValidationResult() const
+    {
+        // usage is checked by scanning all low level objects which refer to it
+        return false;
+    }
+
     void ArrayBufferImpl::onValidate(ValidationReportImpl& report) const
     {
         SceneObjectImpl::onValidate(report);
@@ -159,6 +165,22 @@ namespace ramses::internal
         return true;
     }
 
+    bool ArrayBufferImpl::setUsedNumberOfElements(size_t numElements)
+    {
+        const GeometryDataBuffer& dataBuffer = getIScene().getDataBuffer(m_dataBufferHandle);
+        const size_t usedSizeInBytes = numElements * EnumToSize(dataBuffer.dataType);
+        if (usedSizeInBytes > dataBuffer.data.size())
+        {
+            getErrorReporting().set("DataBuffer::setUsedNumberOfElements failed - used size beyond maximum size", *this);
+            return false;
+        }
+
+        if (usedSizeInBytes != dataBuffer.usedSize)
+            getIScene().setDataBufferUsedSize(m_dataBufferHandle, static_cast<uint32_t>(usedSizeInBytes));
+
+        return true;
+    }
+
     size_t ArrayBufferImpl::getMaximumNumberOfElements() const
     {
         const GeometryDataBuffer& dataBuffer = getIScene().getDataBuffer(m_dataBufferHandle);
@@ -28,8 +28,11 @@ namespace ramses::internal
         bool deserialize(IInputStream& inStream, DeserializationContext& serializationContext) override;
 
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool canCacheValidationResult() const override;
 
         bool updateData(size_t firstElement, size_t numElements, const std::byte* bufferData);
+        // used number of elements otherwise only grows with updates
+        bool setUsedNumberOfElements(size_t numElements);
 
         [[nodiscard]] DataBufferHandle getDataBufferHandle() const;
         [[nodiscard]] size_t getMaximumNumberOfElements() const;
@@ -10,6 +10,7 @@
 #include "ramses/client/MeshNode.h"
 #include "ramses/client/Appearance.h"
 #include "ramses/client/Geometry.h"
+#include "ramses/client/ArrayBuffer.h"
 
 // internal
 #include "impl/NodeImpl.h"
@@ -110,6 +111,61 @@ namespace ramses
         return m_impl.getInstanceCount();
     }
 
+    bool MeshNode::setBoundingSphere(const vec3f& center, float radius)
+    {
+        const bool status = m_impl.setBoundingSphere(center, radius);
+        LOG_HL_CLIENT_API4(status, center.x, center.y, center.z, radius);
+        return status;
+    }
+
+    bool MeshNode::removeBoundingSphere()
+    {
+        const bool status = m_impl.removeBoundingSphere();
+        LOG_HL_CLIENT_API_NOARG(status);
+        return status;
+    }
+
+    bool MeshNode::getBoundingSphere(vec3f& center, float& radius) const
+    {
+        return m_impl.getBoundingSphere(center, radius);
+    }
+
+    bool MeshNode::setInstanceCullingPositions(const ArrayBuffer* instancePositions)
+    {
+        const bool status = m_impl.setInstanceCullingPositions(instancePositions);
+        LOG_HL_CLIENT_API1(status, LOG_API_RAMSESOBJECT_PTR_STRING(instancePositions));
+        return status;
+    }
+
+    const ArrayBuffer* MeshNode::getInstanceCullingPositions() const
+    {
+        return m_impl.getInstanceCullingPositions();
+    }
+
+    bool MeshNode::addLevelOfDetail(uint32_t startIndex, uint32_t indexCount, float screenSize)
+    {
+        const bool status = m_impl.addLevelOfDetail(startIndex, indexCount, screenSize);
+        LOG_HL_CLIENT_API3(status, startIndex, indexCount, screenSize);
+        return status;
+    }
+
+    bool MeshNode::removeLevelsOfDetail()
+    {
+        const bool status = m_impl.removeLevelsOfDetail();
+        LOG_HL_CLIENT_API_NOARG(status);
+        return status;
+    }
+
+    size_t MeshNode::getLevelOfDetailCount() const
+    {
+        return m_impl.getLevelOfDetailCount();
+    }
+
+    bool MeshNode::getLevelOfDetail(size_t index, uint32_t& startIndex, uint32_t& indexCount, float& screenSize) const
+    {
+        return m_impl.getLevelOfDetail(index, startIndex, indexCount, screenSize);
+    }
+
     internal::MeshNodeImpl& MeshNode::impl()
     {
         return m_impl;
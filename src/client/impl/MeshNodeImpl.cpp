@@ -13,6 +13,7 @@
 
 // API
 #include "ramses/client/Geometry.h"
+#include "ramses/client/ArrayBuffer.h"
 
 // impls
 #include "impl/AppearanceImpl.h"
@@ -20,6 +21,9 @@
 #include "impl/ArrayResourceImpl.h"
 #include "impl/AppearanceImpl.h"
 #include "impl/GeometryImpl.h"
+#include "impl/ArrayBufferImpl.h"
+#include "impl/SceneObjectRegistryIterator.h"
+#include "impl/SceneImpl.h"
 #include "impl/RamsesObjectTypeUtils.h"
 #include "impl/SerializationContext.h"
 #include "impl/ErrorReporting.h"
@@ -28,6 +32,8 @@
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
 
+#include "fmt/format.h"
+
 namespace ramses::internal
 {
     MeshNodeImpl::MeshNodeImpl(SceneImpl& scene, std::string_view nodeName)
@@ -102,6 +108,34 @@ namespace ramses::internal
 
             if (getIndexCount() == 0)
                 report.add(EIssueType::Error, "indexCount must be greater 0", &getRamsesObject());
+
+            const RenderableLevelsOfDetail& levelsOfDetail = getIScene().getRenderable(m_renderableHandle).levelsOfDetail;
+            for (uint32_t i = 0u; i < levelsOfDetail.count; ++i)
+            {
+                const RenderableLevelOfDetail& level = levelsOfDetail.levels[i];
+                if (hasIndexArray && (m_geometryImpl->getIndicesCount() < level.startIndex + level.indexCount))
+                    report.add(EIssueType::Error, fmt::format("startIndex + indexCount of level of detail {} exceeds indices of indexarray", i), &getRamsesObject());
+            }
+        }
+
+        const Renderable& renderable = getIScene().getRenderable(m_renderableHandle);
+        if (renderable.levelsOfDetail.count > 0u && renderable.boundingSphere.w < 0.f)
+            report.add(EIssueType::Warning, "meshnode has levels of detail but no bounding sphere, full detail will always be rendered", &getRamsesObject());
+        if (renderable.instancePositions.isValid())
+        {
+            const ArrayBuffer* instancePositions = getInstanceCullingPositions();
+            if (instancePositions == nullptr)
+            {
+                report.add(EIssueType::Error, "meshnode uses instance culling positions buffer which was destroyed", &getRamsesObject());
+            }
+            else
+            {
+                report.addDependentObject(*this, instancePositions->impl());
+                if (renderable.boundingSphere.w < 0.f)
+                    report.add(EIssueType::Warning, "meshnode has instance culling positions but no bounding sphere, instances will not be culled", &getRamsesObject());
+                else if (instancePositions->getUsedNumberOfElements() < renderable.instanceCount)
+                    report.add(EIssueType::Warning, "meshnode has less instance culling positions than instances, instances will not be culled", &getRamsesObject());
+            }
         }
     }
 
@@ -221,6 +255,156 @@ namespace ramses::internal
         return true;
     }
 
+    bool MeshNodeImpl::setBoundingSphere(const glm::vec3& center, float radius)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("MeshNode::setBoundingSphere failed - bounding spheres are supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        if (radius < 0.f)
+        {
+            getErrorReporting().set("MeshNode::setBoundingSphere failed - radius must not be negative.", *this);
+            return false;
+        }
+
+        getIScene().setRenderableBoundingSphere(m_renderableHandle, glm::vec4(center, radius));
+        return true;
+    }
+
+    bool MeshNodeImpl::removeBoundingSphere()
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("MeshNode::removeBoundingSphere failed - bounding spheres are supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        getIScene().setRenderableBoundingSphere(m_renderableHandle, glm::vec4(0.f, 0.f, 0.f, -1.f));
+        return true;
+    }
+
+    bool MeshNodeImpl::getBoundingSphere(glm::vec3& center, float& radius) const
+    {
+        const glm::vec4& boundingSphere = getIScene().getRenderable(m_renderableHandle).boundingSphere;
+        if (boundingSphere.w < 0.f)
+            return false;
+
+        center = glm::vec3(boundingSphere);
+        radius = boundingSphere.w;
+        return true;
+    }
+
+    bool MeshNodeImpl::setInstanceCullingPositions(const ArrayBuffer* instancePositions)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("MeshNode::setInstanceCullingPositions failed - instance culling is supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        if (instancePositions == nullptr)
+        {
+            getIScene().setRenderableInstancePositions(m_renderableHandle, DataBufferHandle::Invalid());
+            return true;
+        }
+
+        if (!isFromTheSameSceneAs(instancePositions->impl()))
+        {
+            getErrorReporting().set("MeshNode::setInstanceCullingPositions failed - array buffer is not from the same scene as this MeshNode.", *this);
+            return false;
+        }
+
+        if (instancePositions->getDataType() != ramses::EDataType::Vector3F)
+        {
+            getErrorReporting().set("MeshNode::setInstanceCullingPositions failed - array buffer must be of type Vector3F.", *this);
+            return false;
+        }
+
+        getIScene().setRenderableInstancePositions(m_renderableHandle, instancePositions->impl().getDataBufferHandle());
+        return true;
+    }
+
+    const ArrayBuffer* MeshNodeImpl::getInstanceCullingPositions() const
+    {
+        const DataBufferHandle instancePositions = getIScene().getRenderable(m_renderableHandle).instancePositions;
+        if (!instancePositions.isValid())
+            return nullptr;
+
+        SceneObjectRegistryIterator iter(getSceneImpl().getObjectRegistry(), ERamsesObjectType::ArrayBuffer);
+        while (const auto* arrayBuffer = iter.getNext<ArrayBuffer>())
+        {
+            if (arrayBuffer->impl().getDataBufferHandle() == instancePositions)
+                return arrayBuffer;
+        }
+
+        return nullptr;
+    }
+
+    bool MeshNodeImpl::addLevelOfDetail(uint32_t startIndex, uint32_t indexCount, float screenSize)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("MeshNode::addLevelOfDetail failed - levels of detail are supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        RenderableLevelsOfDetail levelsOfDetail = getIScene().getRenderable(m_renderableHandle).levelsOfDetail;
+        if (levelsOfDetail.count >= MaxRenderableLevelsOfDetail)
+        {
+            getErrorReporting().set(fmt::format("MeshNode::addLevelOfDetail failed - at most {} levels of detail can be added.", MaxRenderableLevelsOfDetail), *this);
+            return false;
+        }
+
+        if (indexCount == 0u)
+        {
+            getErrorReporting().set("MeshNode::addLevelOfDetail failed - indexCount must be greater 0.", *this);
+            return false;
+        }
+
+        if (!(screenSize > 0.f) || (levelsOfDetail.count > 0u && screenSize >= levelsOfDetail.levels[levelsOfDetail.count - 1u].screenSize))
+        {
+            getErrorReporting().set("MeshNode::addLevelOfDetail failed - screenSize must be greater 0 and smaller than screenSize of previous level.", *this);
+            return false;
+        }
+
+        levelsOfDetail.levels[levelsOfDetail.count] = { startIndex, indexCount, screenSize };
+        ++levelsOfDetail.count;
+        getIScene().setRenderableLevelsOfDetail(m_renderableHandle, levelsOfDetail);
+        return true;
+    }
+
+    bool MeshNodeImpl::removeLevelsOfDetail()
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("MeshNode::removeLevelsOfDetail failed - levels of detail are supported only with feature level 03 or higher.", *this);
+            return false;
+        }
+
+        getIScene().setRenderableLevelsOfDetail(m_renderableHandle, {});
+        return true;
+    }
+
+    size_t MeshNodeImpl::getLevelOfDetailCount() const
+    {
+        return getIScene().getRenderable(m_renderableHandle).levelsOfDetail.count;
+    }
+
+    bool MeshNodeImpl::getLevelOfDetail(size_t index, uint32_t& startIndex, uint32_t& indexCount, float& screenSize) const
+    {
+        const RenderableLevelsOfDetail& levelsOfDetail = getIScene().getRenderable(m_renderableHandle).levelsOfDetail;
+        if (index >= levelsOfDetail.count)
+            return false;
+
+        const RenderableLevelOfDetail& level = levelsOfDetail.levels[index];
+        startIndex = level.startIndex;
+        indexCount = level.indexCount;
+        screenSize = level.screenSize;
+        return true;
+    }
+
     ramses::internal::RenderableHandle MeshNodeImpl::getRenderableHandle() const
     {
         return m_renderableHandle;
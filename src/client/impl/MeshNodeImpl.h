@@ -21,6 +21,7 @@ namespace ramses::internal
 namespace ramses
 {
     class Appearance;
+    class ArrayBuffer;
     class Geometry;
 }
 
@@ -54,6 +55,15 @@ namespace ramses::internal
         bool setInstanceCount(uint32_t instanceCount);
         [[nodiscard]] uint32_t getInstanceCount() const;
         bool setStartVertex(uint32_t startVertex);
+        bool setBoundingSphere(const glm::vec3& center, float radius);
+        bool removeBoundingSphere();
+        bool getBoundingSphere(glm::vec3& center, float& radius) const;
+        bool setInstanceCullingPositions(const ArrayBuffer* instancePositions);
+        [[nodiscard]] const ArrayBuffer* getInstanceCullingPositions() const;
+        bool addLevelOfDetail(uint32_t startIndex, uint32_t indexCount, float screenSize);
+        bool removeLevelsOfDetail();
+        [[nodiscard]] size_t getLevelOfDetailCount() const;
+        bool getLevelOfDetail(size_t index, uint32_t& startIndex, uint32_t& indexCount, float& screenSize) const;
         [[nodiscard]] uint32_t getStartVertex() const;
 
         [[nodiscard]] ramses::internal::RenderableHandle   getRenderableHandle() const;
@@ -32,6 +32,7 @@
 #include "internal/Components/ManagedResource.h"
 #include "internal/Components/ResourceTableOfContents.h"
 #include "internal/Components/FileInputStreamContainer.h"
+#include "internal/Components/MappedFileInputStreamContainer.h"
 #include "internal/Components/MemoryInputStreamContainer.h"
 #include "internal/Components/OffsetFileInputStreamContainer.h"
 #include "internal/SceneGraph/Resource/IResource.h"
@@ -39,6 +40,7 @@
 #include "internal/ClientCommands/FlushSceneVersion.h"
 #include "internal/ClientCommands/SetProperty.h"
 #include "impl/SerializationContext.h"
+#include "impl/SceneFileSectionIndex.h"
 #include "internal/Core/Utils/BinaryFileOutputStream.h"
 #include "internal/Core/Utils/BinaryFileInputStream.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
@@ -62,6 +64,7 @@
 #include "ramses/framework/EFeatureLevel.h"
 
 #include <cstdint>
+#include <algorithm>
 #include <array>
 
 namespace ramses::internal
@@ -72,6 +75,7 @@ namespace ramses::internal
         : RamsesObjectImpl(ERamsesObjectType::Client, applicationName)
         , m_appLogic(framework.getParticipantAddress().getParticipantId(), framework.getFrameworkLock())
         , m_framework(framework)
+        , m_effectCompilationCache(framework.getEffectCompilationCacheFile())
         , m_loadFromFileTaskQueue(framework.getTaskQueue())
         , m_deleteSceneQueue(framework.getTaskQueue())
     {
@@ -85,6 +89,7 @@ namespace ramses::internal
         m_cmdFlushSceneVersion = std::make_shared<ramses::internal::FlushSceneVersion>(*this);
         m_cmdDumpSceneToFile = std::make_shared<ramses::internal::DumpSceneToFile>(*this);
         m_cmdLogResourceMemoryUsage = std::make_shared<ramses::internal::LogResourceMemoryUsage>(*this);
+        m_cmdLogMemoryProfile = std::make_shared<ramses::internal::LogMemoryProfile>(*this);
         framework.getRamsh().add(m_cmdPrintSceneList);
         framework.getRamsh().add(m_cmdSetProperty);
         framework.getRamsh().add(m_cmdSetPropertyAll);
@@ -92,6 +97,7 @@ namespace ramses::internal
         framework.getRamsh().add(m_cmdFlushSceneVersion);
         framework.getRamsh().add(m_cmdDumpSceneToFile);
         framework.getRamsh().add(m_cmdLogResourceMemoryUsage);
+        framework.getRamsh().add(m_cmdLogMemoryProfile);
         m_framework.getPeriodicLogger().registerPeriodicLogSupplier(&m_framework.getScenegraphComponent());
     }
 
@@ -182,6 +188,12 @@ namespace ramses::internal
         m_lowLevelScene.reset();
     }
 
+    ramses::internal::ETaskPriority RamsesClientImpl::DeleteSceneRunnable::getPriority() const
+    {
+        // nobody waits for deletion, should not delay other work
+        return ramses::internal::ETaskPriority::Low;
+    }
+
     bool RamsesClientImpl::destroy(ramses::Scene& scene)
     {
         ramses::internal::PlatformGuard g(m_clientLock);
@@ -235,7 +247,7 @@ namespace ramses::internal
         managedResources.erase(std::unique(managedResources.begin(), managedResources.end()), managedResources.end());
 
         // write LL-TOC and LL resources
-        ramses::internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress);
+        ramses::internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress, &m_framework.getTaskQueue());
     }
 
     ramses::internal::ManagedResource RamsesClientImpl::getResource(ramses::internal::ResourceContentHash hash) const
@@ -364,6 +376,11 @@ namespace ramses::internal
             return {};
         }
 
+        return createSceneFromSceneData(cconfig, sceneData);
+    }
+
+    SceneOwningPtr RamsesClientImpl::createSceneFromSceneData(const SceneCreationConfig& cconfig, const std::vector<std::byte>& sceneData)
+    {
         ramses::internal::IInputStream& inputStream = cconfig.streamContainer->getStream();
 
         SceneOwningPtr scene;
@@ -388,7 +405,7 @@ namespace ramses::internal
         return scene;
     }
 
-    bool RamsesClientImpl::readInitialSceneInformation(const SceneCreationConfig& cconfig, SaveFileConfigImpl::ExporterVersion& exporter, std::vector<std::byte>& sceneData)
+    bool RamsesClientImpl::readInitialSceneInformation(const SceneCreationConfig& cconfig, SaveFileConfigImpl::ExporterVersion& exporter, std::vector<std::byte>& sceneData, const ReadProgressCallback& progress)
     {
         // this stream contains scene data AND resource data and will be handed over to and held open by resource component as resource stream
         ramses::internal::IInputStream& inputStream = cconfig.streamContainer->getStream();
@@ -416,10 +433,28 @@ namespace ramses::internal
         inputStream >> sceneObjectStart;
         inputStream >> llResourceStart;
 
+        const auto sceneDataSize = static_cast<size_t>(llResourceStart - sceneObjectStart);
         if (cconfig.prefetchData)
         {
-            sceneData.resize(static_cast<size_t>(llResourceStart - sceneObjectStart));
-            inputStream.read(sceneData.data(), sceneData.size());
+            sceneData.resize(sceneDataSize);
+            if (progress)
+            {
+                for (size_t offset = 0u; offset < sceneDataSize && inputStream.getState() == ramses::internal::EStatus::Ok; offset += AsyncLoadReadChunkSize)
+                {
+                    const size_t chunkSize = std::min(AsyncLoadReadChunkSize, sceneDataSize - offset);
+                    inputStream.read(sceneData.data() + offset, chunkSize);
+                    progress(offset + chunkSize, sceneDataSize);
+                }
+            }
+            else
+            {
+                inputStream.read(sceneData.data(), sceneData.size());
+            }
+        }
+        else if (progress)
+        {
+            // scene data is parsed directly from stream, there is nothing read upfront
+            progress(sceneDataSize, sceneDataSize);
         }
 
         if (inputStream.getState() != ramses::internal::EStatus::Ok)
@@ -485,11 +520,7 @@ namespace ramses::internal
             return nullptr;
         }
 
-        return loadSceneSynchronousCommon({
-                "loadSceneFromFile",
-                std::string{fileName},
-                std::make_shared<ramses::internal::FileInputStreamContainer>(fileName), true, config
-            });
+        return loadSceneSynchronousCommon(CreateFileSceneCreationConfig("loadSceneFromFile", fileName, config));
     }
 
     // NOLINTNEXTLINE(modernize-avoid-c-arrays)
@@ -528,13 +559,7 @@ namespace ramses::internal
             return nullptr;
         }
 
-        return loadSceneSynchronousCommon(SceneCreationConfig{
-                "loadSceneFromFileDescriptor",
-                fmt::format("<filedescriptor fd:{} offset:{} length:{}>", fd, offset, length),
-                std::make_shared<ramses::internal::OffsetFileInputStreamContainer>(fd, offset, length),
-                true,
-                config
-            });
+        return loadSceneSynchronousCommon(CreateFileDescriptorSceneCreationConfig("loadSceneFromFileDescriptor", fd, offset, length, config));
     }
 
     ramses::Scene* RamsesClientImpl::loadSceneSynchronousCommon(const SceneCreationConfig& cconfig)
@@ -633,6 +658,34 @@ namespace ramses::internal
         return true;
     }
 
+    RamsesClientImpl::SceneCreationConfig RamsesClientImpl::CreateFileSceneCreationConfig(std::string caller, std::string_view fileName, const SceneConfigImpl& config)
+    {
+        if (config.getMemoryMappedLoadingEnabled())
+        {
+            auto mappedStreamContainer = std::make_shared<ramses::internal::MappedFileInputStreamContainer>(fileName);
+            // mapped file is parsed directly, prefetching scene data would only add another copy
+            if (mappedStreamContainer->isMapped())
+                return { std::move(caller), std::string{fileName}, std::move(mappedStreamContainer), false, config };
+            LOG_WARN(CONTEXT_CLIENT, "RamsesClient::{}: failed to map file '{}' into memory, reading it as file stream", caller, fileName);
+        }
+
+        return { std::move(caller), std::string{fileName}, std::make_shared<ramses::internal::FileInputStreamContainer>(fileName), true, config };
+    }
+
+    RamsesClientImpl::SceneCreationConfig RamsesClientImpl::CreateFileDescriptorSceneCreationConfig(std::string caller, int fd, size_t offset, size_t length, const SceneConfigImpl& config)
+    {
+        std::string dataSource = fmt::format("<filedescriptor fd:{} offset:{} length:{}>", fd, offset, length);
+        if (config.getMemoryMappedLoadingEnabled())
+        {
+            auto mappedStreamContainer = std::make_shared<ramses::internal::MappedFileInputStreamContainer>(fd, offset, length);
+            if (mappedStreamContainer->isMapped())
+                return { std::move(caller), std::move(dataSource), std::move(mappedStreamContainer), false, config };
+            LOG_WARN(CONTEXT_CLIENT, "RamsesClient::{}: failed to map {} into memory, reading it as file stream", caller, dataSource);
+        }
+
+        return { std::move(caller), std::move(dataSource), std::make_shared<ramses::internal::OffsetFileInputStreamContainer>(fd, offset, length), true, config };
+    }
+
     void RamsesClientImpl::finalizeLoadedScene(SceneOwningPtr scene)
     {
         // add to the known list of scenes
@@ -680,6 +733,20 @@ namespace ramses::internal
         return GetFeatureLevelFromStream(streamContainer, fmt::format("fileDescriptor fd:{} offset:{} length:{}", fd, offset, length), detectedFeatureLevel);
     }
 
+    bool RamsesClientImpl::ReadSceneFileSectionIndex(std::string_view fileName, ramses::internal::SceneFileSectionIndex& sectionIndex)
+    {
+        ramses::internal::File file{ fileName };
+        size_t fileSize = 0u;
+        if (!file.getSizeInBytes(fileSize))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::ReadSceneFileSectionIndex: failed to get size of '{}'", fileName);
+            return false;
+        }
+
+        ramses::internal::FileInputStreamContainer streamContainer{ fileName };
+        return ramses::internal::SceneFileSectionIndex::ReadFromStream(streamContainer.getStream(), fileSize, sectionIndex);
+    }
+
     bool RamsesClientImpl::ReadRamsesVersionAndPrintWarningOnMismatch(ramses::internal::IInputStream& inputStream, std::string_view verboseFileName, EFeatureLevel featureLevel)
     {
         // return false on read error only, not version mismatch
@@ -718,14 +785,7 @@ namespace ramses::internal
             return false;
         }
 
-        auto* task =
-            new LoadSceneRunnable(*this, SceneCreationConfig{
-                    "loadSceneFromFileAsync",
-                    stdFilename,
-                    std::make_shared<ramses::internal::FileInputStreamContainer>(stdFilename),
-                    true,
-                    config
-                });
+        auto* task = new ReadSceneDataRunnable(*this, CreateFileSceneCreationConfig("loadSceneFromFileAsync", stdFilename, config));
         m_loadFromFileTaskQueue.enqueue(*task);
         task->release();
         return true;
@@ -744,12 +804,17 @@ namespace ramses::internal
 
     bool RamsesClientImpl::dispatchEvents(IClientEventHandler& clientEventHandler)
     {
+        std::vector<SceneLoadProgress> localAsyncSceneLoadProgress;
         std::vector<SceneLoadStatus> localAsyncSceneLoadStatus;
         {
             ramses::internal::PlatformGuard g(m_clientLock);
+            localAsyncSceneLoadProgress.swap(m_asyncSceneLoadProgressVec);
             localAsyncSceneLoadStatus.swap(m_asyncSceneLoadStatusVec);
         }
 
+        for (const auto& progress : localAsyncSceneLoadProgress)
+            clientEventHandler.sceneFileLoadProgress(progress.sceneFilename, progress.bytesLoaded, progress.bytesTotal);
+
         for (auto& sceneStatus : localAsyncSceneLoadStatus)
         {
             if (sceneStatus.scene)
@@ -821,28 +886,84 @@ namespace ramses::internal
         return true;
     }
 
-    RamsesClientImpl::LoadSceneRunnable::LoadSceneRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig)
+    void RamsesClientImpl::pushAsyncSceneLoadStatus(SceneOwningPtr scene, const std::string& sceneFilename)
+    {
+        ramses::internal::PlatformGuard g(m_clientLock);
+        // NOTE: only used for real files by name for now, not sure how to report other cases to user.
+        // therefore can assume dataSource is the filename
+        m_asyncSceneLoadStatusVec.push_back({std::move(scene), sceneFilename});
+    }
+
+    static ramses::internal::ETaskPriority GetAsyncLoadTaskPriority(const SceneConfigImpl& config)
+    {
+        // application waits for loaded scene unless it is loaded in background
+        return config.getBackgroundLoadingEnabled() ? ramses::internal::ETaskPriority::Normal : ramses::internal::ETaskPriority::High;
+    }
+
+    RamsesClientImpl::ReadSceneDataRunnable::ReadSceneDataRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig)
         : m_client(client)
         , m_cconfig(std::move(cconfig))
     {
     }
 
-    void RamsesClientImpl::LoadSceneRunnable::execute()
+    void RamsesClientImpl::ReadSceneDataRunnable::execute()
     {
         const uint64_t start = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
-        auto scene = m_client.loadSceneFromCreationConfig(m_cconfig);
+        SaveFileConfigImpl::ExporterVersion exporter;
+        std::vector<std::byte> sceneData;
+        const auto reportProgress = [&](size_t bytesLoaded, size_t bytesTotal) {
+            ramses::internal::PlatformGuard g(m_client.m_clientLock);
+            m_client.m_asyncSceneLoadProgressVec.push_back({ m_cconfig.dataSource, bytesLoaded, bytesTotal });
+        };
+
+        if (!m_client.readInitialSceneInformation(m_cconfig, exporter, sceneData, reportProgress))
+        {
+            m_client.pushAsyncSceneLoadStatus({}, m_cconfig.dataSource);
+            return;
+        }
+
+        const std::string dataSource = m_cconfig.dataSource;
+        auto* task = new CreateSceneRunnable(m_client, std::move(m_cconfig), std::move(sceneData), start);
+        if (!m_client.m_loadFromFileTaskQueue.enqueue(*task))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::loadSceneFromFileAsync: client is shutting down, loading of '{}' aborted", dataSource);
+            m_client.pushAsyncSceneLoadStatus({}, dataSource);
+        }
+        task->release();
+    }
+
+    ramses::internal::ETaskPriority RamsesClientImpl::ReadSceneDataRunnable::getPriority() const
+    {
+        return GetAsyncLoadTaskPriority(m_cconfig.config);
+    }
+
+    RamsesClientImpl::CreateSceneRunnable::CreateSceneRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig, std::vector<std::byte>&& sceneData, uint64_t loadStartTime)
+        : m_client(client)
+        , m_cconfig(std::move(cconfig))
+        , m_sceneData(std::move(sceneData))
+        , m_loadStartTime(loadStartTime)
+    {
+    }
+
+    void RamsesClientImpl::CreateSceneRunnable::execute()
+    {
+        auto scene = m_client.createSceneFromSceneData(m_cconfig, m_sceneData);
         const uint64_t end = ramses::internal::PlatformTime::GetMillisecondsMonotonic();
 
         if (scene)
         {
             LOG_INFO(CONTEXT_CLIENT, "RamsesClient::loadSceneFromFileAsync: ramses::Scene loaded from '{}' (sceneName: {}, sceneId {}) in {} ms",
-                m_cconfig.dataSource, scene->getName(), scene->getSceneId(), end - start);
+                m_cconfig.dataSource, scene->getName(), scene->getSceneId(), end - m_loadStartTime);
         }
 
-        ramses::internal::PlatformGuard g(m_client.m_clientLock);
-        // NOTE: only used for real files by name for now, not sure how to report other cases to user.
-        // therefore can assume dataSource is the filename
-        m_client.m_asyncSceneLoadStatusVec.push_back({std::move(scene), m_cconfig.dataSource});
+        // scene data is not needed anymore, free it before scene is dispatched
+        std::vector<std::byte>().swap(m_sceneData);
+        m_client.pushAsyncSceneLoadStatus(std::move(scene), m_cconfig.dataSource);
+    }
+
+    ramses::internal::ETaskPriority RamsesClientImpl::CreateSceneRunnable::getPriority() const
+    {
+        return GetAsyncLoadTaskPriority(m_cconfig.config);
     }
 
     const SceneVector& RamsesClientImpl::getListOfScenes() const
@@ -926,6 +1047,11 @@ namespace ramses::internal
         return m_framework;
     }
 
+    const ramses::internal::EffectCompilationCache& RamsesClientImpl::getEffectCompilationCache() const
+    {
+        return m_effectCompilationCache;
+    }
+
     void RamsesClientImpl::onValidate(ValidationReportImpl& report) const
     {
         RamsesObjectImpl::onValidate(report);
@@ -954,6 +1080,66 @@ namespace ramses::internal
         ramses::internal::EResourceType resourceType = DataTypeUtils::DeductResourceTypeFromDataType(type);
 
         auto resource = new ramses::internal::ArrayResource(resourceType, static_cast<uint32_t>(numElements), elementType, arrayData, name);
+        // resource is managed by its hash right away, large data is hashed in parallel by framework task threads
+        resource->precalculateHash(m_framework.getTaskQueue());
+        return manageResource(resource);
+    }
+
+    ramses::internal::ManagedResource RamsesClientImpl::createManagedArrayResource(size_t numElements, ramses::EDataType type, ramses::internal::ResourceBlob arrayData, std::string_view name)
+    {
+        if (0u == numElements || nullptr == arrayData.data())
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClientImpl::createManagedArrayResource Array resource must have element count > 0 and data must not be nullptr!");
+            return {};
+        }
+
+        // type is not checked at compile time as for copied data
+        if (!DataTypeUtils::IsValidIndicesType(type) && !DataTypeUtils::IsValidVerticesType(type))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClientImpl::createManagedArrayResource Array resource cannot be created with given data type!");
+            return {};
+        }
+
+        ramses::internal::EDataType elementType = DataTypeUtils::ConvertDataTypeToInternal(type);
+        ramses::internal::EResourceType resourceType = DataTypeUtils::DeductResourceTypeFromDataType(type);
+        if (arrayData.size() != numElements * ramses::internal::EnumToSize(elementType))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClientImpl::createManagedArrayResource data size {} does not match element count {} and type", arrayData.size(), numElements);
+            return {};
+        }
+
+        auto resource = new ramses::internal::ArrayResource(resourceType, static_cast<uint32_t>(numElements), elementType, std::move(arrayData), name);
+        resource->precalculateHash(m_framework.getTaskQueue());
+        return manageResource(resource);
+    }
+
+    ramses::internal::ManagedResource RamsesClientImpl::createManagedTexture2D(uint32_t width, uint32_t height, ETextureFormat format, ramses::internal::ResourceBlob data, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name)
+    {
+        if (!TextureUtils::TextureParametersValid(width, height, 1u, 1u) || !TextureUtils::MipLevelDataValid(0u, width, height, 1u, data.size(), format))
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesClient::createTexture: invalid parameters");
+            return {};
+        }
+
+        if (generateMipChain && !FormatSupportsMipChainGeneration(format))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "RamsesClient::createTexture: cannot auto generate mipmaps when unsupported format used");
+            generateMipChain = false;
+        }
+
+        // mip chain is not generated on client, it would need a new blob and defeat taking over the data, renderer generates it at upload time instead
+        ramses::internal::TextureMetaInfo texDesc;
+        texDesc.m_width = width;
+        texDesc.m_height = height;
+        texDesc.m_depth = 1u;
+        texDesc.m_format = TextureUtils::GetTextureFormatInternal(format);
+        texDesc.m_generateMipChain = generateMipChain;
+        texDesc.m_swizzle = TextureUtils::GetTextureSwizzleInternal(swizzle);
+        texDesc.m_dataSizes = { static_cast<uint32_t>(data.size()) };
+
+        auto* resource = new ramses::internal::TextureResource(ramses::internal::EResourceType::Texture2D, texDesc, std::move(data), name);
+        resource->precalculateHash(m_framework.getTaskQueue());
+
         return manageResource(resource);
     }
 
@@ -976,6 +1162,12 @@ namespace ramses::internal
             generateMipChain = false;
         }
 
+        // generate mip chain on client already if possible, avoids stalling renderer with mip generation at upload time
+        std::vector<MipDataStorageType> generatedMipLevelData;
+        if (generateMipChain && TextureUtils::GenerateMipChain(width, height, depth, format, mipLevelData, generatedMipLevelData))
+            generateMipChain = false;
+        const auto& textureMipLevelData = (generatedMipLevelData.empty() ? mipLevelData : generatedMipLevelData);
+
         ramses::internal::TextureMetaInfo texDesc;
         texDesc.m_width = width;
         texDesc.m_height = height;
@@ -983,10 +1175,11 @@ namespace ramses::internal
         texDesc.m_format = TextureUtils::GetTextureFormatInternal(format);
         texDesc.m_generateMipChain = generateMipChain;
         texDesc.m_swizzle = TextureUtils::GetTextureSwizzleInternal(swizzle);
-        TextureUtils::FillMipDataSizes(texDesc.m_dataSizes, mipLevelData);
+        TextureUtils::FillMipDataSizes(texDesc.m_dataSizes, textureMipLevelData);
 
         auto* resource = new ramses::internal::TextureResource(textureType, texDesc, name);
-        TextureUtils::FillMipData(const_cast<std::byte*>(resource->getResourceData().data()), mipLevelData);
+        TextureUtils::FillMipData(const_cast<std::byte*>(resource->getResourceData().data()), textureMipLevelData);
+        resource->precalculateHash(m_framework.getTaskQueue());
 
         return manageResource(resource);
     }
@@ -1003,11 +1196,17 @@ namespace ramses::internal
 
     ramses::internal::ManagedResource RamsesClientImpl::createManagedEffect(const EffectDescription& effectDesc, ERenderBackendCompatibility compatibility, std::string_view name, std::string& errorMessages)
     {
+        errorMessages.clear();
+        const EFeatureLevel featureLevel = getFramework().getFeatureLevel();
+        const auto cacheKey = ramses::internal::EffectCompilationCache::CreateKey(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.getGeometryShader(),
+            effectDesc.impl().getCompilerDefines(), effectDesc.impl().getSemanticsMap(), compatibility, featureLevel);
+        if (auto cachedEffectResource = m_effectCompilationCache.getEffectResource(cacheKey, name, featureLevel))
+            return manageResource(cachedEffectResource.release());
+
         //create effect using vertex and fragment shaders
         ramses::internal::GlslEffect effectBlock(effectDesc.getVertexShader(), effectDesc.getFragmentShader(), effectDesc.getGeometryShader(), effectDesc.impl().getCompilerDefines(),
             effectDesc.impl().getSemanticsMap(), compatibility, name);
-        errorMessages.clear();
-        auto effectResource = effectBlock.createEffectResource(getFramework().getFeatureLevel());
+        auto effectResource = effectBlock.createEffectResource(featureLevel);
         if (!effectResource)
         {
             errorMessages = effectBlock.getEffectErrorMessages();
@@ -1015,6 +1214,7 @@ namespace ramses::internal
             return {};
         }
 
+        m_effectCompilationCache.storeEffectResource(cacheKey, *effectResource);
         return manageResource(effectResource.release());
     }
 }
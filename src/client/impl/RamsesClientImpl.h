@@ -30,17 +30,20 @@
 #include "internal/ClientCommands/ValidateCommand.h"
 #include "internal/ClientCommands/DumpSceneToFile.h"
 #include "internal/ClientCommands/LogResourceMemoryUsage.h"
+#include "internal/ClientCommands/LogMemoryProfile.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
 #include "internal/Core/TaskFramework/ITask.h"
 #include "internal/Core/TaskFramework/EnqueueOnlyOneAtATimeQueue.h"
 #include "internal/Core/TaskFramework/TaskForwardingQueue.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/glslEffectBlock/GlslangInitializer.h"
+#include "internal/glslEffectBlock/EffectCompilationCache.h"
 #include "impl/RamsesFrameworkTypesImpl.h"
 #include "impl/SceneImpl.h"
 #include "impl/SceneConfigImpl.h"
 #include "impl/SaveFileConfigImpl.h"
 
+#include <functional>
 #include <memory>
 #include <string_view>
 
@@ -67,6 +70,7 @@ namespace ramses::internal
     class BinaryFileInputStream;
     class ClientScene;
     class ArrayResourceImpl;
+    class SceneFileSectionIndex;
     class Texture2DImpl;
     class ClientObjectImpl;
     class SceneImpl;
@@ -144,13 +148,19 @@ namespace ramses::internal
         ramses::internal::ManagedResource createManagedArrayResource(size_t numElements, ramses::EDataType type, const void* arrayData, std::string_view name);
         template <typename MipDataStorageType>
         ramses::internal::ManagedResource createManagedTexture(ramses::internal::EResourceType textureType, uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<MipDataStorageType>& mipLevelData, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name);
+        // variants taking over given data without copying it
+        ramses::internal::ManagedResource createManagedArrayResource(size_t numElements, ramses::EDataType type, ramses::internal::ResourceBlob arrayData, std::string_view name);
+        ramses::internal::ManagedResource createManagedTexture2D(uint32_t width, uint32_t height, ETextureFormat format, ramses::internal::ResourceBlob data, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name);
         ramses::internal::ManagedResource createManagedEffect(const EffectDescription& effectDesc, ERenderBackendCompatibility compatibility, std::string_view name, std::string& errorMessages);
+        [[nodiscard]] const ramses::internal::EffectCompilationCache& getEffectCompilationCache() const;
 
         void writeLowLevelResourcesToStream(const ResourceObjects& resources, ramses::internal::IOutputStream& resourceOutputStream, bool compress) const;
         static bool ReadRamsesVersionAndPrintWarningOnMismatch(ramses::internal::IInputStream& inputStream, std::string_view verboseFileName, EFeatureLevel featureLevel);
         static void WriteCurrentBuildVersionToStream(ramses::internal::IOutputStream& stream, EFeatureLevel featureLevel);
         static bool GetFeatureLevelFromFile(std::string_view fileName, EFeatureLevel& detectedFeatureLevel);
         static bool GetFeatureLevelFromFile(int fd, size_t offset, size_t length, EFeatureLevel& detectedFeatureLevel);
+        // reads section layout of a scene file without loading it, fails for files written without section index
+        static bool ReadSceneFileSectionIndex(std::string_view fileName, ramses::internal::SceneFileSectionIndex& sectionIndex);
 
     private:
         // This make sure that glslang init/deinit is called maximum once per client to reduce overhead
@@ -166,22 +176,41 @@ namespace ramses::internal
             SceneConfigImpl config;
         };
 
-        class LoadSceneRunnable : public ramses::internal::ITask
+        // asynchronous load is split into stages running as separate tasks, so that stages of several files interleave:
+        // ReadSceneDataRunnable reads the scene part of the file and enqueues CreateSceneRunnable,
+        // which creates low and high level scene objects (including logic engines) from the read data
+        class ReadSceneDataRunnable : public ramses::internal::ITask
         {
         public:
-            LoadSceneRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig);
+            ReadSceneDataRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig);
             void execute() override;
+            [[nodiscard]] ramses::internal::ETaskPriority getPriority() const override;
 
         private:
             RamsesClientImpl& m_client;
             SceneCreationConfig m_cconfig;
         };
 
+        class CreateSceneRunnable : public ramses::internal::ITask
+        {
+        public:
+            CreateSceneRunnable(RamsesClientImpl& client, SceneCreationConfig&& cconfig, std::vector<std::byte>&& sceneData, uint64_t loadStartTime);
+            void execute() override;
+            [[nodiscard]] ramses::internal::ETaskPriority getPriority() const override;
+
+        private:
+            RamsesClientImpl& m_client;
+            SceneCreationConfig m_cconfig;
+            std::vector<std::byte> m_sceneData;
+            uint64_t m_loadStartTime;
+        };
+
         class DeleteSceneRunnable : public ramses::internal::ITask
         {
         public:
             DeleteSceneRunnable(SceneOwningPtr scene, InternalSceneOwningPtr llscene);
             void execute() override;
+            [[nodiscard]] ramses::internal::ETaskPriority getPriority() const override;
 
         private:
             SceneOwningPtr m_scene;
@@ -194,17 +223,29 @@ namespace ramses::internal
             std::string sceneFilename;
         };
 
-        friend class LoadSceneRunnable;
+        struct SceneLoadProgress
+        {
+            std::string sceneFilename;
+            size_t bytesLoaded;
+            size_t bytesTotal;
+        };
+
+        using ReadProgressCallback = std::function<void(size_t bytesLoaded, size_t bytesTotal)>;
+
+        friend class ReadSceneDataRunnable;
+        friend class CreateSceneRunnable;
 
         ramses::internal::ManagedResource manageResource(const ramses::internal::IResource* res);
 
         Scene* loadSceneSynchronousCommon(const SceneCreationConfig& cconf);
         SceneOwningPtr loadSceneFromCreationConfig(const SceneCreationConfig& cconf);
+        SceneOwningPtr createSceneFromSceneData(const SceneCreationConfig& cconfig, const std::vector<std::byte>& sceneData);
         SceneOwningPtr loadSceneObjectFromStream(const std::string& caller,
                                          std::string const& filename,
                                          ramses::internal::IInputStream& inputStream, const SceneConfigImpl& config);
         void finalizeLoadedScene(SceneOwningPtr scene);
-        bool readInitialSceneInformation(const SceneCreationConfig& cconfig, SaveFileConfigImpl::ExporterVersion& exporter, std::vector<std::byte>& sceneData);
+        bool readInitialSceneInformation(const SceneCreationConfig& cconfig, SaveFileConfigImpl::ExporterVersion& exporter, std::vector<std::byte>& sceneData, const ReadProgressCallback& progress = {});
+        void pushAsyncSceneLoadStatus(SceneOwningPtr scene, const std::string& sceneFilename);
         void readAndRegisterResourceFile(IInputStream& inputStream, ramses::Scene& scene, const SceneCreationConfig& cconfig);
 
         bool mergeSceneSynchronousCommon(ramses::Scene& scene, const SceneCreationConfig& cconfig);
@@ -217,6 +258,9 @@ namespace ramses::internal
 
         void validateScenes(ValidationReportImpl& report) const;
 
+        static SceneCreationConfig CreateFileSceneCreationConfig(std::string caller, std::string_view fileName, const SceneConfigImpl& config);
+        static SceneCreationConfig CreateFileDescriptorSceneCreationConfig(std::string caller, int fd, size_t offset, size_t length, const SceneConfigImpl& config);
+
         static bool GetFeatureLevelFromStream(ramses::internal::IInputStreamContainer& streamContainer, const std::string& desc, EFeatureLevel& detectedFeatureLevel);
 
         RamsesClient* m_hlClient = nullptr;
@@ -232,14 +276,20 @@ namespace ramses::internal
         std::shared_ptr<ramses::internal::FlushSceneVersion> m_cmdFlushSceneVersion;
         std::shared_ptr<ramses::internal::DumpSceneToFile> m_cmdDumpSceneToFile;
         std::shared_ptr<ramses::internal::LogResourceMemoryUsage> m_cmdLogResourceMemoryUsage;
+        std::shared_ptr<ramses::internal::LogMemoryProfile> m_cmdLogMemoryProfile;
 
         RamsesFrameworkImpl& m_framework;
         mutable ramses::internal::PlatformLock m_clientLock;
+        ramses::internal::EffectCompilationCache m_effectCompilationCache;
 
         ramses::internal::TaskForwardingQueue m_loadFromFileTaskQueue;
         ramses::internal::EnqueueOnlyOneAtATimeQueue m_deleteSceneQueue;
 
         std::vector<SceneLoadStatus> m_asyncSceneLoadStatusVec;
+        std::vector<SceneLoadProgress> m_asyncSceneLoadProgressVec;
+
+        // scene data of asynchronously loaded files is read in chunks of this size, progress is reported after each of them
+        static constexpr size_t AsyncLoadReadChunkSize = 4u * 1024u * 1024u;
     };
 
     template <typename T>
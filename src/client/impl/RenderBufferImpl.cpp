@@ -86,6 +86,12 @@ namespace ramses::internal
         return true;
     }
 
+    bool RenderBufferImpl::canCacheValidationResult() const
+    {
+        // usage is checked by scanning all low level objects which refer to it
+        return false;
+    }
+
     void RenderBufferImpl::onValidate(ValidationReportImpl& report) const
     {
         SceneObjectImpl::onValidate(report);
@@ -32,6 +32,7 @@ namespace ramses::internal
         bool deserialize(ramses::internal::IInputStream& inStream, DeserializationContext& serializationContext) override;
 
         void onValidate(ValidationReportImpl& report) const override;
+        [[nodiscard]] bool canCacheValidationResult() const override;
 
         [[nodiscard]] uint32_t            getWidth() const;
         [[nodiscard]] uint32_t            getHeight() const;
@@ -167,6 +167,11 @@ namespace ramses::internal
 
         if (ramses::internal::contains_c(m_meshes, &meshImpl))
         {
+            // re-adding with unchanged order would only produce scene actions and renderer re-sort without any effect
+            const auto& internalRenderGroup = getIScene().getRenderGroup(m_renderGroupHandle);
+            const auto renderableEntryIt = ramses::internal::RenderGroupUtils::FindRenderableEntry(meshImpl.getRenderableHandle(), internalRenderGroup);
+            if (renderableEntryIt != internalRenderGroup.renderables.cend() && renderableEntryIt->order == orderWithinGroup)
+                return true;
             remove(meshImpl);
         }
 
@@ -210,6 +215,10 @@ namespace ramses::internal
 
         if (ramses::internal::contains_c(m_renderGroups, &renderGroupImpl))
         {
+            const auto& internalRenderGroup = getIScene().getRenderGroup(m_renderGroupHandle);
+            const auto renderGroupEntryIt = ramses::internal::RenderGroupUtils::FindRenderGroupEntry(renderGroupImpl.getRenderGroupHandle(), internalRenderGroup);
+            if (renderGroupEntryIt != internalRenderGroup.renderGroups.cend() && renderGroupEntryIt->order == orderWithinGroup)
+                return true;
             remove(renderGroupImpl);
         }
 
@@ -151,6 +151,54 @@ namespace ramses
         return status;
     }
 
+    bool RenderPass::setStateSorting(bool enable)
+    {
+        const bool status = m_impl.setStateSorting(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isStateSorting() const
+    {
+        return m_impl.isStateSorting();
+    }
+
+    bool RenderPass::setFrontToBackSorting(bool enable)
+    {
+        const bool status = m_impl.setFrontToBackSorting(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isFrontToBackSorting() const
+    {
+        return m_impl.isFrontToBackSorting();
+    }
+
+    bool RenderPass::setBackToFrontSorting(bool enable)
+    {
+        const bool status = m_impl.setBackToFrontSorting(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::isBackToFrontSorting() const
+    {
+        return m_impl.isBackToFrontSorting();
+    }
+
+    bool RenderPass::setDepthPrePass(bool enable)
+    {
+        const bool status = m_impl.setDepthPrePass(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
+
+    bool RenderPass::hasDepthPrePass() const
+    {
+        return m_impl.hasDepthPrePass();
+    }
+
     internal::RenderPassImpl& RenderPass::impl()
     {
         return m_impl;
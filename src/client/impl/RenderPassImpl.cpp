@@ -16,6 +16,8 @@
 #include "impl/RenderTargetImpl.h"
 #include "impl/RenderGroupImpl.h"
 #include "impl/RamsesObjectTypeUtils.h"
+#include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include "impl/ErrorReporting.h"
 
 #include "internal/SceneGraph/Scene/ClientScene.h"
@@ -394,4 +396,72 @@ namespace ramses::internal
         getIScene().retriggerRenderPassRenderOnce(m_renderPassHandle);
         return true;
     }
+
+    bool RenderPassImpl::setStateSorting(bool enable)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("RenderPass::setStateSorting failed - state sorting is supported only with feature level 03 or higher", *this);
+            return false;
+        }
+
+        getIScene().setRenderPassStateSorting(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::isStateSorting() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isStateSorted;
+    }
+
+    bool RenderPassImpl::setFrontToBackSorting(bool enable)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("RenderPass::setFrontToBackSorting failed - front to back sorting is supported only with feature level 03 or higher", *this);
+            return false;
+        }
+
+        getIScene().setRenderPassFrontToBackSorting(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::isFrontToBackSorting() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isFrontToBackSorted;
+    }
+
+    bool RenderPassImpl::setBackToFrontSorting(bool enable)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("RenderPass::setBackToFrontSorting failed - back to front sorting is supported only with feature level 03 or higher", *this);
+            return false;
+        }
+
+        getIScene().setRenderPassBackToFrontSorting(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::isBackToFrontSorting() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).isBackToFrontSorted;
+    }
+
+    bool RenderPassImpl::setDepthPrePass(bool enable)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("RenderPass::setDepthPrePass failed - depth pre-pass is supported only with feature level 03 or higher", *this);
+            return false;
+        }
+
+        getIScene().setRenderPassDepthPrePass(m_renderPassHandle, enable);
+        return true;
+    }
+
+    bool RenderPassImpl::hasDepthPrePass() const
+    {
+        return getIScene().getRenderPass(m_renderPassHandle).hasDepthPrePass;
+    }
 }
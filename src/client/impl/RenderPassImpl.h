@@ -76,6 +76,15 @@ namespace ramses::internal
         [[nodiscard]] bool isRenderOnce() const;
         bool retriggerRenderOnce();
 
+        bool setStateSorting(bool enable);
+        [[nodiscard]] bool isStateSorting() const;
+        bool setFrontToBackSorting(bool enable);
+        [[nodiscard]] bool isFrontToBackSorting() const;
+        bool setBackToFrontSorting(bool enable);
+        [[nodiscard]] bool isBackToFrontSorting() const;
+        bool setDepthPrePass(bool enable);
+        [[nodiscard]] bool hasDepthPrePass() const;
+
         [[nodiscard]] RenderPassHandle getRenderPassHandle() const;
 
     private:
@@ -94,6 +94,13 @@ namespace ramses
         return meshNode;
     }
 
+    bool Scene::setNodeTransforms(size_t numNodes, Node* const* nodes, const vec3f* translations, const quat* rotations, const vec3f* scalings)
+    {
+        const auto status = m_impl.setNodeTransforms(numNodes, nodes, translations, rotations, scalings);
+        LOG_HL_CLIENT_API5(status, numNodes, LOG_API_GENERIC_PTR_STRING(nodes), LOG_API_GENERIC_PTR_STRING(translations), LOG_API_GENERIC_PTR_STRING(rotations), LOG_API_GENERIC_PTR_STRING(scalings));
+        return status;
+    }
+
     bool Scene::publish(EScenePublicationMode publicationMode)
     {
         const bool status = m_impl.publish(publicationMode);
@@ -153,6 +160,11 @@ namespace ramses
         return status;
     }
 
+    uint32_t Scene::getPendingFlushCount() const
+    {
+        return m_impl.getPendingFlushCount();
+    }
+
     bool Scene::resetUniformTimeMs()
     {
         const auto status = m_impl.resetUniformTimeMs();
@@ -210,6 +222,13 @@ namespace ramses
         return m_impl.findObjectByName<T>(name);
     }
 
+    std::vector<SceneObject*> Scene::findObjects(const std::vector<std::string_view>& names)
+    {
+        std::vector<SceneObject*> objects;
+        m_impl.getObjectRegistry().findObjectsByName(names, objects);
+        return objects;
+    }
+
     const SceneObject* Scene::findObjectById(sceneObjectId_t id) const
     {
         return m_impl.findObjectById(id);
@@ -429,6 +448,15 @@ namespace ramses
         return arr;
     }
 
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    ArrayResource* Scene::createArrayResource(EDataType type, size_t numElements, std::unique_ptr<std::byte[], void (*)(const std::byte*)> arrayData, std::string_view name)
+    {
+        const auto* dataPtr = arrayData.get();
+        auto arr = m_impl.createArrayResource(type, numElements, std::move(arrayData), name);
+        LOG_HL_CLIENT_API4(LOG_API_RESOURCE_PTR_STRING(arr), numElements, type, LOG_API_GENERIC_PTR_STRING(dataPtr), name);
+        return arr;
+    }
+
     Texture2D* Scene::createTexture2D(ETextureFormat format, uint32_t width, uint32_t height, const std::vector<MipLevelData>& mipLevelData, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name /* = {} */)
     {
         Texture2D* tex = m_impl.createTexture2D(width, height, format, mipLevelData, generateMipChain, swizzle, name);
@@ -436,6 +464,15 @@ namespace ramses
         return tex;
     }
 
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    Texture2D* Scene::createTexture2D(ETextureFormat format, uint32_t width, uint32_t height, std::unique_ptr<std::byte[], void (*)(const std::byte*)> data, size_t size, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name /* = {} */)
+    {
+        const auto* dataPtr = data.get();
+        Texture2D* tex = m_impl.createTexture2D(width, height, format, std::move(data), size, generateMipChain, swizzle, name);
+        LOG_HL_CLIENT_API8(LOG_API_RESOURCE_PTR_STRING(tex), width, height, toString(format), LOG_API_GENERIC_PTR_STRING(dataPtr), size, generateMipChain, swizzle, name);
+        return tex;
+    }
+
     Texture3D* Scene::createTexture3D(ETextureFormat format, uint32_t width, uint32_t height, uint32_t depth, const std::vector<MipLevelData>& mipLevelData, bool generateMipChain, std::string_view name /* = {} */)
     {
         Texture3D* tex = m_impl.createTexture3D(width, height, depth, format, mipLevelData, generateMipChain, name);
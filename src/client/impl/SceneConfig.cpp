@@ -78,4 +78,46 @@ namespace ramses
         m_impl->setRenderBackendCompatibility(renderBackendCompatibility);
         LOG_HL_CLIENT_API1(true, renderBackendCompatibility);
     }
+
+    void SceneConfig::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        m_impl->setSceneActionCoalescingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setMemoryMappedLoadingEnabled(bool enabled)
+    {
+        m_impl->setMemoryMappedLoadingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setAsyncFlushEnabled(bool enabled, uint32_t maxPendingFlushes)
+    {
+        m_impl->setAsyncFlushEnabled(enabled, maxPendingFlushes);
+        LOG_HL_CLIENT_API2(true, enabled, maxPendingFlushes);
+    }
+
+    void SceneConfig::setLazyLuaScriptLoadingEnabled(bool enabled)
+    {
+        m_impl->setLazyLuaScriptLoadingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setHighPriorityUpdatesEnabled(bool enabled)
+    {
+        m_impl->setHighPriorityUpdatesEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setBackgroundLoadingEnabled(bool enabled)
+    {
+        m_impl->setBackgroundLoadingEnabled(enabled);
+        LOG_HL_CLIENT_API1(true, enabled);
+    }
+
+    void SceneConfig::setSceneActionDeltaEncodingEnabled(bool enabled, uint32_t transformQuantizationBits)
+    {
+        m_impl->setSceneActionDeltaEncodingEnabled(enabled, transformQuantizationBits);
+        LOG_HL_CLIENT_API2(true, enabled, transformQuantizationBits);
+    }
 }
@@ -7,6 +7,9 @@
 //  -------------------------------------------------------------------------
 
 #include "impl/SceneConfigImpl.h"
+#include "internal/SceneGraph/Scene/SceneActionDeltaEncoder.h"
+
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -49,4 +52,86 @@ namespace ramses::internal
     {
         return m_renderBackendCompatibility;
     }
+
+    void SceneConfigImpl::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        m_sceneActionCoalescingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getSceneActionCoalescingEnabled() const
+    {
+        return m_sceneActionCoalescingEnabled;
+    }
+
+    void SceneConfigImpl::setMemoryMappedLoadingEnabled(bool enabled)
+    {
+        m_memoryMappedLoadingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getMemoryMappedLoadingEnabled() const
+    {
+        return m_memoryMappedLoadingEnabled;
+    }
+
+    void SceneConfigImpl::setAsyncFlushEnabled(bool enabled, uint32_t maxPendingFlushes)
+    {
+        m_asyncFlushEnabled = enabled;
+        m_maxPendingAsyncFlushes = std::max(maxPendingFlushes, 1u);
+    }
+
+    bool SceneConfigImpl::getAsyncFlushEnabled() const
+    {
+        return m_asyncFlushEnabled;
+    }
+
+    uint32_t SceneConfigImpl::getMaxPendingAsyncFlushes() const
+    {
+        return m_maxPendingAsyncFlushes;
+    }
+
+    void SceneConfigImpl::setLazyLuaScriptLoadingEnabled(bool enabled)
+    {
+        m_lazyLuaScriptLoadingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getLazyLuaScriptLoadingEnabled() const
+    {
+        return m_lazyLuaScriptLoadingEnabled;
+    }
+
+    void SceneConfigImpl::setHighPriorityUpdatesEnabled(bool enabled)
+    {
+        m_highPriorityUpdatesEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getHighPriorityUpdatesEnabled() const
+    {
+        return m_highPriorityUpdatesEnabled;
+    }
+
+    void SceneConfigImpl::setBackgroundLoadingEnabled(bool enabled)
+    {
+        m_backgroundLoadingEnabled = enabled;
+    }
+
+    bool SceneConfigImpl::getBackgroundLoadingEnabled() const
+    {
+        return m_backgroundLoadingEnabled;
+    }
+
+    void SceneConfigImpl::setSceneActionDeltaEncodingEnabled(bool enabled, uint32_t transformQuantizationBits)
+    {
+        m_sceneActionDeltaEncodingEnabled = enabled;
+        m_transformQuantizationBits = std::min(transformQuantizationBits, SceneActionDeltaEncoder::MaxTransformQuantizationBits);
+    }
+
+    bool SceneConfigImpl::getSceneActionDeltaEncodingEnabled() const
+    {
+        return m_sceneActionDeltaEncodingEnabled;
+    }
+
+    uint32_t SceneConfigImpl::getTransformQuantizationBits() const
+    {
+        return m_transformQuantizationBits;
+    }
 }
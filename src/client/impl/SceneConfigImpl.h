@@ -21,16 +21,41 @@ namespace ramses::internal
         void setMemoryVerificationEnabled(bool enabled);
         void setSceneId(sceneId_t sceneId);
         void setRenderBackendCompatibility(ERenderBackendCompatibility renderBackendCompatibility);
+        void setSceneActionCoalescingEnabled(bool enabled);
+        void setMemoryMappedLoadingEnabled(bool enabled);
+        void setAsyncFlushEnabled(bool enabled, uint32_t maxPendingFlushes);
+        void setLazyLuaScriptLoadingEnabled(bool enabled);
+        void setHighPriorityUpdatesEnabled(bool enabled);
+        void setBackgroundLoadingEnabled(bool enabled);
+        void setSceneActionDeltaEncodingEnabled(bool enabled, uint32_t transformQuantizationBits);
 
         [[nodiscard]] EScenePublicationMode getPublicationMode() const;
         [[nodiscard]] bool getMemoryVerificationEnabled() const;
         [[nodiscard]] sceneId_t getSceneId() const;
         [[nodiscard]] ERenderBackendCompatibility getRenderBackendCompatibility() const;
+        [[nodiscard]] bool getSceneActionCoalescingEnabled() const;
+        [[nodiscard]] bool getMemoryMappedLoadingEnabled() const;
+        [[nodiscard]] bool getAsyncFlushEnabled() const;
+        [[nodiscard]] uint32_t getMaxPendingAsyncFlushes() const;
+        [[nodiscard]] bool getLazyLuaScriptLoadingEnabled() const;
+        [[nodiscard]] bool getHighPriorityUpdatesEnabled() const;
+        [[nodiscard]] bool getBackgroundLoadingEnabled() const;
+        [[nodiscard]] bool getSceneActionDeltaEncodingEnabled() const;
+        [[nodiscard]] uint32_t getTransformQuantizationBits() const;
 
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode::LocalOnly;
         sceneId_t m_sceneId;
         bool m_memoryVerificationEnabled = true;
         ERenderBackendCompatibility m_renderBackendCompatibility = ERenderBackendCompatibility::OpenGL;
+        bool m_sceneActionCoalescingEnabled = false;
+        bool m_memoryMappedLoadingEnabled = false;
+        bool m_asyncFlushEnabled = false;
+        uint32_t m_maxPendingAsyncFlushes = 2u;
+        bool m_lazyLuaScriptLoadingEnabled = false;
+        bool m_highPriorityUpdatesEnabled = false;
+        bool m_backgroundLoadingEnabled = false;
+        bool m_sceneActionDeltaEncodingEnabled = false;
+        uint32_t m_transformQuantizationBits = 0u;
     };
 }
@@ -97,6 +97,7 @@
 
 #include "internal/SceneGraph/Scene/Scene.h"
 #include "internal/SceneGraph/Scene/ScenePersistation.h"
+#include "impl/SceneFileSectionIndex.h"
 #include "internal/SceneGraph/Resource/ArrayResource.h"
 #include "internal/SceneGraph/Resource/TextureResource.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
@@ -112,6 +113,8 @@
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/Core/Utils/TextureMathUtils.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Core/Utils/BinaryFileOutputStream.h"
+#include "internal/Core/Utils/TraceRecorder.h"
 #include "internal/DataSlotUtils.h"
 #include "internal/RamsesVersion.h"
 
@@ -119,6 +122,7 @@
 #include "fmt/format.h"
 #include <algorithm>
 #include <array>
+#include <limits>
 #include <unordered_set>
 #include <unordered_map>
 
@@ -133,8 +137,15 @@ namespace ramses::internal
     {
         LOG_INFO(CONTEXT_CLIENT, "Scene::Scene: sceneId {}, publicationMode {}", scene.getSceneId(), sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly");
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
+        m_scene.setSceneActionCoalescingEnabled(sceneConfig.getSceneActionCoalescingEnabled());
         const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly;
         getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        if (sceneConfig.getAsyncFlushEnabled())
+            getClientImpl().getClientApplication().enableAsyncFlush(scene.getSceneId(), getClientImpl().getFramework().getTaskQueue(), sceneConfig.getMaxPendingAsyncFlushes());
+        if (sceneConfig.getHighPriorityUpdatesEnabled())
+            getClientImpl().getClientApplication().enableHighPriorityUpdates(scene.getSceneId());
+        if (sceneConfig.getSceneActionDeltaEncodingEnabled())
+            getClientImpl().getClientApplication().enableSceneActionDeltaEncoding(scene.getSceneId(), sceneConfig.getTransformQuantizationBits());
     }
 
     SceneImpl::~SceneImpl()
@@ -421,7 +432,7 @@ namespace ramses::internal
                 SceneObjectRegistryIterator iter(getObjectRegistry(), ERamsesObjectType(i));
                 while (const auto* obj = iter.getNext())
                 {
-                    obj->impl().validate(report);
+                    validateCached(obj->impl(), report);
                     if (!ValidateLogicBindingReferencesTo(obj, lengines))
                         report.add(EIssueType::Error, "Multiple logic bindings reference this object, this will lead to one overwriting values from the other", obj);
                 }
@@ -449,6 +460,111 @@ namespace ramses::internal
         }
     }
 
+    void SceneImpl::validateCached(const RamsesObjectImpl& object, ValidationReportImpl& report) const
+    {
+        // logic engine state is not modified through low level scene, it cannot be invalidated
+        if (!object.isOfType(ERamsesObjectType::SceneObject) || object.isOfType(ERamsesObjectType::LogicEngine))
+        {
+            object.validate(report);
+            return;
+        }
+
+        if (!report.addVisit(&object))
+            return;
+
+        const auto& sceneObject = static_cast<const SceneObjectImpl&>(object);
+        CachedValidationResult uncachedResult;
+        const CachedValidationResult* result = nullptr;
+        if (!sceneObject.canCacheValidationResult())
+        {
+            ValidationReportImpl objectReport;
+            sceneObject.onValidate(objectReport);
+            uncachedResult = CachedValidationResult{ objectReport.getIssues(), objectReport.getDependentObjects(&sceneObject) };
+            result = &uncachedResult;
+            // marked as cached nevertheless so that its next modification invalidates cached results depending on it
+            sceneObject.setValidationResultCached(true);
+        }
+        else
+        {
+            auto it = m_validationCache.find(&sceneObject);
+            if (it == m_validationCache.end())
+            {
+                ValidationReportImpl objectReport;
+                sceneObject.onValidate(objectReport);
+
+                CachedValidationResult newResult{ objectReport.getIssues(), objectReport.getDependentObjects(&sceneObject) };
+                for (const auto* dependency : newResult.dependencies)
+                    m_validationDependents[dependency].insert(&sceneObject);
+                if (!newResult.issues.empty())
+                    m_cachedValidationResultsWithIssues.insert(&sceneObject);
+
+                it = m_validationCache.emplace(&sceneObject, std::move(newResult)).first;
+                sceneObject.setValidationResultCached(true);
+            }
+            result = &it->second;
+        }
+
+        for (const auto& issue : result->issues)
+            report.add(issue.type, issue.message, issue.object);
+
+        // copy, validating dependencies can add to cache
+        const auto dependencies = result->dependencies;
+        for (const auto* dependency : dependencies)
+            validateCached(*dependency, report);
+    }
+
+    void SceneImpl::invalidateValidationResult(const SceneObjectImpl& object)
+    {
+        std::vector<const RamsesObjectImpl*> objectsToInvalidate{ &object };
+        while (!objectsToInvalidate.empty())
+        {
+            const auto* obj = objectsToInvalidate.back();
+            objectsToInvalidate.pop_back();
+
+            if (obj->isOfType(ERamsesObjectType::SceneObject))
+            {
+                const auto& sceneObject = static_cast<const SceneObjectImpl&>(*obj);
+                if (!sceneObject.isValidationResultCached())
+                    continue;
+                sceneObject.setValidationResultCached(false);
+                m_validationCache.erase(&sceneObject);
+                m_cachedValidationResultsWithIssues.erase(&sceneObject);
+            }
+
+            const auto dependentsIt = m_validationDependents.find(obj);
+            if (dependentsIt != m_validationDependents.end())
+            {
+                objectsToInvalidate.insert(objectsToInvalidate.end(), dependentsIt->second.cbegin(), dependentsIt->second.cend());
+                m_validationDependents.erase(dependentsIt);
+            }
+        }
+    }
+
+    void SceneImpl::onSceneObjectCreated()
+    {
+        if (m_cachedValidationResultsWithIssues.empty())
+            return;
+
+        const auto resultsWithIssues = std::move(m_cachedValidationResultsWithIssues);
+        m_cachedValidationResultsWithIssues.clear();
+        for (const auto* object : resultsWithIssues)
+            invalidateValidationResult(*object);
+    }
+
+    void SceneImpl::onSceneObjectDestroyed(const SceneObjectImpl& object)
+    {
+        invalidateValidationResult(object);
+        // dependents are also invalidated if object was not cached itself
+        const auto dependentsIt = m_validationDependents.find(&object);
+        if (dependentsIt != m_validationDependents.end())
+        {
+            const auto dependents = std::move(dependentsIt->second);
+            m_validationDependents.erase(dependentsIt);
+            for (const auto* dependent : dependents)
+                invalidateValidationResult(*dependent);
+        }
+    }
+
     LogicEngine* SceneImpl::createLogicEngine(std::string_view name)
     {
         auto pimpl = std::make_unique<LogicEngineImpl>(*this, name);
@@ -534,10 +650,11 @@ namespace ramses::internal
         case ERamsesObjectType::RenderPass:
         case ERamsesObjectType::BlitPass:
         case ERamsesObjectType::RenderBuffer:
-        case ERamsesObjectType::ArrayBuffer:
         case ERamsesObjectType::Texture2DBuffer:
         case ERamsesObjectType::LogicEngine:
             return destroyObject(object);
+        case ERamsesObjectType::ArrayBuffer:
+            return destroyArrayBuffer(RamsesObjectTypeUtils::ConvertTo<ArrayBuffer>(object));
         case ERamsesObjectType::LogicObject:
             getErrorReporting().set("Scene::destroy cannot destroy logic object, use LogicEngine::destroy to destroy logic objects.", *this);
             return false;
@@ -652,6 +769,23 @@ namespace ramses::internal
         return destroyObject(dataObject);
     }
 
+    bool SceneImpl::destroyArrayBuffer(ArrayBuffer& arrayBuffer)
+    {
+        // data buffer handle can be reused by another buffer, renderables must not refer to it as instance positions anymore
+        const ramses::internal::DataBufferHandle dataBufferHandle = arrayBuffer.impl().getDataBufferHandle();
+        const uint32_t renderableCount = m_scene.getRenderableCount();
+        for (ramses::internal::RenderableHandle renderable(0u); renderable < renderableCount; ++renderable)
+        {
+            if (m_scene.isRenderableAllocated(renderable) &&
+                m_scene.getRenderable(renderable).instancePositions == dataBufferHandle)
+            {
+                m_scene.setRenderableInstancePositions(renderable, ramses::internal::DataBufferHandle::Invalid());
+            }
+        }
+
+        return destroyObject(arrayBuffer);
+    }
+
     template <typename SAMPLER>
     bool SceneImpl::destroyTextureSampler(SAMPLER& sampler)
     {
@@ -749,6 +883,71 @@ namespace ramses::internal
         return &m_objectRegistry.createAndRegisterObject<MeshNode>(std::move(pimpl));
     }
 
+    bool SceneImpl::setNodeTransforms(size_t numNodes, Node* const* nodes, const vec3f* translations, const quat* rotations, const vec3f* scalings)
+    {
+        if (numNodes == 0u || (!translations && !rotations && !scalings))
+            return true;
+
+        if (nodes == nullptr)
+        {
+            getErrorReporting().set("Scene::setNodeTransforms failed, nodes must not be nullptr.", *this);
+            return false;
+        }
+
+        if (numNodes > std::numeric_limits<uint32_t>::max())
+        {
+            getErrorReporting().set("Scene::setNodeTransforms failed, too many nodes.", *this);
+            return false;
+        }
+
+        // check all nodes first so that either all or none are modified
+        for (size_t i = 0u; i < numNodes; ++i)
+        {
+            if (nodes[i] == nullptr || !containsSceneObject(nodes[i]->impl()))
+            {
+                getErrorReporting().set(fmt::format("Scene::setNodeTransforms failed, node at index {} is not in this scene.", i), *this);
+                return false;
+            }
+        }
+
+        std::vector<ramses::internal::TransformHandle> transforms;
+        transforms.reserve(numNodes);
+        for (size_t i = 0u; i < numNodes; ++i)
+        {
+            auto& nodeImpl = nodes[i]->impl();
+            nodeImpl.initializeTransform();
+            transforms.push_back(nodeImpl.getTransformHandle());
+        }
+
+        // quaternion is stored as (x, y, z, w) in low level scene, same as in Node::setRotation
+        std::vector<glm::vec4> rotationValues;
+        if (rotations)
+        {
+            rotationValues.reserve(numNodes);
+            for (size_t i = 0u; i < numNodes; ++i)
+                rotationValues.emplace_back(rotations[i].x, rotations[i].y, rotations[i].z, rotations[i].w);
+        }
+
+        // bulk scene action is not known to renderers below feature level 03, fall back to per transform actions
+        if (m_hlClient.impl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            for (size_t i = 0u; i < numNodes; ++i)
+            {
+                if (translations)
+                    m_scene.setTranslation(transforms[i], translations[i]);
+                if (rotations)
+                    m_scene.setRotation(transforms[i], rotationValues[i], ERotationType::Quaternion);
+                if (scalings)
+                    m_scene.setScaling(transforms[i], scalings[i]);
+            }
+            return true;
+        }
+
+        m_scene.setTransformsBulk(static_cast<uint32_t>(numNodes), transforms.data(), translations, rotations ? rotationValues.data() : nullptr, scalings);
+
+        return true;
+    }
+
     ramses::RenderGroup* SceneImpl::createRenderGroup(std::string_view name)
     {
         auto pimpl = std::make_unique<RenderGroupImpl>(*this, name);
@@ -1327,6 +1526,7 @@ namespace ramses::internal
 
     bool SceneImpl::flush(sceneVersionTag_t sceneVersion)
     {
+        RAMSES_TRACE_SCOPE("client", "SceneFlush");
         const auto timestampOfFlushCall = m_sendEffectTimeSync ? getIScene().getEffectTimeSync() :  ramses::internal::FlushTime::Clock::now();
 
         LOG_DEBUG(CONTEXT_CLIENT, "Scene::flush: sceneVersion {}, prevSceneVersion {}, syncFlushTime {}", sceneVersion, m_nextSceneVersion, ramses::internal::asMilliseconds(timestampOfFlushCall));
@@ -1364,6 +1564,11 @@ namespace ramses::internal
         return true;
     }
 
+    uint32_t SceneImpl::getPendingFlushCount() const
+    {
+        return getClientImpl().getClientApplication().getPendingFlushCount(m_scene.getSceneId());
+    }
+
     bool SceneImpl::resetUniformTimeMs()
     {
         const auto now   = ramses::internal::FlushTime::Clock::now();
@@ -1746,6 +1951,24 @@ namespace ramses::internal
         return createHLArrayResource(res, name);
     }
 
+    ramses::ArrayResource* SceneImpl::createArrayResource(ramses::EDataType type, size_t numElements, ramses::internal::ResourceBlob::OwnedData arrayData, std::string_view name)
+    {
+        if (0u == numElements || nullptr == arrayData)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Scene::createArrayResource: Array resource must have element count > 0 and data must not be nullptr!");
+            return nullptr;
+        }
+
+        const size_t dataSize = numElements * GetSizeOfDataType(type);
+        ramses::internal::ManagedResource res = getClientImpl().createManagedArrayResource(numElements, type, ramses::internal::ResourceBlob(dataSize, std::move(arrayData)), name);
+        if (!res)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Scene::createArrayResource: failed to create managed array resource");
+            return nullptr;
+        }
+        return createHLArrayResource(res, name);
+    }
+
     ramses::ArrayResource* SceneImpl::createHLArrayResource(ramses::internal::ManagedResource const& resource, std::string_view name)
     {
         assert(resource->getTypeID() == ramses::internal::EResourceType::IndexArray ||
@@ -1772,6 +1995,17 @@ namespace ramses::internal
         return createHLTexture2D(res, name);
     }
 
+    Texture2D* SceneImpl::createTexture2D(uint32_t width, uint32_t height, ETextureFormat format, ramses::internal::ResourceBlob::OwnedData data, size_t size, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name)
+    {
+        ramses::internal::ManagedResource res = getClientImpl().createManagedTexture2D(width, height, format, ramses::internal::ResourceBlob(size, std::move(data)), generateMipChain, swizzle, name);
+        if (!res)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "Scene::createTexture2D: failed to create managed Texture2D resource");
+            return nullptr;
+        }
+        return createHLTexture2D(res, name);
+    }
+
     Texture2D* SceneImpl::createHLTexture2D(ramses::internal::ManagedResource const& resource, std::string_view name)
     {
         assert(resource->getTypeID() == ramses::internal::EResourceType::Texture2D);
@@ -1899,47 +2133,83 @@ namespace ramses::internal
         return nullptr;
     }
 
-    bool SceneImpl::writeSceneObjectsToStream(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& saveConfig) const
+    bool SceneImpl::writeSceneObjectsToStream(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& saveConfig, ramses::internal::SceneFileSectionIndex& sectionIndex) const
     {
+        size_t metadataStart = 0u;
+        outputStream.getPos(metadataStart);
         ramses::internal::ScenePersistation::WriteSceneMetadataToStream(outputStream, getIScene(), m_hlClient.impl().getFramework().getFeatureLevel());
+
+        size_t llSceneStart = 0u;
+        outputStream.getPos(llSceneStart);
         ramses::internal::ScenePersistation::WriteSceneToStream(outputStream, getIScene(), m_hlClient.impl().getFramework().getFeatureLevel());
 
+        size_t sceneObjectsStart = 0u;
+        outputStream.getPos(sceneObjectsStart);
         SerializationContext serializationContext{saveConfig};
-        return serialize(outputStream, serializationContext);
+        serializationContext.setSectionIndex(&sectionIndex);
+        const bool status = serialize(outputStream, serializationContext);
+
+        size_t sceneObjectsEnd = 0u;
+        outputStream.getPos(sceneObjectsEnd);
+        sectionIndex.addSection(ramses::internal::ESceneFileSection::SceneMetadata, metadataStart, llSceneStart - metadataStart);
+        sectionIndex.addSection(ramses::internal::ESceneFileSection::LowLevelScene, llSceneStart, sceneObjectsStart - llSceneStart);
+        sectionIndex.addSection(ramses::internal::ESceneFileSection::SceneObjects, sceneObjectsStart, sceneObjectsEnd - sceneObjectsStart);
+
+        return status;
     }
 
     bool SceneImpl::serialize(std::vector<std::byte>& outputBuffer, const SaveFileConfigImpl& config) const
     {
         ramses::internal::BinaryOutputStream outputStream;
+        if (!serialize(outputStream, config))
+            return false;
+        outputBuffer = outputStream.release();
+        return true;
+    }
+
+    bool SceneImpl::serialize(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& config) const
+    {
+        // header and scene objects are small compared to resources, they are serialized to memory first so that offsets in header
+        // can be filled in before anything is written, resources are then written directly to output stream
+        ramses::internal::BinaryOutputStream headerAndSceneStream;
         const EFeatureLevel featureLevel = m_hlClient.impl().getFramework().getFeatureLevel();
-        ramses::internal::RamsesVersion::WriteToStream(outputStream, ::ramses_sdk::RAMSES_SDK_RAMSES_VERSION, ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH, featureLevel);
-        outputStream << config.getExporterVersion();
-        outputStream << config.getMetadataString();
+        ramses::internal::RamsesVersion::WriteToStream(headerAndSceneStream, ::ramses_sdk::RAMSES_SDK_RAMSES_VERSION, ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH, featureLevel);
+        headerAndSceneStream << config.getExporterVersion();
+        headerAndSceneStream << config.getMetadataString();
 
-        const auto headerOffset = outputStream.getSize();
+        const auto headerOffset = headerAndSceneStream.getSize();
 
         // reserve space for offset to SceneObjects and LL-Objects
-        outputStream << static_cast<uint64_t>(0);
-        outputStream << static_cast<uint64_t>(0);
-        const uint64_t offsetSceneObjectsStart = outputStream.getSize();
-        const auto status = writeSceneObjectsToStream(outputStream, config);
+        headerAndSceneStream << static_cast<uint64_t>(0);
+        headerAndSceneStream << static_cast<uint64_t>(0);
+        const uint64_t offsetSceneObjectsStart = headerAndSceneStream.getSize();
+        ramses::internal::SceneFileSectionIndex sectionIndex;
+        if (!writeSceneObjectsToStream(headerAndSceneStream, config, sectionIndex))
+            return false;
+
+        const uint64_t offsetLLResourcesStart = headerAndSceneStream.getSize();
+        auto headerAndScene = headerAndSceneStream.release();
+        headerAndSceneStream << offsetSceneObjectsStart;
+        headerAndSceneStream << offsetLLResourcesStart;
+        const auto offsets = headerAndSceneStream.release();
+
+        assert(offsets.size() == 2*sizeof(uint64_t));
+        std::copy(offsets.begin(), offsets.end(), headerAndScene.begin() + static_cast<ptrdiff_t>(headerOffset));
+        outputStream.write(headerAndScene.data(), headerAndScene.size());
 
-        const auto offsetLLResourcesStart = outputStream.getSize();
         ResourceObjects resources;
         resources.reserve(m_resources.size());
         for (auto const& res : m_resources)
             resources.push_back(res.second);
         getClientImpl().writeLowLevelResourcesToStream(resources, outputStream, config.getCompressionEnabled());
+        size_t offsetLLResourcesEnd = 0u;
+        outputStream.getPos(offsetLLResourcesEnd);
+        sectionIndex.addSection(ramses::internal::ESceneFileSection::LowLevelResources, offsetLLResourcesStart, offsetLLResourcesEnd - offsetLLResourcesStart);
 
-        outputBuffer = outputStream.release();
-        outputStream << static_cast<uint64_t>(offsetSceneObjectsStart);
-        outputStream << static_cast<uint64_t>(offsetLLResourcesStart);
-        const auto offsets = outputStream.release();
-
-        assert(offsets.size() == 2*sizeof(uint64_t));
-        std::copy(offsets.begin(), offsets.end(), outputBuffer.begin() + static_cast<ptrdiff_t>(headerOffset));
+        // appended after resources, not visible to loaders reading only the sections referenced by header
+        sectionIndex.writeToStream(outputStream);
 
-        return status;
+        return true;
     }
 
     bool SceneImpl::saveToFile(std::string_view fileName, const SaveFileConfigImpl& config)
@@ -1970,26 +2240,40 @@ namespace ramses::internal
             return false;
         }
 
-        std::vector<std::byte> outputBuffer;
-        if (!serialize(outputBuffer, config))
-            return false;
-
+        // file is written as stream, without holding whole file content in memory
         ramses::internal::File outputFile(fileName);
-        if (!outputFile.open(ramses::internal::File::Mode::WriteNewBinary))
+        ramses::internal::BinaryFileOutputStream outputStream(outputFile);
+        if (outputStream.getState() != ramses::internal::EStatus::Ok)
         {
             getErrorReporting().set(fmt::format("Scene::saveToFile failed, could not open file for writing: '{}'", fileName), *this);
             return false;
         }
 
-        if (!outputFile.write(outputBuffer.data(), outputBuffer.size()))
+        // incomplete file must not be left behind, anything else than a regular file (e.g. a device) was not created here and is kept
+        const auto removeIncompleteFile = [&outputFile]() {
+            outputFile.close();
+            if (outputFile.isRegularFile())
+                outputFile.remove();
+        };
+
+        if (!serialize(outputStream, config))
+        {
+            removeIncompleteFile();
+            return false;
+        }
+
+        if (outputStream.getState() != ramses::internal::EStatus::Ok)
         {
             getErrorReporting().set(fmt::format("Scene::saveToFile failed, write failed: '{}'", fileName), *this);
+            removeIncompleteFile();
             return false;
         }
 
+        // remaining buffered content is written when closing, this can fail as well
         if (!outputFile.close())
         {
             getErrorReporting().set(fmt::format("Scene::saveToFile failed, close file failed: '{}'", fileName), *this);
+            removeIncompleteFile();
             return false;
         }
 
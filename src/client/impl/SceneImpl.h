@@ -41,6 +41,7 @@
 #include <chrono>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <string_view>
 
 namespace ramses
@@ -89,6 +90,7 @@ namespace ramses::internal
     class ArrayBufferImpl;
     class Texture2DBufferImpl;
     class SaveFileConfigImpl;
+    class SceneFileSectionIndex;
 
     class SceneImpl final : public ClientObjectImpl
     {
@@ -110,6 +112,8 @@ namespace ramses::internal
         EScenePublicationMode getPublicationModeSetFromSceneConfig() const;
 
         bool serialize(std::vector<std::byte>& outputBuffer, const SaveFileConfigImpl& config) const;
+        // writes scene file to stream which must be at its beginning, nothing is written if serialization of scene objects fails
+        bool serialize(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& config) const;
         bool saveToFile(std::string_view fileName, const SaveFileConfigImpl& config);
 
         LogicEngine* createLogicEngine(std::string_view name);
@@ -120,6 +124,7 @@ namespace ramses::internal
         Geometry*    createGeometry(const Effect& effect, std::string_view name);
         Node*               createNode(std::string_view name);
         MeshNode*           createMeshNode(std::string_view name);
+        bool                setNodeTransforms(size_t numNodes, Node* const* nodes, const vec3f* translations, const quat* rotations, const vec3f* scalings);
         ramses::RenderGroup*  createRenderGroup(std::string_view name);
         ramses::RenderPass*   createRenderPass(std::string_view name);
         ramses::BlitPass*     createBlitPass(const RenderBuffer& sourceRenderBuffer, const RenderBuffer& destinationRenderBuffer, std::string_view name);
@@ -203,6 +208,7 @@ namespace ramses::internal
         bool setExpirationTimestamp(uint64_t ptpExpirationTimestampInMilliseconds);
 
         bool flush(sceneVersionTag_t sceneVersion);
+        [[nodiscard]] uint32_t getPendingFlushCount() const;
 
         bool resetUniformTimeMs();
         int32_t getUniformTimeMs() const;
@@ -211,6 +217,8 @@ namespace ramses::internal
         // NOLINTNEXTLINE(modernize-avoid-c-arrays)
         ramses::ArrayResource* createArrayResource(size_t numElements, const T* arrayData, std::string_view name);
         Texture2D* createTexture2D(uint32_t width, uint32_t height, ETextureFormat format, const std::vector<MipLevelData>& mipLevelData, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name);
+        ramses::ArrayResource* createArrayResource(ramses::EDataType type, size_t numElements, ramses::internal::ResourceBlob::OwnedData arrayData, std::string_view name);
+        Texture2D* createTexture2D(uint32_t width, uint32_t height, ETextureFormat format, ramses::internal::ResourceBlob::OwnedData data, size_t size, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name);
         Texture3D* createTexture3D(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<MipLevelData>& mipLevelData, bool generateMipChain, std::string_view name);
         TextureCube* createTextureCube(uint32_t size, ETextureFormat format, const std::vector<CubeMipLevelData>& mipLevelData, bool generateMipChain, const TextureSwizzle& swizzle, std::string_view name);
         Effect* createEffect(const EffectDescription& effectDesc, std::string_view name);
@@ -259,6 +267,11 @@ namespace ramses::internal
 
         void updateResourceId(resourceId_t const& oldId, Resource& resourceWithNewId);
 
+        // validation result of a scene object is cached until the object or one of its dependencies is modified or destroyed
+        void invalidateValidationResult(const SceneObjectImpl& object);
+        void onSceneObjectCreated();
+        void onSceneObjectDestroyed(const SceneObjectImpl& object);
+
     private:
         ramses::TextureSampler* createTextureSamplerImpl(
             ETextureAddressMode wrapUMode,
@@ -299,6 +312,7 @@ namespace ramses::internal
         bool destroyMeshNode(MeshNode& mesh);
         bool destroyNode(Node& node);
         bool destroyDataObject(DataObject& dataObject);
+        bool destroyArrayBuffer(ArrayBuffer& arrayBuffer);
         bool destroyResource(Resource& resource);
         bool destroyObject(SceneObject& object);
 
@@ -310,18 +324,32 @@ namespace ramses::internal
         void applyHierarchicalVisibility();
         std::optional<Issue> validateRenderBufferDependingObjects() const;
 
-        bool writeSceneObjectsToStream(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& saveConfig) const;
+        bool writeSceneObjectsToStream(ramses::internal::IOutputStream& outputStream, const SaveFileConfigImpl& saveConfig, ramses::internal::SceneFileSectionIndex& sectionIndex) const;
 
         bool removeResourceWithIdFromResources(resourceId_t const& id, Resource& resource);
 
         // Validate logic bindings only. Return true for objects that are not logic bindings
         static bool ValidateLogicBindingReferencesTo(const SceneObject* obj, const std::vector<const LogicEngine*>& lengines);
 
+        void validateCached(const RamsesObjectImpl& object, ValidationReportImpl& report) const;
+
         ramses::internal::ClientScene&          m_scene;
         ramses::internal::SceneCommandBuffer    m_commandBuffer;
         sceneVersionTag_t                       m_nextSceneVersion;
         sceneObjectId_t                         m_lastSceneObjectId;
 
+        // issues reported by the object itself (without its dependencies) and its dependencies,
+        // declared before object registry because objects unregister from cache on destruction
+        struct CachedValidationResult
+        {
+            std::vector<Issue> issues;
+            std::vector<const RamsesObjectImpl*> dependencies;
+        };
+        mutable std::unordered_map<const SceneObjectImpl*, CachedValidationResult> m_validationCache;
+        mutable std::unordered_map<const RamsesObjectImpl*, std::unordered_set<const SceneObjectImpl*>> m_validationDependents;
+        // results with issues might be resolved by creating the missing object
+        mutable std::unordered_set<const SceneObjectImpl*> m_cachedValidationResultsWithIssues;
+
         SceneObjectRegistry m_objectRegistry;
         std::unordered_multimap <resourceId_t, Resource*> m_resources;
 
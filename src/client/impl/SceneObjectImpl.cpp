@@ -21,11 +21,13 @@ namespace ramses::internal
         , m_scene{ scene }
     {
         m_scene.getStatisticCollection().statObjectsCreated.incCounter(1);
+        m_scene.onSceneObjectCreated();
     }
 
     SceneObjectImpl::~SceneObjectImpl()
     {
         m_scene.getStatisticCollection().statObjectsDestroyed.incCounter(1);
+        m_scene.onSceneObjectDestroyed(*this);
     }
 
     const SceneImpl& SceneObjectImpl::getSceneImpl() const
@@ -45,6 +47,9 @@ namespace ramses::internal
 
     ramses::internal::ClientScene& SceneObjectImpl::getIScene()
     {
+        // object state is modified through mutable low level scene
+        if (m_validationResultCached)
+            m_scene.invalidateValidationResult(*this);
         return m_scene.getIScene();
     }
 
@@ -92,6 +97,35 @@ namespace ramses::internal
         return true;
     }
 
+    bool SceneObjectImpl::setName(std::string_view name)
+    {
+        const std::string oldName = getName();
+        const auto status = ClientObjectImpl::setName(name);
+        if (m_objectRegistry)
+            m_objectRegistry->onObjectRenamed(RamsesObjectTypeUtils::ConvertTo<SceneObject>(getRamsesObject()), oldName);
+        return status;
+    }
+
+    void SceneObjectImpl::setObjectRegistry(SceneObjectRegistry* registry)
+    {
+        m_objectRegistry = registry;
+    }
+
+    void SceneObjectImpl::setValidationResultCached(bool cached) const
+    {
+        m_validationResultCached = cached;
+    }
+
+    bool SceneObjectImpl::canCacheValidationResult() const
+    {
+        return true;
+    }
+
+    bool SceneObjectImpl::isValidationResultCached() const
+    {
+        return m_validationResultCached;
+    }
+
     sceneObjectId_t SceneObjectImpl::getSceneObjectId() const
     {
         return m_sceneObjectId;
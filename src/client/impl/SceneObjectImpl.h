@@ -21,6 +21,7 @@ namespace ramses::internal
 {
     class ClientScene;
     class SceneImpl;
+    class SceneObjectRegistry;
 
     class SceneObjectImpl : public ClientObjectImpl
     {
@@ -44,11 +45,25 @@ namespace ramses::internal
         [[nodiscard]] bool isFromTheSameSceneAs(const SceneObjectImpl& otherObject) const;
 
         [[nodiscard]] std::string getIdentificationString() const final;
+        bool setName(std::string_view name) override;
+
+        // set by registry which owns this object, it is notified about name changes
+        void setObjectRegistry(SceneObjectRegistry* registry);
+
+        // set by scene when validation result of this object (or of objects depending on it) is cached,
+        // any access to mutable low level scene invalidates it
+        void setValidationResultCached(bool cached) const;
+        [[nodiscard]] bool isValidationResultCached() const;
+        // objects validating how other objects use them read state not tracked as their dependencies,
+        // their validation result cannot be cached
+        [[nodiscard]] virtual bool canCacheValidationResult() const;
 
     protected:
         sceneObjectId_t m_sceneObjectId;
 
     private:
         SceneImpl& m_scene;
+        SceneObjectRegistry* m_objectRegistry = nullptr;
+        mutable bool m_validationResultCached = false;
     };
 }
@@ -25,6 +25,8 @@ namespace ramses::internal
         m_objects[static_cast<int>(type)].push_back(&object);
 
         trackSceneObjectById(object);
+        addToNameIndex(object);
+        object.impl().setObjectRegistry(this);
     }
 
     void SceneObjectRegistry::destroyAndUnregisterObject(SceneObject& object)
@@ -40,6 +42,8 @@ namespace ramses::internal
             assert(m_objectsById.count(sceneObjectId) != 0u);
             m_objectsById.erase(sceneObjectId);
         }
+        removeFromNameIndex(object, object.getName());
+        object.impl().setObjectRegistry(nullptr);
 
         auto& objects = m_objects[static_cast<int>(object.impl().getType())];
         auto it = std::find(objects.begin(), objects.end(), &object);
@@ -86,6 +90,67 @@ namespace ramses::internal
         }
     }
 
+    void SceneObjectRegistry::addToNameIndex(SceneObject& object)
+    {
+        const auto& name = object.getName();
+        if (!name.empty())
+            m_objectsByName[std::string{ name }].push_back(&object);
+    }
+
+    void SceneObjectRegistry::removeFromNameIndex(SceneObject& object, std::string_view name)
+    {
+        if (name.empty())
+            return;
+
+        const auto it = m_objectsByName.find(std::string{ name });
+        assert(it != m_objectsByName.end());
+        auto& objects = it->second;
+        objects.erase(std::find(objects.begin(), objects.end(), &object));
+        if (objects.empty())
+            m_objectsByName.erase(it);
+    }
+
+    void SceneObjectRegistry::onObjectRenamed(SceneObject& object, std::string_view oldName)
+    {
+        assert(containsObject(object));
+        removeFromNameIndex(object, oldName);
+        addToNameIndex(object);
+    }
+
+    SceneObject* SceneObjectRegistry::findObjectByNameAndType(std::string_view name, ERamsesObjectType type)
+    {
+        // unnamed objects are not indexed, searching for empty name is rare
+        if (name.empty())
+        {
+            for (size_t typeIdx = 0u; typeIdx < RamsesObjectTypeCount; ++typeIdx)
+            {
+                const auto concreteType = static_cast<ERamsesObjectType>(typeIdx);
+                if (RamsesObjectTypeUtils::IsConcreteType(concreteType) && RamsesObjectTypeUtils::IsTypeMatchingBaseType(concreteType, type))
+                {
+                    const auto& objs = m_objects[typeIdx];
+                    const auto it = std::find_if(objs.begin(), objs.end(), [](const auto o) { return o->getName().empty(); });
+                    if (it != objs.end())
+                        return *it;
+                }
+            }
+            return nullptr;
+        }
+
+        const auto it = m_objectsByName.find(std::string{ name });
+        if (it == m_objectsByName.end())
+            return nullptr;
+
+        // if there are multiple objects with same name prefer the one with lowest type, same as searching per type
+        SceneObject* foundObject = nullptr;
+        for (auto* obj : it->second)
+        {
+            const auto objType = obj->impl().getType();
+            if (RamsesObjectTypeUtils::IsTypeMatchingBaseType(objType, type) && (!foundObject || objType < foundObject->impl().getType()))
+                foundObject = obj;
+        }
+        return foundObject;
+    }
+
     SceneObject* SceneObjectRegistry::findObjectById(sceneObjectId_t id)
     {
         const auto it = m_objectsById.find(id);
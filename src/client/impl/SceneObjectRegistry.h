@@ -43,6 +43,11 @@ namespace ramses::internal
 
         template <typename T> [[nodiscard]] const T* findObjectByName(std::string_view name) const;
         template <typename T> [[nodiscard]] T* findObjectByName(std::string_view name);
+        // result contains found object or nullptr for every given name, in the same order
+        template <typename T> void findObjectsByName(const std::vector<std::string_view>& names, std::vector<T*>& objects);
+
+        // called by registered object when its name changes, keeps the name index up to date
+        void onObjectRenamed(SceneObject& object, std::string_view oldName);
 
         [[nodiscard]] const SceneObject* findObjectById(sceneObjectId_t id) const;
         SceneObject* findObjectById(sceneObjectId_t id);
@@ -57,8 +62,13 @@ namespace ramses::internal
         void registerObjectInternal(SceneObject& object);
         [[nodiscard]] bool containsObject(const SceneObject& object) const;
         void trackSceneObjectById(SceneObject& object);
+        void addToNameIndex(SceneObject& object);
+        void removeFromNameIndex(SceneObject& object, std::string_view name);
+        [[nodiscard]] SceneObject* findObjectByNameAndType(std::string_view name, ERamsesObjectType type);
 
         std::unordered_map<sceneObjectId_t, SceneObject*> m_objectsById;
+        // objects with non-empty name, per name in order of registration
+        std::unordered_map<std::string, std::vector<SceneObject*>> m_objectsByName;
 
         std::array<std::vector<SceneObject*>, RamsesObjectTypeCount> m_objects;
 
@@ -89,17 +99,9 @@ namespace ramses::internal
         if constexpr (!std::is_base_of_v<LogicObject, T>) // if searching for logic object don't bother going thru scene registry
         {
             constexpr ERamsesObjectType typeToReturn = TYPE_ID_OF_RAMSES_OBJECT<T>::ID;
-            for (size_t typeIdx = 0u; typeIdx < RamsesObjectTypeCount; ++typeIdx)
-            {
-                const auto type = static_cast<ERamsesObjectType>(typeIdx);
-                if (RamsesObjectTypeUtils::IsConcreteType(type) && RamsesObjectTypeUtils::IsTypeMatchingBaseType(type, typeToReturn))
-                {
-                    const auto& objs = m_objects[typeIdx];
-                    const auto it = std::find_if(objs.begin(), objs.end(), [name](const auto o) { return o->getName() == name; });
-                    if (it != objs.end())
-                        return (*it)->template as<T>();
-                }
-            }
+            auto obj = findObjectByNameAndType(name, typeToReturn);
+            if (obj)
+                return obj->template as<T>();
         }
 
         // NOLINTNEXTLINE(readability-misleading-indentation) for some reason clang is confused about constexpr branch above
@@ -123,4 +125,12 @@ namespace ramses::internal
         // const version of findObjectByName cast to its non-const version to avoid duplicating code
         return const_cast<SceneObject*>((const_cast<SceneObjectRegistry&>(*this)).findObjectByName<T>(name));
     }
+
+    template <typename T> void SceneObjectRegistry::findObjectsByName(const std::vector<std::string_view>& names, std::vector<T*>& objects)
+    {
+        assert(objects.empty());
+        objects.reserve(names.size());
+        for (const auto name : names)
+            objects.push_back(findObjectByName<T>(name));
+    }
 }
@@ -48,6 +48,23 @@ namespace ramses
         return m_impl.getRequestedState();
     }
 
+    bool SceneReference::setPreloadHint(RendererSceneState preloadState, int32_t priority)
+    {
+        const auto status = m_impl.setPreloadHint(preloadState, priority);
+        LOG_HL_CLIENT_API2(status, static_cast<uint32_t>(preloadState), priority);
+        return status;
+    }
+
+    RendererSceneState SceneReference::getPreloadState() const
+    {
+        return m_impl.getPreloadState();
+    }
+
+    int32_t SceneReference::getPreloadPriority() const
+    {
+        return m_impl.getPreloadPriority();
+    }
+
     internal::SceneReferenceImpl& SceneReference::impl()
     {
         return m_impl;
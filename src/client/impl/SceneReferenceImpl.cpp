@@ -13,6 +13,8 @@
 #include "internal/SceneGraph/SceneAPI/RendererSceneState.h"
 #include "impl/SceneObjectImpl.h"
 #include "impl/SceneImpl.h"
+#include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include "impl/ErrorReporting.h"
 #include "impl/SerializationContext.h"
 
@@ -88,6 +90,34 @@ namespace ramses::internal
         return true;
     }
 
+    bool SceneReferenceImpl::setPreloadHint(RendererSceneState preloadState, int32_t priority)
+    {
+        if (getClientImpl().getFramework().getFeatureLevel() < EFeatureLevel_03)
+        {
+            getErrorReporting().set("SceneReference::setPreloadHint: Preloading is supported only with feature level 03 or higher", *this);
+            return false;
+        }
+
+        if (preloadState != RendererSceneState::Available && preloadState != RendererSceneState::Ready)
+        {
+            getErrorReporting().set("SceneReference::setPreloadHint: Scene reference can only be preloaded to Ready state, use Available to disable preloading", *this);
+            return false;
+        }
+
+        getIScene().setSceneReferencePreload(m_sceneReferenceHandle, preloadState, priority);
+        return true;
+    }
+
+    RendererSceneState SceneReferenceImpl::getPreloadState() const
+    {
+        return getIScene().getSceneReference(m_sceneReferenceHandle).preloadState;
+    }
+
+    int32_t SceneReferenceImpl::getPreloadPriority() const
+    {
+        return getIScene().getSceneReference(m_sceneReferenceHandle).preloadPriority;
+    }
+
     ramses::internal::SceneReferenceHandle SceneReferenceImpl::getSceneReferenceHandle() const
     {
         return m_sceneReferenceHandle;
@@ -37,6 +37,9 @@ namespace ramses::internal
         [[nodiscard]] RendererSceneState getRequestedState() const;
         bool requestNotificationsForSceneVersionTags(bool flag);
         bool setRenderOrder(int32_t renderOrder);
+        bool setPreloadHint(RendererSceneState preloadState, int32_t priority);
+        [[nodiscard]] RendererSceneState getPreloadState() const;
+        [[nodiscard]] int32_t getPreloadPriority() const;
 
         [[nodiscard]] ramses::internal::SceneReferenceHandle getSceneReferenceHandle() const;
 
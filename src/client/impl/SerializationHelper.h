@@ -9,6 +9,7 @@
 #pragma once
 
 #include "impl/SerializationContext.h"
+#include "impl/SceneFileSectionIndex.h"
 #include "impl/SceneObjectImpl.h"
 #include "impl/SceneObjectRegistry.h"
 #include "impl/SceneObjectRegistryIterator.h"
@@ -63,6 +64,9 @@ namespace ramses::internal
             {
                 const ERamsesObjectType type = typeCountIter.first;
 
+                size_t groupStart = 0u;
+                outStream.getPos(groupStart);
+
                 outStream << static_cast<uint32_t>(type);
                 outStream << typeCountIter.second;
 
@@ -72,6 +76,13 @@ namespace ramses::internal
                     if (!obj->impl().serialize(outStream, serializationContext))
                         return false;
                 }
+
+                if (auto* sectionIndex = serializationContext.getSectionIndex())
+                {
+                    size_t groupEnd = 0u;
+                    outStream.getPos(groupEnd);
+                    sectionIndex->addSection(ESceneFileSection::SceneObjectsOfType, groupStart, groupEnd - groupStart, type);
+                }
             }
 
             return true;
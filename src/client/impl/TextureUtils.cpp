@@ -12,6 +12,8 @@
 #include "internal/Core/Utils/Image.h"
 #include "internal/PlatformAbstraction/PlatformMemory.h"
 
+#include <array>
+
 namespace ramses::internal
 {
     void TextureUtils::FillMipDataSizes(ramses::internal::MipDataSizeVector& mipDataSizes, const std::vector<MipLevelData>& mipLevelData)
@@ -93,35 +95,45 @@ namespace ramses::internal
 
         for (size_t i = 0u; i < mipLevelData.size(); ++i)
         {
-            if (mipLevelData[i].empty())
+            if (!MipLevelDataValid(static_cast<uint32_t>(i), width, height, depth, mipLevelData[i].size(), format))
             {
                 return false;
             }
+        }
 
-            const uint32_t mipWidth = ramses::internal::TextureMathUtils::GetMipSize(static_cast<uint32_t>(i), width);
-            const uint32_t mipHeight = ramses::internal::TextureMathUtils::GetMipSize(static_cast<uint32_t>(i), height);
-            const uint32_t mipDepth = ramses::internal::TextureMathUtils::GetMipSize(static_cast<uint32_t>(i), depth);
-            const ramses::internal::EPixelStorageFormat internalFormat = TextureUtils::GetTextureFormatInternal(format);
-            if (!ramses::internal::IsFormatCompressed(internalFormat))
+        return true;
+    }
+
+    bool TextureUtils::MipLevelDataValid(uint32_t mipLevel, uint32_t width, uint32_t height, uint32_t depth, size_t mipLevelDataSize, ETextureFormat format)
+    {
+        if (mipLevelDataSize == 0u)
+        {
+            return false;
+        }
+
+        const uint32_t mipWidth = ramses::internal::TextureMathUtils::GetMipSize(mipLevel, width);
+        const uint32_t mipHeight = ramses::internal::TextureMathUtils::GetMipSize(mipLevel, height);
+        const uint32_t mipDepth = ramses::internal::TextureMathUtils::GetMipSize(mipLevel, depth);
+        const ramses::internal::EPixelStorageFormat internalFormat = TextureUtils::GetTextureFormatInternal(format);
+        if (!ramses::internal::IsFormatCompressed(internalFormat))
+        {
+            const uint32_t expectedMipDataSize = mipWidth * mipHeight * mipDepth * ramses::internal::GetTexelSizeFromFormat(internalFormat);
+            if (mipLevelDataSize < expectedMipDataSize)
             {
-                const uint32_t expectedMipDataSize = mipWidth * mipHeight * mipDepth * ramses::internal::GetTexelSizeFromFormat(internalFormat);
-                if (mipLevelData[i].size() < expectedMipDataSize)
-                {
-                    return false;
-                }
-                if (mipLevelData[i].size() > expectedMipDataSize)
-                {
-                    LOG_WARN(CONTEXT_CLIENT, "Provided texture mip data does not match expected size, texture might not be as expected");
-                }
+                return false;
             }
-
-            if (!TextureUtils::IsTextureSizeSupportedByFormat(mipWidth, mipHeight, format))
+            if (mipLevelDataSize > expectedMipDataSize)
             {
-                LOG_WARN(CONTEXT_CLIENT, "Provided texture mip {} might fail to be uploaded due to its size {}x{} not supported by used format {}",
-                    i, mipWidth, mipHeight, toString(format));
+                LOG_WARN(CONTEXT_CLIENT, "Provided texture mip data does not match expected size, texture might not be as expected");
             }
         }
 
+        if (!TextureUtils::IsTextureSizeSupportedByFormat(mipWidth, mipHeight, format))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "Provided texture mip {} might fail to be uploaded due to its size {}x{} not supported by used format {}",
+                mipLevel, mipWidth, mipHeight, toString(format));
+        }
+
         return true;
     }
 
@@ -198,4 +210,81 @@ namespace ramses::internal
 
         return true;
     }
+
+    namespace
+    {
+        uint32_t GetChannelCountForCpuMipGeneration(ETextureFormat format)
+        {
+            // sRGB formats are excluded on purpose, filtering must be done in linear space which renderer does correctly
+            switch (format)
+            {
+            case ETextureFormat::R8:
+                return 1u;
+            case ETextureFormat::RG8:
+                return 2u;
+            case ETextureFormat::RGB8:
+                return 3u;
+            case ETextureFormat::RGBA8:
+                return 4u;
+            default:
+                return 0u;
+            }
+        }
+
+        void GenerateMipChainOfFace(uint32_t width, uint32_t height, uint32_t channelCount, std::vector<MipLevelData>& mipChain)
+        {
+            const uint32_t mipCount = TextureMathUtils::GetMipLevelCount(width, height, 1u);
+            mipChain.reserve(mipCount);
+            for (uint32_t mip = 1u; mip < mipCount; ++mip)
+            {
+                const uint32_t mipWidth = TextureMathUtils::GetMipSize(mip, width);
+                const uint32_t mipHeight = TextureMathUtils::GetMipSize(mip, height);
+                MipLevelData mipData(size_t(mipWidth) * mipHeight * channelCount);
+                TextureMathUtils::GenerateLowerMipLevel(mipChain.back().data(), TextureMathUtils::GetMipSize(mip - 1u, width), TextureMathUtils::GetMipSize(mip - 1u, height), channelCount, mipData.data());
+                mipChain.push_back(std::move(mipData));
+            }
+        }
+    }
+
+    bool TextureUtils::GenerateMipChain(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<MipLevelData>& baseLevel, std::vector<MipLevelData>& mipChain)
+    {
+        const uint32_t channelCount = GetChannelCountForCpuMipGeneration(format);
+        if (channelCount == 0u || depth != 1u || baseLevel.size() != 1u)
+            return false;
+
+        mipChain = { baseLevel.front() };
+        GenerateMipChainOfFace(width, height, channelCount, mipChain);
+        return true;
+    }
+
+    bool TextureUtils::GenerateMipChain(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<CubeMipLevelData>& baseLevel, std::vector<CubeMipLevelData>& mipChain)
+    {
+        const uint32_t channelCount = GetChannelCountForCpuMipGeneration(format);
+        if (channelCount == 0u || depth != 1u || baseLevel.size() != 1u)
+            return false;
+
+        std::array<std::vector<MipLevelData>, 6u> faces;
+        faces[0] = { baseLevel.front().m_dataPX };
+        faces[1] = { baseLevel.front().m_dataNX };
+        faces[2] = { baseLevel.front().m_dataPY };
+        faces[3] = { baseLevel.front().m_dataNY };
+        faces[4] = { baseLevel.front().m_dataPZ };
+        faces[5] = { baseLevel.front().m_dataNZ };
+        for (auto& face : faces)
+            GenerateMipChainOfFace(width, height, channelCount, face);
+
+        const size_t mipCount = faces[0].size();
+        mipChain.clear();
+        mipChain.resize(mipCount);
+        for (size_t mip = 0u; mip < mipCount; ++mip)
+        {
+            mipChain[mip].m_dataPX = std::move(faces[0][mip]);
+            mipChain[mip].m_dataNX = std::move(faces[1][mip]);
+            mipChain[mip].m_dataPY = std::move(faces[2][mip]);
+            mipChain[mip].m_dataNY = std::move(faces[3][mip]);
+            mipChain[mip].m_dataPZ = std::move(faces[4][mip]);
+            mipChain[mip].m_dataNZ = std::move(faces[5][mip]);
+        }
+        return true;
+    }
 }
@@ -491,6 +491,12 @@ namespace ramses::internal
         static bool MipDataValid(uint32_t width, uint32_t height, uint32_t depth, const std::vector<MipLevelData>& mipLevelData, ETextureFormat format);
         static bool MipDataValid(uint32_t width, uint32_t height, uint32_t depth, const std::vector<CubeMipLevelData>& mipLevelData, ETextureFormat format);
         static bool MipDataValid(uint32_t size, const std::vector<CubeMipLevelData>& mipLevelData, ETextureFormat format);
+        static bool MipLevelDataValid(uint32_t mipLevel, uint32_t width, uint32_t height, uint32_t depth, size_t mipLevelDataSize, ETextureFormat format);
         static bool TextureParametersValid(uint32_t width, uint32_t height, uint32_t depth, uint32_t mipMapCount);
+
+        // Generates full mip chain from base level on CPU so that renderer does not need to generate it at upload time.
+        // Returns false if texture type or format is not supported, caller then falls back to mip chain generation in renderer.
+        static bool GenerateMipChain(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<MipLevelData>& baseLevel, std::vector<MipLevelData>& mipChain);
+        static bool GenerateMipChain(uint32_t width, uint32_t height, uint32_t depth, ETextureFormat format, const std::vector<CubeMipLevelData>& baseLevel, std::vector<CubeMipLevelData>& mipChain);
     };
 }
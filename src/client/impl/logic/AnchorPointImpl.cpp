@@ -19,6 +19,8 @@
 
 #include "impl/ErrorReporting.h"
 
+#include "internal/logic/AnchorPointCameraCache.h"
+
 #include "internal/logic/flatbuffers/generated/AnchorPointGen.h"
 #include "glm/gtc/type_ptr.hpp"
 
@@ -117,25 +119,21 @@ namespace ramses::internal
 
     std::optional<LogicNodeRuntimeError> AnchorPointImpl::update()
     {
-        matrix44f projectionMatrix;
-        matrix44f cameraViewMatrix;
-        matrix44f modelMatrix;
-
         const auto& ramsesCam = m_cameraBinding.getRamsesCamera();
-        if (!ramsesCam.getProjectionMatrix(projectionMatrix))
-            return LogicNodeRuntimeError{"Failed to retrieve projection matrix from Ramses camera!"};
-
-        if (!ramsesCam.getInverseModelMatrix(cameraViewMatrix))
-            return LogicNodeRuntimeError{ "Failed to retrieve view matrix from Ramses camera!" };
+        AnchorPointCameraCache::CameraData cameraData;
+        auto potentialError = (m_cameraCache ? m_cameraCache->getCameraData(ramsesCam, cameraData) : AnchorPointCameraCache::ComputeCameraData(ramsesCam, cameraData));
+        if (potentialError)
+            return potentialError;
 
+        matrix44f modelMatrix;
         if (!m_nodeBinding.getRamsesNode().getModelMatrix(modelMatrix))
             return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
 
         const vec4f localOrigin{ 0, 0, 0, 1 };
-        const vec4f pointInClipSpace = projectionMatrix * cameraViewMatrix * modelMatrix * localOrigin;
+        const vec4f pointInClipSpace = cameraData.viewProjectionMatrix * modelMatrix * localOrigin;
         const vec4f pointInNDS = pointInClipSpace / pointInClipSpace.w; // NOLINT(cppcoreguidelines-pro-type-union-access)
         const vec4f pointNormalized = (pointInNDS + 1.f) / 2.f;
-        const vec4f pointViewport = pointNormalized * vec4f{ float(ramsesCam.getViewportWidth()), float(ramsesCam.getViewportHeight()), 1.f, 1.f };
+        const vec4f pointViewport = pointNormalized * vec4f{ cameraData.viewportSize.x, cameraData.viewportSize.y, 1.f, 1.f }; // NOLINT(cppcoreguidelines-pro-type-union-access)
 
         getOutputs()->getChild(0u)->impl().setValue(vec2f{ pointViewport.x, pointViewport.y }); // NOLINT(cppcoreguidelines-pro-type-union-access)
         getOutputs()->getChild(1u)->impl().setValue(pointViewport.z); // NOLINT(cppcoreguidelines-pro-type-union-access)
@@ -143,6 +141,11 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    void AnchorPointImpl::setCameraCache(AnchorPointCameraCache* cameraCache)
+    {
+        m_cameraCache = cameraCache;
+    }
+
     NodeBindingImpl& AnchorPointImpl::getNodeBinding()
     {
         return m_nodeBinding;
@@ -28,6 +28,7 @@ namespace ramses::internal
     class NodeBindingImpl;
     class CameraBindingImpl;
     class ErrorReporting;
+    class AnchorPointCameraCache;
     class SerializationMap;
     class DeserializationMap;
 
@@ -57,8 +58,12 @@ namespace ramses::internal
 
         void createRootProperties() final;
 
+        // camera data shared with other anchor points during logic engine update, computed on every update if not set
+        void setCameraCache(AnchorPointCameraCache* cameraCache);
+
     private:
         NodeBindingImpl& m_nodeBinding;
         CameraBindingImpl& m_cameraBinding;
+        AnchorPointCameraCache* m_cameraCache = nullptr;
     };
 }
@@ -36,15 +36,36 @@ namespace ramses::internal
             assert(!channel.tangentsOut || channel.timeStamps->getNumElements() == channel.tangentsOut->getNumElements());
             assert(!exposeDataAsProperties || channel.keyframes->getDataType() != EPropertyType::Array);
 
-            // extract basic channel data to work containers, update logic operates with these containers instead of original channel data
-            // (for timestamps and keyframes at least), it also makes it possible to modify this data in runtime while keeping original data constant
+            // update logic operates directly on data of the data arrays (for timestamps and keyframes at least), only if the data
+            // is exposed via properties it is copied to work containers, so that it can be modified in runtime while keeping original data constant
             assert(m_channels[i].timeStamps->getDataType() == EPropertyType::Float && m_channels[i].timeStamps->getNumElements() > 0);
-            m_channelsWorkData[i].timestamps = *m_channels[i].timeStamps->getData<float>();
-            m_channelsWorkData[i].keyframes = m_channels[i].keyframes->impl().getDataVariant();
+            auto& workData = m_channelsWorkData[i];
+            if (exposeDataAsProperties)
+            {
+                workData.timestampsCopy = *m_channels[i].timeStamps->getData<float>();
+                workData.keyframesCopy = m_channels[i].keyframes->impl().getDataVariant();
+                workData.timestamps = &workData.timestampsCopy;
+                workData.keyframes = &workData.keyframesCopy;
+            }
+            else
+            {
+                workData.timestamps = m_channels[i].timeStamps->getData<float>();
+                workData.keyframes = &m_channels[i].keyframes->impl().getDataVariant();
+            }
+
+            // channels sharing timestamps share keyframe lookup, unless timestamps can be modified for each channel via properties
+            m_channelsWorkData[i].timestampsSourceChannel = i;
+            if (!exposeDataAsProperties)
+            {
+                const auto sourceChannelIt = std::find_if(m_channels.cbegin(), m_channels.cbegin() + static_cast<std::ptrdiff_t>(i),
+                    [&channel](const auto& otherChannel) { return otherChannel.timeStamps == channel.timeStamps; });
+                m_channelsWorkData[i].timestampsSourceChannel = static_cast<size_t>(std::distance(m_channels.cbegin(), sourceChannelIt));
+            }
 
             // overall duration equals longest channel in animation
             m_maxChannelDuration = std::max(m_maxChannelDuration, channel.timeStamps->getData<float>()->back());
         }
+        m_keyframeLookups.resize(m_channels.size());
     }
 
     void AnimationNodeImpl::createRootProperties()
@@ -119,35 +140,64 @@ namespace ramses::internal
         const float localAnimationTime = progress * m_maxChannelDuration;
 
         for (size_t i = 0u; i < m_channels.size(); ++i)
-            updateChannel(i, localAnimationTime);
+        {
+            const size_t sourceChannel = m_channelsWorkData[i].timestampsSourceChannel;
+            if (sourceChannel == i)
+                m_keyframeLookups[i] = findKeyframes(i, localAnimationTime);
+            updateChannel(i, m_keyframeLookups[sourceChannel]);
+        }
 
         return std::nullopt;
     }
 
-    void AnimationNodeImpl::updateChannel(size_t channelIdx, float localAnimationTime)
+    AnimationNodeImpl::KeyframeLookup AnimationNodeImpl::findKeyframes(size_t channelIdx, float localAnimationTime)
     {
-        const auto& channelWorkData = m_channelsWorkData[channelIdx];
-        const auto& channel = m_channels[channelIdx];
-        const auto& timeStamps = channelWorkData.timestamps;
-
-        // find upper/lower timestamp neighbor of elapsed timestamp
-        auto tsUpperIt = std::upper_bound(timeStamps.cbegin(), timeStamps.cend(), localAnimationTime);
-        const auto tsLowerIt = (tsUpperIt == timeStamps.cbegin() ? timeStamps.cbegin() : tsUpperIt - 1);
-        tsUpperIt = (tsUpperIt == timeStamps.cend() ? tsUpperIt - 1 : tsUpperIt);
+        auto& channelWorkData = m_channelsWorkData[channelIdx];
+        const auto& timeStamps = *channelWorkData.timestamps;
+        assert(!timeStamps.empty());
+
+        // find upper/lower timestamp neighbor of elapsed timestamp,
+        // check cursor from last update and its successor first before falling back to binary search
+        const auto isUpperBound = [&](size_t idx) {
+            return idx <= timeStamps.size()
+                && (idx == 0u || timeStamps[idx - 1u] <= localAnimationTime)
+                && (idx == timeStamps.size() || timeStamps[idx] > localAnimationTime);
+        };
+        size_t upperBoundIdx = channelWorkData.timestampCursor;
+        if (!isUpperBound(upperBoundIdx))
+        {
+            if (isUpperBound(upperBoundIdx + 1u))
+                ++upperBoundIdx;
+            else
+                upperBoundIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), std::upper_bound(timeStamps.cbegin(), timeStamps.cend(), localAnimationTime)));
+        }
+        channelWorkData.timestampCursor = upperBoundIdx;
 
         // get index into corresponding keyframes
-        const auto lowerIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsLowerIt));
-        const auto upperIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsUpperIt));
-        assert(lowerIdx < channel.keyframes->getNumElements());
-        assert(upperIdx < channel.keyframes->getNumElements());
+        KeyframeLookup lookup;
+        lookup.lowerIdx = (upperBoundIdx == 0u ? 0u : upperBoundIdx - 1u);
+        lookup.upperIdx = (upperBoundIdx == timeStamps.size() ? upperBoundIdx - 1u : upperBoundIdx);
 
         // calculate interpolation ratio between the elapsed time and timestamp neighbors [0.0, 1.0] (0.0=lower, 1.0=upper)
-        float interpRatio = 0.f;
-        float timeBetweenKeys = *tsUpperIt - *tsLowerIt;
-        if (tsUpperIt != tsLowerIt)
-            interpRatio = (localAnimationTime - *tsLowerIt) / timeBetweenKeys;
+        lookup.timeBetweenKeys = timeStamps[lookup.upperIdx] - timeStamps[lookup.lowerIdx];
+        if (lookup.upperIdx != lookup.lowerIdx)
+            lookup.interpRatio = (localAnimationTime - timeStamps[lookup.lowerIdx]) / lookup.timeBetweenKeys;
         // no clamping needed mathematically but to avoid float precision issues
-        interpRatio = std::clamp(interpRatio, 0.f, 1.f);
+        lookup.interpRatio = std::clamp(lookup.interpRatio, 0.f, 1.f);
+
+        return lookup;
+    }
+
+    void AnimationNodeImpl::updateChannel(size_t channelIdx, const KeyframeLookup& lookup)
+    {
+        const auto& channelWorkData = m_channelsWorkData[channelIdx];
+        const auto& channel = m_channels[channelIdx];
+        const size_t lowerIdx = lookup.lowerIdx;
+        const size_t upperIdx = lookup.upperIdx;
+        const float interpRatio = lookup.interpRatio;
+        const float timeBetweenKeys = lookup.timeBetweenKeys;
+        assert(lowerIdx < channel.keyframes->getNumElements());
+        assert(upperIdx < channel.keyframes->getNumElements());
 
         using DataVariant = std::variant<
             float,
@@ -181,7 +231,7 @@ namespace ramses::internal
                 break;
             }
             }
-        }, channelWorkData.keyframes);
+        }, *channelWorkData.keyframes);
 
         if (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions)
         {
@@ -215,6 +265,12 @@ namespace ramses::internal
             }, interpolatedValue);
     }
 
+    namespace
+    {
+        template <typename T>
+        constexpr bool IsFloatVector = std::is_same_v<T, vec2f> || std::is_same_v<T, vec3f> || std::is_same_v<T, vec4f>;
+    }
+
     template <typename T>
     T AnimationNodeImpl::interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio)
     {
@@ -222,8 +278,9 @@ namespace ramses::internal
         if constexpr (std::is_same_v<T, bool>)
             assert(false);
 
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (std::is_floating_point_v<T> || IsFloatVector<T>)
         {
+            // float vectors are interpolated as a whole, using glm vector arithmetic instead of per-component decomposition
             return lowerVal + interpRatio * (upperVal - lowerVal);
         }
         else if constexpr (std::is_integral_v<T>)
@@ -252,9 +309,10 @@ namespace ramses::internal
         if constexpr (std::is_same_v<T, bool>)
             assert(false);
 
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (std::is_floating_point_v<T> || IsFloatVector<T>)
         {
             // GLTF v2 Appendix C (https://github.com/KhronosGroup/glTF/tree/master/specification/2.0?ts=4#appendix-c-spline-interpolation)
+            // basis coefficients are computed once also for float vectors which are interpolated as a whole
             const float t = interpRatio;
             const float t2 = t * t;
             const float t3 = t2 * t;
@@ -459,10 +517,10 @@ namespace ramses::internal
             Property* keyframesProp = channelDataProp->getChild("keyframes");
             assert(timestampsProp && keyframesProp);
             const auto& channelData = m_channelsWorkData[channelIdx];
-            assert(timestampsProp->getChildCount() == channelData.timestamps.size());
+            assert(timestampsProp->getChildCount() == channelData.timestamps->size());
             assert(keyframesProp->getChildCount() == timestampsProp->getChildCount());
 
-            const auto& timestamps = channelData.timestamps;
+            const auto& timestamps = *channelData.timestamps;
             for (size_t i = 0u; i < timestamps.size(); ++i)
                 timestampsProp->getChild(i)->impl().setValue(timestamps[i]);
 
@@ -478,7 +536,7 @@ namespace ramses::internal
                     for (size_t i = 0u; i < keyframes.size(); ++i)
                         keyframesProp->getChild(i)->impl().setValue(keyframes[i]);
                 }
-            }, channelData.keyframes);
+            }, *channelData.keyframes);
         }
     }
 
@@ -490,7 +548,7 @@ namespace ramses::internal
             const auto channelDataProp = channelsDataProp->getChild(ch);
 
             const auto timestampsProp = channelDataProp->getChild(0u);
-            auto& timestamps = m_channelsWorkData[ch].timestamps;
+            auto& timestamps = m_channelsWorkData[ch].timestampsCopy;
             assert(timestamps.size() == timestampsProp->getChildCount());
             for (size_t i = 0u; i < timestamps.size(); ++i)
             {
@@ -499,7 +557,7 @@ namespace ramses::internal
             }
 
             const auto keyframesProp = channelDataProp->getChild(1u);
-            auto& keyframesVariant = m_channelsWorkData[ch].keyframes;
+            auto& keyframesVariant = m_channelsWorkData[ch].keyframesCopy;
             std::visit([&](auto& keyframes) {
                 using ValueType = std::remove_const_t<std::remove_reference_t<decltype(keyframes.front())>>;
                 // array data type requires each array element of each keyframe element to be read from individual input property
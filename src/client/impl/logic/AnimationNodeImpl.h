@@ -54,7 +54,16 @@ namespace ramses::internal
         void createRootProperties() final;
 
     private:
-        void updateChannel(size_t channelIdx, float localAnimationTime);
+        // neighbor keyframes of animation time and interpolation ratio between them
+        struct KeyframeLookup
+        {
+            size_t lowerIdx = 0u;
+            size_t upperIdx = 0u;
+            float interpRatio = 0.f;
+            float timeBetweenKeys = 0.f;
+        };
+        [[nodiscard]] KeyframeLookup findKeyframes(size_t channelIdx, float localAnimationTime);
+        void updateChannel(size_t channelIdx, const KeyframeLookup& lookup);
 
         template <typename T>
         T interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio);
@@ -70,10 +79,19 @@ namespace ramses::internal
         // work data (extracted copy of subset of original data)
         struct ChannelWorkData
         {
-            std::vector<float> timestamps;
-            DataArrayImpl::DataArrayVariant keyframes;
+            // channel data used in update, refers to data of channel's data arrays (read-only, no copy),
+            // or to own copies below if data is exposed via properties and can be modified in runtime
+            const std::vector<float>* timestamps = nullptr;
+            const DataArrayImpl::DataArrayVariant* keyframes = nullptr;
+            std::vector<float> timestampsCopy;
+            DataArrayImpl::DataArrayVariant keyframesCopy;
+            // index of first timestamp greater than animation time in last update, makes lookup O(1) for monotonic time
+            size_t timestampCursor = 0u;
+            // channel whose keyframe lookup is reused because it has same timestamps (index of this channel if none)
+            size_t timestampsSourceChannel = 0u;
         };
         std::vector<ChannelWorkData> m_channelsWorkData;
+        std::vector<KeyframeLookup> m_keyframeLookups;
 
         float m_maxChannelDuration = 0.f;
 
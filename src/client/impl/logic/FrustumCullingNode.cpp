@@ -0,0 +1,47 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses/client/logic/FrustumCullingNode.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
+#include "impl/logic/MeshNodeBindingImpl.h"
+#include "impl/logic/CameraBindingImpl.h"
+
+namespace ramses
+{
+    FrustumCullingNode::FrustumCullingNode(std::unique_ptr<internal::FrustumCullingNodeImpl> impl) noexcept
+        : LogicNode(std::move(impl))
+        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast) */
+        , m_frustumCullingNodeImpl{ static_cast<internal::FrustumCullingNodeImpl&>(LogicNode::m_impl) }
+    {
+    }
+
+    const Camera& FrustumCullingNode::getRamsesCamera() const
+    {
+        return m_frustumCullingNodeImpl.getCameraBinding().getRamsesCamera();
+    }
+
+    size_t FrustumCullingNode::getMeshNodeCount() const
+    {
+        return m_frustumCullingNodeImpl.getMeshNodeBindings().size();
+    }
+
+    const MeshNode& FrustumCullingNode::getRamsesMeshNode(size_t index) const
+    {
+        return m_frustumCullingNodeImpl.getMeshNodeBindings()[index]->getRamsesMeshNode();
+    }
+
+    internal::FrustumCullingNodeImpl& FrustumCullingNode::impl()
+    {
+        return m_frustumCullingNodeImpl;
+    }
+
+    const internal::FrustumCullingNodeImpl& FrustumCullingNode::impl() const
+    {
+        return m_frustumCullingNodeImpl;
+    }
+}
@@ -0,0 +1,319 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/logic/FrustumCullingNodeImpl.h"
+
+#include "ramses/client/MeshNode.h"
+#include "ramses/client/Camera.h"
+
+#include "ramses/client/logic/Property.h"
+
+#include "impl/logic/PropertyImpl.h"
+#include "impl/logic/MeshNodeBindingImpl.h"
+#include "impl/logic/CameraBindingImpl.h"
+#include "impl/MeshNodeImpl.h"
+
+#include "impl/ErrorReporting.h"
+
+#include "internal/logic/AnchorPointCameraCache.h"
+#include "internal/logic/DeserializationMap.h"
+#include "internal/SceneGraph/Scene/ClientScene.h"
+
+#include "internal/logic/flatbuffers/generated/FrustumCullingNodeGen.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        constexpr uint8_t VisibilityNotApplied = 2u;
+
+        HierarchicalTypeData MakeBoundsType(size_t meshNodeCount)
+        {
+            const HierarchicalTypeData boundingSphereType = MakeStruct("", {
+                    TypeData{"center", EPropertyType::Vec3f},
+                    TypeData{"radius", EPropertyType::Float},
+                });
+            return HierarchicalTypeData({ "bounds", EPropertyType::Array }, std::vector<HierarchicalTypeData>(meshNodeCount, boundingSphereType));
+        }
+    }
+
+    FrustumCullingNodeImpl::FrustumCullingNodeImpl(SceneImpl& scene, CameraBindingImpl& cameraBinding, std::vector<MeshNodeBindingImpl*> meshNodeBindings, std::string_view name, sceneObjectId_t id)
+        : LogicNodeImpl{ scene, name, id }
+        , m_cameraBinding{ cameraBinding }
+        , m_meshNodeBindings{ std::move(meshNodeBindings) }
+    {
+        assert(!m_meshNodeBindings.empty());
+        assert(m_meshNodeBindings.size() <= MaxArrayPropertySize);
+        assert(std::find(m_meshNodeBindings.cbegin(), m_meshNodeBindings.cend(), nullptr) == m_meshNodeBindings.cend());
+
+        const size_t meshNodeCount = m_meshNodeBindings.size();
+        m_meshNodeHandles.reserve(meshNodeCount);
+        for (const auto* meshNodeBinding : m_meshNodeBindings)
+            m_meshNodeHandles.push_back(meshNodeBinding->getRamsesMeshNode().impl().getNodeHandle());
+
+        m_centersX.resize(meshNodeCount);
+        m_centersY.resize(meshNodeCount);
+        m_centersZ.resize(meshNodeCount);
+        m_radii.resize(meshNodeCount);
+        m_inside.resize(meshNodeCount);
+        m_appliedVisibility.resize(meshNodeCount, VisibilityNotApplied);
+    }
+
+    void FrustumCullingNodeImpl::createRootProperties()
+    {
+        const size_t meshNodeCount = m_meshNodeBindings.size();
+
+        HierarchicalTypeData inputsType({ "", EPropertyType::Struct }, { MakeBoundsType(meshNodeCount) });
+        auto inputs = std::make_unique<PropertyImpl>(std::move(inputsType), EPropertySemantics::ScriptInput);
+
+        HierarchicalTypeData outputsType({ "", EPropertyType::Struct }, {
+                MakeArray("visible", meshNodeCount, EPropertyType::Bool),
+                MakeType("visibleCount", EPropertyType::Int32)
+            });
+        auto outputs = std::make_unique<PropertyImpl>(std::move(outputsType), EPropertySemantics::ScriptOutput);
+
+        setRootProperties(std::move(inputs), std::move(outputs));
+    }
+
+    flatbuffers::Offset<rlogic_serialization::FrustumCullingNode> FrustumCullingNodeImpl::Serialize(
+        const FrustumCullingNodeImpl& cullingNode,
+        flatbuffers::FlatBufferBuilder& builder,
+        SerializationMap& serializationMap)
+    {
+        const auto fbLogicObject = LogicObjectImpl::Serialize(cullingNode, builder);
+
+        std::vector<uint64_t> meshNodeBindingIds;
+        meshNodeBindingIds.reserve(cullingNode.m_meshNodeBindings.size());
+        for (const auto* meshNodeBinding : cullingNode.m_meshNodeBindings)
+            meshNodeBindingIds.push_back(meshNodeBinding->getSceneObjectId().getValue());
+        const auto fbMeshNodeBindingIds = builder.CreateVector(meshNodeBindingIds);
+
+        const auto fbInputs = PropertyImpl::Serialize(cullingNode.getInputs()->impl(), builder, serializationMap);
+        const auto fbOutputs = PropertyImpl::Serialize(cullingNode.getOutputs()->impl(), builder, serializationMap);
+        auto fbCullingNode = rlogic_serialization::CreateFrustumCullingNode(builder,
+            fbLogicObject,
+            cullingNode.m_cameraBinding.getSceneObjectId().getValue(),
+            fbMeshNodeBindingIds,
+            fbInputs,
+            fbOutputs);
+
+        builder.Finish(fbCullingNode);
+
+        return fbCullingNode;
+    }
+
+    std::unique_ptr<FrustumCullingNodeImpl> FrustumCullingNodeImpl::Deserialize(
+        const rlogic_serialization::FrustumCullingNode& cullingNode,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        std::string name;
+        sceneObjectId_t id{};
+        uint64_t userIdHigh = 0u;
+        uint64_t userIdLow = 0u;
+        if (!LogicObjectImpl::Deserialize(cullingNode.base(), name, id, userIdHigh, userIdLow, errorReporting))
+        {
+            errorReporting.set("Fatal error during loading of FrustumCullingNode from serialized data: missing name and/or ID!", nullptr);
+            return nullptr;
+        }
+
+        if (!cullingNode.rootInput() || !cullingNode.rootOutput())
+        {
+            errorReporting.set("Fatal error during loading of FrustumCullingNode from serialized data: missing root input and/or output!", nullptr);
+            return nullptr;
+        }
+
+        if (!cullingNode.meshNodeBindingIds() || cullingNode.meshNodeBindingIds()->size() == 0u || cullingNode.meshNodeBindingIds()->size() > MaxArrayPropertySize)
+        {
+            errorReporting.set("Fatal error during loading of FrustumCullingNode from serialized data: missing or corrupted mesh node bindings!", nullptr);
+            return nullptr;
+        }
+
+        std::unique_ptr<PropertyImpl> deserializedRootInput = PropertyImpl::Deserialize(*cullingNode.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
+        std::unique_ptr<PropertyImpl> deserializedRootOutput = PropertyImpl::Deserialize(*cullingNode.rootOutput(), EPropertySemantics::ScriptOutput, errorReporting, deserializationMap);
+        if (!deserializedRootInput || !deserializedRootOutput)
+            return nullptr;
+
+        if (!HasValidProperties(*deserializedRootInput, *deserializedRootOutput, cullingNode.meshNodeBindingIds()->size()))
+        {
+            errorReporting.set("Fatal error during loading of FrustumCullingNode: missing or invalid properties!", nullptr);
+            return nullptr;
+        }
+
+        auto* cameraBinding = deserializationMap.resolveLogicObject<CameraBindingImpl>(sceneObjectId_t{ cullingNode.cameraBindingId() });
+        if (!cameraBinding)
+        {
+            errorReporting.set("Fatal error during loading of FrustumCullingNode: could not resolve CameraBinding!", nullptr);
+            return nullptr;
+        }
+
+        std::vector<MeshNodeBindingImpl*> meshNodeBindings;
+        meshNodeBindings.reserve(cullingNode.meshNodeBindingIds()->size());
+        for (const uint64_t meshNodeBindingId : *cullingNode.meshNodeBindingIds())
+        {
+            auto* meshNodeBinding = deserializationMap.resolveLogicObject<MeshNodeBindingImpl>(sceneObjectId_t{ meshNodeBindingId });
+            if (!meshNodeBinding)
+            {
+                errorReporting.set("Fatal error during loading of FrustumCullingNode: could not resolve MeshNodeBinding!", nullptr);
+                return nullptr;
+            }
+            meshNodeBindings.push_back(meshNodeBinding);
+        }
+
+        auto node = std::make_unique<FrustumCullingNodeImpl>(deserializationMap.getScene(), *cameraBinding, std::move(meshNodeBindings), name, id);
+        node->setUserId(userIdHigh, userIdLow);
+        node->setRootProperties(std::move(deserializedRootInput), std::move(deserializedRootOutput));
+
+        return node;
+    }
+
+    bool FrustumCullingNodeImpl::HasValidProperties(const PropertyImpl& rootInput, const PropertyImpl& rootOutput, size_t meshNodeCount)
+    {
+        if (rootInput.getType() != EPropertyType::Struct || rootInput.getChildCount() != 1u ||
+            rootOutput.getType() != EPropertyType::Struct || rootOutput.getChildCount() != 2u)
+            return false;
+
+        const auto* bounds = rootInput.getChild("bounds");
+        const auto* visible = rootOutput.getChild("visible");
+        const auto* visibleCount = rootOutput.getChild("visibleCount");
+        if (!bounds || bounds->getType() != EPropertyType::Array || bounds->getChildCount() != meshNodeCount ||
+            !visible || visible->getType() != EPropertyType::Array || visible->getChildCount() != meshNodeCount ||
+            !visibleCount || visibleCount->getType() != EPropertyType::Int32)
+            return false;
+
+        for (size_t i = 0u; i < meshNodeCount; ++i)
+        {
+            const auto* sphere = bounds->getChild(i);
+            if (sphere->getType() != EPropertyType::Struct || sphere->getChildCount() != 2u ||
+                sphere->getChild(0u)->getName() != "center" || sphere->getChild(0u)->getType() != EPropertyType::Vec3f ||
+                sphere->getChild(1u)->getName() != "radius" || sphere->getChild(1u)->getType() != EPropertyType::Float ||
+                visible->getChild(i)->getType() != EPropertyType::Bool)
+                return false;
+        }
+
+        return true;
+    }
+
+    std::optional<LogicNodeRuntimeError> FrustumCullingNodeImpl::update()
+    {
+        const auto& ramsesCam = m_cameraBinding.getRamsesCamera();
+        AnchorPointCameraCache::CameraData cameraData;
+        auto potentialError = (m_cameraCache ? m_cameraCache->getCameraData(ramsesCam, cameraData) : AnchorPointCameraCache::ComputeCameraData(ramsesCam, cameraData));
+        if (potentialError)
+            return potentialError;
+
+        // all mesh nodes are from the scene of this logic engine, fetch their world matrices in one go
+        const auto& scene = m_meshNodeBindings.front()->getRamsesMeshNode().impl().getIScene();
+        scene.updateMatrixCaches(ETransformationMatrixType_World, m_meshNodeHandles, m_worldMatrices);
+
+        const size_t meshNodeCount = m_meshNodeBindings.size();
+        const PropertyImpl& bounds = getInputs()->getChild(0u)->impl();
+        for (size_t i = 0u; i < meshNodeCount; ++i)
+        {
+            const PropertyImpl& sphere = bounds.getChild(i)->impl();
+            const auto& localCenter = sphere.getChild(0u)->impl().getValueAs<vec3f>();
+            const float localRadius = sphere.getChild(1u)->impl().getValueAs<float>();
+
+            const matrix44f& world = m_worldMatrices[i];
+            const vec4f center = world * vec4f{ localCenter, 1.f };
+            // non-uniform scaling makes an ellipsoid from the sphere, largest axis scale gives conservative bounding sphere
+            const float maxScaleSquared = std::max({ glm::dot(vec3f{ world[0] }, vec3f{ world[0] }), glm::dot(vec3f{ world[1] }, vec3f{ world[1] }), glm::dot(vec3f{ world[2] }, vec3f{ world[2] }) });
+
+            m_centersX[i] = center.x; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            m_centersY[i] = center.y; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            m_centersZ[i] = center.z; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            m_radii[i] = localRadius * std::sqrt(maxScaleSquared);
+        }
+
+        // plain loops over contiguous arrays without branches, vectorized by compiler
+        std::fill(m_inside.begin(), m_inside.end(), uint8_t(1u));
+        for (const auto& plane : ExtractFrustumPlanes(cameraData.viewProjectionMatrix))
+        {
+            const float a = plane.x; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            const float b = plane.y; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            const float c = plane.z; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            const float d = plane.w; // NOLINT(cppcoreguidelines-pro-type-union-access)
+            for (size_t i = 0u; i < meshNodeCount; ++i)
+            {
+                const float distance = a * m_centersX[i] + b * m_centersY[i] + c * m_centersZ[i] + d;
+                m_inside[i] &= static_cast<uint8_t>(distance >= -m_radii[i]);
+            }
+        }
+
+        PropertyImpl& visibleOutputs = getOutputs()->getChild(0u)->impl();
+        int32_t visibleCount = 0;
+        for (size_t i = 0u; i < meshNodeCount; ++i)
+        {
+            const bool inside = (m_inside[i] != 0u);
+            visibleCount += (inside ? 1 : 0);
+            visibleOutputs.getChild(i)->impl().setValue(inside);
+
+            if (m_appliedVisibility[i] != m_inside[i])
+            {
+                if (!m_meshNodeBindings[i]->getRamsesMeshNode().setVisibility(inside ? EVisibilityMode::Visible : EVisibilityMode::Invisible))
+                    return LogicNodeRuntimeError{ "Failed to set visibility of Ramses mesh node!" };
+                m_appliedVisibility[i] = m_inside[i];
+            }
+        }
+        getOutputs()->getChild(1u)->impl().setValue(visibleCount);
+
+        return std::nullopt;
+    }
+
+    FrustumCullingNodeImpl::FrustumPlanes FrustumCullingNodeImpl::ExtractFrustumPlanes(const matrix44f& viewProjectionMatrix)
+    {
+        // Gribb/Hartmann: planes are sums and differences of the rows of the view projection matrix (OpenGL clip space, z in [-w, w])
+        const auto row = [&viewProjectionMatrix](glm::length_t r) {
+            return vec4f{ viewProjectionMatrix[0][r], viewProjectionMatrix[1][r], viewProjectionMatrix[2][r], viewProjectionMatrix[3][r] };
+        };
+        const vec4f row0 = row(0);
+        const vec4f row1 = row(1);
+        const vec4f row2 = row(2);
+        const vec4f row3 = row(3);
+
+        FrustumPlanes planes{
+            row3 + row0, // left
+            row3 - row0, // right
+            row3 + row1, // bottom
+            row3 - row1, // top
+            row3 + row2, // near
+            row3 - row2  // far
+        };
+        for (auto& plane : planes)
+        {
+            const float normalLength = glm::length(vec3f{ plane });
+            if (normalLength > 0.f)
+                plane /= normalLength;
+        }
+
+        return planes;
+    }
+
+    void FrustumCullingNodeImpl::setCameraCache(AnchorPointCameraCache* cameraCache)
+    {
+        m_cameraCache = cameraCache;
+    }
+
+    CameraBindingImpl& FrustumCullingNodeImpl::getCameraBinding()
+    {
+        return m_cameraBinding;
+    }
+
+    const CameraBindingImpl& FrustumCullingNodeImpl::getCameraBinding() const
+    {
+        return m_cameraBinding;
+    }
+
+    const std::vector<MeshNodeBindingImpl*>& FrustumCullingNodeImpl::getMeshNodeBindings() const
+    {
+        return m_meshNodeBindings;
+    }
+}
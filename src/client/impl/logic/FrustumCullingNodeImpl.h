@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/logic/LogicNodeImpl.h"
+#include "internal/SceneGraph/SceneAPI/SceneTypes.h"
+#include <memory>
+#include <vector>
+#include <array>
+
+namespace rlogic_serialization
+{
+    struct FrustumCullingNode;
+}
+
+namespace flatbuffers
+{
+    template<typename T> struct Offset;
+    template<bool> class FlatBufferBuilderImpl;
+    using FlatBufferBuilder = FlatBufferBuilderImpl<false>;
+}
+
+namespace ramses::internal
+{
+    class MeshNodeBindingImpl;
+    class CameraBindingImpl;
+    class ErrorReporting;
+    class AnchorPointCameraCache;
+    class SerializationMap;
+    class DeserializationMap;
+
+    class FrustumCullingNodeImpl : public LogicNodeImpl
+    {
+    public:
+        // Move-able (noexcept); Not copy-able
+        explicit FrustumCullingNodeImpl(SceneImpl& scene, CameraBindingImpl& cameraBinding, std::vector<MeshNodeBindingImpl*> meshNodeBindings, std::string_view name, sceneObjectId_t id);
+        ~FrustumCullingNodeImpl() noexcept override = default;
+        FrustumCullingNodeImpl(const FrustumCullingNodeImpl& other) = delete;
+        FrustumCullingNodeImpl& operator=(const FrustumCullingNodeImpl& other) = delete;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::FrustumCullingNode> Serialize(
+            const FrustumCullingNodeImpl& cullingNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap);
+
+        [[nodiscard]] static std::unique_ptr<FrustumCullingNodeImpl> Deserialize(
+            const rlogic_serialization::FrustumCullingNode& cullingNode,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+        [[nodiscard]] CameraBindingImpl& getCameraBinding();
+        [[nodiscard]] const CameraBindingImpl& getCameraBinding() const;
+        [[nodiscard]] const std::vector<MeshNodeBindingImpl*>& getMeshNodeBindings() const;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+
+        void createRootProperties() final;
+
+        // camera data shared with anchor points during logic engine update, computed on every update if not set
+        void setCameraCache(AnchorPointCameraCache* cameraCache);
+
+        // planes (a, b, c, d) with normalized normals pointing inside of the frustum, a point p is inside of a plane if dot(abc, p) + d >= 0
+        using FrustumPlanes = std::array<vec4f, 6u>;
+        [[nodiscard]] static FrustumPlanes ExtractFrustumPlanes(const matrix44f& viewProjectionMatrix);
+
+    private:
+        [[nodiscard]] static bool HasValidProperties(const PropertyImpl& rootInput, const PropertyImpl& rootOutput, size_t meshNodeCount);
+
+        CameraBindingImpl& m_cameraBinding;
+        std::vector<MeshNodeBindingImpl*> m_meshNodeBindings;
+        AnchorPointCameraCache* m_cameraCache = nullptr;
+
+        NodeHandleVector m_meshNodeHandles;
+        std::vector<matrix44f> m_worldMatrices;
+        // world space bounding spheres stored per component so that the plane tests run over contiguous arrays
+        std::vector<float> m_centersX;
+        std::vector<float> m_centersY;
+        std::vector<float> m_centersZ;
+        std::vector<float> m_radii;
+        std::vector<uint8_t> m_inside;
+        // visibility last set to the mesh nodes, only changes are sent to Ramses
+        std::vector<uint8_t> m_appliedVisibility;
+    };
+}
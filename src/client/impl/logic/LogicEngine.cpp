@@ -22,6 +22,7 @@
 #include "ramses/client/logic/AnimationNode.h"
 #include "ramses/client/logic/TimerNode.h"
 #include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/FrustumCullingNode.h"
 #include "ramses/client/logic/RenderBufferBinding.h"
 
 #include "impl/logic/LogicEngineImpl.h"
@@ -185,11 +186,21 @@ namespace ramses
         return m_impl.createAnchorPoint(nodeBinding, cameraBinding, name);
     }
 
+    FrustumCullingNode* LogicEngine::createFrustumCullingNode(CameraBinding& cameraBinding, const std::vector<MeshNodeBinding*>& meshNodeBindings, std::string_view name)
+    {
+        return m_impl.createFrustumCullingNode(cameraBinding, meshNodeBindings, name);
+    }
+
     bool LogicEngine::update()
     {
         return m_impl.update();
     }
 
+    bool LogicEngine::updateSubgraph(const std::vector<LogicNode*>& rootNodes)
+    {
+        return m_impl.updateSubgraph(rootNodes);
+    }
+
     void LogicEngine::enableUpdateReport(bool enable)
     {
         m_impl.enableUpdateReport(enable);
@@ -200,6 +211,36 @@ namespace ramses
         return m_impl.getLastUpdateReport();
     }
 
+    void LogicEngine::enableParallelUpdate(bool enable)
+    {
+        m_impl.enableParallelUpdate(enable);
+    }
+
+    bool LogicEngine::isParallelUpdateEnabled() const
+    {
+        return m_impl.isParallelUpdateEnabled();
+    }
+
+    void LogicEngine::enableProfiling(bool enable, uint32_t luaSamplingPeriod)
+    {
+        m_impl.enableProfiling(enable, luaSamplingPeriod);
+    }
+
+    std::string LogicEngine::getProfilingResults() const
+    {
+        return m_impl.getProfilingResults();
+    }
+
+    bool LogicEngine::setLuaGarbageCollectorMode(ELuaGarbageCollectorMode mode, uint32_t parameter1, uint32_t parameter2)
+    {
+        return m_impl.setLuaGarbageCollectorMode(mode, parameter1, parameter2);
+    }
+
+    void LogicEngine::setLuaGarbageCollectorStepBudget(uint32_t kilobytes)
+    {
+        m_impl.setLuaGarbageCollectorStepBudget(kilobytes);
+    }
+
     void LogicEngine::setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode)
     {
         m_impl.setStatisticsLoggingRate(loggingRate, mode);
@@ -261,6 +302,7 @@ namespace ramses
     template RAMSES_API Collection<AnimationNode>       LogicEngine::getLogicObjectsInternal<AnimationNode>() const;
     template RAMSES_API Collection<TimerNode>           LogicEngine::getLogicObjectsInternal<TimerNode>() const;
     template RAMSES_API Collection<AnchorPoint>         LogicEngine::getLogicObjectsInternal<AnchorPoint>() const;
+    template RAMSES_API Collection<FrustumCullingNode>  LogicEngine::getLogicObjectsInternal<FrustumCullingNode>() const;
     template RAMSES_API Collection<RenderBufferBinding> LogicEngine::getLogicObjectsInternal<RenderBufferBinding>() const;
 
     template RAMSES_API const LogicObject*         LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view) const;
@@ -278,6 +320,7 @@ namespace ramses
     template RAMSES_API const AnimationNode*       LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view) const;
     template RAMSES_API const TimerNode*           LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view) const;
     template RAMSES_API const AnchorPoint*         LogicEngine::findLogicObjectInternal<AnchorPoint>(std::string_view) const;
+    template RAMSES_API const FrustumCullingNode*  LogicEngine::findLogicObjectInternal<FrustumCullingNode>(std::string_view) const;
     template RAMSES_API const RenderBufferBinding* LogicEngine::findLogicObjectInternal<RenderBufferBinding>(std::string_view) const;
 
     template RAMSES_API LogicObject*         LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view);
@@ -295,6 +338,7 @@ namespace ramses
     template RAMSES_API AnimationNode*       LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view);
     template RAMSES_API TimerNode*           LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view);
     template RAMSES_API AnchorPoint*         LogicEngine::findLogicObjectInternal<AnchorPoint>(std::string_view);
+    template RAMSES_API FrustumCullingNode*  LogicEngine::findLogicObjectInternal<FrustumCullingNode>(std::string_view);
     template RAMSES_API RenderBufferBinding* LogicEngine::findLogicObjectInternal<RenderBufferBinding>(std::string_view);
 
     template RAMSES_API const LogicObject*         LogicEngine::findLogicObjectInternal<LogicObject>(sceneObjectId_t) const;
@@ -312,6 +356,7 @@ namespace ramses
     template RAMSES_API const AnimationNode*       LogicEngine::findLogicObjectInternal<AnimationNode>(sceneObjectId_t) const;
     template RAMSES_API const TimerNode*           LogicEngine::findLogicObjectInternal<TimerNode>(sceneObjectId_t) const;
     template RAMSES_API const AnchorPoint*         LogicEngine::findLogicObjectInternal<AnchorPoint>(sceneObjectId_t) const;
+    template RAMSES_API const FrustumCullingNode*  LogicEngine::findLogicObjectInternal<FrustumCullingNode>(sceneObjectId_t) const;
     template RAMSES_API const RenderBufferBinding* LogicEngine::findLogicObjectInternal<RenderBufferBinding>(sceneObjectId_t) const;
 
     template RAMSES_API LogicObject*         LogicEngine::findLogicObjectInternal<LogicObject>(sceneObjectId_t);
@@ -329,6 +374,7 @@ namespace ramses
     template RAMSES_API AnimationNode*       LogicEngine::findLogicObjectInternal<AnimationNode>(sceneObjectId_t);
     template RAMSES_API TimerNode*           LogicEngine::findLogicObjectInternal<TimerNode>(sceneObjectId_t);
     template RAMSES_API AnchorPoint*         LogicEngine::findLogicObjectInternal<AnchorPoint>(sceneObjectId_t);
+    template RAMSES_API FrustumCullingNode*  LogicEngine::findLogicObjectInternal<FrustumCullingNode>(sceneObjectId_t);
     template RAMSES_API RenderBufferBinding* LogicEngine::findLogicObjectInternal<RenderBufferBinding>(sceneObjectId_t);
 
     template RAMSES_API DataArray* LogicEngine::createDataArrayInternal<float>(const std::vector<float>&, std::string_view);
@@ -356,5 +402,6 @@ namespace ramses
     template RAMSES_API size_t LogicEngine::getSerializedSizeInternal<AnimationNode>(ELuaSavingMode) const;
     template RAMSES_API size_t LogicEngine::getSerializedSizeInternal<TimerNode>(ELuaSavingMode) const;
     template RAMSES_API size_t LogicEngine::getSerializedSizeInternal<AnchorPoint>(ELuaSavingMode) const;
+    template RAMSES_API size_t LogicEngine::getSerializedSizeInternal<FrustumCullingNode>(ELuaSavingMode) const;
     template RAMSES_API size_t LogicEngine::getSerializedSizeInternal<RenderBufferBinding>(ELuaSavingMode) const;
 }
@@ -19,6 +19,7 @@
 #include "ramses/client/logic/AppearanceBinding.h"
 #include "ramses/client/logic/TimerNode.h"
 #include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/FrustumCullingNode.h"
 #include "ramses/client/logic/AnimationNodeConfig.h"
 #include "ramses/client/logic/RenderGroupBinding.h"
 #include "ramses/client/logic/RenderGroupBindingElements.h"
@@ -27,13 +28,17 @@
 #include "ramses/client/logic/RenderBufferBinding.h"
 
 #include "impl/logic/AnchorPointImpl.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
 #include "impl/logic/LogicNodeImpl.h"
 #include "impl/logic/LuaScriptImpl.h"
 #include "impl/logic/LuaModuleImpl.h"
 #include "impl/logic/LuaConfigImpl.h"
 #include "impl/SaveFileConfigImpl.h"
 #include "impl/logic/TimerNodeImpl.h"
+#include "impl/logic/AnimationNodeImpl.h"
 #include "impl/logic/SkinBindingImpl.h"
+#include "impl/logic/NodeBindingImpl.h"
+#include "impl/logic/CameraBindingImpl.h"
 #include "impl/logic/LogicEngineReportImpl.h"
 #include "impl/logic/RenderGroupBindingElementsImpl.h"
 #include "impl/SceneImpl.h"
@@ -64,18 +69,108 @@
 #include "ramses/client/RenderBuffer.h"
 #include "ramses/client/ramses-utils.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+#include "internal/Core/Utils/TraceRecorder.h"
 
 #include "internal/logic/flatbuffers/generated/LogicEngineGen.h"
 #include "ramses-sdk-build-config.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <functional>
+#include <cassert>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <string>
 #include <fstream>
+#include <limits>
 #include <streambuf>
 
 namespace ramses::internal
 {
+    namespace
+    {
+        // Animation nodes to update shared by the updating thread and worker tasks, every node is updated
+        // by whoever picks it first. Tasks keep the state alive, they might get executed only after all nodes were updated.
+        class AnimationNodeUpdateJobs
+        {
+        public:
+            explicit AnimationNodeUpdateJobs(const std::vector<AnimationNodeImpl*>& nodes)
+                : m_nodes(nodes)
+                , m_results(nodes.size())
+            {
+            }
+
+            void updateRemaining()
+            {
+                for (size_t idx = m_nextIndex++; idx < m_nodes.size(); idx = m_nextIndex++)
+                {
+                    m_results[idx] = m_nodes[idx]->update();
+                    if (++m_numUpdated == m_nodes.size())
+                    {
+                        std::lock_guard<std::mutex> l(m_mutex);
+                        m_allUpdated.notify_all();
+                    }
+                }
+            }
+
+            std::vector<std::optional<LogicNodeRuntimeError>> waitUntilAllUpdated()
+            {
+                std::unique_lock<std::mutex> l(m_mutex);
+                m_allUpdated.wait(l, [&] { return m_numUpdated == m_nodes.size(); });
+                return std::move(m_results);
+            }
+
+        private:
+            const std::vector<AnimationNodeImpl*> m_nodes;
+            std::vector<std::optional<LogicNodeRuntimeError>> m_results;
+            std::atomic<size_t> m_nextIndex{ 0u };
+            std::atomic<size_t> m_numUpdated{ 0u };
+            std::mutex m_mutex;
+            std::condition_variable m_allUpdated;
+        };
+
+        class AnimationNodeUpdateTask : public ITask
+        {
+        public:
+            explicit AnimationNodeUpdateTask(std::shared_ptr<AnimationNodeUpdateJobs> jobs)
+                : m_jobs(std::move(jobs))
+            {
+            }
+
+            void execute() override
+            {
+                m_jobs->updateRemaining();
+            }
+
+            [[nodiscard]] ETaskPriority getPriority() const override
+            {
+                return ETaskPriority::High;
+            }
+
+        private:
+            std::shared_ptr<AnimationNodeUpdateJobs> m_jobs;
+        };
+
+        bool HasWeaklyLinkedInput(const PropertyImpl& input)
+        {
+            if (input.hasIncomingLink() && input.getIncomingLink().isWeakLink)
+                return true;
+
+            const auto childCount = input.getChildCount();
+            for (size_t i = 0; i < childCount; ++i)
+            {
+                if (HasWeaklyLinkedInput(input.getChild(i)->impl()))
+                    return true;
+            }
+            return false;
+        }
+    }
+
     LogicEngineImpl::LogicEngineImpl(SceneImpl& sceneImpl, std::string_view name)
         : SceneObjectImpl{ sceneImpl, ERamsesObjectType::LogicEngine, name }
         , m_featureLevel{ sceneImpl.getClientImpl().getFramework().getFeatureLevel() }
@@ -274,6 +369,7 @@ namespace ramses::internal
         for (const auto j : joints)
             jointsAsImpls.push_back(&j->impl());
 
+        m_skinBindingGroupsDirty = true;
         return m_apiObjects->createSkinBinding(std::move(jointsAsImpls), inverseBindMatrices, appearanceBinding.impl(), *actualUniformInputOpt, name);
     }
 
@@ -369,8 +465,37 @@ namespace ramses::internal
         return m_apiObjects->createAnchorPoint(nodeBinding.impl(), cameraBinding.impl(), name);
     }
 
+    FrustumCullingNode* LogicEngineImpl::createFrustumCullingNode(CameraBinding& cameraBinding, const std::vector<MeshNodeBinding*>& meshNodeBindings, std::string_view name)
+    {
+        if (meshNodeBindings.empty() || meshNodeBindings.size() > MaxArrayPropertySize)
+        {
+            getErrorReporting().set(fmt::format("Failed to create FrustumCullingNode '{}': number of mesh node bindings must be between 1 and {}.", name, MaxArrayPropertySize), *this);
+            return nullptr;
+        }
+
+        const auto& cameraBindings = m_apiObjects->getApiObjectContainer<CameraBinding>();
+        const auto& allMeshNodeBindings = m_apiObjects->getApiObjectContainer<MeshNodeBinding>();
+        const bool allMeshNodeBindingsFound = std::all_of(meshNodeBindings.cbegin(), meshNodeBindings.cend(), [&allMeshNodeBindings](const MeshNodeBinding* binding) {
+            return std::find(allMeshNodeBindings.cbegin(), allMeshNodeBindings.cend(), binding) != allMeshNodeBindings.cend();
+        });
+        if (!allMeshNodeBindingsFound || std::find(cameraBindings.cbegin(), cameraBindings.cend(), &cameraBinding) == cameraBindings.cend())
+        {
+            getErrorReporting().set(fmt::format("Failed to create FrustumCullingNode '{}': provided Ramses camera binding and/or mesh node bindings were not found in this logic instance.", name), *this);
+            return nullptr;
+        }
+
+        std::vector<MeshNodeBindingImpl*> meshNodeBindingImpls;
+        meshNodeBindingImpls.reserve(meshNodeBindings.size());
+        for (auto* meshNodeBinding : meshNodeBindings)
+            meshNodeBindingImpls.push_back(&meshNodeBinding->impl());
+
+        return m_apiObjects->createFrustumCullingNode(cameraBinding.impl(), std::move(meshNodeBindingImpls), name);
+    }
+
     bool LogicEngineImpl::destroy(LogicObject& object)
     {
+        if (object.as<SkinBinding>() != nullptr)
+            m_skinBindingGroupsDirty = true;
         return m_apiObjects->destroy(object, getErrorReporting());
     }
 
@@ -379,40 +504,54 @@ namespace ramses::internal
         return m_apiObjects->getLogicNodeDependencies().isLinked(logicNode.impl());
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::activateLinks(const LogicNodeImpl& node)
     {
         size_t activatedLinks = 0u;
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        for (const auto& linkCopy : m_apiObjects->getLogicNodeDependencies().getOutgoingLinkCopies(node))
         {
-            PropertyImpl& child = output.getChild(i)->impl();
+            PropertyImpl* linkedProp = linkCopy.target;
+            const bool valueChanged = linkedProp->setValueFrom(*linkCopy.source);
+            if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
+            {
+                linkedProp->getLogicNode().setDirty(true);
+                ++activatedLinks;
+            }
+        }
 
-            if (TypeUtils::CanHaveChildren(child.getType()))
+        return activatedLinks;
+    }
+
+    bool LogicEngineImpl::update()
+    {
+        return updateInternal(nullptr);
+    }
+
+    bool LogicEngineImpl::updateSubgraph(const std::vector<LogicNode*>& rootNodes)
+    {
+        NodeVector rootNodeImpls;
+        rootNodeImpls.reserve(rootNodes.size());
+        for (LogicNode* rootNode : rootNodes)
+        {
+            if (rootNode == nullptr)
             {
-                activatedLinks += activateLinksRecursive(child);
+                getErrorReporting().set("Failed to update subgraph, null root node given!", *this);
+                return false;
             }
-            else
+            if (!m_apiObjects->getLogicNodeDependencies().containsNode(rootNode->impl()))
             {
-                const auto& outgoingLinks = child.getOutgoingLinks();
-                for (const auto& outLink : outgoingLinks)
-                {
-                    PropertyImpl* linkedProp = outLink.property;
-                    const bool valueChanged = linkedProp->setValue(child.getValue());
-                    if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedProp->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                getErrorReporting().set(fmt::format("Failed to update subgraph, root node '{}' does not belong to this logic engine!", rootNode->getName()), rootNode);
+                return false;
             }
+            rootNodeImpls.push_back(&rootNode->impl());
         }
 
-        return activatedLinks;
+        return updateInternal(&rootNodeImpls);
     }
 
-    bool LogicEngineImpl::update()
+    bool LogicEngineImpl::updateInternal(const NodeVector* rootNodes)
     {
+        RAMSES_TRACE_SCOPE("logic", "LogicEngineUpdate");
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
             m_updateReport.clear();
@@ -430,22 +569,63 @@ namespace ramses::internal
             return false;
         }
 
+        // nodes outside of the subgraph keep their dirty state until they are updated
+        const NodeVector subgraphNodes = (rootNodes ? m_apiObjects->getLogicNodeDependencies().getTopologicallySortedNodesReachableFrom(*rootNodes) : NodeVector{});
+        const NodeVector& nodesToUpdate = (rootNodes ? subgraphNodes : *sortedNodes);
+
         if (m_updateReportEnabled)
             m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
 
         // force dirty all timer nodes, anchor points and skinbindings
         setNodeToBeAlwaysUpdatedDirty();
+        groupSkinBindingsBySkin();
+
+        // node bindings collect transformation changes, written to scene in bulk when update finished or when read by anchor point
+        m_apiObjects->getNodeTransformWriteBuffer().setEnabled(true);
+        // scene could be modified since last update
+        m_apiObjects->getAnchorPointCameraCache().clear();
+
+        // Lua hook must be (re)installed in current Lua state, which is replaced when loading from file
+        if (m_profilingEnabled)
+            m_profiler.attach(m_apiObjects->getSolState());
+
+        // update report and profiler measure every node execution on its own, they are not compatible with parallel execution,
+        // update report also lists all skipped nodes so it needs to visit every node
+        bool success = false;
+        if (m_parallelUpdateEnabled && !m_updateReportEnabled && !m_profilingEnabled && !rootNodes)
+            success = updateNodesInParallel(m_apiObjects->getLogicNodeDependencies().getTopologicalLevels());
+        else if (m_nodeDirtyMechanismEnabled && !m_updateReportEnabled && !rootNodes)
+            success = updateDirtyNodes();
+        else
+            success = updateNodes(nodesToUpdate);
+
+        // all nodes were visited, drop nodes from dirty set which were updated (set is kept otherwise, it can contain non-dirty nodes)
+        if (success && !rootNodes)
+        {
+            NodeSet& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodes();
+            for (auto it = dirtyNodes.begin(); it != dirtyNodes.end();)
+                it = ((*it)->isDirty() ? std::next(it) : dirtyNodes.erase(it));
+        }
 
-        bool success = updateNodes(*sortedNodes);
+        // node transformations collected from node bindings are written also if update failed, their inputs were already consumed
+        success = commitNodeTransforms() && success;
+        m_apiObjects->getNodeTransformWriteBuffer().setEnabled(false);
 
         // update skin bindings only if updating the other nodes succeeded
         if (success)
             success = updateSkinBindings();
 
+        // budgeted collection step replaces automatic collection, which could otherwise run in the middle of any script
+        if (m_luaGcStepBudget != 0u)
+            m_apiObjects->getSolState().stepGarbageCollector(static_cast<int>(std::min<uint32_t>(m_luaGcStepBudget, std::numeric_limits<int>::max())));
+
+        if (m_updateReportEnabled)
+            collectLuaMemoryUsage();
+
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
             m_updateReport.sectionFinished(UpdateReport::ETimingSection::TotalUpdate);
-            m_statistics.collect(m_updateReport, sortedNodes->size());
+            m_statistics.collect(m_updateReport, nodesToUpdate.size());
             if (m_statistics.checkUpdateFrameFinished())
                 m_statistics.calculateAndLog();
         }
@@ -476,6 +656,133 @@ namespace ramses::internal
         return true;
     }
 
+    bool LogicEngineImpl::updateDirtyNodes()
+    {
+        // Visits only nodes which are dirty instead of iterating all sorted nodes. Dirty nodes are processed in topological order
+        // using min-heap on their topological index. Links only lead to nodes later in the order, so nodes which become dirty
+        // by activated links are added to the heap on the go. Nodes behind current position (targets of weak links) stay in dirty set
+        // to be updated in next update, same as when iterating all sorted nodes.
+        LogicNodeDependencies& dependencies = m_apiObjects->getLogicNodeDependencies();
+        NodeSet& dirtyNodes = dependencies.getDirtyNodes();
+        const auto byIndex = std::greater<>();
+
+        m_dirtyNodeQueue.clear();
+        for (LogicNodeImpl* node : dirtyNodes)
+            m_dirtyNodeQueue.emplace_back(dependencies.getTopologicalIndex(*node), node);
+        dirtyNodes.clear();
+        std::make_heap(m_dirtyNodeQueue.begin(), m_dirtyNodeQueue.end(), byIndex);
+
+        NodeVector dirtyForNextUpdate;
+        while (!m_dirtyNodeQueue.empty())
+        {
+            std::pop_heap(m_dirtyNodeQueue.begin(), m_dirtyNodeQueue.end(), byIndex);
+            const auto [currentIndex, nodePtr] = m_dirtyNodeQueue.back();
+            m_dirtyNodeQueue.pop_back();
+            LogicNodeImpl& node = *nodePtr;
+
+            // skip also processing of SkinBindings, since they will be processed after updating everything else
+            if (!node.isDirty() || dynamic_cast<SkinBindingImpl*>(&node))
+                continue;
+
+            if (!updateNode(node))
+            {
+                // keep all nodes which were not updated for next update
+                dirtyNodes.insert(&node);
+                for (const auto& queued : m_dirtyNodeQueue)
+                    dirtyNodes.insert(queued.second);
+                dirtyNodes.insert(dirtyForNextUpdate.cbegin(), dirtyForNextUpdate.cend());
+                return false;
+            }
+
+            for (LogicNodeImpl* dirtiedNode : dirtyNodes)
+            {
+                const size_t index = dependencies.getTopologicalIndex(*dirtiedNode);
+                if (index > currentIndex)
+                {
+                    m_dirtyNodeQueue.emplace_back(index, dirtiedNode);
+                    std::push_heap(m_dirtyNodeQueue.begin(), m_dirtyNodeQueue.end(), byIndex);
+                }
+                else
+                {
+                    dirtyForNextUpdate.push_back(dirtiedNode);
+                }
+            }
+            dirtyNodes.clear();
+        }
+        dirtyNodes.insert(dirtyForNextUpdate.cbegin(), dirtyForNextUpdate.cend());
+
+        return true;
+    }
+
+    bool LogicEngineImpl::updateNodesInParallel(const std::vector<NodeVector>& levels)
+    {
+        std::vector<AnimationNodeImpl*> animationNodes;
+        std::vector<std::optional<LogicNodeRuntimeError>> animationResults;
+        for (const auto& levelNodes : levels)
+        {
+            // Nodes of one level do not depend on each other. Animation nodes only work with their own properties,
+            // so those can be updated concurrently, all other nodes are updated one after another in the order of the level.
+            // Outputs of all nodes (including the concurrently updated animations) are propagated via links in that order as well.
+            // Animation nodes with weakly linked inputs are excluded, weak link from a node in the same level could activate
+            // them only after they were updated.
+            animationNodes.clear();
+            for (LogicNodeImpl* node : levelNodes)
+            {
+                auto* animationNode = dynamic_cast<AnimationNodeImpl*>(node);
+                if (animationNode != nullptr && (animationNode->isDirty() || !m_nodeDirtyMechanismEnabled) && !HasWeaklyLinkedInput(animationNode->getInputs()->impl()))
+                    animationNodes.push_back(animationNode);
+            }
+
+            if (animationNodes.size() >= MinAnimationNodesForParallelUpdate)
+                updateAnimationNodesInParallel(animationNodes, animationResults);
+            else
+                animationNodes.clear();
+
+            size_t animationIdx = 0u;
+            for (LogicNodeImpl* nodeIter : levelNodes)
+            {
+                LogicNodeImpl& node = *nodeIter;
+
+                if (animationIdx < animationNodes.size() && animationNodes[animationIdx] == &node)
+                {
+                    if (!finishNodeUpdate(node, animationResults[animationIdx]))
+                        return false;
+                    ++animationIdx;
+                    continue;
+                }
+
+                // skip also processing of SkinBindings, since they will be processed after updating everything else
+                if (!node.isDirty() || dynamic_cast<SkinBindingImpl*>(&node))
+                {
+                    if (m_nodeDirtyMechanismEnabled)
+                        continue;
+                }
+
+                if (!updateNode(node))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    void LogicEngineImpl::updateAnimationNodesInParallel(const std::vector<AnimationNodeImpl*>& animationNodes, std::vector<std::optional<LogicNodeRuntimeError>>& results)
+    {
+        ITaskQueue& taskQueue = getClientImpl().getFramework().getTaskQueue();
+
+        // calling thread takes part in updating, so it never waits on tasks which the queue did not get to yet
+        auto jobs = std::make_shared<AnimationNodeUpdateJobs>(animationNodes);
+        const size_t numTasks = std::min(animationNodes.size() - 1u, MaxParallelAnimationUpdateTasks);
+        for (size_t i = 0u; i < numTasks; ++i)
+        {
+            auto task = new AnimationNodeUpdateTask(jobs);
+            taskQueue.enqueue(*task);
+            task->release();
+        }
+        jobs->updateRemaining();
+        results = jobs->waitUntilAllUpdated();
+    }
+
     bool LogicEngineImpl::updateSkinBindings()
     {
         for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>()) {
@@ -486,24 +793,80 @@ namespace ramses::internal
         return true;
     }
 
+    bool LogicEngineImpl::commitNodeTransforms()
+    {
+        NodeTransformWriteBuffer& writeBuffer = m_apiObjects->getNodeTransformWriteBuffer();
+        return writeBuffer.empty() || writeBuffer.commit();
+    }
+
+    void LogicEngineImpl::groupSkinBindingsBySkin()
+    {
+        if (!m_skinBindingGroupsDirty)
+            return;
+
+        // first skin binding of every group calculates joint matrices, the others in group (updated after it) copy them
+        std::vector<const SkinBindingImpl*> groupSources;
+        for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>())
+        {
+            auto& skinBindingImpl = skinBinding->impl();
+            const auto it = std::find_if(groupSources.cbegin(), groupSources.cend(), [&skinBindingImpl](const SkinBindingImpl* source) { return source->hasSameSkin(skinBindingImpl); });
+            if (it == groupSources.cend())
+            {
+                skinBindingImpl.setJointMatricesSource(nullptr);
+                groupSources.push_back(&skinBindingImpl);
+            }
+            else
+            {
+                skinBindingImpl.setJointMatricesSource(*it);
+            }
+        }
+
+        m_skinBindingGroupsDirty = false;
+    }
+
     bool LogicEngineImpl::updateNode(LogicNodeImpl& node)
     {
         if (m_updateReportEnabled)
             m_updateReport.nodeExecutionStarted(node);
+
+        // update report tracks Lua memory kept by every script update
+        auto* script = (m_updateReportEnabled ? dynamic_cast<LuaScriptImpl*>(&node) : nullptr);
+        const size_t luaMemoryBefore = (script != nullptr ? m_apiObjects->getSolState().getMemoryUsage() : 0u);
+
+        // anchor point and frustum culling node read node transformations from scene, changes collected from node bindings must be written before
+        if ((dynamic_cast<AnchorPointImpl*>(&node) != nullptr || dynamic_cast<FrustumCullingNodeImpl*>(&node) != nullptr) && !commitNodeTransforms())
+            return false;
+
+        if (m_profilingEnabled)
+            m_profiler.nodeUpdateStarted(node);
+        const auto potentialError = node.update();
+        if (m_profilingEnabled)
+            m_profiler.nodeUpdateFinished();
+
+        // camera data shared by anchor points is outdated when a camera or node transformation changes
+        AnchorPointCameraCache& anchorPointCameraCache = m_apiObjects->getAnchorPointCameraCache();
+        if (!anchorPointCameraCache.empty() && (dynamic_cast<CameraBindingImpl*>(&node) != nullptr || dynamic_cast<NodeBindingImpl*>(&node) != nullptr))
+            anchorPointCameraCache.clear();
+        if (script != nullptr)
+            m_updateReport.luaMemoryChanged(node, static_cast<int64_t>(m_apiObjects->getSolState().getMemoryUsage()) - static_cast<int64_t>(luaMemoryBefore));
+
+        return finishNodeUpdate(node, potentialError);
+    }
+
+    bool LogicEngineImpl::finishNodeUpdate(LogicNodeImpl& node, const std::optional<LogicNodeRuntimeError>& potentialError)
+    {
         if (m_statisticsEnabled)
             m_statistics.nodeExecuted();
 
-        const std::optional<LogicNodeRuntimeError> potentialError = node.update();
         if (potentialError)
         {
             getErrorReporting().set(potentialError->message, &node.getLogicObject());
             return false;
         }
 
-        Property* outputs = node.getOutputs();
-        if (outputs != nullptr)
+        if (node.getOutputs() != nullptr)
         {
-            const size_t activatedLinks = activateLinksRecursive(outputs->impl());
+            const size_t activatedLinks = activateLinks(node);
 
             if (m_statisticsEnabled || m_updateReportEnabled)
                 m_updateReport.linksActivated(activatedLinks);
@@ -524,6 +887,9 @@ namespace ramses::internal
         // force anchor points dirty because they depend on set of ramses states which cannot be monitored
         for (AnchorPoint* anchorPoint : m_apiObjects->getApiObjectContainer<AnchorPoint>())
             anchorPoint->impl().setDirty(true);
+        // same for frustum culling nodes
+        for (FrustumCullingNode* cullingNode : m_apiObjects->getApiObjectContainer<FrustumCullingNode>())
+            cullingNode->impl().setDirty(true);
     }
 
     void LogicEngineImpl::onValidate(ValidationReportImpl& report) const
@@ -535,7 +901,7 @@ namespace ramses::internal
         m_apiObjects->validateDanglingNodes(report);
     }
 
-    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription, const SceneMergeHandleMapping* mapping)
+    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription, const SceneMergeHandleMapping* mapping, bool lazyLuaScriptLoading)
     {
         if (byteSize < 8)
         {
@@ -573,15 +939,33 @@ namespace ramses::internal
         }
 
         RamsesObjectResolver ramsesResolver{ getErrorReporting(), getSceneImpl(), mapping };
-        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(getSceneImpl(), *logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, getErrorReporting(), m_featureLevel);
+        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(getSceneImpl(), *logicEngine->apiObjects(), ramsesResolver, dataSourceDescription, getErrorReporting(), m_featureLevel, lazyLuaScriptLoading);
 
         if (!deserializedObjects)
         {
             return false;
         }
 
+        // files saved before garbage collector settings were stored have none, Lua defaults are used then
+        const auto* luaGcParameters = logicEngine->luaGcParameters();
+        if (logicEngine->luaGcMode() > static_cast<uint8_t>(ELuaGarbageCollectorMode::Generational) || (luaGcParameters && luaGcParameters->size() != 4u))
+        {
+            getErrorReporting().set(fmt::format("Fatal error while loading {}: invalid Lua garbage collector settings!", dataSourceDescription), *this);
+            return false;
+        }
+
         // No errors -> move data into member
         m_apiObjects = std::move(deserializedObjects);
+        m_skinBindingGroupsDirty = true;
+        m_luaGcMode = static_cast<ELuaGarbageCollectorMode>(logicEngine->luaGcMode());
+        m_luaGcParameters = {};
+        if (luaGcParameters)
+        {
+            m_luaGcParameters[static_cast<size_t>(ELuaGarbageCollectorMode::Incremental)] = { luaGcParameters->Get(0), luaGcParameters->Get(1) };
+            m_luaGcParameters[static_cast<size_t>(ELuaGarbageCollectorMode::Generational)] = { luaGcParameters->Get(2), luaGcParameters->Get(3) };
+        }
+        m_luaGcStepBudget = logicEngine->luaGcStepBudget();
+        applyLuaGarbageCollectorSettings();
 
         return true;
     }
@@ -610,8 +994,14 @@ namespace ramses::internal
             return false;
         }
 
+        const auto& incrementalParameters = m_luaGcParameters[static_cast<size_t>(ELuaGarbageCollectorMode::Incremental)];
+        const auto& generationalParameters = m_luaGcParameters[static_cast<size_t>(ELuaGarbageCollectorMode::Generational)];
+        const std::vector<int32_t> luaGcParameters{ incrementalParameters[0], incrementalParameters[1], generationalParameters[0], generationalParameters[1] };
         const auto logicEngine = rlogic_serialization::CreateLogicEngine(builder,
-            ApiObjects::Serialize(*m_apiObjects, builder, config.getLuaSavingMode()));
+            ApiObjects::Serialize(*m_apiObjects, builder, config.getLuaSavingMode()),
+            static_cast<uint8_t>(m_luaGcMode),
+            builder.CreateVector(luaGcParameters),
+            m_luaGcStepBudget);
 
         builder.Finish(logicEngine);
 
@@ -648,6 +1038,16 @@ namespace ramses::internal
         m_nodeDirtyMechanismEnabled = false;
     }
 
+    void LogicEngineImpl::enableParallelUpdate(bool enable)
+    {
+        m_parallelUpdateEnabled = enable;
+    }
+
+    bool LogicEngineImpl::isParallelUpdateEnabled() const
+    {
+        return m_parallelUpdateEnabled;
+    }
+
     void LogicEngineImpl::enableUpdateReport(bool enable)
     {
         m_updateReportEnabled = enable;
@@ -682,6 +1082,80 @@ namespace ramses::internal
         }
     }
 
+    void LogicEngineImpl::enableProfiling(bool enable, uint32_t luaSamplingPeriod)
+    {
+        if (enable)
+        {
+            m_profiler.clear();
+            m_profiler.setLuaSamplingPeriod(luaSamplingPeriod);
+        }
+        else
+        {
+            m_profiler.detach(m_apiObjects->getSolState());
+        }
+        m_profilingEnabled = enable;
+    }
+
+    std::string LogicEngineImpl::getProfilingResults() const
+    {
+        return m_profiler.getFoldedStacks();
+    }
+
+    bool LogicEngineImpl::setLuaGarbageCollectorMode(ELuaGarbageCollectorMode mode, uint32_t parameter1, uint32_t parameter2)
+    {
+        const int luaParameter1 = static_cast<int>(std::min<uint32_t>(parameter1, std::numeric_limits<int>::max()));
+        const int luaParameter2 = static_cast<int>(std::min<uint32_t>(parameter2, std::numeric_limits<int>::max()));
+        if (!m_apiObjects->getSolState().setGarbageCollectorMode(mode, luaParameter1, luaParameter2))
+        {
+            getErrorReporting().set("Failed to set Lua garbage collector mode, generational mode is not supported by the Lua version used!", *this);
+            return false;
+        }
+
+        m_luaGcMode = mode;
+        auto& modeParameters = m_luaGcParameters[static_cast<size_t>(mode)];
+        if (luaParameter1 != 0)
+            modeParameters[0] = luaParameter1;
+        if (luaParameter2 != 0)
+            modeParameters[1] = luaParameter2;
+
+        return true;
+    }
+
+    void LogicEngineImpl::setLuaGarbageCollectorStepBudget(uint32_t kilobytes)
+    {
+        m_luaGcStepBudget = kilobytes;
+        m_apiObjects->getSolState().setAutomaticGarbageCollection(kilobytes == 0u);
+    }
+
+    void LogicEngineImpl::applyLuaGarbageCollectorSettings()
+    {
+        // parameters of both modes are kept by Lua, so those of incremental mode are restored also if generational mode is used
+        SolState& solState = m_apiObjects->getSolState();
+        const auto& incrementalParameters = m_luaGcParameters[static_cast<size_t>(ELuaGarbageCollectorMode::Incremental)];
+        [[maybe_unused]] const bool incrementalModeSet = solState.setGarbageCollectorMode(ELuaGarbageCollectorMode::Incremental, incrementalParameters[0], incrementalParameters[1]);
+        assert(incrementalModeSet);
+        if (m_luaGcMode != ELuaGarbageCollectorMode::Incremental)
+        {
+            const auto& modeParameters = m_luaGcParameters[static_cast<size_t>(m_luaGcMode)];
+            if (!solState.setGarbageCollectorMode(m_luaGcMode, modeParameters[0], modeParameters[1]))
+            {
+                // file saved with Lua version supporting generational mode
+                LOG_WARN(CONTEXT_CLIENT, "LogicEngine: generational Lua garbage collector mode is not supported by the Lua version used, using incremental mode");
+                m_luaGcMode = ELuaGarbageCollectorMode::Incremental;
+            }
+        }
+        solState.setAutomaticGarbageCollection(m_luaGcStepBudget == 0u);
+    }
+
+    void LogicEngineImpl::collectLuaMemoryUsage()
+    {
+        UpdateReport::LuaMemoryUsages modulesMemory;
+        modulesMemory.reserve(m_apiObjects->getApiObjectContainer<LuaModule>().size());
+        for (LuaModule* module : m_apiObjects->getApiObjectContainer<LuaModule>())
+            modulesMemory.push_back({ &module->impl(), module->impl().getLuaMemoryUsage() });
+        m_updateReport.luaMemoryMeasured(m_apiObjects->getSolState().getMemoryUsage(), std::move(modulesMemory));
+    }
+
     size_t LogicEngineImpl::getTotalSerializedSize(ELuaSavingMode luaSavingMode) const
     {
         return ApiObjectsSerializedSize::GetTotalSerializedSize(*m_apiObjects, luaSavingMode);
@@ -710,8 +1184,20 @@ namespace ramses::internal
 
         uint32_t size = 0u;
         inStream >> size;
-        m_byteBuffer.resize(size);
-        inStream.read(m_byteBuffer.data(), size);
+        // prefetched scene data stays in memory until dependencies are resolved, use it in place if flatbuffers can read it without copy
+        auto* memoryStream = dynamic_cast<BinaryInputStream*>(&inStream);
+        if (memoryStream && (reinterpret_cast<uintptr_t>(memoryStream->readPosition()) % alignof(uint64_t)) == 0u)
+        {
+            m_byteData = memoryStream->readPosition();
+            memoryStream->skip(size);
+        }
+        else
+        {
+            m_byteBuffer.resize(size);
+            inStream.read(m_byteBuffer.data(), size);
+            m_byteData = m_byteBuffer.data();
+        }
+        m_byteDataSize = size;
         // we need to parse the byte buffer later when all scene objects are available
         serializationContext.addForDependencyResolve(this);
         return true;
@@ -720,9 +1206,12 @@ namespace ramses::internal
     bool LogicEngineImpl::resolveDeserializationDependencies(DeserializationContext& serializationContext)
     {
         const bool enableMemoryVerification = serializationContext.getLoadConfig().getMemoryVerificationEnabled();
-        if (!loadFromByteData(m_byteBuffer.data(), m_byteBuffer.size(), enableMemoryVerification, fmt::format("data buffer '{}' (size: {})", m_byteBuffer.data(), m_byteBuffer.size()), serializationContext.getSceneMergeHandleMapping()))
+        const bool lazyLuaScriptLoading = serializationContext.getLoadConfig().getLazyLuaScriptLoadingEnabled();
+        if (!loadFromByteData(m_byteData, m_byteDataSize, enableMemoryVerification, fmt::format("data buffer '{}' (size: {})", m_byteData, m_byteDataSize), serializationContext.getSceneMergeHandleMapping(), lazyLuaScriptLoading))
             return false;
 
+        m_byteData = nullptr;
+        m_byteDataSize = 0u;
         std::vector<char>().swap(m_byteBuffer);
         return true;
     }
@@ -19,12 +19,15 @@
 #include "internal/logic/LogicNodeDependencies.h"
 #include "internal/logic/UpdateReport.h"
 #include "internal/logic/LogicNodeUpdateStatistics.h"
+#include "internal/logic/LogicNodeUpdateProfiler.h"
 #include "internal/logic/ApiObjectsSerializedSize.h"
 
 #include "ramses/framework/RamsesFrameworkTypes.h"
 #include "ramses/framework/ERotationType.h"
 
+#include <array>
 #include <memory>
+#include <optional>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -55,6 +58,7 @@ namespace ramses
     class AnimationNodeConfig;
     class TimerNode;
     class AnchorPoint;
+    class FrustumCullingNode;
     class LuaScript;
     class LuaInterface;
     class LuaModule;
@@ -68,8 +72,10 @@ namespace ramses::internal
     class LuaConfigImpl;
     class SaveFileConfigImpl;
     class LogicNodeImpl;
+    class AnimationNodeImpl;
     class RamsesBindingImpl;
     class ValidationReportImpl;
+    struct LogicNodeRuntimeError;
     class ApiObjects;
     class SceneMergeHandleMapping;
 
@@ -102,10 +108,12 @@ namespace ramses::internal
         AnimationNode* createAnimationNode(const AnimationNodeConfig& config, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
         AnchorPoint* createAnchorPoint(NodeBinding& nodeBinding, CameraBinding& cameraBinding, std::string_view name);
+        FrustumCullingNode* createFrustumCullingNode(CameraBinding& cameraBinding, const std::vector<MeshNodeBinding*>& meshNodeBindings, std::string_view name);
 
         bool destroy(LogicObject& object);
 
         bool update();
+        bool updateSubgraph(const std::vector<LogicNode*>& rootNodes);
 
         void onValidate(ValidationReportImpl& report) const override;
 
@@ -124,7 +132,19 @@ namespace ramses::internal
         void enableUpdateReport(bool enable);
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
 
+        void enableParallelUpdate(bool enable);
+        [[nodiscard]] bool isParallelUpdateEnabled() const;
+
+        // animation nodes of a topological level are updated in parallel only if there is at least this many of them
+        static constexpr size_t MinAnimationNodesForParallelUpdate = 4u;
+        static constexpr size_t MaxParallelAnimationUpdateTasks = 4u;
+
         void setStatisticsLoggingRate(size_t loggingRate, EStatisticsLogMode mode = EStatisticsLogMode::Compact);
+        void enableProfiling(bool enable, uint32_t luaSamplingPeriod);
+        [[nodiscard]] std::string getProfilingResults() const;
+
+        bool setLuaGarbageCollectorMode(ELuaGarbageCollectorMode mode, uint32_t parameter1, uint32_t parameter2);
+        void setLuaGarbageCollectorStepBudget(uint32_t kilobytes);
 
         [[nodiscard]] size_t getTotalSerializedSize(ELuaSavingMode luaSavingMode) const;
         template<typename T>
@@ -138,26 +158,52 @@ namespace ramses::internal
 
     private:
         bool save(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config);
-        size_t activateLinksRecursive(PropertyImpl& output);
+        size_t activateLinks(const LogicNodeImpl& node);
         void setNodeToBeAlwaysUpdatedDirty();
+        // updates all nodes or only the nodes reachable from given roots
+        [[nodiscard]] bool updateInternal(const NodeVector* rootNodes);
 
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateDirtyNodes();
+        [[nodiscard]] bool updateNodesInParallel(const std::vector<NodeVector>& levels);
+        void updateAnimationNodesInParallel(const std::vector<AnimationNodeImpl*>& animationNodes, std::vector<std::optional<LogicNodeRuntimeError>>& results);
 
         [[nodiscard]] bool updateSkinBindings();
+        [[nodiscard]] bool commitNodeTransforms();
+        void groupSkinBindingsBySkin();
+        // garbage collector settings belong to Lua state, which is replaced when loading from file, they are saved with the logic content
+        void applyLuaGarbageCollectorSettings();
+        void collectLuaMemoryUsage();
         [[nodiscard]] bool updateNode(LogicNodeImpl& node);
+        [[nodiscard]] bool finishNodeUpdate(LogicNodeImpl& node, const std::optional<LogicNodeRuntimeError>& potentialError);
 
-        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription, const SceneMergeHandleMapping* mapping);
+        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, bool enableMemoryVerification, const std::string& dataSourceDescription, const SceneMergeHandleMapping* mapping, bool lazyLuaScriptLoading = false);
 
         EFeatureLevel m_featureLevel;
 
         std::unique_ptr<ApiObjects> m_apiObjects;
         bool m_nodeDirtyMechanismEnabled = true;
+        // dirty nodes with their topological index, kept as member to reuse allocation between updates
+        std::vector<std::pair<size_t, LogicNodeImpl*>> m_dirtyNodeQueue;
+        // set whenever skin bindings might have been created or destroyed
+        bool m_skinBindingGroupsDirty = true;
 
         bool m_updateReportEnabled = false;
         bool m_statisticsEnabled   = true;
+        bool m_parallelUpdateEnabled = false;
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
+        bool m_profilingEnabled = false;
+        LogicNodeUpdateProfiler m_profiler;
+        ELuaGarbageCollectorMode m_luaGcMode = ELuaGarbageCollectorMode::Incremental;
+        // parameters given by user for each mode, zero keeps Lua default
+        std::array<std::array<int, 2u>, 2u> m_luaGcParameters{};
+        uint32_t m_luaGcStepBudget = 0u;
+        // serialized logic data kept until all scene objects are deserialized, either copied to m_byteBuffer or
+        // pointing directly into prefetched scene data which outlives dependency resolving
         std::vector<char>         m_byteBuffer;
+        const void*               m_byteData = nullptr;
+        size_t                    m_byteDataSize = 0u;
     };
 
     template<typename T>
@@ -50,4 +50,19 @@ namespace ramses
         return m_impl->getTotalLinkActivations();
     }
 
+    const std::vector<LogicEngineReport::LogicNodeLuaMemory>& LogicEngineReport::getLuaMemoryChangePerScript() const
+    {
+        return m_impl->getLuaMemoryChangePerScript();
+    }
+
+    const std::vector<LogicEngineReport::LuaModuleMemory>& LogicEngineReport::getLuaMemoryPerModule() const
+    {
+        return m_impl->getLuaMemoryPerModule();
+    }
+
+    size_t LogicEngineReport::getLuaMemoryUsage() const
+    {
+        return m_impl->getLuaMemoryUsage();
+    }
+
 }
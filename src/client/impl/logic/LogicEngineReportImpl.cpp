@@ -17,6 +17,7 @@ namespace ramses::internal
         : m_totalUpdateExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TotalUpdate) }
         , m_topologySortExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TopologySort) }
         , m_activatedLinks{ reportData.getLinkActivations() }
+        , m_luaMemoryUsage{ reportData.getLuaMemoryUsage() }
     {
         m_nodesExecuted.reserve(reportData.getNodesExecuted().size());
         for (const auto& n : reportData.getNodesExecuted())
@@ -25,6 +26,14 @@ namespace ramses::internal
         m_nodesSkippedExecution.reserve(reportData.getNodesSkippedExecution().size());
         for (const auto& n : reportData.getNodesSkippedExecution())
             m_nodesSkippedExecution.push_back(n->getLogicObject().as<LogicNode>());
+
+        m_luaMemoryChangePerScript.reserve(reportData.getLuaMemoryChanges().size());
+        for (const auto& n : reportData.getLuaMemoryChanges())
+            m_luaMemoryChangePerScript.push_back({ n.first->getLogicObject().as<LogicNode>(), n.second });
+
+        m_luaMemoryPerModule.reserve(reportData.getLuaModulesMemoryUsage().size());
+        for (const auto& m : reportData.getLuaModulesMemoryUsage())
+            m_luaMemoryPerModule.push_back({ m.first->getLogicObject().as<LuaModule>(), m.second });
     }
 
     const LogicEngineReportImpl::LogicNodesTimed& LogicEngineReportImpl::getNodesExecuted() const
@@ -52,4 +61,19 @@ namespace ramses::internal
         return m_activatedLinks;
     }
 
+    const LogicEngineReportImpl::LogicNodesLuaMemory& LogicEngineReportImpl::getLuaMemoryChangePerScript() const
+    {
+        return m_luaMemoryChangePerScript;
+    }
+
+    const LogicEngineReportImpl::LuaModulesMemory& LogicEngineReportImpl::getLuaMemoryPerModule() const
+    {
+        return m_luaMemoryPerModule;
+    }
+
+    size_t LogicEngineReportImpl::getLuaMemoryUsage() const
+    {
+        return m_luaMemoryUsage;
+    }
+
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "ramses/client/logic/LogicNode.h"
+#include "ramses/client/logic/LuaModule.h"
 #include "internal/logic/UpdateReport.h"
 
 namespace ramses::internal
@@ -18,6 +19,8 @@ namespace ramses::internal
     public:
         using LogicNodesTimed = std::vector<std::pair<LogicNode*, UpdateReport::ReportTimeUnits>>;
         using LogicNodes = std::vector<LogicNode*>;
+        using LogicNodesLuaMemory = std::vector<std::pair<LogicNode*, int64_t>>;
+        using LuaModulesMemory = std::vector<std::pair<LuaModule*, size_t>>;
 
         LogicEngineReportImpl();
         explicit LogicEngineReportImpl(const UpdateReport& reportData);
@@ -27,6 +30,9 @@ namespace ramses::internal
         [[nodiscard]] std::chrono::microseconds getTopologySortExecutionTime() const;
         [[nodiscard]] std::chrono::microseconds getTotalUpdateExecutionTime() const;
         [[nodiscard]] size_t getTotalLinkActivations() const;
+        [[nodiscard]] const LogicNodesLuaMemory& getLuaMemoryChangePerScript() const;
+        [[nodiscard]] const LuaModulesMemory& getLuaMemoryPerModule() const;
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
 
     private:
         LogicNodesTimed m_nodesExecuted;
@@ -34,5 +40,8 @@ namespace ramses::internal
         UpdateReport::ReportTimeUnits m_totalUpdateExecutionTime{ 0 };
         UpdateReport::ReportTimeUnits m_topologySortExecutionTime{ 0 };
         size_t m_activatedLinks = 0u;
+        LogicNodesLuaMemory m_luaMemoryChangePerScript;
+        LuaModulesMemory m_luaMemoryPerModule;
+        size_t m_luaMemoryUsage = 0u;
     };
 }
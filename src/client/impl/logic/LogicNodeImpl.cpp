@@ -43,6 +43,8 @@ namespace ramses::internal
 
     void LogicNodeImpl::setDirty(bool dirty)
     {
+        if (dirty && !m_dirty && m_dirtyNodes != nullptr)
+            m_dirtyNodes->insert(this);
         m_dirty = dirty;
     }
 
@@ -51,6 +53,13 @@ namespace ramses::internal
         return m_dirty;
     }
 
+    void LogicNodeImpl::setDirtyNodeSet(std::unordered_set<LogicNodeImpl*>* dirtyNodes)
+    {
+        m_dirtyNodes = dirtyNodes;
+        if (m_dirty && m_dirtyNodes != nullptr)
+            m_dirtyNodes->insert(this);
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
     {
         assert(!m_inputs);
@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <unordered_set>
 
 namespace ramses::internal
 {
@@ -39,6 +40,9 @@ namespace ramses::internal
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Set of nodes collected for logic engine update, node adds itself to it whenever it becomes dirty
+        void setDirtyNodeSet(std::unordered_set<LogicNodeImpl*>* dirtyNodes);
+
     protected:
         void setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
 
@@ -48,5 +52,6 @@ namespace ramses::internal
 
         // Dirty after creation (every node gets executed at least once after creation)
         bool m_dirty = true;
+        std::unordered_set<LogicNodeImpl*>* m_dirtyNodes = nullptr;
     };
 }
@@ -22,6 +22,11 @@ namespace ramses
         m_impl->enableDebugLogFunctions();
     }
 
+    void LuaConfig::enableTrustedNumericConversions()
+    {
+        m_impl->enableTrustedNumericConversions();
+    }
+
     LuaConfig::~LuaConfig() noexcept = default;
 
     LuaConfig& LuaConfig::operator=(const LuaConfig& other)
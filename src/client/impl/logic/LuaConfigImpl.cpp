@@ -83,4 +83,14 @@ namespace ramses::internal
     {
         return m_debugLogFunctionsEnabled;
     }
+
+    void LuaConfigImpl::enableTrustedNumericConversions()
+    {
+        m_trustedNumericConversionsEnabled = true;
+    }
+
+    bool LuaConfigImpl::hasTrustedNumericConversionsEnabled() const
+    {
+        return m_trustedNumericConversionsEnabled;
+    }
 }
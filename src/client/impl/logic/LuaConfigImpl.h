@@ -31,14 +31,17 @@ namespace ramses::internal
         bool addDependency(std::string_view aliasName, const LuaModule& moduleInstance);
         bool addStandardModuleDependency(EStandardModule stdModule);
         void enableDebugLogFunctions();
+        void enableTrustedNumericConversions();
 
         [[nodiscard]] const ModuleMapping& getModuleMapping() const;
         [[nodiscard]] const StandardModules& getStandardModules() const;
         [[nodiscard]] bool hasDebugLogFunctionsEnabled() const;
+        [[nodiscard]] bool hasTrustedNumericConversionsEnabled() const;
 
     private:
         ModuleMapping m_modulesMapping;
         StandardModules m_stdModules;
         bool m_debugLogFunctionsEnabled = false;
+        bool m_trustedNumericConversionsEnabled = false;
     };
 }
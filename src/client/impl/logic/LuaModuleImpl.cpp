@@ -27,6 +27,7 @@ namespace ramses::internal
         : LogicObjectImpl{ scene, name, id }
         , m_sourceCode{ std::move(module.source.sourceCode) }
         , m_byteCode{ std::move(module.source.byteCode) }
+        , m_sharedSource{ std::move(module.sharedSource) }
         , m_module{ std::move(module.moduleTable) }
         , m_dependencies{ std::move(module.source.userModules) }
         , m_stdModules{ std::move(module.source.stdModules) }
@@ -40,6 +41,16 @@ namespace ramses::internal
         return m_module;
     }
 
+    const std::string& LuaModuleImpl::getSourceCode() const
+    {
+        return (m_sharedSource ? m_sharedSource->sourceCode : m_sourceCode);
+    }
+
+    const sol::bytecode& LuaModuleImpl::getByteCode() const
+    {
+        return (m_sharedSource ? m_sharedSource->byteCode : m_byteCode);
+    }
+
     flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(
         const LuaModuleImpl& module,
         flatbuffers::FlatBufferBuilder& builder,
@@ -70,25 +81,27 @@ namespace ramses::internal
         const auto fbModulesVec = builder.CreateVector(modulesFB);
         const auto fbStdModulesVec = builder.CreateVector(stdModules);
 
-        const bool hasSourceCode = !module.m_sourceCode.empty();
-        const bool hasByteCode = !module.m_byteCode.empty();
+        const std::string& sourceCode = module.getSourceCode();
+        const sol::bytecode& byteCode = module.getByteCode();
+        const bool hasSourceCode = !sourceCode.empty();
+        const bool hasByteCode = !byteCode.empty();
         assert(hasSourceCode || hasByteCode);
         const bool serializeSourceCode = hasSourceCode && !((luaSavingMode == ELuaSavingMode::ByteCodeOnly) && hasByteCode);
         const bool serializeByteCode = hasByteCode && !((luaSavingMode == ELuaSavingMode::SourceCodeOnly) && hasSourceCode);
         assert(serializeSourceCode || serializeByteCode);
 
-        const auto fbSrcCode = (serializeSourceCode ? builder.CreateString(module.m_sourceCode) : 0);
+        const auto fbSrcCode = (serializeSourceCode ? builder.CreateString(sourceCode) : 0);
 
         flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCodeOffset{};
         if (serializeByteCode)
         {
-            std::string byteCodeString{ module.m_byteCode.as_string_view() };
+            std::string byteCodeString{ byteCode.as_string_view() };
             byteCodeOffset = serializationMap.resolveByteCodeOffsetIfFound(byteCodeString);
             if (byteCodeOffset.IsNull())
             {
                 std::vector<uint8_t> byteCodeAsVectorUInt8;
-                byteCodeAsVectorUInt8.reserve(module.m_byteCode.size());
-                std::transform(module.m_byteCode.cbegin(), module.m_byteCode.cend(), std::back_inserter(byteCodeAsVectorUInt8), [](std::byte b) { return uint8_t(b); });
+                byteCodeAsVectorUInt8.reserve(byteCode.size());
+                std::transform(byteCode.cbegin(), byteCode.cend(), std::back_inserter(byteCodeAsVectorUInt8), [](std::byte b) { return uint8_t(b); });
 
                 byteCodeOffset = builder.CreateVector(byteCodeAsVectorUInt8);
                 serializationMap.storeByteCodeOffset(std::move(byteCodeString), byteCodeOffset);
@@ -107,7 +120,8 @@ namespace ramses::internal
         SolState& solState,
         const rlogic_serialization::LuaModule& module,
         ErrorReporting& errorReporting,
-        DeserializationMap& deserializationMap)
+        DeserializationMap& deserializationMap,
+        const LuaPrecompiledSource* precompiledSource)
     {
         std::string name;
         sceneObjectId_t id{};
@@ -161,15 +175,25 @@ namespace ramses::internal
 
         std::string source = (hasSourceCode ? module.source()->str() : "");
         sol::bytecode byteCode{};
+        const bool usePrecompiledSource = !hasBytecode && precompiledSource != nullptr && !precompiledSource->byteCode.empty();
         if (hasBytecode)
         {
             byteCode.reserve(module.luaByteCode()->size());
             std::transform(module.luaByteCode()->cbegin(), module.luaByteCode()->cend(), std::back_inserter(byteCode), [](uint8_t b) { return std::byte(b); });
         }
+        else if (usePrecompiledSource)
+        {
+            // source was compiled in advance on a worker thread, only dependency check is left from compiling it here
+            if (!LuaCompilationUtils::CheckDeclaredAndProvidedModules(precompiledSource->declaredModules, modulesUsed, name, errorReporting))
+                return nullptr;
+            byteCode = precompiledSource->byteCode;
+        }
 
         auto compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(solState, modulesUsed, stdModules, std::move(source), name, errorReporting, std::move(byteCode), false);
         if (!compiledModule)
             return nullptr;
+        if (usePrecompiledSource)
+            LuaCompilationUtils::ShareModuleSource(*compiledModule, precompiledSource->declaredModules);
 
         auto deserialized = std::make_unique<LuaModuleImpl>(
             deserializationMap.getScene(),
@@ -190,4 +214,14 @@ namespace ramses::internal
     {
         return m_hasDebugLogFunctions;
     }
+
+    void LuaModuleImpl::setLuaMemoryUsage(size_t bytes)
+    {
+        m_luaMemoryUsage = bytes;
+    }
+
+    size_t LuaModuleImpl::getLuaMemoryUsage() const
+    {
+        return m_luaMemoryUsage;
+    }
 }
@@ -12,6 +12,7 @@
 #include "internal/logic/LuaCompilationUtils.h"
 #include "internal/logic/SolWrapper.h"
 #include "ramses/client/logic/ELuaSavingMode.h"
+#include <memory>
 #include <string>
 
 namespace rlogic_serialization
@@ -47,6 +48,10 @@ namespace ramses::internal
         [[nodiscard]] const ModuleMapping& getDependencies() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
 
+        // Lua memory taken by compiling and loading the module, estimated from growth of Lua state memory
+        void setLuaMemoryUsage(size_t bytes);
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
+
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
             flatbuffers::FlatBufferBuilder& builder,
@@ -57,14 +62,21 @@ namespace ramses::internal
             SolState& solState,
             const rlogic_serialization::LuaModule& module,
             ErrorReporting& errorReporting,
-            DeserializationMap& deserializationMap);
+            DeserializationMap& deserializationMap,
+            const LuaPrecompiledSource* precompiledSource = nullptr);
 
     private:
+        [[nodiscard]] const std::string& getSourceCode() const;
+        [[nodiscard]] const sol::bytecode& getByteCode() const;
+
+        // source code and bytecode are either owned by module or shared with modules of other logic engines
         std::string m_sourceCode;
         sol::bytecode m_byteCode;
+        std::shared_ptr<const LuaSharedModuleSource> m_sharedSource;
         sol::table m_module;
         ModuleMapping m_dependencies;
         StandardModules m_stdModules;
         bool m_hasDebugLogFunctions;
+        size_t m_luaMemoryUsage = 0u;
     };
 }
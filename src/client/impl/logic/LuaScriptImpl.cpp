@@ -28,6 +28,7 @@ namespace ramses::internal
 {
     LuaScriptImpl::LuaScriptImpl(SceneImpl& scene, LuaCompiledScript compiledScript, std::string_view name, sceneObjectId_t id)
         : LogicNodeImpl{ scene, name, id }
+        , m_solState(compiledScript.source.solState)
         , m_source(std::move(compiledScript.source.sourceCode))
         , m_byteCode(std::move(compiledScript.source.byteCode))
         , m_wrappedRootInput(*compiledScript.rootInput)
@@ -120,7 +121,9 @@ namespace ramses::internal
         SolState& solState,
         const rlogic_serialization::LuaScript& luaScript,
         ErrorReporting& errorReporting,
-        DeserializationMap& deserializationMap)
+        DeserializationMap& deserializationMap,
+        bool lazyCompilation,
+        const LuaPrecompiledSource* precompiledSource)
     {
         std::string name;
         sceneObjectId_t id{};
@@ -217,6 +220,32 @@ namespace ramses::internal
             byteCode.reserve(luaScript.luaByteCode()->size());
             std::transform(luaScript.luaByteCode()->cbegin(), luaScript.luaByteCode()->cend(), std::back_inserter(byteCode), [](uint8_t b) { return std::byte(b); });
         }
+        else if (precompiledSource != nullptr && !precompiledSource->byteCode.empty())
+        {
+            // source was compiled in advance on a worker thread, only dependency check is left from compiling it here
+            if (!LuaCompilationUtils::CheckDeclaredAndProvidedModules(precompiledSource->declaredModules, userModules, name, errorReporting))
+                return nullptr;
+            byteCode = precompiledSource->byteCode;
+        }
+
+        if (lazyCompilation)
+        {
+            // interface is fully deserialized so the script can be linked right away, only loading of the Lua code is deferred
+            auto deserialized = std::make_unique<LuaScriptImpl>(
+                deserializationMap.getScene(),
+                LuaCompiledScript{
+                    LuaCompiledSource{ std::move(sourceCode), std::move(byteCode), solState, std::move(stdModules), std::move(userModules), false },
+                    sol::protected_function{},
+                    std::move(rootInput),
+                    std::move(rootOutput) },
+                name, id);
+            deserialized->m_compilationPending = true;
+            // serialized outputs are the results of the last run, script only needs to run (and be compiled) once its inputs change
+            deserialized->setDirty(false);
+            deserialized->setUserId(userIdHigh, userIdLow);
+
+            return deserialized;
+        }
 
         auto compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
             solState,
@@ -245,7 +274,21 @@ namespace ramses::internal
 
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
-        sol::protected_function_result result = m_runFunction(std::ref(m_wrappedRootInput), std::ref(m_wrappedRootOutput));
+        if (m_compilationPending)
+        {
+            auto compilationError = compilePendingScript();
+            if (compilationError)
+                return compilationError;
+        }
+
+        // Passing std::ref creates new userdata on each call, the wrapped properties never change so they are pushed to Lua once
+        if (!m_luaRootInput.valid())
+        {
+            m_luaRootInput = sol::make_object(m_runFunction.lua_state(), std::ref(m_wrappedRootInput));
+            m_luaRootOutput = sol::make_object(m_runFunction.lua_state(), std::ref(m_wrappedRootOutput));
+        }
+
+        sol::protected_function_result result = m_runFunction(m_luaRootInput, m_luaRootOutput);
 
         if (!result.valid())
         {
@@ -265,4 +308,48 @@ namespace ramses::internal
     {
         return m_hasDebugLogFunctions;
     }
+
+    bool LuaScriptImpl::isCompilationPending() const
+    {
+        return m_compilationPending;
+    }
+
+    void LuaScriptImpl::setTrustedNumericConversions(bool enabled)
+    {
+        // only outputs are assigned from within the script
+        m_wrappedRootOutput.setTrustedNumericConversions(enabled);
+    }
+
+    std::optional<LogicNodeRuntimeError> LuaScriptImpl::compilePendingScript()
+    {
+        assert(m_compilationPending);
+
+        // Properties of this script are already deserialized and possibly linked, the ones created by compilation
+        // are placeholders only, passing them avoids extracting the interface from the script again
+        ErrorReporting compilationErrors;
+        auto compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
+            m_solState,
+            m_modules,
+            m_stdModules,
+            m_source,
+            getName(),
+            compilationErrors,
+            m_byteCode,
+            std::make_unique<PropertyImpl>(MakeStruct("", {}), EPropertySemantics::ScriptInput),
+            std::make_unique<PropertyImpl>(MakeStruct("", {}), EPropertySemantics::ScriptOutput),
+            false);
+
+        if (!compiledScript)
+        {
+            const auto error = compilationErrors.getError();
+            return LogicNodeRuntimeError{ error ? error->message : fmt::format("Failed to compile LuaScript '{}'", getName()) };
+        }
+
+        m_runFunction = std::move(compiledScript->runFunction);
+        m_byteCode = std::move(compiledScript->source.byteCode);
+        m_hasDebugLogFunctions = compiledScript->source.hasDebugLogFunctions;
+        m_compilationPending = false;
+
+        return std::nullopt;
+    }
 }
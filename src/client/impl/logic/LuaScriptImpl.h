@@ -62,23 +62,34 @@ namespace ramses::internal
             SolState& solState,
             const rlogic_serialization::LuaScript& luaScript,
             ErrorReporting& errorReporting,
-            DeserializationMap& deserializationMap);
+            DeserializationMap& deserializationMap,
+            bool lazyCompilation = false,
+            const LuaPrecompiledSource* precompiledSource = nullptr);
 
         std::optional<LogicNodeRuntimeError> update() override;
 
         [[nodiscard]] const ModuleMapping& getModules() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
+        [[nodiscard]] bool isCompilationPending() const;
+        void setTrustedNumericConversions(bool enabled);
 
         void createRootProperties() final;
 
     private:
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> compilePendingScript();
+
+        std::reference_wrapper<SolState> m_solState;
         std::string             m_source;
         sol::bytecode           m_byteCode;
         WrappedLuaProperty      m_wrappedRootInput;
         WrappedLuaProperty      m_wrappedRootOutput;
+        sol::object             m_luaRootInput;
+        sol::object             m_luaRootOutput;
         sol::protected_function m_runFunction;
         ModuleMapping           m_modules;
         StandardModules         m_stdModules;
         bool m_hasDebugLogFunctions;
+        // deserialized with lazy compilation, run function is compiled from source/bytecode on first update
+        bool m_compilationPending = false;
     };
 }
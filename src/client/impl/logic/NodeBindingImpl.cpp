@@ -17,6 +17,7 @@
 
 #include "impl/ErrorReporting.h"
 #include "internal/logic/RamsesObjectResolver.h"
+#include "internal/logic/NodeTransformWriteBuffer.h"
 
 #include "internal/logic/flatbuffers/generated/NodeBindingGen.h"
 #include "glm/gtc/type_ptr.hpp"
@@ -164,6 +165,8 @@ namespace ramses::internal
                 return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
         }
 
+        NodeTransformWriteBuffer* writeBuffer = (m_transformWriteBuffer && m_transformWriteBuffer->isEnabled()) ? m_transformWriteBuffer : nullptr;
+
         PropertyImpl& rotation = getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Rotation))->impl();
         if (rotation.checkForBindingInputNewValueAndReset())
         {
@@ -171,7 +174,16 @@ namespace ramses::internal
             if (m_rotationType == ramses::ERotationType::Quaternion)
             {
                 const auto& value = rotation.getValueAs<vec4f>();
-                status = m_ramsesNode.get().setRotation(quat(value[3], value[0], value[1], value[2]));
+                const quat rotationValue{ value[3], value[0], value[1], value[2] };
+                if (writeBuffer)
+                {
+                    writeBuffer->setRotation(m_ramsesNode, rotationValue);
+                    status = true;
+                }
+                else
+                {
+                    status = m_ramsesNode.get().setRotation(rotationValue);
+                }
             }
             else
             {
@@ -187,7 +199,9 @@ namespace ramses::internal
         if (translation.checkForBindingInputNewValueAndReset())
         {
             const auto& value = translation.getValueAs<vec3f>();
-            if (!m_ramsesNode.get().setTranslation(value))
+            if (writeBuffer)
+                writeBuffer->setTranslation(m_ramsesNode, value);
+            else if (!m_ramsesNode.get().setTranslation(value))
                 return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
         }
 
@@ -195,13 +209,20 @@ namespace ramses::internal
         if (scaling.checkForBindingInputNewValueAndReset())
         {
             const auto& value = scaling.getValueAs<vec3f>();
-            if (!m_ramsesNode.get().setScaling(value))
+            if (writeBuffer)
+                writeBuffer->setScaling(m_ramsesNode, value);
+            else if (!m_ramsesNode.get().setScaling(value))
                 return LogicNodeRuntimeError{ getErrorReporting().getError()->message };
         }
 
         return std::nullopt;
     }
 
+    void NodeBindingImpl::setTransformWriteBuffer(NodeTransformWriteBuffer* writeBuffer)
+    {
+        m_transformWriteBuffer = writeBuffer;
+    }
+
     ramses::Node& NodeBindingImpl::getRamsesNode() const
     {
         return m_ramsesNode;
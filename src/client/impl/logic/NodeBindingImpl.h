@@ -38,6 +38,7 @@ namespace ramses::internal
 {
     class IRamsesObjectResolver;
     class ErrorReporting;
+    class NodeTransformWriteBuffer;
 
     enum class ENodePropertyStaticIndex : size_t
     {
@@ -74,10 +75,14 @@ namespace ramses::internal
 
         void createRootProperties() final;
 
+        // if set and enabled, transformation changes are collected in write buffer instead of being set to node directly
+        void setTransformWriteBuffer(NodeTransformWriteBuffer* writeBuffer);
+
     private:
         static void ApplyRamsesValuesToInputProperties(NodeBindingImpl& binding, ramses::Node& ramsesNode);
 
         std::reference_wrapper<ramses::Node> m_ramsesNode;
         ramses::ERotationType m_rotationType;
+        NodeTransformWriteBuffer* m_transformWriteBuffer = nullptr;
     };
 }
@@ -73,6 +73,7 @@ namespace ramses::internal
         }
         else
         {
+            m_children.reserve(type.children.size());
             for (const auto& childType : type.children)
             {
                 m_children.emplace_back(CreateProperty(std::make_unique<PropertyImpl>(childType, semantics)));
@@ -610,6 +611,26 @@ namespace ramses::internal
         return valueChanged;
     }
 
+    bool PropertyImpl::setValueFrom(const PropertyImpl& source)
+    {
+        assert(m_value.index() == source.m_value.index());
+        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        return std::visit([this](const auto& sourceValue) {
+            using ValueType = std::decay_t<decltype(sourceValue)>;
+            auto& value = *std::get_if<ValueType>(&m_value);
+            if (value == sourceValue)
+                return false;
+            value = sourceValue;
+            return true;
+            }, source.m_value);
+    }
+
     void PropertyImpl::setPropertyInstance(Property& property)
     {
         assert(m_propertyInstance == nullptr);
@@ -728,6 +749,16 @@ namespace ramses::internal
     PropertyUniquePtr PropertyImpl::CreateProperty(std::unique_ptr<PropertyImpl> impl)
     {
         assert(impl);
-        return PropertyUniquePtr{ new Property{ std::move(impl) }, [](Property* p) { delete p; } };
+        return PropertyUniquePtr{ new Property{ std::move(impl) } };
+    }
+
+    void PropertyImpl::DestroyProperty(Property* property) noexcept
+    {
+        delete property;
+    }
+
+    void PropertyDeleter::operator()(Property* property) const noexcept
+    {
+        PropertyImpl::DestroyProperty(property);
     }
 }
@@ -45,7 +45,12 @@ namespace ramses::internal
     class ErrorReporting;
 
     using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
-    using PropertyUniquePtr = std::unique_ptr<Property, std::function<void(Property*)>>;
+    // Stateless deleter keeps the owning pointer of a property as small as a plain pointer
+    struct PropertyDeleter
+    {
+        void operator()(Property* property) const noexcept;
+    };
+    using PropertyUniquePtr = std::unique_ptr<Property, PropertyDeleter>;
     using PropertyList = std::vector<PropertyUniquePtr>;
 
     class PropertyImpl
@@ -104,6 +109,9 @@ namespace ramses::internal
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // Typed in-place copy of the value of another property of the same type (used by link propagation),
+        // does not create temporary variant copies. Returns true if the value changed
+        bool setValueFrom(const PropertyImpl& source);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
@@ -138,6 +146,7 @@ namespace ramses::internal
         void resetIncomingLink();
 
         static PropertyUniquePtr CreateProperty(std::unique_ptr<PropertyImpl> impl);
+        static void DestroyProperty(Property* property) noexcept;
 
     private:
         TypeData        m_typeData;
@@ -10,6 +10,8 @@
 #include "impl/logic/AppearanceBindingImpl.h"
 #include "impl/logic/NodeBindingImpl.h"
 #include "ramses/client/Node.h"
+#include "impl/NodeImpl.h"
+#include "internal/SceneGraph/Scene/ClientScene.h"
 #include "ramses/client/Appearance.h"
 #include "ramses/client/Effect.h"
 #include "impl/ErrorReporting.h"
@@ -42,6 +44,15 @@ namespace ramses::internal
         assert(!m_appearanceBinding.getRamsesAppearance().isInputBound(m_jointMatInput));
         assert(m_jointMatInput.getDataType() == ramses::EDataType::Matrix44F);
         assert(m_jointMatInput.getElementCount() == m_joints.size());
+
+        m_jointNodeHandles.reserve(m_joints.size());
+        [[maybe_unused]] const NodeImpl& firstJoint = m_joints.front()->getRamsesNode().impl();
+        for (const auto* joint : m_joints)
+        {
+            const NodeImpl& jointImpl = joint->getRamsesNode().impl();
+            assert(&jointImpl.getIScene() == &firstJoint.getIScene());
+            m_jointNodeHandles.push_back(jointImpl.getNodeHandle());
+        }
     }
 
     void SkinBindingImpl::createRootProperties()
@@ -152,16 +163,14 @@ namespace ramses::internal
 
     std::optional<LogicNodeRuntimeError> SkinBindingImpl::update()
     {
-        m_jointMatricesArray.clear();
-        for (size_t i = 0u; i < m_joints.size(); ++i)
+        // source might not be updated yet if skin bindings are updated also in topological order (dirty mechanism disabled)
+        if (m_jointMatricesSource != nullptr && m_jointMatricesSource->m_jointMatricesArray.size() == m_joints.size())
         {
-            matrix44f jointNodeWorld;
-            if (!m_joints[i]->getRamsesNode().getModelMatrix(jointNodeWorld))
-                return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
-            const auto& inverseBindMatForJoint = m_inverseBindMatrices[i];
-            const auto jointMat = jointNodeWorld * inverseBindMatForJoint;
-
-            m_jointMatricesArray.emplace_back(jointMat);
+            m_jointMatricesArray = m_jointMatricesSource->m_jointMatricesArray;
+        }
+        else
+        {
+            calculateJointMatrices();
         }
 
         if (!m_appearanceBinding.getRamsesAppearance().setInputValue(m_jointMatInput, uint32_t(m_jointMatricesArray.size()), m_jointMatricesArray.data()))
@@ -170,6 +179,44 @@ namespace ramses::internal
         return std::nullopt;
     }
 
+    void SkinBindingImpl::calculateJointMatrices()
+    {
+        // const access, mutable low level scene access would invalidate cached validation results of the joint node
+        const NodeImpl& firstJoint = m_joints.front()->getRamsesNode().impl();
+        const auto& jointsScene = firstJoint.getIScene();
+        jointsScene.updateMatrixCaches(ramses::internal::ETransformationMatrixType_World, m_jointNodeHandles, m_fetchedJointWorldMatrices);
+
+        // recalculate all if there are no previous matrices (first update), otherwise only those of joints which moved
+        const bool recalculateAll = (m_jointMatricesArray.size() != m_joints.size() || m_jointWorldMatrices.size() != m_joints.size());
+        if (recalculateAll)
+        {
+            m_jointWorldMatrices = m_fetchedJointWorldMatrices;
+            m_jointMatricesArray.resize(m_joints.size());
+        }
+
+        for (size_t i = 0u; i < m_joints.size(); ++i)
+        {
+            const auto& jointNodeWorld = m_fetchedJointWorldMatrices[i];
+            if (recalculateAll || jointNodeWorld != m_jointWorldMatrices[i])
+            {
+                m_jointWorldMatrices[i] = jointNodeWorld;
+                m_jointMatricesArray[i] = jointNodeWorld * m_inverseBindMatrices[i];
+            }
+        }
+    }
+
+    bool SkinBindingImpl::hasSameSkin(const SkinBindingImpl& other) const
+    {
+        return m_joints == other.m_joints && m_inverseBindMatrices == other.m_inverseBindMatrices;
+    }
+
+    void SkinBindingImpl::setJointMatricesSource(const SkinBindingImpl* source)
+    {
+        assert(source != this);
+        assert(source == nullptr || hasSameSkin(*source));
+        m_jointMatricesSource = source;
+    }
+
     const std::vector<const NodeBindingImpl*>& SkinBindingImpl::getJoints() const
     {
         return m_joints;
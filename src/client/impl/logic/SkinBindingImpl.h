@@ -12,6 +12,7 @@
 #include "ramses/client/logic/Property.h"
 #include "ramses/client/UniformInput.h"
 #include "ramses/framework/DataTypes.h"
+#include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 #include <memory>
 
 namespace rlogic_serialization
@@ -64,17 +65,30 @@ namespace ramses::internal
         [[nodiscard]] const AppearanceBindingImpl& getAppearanceBinding() const;
         [[nodiscard]] const ramses::UniformInput& getAppearanceUniformInput() const;
 
+        // skin bindings with same joints and inverse bind matrices calculate equal joint matrices,
+        // if source is set its joint matrices (calculated in its update) are used instead of calculating them again
+        [[nodiscard]] bool hasSameSkin(const SkinBindingImpl& other) const;
+        void setJointMatricesSource(const SkinBindingImpl* source);
+
         std::optional<LogicNodeRuntimeError> update() override;
 
         void createRootProperties() final;
 
     private:
+        void calculateJointMatrices();
+
         std::vector<const NodeBindingImpl*> m_joints;
         std::vector<matrix44f> m_inverseBindMatrices;
         AppearanceBindingImpl& m_appearanceBinding;
         ramses::UniformInput m_jointMatInput;
 
-        // temp variable used only in update kept as member to avoid reallocs every update call
+        // joint world matrices are fetched in bulk from transformation cache of the scene the joints belong to
+        ramses::internal::NodeHandleVector m_jointNodeHandles;
+        // world matrices used for current joint matrices, joint matrix is only recalculated if its world matrix changed
+        std::vector<ramses::matrix44f> m_jointWorldMatrices;
+        // temp variables used only in update kept as member to avoid reallocs every update call
+        std::vector<ramses::matrix44f> m_fetchedJointWorldMatrices;
         std::vector<ramses::matrix44f> m_jointMatricesArray;
+        const SkinBindingImpl* m_jointMatricesSource = nullptr;
     };
 }
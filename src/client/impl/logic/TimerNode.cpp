@@ -18,6 +18,11 @@ namespace ramses
     {
     }
 
+    bool TimerNode::setFixedTimestep(int64_t timestep, uint32_t maxStepsPerUpdate, bool interpolate)
+    {
+        return m_timerNodeImpl.setFixedTimestep(timestep, maxStepsPerUpdate, interpolate);
+    }
+
     internal::TimerNodeImpl& TimerNode::impl()
     {
         return m_timerNodeImpl;
@@ -13,6 +13,7 @@
 #include "internal/logic/flatbuffers/generated/TimerNodeGen.h"
 #include "flatbuffers/flatbuffers.h"
 #include "fmt/format.h"
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -50,11 +51,52 @@ namespace ramses::internal
             outTicker_us = ticker;
         }
 
+        if (m_fixedTimestep > 0)
+            outTicker_us = advanceFixedTimestep(outTicker_us);
+
         getOutputs()->getChild(0u)->impl().setValue(outTicker_us);
 
         return std::nullopt;
     }
 
+    bool TimerNodeImpl::setFixedTimestep(int64_t timestep, uint32_t maxStepsPerUpdate, bool interpolate)
+    {
+        if (timestep < 0 || maxStepsPerUpdate == 0u)
+        {
+            getErrorReporting().set(fmt::format("TimerNode::setFixedTimestep failed - invalid timestep {} or max steps per update {}", timestep, maxStepsPerUpdate), *this);
+            return false;
+        }
+
+        m_fixedTimestep = timestep;
+        m_maxStepsPerUpdate = maxStepsPerUpdate;
+        m_interpolate = interpolate;
+        m_lastSourceTicker.reset();
+        setDirty(true);
+
+        return true;
+    }
+
+    int64_t TimerNodeImpl::advanceFixedTimestep(int64_t sourceTicker)
+    {
+        // first update in fixed timestep mode or ticker source going back in time (e.g. user ticker restarted) starts stepping from source time
+        if (!m_lastSourceTicker || sourceTicker < *m_lastSourceTicker)
+        {
+            m_steppedTicker = sourceTicker;
+            m_accumulatedTime = 0;
+        }
+        else
+        {
+            m_accumulatedTime += sourceTicker - *m_lastSourceTicker;
+            const int64_t steps = std::min<int64_t>(m_accumulatedTime / m_fixedTimestep, m_maxStepsPerUpdate);
+            m_steppedTicker += steps * m_fixedTimestep;
+            // whole steps beyond catch-up limit are dropped, otherwise the backlog would keep growing on overloaded system
+            m_accumulatedTime = (m_accumulatedTime - steps * m_fixedTimestep) % m_fixedTimestep;
+        }
+        m_lastSourceTicker = sourceTicker;
+
+        return m_steppedTicker + (m_interpolate ? m_accumulatedTime : 0);
+    }
+
     flatbuffers::Offset<rlogic_serialization::TimerNode> TimerNodeImpl::Serialize(
         const TimerNodeImpl& timerNode,
         flatbuffers::FlatBufferBuilder& builder,
@@ -38,6 +38,8 @@ namespace ramses::internal
 
         std::optional<LogicNodeRuntimeError> update() override;
 
+        bool setFixedTimestep(int64_t timestep, uint32_t maxStepsPerUpdate, bool interpolate);
+
         void createRootProperties() final;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::TimerNode> Serialize(
@@ -49,5 +51,17 @@ namespace ramses::internal
             const rlogic_serialization::TimerNode& timerNodeFB,
             ErrorReporting& errorReporting,
             DeserializationMap& deserializationMap);
+
+    private:
+        [[nodiscard]] int64_t advanceFixedTimestep(int64_t sourceTicker);
+
+        // fixed timestep mode is disabled if timestep is 0
+        int64_t m_fixedTimestep = 0;
+        uint32_t m_maxStepsPerUpdate = 0u;
+        bool m_interpolate = false;
+
+        std::optional<int64_t> m_lastSourceTicker;
+        int64_t m_steppedTicker = 0;
+        int64_t m_accumulatedTime = 0;
     };
 }
@@ -51,6 +51,11 @@ namespace ramses
         return impl.createFreetype2FontInstanceWithHarfBuzz(fontId, size, forceAutohinting);
     }
 
+    FontInstanceId FontRegistry::createFreetype2FontInstanceWithDistanceField(FontId fontId, uint32_t size, uint32_t spread, bool withHarfBuzz)
+    {
+        return impl.createFreetype2FontInstanceWithDistanceField(fontId, size, spread, withHarfBuzz);
+    }
+
     bool FontRegistry::deleteFontInstance(FontInstanceId fontInstance)
     {
         return impl.deleteFontInstance(fontInstance);
@@ -122,7 +122,7 @@ namespace ramses::internal
         }
 
         const FontInstanceId fontInstanceId = reserveFontInstanceId();
-        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(fontInstanceId, fontIt->second->getFace(), size, forceAutohinting) });
+        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(fontInstanceId, *fontIt->second, size, forceAutohinting) });
 
         return fontInstanceId;
     }
@@ -137,7 +137,30 @@ namespace ramses::internal
         }
 
         const FontInstanceId fontInstanceId = reserveFontInstanceId();
-        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new HarfbuzzFontInstance(fontInstanceId, fontIt->second->getFace(), size, forceAutohinting) });
+        registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new HarfbuzzFontInstance(fontInstanceId, *fontIt->second, size, forceAutohinting) });
+
+        return fontInstanceId;
+    }
+
+    FontInstanceId FontRegistryImpl::createFreetype2FontInstanceWithDistanceField(FontId fontId, uint32_t size, uint32_t spread, bool withHarfBuzz)
+    {
+        const auto fontIt = m_fonts.find(fontId);
+        if (fontIt == m_fonts.cend())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FontRegistry: Failed to create font instance, fontId {} does not exist", fontId);
+            return {};
+        }
+        if (spread == 0u)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FontRegistry: Failed to create font instance, distance field spread must not be 0");
+            return {};
+        }
+
+        const FontInstanceId fontInstanceId = reserveFontInstanceId();
+        if (withHarfBuzz)
+            registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new HarfbuzzFontInstance(fontInstanceId, *fontIt->second, size, false, spread) });
+        else
+            registerFontInstance(fontInstanceId, std::unique_ptr<IFontInstance>{ new Freetype2FontInstance(fontInstanceId, *fontIt->second, size, false, spread) });
 
         return fontInstanceId;
     }
@@ -43,6 +43,7 @@ namespace ramses::internal
 
         FontInstanceId          createFreetype2FontInstance(FontId fontId, uint32_t size, bool forceAutohinting);
         FontInstanceId          createFreetype2FontInstanceWithHarfBuzz(FontId fontId, uint32_t size, bool forceAutohinting);
+        FontInstanceId          createFreetype2FontInstanceWithDistanceField(FontId fontId, uint32_t size, uint32_t spread, bool withHarfBuzz);
 
         bool                    deleteFont(FontId fontId);
         bool                    deleteFontInstance(FontInstanceId fontInstance);
@@ -12,13 +12,17 @@
 #include "impl/RamsesFrameworkTypesImpl.h"
 #include "impl/text/TextTypesImpl.h"
 #include <cassert>
+#include <algorithm>
 
 namespace ramses::internal
 {
-    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting)
+    Freetype2FontInstance::Freetype2FontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting, uint32_t distanceFieldSpread)
         : m_id(id)
-        , m_face(fontFace)
+        , m_fontFace(fontFace)
+        , m_face(fontFace.getFace())
+        , m_pixelSize(pixelSize)
         , m_forceAutohinting(forceAutohinting)
+        , m_distanceFieldSpread(distanceFieldSpread)
     {
         int error = FT_New_Size(m_face, &m_size);
         if (error != 0)
@@ -124,6 +128,16 @@ namespace ramses::internal
         metrics.posY = static_cast<int32_t>((glyphMetrics.horiBearingY - glyphMetrics.height) / 64);
         metrics.advance = static_cast<int32_t>(glyphMetrics.horiAdvance / 64);
 
+        // distance field extends glyph bitmap, advance stays unchanged
+        if (m_distanceFieldSpread > 0u && metrics.width > 0u && metrics.height > 0u)
+        {
+            const auto spread = static_cast<int32_t>(m_distanceFieldSpread);
+            metrics.width += 2u * m_distanceFieldSpread;
+            metrics.height += 2u * m_distanceFieldSpread;
+            metrics.posX -= spread;
+            metrics.posY -= spread;
+        }
+
         return &m_glyphMetricsCache.insert({ glyphId, std::move(metrics) }).first->second;
     }
 
@@ -136,66 +150,45 @@ namespace ramses::internal
         if (!loadGlyph(glyphId))
             return nullptr;
 
-        GlyphBitmapData data;
-        FT_Glyph ftGlyph = nullptr;
-        auto error = FT_Get_Glyph(m_face->glyph, &ftGlyph);
-        {
-            if (error != 0)
-            {
-                LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance::extractGlyphBitmapData:  FT_Get_Glyph failed - error: {}", error);
-                assert(ftGlyph == nullptr);
-                return nullptr;
-            }
-            assert(ftGlyph != nullptr);
-
-            if (ftGlyph->format != FT_GLYPH_FORMAT_BITMAP)
-            {
-                error = FT_Glyph_To_Bitmap(&ftGlyph, FT_RENDER_MODE_NORMAL, nullptr, 1);
-                if (error != 0)
-                {
-                    LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance::extractGlyphBitmapData:  FT_Glyph_To_Bitmap failed - error: {}", error);
-                    FT_Done_Glyph(ftGlyph);
-                    return nullptr;
-                }
-            }
-
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) safe because C-style inheritance, valid if ftGlyph->format == FT_GLYPH_FORMAT_BITMAP
-            const auto bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
-            const QuadSize glyphBitmapSize(bitmapGlyph->bitmap.width, bitmapGlyph->bitmap.rows);
-            data.width = glyphBitmapSize.x;
-            data.height = glyphBitmapSize.y;
-            const uint32_t numberPixels = glyphBitmapSize.getArea();
-            const uint8_t* bitmapBuffer = bitmapGlyph->bitmap.buffer;
-            data.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
-        }
-        FT_Done_Glyph(ftGlyph);
+        std::optional<GlyphBitmapData> data = FreetypeFontFace::RasterizeLoadedGlyph(m_face, m_distanceFieldSpread);
+        if (!data)
+            return nullptr;
 
-        return &m_glyphBitmapCache.insert({ glyphId, std::move(data) }).first->second;
+        return &m_glyphBitmapCache.insert({ glyphId, std::move(*data) }).first->second;
     }
 
     bool Freetype2FontInstance::loadGlyph(GlyphId glyphId)
     {
-        if (glyphId.getValue() == 0)
-        {
-            LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance: Failed to load glyph {}, invalid character", glyphId);
-            return false;
-        }
-
         // must call activateSize() before loading
         activateSize();
 
-        int32_t flags = FT_LOAD_DEFAULT;
-        if (m_forceAutohinting)
-            flags = FT_LOAD_FORCE_AUTOHINT;
+        return FreetypeFontFace::LoadGlyph(m_face, glyphId, m_forceAutohinting);
+    }
 
-        const uint32_t error = FT_Load_Glyph(m_face, glyphId.getValue(), flags);
-        if (error != 0)
+    void Freetype2FontInstance::loadGlyphBitmapsInParallel(const std::vector<GlyphId>& glyphIds, ITaskQueue& taskQueue)
+    {
+        std::vector<GlyphId> glyphsToRasterize;
+        glyphsToRasterize.reserve(glyphIds.size());
+        for (const auto glyphId : glyphIds)
         {
-            LOG_ERROR(CONTEXT_TEXT, "Freetype2FontInstance: Failed to load glyph {}, FT error {}", glyphId, error);
-            return false;
+            if (glyphId.getValue() != 0 && m_glyphBitmapCache.count(glyphId) == 0u &&
+                std::find(glyphsToRasterize.cbegin(), glyphsToRasterize.cend(), glyphId) == glyphsToRasterize.cend())
+                glyphsToRasterize.push_back(glyphId);
         }
+        // not worth overhead of tasks for few glyphs, those get rasterized when loaded
+        if (glyphsToRasterize.size() < MinGlyphsForParallelRasterization)
+            return;
+
+        auto bitmaps = m_fontFace.rasterizeGlyphsInParallel(glyphsToRasterize, m_pixelSize, m_forceAutohinting, m_distanceFieldSpread, taskQueue);
+        if (!bitmaps)
+            return;
 
-        return true;
+        assert(bitmaps->size() == glyphsToRasterize.size());
+        for (size_t i = 0u; i < glyphsToRasterize.size(); ++i)
+        {
+            if ((*bitmaps)[i])
+                m_glyphBitmapCache.emplace(glyphsToRasterize[i], std::move(*(*bitmaps)[i]));
+        }
     }
 
     void Freetype2FontInstance::activateSize() const
@@ -10,6 +10,7 @@
 
 #include "ramses/client/text/IFontInstance.h"
 #include "impl/text/Freetype2Wrapper.h"
+#include "impl/text/FreetypeFontFace.h"
 #include "ramses/client/text/Glyph.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -19,7 +20,8 @@ namespace ramses::internal
     class Freetype2FontInstance : public IFontInstance
     {
     public:
-        Freetype2FontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting);
+        // glyph bitmaps are signed distance fields enlarged by given spread on each side if spread is not 0
+        Freetype2FontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting, uint32_t distanceFieldSpread = 0u);
         ~Freetype2FontInstance() override;
 
         [[nodiscard]] bool      supportsCharacter(char32_t character) const final override;
@@ -33,8 +35,14 @@ namespace ramses::internal
 
         [[nodiscard]] GlyphId getGlyphId(char32_t character) const;
 
+        // Rasterizes bitmaps of given glyphs not cached yet, concurrently using worker tasks of given queue if there are enough of them.
+        // Afterwards loadGlyphBitmapData returns cached bitmaps for those glyphs.
+        void loadGlyphBitmapsInParallel(const std::vector<GlyphId>& glyphIds, ITaskQueue& taskQueue);
+
+        static constexpr size_t MinGlyphsForParallelRasterization = 16u;
+
     protected:
-        struct GlyphBitmapData;
+        using GlyphBitmapData = FreetypeGlyphBitmap;
 
         const GlyphMetrics*    getGlyphMetricsData(GlyphId glyphId);
         const GlyphBitmapData* getGlyphBitmapData(GlyphId glyphId);
@@ -44,21 +52,17 @@ namespace ramses::internal
         void                   cacheAllSupportedCharacters();
 
         FontInstanceId          m_id;
+        FreetypeFontFace&       m_fontFace;
         FT_Face                 m_face = nullptr;
         FT_Size                 m_size = nullptr;
+        uint32_t                m_pixelSize = 0u;
         bool                    m_forceAutohinting = false;
+        uint32_t                m_distanceFieldSpread = 0u;
         int                     m_height = 0;
         int                     m_ascender = 0;
         int                     m_descender = 0;
         bool                    m_allSupportedCharactersCached = false;
 
-        struct GlyphBitmapData
-        {
-            GlyphData data;
-            uint32_t  width = 0;
-            uint32_t  height = 0;
-        };
-
         // The reason for separation of the metrics and bitmap data cache
         // is that bitmap loading is relatively heavy and not needed for determining text layout
         // which needs metrics only.
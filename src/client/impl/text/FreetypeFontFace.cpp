@@ -8,7 +8,15 @@
 
 #include "FreetypeFontFace.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+#include "impl/text/TextTypesImpl.h"
+#include "impl/text/GlyphDistanceField.h"
 #include <cassert>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 namespace ramses::internal
 {
@@ -58,8 +66,106 @@ namespace ramses::internal
         return true;
     }
 
+    struct FreetypeFontFace::RasterizationContext
+    {
+        RasterizationContext() = default;
+        RasterizationContext(const RasterizationContext&) = delete;
+        RasterizationContext& operator=(const RasterizationContext&) = delete;
+        RasterizationContext(RasterizationContext&&) = delete;
+        RasterizationContext& operator=(RasterizationContext&&) = delete;
+
+        ~RasterizationContext()
+        {
+            face.reset();
+            if (library != nullptr)
+                FT_Done_FreeType(library);
+        }
+
+        FT_Library library = nullptr;
+        std::unique_ptr<FreetypeFontFace> face;
+    };
+
+    namespace
+    {
+        // Glyphs to rasterize shared by the calling thread and worker tasks, every glyph is rasterized by whoever picks it first.
+        // Tasks keep the state alive, they might get executed only after all glyphs were rasterized - in that case
+        // they do not touch their rasterization context anymore, it might be already used by next batch.
+        class GlyphRasterizationJobs
+        {
+        public:
+            GlyphRasterizationJobs(const std::vector<GlyphId>& glyphs, uint32_t pixelSize, bool forceAutohinting, uint32_t distanceFieldSpread)
+                : m_glyphs(glyphs)
+                , m_pixelSize(pixelSize)
+                , m_forceAutohinting(forceAutohinting)
+                , m_distanceFieldSpread(distanceFieldSpread)
+                , m_results(glyphs.size())
+            {
+            }
+
+            void rasterizeRemaining(FT_Face face)
+            {
+                bool sizeSet = false;
+                for (size_t idx = m_nextIndex++; idx < m_glyphs.size(); idx = m_nextIndex++)
+                {
+                    if (!sizeSet)
+                    {
+                        const auto error = FT_Set_Pixel_Sizes(face, 0, m_pixelSize);
+                        if (error != 0)
+                            LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::rasterizeGlyphsInParallel: Failed to set pixel sizes, FT error {}", error);
+                        sizeSet = true;
+                    }
+                    if (FreetypeFontFace::LoadGlyph(face, m_glyphs[idx], m_forceAutohinting))
+                        m_results[idx] = FreetypeFontFace::RasterizeLoadedGlyph(face, m_distanceFieldSpread);
+                    if (++m_numRasterized == m_glyphs.size())
+                    {
+                        std::lock_guard<std::mutex> l(m_mutex);
+                        m_allRasterized.notify_all();
+                    }
+                }
+            }
+
+            std::vector<std::optional<FreetypeGlyphBitmap>> waitUntilAllRasterized()
+            {
+                std::unique_lock<std::mutex> l(m_mutex);
+                m_allRasterized.wait(l, [&] { return m_numRasterized == m_glyphs.size(); });
+                return std::move(m_results);
+            }
+
+        private:
+            const std::vector<GlyphId> m_glyphs;
+            const uint32_t m_pixelSize;
+            const bool m_forceAutohinting;
+            const uint32_t m_distanceFieldSpread;
+            std::vector<std::optional<FreetypeGlyphBitmap>> m_results;
+            std::atomic<size_t> m_nextIndex{ 0u };
+            std::atomic<size_t> m_numRasterized{ 0u };
+            std::mutex m_mutex;
+            std::condition_variable m_allRasterized;
+        };
+
+        class GlyphRasterizationTask : public ITask
+        {
+        public:
+            GlyphRasterizationTask(std::shared_ptr<GlyphRasterizationJobs> jobs, FT_Face face)
+                : m_jobs(std::move(jobs))
+                , m_face(face)
+            {
+            }
+
+            void execute() override
+            {
+                m_jobs->rasterizeRemaining(m_face);
+            }
+
+        private:
+            std::shared_ptr<GlyphRasterizationJobs> m_jobs;
+            FT_Face m_face;
+        };
+    }
+
     FreetypeFontFace::~FreetypeFontFace()
     {
+        m_rasterizationContexts.clear();
         if (m_face)
             FT_Done_Face(m_face);
     }
@@ -69,6 +175,122 @@ namespace ramses::internal
         return m_face;
     }
 
+    std::unique_ptr<FreetypeFontFace> FreetypeFontFace::createCopy(FT_Library /*freetypeLib*/)
+    {
+        return {};
+    }
+
+    bool FreetypeFontFace::LoadGlyph(FT_Face face, GlyphId glyphId, bool forceAutohinting)
+    {
+        if (glyphId.getValue() == 0)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace: Failed to load glyph {}, invalid character", glyphId);
+            return false;
+        }
+
+        int32_t flags = FT_LOAD_DEFAULT;
+        if (forceAutohinting)
+            flags = FT_LOAD_FORCE_AUTOHINT;
+
+        const uint32_t error = FT_Load_Glyph(face, glyphId.getValue(), flags);
+        if (error != 0)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace: Failed to load glyph {}, FT error {}", glyphId, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<FreetypeGlyphBitmap> FreetypeFontFace::RasterizeLoadedGlyph(FT_Face face, uint32_t distanceFieldSpread)
+    {
+        FreetypeGlyphBitmap bitmap;
+        FT_Glyph ftGlyph = nullptr;
+        auto error = FT_Get_Glyph(face->glyph, &ftGlyph);
+        {
+            if (error != 0)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::RasterizeLoadedGlyph:  FT_Get_Glyph failed - error: {}", error);
+                assert(ftGlyph == nullptr);
+                return std::nullopt;
+            }
+            assert(ftGlyph != nullptr);
+
+            if (ftGlyph->format != FT_GLYPH_FORMAT_BITMAP)
+            {
+                error = FT_Glyph_To_Bitmap(&ftGlyph, FT_RENDER_MODE_NORMAL, nullptr, 1);
+                if (error != 0)
+                {
+                    LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::RasterizeLoadedGlyph:  FT_Glyph_To_Bitmap failed - error: {}", error);
+                    FT_Done_Glyph(ftGlyph);
+                    return std::nullopt;
+                }
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) safe because C-style inheritance, valid if ftGlyph->format == FT_GLYPH_FORMAT_BITMAP
+            const auto bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(ftGlyph);
+            bitmap.width = bitmapGlyph->bitmap.width;
+            bitmap.height = bitmapGlyph->bitmap.rows;
+            const uint32_t numberPixels = bitmap.width * bitmap.height;
+            const uint8_t* bitmapBuffer = bitmapGlyph->bitmap.buffer;
+            bitmap.data = GlyphData(bitmapBuffer, bitmapBuffer + numberPixels);
+        }
+        FT_Done_Glyph(ftGlyph);
+
+        if (distanceFieldSpread > 0u && bitmap.width > 0u && bitmap.height > 0u)
+        {
+            bitmap.data = GlyphDistanceField::CreateFromCoverage(bitmap.data, bitmap.width, bitmap.height, distanceFieldSpread);
+            bitmap.width += 2u * distanceFieldSpread;
+            bitmap.height += 2u * distanceFieldSpread;
+        }
+
+        return bitmap;
+    }
+
+    std::optional<std::vector<std::optional<FreetypeGlyphBitmap>>> FreetypeFontFace::rasterizeGlyphsInParallel(
+        const std::vector<GlyphId>& glyphs,
+        uint32_t pixelSize,
+        bool forceAutohinting,
+        uint32_t distanceFieldSpread,
+        ITaskQueue& taskQueue)
+    {
+        // calling thread uses a context too, worker faces are needed for it to not change active size of this face
+        const size_t numContexts = std::min(glyphs.size(), MaxParallelRasterizationTasks + 1u);
+        while (!m_rasterizationContextsExhausted && m_rasterizationContexts.size() < numContexts)
+        {
+            auto context = std::make_unique<RasterizationContext>();
+            const auto error = FT_Init_FreeType(&context->library);
+            if (error != 0)
+            {
+                context->library = nullptr;
+                LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFace::rasterizeGlyphsInParallel: Failed to initialize FreeType with error {}", error);
+                m_rasterizationContextsExhausted = true;
+                break;
+            }
+            context->face = createCopy(context->library);
+            if (!context->face || !context->face->init())
+            {
+                m_rasterizationContextsExhausted = true;
+                break;
+            }
+            m_rasterizationContexts.push_back(std::move(context));
+        }
+        if (m_rasterizationContexts.empty())
+            return std::nullopt;
+
+        auto jobs = std::make_shared<GlyphRasterizationJobs>(glyphs, pixelSize, forceAutohinting, distanceFieldSpread);
+        const size_t numTasks = std::min(numContexts, m_rasterizationContexts.size()) - 1u;
+        for (size_t i = 0u; i < numTasks; ++i)
+        {
+            auto task = new GlyphRasterizationTask(jobs, m_rasterizationContexts[i + 1u]->face->getFace());
+            taskQueue.enqueue(*task);
+            task->release();
+        }
+        jobs->rasterizeRemaining(m_rasterizationContexts.front()->face->getFace());
+
+        return jobs->waitUntilAllRasterized();
+    }
+
     // =============================================================
 
     FreetypeFontFaceFilePath::FreetypeFontFaceFilePath(std::string_view fontPath, FT_Library freetypeLib)
@@ -78,6 +300,11 @@ namespace ramses::internal
         assert(!fontPath.empty());
     }
 
+    std::unique_ptr<FreetypeFontFace> FreetypeFontFaceFilePath::createCopy(FT_Library freetypeLib)
+    {
+        return std::make_unique<FreetypeFontFaceFilePath>(m_fontPath, freetypeLib);
+    }
+
     bool FreetypeFontFaceFilePath::init()
     {
         FT_Open_Args openArgs;
@@ -138,4 +365,47 @@ namespace ramses::internal
 
         return initFromOpenArgs(&openArgs);
     }
+
+    std::unique_ptr<FreetypeFontFace> FreetypeFontFaceFileDescriptor::createCopy(FT_Library freetypeLib)
+    {
+        if (!m_fontData)
+        {
+            // FreeType seeks before every read of the stream, reading it here does not affect the face using it
+            std::vector<FT_Byte> fontData(m_fontStream.size);
+            if (m_fileStream.seek(0, IInputStream::Seek::FromBeginning) != EStatus::Ok ||
+                m_fileStream.read(fontData.data(), fontData.size()).getState() != EStatus::Ok)
+            {
+                LOG_ERROR(CONTEXT_TEXT, "FreetypeFontFaceFileDescriptor::createCopy: Failed to read font data to memory");
+                return {};
+            }
+            m_fontData = std::make_shared<const std::vector<FT_Byte>>(std::move(fontData));
+        }
+
+        return std::make_unique<FreetypeFontFaceMemory>(m_fontData, freetypeLib);
+    }
+
+    // =============================================================
+
+    FreetypeFontFaceMemory::FreetypeFontFaceMemory(std::shared_ptr<const std::vector<FT_Byte>> fontData, FT_Library freetypeLib)
+        : FreetypeFontFace(freetypeLib)
+        , m_fontData(std::move(fontData))
+    {
+        assert(m_fontData && !m_fontData->empty());
+    }
+
+    std::unique_ptr<FreetypeFontFace> FreetypeFontFaceMemory::createCopy(FT_Library freetypeLib)
+    {
+        return std::make_unique<FreetypeFontFaceMemory>(m_fontData, freetypeLib);
+    }
+
+    bool FreetypeFontFaceMemory::init()
+    {
+        FT_Open_Args openArgs;
+        std::memset(&openArgs, 0, sizeof(openArgs));
+        openArgs.flags = FT_OPEN_MEMORY;
+        openArgs.memory_base = m_fontData->data();
+        openArgs.memory_size = static_cast<FT_Long>(m_fontData->size());
+
+        return initFromOpenArgs(&openArgs);
+    }
 }
@@ -10,12 +10,25 @@
 
 #include "impl/text/Freetype2Wrapper.h"
 #include "internal/Core/Utils/BinaryOffsetFileInputStream.h"
+#include "ramses/client/text/Glyph.h"
 
 #include <string>
 #include <string_view>
+#include <vector>
+#include <memory>
+#include <optional>
 
 namespace ramses::internal
 {
+    class ITaskQueue;
+
+    struct FreetypeGlyphBitmap
+    {
+        GlyphData data;
+        uint32_t  width = 0;
+        uint32_t  height = 0;
+    };
+
     class FreetypeFontFace
     {
     public:
@@ -24,6 +37,24 @@ namespace ramses::internal
         virtual bool init() = 0;
         FT_Face getFace();
 
+        // Loads glyph to glyph slot of given face (at its active size)
+        static bool LoadGlyph(FT_Face face, GlyphId glyphId, bool forceAutohinting);
+        // Rasterizes glyph currently loaded in glyph slot of given face, as signed distance field if spread is not 0
+        static std::optional<FreetypeGlyphBitmap> RasterizeLoadedGlyph(FT_Face face, uint32_t distanceFieldSpread);
+
+        // Loads and rasterizes glyphs concurrently on worker tasks of given queue, every participating thread uses its own
+        // FreeType library and face of the same font data (FreeType faces must not be used by multiple threads at once).
+        // Calling thread takes part and returns when all glyphs are done. Returns no result if font data cannot be opened again,
+        // otherwise an entry for every given glyph (empty on failure).
+        [[nodiscard]] std::optional<std::vector<std::optional<FreetypeGlyphBitmap>>> rasterizeGlyphsInParallel(
+            const std::vector<GlyphId>& glyphs,
+            uint32_t pixelSize,
+            bool forceAutohinting,
+            uint32_t distanceFieldSpread,
+            ITaskQueue& taskQueue);
+
+        static constexpr size_t MaxParallelRasterizationTasks = 4u;
+
         FreetypeFontFace(const FreetypeFontFace&) = delete;
         FreetypeFontFace& operator=(const FreetypeFontFace&) = delete;
         FreetypeFontFace(FreetypeFontFace&&) = delete;
@@ -33,9 +64,18 @@ namespace ramses::internal
         explicit FreetypeFontFace(FT_Library freetypeLib);
         bool initFromOpenArgs(const FT_Open_Args* args);
 
+        // Creates (not initialized) face of the same font data using given library, nullptr if font data cannot be shared
+        [[nodiscard]] virtual std::unique_ptr<FreetypeFontFace> createCopy(FT_Library freetypeLib);
+
     private:
         FT_Library m_freetypeLib;
         FT_Face m_face = nullptr;
+
+        // library and face of font data used by a single thread at a time for parallel rasterization, kept for following batches
+        struct RasterizationContext;
+        std::vector<std::unique_ptr<RasterizationContext>> m_rasterizationContexts;
+        // set when creating a context failed, no further attempts are made
+        bool m_rasterizationContextsExhausted = false;
     };
 
     class FreetypeFontFaceFilePath : public FreetypeFontFace
@@ -45,6 +85,9 @@ namespace ramses::internal
 
         bool init() override;
 
+    protected:
+        [[nodiscard]] std::unique_ptr<FreetypeFontFace> createCopy(FT_Library freetypeLib) override;
+
     private:
         std::string m_fontPath;
     };
@@ -56,8 +99,27 @@ namespace ramses::internal
 
         bool init() override;
 
+    protected:
+        // file descriptor cannot be read by multiple threads, font data is read to memory once and shared by all copies
+        [[nodiscard]] std::unique_ptr<FreetypeFontFace> createCopy(FT_Library freetypeLib) override;
+
     private:
         BinaryOffsetFileInputStream m_fileStream;
         FT_StreamRec m_fontStream{};
+        std::shared_ptr<const std::vector<FT_Byte>> m_fontData;
+    };
+
+    class FreetypeFontFaceMemory : public FreetypeFontFace
+    {
+    public:
+        FreetypeFontFaceMemory(std::shared_ptr<const std::vector<FT_Byte>> fontData, FT_Library freetypeLib);
+
+        bool init() override;
+
+    protected:
+        [[nodiscard]] std::unique_ptr<FreetypeFontFace> createCopy(FT_Library freetypeLib) override;
+
+    private:
+        std::shared_ptr<const std::vector<FT_Byte>> m_fontData;
     };
 }
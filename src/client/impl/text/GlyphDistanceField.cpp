@@ -0,0 +1,120 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/text/GlyphDistanceField.h"
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <algorithm>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        constexpr float Infinity = 1e20f;
+        constexpr uint8_t CoverageThreshold = 128u;
+
+        // Squared euclidean distance transform of sampled function in one dimension (Felzenszwalb & Huttenlocher),
+        // f and d are accessed with given stride
+        void DistanceTransform1D(const float* f, float* d, size_t n, size_t stride, std::vector<size_t>& v, std::vector<float>& z, std::vector<float>& fCopy)
+        {
+            for (size_t q = 0u; q < n; ++q)
+                fCopy[q] = f[q * stride];
+
+            size_t k = 0u;
+            v[0] = 0u;
+            z[0] = -Infinity;
+            z[1] = Infinity;
+            for (size_t q = 1u; q < n; ++q)
+            {
+                // intersection of parabola from q with rightmost parabola of lower envelope, z[0] is never passed
+                const auto intersection = [&](size_t p) {
+                    const auto fq = static_cast<float>(q);
+                    const auto fp = static_cast<float>(p);
+                    return ((fCopy[q] + fq * fq) - (fCopy[p] + fp * fp)) / (2.f * fq - 2.f * fp);
+                };
+                float s = intersection(v[k]);
+                while (s <= z[k])
+                {
+                    assert(k > 0u);
+                    --k;
+                    s = intersection(v[k]);
+                }
+                ++k;
+                v[k] = q;
+                z[k] = s;
+                z[k + 1] = Infinity;
+            }
+
+            k = 0u;
+            for (size_t q = 0u; q < n; ++q)
+            {
+                const auto fq = static_cast<float>(q);
+                while (z[k + 1] < fq)
+                    ++k;
+                const auto dq = fq - static_cast<float>(v[k]);
+                d[q * stride] = dq * dq + fCopy[v[k]];
+            }
+        }
+
+        // Squared distance of every texel to the nearest texel being a feature (value 0 in grid, others infinite)
+        void DistanceTransform2D(std::vector<float>& grid, size_t width, size_t height)
+        {
+            const size_t maxDim = std::max(width, height);
+            std::vector<size_t> v(maxDim);
+            std::vector<float> z(maxDim + 1u);
+            std::vector<float> fCopy(maxDim);
+            for (size_t x = 0u; x < width; ++x)
+                DistanceTransform1D(&grid[x], &grid[x], height, width, v, z, fCopy);
+            for (size_t y = 0u; y < height; ++y)
+                DistanceTransform1D(&grid[y * width], &grid[y * width], width, 1u, v, z, fCopy);
+        }
+    }
+
+    GlyphData GlyphDistanceField::CreateFromCoverage(const GlyphData& coverage, uint32_t width, uint32_t height, uint32_t spread)
+    {
+        assert(coverage.size() == size_t(width) * height);
+        assert(spread > 0u);
+        if (width == 0u || height == 0u)
+            return {};
+
+        const size_t fieldWidth = width + 2u * spread;
+        const size_t fieldHeight = height + 2u * spread;
+        const size_t fieldSize = fieldWidth * fieldHeight;
+
+        // distance of outside texels to glyph and of inside texels to background
+        std::vector<float> toInside(fieldSize, Infinity);
+        std::vector<float> toOutside(fieldSize, 0.f);
+        for (size_t y = 0u; y < height; ++y)
+        {
+            for (size_t x = 0u; x < width; ++x)
+            {
+                if (coverage[y * width + x] >= CoverageThreshold)
+                {
+                    const size_t fieldIdx = (y + spread) * fieldWidth + x + spread;
+                    toInside[fieldIdx] = 0.f;
+                    toOutside[fieldIdx] = Infinity;
+                }
+            }
+        }
+        DistanceTransform2D(toInside, fieldWidth, fieldHeight);
+        DistanceTransform2D(toOutside, fieldWidth, fieldHeight);
+
+        GlyphData field(fieldSize);
+        const auto maxDistance = static_cast<float>(spread);
+        for (size_t i = 0u; i < fieldSize; ++i)
+        {
+            // outline lies between texel centers, half a texel from both inside and outside texels
+            const float signedDistance = (toOutside[i] > 0.f) ? (std::sqrt(toOutside[i]) - 0.5f) : (0.5f - std::sqrt(toInside[i]));
+            const float normalized = std::clamp(0.5f + 0.5f * signedDistance / maxDistance, 0.f, 1.f);
+            field[i] = static_cast<uint8_t>(std::lround(normalized * 255.f));
+        }
+
+        return field;
+    }
+}
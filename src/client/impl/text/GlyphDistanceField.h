@@ -0,0 +1,24 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/client/text/Glyph.h"
+#include <cstdint>
+
+namespace ramses::internal
+{
+    class GlyphDistanceField
+    {
+    public:
+        // Converts coverage bitmap of a glyph to signed distance field enlarged by spread texels on each side.
+        // Distance to outline is clamped to spread and mapped to [0, 255], outline is at the middle of range,
+        // higher values are inside of glyph.
+        [[nodiscard]] static GlyphData CreateFromCoverage(const GlyphData& coverage, uint32_t width, uint32_t height, uint32_t spread);
+    };
+}
@@ -60,9 +60,43 @@ namespace ramses::internal
         categorizeGlyphs(atlasPage, glyphs, tomap, mapped);
 
         std::vector<Quad> glyphsOnPage;
+        if (!claimSpaceForGlyphs(atlasPage, tomap, glyphsOnPage))
+        {
+            // glyphs not used by any text anymore are kept on page for reuse until their space is needed,
+            // reclaim it before giving up on this page (and possibly creating a new texture page)
+            if (!releaseUnusedGlyphs(atlasPage, mapped) || !claimSpaceForGlyphs(atlasPage, tomap, glyphsOnPage))
+                return false;
+        }
+
+        // actually put new glyphs on page
+        assert(glyphsOnPage.size() == tomap.size());
+        auto it = glyphsOnPage.begin();
         for (auto const& glyphkey : tomap)
         {
             GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
+            glyphInfo.glyphMapping.emplace(atlasPage, GlyphMapping{ 1u, *it });
+            getPage(atlasPage).updateDataWithPadding(*it, &glyphInfo.data[0], m_cacheForGlyphPageDataUpdate);
+            it++;
+        }
+
+        // increase ref count on the glyphs already there
+        for (auto const& glyphkey : mapped)
+        {
+            GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
+            auto mappingIt = glyphInfo.glyphMapping.find(atlasPage);
+            assert(mappingIt != glyphInfo.glyphMapping.end());
+            ++mappingIt->second.refCount;
+        }
+
+        return true;
+    }
+
+    bool GlyphTextureAtlas::claimSpaceForGlyphs(size_t atlasPage, const std::vector<GlyphKey>& glyphs, std::vector<Quad>& glyphsOnPage)
+    {
+        assert(glyphsOnPage.empty());
+        for (auto const& glyphkey : glyphs)
+        {
+            const GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
             const QuadSize sizeInAtlas(glyphInfo.size.x + 2, glyphInfo.size.y + 2); // padding requires 2 more pixels for each dimension
 
             const GlyphTexturePage::QuadIndex freeQuadOnPage = getPage(atlasPage).findFreeSpace(sizeInAtlas);
@@ -78,31 +112,32 @@ namespace ramses::internal
                 {
                     getPage(atlasPage).releaseSpace(torevert);
                 }
+                glyphsOnPage.clear();
                 return false;
             }
         }
 
-        // actually put new glyphs on page
-        assert(glyphsOnPage.size() == tomap.size());
-        auto it = glyphsOnPage.begin();
-        for (auto const& glyphkey : tomap)
-        {
-            GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
-            glyphInfo.glyphMapping.emplace(atlasPage, GlyphMapping{ 1u, *it });
-            getPage(atlasPage).updateDataWithPadding(*it, &glyphInfo.data[0], m_cacheForGlyphPageDataUpdate);
-            it++;
-        }
+        return true;
+    }
 
-        // increase ref count on the glyphs already there
-        for (auto const& glyphkey : mapped)
+    bool GlyphTextureAtlas::releaseUnusedGlyphs(size_t atlasPage, const std::vector<GlyphKey>& glyphsToKeep)
+    {
+        bool anyReleased = false;
+        for (auto& glyphInfoIt : m_glyphInfoMap)
         {
-            GlyphInfo& glyphInfo = m_glyphInfoMap.at(glyphkey);
-            auto mappingIt = glyphInfo.glyphMapping.find(atlasPage);
-            assert(mappingIt != glyphInfo.glyphMapping.end());
-            ++mappingIt->second.refCount;
+            auto& glyphMappings = glyphInfoIt.second.glyphMapping;
+            const auto mappingIt = glyphMappings.find(atlasPage);
+            if (mappingIt == glyphMappings.end() || mappingIt->second.refCount != 0u)
+                continue;
+            if (glyphsToKeep.end() != std::find(glyphsToKeep.begin(), glyphsToKeep.end(), glyphInfoIt.first))
+                continue;
+
+            getPage(atlasPage).releaseSpace(mappingIt->second.quad);
+            glyphMappings.erase(mappingIt);
+            anyReleased = true;
         }
 
-        return true;
+        return anyReleased;
     }
 
     void GlyphTextureAtlas::categorizeGlyphs(size_t atlasPage, const GlyphMetricsVector& glyphs, std::vector<GlyphKey>& tomap, std::vector<GlyphKey>& mapped)
@@ -241,8 +276,7 @@ namespace ramses::internal
             auto& glyphToPageMapping = m_glyphInfoMap.at(glyphkey).glyphMapping.at(atlasPage);
             assert(glyphToPageMapping.refCount != 0);
             --glyphToPageMapping.refCount;
-            // TODO(Violin) implement explicit control of glyph memory
-            // Idea: remove refcount altogether, cache glyph memory in IFontAccessor
+            // unused glyph stays mapped for reuse, its space is released only when needed for other glyphs
         }
     }
 
@@ -250,4 +284,15 @@ namespace ramses::internal
     {
         return getPage(atlasPage).getSampler();
     }
+
+    size_t GlyphTextureAtlas::getPageCount() const
+    {
+        return m_glyphAtlasPages.size();
+    }
+
+    float GlyphTextureAtlas::getPageOccupancy(size_t atlasPage) const
+    {
+        const GlyphTexturePage& page = getPage(atlasPage);
+        return static_cast<float>(page.getOccupiedArea()) / static_cast<float>(page.getArea());
+    }
 }
@@ -38,6 +38,10 @@ namespace ramses::internal
 
         const TextureSampler& getTextureSampler(size_t atlasPage) const;
 
+        // number of texture pages and ratio of their area claimed by mapped glyphs (including unused glyphs kept for reuse)
+        size_t getPageCount() const;
+        float getPageOccupancy(size_t atlasPage) const;
+
         GlyphTextureAtlas(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas& operator=(const GlyphTextureAtlas&) = delete;
         GlyphTextureAtlas(GlyphTextureAtlas&&) = delete;
@@ -50,6 +54,8 @@ namespace ramses::internal
         GlyphTexturePage const& getPage(size_t atlasPage) const;
 
         bool findMappingForPage(size_t atlasPage, const GlyphMetricsVector& glyphs);
+        bool claimSpaceForGlyphs(size_t atlasPage, const std::vector<GlyphKey>& glyphs, std::vector<Quad>& glyphsOnPage);
+        bool releaseUnusedGlyphs(size_t atlasPage, const std::vector<GlyphKey>& glyphsToKeep);
         GlyphGeometry createGlyphsGeometry(size_t atlasPage, const GlyphMetricsVector& glyphs);
         void categorizeGlyphs(size_t atlasPage, const GlyphMetricsVector& glyphs, std::vector<GlyphKey>& tomap, std::vector<GlyphKey>& mapped);
 
@@ -203,6 +203,20 @@ namespace ramses::internal
         m_textureBuffer.updateData(0, updateQuade.getOrigin().x, updateQuade.getOrigin().y, updateQuade.getSize().x, updateQuade.getSize().y, reinterpret_cast<const std::byte*>(pageData.data()));
     }
 
+    uint32_t GlyphTexturePage::getOccupiedArea() const
+    {
+        uint32_t freeArea = 0u;
+        for (const auto& freeQuad : m_freeQuads)
+            freeArea += freeQuad.getSize().getArea();
+        assert(freeArea <= m_size.getArea());
+        return m_size.getArea() - freeArea;
+    }
+
+    uint32_t GlyphTexturePage::getArea() const
+    {
+        return m_size.getArea();
+    }
+
     GlyphTexturePage::QuadIndex GlyphTexturePage::findFreeSpace(QuadSize const& size) const
     {
         assert(size.getArea() > 0);
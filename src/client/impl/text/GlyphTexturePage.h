@@ -38,6 +38,9 @@ namespace ramses::internal
         QuadOffset claimSpace(QuadIndex freeQuadIndex, const QuadSize& subportionSize);
         void releaseSpace(Quad box);
         [[nodiscard]] QuadIndex findFreeSpace(QuadSize const& size) const;
+        // area claimed by glyphs, fragmentation statistics of the page
+        [[nodiscard]] uint32_t getOccupiedArea() const;
+        [[nodiscard]] uint32_t getArea() const;
 
         // Texture data management
         void updateDataWithPadding(const Quad& targetQuad, const uint8_t* sourceData, GlyphPageData& cacheForDataUpdate);
@@ -45,8 +45,8 @@ namespace ramses::internal
     }
 #endif
 
-    HarfbuzzFontInstance::HarfbuzzFontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting)
-        : Freetype2FontInstance(id, fontFace, pixelSize, forceAutohinting)
+    HarfbuzzFontInstance::HarfbuzzFontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting, uint32_t distanceFieldSpread)
+        : Freetype2FontInstance(id, fontFace, pixelSize, forceAutohinting, distanceFieldSpread)
     {
         m_hbFont = hb_ft_font_create(m_face, nullptr);
         if (m_hbFont == nullptr)
@@ -67,6 +67,40 @@ namespace ramses::internal
     }
 
     void HarfbuzzFontInstance::loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs)
+    {
+        if (charsBegin == charsEnd)
+            return;
+
+        const std::u32string_view chars{ &*charsBegin, static_cast<size_t>(std::distance(charsBegin, charsEnd)) };
+
+        const auto cachedIt = m_shapingResultsLookup.find(chars);
+        if (cachedIt != m_shapingResultsLookup.end())
+        {
+            // move to front as most recently used
+            m_shapingResults.splice(m_shapingResults.begin(), m_shapingResults, cachedIt->second);
+            const GlyphMetricsVector& cachedGlyphs = cachedIt->second->glyphs;
+            positionedGlyphs.insert(positionedGlyphs.end(), cachedGlyphs.cbegin(), cachedGlyphs.cend());
+            return;
+        }
+
+        if (m_shapingResults.size() >= ShapingCacheCapacity)
+        {
+            m_shapingResultsLookup.erase(m_shapingResults.back().chars);
+            m_shapingResults.pop_back();
+        }
+
+        ShapingResult& result = m_shapingResults.emplace_front(ShapingResult{ std::u32string{ chars }, {} });
+        shapeAndLoadGlyphMetrics(charsBegin, charsEnd, result.glyphs);
+        m_shapingResultsLookup.emplace(result.chars, m_shapingResults.begin());
+        positionedGlyphs.insert(positionedGlyphs.end(), result.glyphs.cbegin(), result.glyphs.cend());
+    }
+
+    size_t HarfbuzzFontInstance::getShapingCacheSize() const
+    {
+        return m_shapingResults.size();
+    }
+
+    void HarfbuzzFontInstance::shapeAndLoadGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs)
     {
         // Reshape given chars using HB resulting in list of (FT2) glyph indexes and their local offsets
         struct HBGlyphInfo
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "impl/text/Freetype2FontInstance.h"
+#include <list>
+#include <string>
+#include <unordered_map>
 
 struct hb_font_t;
 struct hb_buffer_t;
@@ -18,7 +21,7 @@ namespace ramses::internal
     class HarfbuzzFontInstance final : public Freetype2FontInstance
     {
     public:
-        HarfbuzzFontInstance(FontInstanceId id, FT_Face fontFace, uint32_t pixelSize, bool forceAutohinting);
+        HarfbuzzFontInstance(FontInstanceId id, FreetypeFontFace& fontFace, uint32_t pixelSize, bool forceAutohinting, uint32_t distanceFieldSpread = 0u);
         ~HarfbuzzFontInstance() override;
 
         void loadAndAppendGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs) override;
@@ -28,9 +31,26 @@ namespace ramses::internal
         HarfbuzzFontInstance operator=(const HarfbuzzFontInstance&) = delete;
         HarfbuzzFontInstance operator=(HarfbuzzFontInstance&&) = delete;
 
+        [[nodiscard]] size_t getShapingCacheSize() const;
+
+        // Number of most recently shaped strings whose results are kept
+        static constexpr size_t ShapingCacheCapacity = 256u;
+
     private:
+        void shapeAndLoadGlyphMetrics(std::u32string::const_iterator charsBegin, std::u32string::const_iterator charsEnd, GlyphMetricsVector& positionedGlyphs);
         void activateHBFontSize();
 
+        // LRU cache of shaping results, strings (e.g. clock or speed labels) are often laid out repeatedly.
+        // Font instance and shaping features are fixed per instance, so the string is the only key.
+        struct ShapingResult
+        {
+            std::u32string chars;
+            GlyphMetricsVector glyphs;
+        };
+        using ShapingResults = std::list<ShapingResult>;
+        ShapingResults m_shapingResults;
+        std::unordered_map<std::u32string_view, ShapingResults::iterator> m_shapingResultsLookup;
+
         hb_font_t* m_hbFont = nullptr;
         hb_buffer_t* m_hbBuffer =  nullptr;
     };
@@ -36,6 +36,11 @@ namespace ramses
         return impl->createTextLine(glyphs, effect);
     }
 
+    bool TextCache::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        return impl->updateTextLine(textId, glyphs);
+    }
+
     TextLine const* TextCache::getTextLine(TextLineId textId) const
     {
         return impl->getTextLine(textId);
@@ -58,6 +63,47 @@ namespace ramses
         });
     }
 
+    EffectDescription TextCache::CreateDistanceFieldTextEffectDescription()
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader(R"SHADER(
+            #version 300 es
+            precision highp float;
+
+            uniform highp mat4 mvpMatrix;
+            in vec2 a_position;
+            in vec2 a_texcoord;
+            out vec2 v_texcoord;
+
+            void main()
+            {
+                v_texcoord = a_texcoord;
+                gl_Position = mvpMatrix * vec4(a_position, 0.0, 1.0);
+            })SHADER");
+        effectDesc.setFragmentShader(R"SHADER(
+            #version 300 es
+            precision highp float;
+
+            uniform sampler2D u_texture;
+            uniform vec4 u_color;
+            in vec2 v_texcoord;
+            out vec4 fragColor;
+
+            void main()
+            {
+                // outline at 0.5, smoothing over one screen pixel regardless of text scale
+                float distance = texture(u_texture, v_texcoord).r;
+                float smoothing = max(fwidth(distance), 0.0001) * 0.5;
+                float alpha = smoothstep(0.5 - smoothing, 0.5 + smoothing, distance);
+                fragColor = vec4(u_color.rgb, u_color.a * alpha);
+            })SHADER");
+        effectDesc.setAttributeSemantic("a_position", EEffectAttributeSemantic::TextPositions);
+        effectDesc.setAttributeSemantic("a_texcoord", EEffectAttributeSemantic::TextTextureCoordinates);
+        effectDesc.setUniformSemantic("u_texture", EEffectUniformSemantic::TextTexture);
+        effectDesc.setUniformSemantic("mvpMatrix", EEffectUniformSemantic::ModelViewProjectionMatrix);
+        return effectDesc;
+    }
+
     void TextCache::ApplyTrackingToGlyphs(GlyphMetricsVector& glyphMetrics, int32_t trackingFactor, int32_t fontSize)
     {
         const int32_t trackingInPixels = fontSize * trackingFactor / 1000;
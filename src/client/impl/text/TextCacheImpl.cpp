@@ -24,7 +24,13 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "impl/RamsesFrameworkTypesImpl.h"
 #include "impl/text/TextTypesImpl.h"
+#include "impl/text/Freetype2FontInstance.h"
+#include "impl/SceneImpl.h"
+#include "impl/ArrayBufferImpl.h"
+#include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include <limits>
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -66,6 +72,51 @@ namespace ramses::internal
         return getPositionedGlyphs(str, { { font, 0u } });
     }
 
+    bool TextCacheImpl::registerGlyphs(const GlyphMetricsVector& glyphs, std::string_view caller)
+    {
+        rasterizeNewGlyphsInParallel(glyphs);
+
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
+            {
+                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
+                if (fontInstance == nullptr)
+                {
+                    LOG_ERROR(CONTEXT_TEXT, "TextCache::{}: Could not find font instance {}", caller, glyph.key.fontInstanceId);
+                    return false;
+                }
+                QuadSize glyphSize;
+                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
+                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
+            }
+        }
+
+        return true;
+    }
+
+    void TextCacheImpl::rasterizeNewGlyphsInParallel(const GlyphMetricsVector& glyphs)
+    {
+        // glyphs of same font instance are rasterized as batch, this is a pure speedup for texts with many new glyphs (e.g. CJK),
+        // bitmaps are cached in font instance and registered to atlas in order as before
+        std::unordered_map<FontInstanceId, std::vector<GlyphId>> newGlyphsPerFontInstance;
+        for (const auto& glyph : glyphs)
+        {
+            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
+                newGlyphsPerFontInstance[glyph.key.fontInstanceId].push_back(glyph.key.identifier);
+        }
+
+        for (const auto& [fontInstanceId, glyphIds] : newGlyphsPerFontInstance)
+        {
+            if (glyphIds.size() < Freetype2FontInstance::MinGlyphsForParallelRasterization)
+                continue;
+            // only font instances created by ramses support parallel rasterization
+            auto* freetypeFontInstance = dynamic_cast<Freetype2FontInstance*>(m_fontAccessor.getFontInstance(fontInstanceId));
+            if (freetypeFontInstance != nullptr)
+                freetypeFontInstance->loadGlyphBitmapsInParallel(glyphIds, m_scene.impl().getClientImpl().getFramework().getTaskQueue());
+        }
+    }
+
     TextLineId TextCacheImpl::createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect)
     {
         if (glyphs.empty())
@@ -84,21 +135,8 @@ namespace ramses::internal
             return {};
         }
 
-        for (const auto& glyph : glyphs)
-        {
-            if (!m_textureAtlas.isGlyphRegistered(glyph.key))
-            {
-                IFontInstance* fontInstance = m_fontAccessor.getFontInstance(glyph.key.fontInstanceId);
-                if (fontInstance == nullptr)
-                {
-                    LOG_ERROR(CONTEXT_TEXT, "TextCache::createTextLine: Could not find font instance {}", glyph.key.fontInstanceId);
-                    return {};
-                }
-                QuadSize glyphSize;
-                GlyphData data = fontInstance->loadGlyphBitmapData(glyph.key.identifier, glyphSize.x, glyphSize.y);
-                m_textureAtlas.registerGlyph(glyph.key, glyphSize, std::move(data));
-            }
-        }
+        if (!registerGlyphs(glyphs, "createTextLine"))
+            return {};
 
         const bool allGlyphsEmpty = !TextCache::ContainsRenderableGlyphs(glyphs);
 
@@ -158,6 +196,80 @@ namespace ramses::internal
         return textLineId;
     }
 
+    bool TextCacheImpl::updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs)
+    {
+        const auto textLineIt = m_textLines.find(textId);
+        if (textLineIt == m_textLines.end())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLine: Cannot update text line {}, no such entry", textId);
+            return false;
+        }
+        if (!TextCache::ContainsRenderableGlyphs(glyphs))
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLine failed - string has only empty glyphs (whitespace or control signs). Can't create a mesh for them!");
+            return false;
+        }
+        if (!registerGlyphs(glyphs, "updateTextLine"))
+            return false;
+
+        // map new glyphs before unmapping old ones, so that glyphs shared by both stay in atlas
+        const GlyphGeometry geometry = m_textureAtlas.mapGlyphsAndCreateGeometry(glyphs);
+        if (geometry.atlasPage == std::numeric_limits<decltype(geometry.atlasPage)>::max())
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextCache::updateTextLine failed - glyphs could not be mapped in atlas");
+            return false;
+        }
+
+        TextLine& textLine = textLineIt->second;
+        m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, textLine.atlasPage);
+
+        Appearance* appearance = textLine.meshNode->getAppearance();
+        Geometry* geometryBinding = textLine.meshNode->getGeometry();
+        const Effect& effect = appearance->getEffect();
+        if (geometry.atlasPage != textLine.atlasPage)
+            appearance->setInputTexture(*effect.findUniformInput(EEffectUniformSemantic::TextTexture), m_textureAtlas.getTextureSampler(geometry.atlasPage));
+
+        const auto numIndices = static_cast<uint32_t>(geometry.indices.size());
+        const auto numVertexElements = static_cast<uint32_t>(geometry.positions.size());
+        if (numVertexElements > textLine.positions->getMaximumNumberOfElements())
+        {
+            // buffers are recreated only if they cannot hold the new text, with some headroom for following updates
+            const auto numQuads = numVertexElements / 4u;
+            const auto numQuadsCapacity = std::max(numQuads, static_cast<uint32_t>(textLine.positions->getMaximumNumberOfElements() / 4u * 3u / 2u));
+            const auto numIndicesCapacity = numQuadsCapacity * 6u;
+            const auto numVertexElementsCapacity = numQuadsCapacity * 4u;
+
+            ArrayBuffer* oldIndices = textLine.indices;
+            ArrayBuffer* oldPositions = textLine.positions;
+            ArrayBuffer* oldTextureCoordinates = textLine.textureCoordinates;
+            textLine.indices = m_scene.createArrayBuffer(ramses::EDataType::UInt16, numIndicesCapacity, "");
+            textLine.positions = m_scene.createArrayBuffer(ramses::EDataType::Vector2F, numVertexElementsCapacity, "");
+            textLine.textureCoordinates = m_scene.createArrayBuffer(ramses::EDataType::Vector2F, numVertexElementsCapacity, "");
+
+            geometryBinding->setIndices(*textLine.indices);
+            geometryBinding->setInputBuffer(*effect.findAttributeInput(EEffectAttributeSemantic::TextPositions), *textLine.positions);
+            geometryBinding->setInputBuffer(*effect.findAttributeInput(EEffectAttributeSemantic::TextTextureCoordinates), *textLine.textureCoordinates);
+
+            m_scene.destroy(*oldIndices);
+            m_scene.destroy(*oldPositions);
+            m_scene.destroy(*oldTextureCoordinates);
+        }
+
+        textLine.indices->updateData(0u, numIndices, geometry.indices.data());
+        textLine.positions->updateData(0u, numVertexElements, geometry.positions.data());
+        textLine.textureCoordinates->updateData(0u, numVertexElements, geometry.texcoords.data());
+        // shorter text leaves stale data of previous one behind, which would be still sent to renderer
+        textLine.indices->impl().setUsedNumberOfElements(numIndices);
+        textLine.positions->impl().setUsedNumberOfElements(numVertexElements);
+        textLine.textureCoordinates->impl().setUsedNumberOfElements(numVertexElements);
+        textLine.meshNode->setIndexCount(numIndices);
+
+        textLine.atlasPage = geometry.atlasPage;
+        textLine.glyphs = glyphs;
+
+        return true;
+    }
+
     TextLine const* TextCacheImpl::getTextLine(TextLineId textId) const
     {
         const auto it = m_textLines.find(textId);
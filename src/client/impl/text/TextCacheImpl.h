@@ -13,6 +13,7 @@
 #include "ramses/client/text/FontInstanceOffsets.h"
 #include <unordered_map>
 #include <string>
+#include <string_view>
 
 namespace ramses
 {
@@ -34,6 +35,7 @@ namespace ramses::internal
         GlyphMetricsVector      getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
 
         TextLineId              createTextLine(const GlyphMetricsVector& glyphs, const Effect& effect);
+        bool                    updateTextLine(TextLineId textId, const GlyphMetricsVector& glyphs);
         TextLine const*         getTextLine(TextLineId textId) const;
         TextLine*               getTextLine(TextLineId textId);
         bool                    deleteTextLine(TextLineId textId);
@@ -44,6 +46,9 @@ namespace ramses::internal
         TextCacheImpl& operator=(TextCacheImpl&&) = delete;
 
     private:
+        bool registerGlyphs(const GlyphMetricsVector& glyphs, std::string_view caller);
+        void rasterizeNewGlyphsInParallel(const GlyphMetricsVector& glyphs);
+
         ramses::Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
@@ -11,6 +11,15 @@
 
 #include <cassert>
 #include <array>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RAMSES_UTF_ASCII_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define RAMSES_UTF_ASCII_NEON
+#include <arm_neon.h>
+#endif
 
 namespace ramses
 {
@@ -75,22 +84,73 @@ namespace ramses
             {
                 return IsUTF16HighSurrogate(word) || IsUTF16LowSurrogate(word);
             }
+
+            // Converts leading ASCII bytes of input up to first non-ASCII byte, returns number of converted bytes.
+            // ASCII bytes are always valid UTF8, so no further validation is needed for them.
+            // Output must have space for at least inputSize characters.
+            size_t ConvertAsciiRun(const uint8_t* input, size_t inputSize, char32_t* output)
+            {
+                size_t pos = 0u;
+#if defined(RAMSES_UTF_ASCII_SSE2)
+                const __m128i zero = _mm_setzero_si128();
+                for (; pos + 16u <= inputSize; pos += 16u)
+                {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + pos));
+                    if (_mm_movemask_epi8(bytes) != 0)
+                        break;
+                    const __m128i lowWords = _mm_unpacklo_epi8(bytes, zero);
+                    const __m128i highWords = _mm_unpackhi_epi8(bytes, zero);
+                    auto* dst = reinterpret_cast<__m128i*>(output + pos);
+                    _mm_storeu_si128(dst, _mm_unpacklo_epi16(lowWords, zero));
+                    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lowWords, zero));
+                    _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(highWords, zero));
+                    _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(highWords, zero));
+                }
+#elif defined(RAMSES_UTF_ASCII_NEON)
+                for (; pos + 16u <= inputSize; pos += 16u)
+                {
+                    const uint8x16_t bytes = vld1q_u8(input + pos);
+                    if (vmaxvq_u8(bytes) >= 0x80u)
+                        break;
+                    const uint16x8_t lowWords = vmovl_u8(vget_low_u8(bytes));
+                    const uint16x8_t highWords = vmovl_u8(vget_high_u8(bytes));
+                    auto* dst = reinterpret_cast<uint32_t*>(output + pos);
+                    vst1q_u32(dst, vmovl_u16(vget_low_u16(lowWords)));
+                    vst1q_u32(dst + 4, vmovl_u16(vget_high_u16(lowWords)));
+                    vst1q_u32(dst + 8, vmovl_u16(vget_low_u16(highWords)));
+                    vst1q_u32(dst + 12, vmovl_u16(vget_high_u16(highWords)));
+                }
+#endif
+                for (; pos < inputSize && input[pos] < 0x80u; ++pos)
+                    output[pos] = input[pos];
+
+                return pos;
+            }
         }
 
         std::u32string ConvertUtf8ToUtf32(const std::string& utf8String)
         {
-            std::u32string utf32String;
-            utf32String.reserve(utf8String.size());
+            // every UTF8 byte results in at most one UTF32 character, shrunk to actual size at the end
+            std::u32string utf32String(utf8String.size(), U'\0');
+            char32_t* output = utf32String.data();
+            const auto* input = reinterpret_cast<const uint8_t*>(utf8String.data());
 
-            auto strIt = utf8String.cbegin();
-            while (strIt < utf8String.cend())
+            size_t pos = 0u;
+            while (pos < utf8String.size())
             {
-                const ExtractedUnicodePoint extractedCodepoint = ExtractUnicodePointFromUTF8(strIt, utf8String.cend());
+                const size_t asciiRunLength = ConvertAsciiRun(input + pos, utf8String.size() - pos, output);
+                pos += asciiRunLength;
+                output += asciiRunLength;
+                if (pos == utf8String.size())
+                    break;
+
+                const ExtractedUnicodePoint extractedCodepoint = ExtractUnicodePointFromUTF8(utf8String.cbegin() + static_cast<std::ptrdiff_t>(pos), utf8String.cend());
                 if (extractedCodepoint.extractionSuccessful)
-                    utf32String.push_back(extractedCodepoint.codePoint);
+                    *output++ = extractedCodepoint.codePoint;
 
-                strIt += static_cast<ptrdiff_t>(extractedCodepoint.inputCharsConsumed);
+                pos += extractedCodepoint.inputCharsConsumed;
             }
+            utf32String.resize(static_cast<size_t>(output - utf32String.data()));
 
             return utf32String;
         }
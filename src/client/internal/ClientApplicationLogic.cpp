@@ -15,6 +15,8 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
 
+#include <cassert>
+
 namespace ramses::internal
 {
     ClientApplicationLogic::ClientApplicationLogic(const Guid& myId, PlatformLock& frameworkLock)
@@ -56,6 +58,9 @@ namespace ramses::internal
 
     void ClientApplicationLogic::unpublishScene(SceneId sceneId)
     {
+        if (auto* asyncSender = findAsyncSceneUpdateSender(sceneId))
+            asyncSender->waitForPendingSends();
+
         PlatformGuard guard(m_frameworkLock);
         m_publishedScenes.remove(sceneId);
         m_scenegraphProviderComponent->handleUnpublishScene(sceneId);
@@ -68,16 +73,77 @@ namespace ramses::internal
 
     bool ClientApplicationLogic::flush(SceneId sceneId, const FlushTimeInformation& timeInfo, SceneVersionTag versionTag)
     {
+        // back pressure, do not capture more updates than worker can send
+        if (auto* asyncSender = findAsyncSceneUpdateSender(sceneId))
+            asyncSender->waitForFreeSlot();
+
+        // only the part of flush which deals with subscribers and resources of client is serialized by framework lock
+        m_scenegraphProviderComponent->handlePrepareFlush(sceneId);
         PlatformGuard guard(m_frameworkLock);
         return m_scenegraphProviderComponent->handleFlush(sceneId, timeInfo, versionTag);
     }
 
     void ClientApplicationLogic::removeScene(SceneId sceneId)
+    {
+        if (auto* asyncSender = findAsyncSceneUpdateSender(sceneId))
+            asyncSender->waitForPendingSends();
+
+        std::unique_ptr<AsyncSceneUpdateSender> asyncSender;
+        {
+            PlatformGuard guard(m_frameworkLock);
+            m_publishedScenes.remove(sceneId);
+            m_scenegraphProviderComponent->handleUnpublishScene(sceneId);
+            m_scenegraphProviderComponent->handleRemoveScene(sceneId);
+
+            const auto it = m_asyncSceneUpdateSenders.find(sceneId);
+            if (it != m_asyncSceneUpdateSenders.end())
+            {
+                asyncSender = std::move(it->second);
+                m_asyncSceneUpdateSenders.erase(it);
+            }
+        }
+        // destroyed outside of framework lock, it waits for sends enqueued meanwhile (e.g. by new subscription)
+        asyncSender.reset();
+    }
+
+    void ClientApplicationLogic::enableAsyncFlush(SceneId sceneId, ITaskQueue& taskQueue, uint32_t maxPendingFlushes)
     {
         PlatformGuard guard(m_frameworkLock);
-        m_publishedScenes.remove(sceneId);
-        m_scenegraphProviderComponent->handleUnpublishScene(sceneId);
-        m_scenegraphProviderComponent->handleRemoveScene(sceneId);
+        assert(m_asyncSceneUpdateSenders.count(sceneId) == 0u);
+        auto& asyncSender = m_asyncSceneUpdateSenders[sceneId];
+        asyncSender = std::make_unique<AsyncSceneUpdateSender>(taskQueue, maxPendingFlushes);
+        m_scenegraphProviderComponent->handleEnableAsyncFlush(sceneId, *asyncSender);
+    }
+
+    void ClientApplicationLogic::enableHighPriorityUpdates(SceneId sceneId)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_scenegraphProviderComponent->handleEnableHighPriorityUpdates(sceneId);
+    }
+
+    void ClientApplicationLogic::enableSceneActionDeltaEncoding(SceneId sceneId, uint32_t transformQuantizationBits)
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_scenegraphProviderComponent->handleEnableSceneActionDeltaEncoding(sceneId, transformQuantizationBits);
+    }
+
+    void ClientApplicationLogic::collectSceneMemoryProfile(SceneId sceneId, SceneMemoryProfile& profile) const
+    {
+        PlatformGuard guard(m_frameworkLock);
+        m_scenegraphProviderComponent->collectSceneMemoryProfile(sceneId, profile);
+    }
+
+    uint32_t ClientApplicationLogic::getPendingFlushCount(SceneId sceneId) const
+    {
+        const auto* asyncSender = findAsyncSceneUpdateSender(sceneId);
+        return asyncSender ? asyncSender->getPendingSendCount() : 0u;
+    }
+
+    AsyncSceneUpdateSender* ClientApplicationLogic::findAsyncSceneUpdateSender(SceneId sceneId) const
+    {
+        PlatformGuard guard(m_frameworkLock);
+        const auto it = m_asyncSceneUpdateSenders.find(sceneId);
+        return it != m_asyncSceneUpdateSenders.end() ? it->second.get() : nullptr;
     }
 
     void ClientApplicationLogic::handleSceneReferenceEvent(SceneReferenceEvent const& event, const Guid& /*rendererId*/)
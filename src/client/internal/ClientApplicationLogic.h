@@ -16,10 +16,15 @@
 
 #include "internal/SceneGraph/SceneAPI/SceneVersionTag.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/Guid.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
 #include "internal/SceneReferencing/SceneReferenceEvent.h"
+#include "internal/Components/AsyncSceneUpdateSender.h"
+
+#include <memory>
+#include <unordered_map>
 
 namespace ramses::internal
 {
@@ -30,6 +35,7 @@ namespace ramses::internal
     class ISceneGraphProviderComponent;
     struct FlushTimeInformation;
     class RamsesFrameworkImpl;
+    class ITaskQueue;
 
     class ClientApplicationLogic : public ISceneProviderEventConsumer
     {
@@ -49,6 +55,14 @@ namespace ramses::internal
         bool flush(SceneId sceneId, const FlushTimeInformation& timeInfo, SceneVersionTag versionTag);
         void removeScene(SceneId sceneId);
 
+        // flush returns after capturing scene changes, they are sent by worker from given task queue
+        void enableAsyncFlush(SceneId sceneId, ITaskQueue& taskQueue, uint32_t maxPendingFlushes);
+        [[nodiscard]] uint32_t getPendingFlushCount(SceneId sceneId) const;
+        // scene updates are sent to remote renderers before messages of scenes with normal priority
+        void enableHighPriorityUpdates(SceneId sceneId);
+        void enableSceneActionDeltaEncoding(SceneId sceneId, uint32_t transformQuantizationBits);
+        void collectSceneMemoryProfile(SceneId sceneId, SceneMemoryProfile& profile) const;
+
         void handleSceneReferenceEvent(SceneReferenceEvent const& event, const Guid& rendererId) override;
         void handleResourceAvailabilityEvent(ResourceAvailabilityEvent const& event, const Guid& rendererId) override;
 
@@ -66,6 +80,8 @@ namespace ramses::internal
         std::vector<SceneReferenceEvent> popSceneReferenceEvents();
 
     private:
+        [[nodiscard]] AsyncSceneUpdateSender* findAsyncSceneUpdateSender(SceneId sceneId) const;
+
         PlatformLock&                 m_frameworkLock;
         IResourceProviderComponent*   m_resourceComponent;
         ISceneGraphProviderComponent* m_scenegraphProviderComponent;
@@ -75,5 +91,8 @@ namespace ramses::internal
         HashSet<SceneId> m_publishedScenes;
 
         std::vector<SceneReferenceEvent> m_sceneReferenceEventVec;
+
+        // waiting for pending sends must happen without holding framework lock, the sends take it
+        std::unordered_map<SceneId, std::unique_ptr<AsyncSceneUpdateSender>> m_asyncSceneUpdateSenders;
     };
 }
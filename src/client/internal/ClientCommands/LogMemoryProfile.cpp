@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogMemoryProfile.h"
+#include "SceneCommandBuffer.h"
+#include "impl/RamsesClientImpl.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+namespace ramses::internal
+{
+    LogMemoryProfile::LogMemoryProfile(RamsesClientImpl& client)
+        : m_client(client)
+    {
+        description = "Log detailed client memory of scene, used and reserved memory per object pool, scene actions, resources, shadow copy and Lua";
+        registerKeyword("memprofile");
+        registerKeyword("mp");
+    }
+
+    bool LogMemoryProfile::execute(uint64_t& sceneId) const
+    {
+        LOG_INFO(CONTEXT_CLIENT, "LogMemoryProfile");
+        SceneCommandLogMemoryProfile command;
+        m_client.enqueueSceneCommand(sceneId_t(sceneId), std::move(command));
+        return true;
+    }
+}
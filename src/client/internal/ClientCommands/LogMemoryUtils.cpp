@@ -10,7 +10,12 @@
 #include "impl/ResourceImpl.h"
 #include "impl/RamsesClientImpl.h"
 #include "impl/RamsesObjectTypeUtils.h"
+#include "impl/SceneObjectRegistryIterator.h"
 #include "ramses/client/Resource.h"
+#include "ramses/client/logic/LogicEngine.h"
+#include "impl/logic/LogicEngineImpl.h"
+#include "internal/logic/ApiObjects.h"
+#include "internal/logic/SolState.h"
 #include "internal/SceneGraph/SceneAPI/Camera.h"
 #include "internal/SceneGraph/SceneAPI/Renderable.h"
 #include "internal/SceneGraph/SceneAPI/RenderPass.h"
@@ -109,4 +114,58 @@ namespace ramses::internal
         }));
         return memoryInfos;
     }
+
+    SceneMemoryProfile GetMemoryProfileFromScene(const SceneImpl& scene)
+    {
+        SceneMemoryProfile profile;
+
+        const ClientScene& iscene = scene.getIScene();
+        SceneMemoryProfileUtils::AddScenePools(iscene, "", profile);
+        SceneMemoryProfileUtils::AddSceneActions(iscene.getSceneActionCollection(), "PendingSceneActions", profile);
+        scene.getClientImpl().getClientApplication().collectSceneMemoryProfile(iscene.getSceneId(), profile);
+
+        // blobs are allocated exactly, compressed and decompressed data are reported separately because both can be kept at the same time
+        SceneMemoryProfileEntry compressedResources{ "Resources.Compressed" };
+        SceneMemoryProfileEntry decompressedResources{ "Resources.Decompressed" };
+        SceneObjectVector resources;
+        scene.getObjectRegistry().getObjectsOfType(resources, ERamsesObjectType::Resource);
+        for (const auto it : resources)
+        {
+            const Resource& resource = RamsesObjectTypeUtils::ConvertTo<Resource>(*it);
+            const auto resourceObject = scene.getClientImpl().getResource(resource.impl().getLowlevelResourceHash());
+            if (!resourceObject)
+                continue;
+
+            if (resourceObject->isCompressedAvailable())
+            {
+                ++compressedResources.usedCount;
+                compressedResources.usedBytes += resourceObject->getCompressedDataSize();
+            }
+            if (resourceObject->isDeCompressedAvailable())
+            {
+                ++decompressedResources.usedCount;
+                decompressedResources.usedBytes += resourceObject->getDecompressedDataSize();
+            }
+        }
+        for (auto* entry : { &compressedResources, &decompressedResources })
+        {
+            entry->capacityCount = entry->usedCount;
+            entry->capacityBytes = entry->usedBytes;
+            profile.push_back(std::move(*entry));
+        }
+
+        // Lua allocator does not expose reserved memory, only memory in use is known
+        SceneObjectRegistryIterator logicEngineIter(scene.getObjectRegistry(), ERamsesObjectType::LogicEngine);
+        while (const auto* logicEngine = logicEngineIter.getNext<LogicEngine>())
+        {
+            SceneMemoryProfileEntry entry{ fmt::format("LogicEngine.{}.Lua", logicEngine->getName()) };
+            entry.usedCount = 1u;
+            entry.capacityCount = 1u;
+            entry.usedBytes = logicEngine->impl().getApiObjects().getSolState().getMemoryUsage();
+            entry.capacityBytes = entry.usedBytes;
+            profile.push_back(std::move(entry));
+        }
+
+        return profile;
+    }
 }
@@ -10,6 +10,7 @@
 
 #include "impl/SceneImpl.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
 
 #include <string>
 
@@ -23,4 +24,8 @@ namespace ramses::internal
     using MemoryInfoVector = std::vector<MemoryInfo>;
 
     MemoryInfoVector GetMemoryInfoFromScene(const ramses::internal::SceneImpl& scene);
+
+    // detailed client memory of scene with used and reserved memory reported separately: object pools, scene actions,
+    // resource blobs, memory kept for distribution (shadow copy) and Lua memory of logic engines
+    SceneMemoryProfile GetMemoryProfileFromScene(const ramses::internal::SceneImpl& scene);
 }
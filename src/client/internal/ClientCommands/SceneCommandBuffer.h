@@ -54,6 +54,13 @@ namespace ramses::internal
         uint32_t _dummyValue2 = 0u;
     };
 
+    struct SceneCommandLogMemoryProfile
+    {
+        // work around unsolved gcc bug https://bugzilla.redhat.com/show_bug.cgi?id=1507359
+        uint64_t _dummyValue = 0u;
+        uint32_t _dummyValue2 = 0u;
+    };
+
 
     // Command buffer
     class SceneCommandBuffer
@@ -70,7 +77,8 @@ namespace ramses::internal
                                            SceneCommandSetProperty,
                                            SceneCommandValidationRequest,
                                            SceneCommandDumpSceneToFile,
-                                           SceneCommandLogResourceMemoryUsage>;
+                                           SceneCommandLogResourceMemoryUsage,
+                                           SceneCommandLogMemoryProfile>;
 
         std::mutex m_lock;
         std::vector<CommandVariant> m_buffer;
@@ -249,4 +249,19 @@ namespace ramses::internal
             }
         }));
     }
+
+    void SceneCommandVisitor::operator()(const SceneCommandLogMemoryProfile& /*cmd*/) const
+    {
+        const SceneMemoryProfile profile = GetMemoryProfileFromScene(m_scene);
+
+        LOG_INFO_F(CONTEXT_CLIENT, ([&](StringOutputStream& out) {
+            const auto logEntry = [&out](const SceneMemoryProfileEntry& entry) {
+                out << fmt::format("\n\r{}: used {}/{} objects, {}/{} bytes", entry.name, entry.usedCount, entry.capacityCount, entry.usedBytes, entry.capacityBytes);
+            };
+            out << fmt::format("Memory profile of scene {} (used/reserved):", m_scene.getSceneId());
+            logEntry(SceneMemoryProfileUtils::GetTotal(profile));
+            for (const auto& entry : profile)
+                logEntry(entry);
+        }));
+    }
 }
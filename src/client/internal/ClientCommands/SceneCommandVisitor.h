@@ -20,6 +20,7 @@ namespace ramses::internal
     struct SceneCommandValidationRequest;
     struct SceneCommandDumpSceneToFile;
     struct SceneCommandLogResourceMemoryUsage;
+    struct SceneCommandLogMemoryProfile;
 
     class SceneCommandVisitor
     {
@@ -33,6 +34,7 @@ namespace ramses::internal
         void operator()(const SceneCommandValidationRequest& cmd);
         void operator()(const SceneCommandDumpSceneToFile& cmd) const;
         void operator()(const SceneCommandLogResourceMemoryUsage& cmd) const;
+        void operator()(const SceneCommandLogMemoryProfile& cmd) const;
 
     private:
         SceneImpl& m_scene;
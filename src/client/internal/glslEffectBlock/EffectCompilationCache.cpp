@@ -0,0 +1,252 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/glslEffectBlock/EffectCompilationCache.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/Core/Utils/File.h"
+#include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/Utils/BinaryFileInputStream.h"
+#include "internal/Core/Utils/BinaryFileOutputStream.h"
+#include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include "ramses-sdk-build-config.h"
+#include "city.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <tuple>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct FileHeader
+        {
+            uint64_t fileSize;
+            uint64_t checksum;
+        };
+
+        // created effect resources depend on glslang and effect converter, cache content is valid only for the version that created it
+        std::string GetCacheVersion()
+        {
+            return fmt::format("{}-{}", ::ramses_sdk::RAMSES_SDK_RAMSES_VERSION, ::ramses_sdk::RAMSES_SDK_GIT_COMMIT_HASH);
+        }
+    }
+
+    EffectCompilationCache::EffectCompilationCache(std::string filePath)
+        : m_filePath(std::move(filePath))
+    {
+        if (!m_filePath.empty() && File(m_filePath).exists())
+            loadFromFile(m_filePath);
+    }
+
+    EffectCompilationCache::~EffectCompilationCache()
+    {
+        if (!m_filePath.empty() && m_modified)
+            saveToFile(m_filePath);
+    }
+
+    ResourceContentHash EffectCompilationCache::CreateKey(std::string_view vertexShader,
+        std::string_view fragmentShader,
+        std::string_view geometryShader,
+        const std::vector<std::string>& compilerDefines,
+        const SemanticsMap& semanticInputs,
+        ERenderBackendCompatibility compatibility,
+        EFeatureLevel featureLevel)
+    {
+        BinaryOutputStream stream(vertexShader.size() + fragmentShader.size() + geometryShader.size() + 1024u);
+        stream << vertexShader << fragmentShader << geometryShader;
+
+        stream << static_cast<uint32_t>(compilerDefines.size());
+        for (const auto& define : compilerDefines)
+            stream << define;
+
+        // semantics map is unordered, sort its entries so that key does not depend on insertion order
+        std::vector<std::tuple<std::string, uint32_t, EFixedSemantics>> semantics;
+        semantics.reserve(semanticInputs.size());
+        for (const auto& semantic : semanticInputs)
+        {
+            if (std::holds_alternative<std::string>(semantic.first))
+                semantics.emplace_back(std::get<std::string>(semantic.first), UniformBufferBinding::Invalid().getValue(), semantic.second);
+            else
+                semantics.emplace_back(std::string{}, std::get<UniformBufferBinding>(semantic.first).getValue(), semantic.second);
+        }
+        std::sort(semantics.begin(), semantics.end());
+        stream << static_cast<uint32_t>(semantics.size());
+        for (const auto& semantic : semantics)
+            stream << std::get<0>(semantic) << std::get<1>(semantic) << std::get<2>(semantic);
+
+        stream << compatibility << static_cast<uint32_t>(featureLevel);
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        const cityhash::uint128 hash = cityhash::CityHash128(reinterpret_cast<const char*>(stream.getData()), stream.getSize());
+        return { cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash) };
+    }
+
+    std::unique_ptr<EffectResource> EffectCompilationCache::getEffectResource(const ResourceContentHash& key, std::string_view name, EFeatureLevel featureLevel) const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        const auto it = m_entries.find(key);
+        if (it == m_entries.cend())
+            return nullptr;
+
+        const Entry& entry = it->second;
+        BinaryInputStream metadataStream(entry.metadata.data());
+        std::unique_ptr<IResource> resource = EffectResource::CreateResourceFromMetadataStream(metadataStream, name, featureLevel);
+        if (!resource)
+            return nullptr;
+        resource->setResourceData(ResourceBlob(entry.data.size(), entry.data.data()), entry.resourceHash);
+
+        return std::unique_ptr<EffectResource>(static_cast<EffectResource*>(resource.release()));
+    }
+
+    void EffectCompilationCache::storeEffectResource(const ResourceContentHash& key, const EffectResource& effectResource)
+    {
+        Entry entry;
+        BinaryOutputStream metadataStream;
+        effectResource.serializeResourceMetadataToStream(metadataStream);
+        entry.metadata.assign(metadataStream.getData(), metadataStream.getData() + metadataStream.getSize());
+        const auto& data = effectResource.getResourceData();
+        entry.data.assign(data.data(), data.data() + data.size());
+        entry.resourceHash = effectResource.getHash();
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_entries.insert_or_assign(key, std::move(entry));
+        m_modified = true;
+    }
+
+    size_t EffectCompilationCache::getNumberOfEntries() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_entries.size();
+    }
+
+    bool EffectCompilationCache::loadFromFile(std::string_view filePath)
+    {
+        File file(filePath);
+        size_t actualSize = 0;
+        if (!file.getSizeInBytes(actualSize) || actualSize < sizeof(FileHeader))
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: invalid size of file {}, cache needs to be repopulated", filePath);
+            return false;
+        }
+
+        BinaryFileInputStream fileInputStream(file);
+        FileHeader fileHeader{};
+        fileInputStream >> fileHeader.fileSize >> fileHeader.checksum;
+        if (EStatus::Ok != fileInputStream.getState() || fileHeader.fileSize != actualSize)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: failed to read file {} or file is corrupt, cache needs to be repopulated", filePath);
+            return false;
+        }
+
+        std::vector<std::byte> content(actualSize - sizeof(FileHeader));
+        fileInputStream.read(content.data(), content.size());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        if (EStatus::Ok != fileInputStream.getState() || cityhash::CityHash64(reinterpret_cast<const char*>(content.data()), content.size()) != fileHeader.checksum)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: checksum mismatch, file {} is corrupt, cache needs to be repopulated", filePath);
+            return false;
+        }
+
+        BinaryInputStream inputStream(content.data());
+        std::string version;
+        inputStream >> version;
+        if (version != GetCacheVersion())
+        {
+            LOG_INFO(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: file {} was created by different version ({}), cache needs to be repopulated", filePath, version);
+            return false;
+        }
+
+        uint32_t numEntries = 0u;
+        inputStream >> numEntries;
+        std::map<ResourceContentHash, Entry> entries;
+        for (uint32_t i = 0u; i < numEntries; ++i)
+        {
+            ResourceContentHash key;
+            Entry entry;
+            if (!ReadEntry(inputStream, content.size(), key, entry))
+            {
+                LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: failed to read entry {} of {} from file {}", i, numEntries, filePath);
+                return false;
+            }
+            entries.insert_or_assign(key, std::move(entry));
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "EffectCompilationCache::loadFromFile: loaded {} effects from file {}", entries.size(), filePath);
+        std::lock_guard<std::mutex> guard(m_lock);
+        // entries created before loading take precedence
+        entries.merge(m_entries);
+        m_entries.swap(entries);
+        return true;
+    }
+
+    bool EffectCompilationCache::ReadEntry(BinaryInputStream& stream, size_t streamSize, ResourceContentHash& key, Entry& entry)
+    {
+        uint32_t metadataSize = 0u;
+        uint32_t dataSize = 0u;
+        stream >> key >> entry.resourceHash >> metadataSize >> dataSize;
+        if (metadataSize == 0u || dataSize == 0u || stream.getCurrentReadBytes() + metadataSize + dataSize > streamSize)
+            return false;
+
+        entry.metadata.resize(metadataSize);
+        entry.data.resize(dataSize);
+        stream.read(entry.metadata.data(), entry.metadata.size());
+        stream.read(entry.data.data(), entry.data.size());
+        return stream.getState() == EStatus::Ok;
+    }
+
+    bool EffectCompilationCache::saveToFile(std::string_view filePath)
+    {
+        BinaryOutputStream outputStream;
+        outputStream << GetCacheVersion();
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            outputStream << static_cast<uint32_t>(m_entries.size());
+            for (const auto& it : m_entries)
+            {
+                const Entry& entry = it.second;
+                outputStream << it.first << entry.resourceHash << static_cast<uint32_t>(entry.metadata.size()) << static_cast<uint32_t>(entry.data.size());
+                outputStream.write(entry.metadata.data(), entry.metadata.size());
+                outputStream.write(entry.data.data(), entry.data.size());
+            }
+        }
+
+        FileHeader fileHeader{};
+        fileHeader.fileSize = sizeof(FileHeader) + outputStream.getSize();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+        fileHeader.checksum = cityhash::CityHash64(reinterpret_cast<const char*>(outputStream.getData()), outputStream.getSize());
+
+        // write to temporary file first and replace target file only when complete, so that target file is never left partially written
+        const std::string tempFilePath = fmt::format("{}.tmp", filePath);
+        {
+            File file(tempFilePath);
+            BinaryFileOutputStream outputFileStream(file);
+            outputFileStream << fileHeader.fileSize << fileHeader.checksum;
+            outputFileStream.write(outputStream.getData(), outputStream.getSize());
+            if (outputFileStream.getState() != EStatus::Ok)
+            {
+                LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::saveToFile: failed to write {}", tempFilePath);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempFilePath, std::filesystem::path(filePath), ec);
+        if (ec)
+        {
+            LOG_WARN(CONTEXT_CLIENT, "EffectCompilationCache::saveToFile: failed to replace {}: {}", filePath, ec.message());
+            return false;
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "EffectCompilationCache::saveToFile: saved {} effects to file {}", getNumberOfEntries(), filePath);
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_modified = false;
+        return true;
+    }
+}
@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/EFixedSemantics.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "ramses/framework/EFeatureLevel.h"
+#include "ramses/framework/ERenderBackendCompatibility.h"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ramses::internal
+{
+    class EffectResource;
+    class BinaryInputStream;
+
+    // Keeps effect resources created from GLSL sources, so that creating an effect from same input again does not need
+    // to run glslang. Entries are identified by a key computed from all input affecting the created effect resource except its name.
+    // If a file path is given, the cache is loaded from it on construction and saved back to it on destruction if modified.
+    class EffectCompilationCache
+    {
+    public:
+        explicit EffectCompilationCache(std::string filePath = {});
+        ~EffectCompilationCache();
+
+        EffectCompilationCache(const EffectCompilationCache&) = delete;
+        EffectCompilationCache& operator=(const EffectCompilationCache&) = delete;
+
+        [[nodiscard]] static ResourceContentHash CreateKey(std::string_view vertexShader,
+            std::string_view fragmentShader,
+            std::string_view geometryShader,
+            const std::vector<std::string>& compilerDefines,
+            const SemanticsMap& semanticInputs,
+            ERenderBackendCompatibility compatibility,
+            EFeatureLevel featureLevel);
+
+        // returns nullptr if there is no entry for key, the effect resource created for the entry gets given name
+        [[nodiscard]] std::unique_ptr<EffectResource> getEffectResource(const ResourceContentHash& key, std::string_view name, EFeatureLevel featureLevel) const;
+        void storeEffectResource(const ResourceContentHash& key, const EffectResource& effectResource);
+
+        [[nodiscard]] size_t getNumberOfEntries() const;
+
+        bool loadFromFile(std::string_view filePath);
+        bool saveToFile(std::string_view filePath);
+
+    private:
+        struct Entry
+        {
+            std::vector<std::byte> metadata;
+            std::vector<std::byte> data;
+            ResourceContentHash resourceHash;
+        };
+
+        static bool ReadEntry(BinaryInputStream& stream, size_t streamSize, ResourceContentHash& key, Entry& entry);
+
+        const std::string m_filePath;
+        mutable std::mutex m_lock;
+        std::map<ResourceContentHash, Entry> m_entries;
+        bool m_modified = false;
+    };
+}
@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/AnchorPointCameraCache.h"
+#include "ramses/client/Camera.h"
+
+#include <algorithm>
+
+namespace ramses::internal
+{
+    std::optional<LogicNodeRuntimeError> AnchorPointCameraCache::getCameraData(const ramses::Camera& camera, CameraData& cameraData)
+    {
+        const auto it = std::find_if(m_cameras.cbegin(), m_cameras.cend(), [&camera](const auto& entry) { return entry.first == &camera; });
+        if (it != m_cameras.cend())
+        {
+            cameraData = it->second;
+            return std::nullopt;
+        }
+
+        auto potentialError = ComputeCameraData(camera, cameraData);
+        if (!potentialError)
+            m_cameras.emplace_back(&camera, cameraData);
+
+        return potentialError;
+    }
+
+    std::optional<LogicNodeRuntimeError> AnchorPointCameraCache::ComputeCameraData(const ramses::Camera& camera, CameraData& cameraData)
+    {
+        matrix44f projectionMatrix;
+        matrix44f cameraViewMatrix;
+
+        if (!camera.getProjectionMatrix(projectionMatrix))
+            return LogicNodeRuntimeError{ "Failed to retrieve projection matrix from Ramses camera!" };
+
+        if (!camera.getInverseModelMatrix(cameraViewMatrix))
+            return LogicNodeRuntimeError{ "Failed to retrieve view matrix from Ramses camera!" };
+
+        cameraData.viewProjectionMatrix = projectionMatrix * cameraViewMatrix;
+        cameraData.viewportSize = vec2f{ float(camera.getViewportWidth()), float(camera.getViewportHeight()) };
+
+        return std::nullopt;
+    }
+
+    void AnchorPointCameraCache::clear()
+    {
+        m_cameras.clear();
+    }
+
+    bool AnchorPointCameraCache::empty() const
+    {
+        return m_cameras.empty();
+    }
+}
@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/logic/LogicNodeImpl.h"
+#include "ramses/framework/DataTypes.h"
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ramses
+{
+    class Camera;
+}
+
+namespace ramses::internal
+{
+    // Camera data needed by anchor points to project their node to viewport. All anchor points using the same camera
+    // (typically all of them) share data computed once during logic engine update until a camera or node transformation
+    // may have changed, model matrices of the anchored nodes are taken from transformation cache of client scene.
+    class AnchorPointCameraCache
+    {
+    public:
+        struct CameraData
+        {
+            matrix44f viewProjectionMatrix;
+            vec2f viewportSize;
+        };
+
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> getCameraData(const ramses::Camera& camera, CameraData& cameraData);
+        [[nodiscard]] static std::optional<LogicNodeRuntimeError> ComputeCameraData(const ramses::Camera& camera, CameraData& cameraData);
+
+        // must be called whenever camera parameters or node transformations might have changed
+        void clear();
+        [[nodiscard]] bool empty() const;
+
+    private:
+        // there are only few cameras used by anchor points, linear search is fastest
+        std::vector<std::pair<const ramses::Camera*, CameraData>> m_cameras;
+    };
+}
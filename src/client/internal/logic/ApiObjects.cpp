@@ -28,9 +28,12 @@
 #include "ramses/client/logic/AnimationNode.h"
 #include "ramses/client/logic/TimerNode.h"
 #include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/FrustumCullingNode.h"
 #include "ramses/client/logic/RenderBufferBinding.h"
 
 #include "impl/ValidationReportImpl.h"
+#include "impl/RamsesClientImpl.h"
+#include "impl/RamsesFrameworkImpl.h"
 #include "impl/logic/PropertyImpl.h"
 #include "impl/logic/LuaScriptImpl.h"
 #include "impl/logic/LuaInterfaceImpl.h"
@@ -47,6 +50,7 @@
 #include "impl/logic/AnimationNodeConfigImpl.h"
 #include "impl/logic/TimerNodeImpl.h"
 #include "impl/logic/AnchorPointImpl.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
 #include "impl/logic/RenderBufferBindingImpl.h"
 
 #include "ramses/client/Scene.h"
@@ -74,6 +78,16 @@
 
 namespace ramses::internal
 {
+    namespace
+    {
+        // garbage collection can run while module loads, memory can then even shrink
+        size_t GetLuaMemoryGrowth(const SolState& solState, size_t memoryBefore)
+        {
+            const size_t memoryAfter = solState.getMemoryUsage();
+            return (memoryAfter > memoryBefore ? memoryAfter - memoryBefore : 0u);
+        }
+    }
+
     ApiObjects::ApiObjects(ramses::EFeatureLevel featureLevel, SceneImpl& scene)
         : m_featureLevel{ featureLevel }
         , m_scene{ scene }
@@ -123,6 +137,7 @@ namespace ramses::internal
 
         auto impl = std::make_unique<LuaScriptImpl>(m_scene, std::move(*compiledScript), scriptName, sceneObjectId_t{});
         impl->createRootProperties();
+        impl->setTrustedNumericConversions(config.hasTrustedNumericConversionsEnabled());
 
         return &createAndRegisterObject<LuaScript, LuaScriptImpl>(std::move(impl));
     }
@@ -170,6 +185,7 @@ namespace ramses::internal
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
+        const size_t luaMemoryBefore = m_solState->getMemoryUsage();
         std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(
             *m_solState,
             modules,
@@ -184,6 +200,7 @@ namespace ramses::internal
             return nullptr;
 
         auto impl = std::make_unique<LuaModuleImpl>(m_scene, std::move(*compiledModule), moduleName, sceneObjectId_t{});
+        impl->setLuaMemoryUsage(GetLuaMemoryGrowth(*m_solState, luaMemoryBefore));
         return &createAndRegisterObject<LuaModule, LuaModuleImpl>(std::move(impl));
     }
 
@@ -282,6 +299,19 @@ namespace ramses::internal
         return &anchor;
     }
 
+    FrustumCullingNode* ApiObjects::createFrustumCullingNode(CameraBindingImpl& cameraBinding, std::vector<MeshNodeBindingImpl*> meshNodeBindings, std::string_view name)
+    {
+        auto impl = std::make_unique<FrustumCullingNodeImpl>(m_scene, cameraBinding, std::move(meshNodeBindings), name, sceneObjectId_t{});
+        impl->createRootProperties();
+        auto& cullingNode = createAndRegisterObject<FrustumCullingNode, FrustumCullingNodeImpl>(std::move(impl));
+
+        m_logicNodeDependencies.addBindingDependency(cameraBinding, cullingNode.m_impl);
+        for (auto* meshNodeBinding : cullingNode.impl().getMeshNodeBindings())
+            m_logicNodeDependencies.addBindingDependency(*meshNodeBinding, cullingNode.m_impl);
+
+        return &cullingNode;
+    }
+
     RenderBufferBinding* ApiObjects::createRenderBufferBinding(ramses::RenderBuffer& renderBuffer, std::string_view name)
     {
         auto impl = std::make_unique<RenderBufferBindingImpl>(m_scene, renderBuffer, name, sceneObjectId_t{});
@@ -325,7 +355,7 @@ namespace ramses::internal
 
         auto meshNodeBinding = dynamic_cast<MeshNodeBinding*>(&object);
         if (meshNodeBinding)
-            return destroyAndUnregisterObject(*meshNodeBinding, errorReporting);
+            return destroyInternal(*meshNodeBinding, errorReporting);
 
         auto skinBinding = dynamic_cast<SkinBinding*>(&object);
         if (skinBinding)
@@ -347,6 +377,10 @@ namespace ramses::internal
         if (anchor)
             return destroyInternal(*anchor, errorReporting);
 
+        auto cullingNode = dynamic_cast<FrustumCullingNode*>(&object);
+        if (cullingNode)
+            return destroyInternal(*cullingNode, errorReporting);
+
         auto renderBufferBinding = dynamic_cast<RenderBufferBinding*>(&object);
         if (renderBufferBinding)
             return destroyAndUnregisterObject(*renderBufferBinding, errorReporting);
@@ -444,9 +478,35 @@ namespace ramses::internal
             }
         }
 
+        for (const auto& cullingNode : m_frustumCullingNodes)
+        {
+            if (cullingNode->impl().getCameraBinding().getSceneObjectId() == cameraBinding.getSceneObjectId())
+            {
+                errorReporting.set(fmt::format("Failed to destroy Ramses camera binding '{}', it is used in frustum culling node '{}'", cameraBinding.getName(), cullingNode->getName()), &cameraBinding);
+                return false;
+            }
+        }
+
         return destroyAndUnregisterObject(cameraBinding, errorReporting);
     }
 
+    bool ApiObjects::destroyInternal(MeshNodeBinding& meshNodeBinding, ErrorReporting& errorReporting)
+    {
+        for (const auto& cullingNode : m_frustumCullingNodes)
+        {
+            for (const auto* meshNodeInUse : cullingNode->impl().getMeshNodeBindings())
+            {
+                if (meshNodeInUse->getSceneObjectId() == meshNodeBinding.getSceneObjectId())
+                {
+                    errorReporting.set(fmt::format("Failed to destroy Ramses mesh node binding '{}', it is used in frustum culling node '{}'", meshNodeBinding.getName(), cullingNode->getName()), &meshNodeBinding);
+                    return false;
+                }
+            }
+        }
+
+        return destroyAndUnregisterObject(meshNodeBinding, errorReporting);
+    }
+
     bool ApiObjects::destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting)
     {
         if (std::find(m_anchorPoints.cbegin(), m_anchorPoints.cend(), &node) != m_anchorPoints.end())
@@ -458,6 +518,18 @@ namespace ramses::internal
         return destroyAndUnregisterObject(node, errorReporting);
     }
 
+    bool ApiObjects::destroyInternal(FrustumCullingNode& node, ErrorReporting& errorReporting)
+    {
+        if (std::find(m_frustumCullingNodes.cbegin(), m_frustumCullingNodes.cend(), &node) != m_frustumCullingNodes.end())
+        {
+            m_logicNodeDependencies.removeBindingDependency(node.impl().getCameraBinding(), node.m_impl);
+            for (auto* meshNodeBinding : node.impl().getMeshNodeBindings())
+                m_logicNodeDependencies.removeBindingDependency(*meshNodeBinding, node.m_impl);
+        }
+
+        return destroyAndUnregisterObject(node, errorReporting);
+    }
+
     template <typename T, typename ImplT>
     T& ApiObjects::createAndRegisterObject(std::unique_ptr<ImplT> impl)
     {
@@ -496,6 +568,7 @@ namespace ramses::internal
             else if constexpr (std::is_same_v<NodeBinding, T>)
             {
                 this->m_nodeBindings.push_back(&objRaw);
+                objRaw.impl().setTransformWriteBuffer(&m_nodeTransformWriteBuffer);
             }
             else if constexpr (std::is_same_v<AppearanceBinding, T>)
             {
@@ -536,6 +609,12 @@ namespace ramses::internal
             else if constexpr (std::is_same_v<AnchorPoint, T>)
             {
                 this->m_anchorPoints.push_back(&objRaw);
+                objRaw.impl().setCameraCache(&m_anchorPointCameraCache);
+            }
+            else if constexpr (std::is_same_v<FrustumCullingNode, T>)
+            {
+                this->m_frustumCullingNodes.push_back(&objRaw);
+                objRaw.impl().setCameraCache(&m_anchorPointCameraCache);
             }
             else if constexpr (std::is_same_v<RenderBufferBinding, T>)
             {
@@ -635,6 +714,10 @@ namespace ramses::internal
             {
                 eraseFromPool(objToDelete, this->m_anchorPoints);
             }
+            else if constexpr (std::is_same_v<FrustumCullingNode, T>)
+            {
+                eraseFromPool(objToDelete, this->m_frustumCullingNodes);
+            }
             else if constexpr (std::is_same_v<RenderBufferBinding, T>)
             {
                 eraseFromPool(objToDelete, this->m_renderBufferBindings);
@@ -686,7 +769,8 @@ namespace ramses::internal
             {
                 if (dynamic_cast<const ramses::LuaInterface*>(logicObj) ||  // interfaces have their own validation logic in ApiObjects::validateInterfaces
                     dynamic_cast<const ramses::RamsesBinding*>(logicObj) || // bindings have no outputs
-                    dynamic_cast<const ramses::AnchorPoint*>(logicObj))     // anchor points are being used in special way which sometimes involves reading output value directly by application only
+                    dynamic_cast<const ramses::AnchorPoint*>(logicObj) ||   // anchor points are being used in special way which sometimes involves reading output value directly by application only
+                    dynamic_cast<const ramses::FrustumCullingNode*>(logicObj)) // frustum culling nodes set visibility of mesh nodes directly, outputs are optional
                     continue;
 
                 assert(objAsNode->getOutputs() != nullptr);
@@ -703,7 +787,7 @@ namespace ramses::internal
             }
         }
 
-        // collect node bindings used in anchor points and skin bindings
+        // collect node bindings used in anchor points, frustum culling nodes and skin bindings
         // - these are allowed to have no incoming links because they are being read from
         std::unordered_set<const RamsesBinding*> bindingsInUse;
         for (auto* anchor : m_anchorPoints)
@@ -711,6 +795,12 @@ namespace ramses::internal
             bindingsInUse.insert(anchor->impl().getNodeBinding().getLogicObject().as<RamsesBinding>());
             bindingsInUse.insert(anchor->impl().getCameraBinding().getLogicObject().as<RamsesBinding>());
         }
+        for (const auto* cullingNode : m_frustumCullingNodes)
+        {
+            bindingsInUse.insert(cullingNode->impl().getCameraBinding().getLogicObject().as<RamsesBinding>());
+            for (const auto* meshNodeBinding : cullingNode->impl().getMeshNodeBindings())
+                bindingsInUse.insert(meshNodeBinding->getLogicObject().as<RamsesBinding>());
+        }
         for (const auto* skin : m_skinBindings)
         {
             bindingsInUse.insert(skin->impl().getAppearanceBinding().getLogicObject().as<RamsesBinding>());
@@ -727,6 +817,7 @@ namespace ramses::internal
                 if (dynamic_cast<const ramses::LuaInterface*>(logicObj) ||  // interfaces have their own validation logic in ApiObjects::validateInterfaces
                     dynamic_cast<const ramses::TimerNode*>(logicObj) ||     // timer not having input is valid use case which enables internal clock ticker
                     dynamic_cast<const ramses::AnchorPoint*>(logicObj) ||   // anchor points have no inputs
+                    dynamic_cast<const ramses::FrustumCullingNode*>(logicObj) || // bounds of frustum culling node are typically static values
                     dynamic_cast<const ramses::SkinBinding*>(logicObj))     // skinbinding has no inputs
                     continue;
 
@@ -811,6 +902,10 @@ namespace ramses::internal
         {
             return m_anchorPoints;
         }
+        else if constexpr (std::is_same_v<T, FrustumCullingNode>)
+        {
+            return m_frustumCullingNodes;
+        }
         else if constexpr (std::is_same_v<T, RenderBufferBinding>)
         {
             return m_renderBufferBindings;
@@ -839,6 +934,16 @@ namespace ramses::internal
         return m_logicNodeDependencies;
     }
 
+    NodeTransformWriteBuffer& ApiObjects::getNodeTransformWriteBuffer()
+    {
+        return m_nodeTransformWriteBuffer;
+    }
+
+    AnchorPointCameraCache& ApiObjects::getAnchorPointCameraCache()
+    {
+        return m_anchorPointCameraCache;
+    }
+
     flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, ELuaSavingMode luaSavingMode)
     {
         SerializationMap serializationMap;
@@ -943,6 +1048,12 @@ namespace ramses::internal
         for (const auto& rbBinding : apiObjects.m_renderBufferBindings)
             rbBindings.push_back(RenderBufferBindingImpl::Serialize(rbBinding->impl(), builder, serializationMap));
 
+        // frustum culling nodes must go after mesh node and camera bindings because they reference them
+        std::vector<flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>> cullingNodes;
+        cullingNodes.reserve(apiObjects.m_frustumCullingNodes.size());
+        for (const auto& cullingNode : apiObjects.m_frustumCullingNodes)
+            cullingNodes.push_back(FrustumCullingNodeImpl::Serialize(cullingNode->impl(), builder, serializationMap));
+
         // links must go last due to dependency on serialized properties
         const auto collectedLinks = apiObjects.collectPropertyLinks();
         std::vector<flatbuffers::Offset<rlogic_serialization::Link>> links;
@@ -971,6 +1082,7 @@ namespace ramses::internal
         const auto fbMeshNodeBindings = builder.CreateVector(meshNodeBindings);
         const auto fbSkinBindings = builder.CreateVector(skinBindings);
         const auto fbRbBindings = builder.CreateVector(rbBindings);
+        const auto fbCullingNodes = builder.CreateVector(cullingNodes);
 
         const auto logicEngine = rlogic_serialization::CreateApiObjects(
             builder,
@@ -989,7 +1101,8 @@ namespace ramses::internal
             fbRenderGroupBindings,
             fbSkinBindings,
             fbMeshNodeBindings,
-            fbRbBindings
+            fbRbBindings,
+            fbCullingNodes
             );
 
         builder.Finish(logicEngine);
@@ -1003,7 +1116,8 @@ namespace ramses::internal
         const IRamsesObjectResolver& ramsesResolver,
         const std::string& dataSourceDescription,
         ErrorReporting& errorReporting,
-        ramses::EFeatureLevel featureLevel)
+        ramses::EFeatureLevel featureLevel,
+        bool lazyLuaScriptLoading)
     {
         // Collect data here, only return if no error occurred
         auto deserialized = std::make_unique<ApiObjects>(featureLevel, scene);
@@ -1122,30 +1236,71 @@ namespace ramses::internal
             static_cast<size_t>(apiObjects.renderGroupBindings()->size()) +
             static_cast<size_t>(apiObjects.meshNodeBindings()->size()) +
             static_cast<size_t>(apiObjects.skinBindings()->size()) +
-            static_cast<size_t>(apiObjects.renderBufferBindings()->size());
+            static_cast<size_t>(apiObjects.renderBufferBindings()->size()) +
+            (apiObjects.frustumCullingNodes() ? static_cast<size_t>(apiObjects.frustumCullingNodes()->size()) : 0u);
 
         deserialized->m_objectsOwningContainer.reserve(logicObjectsTotalSize);
         deserialized->m_logicObjects.reserve(logicObjectsTotalSize);
 
         const auto& luaModules = *apiObjects.luaModules();
+        const auto& luascripts = *apiObjects.luaScripts();
+
+        // Sources saved without bytecode are compiled to bytecode in advance and concurrently, deserialization below
+        // then only loads the bytecode into the logic engine Lua state (which has to be done sequentially)
+        std::vector<LuaSourceToPrecompile> sourcesToPrecompile;
+        std::vector<std::optional<size_t>> modulePrecompiledIdx(luaModules.size());
+        std::vector<std::optional<size_t>> scriptPrecompiledIdx(luascripts.size());
+        const auto addSourceToPrecompile = [&](const flatbuffers::String* source, const flatbuffers::Vector<uint8_t>* byteCode, std::string_view chunkName, std::optional<size_t>& precompiledIdx) {
+            if (source != nullptr && source->size() > 0 && (byteCode == nullptr || byteCode->size() == 0))
+            {
+                precompiledIdx = sourcesToPrecompile.size();
+                sourcesToPrecompile.push_back({ source->string_view(), chunkName });
+            }
+        };
+        for (flatbuffers::uoffset_t i = 0u; i < luaModules.size(); ++i)
+        {
+            // modules already compiled by other logic engine are loaded from process-wide cache
+            if (luaModules[i] != nullptr && (luaModules[i]->source() == nullptr || !LuaModuleSourceCache::Find(luaModules[i]->source()->string_view())))
+                addSourceToPrecompile(luaModules[i]->source(), luaModules[i]->luaByteCode(), "RL_lua_module", modulePrecompiledIdx[i]);
+        }
+        // lazily loaded scripts are compiled only when they first run
+        if (!lazyLuaScriptLoading)
+        {
+            for (flatbuffers::uoffset_t i = 0u; i < luascripts.size(); ++i)
+            {
+                if (luascripts[i] != nullptr)
+                    addSourceToPrecompile(luascripts[i]->luaSourceCode(), luascripts[i]->luaByteCode(), "RL_lua_script", scriptPrecompiledIdx[i]);
+            }
+        }
+        // compiling a single source concurrently gains nothing
+        std::vector<LuaPrecompiledSource> precompiledSources;
+        if (sourcesToPrecompile.size() > 1u)
+            precompiledSources = LuaCompilationUtils::PrecompileSources(sourcesToPrecompile, scene.getClientImpl().getFramework().getTaskQueue());
+        const auto getPrecompiledSource = [&](const std::optional<size_t>& precompiledIdx) -> const LuaPrecompiledSource* {
+            return (precompiledIdx && *precompiledIdx < precompiledSources.size()) ? &precompiledSources[*precompiledIdx] : nullptr;
+        };
+
         deserialized->m_luaModules.reserve(luaModules.size());
-        for (const auto* module : luaModules)
+        for (flatbuffers::uoffset_t moduleIdx = 0u; moduleIdx < luaModules.size(); ++moduleIdx)
         {
+            const auto* module = luaModules[moduleIdx];
             assert(module);
-            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, errorReporting, deserializationMap);
+            const size_t luaMemoryBefore = deserialized->m_solState->getMemoryUsage();
+            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, errorReporting, deserializationMap, getPrecompiledSource(modulePrecompiledIdx[moduleIdx]));
             if (!deserializedModule)
                 return nullptr;
+            deserializedModule->setLuaMemoryUsage(GetLuaMemoryGrowth(*deserialized->m_solState, luaMemoryBefore));
 
             auto& obj = deserialized->createAndRegisterObject<LuaModule, LuaModuleImpl>(std::move(deserializedModule));
             deserializationMap.storeLogicObject(obj.getSceneObjectId(), obj.m_impl);
         }
 
-        const auto& luascripts = *apiObjects.luaScripts();
         deserialized->m_scripts.reserve(luascripts.size());
-        for (const auto* script : luascripts)
+        for (flatbuffers::uoffset_t scriptIdx = 0u; scriptIdx < luascripts.size(); ++scriptIdx)
         {
+            const auto* script = luascripts[scriptIdx];
             assert(script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap);
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap, lazyLuaScriptLoading, getPrecompiledSource(scriptPrecompiledIdx[scriptIdx]));
             if (!deserializedScript)
                 return nullptr;
 
@@ -1302,7 +1457,8 @@ namespace ramses::internal
             if (!deserializedBinding)
                 return nullptr;
 
-            deserialized->createAndRegisterObject<MeshNodeBinding, MeshNodeBindingImpl>(std::move(deserializedBinding));
+            auto& obj = deserialized->createAndRegisterObject<MeshNodeBinding, MeshNodeBindingImpl>(std::move(deserializedBinding));
+            deserializationMap.storeLogicObject(obj.getSceneObjectId(), obj.m_impl);
         }
 
         const auto& rbBindings = *apiObjects.renderBufferBindings();
@@ -1317,6 +1473,26 @@ namespace ramses::internal
             deserialized->createAndRegisterObject<RenderBufferBinding, RenderBufferBindingImpl>(std::move(deserializedBinding));
         }
 
+        // frustum culling nodes must go after mesh node and camera bindings because they need to resolve references,
+        // container is optional as it was added after the other types
+        if (apiObjects.frustumCullingNodes())
+        {
+            const auto& cullingNodes = *apiObjects.frustumCullingNodes();
+            deserialized->m_frustumCullingNodes.reserve(cullingNodes.size());
+            for (const auto* fbCullingNode : cullingNodes)
+            {
+                assert(fbCullingNode);
+                std::unique_ptr<FrustumCullingNodeImpl> deserializedCullingNode = FrustumCullingNodeImpl::Deserialize(*fbCullingNode, errorReporting, deserializationMap);
+                if (!deserializedCullingNode)
+                    return nullptr;
+
+                auto& cullingNode = deserialized->createAndRegisterObject<FrustumCullingNode, FrustumCullingNodeImpl>(std::move(deserializedCullingNode));
+                deserialized->m_logicNodeDependencies.addBindingDependency(cullingNode.impl().getCameraBinding(), cullingNode.m_impl);
+                for (auto* meshNodeBinding : cullingNode.impl().getMeshNodeBindings())
+                    deserialized->m_logicNodeDependencies.addBindingDependency(*meshNodeBinding, cullingNode.m_impl);
+            }
+        }
+
         // links must go last due to dependency on deserialized properties
         const auto& links = *apiObjects.links();
         // TODO Violin move this code (serialization parts too) to LogicNodeDependencies
@@ -1377,6 +1553,16 @@ namespace ramses::internal
         return m_solState->getNumElementsInLuaStack();
     }
 
+    SolState& ApiObjects::getSolState()
+    {
+        return *m_solState;
+    }
+
+    const SolState& ApiObjects::getSolState() const
+    {
+        return *m_solState;
+    }
+
     const std::vector<PropertyLinkConst>& ApiObjects::getAllPropertyLinks() const
     {
         const std::vector<PropertyLink> links = collectPropertyLinks();
@@ -1452,6 +1638,7 @@ namespace ramses::internal
     template ApiObjectContainer<AnimationNode>&       ApiObjects::getApiObjectContainer<AnimationNode>();
     template ApiObjectContainer<TimerNode>&           ApiObjects::getApiObjectContainer<TimerNode>();
     template ApiObjectContainer<AnchorPoint>&         ApiObjects::getApiObjectContainer<AnchorPoint>();
+    template ApiObjectContainer<FrustumCullingNode>&  ApiObjects::getApiObjectContainer<FrustumCullingNode>();
     template ApiObjectContainer<RenderBufferBinding>& ApiObjects::getApiObjectContainer<RenderBufferBinding>();
 
     template const ApiObjectContainer<LogicObject>&         ApiObjects::getApiObjectContainer<LogicObject>() const;
@@ -1469,5 +1656,6 @@ namespace ramses::internal
     template const ApiObjectContainer<AnimationNode>&       ApiObjects::getApiObjectContainer<AnimationNode>() const;
     template const ApiObjectContainer<TimerNode>&           ApiObjects::getApiObjectContainer<TimerNode>() const;
     template const ApiObjectContainer<AnchorPoint>&         ApiObjects::getApiObjectContainer<AnchorPoint>() const;
+    template const ApiObjectContainer<FrustumCullingNode>&  ApiObjects::getApiObjectContainer<FrustumCullingNode>() const;
     template const ApiObjectContainer<RenderBufferBinding>& ApiObjects::getApiObjectContainer<RenderBufferBinding>() const;
 }
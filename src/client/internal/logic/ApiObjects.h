@@ -19,6 +19,8 @@
 #include "internal/logic/LuaCompilationUtils.h"
 #include "internal/logic/SolState.h"
 #include "internal/logic/LogicNodeDependencies.h"
+#include "internal/logic/NodeTransformWriteBuffer.h"
+#include "internal/logic/AnchorPointCameraCache.h"
 
 #include "ramses/framework/ERotationType.h"
 
@@ -66,6 +68,7 @@ namespace ramses
     class AnimationNode;
     class TimerNode;
     class AnchorPoint;
+    class FrustumCullingNode;
     class RenderBufferBinding;
 }
 
@@ -77,6 +80,7 @@ namespace ramses::internal
     class SerializationMap;
     class NodeBindingImpl;
     class CameraBindingImpl;
+    class MeshNodeBindingImpl;
     class AppearanceBindingImpl;
     class SceneImpl;
     class ValidationReportImpl;
@@ -111,7 +115,8 @@ namespace ramses::internal
             const IRamsesObjectResolver& ramsesResolver,
             const std::string& dataSourceDescription,
             ErrorReporting& errorReporting,
-            ramses::EFeatureLevel featureLevel);
+            ramses::EFeatureLevel featureLevel,
+            bool lazyLuaScriptLoading = false);
 
         // Create/destroy API objects
         LuaScript* createLuaScript(
@@ -146,6 +151,7 @@ namespace ramses::internal
         AnimationNode* createAnimationNode(const AnimationNodeConfigImpl& config, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
         AnchorPoint* createAnchorPoint(NodeBindingImpl& nodeBinding, CameraBindingImpl& cameraBinding, std::string_view name);
+        FrustumCullingNode* createFrustumCullingNode(CameraBindingImpl& cameraBinding, std::vector<MeshNodeBindingImpl*> meshNodeBindings, std::string_view name);
         RenderBufferBinding* createRenderBufferBinding(ramses::RenderBuffer& renderBuffer, std::string_view name);
         bool destroy(LogicObject& object, ErrorReporting& errorReporting);
 
@@ -161,11 +167,15 @@ namespace ramses::internal
         [[nodiscard]] const ApiObjectOwningContainer& getApiObjectOwningContainer() const;
         [[nodiscard]] const LogicNodeDependencies& getLogicNodeDependencies() const;
         [[nodiscard]] LogicNodeDependencies& getLogicNodeDependencies();
+        [[nodiscard]] NodeTransformWriteBuffer& getNodeTransformWriteBuffer();
+        [[nodiscard]] AnchorPointCameraCache& getAnchorPointCameraCache();
 
         // Internally used
         [[nodiscard]] bool bindingsDirty() const;
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
+        [[nodiscard]] SolState& getSolState();
+        [[nodiscard]] const SolState& getSolState() const;
 
         [[nodiscard]] const std::vector<PropertyLinkConst>& getAllPropertyLinks() const;
         [[nodiscard]] const std::vector<PropertyLink>& getAllPropertyLinks();
@@ -181,8 +191,10 @@ namespace ramses::internal
         [[nodiscard]] bool destroyInternal(LuaModule& luaModule, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(AppearanceBinding& appearanceBinding, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(CameraBinding& cameraBinding, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(MeshNodeBinding& meshNodeBinding, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(DataArray& dataArray, ErrorReporting& errorReporting);
         [[nodiscard]] bool destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting);
+        [[nodiscard]] bool destroyInternal(FrustumCullingNode& node, ErrorReporting& errorReporting);
 
         [[nodiscard]] bool checkLuaModules(const ModuleMapping& moduleMapping, ErrorReporting& errorReporting);
         [[nodiscard]] std::vector<PropertyLink> collectPropertyLinks() const;
@@ -203,6 +215,7 @@ namespace ramses::internal
         ApiObjectContainer<AnimationNode>            m_animationNodes;
         ApiObjectContainer<TimerNode>                m_timerNodes;
         ApiObjectContainer<AnchorPoint>              m_anchorPoints;
+        ApiObjectContainer<FrustumCullingNode>       m_frustumCullingNodes;
         ApiObjectContainer<RenderBufferBinding>      m_renderBufferBindings;
 
         ApiObjectContainer<LogicObject>              m_logicObjects;
@@ -216,5 +229,7 @@ namespace ramses::internal
 
         ramses::EFeatureLevel m_featureLevel;
         SceneImpl& m_scene;
+        NodeTransformWriteBuffer m_nodeTransformWriteBuffer{ m_scene };
+        AnchorPointCameraCache m_anchorPointCameraCache;
     };
 }
@@ -12,6 +12,7 @@
 #include "ramses/client/logic/AnchorPoint.h"
 #include "ramses/client/logic/AnimationNode.h"
 #include "ramses/client/logic/DataArray.h"
+#include "ramses/client/logic/FrustumCullingNode.h"
 #include "ramses/client/logic/LuaInterface.h"
 #include "ramses/client/logic/LuaScript.h"
 #include "ramses/client/logic/LuaModule.h"
@@ -30,6 +31,7 @@
 #include "impl/logic/AnchorPointImpl.h"
 #include "impl/logic/AnimationNodeImpl.h"
 #include "impl/logic/DataArrayImpl.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
 #include "impl/logic/LuaInterfaceImpl.h"
 #include "impl/logic/LuaModuleImpl.h"
 #include "impl/logic/LuaScriptImpl.h"
@@ -206,6 +208,12 @@ namespace ramses::internal
         return calculateSerializedSize<AnchorPoint, AnchorPointImpl>(apiObjects.getApiObjectContainer<AnchorPoint>(), luaSavingMode);
     }
 
+    template<>
+    size_t ApiObjectsSerializedSize::GetSerializedSize<FrustumCullingNode>(const ApiObjects& apiObjects, ELuaSavingMode luaSavingMode)
+    {
+        return calculateSerializedSize<FrustumCullingNode, FrustumCullingNodeImpl>(apiObjects.getApiObjectContainer<FrustumCullingNode>(), luaSavingMode);
+    }
+
     template<>
     size_t ApiObjectsSerializedSize::GetSerializedSize<RenderBufferBinding>(const ApiObjects& apiObjects, ELuaSavingMode luaSavingMode)
     {
@@ -13,6 +13,7 @@
 #include <unordered_set>
 #include <numeric>
 #include <iterator>
+#include <cstddef>
 
 namespace ramses::internal
 {
@@ -22,6 +23,10 @@ namespace ramses::internal
         assert(m_nodeIncomingEdges.count(&node) == 0);
         m_nodeOutgoingEdges.insert({ &node, {} });
         m_nodeIncomingEdges.insert({ &node, {} });
+
+        // node without edges can be put anywhere into topological order
+        m_topologicalIndex.insert({ &node, m_topologicalOrder.size() });
+        m_topologicalOrder.push_back(&node);
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
@@ -50,6 +55,118 @@ namespace ramses::internal
         // remove node from both maps
         m_nodeIncomingEdges.erase(srcNodesIt);
         m_nodeOutgoingEdges.erase(&nodeToRemove);
+
+        // removing node keeps relative order of remaining nodes, only indices of following nodes shift
+        const auto indexIt = m_topologicalIndex.find(&nodeToRemove);
+        assert(indexIt != m_topologicalIndex.end());
+        const size_t removedIndex = indexIt->second;
+        m_topologicalIndex.erase(indexIt);
+        m_topologicalOrder.erase(m_topologicalOrder.begin() + static_cast<std::ptrdiff_t>(removedIndex));
+        for (size_t i = removedIndex; i < m_topologicalOrder.size(); ++i)
+            m_topologicalIndex[m_topologicalOrder[i]] = i;
+    }
+
+    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes()
+    {
+        if (!m_topologicalOrderValid)
+        {
+            // there was a cycle at some point, check with full sort whether it still exists
+            auto sortedNodes = computeTopologicallySortedNodes();
+            if (!sortedNodes)
+                return std::nullopt;
+            setTopologicalOrder(std::move(*sortedNodes));
+        }
+
+        return m_topologicalOrder;
+    }
+
+    void DirectedAcyclicGraph::setTopologicalOrder(NodeVector sortedNodes)
+    {
+        assert(sortedNodes.size() == m_nodeOutgoingEdges.size());
+        m_topologicalOrder = std::move(sortedNodes);
+        m_topologicalIndex.clear();
+        m_topologicalIndex.reserve(m_topologicalOrder.size());
+        for (size_t i = 0; i < m_topologicalOrder.size(); ++i)
+            m_topologicalIndex.insert({ m_topologicalOrder[i], i });
+        m_topologicalOrderValid = true;
+    }
+
+    // Pearce-Kelly dynamic topological sort: if the new edge points from a later to an earlier node in current order,
+    // only nodes with index between target and source need to be looked at. Nodes reachable from target (within that range)
+    // are moved behind all nodes which reach source (within that range), reusing the same set of indices.
+    bool DirectedAcyclicGraph::reorderForNewEdge(Node& source, Node& target)
+    {
+        if (&source == &target)
+            return false;
+
+        const size_t lowerBound = m_topologicalIndex.find(&target)->second;
+        const size_t upperBound = m_topologicalIndex.find(&source)->second;
+        if (lowerBound > upperBound)
+            return true;
+
+        NodeVector forwardNodes;
+        collectAffectedNodes(target, lowerBound, upperBound, true, forwardNodes);
+        if (std::find(forwardNodes.cbegin(), forwardNodes.cend(), &source) != forwardNodes.cend())
+            return false;
+
+        NodeVector backwardNodes;
+        collectAffectedNodes(source, lowerBound, upperBound, false, backwardNodes);
+
+        const auto byIndex = [this](const Node* n1, const Node* n2) {
+            return m_topologicalIndex.find(n1)->second < m_topologicalIndex.find(n2)->second;
+        };
+        std::sort(forwardNodes.begin(), forwardNodes.end(), byIndex);
+        std::sort(backwardNodes.begin(), backwardNodes.end(), byIndex);
+
+        std::vector<size_t> freeIndices;
+        freeIndices.reserve(forwardNodes.size() + backwardNodes.size());
+        for (const Node* node : backwardNodes)
+            freeIndices.push_back(m_topologicalIndex.find(node)->second);
+        for (const Node* node : forwardNodes)
+            freeIndices.push_back(m_topologicalIndex.find(node)->second);
+        std::sort(freeIndices.begin(), freeIndices.end());
+
+        size_t nextFreeIndex = 0u;
+        for (const auto* nodes : { &backwardNodes, &forwardNodes })
+        {
+            for (Node* node : *nodes)
+            {
+                const size_t index = freeIndices[nextFreeIndex++];
+                m_topologicalOrder[index] = node;
+                m_topologicalIndex[node] = index;
+            }
+        }
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::collectAffectedNodes(Node& start, size_t minIndex, size_t maxIndex, bool forward, NodeVector& affectedNodes) const
+    {
+        std::unordered_set<const Node*> visitedNodes{ &start };
+        NodeVector nodesToVisit{ &start };
+        while (!nodesToVisit.empty())
+        {
+            Node* node = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            affectedNodes.push_back(node);
+
+            const auto visitNeighbour = [&](Node* neighbour) {
+                const size_t index = m_topologicalIndex.find(neighbour)->second;
+                if (index >= minIndex && index <= maxIndex && visitedNodes.insert(neighbour).second)
+                    nodesToVisit.push_back(neighbour);
+            };
+
+            if (forward)
+            {
+                for (const auto& edge : m_nodeOutgoingEdges.find(node)->second)
+                    visitNeighbour(edge.target);
+            }
+            else
+            {
+                for (Node* srcNode : m_nodeIncomingEdges.find(node)->second)
+                    visitNeighbour(srcNode);
+            }
+        }
     }
 
     // This is a slightly exotic sorting algorithm for DAGs
@@ -60,7 +177,7 @@ namespace ramses::internal
     // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
     // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
     // we only need to run a second time and remove the 'empty slots' to get the final order.
-    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
+    std::optional<NodeVector> DirectedAcyclicGraph::computeTopologicallySortedNodes() const
     {
         const size_t totalNodeCount = m_nodeOutgoingEdges.size();
 
@@ -136,9 +253,70 @@ namespace ramses::internal
         // Some nodes are nullptr because of the special 'bubble sort' sorting method
         sparseNodeQueue.erase(std::remove(sparseNodeQueue.begin(), sparseNodeQueue.end(), nullptr), sparseNodeQueue.end());
 
+        // Nodes of a cycle which is not reachable from any root node are never visited
+        if (sparseNodeQueue.size() != totalNodeCount)
+        {
+            return std::nullopt;
+        }
+
         return sparseNodeQueue;
     }
 
+    std::vector<NodeVector> DirectedAcyclicGraph::getTopologicalLevels(const NodeVector& sortedNodes) const
+    {
+        std::unordered_map<const Node*, size_t> nodeLevels;
+        nodeLevels.reserve(sortedNodes.size());
+
+        std::vector<NodeVector> levels;
+        for (Node* node : sortedNodes)
+        {
+            assert(m_nodeIncomingEdges.count(node) != 0);
+
+            // level of node is the length of the longest path leading to it, all source nodes were already processed
+            size_t level = 0u;
+            for (const Node* srcNode : m_nodeIncomingEdges.find(node)->second)
+            {
+                assert(nodeLevels.count(srcNode) != 0);
+                level = std::max(level, nodeLevels.find(srcNode)->second + 1u);
+            }
+            nodeLevels.emplace(node, level);
+
+            if (levels.size() <= level)
+                levels.resize(level + 1u);
+            levels[level].push_back(node);
+        }
+
+        return levels;
+    }
+
+    NodeVector DirectedAcyclicGraph::getReachableNodes(const NodeVector& sortedNodes, const NodeVector& startNodes) const
+    {
+        std::unordered_set<const Node*> reachableNodes;
+        NodeVector nodesToVisit;
+        for (Node* node : startNodes)
+        {
+            assert(m_nodeOutgoingEdges.count(node) != 0);
+            if (reachableNodes.insert(node).second)
+                nodesToVisit.push_back(node);
+        }
+
+        while (!nodesToVisit.empty())
+        {
+            Node* node = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            for (const auto& edge : m_nodeOutgoingEdges.find(node)->second)
+            {
+                if (reachableNodes.insert(edge.target).second)
+                    nodesToVisit.push_back(edge.target);
+            }
+        }
+
+        NodeVector result;
+        result.reserve(reachableNodes.size());
+        std::copy_if(sortedNodes.cbegin(), sortedNodes.cend(), std::back_inserter(result), [&reachableNodes](const Node* node) { return reachableNodes.count(node) != 0; });
+        return result;
+    }
+
     bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
         assert(m_nodeOutgoingEdges.count(&source) != 0);
@@ -155,6 +333,9 @@ namespace ramses::internal
             auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
             assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) == tgtToSourcesList.cend());
             tgtToSourcesList.push_back(&source);
+
+            if (m_topologicalOrderValid && !reorderForNewEdge(source, target))
+                m_topologicalOrderValid = false;
         }
         else
         {
@@ -185,6 +366,13 @@ namespace ramses::internal
         }
     }
 
+    size_t DirectedAcyclicGraph::getTopologicalIndex(const Node& node) const
+    {
+        const auto it = m_topologicalIndex.find(&node);
+        assert(it != m_topologicalIndex.cend());
+        return it->second;
+    }
+
     size_t DirectedAcyclicGraph::getInDegree(Node& node) const
     {
         assert(m_nodeOutgoingEdges.count(&node) != 0);
@@ -32,6 +32,10 @@ namespace ramses::internal
     // addEdge(A, C) two times, and A will have outDegree=5.
     // Topological sort result is cached because it's sensitive for performance (and is only
     // executed once before update()
+    // A topological order of all nodes is maintained incrementally (Pearce-Kelly): a new edge which contradicts
+    // the current order only reorders the nodes between its source and target which are reachable from them,
+    // so that single link changes do not require a full sort. If a new edge creates a cycle, the incremental
+    // order is dropped and a full sort is executed on next query (which also detects when the cycle is gone again).
     class DirectedAcyclicGraph
     {
     public:
@@ -45,7 +49,18 @@ namespace ramses::internal
         bool addEdge(Node& source, Node& target);
         void removeEdge(Node& source, Node& target);
 
-        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes();
+
+        // Groups topologically sorted nodes into levels - nodes of the same level do not depend on each other,
+        // all nodes a node depends on are in previous levels. Nodes within a level keep the order given by 'sortedNodes'.
+        [[nodiscard]] std::vector<NodeVector> getTopologicalLevels(const NodeVector& sortedNodes) const;
+
+        // Filters topologically sorted nodes to those reachable via edges from any of 'startNodes' (start nodes included),
+        // nodes keep the order given by 'sortedNodes'.
+        [[nodiscard]] NodeVector getReachableNodes(const NodeVector& sortedNodes, const NodeVector& startNodes) const;
+
+        // Index of node in maintained topological order, order respects all edges whenever sorting succeeds
+        [[nodiscard]] size_t getTopologicalIndex(const Node& node) const;
 
         // For testing only
         [[nodiscard]] size_t getInDegree(Node& node) const;
@@ -60,6 +75,11 @@ namespace ramses::internal
         using EdgeList = std::vector<Edge>;
 
         NodeVector collectRootNodes() const;
+        [[nodiscard]] std::optional<NodeVector> computeTopologicallySortedNodes() const;
+        void setTopologicalOrder(NodeVector sortedNodes);
+        // Returns false if the new edge closes a cycle, order is left untouched then
+        bool reorderForNewEdge(Node& source, Node& target);
+        void collectAffectedNodes(Node& start, size_t minIndex, size_t maxIndex, bool forward, NodeVector& affectedNodes) const;
 
         static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, const Node& node);
         static EdgeList::iterator FindEdgeToNode(EdgeList& vec, const Node& node);
@@ -72,5 +92,11 @@ namespace ramses::internal
         std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
         // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
         std::unordered_map<Node*, NodeVector> m_nodeIncomingEdges;
+
+        // Incrementally maintained topological order of all nodes and index of each node within it,
+        // order is only guaranteed to respect all edges if 'm_topologicalOrderValid' is set
+        NodeVector m_topologicalOrder;
+        std::unordered_map<const Node*, size_t> m_topologicalIndex;
+        bool m_topologicalOrderValid = true;
     };
 }
@@ -62,7 +62,7 @@ namespace ramses::internal
             break;
         case EEnvProtectionFlag::RunFunction:
             protectedMetatable[sol::meta_function::new_index] = EnvironmentProtection::protectedNewIndex_RunFunction;
-            protectedMetatable[sol::meta_function::index] = EnvironmentProtection::protectedIndex_RunFunction;
+            protectedMetatable[sol::meta_function::index] = CreateRunFunctionView(env, protectedMetatable);
             break;
         case EEnvProtectionFlag::Module:
             protectedMetatable[sol::meta_function::new_index] = EnvironmentProtection::protectedNewIndex_Module;
@@ -71,6 +71,25 @@ namespace ramses::internal
         }
     }
 
+    sol::table EnvironmentProtection::CreateRunFunctionView(const sol::environment& env, const sol::table& protectedMetatable)
+    {
+        // run() is called every update and may only read GLOBAL, so instead of calling into C++ on every global access
+        // the environment indexes a table holding GLOBAL, which the Lua VM resolves on its own. Any other key falls through
+        // to the view's metatable which reports the error (or resolves GLOBAL if it was set only after this protection level).
+        sol::state_view solState(env.lua_state());
+        sol::table runView = solState.create_table();
+        sol::table runViewMetatable = solState.create_table();
+        runViewMetatable["__sensitive"] = protectedMetatable.raw_get<sol::object>("__sensitive");
+        runViewMetatable[sol::meta_function::index] = EnvironmentProtection::protectedIndex_RunFunction;
+        runView[sol::metatable_key] = runViewMetatable;
+
+        const sol::object globalTable = GetProtectedEnvironmentTable(env).raw_get<sol::object>("GLOBAL");
+        if (globalTable.valid())
+            runView.raw_set("GLOBAL", globalTable);
+
+        return runView;
+    }
+
     void EnvironmentProtection::EnsureStringKey(const sol::object& key)
     {
         const sol::type keyType = key.get_type();
@@ -55,6 +55,7 @@ namespace ramses::internal
         static void protectedNewIndex_Module(const sol::lua_table& tbl, const sol::object& key, const sol::object& value);
         [[nodiscard]] static sol::object protectedIndex_Module(const sol::lua_table& tbl, const sol::object& key);
 
+        [[nodiscard]] static sol::table CreateRunFunctionView(const sol::environment& env, const sol::table& protectedMetatable);
         static void EnsureStringKey(const sol::object& key);
     };
 
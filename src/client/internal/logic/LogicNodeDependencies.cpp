@@ -28,12 +28,16 @@ namespace ramses::internal
         assert(!m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.addNode(node);
         m_nodeTopologyChanged = true;
+        node.setDirtyNodeSet(&m_dirtyNodes);
     }
 
     void LogicNodeDependencies::removeNode(LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.removeNode(node);
+        m_compiledLinkCopies.clear();
+        m_dirtyNodes.erase(&node);
+        node.setDirtyNodeSet(nullptr);
 
         // Remove the node from the cache without reordering the rest (unless there is no cache yet)
         // Removing nodes does not require topology update (we don't guarantee specific ordering when
@@ -43,6 +47,17 @@ namespace ramses::internal
             NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
             cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
         }
+        // levels of remaining nodes stay valid, they are possibly just not minimal anymore
+        if (m_cachedTopologicalLevels)
+        {
+            for (auto& levelNodes : *m_cachedTopologicalLevels)
+                levelNodes.erase(std::remove(levelNodes.begin(), levelNodes.end(), &node), levelNodes.end());
+        }
+    }
+
+    bool LogicNodeDependencies::containsNode(LogicNodeImpl& node) const
+    {
+        return m_logicNodeDAG.containsNode(node);
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -92,12 +107,70 @@ namespace ramses::internal
         if (m_nodeTopologyChanged)
         {
             m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
+            m_cachedTopologicalLevels.reset();
             m_nodeTopologyChanged = false;
         }
 
         return m_cachedTopologicallySortedNodes;
     }
 
+    size_t LogicNodeDependencies::getTopologicalIndex(const LogicNodeImpl& node) const
+    {
+        return m_logicNodeDAG.getTopologicalIndex(node);
+    }
+
+    NodeSet& LogicNodeDependencies::getDirtyNodes()
+    {
+        return m_dirtyNodes;
+    }
+
+    const std::vector<NodeVector>& LogicNodeDependencies::getTopologicalLevels()
+    {
+        const auto& sortedNodes = getTopologicallySortedNodes();
+        if (!m_cachedTopologicalLevels)
+            m_cachedTopologicalLevels = (sortedNodes ? m_logicNodeDAG.getTopologicalLevels(*sortedNodes) : std::vector<NodeVector>{});
+
+        return *m_cachedTopologicalLevels;
+    }
+
+    NodeVector LogicNodeDependencies::getTopologicallySortedNodesReachableFrom(const NodeVector& rootNodes)
+    {
+        const auto& sortedNodes = getTopologicallySortedNodes();
+        return (sortedNodes ? m_logicNodeDAG.getReachableNodes(*sortedNodes, rootNodes) : NodeVector{});
+    }
+
+    const LogicNodeDependencies::LinkCopies& LogicNodeDependencies::getOutgoingLinkCopies(const LogicNodeImpl& node)
+    {
+        auto it = m_compiledLinkCopies.find(&node);
+        if (it == m_compiledLinkCopies.end())
+        {
+            it = m_compiledLinkCopies.emplace(&node, LinkCopies{}).first;
+            const Property* outputs = node.getOutputs();
+            if (outputs != nullptr)
+                CompileLinkCopies(outputs->impl(), it->second);
+        }
+
+        return it->second;
+    }
+
+    void LogicNodeDependencies::CompileLinkCopies(const PropertyImpl& output, LinkCopies& linkCopies)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            const PropertyImpl& child = output.getChild(i)->impl();
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                CompileLinkCopies(child, linkCopies);
+            }
+            else
+            {
+                for (const auto& outLink : child.getOutgoingLinks())
+                    linkCopies.push_back({ &child, outLink.property });
+            }
+        }
+    }
+
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
@@ -156,6 +229,7 @@ namespace ramses::internal
         }
 
         input.setIncomingLink(output, isWeakLink);
+        m_compiledLinkCopies.clear();
 
         if (!isWeakLink)
         {
@@ -199,9 +273,13 @@ namespace ramses::internal
             auto& node = output.getLogicNode();
             auto& targetNode = input.getLogicNode();
             m_logicNodeDAG.removeEdge(node, targetNode);
+            // removing an edge keeps a valid order valid, but may break a cycle
+            if (!m_cachedTopologicallySortedNodes)
+                m_nodeTopologyChanged = true;
         }
 
         input.resetIncomingLink();
+        m_compiledLinkCopies.clear();
 
         return true;
     }
@@ -223,5 +301,7 @@ namespace ramses::internal
         assert(&node != &binding);
 
         m_logicNodeDAG.removeEdge(binding, node);
+        if (!m_cachedTopologicallySortedNodes)
+            m_nodeTopologyChanged = true;
     }
 }
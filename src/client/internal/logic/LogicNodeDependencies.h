@@ -11,6 +11,8 @@
 #include "internal/logic/DirectedAcyclicGraph.h"
 
 #include <unordered_set>
+#include <unordered_map>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -28,10 +30,31 @@ namespace ramses::internal
     public:
         // The primary purpose of this class
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        // Sorted nodes grouped into levels of nodes independent of each other, empty if nodes cannot be sorted
+        [[nodiscard]] const std::vector<NodeVector>& getTopologicalLevels();
+        // Sorted nodes reachable via links from any of the given root nodes (roots included), empty if nodes cannot be sorted
+        [[nodiscard]] NodeVector getTopologicallySortedNodesReachableFrom(const NodeVector& rootNodes);
+
+        // Flat list of value copies for all links outgoing from the outputs of a node (weak links included),
+        // compiled on first use after the set of links changed
+        struct LinkCopy
+        {
+            const PropertyImpl* source = nullptr;
+            PropertyImpl* target = nullptr;
+        };
+        using LinkCopies = std::vector<LinkCopy>;
+        [[nodiscard]] const LinkCopies& getOutgoingLinkCopies(const LogicNodeImpl& node);
+
+        // Nodes which became dirty since the set was last cleared, filled by the nodes themselves.
+        // Can contain nodes which are not dirty anymore (updated without clearing the set).
+        [[nodiscard]] NodeSet& getDirtyNodes();
+        // Position of node in topological order, only meaningful if nodes can be sorted (see getTopologicallySortedNodes)
+        [[nodiscard]] size_t getTopologicalIndex(const LogicNodeImpl& node) const;
 
         // Nodes management
         void addNode(LogicNodeImpl& node);
         void removeNode(LogicNodeImpl& node);
+        [[nodiscard]] bool containsNode(LogicNodeImpl& node) const;
 
         // Link management
         bool link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting);
@@ -46,9 +69,15 @@ namespace ramses::internal
         DirectedAcyclicGraph m_logicNodeDAG;
 
         [[nodiscard]] bool isLinked(const PropertyImpl& input) const;
+        static void CompileLinkCopies(const PropertyImpl& output, LinkCopies& linkCopies);
 
         // Initial state: no nodes and no need to re-compute node topology
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
+        // computed on demand from sorted nodes
+        std::optional<std::vector<NodeVector>> m_cachedTopologicalLevels;
         bool m_nodeTopologyChanged = false;
+        NodeSet m_dirtyNodes;
+        // cleared whenever links change or nodes are removed
+        std::unordered_map<const LogicNodeImpl*, LinkCopies> m_compiledLinkCopies;
     };
 }
@@ -0,0 +1,202 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/LogicNodeUpdateProfiler.h"
+#include "internal/logic/SolState.h"
+#include "impl/logic/LuaScriptImpl.h"
+#include "impl/logic/LuaInterfaceImpl.h"
+#include "impl/logic/NodeBindingImpl.h"
+#include "impl/logic/AppearanceBindingImpl.h"
+#include "impl/logic/CameraBindingImpl.h"
+#include "impl/logic/RenderPassBindingImpl.h"
+#include "impl/logic/RenderGroupBindingImpl.h"
+#include "impl/logic/MeshNodeBindingImpl.h"
+#include "impl/logic/SkinBindingImpl.h"
+#include "impl/logic/RenderBufferBindingImpl.h"
+#include "impl/logic/AnimationNodeImpl.h"
+#include "impl/logic/TimerNodeImpl.h"
+#include "impl/logic/AnchorPointImpl.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // profiler of logic engine currently updating a Lua script on this thread, hook of any other Lua state ignores samples
+        thread_local LogicNodeUpdateProfiler* ActiveProfiler = nullptr;
+
+        // folded stacks use ';' as frame separator and ' ' as separator of the value
+        std::string SanitizeFrameName(std::string_view name)
+        {
+            std::string frame{ name };
+            std::replace_if(frame.begin(), frame.end(), [](char c) { return c == ';' || c == ' ' || c == '\n'; }, '_');
+            return frame;
+        }
+
+        std::string GetLuaFrameName(const lua_Debug& debugInfo)
+        {
+            if (std::strcmp(debugInfo.what, "main") == 0)
+                return "main";
+            const char* name = (debugInfo.name != nullptr ? debugInfo.name : "?");
+            if (std::strcmp(debugInfo.what, "C") == 0)
+                return SanitizeFrameName(fmt::format("{} [C]", name));
+            return SanitizeFrameName(fmt::format("{}:{}", name, debugInfo.linedefined));
+        }
+
+        template <typename T>
+        bool IsOfType(const LogicNodeImpl& node)
+        {
+            return dynamic_cast<const T*>(&node) != nullptr;
+        }
+    }
+
+    void LogicNodeUpdateProfiler::setLuaSamplingPeriod(uint32_t luaSamplingPeriod)
+    {
+        m_luaSamplingPeriod = std::max(luaSamplingPeriod, 1u);
+    }
+
+    uint32_t LogicNodeUpdateProfiler::getLuaSamplingPeriod() const
+    {
+        return m_luaSamplingPeriod;
+    }
+
+    void LogicNodeUpdateProfiler::attach(SolState& solState)
+    {
+        solState.setInstructionCountHook(&LogicNodeUpdateProfiler::LuaHook, static_cast<int>(std::min<uint32_t>(m_luaSamplingPeriod, std::numeric_limits<int>::max())));
+    }
+
+    void LogicNodeUpdateProfiler::detach(SolState& solState)
+    {
+        solState.setInstructionCountHook(nullptr, 0);
+    }
+
+    void LogicNodeUpdateProfiler::nodeUpdateStarted(const LogicNodeImpl& node)
+    {
+        assert(m_currentNode == nullptr);
+        m_currentNode = &node;
+        m_currentNodeIsScript = IsOfType<LuaScriptImpl>(node);
+        if (m_currentNodeIsScript)
+            ActiveProfiler = this;
+        m_currentNodeStarted = Clock::now();
+    }
+
+    void LogicNodeUpdateProfiler::nodeUpdateFinished()
+    {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_currentNodeStarted);
+        assert(m_currentNode != nullptr);
+
+        if (m_currentNodeIsScript)
+        {
+            ActiveProfiler = nullptr;
+            // script update time is distributed evenly over Lua stacks sampled during its run,
+            // script which ran too short to be sampled gets the time assigned to script itself
+            const std::string scriptStack = fmt::format("LuaScript;{}", SanitizeFrameName(m_currentNode->getName()));
+            if (m_currentLuaSamples.empty())
+            {
+                m_stackTimes[scriptStack] += duration;
+            }
+            else
+            {
+                const auto durationPerSample = duration / static_cast<int64_t>(m_currentLuaSamples.size());
+                for (const auto& luaStack : m_currentLuaSamples)
+                    m_stackTimes[fmt::format("{};{}", scriptStack, luaStack)] += durationPerSample;
+                m_currentLuaSamples.clear();
+            }
+        }
+        else
+        {
+            m_stackTimes[getNodeTypeName(*m_currentNode)] += duration;
+        }
+
+        m_currentNode = nullptr;
+    }
+
+    std::string LogicNodeUpdateProfiler::getFoldedStacks() const
+    {
+        std::string result;
+        for (const auto& [stack, time] : m_stackTimes)
+            result += fmt::format("{} {}\n", stack, std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+        return result;
+    }
+
+    void LogicNodeUpdateProfiler::clear()
+    {
+        m_stackTimes.clear();
+    }
+
+    void LogicNodeUpdateProfiler::LuaHook(lua_State* state, lua_Debug* /*debugInfo*/)
+    {
+        if (ActiveProfiler != nullptr)
+            ActiveProfiler->sampleLuaStack(state);
+    }
+
+    void LogicNodeUpdateProfiler::sampleLuaStack(lua_State* state)
+    {
+        // folded stack lists outermost frame first, Lua stack levels start with innermost (running) function
+        std::vector<std::string> frames;
+        lua_Debug debugInfo{};
+        for (int level = 0; lua_getstack(state, level, &debugInfo) != 0; ++level)
+        {
+            lua_getinfo(state, "Sn", &debugInfo);
+            frames.push_back(GetLuaFrameName(debugInfo));
+        }
+
+        std::string stack;
+        for (auto it = frames.crbegin(); it != frames.crend(); ++it)
+        {
+            if (!stack.empty())
+                stack += ';';
+            stack += *it;
+        }
+        m_currentLuaSamples.push_back(std::move(stack));
+    }
+
+    const std::string& LogicNodeUpdateProfiler::getNodeTypeName(const LogicNodeImpl& node)
+    {
+        const std::type_index type{ typeid(node) };
+        auto it = m_nodeTypeNames.find(type);
+        if (it != m_nodeTypeNames.end())
+            return it->second;
+
+        std::string name = "LogicNode";
+        if (IsOfType<LuaInterfaceImpl>(node))
+            name = "LuaInterface";
+        else if (IsOfType<NodeBindingImpl>(node))
+            name = "NodeBinding";
+        else if (IsOfType<AppearanceBindingImpl>(node))
+            name = "AppearanceBinding";
+        else if (IsOfType<CameraBindingImpl>(node))
+            name = "CameraBinding";
+        else if (IsOfType<RenderPassBindingImpl>(node))
+            name = "RenderPassBinding";
+        else if (IsOfType<RenderGroupBindingImpl>(node))
+            name = "RenderGroupBinding";
+        else if (IsOfType<MeshNodeBindingImpl>(node))
+            name = "MeshNodeBinding";
+        else if (IsOfType<SkinBindingImpl>(node))
+            name = "SkinBinding";
+        else if (IsOfType<RenderBufferBindingImpl>(node))
+            name = "RenderBufferBinding";
+        else if (IsOfType<AnimationNodeImpl>(node))
+            name = "AnimationNode";
+        else if (IsOfType<TimerNodeImpl>(node))
+            name = "TimerNode";
+        else if (IsOfType<AnchorPointImpl>(node))
+            name = "AnchorPoint";
+        else if (IsOfType<FrustumCullingNodeImpl>(node))
+            name = "FrustumCullingNode";
+
+        return m_nodeTypeNames.emplace(type, std::move(name)).first->second;
+    }
+}
@@ -0,0 +1,66 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+struct lua_State;
+struct lua_Debug;
+
+namespace ramses::internal
+{
+    class LogicNodeImpl;
+    class SolState;
+
+    // Sampling profiler for logic engine update.
+    // Update time of native logic nodes (bindings, animations, etc.) is measured and aggregated per node type,
+    // update time of Lua scripts is distributed over Lua call stacks sampled by Lua instruction count hook every N instructions.
+    // Results are given in folded stacks format (one 'frame;frame;frame time_us' per line) as used by flamegraph tools.
+    class LogicNodeUpdateProfiler
+    {
+    public:
+        void setLuaSamplingPeriod(uint32_t luaSamplingPeriod);
+        [[nodiscard]] uint32_t getLuaSamplingPeriod() const;
+
+        // (re)installs Lua hook in given state, must be called before updating nodes, state can change when loading from file
+        void attach(SolState& solState);
+        void detach(SolState& solState);
+
+        void nodeUpdateStarted(const LogicNodeImpl& node);
+        void nodeUpdateFinished();
+
+        [[nodiscard]] std::string getFoldedStacks() const;
+        void clear();
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static void LuaHook(lua_State* state, lua_Debug* debugInfo);
+        void sampleLuaStack(lua_State* state);
+        [[nodiscard]] const std::string& getNodeTypeName(const LogicNodeImpl& node);
+
+        uint32_t m_luaSamplingPeriod = 1000u;
+
+        const LogicNodeImpl* m_currentNode = nullptr;
+        bool m_currentNodeIsScript = false;
+        Clock::time_point m_currentNodeStarted;
+        std::vector<std::string> m_currentLuaSamples;
+
+        std::unordered_map<std::type_index, std::string> m_nodeTypeNames;
+
+        // accumulated time per folded stack, ordered so results are deterministic
+        std::map<std::string, std::chrono::nanoseconds> m_stackTimes;
+    };
+}
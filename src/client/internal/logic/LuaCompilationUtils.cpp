@@ -18,11 +18,96 @@
 #include "internal/logic/PropertyTypeExtractor.h"
 #include "internal/logic/EPropertySemantics.h"
 #include "internal/logic/EnvironmentProtection.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
 #include "fmt/format.h"
 #include "SolHelper.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 namespace ramses::internal
 {
+    namespace
+    {
+        // Sources to precompile shared by the loading thread and worker tasks, every source is compiled by whoever
+        // picks it first. Tasks keep the state alive, they might get executed only after all sources were compiled.
+        class LuaPrecompileJobs
+        {
+        public:
+            explicit LuaPrecompileJobs(const std::vector<LuaSourceToPrecompile>& sources)
+                : m_sources(sources)
+                , m_results(sources.size())
+            {
+            }
+
+            void precompileRemaining()
+            {
+                // state is created only if there is anything left to compile
+                std::optional<sol::state> luaState;
+                for (size_t idx = m_nextIndex++; idx < m_sources.size(); idx = m_nextIndex++)
+                {
+                    if (!luaState)
+                        luaState.emplace();
+                    m_results[idx] = Precompile(*luaState, m_sources[idx]);
+                    if (++m_numCompiled == m_sources.size())
+                    {
+                        std::lock_guard<std::mutex> l(m_mutex);
+                        m_allCompiled.notify_all();
+                    }
+                }
+            }
+
+            std::vector<LuaPrecompiledSource> waitUntilAllCompiled()
+            {
+                std::unique_lock<std::mutex> l(m_mutex);
+                m_allCompiled.wait(l, [&] { return m_numCompiled == m_sources.size(); });
+                return std::move(m_results);
+            }
+
+        private:
+            static LuaPrecompiledSource Precompile(sol::state& luaState, const LuaSourceToPrecompile& source)
+            {
+                sol::load_result loadResult = luaState.load(source.source, std::string(source.chunkName));
+                if (!loadResult.valid())
+                    return {};
+
+                ErrorReporting extractionErrors;
+                std::optional<std::vector<std::string>> declaredModules = LuaCompilationUtils::ExtractModuleDependencies(source.source, extractionErrors);
+                if (!declaredModules)
+                    return {};
+
+                sol::protected_function mainFunction = loadResult;
+                return LuaPrecompiledSource{ mainFunction.dump(), std::move(*declaredModules) };
+            }
+
+            const std::vector<LuaSourceToPrecompile> m_sources;
+            std::vector<LuaPrecompiledSource> m_results;
+            std::atomic<size_t> m_nextIndex{ 0u };
+            std::atomic<size_t> m_numCompiled{ 0u };
+            std::mutex m_mutex;
+            std::condition_variable m_allCompiled;
+        };
+
+        class LuaPrecompileTask : public ITask
+        {
+        public:
+            explicit LuaPrecompileTask(std::shared_ptr<LuaPrecompileJobs> jobs)
+                : m_jobs(std::move(jobs))
+            {
+            }
+
+            void execute() override
+            {
+                m_jobs->precompileRemaining();
+            }
+
+        private:
+            std::shared_ptr<LuaPrecompileJobs> m_jobs;
+        };
+    }
+
     std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScriptOrImportPrecompiled(
         SolState& solState,
         const ModuleMapping& userModules,
@@ -311,7 +396,29 @@ namespace ramses::internal
         sol::protected_function_result main_result{};
 
         const std::string debuggingName = "RL_lua_module";
-        if (!byteCodeFromPrecompiledModule.empty())
+
+        // module with same source compiled before by any logic engine, its bytecode can be loaded directly
+        std::shared_ptr<const LuaSharedModuleSource> sharedSource;
+        if (byteCodeFromPrecompiledModule.empty() && !source.empty())
+        {
+            sharedSource = LuaModuleSourceCache::Find(source);
+            if (sharedSource)
+            {
+                if (!CheckDeclaredAndProvidedModules(sharedSource->declaredModules, userModules, name, errorReporting))
+                    return std::nullopt;
+
+                ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
+                main_result = solState.loadScriptByteCode(sharedSource->byteCode.as_string_view(), debuggingName, env);
+                if (!main_result.valid())
+                {
+                    sol::error error = main_result;
+                    errorReporting.set(error.what(), nullptr);
+                    return std::nullopt;
+                }
+            }
+        }
+
+        if (!sharedSource && !byteCodeFromPrecompiledModule.empty())
         {
             ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
             main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledModule.as_string_view(), debuggingName, env);
@@ -331,7 +438,9 @@ namespace ramses::internal
             }
         }
 
-        if (byteCodeFromPrecompiledModule.empty())
+        // dependencies are extracted only when compiling from source, they are cached together with its bytecode
+        std::optional<std::vector<std::string>> declaredModules;
+        if (!sharedSource && byteCodeFromPrecompiledModule.empty())
         {
             load_result = solState.loadScript(source, debuggingName);
             if (!load_result.valid())
@@ -341,7 +450,8 @@ namespace ramses::internal
                 return std::nullopt;
             }
 
-            if (!CrossCheckDeclaredAndProvidedModules(source, userModules, name, errorReporting))
+            declaredModules = LuaCompilationUtils::ExtractModuleDependencies(source, errorReporting);
+            if (!declaredModules || !CheckDeclaredAndProvidedModules(*declaredModules, userModules, name, errorReporting))
                 return std::nullopt;
 
             mainFunction = load_result;
@@ -373,20 +483,27 @@ namespace ramses::internal
         sol::table moduleTable = resultObj;
 
         //for serialization
-        sol::bytecode resultByteCode = (byteCodeFromPrecompiledModule.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledModule));
+        sol::bytecode resultByteCode;
+        if (!sharedSource)
+            resultByteCode = (byteCodeFromPrecompiledModule.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledModule));
 
         auto compiledModule = LuaCompiledModule{
             LuaCompiledSource{
-                std::move(source),
+                (sharedSource ? std::string{} : std::move(source)),
                 std::move(resultByteCode),
                 solState,
                 stdModules,
                 userModules,
                 enableDebugLogFunctions
             },
-            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable)
+            LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable),
+            std::move(sharedSource)
         };
 
+        // freshly compiled from source, make it available to modules of other logic engines
+        if (declaredModules)
+            ShareModuleSource(compiledModule, std::move(*declaredModules));
+
         // Applies environment protection to the module until it's destroyed
         // There is no difference between compilation time and runtime protection rules for modules
         // (the rules are the same)
@@ -446,24 +563,40 @@ namespace ramses::internal
         return true;
     }
 
+    void LuaCompilationUtils::ShareModuleSource(LuaCompiledModule& module, std::vector<std::string> declaredModules)
+    {
+        if (module.sharedSource || module.source.sourceCode.empty() || module.source.byteCode.empty())
+            return;
+
+        module.sharedSource = LuaModuleSourceCache::Store({ std::move(module.source.sourceCode), std::move(module.source.byteCode), std::move(declaredModules) });
+        module.source.sourceCode.clear();
+        module.source.byteCode.clear();
+    }
+
     bool LuaCompilationUtils::CrossCheckDeclaredAndProvidedModules(std::string_view source, const ModuleMapping& modules, std::string_view name, ErrorReporting& errorReporting)
     {
         std::optional<std::vector<std::string>> declaredModules = LuaCompilationUtils::ExtractModuleDependencies(source, errorReporting);
         if (!declaredModules) // failed extraction
             return false;
-        if (modules.empty() && declaredModules->empty()) // early out if no modules
+
+        return CheckDeclaredAndProvidedModules(std::move(*declaredModules), modules, name, errorReporting);
+    }
+
+    bool LuaCompilationUtils::CheckDeclaredAndProvidedModules(std::vector<std::string> declaredModules, const ModuleMapping& modules, std::string_view name, ErrorReporting& errorReporting)
+    {
+        if (modules.empty() && declaredModules.empty()) // early out if no modules
             return true;
 
         std::vector<std::string> providedModules;
         providedModules.reserve(modules.size());
         for (const auto& m : modules)
             providedModules.push_back(m.first);
-        std::sort(declaredModules->begin(), declaredModules->end());
+        std::sort(declaredModules.begin(), declaredModules.end());
         std::sort(providedModules.begin(), providedModules.end());
         if (providedModules != declaredModules)
         {
             std::string errMsg = fmt::format("[{}] Error while loading script/module. Module dependencies declared in source code do not match those provided by LuaConfig.\n", name);
-            errMsg += fmt::format("  Module dependencies declared in source code: {}\n", fmt::join(*declaredModules, ", "));
+            errMsg += fmt::format("  Module dependencies declared in source code: {}\n", fmt::join(declaredModules, ", "));
             errMsg += fmt::format("  Module dependencies provided on create API: {}", fmt::join(providedModules, ", "));
             errorReporting.set(errMsg, nullptr);
             return false;
@@ -536,4 +669,22 @@ namespace ramses::internal
 
         return extractedModules;
     }
+
+    std::vector<LuaPrecompiledSource> LuaCompilationUtils::PrecompileSources(const std::vector<LuaSourceToPrecompile>& sources, ITaskQueue& taskQueue)
+    {
+        if (sources.empty())
+            return {};
+
+        auto jobs = std::make_shared<LuaPrecompileJobs>(sources);
+        const size_t numTasks = std::min(sources.size() - 1u, MaxParallelPrecompileTasks);
+        for (size_t i = 0u; i < numTasks; ++i)
+        {
+            auto task = new LuaPrecompileTask(jobs);
+            taskQueue.enqueue(*task);
+            task->release();
+        }
+        jobs->precompileRemaining();
+
+        return jobs->waitUntilAllCompiled();
+    }
 }
@@ -10,10 +10,13 @@
 
 #include "impl/logic/LuaConfigImpl.h"
 #include "internal/logic/SolWrapper.h"
+#include "internal/logic/LuaModuleSourceCache.h"
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace ramses
 {
@@ -25,6 +28,7 @@ namespace ramses::internal
     class SolState;
     class ErrorReporting;
     class PropertyImpl;
+    class ITaskQueue;
 
     struct LuaCompiledSource
     {
@@ -58,6 +62,22 @@ namespace ramses::internal
     {
         LuaCompiledSource source;
         sol::table moduleTable;
+        // set if source and bytecode are held by process-wide cache, source code and bytecode above are empty then
+        std::shared_ptr<const LuaSharedModuleSource> sharedSource;
+    };
+
+    struct LuaSourceToPrecompile
+    {
+        std::string_view source;
+        // has to match the chunk name used when compiling in the logic engine state, it is part of the bytecode
+        std::string_view chunkName;
+    };
+
+    struct LuaPrecompiledSource
+    {
+        // empty if source failed to precompile, it then has to be compiled the regular way which reports the error
+        sol::bytecode byteCode;
+        std::vector<std::string> declaredModules;
     };
 
     class LuaCompilationUtils
@@ -93,6 +113,9 @@ namespace ramses::internal
             sol::bytecode byteCodeFromPrecompiledModule,
             bool enableDebugLogFunctions);
 
+        // Moves source and bytecode of compiled module to process-wide cache (or replaces them with already cached ones)
+        static void ShareModuleSource(LuaCompiledModule& module, std::vector<std::string> declaredModules);
+
         [[nodiscard]] static bool CheckModuleName(std::string_view name);
 
         [[nodiscard]] static std::optional<std::vector<std::string>> ExtractModuleDependencies(
@@ -101,6 +124,21 @@ namespace ramses::internal
 
         [[nodiscard]] static sol::table MakeTableReadOnly(SolState& solState, sol::table table);
 
+        // Compiles sources to bytecode and extracts their module dependencies concurrently on worker tasks of given queue,
+        // every participating thread uses its own Lua state. Calling thread takes part and returns when all sources are done.
+        [[nodiscard]] static std::vector<LuaPrecompiledSource> PrecompileSources(
+            const std::vector<LuaSourceToPrecompile>& sources,
+            ITaskQueue& taskQueue);
+
+        // Same check as done when compiling from source, for sources whose dependencies were extracted by PrecompileSources
+        [[nodiscard]] static bool CheckDeclaredAndProvidedModules(
+            std::vector<std::string> declaredModules,
+            const ModuleMapping& modules,
+            std::string_view chunkname,
+            ErrorReporting& errorReporting);
+
+        static constexpr size_t MaxParallelPrecompileTasks = 4u;
+
     private:
         [[nodiscard]] static bool CrossCheckDeclaredAndProvidedModules(
             std::string_view source,
@@ -0,0 +1,81 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/LuaModuleSourceCache.h"
+
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // entries are keyed by hash of source and compared by full source on lookup
+        using CacheEntries = std::unordered_multimap<size_t, std::weak_ptr<const LuaSharedModuleSource>>;
+
+        std::mutex& GetCacheLock()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+        CacheEntries& GetCacheEntries()
+        {
+            static CacheEntries entries;
+            return entries;
+        }
+
+        std::shared_ptr<const LuaSharedModuleSource> FindLocked(CacheEntries& entries, size_t hash, std::string_view sourceCode)
+        {
+            const auto range = entries.equal_range(hash);
+            for (auto it = range.first; it != range.second;)
+            {
+                auto entry = it->second.lock();
+                if (!entry)
+                {
+                    it = entries.erase(it);
+                    continue;
+                }
+                if (entry->sourceCode == sourceCode)
+                    return entry;
+                ++it;
+            }
+            return nullptr;
+        }
+    }
+
+    std::shared_ptr<const LuaSharedModuleSource> LuaModuleSourceCache::Find(std::string_view sourceCode)
+    {
+        std::lock_guard<std::mutex> guard{ GetCacheLock() };
+        return FindLocked(GetCacheEntries(), std::hash<std::string_view>{}(sourceCode), sourceCode);
+    }
+
+    std::shared_ptr<const LuaSharedModuleSource> LuaModuleSourceCache::Store(LuaSharedModuleSource source)
+    {
+        const size_t hash = std::hash<std::string_view>{}(source.sourceCode);
+
+        std::lock_guard<std::mutex> guard{ GetCacheLock() };
+        auto& entries = GetCacheEntries();
+        if (auto existingEntry = FindLocked(entries, hash, source.sourceCode))
+            return existingEntry;
+
+        auto entry = std::make_shared<const LuaSharedModuleSource>(std::move(source));
+        entries.emplace(hash, entry);
+        return entry;
+    }
+
+    size_t LuaModuleSourceCache::GetEntryCount()
+    {
+        std::lock_guard<std::mutex> guard{ GetCacheLock() };
+        auto& entries = GetCacheEntries();
+        for (auto it = entries.begin(); it != entries.end();)
+            it = (it->second.expired() ? entries.erase(it) : std::next(it));
+        return entries.size();
+    }
+}
@@ -0,0 +1,42 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/logic/SolWrapper.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Immutable compilation result of a Lua module source, independent of the Lua state it is loaded into
+    struct LuaSharedModuleSource
+    {
+        std::string sourceCode;
+        sol::bytecode byteCode;
+        std::vector<std::string> declaredModules;
+    };
+
+    // Process-wide cache of Lua module sources and their bytecode, shared by modules of all logic engines.
+    // Loading a module whose source is already cached skips its compilation and the memory of source and bytecode
+    // is held only once regardless of how many logic engines use the module.
+    // Entries are held weakly, an entry is released as soon as the last module using it is destroyed. Thread safe.
+    class LuaModuleSourceCache
+    {
+    public:
+        [[nodiscard]] static std::shared_ptr<const LuaSharedModuleSource> Find(std::string_view sourceCode);
+
+        // returns already cached entry with same source if there is one, otherwise caches and returns given one
+        [[nodiscard]] static std::shared_ptr<const LuaSharedModuleSource> Store(LuaSharedModuleSource source);
+
+        [[nodiscard]] static size_t GetEntryCount();
+    };
+}
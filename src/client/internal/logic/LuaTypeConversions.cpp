@@ -13,6 +13,28 @@
 
 namespace ramses::internal
 {
+    namespace
+    {
+        // Pushes the object only once to the Lua stack, querying get_type() and as<double>() separately would push it twice
+        bool GetNumber(const sol::object& solObject, double& number, sol::type& type)
+        {
+            if (!solObject.valid())
+            {
+                type = solObject.get_type();
+                return false;
+            }
+
+            lua_State* state = solObject.lua_state();
+            solObject.push();
+            type = static_cast<sol::type>(lua_type(state, -1));
+            if (type == sol::type::number)
+                number = lua_tonumber(state, -1);
+            lua_pop(state, 1);
+
+            return type == sol::type::number;
+        }
+    }
+
     // extracts a plain Lua table, or one which was made read-only (e.g. module data tables)
     std::optional<sol::lua_table> LuaTypeConversions::ExtractLuaTable(const sol::object& object)
     {
@@ -77,18 +99,9 @@ namespace ramses::internal
         return 0;
     }
 
-    template <> DataOrError<float> LuaTypeConversions::ExtractSpecificType<float>(const sol::object& solObject)
+    template <>
+    DataOrError<float> LuaTypeConversions::ConvertNumber<float>(double asDouble)
     {
-        if (!solObject.valid() || solObject.get_type() != sol::type::number)
-        {
-            return DataOrError<float>(
-                fmt::format("Error while extracting floating point number: expected a number, received '{}'",
-                    sol_helper::GetSolTypeName(solObject.get_type())));
-        }
-
-        // Extract Lua number (==double)
-        const double asDouble = solObject.as<double>();
-
         // Integral part out of range of float type
         if (asDouble > std::numeric_limits<float>::max() || asDouble < std::numeric_limits<float>::lowest())
         {
@@ -99,17 +112,8 @@ namespace ramses::internal
     }
 
     template <>
-    DataOrError<int32_t> LuaTypeConversions::ExtractSpecificType<int32_t>(const sol::object& solObject)
+    DataOrError<int32_t> LuaTypeConversions::ConvertNumber<int32_t>(double asDouble)
     {
-        if (!solObject.valid() || solObject.get_type() != sol::type::number)
-        {
-            return DataOrError<int32_t>(
-                fmt::format("Error while extracting integer: expected a number, received '{}'",
-                sol_helper::GetSolTypeName(solObject.get_type())));
-        }
-
-        // Get Lua number as double (internal format of Lua)
-        const double asDouble = solObject.as<double>();
         // Rounds to closest signed integer
         const double rounded = std::round(asDouble);
 
@@ -134,17 +138,8 @@ namespace ramses::internal
     }
 
     template <>
-    DataOrError<int64_t> LuaTypeConversions::ExtractSpecificType<int64_t>(const sol::object& solObject)
+    DataOrError<int64_t> LuaTypeConversions::ConvertNumber<int64_t>(double asDouble)
     {
-        if (!solObject.valid() || solObject.get_type() != sol::type::number)
-        {
-            return DataOrError<int64_t>(
-                fmt::format("Error while extracting integer: expected a number, received '{}'",
-                    sol_helper::GetSolTypeName(solObject.get_type())));
-        }
-
-        // Get Lua number as double (internal format of Lua)
-        const double asDouble = solObject.as<double>();
         // Rounds to closest signed integer
         const double rounded = std::round(asDouble);
 
@@ -169,19 +164,83 @@ namespace ramses::internal
         return DataOrError<int64_t>(static_cast<int64_t>(rounded));
     }
 
+    template <>
+    float LuaTypeConversions::ConvertNumberTrusted<float>(double asDouble)
+    {
+        return static_cast<float>(asDouble);
+    }
+
+    template <>
+    int32_t LuaTypeConversions::ConvertNumberTrusted<int32_t>(double asDouble)
+    {
+        return static_cast<int32_t>(std::round(asDouble));
+    }
 
     template <>
-    DataOrError<size_t> LuaTypeConversions::ExtractSpecificType<size_t>(const sol::object& solObject)
+    int64_t LuaTypeConversions::ConvertNumberTrusted<int64_t>(double asDouble)
+    {
+        return static_cast<int64_t>(std::round(asDouble));
+    }
+
+    template <> DataOrError<float> LuaTypeConversions::ExtractSpecificType<float>(const sol::object& solObject)
     {
-        if (!solObject.valid() || solObject.get_type() != sol::type::number)
+        double asDouble = 0.0;
+        sol::type type = sol::type::none;
+        if (!GetNumber(solObject, asDouble, type))
         {
-            return DataOrError<size_t>(
+            return DataOrError<float>(
+                fmt::format("Error while extracting floating point number: expected a number, received '{}'",
+                    sol_helper::GetSolTypeName(type)));
+        }
+
+        // Extract Lua number (==double)
+        return ConvertNumber<float>(asDouble);
+    }
+
+    template <>
+    DataOrError<int32_t> LuaTypeConversions::ExtractSpecificType<int32_t>(const sol::object& solObject)
+    {
+        double asDouble = 0.0;
+        sol::type type = sol::type::none;
+        if (!GetNumber(solObject, asDouble, type))
+        {
+            return DataOrError<int32_t>(
                 fmt::format("Error while extracting integer: expected a number, received '{}'",
-                sol_helper::GetSolTypeName(solObject.get_type())));
+                sol_helper::GetSolTypeName(type)));
         }
 
+        // Extract Lua number (==double)
+        return ConvertNumber<int32_t>(asDouble);
+    }
+
+    template <>
+    DataOrError<int64_t> LuaTypeConversions::ExtractSpecificType<int64_t>(const sol::object& solObject)
+    {
+        double asDouble = 0.0;
+        sol::type type = sol::type::none;
+        if (!GetNumber(solObject, asDouble, type))
+        {
+            return DataOrError<int64_t>(
+                fmt::format("Error while extracting integer: expected a number, received '{}'",
+                    sol_helper::GetSolTypeName(type)));
+        }
+
+        // Extract Lua number (==double)
+        return ConvertNumber<int64_t>(asDouble);
+    }
+
+    template <>
+    DataOrError<size_t> LuaTypeConversions::ExtractSpecificType<size_t>(const sol::object& solObject)
+    {
         // Get Lua number as double (internal format of Lua)
-        const double asDouble = solObject.as<double>();
+        double asDouble = 0.0;
+        sol::type type = sol::type::none;
+        if (!GetNumber(solObject, asDouble, type))
+        {
+            return DataOrError<size_t>(
+                fmt::format("Error while extracting integer: expected a number, received '{}'",
+                sol_helper::GetSolTypeName(type)));
+        }
 
         // Check that number is >= 0, with some tolerance
         if (asDouble < -std::numeric_limits<double>::epsilon())
@@ -227,7 +286,7 @@ namespace ramses::internal
     }
 
     template <typename T, size_t size >
-    DataOrError< std::array<T, size> > LuaTypeConversions::ExtractArray(const sol::object& solObject)
+    DataOrError< std::array<T, size> > LuaTypeConversions::ExtractArray(const sol::object& solObject, bool trustedNumbers)
     {
         const std::optional<sol::lua_table> potentialLuaTable = ExtractLuaTable(solObject);
         if (!potentialLuaTable)
@@ -239,41 +298,70 @@ namespace ramses::internal
 
         const sol::lua_table& solTable = *potentialLuaTable;
 
-        const size_t tableFieldCount = solTable.size();
+        // Table is pushed once and all entries are read by raw index, which is the hot path when scripts assign vectors
+        lua_State* state = solTable.lua_state();
+        solTable.push();
+        const int tableIndex = lua_gettop(state);
 
+        const auto tableFieldCount = static_cast<size_t>(lua_rawlen(state, tableIndex));
         if (tableFieldCount != size)
         {
+            lua_pop(state, 1);
             return DataOrError<std::array<T, size>>(
                 fmt::format("Error while extracting array: expected {} array components in table but got {} instead!",
                             size, tableFieldCount));
         }
 
         std::array<T, size> data{};
+        size_t failedEntry = 0u;
         for (size_t i = 1; i <= size; ++i)
         {
-            const sol::object& tableEntry = solTable[i];
+            const bool isNumber = (lua_rawgeti(state, tableIndex, static_cast<lua_Integer>(i)) == LUA_TNUMBER);
+            const double number = isNumber ? lua_tonumber(state, -1) : 0.0;
+            lua_pop(state, 1);
 
-            const DataOrError<T> maybeValue = ExtractSpecificType<T>(tableEntry);
+            if (!isNumber)
+            {
+                failedEntry = i;
+                break;
+            }
 
+            if (trustedNumbers)
+            {
+                data[i - 1] = ConvertNumberTrusted<T>(number);
+                continue;
+            }
+
+            const DataOrError<T> maybeValue = ConvertNumber<T>(number);
             if (maybeValue.hasError())
             {
-                return DataOrError<std::array<T, size>>(
-                    fmt::format("Error while extracting array: unexpected value (type: '{}') at array element # {}! Reason: {}",
-                                sol_helper::GetSolTypeName(tableEntry.get_type()), i, maybeValue.getError())
-                );
+                failedEntry = i;
+                break;
             }
+            data[i - 1] = maybeValue.getData();
+        }
+        lua_pop(state, 1);
 
-            data[i-1] = maybeValue.getData();
+        if (failedEntry != 0u)
+        {
+            // error path resolves the entry again through sol to report its type and the exact reason
+            const sol::object& tableEntry = solTable[failedEntry];
+            const DataOrError<T> maybeValue = ExtractSpecificType<T>(tableEntry);
+            assert(maybeValue.hasError());
+            return DataOrError<std::array<T, size>>(
+                fmt::format("Error while extracting array: unexpected value (type: '{}') at array element # {}! Reason: {}",
+                            sol_helper::GetSolTypeName(tableEntry.get_type()), failedEntry, maybeValue.getError())
+            );
         }
 
         return DataOrError(std::move(data));
     }
 
     // Explicitly instantiate types we use
-    template DataOrError<std::array<int32_t, 2>> LuaTypeConversions::ExtractArray<int32_t, 2>(const sol::object& solObject);
-    template DataOrError<std::array<int32_t, 3>> LuaTypeConversions::ExtractArray<int32_t, 3>(const sol::object& solObject);
-    template DataOrError<std::array<int32_t, 4>> LuaTypeConversions::ExtractArray<int32_t, 4>(const sol::object& solObject);
-    template DataOrError<std::array<float, 2>> LuaTypeConversions::ExtractArray<float, 2>(const sol::object& solObject);
-    template DataOrError<std::array<float, 3>> LuaTypeConversions::ExtractArray<float, 3>(const sol::object& solObject);
-    template DataOrError<std::array<float, 4>> LuaTypeConversions::ExtractArray<float, 4>(const sol::object& solObject);
+    template DataOrError<std::array<int32_t, 2>> LuaTypeConversions::ExtractArray<int32_t, 2>(const sol::object& solObject, bool trustedNumbers);
+    template DataOrError<std::array<int32_t, 3>> LuaTypeConversions::ExtractArray<int32_t, 3>(const sol::object& solObject, bool trustedNumbers);
+    template DataOrError<std::array<int32_t, 4>> LuaTypeConversions::ExtractArray<int32_t, 4>(const sol::object& solObject, bool trustedNumbers);
+    template DataOrError<std::array<float, 2>> LuaTypeConversions::ExtractArray<float, 2>(const sol::object& solObject, bool trustedNumbers);
+    template DataOrError<std::array<float, 3>> LuaTypeConversions::ExtractArray<float, 3>(const sol::object& solObject, bool trustedNumbers);
+    template DataOrError<std::array<float, 4>> LuaTypeConversions::ExtractArray<float, 4>(const sol::object& solObject, bool trustedNumbers);
 }
@@ -66,10 +66,21 @@ namespace ramses::internal
         template <typename T>
         [[nodiscard]] static DataOrError<T> ExtractSpecificType(const sol::object& solObject);
 
+        // Same as ExtractSpecificType, but for callers which already checked that the Lua object is a number
+        template <typename T>
+        [[nodiscard]] static DataOrError<T> ConvertNumber(double number);
+
+        // Same as ConvertNumber, but without range and rounding checks - for scripts created with trusted numeric conversions,
+        // which guarantee that their values fit into the target type (otherwise the result is undefined)
+        template <typename T>
+        [[nodiscard]] static T ConvertNumberTrusted(double number);
+
         [[nodiscard]] static size_t         GetMaxIndexForVectorType(EPropertyType type);
 
+        // Reads the numeric table entries by raw index directly from the Lua stack (no sol::object per entry),
+        // with trustedNumbers the entries are converted using ConvertNumberTrusted
         template <typename T, size_t size>
-        [[nodiscard]] static DataOrError<std::array<T, size>> ExtractArray(const sol::object& solObject);
+        [[nodiscard]] static DataOrError<std::array<T, size>> ExtractArray(const sol::object& solObject, bool trustedNumbers = false);
 
         static_assert(std::is_same<LUA_NUMBER, double>::value, "This class assumes that Lua-internal numbers are double precision floats");
     };
@@ -0,0 +1,89 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/logic/NodeTransformWriteBuffer.h"
+#include "ramses/client/Node.h"
+#include "impl/SceneImpl.h"
+#include "impl/NodeImpl.h"
+
+namespace ramses::internal
+{
+    NodeTransformWriteBuffer::NodeTransformWriteBuffer(SceneImpl& scene)
+        : m_scene{ scene }
+    {
+    }
+
+    void NodeTransformWriteBuffer::setTranslation(ramses::Node& node, const vec3f& translation)
+    {
+        vec3f currentTranslation;
+        if (node.getTranslation(currentTranslation) && currentTranslation == translation)
+            return;
+
+        m_translations.nodes.push_back(&node);
+        m_translations.values.push_back(translation);
+    }
+
+    void NodeTransformWriteBuffer::setRotation(ramses::Node& node, const quat& rotation)
+    {
+        // node without transform reports identity rotation, with transform only quaternion rotation can be compared
+        const bool canCompare = !node.impl().getTransformHandle().isValid() || node.getRotationType() == ramses::ERotationType::Quaternion;
+        quat currentRotation;
+        if (canCompare && node.getRotation(currentRotation) && currentRotation == rotation)
+            return;
+
+        m_rotations.nodes.push_back(&node);
+        m_rotations.values.push_back(rotation);
+    }
+
+    void NodeTransformWriteBuffer::setScaling(ramses::Node& node, const vec3f& scaling)
+    {
+        vec3f currentScaling;
+        if (node.getScaling(currentScaling) && currentScaling == scaling)
+            return;
+
+        m_scalings.nodes.push_back(&node);
+        m_scalings.values.push_back(scaling);
+    }
+
+    bool NodeTransformWriteBuffer::empty() const
+    {
+        return m_translations.nodes.empty() && m_rotations.nodes.empty() && m_scalings.nodes.empty();
+    }
+
+    void NodeTransformWriteBuffer::setEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    bool NodeTransformWriteBuffer::isEnabled() const
+    {
+        return m_enabled;
+    }
+
+    bool NodeTransformWriteBuffer::commit()
+    {
+        bool success = commitComponent(m_translations, m_translations.values.data(), nullptr, nullptr);
+        success &= commitComponent(m_rotations, nullptr, m_rotations.values.data(), nullptr);
+        success &= commitComponent(m_scalings, nullptr, nullptr, m_scalings.values.data());
+
+        return success;
+    }
+
+    template <typename T>
+    bool NodeTransformWriteBuffer::commitComponent(ComponentWrites<T>& writes, const vec3f* translations, const quat* rotations, const vec3f* scalings)
+    {
+        if (writes.nodes.empty())
+            return true;
+
+        const bool success = m_scene.setNodeTransforms(writes.nodes.size(), writes.nodes.data(), translations, rotations, scalings);
+        writes.nodes.clear();
+        writes.values.clear();
+
+        return success;
+    }
+}
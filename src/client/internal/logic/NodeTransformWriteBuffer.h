@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/DataTypes.h"
+
+#include <vector>
+
+namespace ramses
+{
+    class Node;
+}
+
+namespace ramses::internal
+{
+    class SceneImpl;
+
+    // Collects node transformation changes of node bindings during logic engine update and writes them
+    // to the scene in one bulk update per transformation component (see Scene::setNodeTransforms).
+    // Values equal to the current state of the node are not collected, same as the single value setters of Node skip them.
+    class NodeTransformWriteBuffer
+    {
+    public:
+        explicit NodeTransformWriteBuffer(SceneImpl& scene);
+
+        void setTranslation(ramses::Node& node, const vec3f& translation);
+        void setRotation(ramses::Node& node, const quat& rotation);
+        void setScaling(ramses::Node& node, const vec3f& scaling);
+
+        [[nodiscard]] bool empty() const;
+
+        // node bindings collect their changes only while enabled (during logic engine update), otherwise they set them to node directly
+        void setEnabled(bool enabled);
+        [[nodiscard]] bool isEnabled() const;
+
+        // Writes all collected values to scene and clears the buffer, must be called before any
+        // logic node reads node transformations from scene (and at end of update at latest)
+        bool commit();
+
+    private:
+        template <typename T>
+        struct ComponentWrites
+        {
+            std::vector<ramses::Node*> nodes;
+            std::vector<T> values;
+        };
+
+        template <typename T>
+        bool commitComponent(ComponentWrites<T>& writes, const vec3f* translations, const quat* rotations, const vec3f* scalings);
+
+        SceneImpl& m_scene;
+        ComponentWrites<vec3f> m_translations;
+        ComponentWrites<quat> m_rotations;
+        ComponentWrites<vec3f> m_scalings;
+        bool m_enabled = false;
+    };
+}
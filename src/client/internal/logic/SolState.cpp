@@ -189,4 +189,50 @@ namespace ramses::internal
     {
         return lua_gettop(m_solState.lua_state());
     }
+
+    void SolState::setInstructionCountHook(lua_Hook hook, int instructionCount)
+    {
+        lua_sethook(m_solState.lua_state(), hook, hook != nullptr ? LUA_MASKCOUNT : 0, instructionCount);
+    }
+
+    bool SolState::setGarbageCollectorMode(ELuaGarbageCollectorMode mode, int parameter1, int parameter2)
+    {
+        lua_State* state = m_solState.lua_state();
+#if LUA_VERSION_NUM >= 504
+        if (mode == ELuaGarbageCollectorMode::Generational)
+            lua_gc(state, LUA_GCGEN, parameter1, parameter2);
+        else
+            lua_gc(state, LUA_GCINC, parameter1, parameter2, 0);
+        return true;
+#else
+        if (mode == ELuaGarbageCollectorMode::Generational)
+            return false;
+        if (parameter1 != 0)
+            lua_gc(state, LUA_GCSETPAUSE, parameter1);
+        if (parameter2 != 0)
+            lua_gc(state, LUA_GCSETSTEPMUL, parameter2);
+        return true;
+#endif
+    }
+
+    void SolState::setAutomaticGarbageCollection(bool enable)
+    {
+        lua_gc(m_solState.lua_state(), enable ? LUA_GCRESTART : LUA_GCSTOP, 0);
+    }
+
+    bool SolState::isAutomaticGarbageCollectionRunning() const
+    {
+        return lua_gc(m_solState.lua_state(), LUA_GCISRUNNING, 0) != 0;
+    }
+
+    void SolState::stepGarbageCollector(int kilobytes)
+    {
+        lua_gc(m_solState.lua_state(), LUA_GCSTEP, kilobytes);
+    }
+
+    size_t SolState::getMemoryUsage() const
+    {
+        lua_State* state = m_solState.lua_state();
+        return static_cast<size_t>(lua_gc(state, LUA_GCCOUNT, 0)) * 1024u + static_cast<size_t>(lua_gc(state, LUA_GCCOUNTB, 0));
+    }
 }
@@ -10,6 +10,7 @@
 
 #include "impl/logic/LuaConfigImpl.h"
 #include "internal/logic/SolWrapper.h"
+#include "ramses/client/logic/ELuaGarbageCollectorMode.h"
 
 #include <string_view>
 #include <utility>
@@ -57,6 +58,18 @@ namespace ramses::internal
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
 
+        // installs hook called after every instructionCount executed Lua instructions, nullptr hook removes it
+        void setInstructionCountHook(lua_Hook hook, int instructionCount);
+
+        // garbage collector control, zero parameter keeps its current value, fails if mode is not supported by Lua version
+        [[nodiscard]] bool setGarbageCollectorMode(ELuaGarbageCollectorMode mode, int parameter1, int parameter2);
+        void setAutomaticGarbageCollection(bool enable);
+        [[nodiscard]] bool isAutomaticGarbageCollectionRunning() const;
+        // does amount of collection work as if given amount of memory was allocated (basic step for zero)
+        void stepGarbageCollector(int kilobytes);
+        // total memory in use by Lua state in bytes
+        [[nodiscard]] size_t getMemoryUsage() const;
+
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
 
     private:
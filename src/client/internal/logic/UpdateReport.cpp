@@ -8,6 +8,7 @@
 
 #include "internal/logic/UpdateReport.h"
 #include <cassert>
+#include <utility>
 
 namespace ramses::internal
 {
@@ -46,6 +47,17 @@ namespace ramses::internal
         m_nodesSkippedExecution.push_back(&node);
     }
 
+    void UpdateReport::luaMemoryChanged(LogicNodeImpl& node, int64_t bytes)
+    {
+        m_luaMemoryChanges.push_back({ &node, bytes });
+    }
+
+    void UpdateReport::luaMemoryMeasured(size_t totalBytes, LuaMemoryUsages moduleBytes)
+    {
+        m_luaMemoryUsage = totalBytes;
+        m_luaModulesMemoryUsage = std::move(moduleBytes);
+    }
+
     void UpdateReport::clear()
     {
         m_nodesExecuted.clear();
@@ -53,6 +65,9 @@ namespace ramses::internal
         for (auto& s : m_sectionExecutionTime)
             s = ReportTimeUnits{ 0u };
         m_activatedLinks = 0u;
+        m_luaMemoryChanges.clear();
+        m_luaMemoryUsage = 0u;
+        m_luaModulesMemoryUsage.clear();
 
         // clear also internals in case update/measure was interrupted due to error
         m_nodeExecutionStarted.reset();
@@ -79,4 +94,19 @@ namespace ramses::internal
     {
         return m_activatedLinks;
     }
+
+    const UpdateReport::LuaMemoryChanges& UpdateReport::getLuaMemoryChanges() const
+    {
+        return m_luaMemoryChanges;
+    }
+
+    size_t UpdateReport::getLuaMemoryUsage() const
+    {
+        return m_luaMemoryUsage;
+    }
+
+    const UpdateReport::LuaMemoryUsages& UpdateReport::getLuaModulesMemoryUsage() const
+    {
+        return m_luaModulesMemoryUsage;
+    }
 }
@@ -12,10 +12,12 @@
 #include <chrono>
 #include <optional>
 #include <array>
+#include <cstdint>
 
 namespace ramses::internal
 {
     class LogicNodeImpl;
+    class LogicObjectImpl;
 
     class UpdateReport
     {
@@ -24,6 +26,8 @@ namespace ramses::internal
         using LogicNodeTimed = std::pair<LogicNodeImpl*, ReportTimeUnits>;
         using LogicNodesTimed = std::vector<LogicNodeTimed>;
         using LogicNodes = std::vector<LogicNodeImpl*>;
+        using LuaMemoryChanges = std::vector<std::pair<LogicNodeImpl*, int64_t>>;
+        using LuaMemoryUsages = std::vector<std::pair<LogicObjectImpl*, size_t>>;
 
         enum class ETimingSection
         {
@@ -37,12 +41,17 @@ namespace ramses::internal
         void nodeExecutionFinished();
         void nodeSkippedExecution(LogicNodeImpl& node);
         void linksActivated(size_t activatedLinks);
+        void luaMemoryChanged(LogicNodeImpl& node, int64_t bytes);
+        void luaMemoryMeasured(size_t totalBytes, LuaMemoryUsages moduleBytes);
         void clear();
 
         [[nodiscard]] const LogicNodesTimed& getNodesExecuted() const;
         [[nodiscard]] const LogicNodes& getNodesSkippedExecution() const;
         [[nodiscard]] ReportTimeUnits getSectionExecutionTime(ETimingSection section) const;
         [[nodiscard]] size_t getLinkActivations() const;
+        [[nodiscard]] const LuaMemoryChanges& getLuaMemoryChanges() const;
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
+        [[nodiscard]] const LuaMemoryUsages& getLuaModulesMemoryUsage() const;
 
     private:
         using Clock = std::chrono::steady_clock;
@@ -52,6 +61,9 @@ namespace ramses::internal
         LogicNodes m_nodesSkippedExecution;
         std::array<ReportTimeUnits, 2u> m_sectionExecutionTime = { ReportTimeUnits{ 0 } };
         size_t m_activatedLinks {0u};
+        LuaMemoryChanges m_luaMemoryChanges;
+        size_t m_luaMemoryUsage {0u};
+        LuaMemoryUsages m_luaModulesMemoryUsage;
 
         std::optional<TimePoint> m_nodeExecutionStarted;
         std::array<std::optional<TimePoint>, 2u> m_sectionStarted;
@@ -37,6 +37,15 @@ namespace ramses::internal
         {
             m_wrappedChildProperties.emplace_back(propertyToWrap.getChild(i)->impl());
         }
+
+        if (propertyToWrap.getType() == EPropertyType::Struct)
+        {
+            m_structFieldIndices.reserve(m_wrappedChildProperties.size());
+            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            {
+                m_structFieldIndices.emplace(m_wrappedChildProperties[i].m_wrappedProperty.get().getName(), i);
+            }
+        }
     }
 
     sol::object WrappedLuaProperty::index(sol::this_state solState, const sol::object& index) const
@@ -152,8 +161,10 @@ namespace ramses::internal
     void WrappedLuaProperty::setChildValue(size_t index, const sol::object& rhs)
     {
         WrappedLuaProperty& childProperty = m_wrappedChildProperties[index];
+        // Query type only once, each query has to push the object to the Lua stack
+        const sol::type rhsType = rhs.get_type();
 
-        if (rhs.get_type() == sol::type::userdata)
+        if (rhsType == sol::type::userdata)
         {
             if (!rhs.is<WrappedLuaProperty>())
             {
@@ -193,19 +204,19 @@ namespace ramses::internal
                 childProperty.setVectorComponents<vec4i>(rhs);
                 break;
             case EPropertyType::String:
-                childProperty.setString(rhs);
+                childProperty.setString(rhs, rhsType);
                 break;
             case EPropertyType::Bool:
-                childProperty.setBool(rhs);
+                childProperty.setBool(rhs, rhsType);
                 break;
             case EPropertyType::Float:
-                childProperty.setFloat(rhs);
+                childProperty.setFloat(rhs, rhsType);
                 break;
             case EPropertyType::Int32:
-                childProperty.setInt32(rhs);
+                childProperty.setInt32(rhs, rhsType);
                 break;
             case EPropertyType::Int64:
-                childProperty.setInt64(rhs);
+                childProperty.setInt64(rhs, rhsType);
                 break;
             default:
                 assert(false && "Missing implementation");
@@ -225,12 +236,10 @@ namespace ramses::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            const auto fieldIt = m_structFieldIndices.find(structFieldName.getData());
+            if (fieldIt != m_structFieldIndices.cend())
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                return fieldIt->second;
             }
 
             throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
@@ -313,7 +322,7 @@ namespace ramses::internal
         static_assert(std::is_same_v<T, vec2f> || std::is_same_v<T, vec3f> || std::is_same_v<T, vec4f> ||
             std::is_same_v<T, vec2i> || std::is_same_v<T, vec3i> || std::is_same_v<T, vec4i>);
 
-        const DataOrError potentialArrayData = LuaTypeConversions::ExtractArray<typename T::value_type, T::length()>(rhs);
+        const DataOrError potentialArrayData = LuaTypeConversions::ExtractArray<typename T::value_type, T::length()>(rhs, m_trustedNumericConversions);
 
         if (potentialArrayData.hasError())
         {
@@ -376,14 +385,20 @@ namespace ramses::internal
             m_wrappedProperty.get().getName());
     }
 
-    void WrappedLuaProperty::setInt32(const sol::object& rhs)
+    void WrappedLuaProperty::setInt32(const sol::object& rhs, sol::type rhsType)
     {
-        if (rhs.get_type() != sol::type::number)
+        if (rhsType != sol::type::number)
+        {
+            badTypeAssignment(rhsType);
+        }
+
+        if (m_trustedNumericConversions)
         {
-            badTypeAssignment(rhs.get_type());
+            m_wrappedProperty.get().setValue(LuaTypeConversions::ConvertNumberTrusted<int32_t>(rhs.as<double>()));
+            return;
         }
 
-        const DataOrError<int32_t> potentiallyInt32 = LuaTypeConversions::ExtractSpecificType<int32_t>(rhs);
+        const DataOrError<int32_t> potentiallyInt32 = LuaTypeConversions::ConvertNumber<int32_t>(rhs.as<double>());
         if (potentiallyInt32.hasError())
         {
             sol_helper::throwSolException("Error during assignment of property '{}'! {}",
@@ -393,14 +408,20 @@ namespace ramses::internal
         m_wrappedProperty.get().setValue(potentiallyInt32.getData());
     }
 
-    void WrappedLuaProperty::setInt64(const sol::object& rhs)
+    void WrappedLuaProperty::setInt64(const sol::object& rhs, sol::type rhsType)
     {
-        if (rhs.get_type() != sol::type::number)
+        if (rhsType != sol::type::number)
         {
-            badTypeAssignment(rhs.get_type());
+            badTypeAssignment(rhsType);
         }
 
-        const DataOrError<int64_t> potentiallyInt64 = LuaTypeConversions::ExtractSpecificType<int64_t>(rhs);
+        if (m_trustedNumericConversions)
+        {
+            m_wrappedProperty.get().setValue(LuaTypeConversions::ConvertNumberTrusted<int64_t>(rhs.as<double>()));
+            return;
+        }
+
+        const DataOrError<int64_t> potentiallyInt64 = LuaTypeConversions::ConvertNumber<int64_t>(rhs.as<double>());
         if (potentiallyInt64.hasError())
         {
             sol_helper::throwSolException("Error during assignment of property '{}'! {}",
@@ -410,14 +431,20 @@ namespace ramses::internal
         m_wrappedProperty.get().setValue(potentiallyInt64.getData());
     }
 
-    void WrappedLuaProperty::setFloat(const sol::object& rhs)
+    void WrappedLuaProperty::setFloat(const sol::object& rhs, sol::type rhsType)
     {
-        if (rhs.get_type() != sol::type::number)
+        if (rhsType != sol::type::number)
         {
-            badTypeAssignment(rhs.get_type());
+            badTypeAssignment(rhsType);
         }
 
-        const DataOrError<float> potentiallyFloat = LuaTypeConversions::ExtractSpecificType<float>(rhs);
+        if (m_trustedNumericConversions)
+        {
+            m_wrappedProperty.get().setValue(LuaTypeConversions::ConvertNumberTrusted<float>(rhs.as<double>()));
+            return;
+        }
+
+        const DataOrError<float> potentiallyFloat = LuaTypeConversions::ConvertNumber<float>(rhs.as<double>());
         if (potentiallyFloat.hasError())
         {
             sol_helper::throwSolException("Error during assignment of property '{}'! {}",
@@ -427,21 +454,21 @@ namespace ramses::internal
         m_wrappedProperty.get().setValue(potentiallyFloat.getData());
     }
 
-    void WrappedLuaProperty::setString(const sol::object& rhs)
+    void WrappedLuaProperty::setString(const sol::object& rhs, sol::type rhsType)
     {
-        if (!rhs.is<std::string>())
+        if (rhsType != sol::type::string)
         {
-            badTypeAssignment(rhs.get_type());
+            badTypeAssignment(rhsType);
         }
 
         m_wrappedProperty.get().setValue(rhs.as<std::string>());
     }
 
-    void WrappedLuaProperty::setBool(const sol::object& rhs)
+    void WrappedLuaProperty::setBool(const sol::object& rhs, sol::type rhsType)
     {
-        if (!rhs.is<bool>())
+        if (rhsType != sol::type::boolean)
         {
-            badTypeAssignment(rhs.get_type());
+            badTypeAssignment(rhsType);
         }
 
         m_wrappedProperty.get().setValue(rhs.as<bool>());
@@ -597,4 +624,11 @@ namespace ramses::internal
     {
         return m_wrappedProperty.get();
     }
+
+    void WrappedLuaProperty::setTrustedNumericConversions(bool enabled)
+    {
+        m_trustedNumericConversions = enabled;
+        for (auto& child : m_wrappedChildProperties)
+            child.setTrustedNumericConversions(enabled);
+    }
 }
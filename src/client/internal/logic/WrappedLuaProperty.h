@@ -13,6 +13,9 @@
 #include "impl/logic/PropertyImpl.h"
 #include "internal/logic/SolState.h"
 
+#include <string_view>
+#include <unordered_map>
+
 namespace ramses
 {
     class Property;
@@ -46,12 +49,18 @@ namespace ramses::internal
 
         [[nodiscard]] const PropertyImpl& getWrappedProperty() const;
 
+        // Values assigned from script skip range checks of numeric conversions (applies to all children)
+        void setTrustedNumericConversions(bool enabled);
+
         // Register symbols for type extraction to sol state globally
         static void RegisterTypes(sol::state& state);
 
     private:
         std::reference_wrapper<PropertyImpl> m_wrappedProperty;
         std::vector<WrappedLuaProperty> m_wrappedChildProperties;
+        // Struct field name -> child index, avoids comparing all field names on each 'IN.field' access
+        std::unordered_map<std::string_view, size_t> m_structFieldIndices;
+        bool m_trustedNumericConversions = false;
 
         template <typename T>
         [[nodiscard]] sol::object extractVectorComponent(sol::this_state solState, const sol::object& index) const;
@@ -63,11 +72,11 @@ namespace ramses::internal
 
         void setStruct(const sol::object& rhs);
         void setArray(const sol::object& rhs);
-        void setInt32(const sol::object& rhs);
-        void setInt64(const sol::object& rhs);
-        void setFloat(const sol::object& rhs);
-        void setString(const sol::object& rhs);
-        void setBool(const sol::object& rhs);
+        void setInt32(const sol::object& rhs, sol::type rhsType);
+        void setInt64(const sol::object& rhs, sol::type rhsType);
+        void setFloat(const sol::object& rhs, sol::type rhsType);
+        void setString(const sol::object& rhs, sol::type rhsType);
+        void setBool(const sol::object& rhs, sol::type rhsType);
 
         [[nodiscard]] std::string getChildDebugName(size_t childIndex) const;
         void verifyTypeCompatibility(const WrappedLuaProperty& other) const;
@@ -18,6 +18,7 @@ static_assert(FLATBUFFERS_VERSION_MAJOR == 23 &&
 #include "AppearanceBindingGen.h"
 #include "CameraBindingGen.h"
 #include "DataArrayGen.h"
+#include "FrustumCullingNodeGen.h"
 #include "LinkGen.h"
 #include "LuaInterfaceGen.h"
 #include "LuaModuleGen.h"
@@ -59,7 +60,8 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_RENDERGROUPBINDINGS = 28,
     VT_SKINBINDINGS = 30,
     VT_MESHNODEBINDINGS = 32,
-    VT_RENDERBUFFERBINDINGS = 34
+    VT_RENDERBUFFERBINDINGS = 34,
+    VT_FRUSTUMCULLINGNODES = 36
   };
   const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::LuaModule>> *luaModules() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::LuaModule>> *>(VT_LUAMODULES);
@@ -109,6 +111,9 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>> *renderBufferBindings() const {
     return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>> *>(VT_RENDERBUFFERBINDINGS);
   }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>> *frustumCullingNodes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>> *>(VT_FRUSTUMCULLINGNODES);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_LUAMODULES) &&
@@ -159,6 +164,9 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_RENDERBUFFERBINDINGS) &&
            verifier.VerifyVector(renderBufferBindings()) &&
            verifier.VerifyVectorOfTables(renderBufferBindings()) &&
+           VerifyOffset(verifier, VT_FRUSTUMCULLINGNODES) &&
+           verifier.VerifyVector(frustumCullingNodes()) &&
+           verifier.VerifyVectorOfTables(frustumCullingNodes()) &&
            verifier.EndTable();
   }
 };
@@ -215,6 +223,9 @@ struct ApiObjectsBuilder {
   void add_renderBufferBindings(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>>> renderBufferBindings) {
     fbb_.AddOffset(ApiObjects::VT_RENDERBUFFERBINDINGS, renderBufferBindings);
   }
+  void add_frustumCullingNodes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>>> frustumCullingNodes) {
+    fbb_.AddOffset(ApiObjects::VT_FRUSTUMCULLINGNODES, frustumCullingNodes);
+  }
   explicit ApiObjectsBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -243,8 +254,10 @@ inline ::flatbuffers::Offset<ApiObjects> CreateApiObjects(
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderGroupBinding>>> renderGroupBindings = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::SkinBinding>>> skinBindings = 0,
     ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::MeshNodeBinding>>> meshNodeBindings = 0,
-    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>>> renderBufferBindings = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>>> renderBufferBindings = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>>> frustumCullingNodes = 0) {
   ApiObjectsBuilder builder_(_fbb);
+  builder_.add_frustumCullingNodes(frustumCullingNodes);
   builder_.add_renderBufferBindings(renderBufferBindings);
   builder_.add_meshNodeBindings(meshNodeBindings);
   builder_.add_skinBindings(skinBindings);
@@ -286,7 +299,8 @@ inline ::flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
     const std::vector<::flatbuffers::Offset<rlogic_serialization::RenderGroupBinding>> *renderGroupBindings = nullptr,
     const std::vector<::flatbuffers::Offset<rlogic_serialization::SkinBinding>> *skinBindings = nullptr,
     const std::vector<::flatbuffers::Offset<rlogic_serialization::MeshNodeBinding>> *meshNodeBindings = nullptr,
-    const std::vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>> *renderBufferBindings = nullptr) {
+    const std::vector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>> *renderBufferBindings = nullptr,
+    const std::vector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>> *frustumCullingNodes = nullptr) {
   auto luaModules__ = luaModules ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::LuaModule>>(*luaModules) : 0;
   auto luaScripts__ = luaScripts ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::LuaScript>>(*luaScripts) : 0;
   auto luaInterfaces__ = luaInterfaces ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::LuaInterface>>(*luaInterfaces) : 0;
@@ -303,6 +317,7 @@ inline ::flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
   auto skinBindings__ = skinBindings ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::SkinBinding>>(*skinBindings) : 0;
   auto meshNodeBindings__ = meshNodeBindings ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::MeshNodeBinding>>(*meshNodeBindings) : 0;
   auto renderBufferBindings__ = renderBufferBindings ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::RenderBufferBinding>>(*renderBufferBindings) : 0;
+  auto frustumCullingNodes__ = frustumCullingNodes ? _fbb.CreateVector<::flatbuffers::Offset<rlogic_serialization::FrustumCullingNode>>(*frustumCullingNodes) : 0;
   return rlogic_serialization::CreateApiObjects(
       _fbb,
       luaModules__,
@@ -320,7 +335,8 @@ inline ::flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
       renderGroupBindings__,
       skinBindings__,
       meshNodeBindings__,
-      renderBufferBindings__);
+      renderBufferBindings__,
+      frustumCullingNodes__);
 }
 
 inline const ::flatbuffers::TypeTable *ApiObjectsTypeTable() {
@@ -340,7 +356,8 @@ inline const ::flatbuffers::TypeTable *ApiObjectsTypeTable() {
     { ::flatbuffers::ET_SEQUENCE, 1, 12 },
     { ::flatbuffers::ET_SEQUENCE, 1, 13 },
     { ::flatbuffers::ET_SEQUENCE, 1, 14 },
-    { ::flatbuffers::ET_SEQUENCE, 1, 15 }
+    { ::flatbuffers::ET_SEQUENCE, 1, 15 },
+    { ::flatbuffers::ET_SEQUENCE, 1, 16 }
   };
   static const ::flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::LuaModuleTypeTable,
@@ -358,7 +375,8 @@ inline const ::flatbuffers::TypeTable *ApiObjectsTypeTable() {
     rlogic_serialization::RenderGroupBindingTypeTable,
     rlogic_serialization::SkinBindingTypeTable,
     rlogic_serialization::MeshNodeBindingTypeTable,
-    rlogic_serialization::RenderBufferBindingTypeTable
+    rlogic_serialization::RenderBufferBindingTypeTable,
+    rlogic_serialization::FrustumCullingNodeTypeTable
   };
   static const char * const names[] = {
     "luaModules",
@@ -376,10 +394,11 @@ inline const ::flatbuffers::TypeTable *ApiObjectsTypeTable() {
     "renderGroupBindings",
     "skinBindings",
     "meshNodeBindings",
-    "renderBufferBindings"
+    "renderBufferBindings",
+    "frustumCullingNodes"
   };
   static const ::flatbuffers::TypeTable tt = {
-    ::flatbuffers::ST_TABLE, 16, type_codes, type_refs, nullptr, nullptr, names
+    ::flatbuffers::ST_TABLE, 17, type_codes, type_refs, nullptr, nullptr, names
   };
   return &tt;
 }
@@ -0,0 +1,164 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_FRUSTUMCULLINGNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_FRUSTUMCULLINGNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 23 &&
+              FLATBUFFERS_VERSION_MINOR == 5 &&
+              FLATBUFFERS_VERSION_REVISION == 9,
+             "Non-compatible flatbuffers version included");
+
+#include "LogicObjectGen.h"
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct FrustumCullingNode;
+struct FrustumCullingNodeBuilder;
+
+inline const ::flatbuffers::TypeTable *FrustumCullingNodeTypeTable();
+
+struct FrustumCullingNode FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef FrustumCullingNodeBuilder Builder;
+  struct Traits;
+  static const ::flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return FrustumCullingNodeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_BASE = 4,
+    VT_CAMERABINDINGID = 6,
+    VT_MESHNODEBINDINGIDS = 8,
+    VT_ROOTINPUT = 10,
+    VT_ROOTOUTPUT = 12
+  };
+  const rlogic_serialization::LogicObject *base() const {
+    return GetPointer<const rlogic_serialization::LogicObject *>(VT_BASE);
+  }
+  uint64_t cameraBindingId() const {
+    return GetField<uint64_t>(VT_CAMERABINDINGID, 0);
+  }
+  const ::flatbuffers::Vector<uint64_t> *meshNodeBindingIds() const {
+    return GetPointer<const ::flatbuffers::Vector<uint64_t> *>(VT_MESHNODEBINDINGIDS);
+  }
+  const rlogic_serialization::Property *rootInput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::Property *rootOutput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BASE) &&
+           verifier.VerifyTable(base()) &&
+           VerifyField<uint64_t>(verifier, VT_CAMERABINDINGID, 8) &&
+           VerifyOffset(verifier, VT_MESHNODEBINDINGIDS) &&
+           verifier.VerifyVector(meshNodeBindingIds()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           verifier.EndTable();
+  }
+};
+
+struct FrustumCullingNodeBuilder {
+  typedef FrustumCullingNode Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_base(::flatbuffers::Offset<rlogic_serialization::LogicObject> base) {
+    fbb_.AddOffset(FrustumCullingNode::VT_BASE, base);
+  }
+  void add_cameraBindingId(uint64_t cameraBindingId) {
+    fbb_.AddElement<uint64_t>(FrustumCullingNode::VT_CAMERABINDINGID, cameraBindingId, 0);
+  }
+  void add_meshNodeBindingIds(::flatbuffers::Offset<::flatbuffers::Vector<uint64_t>> meshNodeBindingIds) {
+    fbb_.AddOffset(FrustumCullingNode::VT_MESHNODEBINDINGIDS, meshNodeBindingIds);
+  }
+  void add_rootInput(::flatbuffers::Offset<rlogic_serialization::Property> rootInput) {
+    fbb_.AddOffset(FrustumCullingNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(::flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
+    fbb_.AddOffset(FrustumCullingNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  explicit FrustumCullingNodeBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<FrustumCullingNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<FrustumCullingNode>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<FrustumCullingNode> CreateFrustumCullingNode(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<rlogic_serialization::LogicObject> base = 0,
+    uint64_t cameraBindingId = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint64_t>> meshNodeBindingIds = 0,
+    ::flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    ::flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+  FrustumCullingNodeBuilder builder_(_fbb);
+  builder_.add_cameraBindingId(cameraBindingId);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_meshNodeBindingIds(meshNodeBindingIds);
+  builder_.add_base(base);
+  return builder_.Finish();
+}
+
+struct FrustumCullingNode::Traits {
+  using type = FrustumCullingNode;
+  static auto constexpr Create = CreateFrustumCullingNode;
+};
+
+inline ::flatbuffers::Offset<FrustumCullingNode> CreateFrustumCullingNodeDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<rlogic_serialization::LogicObject> base = 0,
+    uint64_t cameraBindingId = 0,
+    const std::vector<uint64_t> *meshNodeBindingIds = nullptr,
+    ::flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    ::flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+  auto meshNodeBindingIds__ = meshNodeBindingIds ? _fbb.CreateVector<uint64_t>(*meshNodeBindingIds) : 0;
+  return rlogic_serialization::CreateFrustumCullingNode(
+      _fbb,
+      base,
+      cameraBindingId,
+      meshNodeBindingIds__,
+      rootInput,
+      rootOutput);
+}
+
+inline const ::flatbuffers::TypeTable *FrustumCullingNodeTypeTable() {
+  static const ::flatbuffers::TypeCode type_codes[] = {
+    { ::flatbuffers::ET_SEQUENCE, 0, 0 },
+    { ::flatbuffers::ET_ULONG, 0, -1 },
+    { ::flatbuffers::ET_ULONG, 1, -1 },
+    { ::flatbuffers::ET_SEQUENCE, 0, 1 },
+    { ::flatbuffers::ET_SEQUENCE, 0, 1 }
+  };
+  static const ::flatbuffers::TypeFunction type_refs[] = {
+    rlogic_serialization::LogicObjectTypeTable,
+    rlogic_serialization::PropertyTypeTable
+  };
+  static const char * const names[] = {
+    "base",
+    "cameraBindingId",
+    "meshNodeBindingIds",
+    "rootInput",
+    "rootOutput"
+  };
+  static const ::flatbuffers::TypeTable tt = {
+    ::flatbuffers::ST_TABLE, 5, type_codes, type_refs, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_FRUSTUMCULLINGNODE_RLOGIC_SERIALIZATION_H_
@@ -111,6 +111,11 @@ namespace ramses
         m_impl->setLoggingInstanceName(instanceName);
     }
 
+    bool RamsesFrameworkConfig::setAsynchronousLogging(bool enable, uint32_t queueCapacity, bool dropOnOverflow)
+    {
+        return m_impl->setAsynchronousLogging(enable, queueCapacity, dropOnOverflow);
+    }
+
     bool RamsesFrameworkConfig::setParticipantGuid(uint64_t guid)
     {
         return m_impl->setParticipantGuid(guid);
@@ -153,6 +158,31 @@ namespace ramses
         return true;
     }
 
+    void RamsesFrameworkConfig::setSceneUpdateCompressionForTCPCommunication(bool enabled)
+    {
+        m_impl->m_tcpConfig.setSceneUpdateCompression(enabled);
+    }
+
+    void RamsesFrameworkConfig::setSendQueueLimitForTCPCommunication(size_t limitInBytes)
+    {
+        m_impl->m_tcpConfig.setSendQueueLimit(limitInBytes);
+    }
+
+    bool RamsesFrameworkConfig::setWorkerThreadCount(uint32_t threadCount)
+    {
+        return m_impl->setWorkerThreadCount(threadCount);
+    }
+
+    void RamsesFrameworkConfig::setWorkerThreadCpuAffinity(const std::vector<uint32_t>& cpuIds)
+    {
+        m_impl->setWorkerThreadCpuAffinity(cpuIds);
+    }
+
+    void RamsesFrameworkConfig::setEffectCompilationCacheFile(std::string_view filePath)
+    {
+        m_impl->setEffectCompilationCacheFile(filePath);
+    }
+
     internal::RamsesFrameworkConfigImpl& RamsesFrameworkConfig::impl()
     {
         return *m_impl;
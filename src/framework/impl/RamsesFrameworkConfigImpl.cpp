@@ -173,6 +173,19 @@ namespace ramses::internal
         return m_loggingInstanceName;
     }
 
+    bool RamsesFrameworkConfigImpl::setAsynchronousLogging(bool enable, uint32_t queueCapacity, bool dropOnOverflow)
+    {
+        if (queueCapacity == 0u)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesFrameworkConfig::setAsynchronousLogging: Failed to set invalid queue capacity 0.");
+            return false;
+        }
+        loggerConfig.asyncLogging = enable;
+        loggerConfig.asyncLogQueueCapacity = queueCapacity;
+        loggerConfig.asyncLogOverflowPolicy = dropOnOverflow ? ELogOverflowPolicy::Drop : ELogOverflowPolicy::Block;
+        return true;
+    }
+
     bool RamsesFrameworkConfigImpl::setParticipantGuid(uint64_t guid)
     {
         m_userProvidedGuid = Guid(guid);
@@ -209,6 +222,42 @@ namespace ramses::internal
         return m_userProvidedGuid;
     }
 
+    bool RamsesFrameworkConfigImpl::setWorkerThreadCount(uint32_t threadCount)
+    {
+        if (threadCount == 0u || threadCount > 256u)
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "RamsesFrameworkConfig::setWorkerThreadCount: Failed to set invalid thread count {}, must be between 1 and 256.", threadCount);
+            return false;
+        }
+        m_workerThreadCount = static_cast<uint16_t>(threadCount);
+        return true;
+    }
+
+    uint16_t RamsesFrameworkConfigImpl::getWorkerThreadCount() const
+    {
+        return m_workerThreadCount;
+    }
+
+    void RamsesFrameworkConfigImpl::setWorkerThreadCpuAffinity(const std::vector<uint32_t>& cpuIds)
+    {
+        m_workerThreadCpuAffinity = cpuIds;
+    }
+
+    const std::vector<uint32_t>& RamsesFrameworkConfigImpl::getWorkerThreadCpuAffinity() const
+    {
+        return m_workerThreadCpuAffinity;
+    }
+
+    void RamsesFrameworkConfigImpl::setEffectCompilationCacheFile(std::string_view filePath)
+    {
+        m_effectCompilationCacheFile = filePath;
+    }
+
+    const std::string& RamsesFrameworkConfigImpl::getEffectCompilationCacheFile() const
+    {
+        return m_effectCompilationCacheFile;
+    }
+
     void RamsesFrameworkConfigImpl::setFeatureLevelNoCheck(EFeatureLevel featureLevel)
     {
         m_featureLevel = featureLevel;
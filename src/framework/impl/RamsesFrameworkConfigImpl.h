@@ -17,6 +17,7 @@
 #include "internal/PlatformAbstraction/Collections/Guid.h"
 
 #include <string>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -57,6 +58,8 @@ namespace ramses::internal
         void setLoggingInstanceName(std::string_view instanceName);
         [[nodiscard]] const std::string& getLoggingInstanceName() const;
 
+        [[nodiscard]] bool setAsynchronousLogging(bool enable, uint32_t queueCapacity, bool dropOnOverflow);
+
         [[nodiscard]] bool setParticipantGuid(uint64_t guid);
         [[nodiscard]] Guid getUserProvidedGuid() const;
 
@@ -65,6 +68,13 @@ namespace ramses::internal
 
         [[nodiscard]] bool setConnectionSystem(EConnectionSystem connectionSystem);
 
+        [[nodiscard]] bool setWorkerThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint16_t getWorkerThreadCount() const;
+        void setWorkerThreadCpuAffinity(const std::vector<uint32_t>& cpuIds);
+        [[nodiscard]] const std::vector<uint32_t>& getWorkerThreadCpuAffinity() const;
+        void setEffectCompilationCacheFile(std::string_view filePath);
+        [[nodiscard]] const std::string& getEffectCompilationCacheFile() const;
+
         TCPConfig        m_tcpConfig;
         ERamsesShellType m_shellType;
         ThreadWatchdogConfig m_watchdogConfig;
@@ -83,5 +93,8 @@ namespace ramses::internal
         bool m_enableDltApplicationRegistration = true;
         Guid m_userProvidedGuid;
         std::string m_loggingInstanceName = "R";
+        uint16_t m_workerThreadCount = 3u;
+        std::vector<uint32_t> m_workerThreadCpuAffinity;
+        std::string m_effectCompilationCacheFile;
     };
 }
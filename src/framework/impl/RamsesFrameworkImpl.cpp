@@ -35,8 +35,9 @@ namespace ramses::internal
         , m_periodicLogger(m_frameworkLock, m_statisticCollection)
         , m_connected(false)
         , m_threadWatchdogConfig(config.m_watchdogConfig)
+        , m_effectCompilationCacheFile(config.getEffectCompilationCacheFile())
         // NOTE: ThreadedTaskExecutor must always be constructed after CommunicationSystem
-        , m_threadedTaskExecutor(3, config.m_watchdogConfig)
+        , m_threadedTaskExecutor(config.getWorkerThreadCount(), config.m_watchdogConfig, config.getWorkerThreadCpuAffinity())
         , m_resourceComponent(m_statisticCollection, m_frameworkLock, config.getFeatureLevel())
         , m_scenegraphComponent(
             m_participantAddress.getParticipantId(),
@@ -223,6 +224,11 @@ namespace ramses::internal
         return m_threadWatchdogConfig;
     }
 
+    const std::string& RamsesFrameworkImpl::getEffectCompilationCacheFile() const
+    {
+        return m_effectCompilationCacheFile;
+    }
+
     ITaskQueue& RamsesFrameworkImpl::getTaskQueue()
     {
         return m_threadedTaskExecutor;
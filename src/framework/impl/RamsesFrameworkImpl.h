@@ -25,6 +25,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <optional>
 
@@ -73,6 +74,7 @@ namespace ramses::internal
         Ramsh& getRamsh();
         PlatformLock& getFrameworkLock();
         const ThreadWatchdogConfig& getThreadWatchdogConfig() const;
+        const std::string& getEffectCompilationCacheFile() const;
         ITaskQueue& getTaskQueue();
         PeriodicLogger& getPeriodicLogger();
         StatisticCollectionFramework& getStatisticCollection();
@@ -101,6 +103,7 @@ namespace ramses::internal
         PeriodicLogger m_periodicLogger;
         bool m_connected;
         const ThreadWatchdogConfig m_threadWatchdogConfig;
+        const std::string m_effectCompilationCacheFile;
         ThreadedTaskExecutor m_threadedTaskExecutor;
         ResourceComponent m_resourceComponent;
         SceneGraphComponent m_scenegraphComponent;
@@ -27,6 +27,7 @@
 #include "ramses/client/logic/AnimationNode.h"
 #include "ramses/client/logic/TimerNode.h"
 #include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/FrustumCullingNode.h"
 #include "ramses/client/logic/RenderBufferBinding.h"
 
 #include "ramses/client/Effect.h"
@@ -146,6 +147,7 @@ namespace ramses
     template RAMSES_API const AnimationNode*       RamsesObject::internalCast() const;
     template RAMSES_API const TimerNode*           RamsesObject::internalCast() const;
     template RAMSES_API const AnchorPoint*         RamsesObject::internalCast() const;
+    template RAMSES_API const FrustumCullingNode*  RamsesObject::internalCast() const;
     template RAMSES_API const RenderBufferBinding* RamsesObject::internalCast() const;
 
     template RAMSES_API LogicObject*         RamsesObject::internalCast();
@@ -165,6 +167,7 @@ namespace ramses
     template RAMSES_API AnimationNode*       RamsesObject::internalCast();
     template RAMSES_API TimerNode*           RamsesObject::internalCast();
     template RAMSES_API AnchorPoint*         RamsesObject::internalCast();
+    template RAMSES_API FrustumCullingNode*  RamsesObject::internalCast();
     template RAMSES_API RenderBufferBinding* RamsesObject::internalCast();
 
     template RAMSES_API const ClientObject* RamsesObject::internalCast() const;
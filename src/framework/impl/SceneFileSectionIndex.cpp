@@ -0,0 +1,123 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/SceneFileSectionIndex.h"
+#include "internal/PlatformAbstraction/Collections/IOutputStream.h"
+#include "internal/PlatformAbstraction/Collections/IInputStream.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <algorithm>
+
+namespace ramses::internal
+{
+    static const uint32_t gSectionIndexMarker = 0x58495352;  // {'R', 'S', 'I', 'X'}
+    static constexpr size_t gSectionEntrySize = 2u * sizeof(uint32_t) + 2u * sizeof(uint64_t);
+
+    void SceneFileSectionIndex::addSection(ESceneFileSection type, uint64_t offset, uint64_t size, ERamsesObjectType objectType)
+    {
+        m_sections.push_back({ type, objectType, offset, size });
+    }
+
+    const std::vector<SceneFileSection>& SceneFileSectionIndex::getSections() const
+    {
+        return m_sections;
+    }
+
+    const SceneFileSection* SceneFileSectionIndex::findSection(ESceneFileSection type, ERamsesObjectType objectType) const
+    {
+        const auto it = std::find_if(m_sections.cbegin(), m_sections.cend(), [&](const auto& section) {
+            return section.type == type && section.objectType == objectType;
+        });
+        return it != m_sections.cend() ? &*it : nullptr;
+    }
+
+    void SceneFileSectionIndex::writeToStream(IOutputStream& outStream) const
+    {
+        size_t indexOffset = 0u;
+        outStream.getPos(indexOffset);
+
+        outStream << CurrentVersion;
+        outStream << static_cast<uint32_t>(m_sections.size());
+        for (const auto& section : m_sections)
+        {
+            outStream << static_cast<uint32_t>(section.type);
+            outStream << static_cast<uint32_t>(section.objectType);
+            outStream << section.offset;
+            outStream << section.size;
+        }
+
+        outStream << static_cast<uint64_t>(indexOffset);
+        outStream << gSectionIndexMarker;
+    }
+
+    bool SceneFileSectionIndex::ReadFromStream(IInputStream& inStream, size_t streamSize, SceneFileSectionIndex& index)
+    {
+        index.m_sections.clear();
+        if (streamSize < TrailerSize)
+            return false;
+
+        size_t originalPosition = 0u;
+        if (inStream.getPos(originalPosition) != EStatus::Ok)
+            return false;
+
+        const size_t trailerOffset = streamSize - TrailerSize;
+        uint64_t indexOffset = 0u;
+        uint32_t marker = 0u;
+        inStream.seek(static_cast<int64_t>(trailerOffset), IInputStream::Seek::FromBeginning);
+        inStream >> indexOffset;
+        inStream >> marker;
+
+        bool success = inStream.getState() == EStatus::Ok && marker == gSectionIndexMarker && indexOffset < trailerOffset;
+        if (success)
+        {
+            uint32_t version = 0u;
+            uint32_t sectionCount = 0u;
+            inStream.seek(static_cast<int64_t>(indexOffset), IInputStream::Seek::FromBeginning);
+            inStream >> version;
+            inStream >> sectionCount;
+
+            if (version != CurrentVersion)
+            {
+                LOG_WARN(CONTEXT_CLIENT, "SceneFileSectionIndex::ReadFromStream: ignoring section index of unsupported version {}", version);
+                success = false;
+            }
+            else if (sectionCount * gSectionEntrySize > trailerOffset - indexOffset)
+            {
+                LOG_ERROR(CONTEXT_CLIENT, "SceneFileSectionIndex::ReadFromStream: section index is corrupt, {} sections do not fit into index", sectionCount);
+                success = false;
+            }
+
+            for (uint32_t i = 0u; success && i < sectionCount; ++i)
+            {
+                uint32_t type = 0u;
+                uint32_t objectType = 0u;
+                SceneFileSection section;
+                inStream >> type;
+                inStream >> objectType;
+                inStream >> section.offset;
+                inStream >> section.size;
+                section.type = static_cast<ESceneFileSection>(type);
+                section.objectType = static_cast<ERamsesObjectType>(objectType);
+
+                if (section.offset > indexOffset || section.size > indexOffset - section.offset)
+                {
+                    LOG_ERROR(CONTEXT_CLIENT, "SceneFileSectionIndex::ReadFromStream: section index is corrupt, section {} exceeds scene data", i);
+                    success = false;
+                }
+                index.m_sections.push_back(section);
+            }
+            success = success && inStream.getState() == EStatus::Ok;
+        }
+
+        if (!success)
+            index.m_sections.clear();
+
+        inStream.seek(static_cast<int64_t>(originalPosition), IInputStream::Seek::FromBeginning);
+        return success;
+    }
+}
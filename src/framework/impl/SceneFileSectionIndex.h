@@ -0,0 +1,70 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/RamsesObjectTypes.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IOutputStream;
+    class IInputStream;
+
+    enum class ESceneFileSection : uint32_t
+    {
+        SceneMetadata = 0,
+        LowLevelScene,
+        SceneObjects,       // all high level scene objects
+        SceneObjectsOfType, // high level objects of a single type (incl. logic engines), objectType specifies type
+        LowLevelResources,  // resource table of contents followed by resources
+    };
+
+    struct SceneFileSection
+    {
+        ESceneFileSection type = ESceneFileSection::SceneMetadata;
+        ERamsesObjectType objectType = ERamsesObjectType::Invalid;
+        uint64_t offset = 0u;
+        uint64_t size = 0u;
+
+        bool operator==(const SceneFileSection& other) const
+        {
+            return type == other.type && objectType == other.objectType && offset == other.offset && size == other.size;
+        }
+    };
+
+    /**
+     * Index of the sections of a scene file with their offset and size, offsets are relative to the start of the file.
+     *
+     * The index is appended after the last low level resource, followed by a fixed size trailer with the index offset.
+     * Loaders not knowing the index never read past the resources, so files stay loadable by them and files
+     * without index are recognized by a missing trailer marker.
+     */
+    class SceneFileSectionIndex
+    {
+    public:
+        static constexpr uint32_t CurrentVersion = 1u;
+        static constexpr size_t TrailerSize = sizeof(uint64_t) + sizeof(uint32_t);
+
+        void addSection(ESceneFileSection type, uint64_t offset, uint64_t size, ERamsesObjectType objectType = ERamsesObjectType::Invalid);
+
+        [[nodiscard]] const std::vector<SceneFileSection>& getSections() const;
+        [[nodiscard]] const SceneFileSection* findSection(ESceneFileSection type, ERamsesObjectType objectType = ERamsesObjectType::Invalid) const;
+
+        // writes index and trailer at current position of stream, offsets in index must be relative to start of stream
+        void writeToStream(IOutputStream& outStream) const;
+
+        // streamSize is total size of the scene file, returns false if file has no (valid) index
+        [[nodiscard]] static bool ReadFromStream(IInputStream& inStream, size_t streamSize, SceneFileSectionIndex& index);
+
+    private:
+        std::vector<SceneFileSection> m_sections;
+    };
+}
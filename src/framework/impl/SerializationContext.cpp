@@ -67,6 +67,16 @@ namespace ramses::internal
         return m_serializeSceneObjectIds;
     }
 
+    void SerializationContext::setSectionIndex(SceneFileSectionIndex* sectionIndex)
+    {
+        m_sectionIndex = sectionIndex;
+    }
+
+    SceneFileSectionIndex* SerializationContext::getSectionIndex() const
+    {
+        return m_sectionIndex;
+    }
+
     void DeserializationContext::registerObjectImpl(RamsesObjectImpl* obj, ObjectIDType id)
     {
         if (m_objectImpls.size() <= id)
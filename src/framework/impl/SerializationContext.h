@@ -22,6 +22,7 @@ namespace ramses::internal
     class NodeImpl;
     class SaveFileConfigImpl;
     class SceneConfigImpl;
+    class SceneFileSectionIndex;
 
     using ObjectIDType = uint32_t;
 
@@ -82,11 +83,16 @@ namespace ramses::internal
 
         [[nodiscard]] const SaveFileConfigImpl& getSaveConfig() const;
 
+        // if set, serialized object type groups are recorded to index as they are written
+        void setSectionIndex(SceneFileSectionIndex* sectionIndex);
+        [[nodiscard]] SceneFileSectionIndex* getSectionIndex() const;
+
     private:
         bool         m_serializeSceneObjectIds = true;
         IdMap        m_ids;
         ObjectIDType m_lastID;
         const SaveFileConfigImpl& m_saveConfig;
+        SceneFileSectionIndex* m_sectionIndex = nullptr;
     };
 
     template <typename OBJECT_TYPE>
@@ -84,4 +84,24 @@ namespace ramses::internal
     {
         m_aliveTimeout = timeout;
     }
+
+    bool TCPConfig::getSceneUpdateCompression() const
+    {
+        return m_sceneUpdateCompression;
+    }
+
+    void TCPConfig::setSceneUpdateCompression(bool enabled)
+    {
+        m_sceneUpdateCompression = enabled;
+    }
+
+    size_t TCPConfig::getSendQueueLimit() const
+    {
+        return m_sendQueueLimit;
+    }
+
+    void TCPConfig::setSendQueueLimit(size_t limitInBytes)
+    {
+        m_sendQueueLimit = limitInBytes;
+    }
 }
@@ -35,6 +35,12 @@ namespace ramses::internal
         void setAliveInterval(std::chrono::milliseconds interval);
         void setAliveTimeout(std::chrono::milliseconds timeout);
 
+        [[nodiscard]] bool getSceneUpdateCompression() const;
+        void setSceneUpdateCompression(bool enabled);
+
+        [[nodiscard]] size_t getSendQueueLimit() const;
+        void setSendQueueLimit(size_t limitInBytes);
+
     private:
         static const uint16_t DefaultPort;
         static const uint16_t DefaultDaemonPort;
@@ -46,5 +52,7 @@ namespace ramses::internal
         std::string m_daemonIP;
         std::chrono::milliseconds m_aliveInterval;
         std::chrono::milliseconds m_aliveTimeout;
+        bool m_sceneUpdateCompression{false};
+        size_t m_sendQueueLimit{0u};
     };
 }
@@ -42,10 +42,14 @@ namespace ramses::internal
         virtual bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) = 0;
 
         virtual bool sendInitializeScene(const Guid& to, const SceneId& sceneId) = 0;
-        virtual bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
+        // scene update is serialized once and shared by all recipients
+        virtual bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) = 0;
 
         virtual bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) = 0;
 
+        // messages of high priority scene are sent before queued messages of other scenes
+        virtual void setHighPriorityScene(const SceneId& sceneId, bool highPriority) = 0;
+
         // set service handlers
         virtual void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) = 0;
         virtual void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) = 0;
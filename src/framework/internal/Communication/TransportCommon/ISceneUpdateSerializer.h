@@ -18,6 +18,7 @@ namespace ramses::internal
     {
     public:
         virtual ~ISceneUpdateSerializer() = default;
-        virtual bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const = 0;
+        // compressSceneActions: receiver supports compressed scene actions, used if scene actions are large enough
+        virtual bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, bool compressSceneActions) const = 0;
     };
 }
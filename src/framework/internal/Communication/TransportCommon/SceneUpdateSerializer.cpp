@@ -18,9 +18,9 @@ namespace ramses::internal
     {
     }
 
-    bool SceneUpdateSerializer::writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const
+    bool SceneUpdateSerializer::writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, bool compressSceneActions) const
     {
-        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics, m_featureLevel);
+        SingleSceneUpdateWriter writer(m_update, packetMem, writeDoneFunc, m_sceneStatistics, m_featureLevel, compressSceneActions);
         return writer.write();
     }
 
@@ -20,7 +20,7 @@ namespace ramses::internal
     {
     public:
         SceneUpdateSerializer(const SceneUpdate& update, StatisticCollectionScene& sceneStatistics, EFeatureLevel featureLevel);
-        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc) const override;
+        bool writeToPackets(absl::Span<std::byte> packetMem, const std::function<bool(size_t)>& writeDoneFunc, bool compressSceneActions) const override;
 
         [[nodiscard]] const SceneUpdate& getUpdate() const;
         [[nodiscard]] const StatisticCollectionScene& getStatisticCollection() const;
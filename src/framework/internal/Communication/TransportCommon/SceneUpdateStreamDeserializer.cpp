@@ -9,6 +9,7 @@
 #include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
 #include "internal/Communication/TransportCommon/SingleSceneUpdateWriter.h"
 #include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
 
@@ -67,18 +68,34 @@ namespace ramses::internal
             if (m_currentBlockSize != 0)
             {
                 continueReadingBlock(is, data.size());
+
+                // check if read full block
+                if (m_currentBlock.size() == m_currentBlockSize)
+                {
+                    if (!finalizeBlock(m_currentBlock))
+                        return fail();
+                }
             }
             else
             {
                 if (!startReadingNewBlock(is, data.size()))
                     return fail();
-            }
 
-            // check if read full block
-            if (m_currentBlock.size() == m_currentBlockSize)
-            {
-                if (!finalizeBlock())
-                    return fail();
+                const size_t remainingDataInPacket = data.size() - is.getCurrentReadBytes();
+                if (m_currentBlockSize <= remainingDataInPacket)
+                {
+                    // block not fragmented, handle directly from packet without copying it
+                    const absl::Span<const std::byte> block(is.readPosition(), m_currentBlockSize);
+                    is.skip(static_cast<int64_t>(m_currentBlockSize));
+                    if (!finalizeBlock(block))
+                        return fail();
+                }
+                else
+                {
+                    // block continues in next packets, assemble in buffer allocated once for whole block
+                    m_currentBlock.reserve(std::min(m_currentBlockSize, MaxBlockPreallocationSize));
+                    continueReadingBlock(is, data.size());
+                }
             }
         }
 
@@ -130,23 +147,28 @@ namespace ramses::internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::finalizeBlock()
+    bool SceneUpdateStreamDeserializer::finalizeBlock(absl::Span<const std::byte> block)
     {
         auto blockType = static_cast<SingleSceneUpdateWriter::BlockType>(m_blockType);
 
         if (blockType == SingleSceneUpdateWriter::BlockType::SceneActionCollection)
         {
-            if (!handleSceneActionCollection())
+            if (!handleSceneActionCollection(block))
+                return false;
+        }
+        else if (blockType == SingleSceneUpdateWriter::BlockType::CompressedSceneActionCollection)
+        {
+            if (!handleCompressedSceneActionCollection(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::Resource)
         {
-            if (!handleResource())
+            if (!handleResource(block))
                 return false;
         }
         else if (blockType == SingleSceneUpdateWriter::BlockType::FlushInfos)
         {
-            if (!handleFlushInfos())
+            if (!handleFlushInfos(block))
                 return false;
         }
         else
@@ -166,11 +188,11 @@ namespace ramses::internal
         return Result{ResultType::Failed, SceneActionCollection(), {}, {}};
     }
 
-    bool SceneUpdateStreamDeserializer::handleSceneActionCollection()
+    bool SceneUpdateStreamDeserializer::handleSceneActionCollection(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleSceneActionCollection: Block too small ({})", block.size());
             return false;
         }
         if (m_currentResult.actions.numberOfActions() != 0)
@@ -179,7 +201,7 @@ namespace ramses::internal
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
@@ -190,15 +212,64 @@ namespace ramses::internal
         return true;
     }
 
-    bool SceneUpdateStreamDeserializer::handleResource()
+    bool SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection(absl::Span<const std::byte> block)
+    {
+        if (block.size() < sizeof(uint32_t)*4)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Block too small ({})", block.size());
+            return false;
+        }
+        if (m_currentResult.actions.numberOfActions() != 0)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: More than one SceneActionCollection in packet");
+            return false;
+        }
+
+        BinaryInputStream is(block.data());
+        uint32_t descSize = 0;
+        uint32_t dataSize = 0;
+        uint32_t compressedDescSize = 0;
+        uint32_t compressedDataSize = 0;
+        is >> descSize
+           >> dataSize
+           >> compressedDescSize
+           >> compressedDataSize;
+
+        if (sizeof(uint32_t)*4 + static_cast<size_t>(compressedDescSize) + compressedDataSize != block.size())
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Block size mismatch (block {}, compressed desc {}, compressed data {})",
+                block.size(), compressedDescSize, compressedDataSize);
+            return false;
+        }
+        if (static_cast<size_t>(descSize) + dataSize > SingleSceneUpdateWriter::MaxDecompressedSceneActionSize)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Decompressed size exceeds limit (desc {}, data {}, limit {})",
+                descSize, dataSize, SingleSceneUpdateWriter::MaxDecompressedSceneActionSize);
+            return false;
+        }
+
+        std::vector<std::byte> desc(descSize);
+        std::vector<std::byte> data(dataSize);
+        if (!LZ4CompressionUtils::decompress(absl::Span<const std::byte>(is.readPosition(), compressedDescSize), absl::MakeSpan(desc)) ||
+            (dataSize > 0u && !LZ4CompressionUtils::decompress(absl::Span<const std::byte>(is.readPosition() + compressedDescSize, compressedDataSize), absl::MakeSpan(data))))
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleCompressedSceneActionCollection: Decompression failed (desc {}, data {})", descSize, dataSize);
+            return false;
+        }
+
+        m_currentResult.actions = SceneActionSerialization::Deserialize(desc, data);
+        return true;
+    }
+
+    bool SceneUpdateStreamDeserializer::handleResource(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t)*2)
+        if (block.size() < sizeof(uint32_t)*2)
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleResource: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t descSize = 0;
         uint32_t dataSize = 0;
         is >> descSize
@@ -210,15 +281,15 @@ namespace ramses::internal
 
     }
 
-    bool SceneUpdateStreamDeserializer::handleFlushInfos()
+    bool SceneUpdateStreamDeserializer::handleFlushInfos(absl::Span<const std::byte> block)
     {
-        if (m_currentBlock.size() < sizeof(uint32_t))
+        if (block.size() < sizeof(uint32_t))
         {
-            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", m_currentBlock.size());
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneUpdateStreamDeserializer::handleFlushInfos: Block to small ({})", block.size());
             return false;
         }
 
-        BinaryInputStream is(m_currentBlock.data());
+        BinaryInputStream is(block.data());
         uint32_t dataSize = 0;
         is >> dataSize;
 
@@ -52,15 +52,20 @@ namespace ramses::internal
         bool startReadingNewBlock(BinaryInputStream& is, size_t dataSize);
         Result fail();
 
-        bool finalizeBlock();
-        bool handleSceneActionCollection();
-        bool handleResource();
-        bool handleFlushInfos();
+        bool finalizeBlock(absl::Span<const std::byte> block);
+        bool handleSceneActionCollection(absl::Span<const std::byte> block);
+        bool handleCompressedSceneActionCollection(absl::Span<const std::byte> block);
+        bool handleResource(absl::Span<const std::byte> block);
+        bool handleFlushInfos(absl::Span<const std::byte> block);
+
+        // upper bound for preallocating fragmented blocks from their announced size, larger blocks grow while received
+        static constexpr uint32_t MaxBlockPreallocationSize = 64u * 1024u * 1024u;
 
         uint32_t m_nextExpectedPacketNum = 1;
         bool m_hasFailed = false;
         uint32_t m_currentBlockSize = 0;
         uint32_t m_blockType = 0;
+        // only used for blocks fragmented over several packets
         std::vector<std::byte> m_currentBlock;
         Result m_currentResult;
 
@@ -8,6 +8,7 @@
 
 #include "internal/Communication/TransportCommon/SingleSceneUpdateWriter.h"
 #include "internal/Communication/TransportCommon/SceneUpdateSerializationHelper.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/LogMacros.h"
 
@@ -20,13 +21,15 @@ namespace ramses::internal
         absl::Span<std::byte> packetMem,
         const std::function<bool(size_t)>& writeDoneFunc,
         StatisticCollectionScene& sceneStatistics,
-        EFeatureLevel featureLevel)
+        EFeatureLevel featureLevel,
+        bool compressSceneActions)
         : m_update(update)
         , m_packetMem(packetMem)
         , m_writeDoneFunc(writeDoneFunc)
         , m_packetWriter(m_packetMem.data(), static_cast<uint32_t>(m_packetMem.size()))
         , m_sceneStatistics(sceneStatistics)
         , m_featureLevel{ featureLevel }
+        , m_compressSceneActions{ compressSceneActions }
     {
         /*
           Packet format
@@ -47,6 +50,14 @@ namespace ramses::internal
           - type list blob
           - data blob
 
+          Compressed SceneAction data (LZ4, same content as SceneAction data)
+          - type list length : uin32_t
+          - data length : uint32_t
+          - compressed type list length : uin32_t
+          - compressed data length : uint32_t
+          - compressed type list blob
+          - compressed data blob
+
           Resource data
           - metadata length : uin32_t
           - blob length : uint32_t
@@ -97,6 +108,10 @@ namespace ramses::internal
         const auto descSpan = SceneActionSerialization::SerializeDescription(m_update.actions, m_temporaryMemToSerializeDescription);
         const auto dataSpan = SceneActionSerialization::SerializeData(m_update.actions);
 
+        const size_t sceneActionSize = descSpan.size() + dataSpan.size();
+        if (m_compressSceneActions && sceneActionSize >= SceneActionCompressionThreshold && sceneActionSize <= MaxDecompressedSceneActionSize)
+            return writeCompressedSceneActionCollection(descSpan, dataSpan);
+
         std::array<std::byte, sizeof(uint32_t)*2> header{};
         RawBinaryOutputStream os(header.data(), header.size());
         os << static_cast<uint32_t>(descSpan.size())
@@ -104,6 +119,28 @@ namespace ramses::internal
         return writeBlock(BlockType::SceneActionCollection, {{os.getData(), os.getSize()}, descSpan, dataSpan});
     }
 
+    bool SingleSceneUpdateWriter::writeCompressedSceneActionCollection(absl::Span<const std::byte> descSpan, absl::Span<const std::byte> dataSpan)
+    {
+        const CompressedResourceBlob compressedDesc = LZ4CompressionUtils::compress(descSpan, LZ4CompressionUtils::CompressionLevel::Fast);
+        const CompressedResourceBlob compressedData = LZ4CompressionUtils::compress(dataSpan, LZ4CompressionUtils::CompressionLevel::Fast);
+        const bool compressionFailed = compressedDesc.size() == 0u || (!dataSpan.empty() && compressedData.size() == 0u);
+        if (compressionFailed || compressedDesc.size() + compressedData.size() >= descSpan.size() + dataSpan.size())
+        {
+            if (compressionFailed)
+                LOG_WARN(CONTEXT_COMMUNICATION, "SingleSceneUpdateWriter::writeCompressedSceneActionCollection: Compression failed, send uncompressed (size {})", descSpan.size() + dataSpan.size());
+            m_compressSceneActions = false;
+            return writeSceneActionCollection();
+        }
+
+        std::array<std::byte, sizeof(uint32_t)*4> header{};
+        RawBinaryOutputStream os(header.data(), header.size());
+        os << static_cast<uint32_t>(descSpan.size())
+           << static_cast<uint32_t>(dataSpan.size())
+           << static_cast<uint32_t>(compressedDesc.size())
+           << static_cast<uint32_t>(compressedData.size());
+        return writeBlock(BlockType::CompressedSceneActionCollection, {{os.getData(), os.getSize()}, {compressedDesc.data(), compressedDesc.size()}, {compressedData.data(), compressedData.size()}});
+    }
+
     bool SingleSceneUpdateWriter::writeResource(const IResource& res)
     {
         m_temporaryMemToSerializeDescription.clear();
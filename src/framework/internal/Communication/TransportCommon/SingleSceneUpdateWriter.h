@@ -25,7 +25,8 @@ namespace ramses::internal
             absl::Span<std::byte> packetMem,
             const std::function<bool(size_t)>& writeDoneFunc,
             StatisticCollectionScene& sceneStatistics,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            bool compressSceneActions);
 
         bool write();
 
@@ -34,16 +35,23 @@ namespace ramses::internal
             SceneActionCollection = 10,
             Resource              = 11,
             FlushInfos            = 12,
+            CompressedSceneActionCollection = 13,
         };
 
         static constexpr const uint32_t hasMorePacketsFlag = 0xCA;
         static constexpr const uint32_t lastPacketFlag = 0xFE;
 
+        // scene actions smaller than this are sent uncompressed even if compression is enabled
+        static constexpr const size_t SceneActionCompressionThreshold = 16384u;
+        // receiver does not trust decompressed sizes announced by peer above this limit, larger scene actions are sent uncompressed
+        static constexpr const size_t MaxDecompressedSceneActionSize = 64u * 1024u * 1024u;
+
     private:
         void initializePacket();
         bool finalizePacket(bool more);
 
         bool writeSceneActionCollection();
+        bool writeCompressedSceneActionCollection(absl::Span<const std::byte> descSpan, absl::Span<const std::byte> dataSpan);
         bool writeResource(const IResource& resource);
         bool writeFlushInfos(const FlushInformation& infos);
 
@@ -59,5 +67,6 @@ namespace ramses::internal
         StatisticCollectionScene&          m_sceneStatistics;
         uint64_t                           m_overallSize{0};
         EFeatureLevel                      m_featureLevel = EFeatureLevel_Latest;
+        bool                               m_compressSceneActions = false;
     };
 }
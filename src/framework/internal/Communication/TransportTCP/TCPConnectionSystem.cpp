@@ -13,6 +13,9 @@
 #include "internal/Core/Utils/RawBinaryOutputStream.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include <array>
+#include <functional>
+#include <limits>
 #include <thread>
 #include <utility>
 #include "internal/Communication/TransportCommon/ISceneUpdateSerializer.h"
@@ -29,7 +32,9 @@ namespace ramses::internal
                                                      PlatformLock& frameworkLock,
                                                      StatisticCollectionFramework& statisticCollection,
                                                      std::chrono::milliseconds aliveInterval,
-                                                     std::chrono::milliseconds aliveTimeout)
+                                                     std::chrono::milliseconds aliveTimeout,
+                                                     bool sceneUpdateCompressionEnabled,
+                                                     size_t sendQueueLimit)
         : m_participantAddress(std::move(participantAddress))
         , m_protocolVersion(protocolVersion)
         , m_daemonAddress(std::move(daemonAddress))
@@ -43,6 +48,8 @@ namespace ramses::internal
                             : EParticipantType::Client)
         , m_aliveInterval(aliveInterval)
         , m_aliveIntervalTimeout(aliveTimeout)
+        , m_sceneUpdateCompressionEnabled(sceneUpdateCompressionEnabled)
+        , m_sendQueueLimit(sendQueueLimit)
         , m_frameworkLock(frameworkLock)
         , m_thread("TCP_ConnSys")
         , m_statisticCollection(statisticCollection)
@@ -71,7 +78,8 @@ namespace ramses::internal
                                                    << m_participantAddress.getParticipantId() << "/" << m_participantAddress.getParticipantName()
                                                    << " at " << m_participantAddress.getIp() << ":" << m_participantAddress.getPort()
                                                    << ", type " << EnumToString(m_participantType)
-                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms";
+                                                   << ", aliveInterval " << m_aliveInterval.count() << "ms, aliveTimeout " << m_aliveIntervalTimeout.count() << "ms"
+                                                   << ", sendQueueLimit " << m_sendQueueLimit;
                                                if (m_hasOtherDaemon)
                                                    sos << ", other daemon at " << m_daemonAddress.getIp() << ":" << m_daemonAddress.getPort();
                                            }));
@@ -89,6 +97,8 @@ namespace ramses::internal
         }
 
         m_runState = std::make_unique<RunState>();
+        m_connectServicesTime = std::chrono::steady_clock::now();
+        m_daemonConnectionLogged = false;
         m_thread.start(*this);
 
         return true;
@@ -291,28 +301,49 @@ namespace ramses::internal
         pp->socket.set_option(asio::ip::tcp::no_delay{true});
         pp->state = EParticipantState::WaitingForHello;
         pp->lastReceived = std::chrono::steady_clock::now();
+        pp->connected = pp->lastReceived;
 
         doReadHeader(pp);
         sendConnectionDescriptionOnNewConnection(pp);
     }
 
+    TCPConnectionSystem::SharedOutMessage TCPConnectionSystem::finalizeMessage(OutMessage msg) const
+    {
+        std::vector<std::byte> buffer = msg.stream.release();
+        const auto fullSize = static_cast<uint32_t>(buffer.size() + msg.payload.size());
+
+        RawBinaryOutputStream s(buffer.data(), buffer.size());
+        const uint32_t remainingSize = fullSize - sizeof(Participant::lengthReceiveBuffer);
+        s << remainingSize
+          << m_protocolVersion;
+
+        SharedOutMessage result{msg.messageType, std::make_shared<const std::vector<std::byte>>(std::move(buffer)), nullptr, msg.highPriority};
+        if (!msg.payload.empty())
+            result.payload = std::make_shared<const std::vector<std::byte>>(std::move(msg.payload));
+        return result;
+    }
+
     void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg)
     {
-        assert(pp->currentOutBuffer.empty());
+        sendMessageToParticipant(pp, finalizeMessage(std::move(msg)));
+    }
+
+    void TCPConnectionSystem::sendMessageToParticipant(const ParticipantPtr& pp, const SharedOutMessage& msg)
+    {
+        assert(!pp->currentOutMessage.data);
 
-        pp->currentOutBuffer = msg.stream.release();
-        const auto fullSize = static_cast<uint32_t>(pp->currentOutBuffer.size());
+        pp->currentOutMessage = msg;
+        const std::array<asio::const_buffer, 2u> buffers{
+            asio::const_buffer(msg.data->data(), msg.data->size()),
+            msg.payload ? asio::const_buffer(msg.payload->data(), msg.payload->size()) : asio::const_buffer()
+        };
+        const size_t fullSize = asio::buffer_size(buffers);
 
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgType {}, Size {}",
             m_participantAddress.getParticipantName(), pp->address.getParticipantId(), msg.messageType, fullSize);
 
-        RawBinaryOutputStream s(pp->currentOutBuffer.data(), pp->currentOutBuffer.size());
-        const uint32_t remainingSize = fullSize - sizeof(pp->lengthReceiveBuffer);
-        s << remainingSize
-          << m_protocolVersion;
-
-        asio::async_write(pp->socket, asio::const_buffer(pp->currentOutBuffer.data(), pp->currentOutBuffer.size()),
-                          [this, pp](asio::error_code e, std::size_t sentBytes) {
+        asio::async_write(pp->socket, buffers,
+                          [this, pp, fullSize](asio::error_code e, std::size_t sentBytes) {
                               if (e)
                               {
                                   LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: Send to {}/{} failed. {}. Remove participant",
@@ -323,9 +354,9 @@ namespace ramses::internal
                               else
                               {
                                   LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendMessageToParticipant: To {}, MsgBytes {}, SentBytes {}",
-                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->currentOutBuffer.size(), sentBytes);
+                                      m_participantAddress.getParticipantName(), pp->address.getParticipantId(), fullSize, sentBytes);
 
-                                  pp->currentOutBuffer.clear();
+                                  pp->currentOutMessage = SharedOutMessage{};
                                   pp->lastSent = std::chrono::steady_clock::now();
 
                                   pp->sendAliveTimer.expires_after(m_aliveInterval);
@@ -344,20 +375,26 @@ namespace ramses::internal
 
     void TCPConnectionSystem::doSendQueuedMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty() && !pp->outQueue.empty())
+        if (pp->currentOutMessage.data)
+            return;
+
+        // scene updates are split into packet messages, so a high priority scene overtakes large updates of other scenes packet-wise
+        auto& queue = pp->outQueueHighPriority.empty() ? pp->outQueue : pp->outQueueHighPriority;
+        if (!queue.empty())
         {
-            OutMessage msg = std::move(pp->outQueue.front());
-            pp->outQueue.pop_front();
+            const SharedOutMessage msg = std::move(queue.front());
+            queue.pop_front();
+            pp->outQueueBytes -= GetMessageSize(msg);
 
-            sendMessageToParticipant(pp, std::move(msg));
+            sendMessageToParticipant(pp, msg);
         }
     }
 
     void TCPConnectionSystem::doTrySendAliveMessage(const ParticipantPtr& pp)
     {
-        if (pp->currentOutBuffer.empty())
+        if (!pp->currentOutMessage.data)
         {
-            assert(pp->outQueue.empty());
+            assert(pp->outQueue.empty() && pp->outQueueHighPriority.empty());
 
             sendMessageToParticipant(pp, OutMessage(std::vector<Guid>(), EMessageId::Alive));
         }
@@ -452,6 +489,9 @@ namespace ramses::internal
         pp->connectTimer.cancel();
         pp->sendAliveTimer.cancel();
         pp->checkReceivedAliveTimer.cancel();
+        pp->outQueue.clear();
+        pp->outQueueHighPriority.clear();
+        pp->outQueueBytes = 0u;
         pp->state = EParticipantState::Invalid;
 
         // remove from sets
@@ -459,12 +499,15 @@ namespace ramses::internal
         if (!pp->address.getParticipantId().isInvalid())
         {
             m_establishedParticipants.remove(pp->address.getParticipantId());
+            std::lock_guard<std::mutex> lock(m_compressionAcceptingParticipantsLock);
+            m_compressionAcceptingParticipants.remove(pp->address.getParticipantId());
         }
 
         // check if should be tried again
         if (reconnectWithBackoff)
         {
-            const std::chrono::milliseconds backoffTime{2000};
+            // local peer (e.g. daemon on same machine) is usually back quickly, long backoff would dominate reconnect time
+            const std::chrono::milliseconds backoffTime{IsLocalAddress(pp->address.getIp()) ? 200 : 2000};
             LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::removeParticipant: will delay reconnect by {}ms", m_participantAddress.getParticipantName(), backoffTime.count());
             pp->connectTimer.expires_after(backoffTime);
             pp->connectTimer.async_wait([this, pp](asio::error_code ee) {
@@ -482,6 +525,11 @@ namespace ramses::internal
             addNewParticipantByAddress(pp->address);
     }
 
+    size_t TCPConnectionSystem::GetMessageSize(const SharedOutMessage& msg)
+    {
+        return msg.data->size() + (msg.payload ? msg.payload->size() : 0u);
+    }
+
     const char* TCPConnectionSystem::EnumToString(EParticipantState e)
     {
         switch (e)
@@ -544,42 +592,60 @@ namespace ramses::internal
         if (msg.to.empty())
             return true;
 
-        asio::post(m_runState->m_io, [this, msg = std::move(msg)]() mutable {
-                            if (msg.to.size() > 1)
+        // serialized once, all recipients send from same buffer
+        std::vector<Guid> to = std::move(msg.to);
+        asio::post(m_runState->m_io, [this, to = std::move(to), sharedMsg = finalizeMessage(std::move(msg))]() {
+                            if (to.size() > 1)
                             {
-                                for (auto& p : msg.to)
+                                for (auto& p : to)
                                 {
                                     ParticipantPtr pp;
                                     if (m_establishedParticipants.get(p, pp) != EStatus::Ok)
                                         continue; // skip invalid participant in broadcast. might happen due to disconnect race
                                     assert(pp);
 
-                                    // cannot move here when broadcast to more than 1 participant
-                                    pp->outQueue.push_back(msg);
-
-                                    doSendQueuedMessage(pp);
+                                    queueMessageForSending(pp, sharedMsg);
                                 }
                             }
                             else
                             {
                                 ParticipantPtr pp;
-                                if (m_establishedParticipants.get(msg.to.front(), pp) != EStatus::Ok)
+                                if (m_establishedParticipants.get(to.front(), pp) != EStatus::Ok)
                                 {
                                     LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::postMessageForSending: post message {} to not (fully) connected participant {}",
-                                        m_participantAddress.getParticipantName(), msg.messageType, msg.to.front());
+                                        m_participantAddress.getParticipantName(), sharedMsg.messageType, to.front());
                                     return;
                                 }
                                 assert(pp);
 
-                                pp->outQueue.push_back(std::move(msg));
-
-                                doSendQueuedMessage(pp);
+                                queueMessageForSending(pp, sharedMsg);
                             }
             });
 
         return true;
     }
 
+    void TCPConnectionSystem::queueMessageForSending(const ParticipantPtr& pp, const SharedOutMessage& msg)
+    {
+        const size_t msgSize = GetMessageSize(msg);
+        // scene updates are incremental and cannot be dropped selectively. A participant not keeping up is disconnected instead,
+        // which drops all its pending flushes and it gets the current scene state again when re-subscribing after reconnect.
+        if (m_sendQueueLimit != 0u && msg.messageType == EMessageId::SendSceneUpdate && pp->outQueueBytes + msgSize > m_sendQueueLimit)
+        {
+            LOG_WARN(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::queueMessageForSending: Participant {}/{} does not keep up receiving scene updates ({} bytes queued, limit {}). Drop connection",
+                m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->address.getParticipantName(), pp->outQueueBytes + msgSize, m_sendQueueLimit);
+            removeParticipant(pp, true);
+            return;
+        }
+
+        (msg.highPriority ? pp->outQueueHighPriority : pp->outQueue).push_back(msg);
+        pp->outQueueBytes += msgSize;
+        m_statisticCollection.statMaximumSendQueueSize.setCounterValueIfCurrent<std::less<>>(
+            static_cast<uint32_t>(std::min<size_t>(pp->outQueueBytes, std::numeric_limits<uint32_t>::max())));
+
+        doSendQueuedMessage(pp);
+    }
+
     void TCPConnectionSystem::handleReceivedMessage(const ParticipantPtr& pp)
     {
         assert(!pp->receiveBuffer.empty());
@@ -649,7 +715,8 @@ namespace ramses::internal
                    << m_participantAddress.getParticipantName()
                    << m_participantAddress.getIp()
                    << static_cast<uint16_t>(m_runState->m_acceptor.local_endpoint().port())
-                   << m_participantType;
+                   << m_participantType
+                   << m_sceneUpdateCompressionEnabled;
         sendMessageToParticipant(pp, std::move(msg));
     }
 
@@ -675,16 +742,24 @@ namespace ramses::internal
         std::string ip;
         uint16_t port = 0u;
         EParticipantType participantType;
+        bool acceptsCompressedSceneUpdates = false;
         stream >> guid
                >> name
                >> ip
                >> port
-               >> participantType;
+               >> participantType
+               >> acceptsCompressedSceneUpdates;
         pp->address = NetworkParticipantAddress(guid, name, ip, port);
         assert(!guid.isInvalid());
 
-        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleConnectionDescriptionMessage: Hello from {}/{} type {} at {}:{}. Established now",
-            m_participantAddress.getParticipantName(), guid, name, EnumToString(participantType), ip, port);
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleConnectionDescriptionMessage: Hello from {}/{} type {} at {}:{}, scene update compression {}. Established now",
+            m_participantAddress.getParticipantName(), guid, name, EnumToString(participantType), ip, port, acceptsCompressedSceneUpdates);
+
+        if (acceptsCompressedSceneUpdates)
+        {
+            std::lock_guard<std::mutex> lock(m_compressionAcceptingParticipantsLock);
+            m_compressionAcceptingParticipants.put(guid);
+        }
 
         pp->type = participantType;
         pp->state = EParticipantState::Established;
@@ -692,12 +767,37 @@ namespace ramses::internal
         m_connectingParticipants.remove(pp);
         m_establishedParticipants.put(guid, pp);
 
+        logConnectionSetupTimes(pp);
+
         if (pp->type != EParticipantType::PureDaemon)
             triggerConnectionUpdateNotification(guid, EConnectionStatus_Connected);
 
         sendConnectorAddressExchangeMessagesForNewParticipant(pp);
     }
 
+    void TCPConnectionSystem::logConnectionSetupTimes(const ParticipantPtr& pp)
+    {
+        // connect phase covers all connect attempts (incl. retries while peer not listening yet), it is zero for accepted connections
+        using Ms = std::chrono::duration<int64_t, std::milli>;
+        const auto now = std::chrono::steady_clock::now();
+        const auto connectMs = std::chrono::duration_cast<Ms>(pp->connected - pp->created).count();
+        const auto handshakeMs = std::chrono::duration_cast<Ms>(now - pp->connected).count();
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::logConnectionSetupTimes: {}/{} connect {}ms, handshake {}ms",
+            m_participantAddress.getParticipantName(), pp->address.getParticipantId(), pp->address.getParticipantName(), connectMs, handshakeMs);
+
+        if ((pp->type == EParticipantType::Daemon || pp->type == EParticipantType::PureDaemon) && !m_daemonConnectionLogged)
+        {
+            m_daemonConnectionLogged = true;
+            LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::logConnectionSetupTimes: first daemon connection established {}ms after connectServices",
+                m_participantAddress.getParticipantName(), std::chrono::duration_cast<Ms>(now - m_connectServicesTime).count());
+        }
+    }
+
+    bool TCPConnectionSystem::IsLocalAddress(const std::string& ip)
+    {
+        return ip == "localhost" || ip.rfind("127.", 0) == 0;
+    }
+
     void TCPConnectionSystem::sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp)
     {
         if (m_participantType == EParticipantType::Daemon || m_participantType == EParticipantType::PureDaemon)
@@ -874,6 +974,7 @@ namespace ramses::internal
         LOG_DEBUG(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendInitializeScene: to {}, sceneId {}", m_participantAddress.getParticipantName(), to, sceneId);
         OutMessage msg(to, EMessageId::CreateScene);
         msg.stream << sceneId.getValue();
+        msg.highPriority = isHighPriorityScene(sceneId);
         return postMessageForSending(std::move(msg));
     }
 
@@ -891,23 +992,48 @@ namespace ramses::internal
     }
 
     // --
-    bool TCPConnectionSystem::sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
+    bool TCPConnectionSystem::sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer)
     {
-        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {}", m_participantAddress.getParticipantName(), to);
+        LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::sendSceneActionList: to {}", m_participantAddress.getParticipantName(), fmt::join(to, ", "));
 
         static_assert(SceneActionDataSize < 1000000, "SceneActionDataSize too big");
 
-        std::vector<std::byte> buffer(SceneActionDataSize);
-        return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
+        // compress only if both sides enabled it, peers not announcing support could not read compressed blocks
+        std::vector<Guid> toCompressed;
+        std::vector<Guid> toUncompressed;
+        {
+            std::lock_guard<std::mutex> lock(m_compressionAcceptingParticipantsLock);
+            for (const auto& p : to)
+            {
+                if (m_sceneUpdateCompressionEnabled && m_compressionAcceptingParticipants.contains(p))
+                    toCompressed.push_back(p);
+                else
+                    toUncompressed.push_back(p);
+            }
+        }
 
-            const auto usedSize = static_cast<uint32_t>(size);
-            OutMessage msg(to, EMessageId::SendSceneUpdate);
-            msg.stream << sceneId.getValue()
-                       << usedSize;
-            msg.stream.write(buffer.data(), usedSize);
+        // serialize once per group of recipients, every packet message is shared between all of them
+        const bool highPriority = isHighPriorityScene(sceneId);
+        std::vector<std::byte> buffer(SceneActionDataSize);
+        const auto serializeAndPost = [&](const std::vector<Guid>& recipients, bool compressSceneActions) {
+            return serializer.writeToPackets({buffer.data(), buffer.size()}, [&](size_t size) {
+                const auto usedSize = static_cast<uint32_t>(size);
+                OutMessage msg(recipients, EMessageId::SendSceneUpdate);
+                msg.stream << sceneId.getValue()
+                           << usedSize;
+                msg.payload.assign(buffer.data(), buffer.data() + usedSize);
+                msg.highPriority = highPriority;
+
+                return postMessageForSending(std::move(msg));
+            }, compressSceneActions);
+        };
 
-            return postMessageForSending(std::move(msg));
-        });
+        bool result = true;
+        if (!toUncompressed.empty())
+            result = serializeAndPost(toUncompressed, false);
+        if (!toCompressed.empty())
+            result = serializeAndPost(toCompressed, true) && result;
+        return result;
     }
 
 
@@ -920,8 +1046,16 @@ namespace ramses::internal
             uint32_t dataSize = 0;
             stream >> dataSize;
 
-            std::vector<std::byte> data(dataSize);
-            stream.read(data.data(), dataSize);
+            // scene update data is passed directly from receive buffer, it stays valid until handler returns
+            const size_t remainingSize = pp->receiveBuffer.size() - stream.getCurrentReadBytes();
+            if (dataSize > remainingSize)
+            {
+                LOG_ERROR(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {} invalid data size {} (message has {} bytes left)",
+                    m_participantAddress.getParticipantName(), pp->address.getParticipantId(), dataSize, remainingSize);
+                removeParticipant(pp);
+                return;
+            }
+            const absl::Span<const std::byte> data(stream.readPosition(), dataSize);
 
             LOG_TRACE(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::handleSceneActionList: from {}", m_participantAddress.getParticipantName(), pp->address.getParticipantId());
 
@@ -1111,6 +1245,23 @@ namespace ramses::internal
         }
     }
 
+    // --
+    void TCPConnectionSystem::setHighPriorityScene(const SceneId& sceneId, bool highPriority)
+    {
+        LOG_INFO(CONTEXT_COMMUNICATION, "TCPConnectionSystem({})::setHighPriorityScene: sceneId {}, highPriority {}", m_participantAddress.getParticipantName(), sceneId, highPriority);
+        std::lock_guard<std::mutex> lock(m_highPriorityScenesLock);
+        if (highPriority)
+            m_highPriorityScenes.put(sceneId);
+        else
+            m_highPriorityScenes.remove(sceneId);
+    }
+
+    bool TCPConnectionSystem::isHighPriorityScene(const SceneId& sceneId)
+    {
+        std::lock_guard<std::mutex> lock(m_highPriorityScenesLock);
+        return m_highPriorityScenes.contains(sceneId);
+    }
+
     // --- ramsh command handling ---
     void TCPConnectionSystem::logConnectionInfo()
     {
@@ -1137,6 +1288,7 @@ namespace ramses::internal
                                     sos << "  "  << addr.getParticipantId() << " / " << addr.getParticipantName() << " at " << addr.getIp() << ":" << addr.getPort();
                                     if (m_hasOtherDaemon && addr.getIp() == m_daemonAddress.getIp() && addr.getPort() == m_daemonAddress.getPort())
                                         sos << " (daemon)";
+                                    sos << ", send queue " << p.value->outQueue.size() + p.value->outQueueHighPriority.size() << " msg/" << p.value->outQueueBytes << " bytes";
                                     sos << "\n";
                                 }
 
@@ -1181,7 +1333,10 @@ namespace ramses::internal
                                     {
                                         for (const auto& p : m_establishedParticipants)
                                         {
-                                            sos << p.key << "; ";
+                                            sos << p.key;
+                                            if (p.value->outQueueBytes > 0u)
+                                                sos << " (queued " << p.value->outQueue.size() + p.value->outQueueHighPriority.size() << " msg/" << p.value->outQueueBytes << " bytes)";
+                                            sos << "; ";
                                         }
                                     }
                                 }));
@@ -1223,6 +1378,7 @@ namespace ramses::internal
         , checkReceivedAliveTimer(io_)
         , type(type_)
         , state(state_)
+        , created(std::chrono::steady_clock::now())
     {}
 
     TCPConnectionSystem::Participant::~Participant()
@@ -17,7 +17,10 @@
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/Communication/TransportTCP/AsioWrapper.h"
+#include <chrono>
 #include <deque>
+#include <mutex>
+#include <string>
 #include <utility>
 
 
@@ -31,7 +34,7 @@ namespace ramses::internal
     public:
         TCPConnectionSystem(NetworkParticipantAddress  participantAddress, uint32_t protocolVersion, NetworkParticipantAddress  daemonAddress, bool pureDaemon,
                             PlatformLock& frameworkLock, StatisticCollectionFramework& statisticCollection,
-                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout);
+                            std::chrono::milliseconds aliveInterval, std::chrono::milliseconds aliveTimeout, bool sceneUpdateCompressionEnabled = false, size_t sendQueueLimit = 0u);
         ~TCPConnectionSystem() override;
 
         static Guid GetDaemonId();
@@ -50,10 +53,12 @@ namespace ramses::internal
         bool sendUnsubscribeScene(const Guid& to, const SceneId& sceneId) override;
 
         bool sendInitializeScene(const Guid& to, const SceneId& sceneId) override;
-        bool sendSceneUpdate(const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
+        bool sendSceneUpdate(const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer) override;
 
         bool sendRendererEvent(const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data) override;
 
+        void setHighPriorityScene(const SceneId& sceneId, bool highPriority) override;
+
         // set service handlers
         void setSceneProviderServiceHandler(ISceneProviderServiceHandler* handler) override;
         void setSceneRendererServiceHandler(ISceneRendererServiceHandler* handler) override;
@@ -103,6 +108,18 @@ namespace ramses::internal
             std::vector<Guid> to;
             EMessageId messageType;
             BinaryOutputStream stream;
+            // sent directly after stream content with a gather write, large data is not copied into stream
+            std::vector<std::byte> payload;
+            bool highPriority = false;
+        };
+
+        // message with size and protocol version filled in, data and payload are shared between out queues of all recipients
+        struct SharedOutMessage
+        {
+            EMessageId messageType;
+            std::shared_ptr<const std::vector<std::byte>> data;
+            std::shared_ptr<const std::vector<std::byte>> payload;
+            bool highPriority = false;
         };
 
         struct Participant
@@ -115,8 +132,11 @@ namespace ramses::internal
             asio::ip::tcp::socket socket;
             asio::steady_timer connectTimer;
 
-            std::deque<OutMessage> outQueue;
-            std::vector<std::byte> currentOutBuffer;
+            // high priority lane is sent first, all messages of a scene use the same lane so they stay in order
+            std::deque<SharedOutMessage> outQueue;
+            std::deque<SharedOutMessage> outQueueHighPriority;
+            size_t outQueueBytes = 0u;
+            SharedOutMessage currentOutMessage;
 
             uint32_t lengthReceiveBuffer;
             std::vector<std::byte> receiveBuffer;
@@ -128,6 +148,10 @@ namespace ramses::internal
 
             EParticipantType type;
             EParticipantState state;
+
+            // connection setup phases for logging: participant created (first connect attempt or accept), socket connected
+            std::chrono::steady_clock::time_point created;
+            std::chrono::steady_clock::time_point connected;
         };
         using ParticipantPtr = std::shared_ptr<Participant>;
 
@@ -152,15 +176,21 @@ namespace ramses::internal
         bool openAcceptor();
         void doAcceptIncomingConnections();
 
+        [[nodiscard]] SharedOutMessage finalizeMessage(OutMessage msg) const;
         void sendMessageToParticipant(const ParticipantPtr& pp, OutMessage msg);
+        void sendMessageToParticipant(const ParticipantPtr& pp, const SharedOutMessage& msg);
         void removeParticipant(const ParticipantPtr& pp, bool reconnectWithBackoff = false);
         void addNewParticipantByAddress(const NetworkParticipantAddress& address);
         void initializeNewlyConnectedParticipant(const ParticipantPtr& pp);
         void handleReceivedMessage(const ParticipantPtr& pp);
         bool postMessageForSending(OutMessage msg);
+        void queueMessageForSending(const ParticipantPtr& pp, const SharedOutMessage& msg);
         void updateLastReceivedTime(const ParticipantPtr& pp);
         void sendConnectorAddressExchangeMessagesForNewParticipant(const ParticipantPtr& newPp);
         void triggerConnectionUpdateNotification(Guid participant, EConnectionStatus status);
+        void logConnectionSetupTimes(const ParticipantPtr& pp);
+        static bool IsLocalAddress(const std::string& ip);
+        bool isHighPriorityScene(const SceneId& sceneId);
 
         void handleConnectionDescriptionMessage(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleConnectorAddressExchange(const ParticipantPtr& pp, BinaryInputStream& stream);
@@ -174,6 +204,7 @@ namespace ramses::internal
         void handleSceneNotAvailable(const ParticipantPtr& pp, BinaryInputStream& stream);
         void handleRendererEvent(const ParticipantPtr& pp, BinaryInputStream& stream);
 
+        static size_t GetMessageSize(const SharedOutMessage& msg);
         static const char* EnumToString(EParticipantState e);
         static const char* EnumToString(EParticipantType e);
 
@@ -185,6 +216,9 @@ namespace ramses::internal
         const EParticipantType m_participantType;
         const std::chrono::milliseconds m_aliveInterval;
         const std::chrono::milliseconds m_aliveIntervalTimeout;
+        const bool m_sceneUpdateCompressionEnabled;
+        // maximum bytes queued for sending to a participant before it is considered too slow and disconnected (0 = unlimited)
+        const size_t m_sendQueueLimit;
 
         PlatformLock& m_frameworkLock;
         PlatformThread m_thread;
@@ -197,7 +231,17 @@ namespace ramses::internal
         ISceneRendererServiceHandler* m_sceneRendererHandler;
 
         std::unique_ptr<RunState>     m_runState;
+        std::chrono::steady_clock::time_point m_connectServicesTime;
+        bool                          m_daemonConnectionLogged = false;
         HashSet<ParticipantPtr>       m_connectingParticipants;
         HashMap<Guid, ParticipantPtr> m_establishedParticipants;
+
+        // participants which announced to accept compressed scene updates, accessed from io thread and sending threads
+        std::mutex     m_compressionAcceptingParticipantsLock;
+        HashSet<Guid>  m_compressionAcceptingParticipants;
+
+        // scenes whose messages use high priority lane, accessed from sending threads
+        std::mutex        m_highPriorityScenesLock;
+        HashSet<SceneId>  m_highPriorityScenes;
     };
 }
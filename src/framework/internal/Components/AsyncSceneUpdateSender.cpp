@@ -0,0 +1,102 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Components/AsyncSceneUpdateSender.h"
+#include "internal/Core/TaskFramework/ITask.h"
+
+#include <algorithm>
+
+namespace ramses::internal
+{
+    class AsyncSceneUpdateSender::SendTask : public ITask
+    {
+    public:
+        SendTask(AsyncSceneUpdateSender& sender, SendFunction sendFunction)
+            : m_sender(sender)
+            , m_sendFunction(std::move(sendFunction))
+        {
+        }
+
+        void execute() override
+        {
+            m_sendFunction();
+            // release captured data before signaling, waiting thread may destroy what it refers to
+            m_sendFunction = nullptr;
+            m_sender.sendFinished();
+        }
+
+        [[nodiscard]] ETaskPriority getPriority() const override
+        {
+            return ETaskPriority::High;
+        }
+
+    private:
+        AsyncSceneUpdateSender& m_sender;
+        SendFunction m_sendFunction;
+    };
+
+    AsyncSceneUpdateSender::AsyncSceneUpdateSender(ITaskQueue& taskQueue, uint32_t maxPendingSends)
+        : m_queue(taskQueue)
+        , m_maxPendingSends(std::max(maxPendingSends, 1u))
+    {
+    }
+
+    AsyncSceneUpdateSender::~AsyncSceneUpdateSender()
+    {
+        m_queue.disableAcceptingTasksAfterExecutingCurrentQueue();
+    }
+
+    void AsyncSceneUpdateSender::enqueue(SendFunction sendFunction)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            ++m_pendingSends;
+        }
+
+        auto task = new SendTask(*this, std::move(sendFunction));
+        if (!m_queue.enqueue(*task))
+            sendFinished();
+        task->release();
+    }
+
+    void AsyncSceneUpdateSender::waitForFreeSlot()
+    {
+        waitForPendingCountBelow(m_maxPendingSends);
+    }
+
+    void AsyncSceneUpdateSender::waitForPendingSends()
+    {
+        waitForPendingCountBelow(1u);
+    }
+
+    uint32_t AsyncSceneUpdateSender::getPendingSendCount() const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_pendingSends;
+    }
+
+    uint32_t AsyncSceneUpdateSender::getMaxPendingSends() const
+    {
+        return m_maxPendingSends;
+    }
+
+    void AsyncSceneUpdateSender::waitForPendingCountBelow(uint32_t count)
+    {
+        std::unique_lock<std::mutex> l(m_lock);
+        m_sendFinished.wait(l, [&]() { return m_pendingSends < count; });
+    }
+
+    void AsyncSceneUpdateSender::sendFinished()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            --m_pendingSends;
+        }
+        m_sendFinished.notify_all();
+    }
+}
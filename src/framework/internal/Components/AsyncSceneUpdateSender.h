@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/TaskFramework/EnqueueOnlyOneAtATimeQueue.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+namespace ramses::internal
+{
+    class ITaskQueue;
+
+    /**
+     * Executes sending of scene updates of one scene on a framework worker, in the order they were enqueued.
+     * Number of pending sends is limited, the flushing thread waits (outside of framework lock) for a send
+     * to finish before it captures a further update.
+     */
+    class AsyncSceneUpdateSender
+    {
+    public:
+        using SendFunction = std::function<void()>;
+
+        AsyncSceneUpdateSender(ITaskQueue& taskQueue, uint32_t maxPendingSends);
+        ~AsyncSceneUpdateSender();
+
+        AsyncSceneUpdateSender(const AsyncSceneUpdateSender&) = delete;
+        AsyncSceneUpdateSender& operator=(const AsyncSceneUpdateSender&) = delete;
+
+        void enqueue(SendFunction sendFunction);
+
+        // must not be called while holding a lock the enqueued send functions take
+        void waitForFreeSlot();
+        void waitForPendingSends();
+
+        [[nodiscard]] uint32_t getPendingSendCount() const;
+        [[nodiscard]] uint32_t getMaxPendingSends() const;
+
+    private:
+        class SendTask;
+
+        void waitForPendingCountBelow(uint32_t count);
+        void sendFinished();
+
+        EnqueueOnlyOneAtATimeQueue m_queue;
+        const uint32_t m_maxPendingSends;
+
+        mutable std::mutex m_lock;
+        std::condition_variable m_sendFinished;
+        uint32_t m_pendingSends = 0u;
+    };
+}
@@ -11,6 +11,7 @@
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/SceneDescriber.h"
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
 #include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
 #include "internal/SceneGraph/SceneUtils/ResourceUtils.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
@@ -100,6 +101,26 @@ namespace ramses::internal
         }
     }
 
+    void ClientSceneLogicBase::prepareFlush()
+    {
+        auto& actions = m_scene.getSceneActionCollection();
+        if (actions.empty())
+            return;
+
+        if (m_scene.isSceneActionCoalescingEnabled())
+            SceneActionCoalescer::CoalesceActions(actions);
+
+        if (m_preparedActions.empty())
+        {
+            m_preparedActions.swap(actions);
+        }
+        else
+        {
+            m_preparedActions.append(actions);
+            actions.clear();
+        }
+    }
+
     std::vector<Guid> ClientSceneLogicBase::getWaitingAndActiveSubscribers() const
     {
         std::vector<Guid> result(m_subscribersActive);
@@ -107,6 +128,21 @@ namespace ramses::internal
         return result;
     }
 
+    void ClientSceneLogicBase::enableAsyncSceneDescription()
+    {
+        m_asyncSceneDescription = true;
+    }
+
+    void ClientSceneLogicBase::DescribeScene(const IScene& scene, EFeatureLevel featureLevel, SceneUpdate& sceneUpdate, size_t& sceneResourcesSize)
+    {
+        SceneActionCollectionCreator creator(sceneUpdate.actions, featureLevel);
+        SceneDescriber::describeScene<IScene>(scene, creator, true);
+
+        sceneResourcesSize = 0u;
+        ResourceUtils::GetAllSceneResourcesFromScene(sceneUpdate.flushInfos.resourceChanges.m_sceneResourceActions, scene, sceneResourcesSize);
+        sceneUpdate.flushInfos.sizeInfo = scene.getSceneSizeInformation();
+    }
+
     void ClientSceneLogicBase::sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
         if (m_subscribersWaitingForScene.empty())
@@ -116,32 +152,67 @@ namespace ramses::internal
         }
 
         SceneUpdate sceneUpdate;
-        SceneActionCollectionCreator creator(sceneUpdate.actions, m_featureLevel);
-        SceneDescriber::describeScene<IScene>(scene, creator);
-
-        m_resourceChangesSinceLastFlush.clear();
         size_t sceneResourcesSize = 0u;
-        ResourceUtils::GetAllSceneResourcesFromScene(m_resourceChangesSinceLastFlush.m_sceneResourceActions, scene, sceneResourcesSize);
+        DescribeScene(scene, m_featureLevel, sceneUpdate, sceneResourcesSize);
+        LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} subscribers, {} scene actions ({} bytes), {} client resources, {} scene resource actions ({} bytes in total used by scene resources)",
+            scene.getSceneId(), m_subscribersWaitingForScene.size(), sceneUpdate.actions.numberOfActions(),
+            sceneUpdate.actions.collectionData().size(), m_lastFlushResourcesInUse.size(),
+            sceneUpdate.flushInfos.resourceChanges.m_sceneResourceActions.size(), sceneResourcesSize);
 
+        m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<uint32_t>(m_subscribersWaitingForScene.size()));
+        sendToWaitingSubscribers(std::move(sceneUpdate), flushTimeInfo, versionTag);
+    }
+
+    void ClientSceneLogicBase::sendDeferredSceneToWaitingSubscribers(std::function<void(SceneUpdate&, size_t&)> sceneDescription, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    {
+        if (m_subscribersWaitingForScene.empty())
+        {
+            LOG_DEBUG(CONTEXT_CLIENT, "ClientSceneLogicBase::sendDeferredSceneToWaitingSubscribers: No subscribers waiting for scene {}", m_sceneId);
+            return;
+        }
+
+        LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} subscribers, {} client resources, scene description deferred to async flush",
+            m_sceneId, m_subscribersWaitingForScene.size(), m_lastFlushResourcesInUse.size());
+
+        SceneUpdate sceneUpdate;
+        // statistics are owned by client scene which outlives all of its pending async sends
+        sceneUpdate.sceneDescription = [description = std::move(sceneDescription), numSubscribers = static_cast<uint32_t>(m_subscribersWaitingForScene.size()),
+            &statistics = m_scene.getStatisticCollection(), sceneId = m_sceneId](SceneUpdate& update) {
+            size_t sceneResourcesSize = 0u;
+            description(update, sceneResourcesSize);
+            LOG_INFO(CONTEXT_CLIENT, "Described scene {} for new subscribers, {} scene actions ({} bytes), {} scene resource actions ({} bytes in total used by scene resources)",
+                sceneId, update.actions.numberOfActions(), update.actions.collectionData().size(),
+                update.flushInfos.resourceChanges.m_sceneResourceActions.size(), sceneResourcesSize);
+            statistics.statSceneActionsSent.incCounter(update.actions.numberOfActions() * numSubscribers);
+        };
+        sendToWaitingSubscribers(std::move(sceneUpdate), flushTimeInfo, versionTag);
+    }
+
+    void ClientSceneLogicBase::sendToWaitingSubscribers(SceneUpdate&& sceneUpdate, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
+    {
+        m_resourceChangesSinceLastFlush.clear();
         m_resourceChangesSinceLastFlush.m_resourcesAdded = m_lastFlushResourcesInUse;
 
         // flush asynchronously & check if there already was a named flush
         if (!m_resourceChangesSinceLastFlush.m_resourcesAdded.empty())
             sceneUpdate.resources = m_resourceComponent.resolveResources(m_resourceChangesSinceLastFlush.m_resourcesAdded);
         assert(sceneUpdate.resources.size() == m_resourceChangesSinceLastFlush.m_resourcesAdded.size());
-        sceneUpdate.flushInfos = { m_flushCounter, versionTag, scene.getSceneSizeInformation(), m_resourceChangesSinceLastFlush, {}, flushTimeInfo, true, true };
-        LOG_INFO(CONTEXT_CLIENT, "Sending scene {} to {} subscribers, {} scene actions ({} bytes), {} client resources, {} scene resource actions ({} bytes in total used by scene resources)",
-            scene.getSceneId(), m_subscribersWaitingForScene.size(), sceneUpdate.actions.numberOfActions(),
-            sceneUpdate.actions.collectionData().size(), m_resourceChangesSinceLastFlush.m_resourcesAdded.size(),
-            m_resourceChangesSinceLastFlush.m_sceneResourceActions.size(), sceneResourcesSize);
+
+        // size info and scene resource actions are filled when describing the scene
+        FlushInformation& flushInfos = sceneUpdate.flushInfos;
+        flushInfos.flushCounter = m_flushCounter;
+        flushInfos.versionTag = versionTag;
+        flushInfos.resourceChanges.m_resourcesAdded = m_resourceChangesSinceLastFlush.m_resourcesAdded;
+        flushInfos.flushTimeInfo = flushTimeInfo;
+        flushInfos.hasSizeInfo = true;
+        flushInfos.containsValidInformation = true;
 
         assert(m_scenePublicationMode.has_value());
         for(const auto& subscriber : m_subscribersWaitingForScene)
         {
-            SceneInfo sceneInfo{ m_sceneId, scene.getName(), *m_scenePublicationMode, scene.getRenderBackendCompatibility(), scene.getVulkanAPIVersion(), scene.getSPIRVVersion() };
+            SceneInfo sceneInfo{ m_sceneId, m_scene.getName(), *m_scenePublicationMode, m_scene.getRenderBackendCompatibility(), m_scene.getVulkanAPIVersion(), m_scene.getSPIRVVersion() };
             m_scenegraphSender.sendCreateScene(subscriber, sceneInfo);
         }
-        m_scene.getStatisticCollection().statSceneActionsSent.incCounter(sceneUpdate.actions.numberOfActions()*static_cast<uint32_t>(m_subscribersWaitingForScene.size()));
         m_scenegraphSender.sendSceneUpdate(m_subscribersWaitingForScene, std::move(sceneUpdate), m_sceneId, *m_scenePublicationMode, m_scene.getStatisticCollection());
 
         m_subscribersActive.insert(m_subscribersActive.end(), m_subscribersWaitingForScene.begin(), m_subscribersWaitingForScene.end());
@@ -177,6 +248,11 @@ namespace ramses::internal
         }
     }
 
+    void ClientSceneLogicBase::collectMemoryProfile(SceneMemoryProfile& profile) const
+    {
+        SceneMemoryProfileUtils::AddSceneActions(m_preparedActions, "PreparedSceneActions", profile);
+    }
+
     const char* ClientSceneLogicBase::getSceneStateString() const
     {
         if (!m_subscribersActive.empty())
@@ -278,15 +354,39 @@ namespace ramses::internal
         ResourceChangeState result = ResourceChangeState::NoChange;
         if (m_scene.haveResourcesChanged())
         {
+            // resource usage is tracked by scene when modified, only the changes since last flush are applied to resources in use
+            m_scene.getClientResourceUsageChanges(m_resourceChangesSinceLastFlush.m_resourcesAdded, m_resourceChangesSinceLastFlush.m_resourcesRemoved);
             m_currentFlushResourcesInUse.clear();
-            ResourceUtils::GetAllResourcesFromScene(m_currentFlushResourcesInUse, m_scene);
-            ResourceUtils::DiffResources(m_lastFlushResourcesInUse, m_currentFlushResourcesInUse, m_resourceChangesSinceLastFlush);
+            ResourceUtils::ApplyResourceChanges(m_lastFlushResourcesInUse, m_resourceChangesSinceLastFlush, m_currentFlushResourcesInUse);
+#ifndef NDEBUG
+            {
+                ResourceContentHashVector resourcesFromScene;
+                ResourceUtils::GetAllResourcesFromScene(resourcesFromScene, m_scene);
+                assert(resourcesFromScene == m_currentFlushResourcesInUse);
+            }
+#endif
 
             if (!m_resourceChangesSinceLastFlush.m_resourcesAdded.empty())
             {
-                sceneUpdate.resources = m_resourceComponent.resolveResources(m_resourceChangesSinceLastFlush.m_resourcesAdded);
-                if (sceneUpdate.resources.size() != m_resourceChangesSinceLastFlush.m_resourcesAdded.size())
-                    return ResourceChangeState::MissingResource;
+                if (isPublished() && !m_subscribersActive.empty())
+                {
+                    sceneUpdate.resources = m_resourceComponent.resolveResources(m_resourceChangesSinceLastFlush.m_resourcesAdded);
+                    if (sceneUpdate.resources.size() != m_resourceChangesSinceLastFlush.m_resourcesAdded.size())
+                        return ResourceChangeState::MissingResource;
+                }
+                else
+                {
+                    // nobody to send the resources to, only check that they are known (e.g. from table of contents of scene file),
+                    // their data is loaded when scene gets sent to subscriber, resources of a scene never shown are never loaded
+                    for (const auto& hash : m_resourceChangesSinceLastFlush.m_resourcesAdded)
+                    {
+                        if (!m_resourceComponent.knowsResource(hash))
+                        {
+                            LOG_ERROR(CONTEXT_CLIENT, "ClientSceneLogicBase::verifyAndGetResourceChanges: resource {} is unknown", hash);
+                            return ResourceChangeState::MissingResource;
+                        }
+                    }
+                }
             }
 
             updateResourceStatistics();
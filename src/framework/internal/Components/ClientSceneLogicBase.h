@@ -11,7 +11,9 @@
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
 #include <optional>
+#include <functional>
 
 namespace ramses::internal
 {
@@ -35,10 +37,19 @@ namespace ramses::internal
 
         [[nodiscard]] std::vector<Guid> getWaitingAndActiveSubscribers() const;
 
+        // takes over scene actions collected since last flush and does the work which involves only this scene,
+        // can be called without framework lock because it does not touch subscribers or resources of client
+        virtual void prepareFlush();
         virtual bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
 
         [[nodiscard]] const char* getSceneStateString() const;
 
+        // adds memory kept by scene logic in addition to the client scene itself
+        virtual void collectMemoryProfile(SceneMemoryProfile& profile) const;
+
+        // scene updates are sent by async flush worker, scene sent to new subscribers may then be described there too
+        void enableAsyncSceneDescription();
+
     protected:
         enum class ResourceChangeState {
             MissingResource,
@@ -48,6 +59,9 @@ namespace ramses::internal
 
         virtual void postAddSubscriber() {};
         void sendSceneToWaitingSubscribers(const IScene& scene, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        // scene is described only when update is sent, description must not touch anything owned by this scene logic
+        void sendDeferredSceneToWaitingSubscribers(std::function<void(SceneUpdate&, size_t&)> sceneDescription, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
+        static void DescribeScene(const IScene& scene, EFeatureLevel featureLevel, SceneUpdate& sceneUpdate, size_t& sceneResourcesSize);
         void printFlushInfo(StringOutputStream& sos, const char* name, const SceneUpdate& update) const;
         ResourceChangeState verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
         void updateResourceStatistics();
@@ -70,14 +84,19 @@ namespace ramses::internal
         ResourceContentHashVector m_lastFlushResourcesInUse;
         FlushTime::Clock::time_point m_lastFlushedExpirationTimestamp{ FlushTime::InvalidTimestamp };
 
-        ResourceChanges m_resourceChangesSinceLastFlush; // keep container memory allocated
+        ResourceChanges m_resourceChangesSinceLastFlush; // moved into flush information when flushed to subscribers
         ResourceContentHashVector m_currentFlushResourcesInUse; // keep container memory allocated
+        SceneActionCollection m_preparedActions; // scene actions taken over from scene by prepareFlush, sent with next flush
 
         EFeatureLevel m_featureLevel = EFeatureLevel_Latest;
+        bool m_asyncSceneDescription = false;
 
         // resource statistics gathered while flushing the last time
         std::array<uint64_t, EResourceStatisticIndex_NumIndices> m_resourceCount{};
         std::array<uint64_t, EResourceStatisticIndex_NumIndices> m_resourceDataSize{};
         std::array<uint64_t, EResourceStatisticIndex_NumIndices> m_resourceMaxSize{};
+
+    private:
+        void sendToWaitingSubscribers(SceneUpdate&& sceneUpdate, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag);
     };
 }
@@ -29,7 +29,9 @@ namespace ramses::internal
 
     bool ClientSceneLogicDirect::flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
-        const bool hasNewActions = !m_scene.getSceneActionCollection().empty();
+        // usually done already without framework lock, only picks up what was not prepared
+        prepareFlush();
+        const bool hasNewActions = !m_preparedActions.empty();
 
         SceneUpdate sceneUpdate;
         const auto resourceChangeState = verifyAndGetResourceChanges(sceneUpdate, hasNewActions);
@@ -43,8 +45,8 @@ namespace ramses::internal
         fillStatisticsCollection();
         const SceneSizeInformation sceneSizes(m_scene.getSceneSizeInformation());
 
-        // swap out of ClientScene and reserve new memory there
-        sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        // prepared actions were swapped out of ClientScene, new memory is reserved there below
+        sceneUpdate.actions.swap(m_preparedActions);
 
         if (m_flushCounter == 0)
         {
@@ -66,7 +68,8 @@ namespace ramses::internal
         if (isPublished())
         {
             const bool addSizeInfo = sceneSizes > m_previousSceneSizes;
-            sceneUpdate.flushInfos = { m_flushCounter, versionTag, addSizeInfo?sceneSizes: SceneSizeInformation(), m_resourceChangesSinceLastFlush, m_scene.getSceneReferenceActions(), flushTimeInfo, addSizeInfo, true};
+            // resource changes are handed over without copying, they are collected anew in next flush
+            sceneUpdate.flushInfos = { m_flushCounter, versionTag, addSizeInfo?sceneSizes: SceneSizeInformation(), std::move(m_resourceChangesSinceLastFlush), m_scene.getSceneReferenceActions(), flushTimeInfo, addSizeInfo, true};
             m_previousSceneSizes = sceneSizes;
         }
 
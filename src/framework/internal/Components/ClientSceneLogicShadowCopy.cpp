@@ -11,6 +11,7 @@
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/SceneDescriber.h"
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/StatisticCollection.h"
@@ -22,9 +23,10 @@ namespace ramses::internal
 {
     ClientSceneLogicShadowCopy::ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, EFeatureLevel featureLevel)
         : ClientSceneLogicBase(sceneGraphSender, scene, res, clientAddress, featureLevel)
-        , m_sceneShadowCopy(SceneInfo{ scene.getSceneId(), scene.getName(), EScenePublicationMode::LocalOnly, scene.getRenderBackendCompatibility(), scene.getVulkanAPIVersion(), scene.getSPIRVVersion() })
+        , m_sceneShadowCopy(std::make_shared<ShadowCopy>(SceneInfo{ scene.getSceneId(), scene.getName(), EScenePublicationMode::LocalOnly, scene.getRenderBackendCompatibility(), scene.getVulkanAPIVersion(), scene.getSPIRVVersion() }))
+        , m_sceneSizesOfLastFlush(m_scene.getSceneSizeInformation())
     {
-        m_sceneShadowCopy.preallocateSceneSize(m_scene.getSceneSizeInformation());
+        m_sceneShadowCopy->scene.preallocateSceneSize(m_sceneSizesOfLastFlush);
     }
 
     void ClientSceneLogicShadowCopy::postAddSubscriber()
@@ -32,9 +34,32 @@ namespace ramses::internal
         sendShadowCopySceneToWaitingSubscribers();
     }
 
+    void ClientSceneLogicShadowCopy::collectMemoryProfile(SceneMemoryProfile& profile) const
+    {
+        ClientSceneLogicBase::collectMemoryProfile(profile);
+
+        PlatformGuard guard(m_shadowCopyLock);
+        // shadow copy is in use by pending scene description, it is profiled with next collection
+        if (m_sceneShadowCopy->pendingDescriptions.load(std::memory_order_acquire) == 0u)
+            SceneMemoryProfileUtils::AddScenePools(m_sceneShadowCopy->scene, "ShadowCopy.", profile);
+        SceneMemoryProfileUtils::AddSceneActions(m_actionsPendingForShadowCopy, "ShadowCopy.PendingSceneActions", profile);
+    }
+
+    void ClientSceneLogicShadowCopy::prepareFlush()
+    {
+        ClientSceneLogicBase::prepareFlush();
+
+        // applying is the most expensive part of flush, doing it here lets other scenes flush meanwhile
+        PlatformGuard guard(m_shadowCopyLock);
+        if (m_actionsPendingForShadowCopy.collectionData().size() > MaxPendingShadowCopyActionsSize)
+            applyPendingActionsToShadowCopy();
+    }
+
     bool ClientSceneLogicShadowCopy::flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
-        const bool hasNewActions = !m_scene.getSceneActionCollection().empty();
+        // usually done already without framework lock, only picks up what was not prepared
+        prepareFlush();
+        const bool hasNewActions = !m_preparedActions.empty();
 
         SceneUpdate sceneUpdate;
         const auto resourceChangeState = verifyAndGetResourceChanges(sceneUpdate, hasNewActions);
@@ -48,10 +73,28 @@ namespace ramses::internal
         fillStatisticsCollection();
         const SceneSizeInformation sceneSizes(m_scene.getSceneSizeInformation());
 
-        // swap out of ClientScene and reserve new memory there
-        sceneUpdate.actions.swap(m_scene.getSceneActionCollection());
+        // prepared actions were swapped out of ClientScene, new memory is reserved there below
+        sceneUpdate.actions.swap(m_preparedActions);
         if (resourceChangeState == ResourceChangeState::HasChanges)
-            m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushResourcesInUse); // keep ll resources alive, in case we need to send a scene update to a new subscriber
+        {
+            // keep all resources alive, in case we need to send a scene update to a new subscriber,
+            // without any subscriber only resources already in memory are kept (client might release them till first one subscribes),
+            // resources not loaded yet are loaded from their file when first subscriber is added
+            if (isPublished() && !m_subscribersActive.empty())
+            {
+                m_lastFlushUsedResources = m_resourceComponent.resolveResources(m_lastFlushResourcesInUse);
+            }
+            else
+            {
+                m_lastFlushUsedResources.clear();
+                for (const auto& hash : m_lastFlushResourcesInUse)
+                {
+                    ManagedResource resource = m_resourceComponent.getResource(hash);
+                    if (resource)
+                        m_lastFlushUsedResources.push_back(std::move(resource));
+                }
+            }
+        }
 
         if (m_flushCounter == 0)
         {
@@ -70,16 +113,21 @@ namespace ramses::internal
 
         ++m_flushCounter;
 
+        // resource changes are handed over without copying, they are collected anew in next flush
         if (isPublished())
-            sceneUpdate.flushInfos = { m_flushCounter, versionTag, sceneSizes, m_resourceChangesSinceLastFlush, m_scene.getSceneReferenceActions(), flushTimeInfo,sceneSizes > m_sceneShadowCopy.getSceneSizeInformation(), true };
+            sceneUpdate.flushInfos = { m_flushCounter, versionTag, sceneSizes, std::move(m_resourceChangesSinceLastFlush), m_scene.getSceneReferenceActions(), flushTimeInfo,sceneSizes > m_sceneSizesOfLastFlush, true };
 
         // reserve memory in ClientScene after flush because flush might add a lot of data
         m_scene.getSceneActionCollection().reserveAdditionalCapacity(sceneUpdate.actions.collectionData().size(), sceneUpdate.actions.numberOfActions());
 
         if (hasNewActions)
         {
-            m_sceneShadowCopy.preallocateSceneSize(sceneSizes);
-            SceneActionApplier::ApplyActionsOnScene(m_sceneShadowCopy, sceneUpdate.actions, m_featureLevel);
+            {
+                // applied when too many are pending in next prepareFlush, or when sending scene to new subscriber
+                PlatformGuard guard(m_shadowCopyLock);
+                m_actionsPendingForShadowCopy.append(sceneUpdate.actions);
+                m_sceneSizesOfLastFlush = sceneSizes;
+            }
             m_scene.getStatisticCollection().statSceneActionsGenerated.incCounter(sceneUpdate.actions.numberOfActions());
             m_scene.getStatisticCollection().statSceneActionsGeneratedSize.incCounter(static_cast<uint32_t>(sceneUpdate.actions.collectionData().size()));
         }
@@ -135,6 +183,55 @@ namespace ramses::internal
             m_flushTimeInfoOfLastFlush.isEffectTimeSync = true;
         }
 
-        sendSceneToWaitingSubscribers(m_sceneShadowCopy, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+        PlatformGuard guard(m_shadowCopyLock);
+        if (m_asyncSceneDescription)
+        {
+            describeShadowCopyDeferred();
+            return;
+        }
+
+        if (!m_subscribersWaitingForScene.empty())
+            applyPendingActionsToShadowCopy();
+        sendSceneToWaitingSubscribers(m_sceneShadowCopy->scene, m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+    }
+
+    void ClientSceneLogicShadowCopy::describeShadowCopyDeferred()
+    {
+        if (m_subscribersWaitingForScene.empty())
+            return;
+
+        // pending actions are taken over by the description, it brings the shadow copy to the state of last flush when it runs,
+        // later flushes stay pending until all descriptions ran because they must be applied after
+        auto actions = std::make_shared<SceneActionCollection>();
+        actions->swap(m_actionsPendingForShadowCopy);
+        m_sceneShadowCopy->pendingDescriptions.fetch_add(1u, std::memory_order_relaxed);
+
+        auto description = [shadowCopy = m_sceneShadowCopy, actions, sceneSizes = m_sceneSizesOfLastFlush, featureLevel = m_featureLevel](SceneUpdate& update, size_t& sceneResourcesSize) {
+            if (!actions->empty())
+            {
+                SceneActionCoalescer::CoalesceActions(*actions);
+                shadowCopy->scene.preallocateSceneSize(sceneSizes);
+                SceneActionApplier::ApplyActionsOnScene(shadowCopy->scene, *actions, featureLevel);
+                actions->clear();
+            }
+            DescribeScene(shadowCopy->scene, featureLevel, update, sceneResourcesSize);
+            shadowCopy->pendingDescriptions.fetch_sub(1u, std::memory_order_release);
+        };
+        sendDeferredSceneToWaitingSubscribers(std::move(description), m_flushTimeInfoOfLastFlush, m_lastVersionTag);
+    }
+
+    void ClientSceneLogicShadowCopy::applyPendingActionsToShadowCopy()
+    {
+        if (m_actionsPendingForShadowCopy.empty())
+            return;
+
+        // a pending scene description applies actions taken over before, these must stay pending to keep order
+        if (m_sceneShadowCopy->pendingDescriptions.load(std::memory_order_acquire) != 0u)
+            return;
+
+        SceneActionCoalescer::CoalesceActions(m_actionsPendingForShadowCopy);
+        m_sceneShadowCopy->scene.preallocateSceneSize(m_sceneSizesOfLastFlush);
+        SceneActionApplier::ApplyActionsOnScene(m_sceneShadowCopy->scene, m_actionsPendingForShadowCopy, m_featureLevel);
+        m_actionsPendingForShadowCopy.clear();
     }
 }
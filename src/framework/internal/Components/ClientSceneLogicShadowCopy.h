@@ -11,6 +11,10 @@
 #include "internal/Components/ClientSceneLogicBase.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/Components/ManagedResource.h"
+#include "internal/PlatformAbstraction/PlatformLock.h"
+
+#include <atomic>
+#include <memory>
 
 namespace ramses::internal
 {
@@ -19,13 +23,39 @@ namespace ramses::internal
     public:
         ClientSceneLogicShadowCopy(ISceneGraphSender& sceneGraphSender, ClientScene& scene, IResourceProviderComponent& res, const Guid& clientAddress, EFeatureLevel featureLevel);
 
+        void prepareFlush() override;
         bool flushSceneActions(const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
+        void collectMemoryProfile(SceneMemoryProfile& profile) const override;
 
     private:
         void postAddSubscriber() override;
         void sendShadowCopySceneToWaitingSubscribers();
+        void applyPendingActionsToShadowCopy();
+        void describeShadowCopyDeferred();
+
+        // flushed actions are applied to shadow copy only when it is needed for new subscriber or when too many are collected,
+        // most flushes (e.g. animations) are then not applied twice and overwritten values are coalesced before applying
+        static constexpr size_t MaxPendingShadowCopyActionsSize = 4u * 1024u * 1024u;
+
+        // shadow copy is shared with scene descriptions pending on async flush worker, while any is pending
+        // only those modify and read the shadow copy, in send order, and flushed actions are kept pending meanwhile
+        struct ShadowCopy
+        {
+            explicit ShadowCopy(const SceneInfo& sceneInfo)
+                : scene(sceneInfo)
+            {
+            }
+
+            SceneWithExplicitMemory scene;
+            std::atomic<uint32_t> pendingDescriptions{ 0u };
+        };
 
-        SceneWithExplicitMemory m_sceneShadowCopy;
+        // guards shadow copy and actions pending for it, these are applied in prepareFlush without framework lock
+        // while a new subscriber can get the shadow copy sent with framework lock held
+        mutable PlatformLock m_shadowCopyLock;
+        std::shared_ptr<ShadowCopy> m_sceneShadowCopy;
+        SceneActionCollection m_actionsPendingForShadowCopy;
+        SceneSizeInformation m_sceneSizesOfLastFlush;
         FlushTimeInformation m_flushTimeInfoOfLastFlush;
         FlushTime::Clock::time_point m_effectTimeSync{FlushTime::InvalidTimestamp};
         SceneVersionTag m_lastVersionTag;
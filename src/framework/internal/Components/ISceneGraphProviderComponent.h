@@ -14,6 +14,8 @@
 #include "internal/SceneGraph/SceneAPI/Handles.h"
 #include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 
+#include <vector>
+
 namespace ramses::internal
 {
     class Guid;
@@ -21,6 +23,9 @@ namespace ramses::internal
     class ISceneProviderServiceHandler;
     class ISceneProviderEventConsumer;
     struct FlushTimeInformation;
+    class AsyncSceneUpdateSender;
+    struct SceneMemoryProfileEntry;
+    using SceneMemoryProfile = std::vector<SceneMemoryProfileEntry>;
 
     class ISceneGraphProviderComponent
     {
@@ -29,7 +34,15 @@ namespace ramses::internal
         virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventInterface) = 0;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) = 0;
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
+        // scene local part of flush, called without framework lock so that scenes can be flushed from multiple threads concurrently
+        virtual void handlePrepareFlush(SceneId sceneId) = 0;
         virtual bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
         virtual void handleRemoveScene(SceneId sceneId) = 0;
+        // scene updates of given scene are then sent by worker, sender must outlive the scene
+        virtual void handleEnableAsyncFlush(SceneId sceneId, AsyncSceneUpdateSender& sender) = 0;
+        virtual void handleEnableHighPriorityUpdates(SceneId sceneId) = 0;
+        virtual void handleEnableSceneActionDeltaEncoding(SceneId sceneId, uint32_t transformQuantizationBits) = 0;
+        // memory kept for distribution of given scene (prepared actions, shadow copy)
+        virtual void collectSceneMemoryProfile(SceneId sceneId, SceneMemoryProfile& profile) const = 0;
     };
 }
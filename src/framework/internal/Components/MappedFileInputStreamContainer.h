@@ -0,0 +1,42 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/InputStreamContainer.h"
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+
+#include <string_view>
+
+namespace ramses::internal
+{
+    class MappedFileInputStreamContainer : public IInputStreamContainer
+    {
+    public:
+        explicit MappedFileInputStreamContainer(std::string_view filename)
+            : m_stream(filename)
+        {}
+
+        MappedFileInputStreamContainer(int fd, size_t offset, size_t length)
+            : m_stream(fd, offset, length)
+        {}
+
+        IInputStream& getStream() override
+        {
+            return m_stream;
+        }
+
+        [[nodiscard]] bool isMapped() const
+        {
+            return m_stream.isMapped();
+        }
+
+    private:
+        BinaryMappedFileInputStream m_stream;
+    };
+}
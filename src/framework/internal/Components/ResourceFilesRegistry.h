@@ -15,6 +15,7 @@
 #include "internal/Components/InputStreamContainer.h"
 #include "internal/Core/Utils/File.h"
 #include "internal/PlatformAbstraction/Collections/Pair.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/Components/SceneFileHandle.h"
 
 #include <algorithm>
@@ -20,9 +20,75 @@
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/Components/SingleResourceSerialization.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 namespace ramses::internal
 {
+    namespace
+    {
+        // Resources to compress shared by the saving thread and the compression tasks, every resource is compressed
+        // by whoever picks it first. Tasks keep the state alive, they might get executed only after all resources were compressed.
+        class ResourceCompressionJobs
+        {
+        public:
+            ResourceCompressionJobs(const ManagedResourceVector& resources, IResource::CompressionLevel level)
+                : m_resources(resources)
+                , m_level(level)
+            {
+            }
+
+            void compressRemaining()
+            {
+                for (size_t idx = m_nextIndex++; idx < m_resources.size(); idx = m_nextIndex++)
+                {
+                    m_resources[idx]->compress(m_level);
+                    if (++m_numCompressed == m_resources.size())
+                    {
+                        std::lock_guard<std::mutex> l(m_mutex);
+                        m_allCompressed.notify_all();
+                    }
+                }
+            }
+
+            void waitUntilAllCompressed()
+            {
+                std::unique_lock<std::mutex> l(m_mutex);
+                m_allCompressed.wait(l, [&] { return m_numCompressed == m_resources.size(); });
+            }
+
+        private:
+            const ManagedResourceVector m_resources;
+            const IResource::CompressionLevel m_level;
+            std::atomic<size_t> m_nextIndex{ 0u };
+            std::atomic<size_t> m_numCompressed{ 0u };
+            std::mutex m_mutex;
+            std::condition_variable m_allCompressed;
+        };
+
+        class ResourceCompressionTask : public ITask
+        {
+        public:
+            explicit ResourceCompressionTask(std::shared_ptr<ResourceCompressionJobs> jobs)
+                : m_jobs(std::move(jobs))
+            {
+            }
+
+            void execute() override
+            {
+                m_jobs->compressRemaining();
+            }
+
+        private:
+            std::shared_ptr<ResourceCompressionJobs> m_jobs;
+        };
+    }
+
     void ResourcePersistation::WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource)
     {
         SingleResourceSerialization::SerializeResource(outStream, *resource.get());
@@ -33,7 +99,29 @@ namespace ramses::internal
         return SingleResourceSerialization::DeserializeResource(inStream, hash, featureLevel);
     }
 
-    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress)
+    void ResourcePersistation::CompressResources(const ManagedResourceVector& resources, IResource::CompressionLevel level, ITaskQueue* taskQueue)
+    {
+        if (taskQueue == nullptr || level == IResource::CompressionLevel::None || resources.size() < 2u)
+        {
+            for (const auto& res : resources)
+                res->compress(level);
+            return;
+        }
+
+        // calling thread takes part in compression, so it never waits on tasks which the queue did not get to yet
+        auto jobs = std::make_shared<ResourceCompressionJobs>(resources, level);
+        const size_t numTasks = std::min(resources.size() - 1u, MaxParallelCompressionTasks);
+        for (size_t i = 0u; i < numTasks; ++i)
+        {
+            auto task = new ResourceCompressionTask(jobs);
+            taskQueue->enqueue(*task);
+            task->release();
+        }
+        jobs->compressRemaining();
+        jobs->waitUntilAllCompressed();
+    }
+
+    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress, ITaskQueue* compressionTaskQueue)
     {
         // achieve maximum resource file loading speed by reading in increasing file position order
         // so store TOC first followed by all resources, as the toc is read before the resources
@@ -50,10 +138,7 @@ namespace ramses::internal
         uint32_t currentPosAfterWrite = 0;
 
         // possible compress all resources before writing
-        for (const auto& res : resourcesForFile)
-        {
-            res->compress(compress ? IResource::CompressionLevel::Offline : IResource::CompressionLevel::None);
-        }
+        CompressResources(resourcesForFile, compress ? IResource::CompressionLevel::Offline : IResource::CompressionLevel::None, compressionTaskQueue);
 
         for (const auto& res : resourcesForFile)
         {
@@ -11,6 +11,7 @@
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include "ManagedResource.h"
 #include "internal/PlatformAbstraction/Collections/Pair.h"
+#include "internal/SceneGraph/Resource/IResource.h"
 #include "ramses/framework/EFeatureLevel.h"
 #include <memory>
 
@@ -20,14 +21,19 @@ namespace ramses::internal
     class IInputStream;
     class BinaryFileOutputStream;
     struct ResourceFileEntry;
+    class ITaskQueue;
 
     class ResourcePersistation
     {
     public:
-        static void WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress);
+        // if task queue is given resources are compressed in parallel by tasks enqueued to it and the calling thread
+        static void WriteNamedResourcesWithTOCToStream(IOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress, ITaskQueue* compressionTaskQueue = nullptr);
+        static void CompressResources(const ManagedResourceVector& resources, IResource::CompressionLevel level, ITaskQueue* taskQueue);
         static void WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource);
 
         static std::unique_ptr<IResource> ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash, EFeatureLevel featureLevel);
         static std::unique_ptr<IResource> RetrieveResourceFromStream(IInputStream& inStream, const ResourceFileEntry& entry, EFeatureLevel featureLevel);
+
+        static constexpr size_t MaxParallelCompressionTasks = 4u;
     };
 }
@@ -14,7 +14,7 @@
 #include "internal/Components/ResourceHashUsage.h"
 #include "internal/Components/IResourceHashUsageCallback.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
-#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
 #include "internal/SceneGraph/Resource/ResourceInfo.h"
 #include "internal/Core/Utils/StatisticCollection.h"
 
@@ -59,7 +59,7 @@ namespace ramses::internal
         PlatformLock& m_resourceMapLock;
         StatisticCollectionFramework& m_statistics;
 
-        using ResourceMap = HashMap<ResourceContentHash, RefCntResource>;
+        using ResourceMap = FlatHashMap<ResourceContentHash, RefCntResource>;
         ResourceMap m_resourceMap;
     };
 }
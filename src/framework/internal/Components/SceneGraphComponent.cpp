@@ -18,11 +18,16 @@
 #include "internal/Components/ISceneRendererHandler.h"
 #include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
 #include "internal/Components/SceneUpdate.h"
+#include "internal/Components/AsyncSceneUpdateSender.h"
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 #include "internal/Components/ResourceAvailabilityEvent.h"
 #include "internal/Components/IResourceProviderComponent.h"
 #include "internal/Components/SceneUpdate.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+
 namespace ramses::internal
 {
     SceneGraphComponent::SceneGraphComponent(
@@ -90,6 +95,22 @@ namespace ramses::internal
     }
 
     void SceneGraphComponent::sendCreateScene(const Guid& to, const SceneInfo& sceneInfo)
+    {
+        // must not overtake scene updates still pending for previous subscription of same recipient
+        const auto asyncSender = m_asyncSceneUpdateSenders.find(sceneInfo.sceneID);
+        if (asyncSender != m_asyncSceneUpdateSenders.end())
+        {
+            asyncSender->second->enqueue([this, to, sceneInfo]() {
+                PlatformGuard guard(m_frameworkLock);
+                sendCreateSceneNow(to, sceneInfo);
+            });
+            return;
+        }
+
+        sendCreateSceneNow(to, sceneInfo);
+    }
+
+    void SceneGraphComponent::sendCreateSceneNow(const Guid& to, const SceneInfo& sceneInfo)
     {
         LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::sendCreateScene: sceneId {}, to {}", sceneInfo.sceneID, to);
 
@@ -117,15 +138,47 @@ namespace ramses::internal
         else
         {
             assert(sceneInfo.publicationMode != EScenePublicationMode::LocalOnly);
+            const auto deltaEncodedScene = m_deltaEncodedScenes.find(sceneInfo.sceneID);
+            if (deltaEncodedScene != m_deltaEncodedScenes.end())
+                deltaEncodedScene->second.subscribersWaitingForScene.put(to);
             m_communicationSystem.sendInitializeScene(to, sceneInfo.sceneID);
         }
     }
 
     void SceneGraphComponent::sendSceneUpdate(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, EScenePublicationMode /*mode*/, StatisticCollectionScene& sceneStatistics)
+    {
+        const auto asyncSender = m_asyncSceneUpdateSenders.find(sceneId);
+        if (asyncSender != m_asyncSceneUpdateSenders.end())
+        {
+            // std::function must be copyable, update is moved out of shared pointer when sent
+            auto update = std::make_shared<SceneUpdate>(std::move(sceneUpdate));
+            asyncSender->second->enqueue([this, toVec, update, sceneId, &sceneStatistics]() {
+                // describing a whole scene for new subscribers is expensive, it is done here without framework lock
+                if (update->sceneDescription)
+                    std::exchange(update->sceneDescription, {})(*update);
+                // compress before taking framework lock, compressed data is cached in resource for later sends
+                if (std::any_of(toVec.cbegin(), toVec.cend(), [this](const Guid& to) { return to != m_myID; }))
+                {
+                    for (auto& resource : update->resources)
+                        resource->compress(IResource::CompressionLevel::Realtime);
+                }
+                PlatformGuard guard(m_frameworkLock);
+                sendSceneUpdateNow(toVec, std::move(*update), sceneId, sceneStatistics);
+            });
+            return;
+        }
+
+        if (sceneUpdate.sceneDescription)
+            std::exchange(sceneUpdate.sceneDescription, {})(sceneUpdate);
+        sendSceneUpdateNow(toVec, std::move(sceneUpdate), sceneId, sceneStatistics);
+    }
+
+    void SceneGraphComponent::sendSceneUpdateNow(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, StatisticCollectionScene& sceneStatistics)
     {
         // send to network (no ownership transfer)
         bool sendToSelf = false;
-        bool alreadyCompressed = false;
+        std::vector<Guid> remoteRecipients;
+        remoteRecipients.reserve(toVec.size());
         for (const auto& to : toVec)
         {
             if (m_myID == to)
@@ -134,16 +187,40 @@ namespace ramses::internal
             }
             else
             {
-                if (!alreadyCompressed)
+                remoteRecipients.push_back(to);
+            }
+        }
+
+        if (!remoteRecipients.empty())
+        {
+            for (auto& resource : sceneUpdate.resources)
+            {
+                resource->compress(IResource::CompressionLevel::Realtime);
+            }
+
+            SceneActionCollection encodedActions;
+            const auto deltaEncodedScene = m_deltaEncodedScenes.find(sceneId);
+            if (deltaEncodedScene != m_deltaEncodedScenes.end())
+            {
+                auto& waitingSubscribers = deltaEncodedScene->second.subscribersWaitingForScene;
+                if (std::any_of(remoteRecipients.cbegin(), remoteRecipients.cend(), [&](const Guid& to) { return waitingSubscribers.contains(to); }))
                 {
-                    for (auto& resource : sceneUpdate.resources)
-                    {
-                        resource->compress(IResource::CompressionLevel::Realtime);
-                    }
-                    alreadyCompressed = true;
+                    // scene dump is sent plain, following updates must not refer to values the new subscribers never got
+                    for (const auto& to : remoteRecipients)
+                        waitingSubscribers.remove(to);
+                    deltaEncodedScene->second.encoder.reset();
+                }
+                else if (deltaEncodedScene->second.encoder.encode(sceneUpdate.actions, encodedActions))
+                {
+                    sceneUpdate.actions.swap(encodedActions);
                 }
-                m_communicationSystem.sendSceneUpdate(to, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics, m_featureLevel));
             }
+
+            m_communicationSystem.sendSceneUpdate(remoteRecipients, sceneId, SceneUpdateSerializer(sceneUpdate, sceneStatistics, m_featureLevel));
+
+            // local renderer gets original actions
+            if (!encodedActions.empty())
+                sceneUpdate.actions.swap(encodedActions);
         }
 
         // send to self last to move sceneUpdate to local renderer
@@ -327,6 +404,20 @@ namespace ramses::internal
         sceneLogic.unpublish();
     }
 
+    void SceneGraphComponent::handlePrepareFlush(SceneId sceneId)
+    {
+        ClientSceneLogicBase* sceneLogic = nullptr;
+        {
+            // scenes might be created or removed by other threads meanwhile
+            PlatformGuard guard(m_frameworkLock);
+            assert(m_clientSceneLogicMap.contains(sceneId));
+            sceneLogic = *m_clientSceneLogicMap.get(sceneId);
+        }
+
+        // scene logic is removed only by the thread owning the scene, which is the one flushing it
+        sceneLogic->prepareFlush();
+    }
+
     bool SceneGraphComponent::handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag)
     {
         assert(m_clientSceneLogicMap.contains(sceneId));
@@ -343,9 +434,42 @@ namespace ramses::internal
         assert(sceneLogic != nullptr);
         m_clientSceneLogicMap.remove(sceneId);
         m_sceneEventConsumers.remove(sceneId);
+        m_asyncSceneUpdateSenders.erase(sceneId);
+        if (m_highPriorityScenes.remove(sceneId))
+            m_communicationSystem.setHighPriorityScene(sceneId, false);
+        m_deltaEncodedScenes.erase(sceneId);
         delete sceneLogic;
     }
 
+    void SceneGraphComponent::handleEnableAsyncFlush(SceneId sceneId, AsyncSceneUpdateSender& sender)
+    {
+        LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleEnableAsyncFlush: {}, max pending flushes {}", sceneId, sender.getMaxPendingSends());
+        assert(m_clientSceneLogicMap.contains(sceneId));
+        m_asyncSceneUpdateSenders[sceneId] = &sender;
+        (*m_clientSceneLogicMap.get(sceneId))->enableAsyncSceneDescription();
+    }
+
+    void SceneGraphComponent::handleEnableHighPriorityUpdates(SceneId sceneId)
+    {
+        LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleEnableHighPriorityUpdates: {}", sceneId);
+        assert(m_clientSceneLogicMap.contains(sceneId));
+        m_highPriorityScenes.put(sceneId);
+        m_communicationSystem.setHighPriorityScene(sceneId, true);
+    }
+
+    void SceneGraphComponent::handleEnableSceneActionDeltaEncoding(SceneId sceneId, uint32_t transformQuantizationBits)
+    {
+        LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleEnableSceneActionDeltaEncoding: {}, transform quantization bits {}", sceneId, transformQuantizationBits);
+        assert(m_clientSceneLogicMap.contains(sceneId));
+        m_deltaEncodedScenes.emplace(sceneId, DeltaEncodedScene{ transformQuantizationBits });
+    }
+
+    void SceneGraphComponent::collectSceneMemoryProfile(SceneId sceneId, SceneMemoryProfile& profile) const
+    {
+        if (const auto* sceneLogic = getClientSceneLogicForScene(sceneId))
+            sceneLogic->collectMemoryProfile(profile);
+    }
+
     void SceneGraphComponent::handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID)
     {
         ClientSceneLogicBase** sceneLogic = m_clientSceneLogicMap.get(sceneId);
@@ -513,6 +637,7 @@ namespace ramses::internal
         // start with fresh deinitializer
         // TODO(tobias) should already be cleared when unsub was sent ou for this scene
         it->second.sceneUpdateDeserializer = std::make_unique<SceneUpdateStreamDeserializer>(m_featureLevel);
+        it->second.sceneActionDecoder = SceneActionDeltaDecoder{};
 
         m_sceneRendererHandler->handleInitializeScene(it->second.info, providerID);
     }
@@ -562,6 +687,11 @@ namespace ramses::internal
             {
                 SceneUpdate sceneUpdate;
                 sceneUpdate.actions = std::move(result.actions);
+                if (!it->second.sceneActionDecoder.decode(sceneUpdate.actions))
+                {
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleSceneUpdate: decoding of delta encoded scene actions failed for scene: {} from provider:{}", sceneId, providerID);
+                    break;
+                }
                 sceneUpdate.resources.insert(sceneUpdate.resources.end(), std::make_move_iterator(result.resources.begin()), std::make_move_iterator(result.resources.end()));
                 sceneUpdate.flushInfos = std::move(result.flushInfos);
                 m_sceneRendererHandler->handleSceneUpdate(sceneId, std::move(sceneUpdate), providerID);
@@ -593,7 +723,7 @@ namespace ramses::internal
                 {
                     LOG_INFO(CONTEXT_FRAMEWORK, "SceneGraphComponent::handleNewScenesAvailable: scene published: {} @ {} name:{} publicationmode: {}", newScene.sceneID.getValue(), providerID, newScene.friendlyName, EnumToString(newScene.publicationMode));
 
-                    m_remoteScenes[newScene.sceneID] = ReceivedScene{ newScene, providerID, nullptr };
+                    m_remoteScenes[newScene.sceneID] = ReceivedScene{ newScene, providerID, nullptr, {} };
 
                     assert(newScene.publicationMode == EScenePublicationMode::LocalAndRemote);
                     if (m_sceneRendererHandler)
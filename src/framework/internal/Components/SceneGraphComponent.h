@@ -20,6 +20,7 @@
 #include "ERendererToClientEventType.h"
 #include "ramses/framework/EFeatureLevel.h"
 #include "internal/Core/Utils/IPeriodicLogSupplier.h"
+#include "internal/SceneGraph/Scene/SceneActionDeltaEncoder.h"
 #include "internal/PlatformAbstraction/PlatformLock.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include "internal/PlatformAbstraction/Collections/HashSet.h"
@@ -36,6 +37,7 @@ namespace ramses::internal
     class ISceneRendererHandler;
     class SceneUpdateStreamDeserializer;
     class IResourceProviderComponent;
+    class StatisticCollectionScene;
 
     class SceneGraphComponent final : public ISceneGraphProviderComponent,
                                       public ISceneGraphSender,
@@ -77,8 +79,13 @@ namespace ramses::internal
         void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer) override;
         void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) override;
         void handleUnpublishScene(SceneId sceneId) override;
+        void handlePrepareFlush(SceneId sceneId) override;
         bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) override;
         void handleRemoveScene(SceneId sceneId) override;
+        void handleEnableAsyncFlush(SceneId sceneId, AsyncSceneUpdateSender& sender) override;
+        void handleEnableHighPriorityUpdates(SceneId sceneId) override;
+        void handleEnableSceneActionDeltaEncoding(SceneId sceneId, uint32_t transformQuantizationBits) override;
+        void collectSceneMemoryProfile(SceneId sceneId, SceneMemoryProfile& profile) const override;
 
         // ISceneProviderServiceHandler
         void handleSubscribeScene(const SceneId& sceneId, const Guid& consumerID) override;
@@ -102,6 +109,8 @@ namespace ramses::internal
         [[nodiscard]] const ClientSceneLogicBase* getClientSceneLogicForScene(SceneId sceneId) const;
 
     private:
+        void sendCreateSceneNow(const Guid& to, const SceneInfo& sceneInfo);
+        void sendSceneUpdateNow(const std::vector<Guid>& toVec, SceneUpdate&& sceneUpdate, SceneId sceneId, StatisticCollectionScene& sceneStatistics);
         void forwardToSceneProviderEventConsumer(SceneReferenceEvent const& event);
         void forwardToSceneProviderEventConsumer(ResourceAvailabilityEvent const& event);
 
@@ -120,6 +129,24 @@ namespace ramses::internal
         using SceneEventConsumerMap = HashMap<SceneId, ISceneProviderEventConsumer *>;
         SceneEventConsumerMap m_sceneEventConsumers;
 
+        // scenes flushed asynchronously, their create and update messages are sent by worker in order
+        std::unordered_map<SceneId, AsyncSceneUpdateSender*> m_asyncSceneUpdateSenders;
+        HashSet<SceneId> m_highPriorityScenes;
+
+        // scenes sending value setters delta encoded to remote subscribers,
+        // a subscriber which got create scene receives its scene dump unencoded and the encoder starts over with keyframes
+        struct DeltaEncodedScene
+        {
+            explicit DeltaEncodedScene(uint32_t transformQuantizationBits)
+                : encoder(transformQuantizationBits)
+            {
+            }
+
+            SceneActionDeltaEncoder encoder;
+            HashSet<Guid> subscribersWaitingForScene;
+        };
+        std::unordered_map<SceneId, DeltaEncodedScene> m_deltaEncodedScenes;
+
         IResourceProviderComponent& m_resourceComponent;
 
         EFeatureLevel m_featureLevel = EFeatureLevel_Latest;
@@ -129,6 +156,7 @@ namespace ramses::internal
             SceneInfo info;
             Guid provider;
             std::unique_ptr<SceneUpdateStreamDeserializer> sceneUpdateDeserializer;
+            SceneActionDeltaDecoder sceneActionDecoder;
         };
 
         std::unordered_map<SceneId, ReceivedScene> m_remoteScenes;
@@ -12,6 +12,8 @@
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
 #include "internal/Components/FlushInformation.h"
 
+#include <functional>
+
 namespace ramses::internal
 {
     struct SceneUpdate
@@ -19,5 +21,9 @@ namespace ramses::internal
         SceneActionCollection actions;
         ManagedResourceVector resources;
         FlushInformation flushInfos;
+
+        // when set, fills actions and scene resource parts of flush information right before the update is sent,
+        // it might run on async flush worker without framework lock and therefore only reads an immutable scene snapshot
+        std::function<void(SceneUpdate&)> sceneDescription;
     };
 }
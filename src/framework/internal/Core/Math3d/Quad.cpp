@@ -46,6 +46,19 @@ namespace ramses::internal
         return { minX, minY, maxX - minX, maxY - minY };
     }
 
+    Quad Quad::getIntersection(const Quad& other) const
+    {
+        const auto minX = std::max(x, other.x);
+        const auto minY = std::max(y, other.y);
+        const auto maxX = std::min(x + width, other.x + other.width);
+        const auto maxY = std::min(y + height, other.y + other.height);
+
+        if (maxX <= minX || maxY <= minY)
+            return {};
+
+        return { minX, minY, maxX - minX, maxY - minY };
+    }
+
     int32_t Quad::getArea() const
     {
         return width * height;
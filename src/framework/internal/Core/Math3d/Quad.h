@@ -23,6 +23,7 @@ namespace ramses::internal
         bool operator!=(const Quad& q) const;
 
         [[nodiscard]] Quad getBoundingQuad(const Quad& other) const;
+        [[nodiscard]] Quad getIntersection(const Quad& other) const;
         [[nodiscard]] int32_t getArea() const;
 
         int32_t x = 0;
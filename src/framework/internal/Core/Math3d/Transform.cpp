@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Math3d/Transform.h"
+
+namespace ramses::internal
+{
+    namespace Math3d
+    {
+        glm::mat4 Transform(const glm::vec3& translation, const glm::mat4& rotation, const glm::vec3& scaling)
+        {
+            glm::mat4 result{ 1.f };
+            for (glm::length_t col = 0; col < 3; ++col)
+            {
+                const float s = scaling[col];
+                result[col] = glm::vec4(rotation[col][0] * s, rotation[col][1] * s, rotation[col][2] * s, 0.f);
+            }
+            result[3] = glm::vec4(translation, 1.f);
+
+            return result;
+        }
+
+        glm::mat4 InverseTransform(const glm::vec3& translation, const glm::mat4& rotation, const glm::vec3& scaling)
+        {
+            const glm::vec3 invScaling = glm::vec3(1.f) / scaling;
+
+            // upper 3x3 is transposed rotation with rows scaled by inverse scaling
+            glm::mat4 result{ 1.f };
+            for (glm::length_t col = 0; col < 3; ++col)
+                result[col] = glm::vec4(rotation[0][col] * invScaling.x, rotation[1][col] * invScaling.y, rotation[2][col] * invScaling.z, 0.f);
+
+            result[3] = glm::vec4(
+                result[0][0] * -translation.x + result[1][0] * -translation.y + result[2][0] * -translation.z,
+                result[0][1] * -translation.x + result[1][1] * -translation.y + result[2][1] * -translation.z,
+                result[0][2] * -translation.x + result[1][2] * -translation.y + result[2][2] * -translation.z,
+                1.f);
+
+            return result;
+        }
+    }
+}
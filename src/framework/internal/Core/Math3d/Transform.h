@@ -0,0 +1,26 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/DataTypesImpl.h"
+
+namespace ramses::internal
+{
+    namespace Math3d
+    {
+        // Equivalent to glm::translate(translation) * rotation * glm::scale(scaling)
+        // but composed directly without the two full 4x4 matrix multiplications.
+        // Rotation is expected to be a pure rotation matrix (as created by Math3d::Rotation).
+        glm::mat4 Transform(const glm::vec3& translation, const glm::mat4& rotation, const glm::vec3& scaling);
+
+        // Equivalent to glm::scale(1 / scaling) * glm::transpose(rotation) * glm::translate(-translation),
+        // i.e. inverse of Transform(translation, rotation, scaling), composed directly.
+        glm::mat4 InverseTransform(const glm::vec3& translation, const glm::mat4& rotation, const glm::vec3& scaling);
+    }
+}
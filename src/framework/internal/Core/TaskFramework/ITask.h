@@ -10,8 +10,23 @@
 
 #include "internal/Core/TaskFramework/RefCounted.h"
 
+#include <cstdint>
+#include <cstddef>
+
 namespace ramses::internal
 {
+    /**
+     * Priority of a task, task queues executing tasks in parallel pick tasks with higher priority first.
+     */
+    enum class ETaskPriority : uint8_t
+    {
+        High = 0,   // e.g. loading of scenes the user waits for
+        Normal,     // e.g. resource compression
+        Low,        // e.g. deferred deletion of objects
+    };
+
+    constexpr size_t TaskPriorityCount = 3u;
+
     /**
      * Interface for a Task which executable.
      */
@@ -24,5 +39,13 @@ namespace ramses::internal
          */
         virtual void execute() = 0;
 
+        /**
+         * Priority of this task.
+         * @return  priority used by executing queue to order tasks, ETaskPriority::Normal by default
+         */
+        [[nodiscard]] virtual ETaskPriority getPriority() const
+        {
+            return ETaskPriority::Normal;
+        }
     };
 }
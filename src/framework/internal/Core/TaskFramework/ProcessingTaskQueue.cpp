@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/TaskFramework/ProcessingTaskQueue.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // queue and worker index registered by worker threads, used to put tasks enqueued from within task execution
+        // to worker's own deque
+        thread_local const ProcessingTaskQueue* t_workerQueue = nullptr;
+        thread_local size_t t_workerIndex = 0u;
+    }
+
+    ProcessingTaskQueue::ProcessingTaskQueue(size_t workerCount)
+    {
+        m_workerDeques.resize(std::max<size_t>(workerCount, 1u));
+        for (auto& deques : m_workerDeques)
+            deques = std::make_unique<WorkerDeques>();
+    }
+
+    void ProcessingTaskQueue::addTask(ITask* taskToAdd)
+    {
+        if (taskToAdd)
+        {
+            taskToAdd->addRef();
+
+            const size_t workerIndex = (t_workerQueue == this) ? t_workerIndex : (m_nextWorkerForExternalTasks++ % m_workerDeques.size());
+            {
+                WorkerDeques& deques = *m_workerDeques[workerIndex];
+                std::lock_guard<std::mutex> g(deques.mutex);
+                deques.tasks[static_cast<size_t>(taskToAdd->getPriority())].push_back(taskToAdd);
+            }
+            ++m_taskCount;
+
+            // lock so that waiting worker cannot miss the notification between checking task count and starting to wait
+            std::lock_guard<std::mutex> g(m_waitMutex);
+            m_waitCondition.notify_one();
+        }
+        else
+        {
+            std::lock_guard<std::mutex> g(m_waitMutex);
+            ++m_pendingWakeUps;
+            m_waitCondition.notify_all();
+        }
+    }
+
+    ITask* ProcessingTaskQueue::popTask(std::chrono::milliseconds timeout)
+    {
+        return popTask(getWorkerIndexOfCurrentThread(), timeout);
+    }
+
+    ITask* ProcessingTaskQueue::popTask(size_t workerIndex, std::chrono::milliseconds timeout)
+    {
+        assert(workerIndex < m_workerDeques.size());
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+        for (;;)
+        {
+            if (ITask* task = tryPopTask(workerIndex))
+                return task;
+
+            std::unique_lock<std::mutex> l(m_waitMutex);
+            const auto canContinue = [&]() { return m_taskCount > 0 || m_pendingWakeUps > 0u; };
+            if (timeout == std::chrono::milliseconds{0})
+            {
+                m_waitCondition.wait(l, canContinue);
+            }
+            else if (!m_waitCondition.wait_until(l, deadline, canContinue))
+            {
+                return nullptr;
+            }
+
+            if (m_pendingWakeUps > 0u)
+            {
+                --m_pendingWakeUps;
+                return nullptr;
+            }
+        }
+    }
+
+    bool ProcessingTaskQueue::isEmpty() const
+    {
+        return m_taskCount <= 0;
+    }
+
+    size_t ProcessingTaskQueue::getWorkerCount() const
+    {
+        return m_workerDeques.size();
+    }
+
+    void ProcessingTaskQueue::registerWorkerThread(size_t workerIndex) const
+    {
+        assert(workerIndex < m_workerDeques.size());
+        t_workerQueue = this;
+        t_workerIndex = workerIndex;
+    }
+
+    void ProcessingTaskQueue::unregisterWorkerThread() const
+    {
+        if (t_workerQueue == this)
+        {
+            t_workerQueue = nullptr;
+            t_workerIndex = 0u;
+        }
+    }
+
+    size_t ProcessingTaskQueue::getWorkerIndexOfCurrentThread() const
+    {
+        return (t_workerQueue == this) ? t_workerIndex : 0u;
+    }
+
+    ITask* ProcessingTaskQueue::tryPopTask(size_t workerIndex)
+    {
+        const size_t workerCount = m_workerDeques.size();
+        for (size_t priority = 0u; priority < TaskPriorityCount; ++priority)
+        {
+            for (size_t i = 0u; i < workerCount; ++i)
+            {
+                const size_t dequeIndex = (workerIndex + i) % workerCount;
+                if (ITask* task = tryTakeFrom(dequeIndex, static_cast<ETaskPriority>(priority), i == 0u))
+                {
+                    --m_taskCount;
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    ITask* ProcessingTaskQueue::tryTakeFrom(size_t dequeIndex, ETaskPriority priority, bool fromOwnDeque)
+    {
+        WorkerDeques& deques = *m_workerDeques[dequeIndex];
+        std::lock_guard<std::mutex> g(deques.mutex);
+        auto& tasks = deques.tasks[static_cast<size_t>(priority)];
+        if (tasks.empty())
+            return nullptr;
+
+        // owner keeps enqueue order, stealing takes from the other end to not compete with owner for same tasks
+        ITask* task = nullptr;
+        if (fromOwnDeque)
+        {
+            task = tasks.front();
+            tasks.pop_front();
+        }
+        else
+        {
+            task = tasks.back();
+            tasks.pop_back();
+        }
+        return task;
+    }
+}
@@ -8,44 +8,64 @@
 
 #pragma once
 
-#include "internal/PlatformAbstraction/Collections/BlockingQueue.h"
 #include "ITask.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ramses::internal
 {
     /**
-     * The processing task queue stores task which should be executed according with their execution observer.
+     * The processing task queue stores tasks which should be executed by a number of worker threads.
+     *
+     * Every worker has its own deque for each task priority. Tasks added from a worker thread (see registerWorkerThread)
+     * go to the deque of that worker, tasks added from other threads are distributed round robin. A worker takes
+     * tasks from its own deque in the order they were added, if it is empty it steals the most recently added task from
+     * the deques of other workers. Tasks of higher priority are always taken first, from own or other deques.
+     *
+     * Adding a nullptr task does not store a task but wakes up one waiting popTask call which then returns nullptr.
      */
     class ProcessingTaskQueue
     {
     public:
+        explicit ProcessingTaskQueue(size_t workerCount = 1u);
+
         void addTask(ITask* taskToAdd);
+        // timeout 0 means wait until there is a task or wake up request
         ITask* popTask(std::chrono::milliseconds timeout = std::chrono::milliseconds{0});
+        ITask* popTask(size_t workerIndex, std::chrono::milliseconds timeout);
         [[nodiscard]] bool isEmpty() const;
 
-    private:
-        BlockingQueue<ITask*> m_taskQueue;
-    };
+        [[nodiscard]] size_t getWorkerCount() const;
 
-    inline void ProcessingTaskQueue::addTask(ITask* taskToAdd)
-    {
-        if (taskToAdd)
+        // marks calling thread as worker of this queue with given index, tasks it adds then go to its own deque
+        void registerWorkerThread(size_t workerIndex) const;
+        void unregisterWorkerThread() const;
+
+    private:
+        struct WorkerDeques
         {
-            taskToAdd->addRef();
-        }
-        m_taskQueue.push(taskToAdd);
-    }
+            std::mutex mutex;
+            std::array<std::deque<ITask*>, TaskPriorityCount> tasks;
+        };
 
-    inline ITask* ProcessingTaskQueue::popTask(std::chrono::milliseconds timeout)
-    {
-        ITask* task = nullptr;
-        m_taskQueue.pop(&task, timeout);
-        return task;
-    }
+        [[nodiscard]] size_t getWorkerIndexOfCurrentThread() const;
+        ITask* tryPopTask(size_t workerIndex);
+        ITask* tryTakeFrom(size_t dequeIndex, ETaskPriority priority, bool fromOwnDeque);
 
-    inline bool ProcessingTaskQueue::isEmpty() const
-    {
-        return m_taskQueue.empty();
-    }
+        std::vector<std::unique_ptr<WorkerDeques>> m_workerDeques;
+        std::atomic<size_t> m_nextWorkerForExternalTasks{ 0u };
+
+        // number of queued tasks, may be temporarily negative because it is updated after deque access
+        std::atomic<int64_t> m_taskCount{ 0 };
+        mutable std::mutex m_waitMutex;
+        std::condition_variable m_waitCondition;
+        uint32_t m_pendingWakeUps = 0u;
+    };
 }
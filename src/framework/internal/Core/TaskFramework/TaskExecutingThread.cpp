@@ -13,11 +13,13 @@
 
 namespace ramses::internal
 {
-    TaskExecutingThread::TaskExecutingThread(IThreadAliveNotifier& aliveHandler)
+    TaskExecutingThread::TaskExecutingThread(IThreadAliveNotifier& aliveHandler, size_t workerIndex, std::vector<uint32_t> cpuAffinity)
             : m_pBlockingTaskQueue(nullptr)
             , m_thread("Taskpool_Thrd")
             , m_aliveHandler(aliveHandler)
             , m_aliveIdentifier(m_aliveHandler.registerThread())
+            , m_workerIndex(workerIndex)
+            , m_cpuAffinity(std::move(cpuAffinity))
             , m_bThreadStarted(false)
     {
     }
@@ -89,10 +91,15 @@ namespace ramses::internal
     {
         if (nullptr != m_pBlockingTaskQueue)
         {
+            if (!m_cpuAffinity.empty() && !PlatformThread::SetCurrentThreadCpuAffinity(m_cpuAffinity))
+                LOG_WARN(CONTEXT_FRAMEWORK, "TaskExecutingThread::run() failed to set CPU affinity to [{}]", fmt::join(m_cpuAffinity, ", "));
+
+            const size_t workerIndex = (m_workerIndex < m_pBlockingTaskQueue->getWorkerCount()) ? m_workerIndex : 0u;
+            m_pBlockingTaskQueue->registerWorkerThread(workerIndex);
             m_aliveHandler.notifyAlive(m_aliveIdentifier);
             while (!isCancelRequested())
             {
-                ITask* const pTaskToExecute = m_pBlockingTaskQueue->popTask(std::chrono::milliseconds{m_aliveHandler.calculateTimeout()});
+                ITask* const pTaskToExecute = m_pBlockingTaskQueue->popTask(workerIndex, std::chrono::milliseconds{m_aliveHandler.calculateTimeout()});
                 m_aliveHandler.notifyAlive(m_aliveIdentifier);
                 if (nullptr != pTaskToExecute)
                 {
@@ -100,6 +107,7 @@ namespace ramses::internal
                     pTaskToExecute->release();
                 }
             }
+            m_pBlockingTaskQueue->unregisterWorkerThread();
         }
         else
         {
@@ -11,6 +11,7 @@
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 #include <mutex>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -26,7 +27,12 @@ namespace ramses::internal
     {
 
     public:
-        explicit TaskExecutingThread(IThreadAliveNotifier& aliveHandler);
+        /**
+         * @param   aliveHandler    Thread alive handler
+         * @param   workerIndex     Index of this worker within processing task queue it executes tasks of
+         * @param   cpuAffinity     CPUs the thread is restricted to run on, empty for no restriction
+         */
+        explicit TaskExecutingThread(IThreadAliveNotifier& aliveHandler, size_t workerIndex = 0u, std::vector<uint32_t> cpuAffinity = {});
         ~TaskExecutingThread() override;
 
 
@@ -85,6 +91,8 @@ namespace ramses::internal
 
         IThreadAliveNotifier& m_aliveHandler;
         const uint64_t m_aliveIdentifier;
+        const size_t m_workerIndex;
+        const std::vector<uint32_t> m_cpuAffinity;
 
         /**
          * Flag whether the thread is started.
@@ -20,7 +20,7 @@ namespace ramses::internal
         deinit();
     }
 
-    void TaskExecutingThreadPool::init(uint16_t threadCount, IThreadAliveNotifier& threadAliveHandler)
+    void TaskExecutingThreadPool::init(uint16_t threadCount, IThreadAliveNotifier& threadAliveHandler, const std::vector<uint32_t>& cpuAffinity)
     {
         std::lock_guard<std::mutex> mutexGuard(m_mutex);
 
@@ -36,7 +36,7 @@ namespace ramses::internal
 
             for (uint16_t index = 0; index < threadCount; ++index)
             {
-                m_threads.push_back(std::make_unique<TaskExecutingThread>(threadAliveHandler));
+                m_threads.push_back(std::make_unique<TaskExecutingThread>(threadAliveHandler, index, cpuAffinity));
             }
         }
     }
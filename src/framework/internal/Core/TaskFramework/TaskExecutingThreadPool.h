@@ -38,8 +38,9 @@ namespace ramses::internal
          * Initialize the thread pool with the supplied amount of threads.
          * @param   threadCount   The number of threads which should be created.
          * @param   aliveHandler  Thread alive handler
+         * @param   cpuAffinity   CPUs the threads are restricted to run on, empty for no restriction
          */
-        void init(uint16_t threadCount, IThreadAliveNotifier& aliveHandler);
+        void init(uint16_t threadCount, IThreadAliveNotifier& aliveHandler, const std::vector<uint32_t>& cpuAffinity = {});
 
         /**
          * Deinitialize the thread pool.
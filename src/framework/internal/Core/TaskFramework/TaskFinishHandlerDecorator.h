@@ -21,6 +21,7 @@ namespace ramses::internal
         ~TaskFinishHandlerDecorator() override;
 
         void execute() override;
+        [[nodiscard]] ETaskPriority getPriority() const override;
 
     protected:
 
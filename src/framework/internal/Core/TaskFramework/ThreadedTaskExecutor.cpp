@@ -11,11 +11,12 @@
 
 namespace ramses::internal
 {
-    ThreadedTaskExecutor::ThreadedTaskExecutor(uint16_t threadCount, const ThreadWatchdogConfig& watchdogConfig)
+    ThreadedTaskExecutor::ThreadedTaskExecutor(uint16_t threadCount, const ThreadWatchdogConfig& watchdogConfig, const std::vector<uint32_t>& cpuAffinity)
         : ThreadWatchdog(watchdogConfig, ERamsesThreadIdentifier::Workers)
+        , m_taskQueue(threadCount)
         , m_acceptingNewTasks(true)
     {
-        m_threadPool.init(threadCount, *this);
+        m_threadPool.init(threadCount, *this, cpuAffinity);
         start();
     }
 
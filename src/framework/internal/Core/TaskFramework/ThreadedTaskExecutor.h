@@ -28,10 +28,12 @@ namespace ramses::internal
     public:
         /**
         * Create instance with the processing task queue and the thread pool.
+        * Each thread works on its own part of the queue and steals tasks from the others when it runs out of work.
         * @param   threadCount     The number of threads which should be created.
         * @param   watchdogConfig The configuration for watchdogHandling
+        * @param   cpuAffinity     CPUs the threads are restricted to run on, empty for no restriction
         */
-        explicit ThreadedTaskExecutor(uint16_t threadCount, const ThreadWatchdogConfig& watchdogConfig = ThreadWatchdogConfig());
+        explicit ThreadedTaskExecutor(uint16_t threadCount, const ThreadWatchdogConfig& watchdogConfig = ThreadWatchdogConfig(), const std::vector<uint32_t>& cpuAffinity = {});
 
         /**
          * Virtual destructor.
@@ -0,0 +1,176 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/AsyncLogQueue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <thread>
+
+namespace ramses::internal
+{
+    class AsyncLogQueue::Ring
+    {
+    public:
+        explicit Ring(size_t capacity)
+            : m_slots(capacity)
+        {
+        }
+
+        // producer side, only called by owning thread
+        bool tryPush(uint64_t sequence, LogMessage&& msg)
+        {
+            const size_t tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == m_slots.size())
+                return false;
+
+            Slot& slot = m_slots[tail % m_slots.size()];
+            slot.sequence = sequence;
+            slot.msg.emplace(std::move(msg));
+            m_tail.store(tail + 1u, std::memory_order_release);
+            return true;
+        }
+
+        // consumer side
+        template <typename F>
+        void popAll(F&& func)
+        {
+            const size_t head = m_head.load(std::memory_order_relaxed);
+            const size_t tail = m_tail.load(std::memory_order_acquire);
+            for (size_t i = head; i < tail; ++i)
+            {
+                Slot& slot = m_slots[i % m_slots.size()];
+                func(slot.sequence, std::move(*slot.msg));
+                slot.msg.reset();
+            }
+            m_head.store(tail, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool isEmpty() const
+        {
+            return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        struct Slot
+        {
+            uint64_t sequence = 0u;
+            std::optional<LogMessage> msg;
+        };
+
+        std::vector<Slot> m_slots;
+        // head and tail are written by different threads, keep them on separate cache lines
+        alignas(64) std::atomic<size_t> m_head{0u};
+        alignas(64) std::atomic<size_t> m_tail{0u};
+    };
+
+    namespace
+    {
+        // identifies queue instance the cached ring of a thread belongs to, address could be reused by a new queue
+        std::atomic<uint64_t> NextQueueId{1u};
+
+        struct ThreadRing
+        {
+            uint64_t queueId = 0u;
+            std::shared_ptr<void> ring;
+        };
+        thread_local ThreadRing CurrentThreadRing;
+    }
+
+    AsyncLogQueue::AsyncLogQueue(size_t capacityPerThread, ELogOverflowPolicy overflowPolicy)
+        : m_capacityPerThread(std::max<size_t>(capacityPerThread, 1u))
+        , m_overflowPolicy(overflowPolicy)
+        , m_queueId(NextQueueId++)
+    {
+    }
+
+    AsyncLogQueue::~AsyncLogQueue() = default;
+
+    AsyncLogQueue::Ring& AsyncLogQueue::getRingOfCurrentThread()
+    {
+        if (CurrentThreadRing.queueId != m_queueId)
+        {
+            auto ring = std::make_shared<Ring>(m_capacityPerThread);
+            {
+                std::lock_guard<std::mutex> guard(m_ringsLock);
+                m_rings.push_back(ring);
+            }
+            CurrentThreadRing.queueId = m_queueId;
+            CurrentThreadRing.ring = std::move(ring);
+        }
+        return *static_cast<Ring*>(CurrentThreadRing.ring.get());
+    }
+
+    bool AsyncLogQueue::push(LogMessage&& msg)
+    {
+        Ring& ring = getRingOfCurrentThread();
+        const uint64_t sequence = m_nextSequence.fetch_add(1u, std::memory_order_relaxed);
+        while (!ring.tryPush(sequence, std::move(msg)))
+        {
+            if (m_overflowPolicy == ELogOverflowPolicy::Drop)
+            {
+                m_droppedCount.fetch_add(1u, std::memory_order_relaxed);
+                m_totalDroppedCount.fetch_add(1u, std::memory_order_relaxed);
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    size_t AsyncLogQueue::drain(const std::function<void(const LogMessage&)>& handler)
+    {
+        assert(m_drainBuffer.empty());
+        {
+            std::lock_guard<std::mutex> guard(m_ringsLock);
+            for (auto& ring : m_rings)
+            {
+                ring->popAll([this](uint64_t sequence, LogMessage&& msg) {
+                    m_drainBuffer.push_back(SequencedMessage{ sequence, std::move(msg) });
+                });
+            }
+
+            // ring is only referenced here after its thread exited
+            m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](const auto& ring) { return ring.use_count() == 1 && ring->isEmpty(); }), m_rings.end());
+        }
+
+        // LogMessage holds a reference and cannot be reordered in place, sort indices instead
+        m_drainOrder.resize(m_drainBuffer.size());
+        for (size_t i = 0u; i < m_drainOrder.size(); ++i)
+            m_drainOrder[i] = i;
+        std::sort(m_drainOrder.begin(), m_drainOrder.end(), [this](size_t a, size_t b) { return m_drainBuffer[a].sequence < m_drainBuffer[b].sequence; });
+
+        for (const size_t idx : m_drainOrder)
+            handler(m_drainBuffer[idx].msg);
+
+        const size_t count = m_drainBuffer.size();
+        m_drainBuffer.clear();
+        return count;
+    }
+
+    uint64_t AsyncLogQueue::takeDroppedCount()
+    {
+        return m_droppedCount.exchange(0u, std::memory_order_relaxed);
+    }
+
+    uint64_t AsyncLogQueue::getTotalDroppedCount() const
+    {
+        return m_totalDroppedCount.load(std::memory_order_relaxed);
+    }
+
+    size_t AsyncLogQueue::getCapacityPerThread() const
+    {
+        return m_capacityPerThread;
+    }
+
+    ELogOverflowPolicy AsyncLogQueue::getOverflowPolicy() const
+    {
+        return m_overflowPolicy;
+    }
+}
@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/Utils/LogMessage.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    enum class ELogOverflowPolicy : uint8_t
+    {
+        Block, ///< logging thread waits until there is space in its ring
+        Drop,  ///< message is discarded and counted as dropped
+    };
+
+    /**
+     * Queue of formatted log messages, to be dispatched to log appenders by a single consumer thread.
+     * Every logging thread gets its own bounded single producer/single consumer ring, so pushing a message
+     * does not take any lock (except once when a thread logs for the first time and registers its ring).
+     * Messages carry a global sequence number, the consumer merges all rings in logging order.
+     */
+    class AsyncLogQueue
+    {
+    public:
+        AsyncLogQueue(size_t capacityPerThread, ELogOverflowPolicy overflowPolicy);
+        ~AsyncLogQueue();
+
+        AsyncLogQueue(const AsyncLogQueue&) = delete;
+        AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+        // can be called from any thread, returns false if message was dropped
+        bool push(LogMessage&& msg);
+
+        // must not be called concurrently, calls handler for all queued messages in logging order and returns their number
+        size_t drain(const std::function<void(const LogMessage&)>& handler);
+
+        // number of messages dropped since last call
+        [[nodiscard]] uint64_t takeDroppedCount();
+        [[nodiscard]] uint64_t getTotalDroppedCount() const;
+
+        [[nodiscard]] size_t getCapacityPerThread() const;
+        [[nodiscard]] ELogOverflowPolicy getOverflowPolicy() const;
+
+    private:
+        class Ring;
+
+        Ring& getRingOfCurrentThread();
+
+        const size_t m_capacityPerThread;
+        const ELogOverflowPolicy m_overflowPolicy;
+        const uint64_t m_queueId;
+
+        std::atomic<uint64_t> m_nextSequence{0u};
+        std::atomic<uint64_t> m_droppedCount{0u};
+        std::atomic<uint64_t> m_totalDroppedCount{0u};
+
+        std::mutex m_ringsLock;
+        std::vector<std::shared_ptr<Ring>> m_rings;
+
+        struct SequencedMessage
+        {
+            uint64_t sequence;
+            LogMessage msg;
+        };
+        std::vector<SequencedMessage> m_drainBuffer;
+        std::vector<size_t> m_drainOrder;
+    };
+}
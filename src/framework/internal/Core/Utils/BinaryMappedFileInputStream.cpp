@@ -0,0 +1,136 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+
+#include <cstring>
+#include <string>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ramses::internal
+{
+    BinaryMappedFileInputStream::BinaryMappedFileInputStream([[maybe_unused]] std::string_view filename)
+    {
+#ifndef _WIN32
+        const int fd = ::open(std::string{ filename }.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return;
+
+        struct stat fileStat{};
+        if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+            map(fd, 0u, static_cast<size_t>(fileStat.st_size));
+        if (!isMapped())
+            ::close(fd);
+#endif
+    }
+
+    BinaryMappedFileInputStream::BinaryMappedFileInputStream(int fd, size_t offset, size_t length)
+    {
+        map(fd, offset, length);
+    }
+
+    BinaryMappedFileInputStream::~BinaryMappedFileInputStream()
+    {
+#ifndef _WIN32
+        if (m_mapping != nullptr)
+            ::munmap(m_mapping, m_mappingSize);
+#endif
+    }
+
+    void BinaryMappedFileInputStream::map([[maybe_unused]] int fd, [[maybe_unused]] size_t offset, [[maybe_unused]] size_t length)
+    {
+#ifndef _WIN32
+        if (length == 0u)
+            return;
+
+        // mapping has to start at page boundary
+        const auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        const size_t pageOffset = offset % pageSize;
+        const size_t mappingSize = length + pageOffset;
+        void* mapping = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset - pageOffset));
+        if (mapping == MAP_FAILED)
+            return;
+
+        m_mapping = mapping;
+        m_mappingSize = mappingSize;
+        m_data = static_cast<const std::byte*>(mapping) + pageOffset;
+        m_length = length;
+        m_state = EStatus::Ok;
+        ::close(fd);
+#endif
+    }
+
+    IInputStream& BinaryMappedFileInputStream::read(void* buffer, size_t size)
+    {
+        if (EStatus::Ok != m_state)
+            return *this;
+        if (buffer == nullptr)
+        {
+            m_state = EStatus::Error;
+            return *this;
+        }
+        if (size > m_length - m_pos)
+        {
+            m_state = EStatus::Eof;
+            return *this;
+        }
+
+        if (size != 0u)
+            std::memcpy(buffer, m_data + m_pos, size);
+        m_pos += size;
+
+        return *this;
+    }
+
+    EStatus BinaryMappedFileInputStream::seek(int64_t numberOfBytesToSeek, Seek origin)
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+
+        int64_t newPos = 0;
+        switch (origin)
+        {
+        case Seek::FromBeginning:
+            newPos = numberOfBytesToSeek;
+            break;
+        case Seek::Relative:
+            newPos = static_cast<int64_t>(m_pos) + numberOfBytesToSeek;
+            break;
+        }
+        if (newPos < 0 || newPos > static_cast<int64_t>(m_length))
+            return EStatus::Error;
+
+        m_pos = static_cast<size_t>(newPos);
+
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMappedFileInputStream::getPos(size_t& position) const
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+        position = m_pos;
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMappedFileInputStream::getState() const
+    {
+        return m_state;
+    }
+
+    bool BinaryMappedFileInputStream::isMapped() const
+    {
+        return m_mapping != nullptr;
+    }
+}
@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/Collections/IInputStream.h"
+#include <cstddef>
+#include <string_view>
+
+namespace ramses::internal
+{
+    /*
+     * Input stream reading from a read-only memory mapping of a file (or a part of it given by offset and length).
+     * Reads are plain memory copies from the mapped pages, there is no read call or intermediate buffer per read.
+     *
+     * The file descriptor is closed as soon as the mapping is created (mapping stays valid without it), if mapping
+     * fails it is left open so that caller can read the file by other means.
+     * Memory mapping is only supported on POSIX platforms, on other platforms or if mapping fails the stream
+     * state is EStatus::Error and isMapped() returns false, caller is expected to fall back to other file stream.
+     * The mapped file must not be truncated while the stream exists.
+     */
+    class BinaryMappedFileInputStream final : public IInputStream
+    {
+    public:
+        explicit BinaryMappedFileInputStream(std::string_view filename);
+        BinaryMappedFileInputStream(int fd, size_t offset, size_t length);
+        ~BinaryMappedFileInputStream() override;
+
+        BinaryMappedFileInputStream(const BinaryMappedFileInputStream&) = delete;
+        BinaryMappedFileInputStream& operator=(const BinaryMappedFileInputStream&) = delete;
+
+        IInputStream& read(void* buffer, size_t size) override;
+
+        EStatus seek(int64_t numberOfBytesToSeek, Seek origin) override;
+        EStatus getPos(size_t& position) const override;
+
+        [[nodiscard]] EStatus getState() const override;
+
+        [[nodiscard]] bool isMapped() const;
+
+    private:
+        void map(int fd, size_t offset, size_t length);
+
+        void* m_mapping = nullptr;
+        size_t m_mappingSize = 0u;
+        const std::byte* m_data = nullptr;
+        size_t m_length = 0u;
+        size_t m_pos = 0u;
+        EStatus m_state = EStatus::Error;
+    };
+}
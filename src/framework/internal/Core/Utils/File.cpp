@@ -120,13 +120,15 @@ namespace ramses::internal
         if (m_handle == nullptr)
             return false;
 
-        if (std::fclose(m_handle) != 0)
+        // handle is released even if fclose fails, it must not be closed again
+        const bool closed = (std::fclose(m_handle) == 0);
+        m_handle = nullptr;
+        m_isOpen = false;
+        if (!closed)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "File::close: fclose failed for {}, errno is {}", m_path.string(), errno);
             return false;
         }
-        m_handle = nullptr;
-        m_isOpen = false;
         return true;
     }
 
@@ -235,6 +237,12 @@ namespace ramses::internal
         return std::filesystem::is_directory(m_path, ec);
     }
 
+    bool File::isRegularFile() const
+    {
+        std::error_code ec;
+        return std::filesystem::is_regular_file(m_path, ec);
+    }
+
     bool File::exists() const
     {
         std::error_code ec;
@@ -55,6 +55,7 @@ namespace ramses::internal
 
         [[nodiscard]] bool exists() const;
         [[nodiscard]] bool isDirectory() const;
+        [[nodiscard]] bool isRegularFile() const;
         bool createFile();
         bool createDirectory();
         bool remove();
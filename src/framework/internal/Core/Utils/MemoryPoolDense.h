@@ -0,0 +1,286 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/Utils/HandlePool.h"
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include <limits>
+#include <cassert>
+
+namespace ramses::internal
+{
+    template<typename memory_pool_t, typename object_t>
+    class dense_memory_pool_iterator
+    {
+    public:
+        using value_type = std::pair<typename memory_pool_t::handle_type, object_t*>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = std::forward_iterator_tag;
+
+        dense_memory_pool_iterator() = default;
+
+        dense_memory_pool_iterator(memory_pool_t* memPool, uint32_t denseIndex)
+            : m_memPool(memPool)
+            , m_denseIndex(denseIndex)
+        {
+            updateCurrent();
+        }
+
+        bool operator==(const dense_memory_pool_iterator& other) const
+        {
+            return m_memPool == other.m_memPool && m_denseIndex == other.m_denseIndex;
+        }
+
+        bool operator!=(const dense_memory_pool_iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+        const value_type& operator*() const
+        {
+            return m_current;
+        }
+
+        const value_type* operator->() const
+        {
+            return &m_current;
+        }
+
+        dense_memory_pool_iterator& operator++()
+        {
+            ++m_denseIndex;
+            updateCurrent();
+            return *this;
+        }
+
+        // NOLINTNEXTLINE(readability-const-return-type): required by cert-dcl21-cpp
+        const dense_memory_pool_iterator operator++(int)
+        {
+            auto currentIt = *this;
+            ++(*this);
+            return currentIt;
+        }
+
+    private:
+        void updateCurrent()
+        {
+            if (m_memPool && m_denseIndex < m_memPool->getActualCount())
+                m_current = { m_memPool->m_denseHandles[m_denseIndex], &m_memPool->m_denseObjects[m_denseIndex] };
+            else
+                m_current = { typename memory_pool_t::handle_type{}, nullptr };
+        }
+
+        memory_pool_t* m_memPool = nullptr;
+        uint32_t m_denseIndex = 0u;
+        value_type m_current{ typename memory_pool_t::handle_type{}, nullptr };
+    };
+
+    // Memory pool with same interface and handle assignment as MemoryPool, but objects are kept packed in a dense array
+    // with a sparse index from handle to array position. Iteration visits only allocated objects in packed order (not handle order),
+    // so it costs O(allocated) regardless of how many handles were released before.
+    // Releasing an object moves the last packed object into its place, so pointers obtained by getMemory are invalidated
+    // by release as well as by allocate.
+    template <typename OBJECTTYPE, typename HANDLE>
+    class MemoryPoolDense final
+    {
+    public:
+        using object_type       = OBJECTTYPE;
+        using handle_type       = HANDLE;
+
+        using iterator          = dense_memory_pool_iterator<MemoryPoolDense, OBJECTTYPE>;
+        using const_iterator    = dense_memory_pool_iterator<const MemoryPoolDense, const OBJECTTYPE>;
+
+        explicit MemoryPoolDense(uint32_t size = 0);
+
+        // Creation/Deletion
+        HANDLE                          allocate(HANDLE handle = InvalidMemoryHandle());
+        void                            release(HANDLE handle);
+
+        // Access
+        [[nodiscard]] uint32_t                          getTotalCount() const;
+        [[nodiscard]] uint32_t                          getActualCount() const;
+        [[nodiscard]] bool                            isAllocated(HANDLE handle) const;
+
+        // Access to actual memory
+        OBJECTTYPE*                     getMemory(HANDLE handle);
+        [[nodiscard]] const OBJECTTYPE*               getMemory(HANDLE handle) const;
+
+        void                            preallocateSize(uint32_t size);
+
+        static HANDLE                   InvalidMemoryHandle();
+
+        iterator                        begin();
+        iterator                        end();
+        [[nodiscard]] const_iterator                  begin() const;
+        [[nodiscard]] const_iterator                  end() const;
+        [[nodiscard]] const_iterator                  cbegin() const;
+        [[nodiscard]] const_iterator                  cend() const;
+
+        static_assert(std::is_move_constructible<OBJECTTYPE>::value && std::is_move_assignable<OBJECTTYPE>::value, "OBJECTTYPE must be movable");
+    private:
+        friend iterator;
+        friend const_iterator;
+
+        static constexpr uint32_t InvalidDenseIndex = std::numeric_limits<uint32_t>::max();
+
+        HandlePool<HANDLE> m_handlePool;
+        std::vector<uint32_t> m_denseIndices;
+        std::vector<OBJECTTYPE> m_denseObjects;
+        std::vector<HANDLE> m_denseHandles;
+    };
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    MemoryPoolDense<OBJECTTYPE, HANDLE>::MemoryPoolDense(uint32_t size /*= 0*/)
+        : m_handlePool(size)
+        , m_denseIndices(size, InvalidDenseIndex)
+    {
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    void MemoryPoolDense<OBJECTTYPE, HANDLE>::preallocateSize(uint32_t size)
+    {
+        assert(m_denseIndices.size() == m_handlePool.size());
+        if (size > m_denseIndices.size())
+        {
+            m_handlePool.resize(size);
+            m_denseIndices.resize(size, InvalidDenseIndex);
+            m_denseObjects.reserve(size);
+            m_denseHandles.reserve(size);
+        }
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    HANDLE MemoryPoolDense<OBJECTTYPE, HANDLE>::InvalidMemoryHandle()
+    {
+        return HandlePool<HANDLE>::InvalidMemoryHandle();
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline HANDLE MemoryPoolDense<OBJECTTYPE, HANDLE>::allocate(HANDLE handle)
+    {
+        const HANDLE actualHandle = m_handlePool.acquire(handle);
+        const MemoryHandle memoryHandle = AsMemoryHandle(actualHandle);
+        if (memoryHandle >= m_denseIndices.size())
+            m_denseIndices.resize(memoryHandle + 1u, InvalidDenseIndex);
+
+        assert(m_denseIndices[memoryHandle] == InvalidDenseIndex);
+        m_denseIndices[memoryHandle] = static_cast<uint32_t>(m_denseObjects.size());
+        m_denseObjects.emplace_back();
+        m_denseHandles.push_back(actualHandle);
+
+        return actualHandle;
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline void MemoryPoolDense<OBJECTTYPE, HANDLE>::release(HANDLE handle)
+    {
+        const MemoryHandle memoryHandle = AsMemoryHandle(handle);
+        assert(memoryHandle < m_denseIndices.size());
+        const uint32_t denseIndex = m_denseIndices[memoryHandle];
+        assert(denseIndex != InvalidDenseIndex);
+
+        // fill the hole with last packed object
+        const uint32_t lastDenseIndex = static_cast<uint32_t>(m_denseObjects.size()) - 1u;
+        if (denseIndex != lastDenseIndex)
+        {
+            m_denseObjects[denseIndex] = std::move(m_denseObjects[lastDenseIndex]);
+            m_denseHandles[denseIndex] = m_denseHandles[lastDenseIndex];
+            m_denseIndices[AsMemoryHandle(m_denseHandles[denseIndex])] = denseIndex;
+        }
+        m_denseObjects.pop_back();
+        m_denseHandles.pop_back();
+
+        m_denseIndices[memoryHandle] = InvalidDenseIndex;
+        m_handlePool.release(handle);
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline bool MemoryPoolDense<OBJECTTYPE, HANDLE>::isAllocated(HANDLE handle) const
+    {
+        return m_handlePool.isAcquired(handle);
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline const OBJECTTYPE* MemoryPoolDense<OBJECTTYPE, HANDLE>::getMemory(HANDLE handle) const
+    {
+        const MemoryHandle memoryHandle = AsMemoryHandle(handle);
+        assert(memoryHandle < m_denseIndices.size());
+        assert(m_denseIndices[memoryHandle] != InvalidDenseIndex);
+
+        return &m_denseObjects[m_denseIndices[memoryHandle]];
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline OBJECTTYPE* MemoryPoolDense<OBJECTTYPE, HANDLE>::getMemory(HANDLE handle)
+    {
+        const MemoryHandle memoryHandle = AsMemoryHandle(handle);
+        assert(memoryHandle < m_denseIndices.size());
+        assert(m_denseIndices[memoryHandle] != InvalidDenseIndex);
+
+        return &m_denseObjects[m_denseIndices[memoryHandle]];
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline uint32_t MemoryPoolDense<OBJECTTYPE, HANDLE>::getTotalCount() const
+    {
+        return static_cast<uint32_t>(m_denseIndices.size());
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline uint32_t MemoryPoolDense<OBJECTTYPE, HANDLE>::getActualCount() const
+    {
+        return static_cast<uint32_t>(m_denseObjects.size());
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::begin()
+    {
+        return iterator(this, 0u);
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::end()
+    {
+        return iterator(this, getActualCount());
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::begin() const
+    {
+        return const_iterator(this, 0u);
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::end() const
+    {
+        return const_iterator(this, getActualCount());
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::cbegin() const
+    {
+        return const_iterator(this, 0u);
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    inline
+    typename MemoryPoolDense<OBJECTTYPE, HANDLE>::const_iterator MemoryPoolDense<OBJECTTYPE, HANDLE>::cend() const
+    {
+        return const_iterator(this, getActualCount());
+    }
+}
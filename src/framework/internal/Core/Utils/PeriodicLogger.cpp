@@ -155,6 +155,8 @@ namespace ramses::internal
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileNumber.getSummary(), numberTimeIntervals);
                     output << " resFS ";
                     logStatisticSummaryEntry(output, m_statisticCollection.statResourcesLoadedFromFileSize.getSummary(), numberTimeIntervals);
+                    output << " sendQ ";
+                    logStatisticSummaryEntry(output, m_statisticCollection.statMaximumSendQueueSize.getSummary(), numberTimeIntervals);
         }));
 
         m_statisticCollection.resetSummaries();
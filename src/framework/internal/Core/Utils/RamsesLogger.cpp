@@ -39,7 +39,10 @@ namespace ramses::internal
 #endif
     }
 
-    RamsesLogger::~RamsesLogger() = default;
+    RamsesLogger::~RamsesLogger()
+    {
+        stopAsyncLogging();
+    }
 
     void RamsesLogger::initialize(const RamsesLoggerConfig& config, bool disableDLT, bool enableDLTApplicationRegistration)
     {
@@ -132,6 +135,101 @@ namespace ramses::internal
         }
 
         LOG_INFO(CONTEXT_FRAMEWORK, "Ramses log levels: Contexts {}, Console {}", RamsesLogger::GetLogLevelText(logLevelContexts), RamsesLogger::GetLogLevelText(logLevelConsole));
+
+        if (config.asyncLogging)
+        {
+            startAsyncLogging(config);
+        }
+    }
+
+    void RamsesLogger::startAsyncLogging(const RamsesLoggerConfig& config)
+    {
+        if (m_asyncQueue)
+        {
+            LOG_INFO(CONTEXT_FRAMEWORK, "RamsesLogger::initialize: asynchronous logging already active, keep queue capacity {}", m_asyncQueue->getCapacityPerThread());
+            return;
+        }
+
+        m_asyncQueue = std::make_unique<AsyncLogQueue>(config.asyncLogQueueCapacity, config.asyncLogOverflowPolicy);
+        m_stopAsyncLogThread = false;
+        m_asyncLogThread = std::thread([this]() { asyncLogThreadLoop(); });
+        m_activeAsyncQueue = m_asyncQueue.get();
+
+        LOG_INFO(CONTEXT_FRAMEWORK, "RamsesLogger::initialize: asynchronous logging enabled, queue capacity {} per thread, {} on overflow",
+            m_asyncQueue->getCapacityPerThread(), (config.asyncLogOverflowPolicy == ELogOverflowPolicy::Drop ? "drop" : "block"));
+    }
+
+    void RamsesLogger::stopAsyncLogging()
+    {
+        if (!m_asyncQueue)
+            return;
+
+        // log synchronously from now on, wait for threads still pushing to the queue (log thread keeps draining
+        // meanwhile for blocked ones), then dispatch what is left
+        m_activeAsyncQueue = nullptr;
+        while (m_asyncLogProducers.load() != 0u)
+            std::this_thread::yield();
+        {
+            std::lock_guard<std::mutex> guard(m_asyncLogThreadLock);
+            m_stopAsyncLogThread = true;
+        }
+        m_asyncLogThreadCondition.notify_one();
+        if (m_asyncLogThread.joinable())
+            m_asyncLogThread.join();
+
+        drainAsyncQueue();
+    }
+
+    void RamsesLogger::asyncLogThreadLoop()
+    {
+        SetPrefixes(PrefixInstance, "log");
+
+        std::unique_lock<std::mutex> lock(m_asyncLogThreadLock);
+        while (!m_stopAsyncLogThread)
+        {
+            lock.unlock();
+            drainAsyncQueue();
+            lock.lock();
+
+            if (m_stopAsyncLogThread)
+                break;
+
+            // producers only notify when thread is waiting, a missed notification is caught up by the timeout
+            m_asyncLogThreadWaiting = true;
+            m_asyncLogThreadCondition.wait_for(lock, std::chrono::milliseconds{10});
+            m_asyncLogThreadWaiting = false;
+        }
+    }
+
+    void RamsesLogger::drainAsyncQueue()
+    {
+        std::lock_guard<std::mutex> drainGuard(m_drainLock);
+        std::lock_guard<std::mutex> guard(m_appenderLock);
+        m_asyncQueue->drain([this](const LogMessage& msg) { dispatch(msg); });
+
+        const uint64_t droppedCount = m_asyncQueue->takeDroppedCount();
+        if (droppedCount > 0u)
+        {
+            dispatch(LogMessage{ CONTEXT_FRAMEWORK, ELogLevel::Warn,
+                fmt::format("{}RamsesLogger: dropped {} log messages because log queue was full", PrefixCombined, droppedCount) });
+        }
+    }
+
+    void RamsesLogger::flush()
+    {
+        if (m_activeAsyncQueue.load())
+            drainAsyncQueue();
+    }
+
+    bool RamsesLogger::isAsyncLoggingActive() const
+    {
+        return m_activeAsyncQueue.load() != nullptr;
+    }
+
+    uint64_t RamsesLogger::getDroppedMessageCount() const
+    {
+        const AsyncLogQueue* asyncQueue = m_activeAsyncQueue.load();
+        return asyncQueue ? asyncQueue->getTotalDroppedCount() : 0u;
     }
 
     void RamsesLogger::applyContextFilterCommand(const std::string& command)
@@ -280,11 +378,34 @@ namespace ramses::internal
         {
             msg.m_message.insert(0, PrefixCombined);
 
-            std::lock_guard<std::mutex> guard(m_appenderLock);
-            for (auto& appender : m_logAppenders)
+            // message is formatted already, only the (potentially blocking) appenders are deferred,
+            // producer is counted before queue is taken so that stopAsyncLogging can wait for its push
+            ++m_asyncLogProducers;
+            AsyncLogQueue* asyncQueue = m_activeAsyncQueue.load();
+            if (asyncQueue && msg.m_logLevel != ELogLevel::Fatal)
             {
-                appender->log(msg);
+                asyncQueue->push(std::move(msg));
+                if (m_asyncLogThreadWaiting.load(std::memory_order_relaxed))
+                    m_asyncLogThreadCondition.notify_one();
+                --m_asyncLogProducers;
+                return;
             }
+            --m_asyncLogProducers;
+
+            // fatal messages must not be lost, dispatch them directly after everything logged before
+            if (asyncQueue)
+                drainAsyncQueue();
+
+            std::lock_guard<std::mutex> guard(m_appenderLock);
+            dispatch(msg);
+        }
+    }
+
+    void RamsesLogger::dispatch(const LogMessage& msg)
+    {
+        for (auto& appender : m_logAppenders)
+        {
+            appender->log(msg);
         }
     }
 
@@ -316,6 +437,9 @@ namespace ramses::internal
             LOG_INFO(CONTEXT_FRAMEWORK, "RamsesLogger::setLogHandler: deleting a user logger");
         }
 
+        // queued messages still go to the previous handler
+        flush();
+
         std::lock_guard<std::mutex> guard(m_appenderLock);
         if (m_userLogAppender)
         {
@@ -13,6 +13,7 @@
 #include "internal/Core/Utils/ConsoleLogAppender.h"
 #include "internal/Core/Utils/LogAppenderBase.h"
 #include "internal/Core/Utils/UserLogAppender.h"
+#include "internal/Core/Utils/AsyncLogQueue.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 
 #include <cstdint>
@@ -21,6 +22,9 @@
 #include <memory>
 #include <optional>
 #include <map>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
 
 namespace ramses::internal
 {
@@ -35,6 +39,10 @@ namespace ramses::internal
         std::map<std::string, ELogLevel> logLevelContexts{}; // TODO: std::unordered_map<std::string, ELogLevel>
         std::string dltAppId = "RAMS";
         std::string dltAppDescription = "RAMS-DESC";
+        // dispatch messages to appenders on a background thread instead of the logging thread
+        bool asyncLogging = false;
+        size_t asyncLogQueueCapacity = 4096u; // messages per logging thread
+        ELogOverflowPolicy asyncLogOverflowPolicy = ELogOverflowPolicy::Block;
     };
 
     struct LogContextInformation
@@ -75,6 +83,13 @@ namespace ramses::internal
 
         void setLogHandler(const LogHandlerFunc& logHandlerFunc);
 
+        // dispatches all messages queued so far when asynchronous logging is enabled, no-op otherwise
+        void flush();
+        [[nodiscard]] bool isAsyncLoggingActive() const;
+        // dispatches all queued messages and logs synchronously from then on, called on destruction
+        void stopAsyncLogging();
+        [[nodiscard]] uint64_t getDroppedMessageCount() const;
+
         static const char* GetLogLevelText(ELogLevel logLevel);
         static const std::string& GetPrefixInstance();
 
@@ -94,6 +109,11 @@ namespace ramses::internal
         void dltLogLevelChangeCallback(const std::string& contextId, int logLevelAsInt);
         LogContext* getLogContextById(const std::string& contextId);
 
+        void startAsyncLogging(const RamsesLoggerConfig& config);
+        void asyncLogThreadLoop();
+        void dispatch(const LogMessage& msg);
+        void drainAsyncQueue();
+
         std::mutex m_appenderLock;
         std::atomic_bool m_isInitialized;
         ConsoleLogAppender m_consoleLogAppender;
@@ -104,6 +124,18 @@ namespace ramses::internal
         std::vector<LogAppenderBase*> m_logAppenders;
         LogContext& m_fileTransferContext;
 
+        std::unique_ptr<AsyncLogQueue> m_asyncQueue;
+        std::atomic<AsyncLogQueue*> m_activeAsyncQueue{nullptr};
+        // serializes consumers of async queue (log thread and flushing threads)
+        std::mutex m_drainLock;
+        std::thread m_asyncLogThread;
+        std::mutex m_asyncLogThreadLock;
+        std::condition_variable m_asyncLogThreadCondition;
+        std::atomic_bool m_asyncLogThreadWaiting{false};
+        // threads currently between taking the active queue and pushing to it
+        std::atomic<uint32_t> m_asyncLogProducers{0u};
+        bool m_stopAsyncLogThread = false;
+
         friend class RamsesLoggerPrefixes;
         friend class RamsesLoggerPrefixesExported;
     };
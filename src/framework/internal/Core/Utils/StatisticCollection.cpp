@@ -42,6 +42,7 @@ namespace ramses::internal
         statResourcesNumber.reset();
         statResourcesLoadedFromFileNumber.reset();
         statResourcesLoadedFromFileSize.reset();
+        statMaximumSendQueueSize.reset();
     }
 
     void StatisticCollectionFramework::resetSummaries()
@@ -55,6 +56,7 @@ namespace ramses::internal
         statResourcesNumber.getSummary().reset();
         statResourcesLoadedFromFileNumber.getSummary().reset();
         statResourcesLoadedFromFileSize.getSummary().reset();
+        statMaximumSendQueueSize.getSummary().reset();
     }
 
     void StatisticCollectionFramework::nextTimeInterval()
@@ -67,6 +69,7 @@ namespace ramses::internal
         const uint32_t resourcesDestroyed = statResourcesDestroyed.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileNumber.updateSummaryAndResetCounter();
         statResourcesLoadedFromFileSize.updateSummaryAndResetCounter();
+        statMaximumSendQueueSize.updateSummaryAndResetCounter();
 
         statResourcesNumber.incCounter(resourcesCreated);
         statResourcesNumber.decCounter(resourcesDestroyed);
@@ -177,6 +177,7 @@ namespace ramses::internal
         StatisticEntry<uint32_t, SummaryEntry> statResourcesNumber; //updated by values of statResourcesCreated and statResourcesDestroyed
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileNumber;
         StatisticEntry<uint32_t, SummaryEntry> statResourcesLoadedFromFileSize;
+        StatisticEntry<uint32_t, SummaryEntry> statMaximumSendQueueSize; // bytes queued for sending to a single participant
     };
 
     enum EResourceStatisticIndex : std::size_t // deliberately not enum class, supposed to be implicitly convertible
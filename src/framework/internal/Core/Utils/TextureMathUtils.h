@@ -9,6 +9,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 #include <algorithm>
 #include <cmath>
 #include <cassert>
@@ -57,5 +58,28 @@ namespace ramses::internal
             }
             return totalSizeInBytes;
         }
+
+        // Computes next lower mip level of tightly packed 8-bit per channel texel data using 2x2 box filter.
+        // Odd source dimensions clamp the filter footprint to the last texel row/column.
+        static void GenerateLowerMipLevel(const std::byte* srcData, uint32_t srcWidth, uint32_t srcHeight, uint32_t channelCount, std::byte* dstData)
+        {
+            const uint32_t dstWidth = GetLowerMipSize(srcWidth);
+            const uint32_t dstHeight = GetLowerMipSize(srcHeight);
+            const auto srcTexel = [&](uint32_t x, uint32_t y, uint32_t c) {
+                return static_cast<uint32_t>(srcData[(std::min(y, srcHeight - 1u) * srcWidth + std::min(x, srcWidth - 1u)) * channelCount + c]);
+            };
+
+            for (uint32_t y = 0u; y < dstHeight; ++y)
+            {
+                for (uint32_t x = 0u; x < dstWidth; ++x)
+                {
+                    for (uint32_t c = 0u; c < channelCount; ++c)
+                    {
+                        const uint32_t sum = srcTexel(2u * x, 2u * y, c) + srcTexel(2u * x + 1u, 2u * y, c) + srcTexel(2u * x, 2u * y + 1u, c) + srcTexel(2u * x + 1u, 2u * y + 1u, c);
+                        *dstData++ = static_cast<std::byte>((sum + 2u) / 4u);
+                    }
+                }
+            }
+        }
     };
 }
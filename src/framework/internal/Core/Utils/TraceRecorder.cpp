@@ -0,0 +1,204 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/TraceRecorder.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+#include <algorithm>
+#include <fstream>
+
+#ifdef _WIN32
+#include "internal/PlatformAbstraction/MinimalWindowsH.h"
+#else
+#include <unistd.h>
+#endif
+
+namespace ramses::internal
+{
+    namespace
+    {
+        uint64_t GetProcessId()
+        {
+#ifdef _WIN32
+            return static_cast<uint64_t>(::GetCurrentProcessId());
+#else
+            return static_cast<uint64_t>(::getpid());
+#endif
+        }
+
+        std::atomic<uint64_t> NextRecorderId{ 1u };
+    }
+
+    TraceRecorder::TraceRecorder(size_t eventsPerThread)
+        : m_eventsPerThread(std::max<size_t>(eventsPerThread, 1u))
+        , m_recorderId(NextRecorderId++)
+    {
+    }
+
+    void TraceRecorder::enable(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    TraceRecorder::ThreadBuffer& TraceRecorder::getThreadBuffer()
+    {
+        // recorder id protects from using buffer of another recorder, buffer is marked as exited when thread ends
+        // or starts to record to another recorder
+        struct CachedThreadBuffer
+        {
+            CachedThreadBuffer() = default;
+            CachedThreadBuffer(const CachedThreadBuffer&) = delete;
+            CachedThreadBuffer& operator=(const CachedThreadBuffer&) = delete;
+            ~CachedThreadBuffer()
+            {
+                if (buffer)
+                    buffer->threadExited = true;
+            }
+
+            uint64_t recorderId = 0u;
+            std::shared_ptr<ThreadBuffer> buffer;
+        };
+        thread_local CachedThreadBuffer cachedBuffer;
+        if (cachedBuffer.recorderId != m_recorderId)
+        {
+            if (cachedBuffer.buffer)
+                cachedBuffer.buffer->threadExited = true;
+            cachedBuffer.buffer = acquireThreadBuffer();
+            cachedBuffer.recorderId = m_recorderId;
+        }
+        return *cachedBuffer.buffer;
+    }
+
+    std::shared_ptr<TraceRecorder::ThreadBuffer> TraceRecorder::acquireThreadBuffer()
+    {
+        std::lock_guard<std::mutex> lock{ m_threadBuffersLock };
+
+        size_t numExited = 0u;
+        for (const auto& buffer : m_threadBuffers)
+        {
+            if (!buffer->threadExited)
+                continue;
+            std::lock_guard<std::mutex> bufferLock{ buffer->lock };
+            if (buffer->events.empty())
+            {
+                // recycle buffer of exited thread which has nothing to export anymore
+                buffer->threadExited = false;
+                buffer->threadId = ++m_lastThreadId;
+                return buffer;
+            }
+            ++numExited;
+        }
+
+        // release oldest buffers of exited threads with events not exported yet
+        for (auto it = m_threadBuffers.begin(); it != m_threadBuffers.end() && numExited >= MaxExitedThreadBuffers;)
+        {
+            if ((*it)->threadExited)
+            {
+                it = m_threadBuffers.erase(it);
+                --numExited;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        auto& buffer = m_threadBuffers.emplace_back(std::make_shared<ThreadBuffer>());
+        buffer->threadId = ++m_lastThreadId;
+        buffer->events.reserve(m_eventsPerThread);
+        return buffer;
+    }
+
+    void TraceRecorder::addEvent(const char* category, const char* name, uint64_t startTime, uint64_t endTime)
+    {
+        if (!isEnabled())
+            return;
+
+        ThreadBuffer& buffer = getThreadBuffer();
+        const Event event{ category, name, startTime, endTime > startTime ? endTime - startTime : 0u };
+
+        std::lock_guard<std::mutex> lock{ buffer.lock };
+        if (buffer.events.size() < m_eventsPerThread)
+            buffer.events.push_back(event);
+        else
+            buffer.events[buffer.nextEvent] = event;
+        buffer.nextEvent = (buffer.nextEvent + 1u) % m_eventsPerThread;
+    }
+
+    std::vector<TraceRecorder::Event> TraceRecorder::getEvents() const
+    {
+        std::vector<Event> events;
+        std::lock_guard<std::mutex> lock{ m_threadBuffersLock };
+        for (const auto& buffer : m_threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock{ buffer->lock };
+            // oldest event is at next write position once ring buffer is full
+            const auto oldest = (buffer->events.size() < m_eventsPerThread ? 0u : buffer->nextEvent);
+            events.insert(events.end(), buffer->events.cbegin() + static_cast<std::ptrdiff_t>(oldest), buffer->events.cend());
+            events.insert(events.end(), buffer->events.cbegin(), buffer->events.cbegin() + static_cast<std::ptrdiff_t>(oldest));
+        }
+        return events;
+    }
+
+    void TraceRecorder::clear()
+    {
+        std::lock_guard<std::mutex> lock{ m_threadBuffersLock };
+        m_threadBuffers.erase(std::remove_if(m_threadBuffers.begin(), m_threadBuffers.end(), [](const auto& buffer) { return buffer->threadExited.load(); }), m_threadBuffers.end());
+        for (const auto& buffer : m_threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock{ buffer->lock };
+            buffer->events.clear();
+            buffer->nextEvent = 0u;
+        }
+    }
+
+    size_t TraceRecorder::getNumberOfThreadBuffers() const
+    {
+        std::lock_guard<std::mutex> lock{ m_threadBuffersLock };
+        return m_threadBuffers.size();
+    }
+
+    void TraceRecorder::writeChromeTrace(std::ostream& os) const
+    {
+        const auto processId = GetProcessId();
+
+        os << R"({"displayTimeUnit":"ms","traceEvents":[)";
+        bool first = true;
+        std::lock_guard<std::mutex> lock{ m_threadBuffersLock };
+        for (const auto& buffer : m_threadBuffers)
+        {
+            std::lock_guard<std::mutex> bufferLock{ buffer->lock };
+            for (const auto& event : buffer->events)
+            {
+                os << (first ? "\n" : ",\n");
+                first = false;
+                os << fmt::format(R"({{"name":"{}","cat":"{}","ph":"X","ts":{},"dur":{},"pid":{},"tid":{}}})",
+                    event.name, event.category, event.startTime, event.duration, processId, buffer->threadId);
+            }
+        }
+        os << "\n]}\n";
+    }
+
+    bool TraceRecorder::writeChromeTraceToFile(std::string_view fileName) const
+    {
+        std::ofstream file{ std::string{ fileName } };
+        if (!file)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "TraceRecorder: failed to open file '{}' for writing", fileName);
+            return false;
+        }
+        writeChromeTrace(file);
+        return file.good();
+    }
+
+    TraceRecorder& GetTraceRecorder()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+}
@@ -0,0 +1,123 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/APIExport.h"
+#include "internal/PlatformAbstraction/PlatformTime.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace ramses::internal
+{
+    /**
+     * Records durations of scopes into per thread ring buffers and exports them in Chrome trace event format
+     * (chrome://tracing, Perfetto). Recording is disabled by default, a disabled scope costs a single atomic load.
+     * Timestamps are taken from the synchronized clock so that traces of several processes can be correlated.
+     */
+    class TraceRecorder
+    {
+    public:
+        struct Event
+        {
+            const char* category = nullptr;
+            const char* name = nullptr;
+            uint64_t startTime = 0u;
+            uint64_t duration = 0u;
+        };
+
+        static constexpr size_t DefaultEventsPerThread = 16384u;
+
+        explicit TraceRecorder(size_t eventsPerThread = DefaultEventsPerThread);
+
+        void enable(bool enabled);
+        [[nodiscard]] bool isEnabled() const;
+
+        // category and name are stored as pointers and have to outlive the recorder (use string literals)
+        void addEvent(const char* category, const char* name, uint64_t startTime, uint64_t endTime);
+
+        // returns recorded events of all threads, only the most recent events are kept if a thread's ring buffer overflowed
+        [[nodiscard]] std::vector<Event> getEvents() const;
+        // also releases buffers of exited threads
+        void clear();
+
+        // buffers of exited threads keep their events for export, only this many of them are kept (oldest are released)
+        static constexpr size_t MaxExitedThreadBuffers = 8u;
+        [[nodiscard]] size_t getNumberOfThreadBuffers() const;
+
+        void writeChromeTrace(std::ostream& os) const;
+        [[nodiscard]] bool writeChromeTraceToFile(std::string_view fileName) const;
+
+    private:
+        struct ThreadBuffer
+        {
+            uint32_t threadId = 0u;
+            // only contended while events are being collected
+            std::mutex lock;
+            std::vector<Event> events;
+            size_t nextEvent = 0u;
+            // set when owning thread exits, buffer is then reused by new thread if empty or released
+            std::atomic<bool> threadExited{ false };
+        };
+
+        ThreadBuffer& getThreadBuffer();
+        [[nodiscard]] std::shared_ptr<ThreadBuffer> acquireThreadBuffer();
+
+        std::atomic<bool> m_enabled{ false };
+        const size_t m_eventsPerThread;
+        const uint64_t m_recorderId;
+
+        mutable std::mutex m_threadBuffersLock;
+        // shared with thread local reference of owning thread, which can outlive the recorder
+        std::vector<std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+        uint32_t m_lastThreadId = 0u;
+    };
+
+    RAMSES_IMPL_EXPORT TraceRecorder& GetTraceRecorder();
+
+    inline bool TraceRecorder::isEnabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    class ScopedTraceEvent
+    {
+    public:
+        ScopedTraceEvent(const char* category, const char* name)
+            : m_category(category)
+            , m_name(name)
+            , m_startTime(GetTraceRecorder().isEnabled() ? PlatformTime::GetMicrosecondsSynchronized() : 0u)
+        {
+        }
+
+        ~ScopedTraceEvent()
+        {
+            if (m_startTime != 0u)
+                GetTraceRecorder().addEvent(m_category, m_name, m_startTime, PlatformTime::GetMicrosecondsSynchronized());
+        }
+
+        ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+        ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+    private:
+        const char* m_category;
+        const char* m_name;
+        uint64_t m_startTime;
+    };
+}
+
+#define RAMSES_TRACE_CONCAT_INNER(a, b) a##b
+#define RAMSES_TRACE_CONCAT(a, b) RAMSES_TRACE_CONCAT_INNER(a, b)
+#define RAMSES_TRACE_SCOPE(category, name) \
+    const ::ramses::internal::ScopedTraceEvent RAMSES_TRACE_CONCAT(traceScope, __LINE__){ category, name }
@@ -0,0 +1,299 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/PlatformError.h"
+#include "internal/PlatformAbstraction/Hash.h"
+#include "internal/PlatformAbstraction/Macros.h"
+
+#include "absl/container/flat_hash_set.h"
+
+#include <cstddef>
+#include <utility>
+
+namespace ramses::internal
+{
+    /**
+     * Hash table with the same interface as HashMap, backed by an open addressing (swiss table) abseil container.
+     * Entries are stored inline in a flat array with group-wise probing of control bytes, this gives better locality
+     * than the chained HashMap for lookup heavy maps like resource registries keyed by resource hash.
+     *
+     * As with HashMap, pointers and iterators to entries are invalidated by insertion, removal keeps other entries in place.
+     */
+    template <class Key, class T>
+    class FlatHashMap final
+    {
+    public:
+        class Pair final
+        {
+        public:
+            Pair(Key key_, T value_)
+                : key(std::move(key_))
+                , value(std::move(value_))
+            {
+            }
+
+            const Key key;
+            T value;
+        };
+
+    private:
+        struct PairHash
+        {
+            using is_transparent = void;
+            size_t operator()(const Key& key) const { return HashValue(key); }
+            size_t operator()(const Pair& pair) const { return HashValue(pair.key); }
+        };
+
+        struct PairEqual
+        {
+            using is_transparent = void;
+            bool operator()(const Pair& a, const Pair& b) const { return a.key == b.key; }
+            bool operator()(const Pair& a, const Key& b) const { return a.key == b; }
+            bool operator()(const Key& a, const Pair& b) const { return a == b.key; }
+        };
+
+        using Set = absl::flat_hash_set<Pair, PairHash, PairEqual>;
+
+    public:
+        class ConstIterator final
+        {
+        public:
+            ConstIterator() = default;
+            explicit ConstIterator(typename Set::const_iterator it)
+                : m_it(it)
+            {
+            }
+
+            const Pair& operator*() const
+            {
+                return *m_it;
+            }
+
+            const Pair* operator->() const
+            {
+                return &*m_it;
+            }
+
+            bool operator==(const ConstIterator& iter) const
+            {
+                return m_it == iter.m_it;
+            }
+
+            bool operator!=(const ConstIterator& iter) const
+            {
+                return m_it != iter.m_it;
+            }
+
+            ConstIterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+
+            // NOLINTNEXTLINE(readability-const-return-type): required by cert-dcl21-cpp
+            const ConstIterator operator++(int32_t)
+            {
+                ConstIterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            typename Set::const_iterator m_it;
+        };
+
+        class Iterator final
+        {
+        public:
+            friend class FlatHashMap;
+
+            Iterator() = default;
+            explicit Iterator(typename Set::iterator it)
+                : m_it(it)
+            {
+            }
+
+            // set exposes its elements as const to protect the hashed part, the key of Pair is const by itself
+            Pair& operator*() const
+            {
+                return const_cast<Pair&>(*m_it);
+            }
+
+            Pair* operator->() const
+            {
+                return &const_cast<Pair&>(*m_it);
+            }
+
+            bool operator==(const Iterator& iter) const
+            {
+                return m_it == iter.m_it;
+            }
+
+            bool operator!=(const Iterator& iter) const
+            {
+                return m_it != iter.m_it;
+            }
+
+            Iterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+
+            // NOLINTNEXTLINE(readability-const-return-type): required by cert-dcl21-cpp
+            const Iterator operator++(int32_t)
+            {
+                Iterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            typename Set::iterator m_it;
+        };
+
+        FlatHashMap() = default;
+
+        explicit FlatHashMap(size_t minimumCapacity)
+        {
+            m_set.reserve(minimumCapacity);
+        }
+
+        /**
+         * overloading subscript operator to get read and write access to element referenced by given key.
+         *
+         * @param key Key value
+         * @return value Value referenced by key. If no value is stored for given key, a default constructed object is added and returned
+         */
+        T& operator[](const Key& key)
+        {
+            if (T* value = get(key))
+                return *value;
+            return put(key, T())->value;
+        }
+
+        Iterator put(const Key& key, const T& value)
+        {
+            Iterator it = find(key);
+            if (it != end())
+            {
+                it->value = value;
+                return it;
+            }
+            return Iterator(m_set.insert(Pair(key, value)).first);
+        }
+
+        EStatus get(const Key& key, T& value) const
+        {
+            const auto it = m_set.find(key);
+            if (it == m_set.end())
+                return EStatus::NotExist;
+            value = it->value;
+            return EStatus::Ok;
+        }
+
+        RNODISCARD T* get(const Key& key) const
+        {
+            const auto it = m_set.find(key);
+            if (it == m_set.end())
+                return nullptr;
+            // same broken constness as HashMap::get
+            return &const_cast<Pair&>(*it).value;
+        }
+
+        RNODISCARD Iterator find(const Key& key)
+        {
+            return Iterator(m_set.find(key));
+        }
+
+        RNODISCARD ConstIterator find(const Key& key) const
+        {
+            return ConstIterator(m_set.find(key));
+        }
+
+        RNODISCARD bool contains(const Key& key) const
+        {
+            return m_set.contains(key);
+        }
+
+        bool remove(const Key& key, T* value_old = nullptr)
+        {
+            Iterator it = find(key);
+            if (it == end())
+                return false;
+            remove(it, value_old);
+            return true;
+        }
+
+        Iterator remove(Iterator iter, T* value_old = nullptr)
+        {
+            Iterator next = iter;
+            ++next;
+            if (value_old)
+                *value_old = std::move(iter->value);
+            m_set.erase(iter.m_it);
+            return next;
+        }
+
+        RNODISCARD size_t size() const
+        {
+            return m_set.size();
+        }
+
+        void clear()
+        {
+            m_set.clear();
+        }
+
+        RNODISCARD Iterator begin()
+        {
+            return Iterator(m_set.begin());
+        }
+
+        RNODISCARD ConstIterator begin() const
+        {
+            return ConstIterator(m_set.begin());
+        }
+
+        RNODISCARD Iterator end()
+        {
+            return Iterator(m_set.end());
+        }
+
+        RNODISCARD ConstIterator end() const
+        {
+            return ConstIterator(m_set.end());
+        }
+
+        void reserve(size_t requestedCapacity)
+        {
+            m_set.reserve(requestedCapacity);
+        }
+
+        RNODISCARD size_t capacity() const
+        {
+            return m_set.capacity();
+        }
+
+        void swap(FlatHashMap<Key, T>& other)
+        {
+            m_set.swap(other.m_set);
+        }
+
+    private:
+        Set m_set;
+    };
+
+    template <class Key, class T>
+    inline void swap(FlatHashMap<Key, T>& first, FlatHashMap<Key, T>& second)
+    {
+        first.swap(second);
+    }
+}
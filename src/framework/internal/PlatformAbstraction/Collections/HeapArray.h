@@ -25,8 +25,13 @@ namespace ramses::internal
         static_assert(std::is_same_v<T, std::byte> || std::is_integral_v<T>, "only integral types or std::byte allowed");
 
     public:
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+        using OwnedData = std::unique_ptr<T[], void (*)(const T*)>;
+
         explicit HeapArray(size_t size = 0, const T* data = nullptr);
         HeapArray(size_t size, HeapArray&& other);
+        // takes ownership of given data without copying it, data is released using its deleter
+        HeapArray(size_t size, OwnedData data);
 
         HeapArray(const HeapArray&) = delete;
         HeapArray& operator=(const HeapArray&) = delete;
@@ -42,16 +47,17 @@ namespace ramses::internal
         void setZero();
 
     private:
+        static void DeleteArray(const T* data);
+
         size_t m_size;
-        // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-        std::unique_ptr<T[]> m_data;
+        OwnedData m_data;
     };
 
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(size_t size, const T* data)
         : m_size(size)
-        , m_data(m_size > 0 ? new T[m_size] : nullptr)
+        , m_data(m_size > 0 ? new T[m_size] : nullptr, &DeleteArray)
     {
         if (m_data && data)
         {
@@ -70,6 +76,14 @@ namespace ramses::internal
         other.m_size = 0;
     }
 
+    template <typename T, typename UniqueIdT>
+    inline
+    HeapArray<T, UniqueIdT>::HeapArray(size_t size, OwnedData data)
+        : m_size(data ? size : 0u)
+        , m_data(std::move(data))
+    {
+    }
+
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(HeapArray&& o) noexcept
@@ -120,6 +134,13 @@ namespace ramses::internal
         return {m_data.get(), m_size};
     }
 
+    template <typename T, typename UniqueIdT>
+    inline
+    void HeapArray<T, UniqueIdT>::DeleteArray(const T* data)
+    {
+        delete[] data;
+    }
+
     template <typename T, typename UniqueIdT>
     inline
     void HeapArray<T, UniqueIdT>::setZero()
@@ -16,6 +16,7 @@
 #include <string>
 #include <string_view>
 #include <exception>
+#include <vector>
 
 #ifdef _WIN32
 #include "internal/PlatformAbstraction/internal/Thread_std.h"
@@ -44,6 +45,13 @@ namespace ramses::internal
         [[nodiscard]] bool joinable() const;
 
         static void Sleep(uint32_t msec);
+        // Restricts calling thread to run only on given CPUs, returns false if not supported on platform or failed
+        static bool SetCurrentThreadCpuAffinity(const std::vector<uint32_t>& cpuIds);
+        // Applies scheduling policy, priority and CPU affinity to calling thread, values left at default are not changed.
+        // Returns false if any of them is not supported on platform or failed (e.g. missing privileges for realtime policies)
+        static bool SetCurrentThreadScheduling(const ThreadScheduling& scheduling);
+        // Scheduling the calling thread actually runs with, empty CPU affinity if not restricted or not supported on platform
+        static ThreadScheduling GetCurrentThreadScheduling();
 
     private:
         std::string m_name;
@@ -118,4 +126,27 @@ namespace ramses::internal
     {
         std::this_thread::sleep_for(std::chrono::milliseconds{msec});
     }
+
+    inline
+    bool PlatformThread::SetCurrentThreadCpuAffinity(const std::vector<uint32_t>& cpuIds)
+    {
+        return internal::Thread::SetCurrentThreadCpuAffinity(cpuIds);
+    }
+
+    inline
+    bool PlatformThread::SetCurrentThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        bool success = true;
+        if (scheduling.policy != EThreadSchedulingPolicy::Default || scheduling.priority != 0)
+            success = internal::Thread::SetCurrentThreadSchedulingPolicy(scheduling.policy, scheduling.priority);
+        if (!scheduling.cpuAffinity.empty())
+            success = internal::Thread::SetCurrentThreadCpuAffinity(scheduling.cpuAffinity) && success;
+        return success;
+    }
+
+    inline
+    ThreadScheduling PlatformThread::GetCurrentThreadScheduling()
+    {
+        return internal::Thread::GetCurrentThreadScheduling();
+    }
 }
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses/framework/RamsesFrameworkTypes.h"
+#include "internal/PlatformAbstraction/FmtBase.h"
+#include "internal/Core/Utils/LoggingUtils.h"
+
+#include <vector>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // scheduling of a thread, default constructed means platform defaults for policy and priority and no CPU restriction
+    struct ThreadScheduling
+    {
+        EThreadSchedulingPolicy policy = EThreadSchedulingPolicy::Default;
+        int32_t priority = 0;
+        std::vector<uint32_t> cpuAffinity;
+
+        [[nodiscard]] bool isDefault() const
+        {
+            return policy == EThreadSchedulingPolicy::Default && priority == 0 && cpuAffinity.empty();
+        }
+
+        // default policy has no priorities, realtime policies use the range guaranteed by Linux
+        [[nodiscard]] bool hasValidPriority() const
+        {
+            if (policy == EThreadSchedulingPolicy::Default)
+                return priority == 0;
+            return priority >= 1 && priority <= 99;
+        }
+
+        bool operator==(const ThreadScheduling& other) const
+        {
+            return policy == other.policy && priority == other.priority && cpuAffinity == other.cpuAffinity;
+        }
+
+        bool operator!=(const ThreadScheduling& other) const
+        {
+            return !operator==(other);
+        }
+    };
+
+    const std::array ThreadSchedulingPolicyNames =
+    {
+        "Default",
+        "Fifo",
+        "RoundRobin",
+    };
+}
+
+MAKE_ENUM_CLASS_PRINTABLE(ramses::EThreadSchedulingPolicy, "EThreadSchedulingPolicy", ramses::internal::ThreadSchedulingPolicyNames, ramses::EThreadSchedulingPolicy::RoundRobin);
+
+template <>
+struct fmt::formatter<ramses::internal::ThreadScheduling> : public ramses::internal::SimpleFormatterBase
+{
+    template<typename FormatContext>
+    constexpr auto format(const ramses::internal::ThreadScheduling& scheduling, FormatContext& ctx) const
+    {
+        if (scheduling.cpuAffinity.empty())
+            return fmt::format_to(ctx.out(), "policy={} priority={} cpus=any", scheduling.policy, scheduling.priority);
+        return fmt::format_to(ctx.out(), "policy={} priority={} cpus=[{}]", scheduling.policy, scheduling.priority, fmt::join(scheduling.cpuAffinity, ","));
+    }
+};
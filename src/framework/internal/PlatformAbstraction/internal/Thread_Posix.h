@@ -10,10 +10,16 @@
 
 #include "internal/PlatformAbstraction/Macros.h"
 #include "internal/Core/Utils/AssertMovable.h"
+#include "internal/PlatformAbstraction/ThreadScheduling.h"
 #include <thread>
 #include <functional>
 #include <cassert>
 #include <pthread.h>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
 
 namespace ramses::internal
 {
@@ -35,6 +41,10 @@ namespace internal
         [[nodiscard]] bool joinable() const;
         void join();
 
+        static bool SetCurrentThreadCpuAffinity(const std::vector<uint32_t>& cpuIds);
+        static bool SetCurrentThreadSchedulingPolicy(EThreadSchedulingPolicy policy, int32_t priority);
+        static ThreadScheduling GetCurrentThreadScheduling();
+
         Thread(const Thread&) = delete;
         Thread& operator=(const Thread&) = delete;
 
@@ -120,5 +130,74 @@ namespace internal
             pthread_join(m_threadId, nullptr);
         m_running = false;
     }
+    inline bool Thread::SetCurrentThreadCpuAffinity([[maybe_unused]] const std::vector<uint32_t>& cpuIds)
+    {
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        bool anyCpuSet = false;
+        for (const auto cpuId : cpuIds)
+        {
+            if (cpuId < CPU_SETSIZE)
+            {
+                CPU_SET(cpuId, &cpuSet);
+                anyCpuSet = true;
+            }
+        }
+        // pid 0 refers to calling thread
+        return anyCpuSet && sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0;
+#else
+        return false;
+#endif
+    }
+
+    inline bool Thread::SetCurrentThreadSchedulingPolicy(EThreadSchedulingPolicy policy, int32_t priority)
+    {
+        int nativePolicy = SCHED_OTHER;
+        switch (policy)
+        {
+        case EThreadSchedulingPolicy::Default:
+            nativePolicy = SCHED_OTHER;
+            break;
+        case EThreadSchedulingPolicy::Fifo:
+            nativePolicy = SCHED_FIFO;
+            break;
+        case EThreadSchedulingPolicy::RoundRobin:
+            nativePolicy = SCHED_RR;
+            break;
+        }
+        sched_param param{};
+        param.sched_priority = priority;
+        return pthread_setschedparam(pthread_self(), nativePolicy, &param) == 0;
+    }
+
+    inline ThreadScheduling Thread::GetCurrentThreadScheduling()
+    {
+        ThreadScheduling scheduling;
+        int nativePolicy = SCHED_OTHER;
+        sched_param param{};
+        if (pthread_getschedparam(pthread_self(), &nativePolicy, &param) == 0)
+        {
+            if (nativePolicy == SCHED_FIFO)
+                scheduling.policy = EThreadSchedulingPolicy::Fifo;
+            else if (nativePolicy == SCHED_RR)
+                scheduling.policy = EThreadSchedulingPolicy::RoundRobin;
+            scheduling.priority = param.sched_priority;
+        }
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        // pid 0 refers to calling thread, no restriction is reported as empty affinity
+        if (sched_getaffinity(0, sizeof(cpuSet), &cpuSet) == 0 && CPU_COUNT(&cpuSet) < static_cast<int>(std::thread::hardware_concurrency()))
+        {
+            for (uint32_t cpuId = 0u; cpuId < CPU_SETSIZE; ++cpuId)
+            {
+                if (CPU_ISSET(cpuId, &cpuSet))
+                    scheduling.cpuAffinity.push_back(cpuId);
+            }
+        }
+#endif
+        return scheduling;
+    }
 }
 }
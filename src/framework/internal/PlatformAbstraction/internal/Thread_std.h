@@ -10,8 +10,10 @@
 
 #include "internal/PlatformAbstraction/Macros.h"
 #include "internal/Core/Utils/AssertMovable.h"
+#include "internal/PlatformAbstraction/ThreadScheduling.h"
 #include <thread>
 #include <functional>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -31,6 +33,10 @@ namespace internal
         bool joinable() const;
         void join();
 
+        static bool SetCurrentThreadCpuAffinity(const std::vector<uint32_t>& cpuIds);
+        static bool SetCurrentThreadSchedulingPolicy(EThreadSchedulingPolicy policy, int32_t priority);
+        static ThreadScheduling GetCurrentThreadScheduling();
+
         Thread(const Thread&) = delete;
         Thread& operator=(const Thread&) = delete;
 
@@ -54,5 +60,21 @@ namespace internal
     {
         m_thread.join();
     }
+    inline bool Thread::SetCurrentThreadCpuAffinity(const std::vector<uint32_t>& /*cpuIds*/)
+    {
+        // not supported
+        return false;
+    }
+
+    inline bool Thread::SetCurrentThreadSchedulingPolicy(EThreadSchedulingPolicy policy, int32_t priority)
+    {
+        // only default scheduling supported
+        return policy == EThreadSchedulingPolicy::Default && priority == 0;
+    }
+
+    inline ThreadScheduling Thread::GetCurrentThreadScheduling()
+    {
+        return {};
+    }
 }
 }
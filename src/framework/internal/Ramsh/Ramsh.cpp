@@ -18,6 +18,7 @@
 #include "internal/Ramsh/RamshCommandSetContextLogLevel.h"
 #include "internal/Ramsh/RamshCommandSetContextLogLevelFilter.h"
 #include "internal/Ramsh/RamshCommandPrintLogLevels.h"
+#include "internal/Ramsh/RamshCommandTrace.h"
 #include <mutex>
 
 namespace ramses::internal
@@ -44,6 +45,9 @@ namespace ramses::internal
 
         m_pCmdPrintLogLevels = std::make_shared<RamshCommandPrintLogLevels>(*this);
         add(m_pCmdPrintLogLevels);
+
+        m_cmdTrace = std::make_shared<RamshCommandTrace>();
+        add(m_cmdTrace);
     }
 
     Ramsh::~Ramsh() = default;
@@ -24,6 +24,7 @@ namespace ramses::internal
     class RamshCommandSetContextLogLevel;
     class RamshCommandSetContextLogLevelFilter;
     class RamshCommandPrintLogLevels;
+    class RamshCommandTrace;
 
     class Ramsh
     {
@@ -50,5 +51,6 @@ namespace ramses::internal
         std::shared_ptr<RamshCommandSetContextLogLevel> m_pCmdSetContextLogLevel;
         std::shared_ptr<RamshCommandSetContextLogLevelFilter> m_pCmdSetContextLogLevelFilter;
         std::shared_ptr<RamshCommandPrintLogLevels> m_pCmdPrintLogLevels;
+        std::shared_ptr<RamshCommandTrace> m_cmdTrace;
     };
 }
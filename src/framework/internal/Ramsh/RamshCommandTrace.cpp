@@ -0,0 +1,51 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#include "internal/Ramsh/RamshCommandTrace.h"
+#include "internal/Core/Utils/TraceRecorder.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+namespace ramses::internal
+{
+    RamshCommandTrace::RamshCommandTrace()
+    {
+        registerKeyword("trace");
+        description = "Records timing events, dumps them as Chrome trace (chrome://tracing, Perfetto). Usage: trace {on | off | clear | dump <file>}";
+    }
+
+    bool RamshCommandTrace::executeInput(const std::vector<std::string>& input)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        if (input.size() == 2u && input[1] == "on")
+        {
+            LOG_INFO(CONTEXT_RAMSH, "Trace recording enabled");
+            recorder.enable(true);
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "off")
+        {
+            LOG_INFO(CONTEXT_RAMSH, "Trace recording disabled");
+            recorder.enable(false);
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "clear")
+        {
+            recorder.clear();
+            return true;
+        }
+        if (input.size() == 3u && input[1] == "dump")
+        {
+            if (!recorder.writeChromeTraceToFile(input[2]))
+                return false;
+            LOG_INFO(CONTEXT_RAMSH, "Trace written to {}", input[2]);
+            return true;
+        }
+        return false;
+    }
+}
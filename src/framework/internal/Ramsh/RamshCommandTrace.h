@@ -0,0 +1,22 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#pragma once
+
+#include "internal/Ramsh/RamshCommand.h"
+
+namespace ramses::internal
+{
+    class RamshCommandTrace : public RamshCommand
+    {
+    public:
+        RamshCommandTrace();
+        bool executeInput(const std::vector<std::string>& input) override;
+    };
+}
@@ -25,6 +25,15 @@ namespace ramses::internal
         {
         }
 
+        // takes over given data, its size must match element count and type
+        ArrayResource(EResourceType arrayType, uint32_t elementCount, EDataType elementType, ResourceBlob arrayData, std::string_view name)
+            : BufferResource(arrayType, std::move(arrayData), name)
+            , m_elementCount(elementCount)
+            , m_elementType(elementType)
+        {
+            assert(getDecompressedDataSize() == elementCount * EnumToSize(elementType));
+        }
+
         uint32_t getElementCount() const
         {
             return m_elementCount;
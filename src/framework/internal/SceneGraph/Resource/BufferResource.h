@@ -23,5 +23,12 @@ namespace ramses::internal
             if (dataSize != 0u)
                 setResourceData(ResourceBlob(dataSize, static_cast<const std::byte*>(data)));
         }
+
+        BufferResource(EResourceType typeID, ResourceBlob data, std::string_view name)
+            : ResourceBase(typeID, name)
+        {
+            if (data.size() != 0u)
+                setResourceData(std::move(data));
+        }
     };
 }
@@ -15,6 +15,11 @@ namespace ramses::internal
     namespace LZ4CompressionUtils
     {
         CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level)
+        {
+            return compress(absl::Span<const std::byte>(plainBuffer.data(), plainBuffer.size()), level);
+        }
+
+        CompressedResourceBlob compress(absl::Span<const std::byte> plainBuffer, CompressionLevel level)
         {
             const int plainSize = static_cast<int>(plainBuffer.size());
             if (plainSize == 0)
@@ -57,17 +62,25 @@ namespace ramses::internal
                 return ResourceBlob();
 
             ResourceBlob plainBuffer(uncompressedSize);
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-            int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
-                                                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                                                        reinterpret_cast<char*>(plainBuffer.data()),
-                                                        static_cast<int>(compressedData.size()),
-                                                        static_cast<int>(plainBuffer.size()));
-
-            if (bytesDecompressed != static_cast<int>(plainBuffer.size()))
+            if (!decompress(absl::Span<const std::byte>(compressedData.data(), compressedData.size()), absl::Span<std::byte>(plainBuffer.data(), plainBuffer.size())))
                 return ResourceBlob();
 
             return plainBuffer;
         }
+
+        bool decompress(absl::Span<const std::byte> compressedData, absl::Span<std::byte> plainData)
+        {
+            if (compressedData.empty() || plainData.empty())
+                return false;
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+            const int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
+                                                              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                                                              reinterpret_cast<char*>(plainData.data()),
+                                                              static_cast<int>(compressedData.size()),
+                                                              static_cast<int>(plainData.size()));
+
+            return bytesDecompressed == static_cast<int>(plainData.size());
+        }
     }
 }
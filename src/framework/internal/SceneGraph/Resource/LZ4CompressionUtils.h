@@ -10,6 +10,7 @@
 
 #include "internal/PlatformAbstraction/Collections/HeapArray.h"
 #include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include "absl/types/span.h"
 
 namespace ramses::internal
 {
@@ -23,6 +24,10 @@ namespace ramses::internal
 
         CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level);
         ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize);
+
+        // variants for data not held in resource blobs, decompress returns false if plainData size does not match decompressed size
+        CompressedResourceBlob compress(absl::Span<const std::byte> plainData, CompressionLevel level);
+        bool decompress(absl::Span<const std::byte> compressedData, absl::Span<std::byte> plainData);
     }
 }
 
@@ -8,12 +8,13 @@
 
 #include "internal/SceneGraph/Resource/ResourceBase.h"
 #include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+#include "internal/SceneGraph/Resource/ResourceDataHashing.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
 #include <city.h>
 
 namespace ramses::internal
 {
-    void ResourceBase::updateHash() const
+    void ResourceBase::updateHash(ITaskQueue* taskQueue) const
     {
         if (!m_data.data() || m_data.size() == 0)
         {
@@ -25,15 +26,14 @@ namespace ramses::internal
         else
         {
             // hash blob
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-            const cityhash::uint128 cityHashBlob = cityhash::CityHash128(reinterpret_cast<const char*>(m_data.data()), m_data.size());
+            const ResourceContentHash blobHash = ResourceDataHashing::HashData(m_data.span(), taskQueue);
 
             // hash metadata
             BinaryOutputStream metaDataStream(1024);
             metaDataStream << static_cast<uint32_t>(m_typeID);
             serializeResourceMetadataToStream(metaDataStream);
-            metaDataStream << cityhash::Uint128Low64(cityHashBlob);
-            metaDataStream << cityhash::Uint128High64(cityHashBlob);
+            metaDataStream << blobHash.lowPart;
+            metaDataStream << blobHash.highPart;
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
             const cityhash::uint128 cityHashMetadataAndBlob = cityhash::CityHash128(reinterpret_cast<const char*>(metaDataStream.getData()), metaDataStream.getSize());
 
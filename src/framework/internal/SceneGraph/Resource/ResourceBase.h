@@ -17,6 +17,8 @@
 
 namespace ramses::internal
 {
+    class ITaskQueue;
+
     class ResourceBase : public IResource
     {
     public:
@@ -95,6 +97,13 @@ namespace ramses::internal
             return m_hash;
         }
 
+        // calculates hash if not known yet, data of large resources is hashed in parallel by tasks enqueued to given queue and the calling thread
+        void precalculateHash(ITaskQueue& taskQueue) const
+        {
+            if (!m_hash.isValid())
+                updateHash(&taskQueue);
+        }
+
         void compress(CompressionLevel level) const final override;
 
         void decompress() const final override;
@@ -122,7 +131,7 @@ namespace ramses::internal
             m_hash = hash;
         }
 
-        void updateHash() const;
+        void updateHash(ITaskQueue* taskQueue = nullptr) const;
 
     private:
         const EResourceType m_typeID;
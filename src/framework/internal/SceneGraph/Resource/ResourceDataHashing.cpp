@@ -0,0 +1,128 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Resource/ResourceDataHashing.h"
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+#include <city.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        cityhash::uint128 HashChunk(absl::Span<const std::byte> data)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+            return cityhash::CityHash128(reinterpret_cast<const char*>(data.data()), data.size());
+        }
+
+        // Chunks to hash shared by the calling thread and the hashing tasks, every chunk is hashed by whoever picks it first.
+        // Tasks keep the state alive, they might get executed only after all chunks were hashed.
+        class ChunkHashingJobs
+        {
+        public:
+            explicit ChunkHashingJobs(absl::Span<const std::byte> data)
+                : m_data(data)
+                , m_chunkCount((data.size() + ResourceDataHashing::ChunkSize - 1u) / ResourceDataHashing::ChunkSize)
+                , m_chunkHashes(2u * m_chunkCount)
+            {
+            }
+
+            void hashRemaining()
+            {
+                for (size_t idx = m_nextIndex++; idx < m_chunkCount; idx = m_nextIndex++)
+                {
+                    const auto chunk = m_data.subspan(idx * ResourceDataHashing::ChunkSize, ResourceDataHashing::ChunkSize);
+                    const auto hash = HashChunk(chunk);
+                    m_chunkHashes[2u * idx] = cityhash::Uint128Low64(hash);
+                    m_chunkHashes[2u * idx + 1u] = cityhash::Uint128High64(hash);
+                    if (++m_numHashed == m_chunkCount)
+                    {
+                        std::lock_guard<std::mutex> l(m_mutex);
+                        m_allHashed.notify_all();
+                    }
+                }
+            }
+
+            [[nodiscard]] const std::vector<uint64_t>& waitUntilAllHashed()
+            {
+                std::unique_lock<std::mutex> l(m_mutex);
+                m_allHashed.wait(l, [&] { return m_numHashed == m_chunkCount; });
+                return m_chunkHashes;
+            }
+
+            [[nodiscard]] size_t getChunkCount() const
+            {
+                return m_chunkCount;
+            }
+
+        private:
+            // data is only accessed while calling thread waits for all chunks to be hashed
+            const absl::Span<const std::byte> m_data;
+            const size_t m_chunkCount;
+            // low and high part of every chunk hash
+            std::vector<uint64_t> m_chunkHashes;
+            std::atomic<size_t> m_nextIndex{ 0u };
+            std::atomic<size_t> m_numHashed{ 0u };
+            std::mutex m_mutex;
+            std::condition_variable m_allHashed;
+        };
+
+        class ChunkHashingTask : public ITask
+        {
+        public:
+            explicit ChunkHashingTask(std::shared_ptr<ChunkHashingJobs> jobs)
+                : m_jobs(std::move(jobs))
+            {
+            }
+
+            void execute() override
+            {
+                m_jobs->hashRemaining();
+            }
+
+        private:
+            std::shared_ptr<ChunkHashingJobs> m_jobs;
+        };
+    }
+
+    ResourceContentHash ResourceDataHashing::HashData(absl::Span<const std::byte> data, ITaskQueue* taskQueue)
+    {
+        if (data.size() <= ChunkSize)
+        {
+            const auto hash = HashChunk(data);
+            return { cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash) };
+        }
+
+        // calling thread takes part in hashing, so it never waits on tasks which the queue did not get to yet
+        auto jobs = std::make_shared<ChunkHashingJobs>(data);
+        if (taskQueue != nullptr)
+        {
+            const size_t numTasks = std::min(jobs->getChunkCount() - 1u, MaxParallelHashingTasks);
+            for (size_t i = 0u; i < numTasks; ++i)
+            {
+                auto task = new ChunkHashingTask(jobs);
+                taskQueue->enqueue(*task);
+                task->release();
+            }
+        }
+        jobs->hashRemaining();
+        const auto& chunkHashes = jobs->waitUntilAllHashed();
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) chunk hashes are hashed as binary data
+        const auto hash = HashChunk(absl::MakeConstSpan(reinterpret_cast<const std::byte*>(chunkHashes.data()), chunkHashes.size() * sizeof(uint64_t)));
+        return { cityhash::Uint128Low64(hash), cityhash::Uint128High64(hash) };
+    }
+}
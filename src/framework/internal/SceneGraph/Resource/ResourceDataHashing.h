@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "absl/types/span.h"
+
+#include <cstddef>
+
+namespace ramses::internal
+{
+    class ITaskQueue;
+
+    namespace ResourceDataHashing
+    {
+        // data larger than chunk size is hashed as hash of its chunk hashes, so that chunks can be hashed independently
+        constexpr size_t ChunkSize = 1u << 20u;
+        constexpr size_t MaxParallelHashingTasks = 4u;
+
+        // 128 bit cityhash based hash of data, independent of whether a task queue is given or not.
+        // If task queue is given chunks of large data are hashed in parallel by tasks enqueued to it and the calling thread.
+        ResourceContentHash HashData(absl::Span<const std::byte> data, ITaskQueue* taskQueue = nullptr);
+    }
+}
@@ -35,6 +35,24 @@ namespace ramses::internal
             assert((texDesc.m_dataSizes.size() == 1) || !texDesc.m_generateMipChain);
         };
 
+        // takes over given data, its size must match the mip data sizes
+        TextureResource(EResourceType typeID, const TextureMetaInfo& texDesc, ResourceBlob data, std::string_view name)
+            : BufferResource(typeID, std::move(data), name)
+            , m_width(texDesc.m_width)
+            , m_height(texDesc.m_height)
+            , m_depth(texDesc.m_depth)
+            , m_mipDataSizes(texDesc.m_dataSizes)
+            , m_format(texDesc.m_format)
+            , m_swizzle(texDesc.m_swizzle)
+            , m_generateMipChain(texDesc.m_generateMipChain)
+        {
+            assert(m_width != 0u);
+            assert(m_height != 0u);
+            assert(m_depth != 0u);
+            assert((texDesc.m_dataSizes.size() == 1) || !texDesc.m_generateMipChain);
+            assert(getDecompressedDataSize() == GetTotalDataSizeFromMipSizes(texDesc.m_dataSizes, typeID));
+        }
+
         uint32_t getWidth() const
         {
             return m_width;
@@ -47,6 +47,12 @@ namespace ramses::internal
         m_creator.setDataUniformBuffer(containerHandle, field, uniformBufferHandle);
     }
 
+    void ActionCollectingScene::setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs)
+    {
+        BaseT::setDataInstanceUniformTimeAnimationEnd(containerHandle, endTimeMs);
+        m_creator.setDataInstanceUniformTimeAnimationEnd(containerHandle, endTimeMs);
+    }
+
     void ActionCollectingScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec4* data)
     {
         BaseT::setDataVector4iArray(containerHandle, field, elementCount, data);
@@ -165,6 +171,20 @@ namespace ramses::internal
         m_creator.setTranslation(handle, translation);
     }
 
+    void ActionCollectingScene::setTransformsBulk(uint32_t count, const TransformHandle* transforms, const glm::vec3* translations, const glm::vec4* rotations, const glm::vec3* scalings)
+    {
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            if (translations)
+                BaseT::setTranslation(transforms[i], translations[i]);
+            if (rotations)
+                BaseT::setRotation(transforms[i], rotations[i], ERotationType::Quaternion);
+            if (scalings)
+                BaseT::setScaling(transforms[i], scalings[i]);
+        }
+        m_creator.setTransformsBulk(count, transforms, translations, rotations, scalings);
+    }
+
     void ActionCollectingScene::removeChildFromNode(NodeHandle parent, NodeHandle child)
     {
         BaseT::removeChildFromNode(parent, child);
@@ -361,6 +381,24 @@ namespace ramses::internal
         m_creator.setRenderableStartVertex(renderableHandle, startVertex);
     }
 
+    void ActionCollectingScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere)
+    {
+        BaseT::setRenderableBoundingSphere(renderableHandle, boundingSphere);
+        m_creator.setRenderableBoundingSphere(renderableHandle, boundingSphere);
+    }
+
+    void ActionCollectingScene::setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions)
+    {
+        BaseT::setRenderableInstancePositions(renderableHandle, instancePositions);
+        m_creator.setRenderableInstancePositions(renderableHandle, instancePositions);
+    }
+
+    void ActionCollectingScene::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        BaseT::setRenderableLevelsOfDetail(renderableHandle, levelsOfDetail);
+        m_creator.setRenderableLevelsOfDetail(renderableHandle, levelsOfDetail);
+    }
+
     void ActionCollectingScene::setRenderableUniformsDataInstanceAndState(RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle)
     {
         BaseT::setRenderableDataInstance(renderableHandle, ERenderableDataSlotType_Uniforms, newDataInstance);
@@ -476,6 +514,30 @@ namespace ramses::internal
         m_creator.retriggerRenderPassRenderOnce(passHandle);
     }
 
+    void ActionCollectingScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassStateSorting(passHandle, enable);
+        m_creator.setRenderPassStateSorting(passHandle, enable);
+    }
+
+    void ActionCollectingScene::setRenderPassFrontToBackSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassFrontToBackSorting(passHandle, enable);
+        m_creator.setRenderPassFrontToBackSorting(passHandle, enable);
+    }
+
+    void ActionCollectingScene::setRenderPassBackToFrontSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassBackToFrontSorting(passHandle, enable);
+        m_creator.setRenderPassBackToFrontSorting(passHandle, enable);
+    }
+
+    void ActionCollectingScene::setRenderPassDepthPrePass(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassDepthPrePass(passHandle, enable);
+        m_creator.setRenderPassDepthPrePass(passHandle, enable);
+    }
+
     void ActionCollectingScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         BaseT::addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -653,6 +715,12 @@ namespace ramses::internal
         m_creator.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
     }
 
+    void ActionCollectingScene::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        BaseT::setDataBufferUsedSize(handle, usedSizeInBytes);
+        m_creator.setDataBufferUsedSize(handle, usedSizeInBytes);
+    }
+
     UniformBufferHandle ActionCollectingScene::allocateUniformBuffer(uint32_t size, UniformBufferHandle handle)
     {
         const auto allocatedHandle = BaseT::allocateUniformBuffer(size, handle);
@@ -724,6 +792,12 @@ namespace ramses::internal
         m_creator.setSceneReferenceRenderOrder(handle, renderOrder);
     }
 
+    void ActionCollectingScene::setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority)
+    {
+        BaseT::setSceneReferencePreload(handle, preloadState, preloadPriority);
+        m_creator.setSceneReferencePreload(handle, preloadState, preloadPriority);
+    }
+
     const SceneActionCollection& ActionCollectingScene::getSceneActionCollection() const
     {
         return m_collection;
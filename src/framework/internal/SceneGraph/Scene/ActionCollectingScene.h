@@ -35,6 +35,9 @@ namespace ramses::internal
         void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const glm::vec4& boundingSphere) override;
+        void                        setRenderableInstancePositions  (RenderableHandle renderableHandle, DataBufferHandle instancePositions) override;
+        void                        setRenderableLevelsOfDetail     (RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail) override;
         void                        setRenderableUniformsDataInstanceAndState (RenderableHandle renderableHandle, DataInstanceHandle newDataInstance, RenderStateHandle stateHandle);
 
         // Render state
@@ -71,6 +74,8 @@ namespace ramses::internal
         void                        setTranslation                  (TransformHandle handle, const glm::vec3& translation) override;
         void                        setRotation                     (TransformHandle handle, const glm::vec4& rotation, ERotationType rotationType) override;
         void                        setScaling                      (TransformHandle handle, const glm::vec3& scaling) override;
+        // sets transform components of multiple transforms and collects them as one scene action, see SceneActionCollectionCreator::setTransformsBulk
+        void                        setTransformsBulk               (uint32_t count, const TransformHandle* transforms, const glm::vec3* translations, const glm::vec4* rotations, const glm::vec3* scalings);
 
 
         DataLayoutHandle            allocateDataLayout              (const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle) override;
@@ -95,6 +100,7 @@ namespace ramses::internal
         void                        setDataTextureSamplerHandle     (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
         void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
         void                        setDataUniformBuffer            (DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle) override;
+        void                        setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs) override;
 
         // Texture sampler description
         TextureSamplerHandle        allocateTextureSampler          (const TextureSampler& sampler, TextureSamplerHandle handle) override;
@@ -118,6 +124,10 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassFrontToBackSorting (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassBackToFrontSorting (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassDepthPrePass       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
 
@@ -151,6 +161,7 @@ namespace ramses::internal
         DataBufferHandle            allocateDataBuffer              (EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle) override;
         void                        releaseDataBuffer               (DataBufferHandle handle) override;
         void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+        void                        setDataBufferUsedSize           (DataBufferHandle handle, uint32_t usedSizeInBytes) override;
 
         UniformBufferHandle         allocateUniformBuffer           (uint32_t size, UniformBufferHandle handle) override;
         void                        releaseUniformBuffer            (UniformBufferHandle uniformBufferHandle) override;
@@ -165,6 +176,7 @@ namespace ramses::internal
         void                        requestSceneReferenceState      (SceneReferenceHandle handle, RendererSceneState state) override;
         void                        requestSceneReferenceFlushNotifications(SceneReferenceHandle handle, bool enable) override;
         void                        setSceneReferenceRenderOrder    (SceneReferenceHandle handle, int32_t renderOrder) override;
+        void                        setSceneReferencePreload        (SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority) override;
 
         [[nodiscard]] const SceneActionCollection& getSceneActionCollection() const;
         SceneActionCollection& getSceneActionCollection();
@@ -31,7 +31,19 @@ namespace ramses::internal
             return m_statisticCollection;
         }
 
+        // enables removal of overwritten scene actions before flush is sent, see SceneActionCoalescer
+        void setSceneActionCoalescingEnabled(bool enabled)
+        {
+            m_sceneActionCoalescingEnabled = enabled;
+        }
+
+        [[nodiscard]] bool isSceneActionCoalescingEnabled() const
+        {
+            return m_sceneActionCoalescingEnabled;
+        }
+
     private:
         StatisticCollectionScene m_statisticCollection;
+        bool m_sceneActionCoalescingEnabled = false;
     };
 }
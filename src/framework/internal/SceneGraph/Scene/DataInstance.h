@@ -11,6 +11,8 @@
 #include "internal/SceneGraph/Scene/DataLayout.h"
 #include "internal/Core/Utils/AssertMovable.h"
 
+#include <limits>
+
 namespace ramses::internal
 {
     class DataInstance
@@ -48,14 +50,33 @@ namespace ramses::internal
             }
         }
 
+        [[nodiscard]] const std::byte* getData() const
+        {
+            return m_data.data();
+        }
+
         [[nodiscard]] DataLayoutHandle getLayoutHandle() const
         {
             return m_dataLayoutHandle;
         }
 
+        [[nodiscard]] int32_t getUniformTimeAnimationEnd() const
+        {
+            return m_uniformTimeAnimationEnd;
+        }
+
+        void setUniformTimeAnimationEnd(int32_t endTimeMs)
+        {
+            m_uniformTimeAnimationEnd = endTimeMs;
+        }
+
+        // value of semantic time uniform at which shader animation ends, default never ends
+        static constexpr int32_t UnboundedUniformTimeAnimationEnd = std::numeric_limits<int32_t>::max();
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
         std::vector<std::byte> m_data;
+        int32_t m_uniformTimeAnimationEnd = UnboundedUniformTimeAnimationEnd;
     };
 
     ASSERT_MOVABLE(DataInstance)
@@ -11,27 +11,31 @@
 #include "internal/SceneGraph/SceneAPI/DataFieldInfo.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
+    enum class EDataLayoutPacking : uint8_t
+    {
+        // fields placed in declaration order, each aligned to its native C++ alignment
+        Native,
+        // value fields placed first as contiguous block using GLSL std140 rules (if all of them can be represented so),
+        // the block can then be copied directly into uniform buffer, remaining fields follow after it
+        Std140UniformBlock
+    };
+
     class DataLayout
     {
     public:
-        void setDataFields(const DataFieldInfoVector& fields)
+        void setDataFields(const DataFieldInfoVector& fields, EDataLayoutPacking packing = EDataLayoutPacking::Native)
         {
             assert(m_fields.empty());
             assert(m_fieldOffsets.empty());
 
             m_fields = fields;
-            m_fieldOffsets.reserve(fields.size());
-            for (const auto& field : fields)
-            {
-                const auto alignmentRequirement = static_cast<uint32_t>(EnumToAlignment(field.dataType));
-                if (m_totalSize % alignmentRequirement != 0)
-                    m_totalSize += alignmentRequirement - (m_totalSize % alignmentRequirement);
-
-                m_fieldOffsets.push_back(m_totalSize);
-                m_totalSize += static_cast<uint32_t>(EnumToSize(field.dataType)) * field.elementCount;
-            }
+            m_fieldOffsets.resize(fields.size(), 0u);
+            if (packing != EDataLayoutPacking::Std140UniformBlock || !layoutFieldsAsStd140UniformBlock())
+                layoutFieldsNative();
         }
 
         [[nodiscard]] const DataFieldInfoVector& getDataFields() const
@@ -61,6 +65,72 @@ namespace ramses::internal
             return m_totalSize;
         }
 
+        // Size of std140 block at the beginning of data instance memory containing all value fields,
+        // 0 if layout does not have such block (native packing or fields not representable in std140)
+        [[nodiscard]] uint32_t getUniformBlockSize() const
+        {
+            return m_uniformBlockSize;
+        }
+
+        // Returns std140 base alignment of field if it can be stored in std140 layout with same memory representation as native,
+        // i.e. data of field can be copied as is. Returns 0 for value types which need conversion (bool, mat2/mat3, arrays
+        // with element stride not multiple of 16 bytes) and for non-value types (textures, references, buffers).
+        static uint32_t GetStd140Alignment(const DataFieldInfo& field)
+        {
+            uint32_t alignment = 0u;
+            switch (field.dataType)
+            {
+            case EDataType::Int32:
+            case EDataType::UInt32:
+            case EDataType::Float:
+                alignment = 4u;
+                break;
+            case EDataType::Vector2F:
+            case EDataType::Vector2I:
+                alignment = 8u;
+                break;
+            case EDataType::Vector3F:
+            case EDataType::Vector3I:
+            case EDataType::Vector4F:
+            case EDataType::Vector4I:
+            case EDataType::Matrix44F:
+                alignment = 16u;
+                break;
+            default:
+                return 0u;
+            }
+
+            // std140 array stride is rounded up to 16 bytes
+            if (field.elementCount > 1u)
+                return (EnumToSize(field.dataType) % 16u == 0u) ? 16u : 0u;
+
+            return alignment;
+        }
+
+        static bool IsUniformValueField(const DataFieldInfo& field)
+        {
+            switch (field.dataType)
+            {
+            case EDataType::Bool:
+            case EDataType::Int32:
+            case EDataType::UInt16:
+            case EDataType::UInt32:
+            case EDataType::Float:
+            case EDataType::Vector2F:
+            case EDataType::Vector3F:
+            case EDataType::Vector4F:
+            case EDataType::Vector2I:
+            case EDataType::Vector3I:
+            case EDataType::Vector4I:
+            case EDataType::Matrix22F:
+            case EDataType::Matrix33F:
+            case EDataType::Matrix44F:
+                return true;
+            default:
+                return false;
+            }
+        }
+
         void setEffectHash(const ResourceContentHash& newHash)
         {
             effectHash = newHash;
@@ -72,9 +142,68 @@ namespace ramses::internal
         }
 
     private:
+        static uint32_t AlignOffset(uint32_t offset, uint32_t alignment)
+        {
+            if (offset % alignment != 0)
+                offset += alignment - (offset % alignment);
+            return offset;
+        }
+
+        void layoutFieldsNative()
+        {
+            m_totalSize = 0u;
+            m_uniformBlockSize = 0u;
+            for (size_t i = 0u; i < m_fields.size(); ++i)
+            {
+                const auto& field = m_fields[i];
+                m_totalSize = AlignOffset(m_totalSize, static_cast<uint32_t>(EnumToAlignment(field.dataType)));
+                m_fieldOffsets[i] = m_totalSize;
+                m_totalSize += EnumToSize(field.dataType) * field.elementCount;
+            }
+        }
+
+        bool layoutFieldsAsStd140UniformBlock()
+        {
+            if (std::none_of(m_fields.cbegin(), m_fields.cend(), IsUniformValueField))
+                return false;
+
+            uint32_t offset = 0u;
+            for (size_t i = 0u; i < m_fields.size(); ++i)
+            {
+                const auto& field = m_fields[i];
+                if (!IsUniformValueField(field))
+                    continue;
+
+                const uint32_t alignment = GetStd140Alignment(field);
+                if (alignment == 0u)
+                    return false;
+
+                offset = AlignOffset(offset, alignment);
+                m_fieldOffsets[i] = offset;
+                offset += EnumToSize(field.dataType) * field.elementCount;
+            }
+            // std140 block size is multiple of vec4
+            m_uniformBlockSize = AlignOffset(offset, 16u);
+
+            m_totalSize = m_uniformBlockSize;
+            for (size_t i = 0u; i < m_fields.size(); ++i)
+            {
+                const auto& field = m_fields[i];
+                if (IsUniformValueField(field))
+                    continue;
+
+                m_totalSize = AlignOffset(m_totalSize, static_cast<uint32_t>(EnumToAlignment(field.dataType)));
+                m_fieldOffsets[i] = m_totalSize;
+                m_totalSize += EnumToSize(field.dataType) * field.elementCount;
+            }
+
+            return true;
+        }
+
         DataFieldInfoVector m_fields;
         std::vector<uint32_t> m_fieldOffsets;
         uint32_t m_totalSize = 0u;
+        uint32_t m_uniformBlockSize = 0u;
         ResourceContentHash effectHash;
     };
 }
@@ -198,11 +198,55 @@ namespace ramses::internal
         UpdateUniformBuffer,
         SetDataUniformBuffer,
 
+        // render pass (continued)
+        SetRenderPassStateSorting,
+        SetRenderPassFrontToBackSorting,
+        SetRenderPassDepthPrePass,
+
+        // renderable (continued)
+        SetRenderableBoundingSphere,
+
+        // nodes (continued)
+        SetTransformsBulk,
+
+        // renderable (continued)
+        SetRenderableInstancePositions,
+
+        // scene references (continued)
+        SetSceneReferencePreload,
+
+        // value setter encoded against previously sent value, see SceneActionDeltaEncoder
+        SetValueDeltaEncoded,
+
+        // nodes (continued), used for scene snapshot sent to new subscribers
+        AllocateNodesBulk,
+        AllocateTransformsBulk,
+
+        // renderable (continued)
+        SetRenderableLevelsOfDetail,
+
+        // render pass (continued)
+        SetRenderPassBackToFrontSorting,
+
+        // data instance (continued)
+        SetDataInstanceUniformTimeAnimationEnd,
+
+        // data buffer (continued)
+        SetDataBufferUsedSize,
+
         NUMBER_OF_TYPES
     };
 
     static constexpr const uint32_t NumOfSceneActionTypes = static_cast<uint32_t>(ESceneActionId::NUMBER_OF_TYPES);
 
+    // flags of transform components contained in ESceneActionId::SetTransformsBulk
+    enum EBulkTransformComponent : uint8_t
+    {
+        EBulkTransformComponent_Translation = 1u << 0u,
+        EBulkTransformComponent_Rotation = 1u << 1u,
+        EBulkTransformComponent_Scaling = 1u << 2u,
+    };
+
 #ifndef CreateNameForEnumID
 #define CreateNameForEnumID(ENUMVALUE) \
 case ENUMVALUE: return #ENUMVALUE
@@ -217,6 +261,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetTranslation);
             CreateNameForEnumID(ESceneActionId::SetRotation);
             CreateNameForEnumID(ESceneActionId::SetScaling);
+            CreateNameForEnumID(ESceneActionId::SetTransformsBulk);
             CreateNameForEnumID(ESceneActionId::AllocateNode);
             CreateNameForEnumID(ESceneActionId::ReleaseNode);
             CreateNameForEnumID(ESceneActionId::AllocateTransform);
@@ -243,6 +288,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetDataTextureSamplerHandle);
             CreateNameForEnumID(ESceneActionId::SetDataReference);
             CreateNameForEnumID(ESceneActionId::SetDataUniformBuffer);
+            CreateNameForEnumID(ESceneActionId::SetDataInstanceUniformTimeAnimationEnd);
             CreateNameForEnumID(ESceneActionId::SetDataMatrix22fArray);
             CreateNameForEnumID(ESceneActionId::SetDataMatrix33fArray);
             CreateNameForEnumID(ESceneActionId::SetDataMatrix44fArray);
@@ -251,6 +297,7 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::AllocateDataBuffer);
             CreateNameForEnumID(ESceneActionId::ReleaseDataBuffer);
             CreateNameForEnumID(ESceneActionId::UpdateDataBuffer);
+            CreateNameForEnumID(ESceneActionId::SetDataBufferUsedSize);
 
             // Uniform buffer
             CreateNameForEnumID(ESceneActionId::AllocateUniformBuffer);
@@ -271,6 +318,9 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetRenderableDataInstance);
             CreateNameForEnumID(ESceneActionId::SetRenderableInstanceCount);
             CreateNameForEnumID(ESceneActionId::SetRenderableStartVertex);
+            CreateNameForEnumID(ESceneActionId::SetRenderableBoundingSphere);
+            CreateNameForEnumID(ESceneActionId::SetRenderableInstancePositions);
+            CreateNameForEnumID(ESceneActionId::SetRenderableLevelsOfDetail);
 
             // render states
             CreateNameForEnumID(ESceneActionId::ReleaseState);
@@ -311,6 +361,10 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::SetRenderPassEnabled);
             CreateNameForEnumID(ESceneActionId::SetRenderPassRenderOnce);
             CreateNameForEnumID(ESceneActionId::RetriggerRenderPassRenderOnce);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassStateSorting);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassFrontToBackSorting);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassBackToFrontSorting);
+            CreateNameForEnumID(ESceneActionId::SetRenderPassDepthPrePass);
             CreateNameForEnumID(ESceneActionId::AddRenderGroupToRenderPass);
             CreateNameForEnumID(ESceneActionId::RemoveRenderGroupFromRenderPass);
 
@@ -348,6 +402,10 @@ case ENUMVALUE: return #ENUMVALUE
             CreateNameForEnumID(ESceneActionId::RequestSceneReferenceState);
             CreateNameForEnumID(ESceneActionId::SetSceneReferenceRenderOrder);
             CreateNameForEnumID(ESceneActionId::RequestSceneReferenceFlushNotifications);
+            CreateNameForEnumID(ESceneActionId::SetSceneReferencePreload);
+            CreateNameForEnumID(ESceneActionId::SetValueDeltaEncoded);
+            CreateNameForEnumID(ESceneActionId::AllocateNodesBulk);
+            CreateNameForEnumID(ESceneActionId::AllocateTransformsBulk);
             //animation
             CreateNameForEnumID(ESceneActionId::AddAnimationSystem);
             CreateNameForEnumID(ESceneActionId::RemoveAnimationSystem);
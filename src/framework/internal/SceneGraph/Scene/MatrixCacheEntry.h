@@ -15,6 +15,9 @@
 
 namespace ramses::internal
 {
+    // State of cached matrices of a node, the matrices themselves are stored separately
+    // in contiguous arrays per matrix type (see TransformationCachedSceneT), so that dirtiness
+    // checks and propagation only touch these compact entries.
     struct MatrixCacheEntry
     {
         MatrixCacheEntry()
@@ -28,7 +31,6 @@ namespace ramses::internal
             m_matrixDirty[ETransformationMatrixType_Object] = true;
         }
 
-        std::array<glm::mat4, ETransformationMatrixType_COUNT> m_matrix{};
         std::array<bool, ETransformationMatrixType_COUNT>      m_matrixDirty{};
         bool                                                   m_isIdentity{true};
     };
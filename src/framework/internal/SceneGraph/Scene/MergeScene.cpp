@@ -140,6 +140,21 @@ namespace ramses::internal
         m_originalScene.setRenderableStartVertex(getMappedHandle(renderableHandle), startVertex);
     }
 
+    void MergeScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere)
+    {
+        m_originalScene.setRenderableBoundingSphere(getMappedHandle(renderableHandle), boundingSphere);
+    }
+
+    void MergeScene::setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions)
+    {
+        m_originalScene.setRenderableInstancePositions(getMappedHandle(renderableHandle), getMappedHandle(instancePositions));
+    }
+
+    void MergeScene::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        m_originalScene.setRenderableLevelsOfDetail(getMappedHandle(renderableHandle), levelsOfDetail);
+    }
+
     const Renderable& MergeScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_originalScene.getRenderable(getMappedHandle(renderableHandle));
@@ -520,6 +535,11 @@ namespace ramses::internal
         return m_originalScene.getDataUniformBuffer(getMappedHandle(containerHandle), field);
     }
 
+    int32_t MergeScene::getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const
+    {
+        return m_originalScene.getDataInstanceUniformTimeAnimationEnd(getMappedHandle(containerHandle));
+    }
+
     float MergeScene::getDataSingleFloat(DataInstanceHandle containerHandle, DataFieldHandle field) const
     {
         return m_originalScene.getDataSingleFloat(getMappedHandle(containerHandle), field);
@@ -660,6 +680,11 @@ namespace ramses::internal
         m_originalScene.setDataUniformBuffer(getMappedHandle(containerHandle), field, getMappedHandle(uniformBufferHandle));
     }
 
+    void MergeScene::setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs)
+    {
+        m_originalScene.setDataInstanceUniformTimeAnimationEnd(getMappedHandle(containerHandle), endTimeMs);
+    }
+
     void MergeScene::setDataSingleFloat(DataInstanceHandle containerHandle, DataFieldHandle field, float data)
     {
         m_originalScene.setDataSingleFloat(getMappedHandle(containerHandle), field, data);
@@ -944,6 +969,11 @@ namespace ramses::internal
         m_originalScene.updateDataBuffer(getMappedHandle(handle), offsetInBytes, dataSizeInBytes, data);
     }
 
+    void MergeScene::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        m_originalScene.setDataBufferUsedSize(getMappedHandle(handle), usedSizeInBytes);
+    }
+
     bool MergeScene::isDataBufferAllocated(DataBufferHandle handle) const
     {
         return m_originalScene.isDataBufferAllocated(getMappedHandle(handle));
@@ -1097,6 +1127,11 @@ namespace ramses::internal
         m_originalScene.setSceneReferenceRenderOrder(getMappedHandle(handle), renderOrder);
     }
 
+    void MergeScene::setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority)
+    {
+        m_originalScene.setSceneReferencePreload(getMappedHandle(handle), preloadState, preloadPriority);
+    }
+
     bool MergeScene::isSceneReferenceAllocated(SceneReferenceHandle handle) const
     {
         return m_originalScene.isSceneReferenceAllocated(getMappedHandle(handle));
@@ -1147,6 +1182,26 @@ namespace ramses::internal
         m_originalScene.retriggerRenderPassRenderOnce(getMappedHandle(pass));
     }
 
+    void MergeScene::setRenderPassStateSorting(RenderPassHandle pass, bool enable)
+    {
+        m_originalScene.setRenderPassStateSorting(getMappedHandle(pass), enable);
+    }
+
+    void MergeScene::setRenderPassFrontToBackSorting(RenderPassHandle pass, bool enable)
+    {
+        m_originalScene.setRenderPassFrontToBackSorting(getMappedHandle(pass), enable);
+    }
+
+    void MergeScene::setRenderPassBackToFrontSorting(RenderPassHandle pass, bool enable)
+    {
+        m_originalScene.setRenderPassBackToFrontSorting(getMappedHandle(pass), enable);
+    }
+
+    void MergeScene::setRenderPassDepthPrePass(RenderPassHandle pass, bool enable)
+    {
+        m_originalScene.setRenderPassDepthPrePass(getMappedHandle(pass), enable);
+    }
+
     void MergeScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         m_originalScene.addRenderGroupToRenderPass(getMappedHandle(passHandle), getMappedHandle(groupHandle), order);
@@ -1287,6 +1342,7 @@ namespace ramses::internal
         };
 
         m_originalScene.preallocateSceneSize(newSizeInfo);
+        m_mapping.reserve(sizeInfo);
     }
 
     template<>
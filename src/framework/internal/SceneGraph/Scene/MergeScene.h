@@ -40,6 +40,9 @@ namespace ramses::internal
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const glm::vec4& boundingSphere) override;
+        void                        setRenderableInstancePositions  (RenderableHandle renderableHandle, DataBufferHandle instancePositions) override;
+        void                        setRenderableLevelsOfDetail     (RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail) override;
         [[nodiscard]] const Renderable& getRenderable               (RenderableHandle renderableHandle) const override;
 
         // Render state
@@ -124,6 +127,7 @@ namespace ramses::internal
         [[nodiscard]] TextureSamplerHandle      getDataTextureSamplerHandle (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
         [[nodiscard]] DataInstanceHandle        getDataReference            (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
         [[nodiscard]] UniformBufferHandle       getDataUniformBuffer        (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
+        [[nodiscard]] int32_t                   getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const override;
 
         void setDataFloatArray           (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const float* data) override;
         void setDataVector2fArray        (DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec2* data) override;
@@ -141,6 +145,7 @@ namespace ramses::internal
         void setDataTextureSamplerHandle (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
         void setDataReference            (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
         void setDataUniformBuffer        (DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle) override;
+        void setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs) override;
 
         // get/setData*Array wrappers for elementCount == 1
         [[nodiscard]] float             getDataSingleFloat     (DataInstanceHandle containerHandle, DataFieldHandle field) const override;
@@ -200,6 +205,10 @@ namespace ramses::internal
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassFrontToBackSorting (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassBackToFrontSorting (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassDepthPrePass       (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         [[nodiscard]] const RenderPass&           getRenderPass                   (RenderPassHandle passHandle) const override;
@@ -246,6 +255,7 @@ namespace ramses::internal
         void                        releaseDataBuffer               (DataBufferHandle handle) override;
         [[nodiscard]] uint32_t                      getDataBufferCount              () const override;
         void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+        void                        setDataBufferUsedSize           (DataBufferHandle handle, uint32_t usedSizeInBytes) override;
         [[nodiscard]] bool                        isDataBufferAllocated           (DataBufferHandle handle) const override;
         [[nodiscard]] const GeometryDataBuffer&   getDataBuffer                   (DataBufferHandle handle) const override;
 
@@ -277,6 +287,7 @@ namespace ramses::internal
         void                        requestSceneReferenceState      (SceneReferenceHandle handle, RendererSceneState state) override;
         void                        requestSceneReferenceFlushNotifications(SceneReferenceHandle handle, bool enable) override;
         void                        setSceneReferenceRenderOrder    (SceneReferenceHandle handle, int32_t renderOrder) override;
+        void                        setSceneReferencePreload        (SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority) override;
         [[nodiscard]] bool                        isSceneReferenceAllocated       (SceneReferenceHandle handle) const final override;
         [[nodiscard]] uint32_t                      getSceneReferenceCount          () const final override;
         [[nodiscard]] const SceneReference&       getSceneReference               (SceneReferenceHandle handle) const final override;
@@ -8,6 +8,10 @@
 
 #include "internal/SceneGraph/Scene/ResourceChangeCollectingScene.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/SceneGraph/Scene/DataLayout.h"
+
+#include <algorithm>
+#include <cassert>
 
 namespace ramses::internal
 {
@@ -30,41 +34,123 @@ namespace ramses::internal
     {
         m_sceneResourceActions.clear();
         m_resourcesChanged = false;
+
+        for (const auto& hash : m_clientResourcesWithChangedUsage)
+        {
+            auto it = m_clientResourceUsage.find(hash);
+            assert(it != m_clientResourceUsage.end());
+            if (it->second.refCount == 0u)
+            {
+                m_clientResourceUsage.erase(it);
+            }
+            else
+            {
+                it->second.usedAtLastReset = true;
+                it->second.changedSinceLastReset = false;
+            }
+        }
+        m_clientResourcesWithChangedUsage.clear();
     }
 
+    void ResourceChangeCollectingScene::getClientResourceUsageChanges(ResourceContentHashVector& added, ResourceContentHashVector& removed) const
+    {
+        for (const auto& hash : m_clientResourcesWithChangedUsage)
+        {
+            const ResourceUsage& usage = m_clientResourceUsage.at(hash);
+            const bool used = (usage.refCount != 0u);
+            if (used && !usage.usedAtLastReset)
+                added.push_back(hash);
+            else if (!used && usage.usedAtLastReset)
+                removed.push_back(hash);
+        }
+        std::sort(added.begin(), added.end());
+        std::sort(removed.begin(), removed.end());
+    }
 
     void ResourceChangeCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
         m_resourcesChanged = true;
+        const Renderable& renderable = getRenderable(renderableHandle);
+        if (renderable.visibilityMode != EVisibilityMode::Off)
+        {
+            unreferenceDataInstance(renderable.dataInstances[ERenderableDataSlotType_Geometry]);
+            unreferenceDataInstance(renderable.dataInstances[ERenderableDataSlotType_Uniforms]);
+        }
         BaseT::releaseRenderable(renderableHandle);
-
     }
 
     void ResourceChangeCollectingScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         m_resourcesChanged = true;
+        const bool visible = (getRenderable(renderableHandle).visibilityMode != EVisibilityMode::Off);
+        if (visible)
+            unreferenceDataInstance(getRenderable(renderableHandle).dataInstances[slot]);
         BaseT::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        if (visible)
+            referenceDataInstance(newDataInstance);
     }
 
     void ResourceChangeCollectingScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visibility)
     {
-        auto oldVisibility = getRenderable(renderableHandle).visibilityMode;
+        const Renderable& renderable = getRenderable(renderableHandle);
+        auto oldVisibility = renderable.visibilityMode;
         if (oldVisibility != visibility && (oldVisibility == EVisibilityMode::Off || visibility == EVisibilityMode::Off))
+        {
             m_resourcesChanged = true;
+            for (const auto slot : { ERenderableDataSlotType_Geometry, ERenderableDataSlotType_Uniforms })
+            {
+                if (visibility == EVisibilityMode::Off)
+                    unreferenceDataInstance(renderable.dataInstances[slot]);
+                else
+                    referenceDataInstance(renderable.dataInstances[slot]);
+            }
+        }
 
         BaseT::setRenderableVisibility(renderableHandle, visibility);
     }
 
+    DataInstanceHandle ResourceChangeCollectingScene::allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle)
+    {
+        const DataInstanceHandle newHandle = BaseT::allocateDataInstance(finishedLayoutHandle, instanceHandle);
+        // handle might be already assigned to a visible renderable
+        if (isDataInstanceReferenced(newHandle))
+        {
+            m_resourcesChanged = true;
+            referenceDataInstanceResources(newHandle);
+        }
+        return newHandle;
+    }
+
+    void ResourceChangeCollectingScene::releaseDataInstance(DataInstanceHandle containerHandle)
+    {
+        if (isDataInstanceReferenced(containerHandle))
+        {
+            m_resourcesChanged = true;
+            unreferenceDataInstanceResources(containerHandle);
+        }
+        BaseT::releaseDataInstance(containerHandle);
+    }
+
     void ResourceChangeCollectingScene::setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride)
     {
         m_resourcesChanged = true;
+        const bool referenced = isDataInstanceReferenced(dataInstanceHandle);
+        if (referenced)
+            unreferenceResource(getDataResource(dataInstanceHandle, field).hash);
         BaseT::setDataResource(dataInstanceHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
+        if (referenced)
+            referenceResource(hash);
     }
 
     void ResourceChangeCollectingScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
     {
         m_resourcesChanged = true;
+        const bool referenced = isDataInstanceReferenced(containerHandle);
+        if (referenced)
+            unreferenceTextureSampler(getDataTextureSamplerHandle(containerHandle, field));
         BaseT::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
+        if (referenced)
+            referenceTextureSampler(samplerHandle);
     }
 
     TextureSamplerHandle ResourceChangeCollectingScene::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle /*= TextureSamplerHandle::Invalid()*/)
@@ -72,13 +158,20 @@ namespace ramses::internal
         if (sampler.textureResource.isValid())
             m_resourcesChanged = true;
 
-        return BaseT::allocateTextureSampler(sampler, handle);
+        const TextureSamplerHandle newHandle = BaseT::allocateTextureSampler(sampler, handle);
+        // handle might be already assigned to a data instance in use
+        if (newHandle.asMemoryHandle() < m_textureSamplerRefCounts.size() && m_textureSamplerRefCounts[newHandle.asMemoryHandle()] != 0u)
+            referenceResource(sampler.textureResource);
+        return newHandle;
     }
 
     void ResourceChangeCollectingScene::releaseTextureSampler(TextureSamplerHandle handle)
     {
-        if (getTextureSampler(handle).textureResource.isValid())
+        const ResourceContentHash& textureHash = getTextureSampler(handle).textureResource;
+        if (textureHash.isValid())
             m_resourcesChanged = true;
+        if (handle.asMemoryHandle() < m_textureSamplerRefCounts.size() && m_textureSamplerRefCounts[handle.asMemoryHandle()] != 0u)
+            unreferenceResource(textureHash);
 
         BaseT::releaseTextureSampler(handle);
     }
@@ -87,13 +180,16 @@ namespace ramses::internal
     {
         if (dataSlot.attachedTexture.isValid())
             m_resourcesChanged = true;
+        referenceResource(dataSlot.attachedTexture);
         return BaseT::allocateDataSlot(dataSlot, handle);
     }
 
     void ResourceChangeCollectingScene::setDataSlotTexture(DataSlotHandle providerHandle, const ResourceContentHash& texture)
     {
         m_resourcesChanged = true;
+        unreferenceResource(getDataSlot(providerHandle).attachedTexture);
         BaseT::setDataSlotTexture(providerHandle, texture);
+        referenceResource(texture);
     }
 
     void ResourceChangeCollectingScene::releaseDataSlot(DataSlotHandle handle)
@@ -101,10 +197,118 @@ namespace ramses::internal
         const ResourceContentHash& textureHash = getDataSlot(handle).attachedTexture;
         if (textureHash.isValid())
             m_resourcesChanged = true;
+        unreferenceResource(textureHash);
 
         BaseT::releaseDataSlot(handle);
     }
 
+    void ResourceChangeCollectingScene::referenceDataInstance(DataInstanceHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        const auto index = handle.asMemoryHandle();
+        if (index >= m_dataInstanceRefCounts.size())
+            m_dataInstanceRefCounts.resize(index + 1u, 0u);
+        if (m_dataInstanceRefCounts[index]++ == 0u && isDataInstanceAllocated(handle))
+            referenceDataInstanceResources(handle);
+    }
+
+    void ResourceChangeCollectingScene::unreferenceDataInstance(DataInstanceHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        const auto index = handle.asMemoryHandle();
+        assert(index < m_dataInstanceRefCounts.size() && m_dataInstanceRefCounts[index] != 0u);
+        if (--m_dataInstanceRefCounts[index] == 0u && isDataInstanceAllocated(handle))
+            unreferenceDataInstanceResources(handle);
+    }
+
+    bool ResourceChangeCollectingScene::isDataInstanceReferenced(DataInstanceHandle handle) const
+    {
+        return handle.asMemoryHandle() < m_dataInstanceRefCounts.size() && m_dataInstanceRefCounts[handle.asMemoryHandle()] != 0u;
+    }
+
+    void ResourceChangeCollectingScene::referenceDataInstanceResources(DataInstanceHandle handle)
+    {
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(handle));
+        referenceResource(layout.getEffectHash());
+        for (DataFieldHandle fieldHandle(0u); fieldHandle < layout.getFieldCount(); ++fieldHandle)
+        {
+            const EDataType fieldType = layout.getField(fieldHandle).dataType;
+            if (IsBufferDataType(fieldType))
+                referenceResource(getDataResource(handle, fieldHandle).hash);
+            else if (IsTextureSamplerType(fieldType))
+                referenceTextureSampler(getDataTextureSamplerHandle(handle, fieldHandle));
+        }
+    }
+
+    void ResourceChangeCollectingScene::unreferenceDataInstanceResources(DataInstanceHandle handle)
+    {
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(handle));
+        unreferenceResource(layout.getEffectHash());
+        for (DataFieldHandle fieldHandle(0u); fieldHandle < layout.getFieldCount(); ++fieldHandle)
+        {
+            const EDataType fieldType = layout.getField(fieldHandle).dataType;
+            if (IsBufferDataType(fieldType))
+                unreferenceResource(getDataResource(handle, fieldHandle).hash);
+            else if (IsTextureSamplerType(fieldType))
+                unreferenceTextureSampler(getDataTextureSamplerHandle(handle, fieldHandle));
+        }
+    }
+
+    void ResourceChangeCollectingScene::referenceTextureSampler(TextureSamplerHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        const auto index = handle.asMemoryHandle();
+        if (index >= m_textureSamplerRefCounts.size())
+            m_textureSamplerRefCounts.resize(index + 1u, 0u);
+        if (m_textureSamplerRefCounts[index]++ == 0u && isTextureSamplerAllocated(handle))
+            referenceResource(getTextureSampler(handle).textureResource);
+    }
+
+    void ResourceChangeCollectingScene::unreferenceTextureSampler(TextureSamplerHandle handle)
+    {
+        if (!handle.isValid())
+            return;
+
+        const auto index = handle.asMemoryHandle();
+        assert(index < m_textureSamplerRefCounts.size() && m_textureSamplerRefCounts[index] != 0u);
+        if (--m_textureSamplerRefCounts[index] == 0u && isTextureSamplerAllocated(handle))
+            unreferenceResource(getTextureSampler(handle).textureResource);
+    }
+
+    void ResourceChangeCollectingScene::referenceResource(const ResourceContentHash& hash)
+    {
+        if (!hash.isValid())
+            return;
+
+        ResourceUsage& usage = m_clientResourceUsage[hash];
+        if (usage.refCount++ == 0u && !usage.changedSinceLastReset)
+        {
+            usage.changedSinceLastReset = true;
+            m_clientResourcesWithChangedUsage.push_back(hash);
+        }
+    }
+
+    void ResourceChangeCollectingScene::unreferenceResource(const ResourceContentHash& hash)
+    {
+        if (!hash.isValid())
+            return;
+
+        auto it = m_clientResourceUsage.find(hash);
+        assert(it != m_clientResourceUsage.end() && it->second.refCount != 0u);
+        ResourceUsage& usage = it->second;
+        if (--usage.refCount == 0u && !usage.changedSinceLastReset)
+        {
+            usage.changedSinceLastReset = true;
+            m_clientResourcesWithChangedUsage.push_back(hash);
+        }
+    }
+
     UniformBufferHandle ResourceChangeCollectingScene::allocateUniformBuffer(uint32_t size, UniformBufferHandle handle)
     {
         const auto newHandle = BaseT::allocateUniformBuffer(size, handle);
@@ -11,6 +11,9 @@
 #include "internal/SceneGraph/Scene/TransformationCachedScene.h"
 #include "internal/SceneGraph/Scene/ResourceChanges.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace ramses::internal
 {
     class ResourceChangeCollectingScene : public TransformationCachedScene
@@ -23,11 +26,17 @@ namespace ramses::internal
         [[nodiscard]] bool                                haveResourcesChanged() const;
         void                                resetResourceChanges();
 
+        // client resources which started or stopped being used since last reset (same usage as ResourceUtils::GetAllResourcesFromScene),
+        // tracked at the time the scene is modified so that the cost depends on number of changes, not scene size
+        void                        getClientResourceUsageChanges(ResourceContentHashVector& added, ResourceContentHashVector& removed) const;
+
         // functions which affect client resources
         void                        releaseRenderable(RenderableHandle renderableHandle) override;
         void                        setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
         void                        setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visibility) override;
 
+        DataInstanceHandle          allocateDataInstance(DataLayoutHandle finishedLayoutHandle, DataInstanceHandle instanceHandle) override;
+        void                        releaseDataInstance(DataInstanceHandle containerHandle) override;
 
         void                        setDataResource(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride) override;
         void                        setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
@@ -63,8 +72,31 @@ namespace ramses::internal
         void                        updateTextureBuffer(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data) override;
 
     private:
+        void referenceDataInstance(DataInstanceHandle handle);
+        void unreferenceDataInstance(DataInstanceHandle handle);
+        [[nodiscard]] bool isDataInstanceReferenced(DataInstanceHandle handle) const;
+        void referenceDataInstanceResources(DataInstanceHandle handle);
+        void unreferenceDataInstanceResources(DataInstanceHandle handle);
+        void referenceTextureSampler(TextureSamplerHandle handle);
+        void unreferenceTextureSampler(TextureSamplerHandle handle);
+        void referenceResource(const ResourceContentHash& hash);
+        void unreferenceResource(const ResourceContentHash& hash);
 
         SceneResourceActionVector   m_sceneResourceActions;
         bool                        m_resourcesChanged = false;
+
+        // number of references from visible renderables (data instances) and from referenced data instances (texture samplers),
+        // independent of whether the referenced object is allocated
+        std::vector<uint32_t>       m_dataInstanceRefCounts;
+        std::vector<uint32_t>       m_textureSamplerRefCounts;
+
+        struct ResourceUsage
+        {
+            uint32_t refCount = 0u;
+            bool usedAtLastReset = false;
+            bool changedSinceLastReset = false;
+        };
+        std::unordered_map<ResourceContentHash, ResourceUsage> m_clientResourceUsage;
+        ResourceContentHashVector   m_clientResourcesWithChangedUsage;
     };
 }
@@ -10,6 +10,7 @@
 
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
 #include "internal/Core/Utils/MemoryPool.h"
+#include "internal/Core/Utils/MemoryPoolDense.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/SceneGraph/SceneAPI/SceneSizeInformation.h"
 #include "internal/SceneGraph/SceneAPI/RenderGroupUtils.h"
@@ -121,6 +122,30 @@ namespace ramses::internal
         // implemented on renderer side only in a derived scene
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isStateSorted = enable;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassFrontToBackSorting(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isFrontToBackSorted = enable;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassBackToFrontSorting(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->isBackToFrontSorted = enable;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderPassDepthPrePass(RenderPassHandle passHandle, bool enable)
+    {
+        m_renderPasses.getMemory(passHandle)->hasDepthPrePass = enable;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
@@ -256,6 +281,14 @@ namespace ramses::internal
         dataBuffer.usedSize = std::max(dataBuffer.usedSize, dataSizeInBytes + offsetInBytes);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        GeometryDataBuffer& dataBuffer = *m_dataBuffers.getMemory(handle);
+        assert(usedSizeInBytes <= dataBuffer.data.size());
+        dataBuffer.usedSize = usedSizeInBytes;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const GeometryDataBuffer& SceneT<MEMORYPOOL>::getDataBuffer(DataBufferHandle handle) const
     {
@@ -707,6 +740,25 @@ namespace ramses::internal
         m_renderables.getMemory(renderableHandle)->startVertex = startVertex;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere)
+    {
+        m_renderables.getMemory(renderableHandle)->boundingSphere = boundingSphere;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions)
+    {
+        m_renderables.getMemory(renderableHandle)->instancePositions = instancePositions;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        assert(levelsOfDetail.count <= MaxRenderableLevelsOfDetail);
+        m_renderables.getMemory(renderableHandle)->levelsOfDetail = levelsOfDetail;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     const Renderable& SceneT<MEMORYPOOL>::getRenderable(RenderableHandle renderableHandle) const
     {
@@ -720,6 +772,8 @@ namespace ramses::internal
         RenderGroup& rg = *m_renderGroups.getMemory(actualHandle);
         rg.renderables.reserve(renderableCount);
         rg.renderGroups.reserve(nestedGroupCount);
+        rg.renderableIndices.reserve(renderableCount);
+        rg.renderGroupIndices.reserve(nestedGroupCount);
         return actualHandle;
     }
 
@@ -739,34 +793,28 @@ namespace ramses::internal
     void SceneT<MEMORYPOOL>::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order)
     {
         RenderGroup& rg = *m_renderGroups.getMemory(groupHandle);
-        assert(!RenderGroupUtils::ContainsRenderable(renderableHandle, rg));
-        rg.renderables.push_back({ renderableHandle, order });
+        RenderGroupUtils::AddRenderable(renderableHandle, order, rg);
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
         RenderGroup& rg = *m_renderGroups.getMemory(groupHandle);
-        const auto it = RenderGroupUtils::FindRenderableEntry(renderableHandle, rg);
-        assert(it != rg.renderables.cend());
-        rg.renderables.erase(it);
+        RenderGroupUtils::RemoveRenderable(renderableHandle, rg);
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order)
     {
         RenderGroup& rg = *m_renderGroups.getMemory(groupHandleParent);
-        assert(!RenderGroupUtils::ContainsRenderGroup(groupHandleChild, rg));
-        rg.renderGroups.push_back({ groupHandleChild, order });
+        RenderGroupUtils::AddRenderGroup(groupHandleChild, order, rg);
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         RenderGroup& rg = *m_renderGroups.getMemory(groupHandleParent);
-        const auto it = RenderGroupUtils::FindRenderGroupEntry(groupHandleChild, rg);
-        assert(it != rg.renderGroups.cend());
-        rg.renderGroups.erase(it);
+        RenderGroupUtils::RemoveRenderGroup(groupHandleChild, rg);
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -953,6 +1001,12 @@ namespace ramses::internal
         setInstanceDataInternal<UniformBufferHandle>(containerHandle, fieldId, 1, &uniformBufferHandle);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs)
+    {
+        m_dataInstanceMemory.getMemory(containerHandle)->setUniformTimeAnimationEnd(endTimeMs);
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     DataInstanceHandle SceneT<MEMORYPOOL>::allocateDataInstance(DataLayoutHandle layoutHandle, DataInstanceHandle instanceHandle)
     {
@@ -1025,12 +1079,32 @@ namespace ramses::internal
         const DataLayoutHandle actualHandle = m_dataLayoutMemory.allocate(handle);
 
         DataLayout& dataLayout = *m_dataLayoutMemory.getMemory(actualHandle);
-        dataLayout.setDataFields(dataFields);
+        dataLayout.setDataFields(dataFields, m_dataLayoutPacking);
         dataLayout.setEffectHash(effectHash);
 
         return actualHandle;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setDataLayoutPacking(EDataLayoutPacking packing)
+    {
+        m_dataLayoutPacking = packing;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    EDataLayoutPacking SceneT<MEMORYPOOL>::getDataLayoutPacking() const
+    {
+        return m_dataLayoutPacking;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    const std::byte* SceneT<MEMORYPOOL>::getDataUniformBlock(DataInstanceHandle containerHandle) const
+    {
+        const DataInstance* dataInstance = m_dataInstanceMemory.getMemory(containerHandle);
+        const DataLayout* dataLayout = m_dataLayoutMemory.getMemory(dataInstance->getLayoutHandle());
+        return dataLayout->getUniformBlockSize() > 0u ? dataInstance->getData() : nullptr;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     uint32_t SceneT<MEMORYPOOL>::getTransformCount() const
     {
@@ -1237,6 +1311,14 @@ namespace ramses::internal
         m_sceneReferences.getMemory(handle)->renderOrder = renderOrder;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority)
+    {
+        auto& sceneReference = *m_sceneReferences.getMemory(handle);
+        sceneReference.preloadState = preloadState;
+        sceneReference.preloadPriority = preloadPriority;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     uint32_t SceneT<MEMORYPOOL>::getSceneReferenceCount() const
     {
@@ -1459,4 +1541,5 @@ namespace ramses::internal
 
     template class SceneT < MemoryPool >;
     template class SceneT < MemoryPoolExplicit > ;
+    template class SceneT < MemoryPoolDense >;
 }
@@ -31,6 +31,7 @@
 
 #include "internal/Core/Utils/MemoryPool.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/Core/Utils/MemoryPoolDense.h"
 
 namespace ramses::internal
 {
@@ -39,6 +40,7 @@ namespace ramses::internal
 
     using Scene = SceneT<MemoryPool>;
     using SceneWithExplicitMemory = SceneT<MemoryPoolExplicit>;
+    using SceneWithDenseMemory = SceneT<MemoryPoolDense>;
 
     template <template<typename, typename> class MEMORYPOOL>
     class SceneT : public IScene
@@ -89,6 +91,9 @@ namespace ramses::internal
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) override;
         void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
         void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) override;
+        void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const glm::vec4& boundingSphere) override;
+        void                        setRenderableInstancePositions  (RenderableHandle renderableHandle, DataBufferHandle instancePositions) override;
+        void                        setRenderableLevelsOfDetail     (RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail) override;
         [[nodiscard]] const Renderable& getRenderable               (RenderableHandle renderableHandle) const final override;
         [[nodiscard]] const RenderableMemoryPool& getRenderables    () const;
 
@@ -194,6 +199,9 @@ namespace ramses::internal
         void setDataReference            (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
         void setDataUniformBuffer        (DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle) override;
 
+        void                  setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs) override;
+        [[nodiscard]] int32_t getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const final override;
+
         // get/setData*Array wrappers for elementCount == 1
         [[nodiscard]] float             getDataSingleFloat              (DataInstanceHandle containerHandle, DataFieldHandle field) const final override;
         [[nodiscard]] const glm::vec2&  getDataSingleVector2f           (DataInstanceHandle containerHandle, DataFieldHandle field) const final override;
@@ -254,6 +262,10 @@ namespace ramses::internal
         void                    setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                    setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                    retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                    setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
+        void                    setRenderPassFrontToBackSorting (RenderPassHandle passHandle, bool enable) override;
+        void                    setRenderPassBackToFrontSorting (RenderPassHandle passHandle, bool enable) override;
+        void                    setRenderPassDepthPrePass       (RenderPassHandle passHandle, bool enable) override;
         void                    addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                    removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         [[nodiscard]] const RenderPass& getRenderPass           (RenderPassHandle passHandle) const final override;
@@ -305,6 +317,7 @@ namespace ramses::internal
         void                    releaseDataBuffer               (DataBufferHandle handle) override;
         [[nodiscard]] uint32_t  getDataBufferCount              () const final override;
         void                    updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+        void                    setDataBufferUsedSize           (DataBufferHandle handle, uint32_t usedSizeInBytes) override;
         [[nodiscard]] bool      isDataBufferAllocated           (DataBufferHandle handle) const final override;
         [[nodiscard]] const GeometryDataBuffer& getDataBuffer   (DataBufferHandle handle) const final override;
         [[nodiscard]] const DataBufferMemoryPool& getDataBuffers() const;
@@ -340,6 +353,7 @@ namespace ramses::internal
         void                    requestSceneReferenceState      (SceneReferenceHandle handle, RendererSceneState state) override;
         void                    requestSceneReferenceFlushNotifications(SceneReferenceHandle handle, bool enable) override;
         void                    setSceneReferenceRenderOrder    (SceneReferenceHandle handle, int32_t renderOrder) override;
+        void                    setSceneReferencePreload        (SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority) override;
         [[nodiscard]] bool      isSceneReferenceAllocated       (SceneReferenceHandle handle) const final override;
         [[nodiscard]] uint32_t  getSceneReferenceCount          () const final override;
         [[nodiscard]] const SceneReference& getSceneReference   (SceneReferenceHandle handle) const final override;
@@ -347,6 +361,12 @@ namespace ramses::internal
 
         [[nodiscard]] SceneSizeInformation getSceneSizeInformation() const final  override;
 
+        // Packing used for data layouts allocated afterwards, existing layouts are not affected
+        void                              setDataLayoutPacking(EDataLayoutPacking packing);
+        [[nodiscard]] EDataLayoutPacking  getDataLayoutPacking() const;
+        // Pointer to std140 uniform block of data instance (see DataLayout::getUniformBlockSize), nullptr if its layout has none
+        [[nodiscard]] const std::byte*    getDataUniformBlock(DataInstanceHandle containerHandle) const;
+
     protected:
         [[nodiscard]] const TopologyNode& getNode                         (NodeHandle handle) const;
         TextureSampler&                   getTextureSamplerInternal       (TextureSamplerHandle handle);
@@ -388,6 +408,7 @@ namespace ramses::internal
         const ESPIRVVersion                 m_spirvVersion;
 
         FlushTime::Clock::time_point m_effectTimeSync;
+        EDataLayoutPacking m_dataLayoutPacking = EDataLayoutPacking::Native;
     };
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -769,6 +790,12 @@ namespace ramses::internal
         return *getInstanceDataInternal<UniformBufferHandle>(containerHandle, fieldId);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    inline int32_t SceneT<MEMORYPOOL>::getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const
+    {
+        return m_dataInstanceMemory.getMemory(containerHandle)->getUniformTimeAnimationEnd();
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     inline const ResourceField& SceneT<MEMORYPOOL>::getDataResource(DataInstanceHandle containerHandle, DataFieldHandle fieldId) const
     {
@@ -8,6 +8,7 @@
 
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
 #include "internal/SceneGraph/Scene/ResourceChanges.h"
+#include "internal/SceneGraph/Scene/DataLayout.h"
 #include "internal/SceneGraph/SceneAPI/IScene.h"
 #include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
 #include "internal/SceneGraph/SceneAPI/TextureSampler.h"
@@ -20,9 +21,13 @@
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/Core/Utils/BinaryInputStream.h"
+#include "internal/Core/Utils/LogMacros.h"
 #include "glm/gtx/range.hpp"
 
+#include <array>
+#include <numeric>
 #include <string>
+#include <vector>
 
 
 namespace ramses::internal
@@ -34,6 +39,122 @@ namespace ramses::internal
         assert(actualHandle.isValid());
     }
 
+    // copies raw handle array written by SceneActionCollectionCreator bulk actions,
+    // fails if array size does not match element size (actions can be received from network)
+    template<typename T>
+    [[nodiscard]] inline bool ReadBulkArray(SceneActionCollection::SceneActionReader& action, std::vector<T>& values)
+    {
+        const std::byte* data = nullptr;
+        uint32_t size = 0u;
+        action.readWithoutCopy(data, size);
+        if (size % sizeof(T) != 0u)
+            return false;
+        values.resize(size / sizeof(T));
+        if (size > 0u)
+            PlatformMemory::Copy(values.data(), data, size);
+        return true;
+    }
+
+    namespace
+    {
+        // applies a run of consecutive actions [begin, end) of the same type with a typed loop instead of
+        // dispatching every single action through the generic switch, animation flushes are mostly such runs
+        using ActionRunApplier = void (*)(IScene& scene, const SceneActionCollection& actions, size_t begin, size_t end);
+
+        template <void (IScene::*Setter)(TransformHandle, const glm::vec3&)>
+        void ApplyTransformVec3Run(IScene& scene, const SceneActionCollection& actions, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto action = actions[i];
+                TransformHandle transform;
+                glm::vec3 vec;
+                action.read(transform);
+                action.read(vec);
+                (scene.*Setter)(transform, vec);
+                assert(action.isFullyRead());
+            }
+        }
+
+        void ApplyRotationRun(IScene& scene, const SceneActionCollection& actions, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto action = actions[i];
+                TransformHandle transform;
+                glm::vec4 vec;
+                ERotationType rotationType;
+                action.read(transform);
+                action.read(vec);
+                action.read(rotationType);
+                scene.setRotation(transform, vec, rotationType);
+                assert(action.isFullyRead());
+            }
+        }
+
+        // array values are written element by element and component by component which is their memory layout,
+        // so they are copied at once into an aligned temporary which is passed to the scene's setter
+        template <typename T, void (IScene::*Setter)(DataInstanceHandle, DataFieldHandle, uint32_t, const T*)>
+        void ApplyDataArrayRun(IScene& scene, const SceneActionCollection& actions, size_t begin, size_t end)
+        {
+            constexpr uint32_t headerSize = sizeof(DataInstanceHandle) + sizeof(DataFieldHandle) + sizeof(uint32_t);
+            std::vector<T> values;
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto action = actions[i];
+                DataInstanceHandle handle;
+                DataFieldHandle field;
+                uint32_t elementCount = 0;
+                action.read(handle);
+                action.read(field);
+                action.read(elementCount);
+
+                // actions can be received from network, sizes must match the action and the target field
+                const bool validSize = (action.size() == headerSize + uint64_t{ elementCount } * sizeof(T));
+                bool validTarget = false;
+                if (validSize && scene.isDataInstanceAllocated(handle))
+                {
+                    const DataLayout& layout = scene.getDataLayout(scene.getLayoutOfDataInstance(handle));
+                    validTarget = (field < layout.getFieldCount() && elementCount <= layout.getField(field).elementCount);
+                }
+                if (!validTarget)
+                {
+                    LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier: ignoring invalid {} action for data instance {} field {} with {} elements and size {}",
+                        GetNameForSceneActionId(action.type()), handle, field, elementCount, action.size());
+                    continue;
+                }
+
+                values.resize(elementCount);
+                if (elementCount > 0u)
+                    PlatformMemory::Copy(values.data(), action.data() + headerSize, elementCount * sizeof(T));
+                (scene.*Setter)(handle, field, elementCount, values.data());
+            }
+        }
+
+        constexpr std::array<ActionRunApplier, static_cast<size_t>(ESceneActionId::NUMBER_OF_TYPES)> CreateActionRunAppliers()
+        {
+            std::array<ActionRunApplier, static_cast<size_t>(ESceneActionId::NUMBER_OF_TYPES)> appliers{};
+            const auto set = [&appliers](ESceneActionId type, ActionRunApplier applier) { appliers[static_cast<size_t>(type)] = applier; };
+            set(ESceneActionId::SetTranslation, &ApplyTransformVec3Run<&IScene::setTranslation>);
+            set(ESceneActionId::SetScaling, &ApplyTransformVec3Run<&IScene::setScaling>);
+            set(ESceneActionId::SetRotation, &ApplyRotationRun);
+            set(ESceneActionId::SetDataFloatArray, &ApplyDataArrayRun<float, &IScene::setDataFloatArray>);
+            set(ESceneActionId::SetDataVector2fArray, &ApplyDataArrayRun<glm::vec2, &IScene::setDataVector2fArray>);
+            set(ESceneActionId::SetDataVector3fArray, &ApplyDataArrayRun<glm::vec3, &IScene::setDataVector3fArray>);
+            set(ESceneActionId::SetDataVector4fArray, &ApplyDataArrayRun<glm::vec4, &IScene::setDataVector4fArray>);
+            set(ESceneActionId::SetDataIntegerArray, &ApplyDataArrayRun<int32_t, &IScene::setDataIntegerArray>);
+            set(ESceneActionId::SetDataVector2iArray, &ApplyDataArrayRun<glm::ivec2, &IScene::setDataVector2iArray>);
+            set(ESceneActionId::SetDataVector3iArray, &ApplyDataArrayRun<glm::ivec3, &IScene::setDataVector3iArray>);
+            set(ESceneActionId::SetDataVector4iArray, &ApplyDataArrayRun<glm::ivec4, &IScene::setDataVector4iArray>);
+            set(ESceneActionId::SetDataMatrix22fArray, &ApplyDataArrayRun<glm::mat2, &IScene::setDataMatrix22fArray>);
+            set(ESceneActionId::SetDataMatrix33fArray, &ApplyDataArrayRun<glm::mat3, &IScene::setDataMatrix33fArray>);
+            set(ESceneActionId::SetDataMatrix44fArray, &ApplyDataArrayRun<glm::mat4, &IScene::setDataMatrix44fArray>);
+            return appliers;
+        }
+
+        constexpr auto ActionRunAppliers = CreateActionRunAppliers();
+    }
+
     void SceneActionApplier::ApplySingleActionOnScene(IScene& scene, SceneActionCollection::SceneActionReader& action, EFeatureLevel featureLevel)
     {
         switch (action.type())
@@ -56,6 +177,55 @@ namespace ramses::internal
             scene.addChildToNode(node, child);
             break;
         }
+        case ESceneActionId::AllocateNodesBulk:
+        {
+            uint32_t count = 0u;
+            std::vector<NodeHandle> nodes;
+            std::vector<uint32_t> childCounts;
+            std::vector<NodeHandle> children;
+            action.read(count);
+            // all arrays are read regardless of validity of previous ones so that action is always fully read
+            const bool nodesRead = ReadBulkArray(action, nodes);
+            const bool childCountsRead = ReadBulkArray(action, childCounts);
+            const bool childrenRead = ReadBulkArray(action, children);
+            const bool sizesValid = nodesRead && childCountsRead && childrenRead && nodes.size() == count && childCounts.size() == count &&
+                std::accumulate(childCounts.cbegin(), childCounts.cend(), uint64_t{ 0u }) == children.size();
+            if (!sizesValid)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier: ignoring invalid AllocateNodesBulk action with count {}, {} nodes, {} child counts and {} children",
+                    count, nodes.size(), childCounts.size(), children.size());
+                break;
+            }
+
+            // all nodes exist before any child is added, same as with single actions
+            for (uint32_t i = 0u; i < count; ++i)
+                AssertHandle(scene.allocateNode(childCounts[i], nodes[i]), nodes[i]);
+            size_t childIdx = 0u;
+            for (uint32_t i = 0u; i < count; ++i)
+            {
+                for (uint32_t child = 0u; child < childCounts[i]; ++child)
+                    scene.addChildToNode(nodes[i], children[childIdx++]);
+            }
+            break;
+        }
+        case ESceneActionId::AllocateTransformsBulk:
+        {
+            uint32_t count = 0u;
+            std::vector<TransformHandle> transforms;
+            std::vector<NodeHandle> nodes;
+            action.read(count);
+            const bool transformsRead = ReadBulkArray(action, transforms);
+            const bool nodesRead = ReadBulkArray(action, nodes);
+            if (!transformsRead || !nodesRead || transforms.size() != count || nodes.size() != count)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier: ignoring invalid AllocateTransformsBulk action with count {}, {} transforms and {} nodes",
+                    count, transforms.size(), nodes.size());
+                break;
+            }
+            for (uint32_t i = 0u; i < count; ++i)
+                AssertHandle(scene.allocateTransform(nodes[i], transforms[i]), transforms[i]);
+            break;
+        }
         case ESceneActionId::AllocateTransform:
         {
             NodeHandle nodeHandle;
@@ -94,6 +264,40 @@ namespace ramses::internal
             scene.setScaling(transform, vec);
             break;
         }
+        case ESceneActionId::SetTransformsBulk:
+        {
+            uint32_t count = 0u;
+            uint8_t components = 0u;
+            action.read(count);
+            action.read(components);
+            const bool hasTranslation = (components & EBulkTransformComponent_Translation) != 0u;
+            const bool hasRotation = (components & EBulkTransformComponent_Rotation) != 0u;
+            const bool hasScaling = (components & EBulkTransformComponent_Scaling) != 0u;
+            TransformHandle transform;
+            glm::vec3 translation;
+            glm::vec4 rotation;
+            glm::vec3 scaling;
+            for (uint32_t i = 0u; i < count; ++i)
+            {
+                action.read(transform);
+                if (hasTranslation)
+                {
+                    action.read(translation);
+                    scene.setTranslation(transform, translation);
+                }
+                if (hasRotation)
+                {
+                    action.read(rotation);
+                    scene.setRotation(transform, rotation, ERotationType::Quaternion);
+                }
+                if (hasScaling)
+                {
+                    action.read(scaling);
+                    scene.setScaling(transform, scaling);
+                }
+            }
+            break;
+        }
         case ESceneActionId::AllocateDataInstance:
         {
             DataLayoutHandle dataLayout;
@@ -316,6 +520,15 @@ namespace ramses::internal
             scene.setDataUniformBuffer(handle, field, uniformBufferHandle);
             break;
         }
+        case ESceneActionId::SetDataInstanceUniformTimeAnimationEnd:
+        {
+            DataInstanceHandle handle;
+            int32_t endTimeMs = 0;
+            action.read(handle);
+            action.read(endTimeMs);
+            scene.setDataInstanceUniformTimeAnimationEnd(handle, endTimeMs);
+            break;
+        }
         case ESceneActionId::AllocateRenderable:
         {
             NodeHandle node;
@@ -426,6 +639,49 @@ namespace ramses::internal
             scene.setRenderableStartVertex(renderable, startVertex);
             break;
         }
+        case ESceneActionId::SetRenderableBoundingSphere:
+        {
+            RenderableHandle renderable;
+            glm::vec4 boundingSphere;
+            action.read(renderable);
+            action.read(boundingSphere);
+            scene.setRenderableBoundingSphere(renderable, boundingSphere);
+            break;
+        }
+        case ESceneActionId::SetRenderableInstancePositions:
+        {
+            RenderableHandle renderable;
+            DataBufferHandle instancePositions;
+            action.read(renderable);
+            action.read(instancePositions);
+            scene.setRenderableInstancePositions(renderable, instancePositions);
+            break;
+        }
+        case ESceneActionId::SetRenderableLevelsOfDetail:
+        {
+            RenderableHandle renderable;
+            RenderableLevelsOfDetail levelsOfDetail;
+            action.read(renderable);
+            action.read(levelsOfDetail.count);
+            // actions can be received from network, levels must fit into fixed array and match action size
+            constexpr uint64_t levelSize = sizeof(RenderableLevelOfDetail::startIndex) + sizeof(RenderableLevelOfDetail::indexCount) + sizeof(RenderableLevelOfDetail::screenSize);
+            if (levelsOfDetail.count > MaxRenderableLevelsOfDetail || action.size() != sizeof(RenderableHandle) + sizeof(uint32_t) + levelsOfDetail.count * levelSize)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneActionApplier: ignoring invalid SetRenderableLevelsOfDetail action for renderable {} with {} levels and size {}",
+                    renderable, levelsOfDetail.count, action.size());
+                // remaining content is not read, action is dropped as a whole
+                return;
+            }
+            for (uint32_t i = 0u; i < levelsOfDetail.count; ++i)
+            {
+                RenderableLevelOfDetail& level = levelsOfDetail.levels[i];
+                action.read(level.startIndex);
+                action.read(level.indexCount);
+                action.read(level.screenSize);
+            }
+            scene.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+            break;
+        }
         case ESceneActionId::AllocateRenderGroup:
         {
             uint32_t renderableCount = 0u;
@@ -739,6 +995,42 @@ namespace ramses::internal
             scene.retriggerRenderPassRenderOnce(passHandle);
             break;
         }
+        case ESceneActionId::SetRenderPassStateSorting:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassStateSorting(passHandle, enabled);
+            break;
+        }
+        case ESceneActionId::SetRenderPassFrontToBackSorting:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassFrontToBackSorting(passHandle, enabled);
+            break;
+        }
+        case ESceneActionId::SetRenderPassBackToFrontSorting:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassBackToFrontSorting(passHandle, enabled);
+            break;
+        }
+        case ESceneActionId::SetRenderPassDepthPrePass:
+        {
+            RenderPassHandle passHandle;
+            bool enabled = false;
+            action.read(passHandle);
+            action.read(enabled);
+            scene.setRenderPassDepthPrePass(passHandle, enabled);
+            break;
+        }
         case ESceneActionId::AddRenderGroupToRenderPass:
         {
             RenderPassHandle passHandle;
@@ -1037,6 +1329,15 @@ namespace ramses::internal
             scene.updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
             break;
         }
+        case ESceneActionId::SetDataBufferUsedSize:
+        {
+            DataBufferHandle handle;
+            uint32_t usedSizeInBytes = 0;
+            action.read(handle.asMemoryHandleReference());
+            action.read(usedSizeInBytes);
+            scene.setDataBufferUsedSize(handle, usedSizeInBytes);
+            break;
+        }
         case ESceneActionId::AllocateUniformBuffer:
         {
             UniformBufferHandle handle;
@@ -1161,6 +1462,17 @@ namespace ramses::internal
             scene.requestSceneReferenceFlushNotifications(handle, enable);
             break;
         }
+        case ESceneActionId::SetSceneReferencePreload:
+        {
+            SceneReferenceHandle handle;
+            RendererSceneState preloadState;
+            int32_t preloadPriority = 0;
+            action.read(handle);
+            action.read(preloadState);
+            action.read(preloadPriority);
+            scene.setSceneReferencePreload(handle, preloadState, preloadPriority);
+            break;
+        }
         case ESceneActionId::PreallocateSceneSize:
         {
             SceneSizeInformation sizeInfos;
@@ -1327,9 +1639,26 @@ namespace ramses::internal
 
     void SceneActionApplier::ApplyActionsOnScene(IScene& scene, const SceneActionCollection& actions, EFeatureLevel featureLevel)
     {
-        for (auto& reader : actions)
-        {
-            ApplySingleActionOnScene(scene, reader, featureLevel);
+        const size_t numActions = actions.numberOfActions();
+        size_t actionIdx = 0u;
+        while (actionIdx < numActions)
+        {
+            auto action = actions[actionIdx];
+            // type of action received from network is not guaranteed to be known
+            const ActionRunApplier runApplier = (action.type() < ESceneActionId::NUMBER_OF_TYPES) ? ActionRunAppliers[static_cast<size_t>(action.type())] : nullptr;
+            if (runApplier != nullptr)
+            {
+                size_t runEnd = actionIdx + 1u;
+                while (runEnd < numActions && actions[runEnd].type() == action.type())
+                    ++runEnd;
+                runApplier(scene, actions, actionIdx, runEnd);
+                actionIdx = runEnd;
+            }
+            else
+            {
+                ApplySingleActionOnScene(scene, action, featureLevel);
+                ++actionIdx;
+            }
         }
     }
 
@@ -0,0 +1,126 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
+#include "internal/Core/Common/MemoryHandle.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct LastWrite
+        {
+            uint32_t actionIndex;
+            uint32_t sequence;
+        };
+
+        // type is stored in lowest byte, data field in the following 3 bytes and object handle in upper half
+        static_assert(NumOfSceneActionTypes <= 0xFFu, "scene action type does not fit into coalescing key");
+        constexpr uint32_t MaxDataFieldForKey = 0xFFFFFFu;
+
+        uint64_t MakeKey(ESceneActionId type, MemoryHandle object, MemoryHandle field)
+        {
+            return (uint64_t{ object } << 32u) | (uint64_t{ field } << 8u) | static_cast<uint64_t>(type);
+        }
+    }
+
+    uint32_t SceneActionCoalescer::CoalesceActions(SceneActionCollection& actions)
+    {
+        const uint32_t numActions = actions.numberOfActions();
+        std::vector<bool> overwritten(numActions, false);
+        uint32_t numOverwritten = 0u;
+
+        // actions can only be coalesced within a sequence of coalescible actions, every other action starts a new sequence
+        HashMap<uint64_t, LastWrite> lastWrites;
+        uint32_t sequence = 0u;
+
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            auto action = actions[i];
+            const ESceneActionId type = action.type();
+            if (!IsCoalescible(type))
+            {
+                ++sequence;
+                continue;
+            }
+
+            MemoryHandle object = InvalidMemoryHandle;
+            MemoryHandle field = 0u;
+            action.read(object);
+            if (type != ESceneActionId::SetTranslation && type != ESceneActionId::SetRotation && type != ESceneActionId::SetScaling && type != ESceneActionId::SetRenderableVisibility)
+                action.read(field);
+            if (field > MaxDataFieldForKey)
+            {
+                ++sequence;
+                continue;
+            }
+
+            const uint64_t key = MakeKey(type, object, field);
+            LastWrite* lastWrite = lastWrites.get(key);
+            if (lastWrite != nullptr && lastWrite->sequence == sequence)
+            {
+                // data arrays with different element count do not fully overwrite each other
+                if (actions[lastWrite->actionIndex].size() == action.size())
+                {
+                    overwritten[lastWrite->actionIndex] = true;
+                    ++numOverwritten;
+                }
+                lastWrite->actionIndex = i;
+            }
+            else
+            {
+                lastWrites.put(key, { i, sequence });
+            }
+        }
+
+        if (numOverwritten == 0u)
+            return 0u;
+
+        SceneActionCollection coalescedActions(actions.collectionData().size(), numActions - numOverwritten);
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            if (overwritten[i])
+                continue;
+            const auto action = actions[i];
+            coalescedActions.addRawSceneActionInformation(action.type(), static_cast<uint32_t>(coalescedActions.collectionData().size()));
+            coalescedActions.appendRawData(action.data(), action.size());
+        }
+        actions.swap(coalescedActions);
+
+        return numOverwritten;
+    }
+
+    bool SceneActionCoalescer::IsCoalescible(ESceneActionId type)
+    {
+        switch (type)
+        {
+        case ESceneActionId::SetTranslation:
+        case ESceneActionId::SetRotation:
+        case ESceneActionId::SetScaling:
+        case ESceneActionId::SetRenderableVisibility:
+        case ESceneActionId::SetDataBooleanArray:
+        case ESceneActionId::SetDataIntegerArray:
+        case ESceneActionId::SetDataFloatArray:
+        case ESceneActionId::SetDataVector2fArray:
+        case ESceneActionId::SetDataVector3fArray:
+        case ESceneActionId::SetDataVector4fArray:
+        case ESceneActionId::SetDataVector2iArray:
+        case ESceneActionId::SetDataVector3iArray:
+        case ESceneActionId::SetDataVector4iArray:
+        case ESceneActionId::SetDataMatrix22fArray:
+        case ESceneActionId::SetDataMatrix33fArray:
+        case ESceneActionId::SetDataMatrix44fArray:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
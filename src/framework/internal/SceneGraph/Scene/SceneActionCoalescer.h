@@ -0,0 +1,28 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+
+namespace ramses::internal
+{
+    // Removes scene actions which are fully overwritten by a later action of same type on same object (and data field)
+    // before the collection is sent to subscribers, e.g. repeated setTranslation on a transform within one flush.
+    // Only last-writer-wins setters (transformation, renderable visibility, data values) are coalesced and only within
+    // a sequence of such setters, any other action (allocation, release, etc.) keeps all actions before it untouched.
+    class SceneActionCoalescer
+    {
+    public:
+        // returns number of removed actions
+        static uint32_t CoalesceActions(SceneActionCollection& actions);
+
+    private:
+        static bool IsCoalescible(ESceneActionId type);
+    };
+}
@@ -98,6 +98,10 @@ namespace ramses::internal
 
         [[nodiscard]] uint32_t numberOfActions() const;
 
+        // memory of action data and action infos, reserved memory is kept when collection is cleared
+        [[nodiscard]] size_t getUsedMemorySize() const;
+        [[nodiscard]] size_t getReservedMemorySize() const;
+
         [[nodiscard]] Iterator begin() const;
         [[nodiscard]] Iterator end() const;
 
@@ -423,6 +427,16 @@ namespace ramses::internal
         return static_cast<uint32_t>(m_actionInfo.size());
     }
 
+    inline size_t SceneActionCollection::getUsedMemorySize() const
+    {
+        return m_data.size() + m_actionInfo.size() * sizeof(ActionInfo);
+    }
+
+    inline size_t SceneActionCollection::getReservedMemorySize() const
+    {
+        return m_data.capacity() + m_actionInfo.capacity() * sizeof(ActionInfo);
+    }
+
     inline SceneActionCollection::Iterator SceneActionCollection::begin() const
     {
         return Iterator(SceneActionReader(this, 0));
@@ -23,8 +23,20 @@
 #include "internal/Core/Utils/RawBinaryOutputStream.h"
 #include "glm/gtx/range.hpp"
 
+#include <numeric>
+
 namespace ramses::internal
 {
+    namespace
+    {
+        template <typename T>
+        void WriteBulkArray(SceneActionCollection& collection, const T* data, uint32_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T> && sizeof(T) == sizeof(uint32_t), "bulk arrays are read as raw memory");
+            collection.write(reinterpret_cast<const std::byte*>(data), count * static_cast<uint32_t>(sizeof(T)));
+        }
+    }
+
     SceneActionCollectionCreator::SceneActionCollectionCreator(SceneActionCollection& collection_, EFeatureLevel featureLevel)
         : collection{ collection_ }
         , m_featureLevel{ featureLevel }
@@ -59,6 +71,30 @@ namespace ramses::internal
         collection.write(newValue);
     }
 
+    void SceneActionCollectionCreator::setTransformsBulk(uint32_t count, const TransformHandle* transforms, const glm::vec3* translations, const glm::vec4* rotations, const glm::vec3* scalings)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetTransformsBulk);
+        collection.write(count);
+        uint8_t components = 0u;
+        if (translations)
+            components |= EBulkTransformComponent_Translation;
+        if (rotations)
+            components |= EBulkTransformComponent_Rotation;
+        if (scalings)
+            components |= EBulkTransformComponent_Scaling;
+        collection.write(components);
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            collection.write(transforms[i]);
+            if (translations)
+                collection.write(translations[i]);
+            if (rotations)
+                collection.write(rotations[i]);
+            if (scalings)
+                collection.write(scalings[i]);
+        }
+    }
+
     void SceneActionCollectionCreator::allocateRenderable(NodeHandle nodeHandle, RenderableHandle handle)
     {
         collection.beginWriteSceneAction(ESceneActionId::AllocateRenderable);
@@ -237,6 +273,24 @@ namespace ramses::internal
         collection.write(nodeHandle);
     }
 
+    void SceneActionCollectionCreator::allocateNodesBulk(uint32_t count, const NodeHandle* nodes, const uint32_t* childCounts, const NodeHandle* children)
+    {
+        const uint32_t totalChildCount = std::accumulate(childCounts, childCounts + count, 0u);
+        collection.beginWriteSceneAction(ESceneActionId::AllocateNodesBulk);
+        collection.write(count);
+        WriteBulkArray(collection, nodes, count);
+        WriteBulkArray(collection, childCounts, count);
+        WriteBulkArray(collection, children, totalChildCount);
+    }
+
+    void SceneActionCollectionCreator::allocateTransformsBulk(uint32_t count, const TransformHandle* transforms, const NodeHandle* nodes)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::AllocateTransformsBulk);
+        collection.write(count);
+        WriteBulkArray(collection, transforms, count);
+        WriteBulkArray(collection, nodes, count);
+    }
+
     void SceneActionCollectionCreator::addChildToNode(NodeHandle parent, NodeHandle child)
     {
         collection.beginWriteSceneAction(ESceneActionId::AddChildToNode);
@@ -286,6 +340,34 @@ namespace ramses::internal
         collection.write(startVertex);
     }
 
+    void SceneActionCollectionCreator::setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableBoundingSphere);
+        collection.write(renderableHandle);
+        collection.write(boundingSphere);
+    }
+
+    void SceneActionCollectionCreator::setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableInstancePositions);
+        collection.write(renderableHandle);
+        collection.write(instancePositions);
+    }
+
+    void SceneActionCollectionCreator::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableLevelsOfDetail);
+        collection.write(renderableHandle);
+        collection.write(levelsOfDetail.count);
+        for (uint32_t i = 0u; i < levelsOfDetail.count; ++i)
+        {
+            const RenderableLevelOfDetail& level = levelsOfDetail.levels[i];
+            collection.write(level.startIndex);
+            collection.write(level.indexCount);
+            collection.write(level.screenSize);
+        }
+    }
+
     void SceneActionCollectionCreator::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
         collection.beginWriteSceneAction(ESceneActionId::SetRenderableDataInstance);
@@ -538,6 +620,34 @@ namespace ramses::internal
         collection.write(pass);
     }
 
+    void SceneActionCollectionCreator::setRenderPassStateSorting(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassStateSorting);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
+    void SceneActionCollectionCreator::setRenderPassFrontToBackSorting(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassFrontToBackSorting);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
+    void SceneActionCollectionCreator::setRenderPassBackToFrontSorting(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassBackToFrontSorting);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
+    void SceneActionCollectionCreator::setRenderPassDepthPrePass(RenderPassHandle pass, bool enabled)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderPassDepthPrePass);
+        collection.write(pass);
+        collection.write(enabled);
+    }
+
     void SceneActionCollectionCreator::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         collection.beginWriteSceneAction(ESceneActionId::AddRenderGroupToRenderPass);
@@ -656,6 +766,13 @@ namespace ramses::internal
         collection.write(uniformBufferHandle);
     }
 
+    void SceneActionCollectionCreator::setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle handle, int32_t endTimeMs)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetDataInstanceUniformTimeAnimationEnd);
+        collection.write(handle);
+        collection.write(endTimeMs);
+    }
+
     void SceneActionCollectionCreator::allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle)
     {
         collection.beginWriteSceneAction(ESceneActionId::AllocateTextureSampler);
@@ -751,6 +868,13 @@ namespace ramses::internal
         collection.write(data, dataSizeInBytes);
     }
 
+    void SceneActionCollectionCreator::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetDataBufferUsedSize);
+        collection.write(handle);
+        collection.write(usedSizeInBytes);
+    }
+
     void SceneActionCollectionCreator::allocateUniformBuffer(uint32_t size, UniformBufferHandle handle)
     {
         collection.beginWriteSceneAction(ESceneActionId::AllocateUniformBuffer);
@@ -862,6 +986,14 @@ namespace ramses::internal
         collection.write(renderOrder);
     }
 
+    void SceneActionCollectionCreator::setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetSceneReferencePreload);
+        collection.write(handle);
+        collection.write(preloadState);
+        collection.write(preloadPriority);
+    }
+
     void SceneActionCollectionCreator::setRenderPassClearColor(RenderPassHandle handle, const glm::vec4& clearColor)
     {
         collection.beginWriteSceneAction(ESceneActionId::SetRenderPassClearColor);
@@ -62,6 +62,9 @@ namespace ramses::internal
         void setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible);
         void setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount);
         void setRenderableStartVertex(RenderableHandle renderableHandle, uint32_t startVertex);
+        void setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere);
+        void setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions);
+        void setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail);
 
         // Render state allocation
         void allocateRenderState(RenderStateHandle stateHandle);
@@ -91,6 +94,11 @@ namespace ramses::internal
         void allocateTransform(NodeHandle nodeHandle, TransformHandle handle);
         void releaseTransform(TransformHandle transform);
 
+        // allocates multiple nodes and adds their children as one scene action, handle arrays are written as raw memory,
+        // children contains the children of all nodes in order, childCounts[i] of them for nodes[i]
+        void allocateNodesBulk(uint32_t count, const NodeHandle* nodes, const uint32_t* childCounts, const NodeHandle* children);
+        void allocateTransformsBulk(uint32_t count, const TransformHandle* transforms, const NodeHandle* nodes);
+
         // Parent-child relationship
         void addChildToNode(NodeHandle parent, NodeHandle child);
         void removeChildFromNode(NodeHandle parent, NodeHandle child);
@@ -99,6 +107,8 @@ namespace ramses::internal
         void setTranslation(TransformHandle node, const glm::vec3& newValue);
         void setRotation(TransformHandle node, const glm::vec4& newValue, ERotationType rotationType);
         void setScaling(TransformHandle node, const glm::vec3& newValue);
+        // any of the value arrays can be nullptr if that component is not set, rotations are quaternions
+        void setTransformsBulk(uint32_t count, const TransformHandle* transforms, const glm::vec3* translations, const glm::vec4* rotations, const glm::vec3* scalings);
 
         void allocateDataLayout(const DataFieldInfoVector& dataFields, const ResourceContentHash& effectHash, DataLayoutHandle handle);
         void releaseDataLayout(DataLayoutHandle layoutHandle);
@@ -122,6 +132,7 @@ namespace ramses::internal
         void setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle);
         void setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef);
         void setDataUniformBuffer(DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle);
+        void setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs);
 
         // Texture sampler description
         void allocateTextureSampler(const TextureSampler& sampler, TextureSamplerHandle handle);
@@ -146,6 +157,10 @@ namespace ramses::internal
         void setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled);
         void setRenderPassRenderOnce(RenderPassHandle pass, bool enabled);
         void retriggerRenderPassRenderOnce(RenderPassHandle pass);
+        void setRenderPassStateSorting(RenderPassHandle pass, bool enabled);
+        void setRenderPassFrontToBackSorting(RenderPassHandle pass, bool enabled);
+        void setRenderPassBackToFrontSorting(RenderPassHandle pass, bool enabled);
+        void setRenderPassDepthPrePass(RenderPassHandle pass, bool enabled);
         void addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order);
         void removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle);
 
@@ -177,6 +192,7 @@ namespace ramses::internal
         void allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle);
         void releaseDataBuffer(DataBufferHandle handle);
         void updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data);
+        void setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes);
 
         // Uniform buffers
         void allocateUniformBuffer(uint32_t size, UniformBufferHandle handle);
@@ -197,6 +213,7 @@ namespace ramses::internal
         void requestSceneReferenceState(SceneReferenceHandle handle, RendererSceneState state);
         void requestSceneReferenceFlushNotifications(SceneReferenceHandle handle, bool enable);
         void setSceneReferenceRenderOrder(SceneReferenceHandle handle, int32_t renderOrder);
+        void setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority);
 
         // compound actions
         void compoundRenderableData(RenderableHandle renderableHandle
@@ -0,0 +1,335 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionDeltaEncoder.h"
+#include "internal/SceneGraph/SceneAPI/ERotationType.h"
+#include "internal/Core/Common/MemoryHandle.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // Encoded action layout:
+        //   uint8 original type, uint8 flags, header of original action (object handle, for data setters also data field and element count),
+        //   changed mask (one bit per 32 bit word), descriptor per changed word (4 bits: trailing zero bytes and number
+        //   of significant bytes - 1), significant bytes of changed words XORed with reference value, trailer of original action
+        struct SetterLayout
+        {
+            uint32_t headerSize = 0u;
+            uint32_t trailerSize = 0u;
+            uint32_t wordsPerElement = 0u;
+            bool isTransform = false;
+        };
+
+        constexpr uint32_t DataSetterHeaderSize = 3u * sizeof(uint32_t);
+        constexpr uint8_t KeyframeFlag = 1u;
+
+        static_assert(NumOfSceneActionTypes <= 0xFFu, "scene action type does not fit into encoded action");
+        constexpr uint32_t MaxDataFieldForKey = 0xFFFFFFu;
+
+        bool GetSetterLayout(ESceneActionId type, SetterLayout& layout)
+        {
+            switch (type)
+            {
+            case ESceneActionId::SetTranslation:
+            case ESceneActionId::SetScaling:
+                layout = { sizeof(MemoryHandle), 0u, 3u, true };
+                return true;
+            case ESceneActionId::SetRotation:
+                layout = { sizeof(MemoryHandle), sizeof(ERotationType), 4u, true };
+                return true;
+            case ESceneActionId::SetDataFloatArray:
+            case ESceneActionId::SetDataIntegerArray:
+                layout = { DataSetterHeaderSize, 0u, 1u, false };
+                return true;
+            case ESceneActionId::SetDataVector2fArray:
+            case ESceneActionId::SetDataVector2iArray:
+                layout = { DataSetterHeaderSize, 0u, 2u, false };
+                return true;
+            case ESceneActionId::SetDataVector3fArray:
+            case ESceneActionId::SetDataVector3iArray:
+                layout = { DataSetterHeaderSize, 0u, 3u, false };
+                return true;
+            case ESceneActionId::SetDataVector4fArray:
+            case ESceneActionId::SetDataVector4iArray:
+            case ESceneActionId::SetDataMatrix22fArray:
+                layout = { DataSetterHeaderSize, 0u, 4u, false };
+                return true;
+            case ESceneActionId::SetDataMatrix33fArray:
+                layout = { DataSetterHeaderSize, 0u, 9u, false };
+                return true;
+            case ESceneActionId::SetDataMatrix44fArray:
+                layout = { DataSetterHeaderSize, 0u, 16u, false };
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        uint32_t ReadUInt32(const std::byte* data)
+        {
+            uint32_t value = 0u;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        uint64_t GetWordCount(const SetterLayout& layout, const std::byte* header)
+        {
+            if (layout.isTransform)
+                return layout.wordsPerElement;
+            return uint64_t{ ReadUInt32(header + 2u * sizeof(uint32_t)) } * layout.wordsPerElement;
+        }
+
+        // type is stored in lowest byte, data field in the following 3 bytes and object handle in upper half
+        bool MakeKey(ESceneActionId type, const SetterLayout& layout, const std::byte* header, uint64_t& key)
+        {
+            const MemoryHandle object = ReadUInt32(header);
+            const MemoryHandle field = layout.isTransform ? 0u : ReadUInt32(header + sizeof(uint32_t));
+            if (field > MaxDataFieldForKey)
+                return false;
+            key = (uint64_t{ object } << 32u) | (uint64_t{ field } << 8u) | static_cast<uint64_t>(type);
+            return true;
+        }
+
+        uint32_t QuantizeFloatBits(uint32_t bits, uint32_t droppedBits)
+        {
+            // infinity and NaN are kept as they are, rounding must not turn large values into infinity
+            constexpr uint32_t ExponentMask = 0x7F800000u;
+            const uint32_t dropMask = (1u << droppedBits) - 1u;
+            if ((bits & ExponentMask) == ExponentMask)
+                return bits;
+            const uint32_t rounded = bits + (1u << (droppedBits - 1u));
+            if ((rounded & ExponentMask) == ExponentMask)
+                return bits & ~dropMask;
+            return rounded & ~dropMask;
+        }
+
+        void CopyAction(const SceneActionCollection::SceneActionReader& action, SceneActionCollection& target)
+        {
+            target.addRawSceneActionInformation(action.type(), static_cast<uint32_t>(target.collectionData().size()));
+            target.appendRawData(action.data(), action.size());
+        }
+    }
+
+    SceneActionDeltaEncoder::SceneActionDeltaEncoder(uint32_t transformQuantizationBits)
+        : m_transformQuantizationBits(std::min(transformQuantizationBits, MaxTransformQuantizationBits))
+    {
+    }
+
+    bool SceneActionDeltaEncoder::encode(const SceneActionCollection& actions, SceneActionCollection& encodedActions)
+    {
+        encodedActions.clear();
+
+        SetterLayout layout;
+        const bool hasSetter = std::any_of(actions.begin(), actions.end(), [&](const auto& action) { return GetSetterLayout(action.type(), layout); });
+        if (!hasSetter)
+            return false;
+
+        encodedActions.reserveAdditionalCapacity(actions.collectionData().size(), actions.numberOfActions());
+        for (const auto& action : actions)
+        {
+            const ESceneActionId type = action.type();
+            const std::byte* data = action.data();
+            uint64_t key = 0u;
+            if (!GetSetterLayout(type, layout) || action.size() < layout.headerSize + layout.trailerSize || !MakeKey(type, layout, data, key))
+            {
+                CopyAction(action, encodedActions);
+                continue;
+            }
+
+            const uint64_t numWords = GetWordCount(layout, data);
+            if (action.size() != layout.headerSize + numWords * sizeof(uint32_t) + layout.trailerSize)
+            {
+                CopyAction(action, encodedActions);
+                continue;
+            }
+
+            m_words.resize(numWords);
+            std::memcpy(m_words.data(), data + layout.headerSize, numWords * sizeof(uint32_t));
+            if (layout.isTransform && m_transformQuantizationBits > 0u)
+            {
+                for (auto& word : m_words)
+                    word = QuantizeFloatBits(word, m_transformQuantizationBits);
+            }
+
+            // setter without reference value of same size (e.g. first one or data array with different element count) is a keyframe
+            std::vector<uint32_t>* reference = m_referenceValues.get(key);
+            const bool keyframe = (reference == nullptr || reference->size() != numWords);
+            if (keyframe)
+            {
+                reference = &m_referenceValues[key];
+                reference->assign(numWords, 0u);
+            }
+
+            std::vector<uint8_t> changedMask((numWords + 7u) / 8u, 0u);
+            uint32_t numChanged = 0u;
+            for (size_t i = 0u; i < numWords; ++i)
+            {
+                const uint32_t value = m_words[i];
+                m_words[i] = value ^ (*reference)[i];
+                (*reference)[i] = value;
+                if (m_words[i] != 0u)
+                {
+                    changedMask[i / 8u] |= static_cast<uint8_t>(1u << (i % 8u));
+                    ++numChanged;
+                }
+            }
+
+            encodedActions.beginWriteSceneAction(ESceneActionId::SetValueDeltaEncoded);
+            encodedActions.write(static_cast<uint8_t>(type));
+            encodedActions.write(keyframe ? KeyframeFlag : uint8_t{ 0u });
+            encodedActions.appendRawData(data, layout.headerSize);
+            encodedActions.appendRawData(reinterpret_cast<const std::byte*>(changedMask.data()), changedMask.size());
+
+            // descriptors of two words share a byte, followed by significant bytes of all changed words
+            const size_t descriptorsOffset = encodedActions.collectionData().size();
+            std::vector<std::byte>& rawData = encodedActions.getRawDataForDirectWriting();
+            rawData.resize(descriptorsOffset + (numChanged + 1u) / 2u, std::byte{ 0u });
+            uint32_t changedIdx = 0u;
+            for (const uint32_t delta : m_words)
+            {
+                if (delta == 0u)
+                    continue;
+
+                uint32_t trailingZeroBytes = 0u;
+                while (((delta >> (8u * trailingZeroBytes)) & 0xFFu) == 0u)
+                    ++trailingZeroBytes;
+                uint32_t leadingZeroBytes = 0u;
+                while (((delta >> (8u * (3u - leadingZeroBytes))) & 0xFFu) == 0u)
+                    ++leadingZeroBytes;
+                const uint32_t significantBytes = 4u - trailingZeroBytes - leadingZeroBytes;
+
+                const auto descriptor = static_cast<uint8_t>((trailingZeroBytes << 2u) | (significantBytes - 1u));
+                rawData[descriptorsOffset + changedIdx / 2u] |= std::byte{ static_cast<uint8_t>(descriptor << (4u * (changedIdx % 2u))) };
+                for (uint32_t b = 0u; b < significantBytes; ++b)
+                    rawData.push_back(std::byte{ static_cast<uint8_t>(delta >> (8u * (trailingZeroBytes + b))) });
+                ++changedIdx;
+            }
+
+            encodedActions.appendRawData(data + layout.headerSize + numWords * sizeof(uint32_t), layout.trailerSize);
+        }
+
+        return true;
+    }
+
+    void SceneActionDeltaEncoder::reset()
+    {
+        m_referenceValues.clear();
+    }
+
+    bool SceneActionDeltaDecoder::decode(SceneActionCollection& actions)
+    {
+        const bool hasEncodedAction = std::any_of(actions.begin(), actions.end(), [](const auto& action) { return action.type() == ESceneActionId::SetValueDeltaEncoded; });
+        if (!hasEncodedAction)
+            return true;
+
+        SceneActionCollection decodedActions(actions.collectionData().size() * 2u, actions.numberOfActions());
+        bool valid = true;
+        for (const auto& action : actions)
+        {
+            if (action.type() != ESceneActionId::SetValueDeltaEncoded)
+            {
+                CopyAction(action, decodedActions);
+                continue;
+            }
+
+            // received from network, every size is checked before reading
+            const std::byte* data = action.data();
+            const std::byte* const dataEnd = data + action.size();
+            SetterLayout layout;
+            const auto remaining = [&]() { return static_cast<size_t>(dataEnd - data); };
+            if (remaining() < 2u || !GetSetterLayout(static_cast<ESceneActionId>(std::to_integer<uint8_t>(data[0])), layout) || remaining() < 2u + layout.headerSize + layout.trailerSize)
+            {
+                valid = false;
+                continue;
+            }
+            const auto type = static_cast<ESceneActionId>(std::to_integer<uint8_t>(data[0]));
+            const bool keyframe = (std::to_integer<uint8_t>(data[1]) & KeyframeFlag) != 0u;
+            data += 2u;
+            const std::byte* header = data;
+            data += layout.headerSize;
+
+            uint64_t key = 0u;
+            const uint64_t numWords = GetWordCount(layout, header);
+            const size_t maskSize = (numWords + 7u) / 8u;
+            if (!MakeKey(type, layout, header, key) || numWords > remaining() * 8u)
+            {
+                valid = false;
+                continue;
+            }
+            const std::byte* const changedMask = data;
+            data += maskSize;
+
+            std::vector<uint32_t>* reference = m_referenceValues.get(key);
+            if (keyframe)
+            {
+                reference = &m_referenceValues[key];
+                reference->assign(numWords, 0u);
+            }
+            else if (reference == nullptr || reference->size() != numWords)
+            {
+                valid = false;
+                continue;
+            }
+
+            size_t numChanged = 0u;
+            for (size_t i = 0u; i < numWords; ++i)
+            {
+                if ((std::to_integer<uint8_t>(changedMask[i / 8u]) >> (i % 8u)) & 1u)
+                    ++numChanged;
+            }
+            const std::byte* const descriptors = data;
+            if (remaining() < (numChanged + 1u) / 2u)
+            {
+                valid = false;
+                continue;
+            }
+            data += (numChanged + 1u) / 2u;
+
+            // reference is updated word by word, a truncated action leaves it partially updated which is reported as error anyway
+            bool actionValid = true;
+            size_t changedIdx = 0u;
+            for (size_t i = 0u; i < numWords && actionValid; ++i)
+            {
+                if (((std::to_integer<uint8_t>(changedMask[i / 8u]) >> (i % 8u)) & 1u) == 0u)
+                    continue;
+
+                const uint8_t descriptor = (std::to_integer<uint8_t>(descriptors[changedIdx / 2u]) >> (4u * (changedIdx % 2u))) & 0xFu;
+                const uint32_t trailingZeroBytes = descriptor >> 2u;
+                const uint32_t significantBytes = (descriptor & 3u) + 1u;
+                if (trailingZeroBytes + significantBytes > 4u || remaining() < significantBytes + layout.trailerSize)
+                {
+                    actionValid = false;
+                    break;
+                }
+                uint32_t delta = 0u;
+                for (uint32_t b = 0u; b < significantBytes; ++b)
+                    delta |= uint32_t{ std::to_integer<uint8_t>(data[b]) } << (8u * (trailingZeroBytes + b));
+                data += significantBytes;
+                (*reference)[i] ^= delta;
+                ++changedIdx;
+            }
+            if (!actionValid || remaining() != layout.trailerSize)
+            {
+                valid = false;
+                continue;
+            }
+
+            decodedActions.addRawSceneActionInformation(type, static_cast<uint32_t>(decodedActions.collectionData().size()));
+            decodedActions.appendRawData(header, layout.headerSize);
+            decodedActions.appendRawData(reinterpret_cast<const std::byte*>(reference->data()), reference->size() * sizeof(uint32_t));
+            decodedActions.appendRawData(data, layout.trailerSize);
+        }
+
+        actions.swap(decodedActions);
+        return valid;
+    }
+}
@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    // Compact encoding of transformation and 32 bit data value setters for network transport, e.g. for animations changing only
+    // few components of a matrix in every flush. A setter is replaced by ESceneActionId::SetValueDeltaEncoded which contains only
+    // the 32 bit words which differ from the value of the previous encoded setter on same object (and data field), XORed with it
+    // and stripped of their leading and trailing zero bytes.
+    //
+    // The reference values are not taken from the scene but from the previously encoded setters. Sender and receiver therefore
+    // have to see the same sequence of encoded actions since last keyframe, a setter without reference value is encoded
+    // against zero (keyframe). The sender has to be reset whenever a receiver might have missed encoded actions, e.g. when
+    // a new subscriber joins or actions are not sent at all.
+    class SceneActionDeltaEncoder
+    {
+    public:
+        // transform values (translation, rotation, scaling) are rounded to drop given number of least significant mantissa bits,
+        // this is lossy but makes changed values shorter
+        explicit SceneActionDeltaEncoder(uint32_t transformQuantizationBits = 0u);
+
+        // writes actions to encodedActions with all supported setters delta encoded,
+        // returns false and leaves encodedActions empty if there is no setter to encode
+        bool encode(const SceneActionCollection& actions, SceneActionCollection& encodedActions);
+
+        // next setter of every object is encoded as keyframe
+        void reset();
+
+        static constexpr uint32_t MaxTransformQuantizationBits = 16u;
+
+    private:
+        HashMap<uint64_t, std::vector<uint32_t>> m_referenceValues;
+        const uint32_t m_transformQuantizationBits;
+        std::vector<uint32_t> m_words;
+    };
+
+    // Restores original setters from actions encoded by SceneActionDeltaEncoder, a decoder is needed per sender and scene
+    // and has to get all actions of the scene in same order as they were encoded
+    class SceneActionDeltaDecoder
+    {
+    public:
+        // replaces encoded actions by original setters, returns false if an encoded action was invalid or had no reference value
+        bool decode(SceneActionCollection& actions);
+
+    private:
+        HashMap<uint64_t, std::vector<uint32_t>> m_referenceValues;
+    };
+}
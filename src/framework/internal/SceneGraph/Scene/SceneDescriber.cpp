@@ -20,7 +20,7 @@
 namespace ramses::internal
 {
     template <typename T>
-    void SceneDescriber::describeScene(const T& source, SceneActionCollectionCreator& collector)
+    void SceneDescriber::describeScene(const T& source, SceneActionCollectionCreator& collector, bool useBulkActions)
     {
         // 25% more than node+transform+renderable count
         const size_t numberOfSceneActionsEstimate =
@@ -29,9 +29,18 @@ namespace ramses::internal
         const size_t sizeOfSceneActionsEstimate = 30u * numberOfSceneActionsEstimate;
         collector.collection.reserveAdditionalCapacity(sizeOfSceneActionsEstimate, numberOfSceneActionsEstimate);
 
-        RecreateNodes(                   source, collector);
-        RecreateTransformNodes(          source, collector);
-        RecreateTransformations(         source, collector);
+        if (useBulkActions)
+        {
+            RecreateNodesBulk(               source, collector);
+            RecreateTransformNodesBulk(      source, collector);
+            RecreateTransformationsBulk(     source, collector);
+        }
+        else
+        {
+            RecreateNodes(                   source, collector);
+            RecreateTransformNodes(          source, collector);
+            RecreateTransformations(         source, collector);
+        }
         RecreateDataLayouts(             source, collector);
         RecreateDataInstances(           source, collector);
         RecreateRenderables(             source, collector);
@@ -126,6 +135,100 @@ namespace ramses::internal
         }
     }
 
+    void SceneDescriber::RecreateNodesBulk(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        const uint32_t totalNodeCount = source.getNodeCount();
+        std::vector<NodeHandle> nodes;
+        std::vector<uint32_t> childCounts;
+        std::vector<NodeHandle> children;
+        nodes.reserve(totalNodeCount);
+        childCounts.reserve(totalNodeCount);
+        children.reserve(totalNodeCount);
+        for (NodeHandle n(0u); n < totalNodeCount; ++n)
+        {
+            if (source.isNodeAllocated(n))
+            {
+                const uint32_t childCount = source.getChildCount(n);
+                nodes.push_back(n);
+                childCounts.push_back(childCount);
+                for (uint32_t child = 0; child < childCount; ++child)
+                    children.push_back(source.getChild(n, child));
+            }
+        }
+        if (!nodes.empty())
+            collector.allocateNodesBulk(static_cast<uint32_t>(nodes.size()), nodes.data(), childCounts.data(), children.data());
+    }
+
+    void SceneDescriber::RecreateTransformNodesBulk(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        const uint32_t totalTransformCount = source.getTransformCount();
+        std::vector<TransformHandle> transforms;
+        std::vector<NodeHandle> nodes;
+        transforms.reserve(totalTransformCount);
+        nodes.reserve(totalTransformCount);
+        for (TransformHandle t(0u); t < totalTransformCount; ++t)
+        {
+            if (source.isTransformAllocated(t))
+            {
+                transforms.push_back(t);
+                nodes.push_back(source.getTransformNode(t));
+            }
+        }
+        if (!transforms.empty())
+            collector.allocateTransformsBulk(static_cast<uint32_t>(transforms.size()), transforms.data(), nodes.data());
+    }
+
+    void SceneDescriber::RecreateTransformationsBulk(const IScene& source, SceneActionCollectionCreator& collector)
+    {
+        // components are collected separately to send only the non identity ones, same as single setters
+        const uint32_t totalTransformCount = source.getTransformCount();
+        std::vector<TransformHandle> translated;
+        std::vector<glm::vec3> translations;
+        std::vector<TransformHandle> rotated;
+        std::vector<glm::vec4> rotations;
+        std::vector<TransformHandle> scaled;
+        std::vector<glm::vec3> scalings;
+        for (TransformHandle t(0u); t < totalTransformCount; ++t)
+        {
+            if (source.isTransformAllocated(t))
+            {
+                const auto& translation = source.getTranslation(t);
+                if (translation != IScene::IdentityTranslation)
+                {
+                    translated.push_back(t);
+                    translations.push_back(translation);
+                }
+                const auto& rotation = source.getRotation(t);
+                if (rotation != IScene::IdentityRotation)
+                {
+                    // bulk action carries quaternions only
+                    const auto rotationType = source.getRotationType(t);
+                    if (rotationType == ERotationType::Quaternion)
+                    {
+                        rotated.push_back(t);
+                        rotations.push_back(rotation);
+                    }
+                    else
+                    {
+                        collector.setRotation(t, rotation, rotationType);
+                    }
+                }
+                const auto& scaling = source.getScaling(t);
+                if (scaling != IScene::IdentityScaling)
+                {
+                    scaled.push_back(t);
+                    scalings.push_back(scaling);
+                }
+            }
+        }
+        if (!translated.empty())
+            collector.setTransformsBulk(static_cast<uint32_t>(translated.size()), translated.data(), translations.data(), nullptr, nullptr);
+        if (!rotated.empty())
+            collector.setTransformsBulk(static_cast<uint32_t>(rotated.size()), rotated.data(), nullptr, rotations.data(), nullptr);
+        if (!scaled.empty())
+            collector.setTransformsBulk(static_cast<uint32_t>(scaled.size()), scaled.data(), nullptr, nullptr, scalings.data());
+    }
+
     void SceneDescriber::RecreateRenderables(const IScene& source, SceneActionCollectionCreator& collector)
     {
         const uint32_t totalRenderableCount = source.getRenderableCount();
@@ -133,7 +236,14 @@ namespace ramses::internal
         {
             if (source.isRenderableAllocated(r))
             {
-                collector.compoundRenderable(r, source.getRenderable(r));
+                const Renderable& renderable = source.getRenderable(r);
+                collector.compoundRenderable(r, renderable);
+                if (renderable.boundingSphere.w >= 0.f)
+                    collector.setRenderableBoundingSphere(r, renderable.boundingSphere);
+                if (renderable.instancePositions.isValid())
+                    collector.setRenderableInstancePositions(r, renderable.instancePositions);
+                if (renderable.levelsOfDetail.count > 0u)
+                    collector.setRenderableLevelsOfDetail(r, renderable.levelsOfDetail);
             }
         }
     }
@@ -194,6 +304,10 @@ namespace ramses::internal
                 const DataLayoutHandle layoutHandle = source.getLayoutOfDataInstance(i);
                 collector.allocateDataInstance(layoutHandle, i);
 
+                const int32_t uniformTimeAnimationEnd = source.getDataInstanceUniformTimeAnimationEnd(i);
+                if (uniformTimeAnimationEnd != DataInstance::UnboundedUniformTimeAnimationEnd)
+                    collector.setDataInstanceUniformTimeAnimationEnd(i, uniformTimeAnimationEnd);
+
                 const DataLayout& layout = source.getDataLayout(layoutHandle);
                 for (DataFieldHandle f(0u); f < layout.getFieldCount(); ++f)
                 {
@@ -390,6 +504,14 @@ namespace ramses::internal
                 collector.setRenderPassEnabled(renderPass, rp.isEnabled);
                 if (rp.isRenderOnce)
                     collector.setRenderPassRenderOnce(renderPass, true);
+                if (rp.isStateSorted)
+                    collector.setRenderPassStateSorting(renderPass, true);
+                if (rp.isFrontToBackSorted)
+                    collector.setRenderPassFrontToBackSorting(renderPass, true);
+                if (rp.isBackToFrontSorted)
+                    collector.setRenderPassBackToFrontSorting(renderPass, true);
+                if (rp.hasDepthPrePass)
+                    collector.setRenderPassDepthPrePass(renderPass, true);
                 for (const auto& rgEntry : rp.renderGroups)
                     collector.addRenderGroupToRenderPass(renderPass, rgEntry.renderGroup, rgEntry.order);
             }
@@ -592,10 +714,12 @@ namespace ramses::internal
                 collector.requestSceneReferenceState(handle, sr.requestedState);
                 collector.requestSceneReferenceFlushNotifications(handle, sr.flushNotifications);
                 collector.setSceneReferenceRenderOrder(handle, sr.renderOrder);
+                if (sr.preloadState != RendererSceneState::Available || sr.preloadPriority != 0)
+                    collector.setSceneReferencePreload(handle, sr.preloadState, sr.preloadPriority);
             }
         }
     }
 
-    template void SceneDescriber::describeScene<IScene>(const IScene& source, SceneActionCollectionCreator& collector);
-    template void SceneDescriber::describeScene<ClientScene>(const ClientScene& source, SceneActionCollectionCreator& collector);
+    template void SceneDescriber::describeScene<IScene>(const IScene& source, SceneActionCollectionCreator& collector, bool useBulkActions);
+    template void SceneDescriber::describeScene<ClientScene>(const ClientScene& source, SceneActionCollectionCreator& collector, bool useBulkActions);
 }
@@ -21,11 +21,16 @@ namespace ramses::internal
     class SceneDescriber
     {
     public:
+        // with useBulkActions nodes, transforms and their values are described by few bulk scene actions instead of
+        // several actions per object, this is meant for scene snapshots sent to new subscribers and not for scene files
         template <typename T>
-        static void describeScene(const T& source, SceneActionCollectionCreator& collector);
+        static void describeScene(const T& source, SceneActionCollectionCreator& collector, bool useBulkActions = false);
 
     private:
         static void RecreateNodes(const IScene& source, SceneActionCollectionCreator& collector);
+        static void RecreateNodesBulk(const IScene& source, SceneActionCollectionCreator& collector);
+        static void RecreateTransformNodesBulk(const IScene& source, SceneActionCollectionCreator& collector);
+        static void RecreateTransformationsBulk(const IScene& source, SceneActionCollectionCreator& collector);
         static void RecreateCameras(const IScene& source, SceneActionCollectionCreator& collector);
         static void RecreateTransformNodes(const IScene& source, SceneActionCollectionCreator& collector);
         static void RecreateTransformations(const IScene& source, SceneActionCollectionCreator& collector);
@@ -0,0 +1,140 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+#include "fmt/format.h"
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct ContentMemory
+        {
+            size_t used = 0u;
+            size_t capacity = 0u;
+        };
+
+        template <typename POOL, typename CONTENT_FUNC>
+        SceneMemoryProfileEntry GetPoolMemory(std::string_view namePrefix, std::string_view name, const POOL& pool, CONTENT_FUNC&& contentMemory)
+        {
+            constexpr size_t objectSize = sizeof(typename POOL::object_type);
+
+            SceneMemoryProfileEntry entry;
+            entry.name = fmt::format("{}{}", namePrefix, name);
+            entry.capacityCount = pool.getTotalCount();
+            entry.capacityBytes = entry.capacityCount * objectSize;
+            for (const auto& it : pool)
+            {
+                const ContentMemory content = contentMemory(*it.second);
+                ++entry.usedCount;
+                entry.usedBytes += objectSize + content.used;
+                entry.capacityBytes += content.capacity;
+            }
+
+            return entry;
+        }
+
+        template <typename POOL>
+        SceneMemoryProfileEntry GetPoolMemory(std::string_view namePrefix, std::string_view name, const POOL& pool)
+        {
+            return GetPoolMemory(namePrefix, name, pool, [](const auto& /*unused*/) { return ContentMemory{}; });
+        }
+
+        template <typename T>
+        ContentMemory GetVectorMemory(const std::vector<T>& vec)
+        {
+            return { vec.size() * sizeof(T), vec.capacity() * sizeof(T) };
+        }
+    }
+
+    namespace SceneMemoryProfileUtils
+    {
+        template <template<typename, typename> class MEMORYPOOL>
+        void AddScenePools(const SceneT<MEMORYPOOL>& scene, std::string_view namePrefix, SceneMemoryProfile& profile)
+        {
+            profile.push_back(GetPoolMemory(namePrefix, "Cameras", scene.getCameras()));
+            profile.push_back(GetPoolMemory(namePrefix, "Renderables", scene.getRenderables()));
+            profile.push_back(GetPoolMemory(namePrefix, "RenderStates", scene.getRenderStates()));
+            profile.push_back(GetPoolMemory(namePrefix, "Transforms", scene.getTransforms()));
+            profile.push_back(GetPoolMemory(namePrefix, "BlitPasses", scene.getBlitPasses()));
+            profile.push_back(GetPoolMemory(namePrefix, "PickableObjects", scene.getPickableObjects()));
+            profile.push_back(GetPoolMemory(namePrefix, "RenderBuffers", scene.getRenderBuffers()));
+            profile.push_back(GetPoolMemory(namePrefix, "TextureSamplers", scene.getTextureSamplers()));
+            profile.push_back(GetPoolMemory(namePrefix, "DataSlots", scene.getDataSlots()));
+            profile.push_back(GetPoolMemory(namePrefix, "SceneReferences", scene.getSceneReferences()));
+
+            profile.push_back(GetPoolMemory(namePrefix, "Nodes", scene.getNodes(), [](const TopologyNode& node) {
+                return GetVectorMemory(node.children);
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "RenderGroups", scene.getRenderGroups(), [](const RenderGroup& group) {
+                const auto renderables = GetVectorMemory(group.renderables);
+                const auto renderGroups = GetVectorMemory(group.renderGroups);
+                return ContentMemory{ renderables.used + renderGroups.used, renderables.capacity + renderGroups.capacity };
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "RenderPasses", scene.getRenderPasses(), [](const RenderPass& pass) {
+                return GetVectorMemory(pass.renderGroups);
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "RenderTargets", scene.getRenderTargets(), [](const RenderTarget& target) {
+                return GetVectorMemory(target.renderBuffers);
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "TextureBuffers", scene.getTextureBuffers(), [](const TextureBuffer& buffer) {
+                ContentMemory memory = GetVectorMemory(buffer.mipMaps);
+                for (const auto& mip : buffer.mipMaps)
+                {
+                    memory.used += mip.data.size();
+                    memory.capacity += mip.data.capacity();
+                }
+                return memory;
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "DataBuffers", scene.getDataBuffers(), [](const GeometryDataBuffer& buffer) {
+                return GetVectorMemory(buffer.data);
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "UniformBuffers", scene.getUniformBuffers(), [](const UniformBuffer& buffer) {
+                return GetVectorMemory(buffer.data);
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "DataLayouts", scene.getDataLayouts(), [](const DataLayout& layout) {
+                const size_t fieldsSize = layout.getFieldCount() * (sizeof(DataFieldInfo) + sizeof(uint32_t));
+                return ContentMemory{ fieldsSize, fieldsSize };
+            }));
+            profile.push_back(GetPoolMemory(namePrefix, "DataInstances", scene.getDataInstances(), [&scene](const DataInstance& instance) {
+                const size_t dataSize = scene.getDataLayout(instance.getLayoutHandle()).getTotalSize();
+                return ContentMemory{ dataSize, dataSize };
+            }));
+        }
+
+        void AddSceneActions(const SceneActionCollection& actions, std::string_view name, SceneMemoryProfile& profile)
+        {
+            SceneMemoryProfileEntry entry;
+            entry.name = std::string{ name };
+            entry.usedCount = actions.numberOfActions();
+            entry.capacityCount = entry.usedCount;
+            entry.usedBytes = actions.getUsedMemorySize();
+            entry.capacityBytes = actions.getReservedMemorySize();
+            profile.push_back(std::move(entry));
+        }
+
+        SceneMemoryProfileEntry GetTotal(const SceneMemoryProfile& profile)
+        {
+            SceneMemoryProfileEntry total;
+            total.name = "Total";
+            for (const auto& entry : profile)
+            {
+                total.usedCount += entry.usedCount;
+                total.capacityCount += entry.capacityCount;
+                total.usedBytes += entry.usedBytes;
+                total.capacityBytes += entry.capacityBytes;
+            }
+            return total;
+        }
+
+        template void AddScenePools<MemoryPool>(const SceneT<MemoryPool>& scene, std::string_view namePrefix, SceneMemoryProfile& profile);
+        template void AddScenePools<MemoryPoolExplicit>(const SceneT<MemoryPoolExplicit>& scene, std::string_view namePrefix, SceneMemoryProfile& profile);
+    }
+}
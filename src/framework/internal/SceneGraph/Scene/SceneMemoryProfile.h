@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+
+namespace ramses::internal
+{
+    template <template<typename, typename> class MEMORYPOOL>
+    class SceneT;
+    class SceneActionCollection;
+
+    // memory held by one part of a scene, capacity is what is reserved including the used part,
+    // a capacity much bigger than used memory points to over-preallocation, a used memory growing over time to a leak
+    struct SceneMemoryProfileEntry
+    {
+        std::string name;
+        size_t usedCount = 0u;
+        size_t capacityCount = 0u;
+        size_t usedBytes = 0u;
+        size_t capacityBytes = 0u;
+    };
+    using SceneMemoryProfile = std::vector<SceneMemoryProfileEntry>;
+
+    namespace SceneMemoryProfileUtils
+    {
+        // one entry per object pool of the scene, object memory plus memory of their dynamic content (children, data, ...)
+        template <template<typename, typename> class MEMORYPOOL>
+        void AddScenePools(const SceneT<MEMORYPOOL>& scene, std::string_view namePrefix, SceneMemoryProfile& profile);
+
+        void AddSceneActions(const SceneActionCollection& actions, std::string_view name, SceneMemoryProfile& profile);
+
+        [[nodiscard]] SceneMemoryProfileEntry GetTotal(const SceneMemoryProfile& profile);
+    }
+}
@@ -9,9 +9,11 @@
 #pragma once
 
 #include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/SceneGraph/SceneAPI/SceneSizeInformation.h"
 #include "ramses/framework/RamsesFrameworkTypes.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -33,9 +35,14 @@ namespace ramses::internal
         [[nodiscard]] bool hasMapping(TypedMemoryHandle<T> handle) const;
         [[nodiscard]] bool hasMapping(sceneObjectId_t handle) const;
 
+        // reserves mapping tables for handles of merged scene with given size, avoids growing them during merge
+        void reserve(const SceneSizeInformation& sizeInfo);
+
     private:
+        // handles of merged scene are dense (same as their memory pool indices), so they are mapped by flat tables
+        // indexed by handle, unmapped entries hold invalid handle
         template<typename T>
-        using container_ll_t = std::unordered_map<TypedMemoryHandle<T>, TypedMemoryHandle<T>>;
+        using container_ll_t = std::vector<TypedMemoryHandle<T>>;
 
         template<typename T>
         using container_hl_t = std::unordered_map<T, T>;
@@ -75,8 +82,11 @@ namespace ramses::internal
         assert(handle.isValid());
         assert(newHandle.isValid());
         auto& mapping = getMapping<T>();
-        assert(mapping.count(handle) == 0);
-        mapping[handle] = newHandle;
+        const auto index = handle.asMemoryHandle();
+        if (index >= mapping.size())
+            mapping.resize(index + 1u, TypedMemoryHandle<T>::Invalid());
+        assert(!mapping[index].isValid());
+        mapping[index] = newHandle;
     }
 
     inline void SceneMergeHandleMapping::addMapping(sceneObjectId_t handle, sceneObjectId_t newHandle)
@@ -92,10 +102,10 @@ namespace ramses::internal
     {
         assert(handle.isValid());
         const auto& mapping = getMapping<T>();
-        auto findIt = mapping.find(handle);
-        if (findIt != mapping.end())
+        const auto index = handle.asMemoryHandle();
+        if (index < mapping.size())
         {
-            return findIt->second;
+            return mapping[index];
         }
         return TypedMemoryHandle<T>::Invalid();
     }
@@ -119,7 +129,7 @@ namespace ramses::internal
             return false;
         }
 
-        return getMapping<T>().count(handle) > 0u;
+        return getMapping(handle).isValid();
     }
 
     inline bool SceneMergeHandleMapping::hasMapping(sceneObjectId_t handle) const
@@ -132,6 +142,29 @@ namespace ramses::internal
         return m_sceneObjectIdMapping.count(handle) > 0u;
     }
 
+    inline void SceneMergeHandleMapping::reserve(const SceneSizeInformation& sizeInfo)
+    {
+        m_nodeHandleMapping.reserve(sizeInfo.nodeCount);
+        m_transformHandleMapping.reserve(sizeInfo.transformCount);
+        m_renderableHandleMapping.reserve(sizeInfo.renderableCount);
+        m_dataInstanceHandleMapping.reserve(sizeInfo.datainstanceCount);
+        m_textureSamplerHandleMapping.reserve(sizeInfo.textureSamplerCount);
+        m_renderBufferHandleMapping.reserve(sizeInfo.renderBufferCount);
+        m_dataSlotHandleMapping.reserve(sizeInfo.dataSlotCount);
+        m_renderGroupHandleMapping.reserve(sizeInfo.renderGroupCount);
+        m_stateHandleMapping.reserve(sizeInfo.renderStateCount);
+        m_cameraHandleMapping.reserve(sizeInfo.cameraCount);
+        m_renderPassHandleMapping.reserve(sizeInfo.renderPassCount);
+        m_blitPassHandleMapping.reserve(sizeInfo.blitPassCount);
+        m_pickableObjectHandleMapping.reserve(sizeInfo.pickableObjectCount);
+        m_renderTargetHandleMapping.reserve(sizeInfo.renderTargetCount);
+        m_dataBufferHandleMapping.reserve(sizeInfo.dataBufferCount);
+        m_textureBufferHandleMapping.reserve(sizeInfo.textureBufferCount);
+        m_sceneReferenceHandleMapping.reserve(sizeInfo.sceneReferenceCount);
+        m_dataLayoutHandleMapping.reserve(sizeInfo.datalayoutCount);
+        m_uniformBufferHandleMapping.reserve(sizeInfo.uniformBufferCount);
+    }
+
     template<typename T>
     inline const SceneMergeHandleMapping::container_ll_t<T>& SceneMergeHandleMapping::getMapping() const
     {
@@ -9,7 +9,9 @@
 #include "internal/SceneGraph/Scene/TransformationCachedScene.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
 #include "internal/Core/Utils/MemoryPool.h"
+#include "internal/Core/Utils/MemoryPoolDense.h"
 #include "internal/Core/Math3d/Rotation.h"
+#include "internal/Core/Math3d/Transform.h"
 #include "glm/gtx/transform.hpp"
 
 namespace
@@ -32,6 +34,11 @@ namespace ramses::internal
 
         m_nodeToTransformMap.reserve(sizeInfo.transformCount);
         m_matrixCachePool.preallocateSize(sizeInfo.nodeCount);
+        for (auto& matrices : m_matrices)
+        {
+            if (matrices.size() < sizeInfo.nodeCount)
+                matrices.resize(sizeInfo.nodeCount);
+        }
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -102,6 +109,12 @@ namespace ramses::internal
     {
         const NodeHandle _node = BaseT::allocateNode(childrenCount, node);
         m_matrixCachePool.allocate(_node);
+        // matrices of new node are not initialized, they are dirty and will be set before first use
+        for (auto& matrices : m_matrices)
+        {
+            if (matrices.size() <= _node.asMemoryHandle())
+                matrices.resize(_node.asMemoryHandle() + 1u);
+        }
         return _node;
     }
 
@@ -114,10 +127,11 @@ namespace ramses::internal
     }
 
     template <template<typename, typename> class MEMORYPOOL>
-    void TransformationCachedSceneT<MEMORYPOOL>::setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const glm::mat4& matrix) const
+    void TransformationCachedSceneT<MEMORYPOOL>::setMatrixCache(ETransformationMatrixType matrixType, NodeHandle nodeHandle, const glm::mat4& matrix) const
     {
-        matrixCache.m_matrix[matrixType] = matrix;
-        matrixCache.m_matrixDirty[matrixType] = false;
+        assert(nodeHandle.asMemoryHandle() < m_matrices[matrixType].size());
+        m_matrices[matrixType][nodeHandle.asMemoryHandle()] = matrix;
+        getMatrixCacheEntry(nodeHandle).m_matrixDirty[matrixType] = false;
     }
 
     template <template<typename, typename> class MEMORYPOOL>
@@ -130,7 +144,7 @@ namespace ramses::internal
             const MatrixCacheEntry& cacheEntry = getMatrixCacheEntry(currentNode);
             if (!cacheEntry.m_matrixDirty[matrixType])
             {
-                return cacheEntry.m_matrix[matrixType];
+                return m_matrices[matrixType][currentNode.asMemoryHandle()];
             }
             dirtyNodes.push_back(currentNode);
             currentNode = BaseT::getParent(currentNode);
@@ -145,10 +159,9 @@ namespace ramses::internal
         for (int32_t i = static_cast<int32_t>(dirtyNodes.size()) - 1; i >= 0; --i)
         {
             const NodeHandle dirtyNode = dirtyNodes[i];
-            MatrixCacheEntry& matrixCache = getMatrixCacheEntry(dirtyNode);
-            if (!matrixCache.m_isIdentity)
+            if (!getMatrixCacheEntry(dirtyNode).m_isIdentity)
                 computeMatrixForNode(matrixType, dirtyNode, chainMatrix);
-            setMatrixCache(matrixType, matrixCache, chainMatrix);
+            setMatrixCache(matrixType, dirtyNode, chainMatrix);
         }
     }
 
@@ -161,6 +174,15 @@ namespace ramses::internal
         return chainMatrix;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCaches(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, std::vector<glm::mat4>& matrices) const
+    {
+        // nodes sharing ancestors (e.g. joints of a skeleton) only update the dirty part of the chain not updated by previous nodes
+        matrices.resize(nodes.size());
+        for (size_t i = 0u; i < nodes.size(); ++i)
+            matrices[i] = updateMatrixCache(matrixType, nodes[i]);
+    }
+
 
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const
@@ -230,10 +252,7 @@ namespace ramses::internal
         if (transformHandlePtr != nullptr)
         {
             const auto& transform = BaseT::getTransform(*transformHandlePtr);
-            const auto matrix =
-                glm::translate(transform.translation) *
-                Math3d::Rotation(transform.rotation, transform.rotationType) *
-                glm::scale(transform.scaling);
+            const auto matrix = Math3d::Transform(transform.translation, Math3d::Rotation(transform.rotation, transform.rotationType), transform.scaling);
 
             chainMatrix *= matrix;
         }
@@ -246,10 +265,7 @@ namespace ramses::internal
         if (transformHandlePtr != nullptr)
         {
             const auto& transform = BaseT::getTransform(*transformHandlePtr);
-            const auto matrix =
-                glm::scale(glm::vec3(1.f) / transform.scaling) *
-                glm::transpose(Math3d::Rotation(transform.rotation, transform.rotationType)) *
-                glm::translate(-transform.translation);
+            const auto matrix = Math3d::InverseTransform(transform.translation, Math3d::Rotation(transform.rotation, transform.rotationType), transform.scaling);
 
             chainMatrix = matrix * chainMatrix;
         }
@@ -257,4 +273,5 @@ namespace ramses::internal
 
     template class TransformationCachedSceneT < MemoryPool >;
     template class TransformationCachedSceneT < MemoryPoolExplicit >;
+    template class TransformationCachedSceneT < MemoryPoolDense >;
 }
@@ -12,8 +12,11 @@
 #include "internal/SceneGraph/Scene/MatrixCacheEntry.h"
 #include "internal/Core/Utils/MemoryPool.h"
 #include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/Core/Utils/MemoryPoolDense.h"
 
 #include <cstdint>
+#include <array>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -22,6 +25,7 @@ namespace ramses::internal
 
     using TransformationCachedScene = TransformationCachedSceneT<MemoryPool>;
     using TransformationCachedSceneWithExplicitMemory = TransformationCachedSceneT<MemoryPoolExplicit>;
+    using TransformationCachedSceneWithDenseMemory = TransformationCachedSceneT<MemoryPoolDense>;
 
     template <template<typename, typename> class MEMORYPOOL>
     class TransformationCachedSceneT : public SceneT<MEMORYPOOL>
@@ -48,6 +52,8 @@ namespace ramses::internal
         void                    setScaling(TransformHandle transform, const glm::vec3& scaling) override;
 
         glm::mat4                       updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const;
+        // bulk variant of updateMatrixCache, 'matrices' is resized to number of nodes and filled in the same order
+        void                            updateMatrixCaches(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, std::vector<glm::mat4>& matrices) const;
         bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
     protected:
@@ -56,7 +62,7 @@ namespace ramses::internal
 
         const glm::mat4&            findCleanAncestorMatrixAndCollectDirtyNodesOnTheWay(ETransformationMatrixType matrixType, NodeHandle node, NodeHandleVector& dirtyNodes) const;
         void                        computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const;
-        void                        setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const glm::mat4& matrix) const;
+        void                        setMatrixCache(ETransformationMatrixType matrixType, NodeHandle nodeHandle, const glm::mat4& matrix) const;
 
         // A (local) member variable used by propagateDirty(...) and propagateDirtyToConsumers(...).,
         // in order to avoid creating a new Vector each time a method is called.
@@ -69,9 +75,12 @@ namespace ramses::internal
         void                        computeObjectMatrixForNode(NodeHandle node, glm::mat4& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
 
-        // Cache
+        // Cache, matrices are kept in contiguous arrays per matrix type indexed by node handle,
+        // the pool of cache entries holding dirtiness is the owner of node handles
         using MatrixCachePool = MEMORYPOOL<MatrixCacheEntry, NodeHandle>;
         mutable MatrixCachePool m_matrixCachePool;
+        using MatrixArray = std::vector<glm::mat4>;
+        mutable std::array<MatrixArray, ETransformationMatrixType_COUNT> m_matrices;
 
         HashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
 
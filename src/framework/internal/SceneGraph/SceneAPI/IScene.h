@@ -87,6 +87,9 @@ namespace ramses::internal
         virtual void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visibility) = 0;
         virtual void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) = 0;
         virtual void                        setRenderableStartVertex        (RenderableHandle renderableHandle, uint32_t startVertex) = 0;
+        virtual void                        setRenderableBoundingSphere     (RenderableHandle renderableHandle, const glm::vec4& boundingSphere) = 0;
+        virtual void                        setRenderableInstancePositions  (RenderableHandle renderableHandle, DataBufferHandle instancePositions) = 0;
+        virtual void                        setRenderableLevelsOfDetail     (RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail) = 0;
         [[nodiscard]] virtual const Renderable& getRenderable               (RenderableHandle renderableHandle) const = 0;
 
         // Render state
@@ -189,6 +192,10 @@ namespace ramses::internal
         virtual void setDataReference            (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) = 0;
         virtual void setDataUniformBuffer        (DataInstanceHandle containerHandle, DataFieldHandle field, UniformBufferHandle uniformBufferHandle) = 0;
 
+        // value of semantic time uniform at which shader animation using the data instance ends
+        virtual void                  setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs) = 0;
+        [[nodiscard]] virtual int32_t getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const = 0;
+
         // get/setData*Array wrappers for elementCount == 1
         [[nodiscard]] virtual float              getDataSingleFloat          (DataInstanceHandle containerHandle, DataFieldHandle field) const = 0;
         [[nodiscard]] virtual const glm::vec2&   getDataSingleVector2f       (DataInstanceHandle containerHandle, DataFieldHandle field) const = 0;
@@ -255,6 +262,10 @@ namespace ramses::internal
         virtual void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) = 0;
         virtual void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) = 0;
+        virtual void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) = 0;
+        virtual void                        setRenderPassFrontToBackSorting (RenderPassHandle passHandle, bool enable) = 0;
+        virtual void                        setRenderPassBackToFrontSorting (RenderPassHandle passHandle, bool enable) = 0;
+        virtual void                        setRenderPassDepthPrePass       (RenderPassHandle passHandle, bool enable) = 0;
         virtual void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) = 0;
         virtual void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) = 0;
         [[nodiscard]] virtual const RenderPass&           getRenderPass     (RenderPassHandle passHandle) const = 0;
@@ -304,6 +315,8 @@ namespace ramses::internal
         [[nodiscard]] virtual bool          isDataBufferAllocated           (DataBufferHandle handle) const = 0;
         [[nodiscard]] virtual uint32_t      getDataBufferCount              () const = 0;
         virtual void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) = 0;
+        // used size otherwise only grows with updates, this sets it e.g. when content gets shorter
+        virtual void                        setDataBufferUsedSize           (DataBufferHandle handle, uint32_t usedSizeInBytes) = 0;
         [[nodiscard]] virtual const GeometryDataBuffer& getDataBuffer       (DataBufferHandle handle) const = 0;
 
         //Texture buffers
@@ -328,6 +341,7 @@ namespace ramses::internal
         virtual void                        requestSceneReferenceState      (SceneReferenceHandle handle, RendererSceneState state) = 0;
         virtual void                        requestSceneReferenceFlushNotifications(SceneReferenceHandle handle, bool enable) = 0;
         virtual void                        setSceneReferenceRenderOrder    (SceneReferenceHandle handle, int32_t renderOrder) = 0;
+        virtual void                        setSceneReferencePreload        (SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority) = 0;
         [[nodiscard]] virtual bool                  isSceneReferenceAllocated(SceneReferenceHandle handle) const = 0;
         [[nodiscard]] virtual uint32_t              getSceneReferenceCount   () const = 0;
         [[nodiscard]] virtual const SceneReference& getSceneReference        (SceneReferenceHandle handle) const = 0;
@@ -12,6 +12,8 @@
 #include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 #include "internal/Core/Utils/AssertMovable.h"
 
+#include <unordered_map>
+
 namespace ramses::internal
 {
     struct RenderableOrderEntry
@@ -25,6 +27,10 @@ namespace ramses::internal
     {
         RenderableOrderVector  renderables;
         RenderGroupOrderVector renderGroups;
+
+        // position of each entry in vectors above for constant time lookups, kept in sync by RenderGroupUtils
+        std::unordered_map<RenderableHandle, uint32_t>  renderableIndices;
+        std::unordered_map<RenderGroupHandle, uint32_t> renderGroupIndices;
     };
 
     ASSERT_MOVABLE(RenderGroup)
@@ -11,6 +11,9 @@
 #include "internal/SceneGraph/SceneAPI/RenderGroup.h"
 #include "internal/SceneGraph/SceneAPI/RenderPass.h"
 
+#include <algorithm>
+#include <cassert>
+
 namespace ramses::internal
 {
     class RenderGroupUtils
@@ -18,32 +21,82 @@ namespace ramses::internal
     public:
         static RenderableOrderVector::const_iterator FindRenderableEntry(RenderableHandle handle, const RenderGroup& rg)
         {
-            return std::find_if(rg.renderables.cbegin(), rg.renderables.cend(), [handle](const RenderableOrderEntry& r) { return r.renderable == handle; });
+            const auto it = rg.renderableIndices.find(handle);
+            return (it != rg.renderableIndices.cend() ? rg.renderables.cbegin() + it->second : rg.renderables.cend());
         }
 
         static RenderableOrderVector::iterator FindRenderableEntry(RenderableHandle handle, RenderGroup& rg)
         {
-            return std::find_if(rg.renderables.begin(), rg.renderables.end(), [handle](const RenderableOrderEntry& r) { return r.renderable == handle; });
+            const auto it = rg.renderableIndices.find(handle);
+            return (it != rg.renderableIndices.cend() ? rg.renderables.begin() + it->second : rg.renderables.end());
         }
 
         static bool ContainsRenderable(RenderableHandle handle, const RenderGroup& rg)
         {
-            return std::find_if(rg.renderables.cbegin(), rg.renderables.cend(), [handle](const RenderableOrderEntry& r) { return r.renderable == handle; }) != rg.renderables.cend();
+            return rg.renderableIndices.count(handle) != 0u;
         }
 
         static RenderGroupOrderVector::const_iterator FindRenderGroupEntry(RenderGroupHandle handle, const RenderGroup& rg)
         {
-            return std::find_if(rg.renderGroups.cbegin(), rg.renderGroups.cend(), [handle](const RenderGroupOrderEntry& r) { return r.renderGroup == handle; });
+            const auto it = rg.renderGroupIndices.find(handle);
+            return (it != rg.renderGroupIndices.cend() ? rg.renderGroups.cbegin() + it->second : rg.renderGroups.cend());
         }
 
         static RenderGroupOrderVector::iterator FindRenderGroupEntry(RenderGroupHandle handle, RenderGroup& rg)
         {
-            return std::find_if(rg.renderGroups.begin(), rg.renderGroups.end(), [handle](const RenderGroupOrderEntry& r) { return r.renderGroup == handle; });
+            const auto it = rg.renderGroupIndices.find(handle);
+            return (it != rg.renderGroupIndices.cend() ? rg.renderGroups.begin() + it->second : rg.renderGroups.end());
         }
 
         static bool ContainsRenderGroup(RenderGroupHandle handle, const RenderGroup& rg)
         {
-            return std::find_if(rg.renderGroups.cbegin(), rg.renderGroups.cend(), [handle](const RenderGroupOrderEntry& r) { return r.renderGroup == handle; }) != rg.renderGroups.cend();
+            return rg.renderGroupIndices.count(handle) != 0u;
+        }
+
+        static void AddRenderable(RenderableHandle handle, int32_t order, RenderGroup& rg)
+        {
+            assert(!ContainsRenderable(handle, rg));
+            rg.renderableIndices.emplace(handle, static_cast<uint32_t>(rg.renderables.size()));
+            rg.renderables.push_back({ handle, order });
+        }
+
+        static void RemoveRenderable(RenderableHandle handle, RenderGroup& rg)
+        {
+            const auto indexIt = rg.renderableIndices.find(handle);
+            assert(indexIt != rg.renderableIndices.cend());
+            const uint32_t index = indexIt->second;
+            rg.renderableIndices.erase(indexIt);
+            // keep order of remaining entries, only entries behind removed one change position
+            rg.renderables.erase(rg.renderables.begin() + index);
+            for (uint32_t i = index; i < static_cast<uint32_t>(rg.renderables.size()); ++i)
+                rg.renderableIndices[rg.renderables[i].renderable] = i;
+        }
+
+        static void AddRenderGroup(RenderGroupHandle handle, int32_t order, RenderGroup& rg)
+        {
+            assert(!ContainsRenderGroup(handle, rg));
+            rg.renderGroupIndices.emplace(handle, static_cast<uint32_t>(rg.renderGroups.size()));
+            rg.renderGroups.push_back({ handle, order });
+        }
+
+        static void RemoveRenderGroup(RenderGroupHandle handle, RenderGroup& rg)
+        {
+            const auto indexIt = rg.renderGroupIndices.find(handle);
+            assert(indexIt != rg.renderGroupIndices.cend());
+            const uint32_t index = indexIt->second;
+            rg.renderGroupIndices.erase(indexIt);
+            rg.renderGroups.erase(rg.renderGroups.begin() + index);
+            for (uint32_t i = index; i < static_cast<uint32_t>(rg.renderGroups.size()); ++i)
+                rg.renderGroupIndices[rg.renderGroups[i].renderGroup] = i;
+        }
+
+        // must be called after entries of render group were reordered in place (e.g. sorted)
+        static void UpdateIndices(RenderGroup& rg)
+        {
+            for (uint32_t i = 0u; i < static_cast<uint32_t>(rg.renderables.size()); ++i)
+                rg.renderableIndices[rg.renderables[i].renderable] = i;
+            for (uint32_t i = 0u; i < static_cast<uint32_t>(rg.renderGroups.size()); ++i)
+                rg.renderGroupIndices[rg.renderGroups[i].renderGroup] = i;
         }
 
         static RenderGroupOrderVector::const_iterator FindRenderGroupEntry(RenderGroupHandle handle, const RenderPass& rp)
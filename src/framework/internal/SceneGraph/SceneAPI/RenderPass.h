@@ -23,6 +23,10 @@ namespace ramses::internal
         glm::vec4              clearColor{ 0.f, 0.f, 0.f, 1.f };
         ClearFlags             clearFlags = EClearFlag::All;
         bool                   isRenderOnce = false;
+        bool                   isStateSorted = false;
+        bool                   isFrontToBackSorted = false;
+        bool                   isBackToFrontSorted = false;
+        bool                   hasDepthPrePass = false;
 
         RenderGroupOrderVector renderGroups;
     };
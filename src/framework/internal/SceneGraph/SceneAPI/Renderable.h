@@ -12,12 +12,51 @@
 #include "internal/SceneGraph/SceneAPI/Handles.h"
 #include "internal/SceneGraph/SceneAPI/ERenderableDataSlotType.h"
 #include "ramses/framework/EVisibilityMode.h"
+#include "impl/DataTypesImpl.h"
 #include <array>
+#include <algorithm>
 
 namespace ramses::internal
 {
     using ramses::EVisibilityMode;
 
+    // alternative (typically coarser) index range of renderable, used when renderable covers
+    // less than screenSize of viewport height (diameter of bounding sphere projected by pass camera)
+    struct RenderableLevelOfDetail
+    {
+        uint32_t startIndex = 0u;
+        uint32_t indexCount = 0u;
+        float screenSize = 0.f;
+
+        bool operator==(const RenderableLevelOfDetail& other) const
+        {
+            return startIndex == other.startIndex && indexCount == other.indexCount && screenSize == other.screenSize;
+        }
+        bool operator!=(const RenderableLevelOfDetail& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    static constexpr uint32_t MaxRenderableLevelsOfDetail = 4u;
+
+    // levels of detail following the full detail level given by renderable's startIndex and indexCount,
+    // screen sizes are in descending order
+    struct RenderableLevelsOfDetail
+    {
+        std::array<RenderableLevelOfDetail, MaxRenderableLevelsOfDetail> levels{};
+        uint32_t count = 0u;
+
+        bool operator==(const RenderableLevelsOfDetail& other) const
+        {
+            return count == other.count && std::equal(levels.cbegin(), levels.cbegin() + count, other.levels.cbegin());
+        }
+        bool operator!=(const RenderableLevelsOfDetail& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
     struct Renderable
     {
         NodeHandle node;
@@ -27,6 +66,13 @@ namespace ramses::internal
         uint32_t indexCount = 0u;
         uint32_t instanceCount = 1u;
         uint32_t startVertex = 0u;
+        // bounding sphere in local (model) space, xyz is center and w is radius, negative radius means no bounding volume (never culled)
+        glm::vec4 boundingSphere{ 0.f, 0.f, 0.f, -1.f };
+        // optional buffer with per-instance translations (Vector3F) in local space, if valid the bounding sphere encloses single instance
+        // and renderer culls instances individually, only instances up to last visible one are drawn
+        DataBufferHandle instancePositions;
+        // optional coarser index ranges selected by renderer per render pass depending on projected size of bounding sphere
+        RenderableLevelsOfDetail levelsOfDetail;
 
         std::array<DataInstanceHandle, ERenderableDataSlotType_MAX_SLOTS> dataInstances;
         RenderStateHandle renderState;
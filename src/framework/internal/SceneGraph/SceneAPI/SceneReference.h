@@ -19,5 +19,8 @@ namespace ramses::internal
         RendererSceneState requestedState = RendererSceneState::Available;
         int32_t renderOrder = 0;
         bool flushNotifications = false;
+        // state the renderer may bring the referenced scene to in background, ahead of requestedState
+        RendererSceneState preloadState = RendererSceneState::Available;
+        int32_t preloadPriority = 0;
     };
 }
@@ -26,5 +26,27 @@ namespace ramses::internal
             std::set_difference(curr.begin(), curr.end(), old.begin(), old.end(), std::back_inserter(changes.m_resourcesAdded));
             std::set_difference(old.begin(), old.end(), curr.begin(), curr.end(), std::back_inserter(changes.m_resourcesRemoved));
         }
+
+        void ApplyResourceChanges(ResourceContentHashVector const& old, ResourceChanges const& changes, ResourceContentHashVector& curr)
+        {
+            assert(std::is_sorted(old.cbegin(), old.cend()));
+            assert(std::is_sorted(changes.m_resourcesAdded.cbegin(), changes.m_resourcesAdded.cend()));
+            assert(std::is_sorted(changes.m_resourcesRemoved.cbegin(), changes.m_resourcesRemoved.cend()));
+            assert(curr.empty());
+            curr.reserve(old.size() + changes.m_resourcesAdded.size());
+            auto removedIt = changes.m_resourcesRemoved.cbegin();
+            auto addedIt = changes.m_resourcesAdded.cbegin();
+            for (const auto& hash : old)
+            {
+                while (removedIt != changes.m_resourcesRemoved.cend() && *removedIt < hash)
+                    ++removedIt;
+                if (removedIt != changes.m_resourcesRemoved.cend() && *removedIt == hash)
+                    continue;
+                while (addedIt != changes.m_resourcesAdded.cend() && *addedIt < hash)
+                    curr.push_back(*addedIt++);
+                curr.push_back(hash);
+            }
+            curr.insert(curr.end(), addedIt, changes.m_resourcesAdded.cend());
+        }
     }
 }
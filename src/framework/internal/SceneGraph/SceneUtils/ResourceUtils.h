@@ -138,5 +138,7 @@ namespace ramses::internal
         }
 
         void DiffResources(ResourceContentHashVector const& old, ResourceContentHashVector const& curr, ResourceChanges& changes);
+        // inverse of DiffResources, curr = old + added - removed
+        void ApplyResourceChanges(ResourceContentHashVector const& old, ResourceChanges const& changes, ResourceContentHashVector& curr);
     }
 }
@@ -142,6 +142,9 @@ namespace ramses
             "--ec-socket-permissions", [&](auto value) { config.setWaylandEmbeddedCompositingSocketPermissions(value); }, "file permissions for wayland display socket")
             ->needs(ec)
             ->type_name("MODE");
+        grp->add_flag_function(
+            "--ec-event-thread", [&](auto /*unused*/) { config.setWaylandEmbeddedCompositingEventThread(true); }, "dispatch embedded compositing client requests in a dedicated thread")
+            ->needs(ec);
         grp->add_option_function<std::string>(
             "--clear", [&](const auto& value) {
                 std::istringstream is;
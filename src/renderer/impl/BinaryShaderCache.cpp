@@ -74,6 +74,11 @@ namespace ramses
         return m_impl.loadFromFile(filePath);
     }
 
+    bool BinaryShaderCache::enablePersistence(std::string_view filePath, bool warmUp)
+    {
+        return m_impl.enablePersistence(filePath, warmUp);
+    }
+
     void BinaryShaderCache::binaryShaderUploaded(effectId_t effectId, bool success) const
     {
         m_impl.binaryShaderUploaded(ramses::internal::ResourceContentHash(effectId.lowPart, effectId.highPart), success);
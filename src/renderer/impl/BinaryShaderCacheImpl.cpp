@@ -16,6 +16,8 @@
 #include "internal/PlatformAbstraction/PlatformMemory.h"
 #include "city.h"
 #include "internal/Communication/TransportCommon/RamsesTransportProtocolVersion.h"
+#include <algorithm>
+#include <filesystem>
 
 namespace
 {
@@ -24,13 +26,101 @@ namespace
 
 namespace ramses::internal
 {
+    BinaryShaderCacheImpl::~BinaryShaderCacheImpl()
+    {
+        waitForWarmUp();
+        if (!m_persistentFilePath.empty() && m_modified)
+            saveToFile(m_persistentFilePath);
+    }
+
     void BinaryShaderCacheImpl::deviceSupportsBinaryShaderFormats(const binaryShaderFormatId_t* supportedFormats, uint32_t numSupportedFormats)
     {
         m_supportedFormats = {supportedFormats, supportedFormats + numSupportedFormats };
+        m_deviceIdentity = GetDeviceIdentity(m_supportedFormats);
+
+        // persistence enabled without warm-up loads file only now when device is known
+        if (m_loadOnDeviceFormatsReported)
+        {
+            m_loadOnDeviceFormatsReported = false;
+            loadFromFile(m_persistentFilePath);
+        }
+        waitForWarmUp();
+        evictShadersOfOtherDevice();
+    }
+
+    bool BinaryShaderCacheImpl::enablePersistence(std::string_view filePath, bool warmUp)
+    {
+        if (!m_persistentFilePath.empty())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "BinaryShaderCacheImpl::enablePersistence: persistence already enabled with file {}", m_persistentFilePath);
+            return false;
+        }
+        if (filePath.empty())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "BinaryShaderCacheImpl::enablePersistence: file path must not be empty");
+            return false;
+        }
+
+        m_persistentFilePath = filePath;
+        if (warmUp)
+        {
+            // shaders are loaded in background, every query waits for it to finish
+            // (first query typically comes from upload thread when device is created, not blocking rendering)
+            m_warmUpPending = true;
+            m_warmUpThread.start(m_warmUpRunnable);
+        }
+        else if (m_supportedFormats.empty())
+        {
+            m_loadOnDeviceFormatsReported = true;
+        }
+        else
+        {
+            loadFromFile(m_persistentFilePath);
+            evictShadersOfOtherDevice();
+        }
+
+        return true;
+    }
+
+    void BinaryShaderCacheImpl::waitForWarmUp() const
+    {
+        if (!m_warmUpPending)
+            return;
+
+        std::lock_guard<std::mutex> g(m_warmUpLock);
+        if (m_warmUpThread.joinable())
+            m_warmUpThread.join();
+        m_warmUpPending = false;
+    }
+
+    void BinaryShaderCacheImpl::evictShadersOfOtherDevice()
+    {
+        if (m_loadedDeviceIdentity == 0u || m_deviceIdentity == 0u || m_loadedDeviceIdentity == m_deviceIdentity)
+            return;
+
+        LOG_INFO(CONTEXT_RENDERER, "BinaryShaderCacheImpl: cached binary shaders were created with different device or driver, evicting {} binary shaders", m_binaryShaders.size());
+        std::lock_guard<std::mutex> g(m_hashMapLock);
+        m_binaryShaders.clear();
+        m_loadedDeviceIdentity = 0u;
+        m_modified = true;
+    }
+
+    uint64_t BinaryShaderCacheImpl::GetDeviceIdentity(const std::vector<binaryShaderFormatId_t>& supportedFormats)
+    {
+        if (supportedFormats.empty())
+            return 0u;
+
+        // formats reported by driver are its only identification available to cache, they change with driver/GPU which produce incompatible binaries
+        std::vector<uint32_t> formats;
+        formats.reserve(supportedFormats.size());
+        std::transform(supportedFormats.cbegin(), supportedFormats.cend(), std::back_inserter(formats), [](binaryShaderFormatId_t f) { return f.getValue(); });
+        std::sort(formats.begin(), formats.end());
+        return cityhash::CityHash64(reinterpret_cast<const char*>(formats.data()), formats.size() * sizeof(uint32_t));
     }
 
     bool BinaryShaderCacheImpl::hasBinaryShader(const ResourceContentHash& effectId) const
     {
+        waitForWarmUp();
         if (!m_binaryShaders.contains(effectId))
             return false;
 
@@ -82,12 +172,14 @@ namespace ramses::internal
         assert(nullptr != binaryShaderData);
         assert(binaryShaderDataSize > 0);
 
+        waitForWarmUp();
         std::lock_guard<std::mutex> g(m_hashMapLock);
         if (m_binaryShaders.contains(effectId))
             return;
 
         BinaryShader binaryShader = { {binaryShaderData, binaryShaderData + binaryShaderDataSize}, BinaryShaderFormatID{ binaryShaderFormat.getValue() } };
         m_binaryShaders.put(effectId, binaryShader);
+        m_modified = true;
     }
 
     bool BinaryShaderCacheImpl::loadFromFile(std::string_view filePath)
@@ -109,7 +201,25 @@ namespace ramses::internal
         FileHeader fileHeader{};
 
         size_t actualSize = 0;
-        if (!file.getSizeInBytes(actualSize) || actualSize < sizeof(FileHeader))
+        if (!file.getSizeInBytes(actualSize) || actualSize < sizeof(FileHeader::magic) + sizeof(FileHeader::formatVersion))
+        {
+            LOG_WARN(CONTEXT_RENDERER,
+                     "BinaryShaderCacheImpl::loadFromFile: Invalid file size - cache needs to be repopulated and saved again");
+            return false;
+        }
+
+        fileInputStream >> fileHeader.magic;
+        fileInputStream >> fileHeader.formatVersion;
+
+        // not an error, cache saved by other version is expected after update
+        if (fileHeader.magic != FileMagic || fileHeader.formatVersion != FileFormatVersion)
+        {
+            LOG_INFO(CONTEXT_RENDERER,
+                     "BinaryShaderCacheImpl::loadFromFile: File format is not supported by this version (expected version {}) - cache needs to be repopulated and saved again", FileFormatVersion);
+            return false;
+        }
+
+        if (actualSize < sizeof(FileHeader))
         {
             LOG_WARN(CONTEXT_RENDERER,
                      "BinaryShaderCacheImpl::loadFromFile: Invalid file size - cache needs to be repopulated and saved again");
@@ -135,6 +245,7 @@ namespace ramses::internal
         }
 
         fileInputStream >> fileHeader.checksum;
+        fileInputStream >> fileHeader.deviceIdentity;
 
         const uint32_t contentSize = fileHeader.fileSize - sizeof(fileHeader);
 
@@ -158,6 +269,7 @@ namespace ramses::internal
         inputStream >> numBinaryShaders;
 
         std::lock_guard<std::mutex> g(m_hashMapLock);
+        m_loadedDeviceIdentity = fileHeader.deviceIdentity;
         for (uint32_t index = 0; index < numBinaryShaders; index++)
         {
             BinaryShader binaryShader;
@@ -190,31 +302,57 @@ namespace ramses::internal
         const uint64_t checksum = cityhash::CityHash64(reinterpret_cast<const char*>(outputStream.getData()), contentSize);
 
         FileHeader fileHeader = {};
+        fileHeader.magic            = FileMagic;
+        fileHeader.formatVersion    = FileFormatVersion;
         fileHeader.fileSize         = static_cast<uint32_t>(sizeof(FileHeader)) + contentSize;
         fileHeader.transportVersion = RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR;
         fileHeader.checksum         = checksum;
+        fileHeader.deviceIdentity   = m_deviceIdentity;
 
-        ramses::internal::File                   file(filePath);
-        ramses::internal::BinaryFileOutputStream outputFileStream(file);
-
-        if (outputFileStream.getState() == EStatus::Ok)
+        // write to temporary file first and replace target file only when complete,
+        // so that target file is never left partially written (e.g. on power loss)
+        const std::string tempFilePath = fmt::format("{}.tmp", filePath);
         {
-            outputFileStream << fileHeader.fileSize << fileHeader.transportVersion << fileHeader.checksum;
+            ramses::internal::File                   file(tempFilePath);
+            ramses::internal::BinaryFileOutputStream outputFileStream(file);
+
+            if (outputFileStream.getState() != EStatus::Ok)
+            {
+                LOG_WARN(CONTEXT_RENDERER,
+                         "BinaryShaderCacheImpl::saveToFile: failed to open {}", tempFilePath);
+                return;
+            }
+
+            outputFileStream << fileHeader.magic << fileHeader.formatVersion << fileHeader.fileSize << fileHeader.transportVersion << fileHeader.checksum << fileHeader.deviceIdentity;
             outputFileStream.write(outputStream.getData(), contentSize);
+            if (outputFileStream.getState() != EStatus::Ok)
+            {
+                LOG_WARN(CONTEXT_RENDERER,
+                         "BinaryShaderCacheImpl::saveToFile: failed to write {}", tempFilePath);
+                return;
+            }
         }
-        else
+
+        std::error_code ec;
+        std::filesystem::rename(tempFilePath, std::filesystem::path(filePath), ec);
+        if (ec)
         {
             LOG_WARN(CONTEXT_RENDERER,
-                     "BinaryShaderCacheImpl::saveToFile: failed to open {}", filePath);
+                     "BinaryShaderCacheImpl::saveToFile: failed to replace {}: {}", filePath, ec.message());
+            return;
         }
+        m_modified = false;
     }
 
-    // NOLINTNEXTLINE(readability-convert-member-functions-to-static): design decision
     void BinaryShaderCacheImpl::binaryShaderUploaded(ResourceContentHash effectHash, bool success) const
     {
         if (!success)
         {
-            LOG_WARN(CONTEXT_RENDERER, "BinaryShaderCache: Failed to upload binary shader from cache for effect id: {}", effectHash);
+            LOG_WARN(CONTEXT_RENDERER, "BinaryShaderCache: Failed to upload binary shader from cache for effect id: {}, evicting it from cache", effectHash);
+            // shader will be compiled from source and stored again
+            std::lock_guard<std::mutex> g(m_hashMapLock);
+            if (m_binaryShaders.remove(effectHash))
+                m_modified = true;
         }
     }
 
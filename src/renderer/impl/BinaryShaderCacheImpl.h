@@ -13,8 +13,12 @@
 #include "ramses/renderer/Types.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
 
+#include <atomic>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <string_view>
 
 namespace ramses::internal
@@ -25,6 +29,9 @@ namespace ramses::internal
     class BinaryShaderCacheImpl
     {
     public:
+        BinaryShaderCacheImpl() = default;
+        ~BinaryShaderCacheImpl();
+
         void deviceSupportsBinaryShaderFormats(const binaryShaderFormatId_t* supportedFormats, uint32_t numSupportedFormats);
         bool hasBinaryShader(const ResourceContentHash& effectId) const;
         uint32_t getBinaryShaderSize(const ResourceContentHash& effectId) const;
@@ -37,14 +44,48 @@ namespace ramses::internal
         void saveToFile(std::string_view filePath) const;
         bool loadFromFile(std::string_view filePath);
 
+        bool enablePersistence(std::string_view filePath, bool warmUp);
+
+        // written first, so that files of other layout (e.g. from older versions) are recognized before reading the rest of the header
+        static constexpr uint32_t FileMagic = 0x43534252u; // "RBSC"
+        static constexpr uint32_t FileFormatVersion = 2u;
+
         struct FileHeader
         {
+            uint32_t magic;
+            uint32_t formatVersion;
             uint32_t fileSize;
             uint32_t transportVersion;
             uint64_t checksum;
+            // identifies device the shaders were compiled with, 0 if unknown
+            uint64_t deviceIdentity;
         };
 
+        BinaryShaderCacheImpl(const BinaryShaderCacheImpl&) = delete;
+        BinaryShaderCacheImpl& operator=(const BinaryShaderCacheImpl&) = delete;
+
     private:
+        class WarmUpRunnable : public Runnable
+        {
+        public:
+            explicit WarmUpRunnable(BinaryShaderCacheImpl& cache)
+                : m_cache(cache)
+            {
+            }
+
+            void run() override
+            {
+                m_cache.loadFromFile(m_cache.m_persistentFilePath);
+            }
+
+        private:
+            BinaryShaderCacheImpl& m_cache;
+        };
+
+        void waitForWarmUp() const;
+        void evictShadersOfOtherDevice();
+        static uint64_t GetDeviceIdentity(const std::vector<binaryShaderFormatId_t>& supportedFormats);
+
         static void serializeBinaryShader(IOutputStream& outputStream, const ResourceContentHash& effectId, const std::vector<std::byte>& binaryShaderData, BinaryShaderFormatID binaryShaderFormat);
         static bool deserializeBinaryShader(IInputStream& inputStream, ResourceContentHash& effectId, std::vector<std::byte>& binaryShaderData, BinaryShaderFormatID& binaryShaderFormat);
 
@@ -55,8 +96,21 @@ namespace ramses::internal
         };
         using BinaryShaderTable = HashMap<ResourceContentHash, BinaryShader>;
 
-        BinaryShaderTable m_binaryShaders;
+        // mutable because invalid shaders are evicted when their upload fails, which is reported by const binaryShaderUploaded
+        mutable BinaryShaderTable m_binaryShaders;
         std::vector<binaryShaderFormatId_t> m_supportedFormats;
+        uint64_t m_deviceIdentity = 0u;
+        uint64_t m_loadedDeviceIdentity = 0u;
+
+        // persistence: file is loaded (optionally on warm-up thread) and saved on destruction if content changed
+        std::string m_persistentFilePath;
+        bool m_loadOnDeviceFormatsReported = false;
+        mutable std::atomic<bool> m_modified{ false };
+        mutable std::atomic<bool> m_warmUpPending{ false };
+        mutable std::mutex m_warmUpLock;
+        WarmUpRunnable m_warmUpRunnable{ *this };
+        mutable PlatformThread m_warmUpThread{ "R_ShaderCache" };
+
         // protects HashMap write of new shaders concurrently with saving of file
         // WARNING: Does not protect loading from file concurrently with querying for shaders!
         // Reason: Avoid performance degradation because unknown if Integrity mutexes are cheap without congestion.
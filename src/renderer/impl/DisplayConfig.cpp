@@ -245,6 +245,11 @@ namespace ramses
         return m_impl->setWaylandEmbeddedCompositingSocketPermissions(permissions);
     }
 
+    bool DisplayConfig::setWaylandEmbeddedCompositingEventThread(bool enable)
+    {
+        return m_impl->setWaylandEmbeddedCompositingEventThread(enable);
+    }
+
     bool DisplayConfig::setPlatformRenderNode(std::string_view renderNode)
     {
         return m_impl->setPlatformRenderNode(renderNode);
@@ -260,11 +265,66 @@ namespace ramses
         return m_impl->setScenePriority(sceneId, priority);
     }
 
+    bool DisplayConfig::setScenePrefetch(sceneId_t sceneId, bool enable)
+    {
+        return m_impl->setScenePrefetch(sceneId, enable);
+    }
+
+    bool DisplayConfig::setSceneProgressiveMapping(sceneId_t sceneId, bool enable)
+    {
+        return m_impl->setSceneProgressiveMapping(sceneId, enable);
+    }
+
     bool DisplayConfig::setResourceUploadBatchSize(uint32_t batchSize)
     {
         return m_impl->setResourceUploadBatchSize(batchSize);
     }
 
+    bool DisplayConfig::setMaxFramesInFlight(uint32_t maxFramesInFlight)
+    {
+        return m_impl->setMaxFramesInFlight(maxFramesInFlight);
+    }
+
+    bool DisplayConfig::setFlushApplyThreadCount(uint32_t threadCount)
+    {
+        return m_impl->setFlushApplyThreadCount(threadCount);
+    }
+
+    bool DisplayConfig::setAsyncFlushApplyThreshold(uint32_t minSceneActions)
+    {
+        return m_impl->setAsyncFlushApplyThreshold(minSceneActions);
+    }
+
+    bool DisplayConfig::setOffscreenBufferScalingGpuTimeThreshold(uint32_t microseconds)
+    {
+        return m_impl->setOffscreenBufferScalingGpuTimeThreshold(microseconds);
+    }
+
+    bool DisplayConfig::setIdleWaitEnabled(bool enable)
+    {
+        return m_impl->setIdleWaitEnabled(enable);
+    }
+
+    bool DisplayConfig::setRenderOncePassesPerFrameLimit(uint32_t maxPasses)
+    {
+        return m_impl->setRenderOncePassesPerFrameLimit(maxPasses);
+    }
+
+    bool DisplayConfig::setAsyncPickingEnabled(bool enable)
+    {
+        return m_impl->setAsyncPickingEnabled(enable);
+    }
+
+    bool DisplayConfig::setDisplayThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity)
+    {
+        return m_impl->setDisplayThreadScheduling(ramses::internal::ThreadScheduling{ policy, priority, cpuAffinity });
+    }
+
+    bool DisplayConfig::setEffectUploadThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity)
+    {
+        return m_impl->setEffectUploadThreadScheduling(ramses::internal::ThreadScheduling{ policy, priority, cpuAffinity });
+    }
+
     void DisplayConfig::validate(ValidationReport& report) const
     {
         m_impl->validate(report.impl());
@@ -246,6 +246,17 @@ namespace ramses::internal
         return m_internalConfig.getWaylandSocketEmbeddedPermissions();
     }
 
+    bool DisplayConfigImpl::setWaylandEmbeddedCompositingEventThread(bool enable)
+    {
+        m_internalConfig.setWaylandEmbeddedCompositingEventThread(enable);
+        return true;
+    }
+
+    bool DisplayConfigImpl::isWaylandEmbeddedCompositingEventThreadEnabled() const
+    {
+        return m_internalConfig.isWaylandEmbeddedCompositingEventThreadEnabled();
+    }
+
     bool DisplayConfigImpl::setWaylandEmbeddedCompositingSocketName(std::string_view socketname)
     {
         m_internalConfig.setWaylandEmbeddedCompositingSocketName(socketname);
@@ -301,6 +312,28 @@ namespace ramses::internal
         return m_internalConfig.getScenePriority(SceneId(sceneId.getValue()));
     }
 
+    bool DisplayConfigImpl::setScenePrefetch(sceneId_t sceneId, bool enable)
+    {
+        m_internalConfig.setScenePrefetch(SceneId(sceneId.getValue()), enable);
+        return true;
+    }
+
+    bool DisplayConfigImpl::isScenePrefetchEnabled(sceneId_t sceneId) const
+    {
+        return m_internalConfig.isScenePrefetchEnabled(SceneId(sceneId.getValue()));
+    }
+
+    bool DisplayConfigImpl::setSceneProgressiveMapping(sceneId_t sceneId, bool enable)
+    {
+        m_internalConfig.setSceneProgressiveMapping(SceneId(sceneId.getValue()), enable);
+        return true;
+    }
+
+    bool DisplayConfigImpl::isSceneProgressiveMappingEnabled(sceneId_t sceneId) const
+    {
+        return m_internalConfig.isSceneProgressiveMappingEnabled(SceneId(sceneId.getValue()));
+    }
+
     bool DisplayConfigImpl::setResourceUploadBatchSize(uint32_t batchSize)
     {
         if (batchSize == 0)
@@ -317,6 +350,115 @@ namespace ramses::internal
         return m_internalConfig.getResourceUploadBatchSize();
     }
 
+    bool DisplayConfigImpl::setMaxFramesInFlight(uint32_t maxFramesInFlight)
+    {
+        m_internalConfig.setMaxFramesInFlight(maxFramesInFlight);
+        return true;
+    }
+
+    uint32_t DisplayConfigImpl::getMaxFramesInFlight() const
+    {
+        return m_internalConfig.getMaxFramesInFlight();
+    }
+
+    bool DisplayConfigImpl::setFlushApplyThreadCount(uint32_t threadCount)
+    {
+        m_internalConfig.setFlushApplyThreadCount(threadCount);
+        return true;
+    }
+
+    uint32_t DisplayConfigImpl::getFlushApplyThreadCount() const
+    {
+        return m_internalConfig.getFlushApplyThreadCount();
+    }
+
+    bool DisplayConfigImpl::setAsyncFlushApplyThreshold(uint32_t minSceneActions)
+    {
+        m_internalConfig.setAsyncFlushApplyThreshold(minSceneActions);
+        return true;
+    }
+
+    uint32_t DisplayConfigImpl::getAsyncFlushApplyThreshold() const
+    {
+        return m_internalConfig.getAsyncFlushApplyThreshold();
+    }
+
+    bool DisplayConfigImpl::setOffscreenBufferScalingGpuTimeThreshold(uint32_t microseconds)
+    {
+        m_internalConfig.setOffscreenBufferScalingGpuTimeThreshold(std::chrono::microseconds{ microseconds });
+        return true;
+    }
+
+    std::chrono::microseconds DisplayConfigImpl::getOffscreenBufferScalingGpuTimeThreshold() const
+    {
+        return m_internalConfig.getOffscreenBufferScalingGpuTimeThreshold();
+    }
+
+    bool DisplayConfigImpl::setIdleWaitEnabled(bool enable)
+    {
+        m_internalConfig.setIdleWaitEnabled(enable);
+        return true;
+    }
+
+    bool DisplayConfigImpl::isIdleWaitEnabled() const
+    {
+        return m_internalConfig.isIdleWaitEnabled();
+    }
+
+    bool DisplayConfigImpl::setRenderOncePassesPerFrameLimit(uint32_t maxPasses)
+    {
+        m_internalConfig.setRenderOncePassesPerFrameLimit(maxPasses);
+        return true;
+    }
+
+    uint32_t DisplayConfigImpl::getRenderOncePassesPerFrameLimit() const
+    {
+        return m_internalConfig.getRenderOncePassesPerFrameLimit();
+    }
+
+    bool DisplayConfigImpl::setAsyncPickingEnabled(bool enable)
+    {
+        m_internalConfig.setAsyncPickingEnabled(enable);
+        return true;
+    }
+
+    bool DisplayConfigImpl::isAsyncPickingEnabled() const
+    {
+        return m_internalConfig.isAsyncPickingEnabled();
+    }
+
+    bool DisplayConfigImpl::setDisplayThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        if (!scheduling.hasValidPriority())
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "DisplayConfig::setDisplayThreadScheduling failed - priority {} is not valid for policy {}!", scheduling.priority, scheduling.policy);
+            return false;
+        }
+        m_internalConfig.setDisplayThreadScheduling(scheduling);
+        return true;
+    }
+
+    const ThreadScheduling& DisplayConfigImpl::getDisplayThreadScheduling() const
+    {
+        return m_internalConfig.getDisplayThreadScheduling();
+    }
+
+    bool DisplayConfigImpl::setEffectUploadThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        if (!scheduling.hasValidPriority())
+        {
+            LOG_ERROR(CONTEXT_CLIENT, "DisplayConfig::setEffectUploadThreadScheduling failed - priority {} is not valid for policy {}!", scheduling.priority, scheduling.policy);
+            return false;
+        }
+        m_internalConfig.setEffectUploadThreadScheduling(scheduling);
+        return true;
+    }
+
+    const ThreadScheduling& DisplayConfigImpl::getEffectUploadThreadScheduling() const
+    {
+        return m_internalConfig.getEffectUploadThreadScheduling();
+    }
+
     void DisplayConfigImpl::validate(ValidationReportImpl& report) const
     {
         const auto embeddedCompositorFilename = m_internalConfig.getWaylandSocketEmbedded();
@@ -65,6 +65,9 @@ namespace ramses::internal
         [[nodiscard]] bool setWaylandEmbeddedCompositingSocketPermissions(uint32_t permissions);
         [[nodiscard]] uint32_t getWaylandSocketEmbeddedPermissions() const;
 
+        [[nodiscard]] bool setWaylandEmbeddedCompositingEventThread(bool enable);
+        [[nodiscard]] bool isWaylandEmbeddedCompositingEventThreadEnabled() const;
+
         [[nodiscard]] bool setWaylandEmbeddedCompositingSocketName(std::string_view socketname);
         [[nodiscard]] std::string_view getWaylandEmbeddedCompositingSocketName() const;
 
@@ -80,9 +83,38 @@ namespace ramses::internal
         [[nodiscard]] bool setScenePriority(sceneId_t sceneId, int32_t priority);
         [[nodiscard]] int32_t getScenePriority(sceneId_t sceneId) const;
 
+        [[nodiscard]] bool setScenePrefetch(sceneId_t sceneId, bool enable);
+        [[nodiscard]] bool isScenePrefetchEnabled(sceneId_t sceneId) const;
+
+        [[nodiscard]] bool setSceneProgressiveMapping(sceneId_t sceneId, bool enable);
+        [[nodiscard]] bool isSceneProgressiveMappingEnabled(sceneId_t sceneId) const;
+
         [[nodiscard]] bool setResourceUploadBatchSize(uint32_t batchSize);
         [[nodiscard]] uint32_t getResourceUploadBatchSize() const;
 
+        [[nodiscard]] bool setMaxFramesInFlight(uint32_t maxFramesInFlight);
+        [[nodiscard]] uint32_t getMaxFramesInFlight() const;
+
+        [[nodiscard]] bool setFlushApplyThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getFlushApplyThreadCount() const;
+
+        [[nodiscard]] bool setAsyncFlushApplyThreshold(uint32_t minSceneActions);
+        [[nodiscard]] uint32_t getAsyncFlushApplyThreshold() const;
+
+        [[nodiscard]] bool setOffscreenBufferScalingGpuTimeThreshold(uint32_t microseconds);
+        [[nodiscard]] std::chrono::microseconds getOffscreenBufferScalingGpuTimeThreshold() const;
+
+        [[nodiscard]] bool setIdleWaitEnabled(bool enable);
+        [[nodiscard]] bool isIdleWaitEnabled() const;
+        [[nodiscard]] bool setRenderOncePassesPerFrameLimit(uint32_t maxPasses);
+        [[nodiscard]] uint32_t getRenderOncePassesPerFrameLimit() const;
+        [[nodiscard]] bool setAsyncPickingEnabled(bool enable);
+        [[nodiscard]] bool isAsyncPickingEnabled() const;
+        [[nodiscard]] bool setDisplayThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getDisplayThreadScheduling() const;
+        [[nodiscard]] bool setEffectUploadThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getEffectUploadThreadScheduling() const;
+
         void validate(ValidationReportImpl& report) const;
 
         //impl methods
@@ -130,6 +130,20 @@ namespace ramses
         return bufferId;
     }
 
+    bool RamsesRenderer::updateExternalBufferFromDmaBuffer(displayId_t display, externalBufferId_t externalBuffer, int dmaBufferFD, uint32_t width, uint32_t height, uint32_t bufferFourccFormat, uint32_t stride, uint64_t modifier)
+    {
+        const auto status = m_impl->updateExternalBufferFromDmaBuffer(display, externalBuffer, dmaBufferFD, width, height, bufferFourccFormat, stride, modifier);
+        LOG_HL_RENDERER_API8(status, display, externalBuffer, dmaBufferFD, width, height, bufferFourccFormat, stride, modifier);
+        return status;
+    }
+
+    bool RamsesRenderer::linkDmaOffscreenBufferToExternalBuffer(displayId_t offscreenBufferDisplay, displayBufferId_t offscreenBuffer, displayId_t externalBufferDisplay, externalBufferId_t externalBuffer)
+    {
+        const auto status = m_impl->linkDmaOffscreenBufferToExternalBuffer(offscreenBufferDisplay, offscreenBuffer, externalBufferDisplay, externalBuffer);
+        LOG_HL_RENDERER_API4(status, offscreenBufferDisplay, offscreenBuffer, externalBufferDisplay, externalBuffer);
+        return status;
+    }
+
     bool RamsesRenderer::destroyExternalBuffer(displayId_t display, externalBufferId_t externalBuffer)
     {
         const auto status = m_impl->destroyExternalBuffer(display, externalBuffer);
@@ -161,9 +175,30 @@ namespace ramses
         return status;
     }
 
+    bool RamsesRenderer::setOffscreenBufferRenderRateDivisor(displayId_t display, displayBufferId_t offscreenBuffer, uint32_t divisor)
+    {
+        const bool status = m_impl->setOffscreenBufferRenderRateDivisor(display, offscreenBuffer, divisor);
+        LOG_HL_RENDERER_API3(status, display, offscreenBuffer, divisor);
+        return status;
+    }
+
+    bool RamsesRenderer::setOffscreenBufferScalable(displayId_t display, displayBufferId_t offscreenBuffer, bool scalable)
+    {
+        const bool status = m_impl->setOffscreenBufferScalable(display, offscreenBuffer, scalable);
+        LOG_HL_RENDERER_API3(status, display, offscreenBuffer, scalable);
+        return status;
+    }
+
     bool RamsesRenderer::readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
     {
-        const bool status = m_impl->readPixels(displayId, displayBuffer, x, y, width, height);
+        const bool status = m_impl->readPixels(displayId, displayBuffer, x, y, width, height, false);
+        LOG_HL_RENDERER_API6(status, displayId, displayBuffer, x, y, width, height);
+        return status;
+    }
+
+    bool RamsesRenderer::readPixelsNonBlocking(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        const bool status = m_impl->readPixels(displayId, displayBuffer, x, y, width, height, true);
         LOG_HL_RENDERER_API6(status, displayId, displayBuffer, x, y, width, height);
         return status;
     }
@@ -253,6 +288,13 @@ namespace ramses
         return m_impl->getDmaOffscreenBufferFDAndStride(display, displayBufferId, fd, stride);
     }
 
+    bool RamsesRenderer::setDmaOffscreenBufferSyncFenceEnabled(displayId_t display, displayBufferId_t offscreenBuffer, bool enable)
+    {
+        const bool status = m_impl->setDmaOffscreenBufferSyncFenceEnabled(display, offscreenBuffer, enable);
+        LOG_HL_RENDERER_API3(status, display, offscreenBuffer, enable);
+        return status;
+    }
+
     bool RamsesRenderer::setSkippingOfUnmodifiedBuffers(bool enable)
     {
         const bool status = m_impl->setSkippingOfUnmodifiedBuffers(enable);
@@ -260,6 +302,13 @@ namespace ramses
         return status;
     }
 
+    bool RamsesRenderer::trimMemory()
+    {
+        const bool status = m_impl->trimMemory();
+        LOG_HL_RENDERER_API_NOARG(status);
+        return status;
+    }
+
     internal::RamsesRendererImpl& RamsesRenderer::impl()
     {
         return *m_impl;
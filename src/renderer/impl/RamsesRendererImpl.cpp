@@ -35,9 +35,16 @@ namespace ramses::internal
 {
     static const bool rendererRegisterSuccess = RendererFactory::RegisterRendererFactory();
 
+    static GpuMemoryUsage ToGpuMemoryUsage(const GpuMemoryReport::Usage& usage)
+    {
+        return GpuMemoryUsage{ usage.textures, usage.buffers, usage.renderTargets, usage.shaders, usage.shared };
+    }
+
     RamsesRendererImpl::RamsesRendererImpl(RamsesFrameworkImpl& framework, const ramses::RendererConfig& config)
         : m_framework(framework)
-        , m_binaryShaderCache(config.impl().getBinaryShaderCache() ? new BinaryShaderCacheProxy(*(config.impl().getBinaryShaderCache())) : nullptr)
+        , m_crossDisplayShaderCache((config.impl().isCrossDisplayShaderSharingEnabled() || config.impl().isDisplayRestartCacheEnabled()) && !config.impl().getBinaryShaderCache() ? std::make_unique<ramses::BinaryShaderCache>() : nullptr)
+        , m_binaryShaderCache(config.impl().getBinaryShaderCache() ? new BinaryShaderCacheProxy(*(config.impl().getBinaryShaderCache())) :
+            (m_crossDisplayShaderCache ? new BinaryShaderCacheProxy(*m_crossDisplayShaderCache) : nullptr))
         , m_rendererFrameworkLogic(framework.getScenegraphComponent(), m_rendererCommandBuffer, framework.getFrameworkLock())
         , m_threadWatchdog(framework.getThreadWatchdogConfig(), ERamsesThreadIdentifier::Renderer)
         , m_displayDispatcher{ std::make_unique<DisplayDispatcher>(std::make_unique<PlatformFactory>(), config.impl().getInternalRendererConfig(), m_rendererFrameworkLogic, m_threadWatchdog, m_framework.getFeatureLevel()) }
@@ -60,6 +67,9 @@ namespace ramses::internal
             m_ramshCommands.push_back(std::make_shared<TriggerPickEvent>(m_rendererCommandBuffer));
             m_ramshCommands.push_back(std::make_shared<SetClearColor>(m_rendererCommandBuffer));
             m_ramshCommands.push_back(std::make_shared<SetSkippingOfUnmodifiedBuffers>(m_rendererCommandBuffer));
+            m_ramshCommands.push_back(std::make_shared<SetGpuTimerQueries>(m_rendererCommandBuffer));
+            m_ramshCommands.push_back(std::make_shared<SetSkippingOfUnusedRenderPasses>(m_rendererCommandBuffer));
+            m_ramshCommands.push_back(std::make_shared<SetPartialRedraw>(m_rendererCommandBuffer));
             m_ramshCommands.push_back(std::make_shared<SystemCompositorControllerListIviSurfaces>(m_rendererCommandBuffer));
             m_ramshCommands.push_back(std::make_shared<SystemCompositorControllerSetLayerVisibility>(m_rendererCommandBuffer));
             m_ramshCommands.push_back(std::make_shared<SystemCompositorControllerSetSurfaceVisibility>(m_rendererCommandBuffer));
@@ -215,6 +225,7 @@ namespace ramses::internal
 
         RendererCommand::CreateDmaOffscreenBuffer cmd{ displayHandle, bufferHandle, width, height, dmaBufferFourccFormat, dmaBufferUsageFlags, dmaBufferModifiers };
         m_pendingRendererCommands.push_back(std::move(cmd));
+        m_offscreenDmaBufferFormats.push_back({ display, bufferId, width, height, dmaBufferFourccFormat, dmaBufferModifiers });
 
         return bufferId;
     }
@@ -268,6 +279,75 @@ namespace ramses::internal
         return true;
     }
 
+    bool RamsesRendererImpl::setOffscreenBufferRenderRateDivisor(displayId_t display, displayBufferId_t offscreenBuffer, uint32_t divisor)
+    {
+        const auto it = m_displayFramebuffers.find(display);
+        if (it == m_displayFramebuffers.cend())
+        {
+            getErrorReporting().set("RamsesRenderer::setOffscreenBufferRenderRateDivisor failed: display does not exist.");
+            return false;
+        }
+
+        if (!offscreenBuffer.isValid() || offscreenBuffer == it->second)
+        {
+            getErrorReporting().set("RamsesRenderer::setOffscreenBufferRenderRateDivisor failed: render rate can only be set for offscreen buffer.");
+            return false;
+        }
+
+        if (divisor == 0u)
+        {
+            getErrorReporting().set("RamsesRenderer::setOffscreenBufferRenderRateDivisor failed: divisor must not be 0.");
+            return false;
+        }
+
+        const DisplayHandle displayHandle{ display.getValue() };
+        m_pendingRendererCommands.push_back(RendererCommand::SetRenderRateDivisor{ displayHandle, OffscreenBufferHandle{ offscreenBuffer.getValue() }, divisor });
+
+        return true;
+    }
+
+    bool RamsesRendererImpl::setOffscreenBufferScalable(displayId_t display, displayBufferId_t offscreenBuffer, bool scalable)
+    {
+        const auto it = m_displayFramebuffers.find(display);
+        if (it == m_displayFramebuffers.cend())
+        {
+            getErrorReporting().set("RamsesRenderer::setOffscreenBufferScalable failed: display does not exist.");
+            return false;
+        }
+
+        if (!offscreenBuffer.isValid() || offscreenBuffer == it->second)
+        {
+            getErrorReporting().set("RamsesRenderer::setOffscreenBufferScalable failed: only offscreen buffer can be scalable.");
+            return false;
+        }
+
+        const DisplayHandle displayHandle{ display.getValue() };
+        m_pendingRendererCommands.push_back(RendererCommand::SetOffscreenBufferScalable{ displayHandle, OffscreenBufferHandle{ offscreenBuffer.getValue() }, scalable });
+
+        return true;
+    }
+
+    bool RamsesRendererImpl::setDmaOffscreenBufferSyncFenceEnabled(displayId_t display, displayBufferId_t offscreenBuffer, bool enable)
+    {
+        const auto it = m_displayFramebuffers.find(display);
+        if (it == m_displayFramebuffers.cend())
+        {
+            getErrorReporting().set("RamsesRenderer::setDmaOffscreenBufferSyncFenceEnabled failed: display does not exist.");
+            return false;
+        }
+
+        if (!offscreenBuffer.isValid() || offscreenBuffer == it->second)
+        {
+            getErrorReporting().set("RamsesRenderer::setDmaOffscreenBufferSyncFenceEnabled failed: sync fence can be enabled only for DMA offscreen buffer.");
+            return false;
+        }
+
+        const DisplayHandle displayHandle{ display.getValue() };
+        m_pendingRendererCommands.push_back(RendererCommand::SetDmaOffscreenBufferSyncFence{ displayHandle, OffscreenBufferHandle{ offscreenBuffer.getValue() }, enable });
+
+        return true;
+    }
+
     bool RamsesRendererImpl::getDmaOffscreenBufferFDAndStride(displayId_t display, displayBufferId_t displayBufferId, int& fd, uint32_t& stride) const
     {
         const auto it = std::find_if(m_offscreenDmaBufferInfos.cbegin(), m_offscreenDmaBufferInfos.cend(), [&](const auto& dmaBufInfo){ return dmaBufInfo.display == display && dmaBufInfo.displayBuffer == displayBufferId;});
@@ -338,7 +418,71 @@ namespace ramses::internal
         return true;
     }
 
-    bool RamsesRendererImpl::readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    bool RamsesRendererImpl::updateExternalBufferFromDmaBuffer(displayId_t display, externalBufferId_t externalBuffer, int dmaBufferFD, uint32_t width, uint32_t height, uint32_t bufferFourccFormat, uint32_t stride, uint64_t modifier)
+    {
+        if (m_displayFramebuffers.count(display) == 0u)
+        {
+            getErrorReporting().set("RamsesRenderer::updateExternalBufferFromDmaBuffer failed: display does not exist.");
+            return false;
+        }
+
+        if (dmaBufferFD < 0 || width == 0u || height == 0u || stride == 0u)
+        {
+            getErrorReporting().set("RamsesRenderer::updateExternalBufferFromDmaBuffer failed: invalid DMA buffer FD, size or stride.");
+            return false;
+        }
+
+        const DmaBufferFrame frame{ dmaBufferFD, width, height, DmaBufferFourccFormat{ bufferFourccFormat }, stride, DmaBufferModifiers{ modifier } };
+        m_pendingRendererCommands.push_back(RendererCommand::UpdateExternalBufferDmaBuffer{ DisplayHandle{ display.getValue() }, ExternalBufferHandle{ externalBuffer.getValue() }, frame });
+
+        return true;
+    }
+
+    bool RamsesRendererImpl::linkDmaOffscreenBufferToExternalBuffer(displayId_t offscreenBufferDisplay, displayBufferId_t offscreenBuffer, displayId_t externalBufferDisplay, externalBufferId_t externalBuffer)
+    {
+        if (m_displayFramebuffers.count(offscreenBufferDisplay) == 0u || m_displayFramebuffers.count(externalBufferDisplay) == 0u)
+        {
+            getErrorReporting().set("RamsesRenderer::linkDmaOffscreenBufferToExternalBuffer failed: display does not exist.");
+            return false;
+        }
+
+        const auto formatIt = std::find_if(m_offscreenDmaBufferFormats.cbegin(), m_offscreenDmaBufferFormats.cend(),
+            [&](const auto& format) { return format.display == offscreenBufferDisplay && format.displayBuffer == offscreenBuffer; });
+        const auto infoIt = std::find_if(m_offscreenDmaBufferInfos.cbegin(), m_offscreenDmaBufferInfos.cend(),
+            [&](const auto& dmaBufInfo) { return dmaBufInfo.display == offscreenBufferDisplay && dmaBufInfo.displayBuffer == offscreenBuffer; });
+        if (formatIt == m_offscreenDmaBufferFormats.cend() || infoIt == m_offscreenDmaBufferInfos.cend() || infoIt->fd < 0)
+        {
+            getErrorReporting().set(::fmt::format("RamsesRenderer::linkDmaOffscreenBufferToExternalBuffer failed: no DMA buffer created for buffer {} on display {}", offscreenBuffer, offscreenBufferDisplay));
+            return false;
+        }
+
+        // DMA buffer is shared, import is needed only once and content rendered by producer is then directly visible to consumer
+        const DmaBufferFrame frame{ infoIt->fd, formatIt->width, formatIt->height, formatIt->fourccFormat, infoIt->stride, formatIt->modifiers };
+        m_pendingRendererCommands.push_back(RendererCommand::UpdateExternalBufferDmaBuffer{ DisplayHandle{ externalBufferDisplay.getValue() }, ExternalBufferHandle{ externalBuffer.getValue() }, frame });
+
+        removeDmaOffscreenBufferLinks([&](const auto& link) { return link.externalBufferDisplay == externalBufferDisplay && link.externalBuffer == externalBuffer; });
+        m_dmaOffscreenBufferLinks.push_back({ offscreenBufferDisplay, offscreenBuffer, externalBufferDisplay, externalBuffer });
+        LOG_INFO(CONTEXT_RENDERER, "RamsesRenderer::linkDmaOffscreenBufferToExternalBuffer: DMA offscreen buffer {} of display {} linked to external buffer {} of display {}",
+            offscreenBuffer, offscreenBufferDisplay, externalBuffer, externalBufferDisplay);
+
+        return true;
+    }
+
+    void RamsesRendererImpl::removeOffscreenDmaBufferFormat(displayId_t display, displayBufferId_t displayBuffer)
+    {
+        const auto it = std::find_if(m_offscreenDmaBufferFormats.cbegin(), m_offscreenDmaBufferFormats.cend(),
+            [&](const auto& format) { return format.display == display && format.displayBuffer == displayBuffer; });
+        if (it != m_offscreenDmaBufferFormats.cend())
+            m_offscreenDmaBufferFormats.erase(it);
+    }
+
+    template <typename PREDICATE>
+    void RamsesRendererImpl::removeDmaOffscreenBufferLinks(PREDICATE&& predicate)
+    {
+        m_dmaOffscreenBufferLinks.erase(std::remove_if(m_dmaOffscreenBufferLinks.begin(), m_dmaOffscreenBufferLinks.end(), predicate), m_dmaOffscreenBufferLinks.end());
+    }
+
+    bool RamsesRendererImpl::readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool nonBlocking)
     {
         if (width == 0u || height == 0u)
         {
@@ -357,7 +501,7 @@ namespace ramses::internal
         if (displayBuffer == it->second)
             bufferHandle = OffscreenBufferHandle::Invalid();
 
-        RendererCommand::ReadPixels cmd{ DisplayHandle{ displayId.getValue() }, bufferHandle, x, y, width, height, false, false, {} };
+        RendererCommand::ReadPixels cmd{ DisplayHandle{ displayId.getValue() }, bufferHandle, x, y, width, height, false, false, {}, nonBlocking };
         m_pendingRendererCommands.push_back(std::move(cmd));
 
         return true;
@@ -485,8 +629,13 @@ namespace ramses::internal
                 break;
             }
             case ERendererEventType::OffscreenBufferCreateFailed:
-                rendererEventHandler.offscreenBufferCreated(displayId_t{ event.displayHandle.asMemoryHandle() }, displayBufferId_t{ event.offscreenBuffer.asMemoryHandle() }, ERendererEventResult::Failed);
+            {
+                const displayId_t display{ event.displayHandle.asMemoryHandle() };
+                const displayBufferId_t displayBuffer{ event.offscreenBuffer.asMemoryHandle() };
+                rendererEventHandler.offscreenBufferCreated(display, displayBuffer, ERendererEventResult::Failed);
+                removeOffscreenDmaBufferFormat(display, displayBuffer);
                 break;
+            }
             case ERendererEventType::OffscreenBufferDestroyed:
             {
                 const displayId_t display{ event.displayHandle.asMemoryHandle() };
@@ -496,6 +645,8 @@ namespace ramses::internal
                 const auto it = std::find_if(m_offscreenDmaBufferInfos.cbegin(), m_offscreenDmaBufferInfos.cend(), [&](const auto& dmaBufInfo){ return dmaBufInfo.display == display && dmaBufInfo.displayBuffer == displayBuffer;});
                 if(it != m_offscreenDmaBufferInfos.cend())
                     m_offscreenDmaBufferInfos.erase(it);
+                removeOffscreenDmaBufferFormat(display, displayBuffer);
+                removeDmaOffscreenBufferLinks([&](const auto& link) { return link.offscreenBufferDisplay == display && link.offscreenBuffer == displayBuffer; });
                 break;
             }
             case ERendererEventType::OffscreenBufferDestroyFailed:
@@ -508,8 +659,13 @@ namespace ramses::internal
                 rendererEventHandler.externalBufferCreated(displayId_t{ event.displayHandle.asMemoryHandle() }, externalBufferId_t{ event.externalBuffer.asMemoryHandle() }, 0u, ERendererEventResult::Failed);
                 break;
             case ERendererEventType::ExternalBufferDestroyed:
-                rendererEventHandler.externalBufferDestroyed(displayId_t{ event.displayHandle.asMemoryHandle() }, externalBufferId_t{ event.externalBuffer.asMemoryHandle() }, ERendererEventResult::Ok);
+            {
+                const displayId_t display{ event.displayHandle.asMemoryHandle() };
+                const externalBufferId_t externalBuffer{ event.externalBuffer.asMemoryHandle() };
+                rendererEventHandler.externalBufferDestroyed(display, externalBuffer, ERendererEventResult::Ok);
+                removeDmaOffscreenBufferLinks([&](const auto& link) { return link.externalBufferDisplay == display && link.externalBuffer == externalBuffer; });
                 break;
+            }
             case ERendererEventType::ExternalBufferDestroyFailed:
                 rendererEventHandler.externalBufferDestroyed(displayId_t{ event.displayHandle.asMemoryHandle() }, externalBufferId_t{ event.externalBuffer.asMemoryHandle() }, ERendererEventResult::Failed);
                 break;
@@ -533,6 +689,29 @@ namespace ramses::internal
                 break;
             case ERendererEventType::FrameTimingReport:
                 rendererEventHandler.renderThreadLoopTimings(displayId_t{ event.displayHandle.asMemoryHandle() }, event.frameTimings.maximumLoopTimeWithinPeriod, event.frameTimings.averageLoopTimeWithinPeriod);
+                rendererEventHandler.renderThreadLoopTimingPercentiles(displayId_t{ event.displayHandle.asMemoryHandle() },
+                    event.frameTimings.loopTimePercentile50, event.frameTimings.loopTimePercentile90, event.frameTimings.loopTimePercentile99);
+                break;
+            case ERendererEventType::GpuMemoryReport:
+            {
+                const displayId_t displayId{ event.displayHandle.asMemoryHandle() };
+                for (const auto& sceneUsage : event.gpuMemoryReport.scenes)
+                    rendererEventHandler.sceneGpuMemoryUsage(displayId, sceneId_t{ sceneUsage.first.getValue() }, ToGpuMemoryUsage(sceneUsage.second));
+                rendererEventHandler.displayGpuMemoryUsage(displayId, ToGpuMemoryUsage(event.gpuMemoryReport.getTotal()), event.gpuMemoryReport.gpuCacheSize);
+                break;
+            }
+            case ERendererEventType::SceneFlushPresented:
+                rendererEventHandler.sceneFlushPresented(displayId_t{ event.displayHandle.asMemoryHandle() }, sceneId_t{ event.sceneId.getValue() }, event.sceneVersionTag.getValue(),
+                    std::chrono::duration_cast<std::chrono::microseconds>(event.flushPresentation.presentationTimestamp.time_since_epoch()), event.flushPresentation.latency);
+                break;
+            case ERendererEventType::MemoryTrimmed:
+                rendererEventHandler.memoryTrimmed(displayId_t{ event.displayHandle.asMemoryHandle() }, event.freedMemory);
+                break;
+            case ERendererEventType::DmaOffscreenBufferRendered:
+                rendererEventHandler.dmaOffscreenBufferRendered(displayId_t{ event.displayHandle.asMemoryHandle() }, displayBufferId_t{ event.offscreenBuffer.asMemoryHandle() }, event.syncFenceFD);
+                break;
+            case ERendererEventType::ExternalBufferDmaBufferReleased:
+                rendererEventHandler.externalBufferDmaBufferReleased(displayId_t{ event.displayHandle.asMemoryHandle() }, externalBufferId_t{ event.externalBuffer.asMemoryHandle() }, event.dmaBufferFD, event.syncFenceFD);
                 break;
             case ERendererEventType::Invalid:
             case ERendererEventType::ScenePublished:
@@ -554,6 +733,7 @@ namespace ramses::internal
             case ERendererEventType::SceneHiddenIndirect:
             case ERendererEventType::SceneHideFailed:
             case ERendererEventType::SceneFlushed:
+            case ERendererEventType::SceneResourcesComplete:
             case ERendererEventType::SceneExpirationMonitoringEnabled:
             case ERendererEventType::SceneExpirationMonitoringDisabled:
             case ERendererEventType::SceneExpired:
@@ -700,6 +880,12 @@ namespace ramses::internal
         return true;
     }
 
+    bool RamsesRendererImpl::trimMemory()
+    {
+        m_pendingRendererCommands.push_back(RendererCommand::TrimMemory{});
+        return true;
+    }
+
     void RamsesRendererImpl::pushAndConsumeRendererCommands(RendererCommands& cmds)
     {
         m_rendererCommandBuffer.addAndConsumeCommandsFrom(cmds);
@@ -10,6 +10,7 @@
 
 #include "ramses/renderer/Types.h"
 #include "ramses/renderer/RendererSceneControl.h"
+#include "ramses/renderer/BinaryShaderCache.h"
 #include "impl/DataTypesImpl.h"
 #include "impl/CommandDispatchingThread.h"
 #include "internal/RendererLib/RendererCommandBuffer.h"
@@ -24,6 +25,9 @@
 #include "internal/RendererLib/RamshCommands/TriggerPickEvent.h"
 #include "internal/RendererLib/RamshCommands/SetClearColor.h"
 #include "internal/RendererLib/RamshCommands/SetSkippingOfUnmodifiedBuffers.h"
+#include "internal/RendererLib/RamshCommands/SetGpuTimerQueries.h"
+#include "internal/RendererLib/RamshCommands/SetSkippingOfUnusedRenderPasses.h"
+#include "internal/RendererLib/RamshCommands/SetPartialRedraw.h"
 #include "internal/RendererLib/RamshCommands/SystemCompositorControllerListIviSurfaces.h"
 #include "internal/RendererLib/RamshCommands/SystemCompositorControllerSetLayerVisibility.h"
 #include "internal/RendererLib/RamshCommands/SystemCompositorControllerSetSurfaceVisibility.h"
@@ -77,7 +81,10 @@ namespace ramses::internal
         bool destroyOffscreenBuffer(displayId_t display, displayBufferId_t offscreenBuffer);
         bool setDisplayBufferClearFlags(displayId_t display, displayBufferId_t displayBuffer, ClearFlags clearFlags);
         bool setDisplayBufferClearColor(displayId_t display, displayBufferId_t displayBuffer, const vec4f& color);
+        bool setOffscreenBufferRenderRateDivisor(displayId_t display, displayBufferId_t offscreenBuffer, uint32_t divisor);
+        bool setOffscreenBufferScalable(displayId_t display, displayBufferId_t offscreenBuffer, bool scalable);
         bool getDmaOffscreenBufferFDAndStride(displayId_t display, displayBufferId_t displayBufferId, int& fd, uint32_t& stride) const;
+        bool setDmaOffscreenBufferSyncFenceEnabled(displayId_t display, displayBufferId_t offscreenBuffer, bool enable);
 
         streamBufferId_t allocateStreamBuffer();
         streamBufferId_t createStreamBuffer(displayId_t display, waylandIviSurfaceId_t source);
@@ -85,7 +92,9 @@ namespace ramses::internal
 
         externalBufferId_t createExternalBuffer(displayId_t display);
         bool destroyExternalBuffer(displayId_t display, externalBufferId_t externalTexture);
-        bool readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+        bool updateExternalBufferFromDmaBuffer(displayId_t display, externalBufferId_t externalBuffer, int dmaBufferFD, uint32_t width, uint32_t height, uint32_t bufferFourccFormat, uint32_t stride, uint64_t modifier);
+        bool linkDmaOffscreenBufferToExternalBuffer(displayId_t offscreenBufferDisplay, displayBufferId_t offscreenBuffer, displayId_t externalBufferDisplay, externalBufferId_t externalBuffer);
+        bool readPixels(displayId_t displayId, displayBufferId_t displayBuffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool nonBlocking);
 
         bool systemCompositorSetIviSurfaceVisibility(uint32_t surfaceId, bool visibility);
         bool systemCompositorSetIviSurfaceOpacity(uint32_t surfaceId, float opacity);
@@ -112,6 +121,7 @@ namespace ramses::internal
 
         bool setPendingFlushLimits(uint32_t forceApplyFlushLimit, uint32_t forceUnsubscribeSceneLimit);
         bool setSkippingOfUnmodifiedBuffers(bool enable);
+        bool trimMemory();
 
         const RendererCommands& getPendingCommands() const;
         void pushAndConsumeRendererCommands(RendererCommands& cmds);
@@ -122,7 +132,13 @@ namespace ramses::internal
         ErrorReporting& getErrorReporting() const;
 
     private:
+        void removeOffscreenDmaBufferFormat(displayId_t display, displayBufferId_t displayBuffer);
+        template <typename PREDICATE>
+        void removeDmaOffscreenBufferLinks(PREDICATE&& predicate);
+
         RamsesFrameworkImpl&                                  m_framework;
+        // in-memory cache used to share compiled shaders between displays if enabled and no user cache provided
+        std::unique_ptr<ramses::BinaryShaderCache>            m_crossDisplayShaderCache;
         std::unique_ptr<ramses::internal::IBinaryShaderCache> m_binaryShaderCache;
 
         RendererCommands                   m_pendingRendererCommands;
@@ -147,6 +163,27 @@ namespace ramses::internal
         };
         std::vector<OffscreenDmaBufferInfo> m_offscreenDmaBufferInfos;
 
+        // format as requested on creation of DMA offscreen buffer, needed to import it into external buffer of other display
+        struct OffscreenDmaBufferFormat
+        {
+            displayId_t display;
+            displayBufferId_t displayBuffer;
+            uint32_t width;
+            uint32_t height;
+            DmaBufferFourccFormat fourccFormat;
+            DmaBufferModifiers modifiers;
+        };
+        std::vector<OffscreenDmaBufferFormat> m_offscreenDmaBufferFormats;
+
+        struct DmaOffscreenBufferLink
+        {
+            displayId_t offscreenBufferDisplay;
+            displayBufferId_t offscreenBuffer;
+            displayId_t externalBufferDisplay;
+            externalBufferId_t externalBuffer;
+        };
+        std::vector<DmaOffscreenBufferLink> m_dmaOffscreenBufferLinks;
+
         ELoopMode m_loopMode;
         std::unique_ptr<CommandDispatchingThread> m_commandDispatchingThread;
         bool m_diplayThreadUpdating = false;
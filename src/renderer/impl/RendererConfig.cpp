@@ -45,6 +45,30 @@ namespace ramses
         return status;
     }
 
+    bool RendererConfig::enableCrossDisplayShaderSharing(bool enable)
+    {
+        const auto status = m_impl->enableCrossDisplayShaderSharing(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
+    bool RendererConfig::isCrossDisplayShaderSharingEnabled() const
+    {
+        return m_impl->isCrossDisplayShaderSharingEnabled();
+    }
+
+    bool RendererConfig::enableDisplayRestartCache(bool enable)
+    {
+        const auto status = m_impl->enableDisplayRestartCache(enable);
+        LOG_HL_RENDERER_API1(status, enable);
+        return status;
+    }
+
+    bool RendererConfig::isDisplayRestartCacheEnabled() const
+    {
+        return m_impl->isDisplayRestartCacheEnabled();
+    }
+
     bool RendererConfig::enableSystemCompositorControl()
     {
         const auto status = m_impl->enableSystemCompositorControl();
@@ -81,6 +105,13 @@ namespace ramses
         return m_impl->getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfig::setResourceDecompressionThreadScheduling(EThreadSchedulingPolicy policy, int32_t priority, const std::vector<uint32_t>& cpuAffinity)
+    {
+        const auto status = m_impl->setResourceDecompressionThreadScheduling(internal::ThreadScheduling{ policy, priority, cpuAffinity });
+        LOG_HL_RENDERER_API3(status, policy, priority, fmt::join(cpuAffinity, ","));
+        return status;
+    }
+
     internal::RendererConfigImpl& RendererConfig::impl()
     {
         return *m_impl;
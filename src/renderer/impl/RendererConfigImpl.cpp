@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "impl/RendererConfigImpl.h"
+#include "internal/Core/Utils/LogMacros.h"
 
 namespace ramses::internal
 {
@@ -46,6 +47,28 @@ namespace ramses::internal
         return m_binaryShaderCache;
     }
 
+    bool RendererConfigImpl::enableCrossDisplayShaderSharing(bool enable)
+    {
+        m_crossDisplayShaderSharing = enable;
+        return true;
+    }
+
+    bool RendererConfigImpl::isCrossDisplayShaderSharingEnabled() const
+    {
+        return m_crossDisplayShaderSharing;
+    }
+
+    bool RendererConfigImpl::enableDisplayRestartCache(bool enable)
+    {
+        m_internalConfig.setDisplayRestartCacheEnabled(enable);
+        return true;
+    }
+
+    bool RendererConfigImpl::isDisplayRestartCacheEnabled() const
+    {
+        return m_internalConfig.isDisplayRestartCacheEnabled();
+    }
+
     bool RendererConfigImpl::setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period)
     {
         m_internalConfig.setRenderthreadLooptimingReportingPeriod(period);
@@ -57,6 +80,22 @@ namespace ramses::internal
         return m_internalConfig.getRenderThreadLoopTimingReportingPeriod();
     }
 
+    bool RendererConfigImpl::setResourceDecompressionThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        if (!scheduling.hasValidPriority())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererConfig::setResourceDecompressionThreadScheduling failed - priority {} is not valid for policy {}!", scheduling.priority, scheduling.policy);
+            return false;
+        }
+        m_internalConfig.setResourceDecompressionThreadScheduling(scheduling);
+        return true;
+    }
+
+    const ThreadScheduling& RendererConfigImpl::getResourceDecompressionThreadScheduling() const
+    {
+        return m_internalConfig.getResourceDecompressionThreadScheduling();
+    }
+
     const ramses::internal::RendererConfigData& RendererConfigImpl::getInternalRendererConfig() const
     {
         return m_internalConfig;
@@ -32,8 +32,16 @@ namespace ramses::internal
         [[nodiscard]] bool setBinaryShaderCache(IBinaryShaderCache& cache);
         [[nodiscard]] ramses::IBinaryShaderCache* getBinaryShaderCache() const;
 
+        [[nodiscard]] bool enableCrossDisplayShaderSharing(bool enable);
+        [[nodiscard]] bool isCrossDisplayShaderSharingEnabled() const;
+
+        [[nodiscard]] bool enableDisplayRestartCache(bool enable);
+        [[nodiscard]] bool isDisplayRestartCacheEnabled() const;
+
         [[nodiscard]] bool setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
+        [[nodiscard]] bool setResourceDecompressionThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getResourceDecompressionThreadScheduling() const;
 
         //impl methods
         [[nodiscard]] const ramses::internal::RendererConfigData& getInternalRendererConfig() const;
@@ -41,5 +49,6 @@ namespace ramses::internal
     private:
         ramses::internal::RendererConfigData  m_internalConfig;
         IBinaryShaderCache*                m_binaryShaderCache{nullptr};
+        bool                               m_crossDisplayShaderSharing{false};
     };
 }
@@ -88,6 +88,48 @@ namespace ramses::internal
             m_handler2.renderThreadLoopTimings(displayId, maximumLoopTime, averageLooptime);
         }
 
+        void renderThreadLoopTimingPercentiles(displayId_t displayId, std::chrono::microseconds percentile50, std::chrono::microseconds percentile90, std::chrono::microseconds percentile99) override
+        {
+            m_handler1.renderThreadLoopTimingPercentiles(displayId, percentile50, percentile90, percentile99);
+            m_handler2.renderThreadLoopTimingPercentiles(displayId, percentile50, percentile90, percentile99);
+        }
+
+        void sceneGpuMemoryUsage(displayId_t displayId, sceneId_t sceneId, const GpuMemoryUsage& usage) override
+        {
+            m_handler1.sceneGpuMemoryUsage(displayId, sceneId, usage);
+            m_handler2.sceneGpuMemoryUsage(displayId, sceneId, usage);
+        }
+
+        void displayGpuMemoryUsage(displayId_t displayId, const GpuMemoryUsage& totalUsage, uint64_t gpuCacheSize) override
+        {
+            m_handler1.displayGpuMemoryUsage(displayId, totalUsage, gpuCacheSize);
+            m_handler2.displayGpuMemoryUsage(displayId, totalUsage, gpuCacheSize);
+        }
+
+        void sceneFlushPresented(displayId_t displayId, sceneId_t sceneId, sceneVersionTag_t sceneVersionTag, std::chrono::microseconds presentationTimestamp, std::chrono::microseconds flushLatency) override
+        {
+            m_handler1.sceneFlushPresented(displayId, sceneId, sceneVersionTag, presentationTimestamp, flushLatency);
+            m_handler2.sceneFlushPresented(displayId, sceneId, sceneVersionTag, presentationTimestamp, flushLatency);
+        }
+
+        void memoryTrimmed(displayId_t displayId, uint64_t freedMemory) override
+        {
+            m_handler1.memoryTrimmed(displayId, freedMemory);
+            m_handler2.memoryTrimmed(displayId, freedMemory);
+        }
+
+        void dmaOffscreenBufferRendered(displayId_t displayId, displayBufferId_t offscreenBufferId, int syncFenceFD) override
+        {
+            m_handler1.dmaOffscreenBufferRendered(displayId, offscreenBufferId, syncFenceFD);
+            m_handler2.dmaOffscreenBufferRendered(displayId, offscreenBufferId, syncFenceFD);
+        }
+
+        void externalBufferDmaBufferReleased(displayId_t displayId, externalBufferId_t externalBufferId, int dmaBufferFD, int releaseFenceFD) override
+        {
+            m_handler1.externalBufferDmaBufferReleased(displayId, externalBufferId, dmaBufferFD, releaseFenceFD);
+            m_handler2.externalBufferDmaBufferReleased(displayId, externalBufferId, dmaBufferFD, releaseFenceFD);
+        }
+
         void externalBufferCreated(displayId_t displayId, externalBufferId_t externalBufferId, uint32_t textureGlId, ERendererEventResult result) override
         {
             m_handler1.externalBufferCreated(displayId, externalBufferId, textureGlId, result);
@@ -186,6 +228,12 @@ namespace ramses::internal
             m_handler2.sceneFlushed(sceneId, sceneVersionTag);
         }
 
+        void sceneResourcesComplete(sceneId_t sceneId) override
+        {
+            m_handler1.sceneResourcesComplete(sceneId);
+            m_handler2.sceneResourcesComplete(sceneId);
+        }
+
         void sceneExpirationMonitoringEnabled(sceneId_t sceneId) override
         {
             m_handler1.sceneExpirationMonitoringEnabled(sceneId);
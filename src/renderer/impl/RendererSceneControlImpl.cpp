@@ -239,6 +239,9 @@ namespace ramses::internal
             case ERendererEventType::SceneFlushed:
                 eventHandler.sceneFlushed(sceneId_t(event.sceneId.getValue()), event.sceneVersionTag.getValue());
                 break;
+            case ERendererEventType::SceneResourcesComplete:
+                eventHandler.sceneResourcesComplete(sceneId_t(event.sceneId.getValue()));
+                break;
             case ERendererEventType::SceneExpirationMonitoringEnabled:
                 eventHandler.sceneExpirationMonitoringEnabled(sceneId_t(event.sceneId.getValue()));
                 break;
@@ -12,6 +12,7 @@
 #include <gbm.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <array>
 
 namespace ramses::internal
 {
@@ -24,6 +25,9 @@ namespace ramses::internal
 
     Device_EGL_Extension::~Device_EGL_Extension()
     {
+        for (const auto& externalTextureImage : m_externalTextureImages)
+            m_eglExtensionProcs.eglDestroyImageKHR(externalTextureImage.second);
+
         if(m_gbmDevice != nullptr)
         {
             LOG_INFO(CONTEXT_RENDERER, "Device_EGL_Extension::~Device_EGL_Extension(): Destroy GBM device");
@@ -60,6 +64,9 @@ namespace ramses::internal
             return false;
         }
 
+        if (!m_eglExtensionProcs.areNativeFenceSyncExtensionsSupported())
+            LOG_WARN(CONTEXT_RENDERER, "Device_EGL_Extension::init(): native fence sync EGL extension not supported, no sync fences can be provided for DMA buffers");
+
         LOG_INFO(CONTEXT_RENDERER, "Device_EGL_Extension::init(): init successful");
         return true;
     }
@@ -95,36 +102,7 @@ namespace ramses::internal
             return {};
         }
 
-        std::vector<EGLint> eglImageCreationAttribs;
-        eglImageCreationAttribs.push_back(EGL_WIDTH);
-        eglImageCreationAttribs.push_back(static_cast<EGLint>(width));
-        eglImageCreationAttribs.push_back(EGL_HEIGHT);
-        eglImageCreationAttribs.push_back(static_cast<EGLint>(height));
-        eglImageCreationAttribs.push_back(EGL_LINUX_DRM_FOURCC_EXT);
-        eglImageCreationAttribs.push_back(static_cast<EGLint>(bufferFormat));
-
-        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_FD_EXT);
-        eglImageCreationAttribs.push_back(bufferFD);
-        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_OFFSET_EXT);
-        eglImageCreationAttribs.push_back(0);
-        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_PITCH_EXT);
-        eglImageCreationAttribs.push_back(static_cast<EGLint>(bufferStride));
-
-        if(modifiers.isValid() && modifiers.getValue() != DRM_FORMAT_MOD_INVALID)
-        {
-            const uint64_t bufferModifiers = modifiers.getValue();
-            const auto bufferModifiersLowBytes   = static_cast<EGLint>(bufferModifiers & 0xffffffff);
-            const auto bufferModifiersHighBytes  = static_cast<EGLint>(bufferModifiers >> 32);
-
-            eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT);
-            eglImageCreationAttribs.push_back(bufferModifiersLowBytes);
-            eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT);
-            eglImageCreationAttribs.push_back(bufferModifiersHighBytes);
-        }
-
-        eglImageCreationAttribs.push_back(EGL_NONE);
-
-        const auto eglImage = m_eglExtensionProcs.eglCreateImageKHR(EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT, nullptr, eglImageCreationAttribs.data());
+        const auto eglImage = createDmaBufferImage(width, height, fourccFormat, bufferFD, bufferStride, modifiers);
         if (eglImage == EGL_NO_IMAGE)
         {
             LOG_ERROR(CONTEXT_RENDERER, "Device_EGL_Extension::createDmaRenderBuffer(): failed to create EGL Image, EGL error: {}! [width: {}, height: {}, format: {}, usage: {}, modifiers: {}, FD :{}, stride: {}]", eglGetError(), width, height, bufferFormat, bufferUsage, modifiers.getValue(), bufferFD, bufferStride);
@@ -155,6 +133,39 @@ namespace ramses::internal
         return resource.getStride();
     }
 
+    int Device_EGL_Extension::createDmaRenderBufferSyncFence([[maybe_unused]] DeviceResourceHandle handle)
+    {
+        assert(m_resourceMapper.containsResource(handle));
+        return createNativeFenceFD();
+    }
+
+    int Device_EGL_Extension::createNativeFenceFD() const
+    {
+        if (!m_eglExtensionProcs.areNativeFenceSyncExtensionsSupported())
+            return -1;
+
+        // native fence is signaled when GPU finished all commands submitted before its creation, including rendering into the buffer
+        const std::array<EGLint, 3u> syncAttribs{ EGL_SYNC_NATIVE_FENCE_FD_ANDROID, EGL_NO_NATIVE_FENCE_FD_ANDROID, EGL_NONE };
+        const auto sync = m_eglExtensionProcs.eglCreateSyncKHR(EGL_SYNC_NATIVE_FENCE_ANDROID, syncAttribs.data());
+        if (sync == EGL_NO_SYNC_KHR)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_EGL_Extension::createNativeFenceFD(): failed to create native fence sync, EGL error: {}", eglGetError());
+            return -1;
+        }
+
+        // native fence FD can only be retrieved after the fence command was flushed
+        glFlush();
+        const int syncFD = m_eglExtensionProcs.eglDupNativeFenceFDANDROID(sync);
+        m_eglExtensionProcs.eglDestroySyncKHR(sync);
+        if (syncFD == EGL_NO_NATIVE_FENCE_FD_ANDROID)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_EGL_Extension::createNativeFenceFD(): failed to get FD from native fence sync, EGL error: {}", eglGetError());
+            return -1;
+        }
+
+        return syncFD;
+    }
+
     void Device_EGL_Extension::destroyDmaRenderBuffer(DeviceResourceHandle handle)
     {
         const auto& resource = m_resourceMapper.getResourceAs<DmaRenderBufferGpuResource>(handle);
@@ -166,4 +177,77 @@ namespace ramses::internal
 
         m_resourceMapper.deleteResource(handle);
     }
+
+    bool Device_EGL_Extension::importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD)
+    {
+        releaseFenceFD = -1;
+        const auto eglImage = createDmaBufferImage(frame.width, frame.height, frame.fourccFormat, frame.fd, frame.stride, frame.modifiers);
+        if (eglImage == EGL_NO_IMAGE)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_EGL_Extension::importDmaBufferToExternalTexture(): failed to create EGL Image, EGL error: {}! [width: {}, height: {}, format: {}, modifiers: {}, FD :{}, stride: {}]",
+                eglGetError(), frame.width, frame.height, frame.fourccFormat.getValue(), frame.modifiers.getValue(), frame.fd, frame.stride);
+            return false;
+        }
+
+        glBindTexture(GL_TEXTURE_EXTERNAL_OES, m_resourceMapper.getGPUAddress(handle));
+        m_eglExtensionProcs.glEGLImageTargetTexture2DOES(GL_TEXTURE_EXTERNAL_OES, eglImage);
+
+        auto& textureImage = m_externalTextureImages[handle];
+        if (textureImage != EGL_NO_IMAGE)
+        {
+            // texture no longer references previous image, fence covers all sampling of it submitted so far
+            releaseFenceFD = createNativeFenceFD();
+            m_eglExtensionProcs.eglDestroyImageKHR(textureImage);
+        }
+        textureImage = eglImage;
+
+        return true;
+    }
+
+    int Device_EGL_Extension::releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle)
+    {
+        const auto it = m_externalTextureImages.find(handle);
+        if (it == m_externalTextureImages.cend())
+            return -1;
+
+        const int releaseFenceFD = createNativeFenceFD();
+        m_eglExtensionProcs.eglDestroyImageKHR(it->second);
+        m_externalTextureImages.erase(it);
+
+        return releaseFenceFD;
+    }
+
+    EGLImage Device_EGL_Extension::createDmaBufferImage(uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, int fd, uint32_t stride, DmaBufferModifiers modifiers) const
+    {
+        std::vector<EGLint> eglImageCreationAttribs;
+        eglImageCreationAttribs.push_back(EGL_WIDTH);
+        eglImageCreationAttribs.push_back(static_cast<EGLint>(width));
+        eglImageCreationAttribs.push_back(EGL_HEIGHT);
+        eglImageCreationAttribs.push_back(static_cast<EGLint>(height));
+        eglImageCreationAttribs.push_back(EGL_LINUX_DRM_FOURCC_EXT);
+        eglImageCreationAttribs.push_back(static_cast<EGLint>(fourccFormat.getValue()));
+
+        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_FD_EXT);
+        eglImageCreationAttribs.push_back(fd);
+        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_OFFSET_EXT);
+        eglImageCreationAttribs.push_back(0);
+        eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_PITCH_EXT);
+        eglImageCreationAttribs.push_back(static_cast<EGLint>(stride));
+
+        if(modifiers.isValid() && modifiers.getValue() != DRM_FORMAT_MOD_INVALID)
+        {
+            const uint64_t bufferModifiers = modifiers.getValue();
+            const auto bufferModifiersLowBytes   = static_cast<EGLint>(bufferModifiers & 0xffffffff);
+            const auto bufferModifiersHighBytes  = static_cast<EGLint>(bufferModifiers >> 32);
+
+            eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_MODIFIER_LO_EXT);
+            eglImageCreationAttribs.push_back(bufferModifiersLowBytes);
+            eglImageCreationAttribs.push_back(EGL_DMA_BUF_PLANE0_MODIFIER_HI_EXT);
+            eglImageCreationAttribs.push_back(bufferModifiersHighBytes);
+        }
+
+        eglImageCreationAttribs.push_back(EGL_NONE);
+
+        return m_eglExtensionProcs.eglCreateImageKHR(EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT, nullptr, eglImageCreationAttribs.data());
+    }
 }
@@ -14,6 +14,7 @@
 #include "internal/Platform/Wayland/WaylandEGLExtensionProcs.h"
 
 #include <string>
+#include <unordered_map>
 
 struct gbm_device;
 struct gbm_bo;
@@ -70,9 +71,15 @@ namespace ramses::internal
         DeviceResourceHandle    createDmaRenderBuffer       (uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, DmaBufferUsageFlags usageFlags, DmaBufferModifiers modifiers) override;
         int                     getDmaRenderBufferFD        (DeviceResourceHandle handle) override;
         uint32_t                getDmaRenderBufferStride    (DeviceResourceHandle handle) override;
+        int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) override;
         void                    destroyDmaRenderBuffer      (DeviceResourceHandle handle) override;
+        bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) override;
+        int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) override;
 
     private:
+        [[nodiscard]] EGLImage createDmaBufferImage(uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, int fd, uint32_t stride, DmaBufferModifiers modifiers) const;
+        [[nodiscard]] int createNativeFenceFD() const;
+
         DeviceResourceMapper& m_resourceMapper;
         WaylandEGLExtensionProcs m_eglExtensionProcs;
         const std::string m_renderNode;
@@ -98,5 +105,8 @@ namespace ramses::internal
         // For more information: https://github.com/robclark/libgbm/blob/master/gbm.h
         int m_drmRenderNodeFD = -1;
         gbm_device* m_gbmDevice = nullptr;
+
+        // EGL images of application DMA buffers currently used as content of external textures
+        std::unordered_map<DeviceResourceHandle, EGLImage> m_externalTextureImages;
     };
 }
@@ -8,7 +8,9 @@
 
 #include "internal/Platform/EGL/Context_EGL.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/Math3d/Quad.h"
 #include <array>
+#include <algorithm>
 
 namespace
 {
@@ -67,13 +69,14 @@ namespace
 
 namespace ramses::internal
 {
-    Context_EGL::Context_EGL(Generic_EGLNativeDisplayType eglDisplay, Generic_EGLNativeWindowType eglWindow, const EGLint* contextAttributes, const EGLint* surfaceAttributes, const EGLint* windowSurfaceAttributes, EGLint swapInterval, Context_EGL* sharedContext /*= 0*/)
+    Context_EGL::Context_EGL(Generic_EGLNativeDisplayType eglDisplay, Generic_EGLNativeWindowType eglWindow, const EGLint* contextAttributes, const EGLint* surfaceAttributes, const EGLint* windowSurfaceAttributes, EGLint swapInterval, uint32_t maxFramesInFlight, Context_EGL* sharedContext /*= 0*/)
         : m_nativeDisplay(eglDisplay)
         , m_nativeWindow(eglWindow)
         , m_contextAttributes(contextAttributes)
         , m_surfaceAttributes(surfaceAttributes)
         , m_windowSurfaceAttributes(windowSurfaceAttributes)
         , m_swapInterval(swapInterval)
+        , m_maxFramesInFlight(maxFramesInFlight)
     {
         if(nullptr != sharedContext)
         {
@@ -129,6 +132,7 @@ namespace ramses::internal
         if (isInitialized())
         {
             LOG_DEBUG(CONTEXT_RENDERER, "Context_EGL::destroy destroying surface and context");
+            destroyFrameFences();
 
             const bool isSharedContext = m_eglSurfaceData.eglSharedContext != nullptr;
 
@@ -178,9 +182,69 @@ namespace ramses::internal
     {
         LOG_TRACE(CONTEXT_RENDERER, "Context_EGL swapping buffers");
         eglSwapBuffers(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface);
+        insertFrameFenceAndWaitForFramesInFlight();
         return true;
     }
 
+    bool Context_EGL::swapBuffersWithDamage(const Quad& damagedRegion)
+    {
+        if (m_eglSwapBuffersWithDamage == nullptr)
+            return swapBuffers();
+
+        LOG_TRACE(CONTEXT_RENDERER, "Context_EGL swapping buffers with damage {}/{} {}x{}", damagedRegion.x, damagedRegion.y, damagedRegion.width, damagedRegion.height);
+        // empty damage would mean whole surface changed, pass at least one pixel if nothing changed
+        std::array<EGLint, 4u> rect{ damagedRegion.x, damagedRegion.y, std::max(damagedRegion.width, 1), std::max(damagedRegion.height, 1) };
+        m_eglSwapBuffersWithDamage(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, rect.data(), 1);
+        insertFrameFenceAndWaitForFramesInFlight();
+        return true;
+    }
+
+    void Context_EGL::insertFrameFenceAndWaitForFramesInFlight()
+    {
+        if (m_maxFramesInFlight == 0u || m_eglCreateSync == nullptr)
+            return;
+
+        EGLSyncKHR fence = m_eglCreateSync(m_eglSurfaceData.eglDisplay, EGL_SYNC_FENCE_KHR, nullptr);
+        if (fence == EGL_NO_SYNC_KHR)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Context_EGL::insertFrameFenceAndWaitForFramesInFlight eglCreateSyncKHR failed. Error code: {}", eglGetError());
+            return;
+        }
+        m_frameFences.push_back(fence);
+
+        // block until GPU finished enough frames, rather than letting the driver block unpredictably in next swap
+        constexpr EGLTimeKHR fenceTimeoutNs = 1000000000u;
+        while (m_frameFences.size() > m_maxFramesInFlight)
+        {
+            const EGLint result = m_eglClientWaitSync(m_eglSurfaceData.eglDisplay, m_frameFences.front(), EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, fenceTimeoutNs);
+            if (result == EGL_TIMEOUT_EXPIRED_KHR)
+                LOG_WARN(CONTEXT_RENDERER, "Context_EGL::insertFrameFenceAndWaitForFramesInFlight frame fence not signaled within 1s, GPU might be stalled");
+            else if (result == EGL_FALSE)
+                LOG_ERROR(CONTEXT_RENDERER, "Context_EGL::insertFrameFenceAndWaitForFramesInFlight eglClientWaitSyncKHR failed. Error code: {}", eglGetError());
+            m_eglDestroySync(m_eglSurfaceData.eglDisplay, m_frameFences.front());
+            m_frameFences.pop_front();
+        }
+    }
+
+    void Context_EGL::destroyFrameFences()
+    {
+        for (auto fence : m_frameFences)
+            m_eglDestroySync(m_eglSurfaceData.eglDisplay, fence);
+        m_frameFences.clear();
+    }
+
+    uint32_t Context_EGL::getBufferAge() const
+    {
+        if (!m_bufferAgeSupported)
+            return 0u;
+
+        EGLint age = 0;
+        if (eglQuerySurface(m_eglSurfaceData.eglDisplay, m_eglSurfaceData.eglSurface, EGL_BUFFER_AGE_EXT, &age) != EGL_TRUE || age < 0)
+            return 0u;
+
+        return static_cast<uint32_t>(age);
+    }
+
     bool Context_EGL::enable()
     {
         assert(isInitialized());
@@ -270,6 +334,31 @@ namespace ramses::internal
         {
             LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): EGL extensions: {}", contextExtensionsNativeString);
             parseContextExtensions(contextExtensionsNativeString);
+
+            if (m_contextExtensions.contains("EGL_KHR_swap_buffers_with_damage"))
+                m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+            else if (m_contextExtensions.contains("EGL_EXT_swap_buffers_with_damage"))
+                m_eglSwapBuffersWithDamage = reinterpret_cast<PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC>(eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+            m_bufferAgeSupported = isContextExtensionAvailable("buffer_age");
+
+            if (m_maxFramesInFlight > 0u)
+            {
+                if (m_contextExtensions.contains("EGL_KHR_fence_sync"))
+                {
+                    m_eglCreateSync = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(eglGetProcAddress("eglCreateSyncKHR"));
+                    m_eglClientWaitSync = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(eglGetProcAddress("eglClientWaitSyncKHR"));
+                    m_eglDestroySync = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(eglGetProcAddress("eglDestroySyncKHR"));
+                }
+                if (m_eglCreateSync == nullptr || m_eglClientWaitSync == nullptr || m_eglDestroySync == nullptr)
+                {
+                    LOG_WARN(CONTEXT_RENDERER, "Context_EGL::init(): EGL_KHR_fence_sync not supported, frames in flight will not be limited");
+                    m_eglCreateSync = nullptr;
+                }
+                else
+                {
+                    LOG_INFO(CONTEXT_RENDERER, "Context_EGL::init(): limiting frames in flight to {}", m_maxFramesInFlight);
+                }
+            }
         }
         else
         {
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <EGL/egl.h>
+#include <EGL/eglext.h>
 
 #undef Status
 #undef None
@@ -17,6 +18,8 @@
 
 #include "internal/RendererLib/PlatformBase/Context_Base.h"
 
+#include <deque>
+
 namespace ramses::internal
 {
     struct EglSurfaceData
@@ -44,12 +47,14 @@ namespace ramses::internal
 #endif
         using Generic_EGLNativeWindowType = void*;
 
-        Context_EGL(Generic_EGLNativeDisplayType eglDisplay, Generic_EGLNativeWindowType eglWindow, const EGLint* contextAttributes, const EGLint* surfaceAttributes, const EGLint* windowSurfaceAttributes, EGLint swapInterval, Context_EGL* sharedContext = nullptr);
+        Context_EGL(Generic_EGLNativeDisplayType eglDisplay, Generic_EGLNativeWindowType eglWindow, const EGLint* contextAttributes, const EGLint* surfaceAttributes, const EGLint* windowSurfaceAttributes, EGLint swapInterval, uint32_t maxFramesInFlight, Context_EGL* sharedContext = nullptr);
         ~Context_EGL() override;
 
         bool init();
 
         bool swapBuffers() override;
+        bool swapBuffersWithDamage(const Quad& damagedRegion) override;
+        [[nodiscard]] uint32_t getBufferAge() const override;
         bool enable() override;
         bool disable() override;
 
@@ -68,6 +73,8 @@ namespace ramses::internal
         void logUnmatchedEglConfigParams(const EGLint* surfaceAttributes) const;
         bool createEglSurface();
         bool createEglContext();
+        void insertFrameFenceAndWaitForFramesInFlight();
+        void destroyFrameFences();
 
         [[nodiscard]] bool isInitialized() const;
 
@@ -78,6 +85,17 @@ namespace ramses::internal
         const EGLint* m_surfaceAttributes;
         const EGLint* m_windowSurfaceAttributes;
         const EGLint m_swapInterval;
+
+        // EGL_KHR_swap_buffers_with_damage or EGL_EXT_swap_buffers_with_damage, both have same signature
+        PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC m_eglSwapBuffersWithDamage = nullptr;
+        bool m_bufferAgeSupported = false;
+
+        // EGL_KHR_fence_sync, fence inserted after every swap to limit number of frames GPU is behind, 0 means no limit
+        const uint32_t m_maxFramesInFlight;
+        PFNEGLCREATESYNCKHRPROC m_eglCreateSync = nullptr;
+        PFNEGLCLIENTWAITSYNCKHRPROC m_eglClientWaitSync = nullptr;
+        PFNEGLDESTROYSYNCKHRPROC m_eglDestroySync = nullptr;
+        std::deque<EGLSyncKHR> m_frameFences;
     };
 
 }
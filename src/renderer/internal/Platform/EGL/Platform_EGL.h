@@ -128,6 +128,7 @@ namespace ramses::internal
                 surfaceAttributes.data(),
                 nullptr,
                 swapInterval,
+                displayConfig.getMaxFramesInFlight(),
                 sharedContext);
 
             if (context->init())
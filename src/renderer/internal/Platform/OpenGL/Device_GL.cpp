@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/PlatformBase/RenderTargetGpuResource.h"
 #include "internal/RendererLib/PlatformBase/RenderBufferGPUResource.h"
+#include "internal/RendererLib/PlatformBase/BufferGPUResource.h"
 #include "internal/RendererLib/PlatformBase/IndexBufferGPUResource.h"
 #include "internal/RendererLib/PlatformBase/VertexArrayGPUResource.h"
 
@@ -28,10 +29,14 @@
 #include "internal/Core/Utils/TextureMathUtils.h"
 #include "internal/PlatformAbstraction/PlatformStringUtils.h"
 #include "internal/PlatformAbstraction/Macros.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
 #include "glm/gtc/type_ptr.hpp"
 
 #include "impl/TextureEnumsImpl.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace ramses::internal
 {
     std::mutex Device_GL::s_gladMutex;
@@ -64,6 +69,18 @@ namespace ramses::internal
         const GLTextureInfo m_textureInfo;
     };
 
+    // pixel buffer object filled by asynchronous read back and fence signaling when the read back finished
+    class ReadPixelsGPUResource_GL : public GPUResource
+    {
+    public:
+        ReadPixelsGPUResource_GL(GLHandle pixelBuffer, uint32_t dataSizeInBytes, GLsync fence)
+            : GPUResource(pixelBuffer, dataSizeInBytes)
+            , m_fence(fence)
+        {
+        }
+        const GLsync m_fence;
+    };
+
     Device_GL::Device_GL(IContext& context, IDeviceExtension* deviceExtension)
         : Device_Base(context)
         , m_activePrimitiveDrawMode(EDrawMode::Triangles)
@@ -115,6 +132,15 @@ namespace ramses::internal
         for (const auto& it : m_textureSamplerObjectsCache)
             deleteTextureSampler(it.second);
 
+        for (const auto& it : m_gpuTimerQueries)
+        {
+            if (it.second.queries[0] != 0u)
+                glDeleteQueries(static_cast<GLsizei>(it.second.queries.size()), it.second.queries.data());
+        }
+
+        deleteUniformBufferPool();
+        deleteStaticBufferPools();
+
         m_resourceMapper.deleteResource(m_framebufferRenderTarget);
     }
 
@@ -136,6 +162,12 @@ namespace ramses::internal
 
         PrintOpenGLExtensions();
         queryDeviceDependentFeatures();
+        m_textureUnitBindings.resize(m_limits.getMaximumTextureUnits());
+        loadGpuTimerQueryExtension();
+        loadParallelShaderCompileExtension();
+        loadSpirvShaderExtension();
+        loadBufferStorageExtension();
+        loadCopyImageExtension();
 
         m_framebufferRenderTarget = m_resourceMapper.registerResource(std::make_unique<RenderTargetGPUResource>(0));
 
@@ -164,12 +196,13 @@ namespace ramses::internal
             return;
         }
 
-        const size_t startOffsetAddressAsUInt = startOffset * m_activeIndexArrayElementSizeBytes;
+        const size_t startOffsetAddressAsUInt = m_activeIndexArrayOffsetBytes + startOffset * m_activeIndexArrayElementSizeBytes;
         const GLvoid* startOffsetAddress = reinterpret_cast<void*>(startOffsetAddressAsUInt);
 
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         const GLenum elementTypeGL = TypesConversion_GL::GetIndexElementType(m_activeIndexArrayElementSizeBytes);
         glDrawElementsInstanced(drawModeGL, elementCount, elementTypeGL, startOffsetAddress, static_cast<GLsizei>(instanceCount));
+        m_drawnSinceStreamingUniformBufferUpdate = true;
 
         // For profiling/tests
         Device_Base::drawIndexedTriangles(startOffset, elementCount, instanceCount);
@@ -179,6 +212,7 @@ namespace ramses::internal
     {
         const GLenum drawModeGL = TypesConversion_GL::GetDrawMode(m_activePrimitiveDrawMode);
         glDrawArraysInstanced(drawModeGL, startOffset, elementCount, static_cast<GLsizei>(instanceCount));
+        m_drawnSinceStreamingUniformBufferUpdate = true;
 
         // For profiling/tests
         Device_Base::drawTriangles(startOffset, elementCount, instanceCount);
@@ -404,7 +438,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const float* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform1fv(uniformLocation.getValue(), static_cast<GLsizei>(count), value);
         return uniformLocation.isValid();
     }
@@ -412,7 +446,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec2* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform2fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -420,7 +454,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec3* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform3fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -428,7 +462,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec4* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform4fv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -444,7 +478,7 @@ namespace ramses::internal
         }
 
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, m_containerForBoolValues.data(), count * sizeof(m_containerForBoolValues[0])))
             glUniform1iv(uniformLocation.getValue(), static_cast<GLsizei>(count), m_containerForBoolValues.data());
         return uniformLocation.isValid();
     }
@@ -452,7 +486,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const int32_t* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform1iv(uniformLocation.getValue(), static_cast<GLsizei>(count), value);
         return uniformLocation.isValid();
     }
@@ -460,7 +494,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec2* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform2iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -468,7 +502,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec3* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform3iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -476,7 +510,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec4* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniform4iv(uniformLocation.getValue(), static_cast<GLsizei>(count), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -484,7 +518,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat2* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniformMatrix2fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -492,7 +526,7 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat3* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniformMatrix3fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
@@ -500,13 +534,14 @@ namespace ramses::internal
     bool Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat4* value)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
-        if (uniformLocation.isValid())
+        if (uniformLocation.isValid() && m_activeShader->updateUniformValueCache(field, value, count * sizeof(value[0])))
             glUniformMatrix4fv(uniformLocation.getValue(), static_cast<GLsizei>(count), ToGLboolean(false), glm::value_ptr(value[0]));
         return uniformLocation.isValid();
     }
 
     DeviceResourceHandle Device_GL::allocateTexture2D(uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
+        invalidateTextureUnitBindings();
         const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_2D);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_2D, width, height, 1u, textureFormat, swizzle, texInfo);
@@ -517,6 +552,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateTexture3D(uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
+        invalidateTextureUnitBindings();
         const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_3D);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_3D, width, height, depth, textureFormat, DefaultTextureSwizzleArray, texInfo);
@@ -527,6 +563,7 @@ namespace ramses::internal
 
     DeviceResourceHandle Device_GL::allocateTextureCube(uint32_t faceSize, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, uint32_t mipLevelCount, uint32_t totalSizeInBytes)
     {
+        invalidateTextureUnitBindings();
         const GLHandle texID = GenerateAndBindTexture(GL_TEXTURE_CUBE_MAP);
         GLTextureInfo texInfo;
         fillGLInternalTextureInfo(GL_TEXTURE_CUBE_MAP, faceSize, faceSize, 1u, textureFormat, swizzle, texInfo);
@@ -540,6 +577,7 @@ namespace ramses::internal
         if (m_limits.isExternalTextureExtensionSupported())
         {
             const auto textureTarget = GL_TEXTURE_EXTERNAL_OES;
+            invalidateTextureUnitBindings();
             const GLHandle texID = GenerateAndBindTexture(textureTarget);
             GLTextureInfo texInfo;
             fillGLInternalTextureInfo(textureTarget, 0u, 0u, 1u, EPixelStorageFormat::RGBA8, {}, texInfo);
@@ -557,6 +595,7 @@ namespace ramses::internal
 
     void Device_GL::bindTexture(DeviceResourceHandle handle)
     {
+        invalidateTextureUnitBindings();
         const auto& gpuResource = m_resourceMapper.getResourceAs<TextureGPUResource_GL>(handle);
         glBindTexture(gpuResource.m_textureInfo.target, gpuResource.getGPUAddress());
     }
@@ -598,6 +637,7 @@ namespace ramses::internal
         assert(data != nullptr);
         LOG_DEBUG(CONTEXT_RENDERER, "Device_GL::uploadStreamTexture2D:  texid: {}, width: {}, height: {}, format: {}, textureSwizzle: {},{},{},{}", texID, width, height, EnumToString(format), EnumToString(swizzle[0]), EnumToString(swizzle[1]), EnumToString(swizzle[2]), EnumToString(swizzle[3]));
 
+        invalidateTextureUnitBindings();
         glBindTexture(GL_TEXTURE_2D, texID);
 
         GLTextureInfo texInfo;
@@ -774,6 +814,7 @@ namespace ramses::internal
         switch (accessMode)
         {
         case ERenderBufferAccessMode::ReadWrite:
+            invalidateTextureUnitBindings();
             bufferGLHandle = createTexture(width, height, format, sampleCount);
             break;
         case ERenderBufferAccessMode::WriteOnly:
@@ -794,6 +835,8 @@ namespace ramses::internal
         if(m_deviceExtension == nullptr)
             return {};
 
+        // extension binds the texture it creates
+        invalidateTextureUnitBindings();
         return m_deviceExtension->createDmaRenderBuffer(width, height, fourccFormat, usageFlags, modifiers);
     }
 
@@ -812,6 +855,13 @@ namespace ramses::internal
         return m_deviceExtension->getDmaRenderBufferStride(handle);
     }
 
+    int Device_GL::createDmaRenderBufferSyncFence(DeviceResourceHandle handle)
+    {
+        if(m_deviceExtension == nullptr)
+            return -1;
+        return m_deviceExtension->createDmaRenderBufferSyncFence(handle);
+    }
+
     void Device_GL::destroyDmaRenderBuffer(DeviceResourceHandle handle)
     {
         if(m_deviceExtension == nullptr)
@@ -820,12 +870,34 @@ namespace ramses::internal
         m_deviceExtension->destroyDmaRenderBuffer(handle);
     }
 
+    bool Device_GL::importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD)
+    {
+        releaseFenceFD = -1;
+        if(m_deviceExtension == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::importDmaBufferToExternalTexture: DMA buffers not supported, render node must be set for display");
+            return false;
+        }
+
+        // extension binds the external texture to attach the buffer
+        invalidateTextureUnitBindings();
+        return m_deviceExtension->importDmaBufferToExternalTexture(handle, frame, releaseFenceFD);
+    }
+
+    int Device_GL::releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle)
+    {
+        if(m_deviceExtension == nullptr)
+            return -1;
+        return m_deviceExtension->releaseDmaBufferOfExternalTexture(handle);
+    }
+
     void Device_GL::deleteRenderBuffer(DeviceResourceHandle bufferHandle)
     {
         const auto& resource = m_resourceMapper.getResourceAs<RenderBufferGPUResource>(bufferHandle);
         const GLHandle glAddress = resource.getGPUAddress();
         if (ERenderBufferAccessMode::ReadWrite == resource.getAccessMode())
         {
+            invalidateTextureUnitBindings();
             glDeleteTextures(1, &glAddress);
         }
         else if (ERenderBufferAccessMode::WriteOnly == resource.getAccessMode())
@@ -906,6 +978,12 @@ namespace ramses::internal
         const auto& resource = m_resourceMapper.getResourceAs<GPUResource>(handle);
         const GLHandle glAddress = resource.getGPUAddress();
         glDeleteSamplers(1, &glAddress);
+        // deleted sampler is unbound by GL, its name can be reused by next created sampler
+        for (auto& unitBinding : m_textureUnitBindings)
+        {
+            if (unitBinding.sampler == glAddress)
+                unitBinding.sampler = InvalidGLHandle;
+        }
 
         m_resourceMapper.deleteResource(handle);
     }
@@ -914,8 +992,14 @@ namespace ramses::internal
     {
         const TextureSlot textureSlot = m_activeShader->getTextureSlot(field).slot;
         assert(static_cast<uint32_t>(textureSlot) < m_limits.getMaximumTextureUnits());
-        const GLHandle glAddress = m_resourceMapper.getResource(handle).getGPUAddress();
-        glBindSampler(textureSlot, glAddress);
+        const GLHandle glAddress = m_resourceMapper.getGPUAddress(handle);
+
+        auto& unitBinding = m_textureUnitBindings[static_cast<size_t>(textureSlot)];
+        if (unitBinding.sampler != glAddress)
+        {
+            glBindSampler(textureSlot, glAddress);
+            unitBinding.sampler = glAddress;
+        }
     }
 
     void Device_GL::activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field)
@@ -995,7 +1079,7 @@ namespace ramses::internal
         }
         glDrawBuffers(static_cast<GLsizei>(colorBuffers.size()), colorBuffers.data());
 
-        const DeviceResourceHandle fboHandle = m_resourceMapper.registerResource(std::make_unique<RenderTargetGPUResource>(fboAddress));
+        const DeviceResourceHandle fboHandle = m_resourceMapper.registerResource(std::make_unique<RenderTargetGPUResource>(fboAddress, renderBuffers));
         return fboHandle;
     }
 
@@ -1017,6 +1101,17 @@ namespace ramses::internal
         glInvalidateFramebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(depthStencilAttachments.size()), depthStencilAttachments.data());
     }
 
+    void Device_GL::discardColorBuffers()
+    {
+        // Not to be used with default framebuffer, see discardDepthStencil.
+        // Color buffers are attached to consecutive slots (see uploadRenderTarget), attachments not present in framebuffer are ignored
+        std::array<GLenum, 16u> colorAttachments{};
+        const auto colorAttachmentsCount = std::min<size_t>(m_limits.getMaximumDrawBuffers(), colorAttachments.size());
+        for (size_t i = 0u; i < colorAttachmentsCount; ++i)
+            colorAttachments[i] = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+        glInvalidateFramebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(colorAttachmentsCount), colorAttachments.data());
+    }
+
     void Device_GL::BindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, size_t colorBufferSlot)
     {
         switch (renderBufferGpuResource.getAccessMode())
@@ -1085,6 +1180,9 @@ namespace ramses::internal
 
         const GLHandle rtGlAddress = rtResource->getGPUAddress();
         glBindFramebuffer(GL_FRAMEBUFFER, rtGlAddress);
+
+        // textures might have been bound outside of device (e.g. by embedded compositing) since last render pass
+        invalidateTextureUnitBindings();
     }
 
     void Device_GL::pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& renderTargets, const std::array<DeviceResourceHandle, 2>& colorBuffers)
@@ -1106,6 +1204,29 @@ namespace ramses::internal
         renderTargetPair->readingIndex = (renderTargetPair->readingIndex + 1) % 2;
     }
 
+    void Device_GL::invalidateStateCache()
+    {
+        invalidateTextureUnitBindings();
+        m_boundProgram = UnknownBinding;
+        m_boundVertexArray = UnknownBinding;
+    }
+
+    void Device_GL::bindVertexArray(GLHandle vertexArray)
+    {
+        if (m_boundVertexArray != vertexArray)
+        {
+            glBindVertexArray(vertexArray);
+            m_boundVertexArray = vertexArray;
+        }
+    }
+
+    void Device_GL::invalidateTextureUnitBindings()
+    {
+        // texture binds outside of activateTexture happen on currently active unit, which is not tracked afterwards
+        std::fill(m_textureUnitBindings.begin(), m_textureUnitBindings.end(), TextureUnitBinding{});
+        m_activeTextureUnit = -1;
+    }
+
     GLHandle Device_GL::GenerateAndBindTexture(GLenum target)
     {
         GLHandle texID = InvalidGLHandle;
@@ -1130,6 +1251,19 @@ namespace ramses::internal
         const auto& uniformBuffer = m_resourceMapper.getResource(handle);
         assert(dataSize <= uniformBuffer.getTotalSizeInBytes());
 
+        auto* streamingAllocation = findStreamingUniformBuffer(handle);
+        if (streamingAllocation != nullptr)
+        {
+            if (m_drawnSinceStreamingUniformBufferUpdate)
+                beginStreamingUniformBufferUpdateBatch();
+
+            auto& allocation = *streamingAllocation;
+            const uint32_t offset = m_uniformBufferPool->selectCopyForUpdate(allocation);
+            // mapping is coherent, written data are visible to all commands issued afterwards
+            std::memcpy(m_uniformBufferPoolChunks[allocation.chunk].mappedMemory + offset, data, dataSize);
+            return;
+        }
+
         glBindBuffer(GL_UNIFORM_BUFFER, uniformBuffer.getGPUAddress());
         glBufferData(GL_UNIFORM_BUFFER, dataSize, data, GL_DYNAMIC_DRAW);
     }
@@ -1138,38 +1272,276 @@ namespace ramses::internal
     {
         const auto& uniformBufferResource = m_resourceMapper.getResourceAs<const GPUResource>(handle);
         const auto uniformBufferBinding = m_activeShader->getUniformBufferBinding(field);
+
+        const auto* streamingAllocation = findStreamingUniformBuffer(handle);
+        if (streamingAllocation != nullptr)
+        {
+            glBindBufferRange(GL_UNIFORM_BUFFER, uniformBufferBinding.getValue(), uniformBufferResource.getGPUAddress(),
+                UniformBufferPool::GetActiveCopyOffset(*streamingAllocation), uniformBufferResource.getTotalSizeInBytes());
+            return;
+        }
+
         glBindBufferBase(GL_UNIFORM_BUFFER, uniformBufferBinding.getValue(), uniformBufferResource.getGPUAddress());
     }
 
     void Device_GL::deleteUniformBuffer(DeviceResourceHandle handle)
     {
-        const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
+        const auto* streamingAllocation = findStreamingUniformBuffer(handle);
+        if (streamingAllocation != nullptr)
+        {
+            // chunk is owned by pool, only the sub-allocation is released
+            m_uniformBufferPool->release(*streamingAllocation);
+            m_streamingUniformBuffers[handle.asMemoryHandle()].reset();
+            m_resourceMapper.deleteResource(handle);
+            return;
+        }
+
+        const GLHandle resourceAddress = m_resourceMapper.getGPUAddress(handle);
         glDeleteBuffers(1, &resourceAddress);
         m_resourceMapper.deleteResource(handle);
     }
 
-    DeviceResourceHandle Device_GL::allocateVertexBuffer(uint32_t totalSizeInBytes)
+    // values of GL_EXT_buffer_storage (equal to GL_ARB_buffer_storage), not part of GLAD generated API
+    static constexpr GLbitfield MapPersistentBit = 0x0040;
+    static constexpr GLbitfield MapCoherentBit = 0x0080;
+
+    DeviceResourceHandle Device_GL::allocateStreamingUniformBuffer(uint32_t totalSizeInBytes)
+    {
+        if (!m_uniformBufferPool || !m_uniformBufferPool->canAllocate(totalSizeInBytes))
+            return allocateUniformBuffer(totalSizeInBytes);
+
+        const auto allocation = m_uniformBufferPool->allocate(totalSizeInBytes);
+        while (allocation.chunk >= m_uniformBufferPoolChunks.size())
+        {
+            if (!addUniformBufferPoolChunk())
+            {
+                m_uniformBufferPool->release(allocation);
+                return allocateUniformBuffer(totalSizeInBytes);
+            }
+        }
+
+        const GLHandle chunkBuffer = m_uniformBufferPoolChunks[allocation.chunk].buffer;
+        const auto handle = m_resourceMapper.registerResource(std::make_unique<GPUResource>(chunkBuffer, totalSizeInBytes));
+        if (handle.asMemoryHandle() >= m_streamingUniformBuffers.size())
+            m_streamingUniformBuffers.resize(handle.asMemoryHandle() + 1u);
+        m_streamingUniformBuffers[handle.asMemoryHandle()] = allocation;
+
+        return handle;
+    }
+
+    UniformBufferPool::Allocation* Device_GL::findStreamingUniformBuffer(DeviceResourceHandle handle)
+    {
+        if (handle.asMemoryHandle() >= m_streamingUniformBuffers.size())
+            return nullptr;
+        auto& allocation = m_streamingUniformBuffers[handle.asMemoryHandle()];
+        return allocation ? &*allocation : nullptr;
+    }
+
+    bool Device_GL::addUniformBufferPoolChunk()
+    {
+        constexpr GLbitfield storageFlags = GL_MAP_WRITE_BIT | MapPersistentBit | MapCoherentBit;
+
+        UniformBufferPoolChunk chunk;
+        glGenBuffers(1, &chunk.buffer);
+        assert(chunk.buffer != InvalidGLHandle);
+        glBindBuffer(GL_UNIFORM_BUFFER, chunk.buffer);
+        m_glBufferStorage(GL_UNIFORM_BUFFER, UniformBufferPool::ChunkSizeInBytes, nullptr, storageFlags);
+        chunk.mappedMemory = static_cast<std::byte*>(glMapBufferRange(GL_UNIFORM_BUFFER, 0, UniformBufferPool::ChunkSizeInBytes, storageFlags));
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+        if (chunk.mappedMemory == nullptr)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::addUniformBufferPoolChunk: failed to map uniform buffer storage, falling back to regular uniform buffer");
+            glDeleteBuffers(1, &chunk.buffer);
+            return false;
+        }
+
+        m_uniformBufferPoolChunks.push_back(chunk);
+        return true;
+    }
+
+    void Device_GL::beginStreamingUniformBufferUpdateBatch()
+    {
+        m_drawnSinceStreamingUniformBufferUpdate = false;
+
+        // fence signals that GPU finished all commands issued before this batch, i.e. all draws reading copies written in previous batches.
+        // Copy written in batch N can be overwritten in batch N + BufferingCount at the earliest and is read only by draws issued
+        // before batch N + 1, waiting for fence of batch (current - BufferingCount + 1) is sufficient and typically does not block
+        m_uniformBufferPoolFences.push_back(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+        while (m_uniformBufferPoolFences.size() > UniformBufferPool::BufferingCount - 1u)
+        {
+            GLsync fence = m_uniformBufferPoolFences.front();
+            m_uniformBufferPoolFences.pop_front();
+            if (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED) == GL_WAIT_FAILED)
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::beginStreamingUniformBufferUpdateBatch: failed to wait for GPU to finish reading uniform buffers");
+            glDeleteSync(fence);
+        }
+
+        m_uniformBufferPool->beginUpdateBatch();
+    }
+
+    void Device_GL::deleteUniformBufferPool()
+    {
+        for (GLsync fence : m_uniformBufferPoolFences)
+            glDeleteSync(fence);
+        m_uniformBufferPoolFences.clear();
+
+        for (const auto& chunk : m_uniformBufferPoolChunks)
+            glDeleteBuffers(1, &chunk.buffer);
+        m_uniformBufferPoolChunks.clear();
+    }
+
+    StaticBufferPool::Allocation Device_GL::AllocateFromStaticBufferPool(StaticBufferPoolGL& pool, uint32_t sizeInBytes)
+    {
+        const auto allocation = pool.pool.allocate(sizeInBytes);
+        if (allocation.chunk >= pool.chunkBuffers.size())
+            pool.chunkBuffers.resize(allocation.chunk + 1u, InvalidGLHandle);
+
+        // chunk storage is created when chunk gets its first allocation, data of pooled buffers are uploaded into it as sub data
+        GLHandle& chunkBuffer = pool.chunkBuffers[allocation.chunk];
+        if (chunkBuffer == InvalidGLHandle)
+        {
+            glGenBuffers(1, &chunkBuffer);
+            assert(chunkBuffer != InvalidGLHandle);
+            glBindBuffer(pool.target, chunkBuffer);
+            glBufferData(pool.target, StaticBufferPool::ChunkSizeInBytes, nullptr, GL_STATIC_DRAW);
+        }
+
+        return allocation;
+    }
+
+    DeviceResourceHandle Device_GL::registerPooledStaticBuffer(std::unique_ptr<BufferGPUResource> buffer, const StaticBufferPool::Allocation& allocation)
+    {
+        const auto handle = m_resourceMapper.registerResource(std::move(buffer));
+        if (handle.asMemoryHandle() >= m_pooledStaticBuffers.size())
+            m_pooledStaticBuffers.resize(handle.asMemoryHandle() + 1u);
+        m_pooledStaticBuffers[handle.asMemoryHandle()] = allocation;
+
+        return handle;
+    }
+
+    const StaticBufferPool::Allocation* Device_GL::findPooledStaticBuffer(DeviceResourceHandle handle) const
+    {
+        if (handle.asMemoryHandle() >= m_pooledStaticBuffers.size())
+            return nullptr;
+        const auto& allocation = m_pooledStaticBuffers[handle.asMemoryHandle()];
+        return allocation ? &*allocation : nullptr;
+    }
+
+    void Device_GL::uploadPooledStaticBufferData(GLenum target, DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize)
+    {
+        const auto& buffer = m_resourceMapper.getResourceAs<BufferGPUResource>(handle);
+        glBindBuffer(target, buffer.getGPUAddress());
+        glBufferSubData(target, buffer.getOffsetInBytes() + offsetInBytes, dataSize, data);
+    }
+
+    bool Device_GL::releasePooledStaticBuffer(StaticBufferPoolGL& pool, DeviceResourceHandle handle)
+    {
+        const auto* allocation = findPooledStaticBuffer(handle);
+        if (allocation == nullptr)
+            return false;
+
+        // released block is merged with free neighbors right away, chunk left without allocations gives its storage back
+        if (pool.pool.release(*allocation))
+        {
+            auto& chunkBuffer = pool.chunkBuffers[allocation->chunk];
+            glDeleteBuffers(1, &chunkBuffer);
+            chunkBuffer = InvalidGLHandle;
+        }
+        m_pooledStaticBuffers[handle.asMemoryHandle()].reset();
+        m_resourceMapper.deleteResource(handle);
+        return true;
+    }
+
+    void Device_GL::deleteStaticBufferPools()
+    {
+        for (auto* pool : { &m_staticVertexBufferPool, &m_staticIndexBufferPool })
+        {
+            for (const auto chunkBuffer : pool->chunkBuffers)
+            {
+                if (chunkBuffer != InvalidGLHandle)
+                    glDeleteBuffers(1, &chunkBuffer);
+            }
+            pool->chunkBuffers.clear();
+        }
+    }
+
+    void Device_GL::AllocateBufferStorage(GLenum target, const BufferGPUResource& buffer)
     {
+        // static buffer gets its storage with the data uploaded once, updated buffers reserve full size upfront
+        // so that partial updates are valid before first full update
+        if (buffer.getUsage() == EDeviceBufferUsage::Static)
+            return;
+
+        glBindBuffer(target, buffer.getGPUAddress());
+        glBufferData(target, buffer.getTotalSizeInBytes(), nullptr, GL_DYNAMIC_DRAW);
+    }
+
+    void Device_GL::UploadBufferData(GLenum target, const BufferGPUResource& buffer, const std::byte* data, uint32_t dataSize)
+    {
+        glBindBuffer(target, buffer.getGPUAddress());
+        switch (buffer.getUsage())
+        {
+        case EDeviceBufferUsage::Static:
+            glBufferData(target, dataSize, data, GL_STATIC_DRAW);
+            break;
+        case EDeviceBufferUsage::Dynamic:
+            // orphan storage possibly still read by GPU, driver provides new one instead of stalling or making a ghost copy of old content
+            glBufferData(target, buffer.getTotalSizeInBytes(), nullptr, GL_DYNAMIC_DRAW);
+            glBufferSubData(target, 0, dataSize, data);
+            break;
+        }
+    }
+
+    DeviceResourceHandle Device_GL::allocateVertexBuffer(uint32_t totalSizeInBytes, EDeviceBufferUsage usage)
+    {
+        if (usage == EDeviceBufferUsage::Static && StaticBufferPool::CanAllocate(totalSizeInBytes))
+        {
+            bindVertexArray(0u); // make sure no VAO affected
+            const auto allocation = AllocateFromStaticBufferPool(m_staticVertexBufferPool, totalSizeInBytes);
+            const GLHandle chunkBuffer = m_staticVertexBufferPool.chunkBuffers[allocation.chunk];
+            return registerPooledStaticBuffer(std::make_unique<BufferGPUResource>(chunkBuffer, totalSizeInBytes, usage, allocation.offset), allocation);
+        }
+
         GLHandle glAddress = InvalidGLHandle;
         glGenBuffers(1, &glAddress);
         assert(glAddress != InvalidGLHandle);
 
-        return m_resourceMapper.registerResource(std::make_unique<GPUResource>(glAddress, totalSizeInBytes));
+        auto vertexBuffer = std::make_unique<BufferGPUResource>(glAddress, totalSizeInBytes, usage);
+        bindVertexArray(0u); // make sure no VAO affected
+        AllocateBufferStorage(GL_ARRAY_BUFFER, *vertexBuffer);
+
+        return m_resourceMapper.registerResource(std::move(vertexBuffer));
     }
 
     void Device_GL::uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize)
     {
-        const auto& vertexBuffer = m_resourceMapper.getResource(handle);
+        const auto& vertexBuffer = m_resourceMapper.getResourceAs<BufferGPUResource>(handle);
         assert(dataSize <= vertexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
+        bindVertexArray(0u); // make sure no VAO affected
+        if (findPooledStaticBuffer(handle) != nullptr)
+            uploadPooledStaticBufferData(GL_ARRAY_BUFFER, handle, 0u, data, dataSize);
+        else
+            UploadBufferData(GL_ARRAY_BUFFER, vertexBuffer, data, dataSize);
+    }
+
+    void Device_GL::uploadVertexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize)
+    {
+        const auto& vertexBuffer = m_resourceMapper.getResourceAs<BufferGPUResource>(handle);
+        assert(offsetInBytes + dataSize <= vertexBuffer.getTotalSizeInBytes());
+
+        bindVertexArray(0u); // make sure no VAO affected
         glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer.getGPUAddress());
-        glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, vertexBuffer.getOffsetInBytes() + offsetInBytes, dataSize, data);
     }
 
     void Device_GL::deleteVertexBuffer(DeviceResourceHandle handle)
     {
-        const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
+        if (releasePooledStaticBuffer(m_staticVertexBufferPool, handle))
+            return;
+
+        const GLHandle resourceAddress = m_resourceMapper.getGPUAddress(handle);
         glDeleteBuffers(1, &resourceAddress);
         m_resourceMapper.deleteResource(handle);
     }
@@ -1180,7 +1552,7 @@ namespace ramses::internal
 
         GLuint vertexArrayAddress = 0u;
         glGenVertexArrays(1, &vertexArrayAddress);
-        glBindVertexArray(vertexArrayAddress);
+        bindVertexArray(vertexArrayAddress);
 
         if (vertexArrayInfo.indexBuffer.isValid())
         {
@@ -1201,12 +1573,13 @@ namespace ramses::internal
                 continue;
             }
 
-            const GPUResource& arrayResource = m_resourceMapper.getResource(vb.deviceHandle);
+            const auto& arrayResource = m_resourceMapper.getResourceAs<BufferGPUResource>(vb.deviceHandle);
 
             const auto attributeDataType = BufferTypeToElementType(vb.bufferDataType);
             const auto elementSize = (vb.stride != 0u ? vb.stride : EnumToSize(attributeDataType));
 
-            const std::intptr_t offsetInBytes = vb.startVertex * elementSize + vb.offsetWithinElement;
+            // pooled buffer shares device buffer with others, its data start at its offset within the device buffer
+            const std::intptr_t offsetInBytes = arrayResource.getOffsetInBytes() + vb.startVertex * elementSize + vb.offsetWithinElement;
             const void* offsetAsPointer = reinterpret_cast<const void*>(offsetInBytes);
             const auto attributeNumComponents = static_cast<GLint>(EnumToNumComponents(attributeDataType));
 
@@ -1217,7 +1590,7 @@ namespace ramses::internal
             glVertexAttribDivisor(vertexInputAddress.getValue(), vb.instancingDivisor);
         }
 
-        glBindVertexArray(0u);
+        bindVertexArray(0u);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0u);
         glBindBuffer(GL_ARRAY_BUFFER, 0u);
 
@@ -1228,7 +1601,7 @@ namespace ramses::internal
     {
         assert(handle.isValid());
         const auto& vertexArrayResource = m_resourceMapper.getResourceAs<VertexArrayGPUResource>(handle);
-        glBindVertexArray(vertexArrayResource.getGPUAddress());
+        bindVertexArray(vertexArrayResource.getGPUAddress());
 
         const auto indexBuffer = vertexArrayResource.getIndexBufferHandle();
         if (indexBuffer.isValid())
@@ -1237,11 +1610,13 @@ namespace ramses::internal
             m_activeIndexArrayElementSizeBytes = indexBufferGPUResource.getElementSizeInBytes();
             assert(m_activeIndexArrayElementSizeBytes == 2 || m_activeIndexArrayElementSizeBytes == 4);
             m_activeIndexArraySizeBytes = indexBufferGPUResource.getTotalSizeInBytes();
+            m_activeIndexArrayOffsetBytes = indexBufferGPUResource.getOffsetInBytes();
         }
         else
         {
             m_activeIndexArrayElementSizeBytes = 0u;
             m_activeIndexArraySizeBytes = 0u;
+            m_activeIndexArrayOffsetBytes = 0u;
         }
     }
 
@@ -1250,39 +1625,87 @@ namespace ramses::internal
         const GPUResource& vertexArrayResource = m_resourceMapper.getResource(handle);
         const GLuint vertexArray = vertexArrayResource.getGPUAddress();
         glDeleteVertexArrays(1, &vertexArray);
+        // deleted vertex array is unbound by GL, its name can be reused
+        if (m_boundVertexArray == vertexArray)
+            m_boundVertexArray = 0u;
 
         m_resourceMapper.deleteResource(handle);
     }
 
-    DeviceResourceHandle Device_GL::allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes)
+    DeviceResourceHandle Device_GL::allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage)
     {
+        assert(dataType == EDataType::UInt16 || dataType == EDataType::UInt32);
+        if (usage == EDeviceBufferUsage::Static && StaticBufferPool::CanAllocate(sizeInBytes))
+        {
+            bindVertexArray(0u); // make sure no VAO affected
+            const auto allocation = AllocateFromStaticBufferPool(m_staticIndexBufferPool, sizeInBytes);
+            const GLHandle chunkBuffer = m_staticIndexBufferPool.chunkBuffers[allocation.chunk];
+            return registerPooledStaticBuffer(
+                std::make_unique<IndexBufferGPUResource>(chunkBuffer, sizeInBytes, dataType == EDataType::UInt16 ? 2 : 4, usage, allocation.offset), allocation);
+        }
+
         GLHandle glAddress = InvalidGLHandle;
         glGenBuffers(1, &glAddress);
         assert(glAddress != InvalidGLHandle);
-        assert(dataType == EDataType::UInt16 || dataType == EDataType::UInt32);
 
-        return m_resourceMapper.registerResource(std::make_unique<IndexBufferGPUResource>(glAddress, sizeInBytes, dataType == EDataType::UInt16 ? 2 : 4));
+        auto indexBuffer = std::make_unique<IndexBufferGPUResource>(glAddress, sizeInBytes, dataType == EDataType::UInt16 ? 2 : 4, usage);
+        bindVertexArray(0u); // make sure no VAO affected
+        AllocateBufferStorage(GL_ELEMENT_ARRAY_BUFFER, *indexBuffer);
+
+        return m_resourceMapper.registerResource(std::move(indexBuffer));
     }
 
     void Device_GL::uploadIndexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize)
     {
-        const auto& indexBuffer = m_resourceMapper.getResource(handle);
+        const auto& indexBuffer = m_resourceMapper.getResourceAs<IndexBufferGPUResource>(handle);
         assert(dataSize <= indexBuffer.getTotalSizeInBytes());
 
-        glBindVertexArray(0u); // make sure no VAO affected
+        bindVertexArray(0u); // make sure no VAO affected
+        if (findPooledStaticBuffer(handle) != nullptr)
+            uploadPooledStaticBufferData(GL_ELEMENT_ARRAY_BUFFER, handle, 0u, data, dataSize);
+        else
+            UploadBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBuffer, data, dataSize);
+    }
+
+    void Device_GL::uploadIndexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize)
+    {
+        const auto& indexBuffer = m_resourceMapper.getResourceAs<IndexBufferGPUResource>(handle);
+        assert(offsetInBytes + dataSize <= indexBuffer.getTotalSizeInBytes());
+
+        bindVertexArray(0u); // make sure no VAO affected
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getGPUAddress());
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexBuffer.getOffsetInBytes() + offsetInBytes, dataSize, data);
     }
 
     void Device_GL::deleteIndexBuffer(DeviceResourceHandle handle)
     {
-        const GLHandle resourceAddress = m_resourceMapper.getResource(handle).getGPUAddress();
+        if (releasePooledStaticBuffer(m_staticIndexBufferPool, handle))
+            return;
+
+        const GLHandle resourceAddress = m_resourceMapper.getGPUAddress(handle);
         glDeleteBuffers(1, &resourceAddress);
         m_resourceMapper.deleteResource(handle);
     }
 
+    std::unique_ptr<const GPUResource> Device_GL::uploadShaderFromSPIRV(const EffectResource& shader) const
+    {
+        if (m_glSpecializeShader == nullptr || shader.getVertexShaderSPIRVSize() == 0u)
+            return nullptr;
+
+        ShaderProgramInfo programInfo;
+        std::string debugErrorLog;
+        if (ShaderUploader_GL::UploadShaderProgramFromSPIRV(shader, m_glSpecializeShader, programInfo, debugErrorLog))
+            return std::make_unique<const ShaderGPUResource_GL>(shader, programInfo);
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::uploadShaderFromSPIRV: failed to create program from SPIR-V for effect {}, falling back to GLSL source: {}", shader.getName(), debugErrorLog);
+        return nullptr;
+    }
+
     std::unique_ptr<const GPUResource> Device_GL::uploadShader(const EffectResource& shader)
     {
+        if (auto shaderResource = uploadShaderFromSPIRV(shader))
+            return shaderResource;
+
         ShaderProgramInfo programInfo;
         std::string debugErrorLog;
         const bool uploadSuccessful = ShaderUploader_GL::UploadShaderProgramFromSource(shader, programInfo, debugErrorLog);
@@ -1295,6 +1718,54 @@ namespace ramses::internal
         return nullptr;
     }
 
+    std::vector<std::unique_ptr<const GPUResource>> Device_GL::uploadShaders(const std::vector<const EffectResource*>& shaders)
+    {
+        if (!m_parallelShaderCompileSupported || shaders.size() < 2u)
+            return Device_Base::uploadShaders(shaders);
+
+        // issue compile and link of all programs first, so that driver compiles them concurrently on its compiler threads,
+        // then poll completion and check results without blocking on any particular program
+        std::vector<std::unique_ptr<const GPUResource>> shaderResources(shaders.size());
+        std::vector<ShaderProgramInfo> programInfos(shaders.size());
+        std::vector<size_t> pendingPrograms;
+        pendingPrograms.reserve(shaders.size());
+
+        std::string debugErrorLog;
+        for (size_t i = 0u; i < shaders.size(); ++i)
+        {
+            // programs from SPIR-V are cheap to create, no need to compile them in parallel
+            shaderResources[i] = uploadShaderFromSPIRV(*shaders[i]);
+            if (shaderResources[i])
+                continue;
+
+            if (ShaderUploader_GL::StartShaderProgramCompilation(*shaders[i], programInfos[i], debugErrorLog))
+                pendingPrograms.push_back(i);
+            else
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::uploadShaders: shader upload failed: {}", debugErrorLog);
+        }
+
+        while (!pendingPrograms.empty())
+        {
+            const auto it = std::remove_if(pendingPrograms.begin(), pendingPrograms.end(), [&](size_t i) {
+                if (!ShaderUploader_GL::IsShaderProgramCompilationCompleted(programInfos[i]))
+                    return false;
+
+                if (ShaderUploader_GL::FinishShaderProgramCompilation(*shaders[i], programInfos[i], debugErrorLog))
+                    shaderResources[i] = std::make_unique<const ShaderGPUResource_GL>(*shaders[i], programInfos[i]);
+                else
+                    LOG_ERROR(CONTEXT_RENDERER, "Device_GL::uploadShaders: shader upload failed: {}", debugErrorLog);
+                return true;
+            });
+
+            const bool anyCompleted = (it != pendingPrograms.end());
+            pendingPrograms.erase(it, pendingPrograms.end());
+            if (!anyCompleted)
+                PlatformThread::Sleep(1u);
+        }
+
+        return shaderResources;
+    }
+
     DeviceResourceHandle Device_GL::registerShader(std::unique_ptr<const GPUResource> shaderResource)
     {
         return m_resourceMapper.registerResource(std::move(shaderResource));
@@ -1332,33 +1803,48 @@ namespace ramses::internal
             m_activeShader = nullptr;
         }
 
+        // shader resource unbinds program on destruction
         m_resourceMapper.deleteResource(handle);
+        m_boundProgram = 0u;
     }
 
     void Device_GL::activateShader(DeviceResourceHandle handle)
     {
         const auto& shaderProgramGL = m_resourceMapper.getResourceAs<ShaderGPUResource_GL>(handle);
-        glUseProgram(shaderProgramGL.getGPUAddress());
+        if (m_boundProgram != shaderProgramGL.getGPUAddress())
+        {
+            glUseProgram(shaderProgramGL.getGPUAddress());
+            m_boundProgram = shaderProgramGL.getGPUAddress();
+        }
         m_activeShader = &shaderProgramGL;
     }
 
     void Device_GL::deleteTexture(DeviceResourceHandle handle)
     {
+        invalidateTextureUnitBindings();
         const GPUResource& resource = m_resourceMapper.getResource(handle);
         const GLHandle glAddress = resource.getGPUAddress();
         glDeleteTextures(1, &glAddress);
         m_resourceMapper.deleteResource(handle);
     }
 
+    std::unique_ptr<const GPUResource> Device_GL::extractTexture(DeviceResourceHandle handle)
+    {
+        return m_resourceMapper.releaseResource(handle);
+    }
+
+    DeviceResourceHandle Device_GL::registerTexture(std::unique_ptr<const GPUResource> textureResource)
+    {
+        return m_resourceMapper.registerResource(std::move(textureResource));
+    }
+
     void Device_GL::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
     {
         const auto uniformLocation = m_activeShader->getUniformLocation(field);
         if (uniformLocation.isValid())
         {
             const TextureSlotInfo textureSlot = m_activeShader->getTextureSlot(field);
-
             assert(static_cast<uint32_t>(textureSlot.slot) < m_limits.getMaximumTextureUnits());
-            glActiveTexture(GL_TEXTURE0 + textureSlot.slot);
 
             const auto renderTargetPair = std::find_if(m_pairedRenderTargets.cbegin(), m_pairedRenderTargets.cend(), [handle](const RenderTargetPair& rtPair) -> bool {return rtPair.colorBuffers[0] == handle; });
 
@@ -1372,9 +1858,21 @@ namespace ramses::internal
                 resource = &m_resourceMapper.getResource(handle);
             }
 
+            // renderables drawn one after another often share textures (e.g. icons from same atlas), skip redundant binds
             const GLenum target = TypesConversion_GL::GetTextureTargetFromTextureInputType(textureSlot.textureType);
-            glBindTexture(target, resource->getGPUAddress());
-            glUniform1i(uniformLocation.getValue(), textureSlot.slot);
+            auto& unitBinding = m_textureUnitBindings[static_cast<size_t>(textureSlot.slot)];
+            if (unitBinding.target != target || unitBinding.texture != resource->getGPUAddress())
+            {
+                if (m_activeTextureUnit != textureSlot.slot)
+                {
+                    glActiveTexture(GL_TEXTURE0 + textureSlot.slot);
+                    m_activeTextureUnit = textureSlot.slot;
+                }
+                glBindTexture(target, resource->getGPUAddress());
+                unitBinding.target = target;
+                unitBinding.texture = resource->getGPUAddress();
+            }
+            // sampler uniform of the program is bound to the texture unit already when program is linked, see ShaderGPUResource_GL
         }
         else
         {
@@ -1384,7 +1882,7 @@ namespace ramses::internal
 
     uint32_t Device_GL::getTextureAddress(DeviceResourceHandle handle) const
     {
-        return m_resourceMapper.getResource(handle).getGPUAddress();
+        return m_resourceMapper.getGPUAddress(handle);
     }
 
     DeviceResourceHandle Device_GL::getFramebufferRenderTarget() const
@@ -1394,8 +1892,10 @@ namespace ramses::internal
 
     void Device_GL::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly)
     {
-        const GPUResource& rtSrcResource = m_resourceMapper.getResource(rtSrc);
-        const GPUResource& rtDstResource = m_resourceMapper.getResource(rtDst);
+        const auto& rtSrcResource = m_resourceMapper.getResourceAs<RenderTargetGPUResource>(rtSrc);
+        const auto& rtDstResource = m_resourceMapper.getResourceAs<RenderTargetGPUResource>(rtDst);
+        if (copyRenderTargetImage(rtSrcResource, rtDstResource, srcRect, dstRect, colorOnly))
+            return;
 
         const GLuint blittingSourceFrameBuffer = rtSrcResource.getGPUAddress();
         const GLuint blittingDestinationFrameBuffer = rtDstResource.getGPUAddress();
@@ -1415,9 +1915,47 @@ namespace ramses::internal
             static_cast<GLint>(dstRect.y + dstRect.height),
 
             blittingMask,
-            GL_NEAREST);
+            // linear filtering is only allowed for color, it smoothens color blits which scale content (e.g. reduced resolution offscreen buffers)
+            colorOnly ? GL_LINEAR : GL_NEAREST);
+    }
+
+
+    bool Device_GL::copyRenderTargetImage(const RenderTargetGPUResource& rtSrc, const RenderTargetGPUResource& rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly) const
+    {
+        // Image copy is equivalent to blit only for render targets with single buffer of same format and sample count (no resolve),
+        // same size of regions (no scaling or flipping) and regions fully within buffers (blit clips, copy fails).
+        if (m_glCopyImageSubData == nullptr || rtSrc.getRenderBuffers().size() != 1u || rtDst.getRenderBuffers().size() != 1u)
+            return false;
+        if (srcRect.width != dstRect.width || srcRect.height != dstRect.height || srcRect.width <= 0 || srcRect.height <= 0)
+            return false;
+
+        const auto& srcBuffer = m_resourceMapper.getResourceAs<RenderBufferGPUResource>(rtSrc.getRenderBuffers().front());
+        const auto& dstBuffer = m_resourceMapper.getResourceAs<RenderBufferGPUResource>(rtDst.getRenderBuffers().front());
+        if (srcBuffer.getStorageFormat() != dstBuffer.getStorageFormat() || srcBuffer.getSampleCount() != dstBuffer.getSampleCount())
+            return false;
+        // color only blit ignores depth/stencil content
+        if (colorOnly && IsDepthOrStencilFormat(srcBuffer.getStorageFormat()))
+            return false;
+
+        const auto isWithinBuffer = [](const PixelRectangle& rect, const RenderBufferGPUResource& buffer) {
+            return static_cast<int64_t>(rect.x) + rect.width <= static_cast<int64_t>(buffer.getWidth())
+                && static_cast<int64_t>(rect.y) + rect.height <= static_cast<int64_t>(buffer.getHeight());
+        };
+        if (!isWithinBuffer(srcRect, srcBuffer) || !isWithinBuffer(dstRect, dstBuffer))
+            return false;
+
+        m_glCopyImageSubData(srcBuffer.getGPUAddress(), GetRenderBufferImageTarget(srcBuffer), 0, static_cast<GLint>(srcRect.x), static_cast<GLint>(srcRect.y), 0,
+            dstBuffer.getGPUAddress(), GetRenderBufferImageTarget(dstBuffer), 0, static_cast<GLint>(dstRect.x), static_cast<GLint>(dstRect.y), 0,
+            static_cast<GLsizei>(srcRect.width), static_cast<GLsizei>(srcRect.height), 1);
+        return true;
     }
 
+    GLenum Device_GL::GetRenderBufferImageTarget(const RenderBufferGPUResource& renderBuffer)
+    {
+        if (renderBuffer.getAccessMode() == ERenderBufferAccessMode::WriteOnly)
+            return GL_RENDERBUFFER;
+        return renderBuffer.getSampleCount() != 0 ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+    }
 
     void Device_GL::PrintOpenGLExtensions()
     {
@@ -1442,6 +1980,123 @@ namespace ramses::internal
         }
     }
 
+    bool Device_GL::IsOpenGLExtensionAvailable(std::string_view extensionName)
+    {
+        GLint numExtensions = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+        for (auto i = 0; i < numExtensions; i++)
+        {
+            if (extensionName == reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i)))
+                return true;
+        }
+        return false;
+    }
+
+    void Device_GL::loadGpuTimerQueryExtension()
+    {
+        // timer queries are not part of GLAD generated API, load entry point of either ES or desktop GL extension
+        const char* procName = nullptr;
+        if (IsOpenGLExtensionAvailable("GL_EXT_disjoint_timer_query"))
+        {
+            procName = "glGetQueryObjectui64vEXT";
+            m_gpuTimerDisjointSupported = true;
+        }
+        else if (IsOpenGLExtensionAvailable("GL_ARB_timer_query"))
+        {
+            procName = "glGetQueryObjectui64v";
+        }
+
+        if (procName != nullptr)
+            m_glGetQueryObjectui64v = reinterpret_cast<GetQueryObjectui64vFunc>(m_context.getGlProcLoadFunc()(procName));
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadGpuTimerQueryExtension: GPU timer queries support = {}", m_glGetQueryObjectui64v != nullptr);
+    }
+
+    void Device_GL::loadParallelShaderCompileExtension()
+    {
+        // parallel shader compile is not part of GLAD generated API, load entry point of either KHR or ARB extension
+        const char* procName = nullptr;
+        if (IsOpenGLExtensionAvailable("GL_KHR_parallel_shader_compile"))
+        {
+            procName = "glMaxShaderCompilerThreadsKHR";
+        }
+        else if (IsOpenGLExtensionAvailable("GL_ARB_parallel_shader_compile"))
+        {
+            procName = "glMaxShaderCompilerThreadsARB";
+        }
+
+        if (procName != nullptr)
+        {
+            const auto maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsFunc>(m_context.getGlProcLoadFunc()(procName));
+            if (maxShaderCompilerThreads != nullptr)
+            {
+                // let implementation choose number of compiler threads
+                maxShaderCompilerThreads(0xFFFFFFFFu);
+                m_parallelShaderCompileSupported = true;
+            }
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadParallelShaderCompileExtension: parallel shader compile support = {}", m_parallelShaderCompileSupported);
+    }
+
+    void Device_GL::loadSpirvShaderExtension()
+    {
+        // SPIR-V ingestion exists only for desktop GL, not part of GLAD generated API
+        if (IsOpenGLExtensionAvailable("GL_ARB_gl_spirv"))
+            m_glSpecializeShader = reinterpret_cast<ShaderUploader_GL::SpecializeShaderFunc>(m_context.getGlProcLoadFunc()("glSpecializeShaderARB"));
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadSpirvShaderExtension: SPIR-V shaders support = {}", m_glSpecializeShader != nullptr);
+    }
+
+    void Device_GL::loadBufferStorageExtension()
+    {
+        // buffer storage is not part of GLAD generated API, load entry point of either ES or desktop GL extension
+        const char* procName = nullptr;
+        if (IsOpenGLExtensionAvailable("GL_EXT_buffer_storage"))
+        {
+            procName = "glBufferStorageEXT";
+        }
+        else if (IsOpenGLExtensionAvailable("GL_ARB_buffer_storage"))
+        {
+            procName = "glBufferStorage";
+        }
+
+        if (procName != nullptr)
+            m_glBufferStorage = reinterpret_cast<BufferStorageFunc>(m_context.getGlProcLoadFunc()(procName));
+
+        if (m_glBufferStorage != nullptr)
+        {
+            GLint offsetAlignment = 0;
+            glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);
+            m_uniformBufferPool.emplace(static_cast<uint32_t>(offsetAlignment));
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadBufferStorageExtension: persistently mapped streaming uniform buffers support = {}", m_uniformBufferPool.has_value());
+    }
+
+    void Device_GL::loadCopyImageExtension()
+    {
+        // core since ES 3.2, otherwise load entry point of ES or desktop GL extension
+        const char* procName = nullptr;
+        if (glCopyImageSubData != nullptr || IsOpenGLExtensionAvailable("GL_ARB_copy_image"))
+        {
+            procName = "glCopyImageSubData";
+        }
+        else if (IsOpenGLExtensionAvailable("GL_EXT_copy_image"))
+        {
+            procName = "glCopyImageSubDataEXT";
+        }
+        else if (IsOpenGLExtensionAvailable("GL_OES_copy_image"))
+        {
+            procName = "glCopyImageSubDataOES";
+        }
+
+        if (procName != nullptr)
+            m_glCopyImageSubData = reinterpret_cast<CopyImageSubDataFunc>(m_context.getGlProcLoadFunc()(procName));
+
+        LOG_INFO(CONTEXT_RENDERER, "Device_GL::loadCopyImageExtension: image copy for blits support = {}", m_glCopyImageSubData != nullptr);
+    }
+
     void Device_GL::queryDeviceDependentFeatures()
     {
         GLint max_textures(0);
@@ -1530,6 +2185,68 @@ namespace ramses::internal
         glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, static_cast<void*>(buffer));
     }
 
+    DeviceResourceHandle Device_GL::startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        const uint32_t dataSize = width * height * 4u;
+        GLHandle pixelBuffer = InvalidGLHandle;
+        glGenBuffers(1, &pixelBuffer);
+        assert(pixelBuffer != InvalidGLHandle);
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, pixelBuffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, dataSize, nullptr, GL_STREAM_READ);
+        // with pixel pack buffer bound the read back only schedules a copy into the buffer, it does not wait for GPU
+        glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // make sure the fence gets signaled even if nothing else flushes the command stream
+        glFlush();
+
+        return m_resourceMapper.registerResource(std::make_unique<ReadPixelsGPUResource_GL>(pixelBuffer, dataSize, fence));
+    }
+
+    bool Device_GL::finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut)
+    {
+        const auto& readPixelsResource = m_resourceMapper.getResourceAs<ReadPixelsGPUResource_GL>(handle);
+        const GLenum fenceState = glClientWaitSync(readPixelsResource.m_fence, 0, 0u);
+        if (fenceState == GL_TIMEOUT_EXPIRED)
+            return false;
+
+        dataOut.clear();
+        if (fenceState == GL_WAIT_FAILED)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "Device_GL::finishReadPixels: failed to wait for read back fence");
+        }
+        else
+        {
+            const auto dataSize = readPixelsResource.getTotalSizeInBytes();
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, readPixelsResource.getGPUAddress());
+            const auto* mappedData = static_cast<const uint8_t*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(dataSize), GL_MAP_READ_BIT));
+            if (mappedData != nullptr)
+            {
+                dataOut.assign(mappedData, mappedData + dataSize);
+                glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            }
+            else
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "Device_GL::finishReadPixels: failed to map pixel buffer");
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0u);
+        }
+
+        deleteReadPixels(handle);
+        return true;
+    }
+
+    void Device_GL::deleteReadPixels(DeviceResourceHandle handle)
+    {
+        const auto& readPixelsResource = m_resourceMapper.getResourceAs<ReadPixelsGPUResource_GL>(handle);
+        glDeleteSync(readPixelsResource.m_fence);
+        const GLHandle pixelBuffer = readPixelsResource.getGPUAddress();
+        glDeleteBuffers(1, &pixelBuffer);
+        m_resourceMapper.deleteResource(handle);
+    }
+
     uint32_t Device_GL::getTotalGpuMemoryUsageInKB() const
     {
         return m_resourceMapper.getTotalGpuMemoryUsageInKB();
@@ -1568,8 +2285,103 @@ namespace ramses::internal
         return m_limits.isExternalTextureExtensionSupported();
     }
 
+    // values of GL_EXT_disjoint_timer_query (GL_TIME_ELAPSED equals GL_ARB_timer_query)
+    static constexpr GLenum TimeElapsedQueryTarget = 0x88BF;
+    static constexpr GLenum GpuDisjointQueryState = 0x8FBB;
+
+    bool Device_GL::beginGpuTimerQuery(uint64_t queryId)
+    {
+        if (m_glGetQueryObjectui64v == nullptr || m_activeGpuTimerQuery != 0u)
+            return false;
+
+        auto& timerQueries = m_gpuTimerQueries[queryId];
+        if (timerQueries.queries[0] == 0u)
+            glGenQueries(static_cast<GLsizei>(timerQueries.queries.size()), timerQueries.queries.data());
+
+        const uint32_t queryIdx = timerQueries.nextQuery;
+        if (timerQueries.pending[queryIdx])
+            return false;
+
+        glBeginQuery(TimeElapsedQueryTarget, timerQueries.queries[queryIdx]);
+        timerQueries.pending[queryIdx] = true;
+        timerQueries.nextQuery = (queryIdx + 1u) % static_cast<uint32_t>(timerQueries.queries.size());
+        m_activeGpuTimerQuery = timerQueries.queries[queryIdx];
+
+        return true;
+    }
+
+    void Device_GL::endGpuTimerQuery()
+    {
+        if (m_activeGpuTimerQuery == 0u)
+            return;
+
+        glEndQuery(TimeElapsedQueryTarget);
+        m_activeGpuTimerQuery = 0u;
+    }
+
+    void Device_GL::collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& results)
+    {
+        if (m_glGetQueryObjectui64v == nullptr)
+            return;
+
+        // results of queries pending during a disjoint operation (e.g. GPU frequency change) are undefined
+        GLint disjoint = 0;
+        if (m_gpuTimerDisjointSupported)
+            glGetIntegerv(GpuDisjointQueryState, &disjoint);
+
+        for (auto& it : m_gpuTimerQueries)
+        {
+            auto& timerQueries = it.second;
+            for (size_t i = 0u; i < timerQueries.queries.size(); ++i)
+            {
+                if (!timerQueries.pending[i] || timerQueries.queries[i] == m_activeGpuTimerQuery)
+                    continue;
+
+                GLuint available = 0u;
+                glGetQueryObjectuiv(timerQueries.queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+                if (available == 0u)
+                    continue;
+
+                GLuint64 elapsedNanoseconds = 0u;
+                m_glGetQueryObjectui64v(timerQueries.queries[i], GL_QUERY_RESULT, &elapsedNanoseconds);
+                timerQueries.pending[i] = false;
+                if (disjoint == 0)
+                    results.push_back({ it.first, std::chrono::nanoseconds{ elapsedNanoseconds } });
+            }
+        }
+    }
+
+    void Device_GL::deleteGpuTimerQueries(uint64_t queryId)
+    {
+        const auto it = m_gpuTimerQueries.find(queryId);
+        if (it == m_gpuTimerQueries.end())
+            return;
+
+        auto& timerQueries = it->second;
+        assert(m_activeGpuTimerQuery == 0u);
+        if (timerQueries.queries[0] != 0u)
+            glDeleteQueries(static_cast<GLsizei>(timerQueries.queries.size()), timerQueries.queries.data());
+        m_gpuTimerQueries.erase(it);
+    }
+
     void Device_GL::flush()
     {
         glFlush();
     }
+
+    DeviceFence Device_GL::insertFence()
+    {
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        // fence must be flushed to be ever signaled when waited for from another context
+        glFlush();
+        return DeviceFence{ fence };
+    }
+
+    void Device_GL::waitFence(DeviceFence fence)
+    {
+        auto glFence = static_cast<GLsync>(fence.getValue());
+        glWaitSync(glFence, 0, GL_TIMEOUT_IGNORED);
+        // deletion is deferred by driver until the wait is done
+        glDeleteSync(glFence);
+    }
 }
@@ -10,18 +10,28 @@
 
 #include "internal/RendererLib/PlatformBase/Device_Base.h"
 #include "internal/RendererLib/PlatformBase/DeviceResourceMapper.h"
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
+#include "internal/RendererLib/PlatformBase/StaticBufferPool.h"
 #include "Types_GL.h"
 #include "DebugOutput.h"
+#include "ShaderUploader_GL.h"
 #include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
 
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <array>
+#include <deque>
 #include <mutex>
+#include <optional>
+#include <limits>
 
 namespace ramses::internal
 {
     class ShaderGPUResource_GL;
     class RenderBufferGPUResource;
+    class RenderTargetGPUResource;
+    class BufferGPUResource;
     class IDeviceExtension;
     struct GLTextureInfo;
 
@@ -67,25 +77,32 @@ namespace ramses::internal
         bool setConstant(DataFieldHandle field, uint32_t count, const glm::mat4*  value) override;
 
         void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        DeviceResourceHandle startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut) override;
+        void deleteReadPixels(DeviceResourceHandle handle) override;
 
         DeviceResourceHandle    allocateUniformBuffer   (uint32_t totalSizeInBytes) override;
         void                    uploadUniformBufferData (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
         void                    activateUniformBuffer   (DeviceResourceHandle handle, DataFieldHandle field) override;
         void                    deleteUniformBuffer     (DeviceResourceHandle handle) override;
+        DeviceResourceHandle    allocateStreamingUniformBuffer(uint32_t totalSizeInBytes) override;
 
-        DeviceResourceHandle    allocateVertexBuffer  (uint32_t totalSizeInBytes) override;
+        DeviceResourceHandle    allocateVertexBuffer  (uint32_t totalSizeInBytes, EDeviceBufferUsage usage) override;
         void                    uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    uploadVertexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void                    deleteVertexBuffer    (DeviceResourceHandle handle) override;
 
         DeviceResourceHandle    allocateVertexArray   (const VertexArrayInfo& vertexArrayInfo) override;
         void                    activateVertexArray   (DeviceResourceHandle handle) override;
         void                    deleteVertexArray     (DeviceResourceHandle handle) override;
 
-        DeviceResourceHandle    allocateIndexBuffer   (EDataType dataType, uint32_t sizeInBytes) override;
+        DeviceResourceHandle    allocateIndexBuffer   (EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage) override;
         void                    uploadIndexBufferData (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    uploadIndexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void                    deleteIndexBuffer     (DeviceResourceHandle handle) override;
 
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& shader) override;
+        std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& shaders) override;
         DeviceResourceHandle    registerShader      (std::unique_ptr<const GPUResource> shaderResource) override;
         DeviceResourceHandle    uploadBinaryShader  (const EffectResource& shader, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat) override;
         bool                    getBinaryShader     (DeviceResourceHandle handleconst, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
@@ -103,6 +120,8 @@ namespace ramses::internal
         void                    uploadTextureData   (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) override;
         DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
         void                    deleteTexture       (DeviceResourceHandle handle) override;
+        std::unique_ptr<const GPUResource> extractTexture(DeviceResourceHandle handle) override;
+        DeviceResourceHandle    registerTexture     (std::unique_ptr<const GPUResource> textureResource) override;
         void                    activateTexture     (DeviceResourceHandle handle, DataFieldHandle field) override;
         uint32_t                getTextureAddress   (DeviceResourceHandle handle) const override;
 
@@ -112,7 +131,10 @@ namespace ramses::internal
         DeviceResourceHandle    uploadDmaRenderBuffer   (uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, DmaBufferUsageFlags usageFlags, DmaBufferModifiers modifiers) override;
         int                     getDmaRenderBufferFD    (DeviceResourceHandle handle) override;
         uint32_t                getDmaRenderBufferStride(DeviceResourceHandle handle) override;
+        int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) override;
         void                    destroyDmaRenderBuffer  (DeviceResourceHandle handle) override;
+        bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) override;
+        int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) override;
 
         void                    activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field) override;
 
@@ -121,6 +143,7 @@ namespace ramses::internal
         void                    activateRenderTarget(DeviceResourceHandle handle) override;
         void                    deleteRenderTarget(DeviceResourceHandle handle) override;
         void                    discardDepthStencil() override;
+        void                    discardColorBuffers() override;
 
         void                    pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& renderTargets, const std::array<DeviceResourceHandle, 2>& colorBuffers) override;
         void                    unpairRenderTargets(DeviceResourceHandle renderTarget) override;
@@ -135,8 +158,16 @@ namespace ramses::internal
 
 
         uint32_t                  getTotalGpuMemoryUsageInKB() const override;
+        void                    invalidateStateCache() override;
+
+        bool                    beginGpuTimerQuery(uint64_t queryId) override;
+        void                    endGpuTimerQuery() override;
+        void                    collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& results) override;
+        void                    deleteGpuTimerQueries(uint64_t queryId) override;
 
         void                    flush() override;
+        DeviceFence             insertFence() override;
+        void                    waitFence(DeviceFence fence) override;
 
     private:
         DeviceResourceHandle        m_framebufferRenderTarget;
@@ -152,9 +183,14 @@ namespace ramses::internal
 
         // Active states for upcoming draw call(s)
         const ShaderGPUResource_GL* m_activeShader = nullptr;
+        // program and vertex array currently bound in context, used to skip redundant binds between draw calls
+        static constexpr GLHandle   UnknownBinding = std::numeric_limits<GLHandle>::max();
+        GLHandle                    m_boundProgram = UnknownBinding;
+        GLHandle                    m_boundVertexArray = UnknownBinding;
         EDrawMode                   m_activePrimitiveDrawMode = EDrawMode::Points;
         uint32_t                    m_activeIndexArrayElementSizeBytes = 0u;
         uint32_t                    m_activeIndexArraySizeBytes = 0u;
+        uint32_t                    m_activeIndexArrayOffsetBytes = 0u;
 
         DebugOutput                 m_debugOutput;
         std::vector<GLint>          m_supportedBinaryProgramFormats;
@@ -164,9 +200,74 @@ namespace ramses::internal
 
         std::unordered_map<uint64_t, DeviceResourceHandle> m_textureSamplerObjectsCache;
 
+        // textures and sampler objects bound to texture units, used to skip redundant binds between draw calls
+        struct TextureUnitBinding
+        {
+            GLenum target = GL_NONE;
+            GLHandle texture = InvalidGLHandle;
+            GLHandle sampler = InvalidGLHandle;
+        };
+        std::vector<TextureUnitBinding> m_textureUnitBindings;
+        TextureSlot                 m_activeTextureUnit = -1;
+
+        // two queries per query ID, so that one can be issued while result of the other one is not available yet
+        struct GpuTimerQueries
+        {
+            std::array<GLuint, 2> queries{ 0u, 0u };
+            std::array<bool, 2> pending{ false, false };
+            uint32_t nextQuery = 0u;
+        };
+        using GetQueryObjectui64vFunc = void (*)(GLuint id, GLenum pname, GLuint64* params);
+        GetQueryObjectui64vFunc     m_glGetQueryObjectui64v = nullptr;
+        bool                        m_gpuTimerDisjointSupported = false;
+        GLuint                      m_activeGpuTimerQuery = 0u;
+        std::unordered_map<uint64_t, GpuTimerQueries> m_gpuTimerQueries;
+
+        using MaxShaderCompilerThreadsFunc = void (*)(GLuint count);
+        bool                        m_parallelShaderCompileSupported = false;
+
+        // programs are created from SPIR-V of effects if supported, skipping GLSL front-end of driver
+        ShaderUploader_GL::SpecializeShaderFunc m_glSpecializeShader = nullptr;
+
+        // streaming uniform buffers are sub-allocated from persistently mapped chunks if buffer storage is supported
+        using BufferStorageFunc = void (*)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+        BufferStorageFunc           m_glBufferStorage = nullptr;
+        std::optional<UniformBufferPool> m_uniformBufferPool;
+
+        // blits which neither scale nor convert are executed as image copy if supported, no framebuffer read/draw setup needed
+        using CopyImageSubDataFunc = void (*)(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ,
+            GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth);
+        CopyImageSubDataFunc        m_glCopyImageSubData = nullptr;
+        struct UniformBufferPoolChunk
+        {
+            GLHandle buffer = InvalidGLHandle;
+            std::byte* mappedMemory = nullptr;
+        };
+        std::vector<UniformBufferPoolChunk> m_uniformBufferPoolChunks;
+        // indexed by device handle, same as resource mapper, to avoid hashing when binding uniform buffers
+        std::vector<std::optional<UniformBufferPool::Allocation>> m_streamingUniformBuffers;
+        // fences issued at begin of last update batches of streaming uniform buffers
+        std::deque<GLsync>          m_uniformBufferPoolFences;
+        bool                        m_drawnSinceStreamingUniformBufferUpdate = true;
+
+        // small static vertex and index buffers are sub-allocated from shared chunks, vertex arrays refer to chunks at buffer offsets
+        struct StaticBufferPoolGL
+        {
+            GLenum target = GL_ARRAY_BUFFER;
+            StaticBufferPool pool;
+            // device buffer per chunk, invalid while chunk has no allocations
+            std::vector<GLHandle> chunkBuffers;
+        };
+        StaticBufferPoolGL          m_staticVertexBufferPool{ GL_ARRAY_BUFFER, {}, {} };
+        StaticBufferPoolGL          m_staticIndexBufferPool{ GL_ELEMENT_ARRAY_BUFFER, {}, {} };
+        // indexed by device handle, same as resource mapper
+        std::vector<std::optional<StaticBufferPool::Allocation>> m_pooledStaticBuffers;
+
         static std::mutex s_gladMutex;
 
         bool allBuffersHaveTheSameSize(const DeviceHandleVector& renderBuffers) const;
+        static void AllocateBufferStorage(GLenum target, const BufferGPUResource& buffer);
+        static void UploadBufferData(GLenum target, const BufferGPUResource& buffer, const std::byte* data, uint32_t dataSize);
         static void BindRenderBufferToRenderTarget(const RenderBufferGPUResource& renderBufferGpuResource, size_t colorBufferSlot);
         static void BindReadWriteRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle, bool multiSample);
         static void BindWriteOnlyRenderBufferToRenderTarget(EPixelStorageFormat bufferFormat, size_t colorBufferSlot, GLHandle bufferGLHandle);
@@ -177,6 +278,8 @@ namespace ramses::internal
         void                    deleteTextureSampler(DeviceResourceHandle handle);
         void                    activateTextureSampler(DeviceResourceHandle handle, DataFieldHandle field);
 
+        void invalidateTextureUnitBindings();
+        void bindVertexArray(GLHandle vertexArray);
         static GLHandle GenerateAndBindTexture(GLenum target);
 
         void fillGLInternalTextureInfo(GLenum target, uint32_t width, uint32_t height, uint32_t depth, EPixelStorageFormat textureFormat, const TextureSwizzleArray& swizzle, GLTextureInfo& texInfoOut) const;
@@ -186,6 +289,25 @@ namespace ramses::internal
         static void UploadTextureMipMapData(uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const GLTextureInfo& texInfo, const std::byte *pData, uint32_t dataSize, uint32_t stride);
 
         void queryDeviceDependentFeatures();
+        void loadGpuTimerQueryExtension();
+        void loadParallelShaderCompileExtension();
+        void loadSpirvShaderExtension();
+        std::unique_ptr<const GPUResource> uploadShaderFromSPIRV(const EffectResource& shader) const;
+        void loadBufferStorageExtension();
+        void loadCopyImageExtension();
+        bool copyRenderTargetImage(const RenderTargetGPUResource& rtSrc, const RenderTargetGPUResource& rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly) const;
+        static GLenum GetRenderBufferImageTarget(const RenderBufferGPUResource& renderBuffer);
+        bool addUniformBufferPoolChunk();
+        void beginStreamingUniformBufferUpdateBatch();
+        UniformBufferPool::Allocation* findStreamingUniformBuffer(DeviceResourceHandle handle);
+        void deleteUniformBufferPool();
+        static StaticBufferPool::Allocation AllocateFromStaticBufferPool(StaticBufferPoolGL& pool, uint32_t sizeInBytes);
+        DeviceResourceHandle registerPooledStaticBuffer(std::unique_ptr<BufferGPUResource> buffer, const StaticBufferPool::Allocation& allocation);
+        [[nodiscard]] const StaticBufferPool::Allocation* findPooledStaticBuffer(DeviceResourceHandle handle) const;
+        void uploadPooledStaticBufferData(GLenum target, DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize);
+        bool releasePooledStaticBuffer(StaticBufferPoolGL& pool, DeviceResourceHandle handle);
+        void deleteStaticBufferPools();
         static void PrintOpenGLExtensions();
+        static bool IsOpenGLExtensionAvailable(std::string_view extensionName);
     };
 }
@@ -11,6 +11,8 @@
 #include "internal/SceneGraph/Resource/EffectResource.h"
 #include "internal/Core/Utils/LogMacros.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     ShaderGPUResource_GL::ShaderGPUResource_GL(const EffectResource& effect, ShaderProgramInfo shaderProgramInfo)
@@ -56,9 +58,9 @@ namespace ramses::internal
 
     TextureSlotInfo ShaderGPUResource_GL::getTextureSlot(DataFieldHandle field) const
     {
-        TextureSlotInfo slot;
-        [[maybe_unused]] const EStatus status = m_bufferSlots.get(field, slot);
-        assert(status == EStatus::Ok);
+        assert(field.asMemoryHandle() < m_textureSlots.size());
+        const auto& slot = m_textureSlots[field.asMemoryHandle()];
+        assert(slot.textureType != EEffectInputTextureType_Invalid);
         return slot;
     }
 
@@ -71,6 +73,18 @@ namespace ramses::internal
         return uboBinding;
     }
 
+    bool ShaderGPUResource_GL::updateUniformValueCache(DataFieldHandle field, const void* value, size_t sizeInBytes) const
+    {
+        assert(field.asMemoryHandle() < m_uniformValueCache.size());
+        auto& cachedValue = m_uniformValueCache[field.asMemoryHandle()];
+        const auto* valueBytes = static_cast<const std::byte*>(value);
+        if (cachedValue.size() == sizeInBytes && std::equal(cachedValue.cbegin(), cachedValue.cend(), valueBytes))
+            return false;
+
+        cachedValue.assign(valueBytes, valueBytes + sizeInBytes);
+        return true;
+    }
+
     void ShaderGPUResource_GL::init(const EffectResource& effect)
     {
         const EffectInputInformationVector& uniformInputs = effect.getUniformInputs();
@@ -82,6 +96,7 @@ namespace ramses::internal
         m_attributeLocationMap.reserve(vertexInputCount);
         m_uniformLocationMap.reserve(uniformInputWithoutUBOFieldsCount);
         m_uniformBufferBindings.reserve(uniformInputWithoutUBOFieldsCount);
+        m_textureSlots.reserve(uniformInputWithoutUBOFieldsCount);
 
         for (uint32_t i = 0u; i < vertexInputCount; ++i)
             m_attributeLocationMap.push_back(loadAttributeLocation(effect, attributeInputs[i]));
@@ -89,25 +104,50 @@ namespace ramses::internal
         TextureSlot slotCounter = 0; // texture unit 0
         for (const auto& input : uniformInputs)
         {
+            if (EffectInputInformation::IsUniformBufferField(input))
+                continue;
+
+            TextureSlotInfo textureSlot;
             if (IsTextureSamplerType(input.dataType))
             {
-                TextureSlotInfo bufferSlot;
-                bufferSlot.slot = slotCounter++;
-                bufferSlot.textureType = GetTextureTypeFromDataType(input.dataType);
-                m_bufferSlots.put(input.dataFieldHandle, bufferSlot);
+                textureSlot.slot = slotCounter++;
+                textureSlot.textureType = GetTextureTypeFromDataType(input.dataType);
             }
+            m_textureSlots.push_back(textureSlot);
 
             if (EffectInputInformation::IsUniformBuffer(input))
             {
                 m_uniformLocationMap.emplace_back(GLInputLocation{});
                 m_uniformBufferBindings.push_back(input.uniformBufferBinding);
             }
-            else if (!EffectInputInformation::IsUniformBufferField(input))
+            else
             {
                 m_uniformLocationMap.push_back(loadUniformLocation(effect, input));
                 m_uniformBufferBindings.emplace_back(UniformBufferBinding{});
             }
         }
+
+        m_uniformValueCache.resize(m_uniformLocationMap.size());
+
+        if (slotCounter > 0)
+            assignSamplerTextureUnits();
+    }
+
+    void ShaderGPUResource_GL::assignSamplerTextureUnits() const
+    {
+        // texture unit of a sampler uniform is part of program state and never changes, so it is set only once here
+        // instead of every time the texture is activated, previously used program is restored afterwards
+        GLint previousProgram = 0;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+        glUseProgram(m_shaderProgramInfo.shaderProgramHandle);
+
+        for (size_t i = 0u; i < m_textureSlots.size(); ++i)
+        {
+            if (m_textureSlots[i].textureType != EEffectInputTextureType_Invalid && m_uniformLocationMap[i].isValid())
+                glUniform1i(m_uniformLocationMap[i].getValue(), m_textureSlots[i].slot);
+        }
+
+        glUseProgram(static_cast<GLuint>(previousProgram));
     }
 
     GLInputLocation ShaderGPUResource_GL::loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const
@@ -37,22 +37,27 @@ namespace ramses::internal
         [[nodiscard]] GLInputLocation     getAttributeLocation(DataFieldHandle field) const;
         [[nodiscard]] TextureSlotInfo     getTextureSlot(DataFieldHandle field) const;
         [[nodiscard]] UniformBufferBinding getUniformBufferBinding(DataFieldHandle field) const;
+        // Uniform values are part of GL program state, so a value which was already set on this program does not need to be set again.
+        // Returns true if given value differs from the one last set for the uniform (and stores it), false if it can be skipped.
+        [[nodiscard]] bool                updateUniformValueCache(DataFieldHandle field, const void* value, size_t sizeInBytes) const;
 
         [[nodiscard]] bool                getBinaryInfo(std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
     private:
         void                              init(const EffectResource& effect);
+        void                              assignSamplerTextureUnits() const;
         [[nodiscard]] GLInputLocation     loadUniformLocation(const EffectResource& effect, const EffectInputInformation& input) const;
         [[nodiscard]] GLInputLocation     loadAttributeLocation(const EffectResource& effect, const EffectInputInformation& input) const;
 
         ShaderProgramInfo m_shaderProgramInfo;
 
-        using BufferSlotMap = HashMap<DataFieldHandle, TextureSlotInfo>;
         using InputLocationMap = std::vector<GLInputLocation>;
 
-        BufferSlotMap    m_bufferSlots;
+        // lookup tables indexed by data field, uniform locations and texture units are resolved once when program is linked
         InputLocationMap m_uniformLocationMap;
+        std::vector<TextureSlotInfo> m_textureSlots;
         InputLocationMap m_attributeLocationMap;
         std::vector<UniformBufferBinding> m_uniformBufferBindings;
+        mutable std::vector<std::vector<std::byte>> m_uniformValueCache;
     };
 }
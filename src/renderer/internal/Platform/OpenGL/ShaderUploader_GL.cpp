@@ -14,6 +14,8 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "absl/strings/str_split.h"
 
+#include <array>
+
 namespace ramses::internal
 {
     bool ShaderUploader_GL::UploadShaderProgramFromBinary(const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog)
@@ -39,6 +41,104 @@ namespace ramses::internal
     }
 
 
+    bool ShaderUploader_GL::UploadShaderProgramFromSPIRV(const EffectResource& effect, SpecializeShaderFunc specializeShader, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog)
+    {
+        assert(specializeShader != nullptr);
+        if (effect.getVertexShaderSPIRVSize() == 0u || effect.getFragmentShaderSPIRVSize() == 0u)
+        {
+            debugErrorLog = "Effect has no SPIR-V";
+            return false;
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "ShaderUploader_GL::UploadShaderProgramFromSPIRV:  creating shaders from SPIR-V for effect {}", effect.getName());
+
+        ShaderProgramInfo programInfo;
+        programInfo.vertexShaderHandle = SpecializeShaderStage(effect.getVertexShaderSPIRV(), effect.getVertexShaderSPIRVSize(), GL_VERTEX_SHADER, specializeShader, debugErrorLog);
+        if (InvalidGLHandle != programInfo.vertexShaderHandle)
+            programInfo.fragmentShaderHandle = SpecializeShaderStage(effect.getFragmentShaderSPIRV(), effect.getFragmentShaderSPIRVSize(), GL_FRAGMENT_SHADER, specializeShader, debugErrorLog);
+        const bool hasGeometryShader = (effect.getGeometryShaderSPIRVSize() != 0u);
+        if (hasGeometryShader && InvalidGLHandle != programInfo.fragmentShaderHandle)
+            programInfo.geometryShaderHandle = SpecializeShaderStage(effect.getGeometryShaderSPIRV(), effect.getGeometryShaderSPIRVSize(), GL_GEOMETRY_SHADER_EXT, specializeShader, debugErrorLog);
+
+        if (InvalidGLHandle == programInfo.vertexShaderHandle ||
+            InvalidGLHandle == programInfo.fragmentShaderHandle ||
+            (hasGeometryShader && InvalidGLHandle == programInfo.geometryShaderHandle))
+        {
+            DeleteShaderProgram(programInfo);
+            return false;
+        }
+
+        programInfo.shaderProgramHandle = glCreateProgram();
+        if (InvalidGLHandle == programInfo.shaderProgramHandle)
+        {
+            debugErrorLog = "Unable to create shader program";
+            DeleteShaderProgram(programInfo);
+            return false;
+        }
+
+        glAttachShader(programInfo.shaderProgramHandle, programInfo.fragmentShaderHandle);
+        glAttachShader(programInfo.shaderProgramHandle, programInfo.vertexShaderHandle);
+        if (hasGeometryShader)
+            glAttachShader(programInfo.shaderProgramHandle, programInfo.geometryShaderHandle);
+        glLinkProgram(programInfo.shaderProgramHandle);
+
+        if (!CheckShaderProgramLinkStatus(programInfo.shaderProgramHandle, debugErrorLog) || !HasAllInputLocations(effect, programInfo.shaderProgramHandle, debugErrorLog))
+        {
+            DeleteShaderProgram(programInfo);
+            return false;
+        }
+
+        programShaderInfoOut = programInfo;
+        return true;
+    }
+
+    GLHandle ShaderUploader_GL::SpecializeShaderStage(const uint32_t* spirv, uint32_t spirvSize, GLenum shaderType, SpecializeShaderFunc specializeShader, std::string& errorLogOut)
+    {
+        // GL_SHADER_BINARY_FORMAT_SPIR_V_ARB, not part of GLAD generated API
+        static constexpr GLenum SpirvBinaryFormat = 0x9551;
+
+        GLHandle shaderHandle = glCreateShader(shaderType);
+        if (InvalidGLHandle == shaderHandle)
+        {
+            errorLogOut = "Unable to create shader stage";
+            return InvalidGLHandle;
+        }
+
+        glShaderBinary(1, &shaderHandle, SpirvBinaryFormat, spirv, static_cast<GLsizei>(spirvSize));
+        specializeShader(shaderHandle, "main", 0u, nullptr, nullptr);
+        if (!CheckShaderStageCompileStatus(shaderHandle, "(SPIR-V)", errorLogOut))
+        {
+            glDeleteShader(shaderHandle);
+            shaderHandle = InvalidGLHandle;
+        }
+
+        return shaderHandle;
+    }
+
+    bool ShaderUploader_GL::HasAllInputLocations(const EffectResource& effect, GLHandle shaderProgram, std::string& errorLogOut)
+    {
+        // names in SPIR-V are only debug information which drivers are not required to keep,
+        // program is usable only if all inputs can be found the same way as in program created from source
+        for (const auto& input : effect.getAttributeInputs())
+        {
+            if (glGetAttribLocation(shaderProgram, input.inputName.c_str()) < 0)
+            {
+                errorLogOut = fmt::format("Attribute '{}' not found in program created from SPIR-V", input.inputName);
+                return false;
+            }
+        }
+        for (const auto& input : effect.getUniformInputs())
+        {
+            if (!EffectInputInformation::IsUniformBuffer(input) && !EffectInputInformation::IsUniformBufferField(input) &&
+                glGetUniformLocation(shaderProgram, input.inputName.c_str()) < 0)
+            {
+                errorLogOut = fmt::format("Uniform '{}' not found in program created from SPIR-V", input.inputName);
+                return false;
+            }
+        }
+        return true;
+    }
+
     bool ShaderUploader_GL::UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog)
     {
         LOG_INFO(CONTEXT_RENDERER, "ShaderUploader_GL::UploadShaderProgramFromSource:  compiling shaders for effect {}", effect.getName());
@@ -151,46 +251,149 @@ namespace ramses::internal
 
     GLHandle ShaderUploader_GL::CompileShaderStage(const char* stageSource, GLenum shaderType, std::string& errorLogOut)
     {
-        GLHandle shaderHandle = glCreateShader(shaderType);
+        GLHandle shaderHandle = SubmitShaderStage(stageSource, shaderType);
+
+        if (InvalidGLHandle != shaderHandle && !CheckShaderStageCompileStatus(shaderHandle, stageSource, errorLogOut))
+        {
+            glDeleteShader(shaderHandle);
+            shaderHandle = InvalidGLHandle;
+        }
+
+        return shaderHandle;
+    }
+
+    GLHandle ShaderUploader_GL::SubmitShaderStage(const char* stageSource, GLenum shaderType)
+    {
+        const GLHandle shaderHandle = glCreateShader(shaderType);
 
         if (InvalidGLHandle != shaderHandle)
         {
             glShaderSource(shaderHandle, 1, &stageSource, nullptr);
             glCompileShader(shaderHandle);
+        }
 
-            GLint compilationResult = GL_FALSE;
-            glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
+        return shaderHandle;
+    }
+
+    bool ShaderUploader_GL::CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, std::string& errorLogOut)
+    {
+        GLint compilationResult = GL_FALSE;
+        glGetShaderiv(shaderHandle, GL_COMPILE_STATUS, &compilationResult);
 
-            if (compilationResult == GL_FALSE)
+        if (compilationResult == GL_FALSE)
+        {
+            std::string info;
+
+            GLint charBufferSize = 0;
+            glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &charBufferSize);
+            if (charBufferSize > 0)
             {
-                std::string info;
-
-                GLint charBufferSize = 0;
-                glGetShaderiv(shaderHandle, GL_INFO_LOG_LENGTH, &charBufferSize);
-                if (charBufferSize > 0)
-                {
-                    // charBufferSize includes null termination character and data() returns array which is null-terminated
-                    info.resize(charBufferSize - 1);
-                    GLsizei numberChars = 0;
-                    glGetShaderInfoLog(shaderHandle, charBufferSize, &numberChars, info.data());
-                    // Might be useful for the case when charBufferSize reported by glGetShaderiv is bigger than the real data
-                    // returned by glGetShaderInfoLog. Does not affect performance, it is a case of error handling.
-                    info.resize(numberChars);
-                }
-                else
-                {
-                    info = "no info given from compiler";
-                }
-
-                errorLogOut = std::string("Unable to compile shader stage: ") + info;
-
-                PrintShaderSourceWithLineNumbers(stageSource);
-                glDeleteShader(shaderHandle);
-                shaderHandle = InvalidGLHandle;
+                // charBufferSize includes null termination character and data() returns array which is null-terminated
+                info.resize(charBufferSize - 1);
+                GLsizei numberChars = 0;
+                glGetShaderInfoLog(shaderHandle, charBufferSize, &numberChars, info.data());
+                // Might be useful for the case when charBufferSize reported by glGetShaderiv is bigger than the real data
+                // returned by glGetShaderInfoLog. Does not affect performance, it is a case of error handling.
+                info.resize(numberChars);
             }
+            else
+            {
+                info = "no info given from compiler";
+            }
+
+            errorLogOut = std::string("Unable to compile shader stage: ") + info;
+
+            PrintShaderSourceWithLineNumbers(stageSource);
+            return false;
         }
 
-        return shaderHandle;
+        return true;
+    }
+
+    bool ShaderUploader_GL::StartShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog)
+    {
+        LOG_INFO(CONTEXT_RENDERER, "ShaderUploader_GL::StartShaderProgramCompilation:  compiling shaders for effect {}", effect.getName());
+
+        programShaderInfoOut.vertexShaderHandle = SubmitShaderStage(effect.getVertexShader(), GL_VERTEX_SHADER);
+        programShaderInfoOut.fragmentShaderHandle = SubmitShaderStage(effect.getFragmentShader(), GL_FRAGMENT_SHADER);
+        const bool hasGeometryShader = (std::strcmp(effect.getGeometryShader(), "") != 0);
+        if (hasGeometryShader)
+            programShaderInfoOut.geometryShaderHandle = SubmitShaderStage(effect.getGeometryShader(), GL_GEOMETRY_SHADER_EXT);
+        programShaderInfoOut.shaderProgramHandle = glCreateProgram();
+
+        if (InvalidGLHandle == programShaderInfoOut.vertexShaderHandle ||
+            InvalidGLHandle == programShaderInfoOut.fragmentShaderHandle ||
+            (hasGeometryShader && InvalidGLHandle == programShaderInfoOut.geometryShaderHandle) ||
+            InvalidGLHandle == programShaderInfoOut.shaderProgramHandle)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::StartShaderProgramCompilation:  failed to create GL shader objects");
+            debugErrorLog = "Unable to create shader program";
+            DeleteShaderProgram(programShaderInfoOut);
+            return false;
+        }
+
+        // link is issued right away, compile status of stages is checked only after the whole program completed
+        glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.fragmentShaderHandle);
+        glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.vertexShaderHandle);
+        if (hasGeometryShader)
+            glAttachShader(programShaderInfoOut.shaderProgramHandle, programShaderInfoOut.geometryShaderHandle);
+        glLinkProgram(programShaderInfoOut.shaderProgramHandle);
+
+        return true;
+    }
+
+    bool ShaderUploader_GL::IsShaderProgramCompilationCompleted(const ShaderProgramInfo& programShaderInfo)
+    {
+        // GL_COMPLETION_STATUS_KHR (same value for ARB variant), not part of GLAD generated API
+        static constexpr GLenum CompletionStatus = 0x91B1;
+
+        GLint completed = GL_FALSE;
+        glGetProgramiv(programShaderInfo.shaderProgramHandle, CompletionStatus, &completed);
+        return completed != GL_FALSE;
+    }
+
+    bool ShaderUploader_GL::FinishShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfo, std::string& debugErrorLog)
+    {
+        struct Stage
+        {
+            GLHandle handle;
+            const char* source;
+            const char* name;
+        };
+        const std::array<Stage, 3> stages{ {
+            { programShaderInfo.vertexShaderHandle, effect.getVertexShader(), "vertex" },
+            { programShaderInfo.fragmentShaderHandle, effect.getFragmentShader(), "fragment" },
+            { programShaderInfo.geometryShaderHandle, effect.getGeometryShader(), "geometry" } } };
+
+        // check stages first, compile errors are more meaningful than link error which follows from them
+        for (const auto& stage : stages)
+        {
+            if (InvalidGLHandle != stage.handle && !CheckShaderStageCompileStatus(stage.handle, stage.source, debugErrorLog))
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramCompilation:  {} shader failed to compile {}", stage.name, debugErrorLog);
+                DeleteShaderProgram(programShaderInfo);
+                return false;
+            }
+        }
+
+        if (!CheckShaderProgramLinkStatus(programShaderInfo.shaderProgramHandle, debugErrorLog))
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "ShaderUploader_GL::FinishShaderProgramCompilation:  CheckShaderProgramLinkStatus failed");
+            DeleteShaderProgram(programShaderInfo);
+            return false;
+        }
+
+        return true;
+    }
+
+    void ShaderUploader_GL::DeleteShaderProgram(ShaderProgramInfo& programShaderInfo)
+    {
+        // deleting zero handle is silently ignored by GL
+        glDeleteProgram(programShaderInfo.shaderProgramHandle);
+        glDeleteShader(programShaderInfo.vertexShaderHandle);
+        glDeleteShader(programShaderInfo.fragmentShaderHandle);
+        glDeleteShader(programShaderInfo.geometryShaderHandle);
+        programShaderInfo = {};
     }
 
     void ShaderUploader_GL::PrintShaderSourceWithLineNumbers(std::string_view source)
@@ -22,11 +22,30 @@ namespace ramses::internal
     class ShaderUploader_GL
     {
     public:
+        // glSpecializeShader (GL_ARB_gl_spirv), not part of GLAD generated API
+        using SpecializeShaderFunc = void (*)(GLuint shader, const GLchar* entryPoint, GLuint numSpecializationConstants, const GLuint* constantIndex, const GLuint* constantValue);
+
         static bool UploadShaderProgramFromSource(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
+        // Creates program from SPIR-V of the effect, skipping driver's GLSL front-end. Fails if effect has no SPIR-V or if driver does not keep
+        // names of effect inputs in the program, since inputs are looked up by name. Caller is expected to fall back to upload from source then.
+        static bool UploadShaderProgramFromSPIRV(const EffectResource& effect, SpecializeShaderFunc specializeShader, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
         static bool UploadShaderProgramFromBinary(const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
 
+        // Split variant of UploadShaderProgramFromSource for parallel compilation (KHR_parallel_shader_compile):
+        // start issues compile and link without querying any status so that driver does not block,
+        // finish must be called only once IsShaderProgramCompilationCompleted reports true, it checks the results
+        // and deletes all GL objects on failure
+        static bool StartShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfoOut, std::string& debugErrorLog);
+        static bool IsShaderProgramCompilationCompleted(const ShaderProgramInfo& programShaderInfo);
+        static bool FinishShaderProgramCompilation(const EffectResource& effect, ShaderProgramInfo& programShaderInfo, std::string& debugErrorLog);
+
     private:
         static GLHandle CompileShaderStage(const char* stageSource, GLenum shaderType, std::string& errorLogOut);
+        static GLHandle SpecializeShaderStage(const uint32_t* spirv, uint32_t spirvSize, GLenum shaderType, SpecializeShaderFunc specializeShader, std::string& errorLogOut);
+        static bool HasAllInputLocations(const EffectResource& effect, GLHandle shaderProgram, std::string& errorLogOut);
+        static GLHandle SubmitShaderStage(const char* stageSource, GLenum shaderType);
+        static bool CheckShaderStageCompileStatus(GLHandle shaderHandle, const char* stageSource, std::string& errorLogOut);
+        static void DeleteShaderProgram(ShaderProgramInfo& programShaderInfo);
         static bool CheckShaderProgramLinkStatus(GLHandle shaderProgram, std::string& errorLogOut);
         static void PrintShaderSourceWithLineNumbers(std::string_view source);
     };
@@ -7,7 +7,9 @@
 //  -------------------------------------------------------------------------
 
 #include "Device_Vulkan.h"
+#include "VulkanCommon.h"
 
+#include <array>
 
 namespace ramses::internal
 {
@@ -18,11 +20,74 @@ namespace ramses::internal
     {
     }
 
+    Device_Vulkan::~Device_Vulkan()
+    {
+        if (m_device == VK_NULL_HANDLE)
+            return;
+
+        vkDeviceWaitIdle(m_device);
+        vkDestroyDevice(m_device, nullptr);
+    }
+
     bool Device_Vulkan::init()
     {
-        (void) m_instance;
-        (void) m_surface;
+        uint32_t queueFamilyIndex = 0u;
+        if (!pickPhysicalDevice(queueFamilyIndex))
+            return false;
+
+        return createLogicalDevice(queueFamilyIndex);
+    }
+
+    bool Device_Vulkan::pickPhysicalDevice(uint32_t& queueFamilyIndex)
+    {
+        const auto physicalDevices = VulkanEnumrate<VkPhysicalDevice>(std::bind(vkEnumeratePhysicalDevices, m_instance, _1, _2));
+        for (const auto& physicalDevice : physicalDevices)
+        {
+            const auto queueFamilies = VulkanEnumrate<VkQueueFamilyProperties>(std::bind(vkGetPhysicalDeviceQueueFamilyProperties, physicalDevice, _1, _2));
+            for (uint32_t familyIndex = 0u; familyIndex < static_cast<uint32_t>(queueFamilies.size()); ++familyIndex)
+            {
+                if ((queueFamilies[familyIndex].queueFlags & VK_QUEUE_GRAPHICS_BIT) == 0u)
+                    continue;
+
+                VkBool32 presentSupported = VK_FALSE;
+                if (vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, familyIndex, m_surface, &presentSupported) != VK_SUCCESS || presentSupported == VK_FALSE)
+                    continue;
+
+                VkPhysicalDeviceProperties properties{};
+                vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+                LOG_INFO(CONTEXT_RENDERER, "Device_Vulkan::pickPhysicalDevice(): using device {} with queue family {}", properties.deviceName, familyIndex);
 
+                m_physicalDevice = physicalDevice;
+                queueFamilyIndex = familyIndex;
+                return true;
+            }
+        }
+
+        LOG_ERROR(CONTEXT_RENDERER, "Device_Vulkan::pickPhysicalDevice(): no device found with a queue family supporting graphics and presentation (devices: {})", physicalDevices.size());
+        return false;
+    }
+
+    bool Device_Vulkan::createLogicalDevice(uint32_t queueFamilyIndex)
+    {
+        const float queuePriority = 1.f;
+        VkDeviceQueueCreateInfo queueCreationInfo{};
+        queueCreationInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreationInfo.queueFamilyIndex = queueFamilyIndex;
+        queueCreationInfo.queueCount = 1u;
+        queueCreationInfo.pQueuePriorities = &queuePriority;
+
+        const std::array<const char*, 1u> deviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
+        const VkPhysicalDeviceFeatures deviceFeatures{};
+
+        VkDeviceCreateInfo deviceCreationInfo{};
+        deviceCreationInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+        deviceCreationInfo.queueCreateInfoCount = 1u;
+        deviceCreationInfo.pQueueCreateInfos = &queueCreationInfo;
+        deviceCreationInfo.enabledExtensionCount = static_cast<uint32_t>(deviceExtensions.size());
+        deviceCreationInfo.ppEnabledExtensionNames = deviceExtensions.data();
+        deviceCreationInfo.pEnabledFeatures = &deviceFeatures;
+
+        VK_CHECK_RETURN_ERR(vkCreateDevice(m_physicalDevice, &deviceCreationInfo, nullptr, &m_device));
         return true;
     }
 
@@ -201,7 +266,7 @@ namespace ramses::internal
 
     }
 
-    DeviceResourceHandle Device_Vulkan::allocateVertexBuffer([[maybe_unused]] uint32_t totalSizeInBytes)
+    DeviceResourceHandle Device_Vulkan::allocateVertexBuffer([[maybe_unused]] uint32_t totalSizeInBytes, [[maybe_unused]] EDeviceBufferUsage usage)
     {
         return {};
     }
@@ -211,6 +276,11 @@ namespace ramses::internal
 
     }
 
+    void Device_Vulkan::uploadVertexBufferSubData([[maybe_unused]] DeviceResourceHandle handle, [[maybe_unused]] uint32_t offsetInBytes, [[maybe_unused]] const std::byte* data, [[maybe_unused]] uint32_t dataSize)
+    {
+
+    }
+
     void Device_Vulkan::deleteVertexBuffer([[maybe_unused]] DeviceResourceHandle handle)
     {
 
@@ -231,7 +301,7 @@ namespace ramses::internal
 
     }
 
-    DeviceResourceHandle Device_Vulkan::allocateIndexBuffer([[maybe_unused]] EDataType dataType, [[maybe_unused]] uint32_t sizeInBytes)
+    DeviceResourceHandle Device_Vulkan::allocateIndexBuffer([[maybe_unused]] EDataType dataType, [[maybe_unused]] uint32_t sizeInBytes, [[maybe_unused]] EDeviceBufferUsage usage)
     {
         return {};
     }
@@ -241,6 +311,11 @@ namespace ramses::internal
 
     }
 
+    void Device_Vulkan::uploadIndexBufferSubData([[maybe_unused]] DeviceResourceHandle handle, [[maybe_unused]] uint32_t offsetInBytes, [[maybe_unused]] const std::byte* data, [[maybe_unused]] uint32_t dataSize)
+    {
+
+    }
+
     void Device_Vulkan::deleteIndexBuffer([[maybe_unused]] DeviceResourceHandle handle)
     {
 
@@ -330,6 +405,16 @@ namespace ramses::internal
 
     }
 
+    std::unique_ptr<const GPUResource> Device_Vulkan::extractTexture([[maybe_unused]] DeviceResourceHandle handle)
+    {
+        return {};
+    }
+
+    DeviceResourceHandle Device_Vulkan::registerTexture([[maybe_unused]] std::unique_ptr<const GPUResource> textureResource)
+    {
+        return {};
+    }
+
     void Device_Vulkan::activateTexture([[maybe_unused]] DeviceResourceHandle handle, [[maybe_unused]] DataFieldHandle field)
     {
 
@@ -365,11 +450,27 @@ namespace ramses::internal
         return std::numeric_limits<uint32_t>::max();
     }
 
+    int Device_Vulkan::createDmaRenderBufferSyncFence([[maybe_unused]] DeviceResourceHandle handle)
+    {
+        return -1;
+    }
+
     void Device_Vulkan::destroyDmaRenderBuffer([[maybe_unused]] DeviceResourceHandle handle)
     {
 
     }
 
+    bool Device_Vulkan::importDmaBufferToExternalTexture([[maybe_unused]] DeviceResourceHandle handle, [[maybe_unused]] const DmaBufferFrame& frame, int& releaseFenceFD)
+    {
+        releaseFenceFD = -1;
+        return false;
+    }
+
+    int Device_Vulkan::releaseDmaBufferOfExternalTexture([[maybe_unused]] DeviceResourceHandle handle)
+    {
+        return -1;
+    }
+
     void Device_Vulkan::activateTextureSamplerObject([[maybe_unused]] const TextureSamplerStates& samplerStates, [[maybe_unused]] DataFieldHandle field)
     {
 
@@ -400,6 +501,11 @@ namespace ramses::internal
 
     }
 
+    void Device_Vulkan::discardColorBuffers()
+    {
+
+    }
+
     void Device_Vulkan::pairRenderTargetsForDoubleBuffering([[maybe_unused]] const std::array<DeviceResourceHandle, 2>& renderTargets, [[maybe_unused]] const std::array<DeviceResourceHandle, 2>& colorBuffers)
     {
 
@@ -445,8 +551,42 @@ namespace ramses::internal
         return 0u;
     }
 
+    void Device_Vulkan::invalidateStateCache()
+    {
+    }
+
+    bool Device_Vulkan::beginGpuTimerQuery([[maybe_unused]] uint64_t queryId)
+    {
+        return false;
+    }
+
+    void Device_Vulkan::endGpuTimerQuery()
+    {
+
+    }
+
+    void Device_Vulkan::collectGpuTimerQueryResults([[maybe_unused]] std::vector<GpuTimerQueryResult>& results)
+    {
+
+    }
+
+    void Device_Vulkan::deleteGpuTimerQueries([[maybe_unused]] uint64_t queryId)
+    {
+
+    }
+
     void Device_Vulkan::flush()
     {
 
     }
+
+    DeviceFence Device_Vulkan::insertFence()
+    {
+        return {};
+    }
+
+    void Device_Vulkan::waitFence([[maybe_unused]] DeviceFence fence)
+    {
+
+    }
 }
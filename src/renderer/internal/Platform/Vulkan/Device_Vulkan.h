@@ -19,7 +19,7 @@ namespace ramses::internal
     {
     public:
         explicit Device_Vulkan(IContext& context, VkInstance instance, VkSurfaceKHR surface);
-        ~Device_Vulkan() override = default;
+        ~Device_Vulkan() override;
 
         bool init();
 
@@ -63,16 +63,18 @@ namespace ramses::internal
         void                    activateUniformBuffer(DeviceResourceHandle handle, DataFieldHandle field) override;
         void                    deleteUniformBuffer(DeviceResourceHandle handle) override;
 
-        DeviceResourceHandle    allocateVertexBuffer(uint32_t totalSizeInBytes) override;
+        DeviceResourceHandle    allocateVertexBuffer(uint32_t totalSizeInBytes, EDeviceBufferUsage usage) override;
         void                    uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    uploadVertexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void                    deleteVertexBuffer(DeviceResourceHandle handle) override;
 
         DeviceResourceHandle    allocateVertexArray(const VertexArrayInfo& vertexArrayInfo) override;
         void                    activateVertexArray(DeviceResourceHandle handle) override;
         void                    deleteVertexArray(DeviceResourceHandle handle) override;
 
-        DeviceResourceHandle    allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes) override;
+        DeviceResourceHandle    allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage) override;
         void                    uploadIndexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void                    uploadIndexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void                    deleteIndexBuffer(DeviceResourceHandle handle) override;
 
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& shader) override;
@@ -93,6 +95,8 @@ namespace ramses::internal
         void                    uploadTextureData(DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) override;
         DeviceResourceHandle    uploadStreamTexture2D(DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
         void                    deleteTexture(DeviceResourceHandle handle) override;
+        std::unique_ptr<const GPUResource> extractTexture(DeviceResourceHandle handle) override;
+        DeviceResourceHandle    registerTexture(std::unique_ptr<const GPUResource> textureResource) override;
         void                    activateTexture(DeviceResourceHandle handle, DataFieldHandle field) override;
         [[nodiscard]] uint32_t  getTextureAddress(DeviceResourceHandle handle) const override;
 
@@ -102,7 +106,10 @@ namespace ramses::internal
         DeviceResourceHandle    uploadDmaRenderBuffer(uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, DmaBufferUsageFlags usageFlags, DmaBufferModifiers modifiers) override;
         int                     getDmaRenderBufferFD(DeviceResourceHandle handle) override;
         uint32_t                getDmaRenderBufferStride(DeviceResourceHandle handle) override;
+        int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) override;
         void                    destroyDmaRenderBuffer(DeviceResourceHandle handle) override;
+        bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) override;
+        int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) override;
 
         void                    activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field) override;
 
@@ -111,6 +118,7 @@ namespace ramses::internal
         void                    activateRenderTarget(DeviceResourceHandle handle) override;
         void                    deleteRenderTarget(DeviceResourceHandle handle) override;
         void                    discardDepthStencil() override;
+        void                    discardColorBuffers() override;
 
         void                    pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& renderTargets, const std::array<DeviceResourceHandle, 2>& colorBuffers) override;
         void                    unpairRenderTargets(DeviceResourceHandle renderTarget) override;
@@ -125,11 +133,25 @@ namespace ramses::internal
 
 
         [[nodiscard]] uint32_t  getTotalGpuMemoryUsageInKB() const override;
+        void                    invalidateStateCache() override;
+
+        bool                    beginGpuTimerQuery(uint64_t queryId) override;
+        void                    endGpuTimerQuery() override;
+        void                    collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& results) override;
+        void                    deleteGpuTimerQueries(uint64_t queryId) override;
 
         void                    flush() override;
+        DeviceFence             insertFence() override;
+        void                    waitFence(DeviceFence fence) override;
 
     private:
+        bool pickPhysicalDevice(uint32_t& queueFamilyIndex);
+        bool createLogicalDevice(uint32_t queueFamilyIndex);
+
         VkInstance m_instance;
         VkSurfaceKHR m_surface;
+
+        VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
+        VkDevice m_device = VK_NULL_HANDLE;
     };
 }
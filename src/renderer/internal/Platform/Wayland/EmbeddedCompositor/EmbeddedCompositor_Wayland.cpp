@@ -23,6 +23,8 @@
 #include "internal/Core/Utils/Warnings.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include <algorithm>
+#include <cerrno>
+#include <poll.h>
 #include <unistd.h>
 
 namespace ramses::internal
@@ -32,6 +34,7 @@ namespace ramses::internal
         , m_waylandEmbeddedSocketGroup(displayConfig.getWaylandSocketEmbeddedGroup())
         , m_waylandEmbeddedSocketPermissions(displayConfig.getWaylandSocketEmbeddedPermissions())
         , m_waylandEmbeddedSocketFD(displayConfig.getWaylandSocketEmbeddedFD())
+        , m_useEventThread(displayConfig.isWaylandEmbeddedCompositingEventThreadEnabled())
         , m_context(context)
         , m_compositorGlobal(*this)
         , m_waylandOutputGlobal({ displayConfig.getDesiredWindowWidth(), displayConfig.getDesiredWindowHeight() })
@@ -45,6 +48,11 @@ namespace ramses::internal
     {
         LOG_INFO(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::~EmbeddedCompositor_Wayland(): Destroying EmbeddedCompositor_Wayland");
 
+        stopEventThread();
+
+        for (const auto& pendingRelease : m_pendingBufferReleases)
+            m_eglExtensionProcs->eglDestroySyncKHR(pendingRelease.fence);
+
         m_compositorGlobal.destroy();
         m_shellGlobal.destroy();
         m_waylandOutputGlobal.destroy();
@@ -97,16 +105,82 @@ namespace ramses::internal
     {
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::handleRequestsFromClients(): handling pending events and requests from clients");
 
-        m_serverDisplay.dispatchEventLoop();
+        if (m_useEventThread)
+        {
+            // started only once render thread handles clients, so that client requests are never dispatched before renderer is ready
+            if (!m_eventThread.joinable())
+            {
+                LOG_INFO(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::handleRequestsFromClients(): starting event thread");
+                m_eventThread.start(*this);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_lock);
+        // fall back to dispatching in render thread if event thread stopped on error
+        if (!m_eventThread.isRunning())
+            m_serverDisplay.dispatchEventLoop();
+
+        fenceBuffersToRelease();
+        releaseBuffersUnusedByGpu();
+    }
+
+    void EmbeddedCompositor_Wayland::stopEventThread()
+    {
+        if (!m_eventThread.joinable())
+            return;
+
+        m_eventThread.cancel();
+        m_eventThread.join();
+        LOG_INFO(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::stopEventThread(): event thread stopped");
+    }
+
+    void EmbeddedCompositor_Wayland::setClientRequestsListener(std::function<void()> listener)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_clientRequestsListener = std::move(listener);
+    }
+
+    bool EmbeddedCompositor_Wayland::isEventThreadRunning() const
+    {
+        return m_eventThread.isRunning();
+    }
+
+    void EmbeddedCompositor_Wayland::run()
+    {
+        // timeout only bounds the delay until cancel request is noticed
+        constexpr int pollTimeoutMs = 100;
+        pollfd eventLoopFd{ m_serverDisplay.getEventLoopFileDescriptor(), POLLIN, 0 };
+
+        while (!isCancelRequested())
+        {
+            eventLoopFd.revents = 0;
+            const int result = poll(&eventLoopFd, 1u, pollTimeoutMs);
+            if (result < 0 && errno != EINTR)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::run(): polling event loop failed with errno {}, stopping event thread", errno);
+                break;
+            }
+            if (result <= 0)
+                continue;
+
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_serverDisplay.dispatchEventLoop();
+            // events sent to clients while dispatching (e.g. buffer release) are not delayed until end of frame
+            m_serverDisplay.flushClients();
+            if (m_clientRequestsListener)
+                m_clientRequestsListener();
+        }
     }
 
     bool EmbeddedCompositor_Wayland::hasUpdatedStreamTextureSources() const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         return !m_updatedStreamTextureSourceIds.empty();
     }
 
     WaylandIviSurfaceIdSet EmbeddedCompositor_Wayland::dispatchUpdatedStreamTextureSourceIds()
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::dispatchUpdatedStreamTextureSourceIds(): count of pending updates for dispatching :{}", m_updatedStreamTextureSourceIds.size());
         WaylandIviSurfaceIdSet result = m_updatedStreamTextureSourceIds;
         m_updatedStreamTextureSourceIds.clear();
@@ -115,6 +189,7 @@ namespace ramses::internal
 
     WaylandIviSurfaceIdSet EmbeddedCompositor_Wayland::dispatchNewStreamTextureSourceIds()
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         auto result = m_newStreamTextureSourceIds;
         m_newStreamTextureSourceIds.clear();
         return result;
@@ -122,6 +197,7 @@ namespace ramses::internal
 
     WaylandIviSurfaceIdSet EmbeddedCompositor_Wayland::dispatchObsoleteStreamTextureSourceIds()
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         auto result = m_obsoleteStreamTextureSourceIds;
         m_obsoleteStreamTextureSourceIds.clear();
         return result;
@@ -129,6 +205,7 @@ namespace ramses::internal
 
     void EmbeddedCompositor_Wayland::logInfos(RendererLogContext& context) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         WaylandEGLExtensionProcs eglExt(m_context.getEglDisplay());
         context << m_surfaces.size() << " wayland surface(s)" << RendererLogContext::NewLine;
         context.indent();
@@ -149,6 +226,7 @@ namespace ramses::internal
 
     void EmbeddedCompositor_Wayland::logPeriodicInfo(StringOutputStream& sos) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         sos << "EC: ";
         for (auto surface: m_surfaces)
         {
@@ -204,6 +282,7 @@ namespace ramses::internal
 
     void EmbeddedCompositor_Wayland::endFrame(bool notifyClients)
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         if (notifyClients)
         {
             LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::endFrame(): will send surface frame callbacks to clients");
@@ -216,6 +295,8 @@ namespace ramses::internal
             }
         }
 
+        releaseBuffersUnusedByGpu();
+
         LOG_TRACE(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::endFrame(): flusing clients");
 
         m_serverDisplay.flushClients();
@@ -223,6 +304,7 @@ namespace ramses::internal
 
     uint32_t EmbeddedCompositor_Wayland::uploadCompositingContentForStreamTexture(WaylandIviSurfaceId streamTextureSourceId, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter)
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         assert(streamTextureSourceId.isValid());
         IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(streamTextureSourceId);
         assert(nullptr != waylandClientSurface);
@@ -245,6 +327,7 @@ namespace ramses::internal
         LinuxDmabufBufferData* linuxDmabufBuffer = LinuxDmabufBuffer::fromWaylandBufferResource(waylandBufferResource);
 
         const bool surfaceBufferTypeChanged = waylandSurface->dispatchBufferTypeChanged();
+        const WaylandBufferDamage bufferDamage = waylandSurface->dispatchBufferDamage();
 
         if(surfaceBufferTypeChanged)
         {
@@ -258,8 +341,7 @@ namespace ramses::internal
 
         if (nullptr != sharedMemoryBufferData)
         {
-            const TextureSwizzleArray swizzle = {ETextureChannelColor::Blue, ETextureChannelColor::Green, ETextureChannelColor::Red, ETextureChannelColor::Alpha};
-            textureUploadingAdapter.uploadTexture2D(textureHandle, waylandBufferResource.getWidth(), waylandBufferResource.getHeight(), EPixelStorageFormat::RGBA8, sharedMemoryBufferData, swizzle);
+            static_cast<TextureUploadingAdapter_Wayland&>(textureUploadingAdapter).uploadTextureFromSharedMemory(textureHandle, waylandBufferResource.getWidth(), waylandBufferResource.getHeight(), sharedMemoryBufferData, bufferDamage);
         }
         else if (nullptr != linuxDmabufBuffer)
         {
@@ -281,6 +363,7 @@ namespace ramses::internal
 
     bool EmbeddedCompositor_Wayland::isContentAvailableForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         const IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(streamTextureSourceId);
         if(waylandClientSurface)
         {
@@ -292,6 +375,7 @@ namespace ramses::internal
 
     uint64_t EmbeddedCompositor_Wayland::getNumberOfCommitedFramesForWaylandIviSurfaceSinceBeginningOfTime(WaylandIviSurfaceId waylandSurfaceId) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         const IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(waylandSurfaceId);
         if (waylandClientSurface)
         {
@@ -302,6 +386,7 @@ namespace ramses::internal
 
     bool EmbeddedCompositor_Wayland::isBufferAttachedToWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         const IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(waylandSurfaceId);
         if (waylandClientSurface)
         {
@@ -312,11 +397,13 @@ namespace ramses::internal
 
     uint32_t EmbeddedCompositor_Wayland::getNumberOfCompositorConnections() const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         return m_compositorConnections.size();
     }
 
     bool EmbeddedCompositor_Wayland::hasSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         for (const auto surface: m_surfaces)
         {
             if (surface->getIviSurfaceId() == streamTextureSourceId)
@@ -328,14 +415,14 @@ namespace ramses::internal
         return false;
     }
 
-    const IWaylandSurface& EmbeddedCompositor_Wayland::findSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const
+    const IWaylandSurface* EmbeddedCompositor_Wayland::findSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const
     {
-        const auto it = std::find_if(std::cbegin(m_surfaces), std::cend(m_surfaces), [&](const auto surface){ return surface->getIviSurfaceId() == streamTextureSourceId;});
-        return **it;
+        return findWaylandSurfaceByIviSurfaceId(streamTextureSourceId);
     }
 
     std::string EmbeddedCompositor_Wayland::getTitleOfWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const
     {
+        std::lock_guard<std::mutex> lock(m_lock);
         const IWaylandSurface* waylandClientSurface = findWaylandSurfaceByIviSurfaceId(waylandSurfaceId);
         if (waylandClientSurface)
         {
@@ -380,12 +467,87 @@ namespace ramses::internal
             assert(false);
         }
 
+        removeBufferFromPendingReleases(buffer);
+
         for (auto surface: m_surfaces)
         {
             surface->bufferDestroyed(buffer);
         }
     }
 
+    const WaylandEGLExtensionProcs& EmbeddedCompositor_Wayland::getEglExtensionProcs()
+    {
+        if (!m_eglExtensionProcs)
+            m_eglExtensionProcs = std::make_unique<WaylandEGLExtensionProcs>(m_context.getEglDisplay());
+        return *m_eglExtensionProcs;
+    }
+
+    void EmbeddedCompositor_Wayland::releaseBufferWhenUnusedByGpu(IWaylandBuffer& buffer)
+    {
+        // can be called from event thread, fence is created later in render thread
+        // buffer released again before earlier release was sent is kept only with its newest (latest signaling) fence
+        removeBufferFromPendingReleases(buffer);
+        m_buffersToFence.push_back(&buffer);
+    }
+
+    void EmbeddedCompositor_Wayland::fenceBuffersToRelease()
+    {
+        if (m_buffersToFence.empty())
+            return;
+
+        if (!getEglExtensionProcs().areFenceSyncExtensionsSupported())
+        {
+            for (auto* buffer : m_buffersToFence)
+                buffer->getResource().bufferSendRelease();
+            m_buffersToFence.clear();
+            return;
+        }
+
+        // fence covers all GL commands issued so far, i.e. also all commands which could read from the buffers
+        const EGLSyncKHR fence = m_eglExtensionProcs->eglCreateSyncKHR(EGL_SYNC_FENCE_KHR, nullptr);
+        if (fence == EGL_NO_SYNC_KHR)
+        {
+            LOG_WARN(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::fenceBuffersToRelease(): failed to create fence, releasing {} buffer(s) immediately", m_buffersToFence.size());
+            for (auto* buffer : m_buffersToFence)
+                buffer->getResource().bufferSendRelease();
+        }
+        else
+        {
+            m_pendingBufferReleases.push_back({ fence, std::move(m_buffersToFence) });
+        }
+        m_buffersToFence.clear();
+    }
+
+    void EmbeddedCompositor_Wayland::releaseBuffersUnusedByGpu()
+    {
+        // fences signal in order of creation
+        auto it = m_pendingBufferReleases.begin();
+        for (; it != m_pendingBufferReleases.end(); ++it)
+        {
+            const EGLint status = m_eglExtensionProcs->eglClientWaitSyncKHR(it->fence, EGL_SYNC_FLUSH_COMMANDS_BIT_KHR, 0u);
+            if (status == EGL_TIMEOUT_EXPIRED_KHR)
+                break;
+            if (status != EGL_CONDITION_SATISFIED_KHR)
+                LOG_WARN(CONTEXT_RENDERER, "EmbeddedCompositor_Wayland::releaseBuffersUnusedByGpu(): waiting for fence failed, releasing {} buffer(s)", it->buffers.size());
+
+            for (auto* buffer : it->buffers)
+            {
+                // buffer could have been attached to surface again meanwhile
+                if (!buffer->isReferenced())
+                    buffer->getResource().bufferSendRelease();
+            }
+            m_eglExtensionProcs->eglDestroySyncKHR(it->fence);
+        }
+        m_pendingBufferReleases.erase(m_pendingBufferReleases.begin(), it);
+    }
+
+    void EmbeddedCompositor_Wayland::removeBufferFromPendingReleases(const IWaylandBuffer& buffer)
+    {
+        m_buffersToFence.erase(std::remove(m_buffersToFence.begin(), m_buffersToFence.end(), &buffer), m_buffersToFence.end());
+        for (auto& pendingRelease : m_pendingBufferReleases)
+            pendingRelease.buffers.erase(std::remove(pendingRelease.buffers.begin(), pendingRelease.buffers.end(), &buffer), pendingRelease.buffers.end());
+    }
+
     void EmbeddedCompositor_Wayland::removeWaylandCompositorConnection(IWaylandCompositorConnection& waylandCompositorConnection)
     {
         const bool removed = m_compositorConnections.remove(&waylandCompositorConnection);
@@ -18,8 +18,13 @@
 #include "internal/Platform/Wayland/EmbeddedCompositor/LinuxDmabufGlobal.h"
 #include "internal/RendererLib/PlatformInterface/IEmbeddedCompositor.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/Platform/Wayland/WaylandEGLExtensionProcs.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -31,7 +36,10 @@ namespace ramses::internal
     class WaylandBufferResource;
     class IWaylandRegion;
 
-    class EmbeddedCompositor_Wayland: public IEmbeddedCompositor, public IEmbeddedCompositor_Wayland
+    // If enabled in display config, requests of clients are dispatched by a dedicated event thread as soon as they arrive.
+    // All wayland objects are then shared between event thread and render thread, every IEmbeddedCompositor call
+    // is serialized with dispatching of client requests (IEmbeddedCompositor_Wayland callbacks are only called while dispatching).
+    class EmbeddedCompositor_Wayland: public IEmbeddedCompositor, public IEmbeddedCompositor_Wayland, private Runnable
     {
     public:
         EmbeddedCompositor_Wayland(const DisplayConfigData& displayConfig, Context_EGL& context);
@@ -54,15 +62,20 @@ namespace ramses::internal
         [[nodiscard]] bool isBufferAttachedToWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const override;
         [[nodiscard]] uint32_t getNumberOfCompositorConnections() const override;
         [[nodiscard]] bool hasSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const override;
-        [[nodiscard]] const IWaylandSurface& findSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const;
+        // does not lock, to be used only from callbacks while dispatching client requests
+        [[nodiscard]] const IWaylandSurface* findSurfaceForStreamTexture(WaylandIviSurfaceId streamTextureSourceId) const;
         [[nodiscard]] std::string getTitleOfWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const override;
         void logInfos(RendererLogContext& context) const override;
         void logPeriodicInfo(StringOutputStream& sos) const override;
+        void stopEventThread() override;
+        void setClientRequestsListener(std::function<void()> listener) override;
+        [[nodiscard]] bool isEventThreadRunning() const override;
 
         void addWaylandSurface(IWaylandSurface& waylandSurface) override;
         void removeWaylandSurface(IWaylandSurface& waylandSurface) override;
 
         void handleBufferDestroyed(IWaylandBuffer& buffer) override;
+        void releaseBufferWhenUnusedByGpu(IWaylandBuffer& buffer) override;
 
         void addWaylandCompositorConnection(IWaylandCompositorConnection& waylandCompositorConnection) override;
         void removeWaylandCompositorConnection(IWaylandCompositorConnection& waylandCompositorConnection) override;
@@ -78,6 +91,8 @@ namespace ramses::internal
         [[nodiscard]] bool isRealCompositor() const override; //TODO Mohamed: remove this when dummy EC is removed
 
     private:
+        void run() override;
+
         [[nodiscard]] IWaylandSurface* findWaylandSurfaceByIviSurfaceId(WaylandIviSurfaceId iviSurfaceId) const;
 
         static void UploadCompositingContentForWaylandSurface(IWaylandSurface* waylandSurface, DeviceResourceHandle textureHandle, ITextureUploadingAdapter& textureUploadingAdapter);
@@ -89,10 +104,16 @@ namespace ramses::internal
         bool addSocketToDisplayWithName(const std::string& embeddedSocketName);
         IWaylandBuffer* findWaylandBuffer(WaylandBufferResource& bufferResource);
 
+        void fenceBuffersToRelease();
+        void releaseBuffersUnusedByGpu();
+        void removeBufferFromPendingReleases(const IWaylandBuffer& buffer);
+        const WaylandEGLExtensionProcs& getEglExtensionProcs();
+
         const std::string           m_waylandEmbeddedSocketName;
         const std::string           m_waylandEmbeddedSocketGroup;
         const uint32_t              m_waylandEmbeddedSocketPermissions;
         const int                   m_waylandEmbeddedSocketFD;
+        const bool                  m_useEventThread;
         Context_EGL&                m_context;
 
         WaylandDisplay              m_serverDisplay;
@@ -117,5 +138,20 @@ namespace ramses::internal
 
         using WaylandRegions = HashSet<IWaylandRegion *>;
         WaylandRegions m_regions;
+
+        // Buffers read by GPU (dmabuf, wl_drm) are released to client only after a fence created after their last use signals,
+        // otherwise client could render to buffer while GPU still samples it. Fences are polled, never waited for.
+        struct PendingBufferRelease
+        {
+            EGLSyncKHR fence = EGL_NO_SYNC_KHR;
+            std::vector<IWaylandBuffer*> buffers;
+        };
+        std::unique_ptr<WaylandEGLExtensionProcs> m_eglExtensionProcs;
+        std::vector<IWaylandBuffer*> m_buffersToFence;
+        std::vector<PendingBufferRelease> m_pendingBufferReleases;
+
+        mutable std::mutex m_lock;
+        PlatformThread m_eventThread{ "EC_Events" };
+        std::function<void()> m_clientRequestsListener;
     };
 }
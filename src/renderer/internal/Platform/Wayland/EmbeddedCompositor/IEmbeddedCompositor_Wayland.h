@@ -22,6 +22,8 @@ namespace ramses::internal
         virtual ~IEmbeddedCompositor_Wayland() = default;
 
         virtual void handleBufferDestroyed(IWaylandBuffer& buffer) = 0;
+        // buffer is not attached to any surface anymore, but GPU might still read from it (e.g. EGL image of dmabuf)
+        virtual void releaseBufferWhenUnusedByGpu(IWaylandBuffer& buffer) = 0;
         virtual void addWaylandSurface(IWaylandSurface& waylandSurface) = 0;
         virtual void removeWaylandSurface(IWaylandSurface& waylandSurface) = 0;
         virtual IWaylandBuffer& getOrCreateBuffer(WaylandBufferResource& bufferResource) = 0;
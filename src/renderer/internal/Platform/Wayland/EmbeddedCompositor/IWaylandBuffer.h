@@ -21,6 +21,7 @@ namespace ramses::internal
         [[nodiscard]] virtual WaylandBufferResource& getResource() const = 0;
         virtual void reference() = 0;
         virtual void release() = 0;
+        [[nodiscard]] virtual bool isReferenced() const = 0;
         [[nodiscard]] virtual bool isSharedMemoryBuffer() const = 0;
         virtual void logInfos(RendererLogContext& context, const WaylandEGLExtensionProcs& eglExt) const = 0;
     };
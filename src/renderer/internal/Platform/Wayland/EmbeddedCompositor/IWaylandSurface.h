@@ -10,6 +10,7 @@
 
 #include "internal/Platform/Wayland/EmbeddedCompositor/IWaylandClient.h"
 #include "internal/RendererLib/Types.h"
+#include "internal/Platform/Wayland/EmbeddedCompositor/WaylandBufferDamage.h"
 
 #include <string>
 
@@ -54,5 +55,7 @@ namespace ramses::internal
         [[nodiscard]] virtual bool hasIviSurface() const = 0;
         [[nodiscard]] virtual WaylandClientCredentials getClientCredentials() const = 0;
         virtual bool dispatchBufferTypeChanged() = 0;
+        // damage of committed buffers accumulated since last dispatch
+        virtual WaylandBufferDamage dispatchBufferDamage() = 0;
     };
 }
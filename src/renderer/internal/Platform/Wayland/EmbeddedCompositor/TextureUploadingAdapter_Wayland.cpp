@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/Platform/Wayland/EmbeddedCompositor/TextureUploadingAdapter_Wayland.h"
+#include <algorithm>
 #include <cassert>
 #include <functional>
 
@@ -55,12 +56,61 @@ namespace ramses::internal
         }
     }
 
+    void TextureUploadingAdapter_Wayland::uploadTexture2D(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle)
+    {
+        m_sharedMemoryTextureSizes.erase(textureHandle);
+        TextureUploadingAdapter_Base::uploadTexture2D(textureHandle, width, height, format, data, swizzle);
+    }
+
+    void TextureUploadingAdapter_Wayland::handleTextureDeleted(DeviceResourceHandle textureHandle)
+    {
+        m_sharedMemoryTextureSizes.erase(textureHandle);
+    }
+
+    void TextureUploadingAdapter_Wayland::uploadTextureFromSharedMemory(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, const std::byte* data, const WaylandBufferDamage& damage)
+    {
+        const auto it = m_sharedMemoryTextureSizes.find(textureHandle);
+        const bool textureHoldsPreviousContent = (it != m_sharedMemoryTextureSizes.end()) && (it->second.width == width) && (it->second.height == height);
+        if (!textureHoldsPreviousContent || damage.wholeBuffer)
+        {
+            const TextureSwizzleArray swizzle = {ETextureChannelColor::Blue, ETextureChannelColor::Green, ETextureChannelColor::Red, ETextureChannelColor::Alpha};
+            TextureUploadingAdapter_Base::uploadTexture2D(textureHandle, width, height, EPixelStorageFormat::RGBA8, data, swizzle);
+            m_sharedMemoryTextureSizes[textureHandle] = { width, height };
+            return;
+        }
+
+        // clients often report damage exceeding buffer (e.g. INT32_MAX as size)
+        const int64_t left = std::clamp<int64_t>(damage.x, 0, width);
+        const int64_t top = std::clamp<int64_t>(damage.y, 0, height);
+        const int64_t right = std::clamp<int64_t>(int64_t{ damage.x } + damage.width, 0, width);
+        const int64_t bottom = std::clamp<int64_t>(int64_t{ damage.y } + damage.height, 0, height);
+        if (left >= right || top >= bottom)
+            return;
+
+        LOG_DEBUG(CONTEXT_RENDERER, "TextureUploadingAdapter_Wayland::uploadTextureFromSharedMemory: x:{} y:{} w:{} h:{} of w:{} h:{}", left, top, right - left, bottom - top, width, height);
+
+        const GLuint texID = m_device.getTextureAddress(textureHandle);
+        glBindTexture(GL_TEXTURE_2D, texID);
+        // texture bound directly, not through device
+        m_device.invalidateStateCache();
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(width));
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, static_cast<GLint>(top));
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, static_cast<GLint>(left));
+        glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(left), static_cast<GLint>(top), static_cast<GLsizei>(right - left), static_cast<GLsizei>(bottom - top), GL_RGBA, GL_UNSIGNED_BYTE, data);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+        glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    }
+
     void TextureUploadingAdapter_Wayland::uploadTextureFromWaylandResource(DeviceResourceHandle textureHandle, wl_resource *bufferResource)
     {
+        m_sharedMemoryTextureSizes.erase(textureHandle);
         if (m_waylandEglExtensionProcs.areExtensionsSupported())
         {
             const GLuint texID = m_device.getTextureAddress(textureHandle);
             glBindTexture(GL_TEXTURE_2D, texID);
+            // texture bound directly, not through device
+            m_device.invalidateStateCache();
 
             if (CONTEXT_RENDERER.getLogLevel() >= ELogLevel::Debug)
             {
@@ -260,6 +310,7 @@ namespace ramses::internal
 
     bool TextureUploadingAdapter_Wayland::uploadTextureFromLinuxDmabuf(DeviceResourceHandle textureHandle, LinuxDmabufBufferData* dmabuf)
     {
+        m_sharedMemoryTextureSizes.erase(textureHandle);
 
         DmabufEglImage* image = nullptr;
         auto iter = m_dmabufEglImagesMap.find(dmabuf);
@@ -283,6 +334,8 @@ namespace ramses::internal
         // Now refresh the texture from it
         const GLuint texID = m_device.getTextureAddress(textureHandle);
         glBindTexture(GL_TEXTURE_2D, texID);
+        // texture bound directly, not through device
+        m_device.invalidateStateCache();
         m_waylandEglExtensionProcs.glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image->getEglImage());
 
         return true;
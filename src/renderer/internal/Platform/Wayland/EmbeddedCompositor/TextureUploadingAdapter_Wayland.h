@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/PlatformBase/TextureUploadingAdapter_Base.h"
 #include "internal/Platform/Wayland/WaylandEGLExtensionProcs.h"
+#include "internal/Platform/Wayland/EmbeddedCompositor/WaylandBufferDamage.h"
 #include <unordered_map>
 
 namespace ramses::internal
@@ -22,6 +23,11 @@ namespace ramses::internal
         TextureUploadingAdapter_Wayland(IDevice& device, wl_display* waylandWindowDisplay, wl_display* embeddedCompositingDisplay);
         ~TextureUploadingAdapter_Wayland() override;
 
+        void uploadTexture2D(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
+        void handleTextureDeleted(DeviceResourceHandle textureHandle) override;
+
+        // uploads only damaged part of buffer if texture holds content of previous shared memory buffer of same size
+        void uploadTextureFromSharedMemory(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, const std::byte* data, const WaylandBufferDamage& damage);
         void uploadTextureFromWaylandResource(DeviceResourceHandle textureHandle, wl_resource* bufferResource);
         bool uploadTextureFromLinuxDmabuf(DeviceResourceHandle textureHandle, LinuxDmabufBufferData* dmabuf);
 
@@ -51,6 +57,14 @@ namespace ramses::internal
         wl_display* const                m_embeddedCompositingDisplay;
         std::unordered_map<LinuxDmabufBufferData*, DmabufEglImage*> m_dmabufEglImagesMap;
 
+        struct SharedMemoryTextureSize
+        {
+            uint32_t width = 0u;
+            uint32_t height = 0u;
+        };
+        // textures last uploaded from shared memory buffer, only those can be updated partially
+        std::unordered_map<DeviceResourceHandle, SharedMemoryTextureSize> m_sharedMemoryTextureSizes;
+
         friend class DmabufEglImage;
     };
 
@@ -73,10 +73,20 @@ WARNINGS_POP
 
         if (--m_refCount == 0)
         {
-            m_bufferResource.bufferSendRelease();
+            // shared memory content was already copied on upload, other buffers are read by GPU directly
+            // and must not be given back to client before GPU finished reading them
+            if (isSharedMemoryBuffer())
+                m_bufferResource.bufferSendRelease();
+            else
+                m_compositor.releaseBufferWhenUnusedByGpu(*this);
         }
     }
 
+    bool WaylandBuffer::isReferenced() const
+    {
+        return m_refCount > 0;
+    }
+
     bool WaylandBuffer::isSharedMemoryBuffer() const
     {
         return m_bufferResource.bufferGetSharedMemoryData() != nullptr;
@@ -27,6 +27,7 @@ namespace ramses::internal
         [[nodiscard]] WaylandBufferResource& getResource() const override;
         void reference() override;
         void release() override;
+        [[nodiscard]] bool isReferenced() const override;
         [[nodiscard]] bool isSharedMemoryBuffer() const override;
         void logInfos(RendererLogContext& context, const WaylandEGLExtensionProcs& eglExt) const override;
 
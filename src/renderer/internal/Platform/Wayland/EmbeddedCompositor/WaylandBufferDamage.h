@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace ramses::internal
+{
+    // Bounding rectangle of buffer content changed by client, in buffer coordinates (buffer scale and transform are ignored by compositor)
+    struct WaylandBufferDamage
+    {
+        int32_t x = 0;
+        int32_t y = 0;
+        int32_t width = 0;
+        int32_t height = 0;
+        // whole buffer has to be considered changed (e.g. first buffer, or client did not report damage)
+        bool wholeBuffer = false;
+
+        [[nodiscard]] bool isEmpty() const
+        {
+            return !wholeBuffer && (width <= 0 || height <= 0);
+        }
+
+        void add(int32_t rectX, int32_t rectY, int32_t rectWidth, int32_t rectHeight)
+        {
+            if (wholeBuffer || rectWidth <= 0 || rectHeight <= 0)
+                return;
+
+            if (isEmpty())
+            {
+                x = rectX;
+                y = rectY;
+                width = rectWidth;
+                height = rectHeight;
+                return;
+            }
+
+            const int64_t right = std::max<int64_t>(int64_t{ x } + width, int64_t{ rectX } + rectWidth);
+            const int64_t bottom = std::max<int64_t>(int64_t{ y } + height, int64_t{ rectY } + rectHeight);
+            x = std::min(x, rectX);
+            y = std::min(y, rectY);
+            width = static_cast<int32_t>(std::min<int64_t>(right - x, int64_t{ std::numeric_limits<int32_t>::max() }));
+            height = static_cast<int32_t>(std::min<int64_t>(bottom - y, int64_t{ std::numeric_limits<int32_t>::max() }));
+        }
+
+        void add(const WaylandBufferDamage& other)
+        {
+            if (other.wholeBuffer)
+                wholeBuffer = true;
+            else
+                add(other.x, other.y, other.width, other.height);
+        }
+    };
+}
@@ -251,6 +251,11 @@ namespace ramses::internal
         wl_event_loop_dispatch(loop, 0u);
     }
 
+    int WaylandDisplay::getEventLoopFileDescriptor() const
+    {
+        return wl_event_loop_get_fd(wl_display_get_event_loop(m_display));
+    }
+
     void WaylandDisplay::flushClients()
     {
         wl_display_flush_clients(m_display);
@@ -25,6 +25,7 @@ namespace ramses::internal
         IWaylandGlobal* createGlobal(const wl_interface *interface, int version, void *data, wl_global_bind_func_t bind) override;
         void dispatchEventLoop() override;
         void flushClients() override;
+        [[nodiscard]] int getEventLoopFileDescriptor() const;
         [[nodiscard]] wl_display* get() const; // (AI) TODO - Eliminate, when TextureUploadingAdapter_Wayland does not need the wl_display anymore.
 
     private:
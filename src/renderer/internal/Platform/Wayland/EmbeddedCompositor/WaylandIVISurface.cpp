@@ -37,7 +37,8 @@ namespace ramses::internal
         }
         else
         {
-            if (!m_compositor.hasSurfaceForStreamTexture(iviSurfaceId))
+            const IWaylandSurface* surfaceWithSameId = m_compositor.findSurfaceForStreamTexture(iviSurfaceId);
+            if (surfaceWithSameId == nullptr)
             {
                 m_resource = client.resourceCreate(&ivi_surface_interface, iviApplicationConnectionResource.getVersion(), id);
                 if (nullptr != m_resource)
@@ -62,8 +63,7 @@ namespace ramses::internal
             }
             else
             {
-
-                const auto credentialsForOtherClient = m_compositor.findSurfaceForStreamTexture(iviSurfaceId).getClientCredentials();
+                const auto credentialsForOtherClient = surfaceWithSameId->getClientCredentials();
 
                 LOG_ERROR(CONTEXT_RENDERER,
                     "WaylandIVISurface::WaylandIVISurface: failed creating {} for  {}. A wayland surface already exists with same ivi-surface id for {}",
@@ -214,9 +214,11 @@ namespace ramses::internal
     }
 
     void
-    WaylandSurface::surfaceDamage([[maybe_unused]] IWaylandClient& client, [[maybe_unused]] int x, [[maybe_unused]] int y, [[maybe_unused]] int width, [[maybe_unused]] int height)
+    WaylandSurface::surfaceDamage([[maybe_unused]] IWaylandClient& client, int x, int y, int width, int height)
     {
         LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamage");
+        // surface and buffer coordinates are same, buffer scale and transform are ignored
+        m_pendingBufferDamage.add(x, y, width, height);
     }
 
     void WaylandSurface::surfaceFrame(IWaylandClient& client, uint32_t id)
@@ -265,6 +267,11 @@ namespace ramses::internal
         {
             LOG_TRACE(CONTEXT_RENDERER,
                       "WaylandSurface::surfaceCommit: new texture data for surface {}", getIviSurfaceId());
+            // many clients do not report damage with new buffer, then its whole content is considered changed
+            if (m_pendingBufferDamage.isEmpty() || m_bufferTypeChanged)
+                m_bufferDamage.wholeBuffer = true;
+            else
+                m_bufferDamage.add(m_pendingBufferDamage);
             setBufferToSurface(*m_pendingBuffer);
             m_pendingBuffer = nullptr;
         }
@@ -279,6 +286,7 @@ namespace ramses::internal
                 unsetBufferFromSurface();
             }
         }
+        m_pendingBufferDamage = {};
         m_removeBufferOnNextCommit = false;
         m_numberOfCommitedFrames++;
         m_numberOfCommitedFramesSinceBeginningOfTime++;
@@ -295,9 +303,10 @@ namespace ramses::internal
     }
 
     void WaylandSurface::surfaceDamageBuffer(
-        [[maybe_unused]] IWaylandClient& client, [[maybe_unused]] int32_t x, [[maybe_unused]] int32_t y, [[maybe_unused]] int32_t width, [[maybe_unused]] int32_t height)
+        [[maybe_unused]] IWaylandClient& client, int32_t x, int32_t y, int32_t width, int32_t height)
     {
         LOG_TRACE(CONTEXT_RENDERER, "WaylandSurface::surfaceDamageBuffer");
+        m_pendingBufferDamage.add(x, y, width, height);
     }
 
     WaylandClientCredentials WaylandSurface::getClientCredentials() const
@@ -312,6 +321,13 @@ namespace ramses::internal
         return result;
     }
 
+    WaylandBufferDamage WaylandSurface::dispatchBufferDamage()
+    {
+        const auto result = m_bufferDamage;
+        m_bufferDamage = {};
+        return result;
+    }
+
     void WaylandSurface::SurfaceDestroyCallback([[maybe_unused]] wl_client* client, wl_resource* surfaceResource)
     {
         auto* surface = static_cast<WaylandSurface*>(wl_resource_get_user_data(surfaceResource));
@@ -439,6 +455,7 @@ namespace ramses::internal
             m_buffer->release();
         }
 
+        m_bufferDamage.wholeBuffer = true;
         setWaylandBuffer(nullptr);
     }
 
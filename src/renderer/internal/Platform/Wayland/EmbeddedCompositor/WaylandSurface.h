@@ -55,6 +55,7 @@ namespace ramses::internal
         void surfaceDamageBuffer(IWaylandClient& client, int32_t x, int32_t y, int32_t width, int32_t height) override;
         [[nodiscard]] WaylandClientCredentials getClientCredentials() const override;
         bool dispatchBufferTypeChanged() override;
+        WaylandBufferDamage dispatchBufferDamage() override;
 
     private:
         void setBufferToSurface(IWaylandBuffer& buffer);
@@ -109,5 +110,7 @@ namespace ramses::internal
         } m_surfaceInterface;
 
         bool m_bufferTypeChanged = false;
+        WaylandBufferDamage m_pendingBufferDamage;
+        WaylandBufferDamage m_bufferDamage{ 0, 0, 0, 0, true };
     };
 }
@@ -26,8 +26,14 @@ namespace ramses::internal
         , m_eglBindWaylandDisplayWL(nullptr)
         , m_eglUnbindWaylandDisplayWL(nullptr)
         , m_eglQueryWaylandBufferWL(nullptr)
+        , m_eglCreateSyncKHR(nullptr)
+        , m_eglDestroySyncKHR(nullptr)
+        , m_eglClientWaitSyncKHR(nullptr)
+        , m_eglDupNativeFenceFDANDROID(nullptr)
         , m_extensionsSupported(false)
         , m_dmabufExtensionsSupported(false)
+        , m_fenceSyncExtensionsSupported(false)
+        , m_nativeFenceSyncExtensionsSupported(false)
     {
         Init();
     }
@@ -39,8 +45,14 @@ namespace ramses::internal
         , m_eglBindWaylandDisplayWL(nullptr)
         , m_eglUnbindWaylandDisplayWL(nullptr)
         , m_eglQueryWaylandBufferWL(nullptr)
+        , m_eglCreateSyncKHR(nullptr)
+        , m_eglDestroySyncKHR(nullptr)
+        , m_eglClientWaitSyncKHR(nullptr)
+        , m_eglDupNativeFenceFDANDROID(nullptr)
         , m_extensionsSupported(false)
         , m_dmabufExtensionsSupported(false)
+        , m_fenceSyncExtensionsSupported(false)
+        , m_nativeFenceSyncExtensionsSupported(false)
     {
         Init();
     }
@@ -96,6 +108,32 @@ namespace ramses::internal
         {
             m_dmabufExtensionsSupported = true;
         }
+
+        if (CheckExtensionAvailable(eglExtensions, "EGL_KHR_fence_sync"))
+        {
+            m_eglCreateSyncKHR = reinterpret_cast<PFNEGLCREATESYNCKHRPROC>(eglGetProcAddress("eglCreateSyncKHR"));
+            LOG_INFO(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::Init: loaded proc eglCreateSyncKHR :{}", reinterpret_cast<void*>(m_eglCreateSyncKHR));
+            assert(m_eglCreateSyncKHR != nullptr);
+
+            m_eglDestroySyncKHR = reinterpret_cast<PFNEGLDESTROYSYNCKHRPROC>(eglGetProcAddress("eglDestroySyncKHR"));
+            LOG_INFO(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::Init: loaded proc eglDestroySyncKHR :{}", reinterpret_cast<void*>(m_eglDestroySyncKHR));
+            assert(m_eglDestroySyncKHR != nullptr);
+
+            m_eglClientWaitSyncKHR = reinterpret_cast<PFNEGLCLIENTWAITSYNCKHRPROC>(eglGetProcAddress("eglClientWaitSyncKHR"));
+            LOG_INFO(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::Init: loaded proc eglClientWaitSyncKHR :{}", reinterpret_cast<void*>(m_eglClientWaitSyncKHR));
+            assert(m_eglClientWaitSyncKHR != nullptr);
+
+            m_fenceSyncExtensionsSupported = true;
+        }
+
+        if (m_fenceSyncExtensionsSupported && CheckExtensionAvailable(eglExtensions, "EGL_ANDROID_native_fence_sync"))
+        {
+            m_eglDupNativeFenceFDANDROID = reinterpret_cast<PFNEGLDUPNATIVEFENCEFDANDROIDPROC>(eglGetProcAddress("eglDupNativeFenceFDANDROID"));
+            LOG_INFO(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::Init: loaded proc eglDupNativeFenceFDANDROID :{}", reinterpret_cast<void*>(m_eglDupNativeFenceFDANDROID));
+            assert(m_eglDupNativeFenceFDANDROID != nullptr);
+
+            m_nativeFenceSyncExtensionsSupported = true;
+        }
     }
 
     bool WaylandEGLExtensionProcs::CheckExtensionAvailable(const HashSet<std::string>& eglExtensions, const std::string& extensionName)
@@ -169,6 +207,46 @@ namespace ramses::internal
         return EGL_FALSE;
     }
 
+    EGLSyncKHR WaylandEGLExtensionProcs::eglCreateSyncKHR(EGLenum type, const EGLint* attributeList) const
+    {
+        if (m_eglCreateSyncKHR)
+        {
+            return m_eglCreateSyncKHR(m_eglDisplay, type, attributeList);
+        }
+        LOG_ERROR(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::eglCreateSyncKHR Extension not bound!");
+        return EGL_NO_SYNC_KHR;
+    }
+
+    EGLBoolean WaylandEGLExtensionProcs::eglDestroySyncKHR(EGLSyncKHR sync) const
+    {
+        if (m_eglDestroySyncKHR)
+        {
+            return m_eglDestroySyncKHR(m_eglDisplay, sync);
+        }
+        LOG_ERROR(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::eglDestroySyncKHR Extension not bound!");
+        return EGL_FALSE;
+    }
+
+    EGLint WaylandEGLExtensionProcs::eglClientWaitSyncKHR(EGLSyncKHR sync, EGLint flags, EGLTimeKHR timeout) const
+    {
+        if (m_eglClientWaitSyncKHR)
+        {
+            return m_eglClientWaitSyncKHR(m_eglDisplay, sync, flags, timeout);
+        }
+        LOG_ERROR(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::eglClientWaitSyncKHR Extension not bound!");
+        return EGL_FALSE;
+    }
+
+    EGLint WaylandEGLExtensionProcs::eglDupNativeFenceFDANDROID(EGLSyncKHR sync) const
+    {
+        if (m_eglDupNativeFenceFDANDROID)
+        {
+            return m_eglDupNativeFenceFDANDROID(m_eglDisplay, sync);
+        }
+        LOG_ERROR(CONTEXT_RENDERER, "WaylandEGLExtensionProcs::eglDupNativeFenceFDANDROID Extension not bound!");
+        return EGL_NO_NATIVE_FENCE_FD_ANDROID;
+    }
+
     bool WaylandEGLExtensionProcs::areExtensionsSupported()const
     {
         return m_extensionsSupported;
@@ -179,6 +257,16 @@ namespace ramses::internal
         return m_dmabufExtensionsSupported;
     }
 
+    bool WaylandEGLExtensionProcs::areFenceSyncExtensionsSupported() const
+    {
+        return m_fenceSyncExtensionsSupported;
+    }
+
+    bool WaylandEGLExtensionProcs::areNativeFenceSyncExtensionsSupported() const
+    {
+        return m_nativeFenceSyncExtensionsSupported;
+    }
+
     const char* WaylandEGLExtensionProcs::getTextureFormatName(EGLint textureFormat)
     {
         switch (textureFormat)
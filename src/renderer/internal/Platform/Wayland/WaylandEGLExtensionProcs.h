@@ -39,9 +39,15 @@ namespace ramses::internal
         EGLBoolean eglBindWaylandDisplayWL(wl_display* waylandDisplay) const;
         EGLBoolean eglUnbindWaylandDisplayWL(wl_display* waylandDisplay) const;
         EGLBoolean eglQueryWaylandBufferWL(wl_resource* buffer, EGLint attribute, EGLint* value) const;
+        EGLSyncKHR eglCreateSyncKHR(EGLenum type, const EGLint* attributeList) const;
+        EGLBoolean eglDestroySyncKHR(EGLSyncKHR sync) const;
+        EGLint eglClientWaitSyncKHR(EGLSyncKHR sync, EGLint flags, EGLTimeKHR timeout) const;
+        EGLint eglDupNativeFenceFDANDROID(EGLSyncKHR sync) const;
 
         [[nodiscard]] bool areExtensionsSupported()const;
         [[nodiscard]] bool areDmabufExtensionsSupported()const;
+        [[nodiscard]] bool areFenceSyncExtensionsSupported()const;
+        [[nodiscard]] bool areNativeFenceSyncExtensionsSupported()const;
 
         static const char* getTextureFormatName(EGLint textureFormat);
 
@@ -58,8 +64,14 @@ namespace ramses::internal
         PFNEGLBINDWAYLANDDISPLAYWL m_eglBindWaylandDisplayWL;
         PFNEGLUNBINDWAYLANDDISPLAYWL m_eglUnbindWaylandDisplayWL;
         PFNEGLQUERYWAYLANDBUFFERWL m_eglQueryWaylandBufferWL;
+        PFNEGLCREATESYNCKHRPROC m_eglCreateSyncKHR;
+        PFNEGLDESTROYSYNCKHRPROC m_eglDestroySyncKHR;
+        PFNEGLCLIENTWAITSYNCKHRPROC m_eglClientWaitSyncKHR;
+        PFNEGLDUPNATIVEFENCEFDANDROIDPROC m_eglDupNativeFenceFDANDROID;
 
         bool m_extensionsSupported;
         bool m_dmabufExtensionsSupported;
+        bool m_fenceSyncExtensionsSupported;
+        bool m_nativeFenceSyncExtensionsSupported;
     };
 }
@@ -79,6 +79,7 @@ namespace ramses::internal
         wl_display_roundtrip(m_wlContext.display);
 
         registerFrameRenderingDoneCallback();
+        requestPresentationFeedback();
 
         return true;
     }
@@ -92,6 +93,16 @@ namespace ramses::internal
             wl_callback_destroy(m_wlContext.frameRenderingDoneWaylandCallbacObject);
         }
 
+        for (const auto& feedback : m_pendingPresentationFeedbacks)
+        {
+            wp_presentation_feedback_destroy(feedback.first);
+        }
+
+        if (m_wlContext.presentation)
+        {
+            wp_presentation_destroy(m_wlContext.presentation);
+        }
+
         if (m_wlContext.native_window)
         {
             wl_egl_window_destroy(m_wlContext.native_window);
@@ -148,6 +159,7 @@ namespace ramses::internal
     {
         assert(m_wlContext.previousFrameRenderingDone);
         m_wlContext.previousFrameRenderingDone = false;
+        ++m_swappedFramesCount;
     }
 
     bool Window_Wayland::canRenderNewFrame() const
@@ -199,6 +211,7 @@ namespace ramses::internal
         window->m_wlContext.previousFrameRenderingDone = true;
 
         window->registerFrameRenderingDoneCallback();
+        window->requestPresentationFeedback();
     }
 
     void Window_Wayland::registerFrameRenderingDoneCallback()
@@ -211,6 +224,63 @@ namespace ramses::internal
         wl_callback_add_listener(m_wlContext.frameRenderingDoneWaylandCallbacObject, &m_frameRenderingDoneCallbackListener, this);
     }
 
+    void Window_Wayland::requestPresentationFeedback()
+    {
+        if (!m_wlContext.presentation)
+            return;
+
+        // feedback is for the next surface commit, i.e. the next swapped frame
+        struct wp_presentation_feedback* feedback = wp_presentation_feedback(m_wlContext.presentation, m_wlContext.surface);
+        wp_presentation_feedback_add_listener(feedback, &m_presentationFeedbackListener, this);
+        m_pendingPresentationFeedbacks.emplace(feedback, m_swappedFramesCount);
+    }
+
+    void Window_Wayland::onPresentationFeedback(struct wp_presentation_feedback* feedback, const timespec* presentationTime)
+    {
+        const auto it = m_pendingPresentationFeedbacks.find(feedback);
+        assert(it != m_pendingPresentationFeedbacks.end());
+        const uint64_t frameIndex = it->second;
+        m_pendingPresentationFeedbacks.erase(it);
+        wp_presentation_feedback_destroy(feedback);
+
+        // discarded frame will be reported as part of the next presented frame
+        if (!presentationTime)
+            return;
+
+        // presentation clock (usually monotonic) is converted to flush time clock using the current offset of the two clocks
+        timespec now{};
+        clock_gettime(static_cast<clockid_t>(m_wlContext.presentationClockId), &now);
+        const auto toDuration = [](const timespec& ts) { return std::chrono::seconds{ ts.tv_sec } + std::chrono::nanoseconds{ ts.tv_nsec }; };
+        const auto timeSincePresentation = std::chrono::duration_cast<FlushTime::Clock::duration>(toDuration(now) - toDuration(*presentationTime));
+        m_eventHandler.onFramePresented(frameIndex, FlushTime::Clock::now() - timeSincePresentation);
+    }
+
+    void Window_Wayland::PresentationClockId(void* data, [[maybe_unused]] wp_presentation* presentation, uint32_t clockId)
+    {
+        auto* window = static_cast<Window_Wayland*>(data);
+        window->m_wlContext.presentationClockId = clockId;
+    }
+
+    void Window_Wayland::PresentationFeedbackSyncOutput([[maybe_unused]] void* data, [[maybe_unused]] struct wp_presentation_feedback* feedback, [[maybe_unused]] wl_output* output)
+    {
+    }
+
+    void Window_Wayland::PresentationFeedbackPresented(void* data, struct wp_presentation_feedback* feedback, uint32_t tvSecHi, uint32_t tvSecLo, uint32_t tvNsec,
+        [[maybe_unused]] uint32_t refresh, [[maybe_unused]] uint32_t seqHi, [[maybe_unused]] uint32_t seqLo, [[maybe_unused]] uint32_t flags)
+    {
+        auto* window = static_cast<Window_Wayland*>(data);
+        timespec presentationTime{};
+        presentationTime.tv_sec = static_cast<time_t>((static_cast<uint64_t>(tvSecHi) << 32u) | tvSecLo);
+        presentationTime.tv_nsec = static_cast<long>(tvNsec);
+        window->onPresentationFeedback(feedback, &presentationTime);
+    }
+
+    void Window_Wayland::PresentationFeedbackDiscarded(void* data, struct wp_presentation_feedback* feedback)
+    {
+        auto* window = static_cast<Window_Wayland*>(data);
+        window->onPresentationFeedback(feedback, nullptr);
+    }
+
     bool Window_Wayland::setFullscreen([[maybe_unused]] bool fullscreen)
     {
         return true;
@@ -251,5 +321,13 @@ namespace ramses::internal
         {
             m_inputHandling.registerSeat(wl_registry, name);
         }
+
+        if (0 == strcmp(interface, "wp_presentation"))
+        {
+            m_wlContext.presentation =
+                reinterpret_cast<wp_presentation*>(wl_registry_bind(wl_registry, name, &wp_presentation_interface, 1));
+            wp_presentation_add_listener(m_wlContext.presentation, &m_presentationListener, this);
+            LOG_DEBUG(CONTEXT_RENDERER, "Window_Wayland::registryGlobalCreated Bound wp_presentation");
+        }
     }
 }
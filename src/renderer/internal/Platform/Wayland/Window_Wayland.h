@@ -11,9 +11,11 @@
 #include "internal/RendererLib/PlatformBase/Window_Base.h"
 #include "internal/Platform/Wayland/WlContext.h"
 #include "InputHandling_Wayland.h"
+#include "presentation-time-client-protocol.h"
 
 #include <chrono>
 #include <string>
+#include <unordered_map>
 
 namespace ramses::internal
 {
@@ -45,12 +47,19 @@ namespace ramses::internal
     private:
 
         void registerFrameRenderingDoneCallback();
+        void requestPresentationFeedback();
+        void onPresentationFeedback(struct wp_presentation_feedback* feedback, const timespec* presentationTime);
         bool setFullscreen(bool fullscreen) override;
         void dispatchWaylandDisplayEvents(std::chrono::milliseconds pollTime) const;
 
         static void RegistryGlobalCreated(void* data, wl_registry* wl_registry, uint32_t name, const char* interface, uint32_t version);
         static void RegistryGlobalRemoved(void* data, wl_registry* wl_registry, uint32_t name);
         static void FrameRenderingDoneCallback(void* data, wl_callback* callback, uint32_t time);
+        static void PresentationClockId(void* data, wp_presentation* presentation, uint32_t clockId);
+        static void PresentationFeedbackSyncOutput(void* data, struct wp_presentation_feedback* feedback, wl_output* output);
+        static void PresentationFeedbackPresented(void* data, struct wp_presentation_feedback* feedback, uint32_t tvSecHi, uint32_t tvSecLo, uint32_t tvNsec,
+            uint32_t refresh, uint32_t seqHi, uint32_t seqLo, uint32_t flags);
+        static void PresentationFeedbackDiscarded(void* data, struct wp_presentation_feedback* feedback);
 
     protected:
         WlContext m_wlContext;
@@ -67,6 +76,24 @@ namespace ramses::internal
             }
         } m_frameRenderingDoneCallbackListener;
 
+        const struct Presentation_Listener : public wp_presentation_listener
+        {
+            Presentation_Listener() : wp_presentation_listener()
+            {
+                clock_id = PresentationClockId;
+            }
+        } m_presentationListener;
+
+        const struct PresentationFeedback_Listener : public wp_presentation_feedback_listener
+        {
+            PresentationFeedback_Listener() : wp_presentation_feedback_listener()
+            {
+                sync_output = PresentationFeedbackSyncOutput;
+                presented   = PresentationFeedbackPresented;
+                discarded   = PresentationFeedbackDiscarded;
+            }
+        } m_presentationFeedbackListener;
+
         const struct Registry_Listener : public wl_registry_listener
         {
             Registry_Listener() : wl_registry_listener()
@@ -77,5 +104,9 @@ namespace ramses::internal
         } m_registryListener;
 
         const std::chrono::microseconds m_frameCallbackMaxPollTime;
+
+        // presentation feedbacks requested for frames (index of frame in order of swap)
+        uint64_t m_swappedFramesCount = 0u;
+        std::unordered_map<struct wp_presentation_feedback*, uint64_t> m_pendingPresentationFeedbacks;
     };
 }
@@ -11,6 +11,7 @@
 #include "internal/RendererLib/PlatformInterface/IWindowEventHandler.h"
 #include "internal/RendererLib/Enums/EKeyModifier.h"
 #include <wayland-egl.h>
+#include <ctime>
 
 struct wl_display;
 struct wl_registry;
@@ -21,6 +22,7 @@ struct wl_seat;
 struct wl_keyboard;
 struct wl_pointer;
 struct wl_egl_window;
+struct wp_presentation;
 
 namespace ramses::internal
 {
@@ -37,6 +39,8 @@ namespace ramses::internal
         wl_egl_window*    window = nullptr;
         wl_egl_window*    native_window = nullptr;
         wl_callback*      frameRenderingDoneWaylandCallbacObject = nullptr;
+        wp_presentation*  presentation = nullptr;
+        uint32_t          presentationClockId = CLOCK_MONOTONIC;
 
         bool              previousFrameRenderingDone = true;
     };
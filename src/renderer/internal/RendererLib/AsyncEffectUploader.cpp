@@ -13,20 +13,23 @@
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/RendererLib/PlatformInterface/IContext.h"
 #include "internal/RendererLib/PlatformInterface/IPlatform.h"
+#include "internal/RendererLib/ResourceUploader.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/TextureResource.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include <algorithm>
 
 namespace ramses::internal
 {
-    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display)
+    AsyncEffectUploader::AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display, ThreadScheduling scheduling)
         : m_platform(platform)
         , m_renderBackend(renderBackend)
         , m_thread{ fmt::format("EffUpload{}", display) }
         , m_notifier(notifier)
         , m_aliveIdentifier(notifier.registerThread())
         , m_displayHandle{ display }
+        , m_scheduling{ std::move(scheduling) }
     {
     }
 
@@ -72,16 +75,22 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: starting");
 
         EffectsRawResources effectsToUpload;
+        TexturesRawResources texturesToUpload;
         {
             std::unique_lock<std::mutex> guard(m_mutex);
             do
             {
                 m_notifier.notifyAlive(m_aliveIdentifier);
             } while (!m_sleepConditionVar.wait_for(
-                guard, m_notifier.calculateTimeout(), [&]() { return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || isCancelRequested(); }));
+                guard, m_notifier.calculateTimeout(), [&]() {
+                    return !m_effectsToUpload.empty() || !m_effectsUploadedCache.empty() || !m_texturesToUpload.empty() || !m_texturesUploadedCache.empty() || isCancelRequested();
+                }));
 
             m_effectsUploaded.insert(m_effectsUploaded.end(), std::make_move_iterator(m_effectsUploadedCache.begin()), std::make_move_iterator(m_effectsUploadedCache.end()));
             m_effectsUploadedCache.clear();
+            m_texturesUploaded.insert(m_texturesUploaded.end(), std::make_move_iterator(m_texturesUploadedCache.begin()), std::make_move_iterator(m_texturesUploadedCache.end()));
+            m_texturesUploadedCache.clear();
+            m_texturesToUpload.swap(texturesToUpload);
 
             //assert none of the shaders to be uploaded next was already uploaded since last sync
             assert(std::all_of(std::begin(m_effectsToUpload), std::end(m_effectsToUpload), [this](const auto& toUpload) {
@@ -97,9 +106,10 @@ namespace ramses::internal
 
         std::chrono::microseconds maxShaderUploadTime{ 0u };
         std::chrono::microseconds totalShaderUploadTime{ 0u };
-        ResourceContentHash effectWithMaxUploadTime;
 
-        for (const auto effectRes : effectsToUpload)
+        // effects are handed to device in batches so that device can compile them concurrently if supported,
+        // batch size is limited so that watchdog is notified and cancel request is handled regularly
+        for (std::size_t batchBegin = 0u; batchBegin < effectsToUpload.size(); batchBegin += MaxEffectsInUploadBatch)
         {
             if (isCancelRequested())
             {
@@ -107,29 +117,33 @@ namespace ramses::internal
                 break;
             }
 
-            const auto& effectHash = effectRes->getHash();
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading: {}", effectHash);
+            EffectsRawResources batch;
+            const std::size_t batchEnd = std::min(batchBegin + MaxEffectsInUploadBatch, effectsToUpload.size());
+            for (std::size_t i = batchBegin; i < batchEnd; ++i)
+            {
+                const auto& effectHash = effectsToUpload[i]->getHash();
+                LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading: {}", effectHash);
+                assert(std::find_if(std::cbegin(m_effectsUploadedCache), std::cend(m_effectsUploadedCache), [&effectHash](const auto& u) {return effectHash == u.first; }) == m_effectsUploadedCache.cend());
+                batch.push_back(effectsToUpload[i]);
+            }
 
-            assert(std::find_if(std::cbegin(m_effectsUploadedCache), std::cend(m_effectsUploadedCache), [&effectHash](const auto& u) {return effectHash == u.first; }) == m_effectsUploadedCache.cend());
             m_notifier.notifyAlive(m_aliveIdentifier);
             const auto shaderUploadStart = std::chrono::steady_clock::now();
-            auto shaderResource = resourceUploadRenderBackend.getDevice().uploadShader(*effectRes);
+            auto shaderResources = resourceUploadRenderBackend.getDevice().uploadShaders(batch);
             const auto shaderUploadTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - shaderUploadStart);
+            assert(shaderResources.size() == batch.size());
 
-            m_effectsUploadedCache.emplace_back(effectHash, std::move(shaderResource));
+            for (std::size_t i = 0u; i < batch.size(); ++i)
+                m_effectsUploadedCache.emplace_back(batch[i]->getHash(), std::move(shaderResources[i]));
 
-            if (shaderUploadTime > maxShaderUploadTime || !effectWithMaxUploadTime.isValid())
-            {
-                maxShaderUploadTime = shaderUploadTime;
-                effectWithMaxUploadTime = effectHash;
-            }
+            maxShaderUploadTime = std::max(maxShaderUploadTime, shaderUploadTime);
             totalShaderUploadTime += shaderUploadTime;
         }
 
         if (!effectsToUpload.empty())
         {
-            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader {} uploaded in {} us (Max: {} us {})",
-                effectsToUpload.size(), totalShaderUploadTime.count(), maxShaderUploadTime.count(), effectWithMaxUploadTime);
+            LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader {} uploaded in {} us (Max batch: {} us)",
+                effectsToUpload.size(), totalShaderUploadTime.count(), maxShaderUploadTime.count());
 
 #if defined(_WIN32)
             // Workaround for bug https://github.com/COVESA/ramses/issues/61
@@ -139,9 +153,46 @@ namespace ramses::internal
 #endif
         }
 
+        uploadTextures(resourceUploadRenderBackend, texturesToUpload);
+
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::uploadEffectsOrWait: finished");
     }
 
+    void AsyncEffectUploader::uploadTextures(IResourceUploadRenderBackend& resourceUploadRenderBackend, const TexturesRawResources& texturesToUpload)
+    {
+        if (texturesToUpload.empty())
+            return;
+
+        IDevice& device = resourceUploadRenderBackend.getDevice();
+        const auto uploadStart = std::chrono::steady_clock::now();
+        const auto batchBegin = m_texturesUploadedCache.size();
+        for (const auto textureRes : texturesToUpload)
+        {
+            if (isCancelRequested())
+            {
+                LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader uploading cancelled");
+                break;
+            }
+
+            m_notifier.notifyAlive(m_aliveIdentifier);
+            uint32_t vramSize = 0u;
+            const DeviceResourceHandle deviceHandle = ResourceUploader::UploadTexture(device, *textureRes, vramSize);
+            // texture object is shared with render thread context, it is removed from upload device and registered in render device after sync
+            m_texturesUploadedCache.push_back({ textureRes->getHash(), deviceHandle.isValid() ? device.extractTexture(deviceHandle) : nullptr, vramSize, {} });
+        }
+
+        if (m_texturesUploadedCache.size() == batchBegin)
+            return;
+
+        // uploaded textures are handed over in next loop iteration without waiting for GPU, render thread's device waits for the fence instead
+        const DeviceFence fence = device.insertFence();
+        for (auto it = m_texturesUploadedCache.begin() + batchBegin; it != m_texturesUploadedCache.end(); ++it)
+            it->fence = fence;
+
+        LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader {} textures uploaded in {} us", m_texturesUploadedCache.size() - batchBegin,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart).count());
+    }
+
     void AsyncEffectUploader::sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut)
     {
         assert(uploadedResourcesOut.empty());
@@ -169,8 +220,25 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_RENDERER, "AsyncEffectUploader::sync: finished");
     }
 
+    void AsyncEffectUploader::syncTextures(const TexturesRawResources& texturesToUpload, TexturesGpuResources& uploadedTexturesOut)
+    {
+        assert(uploadedTexturesOut.empty());
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_texturesToUpload.insert(m_texturesToUpload.cend(), texturesToUpload.cbegin(), texturesToUpload.cend());
+            uploadedTexturesOut.swap(m_texturesUploaded);
+        }
+
+        if (!texturesToUpload.empty())
+            m_sleepConditionVar.notify_one();
+    }
+
     void AsyncEffectUploader::run()
     {
+        if (!PlatformThread::SetCurrentThreadScheduling(m_scheduling))
+            LOG_WARN(CONTEXT_RENDERER, "AsyncEffectUploader: failed to apply thread scheduling {} for display {}", m_scheduling, m_displayHandle);
+        LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader: running with thread scheduling {} for display {}", PlatformThread::GetCurrentThreadScheduling(), m_displayHandle);
+
         LOG_INFO(CONTEXT_RENDERER, "AsyncEffectUploader creating render backend for resource uploading");
         auto resourceUploadRenderBackend = m_platform.createResourceUploadRenderBackend();
         if (!resourceUploadRenderBackend)
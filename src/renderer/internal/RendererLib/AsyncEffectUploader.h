@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/PlatformBase/GpuResource.h"
+#include "internal/RendererLib/Types.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 
@@ -23,25 +24,47 @@ namespace ramses::internal
     class IRenderBackend;
     class IResourceUploadRenderBackend;
     class EffectResource;
+    class TextureResource;
     class IThreadAliveNotifier;
 
     using EffectsGpuResources = std::vector<std::pair<ResourceContentHash, std::unique_ptr<const GPUResource>>>;
     using EffectsRawResources = std::vector<const EffectResource*>;
 
+    struct UploadedTexture
+    {
+        ResourceContentHash hash;
+        // null if upload failed
+        std::unique_ptr<const GPUResource> gpuResource;
+        uint32_t vramSize = 0u;
+        // signaled when upload commands of the texture completed, shared by all textures of one upload batch
+        DeviceFence fence;
+    };
+    using TexturesGpuResources = std::vector<UploadedTexture>;
+    using TexturesRawResources = std::vector<const TextureResource*>;
+
     class AsyncEffectUploader : private Runnable
     {
     public:
-        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display);
+        // max number of effects handed over to device for (possibly parallel) upload at once
+        static constexpr std::size_t MaxEffectsInUploadBatch = 4u;
+
+        // scheduling is applied by the thread itself when started, see DisplayConfig::setEffectUploadThreadScheduling
+        AsyncEffectUploader(IPlatform& platform, IRenderBackend& renderBackend, IThreadAliveNotifier& notifier, DisplayHandle display, ThreadScheduling scheduling = {});
         ~AsyncEffectUploader() override;
 
         bool createResourceUploadRenderBackendAndStartThread();
         void destroyResourceUploadRenderBackendAndStopThread();
 
         void sync(const EffectsRawResources& effectsToUpload, EffectsGpuResources& uploadedResourcesOut);
+        // Large textures are uploaded in the same thread using the shared context, the uploaded texture objects are handed over
+        // together with fence of their upload commands right after these were issued, so that upload of textures for next frames
+        // overlaps with rendering. Caller must make its device wait for every distinct fence before using the textures.
+        void syncTextures(const TexturesRawResources& texturesToUpload, TexturesGpuResources& uploadedTexturesOut);
 
     private:
         void run() override;
         void uploadEffectsOrWait(IResourceUploadRenderBackend& resourceUploadRenderBackend);
+        void uploadTextures(IResourceUploadRenderBackend& resourceUploadRenderBackend, const TexturesRawResources& texturesToUpload);
 
         IPlatform& m_platform;
         IRenderBackend& m_renderBackend;
@@ -55,11 +78,16 @@ namespace ramses::internal
 
         EffectsGpuResources m_effectsUploadedCache; //to avoid acquiring mutex twice in resource upload thread
 
+        TexturesRawResources m_texturesToUpload;
+        TexturesGpuResources m_texturesUploaded;
+        TexturesGpuResources m_texturesUploadedCache;
+
         std::promise<bool> m_creationSuccess;
 
         IThreadAliveNotifier& m_notifier;
         const uint64_t m_aliveIdentifier;
 
         const DisplayHandle m_displayHandle;
+        const ThreadScheduling m_scheduling;
     };
 }
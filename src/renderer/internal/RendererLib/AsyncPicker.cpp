@@ -0,0 +1,99 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AsyncPicker.h"
+#include "internal/Watchdog/IThreadAliveNotifier.h"
+#include <algorithm>
+#include <iterator>
+
+namespace ramses::internal
+{
+    AsyncPicker::AsyncPicker(IThreadAliveNotifier& notifier, DisplayHandle display)
+        : m_thread{ fmt::format("Picking{}", display) }
+        , m_notifier(notifier)
+        , m_aliveIdentifier(notifier.registerThread())
+    {
+        m_thread.start(*this);
+    }
+
+    AsyncPicker::~AsyncPicker()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            // cancel inside critical section to avoid missing the wake up in run()
+            m_thread.cancel();
+        }
+        m_jobAvailable.notify_one();
+        m_thread.join();
+        m_notifier.unregisterThread(m_aliveIdentifier);
+    }
+
+    void AsyncPicker::startPicking(SceneId sceneId, IntersectionUtils::PickableObjectSnapshots&& pickableObjects)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            const auto it = std::find_if(m_jobs.begin(), m_jobs.end(), [sceneId](const Job& job) { return job.sceneId == sceneId; });
+            if (it != m_jobs.end())
+                it->pickableObjects = std::move(pickableObjects);
+            else
+                m_jobs.push_back({ sceneId, std::move(pickableObjects) });
+        }
+        m_jobAvailable.notify_one();
+    }
+
+    bool AsyncPicker::isEmpty() const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        return m_jobs.empty() && !m_picking && m_picked.empty();
+    }
+
+    void AsyncPicker::collectPicked(PickedObjectsVector& pickedOut)
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        std::move(m_picked.begin(), m_picked.end(), std::back_inserter(pickedOut));
+        m_picked.clear();
+    }
+
+    void AsyncPicker::discard(SceneId sceneId)
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [sceneId](const Job& job) { return job.sceneId == sceneId; }), m_jobs.end());
+        m_picked.erase(std::remove_if(m_picked.begin(), m_picked.end(), [sceneId](const PickedObjects& picked) { return picked.sceneId == sceneId; }), m_picked.end());
+        if (m_picking && m_pickingScene == sceneId)
+            m_pickingDiscarded = true;
+    }
+
+    void AsyncPicker::run()
+    {
+        while (!isCancelRequested())
+        {
+            Job job;
+            {
+                std::unique_lock<std::mutex> guard(m_mutex);
+                while (!m_jobAvailable.wait_for(guard, m_notifier.calculateTimeout(), [&]() { return isCancelRequested() || !m_jobs.empty(); }))
+                    m_notifier.notifyAlive(m_aliveIdentifier);
+                if (isCancelRequested())
+                    break;
+                job = std::move(m_jobs.front());
+                m_jobs.erase(m_jobs.begin());
+                m_pickingScene = job.sceneId;
+                m_picking = true;
+                m_pickingDiscarded = false;
+            }
+            m_notifier.notifyAlive(m_aliveIdentifier);
+
+            PickableObjectIds pickedObjects;
+            IntersectionUtils::CheckPickableObjectsForIntersection(job.pickableObjects, pickedObjects);
+
+            std::lock_guard<std::mutex> guard(m_mutex);
+            if (!pickedObjects.empty() && !m_pickingDiscarded)
+                m_picked.push_back({ job.sceneId, std::move(pickedObjects) });
+            m_picking = false;
+        }
+    }
+}
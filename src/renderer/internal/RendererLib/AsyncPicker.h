@@ -0,0 +1,75 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/IntersectionUtils.h"
+#include "internal/RendererLib/Types.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IThreadAliveNotifier;
+
+    // Checks pick events for intersections with snapshots of pickable objects on a background thread.
+    // Pick event of a scene replaces its previous pick event if that one was not started yet,
+    // results are reported only if something was picked and are collected by the caller.
+    class AsyncPicker : private Runnable
+    {
+    public:
+        struct PickedObjects
+        {
+            SceneId sceneId;
+            PickableObjectIds pickedObjects;
+        };
+        using PickedObjectsVector = std::vector<PickedObjects>;
+
+        AsyncPicker(IThreadAliveNotifier& notifier, DisplayHandle display);
+        ~AsyncPicker() override;
+
+        AsyncPicker(const AsyncPicker&) = delete;
+        AsyncPicker& operator=(const AsyncPicker&) = delete;
+
+        void startPicking(SceneId sceneId, IntersectionUtils::PickableObjectSnapshots&& pickableObjects);
+
+        // true until all started pick events are checked and their results collected
+        [[nodiscard]] bool isEmpty() const;
+
+        // appends results of all finished pick events, in order in which picking was started
+        void collectPicked(PickedObjectsVector& pickedOut);
+        // drops pick events and results of scene (e.g. scene is being destroyed), pick event being checked is dropped once finished
+        void discard(SceneId sceneId);
+
+    private:
+        struct Job
+        {
+            SceneId sceneId;
+            IntersectionUtils::PickableObjectSnapshots pickableObjects;
+        };
+
+        void run() override;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_jobAvailable;
+        std::vector<Job> m_jobs;
+        // scene of job being checked by worker thread
+        SceneId m_pickingScene;
+        bool m_picking = false;
+        bool m_pickingDiscarded = false;
+        PickedObjectsVector m_picked;
+
+        PlatformThread m_thread;
+        IThreadAliveNotifier& m_notifier;
+        const uint64_t m_aliveIdentifier;
+    };
+}
@@ -0,0 +1,132 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AsyncSceneActionApplier.h"
+#include "internal/Watchdog/IThreadAliveNotifier.h"
+#include "internal/Core/Utils/LogMacros.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    AsyncSceneActionApplier::AsyncSceneActionApplier(ApplyFunction applyFunction, IThreadAliveNotifier& notifier, DisplayHandle display)
+        : m_applyFunction(std::move(applyFunction))
+        , m_thread{ fmt::format("SceneApply{}", display) }
+        , m_notifier(notifier)
+        , m_aliveIdentifier(notifier.registerThread())
+    {
+        m_thread.start(*this);
+    }
+
+    AsyncSceneActionApplier::~AsyncSceneActionApplier()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            // cancel inside critical section to avoid missing the wake up in run()
+            m_thread.cancel();
+        }
+        m_jobAvailable.notify_one();
+        m_thread.join();
+        m_notifier.unregisterThread(m_aliveIdentifier);
+    }
+
+    void AsyncSceneActionApplier::startApplying(SceneId sceneId, RendererCachedScene& scene, PendingData&& pendingData, const SceneSizeInformation& sizeInfo)
+    {
+        auto job = std::make_unique<Job>();
+        job->sceneId = sceneId;
+        job->scene = &scene;
+        job->pendingData = std::move(pendingData);
+        job->sizeInfo = sizeInfo;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            assert(std::none_of(m_jobs.cbegin(), m_jobs.cend(), [sceneId](const auto& j) { return j->sceneId == sceneId; }));
+            m_jobs.push_back(std::move(job));
+        }
+        m_jobAvailable.notify_one();
+    }
+
+    bool AsyncSceneActionApplier::hasScene(SceneId sceneId) const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        return std::any_of(m_jobs.cbegin(), m_jobs.cend(), [sceneId](const auto& job) { return job->sceneId == sceneId; });
+    }
+
+    bool AsyncSceneActionApplier::isEmpty() const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        return m_jobs.empty();
+    }
+
+    void AsyncSceneActionApplier::waitUntilApplied(SceneId sceneId) const
+    {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_jobApplied.wait(guard, [&]() {
+            return std::none_of(m_jobs.cbegin(), m_jobs.cend(), [sceneId](const auto& job) { return job->sceneId == sceneId && !job->applied; });
+        });
+    }
+
+    void AsyncSceneActionApplier::waitUntilAllApplied() const
+    {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_jobApplied.wait(guard, [&]() {
+            return std::all_of(m_jobs.cbegin(), m_jobs.cend(), [](const auto& job) { return job->applied; });
+        });
+    }
+
+    void AsyncSceneActionApplier::collectApplied(AppliedFlushesVector& appliedOut)
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        for (auto& job : m_jobs)
+        {
+            if (job->applied)
+                appliedOut.push_back({ job->sceneId, std::move(job->pendingData), job->hadActiveShaderAnimation });
+        }
+        m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [](const auto& job) { return job->applied; }), m_jobs.end());
+    }
+
+    void AsyncSceneActionApplier::discard(SceneId sceneId)
+    {
+        waitUntilApplied(sceneId);
+        std::lock_guard<std::mutex> guard(m_mutex);
+        m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(), [sceneId](const auto& job) { return job->sceneId == sceneId; }), m_jobs.end());
+    }
+
+    AsyncSceneActionApplier::Job* AsyncSceneActionApplier::findJobToApply()
+    {
+        const auto it = std::find_if(m_jobs.begin(), m_jobs.end(), [](const auto& job) { return !job->started; });
+        return (it != m_jobs.end() ? it->get() : nullptr);
+    }
+
+    void AsyncSceneActionApplier::run()
+    {
+        while (!isCancelRequested())
+        {
+            Job* job = nullptr;
+            {
+                std::unique_lock<std::mutex> guard(m_mutex);
+                while (!m_jobAvailable.wait_for(guard, m_notifier.calculateTimeout(), [&]() { return isCancelRequested() || findJobToApply() != nullptr; }))
+                    m_notifier.notifyAlive(m_aliveIdentifier);
+                if (isCancelRequested())
+                    break;
+                job = findJobToApply();
+                job->started = true;
+            }
+            m_notifier.notifyAlive(m_aliveIdentifier);
+
+            LOG_INFO(CONTEXT_RENDERER, "AsyncSceneActionApplier: applying {} flushes of scene {}", job->pendingData.pendingFlushes.size(), job->sceneId);
+            const bool hadActiveShaderAnimation = m_applyFunction(*job->scene, job->pendingData.pendingFlushes, job->sizeInfo);
+
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                job->hadActiveShaderAnimation = hadActiveShaderAnimation;
+                job->applied = true;
+            }
+            m_jobApplied.notify_all();
+        }
+    }
+}
@@ -0,0 +1,92 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/StagingInfo.h"
+#include "internal/RendererLib/Types.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    class RendererCachedScene;
+    class IThreadAliveNotifier;
+
+    // Applies scene actions of pending flushes on a background thread.
+    // Scene given to the applier must not be accessed by anyone else until its flushes are applied (see waitUntilApplied),
+    // bookkeeping of applied flushes (events, statistics) is left to the caller once they are collected.
+    class AsyncSceneActionApplier : private Runnable
+    {
+    public:
+        // applies scene actions of all given flushes to scene, returns whether scene had active shader animation before
+        using ApplyFunction = std::function<bool(RendererCachedScene&, PendingFlushes&, const SceneSizeInformation&)>;
+
+        struct AppliedFlushes
+        {
+            SceneId sceneId;
+            PendingData pendingData;
+            bool hadActiveShaderAnimation = false;
+        };
+        using AppliedFlushesVector = std::vector<AppliedFlushes>;
+
+        AsyncSceneActionApplier(ApplyFunction applyFunction, IThreadAliveNotifier& notifier, DisplayHandle display);
+        ~AsyncSceneActionApplier() override;
+
+        AsyncSceneActionApplier(const AsyncSceneActionApplier&) = delete;
+        AsyncSceneActionApplier& operator=(const AsyncSceneActionApplier&) = delete;
+
+        void startApplying(SceneId sceneId, RendererCachedScene& scene, PendingData&& pendingData, const SceneSizeInformation& sizeInfo);
+
+        // true from start of applying until applied flushes of scene are collected or discarded
+        [[nodiscard]] bool hasScene(SceneId sceneId) const;
+        [[nodiscard]] bool isEmpty() const;
+
+        // blocks until scene is not modified by applier anymore, scene can be safely accessed afterwards
+        void waitUntilApplied(SceneId sceneId) const;
+        void waitUntilAllApplied() const;
+
+        // appends flushes of all scenes which finished applying, in order in which applying was started
+        void collectApplied(AppliedFlushesVector& appliedOut);
+        // drops flushes of scene (e.g. scene is being destroyed), waits for them to be applied if needed
+        void discard(SceneId sceneId);
+
+    private:
+        struct Job
+        {
+            SceneId sceneId;
+            RendererCachedScene* scene = nullptr;
+            PendingData pendingData;
+            SceneSizeInformation sizeInfo;
+            bool started = false;
+            bool applied = false;
+            bool hadActiveShaderAnimation = false;
+        };
+
+        void run() override;
+        [[nodiscard]] Job* findJobToApply();
+
+        const ApplyFunction m_applyFunction;
+
+        mutable std::mutex m_mutex;
+        mutable std::condition_variable m_jobAvailable;
+        mutable std::condition_variable m_jobApplied;
+        // jobs are owned by display thread, worker thread modifies only job it started and only until it is marked applied
+        std::vector<std::unique_ptr<Job>> m_jobs;
+
+        PlatformThread m_thread;
+        IThreadAliveNotifier& m_notifier;
+        const uint64_t m_aliveIdentifier;
+    };
+}
@@ -20,6 +20,9 @@ namespace ramses::internal
     {
         const DataSlotHandle actualHandle = BaseT::allocateDataSlot(dataSlot, handle);
 
+        if (dataSlot.type == EDataSlotType::DataProvider || dataSlot.type == EDataSlotType::DataConsumer)
+            m_slotDataReferenceVersions.put(dataSlot.attachedDataReference, ++m_slotDataReferenceVersionCounter);
+
         if (dataSlot.type == EDataSlotType::DataConsumer)
         {
             assert(dataSlot.attachedDataReference.isValid());
@@ -38,78 +41,80 @@ namespace ramses::internal
         {
             m_fallbackValues.release(dataRef);
         }
+        m_slotDataReferenceVersions.remove(dataRef);
+        m_resolvedDataLinks.remove(dataRef);
     }
 
     void DataReferenceLinkCachedScene::setDataFloatArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const float* data)
     {
         BaseT::setDataFloatArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec2* data)
     {
         BaseT::setDataVector2fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec3* data)
     {
         BaseT::setDataVector3fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::vec4* data)
     {
         BaseT::setDataVector4fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataBooleanArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const bool* data)
     {
         BaseT::setDataBooleanArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataIntegerArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const int32_t* data)
     {
         BaseT::setDataIntegerArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector2iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec2* data)
     {
         BaseT::setDataVector2iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector3iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec3* data)
     {
         BaseT::setDataVector3iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataVector4iArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::ivec4* data)
     {
         BaseT::setDataVector4iArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix22fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat2* data)
     {
         BaseT::setDataMatrix22fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix33fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat3* data)
     {
         BaseT::setDataMatrix33fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::setDataMatrix44fArray(DataInstanceHandle containerHandle, DataFieldHandle field, uint32_t elementCount, const glm::mat4* data)
     {
         BaseT::setDataMatrix44fArray(containerHandle, field, elementCount, data);
-        updateFallbackValue(containerHandle, data);
+        updateSlotDataReference(containerHandle, data);
     }
 
     void DataReferenceLinkCachedScene::restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field)
@@ -130,9 +135,41 @@ namespace ramses::internal
         *m_fallbackValues.getMemory(containerHandle) = fallbackValue;
     }
 
+    uint64_t DataReferenceLinkCachedScene::getSlotDataReferenceVersion(DataInstanceHandle dataRef) const
+    {
+        const auto* version = m_slotDataReferenceVersions.get(dataRef);
+        return version ? *version : 0u;
+    }
+
+    bool DataReferenceLinkCachedScene::isDataLinkResolved(DataInstanceHandle consumerDataRef, SceneId providerSceneId, DataInstanceHandle providerDataRef, uint64_t providerVersion) const
+    {
+        const auto* resolvedLink = m_resolvedDataLinks.get(consumerDataRef);
+        return resolvedLink != nullptr
+            && resolvedLink->providerSceneId == providerSceneId
+            && resolvedLink->providerDataRef == providerDataRef
+            && resolvedLink->providerVersion == providerVersion
+            && resolvedLink->consumerVersion == getSlotDataReferenceVersion(consumerDataRef);
+    }
+
+    void DataReferenceLinkCachedScene::setDataLinkResolved(DataInstanceHandle consumerDataRef, SceneId providerSceneId, DataInstanceHandle providerDataRef, uint64_t providerVersion)
+    {
+        m_resolvedDataLinks.put(consumerDataRef, { providerSceneId, providerDataRef, providerVersion, getSlotDataReferenceVersion(consumerDataRef) });
+    }
+
+    void DataReferenceLinkCachedScene::invalidateResolvedDataLink(DataInstanceHandle consumerDataRef)
+    {
+        m_resolvedDataLinks.remove(consumerDataRef);
+    }
+
     template <typename T>
-    void DataReferenceLinkCachedScene::updateFallbackValue(DataInstanceHandle containerHandle, const T* data)
+    void DataReferenceLinkCachedScene::updateSlotDataReference(DataInstanceHandle containerHandle, const T* data)
     {
+        auto* version = m_slotDataReferenceVersions.get(containerHandle);
+        if (version)
+        {
+            *version = ++m_slotDataReferenceVersionCounter;
+        }
+
         if (m_fallbackValues.isAllocated(containerHandle))
         {
             *m_fallbackValues.getMemory(containerHandle) = data[0];
@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/TransformationLinkCachedScene.h"
 #include "internal/SceneGraph/SceneUtils/DataInstanceHelper.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
 
 namespace ramses::internal
 {
@@ -41,11 +42,31 @@ namespace ramses::internal
         void restoreFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field);
         void setValueWithoutUpdatingFallbackValue(DataInstanceHandle containerHandle, DataFieldHandle field, const DataInstanceValueVariant& value);
 
+        // version of data reference attached to a data slot (provider or consumer), changes whenever its value is set
+        [[nodiscard]] uint64_t getSlotDataReferenceVersion(DataInstanceHandle dataRef) const;
+
+        // consumer data reference needs no update as long as neither provider nor consumer value changed since it was last resolved
+        [[nodiscard]] bool isDataLinkResolved(DataInstanceHandle consumerDataRef, SceneId providerSceneId, DataInstanceHandle providerDataRef, uint64_t providerVersion) const;
+        void setDataLinkResolved(DataInstanceHandle consumerDataRef, SceneId providerSceneId, DataInstanceHandle providerDataRef, uint64_t providerVersion);
+        void invalidateResolvedDataLink(DataInstanceHandle consumerDataRef);
+
     private:
         template <typename T>
-        void updateFallbackValue(DataInstanceHandle containerHandle, const T* data);
+        void updateSlotDataReference(DataInstanceHandle containerHandle, const T* data);
 
         using FallbackValuePool = MemoryPool<DataInstanceValueVariant, DataInstanceHandle>;
         FallbackValuePool m_fallbackValues;
+
+        struct ResolvedDataLink
+        {
+            SceneId providerSceneId;
+            DataInstanceHandle providerDataRef;
+            uint64_t providerVersion = 0u;
+            uint64_t consumerVersion = 0u;
+        };
+
+        uint64_t m_slotDataReferenceVersionCounter = 0u;
+        HashMap<DataInstanceHandle, uint64_t> m_slotDataReferenceVersions;
+        HashMap<DataInstanceHandle, ResolvedDataLink> m_resolvedDataLinks;
     };
 }
@@ -62,6 +62,7 @@ namespace ramses::internal
 
         DataReferenceLinkCachedScene& consumerScene = m_scenes.getScene(consumerSceneId);
         const DataInstanceHandle dataRef = consumerScene.getDataSlot(consumerSlotHandle).attachedDataReference;
+        consumerScene.invalidateResolvedDataLink(dataRef);
         consumerScene.restoreFallbackValue(dataRef, DataFieldHandle(0u));
 
         return true;
@@ -78,12 +79,18 @@ namespace ramses::internal
             assert(link.consumerSceneId == consumerSceneId);
             const DataInstanceHandle consumerDataRef = consumerScene.getDataSlot(link.consumerSlot).attachedDataReference;
 
-            const IScene& providerScene = m_scenes.getScene(link.providerSceneId);
+            const DataReferenceLinkCachedScene& providerScene = m_scenes.getScene(link.providerSceneId);
             const DataInstanceHandle providerDataRef = providerScene.getDataSlot(link.providerSlot).attachedDataReference;
 
+            // copy value only if provider or consumer data changed since last resolve
+            const uint64_t providerVersion = providerScene.getSlotDataReferenceVersion(providerDataRef);
+            if (consumerScene.isDataLinkResolved(consumerDataRef, link.providerSceneId, providerDataRef, providerVersion))
+                continue;
+
             DataInstanceValueVariant value;
             DataInstanceHelper::GetInstanceFieldData(providerScene, providerDataRef, DataFieldHandle(0u), value);
             consumerScene.setValueWithoutUpdatingFallbackValue(consumerDataRef, DataFieldHandle(0u), value);
+            consumerScene.setDataLinkResolved(consumerDataRef, link.providerSceneId, providerDataRef, providerVersion);
         }
     }
 }
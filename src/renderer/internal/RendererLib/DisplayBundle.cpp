@@ -11,6 +11,7 @@
 #include "internal/RendererLib/PlatformInterface/IPlatform.h"
 #include "internal/RendererLib/PlatformInterface/IDisplayController.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
+#include "internal/RendererLib/PlatformInterface/IEmbeddedCompositor.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 
 namespace ramses::internal
@@ -52,6 +53,10 @@ namespace ramses::internal
             break;
         }
 
+        // embedded compositor exists only after display was created by one of the commands
+        if (m_wakeUpListener && !m_wakeUpListenerRegisteredToEC)
+            registerWakeUpListenerToEC();
+
         collectEvents();
         m_renderer.m_traceId = 1100;
         finishFrameStatistics(prevFrameSleepTime);
@@ -60,6 +65,40 @@ namespace ramses::internal
     void DisplayBundle::pushAndConsumeCommands(RendererCommands& cmds)
     {
         m_pendingCommands.addAndConsumeCommandsFrom(cmds);
+        if (m_wakeUpListener)
+            m_wakeUpListener();
+    }
+
+    void DisplayBundle::setWakeUpListener(std::function<void()> listener)
+    {
+        m_wakeUpListener = std::move(listener);
+        m_wakeUpListenerRegisteredToEC = false;
+        registerWakeUpListenerToEC();
+    }
+
+    void DisplayBundle::registerWakeUpListenerToEC()
+    {
+        if (!m_renderer.hasDisplayController())
+            return;
+
+        getEC().setClientRequestsListener(m_wakeUpListener);
+        m_wakeUpListenerRegisteredToEC = true;
+    }
+
+    bool DisplayBundle::isIdle() const
+    {
+        // expiration of monitored scenes must be checked even if no flush arrives
+        if (m_rendererSceneUpdater.hasPendingWork() || m_renderer.hasPendingRendering() || m_expirationMonitor.hasMonitoredScenes())
+            return false;
+
+        if (!m_renderer.hasDisplayController())
+            return true;
+
+        // without event thread embedded compositor dispatches requests of its clients only within display loop
+        const auto& ec = m_renderer.getDisplayController().getRenderBackend().getEmbeddedCompositor();
+        if (ec.hasUpdatedStreamTextureSources())
+            return false;
+        return ec.getNumberOfCompositorConnections() == 0u || ec.isEventThreadRunning();
     }
 
     void DisplayBundle::update()
@@ -80,6 +119,7 @@ namespace ramses::internal
         m_renderer.doOneRenderLoop();
         m_renderer.m_traceId = 1004;
         m_rendererSceneUpdater.processScreenshotResults();
+        m_rendererSceneUpdater.processRenderedDmaOffscreenBuffers();
     }
 
     void DisplayBundle::collectEvents()
@@ -104,11 +144,12 @@ namespace ramses::internal
 
     void DisplayBundle::updateSceneControlLogic()
     {
-        InternalSceneStateEvents internalSceneEvents;
-        m_rendererEventCollector.dispatchInternalSceneStateEvents(internalSceneEvents);
+        // reused, collector and bundle just swap buffers every frame
+        m_internalSceneEvents.clear();
+        m_rendererEventCollector.dispatchInternalSceneStateEvents(m_internalSceneEvents);
 
         m_renderer.m_traceId = 1010;
-        for (const auto& evt : internalSceneEvents)
+        for (const auto& evt : m_internalSceneEvents)
             m_sceneControlLogic.processInternalEvent(evt);
 
         m_renderer.m_traceId = 1011;
@@ -171,11 +212,21 @@ namespace ramses::internal
             const auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrameStart);
             m_maxFrameTime = std::max(m_maxFrameTime, frameTime);
             m_sumFrameTimes += frameTime;
+            m_frameTimeHistogram.addSample(frameTime);
             if (m_sumFrameTimes >= m_timingReportingPeriod && m_loopsWithinMeasurePeriod > 0)
             {
-                m_rendererEventCollector.addFrameTimingReport(m_display, m_maxFrameTime, m_sumFrameTimes / m_loopsWithinMeasurePeriod);
+                FrameTimings frameTimings;
+                frameTimings.maximumLoopTimeWithinPeriod = m_maxFrameTime;
+                frameTimings.averageLoopTimeWithinPeriod = m_sumFrameTimes / m_loopsWithinMeasurePeriod;
+                frameTimings.loopTimePercentile50 = m_frameTimeHistogram.getPercentile(50u);
+                frameTimings.loopTimePercentile90 = m_frameTimeHistogram.getPercentile(90u);
+                frameTimings.loopTimePercentile99 = m_frameTimeHistogram.getPercentile(99u);
+                m_rendererEventCollector.addFrameTimingReport(m_display, frameTimings);
+                if (m_rendererSceneUpdater.hasResourceManager())
+                    m_rendererEventCollector.addGpuMemoryReport(m_display, m_rendererSceneUpdater.getGpuMemoryReport());
                 m_maxFrameTime = std::chrono::microseconds{ 0 };
                 m_sumFrameTimes = std::chrono::microseconds{ 0 };
+                m_frameTimeHistogram.reset();
                 m_loopsWithinMeasurePeriod = 0u;
             }
             m_loopsWithinMeasurePeriod++;
@@ -19,6 +19,7 @@
 #include "internal/RendererLib/SceneReferenceOwnership.h"
 #include "internal/RendererLib/SceneReferenceLogic.h"
 #include "internal/RendererLib/RendererCommandBuffer.h"
+#include "internal/RendererLib/LoopTimeHistogram.h"
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/RendererEventCollector.h"
@@ -44,6 +45,11 @@ namespace ramses::internal
         virtual IEmbeddedCompositor& getEC() = 0;
         [[nodiscard]] virtual bool hasSystemCompositorController() const = 0;
 
+        // listener is called whenever display receives new work from outside of its loop (commands, embedded compositing client requests)
+        virtual void setWakeUpListener(std::function<void()> listener) = 0;
+        // true if last loop left nothing to update or render, i.e. next loop would have no effect unless woken up by new work
+        [[nodiscard]] virtual bool isIdle() const = 0;
+
         virtual std::atomic_int& traceId() = 0;
 
         virtual ~IDisplayBundle() = default;
@@ -76,6 +82,9 @@ namespace ramses::internal
         // needed for Renderer lifecycle tests...
         [[nodiscard]] bool hasSystemCompositorController() const override;
 
+        void setWakeUpListener(std::function<void()> listener) override;
+        [[nodiscard]] bool isIdle() const override;
+
         // TODO vaclav remove, debugging only
         std::atomic_int& traceId() override { return m_renderer.m_traceId; }
 
@@ -87,6 +96,7 @@ namespace ramses::internal
         void finishFrameStatistics(std::chrono::microseconds prevFrameSleepTime);
         void updateSceneControlLogic();
         void updateTiming();
+        void registerWakeUpListenerToEC();
 
         DisplayHandle             m_display;
         FrameTimer                m_frameTimer;
@@ -106,10 +116,15 @@ namespace ramses::internal
         std::mutex            m_eventsLock;
         RendererEventVector   m_rendererEvents;
         RendererEventVector   m_sceneControlEvents;
+        InternalSceneStateEvents m_internalSceneEvents;
+
+        std::function<void()> m_wakeUpListener;
+        bool m_wakeUpListenerRegisteredToEC = false;
 
         const std::chrono::milliseconds m_timingReportingPeriod{ 0 };
         std::chrono::microseconds m_sumFrameTimes{ 0 };
         std::chrono::microseconds m_maxFrameTime{ 0 };
+        LoopTimeHistogram m_frameTimeHistogram;
         size_t m_loopsWithinMeasurePeriod{ 0u };
     };
 }
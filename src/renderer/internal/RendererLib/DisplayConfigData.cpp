@@ -276,6 +276,16 @@ namespace ramses::internal
         return m_waylandSocketEmbeddedPermissions;
     }
 
+    void DisplayConfigData::setWaylandEmbeddedCompositingEventThread(bool enable)
+    {
+        m_waylandEmbeddedCompositingEventThread = enable;
+    }
+
+    bool DisplayConfigData::isWaylandEmbeddedCompositingEventThreadEnabled() const
+    {
+        return m_waylandEmbeddedCompositingEventThread;
+    }
+
     void DisplayConfigData::setPlatformRenderNode(std::string_view renderNode)
     {
         m_platformRenderNode = renderNode;
@@ -316,6 +326,42 @@ namespace ramses::internal
         return m_scenePriorities;
     }
 
+    void DisplayConfigData::setScenePrefetch(SceneId sceneId, bool enable)
+    {
+        if (enable)
+            m_prefetchScenes.insert(sceneId);
+        else
+            m_prefetchScenes.erase(sceneId);
+    }
+
+    bool DisplayConfigData::isScenePrefetchEnabled(SceneId sceneId) const
+    {
+        return m_prefetchScenes.count(sceneId) != 0u;
+    }
+
+    const std::unordered_set<SceneId>& DisplayConfigData::getPrefetchScenes() const
+    {
+        return m_prefetchScenes;
+    }
+
+    void DisplayConfigData::setSceneProgressiveMapping(SceneId sceneId, bool enable)
+    {
+        if (enable)
+            m_progressiveMappingScenes.insert(sceneId);
+        else
+            m_progressiveMappingScenes.erase(sceneId);
+    }
+
+    bool DisplayConfigData::isSceneProgressiveMappingEnabled(SceneId sceneId) const
+    {
+        return m_progressiveMappingScenes.count(sceneId) != 0u;
+    }
+
+    const std::unordered_set<SceneId>& DisplayConfigData::getProgressiveMappingScenes() const
+    {
+        return m_progressiveMappingScenes;
+    }
+
     void DisplayConfigData::setResourceUploadBatchSize(uint32_t batchSize)
     {
         m_resourceUploadBatchSize = batchSize;
@@ -326,6 +372,106 @@ namespace ramses::internal
         return m_resourceUploadBatchSize;
     }
 
+    void DisplayConfigData::setMaxFramesInFlight(uint32_t maxFramesInFlight)
+    {
+        m_maxFramesInFlight = maxFramesInFlight;
+    }
+
+    uint32_t DisplayConfigData::getMaxFramesInFlight() const
+    {
+        return m_maxFramesInFlight;
+    }
+
+    void DisplayConfigData::setFlushApplyThreadCount(uint32_t threadCount)
+    {
+        m_flushApplyThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfigData::getFlushApplyThreadCount() const
+    {
+        return m_flushApplyThreadCount;
+    }
+
+    void DisplayConfigData::setAsyncFlushApplyThreshold(uint32_t minSceneActions)
+    {
+        m_asyncFlushApplyThreshold = minSceneActions;
+    }
+
+    uint32_t DisplayConfigData::getAsyncFlushApplyThreshold() const
+    {
+        return m_asyncFlushApplyThreshold;
+    }
+
+    void DisplayConfigData::setOffscreenBufferScalingGpuTimeThreshold(std::chrono::microseconds threshold)
+    {
+        m_offscreenBufferScalingGpuTimeThreshold = threshold;
+    }
+
+    std::chrono::microseconds DisplayConfigData::getOffscreenBufferScalingGpuTimeThreshold() const
+    {
+        return m_offscreenBufferScalingGpuTimeThreshold;
+    }
+
+    void DisplayConfigData::setIdleWaitEnabled(bool enable)
+    {
+        m_idleWaitEnabled = enable;
+    }
+
+    bool DisplayConfigData::isIdleWaitEnabled() const
+    {
+        return m_idleWaitEnabled;
+    }
+
+    void DisplayConfigData::setRenderOncePassesPerFrameLimit(uint32_t maxPasses)
+    {
+        m_renderOncePassesPerFrameLimit = maxPasses;
+    }
+
+    uint32_t DisplayConfigData::getRenderOncePassesPerFrameLimit() const
+    {
+        return m_renderOncePassesPerFrameLimit;
+    }
+
+    void DisplayConfigData::setAsyncPickingEnabled(bool enable)
+    {
+        m_asyncPickingEnabled = enable;
+    }
+
+    bool DisplayConfigData::isAsyncPickingEnabled() const
+    {
+        return m_asyncPickingEnabled;
+    }
+
+    void DisplayConfigData::setDisplayThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        m_displayThreadScheduling = scheduling;
+    }
+
+    const ThreadScheduling& DisplayConfigData::getDisplayThreadScheduling() const
+    {
+        return m_displayThreadScheduling;
+    }
+
+    void DisplayConfigData::setEffectUploadThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        m_effectUploadThreadScheduling = scheduling;
+    }
+
+    const ThreadScheduling& DisplayConfigData::getEffectUploadThreadScheduling() const
+    {
+        return m_effectUploadThreadScheduling;
+    }
+
+    void DisplayConfigData::setResourceEvictionPolicy(std::shared_ptr<const IResourceEvictionPolicy> policy)
+    {
+        m_resourceEvictionPolicy = std::move(policy);
+    }
+
+    const std::shared_ptr<const IResourceEvictionPolicy>& DisplayConfigData::getResourceEvictionPolicy() const
+    {
+        return m_resourceEvictionPolicy;
+    }
+
     bool DisplayConfigData::operator == (const DisplayConfigData& other) const
     {
         return
@@ -352,10 +498,23 @@ namespace ramses::internal
             m_waylandSocketEmbeddedGroupName    == other.m_waylandSocketEmbeddedGroupName &&
             m_waylandSocketEmbeddedPermissions  == other.m_waylandSocketEmbeddedPermissions &&
             m_waylandSocketEmbeddedFD    == other.m_waylandSocketEmbeddedFD &&
+            m_waylandEmbeddedCompositingEventThread == other.m_waylandEmbeddedCompositingEventThread &&
             m_platformRenderNode         == other.m_platformRenderNode &&
             m_swapInterval               == other.m_swapInterval &&
             m_scenePriorities            == other.m_scenePriorities &&
-            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize;
+            m_prefetchScenes             == other.m_prefetchScenes &&
+            m_progressiveMappingScenes   == other.m_progressiveMappingScenes &&
+            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize &&
+            m_maxFramesInFlight          == other.m_maxFramesInFlight &&
+            m_flushApplyThreadCount      == other.m_flushApplyThreadCount &&
+            m_asyncFlushApplyThreshold   == other.m_asyncFlushApplyThreshold &&
+            m_offscreenBufferScalingGpuTimeThreshold == other.m_offscreenBufferScalingGpuTimeThreshold &&
+            m_idleWaitEnabled            == other.m_idleWaitEnabled &&
+            m_renderOncePassesPerFrameLimit == other.m_renderOncePassesPerFrameLimit &&
+            m_asyncPickingEnabled        == other.m_asyncPickingEnabled &&
+            m_displayThreadScheduling    == other.m_displayThreadScheduling &&
+            m_effectUploadThreadScheduling == other.m_effectUploadThreadScheduling &&
+            m_resourceEvictionPolicy     == other.m_resourceEvictionPolicy;
     }
 
     bool DisplayConfigData::operator != (const DisplayConfigData& other) const
@@ -13,13 +13,19 @@
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/SceneGraph/SceneAPI/TextureEnums.h"
 #include "impl/DataTypesImpl.h"
+#include "internal/PlatformAbstraction/ThreadScheduling.h"
 
+#include <chrono>
 #include <unordered_map>
+#include <unordered_set>
+#include <memory>
 #include <string>
 #include <string_view>
 
 namespace ramses::internal
 {
+    class IResourceEvictionPolicy;
+
     class DisplayConfigData
     {
     public:
@@ -103,6 +109,9 @@ namespace ramses::internal
         bool setWaylandEmbeddedCompositingSocketPermissions(uint32_t permissions);
         [[nodiscard]] uint32_t getWaylandSocketEmbeddedPermissions() const;
 
+        void setWaylandEmbeddedCompositingEventThread(bool enable);
+        [[nodiscard]] bool isWaylandEmbeddedCompositingEventThreadEnabled() const;
+
         void setPlatformRenderNode(std::string_view renderNode);
         [[nodiscard]] std::string_view getPlatformRenderNode() const;
 
@@ -113,9 +122,53 @@ namespace ramses::internal
         [[nodiscard]] int32_t getScenePriority(SceneId sceneId) const;
         [[nodiscard]] const std::unordered_map<SceneId, int32_t>& getScenePriorities() const;
 
+        void setScenePrefetch(SceneId sceneId, bool enable);
+        [[nodiscard]] bool isScenePrefetchEnabled(SceneId sceneId) const;
+        [[nodiscard]] const std::unordered_set<SceneId>& getPrefetchScenes() const;
+
+        void setSceneProgressiveMapping(SceneId sceneId, bool enable);
+        [[nodiscard]] bool isSceneProgressiveMappingEnabled(SceneId sceneId) const;
+        [[nodiscard]] const std::unordered_set<SceneId>& getProgressiveMappingScenes() const;
+
         void setResourceUploadBatchSize(uint32_t batchSize);
         [[nodiscard]] uint32_t getResourceUploadBatchSize() const;
 
+        // 0 means frames in flight are not limited and frame pacing is disabled
+        void setMaxFramesInFlight(uint32_t maxFramesInFlight);
+        [[nodiscard]] uint32_t getMaxFramesInFlight() const;
+
+        // 0 means flushes of all scenes are applied serially on display thread
+        void setFlushApplyThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getFlushApplyThreadCount() const;
+
+        // 0 means flushes are never applied asynchronously
+        void setAsyncFlushApplyThreshold(uint32_t minSceneActions);
+        [[nodiscard]] uint32_t getAsyncFlushApplyThreshold() const;
+
+        // 0 means offscreen buffers are never rendered at reduced resolution
+        void setOffscreenBufferScalingGpuTimeThreshold(std::chrono::microseconds threshold);
+        [[nodiscard]] std::chrono::microseconds getOffscreenBufferScalingGpuTimeThreshold() const;
+
+        void setIdleWaitEnabled(bool enable);
+        [[nodiscard]] bool isIdleWaitEnabled() const;
+
+        // 0 means all pending render once passes of a scene are rendered in one frame
+        void setRenderOncePassesPerFrameLimit(uint32_t maxPasses);
+        [[nodiscard]] uint32_t getRenderOncePassesPerFrameLimit() const;
+
+        void setAsyncPickingEnabled(bool enable);
+        [[nodiscard]] bool isAsyncPickingEnabled() const;
+
+        void setDisplayThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getDisplayThreadScheduling() const;
+
+        void setEffectUploadThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getEffectUploadThreadScheduling() const;
+
+        // null means default policy is used
+        void setResourceEvictionPolicy(std::shared_ptr<const IResourceEvictionPolicy> policy);
+        [[nodiscard]] const std::shared_ptr<const IResourceEvictionPolicy>& getResourceEvictionPolicy() const;
+
         bool operator==(const DisplayConfigData& other) const;
         bool operator!=(const DisplayConfigData& other) const;
 
@@ -175,10 +228,23 @@ namespace ramses::internal
         std::string m_waylandSocketEmbeddedGroupName;
         uint32_t m_waylandSocketEmbeddedPermissions = 0;
         int m_waylandSocketEmbeddedFD = -1;
+        bool m_waylandEmbeddedCompositingEventThread = false;
         std::string m_platformRenderNode;
 
         int32_t m_swapInterval = -1;
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
+        std::unordered_set<SceneId> m_prefetchScenes;
+        std::unordered_set<SceneId> m_progressiveMappingScenes;
         uint32_t m_resourceUploadBatchSize = 10u;
+        uint32_t m_maxFramesInFlight = 0u;
+        uint32_t m_flushApplyThreadCount = 0u;
+        uint32_t m_asyncFlushApplyThreshold = 0u;
+        std::chrono::microseconds m_offscreenBufferScalingGpuTimeThreshold{ 0 };
+        bool m_idleWaitEnabled = false;
+        uint32_t m_renderOncePassesPerFrameLimit = 0u;
+        bool m_asyncPickingEnabled = false;
+        ThreadScheduling m_displayThreadScheduling;
+        ThreadScheduling m_effectUploadThreadScheduling;
+        std::shared_ptr<const IResourceEvictionPolicy> m_resourceEvictionPolicy;
     };
 }
@@ -52,6 +52,14 @@ namespace ramses::internal
         validateRenderingStatusHealthy();
     }
 
+    void DisplayController::swapBuffersWithDamage(const Quad& damagedRegion)
+    {
+        m_renderBackend.getContext().swapBuffersWithDamage(damagedRegion);
+        m_renderBackend.getWindow().frameRendered();
+
+        validateRenderingStatusHealthy();
+    }
+
     SceneRenderExecutionIterator DisplayController::renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer)
     {
         RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer);
@@ -85,6 +93,22 @@ namespace ramses::internal
         m_device.readPixels(&dataOut[0], x, y, width, height);
     }
 
+    DeviceResourceHandle DisplayController::startReadPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        m_device.activateRenderTarget(renderTargetHandle);
+        return m_device.startReadPixels(x, y, width, height);
+    }
+
+    bool DisplayController::finishReadPixels(DeviceResourceHandle readPixelsHandle, std::vector<uint8_t>& dataOut)
+    {
+        return m_device.finishReadPixels(readPixelsHandle, dataOut);
+    }
+
+    void DisplayController::deleteReadPixels(DeviceResourceHandle readPixelsHandle)
+    {
+        m_device.deleteReadPixels(readPixelsHandle);
+    }
+
     uint32_t DisplayController::getDisplayWidth() const
     {
         return m_displayWidth;
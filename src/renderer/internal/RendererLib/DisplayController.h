@@ -33,6 +33,7 @@ namespace ramses::internal
         [[nodiscard]] bool                    canRenderNewFrame() const override;
         void                    enableContext() override;
         void                    swapBuffers() override;
+        void                    swapBuffersWithDamage(const Quad& damagedRegion) override;
         SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer) override;
         void                    clearBuffer(DeviceResourceHandle buffer, ClearFlags clearFlags, const glm::vec4& clearColor) override;
 
@@ -43,6 +44,9 @@ namespace ramses::internal
         [[nodiscard]] uint32_t                  getDisplayHeight() const override;
 
         void readPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) override;
+        DeviceResourceHandle startReadPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool finishReadPixels(DeviceResourceHandle readPixelsHandle, std::vector<uint8_t>& dataOut) override;
+        void deleteReadPixels(DeviceResourceHandle readPixelsHandle) override;
 
         void validateRenderingStatusHealthy() const override;
 
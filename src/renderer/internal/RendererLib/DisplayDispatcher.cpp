@@ -25,6 +25,8 @@ namespace ramses::internal
         , m_notifier{ notifier }
         , m_featureLevel{ featureLevel }
     {
+        if (m_rendererConfig.isDisplayRestartCacheEnabled())
+            m_displayRestartResourceCache = std::make_unique<DisplayRestartResourceCache>();
     }
 
     void DisplayDispatcher::dispatchCommands(RendererCommandBuffer& cmds)
@@ -173,6 +175,32 @@ namespace ramses::internal
                     LOG_ERROR(CONTEXT_RENDERER, "DisplayDispatcher: could not find master scene for referenced scene {} when processing {}", refScene, RendererCommandUtils::ToString(cmd));
                 }
             }
+
+            if (m_displayRestartResourceCache)
+                m_displayRestartResourceCache->onSceneReceived(std::get<RendererCommand::ReceiveScene>(cmd).info.sceneID);
+        }
+        else if (std::holds_alternative<RendererCommand::SceneUnpublished>(cmd))
+        {
+            if (m_displayRestartResourceCache)
+                m_displayRestartResourceCache->onSceneUnpublished(std::get<RendererCommand::SceneUnpublished>(cmd).scene);
+        }
+        else if (std::holds_alternative<RendererCommand::UpdateScene>(cmd))
+        {
+            // resources received again after display restart are replaced by instances kept from before (already decompressed)
+            if (m_displayRestartResourceCache)
+            {
+                auto& updateCmd = std::get<RendererCommand::UpdateScene>(cmd);
+                m_displayRestartResourceCache->cacheAndShareResources(updateCmd.scene, updateCmd.updateData);
+            }
+
+            // in threaded mode decompress resources ahead in shared worker instead of in each display thread uploading them
+            auto& resources = std::get<RendererCommand::UpdateScene>(cmd).updateData.resources;
+            if (m_threadedDisplays && !resources.empty())
+            {
+                if (!m_resourceDecompressionWorker)
+                    m_resourceDecompressionWorker = std::make_unique<ResourceDecompressionWorker>(m_notifier, m_rendererConfig.getResourceDecompressionThreadScheduling());
+                m_resourceDecompressionWorker->shareAndScheduleDecompression(resources);
+            }
         }
         else if (std::holds_alternative<RendererCommand::LogInfo>(cmd))
         {
@@ -202,7 +230,8 @@ namespace ramses::internal
         if (m_threadedDisplays)
         {
             LOG_INFO(CONTEXT_RENDERER, "DisplayDispatcher: creating update/render thread for display {}", displayHandle);
-            bundle.displayThread = std::make_unique<DisplayThread>(bundle.displayBundle, displayHandle, m_notifier);
+            bundle.displayThread = std::make_unique<DisplayThread>(bundle.displayBundle, displayHandle, m_notifier, dispConfig.getMaxFramesInFlight() > 0u, dispConfig.isIdleWaitEnabled(),
+                dispConfig.getDisplayThreadScheduling());
         }
 
         return bundle;
@@ -12,6 +12,8 @@
 #include "internal/RendererLib/RendererConfigData.h"
 #include "internal/RendererLib/SceneDisplayTracker.h"
 #include "internal/RendererLib/DisplayThread.h"
+#include "internal/RendererLib/ResourceDecompressionWorker.h"
+#include "internal/RendererLib/DisplayRestartResourceCache.h"
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/PlatformInterface/IPlatformFactory.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
@@ -100,6 +102,10 @@ namespace ramses::internal
         RendererEventVector m_injectedSceneControlEvents;
 
         bool m_threadedDisplays = false;
+        // created with first scene update in threaded mode, shared by all display threads
+        std::unique_ptr<ResourceDecompressionWorker> m_resourceDecompressionWorker;
+        // keeps resources of published scenes across display destruction, only if enabled in renderer config
+        std::unique_ptr<DisplayRestartResourceCache> m_displayRestartResourceCache;
         bool m_displayThreadsUpdating = true;
         ELoopMode m_loopMode = ELoopMode::UpdateAndRender;
         std::unordered_map<DisplayHandle, std::chrono::microseconds> m_minFrameDurationsPerDisplay;
@@ -11,13 +11,15 @@
 #include "internal/RendererLib/PlatformInterface/IWindowEventHandler.h"
 #include "internal/RendererLib/Enums/EKeyModifier.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/RendererStatistics.h"
 #include "internal/Core/Utils/LogMacros.h"
 
 namespace ramses::internal
 {
-    DisplayEventHandler::DisplayEventHandler(DisplayHandle displayHandle, RendererEventCollector& eventCollector)
+    DisplayEventHandler::DisplayEventHandler(DisplayHandle displayHandle, RendererEventCollector& eventCollector, RendererStatistics& statistics)
         : m_displayHandle(displayHandle)
         , m_eventCollector(eventCollector)
+        , m_statistics(statistics)
     {
     }
 
@@ -65,4 +67,46 @@ namespace ramses::internal
     {
         m_eventCollector.addWindowEvent(ERendererEventType::WindowMoveEvent, m_displayHandle, WindowMoveEvent{ posX, posY });
     }
+
+    void DisplayEventHandler::onFramePresented(uint64_t frameIndex, FlushTime::Clock::time_point presentationTime)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "DisplayController::onFramePresented: [display: {}; frame: {}; time: {}]",
+            m_displayHandle.asMemoryHandle(), frameIndex, asMicroseconds(presentationTime));
+
+        // presented frame also contains content of all older frames which were not reported (e.g. discarded by compositor)
+        while (!m_framesWaitingForPresentation.empty() && m_framesWaitingForPresentation.front().frameIndex <= frameIndex)
+        {
+            for (const auto& flush : m_framesWaitingForPresentation.front().appliedFlushes)
+            {
+                FlushPresentation flushPresentation;
+                flushPresentation.presentationTimestamp = presentationTime;
+                if (flush.flushTimestamp != FlushTime::InvalidTimestamp)
+                {
+                    flushPresentation.latency = std::chrono::duration_cast<std::chrono::microseconds>(presentationTime - flush.flushTimestamp);
+                    m_statistics.flushPresented(flush.sceneId, flushPresentation.latency);
+                }
+                if (flush.versionTag.isValid())
+                    m_eventCollector.addSceneFlushPresentedEvent(m_displayHandle, flush.sceneId, flush.versionTag, flushPresentation);
+            }
+            m_framesWaitingForPresentation.pop_front();
+        }
+    }
+
+    void DisplayEventHandler::onFlushApplied(SceneId sceneId, SceneVersionTag versionTag, FlushTime::Clock::time_point flushTimestamp)
+    {
+        if (versionTag.isValid() || flushTimestamp != FlushTime::InvalidTimestamp)
+            m_flushesAppliedSinceLastSwap.push_back({ sceneId, versionTag, flushTimestamp });
+    }
+
+    void DisplayEventHandler::onFrameSwapped()
+    {
+        const uint64_t frameIndex = m_swappedFramesCount++;
+        if (m_flushesAppliedSinceLastSwap.empty())
+            return;
+
+        m_framesWaitingForPresentation.push_back({ frameIndex, std::move(m_flushesAppliedSinceLastSwap) });
+        m_flushesAppliedSinceLastSwap.clear();
+        if (m_framesWaitingForPresentation.size() > MaxFramesWaitingForPresentation)
+            m_framesWaitingForPresentation.pop_front();
+    }
 }
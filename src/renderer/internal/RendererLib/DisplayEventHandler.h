@@ -10,16 +10,21 @@
 
 #include "internal/RendererLib/Types.h"
 #include "internal/RendererLib/PlatformInterface/IWindowEventHandler.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include "internal/SceneGraph/SceneAPI/SceneVersionTag.h"
+#include <deque>
+#include <vector>
 
 namespace ramses::internal
 {
 
     class RendererEventCollector;
+    class RendererStatistics;
 
     class DisplayEventHandler : public IWindowEventHandler
     {
     public:
-        DisplayEventHandler(DisplayHandle displayHandle, RendererEventCollector& eventCollector);
+        DisplayEventHandler(DisplayHandle displayHandle, RendererEventCollector& eventCollector, RendererStatistics& statistics);
         ~DisplayEventHandler() override;
 
         /* Inherited from IWindowEventHandler */
@@ -28,9 +33,35 @@ namespace ramses::internal
         void onClose() override;
         void onResize(uint32_t width, uint32_t height) override;
         void onWindowMove(int32_t posX, int32_t posY) override;
+        void onFramePresented(uint64_t frameIndex, FlushTime::Clock::time_point presentationTime) override;
+
+        // flushes applied before a swap are correlated with presentation feedback of the swapped frame
+        void onFlushApplied(SceneId sceneId, SceneVersionTag versionTag, FlushTime::Clock::time_point flushTimestamp);
+        void onFrameSwapped();
 
     private:
         const DisplayHandle     m_displayHandle;
         RendererEventCollector& m_eventCollector;
+        RendererStatistics&     m_statistics;
+
+        struct AppliedFlush
+        {
+            SceneId sceneId;
+            SceneVersionTag versionTag;
+            FlushTime::Clock::time_point flushTimestamp;
+        };
+
+        struct SwappedFrame
+        {
+            uint64_t frameIndex = 0u;
+            std::vector<AppliedFlush> appliedFlushes;
+        };
+
+        std::vector<AppliedFlush> m_flushesAppliedSinceLastSwap;
+        std::deque<SwappedFrame>  m_framesWaitingForPresentation;
+        uint64_t                  m_swappedFramesCount = 0u;
+
+        // limits frames kept if platform does not provide presentation feedback
+        static constexpr size_t   MaxFramesWaitingForPresentation = 8u;
     };
 }
@@ -0,0 +1,108 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/DisplayRestartResourceCache.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Resource/IResource.h"
+#include "internal/Core/Utils/LogMacros.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    void DisplayRestartResourceCache::cacheAndShareResources(SceneId sceneId, SceneUpdate& update)
+    {
+        // initial content lists all resources used by scene, scene's usage of anything not listed there is obsolete
+        const bool initialContent = (m_scenesWaitingForInitialContent.erase(sceneId) != 0u);
+
+        for (const auto& hash : update.flushInfos.resourceChanges.m_resourcesRemoved)
+            removeSceneUsage(sceneId, hash);
+
+        size_t numShared = 0u;
+        for (auto& resource : update.resources)
+        {
+            auto& cachedResource = m_resources[resource->getHash()];
+            if (cachedResource.resource)
+            {
+                if (cachedResource.resource != resource)
+                {
+                    resource = cachedResource.resource;
+                    ++numShared;
+                }
+            }
+            else
+            {
+                cachedResource.resource = resource;
+            }
+
+            if (std::find(cachedResource.scenes.cbegin(), cachedResource.scenes.cend(), sceneId) == cachedResource.scenes.cend())
+                cachedResource.scenes.push_back(sceneId);
+        }
+
+        if (initialContent)
+        {
+            std::unordered_set<ResourceContentHash> usedResources;
+            for (const auto& resource : update.resources)
+                usedResources.insert(resource->getHash());
+            removeSceneUsageExcept(sceneId, usedResources);
+        }
+
+        if (numShared > 0u)
+            LOG_INFO(CONTEXT_RENDERER, "DisplayRestartResourceCache: {} of {} resources received for scene {} taken from cache", numShared, update.resources.size(), sceneId);
+    }
+
+    void DisplayRestartResourceCache::onSceneReceived(SceneId sceneId)
+    {
+        m_scenesWaitingForInitialContent.insert(sceneId);
+    }
+
+    void DisplayRestartResourceCache::onSceneUnpublished(SceneId sceneId)
+    {
+        m_scenesWaitingForInitialContent.erase(sceneId);
+        removeSceneUsageExcept(sceneId, {});
+    }
+
+    size_t DisplayRestartResourceCache::getNumberOfCachedResources() const
+    {
+        return m_resources.size();
+    }
+
+    bool DisplayRestartResourceCache::hasResource(const ResourceContentHash& hash) const
+    {
+        return m_resources.count(hash) != 0u;
+    }
+
+    void DisplayRestartResourceCache::removeSceneUsage(SceneId sceneId, const ResourceContentHash& hash)
+    {
+        const auto it = m_resources.find(hash);
+        if (it == m_resources.end())
+            return;
+
+        auto& scenes = it->second.scenes;
+        scenes.erase(std::remove(scenes.begin(), scenes.end(), sceneId), scenes.end());
+        if (scenes.empty())
+            m_resources.erase(it);
+    }
+
+    void DisplayRestartResourceCache::removeSceneUsageExcept(SceneId sceneId, const std::unordered_set<ResourceContentHash>& except)
+    {
+        for (auto it = m_resources.begin(); it != m_resources.end();)
+        {
+            if (except.count(it->first) != 0u)
+            {
+                ++it;
+                continue;
+            }
+            auto& scenes = it->second.scenes;
+            scenes.erase(std::remove(scenes.begin(), scenes.end(), sceneId), scenes.end());
+            if (scenes.empty())
+                it = m_resources.erase(it);
+            else
+                ++it;
+        }
+    }
+}
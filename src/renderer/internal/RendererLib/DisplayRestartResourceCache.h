@@ -0,0 +1,53 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/ManagedResource.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ramses::internal
+{
+    struct SceneUpdate;
+
+    // Keeps data of resources received for scenes alive independently of displays (see RendererConfig::enableDisplayRestartCache).
+    // Displays release resource data once uploaded, when a display is destroyed and created again its scenes are subscribed again
+    // and resources received with their initial content are replaced by the cached instances which were already decompressed
+    // and possibly shared with other displays. Resource is kept as long as a scene which received it uses it or till the scene is unpublished,
+    // scenes which are not subscribed anymore (e.g. because their display was destroyed) keep their resources.
+    // Must be always accessed from the same thread (display dispatcher).
+    class DisplayRestartResourceCache
+    {
+    public:
+        // replaces resources of update by cached instances of same content, caches the others
+        void cacheAndShareResources(SceneId sceneId, SceneUpdate& update);
+        // next update of scene is its initial content with all resources it uses
+        void onSceneReceived(SceneId sceneId);
+        void onSceneUnpublished(SceneId sceneId);
+
+        [[nodiscard]] size_t getNumberOfCachedResources() const;
+        [[nodiscard]] bool hasResource(const ResourceContentHash& hash) const;
+
+    private:
+        void removeSceneUsage(SceneId sceneId, const ResourceContentHash& hash);
+        void removeSceneUsageExcept(SceneId sceneId, const std::unordered_set<ResourceContentHash>& except);
+
+        struct CachedResource
+        {
+            ManagedResource resource;
+            std::vector<SceneId> scenes;
+        };
+        std::unordered_map<ResourceContentHash, CachedResource> m_resources;
+        std::unordered_set<SceneId> m_scenesWaitingForInitialContent;
+    };
+}
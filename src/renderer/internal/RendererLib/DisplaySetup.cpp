@@ -11,6 +11,13 @@
 
 namespace ramses::internal
 {
+    static void MarkToBeFullyRerendered(DisplayBufferInfo& bufferInfo)
+    {
+        bufferInfo.needsRerender = true;
+        bufferInfo.partiallyDamaged = false;
+        bufferInfo.damagedRegion = {};
+    }
+
     void DisplaySetup::registerDisplayBuffer(DeviceResourceHandle displayBuffer, const Viewport& viewport, const glm::vec4& clearColor, bool isOffscreenBuffer, uint32_t sampleCount, bool isInterruptible)
     {
         assert(!isInterruptible || isOffscreenBuffer);
@@ -35,7 +42,24 @@ namespace ramses::internal
 
     void DisplaySetup::setDisplayBufferToBeRerendered(DeviceResourceHandle displayBuffer, bool rerender)
     {
-        getDisplayBufferInternal(displayBuffer).needsRerender = rerender;
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        MarkToBeFullyRerendered(bufferInfo);
+        bufferInfo.needsRerender = rerender;
+    }
+
+    void DisplaySetup::addDisplayBufferDamage(DeviceResourceHandle displayBuffer, const Quad& damagedRegion)
+    {
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        if (!bufferInfo.needsRerender)
+        {
+            bufferInfo.needsRerender = true;
+            bufferInfo.partiallyDamaged = true;
+            bufferInfo.damagedRegion = damagedRegion;
+        }
+        else if (bufferInfo.partiallyDamaged)
+        {
+            bufferInfo.damagedRegion = bufferInfo.damagedRegion.getBoundingQuad(damagedRegion);
+        }
     }
 
     void DisplaySetup::assignSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle displayBuffer, int32_t sceneOrder)
@@ -52,7 +76,7 @@ namespace ramses::internal
         auto& assignedScenes = bufferInfo.scenes;
         const auto it = std::upper_bound(assignedScenes.begin(), assignedScenes.end(), sceneOrder, [](int32_t order, const AssignedSceneInfo& info) { return order < info.globalSceneOrder; });
         assignedScenes.insert(it, sceneInfo);
-        bufferInfo.needsRerender = true;
+        MarkToBeFullyRerendered(bufferInfo);
     }
 
     void DisplaySetup::unassignScene(SceneId sceneId)
@@ -63,7 +87,7 @@ namespace ramses::internal
         const auto it = std::find_if(mappedScenes.begin(), mappedScenes.end(), [sceneId](const AssignedSceneInfo& info) { return info.sceneId == sceneId; });
         assert(it != mappedScenes.end());
         mappedScenes.erase(it);
-        bufferInfo.needsRerender = true;
+        MarkToBeFullyRerendered(bufferInfo);
     }
 
     DeviceResourceHandle DisplaySetup::findDisplayBufferSceneIsAssignedTo(SceneId sceneId) const
@@ -93,7 +117,7 @@ namespace ramses::internal
     {
         const auto displayBuffer = findDisplayBufferSceneIsAssignedTo(sceneId);
         findSceneInfo(sceneId, displayBuffer).shown = show;
-        getDisplayBufferInternal(displayBuffer).needsRerender = true;
+        MarkToBeFullyRerendered(getDisplayBufferInternal(displayBuffer));
     }
 
     void DisplaySetup::setClearFlags(DeviceResourceHandle displayBuffer, ClearFlags clearFlags)
@@ -108,7 +132,7 @@ namespace ramses::internal
         // for simplicity trigger all buffers on display to re-render
         // otherwise would have to resolve dependencies via OB links
         for (auto& dispBufferInfo : m_displayBuffers)
-            dispBufferInfo.second.needsRerender = true;
+            MarkToBeFullyRerendered(dispBufferInfo.second);
     }
 
     void DisplaySetup::setDisplayBufferSize(DeviceResourceHandle displayBuffer, uint32_t width, uint32_t height)
@@ -120,7 +144,34 @@ namespace ramses::internal
         // for simplicity trigger all buffers on display to re-render
         // otherwise would have to resolve dependencies via OB links
         for (auto& dispBufferInfo : m_displayBuffers)
-            dispBufferInfo.second.needsRerender = true;
+            MarkToBeFullyRerendered(dispBufferInfo.second);
+    }
+
+    void DisplaySetup::setRenderRateDivisor(DeviceResourceHandle displayBuffer, uint32_t divisor)
+    {
+        assert(divisor > 0u);
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        assert(bufferInfo.isOffscreenBuffer);
+        bufferInfo.renderRateDivisor = divisor;
+        // device handles of buffers are mostly consecutive, so this spreads buffers with same divisor evenly over frames
+        bufferInfo.renderRatePhase = displayBuffer.asMemoryHandle() % divisor;
+    }
+
+    void DisplaySetup::setScaledRenderTarget(DeviceResourceHandle displayBuffer, DeviceResourceHandle scaledRenderTarget)
+    {
+        auto& bufferInfo = getDisplayBufferInternal(displayBuffer);
+        assert(bufferInfo.isOffscreenBuffer && !bufferInfo.isInterruptible);
+        bufferInfo.scaledRenderTarget = scaledRenderTarget;
+    }
+
+    void DisplaySetup::advanceFrame()
+    {
+        ++m_frameCounter;
+    }
+
+    bool DisplaySetup::isRenderFrameOf(const DisplayBufferInfo& bufferInfo) const
+    {
+        return (m_frameCounter % bufferInfo.renderRateDivisor) == bufferInfo.renderRatePhase;
     }
 
     const DeviceHandleVector& DisplaySetup::getNonInterruptibleOffscreenBuffersToRender() const
@@ -128,7 +179,8 @@ namespace ramses::internal
         m_buffersToRender.clear();
         for (const auto& buffer : m_displayBuffers)
         {
-            if (buffer.second.isOffscreenBuffer && !buffer.second.isInterruptible && buffer.second.needsRerender)
+            // buffer not allowed to render in this frame keeps its re-render request until its next render frame
+            if (buffer.second.isOffscreenBuffer && !buffer.second.isInterruptible && buffer.second.needsRerender && isRenderFrameOf(buffer.second))
                 m_buffersToRender.push_back(buffer.first);
         }
 
@@ -151,7 +203,7 @@ namespace ramses::internal
 
         for (auto it = bufferToRenderBegin; it != m_displayBuffers.end(); ++it)
         {
-            if (it->second.isInterruptible && it->second.needsRerender)
+            if (it->second.isInterruptible && it->second.needsRerender && isRenderFrameOf(it->second))
                 m_buffersToRender.push_back(it->first);
         }
 
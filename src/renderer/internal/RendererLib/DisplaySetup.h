@@ -13,6 +13,7 @@
 #include "internal/SceneGraph/SceneAPI/Viewport.h"
 #include "internal/SceneGraph/SceneAPI/RenderState.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
+#include "internal/Core/Math3d/Quad.h"
 #include "impl/DataTypesImpl.h"
 #include <map>
 
@@ -36,6 +37,14 @@ namespace ramses::internal
         glm::vec4      clearColor;
         AssignedScenes scenes;
         bool           needsRerender{false};
+        // if set, only damagedRegion (in buffer coordinates) changed since last rendering, otherwise whole buffer
+        bool           partiallyDamaged{false};
+        Quad           damagedRegion{};
+        // offscreen buffer is rendered at most every renderRateDivisor-th frame, renderRatePhase spreads buffers with same divisor over frames
+        uint32_t       renderRateDivisor{1u};
+        uint32_t       renderRatePhase{0u};
+        // if valid, offscreen buffer is scalable, it is rendered into this render target at reduced resolution under GPU load
+        DeviceResourceHandle scaledRenderTarget{};
     };
     using DisplayBuffersMap = std::map<DeviceResourceHandle, DisplayBufferInfo>;
 
@@ -48,6 +57,8 @@ namespace ramses::internal
         [[nodiscard]] const DisplayBufferInfo& getDisplayBuffer(DeviceResourceHandle displayBuffer) const;
 
         void setDisplayBufferToBeRerendered(DeviceResourceHandle displayBuffer, bool rerender);
+        // marks buffer to be re-rendered due to changes within given region only, region accumulates until buffer is rendered
+        void addDisplayBufferDamage(DeviceResourceHandle displayBuffer, const Quad& damagedRegion);
 
         void                 assignSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle displayBuffer, int32_t sceneOrder);
         void                 unassignScene(SceneId sceneId);
@@ -56,6 +67,11 @@ namespace ramses::internal
         void                 setClearFlags(DeviceResourceHandle displayBuffer, ClearFlags clearFlags);
         void                 setClearColor(DeviceResourceHandle displayBuffer, const glm::vec4& clearColor);
         void                 setDisplayBufferSize(DeviceResourceHandle displayBuffer, uint32_t width, uint32_t height);
+        void                 setRenderRateDivisor(DeviceResourceHandle displayBuffer, uint32_t divisor);
+        void                 setScaledRenderTarget(DeviceResourceHandle displayBuffer, DeviceResourceHandle scaledRenderTarget);
+
+        // advances frame counter used to decide which buffers with render rate divisor are allowed to render in current frame
+        void                 advanceFrame();
 
         [[nodiscard]] const DeviceHandleVector& getNonInterruptibleOffscreenBuffersToRender() const;
         [[nodiscard]] const DeviceHandleVector& getInterruptibleOffscreenBuffersToRender(DeviceResourceHandle interruptedDisplayBuffer) const;
@@ -65,8 +81,10 @@ namespace ramses::internal
     private:
         AssignedSceneInfo& findSceneInfo(SceneId sceneId, DeviceResourceHandle displayBuffer);
         DisplayBufferInfo& getDisplayBufferInternal(DeviceResourceHandle displayBuffer);
+        [[nodiscard]] bool isRenderFrameOf(const DisplayBufferInfo& bufferInfo) const;
 
         DisplayBuffersMap m_displayBuffers;
+        uint64_t          m_frameCounter = 0u;
 
         // keep as member to avoid re-allocations
         mutable DeviceHandleVector m_buffersToRender;
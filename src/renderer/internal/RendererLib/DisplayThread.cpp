@@ -12,13 +12,18 @@
 
 namespace ramses::internal
 {
-    DisplayThread::DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier)
+    DisplayThread::DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier, bool lateFrameStart, bool idleWait, ThreadScheduling scheduling)
         : m_displayHandle{ displayHandle }
         , m_display{ std::move(displayBundle) }
+        , m_lateFrameStart{ lateFrameStart }
+        , m_idleWait{ idleWait }
+        , m_scheduling{ std::move(scheduling) }
         , m_thread{ GetThreadName(displayHandle) }
         , m_notifier{ notifier }
         , m_aliveIdentifier{ notifier.registerThread() }
     {
+        if (m_idleWait)
+            m_display->setWakeUpListener([this]() { wakeUp(); });
     }
 
     DisplayThread::~DisplayThread()
@@ -64,6 +69,8 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, "{} loop mode set to {}", GetThreadName(m_displayHandle), loopMode == ELoopMode::UpdateAndRender ? "UpdateAndRender" : "UpdateOnly");
         std::lock_guard<std::mutex> lock{ m_lock };
         m_loopMode = loopMode;
+        m_wakeUpRequested = true;
+        m_sleepConditionVar.notify_one();
     }
 
     void DisplayThread::setMinFrameDuration(std::chrono::microseconds minLoopPeriod)
@@ -75,6 +82,10 @@ namespace ramses::internal
 
     void DisplayThread::run()
     {
+        if (!PlatformThread::SetCurrentThreadScheduling(m_scheduling))
+            LOG_WARN(CONTEXT_RENDERER, "DisplayThread {}: failed to apply thread scheduling {}", m_displayHandle, m_scheduling);
+        LOG_INFO(CONTEXT_RENDERER, "DisplayThread {}: running with thread scheduling {}", m_displayHandle, PlatformThread::GetCurrentThreadScheduling());
+
         std::chrono::milliseconds lastLoopSleepTime{ 0u };
         while (!isCancelRequested())
         {
@@ -88,6 +99,8 @@ namespace ramses::internal
                 minimumFrameDuration = m_minFrameDuration;
                 doUpdate = m_isUpdating;
                 loopMode = m_loopMode;
+                // any work arriving from now on is either processed in this loop or wakes up the idle wait after it
+                m_wakeUpRequested = false;
             }
 
             m_display->traceId() = 10001;
@@ -103,6 +116,9 @@ namespace ramses::internal
             }
             else
             {
+                if (m_lateFrameStart)
+                    lastLoopSleepTime = sleepToStartFrameLate(minimumFrameDuration);
+
                 m_display->traceId() = 10004;
                 auto loopStartTime = std::chrono::steady_clock::now();
                 m_display->doOneLoop(loopMode, lastLoopSleepTime);
@@ -110,13 +126,25 @@ namespace ramses::internal
 
                 m_display->traceId() = 10005;
                 const auto currentLoopDuration = std::chrono::duration_cast<std::chrono::microseconds>(loopEndTime - loopStartTime);
-                lastLoopSleepTime = SleepToControlFramerate(currentLoopDuration, minimumFrameDuration);
+                if (m_lateFrameStart)
+                    m_framePacer.frameFinished(currentLoopDuration);
+                else
+                    lastLoopSleepTime = SleepToControlFramerate(currentLoopDuration, minimumFrameDuration);
                 m_display->traceId() = 10006;
+
+                if (m_idleWait && m_display->isIdle())
+                {
+                    m_display->traceId() = 10007;
+                    lastLoopSleepTime += waitWhileIdle();
+                }
             }
 
             m_frameCounter++;
         }
 
+        if (m_idleWait)
+            m_display->setWakeUpListener({});
+
         // release display before thread exit, it might contain platform components that need to be deinitialized in same thread
         LOG_INFO(CONTEXT_RENDERER, "releasing display bundle components");
         m_display.destroy();
@@ -147,6 +175,35 @@ namespace ramses::internal
         return sleepTime;
     }
 
+    std::chrono::milliseconds DisplayThread::sleepToStartFrameLate(std::chrono::microseconds minimumFrameDuration)
+    {
+        // previous frame just finished (typically with buffer swap), sleep so that next one finishes
+        // right before end of frame period rather than right after its start
+        const auto delay = m_framePacer.getDelayBeforeNextFrame(minimumFrameDuration);
+        if (delay.count() > 0)
+            std::this_thread::sleep_for(delay);
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(delay);
+    }
+
+    std::chrono::milliseconds DisplayThread::waitWhileIdle()
+    {
+        const auto waitStart = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock{ m_lock };
+            // wait is interrupted by timeout only to notify watchdog (and handle window events) in next loop
+            m_sleepConditionVar.wait_for(lock, m_notifier.calculateTimeout(), [this]() { return m_wakeUpRequested || isCancelRequested(); });
+        }
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - waitStart);
+    }
+
+    void DisplayThread::wakeUp()
+    {
+        std::lock_guard<std::mutex> lock{ m_lock };
+        m_wakeUpRequested = true;
+        m_sleepConditionVar.notify_one();
+    }
+
     uint32_t DisplayThread::getFrameCounter() const
     {
         return m_frameCounter;
@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/Enums/ELoopMode.h"
 #include "internal/RendererLib/DisplayBundle.h"
+#include "internal/RendererLib/FramePacer.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Watchdog/IThreadAliveNotifier.h"
 
@@ -70,7 +71,10 @@ namespace ramses::internal
     class DisplayThread final : public IDisplayThread, private Runnable
     {
     public:
-        DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier);
+        // with late frame start the thread sleeps before a frame instead of after it, see FramePacer
+        // with idle wait the thread stops looping when display is idle until woken up by display bundle, see DisplayConfig::setIdleWaitEnabled
+        // scheduling is applied by the thread itself when started, see DisplayConfig::setDisplayThreadScheduling
+        DisplayThread(DisplayBundleShared displayBundle, DisplayHandle displayHandle, IThreadAliveNotifier& notifier, bool lateFrameStart = false, bool idleWait = false, ThreadScheduling scheduling = {});
         ~DisplayThread() override;
 
         void startUpdating() override;
@@ -85,15 +89,23 @@ namespace ramses::internal
 
         static std::string GetThreadName(DisplayHandle display);
         static std::chrono::milliseconds SleepToControlFramerate(std::chrono::microseconds loopDuration, std::chrono::microseconds minimumFrameDuration);
+        std::chrono::milliseconds sleepToStartFrameLate(std::chrono::microseconds minimumFrameDuration);
+        std::chrono::milliseconds waitWhileIdle();
+        void wakeUp();
 
         const DisplayHandle m_displayHandle;
         DisplayBundleShared m_display;
         ELoopMode m_loopMode = ELoopMode::UpdateAndRender;
         std::chrono::microseconds m_minFrameDuration{ DefaultMinFrameDuration };
+        const bool m_lateFrameStart;
+        FramePacer m_framePacer;
+        const bool m_idleWait;
+        const ThreadScheduling m_scheduling;
 
         PlatformThread m_thread;
         mutable std::mutex m_lock;
         bool m_isUpdating = false;
+        bool m_wakeUpRequested = false;
         std::condition_variable m_sleepConditionVar;
 
         IThreadAliveNotifier& m_notifier;
@@ -150,6 +150,7 @@ namespace ramses::internal
         StreamTextureSourceInfo* streamTextureSourceInfo = m_streamTextureSourceInfoMap.get(source);
         assert(streamTextureSourceInfo != nullptr);
         m_device.deleteTexture(streamTextureSourceInfo->compositedTextureHandle);
+        m_textureUploadingAdapter.handleTextureDeleted(streamTextureSourceInfo->compositedTextureHandle);
         m_streamTextureSourceInfoMap.remove(source);
     }
 }
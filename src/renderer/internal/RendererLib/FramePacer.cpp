@@ -0,0 +1,34 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FramePacer.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    void FramePacer::frameFinished(std::chrono::microseconds frameDuration)
+    {
+        if (frameDuration.count() < 0)
+            return;
+
+        if (frameDuration >= m_estimatedFrameCost)
+            m_estimatedFrameCost = frameDuration;
+        else
+            m_estimatedFrameCost = (m_estimatedFrameCost * 7 + frameDuration) / 8;
+    }
+
+    std::chrono::microseconds FramePacer::getEstimatedFrameCost() const
+    {
+        return m_estimatedFrameCost;
+    }
+
+    std::chrono::microseconds FramePacer::getDelayBeforeNextFrame(std::chrono::microseconds framePeriod) const
+    {
+        return std::max(framePeriod - m_estimatedFrameCost - SafetyMargin, std::chrono::microseconds{ 0 });
+    }
+}
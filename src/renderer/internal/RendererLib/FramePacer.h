@@ -0,0 +1,33 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+
+namespace ramses::internal
+{
+    // Estimates cost of a frame from measured frame durations and calculates how long start of next frame
+    // can be delayed so that it still finishes within given frame period, i.e. frame starts as late as possible
+    // and its content is as recent as possible when displayed.
+    // The estimate follows frames getting more expensive immediately but decays slowly, so that a single cheap frame
+    // does not cause the next one to start too late.
+    class FramePacer
+    {
+    public:
+        // reserve for inaccuracy of sleep and variance of frame cost not covered by estimate
+        static constexpr std::chrono::microseconds SafetyMargin{ 2000 };
+
+        void frameFinished(std::chrono::microseconds frameDuration);
+        [[nodiscard]] std::chrono::microseconds getEstimatedFrameCost() const;
+        [[nodiscard]] std::chrono::microseconds getDelayBeforeNextFrame(std::chrono::microseconds framePeriod) const;
+
+    private:
+        std::chrono::microseconds m_estimatedFrameCost{ 0 };
+    };
+}
@@ -10,11 +10,13 @@
 #include "internal/PlatformAbstraction/Collections/StringOutputStream.h"
 #include "internal/Core/Utils/LoggingUtils.h"
 #include "internal/PlatformAbstraction/PlatformMath.h"
+#include "internal/Core/Utils/TraceRecorder.h"
 
 namespace ramses::internal
 {
     FrameProfilerStatistics::FrameProfilerStatistics()
         : m_regionStartTimes(NumberOfRegions)
+        , m_regionTraceStartTimes(NumberOfRegions)
     {
         m_frameTimings.reserve(NumberOfFrames * NumberOfRegions);
         initNextFrameTimings();
@@ -29,6 +31,7 @@ namespace ramses::internal
 
         m_currentRegionId = regionId;
         m_regionStartTimes[regionId] = PlatformTime::GetMicrosecondsMonotonic();
+        m_regionTraceStartTimes[regionId] = (GetTraceRecorder().isEnabled() ? PlatformTime::GetMicrosecondsSynchronized() : 0u);
     }
 
     void FrameProfilerStatistics::endRegion(ERegion region)
@@ -39,6 +42,9 @@ namespace ramses::internal
 
         const auto totalRegionTime = static_cast<size_t>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
+
+        if (m_regionTraceStartTimes[regionId] != 0u)
+            GetTraceRecorder().addEvent("renderer", RegionNames[regionId], m_regionTraceStartTimes[regionId], PlatformTime::GetMicrosecondsSynchronized());
     }
 
     void FrameProfilerStatistics::initNextFrameTimings()
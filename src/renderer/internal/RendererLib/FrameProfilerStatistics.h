@@ -73,6 +73,8 @@ namespace ramses::internal
 
         using RegionTimes = std::vector<uint64_t>;
         RegionTimes m_regionStartTimes;
+        // start times in synchronized clock, only taken while tracing is enabled
+        RegionTimes m_regionTraceStartTimes;
 
         // region measurements for periodic logging
         // these are reset every period
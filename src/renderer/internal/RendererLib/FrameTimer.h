@@ -55,6 +55,14 @@ namespace ramses::internal
             return sectionDuration >= m_sectionBudgets[static_cast<size_t>(section)];
         }
 
+        // time left in frame until budget of section is exceeded, zero if exceeded already
+        [[nodiscard]] std::chrono::microseconds getRemainingTimeForSection(EFrameTimerSectionBudget section) const
+        {
+            const auto sectionDuration = std::chrono::duration_cast<Duration>(Clock::now() - m_frameStartTimeStamp);
+            const auto budget = m_sectionBudgets[static_cast<size_t>(section)];
+            return (sectionDuration < budget ? budget - sectionDuration : Duration{ 0 });
+        }
+
         [[nodiscard]] std::chrono::microseconds getTimeBudgetForSection(EFrameTimerSectionBudget section) const
         {
             return m_sectionBudgets[static_cast<size_t>(section)];
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+#include <cstdint>
+#include <map>
+
+namespace ramses::internal
+{
+    // Estimated GPU memory usage of a display's resource manager, sizes are the estimates the renderer
+    // works with internally (e.g. for GPU cache handling), not values queried from the driver.
+    struct GpuMemoryReport
+    {
+        struct Usage
+        {
+            uint64_t textures = 0u;
+            uint64_t buffers = 0u;
+            uint64_t renderTargets = 0u;
+            uint64_t shaders = 0u;
+            // part of the categories above which belongs to resources used by more than one scene,
+            // such resources are split evenly among the scenes using them
+            uint64_t shared = 0u;
+
+            [[nodiscard]] uint64_t getTotal() const
+            {
+                return textures + buffers + renderTargets + shaders;
+            }
+
+            Usage& operator+=(const Usage& other)
+            {
+                textures += other.textures;
+                buffers += other.buffers;
+                renderTargets += other.renderTargets;
+                shaders += other.shaders;
+                shared += other.shared;
+                return *this;
+            }
+        };
+
+        struct SceneIdComparator
+        {
+            bool operator()(SceneId a, SceneId b) const
+            {
+                return a.getValue() < b.getValue();
+            }
+        };
+
+        // using map so that scenes are reported ordered
+        std::map<SceneId, Usage, SceneIdComparator> scenes;
+        // client resources still uploaded but not used by any scene (kept in GPU cache)
+        Usage unusedResources;
+        uint64_t offscreenBuffers = 0u;
+        uint64_t gpuCacheSize = 0u;
+
+        [[nodiscard]] Usage getTotal() const
+        {
+            Usage total = unusedResources;
+            for (const auto& scene : scenes)
+                total += scene.second;
+            total.renderTargets += offscreenBuffers;
+            return total;
+        }
+    };
+}
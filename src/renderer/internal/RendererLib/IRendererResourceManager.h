@@ -10,6 +10,8 @@
 
 #include "IResourceDeviceHandleAccessor.h"
 #include "internal/RendererLib/Enums/EResourceStatus.h"
+#include "internal/RendererLib/GpuMemoryReport.h"
+#include "internal/RendererLib/RenderTargetAlias.h"
 #include "internal/SceneGraph/SceneAPI/RenderBuffer.h"
 #include "internal/SceneGraph/SceneAPI/SceneTypes.h"
 #include "internal/SceneGraph/SceneAPI/TextureSamplerStates.h"
@@ -46,13 +48,15 @@ namespace ramses::internal
         virtual void             updateRenderTargetBufferProperties(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer) = 0;
         virtual void             uploadRenderTarget(RenderTargetHandle renderTarget, const RenderBufferHandleVector& rtBufferHandles, SceneId sceneId) = 0;
         virtual void             unloadRenderTarget(RenderTargetHandle renderTarget, SceneId sceneId) = 0;
+        // returns true if device handles of any render target or render buffer of scene changed
+        virtual bool             updateRenderTargetAliases(SceneId sceneId, const RenderTargetAliases& aliases) = 0;
 
         virtual void             uploadBlitPassRenderTargets(BlitPassHandle blitPass, RenderBufferHandle sourceRenderBuffer, RenderBufferHandle destinationRenderBuffer, SceneId sceneId) = 0;
         virtual void             unloadBlitPassRenderTargets(BlitPassHandle blitPass, SceneId sceneId) = 0;
 
         virtual void             uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t dataSizeInBytes, SceneId sceneId) = 0;
         virtual void             unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) = 0;
-        virtual void             updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) = 0;
+        virtual void             updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) = 0;
 
         virtual void             uploadTextureBuffer(TextureBufferHandle textureBufferHandle, uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, uint32_t mipLevelCount,  SceneId sceneId) = 0;
         virtual void             unloadTextureBuffer(TextureBufferHandle textureBufferHandle, SceneId sceneId) = 0;
@@ -77,14 +81,28 @@ namespace ramses::internal
         virtual void             uploadOffscreenBuffer(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, uint32_t sampleCount, bool isDoubleBuffered, EDepthBufferType depthStencilBufferType) = 0;
         virtual void             uploadDmaOffscreenBuffer(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, DmaBufferFourccFormat dmaBufferFourccFormat, DmaBufferUsageFlags dmaBufferUsageFlags, DmaBufferModifiers dmaBufferModifiers) = 0;
         virtual void             unloadOffscreenBuffer(OffscreenBufferHandle bufferHandle) = 0;
+        // sync file FD signaled when rendering submitted so far is finished, ownership goes to caller, -1 if not supported or not DMA offscreen buffer
+        virtual int              createDmaOffscreenBufferSyncFence(OffscreenBufferHandle bufferHandle) = 0;
+        // render target of given (reduced) size to render offscreen buffer's content into before it is scaled up to the buffer, unloaded together with buffer,
+        // invalid handle for DMA offscreen buffers
+        virtual DeviceResourceHandle uploadOffscreenBufferScaledRenderTarget(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height) = 0;
 
         virtual void             uploadStreamBuffer(StreamBufferHandle bufferHandle, WaylandIviSurfaceId surfaceId) = 0;
         virtual void             unloadStreamBuffer(StreamBufferHandle bufferHandle) = 0;
 
         virtual void             uploadExternalBuffer(ExternalBufferHandle bufferHandle) = 0;
         virtual void             unloadExternalBuffer(ExternalBufferHandle bufferHandle) = 0;
+        // replaces content of external buffer with application owned DMA buffer frame, on success releaseFenceFD is set to
+        // sync file FD (ownership goes to caller) signaled when sampling of previously imported frame is finished, -1 if none or not supported
+        virtual bool             importDmaBufferToExternalBuffer(ExternalBufferHandle bufferHandle, const DmaBufferFrame& frame, int& releaseFenceFD) = 0;
+        // stops using imported DMA buffer frame, returns sync file FD as above
+        virtual int              releaseDmaBufferOfExternalBuffer(ExternalBufferHandle bufferHandle) = 0;
 
         [[nodiscard]] virtual const StreamUsage& getStreamUsage(WaylandIviSurfaceId source) const = 0;
+
+        [[nodiscard]] virtual GpuMemoryReport getGpuMemoryReport() const = 0;
+        // unloads all client resources not used by any scene (kept in GPU cache), returns estimated size of freed memory
+        virtual uint64_t         trimMemory() = 0;
     };
 }
 
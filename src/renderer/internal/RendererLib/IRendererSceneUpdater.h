@@ -39,8 +39,12 @@ namespace ramses::internal
         virtual bool handleBufferDestroyRequest(StreamBufferHandle buffer) = 0;
         virtual bool handleExternalBufferCreateRequest(ExternalBufferHandle buffer) = 0;
         virtual bool handleExternalBufferDestroyRequest(ExternalBufferHandle buffer) = 0;
+        virtual void handleExternalBufferDmaBufferUpdate(ExternalBufferHandle buffer, const DmaBufferFrame& frame) = 0;
         virtual void handleSetClearFlags(OffscreenBufferHandle buffer, ClearFlags clearFlags) = 0;
         virtual void handleSetClearColor(OffscreenBufferHandle buffer, const glm::vec4& clearColor) = 0;
+        virtual void handleSetRenderRateDivisor(OffscreenBufferHandle buffer, uint32_t divisor) = 0;
+        virtual void handleSetOffscreenBufferScalable(OffscreenBufferHandle buffer, bool scalable) = 0;
+        virtual void handleSetDmaOffscreenBufferSyncFence(OffscreenBufferHandle buffer, bool enable) = 0;
         virtual void handleSetExternallyOwnedWindowSize(uint32_t width, uint32_t height) = 0;
         virtual void handleReadPixels(OffscreenBufferHandle buffer, ScreenshotInfo&& screenshotInfo) = 0;
         virtual void handlePickEvent(SceneId sceneId, glm::vec2 coordsNormalizedToBufferSize) = 0;
@@ -52,6 +56,7 @@ namespace ramses::internal
         virtual void setLimitFlushesForceApply(size_t limitForPendingFlushesForceApply) = 0;
         virtual void setLimitFlushesForceUnsubscribe(size_t limitForPendingFlushesForceUnsubscribe) = 0;
         virtual void setSkippingOfUnmodifiedScenes(bool enable) = 0;
+        virtual void handleTrimMemory() = 0;
         virtual void logRendererInfo(const RendererCommand::LogInfo& cmd) const = 0;
 
         virtual ~IRendererSceneUpdater() = default;
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include <vector>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Uploaded resource not used by any scene, which can be unloaded to free GPU memory cache
+    struct ResourceEvictionCandidate
+    {
+        ResourceContentHash hash;
+        EResourceType type = EResourceType::Invalid;
+        // size accounted for in GPU memory cache
+        uint64_t size = 0u;
+        // number of frames since the resource was last used by a scene
+        uint64_t framesSinceLastUse = 0u;
+        // priority of the scene which used the resource last (see DisplayConfig::setScenePriority, higher value means less priority)
+        int32_t scenePriority = 0;
+        // estimated cost of uploading the resource again, in bytes to be transferred and processed
+        uint64_t reuploadCost = 0u;
+    };
+    using ResourceEvictionCandidates = std::vector<ResourceEvictionCandidate>;
+
+    class IResourceEvictionPolicy
+    {
+    public:
+        virtual ~IResourceEvictionPolicy() = default;
+
+        // Order candidates so that the ones to be unloaded first come first,
+        // candidates are passed in the order they became unused (oldest first).
+        virtual void rankForEviction(ResourceEvictionCandidates& candidates) const = 0;
+    };
+}
@@ -10,7 +10,6 @@
 #include "internal/Core/Math3d/CameraMatrixHelper.h"
 #include "internal/RendererLib/PlatformInterface/IDisplayController.h"
 #include "internal/RendererLib/Types.h"
-#include "glm/gtc/type_ptr.hpp"
 
 namespace ramses::internal
 {
@@ -93,6 +92,15 @@ namespace ramses::internal
     bool IntersectionUtils::TestGeometryPicked(const glm::vec2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace)
     {
         assert(geometrySize % 9 == 0);
+        const TriangleBVH geometryBVH{ geometry, geometrySize };
+        return TestGeometryPicked(pickCoordsNDS, geometryBVH, modelMatrix, viewMatrix, projectionMatrix, intersectionPointInModelSpace);
+    }
+
+    bool IntersectionUtils::TestGeometryPicked(const glm::vec2& pickCoordsNDS, const TriangleBVH& geometry, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace)
+    {
+        if (geometry.empty())
+            return false;
+
         // 4D homogeneous Clip Coordinates
         const glm::vec4 ray_orig_clip(pickCoordsNDS.x, pickCoordsNDS.y, -1.0f, 1.0f);
         const glm::vec4 ray_target_clip(pickCoordsNDS.x, pickCoordsNDS.y, 1.0f, 1.0f);
@@ -116,42 +124,20 @@ namespace ramses::internal
         glm::vec3 ray_target_model(inverseModelMatrix * ray_target_world);
         const auto ray_dir_model = glm::normalize(ray_target_model - ray_orig_model);
 
-        bool intersectionResult = false;
-        float distanceInModelSpace = std::numeric_limits<float>::max();
-
-        for (size_t fltIdx = 0u; fltIdx < geometrySize; fltIdx += 9)
-        {
-            const float* triData = &geometry[fltIdx];
-            Triangle triangle{};
-            std::copy(triData + 0, triData + 3, glm::value_ptr(triangle.v0));
-            std::copy(triData + 3, triData + 6, glm::value_ptr(triangle.v1));
-            std::copy(triData + 6, triData + 9, glm::value_ptr(triangle.v2));
-
-            float distanceResult = 0.f;
-            glm::vec3 intersectionPoint;
-            if (IntersectRayVsTriangle(triangle, ray_orig_model, ray_dir_model, intersectionPoint, distanceResult))
-            {
-                intersectionResult = true;
-                if (distanceResult < distanceInModelSpace)
-                {
-                    intersectionPointInModelSpace = intersectionPoint;
-                    distanceInModelSpace = distanceResult;
-                }
-            }
-        }
-        return intersectionResult;
+        float distanceInModelSpace = 0.f;
+        return geometry.intersectRay(ray_orig_model, ray_dir_model, intersectionPointInModelSpace, distanceInModelSpace);
     }
 
     void IntersectionUtils::CheckSceneForIntersectedPickableObjects(const TransformationLinkCachedScene& scene, const glm::ivec2 coordsInBufferSpace, PickableObjectIds& pickedObjects)
     {
-        assert(pickedObjects.empty());
+        PickableObjectSnapshots pickableObjects;
+        CollectPickableObjects(scene, coordsInBufferSpace, pickableObjects);
+        CheckPickableObjectsForIntersection(pickableObjects, pickedObjects);
+    }
 
-        struct PickedObjectEntry
-        {
-            PickableObjectId id;
-            float distance;
-        };
-        std::vector<PickedObjectEntry> pickedObjectEntries;
+    void IntersectionUtils::CollectPickableObjects(const TransformationLinkCachedScene& scene, const glm::ivec2 coordsInBufferSpace, PickableObjectSnapshots& pickableObjects)
+    {
+        assert(pickableObjects.empty());
 
         for (PickableObjectHandle pickableHandle(0); pickableHandle < scene.getPickableObjectCount(); ++pickableHandle)
         {
@@ -190,32 +176,41 @@ namespace ramses::internal
                 const auto projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
                     ProjectionParams::Frustum(pickableCamera.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
 
-                const GeometryDataBuffer& geometryBuffer =
-                    scene.getDataBuffer(pickableObject.geometryHandle);
-                assert(geometryBuffer.bufferType == EDataBufferType::VertexBuffer);
-                assert(geometryBuffer.dataType == EDataType::Vector3F);
-                const auto* geometryBufferFloat = reinterpret_cast<const float*>(geometryBuffer.data.data());
-                const uint32_t geometrySize = geometryBuffer.usedSize / sizeof(float);
-                assert(0 == geometrySize % 9);
-
-                glm::vec3 intersectionPointInModelSpace;
-                if (IntersectionUtils::TestGeometryPicked(coordsNDS,
-                                                            geometryBufferFloat,
-                                                            geometrySize,
-                                                            modelMatrix,
-                                                            cameraViewMatrix,
-                                                            projectionMatrix,
-                                                            intersectionPointInModelSpace))
-                {
-                    const glm::vec4 intersectionPointInClipSpace = projectionMatrix * cameraViewMatrix * modelMatrix * glm::vec4(intersectionPointInModelSpace, 1.f);
-                    const glm::vec4 intersectionPointInNDS = intersectionPointInClipSpace / intersectionPointInClipSpace.w;
-
-                    assert(std::abs(intersectionPointInNDS.x - coordsNDS.x) <= std::numeric_limits<float>::epsilon() * 10);
-                    assert(std::abs(intersectionPointInNDS.y - coordsNDS.y) <= std::numeric_limits<float>::epsilon() * 10);
-                    const float intersectionDepthInNDS = intersectionPointInNDS.z;
-
-                    pickedObjectEntries.push_back({ pickableObject.id , intersectionDepthInNDS });
-                }
+                pickableObjects.push_back({ pickableObject.id, coordsNDS, modelMatrix, cameraViewMatrix, projectionMatrix,
+                    scene.getSharedPickableGeometryBVH(pickableObject.geometryHandle) });
+            }
+        }
+    }
+
+    void IntersectionUtils::CheckPickableObjectsForIntersection(const PickableObjectSnapshots& pickableObjects, PickableObjectIds& pickedObjects)
+    {
+        assert(pickedObjects.empty());
+
+        struct PickedObjectEntry
+        {
+            PickableObjectId id;
+            float distance;
+        };
+        std::vector<PickedObjectEntry> pickedObjectEntries;
+
+        for (const auto& pickableObject : pickableObjects)
+        {
+            const glm::vec2& coordsNDS = pickableObject.pickCoordsNDS;
+            glm::vec3 intersectionPointInModelSpace;
+            if (IntersectionUtils::TestGeometryPicked(coordsNDS,
+                                                        *pickableObject.geometry,
+                                                        pickableObject.modelMatrix,
+                                                        pickableObject.viewMatrix,
+                                                        pickableObject.projectionMatrix,
+                                                        intersectionPointInModelSpace))
+            {
+                const glm::vec4 intersectionPointInClipSpace = pickableObject.projectionMatrix * pickableObject.viewMatrix * pickableObject.modelMatrix * glm::vec4(intersectionPointInModelSpace, 1.f);
+                const glm::vec4 intersectionPointInNDS = intersectionPointInClipSpace / intersectionPointInClipSpace.w;
+                assert(std::abs(intersectionPointInNDS.x - coordsNDS.x) <= std::numeric_limits<float>::epsilon() * 10);
+                assert(std::abs(intersectionPointInNDS.y - coordsNDS.y) <= std::numeric_limits<float>::epsilon() * 10);
+                const float intersectionDepthInNDS = intersectionPointInNDS.z;
+
+                pickedObjectEntries.push_back({ pickableObject.id , intersectionDepthInNDS });
             }
         }
 
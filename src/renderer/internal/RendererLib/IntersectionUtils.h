@@ -9,8 +9,11 @@
 #pragma once
 
 #include "TransformationLinkCachedScene.h"
+#include "internal/RendererLib/TriangleBVH.h"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -27,8 +30,26 @@ namespace ramses::internal
         static glm::vec3 CalculatePlaneNormal(const Triangle& triangle);
         static bool IntersectRayVsTriangle(const Triangle& triangle, const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPointInModelSpace, float& distanceRayOriginToIntersection);
         static bool TestGeometryPicked(const glm::vec2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace);
+        static bool TestGeometryPicked(const glm::vec2& pickCoordsNDS, const TriangleBVH& geometry, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace);
         static void CheckSceneForIntersectedPickableObjects(const TransformationLinkCachedScene& scene, const glm::ivec2 coordsInBufferSpace, PickableObjectIds& pickedObjects);
 
+        // everything needed to check a pickable object for intersection with pick event without accessing its scene
+        struct PickableObjectSnapshot
+        {
+            PickableObjectId id;
+            glm::vec2 pickCoordsNDS;
+            glm::mat4 modelMatrix;
+            glm::mat4 viewMatrix;
+            glm::mat4 projectionMatrix;
+            std::shared_ptr<const TriangleBVH> geometry;
+        };
+        using PickableObjectSnapshots = std::vector<PickableObjectSnapshot>;
+
+        // snapshot of enabled pickable objects with pick event inside of their camera viewport,
+        // must be taken where scene can be accessed (uses matrix cache of scene), intersections can be checked anywhere
+        static void CollectPickableObjects(const TransformationLinkCachedScene& scene, const glm::ivec2 coordsInBufferSpace, PickableObjectSnapshots& pickableObjects);
+        static void CheckPickableObjectsForIntersection(const PickableObjectSnapshots& pickableObjects, PickableObjectIds& pickedObjects);
+
     private:
         static bool TestPointInTriangle(const Triangle& triangle, const glm::vec3& planeNormal, const glm::vec3& testPoint);
         static bool CalculateRayVsPlaneIntersection(const glm::vec3& triangleVertex,
@@ -16,6 +16,19 @@
 
 namespace ramses::internal
 {
+    namespace
+    {
+        const char* GetBufferUsageName(EDeviceBufferUsage usage)
+        {
+            switch (usage)
+            {
+            case EDeviceBufferUsage::Static: return "static";
+            case EDeviceBufferUsage::Dynamic: return "dynamic";
+            }
+            return "";
+        }
+    }
+
     LoggingDevice::LoggingDevice(const IDevice& deviceDelegate, RendererLogContext& context)
         : m_deviceDelegate(deviceDelegate)
         , m_logContext(context)
@@ -215,9 +228,15 @@ namespace ramses::internal
         m_logContext << "delete uniform buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
-    DeviceResourceHandle LoggingDevice::allocateVertexBuffer(uint32_t totalSizeInBytes)
+    DeviceResourceHandle LoggingDevice::allocateStreamingUniformBuffer(uint32_t totalSizeInBytes)
+    {
+        m_logContext << "allocate streaming uniform buffer [total size: " << totalSizeInBytes << "]" << RendererLogContext::NewLine;
+        return {};
+    }
+
+    DeviceResourceHandle LoggingDevice::allocateVertexBuffer(uint32_t totalSizeInBytes, EDeviceBufferUsage usage)
     {
-        m_logContext << "allocate vertex buffer [total size: " << totalSizeInBytes << "]" << RendererLogContext::NewLine;
+        m_logContext << "allocate vertex buffer [total size: " << totalSizeInBytes << " usage: " << GetBufferUsageName(usage) << "]" << RendererLogContext::NewLine;
         return DeviceResourceHandle::Invalid();
     }
 
@@ -226,6 +245,11 @@ namespace ramses::internal
         m_logContext << "upload vertex buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::uploadVertexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* /*data*/, uint32_t dataSize)
+    {
+        m_logContext << "upload vertex buffer sub data [device handle: " << handle << " offset: " << offsetInBytes << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteVertexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete vertex buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -247,9 +271,9 @@ namespace ramses::internal
         m_logContext << "delete vertex array [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
-    DeviceResourceHandle LoggingDevice::allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes)
+    DeviceResourceHandle LoggingDevice::allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage)
     {
-        m_logContext << "allocate index buffer [type: " << EnumToString(dataType) << " size: " << sizeInBytes << "]" << RendererLogContext::NewLine;
+        m_logContext << "allocate index buffer [type: " << EnumToString(dataType) << " size: " << sizeInBytes << " usage: " << GetBufferUsageName(usage) << "]" << RendererLogContext::NewLine;
         return DeviceResourceHandle::Invalid();
     }
 
@@ -258,6 +282,11 @@ namespace ramses::internal
         m_logContext << "upload index buffer data [device handle: " << handle << " size: " << dataSize << "]" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::uploadIndexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* /*data*/, uint32_t dataSize)
+    {
+        m_logContext << "upload index buffer sub data [device handle: " << handle << " offset: " << offsetInBytes << " size: " << dataSize << "]" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::deleteIndexBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "delete index buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
@@ -269,6 +298,14 @@ namespace ramses::internal
         return nullptr;
     }
 
+    std::vector<std::unique_ptr<const GPUResource>> LoggingDevice::uploadShaders(const std::vector<const EffectResource*>& effects)
+    {
+        std::vector<std::unique_ptr<const GPUResource>> shaderResources;
+        for (const auto effect : effects)
+            shaderResources.push_back(uploadShader(*effect));
+        return shaderResources;
+    }
+
     DeviceResourceHandle LoggingDevice::registerShader(std::unique_ptr<const GPUResource> shaderResource)
     {
         m_logContext << "register shader " << shaderResource->getGPUAddress() << RendererLogContext::NewLine;
@@ -360,6 +397,18 @@ namespace ramses::internal
         m_logContext << "delete texture [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
+    std::unique_ptr<const GPUResource> LoggingDevice::extractTexture(DeviceResourceHandle handle)
+    {
+        m_logContext << "extract texture [handle: " << handle << "]" << RendererLogContext::NewLine;
+        return {};
+    }
+
+    DeviceResourceHandle LoggingDevice::registerTexture(std::unique_ptr<const GPUResource> /*textureResource*/)
+    {
+        m_logContext << "register texture" << RendererLogContext::NewLine;
+        return {};
+    }
+
     void LoggingDevice::activateTexture(DeviceResourceHandle handle, DataFieldHandle field)
     {
         logResourceActivation("texture", handle, field);
@@ -407,11 +456,31 @@ namespace ramses::internal
         return 0;
     }
 
+    int LoggingDevice::createDmaRenderBufferSyncFence(DeviceResourceHandle handle)
+    {
+        m_logContext << "create dma render buffer sync fence [handle: " << handle << "]" << RendererLogContext::NewLine;
+        return -1;
+    }
+
     void LoggingDevice::destroyDmaRenderBuffer(DeviceResourceHandle handle)
     {
         m_logContext << "destroy dma render buffer [handle: " << handle << "]" << RendererLogContext::NewLine;
     }
 
+    bool LoggingDevice::importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD)
+    {
+        m_logContext << "import dma buffer to external texture [handle: " << handle << " FD: " << frame.fd << " width: " << frame.width << " height: " << frame.height
+            << " format: " << frame.fourccFormat.getValue() << " stride: " << frame.stride << " modifiers: " << frame.modifiers.getValue() << "]" << RendererLogContext::NewLine;
+        releaseFenceFD = -1;
+        return false;
+    }
+
+    int LoggingDevice::releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle)
+    {
+        m_logContext << "release dma buffer of external texture [handle: " << handle << "]" << RendererLogContext::NewLine;
+        return -1;
+    }
+
     DeviceResourceHandle LoggingDevice::getFramebufferRenderTarget() const
     {
         return DeviceResourceHandle::Invalid();
@@ -438,6 +507,11 @@ namespace ramses::internal
         m_logContext << "discard depthstencil buffer" << RendererLogContext::NewLine;
     }
 
+    void LoggingDevice::discardColorBuffers()
+    {
+        m_logContext << "discard color buffers" << RendererLogContext::NewLine;
+    }
+
     void LoggingDevice::blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& /*srcRect*/, const PixelRectangle& /*dstRect*/, bool /*colorOnly*/)
     {
         m_logContext << "blit render pass [RT src device handle:  " << rtSrc << ", RT dst device handle: " << rtDst << "]" << RendererLogContext::NewLine;
@@ -477,6 +551,22 @@ namespace ramses::internal
     {
     }
 
+    DeviceResourceHandle LoggingDevice::startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        m_logContext << "start read pixels [x: " << x << ", y: " << y << ", width: " << width << ", height: " << height << "]" << RendererLogContext::NewLine;
+        return DeviceResourceHandle::Invalid();
+    }
+
+    bool LoggingDevice::finishReadPixels(DeviceResourceHandle /*handle*/, std::vector<uint8_t>& /*dataOut*/)
+    {
+        return true;
+    }
+
+    void LoggingDevice::deleteReadPixels(DeviceResourceHandle handle)
+    {
+        m_logContext << "delete read pixels [handle: " << handle << "]" << RendererLogContext::NewLine;
+    }
+
     uint32_t LoggingDevice::getTotalGpuMemoryUsageInKB() const
     {
         return m_deviceDelegate.getTotalGpuMemoryUsageInKB();
@@ -535,10 +625,40 @@ namespace ramses::internal
         return 0;
     }
 
+    void LoggingDevice::invalidateStateCache()
+    {
+    }
+
+    bool LoggingDevice::beginGpuTimerQuery(uint64_t /*queryId*/)
+    {
+        return false;
+    }
+
+    void LoggingDevice::endGpuTimerQuery()
+    {
+    }
+
+    void LoggingDevice::collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& /*results*/)
+    {
+    }
+
+    void LoggingDevice::deleteGpuTimerQueries(uint64_t /*queryId*/)
+    {
+    }
+
     void LoggingDevice::flush()
     {
     }
 
+    DeviceFence LoggingDevice::insertFence()
+    {
+        return {};
+    }
+
+    void LoggingDevice::waitFence(DeviceFence /*fence*/)
+    {
+    }
+
     uint32_t LoggingDevice::getGPUHandle(DeviceResourceHandle /*deviceHandle*/) const
     {
         return 0u;
@@ -52,17 +52,21 @@ namespace ramses::internal
         void                    uploadUniformBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
         void                    activateUniformBuffer(DeviceResourceHandle handle, DataFieldHandle field) override;
         void                    deleteUniformBuffer(DeviceResourceHandle handle) override;
+        DeviceResourceHandle    allocateStreamingUniformBuffer(uint32_t totalSizeInBytes) override;
 
-        DeviceResourceHandle allocateVertexBuffer(uint32_t totalSizeInBytes) override;
+        DeviceResourceHandle allocateVertexBuffer(uint32_t totalSizeInBytes, EDeviceBufferUsage usage) override;
         void uploadVertexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void uploadVertexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void deleteVertexBuffer(DeviceResourceHandle handle) override;
         DeviceResourceHandle allocateVertexArray(const VertexArrayInfo& vertexArrayInfo) override;
         void activateVertexArray(DeviceResourceHandle handle) override;
         void deleteVertexArray(DeviceResourceHandle handle) override;
-        DeviceResourceHandle allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes) override;
+        DeviceResourceHandle allocateIndexBuffer(EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage) override;
         void uploadIndexBufferData(DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) override;
+        void uploadIndexBufferSubData(DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) override;
         void deleteIndexBuffer(DeviceResourceHandle handle) override;
         std::unique_ptr<const GPUResource> uploadShader(const EffectResource& effect) override;
+        std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& effects) override;
         DeviceResourceHandle registerShader(std::unique_ptr<const GPUResource> shaderResource) override;
         DeviceResourceHandle uploadBinaryShader(const EffectResource& effect, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat) override;
         bool getBinaryShader(DeviceResourceHandle handle, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) override;
@@ -78,6 +82,8 @@ namespace ramses::internal
         void                 uploadTextureData(DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) override;
         DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) override;
         void deleteTexture(DeviceResourceHandle handle) override;
+        std::unique_ptr<const GPUResource> extractTexture(DeviceResourceHandle handle) override;
+        DeviceResourceHandle registerTexture(std::unique_ptr<const GPUResource> textureResource) override;
         void activateTexture(DeviceResourceHandle handle, DataFieldHandle field) override;
         DeviceResourceHandle    uploadRenderBuffer(uint32_t width, uint32_t height, EPixelStorageFormat format, ERenderBufferAccessMode accessMode, uint32_t sampleCount) override;
         void                    deleteRenderBuffer(DeviceResourceHandle handle) override;
@@ -86,13 +92,17 @@ namespace ramses::internal
         DeviceResourceHandle    uploadDmaRenderBuffer(uint32_t width, uint32_t height, DmaBufferFourccFormat format, DmaBufferUsageFlags bufferUsage, DmaBufferModifiers bufferModifiers) override;
         int                     getDmaRenderBufferFD(DeviceResourceHandle handle) override;
         uint32_t                getDmaRenderBufferStride(DeviceResourceHandle handle) override;
+        int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) override;
         void                    destroyDmaRenderBuffer(DeviceResourceHandle handle) override;
+        bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) override;
+        int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) override;
 
         [[nodiscard]] DeviceResourceHandle    getFramebufferRenderTarget() const override;
         DeviceResourceHandle    uploadRenderTarget(const DeviceHandleVector& renderBuffers) override;
         void                    activateRenderTarget(DeviceResourceHandle handle) override;
         void                    deleteRenderTarget(DeviceResourceHandle handle) override;
         void                    discardDepthStencil() override;
+        void                    discardColorBuffers() override;
         void                    blitRenderTargets(DeviceResourceHandle rtSrc, DeviceResourceHandle rtDst, const PixelRectangle& srcRect, const PixelRectangle& dstRect, bool colorOnly) override;
 
         void drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
@@ -104,9 +114,17 @@ namespace ramses::internal
         void                    swapDoubleBufferedRenderTarget(DeviceResourceHandle renderTarget) override;
 
         void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        DeviceResourceHandle startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut) override;
+        void deleteReadPixels(DeviceResourceHandle handle) override;
 
         [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override;
         uint32_t getAndResetDrawCallCount() override;
+        void invalidateStateCache() override;
+        bool beginGpuTimerQuery(uint64_t queryId) override;
+        void endGpuTimerQuery() override;
+        void collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& results) override;
+        void deleteGpuTimerQueries(uint64_t queryId) override;
 
         void clearDepth(float d) override;
         void clearStencil(int32_t s) override;
@@ -119,6 +137,8 @@ namespace ramses::internal
         [[nodiscard]] bool isExternalTextureExtensionSupported() const override;
 
         void flush() override;
+        DeviceFence insertFence() override;
+        void waitFence(DeviceFence fence) override;
 
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
 
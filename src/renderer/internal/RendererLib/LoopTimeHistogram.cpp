@@ -0,0 +1,55 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/LoopTimeHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    void LoopTimeHistogram::addSample(std::chrono::microseconds loopTime)
+    {
+        const auto sample = std::max(loopTime, std::chrono::microseconds{ 0 });
+        const auto bucket = std::min(static_cast<size_t>(sample / BucketWidth), BucketCount);
+        ++m_buckets[bucket];
+        ++m_sampleCount;
+        m_maxSample = std::max(m_maxSample, sample);
+    }
+
+    void LoopTimeHistogram::reset()
+    {
+        m_buckets.fill(0u);
+        m_sampleCount = 0u;
+        m_maxSample = std::chrono::microseconds{ 0 };
+    }
+
+    size_t LoopTimeHistogram::getSampleCount() const
+    {
+        return m_sampleCount;
+    }
+
+    std::chrono::microseconds LoopTimeHistogram::getPercentile(uint32_t percentile) const
+    {
+        assert(percentile > 0u && percentile <= 100u);
+        if (m_sampleCount == 0u)
+            return std::chrono::microseconds{ 0 };
+
+        // nearest rank
+        const size_t rank = std::max<size_t>((m_sampleCount * percentile + 99u) / 100u, 1u);
+        size_t samplesUpToBucket = 0u;
+        for (size_t bucket = 0u; bucket < BucketCount; ++bucket)
+        {
+            samplesUpToBucket += m_buckets[bucket];
+            if (samplesUpToBucket >= rank)
+                return std::min(BucketWidth * static_cast<int64_t>(bucket + 1u), m_maxSample);
+        }
+
+        return m_maxSample;
+    }
+}
@@ -0,0 +1,38 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Histogram of render loop times with fixed buckets, adding a sample is constant time and allocation free,
+    // percentiles are evaluated only when reported. Percentile is reported as upper bound of its bucket
+    // (limited by maximum sample), samples longer than last bucket are reported as maximum sample.
+    class LoopTimeHistogram
+    {
+    public:
+        static constexpr std::chrono::microseconds BucketWidth{ 250 };
+        static constexpr size_t BucketCount = 400u; // up to 100ms
+
+        void addSample(std::chrono::microseconds loopTime);
+        void reset();
+
+        [[nodiscard]] size_t getSampleCount() const;
+        // percentile in range (0, 100]
+        [[nodiscard]] std::chrono::microseconds getPercentile(uint32_t percentile) const;
+
+    private:
+        std::array<uint32_t, BucketCount + 1u> m_buckets{}; // last bucket collects all samples out of range
+        size_t m_sampleCount = 0u;
+        std::chrono::microseconds m_maxSample{ 0 };
+    };
+}
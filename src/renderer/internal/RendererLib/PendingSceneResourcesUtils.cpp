@@ -130,6 +130,8 @@ namespace ramses::internal
             {
                 const GeometryDataBuffer& dataBuffer = scene.getDataBuffer(DataBufferHandle(handle));
                 resourceManager.uploadDataBuffer(DataBufferHandle(handle), dataBuffer.bufferType, dataBuffer.dataType, static_cast<uint32_t>(dataBuffer.data.size()), scene.getSceneId());
+                // new device buffer has no content yet, also after re-creation when scene was remapped
+                scene.markDataBufferFullyDirty(DataBufferHandle(handle));
             }
                 break;
             case ESceneResourceAction_DestroyDataBuffer:
@@ -138,11 +140,18 @@ namespace ramses::internal
             case ESceneResourceAction_UpdateDataBuffer:
             {
                 const GeometryDataBuffer& dataBuffer = scene.getDataBuffer(DataBufferHandle(handle));
-                resourceManager.updateDataBuffer(DataBufferHandle(handle), static_cast<uint32_t>(dataBuffer.data.size()), dataBuffer.data.data(), scene.getSceneId());
+                const auto& update = scene.getDataBufferUpdate(DataBufferHandle(handle));
+                if (update.sizeInBytes != 0u)
+                {
+                    assert(update.offsetInBytes + update.sizeInBytes <= dataBuffer.data.size());
+                    resourceManager.updateDataBuffer(DataBufferHandle(handle), update.offsetInBytes, update.sizeInBytes, dataBuffer.data.data() + update.offsetInBytes, scene.getSceneId());
+                }
+                scene.popDataBufferUpdate(DataBufferHandle(handle));
             }
                 break;
             case ESceneResourceAction_CreateTextureBuffer:
                 SceneResourceUploader::UploadTextureBuffer(scene, TextureBufferHandle(handle), resourceManager);
+                scene.markTextureBufferFullyDirty(TextureBufferHandle(handle));
                 break;
             case ESceneResourceAction_UpdateTextureBuffer:
                 SceneResourceUploader::UpdateTextureBuffer(scene, TextureBufferHandle(handle), resourceManager);
@@ -0,0 +1,41 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/PlatformBase/GpuResource.h"
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
+
+namespace ramses::internal
+{
+    class BufferGPUResource : public GPUResource
+    {
+    public:
+        // buffer may be sub-allocated from a larger device buffer (gpuAddress), then its data start at given offset
+        BufferGPUResource(uint32_t gpuAddress, uint32_t totalSizeInBytes, EDeviceBufferUsage usage, uint32_t offsetInBytes = 0u)
+            : GPUResource(gpuAddress, totalSizeInBytes)
+            , m_usage(usage)
+            , m_offsetInBytes(offsetInBytes)
+        {
+        }
+
+        [[nodiscard]] EDeviceBufferUsage getUsage() const
+        {
+            return m_usage;
+        }
+
+        [[nodiscard]] uint32_t getOffsetInBytes() const
+        {
+            return m_offsetInBytes;
+        }
+
+    private:
+        const EDeviceBufferUsage m_usage;
+        const uint32_t m_offsetInBytes;
+    };
+}
@@ -18,6 +18,16 @@ namespace ramses::internal
         return m_resources;
     }
 
+    bool Context_Base::swapBuffersWithDamage([[maybe_unused]] const Quad& damagedRegion)
+    {
+        return swapBuffers();
+    }
+
+    uint32_t Context_Base::getBufferAge() const
+    {
+        return 0u;
+    }
+
     void Context_Base::ParseContextExtensionsHelper(const char* extensionNativeString, HashSet<std::string>& extensionsOut)
     {
         extensionsOut = StringUtils::TokenizeToSet(StringUtils::TrimView(extensionNativeString));
@@ -25,6 +25,8 @@ namespace ramses::internal
         Context_Base();
 
         DeviceResourceMapper& getResources() override;
+        bool swapBuffersWithDamage(const Quad& damagedRegion) override;
+        [[nodiscard]] uint32_t getBufferAge() const override;
 
         // TODO Violin this is not beautiful, but is needed because windows parses
         // extensions non-conform to EGL standard (read up about WGL on the net,
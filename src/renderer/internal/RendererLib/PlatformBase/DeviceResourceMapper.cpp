@@ -13,20 +13,14 @@ namespace ramses::internal
 {
     DeviceResourceMapper::DeviceResourceMapper()
     {
-        // preallocate memory for GPU resources to avoid resizing of growing pool for small sizes
-        m_resources.preallocateSize(128u);
+        // preallocate memory for GPU resources to avoid resizing of growing table for small sizes
+        m_resources.reserve(128u);
     }
 
     DeviceResourceMapper::~DeviceResourceMapper()
     {
-        for (uint32_t i = 0; i < m_resources.getTotalCount(); ++i)
-        {
-            const DeviceResourceHandle handle(i);
-            if (containsResource(handle))
-            {
-                deleteResource(handle);
-            }
-        }
+        for (const auto& entry : m_resources)
+            delete entry.resource;
     }
 
     uint32_t DeviceResourceMapper::getTotalGpuMemoryUsageInKB() const
@@ -36,20 +30,43 @@ namespace ramses::internal
 
     DeviceResourceHandle DeviceResourceMapper::registerResource(std::unique_ptr<const GPUResource> resource)
     {
-        const DeviceResourceHandle handle = m_resources.allocate();
+        DeviceResourceHandle handle;
+        if (m_freeHandles.empty())
+        {
+            handle = DeviceResourceHandle(static_cast<MemoryHandle>(m_resources.size()));
+            m_resources.emplace_back();
+        }
+        else
+        {
+            handle = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+
         m_memoryUsage += resource->getTotalSizeInBytes();
-        *m_resources.getMemory(handle) = resource.release();
+        auto& entry = m_resources[handle.asMemoryHandle()];
+        assert(entry.resource == nullptr);
+        entry.gpuAddress = resource->getGPUAddress();
+        entry.resource = resource.release();
 
         return handle;
     }
 
     void DeviceResourceMapper::deleteResource(DeviceResourceHandle resourceHandle)
     {
-        const GPUResource* const resource = *m_resources.getMemory(resourceHandle);
+        // released resource is destroyed right away
+        releaseResource(resourceHandle);
+    }
+
+    std::unique_ptr<const GPUResource> DeviceResourceMapper::releaseResource(DeviceResourceHandle resourceHandle)
+    {
+        assert(containsResource(resourceHandle));
+        auto& entry = m_resources[resourceHandle.asMemoryHandle()];
+        std::unique_ptr<const GPUResource> resource{ entry.resource };
         assert(m_memoryUsage >= resource->getTotalSizeInBytes());
         m_memoryUsage -= resource->getTotalSizeInBytes();
+        entry = {};
+        m_freeHandles.push_back(resourceHandle);
 
-        delete resource;
-        m_resources.release(resourceHandle);
+        return resource;
     }
 }
@@ -10,10 +10,10 @@
 
 #include "internal/RendererLib/Types.h"
 #include "internal/RendererLib/PlatformBase/GpuResource.h"
-#include "internal/Core/Utils/MemoryPool.h"
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 #include <cassert>
 
 namespace ramses::internal
@@ -26,8 +26,11 @@ namespace ramses::internal
 
         DeviceResourceHandle    registerResource(std::unique_ptr<const GPUResource> resource);
         void                    deleteResource  (DeviceResourceHandle resourceHandle);
+        std::unique_ptr<const GPUResource> releaseResource(DeviceResourceHandle resourceHandle);
         [[nodiscard]] bool                    containsResource(DeviceResourceHandle resourceHandle) const;
         [[nodiscard]] const GPUResource&      getResource     (DeviceResourceHandle resourceHandle) const;
+        // same as getResource(handle).getGPUAddress() but without accessing the resource object
+        [[nodiscard]] uint32_t                getGPUAddress   (DeviceResourceHandle resourceHandle) const;
 
         template <typename TYPE>
         const TYPE&             getResourceAs   (DeviceResourceHandle resourceHandle) const;
@@ -35,7 +38,15 @@ namespace ramses::internal
         [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const;
 
     private:
-        MemoryPool<const GPUResource*, DeviceResourceHandle> m_resources;
+        // handle is direct index to dense table, GL name is cached next to the resource so that binds
+        // in draw loop touch only this table
+        struct Entry
+        {
+            const GPUResource* resource = nullptr;
+            uint32_t gpuAddress = 0u;
+        };
+        std::vector<Entry> m_resources;
+        std::vector<DeviceResourceHandle> m_freeHandles;
         uint32_t m_memoryUsage = 0u;
     };
 
@@ -47,12 +58,18 @@ namespace ramses::internal
 
     inline bool DeviceResourceMapper::containsResource(DeviceResourceHandle resourceHandle) const
     {
-        return m_resources.isAllocated(resourceHandle);
+        return resourceHandle.asMemoryHandle() < m_resources.size() && m_resources[resourceHandle.asMemoryHandle()].resource != nullptr;
     }
 
     inline const GPUResource& DeviceResourceMapper::getResource(DeviceResourceHandle resourceHandle) const
     {
         assert(containsResource(resourceHandle) && "resource handle is not mapped to a GPU resource!");
-        return **m_resources.getMemory(resourceHandle);
+        return *m_resources[resourceHandle.asMemoryHandle()].resource;
+    }
+
+    inline uint32_t DeviceResourceMapper::getGPUAddress(DeviceResourceHandle resourceHandle) const
+    {
+        assert(containsResource(resourceHandle) && "resource handle is not mapped to a GPU resource!");
+        return m_resources[resourceHandle.asMemoryHandle()].gpuAddress;
     }
 }
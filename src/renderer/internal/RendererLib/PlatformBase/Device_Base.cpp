@@ -12,6 +12,22 @@
 
 namespace ramses::internal
 {
+    namespace
+    {
+        // pixels read synchronously, used by devices without support for asynchronous read back
+        class ReadPixelsResource : public GPUResource
+        {
+        public:
+            explicit ReadPixelsResource(std::vector<uint8_t> data)
+                : GPUResource(0u, 0u)
+                , m_data(std::move(data))
+            {
+            }
+
+            std::vector<uint8_t> m_data;
+        };
+    }
+
     Device_Base::Device_Base(IContext& context)
         : m_context(context)
         , m_resourceMapper(context.getResources())
@@ -38,6 +54,39 @@ namespace ramses::internal
         return m_resourceMapper.getResource(deviceHandle).getGPUAddress();
     }
 
+    std::vector<std::unique_ptr<const GPUResource>> Device_Base::uploadShaders(const std::vector<const EffectResource*>& effects)
+    {
+        std::vector<std::unique_ptr<const GPUResource>> shaderResources;
+        shaderResources.reserve(effects.size());
+        for (const auto effect : effects)
+            shaderResources.push_back(uploadShader(*effect));
+        return shaderResources;
+    }
+
+    DeviceResourceHandle Device_Base::allocateStreamingUniformBuffer(uint32_t totalSizeInBytes)
+    {
+        return allocateUniformBuffer(totalSizeInBytes);
+    }
+
+    DeviceResourceHandle Device_Base::startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> data(width * height * 4u); // Assuming RGBA8 non multisampled
+        readPixels(data.data(), x, y, width, height);
+        return m_resourceMapper.registerResource(std::make_unique<ReadPixelsResource>(std::move(data)));
+    }
+
+    bool Device_Base::finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut)
+    {
+        const auto resource = m_resourceMapper.releaseResource(handle);
+        dataOut = static_cast<const ReadPixelsResource&>(*resource).m_data;
+        return true;
+    }
+
+    void Device_Base::deleteReadPixels(DeviceResourceHandle handle)
+    {
+        m_resourceMapper.deleteResource(handle);
+    }
+
     uint32_t Device_Base::getAndResetDrawCallCount()
     {
         const auto dc = m_drawCalls;
@@ -26,6 +26,11 @@ namespace ramses::internal
         void     drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         void     drawTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) override;
         [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle deviceHandle) const override;
+        std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& effects) override;
+        DeviceResourceHandle allocateStreamingUniformBuffer(uint32_t totalSizeInBytes) override;
+        DeviceResourceHandle startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+        bool finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut) override;
+        void deleteReadPixels(DeviceResourceHandle handle) override;
 
         [[nodiscard]] const RendererLimits& getRendererLimits() const;
 
@@ -84,6 +84,19 @@ namespace ramses::internal
     {
     }
 
+    void EmbeddedCompositor_Dummy::stopEventThread()
+    {
+    }
+
+    void EmbeddedCompositor_Dummy::setClientRequestsListener([[maybe_unused]] std::function<void()> listener)
+    {
+    }
+
+    bool EmbeddedCompositor_Dummy::isEventThreadRunning() const
+    {
+        return false;
+    }
+
     bool EmbeddedCompositor_Dummy::isRealCompositor() const
     {
         return false;
@@ -33,6 +33,9 @@ namespace ramses::internal
         [[nodiscard]] std::string getTitleOfWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const override;
         void logInfos(RendererLogContext& context) const override;
         void logPeriodicInfo(StringOutputStream& sos) const override;
+        void stopEventThread() override;
+        void setClientRequestsListener(std::function<void()> listener) override;
+        [[nodiscard]] bool isEventThreadRunning() const override;
 
         [[nodiscard]] bool isRealCompositor() const override;
     };
@@ -8,15 +8,15 @@
 
 #pragma once
 
-#include "internal/RendererLib/PlatformBase/GpuResource.h"
+#include "internal/RendererLib/PlatformBase/BufferGPUResource.h"
 
 namespace ramses::internal
 {
-    class IndexBufferGPUResource : public GPUResource
+    class IndexBufferGPUResource : public BufferGPUResource
     {
     public:
-        IndexBufferGPUResource(uint32_t gpuAddress, uint32_t totalSizeInBytes, uint32_t elementSizeInBytes)
-            : GPUResource(gpuAddress, totalSizeInBytes)
+        IndexBufferGPUResource(uint32_t gpuAddress, uint32_t totalSizeInBytes, uint32_t elementSizeInBytes, EDeviceBufferUsage usage, uint32_t offsetInBytes = 0u)
+            : BufferGPUResource(gpuAddress, totalSizeInBytes, usage, offsetInBytes)
             , m_elementSizeInBytes(elementSizeInBytes)
         {
         }
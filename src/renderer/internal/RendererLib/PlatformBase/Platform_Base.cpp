@@ -117,6 +117,9 @@ namespace ramses::internal
     void Platform_Base::destroyRenderBackend()
     {
         assert(m_renderBackend);
+        // client requests dispatched in parallel could still access texture uploading adapter
+        if (m_embeddedCompositor)
+            m_embeddedCompositor->stopEventThread();
         LOG_DEBUG(CONTEXT_RENDERER, "Platform_Base::destroyRenderBackend: destroy texture uploadadapter");
         m_textureUploadingAdapter.reset();
         LOG_DEBUG(CONTEXT_RENDERER, "Platform_Base::destroyRenderBackend: destroy embeddedcompositor");
@@ -7,12 +7,18 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/PlatformBase/RenderTargetGpuResource.h"
-
+#include <utility>
 
 namespace ramses::internal
 {
-    RenderTargetGPUResource::RenderTargetGPUResource(uint32_t gpuAddress)
+    RenderTargetGPUResource::RenderTargetGPUResource(uint32_t gpuAddress, DeviceHandleVector renderBuffers)
         : GPUResource(gpuAddress, 0u)
+        , m_renderBuffers(std::move(renderBuffers))
+    {
+    }
+
+    const DeviceHandleVector& RenderTargetGPUResource::getRenderBuffers() const
     {
+        return m_renderBuffers;
     }
 }
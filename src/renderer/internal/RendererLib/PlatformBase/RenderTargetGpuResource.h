@@ -9,12 +9,18 @@
 #pragma once
 
 #include "internal/RendererLib/PlatformBase/GpuResource.h"
+#include "internal/RendererLib/Types.h"
 
 namespace ramses::internal
 {
     class RenderTargetGPUResource : public GPUResource
     {
     public:
-        explicit RenderTargetGPUResource(uint32_t gpuAddress);
+        explicit RenderTargetGPUResource(uint32_t gpuAddress, DeviceHandleVector renderBuffers = {});
+
+        [[nodiscard]] const DeviceHandleVector& getRenderBuffers() const;
+
+    private:
+        DeviceHandleVector m_renderBuffers;
     };
 }
@@ -0,0 +1,116 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/StaticBufferPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    uint32_t StaticBufferPool::GetOrder(uint32_t size)
+    {
+        uint32_t order = 0u;
+        while (GetBlockSize(order) < size)
+            ++order;
+        return order;
+    }
+
+    uint32_t StaticBufferPool::GetBlockSize(uint32_t order)
+    {
+        return MinBlockSizeInBytes << order;
+    }
+
+    bool StaticBufferPool::CanAllocate(uint32_t size)
+    {
+        return size > 0u && size <= MaxAllocationSizeInBytes;
+    }
+
+    StaticBufferPool::Allocation StaticBufferPool::allocate(uint32_t size)
+    {
+        assert(CanAllocate(size));
+        const uint32_t order = GetOrder(size);
+
+        // take the first chunk which can fit the block, keeps allocations packed in the first chunks
+        // so that chunks at the end are more likely to become empty and released
+        uint32_t chunkIdx = 0u;
+        uint32_t freeOrder = order;
+        for (; chunkIdx < m_chunks.size(); ++chunkIdx)
+        {
+            const auto& freeBlocks = m_chunks[chunkIdx].freeBlocks;
+            freeOrder = order;
+            while (freeOrder < OrderCount && freeBlocks[freeOrder].empty())
+                ++freeOrder;
+            if (freeOrder < OrderCount)
+                break;
+        }
+
+        if (chunkIdx == m_chunks.size())
+        {
+            m_chunks.emplace_back();
+            m_chunks.back().freeBlocks[OrderCount - 1u].insert(0u);
+            freeOrder = OrderCount - 1u;
+        }
+
+        auto& chunk = m_chunks[chunkIdx];
+        auto& freeBlocks = chunk.freeBlocks[freeOrder];
+        const uint32_t offset = *freeBlocks.begin();
+        freeBlocks.erase(freeBlocks.begin());
+
+        // split larger block, upper halves become free blocks of lower orders
+        while (freeOrder > order)
+        {
+            --freeOrder;
+            chunk.freeBlocks[freeOrder].insert(offset + GetBlockSize(freeOrder));
+        }
+
+        ++chunk.allocationCount;
+        ++m_allocationCount;
+        return { chunkIdx, offset, order };
+    }
+
+    bool StaticBufferPool::release(const Allocation& allocation)
+    {
+        assert(allocation.chunk < m_chunks.size());
+        auto& chunk = m_chunks[allocation.chunk];
+        assert(chunk.allocationCount > 0u);
+
+        uint32_t offset = allocation.offset;
+        uint32_t order = allocation.order;
+        while (order < OrderCount - 1u)
+        {
+            const uint32_t buddyOffset = offset ^ GetBlockSize(order);
+            if (chunk.freeBlocks[order].erase(buddyOffset) == 0u)
+                break;
+
+            offset = std::min(offset, buddyOffset);
+            ++order;
+        }
+        chunk.freeBlocks[order].insert(offset);
+
+        --chunk.allocationCount;
+        --m_allocationCount;
+        return chunk.allocationCount == 0u;
+    }
+
+    uint32_t StaticBufferPool::getChunkCount() const
+    {
+        return static_cast<uint32_t>(m_chunks.size());
+    }
+
+    uint32_t StaticBufferPool::getAllocationCount() const
+    {
+        return m_allocationCount;
+    }
+
+    uint32_t StaticBufferPool::getAllocationCount(uint32_t chunk) const
+    {
+        assert(chunk < m_chunks.size());
+        return m_chunks[chunk].allocationCount;
+    }
+}
@@ -0,0 +1,68 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <set>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Sub-allocates small static buffers (vertex or index data uploaded once) from few large chunks (device buffers of ChunkSizeInBytes),
+    // so that scenes with many small meshes do not need a device buffer for every single array resource and many vertex arrays
+    // refer to the same device buffer at different offsets.
+    // Chunks are split using buddy scheme, blocks have power of two sizes between MinBlockSizeInBytes and ChunkSizeInBytes.
+    // A released block is merged with its buddy right away if that is free too, so that fragmentation is resolved when buffers
+    // are released (i.e. when resources are unloaded) and a chunk without allocations is a single free block again.
+    class StaticBufferPool
+    {
+    public:
+        static constexpr uint32_t ChunkSizeInBytes = 4u * 1024u * 1024u;
+        static constexpr uint32_t MinBlockSizeInBytes = 256u;
+        // larger buffers would waste too much of a chunk, they are better off in their own device buffer
+        static constexpr uint32_t MaxAllocationSizeInBytes = 256u * 1024u;
+
+        struct Allocation
+        {
+            uint32_t chunk = 0u;
+            uint32_t offset = 0u;
+            // block size is MinBlockSizeInBytes << order
+            uint32_t order = 0u;
+        };
+
+        [[nodiscard]] static bool CanAllocate(uint32_t size);
+        // if there is no chunk with free space new one is added, i.e. returned chunk index equals previous chunk count
+        Allocation allocate(uint32_t size);
+        // returns true if chunk of the allocation has no allocations left, its device buffer can be released
+        // (and must be created again when an allocation from this chunk is returned later)
+        bool release(const Allocation& allocation);
+
+        [[nodiscard]] uint32_t getChunkCount() const;
+        [[nodiscard]] uint32_t getAllocationCount() const;
+        [[nodiscard]] uint32_t getAllocationCount(uint32_t chunk) const;
+
+    private:
+        static constexpr uint32_t OrderCount = 15u;
+        static_assert((MinBlockSizeInBytes << (OrderCount - 1u)) == ChunkSizeInBytes, "chunk must be exactly the largest block");
+
+        struct Chunk
+        {
+            // offsets of free blocks per order, ordered to allocate lowest offset first and to find free buddy quickly
+            std::array<std::set<uint32_t>, OrderCount> freeBlocks;
+            uint32_t allocationCount = 0u;
+        };
+
+        [[nodiscard]] static uint32_t GetOrder(uint32_t size);
+        [[nodiscard]] static uint32_t GetBlockSize(uint32_t order);
+
+        std::vector<Chunk> m_chunks;
+        uint32_t m_allocationCount = 0u;
+    };
+}
@@ -20,4 +20,8 @@ namespace ramses::internal
     {
         m_device.uploadStreamTexture2D(textureHandle, width, height, format, data, swizzle);
     }
+
+    void TextureUploadingAdapter_Base::handleTextureDeleted([[maybe_unused]] DeviceResourceHandle textureHandle)
+    {
+    }
 }
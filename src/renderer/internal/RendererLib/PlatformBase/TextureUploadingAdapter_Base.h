@@ -20,6 +20,7 @@ namespace ramses::internal
     public:
         explicit TextureUploadingAdapter_Base(IDevice& device);
         void uploadTexture2D(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data,  const TextureSwizzleArray& swizzle) override;
+        void handleTextureDeleted(DeviceResourceHandle textureHandle) override;
 
     protected:
         IDevice& m_device;
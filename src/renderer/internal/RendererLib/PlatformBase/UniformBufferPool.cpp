@@ -0,0 +1,127 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace ramses::internal
+{
+    UniformBufferPool::UniformBufferPool(uint32_t offsetAlignment)
+        : m_offsetAlignment(std::max(offsetAlignment, 1u))
+    {
+    }
+
+    uint32_t UniformBufferPool::getBlockSize(uint32_t size) const
+    {
+        const uint32_t copyStride = ((size + m_offsetAlignment - 1u) / m_offsetAlignment) * m_offsetAlignment;
+        return copyStride * BufferingCount;
+    }
+
+    bool UniformBufferPool::canAllocate(uint32_t size) const
+    {
+        return size > 0u && getBlockSize(size) <= ChunkSizeInBytes;
+    }
+
+    UniformBufferPool::Allocation UniformBufferPool::allocate(uint32_t size)
+    {
+        assert(canAllocate(size));
+        const uint32_t blockSize = getBlockSize(size);
+
+        auto chunkIt = std::find_if(m_chunks.begin(), m_chunks.end(), [blockSize](const Chunk& chunk) {
+            return chunk.blockSize == blockSize && (!chunk.freeBlocks.empty() || (chunk.usedBlocks + 1u) * blockSize <= ChunkSizeInBytes);
+        });
+        if (chunkIt == m_chunks.end())
+        {
+            m_chunks.push_back({ blockSize, 0u, {} });
+            chunkIt = std::prev(m_chunks.end());
+        }
+
+        uint32_t block = 0u;
+        if (chunkIt->freeBlocks.empty())
+        {
+            block = chunkIt->usedBlocks++;
+        }
+        else
+        {
+            block = chunkIt->freeBlocks.back();
+            chunkIt->freeBlocks.pop_back();
+        }
+
+        ++m_allocationCount;
+        Allocation allocation;
+        allocation.chunk = static_cast<uint32_t>(std::distance(m_chunks.begin(), chunkIt));
+        allocation.offset = block * blockSize;
+        allocation.copyStride = blockSize / BufferingCount;
+        return allocation;
+    }
+
+    void UniformBufferPool::release(const Allocation& allocation)
+    {
+        assert(allocation.chunk < m_chunks.size());
+        assert(m_allocationCount > 0u);
+        --m_allocationCount;
+        m_releasedAllocations.push_back({ allocation, m_updateBatch });
+    }
+
+    void UniformBufferPool::freeBlock(const Allocation& allocation)
+    {
+        auto& chunk = m_chunks[allocation.chunk];
+        chunk.freeBlocks.push_back(allocation.offset / chunk.blockSize);
+    }
+
+    void UniformBufferPool::beginUpdateBatch()
+    {
+        ++m_updateBatch;
+
+        // allocation released in batch N could be read by commands issued before batch N + 1 started,
+        // those are guaranteed to be finished when batch N + BufferingCount begins
+        const auto it = std::remove_if(m_releasedAllocations.begin(), m_releasedAllocations.end(), [this](const ReleasedAllocation& released) {
+            if (released.releaseBatch + BufferingCount > m_updateBatch)
+                return false;
+            freeBlock(released.allocation);
+            return true;
+        });
+        m_releasedAllocations.erase(it, m_releasedAllocations.end());
+    }
+
+    uint64_t UniformBufferPool::getUpdateBatch() const
+    {
+        return m_updateBatch;
+    }
+
+    uint32_t UniformBufferPool::selectCopyForUpdate(Allocation& allocation) const
+    {
+        // active copy was not read yet if it was already updated in this batch (no draw call since), it can be overwritten
+        if (allocation.lastUpdateBatch != m_updateBatch)
+        {
+            if (allocation.lastUpdateBatch != 0u)
+                allocation.activeCopy = (allocation.activeCopy + 1u) % BufferingCount;
+            allocation.lastUpdateBatch = m_updateBatch;
+        }
+
+        return GetActiveCopyOffset(allocation);
+    }
+
+    uint32_t UniformBufferPool::GetActiveCopyOffset(const Allocation& allocation)
+    {
+        return allocation.offset + allocation.activeCopy * allocation.copyStride;
+    }
+
+    uint32_t UniformBufferPool::getChunkCount() const
+    {
+        return static_cast<uint32_t>(m_chunks.size());
+    }
+
+    uint32_t UniformBufferPool::getAllocationCount() const
+    {
+        return m_allocationCount;
+    }
+}
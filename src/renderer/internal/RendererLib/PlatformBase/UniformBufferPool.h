@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Sub-allocates small uniform buffers from few large chunks (device buffers of ChunkSizeInBytes), so that device can keep
+    // the chunks persistently mapped, write updates directly to mapped memory and bind the uniform buffers by offset.
+    // Every allocation holds BufferingCount copies of its data, an update is written to the next copy while GPU can still read
+    // copies written before. Updates are grouped into batches (device starts a new batch at the first update after any draw call),
+    // device must make sure GPU finished commands issued before batch (N - BufferingCount + 1) started when starting batch N,
+    // then no copy is overwritten while GPU can still read it.
+    class UniformBufferPool
+    {
+    public:
+        static constexpr uint32_t BufferingCount = 3u;
+        static constexpr uint32_t ChunkSizeInBytes = 64u * 1024u;
+
+        struct Allocation
+        {
+            uint32_t chunk = 0u;
+            // offset of first copy within chunk
+            uint32_t offset = 0u;
+            // size of a copy including padding to offset alignment
+            uint32_t copyStride = 0u;
+            uint32_t activeCopy = 0u;
+            uint64_t lastUpdateBatch = 0u;
+        };
+
+        explicit UniformBufferPool(uint32_t offsetAlignment);
+
+        [[nodiscard]] bool canAllocate(uint32_t size) const;
+        // if there is no chunk with free space new one is added, i.e. returned chunk index equals previous chunk count
+        Allocation allocate(uint32_t size);
+        // allocation is reused only after GPU cannot read it anymore, i.e. BufferingCount batches later
+        void release(const Allocation& allocation);
+
+        void beginUpdateBatch();
+        [[nodiscard]] uint64_t getUpdateBatch() const;
+        // selects copy to write an update to and returns its offset within chunk, selected copy is the one to be bound
+        uint32_t selectCopyForUpdate(Allocation& allocation) const;
+        [[nodiscard]] static uint32_t GetActiveCopyOffset(const Allocation& allocation);
+
+        [[nodiscard]] uint32_t getChunkCount() const;
+        [[nodiscard]] uint32_t getAllocationCount() const;
+
+    private:
+        struct Chunk
+        {
+            uint32_t blockSize = 0u;
+            uint32_t usedBlocks = 0u;
+            std::vector<uint32_t> freeBlocks;
+        };
+
+        struct ReleasedAllocation
+        {
+            Allocation allocation;
+            uint64_t releaseBatch = 0u;
+        };
+
+        [[nodiscard]] uint32_t getBlockSize(uint32_t size) const;
+        void freeBlock(const Allocation& allocation);
+
+        const uint32_t m_offsetAlignment;
+        std::vector<Chunk> m_chunks;
+        std::vector<ReleasedAllocation> m_releasedAllocations;
+        // batch 0 is reserved for never updated allocations
+        uint64_t m_updateBatch = 1u;
+        uint32_t m_allocationCount = 0u;
+    };
+}
@@ -13,6 +13,7 @@
 namespace ramses::internal
 {
     class DeviceResourceMapper;
+    class Quad;
 
     class IContext
     {
@@ -20,6 +21,10 @@ namespace ramses::internal
         virtual ~IContext() = default;
 
         virtual bool swapBuffers() = 0;
+        // presents only given region (bottom-left origin) as changed, falls back to swapBuffers if not supported by platform
+        virtual bool swapBuffersWithDamage(const Quad& damagedRegion) = 0;
+        // number of frames since content of current back buffer was rendered, 0 if unknown (back buffer content undefined)
+        [[nodiscard]] virtual uint32_t getBufferAge() const = 0;
         virtual bool enable() = 0;
         virtual bool disable() = 0;
         virtual DeviceResourceMapper& getResources() = 0;
@@ -16,6 +16,8 @@
 #include "internal/RendererLib/PlatformBase/GpuResource.h"
 #include <memory>
 #include <array>
+#include <vector>
+#include <chrono>
 
 namespace ramses::internal
 {
@@ -24,6 +26,19 @@ namespace ramses::internal
     struct PixelRectangle;
     struct TextureSamplerStates;
 
+    struct GpuTimerQueryResult
+    {
+        uint64_t queryId = 0u;
+        std::chrono::nanoseconds elapsed{ 0 };
+    };
+
+    // hint how often content of vertex/index buffer changes, device selects upload strategy based on it
+    enum class EDeviceBufferUsage
+    {
+        Static,   // uploaded once (e.g. client array resources)
+        Dynamic,  // updated occasionally, whole buffer updates orphan previous storage
+    };
+
     class IDevice
     {
     public:
@@ -48,6 +63,10 @@ namespace ramses::internal
         virtual void drawIndexedTriangles(int32_t startOffset, int32_t elementCount, uint32_t instanceCount) = 0;
         virtual void drawTriangles       (int32_t startOffset, int32_t elementCount, uint32_t instanceCount) = 0;
         virtual void flush              () = 0;
+        // inserts fence after all commands issued so far and flushes them, fence must be waited for exactly once
+        virtual DeviceFence insertFence () = 0;
+        // makes GPU wait for fence (possibly inserted in shared context) before executing further commands, does not block caller, deletes the fence
+        virtual void waitFence          (DeviceFence fence) = 0;
 
         //states
         virtual void colorMask           (bool r, bool g, bool b, bool a) = 0;
@@ -71,13 +90,19 @@ namespace ramses::internal
         virtual void                    uploadUniformBufferData     (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) = 0;
         virtual void                    activateUniformBuffer       (DeviceResourceHandle handle, DataFieldHandle field) = 0;
         virtual void                    deleteUniformBuffer         (DeviceResourceHandle handle) = 0;
+        // uniform buffer with data updated (nearly) every frame, device can sub-allocate it from persistently mapped memory,
+        // it is updated, activated and deleted using same methods as any other uniform buffer
+        virtual DeviceResourceHandle    allocateStreamingUniformBuffer(uint32_t totalSizeInBytes) = 0;
 
-        virtual DeviceResourceHandle    allocateVertexBuffer        (uint32_t totalSizeInBytes) = 0;
+        virtual DeviceResourceHandle    allocateVertexBuffer        (uint32_t totalSizeInBytes, EDeviceBufferUsage usage) = 0;
         virtual void                    uploadVertexBufferData      (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) = 0;
+        // updates only given range of already uploaded buffer, rest of its content is kept
+        virtual void                    uploadVertexBufferSubData   (DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) = 0;
         virtual void                    deleteVertexBuffer          (DeviceResourceHandle handle) = 0;
 
-        virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, uint32_t sizeInBytes) = 0;
+        virtual DeviceResourceHandle    allocateIndexBuffer         (EDataType dataType, uint32_t sizeInBytes, EDeviceBufferUsage usage) = 0;
         virtual void                    uploadIndexBufferData       (DeviceResourceHandle handle, const std::byte* data, uint32_t dataSize) = 0;
+        virtual void                    uploadIndexBufferSubData    (DeviceResourceHandle handle, uint32_t offsetInBytes, const std::byte* data, uint32_t dataSize) = 0;
         virtual void                    deleteIndexBuffer           (DeviceResourceHandle handle) = 0;
 
         virtual DeviceResourceHandle    allocateVertexArray         (const VertexArrayInfo& vertexArrayInfo) = 0;
@@ -85,6 +110,9 @@ namespace ramses::internal
         virtual void                    deleteVertexArray           (DeviceResourceHandle handle) = 0;
 
         virtual std::unique_ptr<const GPUResource> uploadShader     (const EffectResource& effect) = 0;
+        // uploads all given effects, device can compile them concurrently if supported,
+        // returned resources are in same order as given effects, failed uploads are nullptr
+        virtual std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& effects) = 0;
         virtual DeviceResourceHandle    registerShader              (std::unique_ptr<const GPUResource> shaderResource) = 0;
         virtual DeviceResourceHandle    uploadBinaryShader          (const EffectResource& effect, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat) = 0;
         virtual bool                    getBinaryShader             (DeviceResourceHandle handle, std::vector<std::byte>& binaryShader, BinaryShaderFormatID& binaryShaderFormat) = 0;
@@ -102,6 +130,9 @@ namespace ramses::internal
         virtual void                    uploadTextureData           (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride) = 0;
         virtual DeviceResourceHandle    uploadStreamTexture2D       (DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle) = 0;
         virtual void                    deleteTexture               (DeviceResourceHandle handle) = 0;
+        // removes texture from device without deleting it, so that it can be registered in device of a shared context
+        virtual std::unique_ptr<const GPUResource> extractTexture   (DeviceResourceHandle handle) = 0;
+        virtual DeviceResourceHandle    registerTexture             (std::unique_ptr<const GPUResource> textureResource) = 0;
         virtual void                    activateTexture             (DeviceResourceHandle handle, DataFieldHandle field) = 0;
         [[nodiscard]] virtual uint32_t  getTextureAddress           (DeviceResourceHandle handle) const = 0;
 
@@ -112,7 +143,14 @@ namespace ramses::internal
         virtual DeviceResourceHandle    uploadDmaRenderBuffer       (uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, DmaBufferUsageFlags usageFlags, DmaBufferModifiers modifiers) = 0;
         virtual int                     getDmaRenderBufferFD        (DeviceResourceHandle handle) = 0;
         virtual uint32_t                getDmaRenderBufferStride    (DeviceResourceHandle handle) = 0;
+        // returns sync file FD owned by caller which signals when all rendering submitted so far is finished, -1 if not supported
+        virtual int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) = 0;
         virtual void                    destroyDmaRenderBuffer      (DeviceResourceHandle handle) = 0;
+        // replaces content of external texture with DMA buffer frame whose FD stays owned by caller,
+        // on success releaseFenceFD is set to sync file FD owned by caller which signals when sampling of previously imported frame is finished (-1 if none or not supported)
+        virtual bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) = 0;
+        // stops using imported DMA buffer frame, returns sync file FD as above
+        virtual int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) = 0;
 
         virtual void                    activateTextureSamplerObject(const TextureSamplerStates& samplerStates, DataFieldHandle field) = 0;
 
@@ -121,6 +159,7 @@ namespace ramses::internal
         virtual void                    activateRenderTarget        (DeviceResourceHandle handle) = 0;
         virtual void                    deleteRenderTarget          (DeviceResourceHandle handle) = 0;
         virtual void                    discardDepthStencil         () = 0;
+        virtual void                    discardColorBuffers         () = 0;
 
         virtual void                    pairRenderTargetsForDoubleBuffering (const std::array<DeviceResourceHandle, 2>& renderTargets, const std::array<DeviceResourceHandle, 2>& colorBuffers) = 0;
         virtual void                    unpairRenderTargets               (DeviceResourceHandle renderTarget) = 0;
@@ -131,9 +170,27 @@ namespace ramses::internal
 
         // read back data, statistics, info
         virtual void readPixels(uint8_t* buffer, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        // Non-blocking read back: start copies pixels of active render target into device owned memory without waiting for GPU,
+        // finish returns false while the data are not available yet, otherwise provides the data (empty on failure) and releases the read.
+        // Delete releases a read which is not needed anymore.
+        virtual DeviceResourceHandle startReadPixels(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        virtual bool finishReadPixels(DeviceResourceHandle handle, std::vector<uint8_t>& dataOut) = 0;
+        virtual void deleteReadPixels(DeviceResourceHandle handle) = 0;
 
         [[nodiscard]] virtual uint32_t getTotalGpuMemoryUsageInKB() const = 0;
         virtual uint32_t getAndResetDrawCallCount() = 0;
+        // device skips redundant state changes (e.g. binding same program, vertex array or texture again),
+        // must be called when state was changed directly (outside of device) in its context
+        virtual void invalidateStateCache() = 0;
+
+        // GPU timer queries measure GPU time spent on commands issued between begin and end, queries cannot be nested.
+        // Results are collected asynchronously in later frames, begin fails if timer queries are not supported
+        // or if all queries for given query ID are still waiting for result (device never stalls to free a query).
+        virtual bool beginGpuTimerQuery(uint64_t queryId) = 0;
+        virtual void endGpuTimerQuery() = 0;
+        virtual void collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& results) = 0;
+        // deletes queries of given query ID, results still pending are discarded
+        virtual void deleteGpuTimerQueries(uint64_t queryId) = 0;
 
         virtual void    validateDeviceStatusHealthy() const = 0;
         [[nodiscard]] virtual bool    isDeviceStatusHealthy() const = 0;
@@ -20,6 +20,9 @@ namespace ramses::internal
         virtual DeviceResourceHandle    createDmaRenderBuffer       (uint32_t width, uint32_t height, DmaBufferFourccFormat fourccFormat, DmaBufferUsageFlags usageFlags, DmaBufferModifiers modifiers) = 0;
         virtual int                     getDmaRenderBufferFD        (DeviceResourceHandle handle) = 0;
         virtual uint32_t                getDmaRenderBufferStride    (DeviceResourceHandle handle) = 0;
+        virtual int                     createDmaRenderBufferSyncFence(DeviceResourceHandle handle) = 0;
         virtual void                    destroyDmaRenderBuffer      (DeviceResourceHandle handle) = 0;
+        virtual bool                    importDmaBufferToExternalTexture(DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD) = 0;
+        virtual int                     releaseDmaBufferOfExternalTexture(DeviceResourceHandle handle) = 0;
     };
 }
@@ -21,6 +21,7 @@ namespace ramses::internal
     class RendererCachedScene;
     class ProjectionParams;
     class FrameTimer;
+    class Quad;
 
     class IDisplayController
     {
@@ -31,6 +32,7 @@ namespace ramses::internal
         [[nodiscard]] virtual bool                    canRenderNewFrame() const = 0;
         virtual void                    enableContext() = 0;
         virtual void                    swapBuffers() = 0;
+        virtual void                    swapBuffersWithDamage(const Quad& damagedRegion) = 0;
         virtual SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer) = 0;
         virtual void                    clearBuffer(DeviceResourceHandle buffer, ClearFlags clearFlags, const glm::vec4& clearColor) = 0;
 
@@ -41,6 +43,10 @@ namespace ramses::internal
         [[nodiscard]] virtual uint32_t                  getDisplayHeight() const = 0;
 
         virtual void readPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) = 0;
+        // non-blocking variant of readPixels, see IDevice::startReadPixels
+        virtual DeviceResourceHandle startReadPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+        virtual bool finishReadPixels(DeviceResourceHandle readPixelsHandle, std::vector<uint8_t>& dataOut) = 0;
+        virtual void deleteReadPixels(DeviceResourceHandle readPixelsHandle) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
     };
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/Types.h"
+#include <functional>
 
 namespace ramses::internal
 {
@@ -37,6 +38,11 @@ namespace ramses::internal
         [[nodiscard]] virtual std::string getTitleOfWaylandIviSurface(WaylandIviSurfaceId waylandSurfaceId) const = 0;
         virtual void logInfos(RendererLogContext& context) const = 0;
         virtual void logPeriodicInfo(StringOutputStream& sos) const = 0;
+        // stops dispatching of client requests outside of render thread (if any), called before texture uploading adapter is destroyed
+        virtual void stopEventThread() = 0;
+        // listener is called from event thread (if any) whenever it dispatched requests of clients, e.g. to wake up idle render thread
+        virtual void setClientRequestsListener(std::function<void()> listener) = 0;
+        [[nodiscard]] virtual bool isEventThreadRunning() const = 0;
 
         [[nodiscard]] virtual bool isRealCompositor() const = 0; //TODO Mohamed: remove this when dummy EC is removed
     };
@@ -21,5 +21,7 @@ namespace ramses::internal
     public:
         virtual ~ITextureUploadingAdapter() = default;
         virtual void uploadTexture2D(DeviceResourceHandle textureHandle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data,  const TextureSwizzleArray& swizzle) = 0;
+        // texture was deleted from device, its handle can be reused for another texture
+        virtual void handleTextureDeleted(DeviceResourceHandle textureHandle) = 0;
     };
 }
@@ -12,6 +12,7 @@
 #include "internal/RendererLib/Enums/EKeyEvent.h"
 #include "internal/RendererLib/Enums/EKeyCode.h"
 #include "internal/RendererLib/Enums/EKeyModifier.h"
+#include "internal/Components/FlushTimeInformation.h"
 
 namespace ramses::internal
 {
@@ -27,5 +28,8 @@ namespace ramses::internal
         virtual void onClose() = 0;
         virtual void onResize(uint32_t width, uint32_t height) = 0;
         virtual void onWindowMove(int32_t posX, int32_t posY) = 0;
+        // frames are indexed by order of swap starting with 0, presentation feedback might not be provided for every frame
+        // (e.g. frame discarded by compositor), content of presented frame contains also all frames swapped before it
+        virtual void onFramePresented(uint64_t frameIndex, FlushTime::Clock::time_point presentationTime) = 0;
     };
 }
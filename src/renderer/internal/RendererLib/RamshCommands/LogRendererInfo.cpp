@@ -23,7 +23,7 @@ namespace ramses::internal
         getArgument<1>().setDefaultValue(false);
         getArgument<2>().setDefaultValue(NodeHandle::Invalid().asMemoryHandle());
 
-        getArgument<0>().setDescription("topic (display|scene|res|queue|links|ec|events|all)");
+        getArgument<0>().setDescription("topic (display|scene|res|gpumem|queue|links|ec|events|all)");
         getArgument<1>().setDescription("verbose mode");
         getArgument<2>().setDescription("node Id filter");
 
@@ -49,6 +49,8 @@ namespace ramses::internal
             return ERendererLogTopic::SceneStates;
         if (topicName == "res")
             return ERendererLogTopic::Resources;
+        if (topicName == "gpumem")
+            return ERendererLogTopic::GpuMemory;
         if (topicName == "queue")
             return ERendererLogTopic::RenderQueue;
         if (topicName == "links")
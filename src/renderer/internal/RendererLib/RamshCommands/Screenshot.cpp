@@ -15,7 +15,7 @@ namespace ramses::internal
     Screenshot::Screenshot(RendererCommandBuffer& rendererCommandBuffer)
         : m_rendererCommandBuffer(rendererCommandBuffer)
     {
-        description = "saves a screenshot. Options:[-filename FILENAME -displayId DISPLAYID -sendViaDLT -ob BUFFERID]";
+        description = "saves a screenshot. Options:[-filename FILENAME -displayId DISPLAYID -sendViaDLT -ob BUFFERID -async]";
         registerKeyword("p");
         registerKeyword("screenshot");
     }
@@ -36,6 +36,7 @@ namespace ramses::internal
         auto                display = DisplayHandle(0);
         OffscreenBufferHandle offscreenBuffer;
         bool                sendViaDLT = false;
+        bool                async = false;
 
         for (const auto& arg : input)
         {
@@ -51,6 +52,10 @@ namespace ramses::internal
             {
                 sendViaDLT = true;
             }
+            else if (arg == "-async")
+            {
+                async = true;
+            }
             else if (arg == "-ob")
             {
                 lastOption = EOption_OffscreenBuffer;
@@ -82,7 +87,7 @@ namespace ramses::internal
             }
         }
 
-        m_rendererCommandBuffer.enqueueCommand(RendererCommand::ReadPixels{ display, offscreenBuffer, 0u, 0u, 0u, 0u, true, sendViaDLT, std::move(filename) });
+        m_rendererCommandBuffer.enqueueCommand(RendererCommand::ReadPixels{ display, offscreenBuffer, 0u, 0u, 0u, 0u, true, sendViaDLT, std::move(filename), async });
 
         return true;
     }
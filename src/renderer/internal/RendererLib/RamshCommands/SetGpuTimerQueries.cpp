@@ -0,0 +1,28 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RamshCommands/SetGpuTimerQueries.h"
+#include "internal/RendererLib/RendererCommandBuffer.h"
+
+
+using namespace ramses::internal;
+
+SetGpuTimerQueries::SetGpuTimerQueries(RendererCommandBuffer& rendererCommandBuffer)
+: m_rendererCommandBuffer(rendererCommandBuffer)
+{
+    description = "measure GPU time of scenes using timer queries, results are shown in render statistics";
+    registerKeyword("gpuTimers");
+    registerKeyword("setGpuTimerQueries");
+    getArgument<0>().setDescription("enable GPU timer queries (0: off, 1: enable)");
+}
+
+bool SetGpuTimerQueries::execute(uint32_t& enableQueries) const
+{
+    m_rendererCommandBuffer.enqueueCommand(ramses::internal::RendererCommand::SetGpuTimerQueries{ enableQueries > 0u });
+    return true;
+}
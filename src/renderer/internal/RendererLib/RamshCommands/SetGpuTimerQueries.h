@@ -0,0 +1,26 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Ramsh/RamshCommandArguments.h"
+
+namespace ramses::internal
+{
+    class RendererCommandBuffer;
+
+    class SetGpuTimerQueries : public RamshCommandArgs<uint32_t>
+    {
+    public:
+        explicit SetGpuTimerQueries(RendererCommandBuffer& rendererCommandBuffer);
+        bool execute(uint32_t& enableQueries) const override;
+
+    private:
+        RendererCommandBuffer& m_rendererCommandBuffer;
+    };
+}
@@ -0,0 +1,28 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RamshCommands/SetPartialRedraw.h"
+#include "internal/RendererLib/RendererCommandBuffer.h"
+
+
+using namespace ramses::internal;
+
+SetPartialRedraw::SetPartialRedraw(RendererCommandBuffer& rendererCommandBuffer)
+: m_rendererCommandBuffer(rendererCommandBuffer)
+{
+    description = "redraw and swap only damaged region of framebuffer given by viewports of modified scenes (requires swap with damage and buffer age support of platform to be effective)";
+    registerKeyword("partialRedraw");
+    registerKeyword("setPartialRedraw");
+    getArgument<0>().setDescription("enable partial redraw (0: off, 1: enable)");
+}
+
+bool SetPartialRedraw::execute(uint32_t& enablePartialRedraw) const
+{
+    m_rendererCommandBuffer.enqueueCommand(ramses::internal::RendererCommand::SetPartialRedraw{ enablePartialRedraw > 0u });
+    return true;
+}
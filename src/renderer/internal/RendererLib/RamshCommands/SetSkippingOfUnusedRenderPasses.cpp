@@ -0,0 +1,28 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/RamshCommands/SetSkippingOfUnusedRenderPasses.h"
+#include "internal/RendererLib/RendererCommandBuffer.h"
+
+
+using namespace ramses::internal;
+
+SetSkippingOfUnusedRenderPasses::SetSkippingOfUnusedRenderPasses(RendererCommandBuffer& rendererCommandBuffer)
+: m_rendererCommandBuffer(rendererCommandBuffer)
+{
+    description = "skip render passes and blit passes of scenes whose output is not consumed by any other pass, skipped passes are shown in render statistics";
+    registerKeyword("skipUnusedPasses");
+    registerKeyword("setSkippingOfUnusedRenderPasses");
+    getArgument<0>().setDescription("enable skipping (0: off, 1: enable)");
+}
+
+bool SetSkippingOfUnusedRenderPasses::execute(uint32_t& enableSkipping) const
+{
+    m_rendererCommandBuffer.enqueueCommand(ramses::internal::RendererCommand::SetSkippingOfUnusedRenderPasses{ enableSkipping > 0u });
+    return true;
+}
@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/SceneGraph/SceneAPI/DataFieldInfo.h"
+#include "internal/SceneGraph/SceneAPI/EFixedSemantics.h"
+
+#include <vector>
+#include <limits>
+
+namespace ramses::internal
+{
+    class IDevice;
+    class DataInstance;
+    struct RecordedUniform;
+
+    // sets value of recorded uniform on device, it is specialized per data type when recording so that replay does not switch on data type
+    using RecordedUniformSetter = void (*)(IDevice& device, const DataInstance& dataInstance, const RecordedUniform& uniform);
+
+    // Device agnostic command stream of a render pass, recorded by RenderExecutor when executing the pass.
+    // It stores everything which RenderExecutor resolves from scene structure (data layouts, data references, semantics)
+    // so that it does not need to be resolved again when the pass is re-rendered without changes in scene structure.
+    // Data values and device resource handles are not recorded, these are read from scene when replaying the stream,
+    // therefore value changes (e.g. uniform updates, uploaded resources) do not invalidate the recording.
+    struct RecordedUniform
+    {
+        DataFieldInfo      field;
+        DataInstanceHandle dataInstance;
+        DataFieldHandle    dataInstanceField;
+        DataFieldHandle    uniformInputField;
+        // set only for plain value uniforms, others (textures, uniform buffers) resolve device handles when replayed
+        RecordedUniformSetter setter = nullptr;
+        // offset of value within data instance, data layout of an instance never changes
+        uint32_t           dataOffset = 0u;
+    };
+
+    struct RecordedSemantic
+    {
+        EFixedSemantics    semantics = EFixedSemantics::Invalid;
+        DataInstanceHandle dataInstance;
+        DataFieldHandle    dataField;
+    };
+
+    struct RecordedRenderable
+    {
+        static constexpr uint32_t NotRecorded = std::numeric_limits<uint32_t>::max();
+
+        [[nodiscard]] bool isRecorded() const
+        {
+            return uniformsBegin != NotRecorded;
+        }
+
+        RenderableHandle renderable;
+        // ranges into RecordedRenderPass::uniforms and RecordedRenderPass::semantics
+        uint32_t uniformsBegin = NotRecorded;
+        uint32_t uniformsEnd = NotRecorded;
+        uint32_t semanticsBegin = NotRecorded;
+        uint32_t semanticsEnd = NotRecorded;
+    };
+
+    struct RecordedRenderPass
+    {
+        void clear()
+        {
+            renderables.clear();
+            uniforms.clear();
+            semantics.clear();
+            recordingGeneration = InvalidGeneration;
+        }
+
+        static constexpr uint64_t InvalidGeneration = std::numeric_limits<uint64_t>::max();
+
+        std::vector<RecordedRenderable> renderables;
+        std::vector<RecordedUniform>    uniforms;
+        std::vector<RecordedSemantic>   semantics;
+        // recording is valid only if it matches current recording generation of the scene,
+        // generation is 64 bit so that it never wraps and an outdated recording cannot become valid again
+        uint64_t recordingGeneration = InvalidGeneration;
+    };
+}
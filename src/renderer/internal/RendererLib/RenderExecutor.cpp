@@ -14,6 +14,63 @@
 
 namespace ramses::internal
 {
+    static RenderState::ScissorRegion ToScissorRegion(const Quad& quad)
+    {
+        return { static_cast<int16_t>(quad.x), static_cast<int16_t>(quad.y), static_cast<uint16_t>(quad.width), static_cast<uint16_t>(quad.height) };
+    }
+
+    static Viewport ScaleViewport(const Viewport& viewport, float scale)
+    {
+        return { static_cast<int32_t>(static_cast<float>(viewport.posX) * scale), static_cast<int32_t>(static_cast<float>(viewport.posY) * scale),
+            static_cast<uint32_t>(static_cast<float>(viewport.width) * scale), static_cast<uint32_t>(static_cast<float>(viewport.height) * scale) };
+    }
+
+    static RenderState::ScissorRegion ScaleScissorRegion(const RenderState::ScissorRegion& region, float scale)
+    {
+        return { static_cast<int16_t>(static_cast<float>(region.x) * scale), static_cast<int16_t>(static_cast<float>(region.y) * scale),
+            static_cast<uint16_t>(static_cast<float>(region.width) * scale), static_cast<uint16_t>(static_cast<float>(region.height) * scale) };
+    }
+
+    template <typename T>
+    static void SetRecordedConstant(IDevice& device, const DataInstance& dataInstance, const RecordedUniform& uniform)
+    {
+        device.setConstant(uniform.uniformInputField, uniform.field.elementCount, dataInstance.getTypedDataPointer<T>(uniform.dataOffset));
+    }
+
+    static RecordedUniformSetter GetRecordedUniformSetter(EDataType dataType)
+    {
+        switch (dataType)
+        {
+        case EDataType::Float:
+            return &SetRecordedConstant<float>;
+        case EDataType::Vector2F:
+            return &SetRecordedConstant<glm::vec2>;
+        case EDataType::Vector3F:
+            return &SetRecordedConstant<glm::vec3>;
+        case EDataType::Vector4F:
+            return &SetRecordedConstant<glm::vec4>;
+        case EDataType::Matrix22F:
+            return &SetRecordedConstant<glm::mat2>;
+        case EDataType::Matrix33F:
+            return &SetRecordedConstant<glm::mat3>;
+        case EDataType::Matrix44F:
+            return &SetRecordedConstant<glm::mat4>;
+        case EDataType::Bool:
+            return &SetRecordedConstant<bool>;
+        case EDataType::Int32:
+            return &SetRecordedConstant<int32_t>;
+        case EDataType::Vector2I:
+            return &SetRecordedConstant<glm::ivec2>;
+        case EDataType::Vector3I:
+            return &SetRecordedConstant<glm::ivec3>;
+        case EDataType::Vector4I:
+            return &SetRecordedConstant<glm::ivec4>;
+        default:
+            // device handles of textures and uniform buffers are resolved when replaying
+            return nullptr;
+        }
+    }
+
     uint32_t RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
     RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
@@ -25,10 +82,21 @@ namespace ramses::internal
     {
         setGlobalInternalStates(scene);
 
+        // finite shader animations are re-evaluated with every complete rendering, interrupted rendering keeps state of its first part
+        if (m_state.m_currentRenderIterator == SceneRenderExecutionIterator{})
+            scene.setActiveFiniteShaderAnimation(false);
+
         const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
         for ( ; m_state.m_currentRenderIterator.getRenderPassIdx() < orderedPasses.size(); m_state.m_currentRenderIterator.incrementRenderPassIdx())
         {
-            const auto& passInfo = orderedPasses[m_state.m_currentRenderIterator.getRenderPassIdx()];
+            const auto passIdx = m_state.m_currentRenderIterator.getRenderPassIdx();
+            if (m_state.getRenderingContext().skipPassesWithUnusedOutput && !scene.isRenderingPassOutputUsed(passIdx))
+            {
+                scene.renderingPassSkipped();
+                continue;
+            }
+
+            const auto& passInfo = orderedPasses[passIdx];
             switch (passInfo.getType())
             {
             case ERenderingPassType::RenderPass:
@@ -39,6 +107,8 @@ namespace ramses::internal
                 }
                 if (canDiscardDepthBuffer())
                     m_state.getDevice().discardDepthStencil();
+                if (scene.canDiscardRenderingPassColorBuffers(passIdx))
+                    m_state.getDevice().discardColorBuffers();
                 break;
             case ERenderingPassType::BlitPass:
                 executeBlitPass(scene, passInfo.getBlitPassHandle());
@@ -88,7 +158,10 @@ namespace ramses::internal
                 if (clearFlags.isSet(EClearFlag::Depth))
                     m_state.getDevice().depthWrite(EDepthWrite::Enabled);
 
-                m_state.getDevice().scissorTest(EScissorTest::Disabled, {});
+                if (!renderTarget.isValid() && renderContext.limitToRedrawRegion)
+                    m_state.getDevice().scissorTest(EScissorTest::Enabled, ToScissorRegion(renderContext.redrawRegion));
+                else
+                    m_state.getDevice().scissorTest(EScissorTest::Disabled, {});
                 m_state.getDevice().clear(clearFlags);
 
                 //reset cached render states that were updated on device before clearing
@@ -99,6 +172,24 @@ namespace ramses::internal
         }
 
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
+
+        // depth of interrupted pass was laid out already before interruption
+        m_state.depthPrePassStage = EDepthPrePassStage::None;
+        if (renderPass.hasDepthPrePass)
+        {
+            if (renderPassIsExecutedFromBeginning)
+                executeDepthPrePass(scene, orderedRenderables);
+            m_state.depthPrePassStage = EDepthPrePassStage::Shading;
+        }
+
+        if (scene.isRecordedRenderPassValid(pass))
+            return replayRenderPass(scene.getRecordedRenderPass(pass));
+
+        // record pass only if executed from beginning, interrupted recording is discarded
+        RecordedRenderPass& recording = scene.getRecordedRenderPass(pass);
+        recording.clear();
+        RecordedRenderPass* recordingPtr = (renderPassIsExecutedFromBeginning ? &recording : nullptr);
+
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
@@ -106,18 +197,116 @@ namespace ramses::internal
             {
                 assert(!scene.isRenderableVertexArrayDirty(renderableHandle));
                 setRenderableInternalStates(renderableHandle);
-                setSemanticDataFields();
-                executeRenderable();
+                if (m_state.isRenderableOutsideOfFrustum())
+                {
+                    scene.renderableCulled();
+                    // culling depends on camera and transformation which do not invalidate recording,
+                    // renderable will be executed without recording when replaying
+                    if (recordingPtr != nullptr)
+                        recordingPtr->renderables.push_back({ renderableHandle });
+                }
+                else
+                {
+                    setSemanticDataFields(recordingPtr);
+                    executeRenderStates();
+                    executeEffectAndInputs(recordingPtr);
+                    executeDrawCall();
+                }
+            }
+            else if (recordingPtr != nullptr)
+            {
+                // cannot be recorded without resources, will be executed without recording when replaying
+                recordingPtr->renderables.push_back({ renderableHandle });
             }
             m_state.m_currentRenderIterator.incrementRenderableIdx();
 
             if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            {
+                recording.clear();
                 return false;
+            }
+        }
+
+        if (recordingPtr != nullptr)
+        {
+            assert(recording.renderables.size() == orderedRenderables.size());
+            scene.markRecordedRenderPassValid(pass);
         }
 
         return true;
     }
 
+    bool RenderExecutor::replayRenderPass(const RecordedRenderPass& recording) const
+    {
+        const RendererCachedScene& scene = m_state.getScene();
+        while (m_state.m_currentRenderIterator.getRenderableIdx() < recording.renderables.size())
+        {
+            const RecordedRenderable& recordedRenderable = recording.renderables[m_state.m_currentRenderIterator.getRenderableIdx()];
+            if (!scene.renderableResourcesDirty(recordedRenderable.renderable))
+            {
+                assert(!scene.isRenderableVertexArrayDirty(recordedRenderable.renderable));
+                setRenderableInternalStates(recordedRenderable.renderable);
+                if (m_state.isRenderableOutsideOfFrustum())
+                {
+                    scene.renderableCulled();
+                }
+                else if (recordedRenderable.isRecorded())
+                {
+                    for (uint32_t i = recordedRenderable.semanticsBegin; i < recordedRenderable.semanticsEnd; ++i)
+                    {
+                        const RecordedSemantic& semantic = recording.semantics[i];
+                        resolveAndSetSemanticDataField(semantic.semantics, semantic.dataInstance, semantic.dataField);
+                    }
+                    executeRenderStates();
+                    activateShaderAndVertexArray();
+                    for (uint32_t i = recordedRenderable.uniformsBegin; i < recordedRenderable.uniformsEnd; ++i)
+                    {
+                        const RecordedUniform& uniform = recording.uniforms[i];
+                        if (uniform.setter != nullptr)
+                            uniform.setter(m_state.getDevice(), *scene.getDataInstances().getMemory(uniform.dataInstance), uniform);
+                        else
+                            executeConstant(uniform.field, uniform.dataInstance, uniform.dataInstanceField, uniform.uniformInputField);
+                    }
+                    executeDrawCall();
+                }
+                else
+                {
+                    setSemanticDataFields();
+                    executeRenderable();
+                }
+            }
+            m_state.m_currentRenderIterator.incrementRenderableIdx();
+
+            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+                return false;
+        }
+
+        return true;
+    }
+
+    void RenderExecutor::executeDepthPrePass(const RendererCachedScene& scene, const RenderableVector& orderedRenderables) const
+    {
+        // pre-pass is not interruptible, it is repeated only if pass is restarted from beginning
+        m_state.depthPrePassStage = EDepthPrePassStage::DepthOnly;
+        for (const auto renderableHandle : orderedRenderables)
+        {
+            if (scene.renderableResourcesDirty(renderableHandle))
+                continue;
+
+            const Renderable& renderable = scene.getRenderable(renderableHandle);
+            if (!RendererCachedScene::IsDepthOrderIndependent(scene.getRenderState(renderable.renderState)))
+                continue;
+
+            setRenderableInternalStates(renderableHandle);
+            // culled renderables are counted in shading pass
+            if (m_state.isRenderableOutsideOfFrustum())
+                continue;
+
+            setSemanticDataFields();
+            executeRenderable();
+        }
+    }
+
     void RenderExecutor::executeRenderable() const
     {
         executeRenderStates();
@@ -140,9 +329,14 @@ namespace ramses::internal
     {
         m_state.setCamera(camera);
 
-        if (m_state.viewportState.hasChanged())
+        // with reduced resolution same camera needs different viewport for scene's render targets and display buffer
+        const float resolutionScale = m_state.getRenderingContext().resolutionScale;
+        const bool scaleDisplayBufferViewport = (resolutionScale != 1.f);
+        if (m_state.viewportState.hasChanged() || (scaleDisplayBufferViewport && m_state.renderTargetState.hasChanged()))
         {
-            const Viewport& viewport = m_state.viewportState.getState();
+            Viewport viewport = m_state.viewportState.getState();
+            if (scaleDisplayBufferViewport && !m_state.renderTargetState.getState().isValid())
+                viewport = ScaleViewport(viewport, resolutionScale);
             m_state.getDevice().setViewport(viewport.posX, viewport.posY, viewport.width, viewport.height);
         }
     }
@@ -210,18 +404,26 @@ namespace ramses::internal
         device.drawMode(m_state.drawMode);
     }
 
-    void RenderExecutor::executeEffectAndInputs() const
+    void RenderExecutor::activateShaderAndVertexArray() const
     {
-        const RendererCachedScene& renderScene = m_state.getScene();
         IDevice& device = m_state.getDevice();
+        if (m_state.shaderDeviceHandle.hasChanged())
+            device.activateShader(m_state.shaderDeviceHandle.getState());
+
+        device.activateVertexArray(m_state.vertexArrayDeviceHandle);
+    }
+
+    void RenderExecutor::executeEffectAndInputs(RecordedRenderPass* recording) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
         const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
         const DataInstanceHandle uniformData = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
         assert(uniformData.isValid());
 
-        if (m_state.shaderDeviceHandle.hasChanged())
-            device.activateShader(m_state.shaderDeviceHandle.getState());
+        activateShaderAndVertexArray();
 
-        device.activateVertexArray(m_state.vertexArrayDeviceHandle);
+        if (recording != nullptr)
+            recording->renderables.back().uniformsBegin = static_cast<uint32_t>(recording->uniforms.size());
 
         const DataLayoutHandle dataLayoutHandle = renderScene.getLayoutOfDataInstance(uniformData);
         const DataLayout& dataLayout = renderScene.getDataLayout(dataLayoutHandle);
@@ -235,12 +437,22 @@ namespace ramses::internal
                 const DataLayoutHandle dataRefLayout = renderScene.getLayoutOfDataInstance(dataRef);
                 const EDataType dataTypeRef = renderScene.getDataLayout(dataRefLayout).getField(DataFieldHandle(0u)).dataType;
                 executeConstant(DataFieldInfo{ dataTypeRef, 1u }, dataRef, DataFieldHandle(0u), constantField);
+                if (recording != nullptr)
+                {
+                    const uint32_t dataOffset = renderScene.getDataLayout(dataRefLayout).getFieldOffset(DataFieldHandle(0u));
+                    recording->uniforms.push_back({ DataFieldInfo{ dataTypeRef, 1u }, dataRef, DataFieldHandle(0u), constantField, GetRecordedUniformSetter(dataTypeRef), dataOffset });
+                }
             }
             else
             {
                 executeConstant(field, uniformData, constantField, constantField);
+                if (recording != nullptr)
+                    recording->uniforms.push_back({ field, uniformData, constantField, constantField, GetRecordedUniformSetter(field.dataType), dataLayout.getFieldOffset(constantField) });
             }
         }
+
+        if (recording != nullptr)
+            recording->renderables.back().uniformsEnd = static_cast<uint32_t>(recording->uniforms.size());
     }
 
     void RenderExecutor::executeConstant(const DataFieldInfo& field, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const
@@ -404,16 +616,14 @@ namespace ramses::internal
     void RenderExecutor::executeDrawCall() const
     {
         IDevice& device = m_state.getDevice();
-        const auto& renderScene = m_state.getScene();
-        const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
 
         if (m_state.vertexArrayUsesIndices)
         {
-            device.drawIndexedTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawIndexedTriangles(static_cast<int32_t>(m_state.getStartIndexToDraw()), static_cast<int32_t>(m_state.getIndexCountToDraw()), m_state.getInstanceCountToDraw());
         }
         else
         {
-            device.drawTriangles(static_cast<int32_t>(renderable.startIndex), static_cast<int32_t>(renderable.indexCount), renderable.instanceCount);
+            device.drawTriangles(static_cast<int32_t>(m_state.getStartIndexToDraw()), static_cast<int32_t>(m_state.getIndexCountToDraw()), m_state.getInstanceCountToDraw());
         }
     }
 
@@ -440,6 +650,21 @@ namespace ramses::internal
         ScissorState scissorState;
         scissorState.m_scissorTest = renderState.scissorTest;
         scissorState.m_scissorRegion = renderState.scissorRegion;
+        const RenderingContext& renderContext = m_state.getRenderingContext();
+        if (renderContext.resolutionScale != 1.f && renderState.scissorTest == EScissorTest::Enabled && !m_state.renderTargetState.getState().isValid())
+            scissorState.m_scissorRegion = ScaleScissorRegion(renderState.scissorRegion, renderContext.resolutionScale);
+        if (renderContext.limitToRedrawRegion && !m_state.renderTargetState.getState().isValid())
+        {
+            // renderable's own scissor region can only further limit the redraw region
+            Quad scissorQuad = renderContext.redrawRegion;
+            if (renderState.scissorTest == EScissorTest::Enabled)
+            {
+                const auto& region = renderState.scissorRegion;
+                scissorQuad = scissorQuad.getIntersection({ region.x, region.y, int32_t(region.width), int32_t(region.height) });
+            }
+            scissorState.m_scissorTest = EScissorTest::Enabled;
+            scissorState.m_scissorRegion = ToScissorRegion(scissorQuad);
+        }
         m_state.scissorState.setState(scissorState);
 
         m_state.depthFuncState.setState(renderState.depthFunc);
@@ -471,6 +696,25 @@ namespace ramses::internal
         m_state.cullModeState.setState(renderState.cullMode);
 
         m_state.drawMode = renderState.drawMode;
+
+        if (m_state.depthPrePassStage != EDepthPrePassStage::None && RendererCachedScene::IsDepthOrderIndependent(renderState))
+        {
+            if (m_state.depthPrePassStage == EDepthPrePassStage::DepthOnly)
+            {
+                m_state.colorWriteMaskState.setState(0u);
+                // stencil is still tested, but written only once by shading pass
+                stencilState.m_stencilOpDepthFail = EStencilOp::Keep;
+                stencilState.m_stencilOpDepthPass = EStencilOp::Keep;
+                stencilState.m_stencilOpFail = EStencilOp::Keep;
+                m_state.stencilState.setState(stencilState);
+            }
+            else
+            {
+                // depth buffer already contains nearest fragments, shade only those
+                m_state.depthFuncState.setState(EDepthFunc::Equal);
+                m_state.depthWriteState.setState(EDepthWrite::Disabled);
+            }
+        }
     }
 
     void RenderExecutor::activateRenderTarget(RenderTargetHandle renderTarget) const
@@ -566,8 +810,23 @@ namespace ramses::internal
             break;
         case EFixedSemantics::TimeMs:
         {
-            scene.setDataSingleInteger(dataInstHandle, dataFieldHandle, EffectUniformTime::GetMilliseconds(scene.getEffectTimeSync()));
-            scene.setActiveShaderAnimation(true); // override skub mode - will be reset on the next flush
+            const int32_t timeMs = EffectUniformTime::GetMilliseconds(scene.getEffectTimeSync());
+            const int32_t animationEnd = scene.getDataInstanceUniformTimeAnimationEnd(dataInstHandle);
+            if (animationEnd == DataInstance::UnboundedUniformTimeAnimationEnd)
+            {
+                scene.setDataSingleInteger(dataInstHandle, dataFieldHandle, timeMs);
+                scene.setActiveShaderAnimation(true); // override skub mode - will be reset on the next flush
+            }
+            else if (timeMs < animationEnd)
+            {
+                scene.setDataSingleInteger(dataInstHandle, dataFieldHandle, timeMs);
+                scene.setActiveFiniteShaderAnimation(true); // override skub mode - will be reset on next rendering of scene
+            }
+            else
+            {
+                // animation finished, last rendering shows its end state and skub can take over
+                scene.setDataSingleInteger(dataInstHandle, dataFieldHandle, animationEnd);
+            }
             break;
         }
         default:
@@ -576,7 +835,7 @@ namespace ramses::internal
         }
     }
 
-    void RenderExecutor::setSemanticDataFields() const
+    void RenderExecutor::setSemanticDataFields(RecordedRenderPass* recording) const
     {
         const auto& scene = m_state.getScene();
         const RenderableHandle renderable = m_state.getRenderable();
@@ -584,6 +843,13 @@ namespace ramses::internal
         const DataLayoutHandle dataLayoutHandle = scene.getLayoutOfDataInstance(dataInstance);
         const DataLayout& dataLayout = scene.getDataLayout(dataLayoutHandle);
 
+        if (recording != nullptr)
+        {
+            RecordedRenderable recordedRenderable{ renderable };
+            recordedRenderable.semanticsBegin = static_cast<uint32_t>(recording->semantics.size());
+            recording->renderables.push_back(recordedRenderable);
+        }
+
         const uint32_t fieldCount = dataLayout.getFieldCount();
         for (DataFieldHandle i(0u); i < fieldCount; ++i)
         {
@@ -591,8 +857,13 @@ namespace ramses::internal
             if (semantics != EFixedSemantics::Invalid)
             {
                 resolveAndSetSemanticDataField(semantics, dataInstance, i);
+                if (recording != nullptr)
+                    recording->semantics.push_back({ semantics, dataInstance, i });
             }
         }
+
+        if (recording != nullptr)
+            recording->renderables.back().semanticsEnd = static_cast<uint32_t>(recording->semantics.size());
     }
 
     void RenderExecutor::executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const
@@ -19,6 +19,7 @@ namespace ramses::internal
     class FrameTimer;
     class IScene;
     struct DataFieldInfo;
+    struct RecordedRenderPass;
 
     class RenderExecutor
     {
@@ -37,7 +38,8 @@ namespace ramses::internal
         void executeRenderable      () const;
         void executeRenderTarget    (RenderTargetHandle renderTarget) const;
         void executeRenderStates    () const;
-        void executeEffectAndInputs () const;
+        void executeEffectAndInputs (RecordedRenderPass* recording = nullptr) const;
+        void activateShaderAndVertexArray() const;
         void executeConstant        (const DataFieldInfo& field, DataInstanceHandle dataInstance, DataFieldHandle dataInstancefield, DataFieldHandle uniformInputField) const;
         void executeDrawCall        () const;
 
@@ -47,11 +49,13 @@ namespace ramses::internal
         void activateRenderTarget       (RenderTargetHandle renderTarget) const;
 
         void resolveAndSetSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const;
-        void setSemanticDataFields  () const;
+        void setSemanticDataFields  (RecordedRenderPass* recording = nullptr) const;
         void executeCamera(CameraHandle camera) const;
 
     private:
         [[nodiscard]] bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
+        [[nodiscard]] bool replayRenderPass(const RecordedRenderPass& recording) const;
+        void executeDepthPrePass(const RendererCachedScene& scene, const RenderableVector& orderedRenderables) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
         [[nodiscard]] bool canDiscardDepthBuffer() const;
 
@@ -9,6 +9,7 @@
 #include "internal/RendererLib/RenderExecutorInternalState.h"
 #include "internal/RendererLib/RendererCachedScene.h"
 #include "internal/RendererLib/RenderingContext.h"
+#include "internal/SceneGraph/SceneAPI/GeometryDataBuffer.h"
 
 namespace ramses::internal
 {
@@ -65,5 +66,110 @@ namespace ramses::internal
         m_modelMatrix = m_scene->getRenderableWorldMatrix(renderable);
         m_modelViewMatrix = m_viewMatrix * m_modelMatrix;
         m_modelViewProjectionMatrix = m_projectionMatrix * m_modelViewMatrix;
+        updateVisibleInstanceCount();
+        updateIndexRangeToDraw();
+    }
+
+    bool RenderExecutorInternalState::isRenderableOutsideOfFrustum() const
+    {
+        const Renderable& renderable = m_scene->getRenderable(m_renderable);
+        const glm::vec4& boundingSphere = renderable.boundingSphere;
+        if (boundingSphere.w < 0.f)
+            return false;
+
+        if (renderable.instancePositions.isValid() && m_scene->isDataBufferAllocated(renderable.instancePositions)
+            && m_scene->getDataBuffer(renderable.instancePositions).dataType == EDataType::Vector3F)
+            return m_instanceCountToDraw == 0u;
+
+        return IsSphereOutsideOfFrustum(ExtractFrustumPlanes(m_modelViewProjectionMatrix), boundingSphere);
+    }
+
+    uint32_t RenderExecutorInternalState::getInstanceCountToDraw() const
+    {
+        return m_instanceCountToDraw;
+    }
+
+    uint32_t RenderExecutorInternalState::getStartIndexToDraw() const
+    {
+        return m_startIndexToDraw;
+    }
+
+    uint32_t RenderExecutorInternalState::getIndexCountToDraw() const
+    {
+        return m_indexCountToDraw;
+    }
+
+    void RenderExecutorInternalState::updateIndexRangeToDraw()
+    {
+        const Renderable& renderable = m_scene->getRenderable(m_renderable);
+        m_startIndexToDraw = renderable.startIndex;
+        m_indexCountToDraw = renderable.indexCount;
+        if (renderable.levelsOfDetail.count == 0u)
+            return;
+
+        // level selected with last world matrix update might refer to levels which were removed meanwhile
+        const uint32_t level = m_scene->getRenderableLevelOfDetail(renderPassState.getState(), m_renderable);
+        if (level > 0u && level <= renderable.levelsOfDetail.count)
+        {
+            const RenderableLevelOfDetail& levelOfDetail = renderable.levelsOfDetail.levels[level - 1u];
+            m_startIndexToDraw = levelOfDetail.startIndex;
+            m_indexCountToDraw = levelOfDetail.indexCount;
+        }
+    }
+
+    void RenderExecutorInternalState::updateVisibleInstanceCount()
+    {
+        const Renderable& renderable = m_scene->getRenderable(m_renderable);
+        m_instanceCountToDraw = renderable.instanceCount;
+        if (renderable.boundingSphere.w < 0.f || !renderable.instancePositions.isValid() || !m_scene->isDataBufferAllocated(renderable.instancePositions))
+            return;
+
+        // handle received from client might refer to another buffer, do not interpret it as positions then
+        const GeometryDataBuffer& positionsBuffer = m_scene->getDataBuffer(renderable.instancePositions);
+        if (positionsBuffer.dataType != EDataType::Vector3F)
+            return;
+        const auto* positions = reinterpret_cast<const glm::vec3*>(positionsBuffer.data.data());
+        const uint32_t numPositions = positionsBuffer.usedSize / static_cast<uint32_t>(sizeof(glm::vec3));
+        // instances without position provided are considered visible
+        if (numPositions < renderable.instanceCount)
+            return;
+
+        const FrustumPlanes planes = ExtractFrustumPlanes(m_modelViewProjectionMatrix);
+        uint32_t visibleCount = renderable.instanceCount;
+        while (visibleCount > 0u)
+        {
+            const glm::vec4 instanceSphere{ glm::vec3(renderable.boundingSphere) + positions[visibleCount - 1u], renderable.boundingSphere.w };
+            if (!IsSphereOutsideOfFrustum(planes, instanceSphere))
+                break;
+            --visibleCount;
+        }
+        m_instanceCountToDraw = visibleCount;
+    }
+
+    RenderExecutorInternalState::FrustumPlanes RenderExecutorInternalState::ExtractFrustumPlanes(const glm::mat4& mvp)
+    {
+        // frustum planes extracted from model-view-projection matrix are in model space of the renderable,
+        // so bounding spheres in model space can be tested against them as is
+        FrustumPlanes planes;
+        const glm::vec4 rowW{ mvp[0][3], mvp[1][3], mvp[2][3], mvp[3][3] };
+        for (glm::length_t i = 0; i < 3; ++i)
+        {
+            const glm::vec4 row{ mvp[0][i], mvp[1][i], mvp[2][i], mvp[3][i] };
+            planes[2 * i] = rowW + row;
+            planes[2 * i + 1] = rowW - row;
+        }
+        return planes;
+    }
+
+    bool RenderExecutorInternalState::IsSphereOutsideOfFrustum(const FrustumPlanes& planes, const glm::vec4& sphere)
+    {
+        const glm::vec4 center{ glm::vec3(sphere), 1.f };
+        for (const glm::vec4& plane : planes)
+        {
+            if (glm::dot(plane, center) < -sphere.w * glm::length(glm::vec3(plane)))
+                return true;
+        }
+
+        return false;
     }
 }
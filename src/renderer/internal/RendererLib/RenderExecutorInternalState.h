@@ -15,6 +15,7 @@
 #include "internal/RendererLib/RenderingContext.h"
 #include "internal/RendererLib/FrameTimer.h"
 #include "internal/RendererLib/RenderExecutorInternalRenderStates.h"
+#include <array>
 #include <optional>
 
 namespace ramses::internal
@@ -60,6 +61,15 @@ namespace ramses::internal
         bool m_changed = true;
     };
 
+    // Stage of render pass with depth pre-pass, depth order independent renderables are rendered
+    // depth only in pre-pass and with depth function set to 'equal' when shading
+    enum class EDepthPrePassStage
+    {
+        None,
+        DepthOnly,
+        Shading,
+    };
+
     // RenderExecutor is _stateless_, this only keeps an internal state during execution
     // to avoid copying it around
     class RenderExecutorInternalState
@@ -87,6 +97,16 @@ namespace ramses::internal
         [[nodiscard]] RenderableHandle getRenderable() const;
 
         [[nodiscard]] bool hasExceededTimeBudgetForRendering() const;
+        // renderable set by setRenderable is outside of current camera frustum, considering its bounding sphere (if any)
+        // and if it has instance positions also all its instances
+        [[nodiscard]] bool isRenderableOutsideOfFrustum() const;
+        // number of instances of renderable set by setRenderable to draw, instances following
+        // the last one within frustum are skipped (only if renderable has instance positions)
+        [[nodiscard]] uint32_t getInstanceCountToDraw() const;
+        // index range of renderable set by setRenderable to draw, range of level of detail selected
+        // for current render pass if renderable has levels of detail, otherwise its start index and index count
+        [[nodiscard]] uint32_t getStartIndexToDraw() const;
+        [[nodiscard]] uint32_t getIndexCountToDraw() const;
 
         CachedState<DeviceResourceHandle> shaderDeviceHandle;
         DeviceResourceHandle              vertexArrayDeviceHandle;
@@ -104,6 +124,7 @@ namespace ramses::internal
         CachedState<RenderPassHandle>     renderPassState;
         CachedState<Viewport>             viewportState;
         EDrawMode                         drawMode{};
+        EDepthPrePassStage                depthPrePassStage = EDepthPrePassStage::None;
 
         SceneRenderExecutionIterator            m_currentRenderIterator;
 
@@ -112,7 +133,16 @@ namespace ramses::internal
         const RendererCachedScene*  m_scene{nullptr};
         RenderingContext&           m_renderContext;
 
+        using FrustumPlanes = std::array<glm::vec4, 6u>;
+        [[nodiscard]] static FrustumPlanes ExtractFrustumPlanes(const glm::mat4& mvp);
+        [[nodiscard]] static bool IsSphereOutsideOfFrustum(const FrustumPlanes& planes, const glm::vec4& sphere);
+        void updateVisibleInstanceCount();
+        void updateIndexRangeToDraw();
+
         RenderableHandle            m_renderable;
+        uint32_t                    m_instanceCountToDraw = 0u;
+        uint32_t                    m_startIndexToDraw = 0u;
+        uint32_t                    m_indexCountToDraw = 0u;
 
         glm::mat4                   m_projectionMatrix{1.f};
         glm::mat4                   m_viewMatrix{};
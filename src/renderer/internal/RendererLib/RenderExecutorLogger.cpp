@@ -55,6 +55,14 @@ namespace ramses::internal
         const RenderPass& rp = scene.getRenderPass(pass);
         if (rp.isRenderOnce)
             m_logContext << " - 'render once' pass" << RendererLogContext::NewLine;
+        if (rp.isStateSorted)
+            m_logContext << " - 'state sorted' pass" << RendererLogContext::NewLine;
+        if (rp.isFrontToBackSorted)
+            m_logContext << " - 'front to back sorted' pass" << RendererLogContext::NewLine;
+        if (rp.isBackToFrontSorted)
+            m_logContext << " - 'back to front sorted' pass" << RendererLogContext::NewLine;
+        if (rp.hasDepthPrePass)
+            m_logContext << " - 'depth pre-pass' pass" << RendererLogContext::NewLine;
         m_logContext.indent();
 
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
@@ -0,0 +1,43 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include "internal/SceneGraph/SceneAPI/SceneTypes.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    // Render target whose content lives only within a frame (written and consumed by passes of the same frame)
+    // and which uses device memory of host render target, whose content is consumed before this render target is written.
+    // Render buffers are pairwise identical in their properties, each render buffer uses device memory of host render buffer at same index.
+    struct RenderTargetAlias
+    {
+        RenderTargetHandle       renderTarget;
+        RenderBufferHandleVector renderBuffers;
+        RenderTargetHandle       hostRenderTarget;
+        RenderBufferHandleVector hostRenderBuffers;
+
+        bool operator==(const RenderTargetAlias& other) const
+        {
+            return renderTarget == other.renderTarget
+                && renderBuffers == other.renderBuffers
+                && hostRenderTarget == other.hostRenderTarget
+                && hostRenderBuffers == other.hostRenderBuffers;
+        }
+
+        bool operator!=(const RenderTargetAlias& other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    using RenderTargetAliases = std::vector<RenderTargetAlias>;
+}
@@ -22,6 +22,8 @@
 #include "internal/RendererLib/DisplayEventHandler.h"
 #include "internal/RendererLib/SceneExpirationMonitor.h"
 #include "internal/RendererLib/PlatformBase/Platform_Base.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
 #include "internal/Core/Utils/LogMacros.h"
 #include <algorithm>
 
@@ -40,7 +42,7 @@ namespace ramses::internal
         : m_display(display)
         , m_platform(platform)
         , m_rendererScenes(rendererScenes)
-        , m_displayEventHandler(m_display, eventCollector)
+        , m_displayEventHandler(m_display, eventCollector, rendererStatistics)
         , m_statistics(rendererStatistics)
         , m_frameTimer(frameTimer)
         , m_expirationMonitor(expirationMonitor)
@@ -67,7 +69,7 @@ namespace ramses::internal
         assert(!hasAnyBufferWithInterruptedRendering());
         m_displayBuffersSetup.unregisterDisplayBuffer(bufferDeviceHandle);
         m_statistics.untrackOffscreenBuffer(bufferDeviceHandle);
-        m_screenshots.erase(bufferDeviceHandle);
+        discardScreenshot(bufferDeviceHandle);
     }
 
     const IDisplayController& Renderer::getDisplayController() const
@@ -108,6 +110,7 @@ namespace ramses::internal
         m_displayBuffersSetup.registerDisplayBuffer(m_frameBufferDeviceHandle, { 0, 0, m_displayController->getDisplayWidth(), m_displayController->getDisplayHeight() },
             DefaultClearColor, false, displayConfig.getAntialiasingSampleCount(), false);
         setClearColor(m_frameBufferDeviceHandle, displayConfig.getClearColor());
+        m_resolutionScaling = ResolutionScalingController{ displayConfig.getOffscreenBufferScalingGpuTimeThreshold() };
 
         LOG_TRACE(CONTEXT_PROFILING, "RamsesRenderer::createDisplayContext finished creating display");
     }
@@ -120,6 +123,9 @@ namespace ramses::internal
         if (m_platform.getSystemCompositorController() != nullptr)
             systemCompositorDestroyIviSurface(m_displayController->getRenderBackend().getWindow().getWaylandIviSurfaceID());
 
+        while (!m_screenshots.empty())
+            discardScreenshot(m_screenshots.begin()->first);
+
         m_displayController.reset();
         m_platform.destroyRenderBackend();
     }
@@ -271,9 +277,21 @@ namespace ramses::internal
         renderContext.displayBufferDeviceHandle = m_frameBufferDeviceHandle;
         renderContext.viewportWidth = displayBufferInfo.viewport.width;
         renderContext.viewportHeight = displayBufferInfo.viewport.height;
+        renderContext.skipPassesWithUnusedOutput = m_skipUnusedRenderingPasses;
         renderContext.displayBufferClearPending = displayBufferInfo.clearFlags;
         renderContext.displayBufferClearColor = displayBufferInfo.clearColor;
         renderContext.displayBufferDepthDiscard = false; // discarding is not meant for default framebuffer, see Device_GL::discardDepthStencil()
+        if (m_partialRedrawEnabled)
+        {
+            const Quad fullRegion{ 0, 0, int32_t(displayBufferInfo.viewport.width), int32_t(displayBufferInfo.viewport.height) };
+            m_framebufferSwapDamage = displayBufferInfo.partiallyDamaged ? displayBufferInfo.damagedRegion : fullRegion;
+            renderContext.redrawRegion = computeFramebufferRedrawRegion(displayBufferInfo);
+            renderContext.limitToRedrawRegion = (renderContext.redrawRegion != fullRegion);
+
+            m_framebufferDamageHistory.push_front(m_framebufferSwapDamage);
+            if (m_framebufferDamageHistory.size() > MaxFramebufferDamageHistory)
+                m_framebufferDamageHistory.pop_back();
+        }
 
         // FB was marked for re-render but has no shown scenes -> clear it
         const auto& assignedScenes = displayBufferInfo.scenes;
@@ -286,18 +304,156 @@ namespace ramses::internal
             if (sceneInfo.shown)
             {
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneInfo.sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
+                renderScene(scene, renderContext, nullptr);
                 onSceneWasRendered(scene);
             }
         }
 
         processScheduledScreenshots(m_frameBufferDeviceHandle);
+        updateDirectScanoutCandidate(displayBufferInfo);
 
         m_displayBuffersSetup.setDisplayBufferToBeRerendered(m_frameBufferDeviceHandle, false);
 
         return true;
     }
 
+    Quad Renderer::computeFramebufferRedrawRegion(const DisplayBufferInfo& displayBufferInfo) const
+    {
+        const Quad fullRegion{ 0, 0, int32_t(displayBufferInfo.viewport.width), int32_t(displayBufferInfo.viewport.height) };
+        if (!displayBufferInfo.partiallyDamaged)
+            return fullRegion;
+
+        // back buffer content is N frames old, it has to be repaired by redrawing also regions damaged in the N-1 frames swapped since,
+        // age 0 means undefined content
+        const uint32_t bufferAge = m_displayController->getRenderBackend().getContext().getBufferAge();
+        if (bufferAge == 0u || bufferAge - 1u > m_framebufferDamageHistory.size())
+            return fullRegion;
+
+        Quad redrawRegion = displayBufferInfo.damagedRegion;
+        for (size_t i = 0u; i < bufferAge - 1u; ++i)
+            redrawRegion = redrawRegion.getBoundingQuad(m_framebufferDamageHistory[i]);
+
+        return redrawRegion.getIntersection(fullRegion);
+    }
+
+    void Renderer::updateDirectScanoutCandidate(const DisplayBufferInfo& displayBufferInfo)
+    {
+        StreamBufferHandle candidate;
+        const auto& assignedScenes = displayBufferInfo.scenes;
+        if (std::count_if(assignedScenes.cbegin(), assignedScenes.cend(), [](const auto& s) { return s.shown; }) == 1)
+        {
+            const auto shownScene = std::find_if(assignedScenes.cbegin(), assignedScenes.cend(), [](const auto& s) { return s.shown; });
+            candidate = GetDirectScanoutCandidate(m_rendererScenes.getScene(shownScene->sceneId), displayBufferInfo.viewport);
+        }
+
+        if (candidate != m_directScanoutCandidate)
+        {
+            if (candidate.isValid())
+                LOG_INFO(CONTEXT_RENDERER, "Renderer: framebuffer shows only stream buffer {} without blending, it is a candidate for direct scanout", candidate);
+            else
+                LOG_INFO(CONTEXT_RENDERER, "Renderer: framebuffer content is no longer a candidate for direct scanout");
+            m_directScanoutCandidate = candidate;
+        }
+
+        if (m_directScanoutCandidate.isValid())
+            m_statistics.framebufferDirectScanoutCandidate();
+    }
+
+    StreamBufferHandle Renderer::GetDirectScanoutCandidate(const RendererCachedScene& scene, const Viewport& viewport)
+    {
+        // framebuffer content must be exactly one opaque renderable sampling a stream buffer, drawn by single pass covering whole display,
+        // geometry of the renderable is not inspected - it is expected to be a quad covering the viewport
+        RenderPassHandle framebufferPass;
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            if (passInfo.getType() != ERenderingPassType::RenderPass)
+                continue;
+            const auto& renderPass = scene.getRenderPass(passInfo.getRenderPassHandle());
+            if (!renderPass.isEnabled || renderPass.renderTarget.isValid())
+                continue;
+            if (framebufferPass.isValid() || !renderPass.camera.isValid())
+                return {};
+            framebufferPass = passInfo.getRenderPassHandle();
+        }
+        if (!framebufferPass.isValid())
+            return {};
+
+        const auto& cameraData = scene.getCamera(scene.getRenderPass(framebufferPass).camera);
+        const auto& vpOffset = scene.getDataSingleVector2i(scene.getDataReference(cameraData.dataInstance, Camera::ViewportOffsetField), DataFieldHandle{ 0 });
+        const auto& vpSize = scene.getDataSingleVector2i(scene.getDataReference(cameraData.dataInstance, Camera::ViewportSizeField), DataFieldHandle{ 0 });
+        if (vpOffset.x != 0 || vpOffset.y != 0 || vpSize.x != int32_t(viewport.width) || vpSize.y != int32_t(viewport.height))
+            return {};
+
+        RenderableHandle visibleRenderable;
+        for (const auto renderable : scene.getOrderedRenderablesForPass(framebufferPass))
+        {
+            if (scene.getRenderable(renderable).visibilityMode != EVisibilityMode::Visible)
+                continue;
+            if (visibleRenderable.isValid())
+                return {};
+            visibleRenderable = renderable;
+        }
+        if (!visibleRenderable.isValid())
+            return {};
+
+        const auto& renderable = scene.getRenderable(visibleRenderable);
+        if (!renderable.renderState.isValid())
+            return {};
+        const auto& renderState = scene.getRenderState(renderable.renderState);
+        if (renderState.blendOperationColor != EBlendOperation::Disabled || renderState.blendOperationAlpha != EBlendOperation::Disabled)
+            return {};
+
+        const auto uniforms = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        const auto& layout = scene.getDataLayout(scene.getLayoutOfDataInstance(uniforms));
+        StreamBufferHandle streamBuffer;
+        for (DataFieldHandle field{ 0u }; field < layout.getFieldCount(); ++field)
+        {
+            switch (layout.getField(field).dataType)
+            {
+            case EDataType::TextureSampler2D:
+            case EDataType::TextureSampler2DMS:
+            case EDataType::TextureSampler3D:
+            case EDataType::TextureSamplerCube:
+            case EDataType::TextureSamplerExternal:
+            {
+                const auto& sampler = scene.getTextureSampler(scene.getDataTextureSamplerHandle(uniforms, field));
+                if (streamBuffer.isValid() || sampler.contentType != TextureSampler::ContentType::StreamBuffer)
+                    return {};
+                streamBuffer = StreamBufferHandle{ sampler.contentHandle };
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        return streamBuffer;
+    }
+
+    Quad Renderer::GetSceneFramebufferRegion(const RendererCachedScene& scene)
+    {
+        // scene can only modify framebuffer within viewports of its render passes rendering into framebuffer
+        Quad region;
+        for (const auto& passInfo : scene.getSortedRenderingPasses())
+        {
+            if (passInfo.getType() != ERenderingPassType::RenderPass)
+                continue;
+
+            const auto& renderPass = scene.getRenderPass(passInfo.getRenderPassHandle());
+            if (!renderPass.isEnabled || renderPass.renderTarget.isValid() || !renderPass.camera.isValid())
+                continue;
+
+            const auto& cameraData = scene.getCamera(renderPass.camera);
+            const auto vpOffsetRef = scene.getDataReference(cameraData.dataInstance, Camera::ViewportOffsetField);
+            const auto vpSizeRef = scene.getDataReference(cameraData.dataInstance, Camera::ViewportSizeField);
+            const auto& vpOffset = scene.getDataSingleVector2i(vpOffsetRef, DataFieldHandle{ 0 });
+            const auto& vpSize = scene.getDataSingleVector2i(vpSizeRef, DataFieldHandle{ 0 });
+            region = region.getBoundingQuad({ vpOffset.x, vpOffset.y, vpSize.x, vpSize.y });
+        }
+
+        return region;
+    }
+
     void Renderer::renderToOffscreenBuffers()
     {
         assert(m_canRenderFrame);
@@ -314,9 +470,21 @@ namespace ramses::internal
             renderContext.displayBufferDeviceHandle = displayBuffer;
             renderContext.viewportWidth = displayBufferInfo.viewport.width;
             renderContext.viewportHeight = displayBufferInfo.viewport.height;
+            renderContext.skipPassesWithUnusedOutput = m_skipUnusedRenderingPasses;
             renderContext.displayBufferClearPending = displayBufferInfo.clearFlags;
             renderContext.displayBufferClearColor = displayBufferInfo.clearColor;
 
+            // scalable buffer under GPU load is rendered into its scaled render target and scaled up to buffer afterwards,
+            // so that consumers of the buffer keep sampling it without knowing about the reduced resolution
+            const bool renderScaled = m_resolutionScaling.isScaling() && displayBufferInfo.scaledRenderTarget.isValid();
+            if (renderScaled)
+            {
+                renderContext.displayBufferDeviceHandle = displayBufferInfo.scaledRenderTarget;
+                renderContext.viewportWidth = ResolutionScalingController::GetScaledSize(displayBufferInfo.viewport.width);
+                renderContext.viewportHeight = ResolutionScalingController::GetScaledSize(displayBufferInfo.viewport.height);
+                renderContext.resolutionScale = ResolutionScalingController::Scale;
+            }
+
             m_tempScenesToRender.clear();
             for (const auto& assignedScene : displayBufferInfo.scenes)
             {
@@ -336,14 +504,27 @@ namespace ramses::internal
                     renderContext.displayBufferDepthDiscard = true;
 
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
-                m_displayController->renderScene(scene, renderContext, nullptr);
+                renderScene(scene, renderContext, nullptr);
                 onSceneWasRendered(scene);
             }
 
+            if (renderScaled && !m_tempScenesToRender.empty())
+            {
+                const PixelRectangle scaledRect{ 0u, 0u, int32_t(renderContext.viewportWidth), int32_t(renderContext.viewportHeight) };
+                const PixelRectangle fullRect{ 0u, 0u, int32_t(displayBufferInfo.viewport.width), int32_t(displayBufferInfo.viewport.height) };
+                m_displayController->getRenderBackend().getDevice().blitRenderTargets(displayBufferInfo.scaledRenderTarget, displayBuffer, scaledRect, fullRect, true);
+            }
+
             processScheduledScreenshots(displayBuffer);
 
             m_statistics.offscreenBufferSwapped(displayBuffer, false);
             m_displayBuffersSetup.setDisplayBufferToBeRerendered(displayBuffer, false);
+            m_offscreenBuffersRenderedInLastLoop.push_back(displayBuffer);
+
+            // rendering of buffer with reduced render rate might have been deferred from a frame in which its consumers were already rendered,
+            // re-render framebuffer to show its new content (same as for interruptible offscreen buffers)
+            if (displayBufferInfo.renderRateDivisor > 1u)
+                m_displayBuffersSetup.setDisplayBufferToBeRerendered(m_frameBufferDeviceHandle, true);
         }
     }
 
@@ -363,6 +544,7 @@ namespace ramses::internal
             renderContext.displayBufferDeviceHandle = displayBuffer;
             renderContext.viewportWidth = displayBufferInfo.viewport.width;
             renderContext.viewportHeight = displayBufferInfo.viewport.height;
+            renderContext.skipPassesWithUnusedOutput = m_skipUnusedRenderingPasses;
             renderContext.displayBufferClearPending = EClearFlag::None; // set clear flags accordingly below only if not in interrupted state
 
             const auto& assignedScenes = displayBufferInfo.scenes;
@@ -395,13 +577,14 @@ namespace ramses::internal
 
                 const RendererCachedScene& scene = m_rendererScenes.getScene(sceneId);
                 renderContext.renderFrom = m_rendererInterruptState.getExecutorState();
-                const SceneRenderExecutionIterator interruptState = m_displayController->renderScene(scene, renderContext, &m_frameTimer);
+                const SceneRenderExecutionIterator interruptState = renderScene(scene, renderContext, &m_frameTimer);
 
                 if (RendererInterruptState::IsInterrupted(interruptState))
                 {
                     m_rendererInterruptState = RendererInterruptState{ displayBuffer, sceneId, interruptState };
                     LOG_TRACE(CONTEXT_PROFILING, "Renderer::renderToInterruptibleOffscreenBuffers interrupted rendering to OB {}, scene {}", displayBuffer.asMemoryHandle(), sceneId.getValue());
                     m_statistics.offscreenBufferInterrupted(displayBuffer);
+                    m_statistics.sceneBudgetExceeded(sceneId);
                     break;
                 }
                 m_rendererInterruptState = RendererInterruptState{};
@@ -430,7 +613,7 @@ namespace ramses::internal
             return;
 
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin");
-
+        m_offscreenBuffersRenderedInLastLoop.clear();
 
         m_profilerStatistics.startRegion(FrameProfilerStatistics::ERegion::HandleDisplayEvents);
         {
@@ -443,7 +626,11 @@ namespace ramses::internal
         bool swapBuffers = false;
         if (m_canRenderFrame)
         {
+            if (isGpuTimeMeasured())
+                collectGpuTimerQueryResults();
+
             m_traceId = 104;
+            m_displayBuffersSetup.advanceFrame();
             // FRAMEBUFFER AND OFFSCREEN BUFFERS
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop begin frame to offscreen buffers");
             renderToOffscreenBuffers();
@@ -465,9 +652,13 @@ namespace ramses::internal
         if (swapBuffers)
         {
             m_traceId = 105;
-            m_displayController->swapBuffers();
+            if (m_partialRedrawEnabled)
+                m_displayController->swapBuffersWithDamage(m_framebufferSwapDamage);
+            else
+                m_displayController->swapBuffers();
             m_traceId = 106;
             m_statistics.framebufferSwapped();
+            m_displayEventHandler.onFrameSwapped();
             m_traceId = 107;
             m_displayController->getEmbeddedCompositingManager().notifyClients();
             LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop swapBuffers");
@@ -477,11 +668,89 @@ namespace ramses::internal
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::doOneRenderLoop end");
     }
 
+    SceneRenderExecutionIterator Renderer::renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer)
+    {
+        SceneCpuTimeScope cpuTime{ m_statistics, scene.getSceneId(), ESceneCpuTime::Rendering };
+        if (!isGpuTimeMeasured())
+            return m_displayController->renderScene(scene, renderContext, frameTimer);
+
+        IDevice& device = m_displayController->getRenderBackend().getDevice();
+        m_scenesWithGpuTimerQueries.put(scene.getSceneId());
+        const bool queryStarted = device.beginGpuTimerQuery(scene.getSceneId().getValue());
+        const SceneRenderExecutionIterator renderState = m_displayController->renderScene(scene, renderContext, frameTimer);
+        if (queryStarted)
+            device.endGpuTimerQuery();
+
+        return renderState;
+    }
+
+    void Renderer::collectGpuTimerQueryResults()
+    {
+        // results are typically available one or two frames after the queries were issued, never wait for them
+        m_tempGpuTimerQueryResults.clear();
+        m_displayController->getRenderBackend().getDevice().collectGpuTimerQueryResults(m_tempGpuTimerQueryResults);
+        std::chrono::microseconds gpuFrameTime{ 0 };
+        for (const auto& result : m_tempGpuTimerQueryResults)
+        {
+            const auto sceneGpuTime = std::chrono::duration_cast<std::chrono::microseconds>(result.elapsed);
+            if (m_gpuTimerQueriesEnabled)
+                m_statistics.sceneGpuTimeMeasured(SceneId{ result.queryId }, sceneGpuTime);
+            gpuFrameTime += sceneGpuTime;
+        }
+
+        // results collected together belong typically to the same frame, frames without results available yet are not considered
+        if (m_tempGpuTimerQueryResults.empty() || !m_resolutionScaling.update(gpuFrameTime))
+            return;
+
+        LOG_INFO(CONTEXT_RENDERER, "Renderer: GPU frame time {}us, {} rendering of scalable offscreen buffers at reduced resolution",
+            gpuFrameTime.count(), m_resolutionScaling.isScaling() ? "starting" : "stopping");
+        // re-render scaled buffers and thus also all their consumers
+        for (const auto& buffer : m_displayBuffersSetup.getDisplayBuffers())
+            m_displayBuffersSetup.setDisplayBufferToBeRerendered(buffer.first, true);
+    }
+
+    bool Renderer::isGpuTimeMeasured() const
+    {
+        return m_gpuTimerQueriesEnabled || m_resolutionScaling.isEnabled();
+    }
+
+    void Renderer::setGpuTimerQueriesEnabled(bool enable)
+    {
+        m_gpuTimerQueriesEnabled = enable;
+    }
+
+    void Renderer::setSkippingOfUnusedRenderingPasses(bool enable)
+    {
+        m_skipUnusedRenderingPasses = enable;
+    }
+
+    void Renderer::setPartialRedrawEnabled(bool enable)
+    {
+        m_partialRedrawEnabled = enable;
+        m_sceneFramebufferRegions.clear();
+        m_framebufferDamageHistory.clear();
+        if (!hasDisplayController())
+            return;
+
+        // framebuffer is fully redrawn with scenes where they are now, this is where their future damage starts from
+        m_displayBuffersSetup.setDisplayBufferToBeRerendered(m_frameBufferDeviceHandle, true);
+        if (m_partialRedrawEnabled)
+        {
+            for (const auto& sceneInfo : m_displayBuffersSetup.getDisplayBuffer(m_frameBufferDeviceHandle).scenes)
+            {
+                if (sceneInfo.shown)
+                    m_sceneFramebufferRegions.put(sceneInfo.sceneId, GetSceneFramebufferRegion(m_rendererScenes.getScene(sceneInfo.sceneId)));
+            }
+        }
+    }
+
     void Renderer::onSceneWasRendered(const RendererCachedScene& scene)
     {
         scene.markAllRenderOncePassesAsRendered();
         m_expirationMonitor.onRendered(scene.getSceneId());
         m_statistics.sceneRendered(scene.getSceneId());
+        m_statistics.renderablesCulled(scene.getSceneId(), scene.getAndResetCulledRenderablesCount());
+        m_statistics.renderingPassesSkipped(scene.getSceneId(), scene.getAndResetSkippedRenderingPassesCount());
     }
 
     void Renderer::assignSceneToDisplayBuffer(SceneId sceneId, DeviceResourceHandle buffer, int32_t globalSceneOrder)
@@ -497,6 +766,9 @@ namespace ramses::internal
     {
         assert(m_rendererScenes.hasScene(sceneId));
         m_displayBuffersSetup.unassignScene(sceneId);
+        m_sceneFramebufferRegions.remove(sceneId);
+        if (m_scenesWithGpuTimerQueries.remove(sceneId))
+            m_displayController->getRenderBackend().getDevice().deleteGpuTimerQueries(sceneId.getValue());
     }
 
     void Renderer::setSceneShown(SceneId sceneId, bool show)
@@ -504,13 +776,33 @@ namespace ramses::internal
         assert(m_rendererScenes.hasScene(sceneId));
         assert(getBufferSceneIsAssignedTo(sceneId).isValid());
         m_displayBuffersSetup.setSceneShown(sceneId, show);
+
+        // hidden scene is not tracked, shown scene is drawn fully where it is now
+        m_sceneFramebufferRegions.remove(sceneId);
+        if (show && m_partialRedrawEnabled && getBufferSceneIsAssignedTo(sceneId) == m_frameBufferDeviceHandle)
+            m_sceneFramebufferRegions.put(sceneId, GetSceneFramebufferRegion(m_rendererScenes.getScene(sceneId)));
     }
 
     void Renderer::markBufferWithSceneForRerender(SceneId sceneId)
     {
         const auto displayBuffer = getBufferSceneIsAssignedTo(sceneId);
         assert(displayBuffer.isValid());
-        m_displayBuffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+        if (m_partialRedrawEnabled && displayBuffer == m_frameBufferDeviceHandle)
+        {
+            // damage both region where scene was and where it is now,
+            // if it is not known where scene was drawn last the whole framebuffer has to be redrawn
+            const Quad newRegion = GetSceneFramebufferRegion(m_rendererScenes.getScene(sceneId));
+            const Quad* lastRegion = m_sceneFramebufferRegions.get(sceneId);
+            if (lastRegion != nullptr)
+                m_displayBuffersSetup.addDisplayBufferDamage(displayBuffer, lastRegion->getBoundingQuad(newRegion));
+            else
+                m_displayBuffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+            m_sceneFramebufferRegions.put(sceneId, newRegion);
+        }
+        else
+        {
+            m_displayBuffersSetup.setDisplayBufferToBeRerendered(displayBuffer, true);
+        }
     }
 
     DeviceResourceHandle Renderer::getBufferSceneIsAssignedTo(SceneId sceneId) const
@@ -596,6 +888,20 @@ namespace ramses::internal
         m_displayBuffersSetup.setClearColor(bufferDeviceHandle, clearColor);
     }
 
+    void Renderer::setRenderRateDivisor(DeviceResourceHandle bufferDeviceHandle, uint32_t divisor)
+    {
+        assert(hasDisplayController());
+        m_displayBuffersSetup.setRenderRateDivisor(bufferDeviceHandle, divisor);
+    }
+
+    void Renderer::setScaledRenderTarget(DeviceResourceHandle bufferDeviceHandle, DeviceResourceHandle scaledRenderTarget)
+    {
+        assert(hasDisplayController());
+        m_displayBuffersSetup.setScaledRenderTarget(bufferDeviceHandle, scaledRenderTarget);
+        if (m_resolutionScaling.isScaling())
+            m_displayBuffersSetup.setDisplayBufferToBeRerendered(bufferDeviceHandle, true);
+    }
+
     bool Renderer::setExternallyOwnedWindowSize(uint32_t width, uint32_t height)
     {
         assert(hasDisplayController());
@@ -613,7 +919,10 @@ namespace ramses::internal
     {
         assert(hasDisplayController());
         if (m_screenshots.count(renderTargetHandle) != 0u)
+        {
             LOG_WARN(CONTEXT_RENDERER, "Renderer::scheduleScreenshot: will overwrite previous screenshot request that was not executed yet (buffer={})", renderTargetHandle);
+            discardScreenshot(renderTargetHandle);
+        }
 
         m_screenshots[renderTargetHandle] = std::move(screenshot);
 
@@ -631,13 +940,35 @@ namespace ramses::internal
 
         ScreenshotInfo& screenshot = it->second;
         assert(screenshot.rectangle.width > 0u && screenshot.rectangle.height > 0u);
-        if (!screenshot.pixelData.empty())
+        if (!screenshot.pixelData.empty() || screenshot.asyncReadHandle.isValid())
+            return;
+
+        if (screenshot.async)
+        {
+            screenshot.asyncReadHandle = m_displayController->startReadPixels(renderTargetHandle, screenshot.rectangle.x, screenshot.rectangle.y, screenshot.rectangle.width, screenshot.rectangle.height);
             return;
+        }
 
         m_displayController->readPixels(renderTargetHandle, screenshot.rectangle.x, screenshot.rectangle.y, screenshot.rectangle.width, screenshot.rectangle.height, screenshot.pixelData);
         assert(!screenshot.pixelData.empty());
     }
 
+    void Renderer::discardScreenshot(DeviceResourceHandle renderTargetHandle)
+    {
+        auto it = m_screenshots.find(renderTargetHandle);
+        if (it == m_screenshots.end())
+            return;
+
+        if (it->second.asyncReadHandle.isValid())
+            m_displayController->deleteReadPixels(it->second.asyncReadHandle);
+        m_screenshots.erase(it);
+    }
+
+    const std::vector<DeviceResourceHandle>& Renderer::getOffscreenBuffersRenderedInLastLoop() const
+    {
+        return m_offscreenBuffersRenderedInLastLoop;
+    }
+
     std::vector<std::pair<DeviceResourceHandle, ScreenshotInfo>> Renderer::dispatchProcessedScreenshots()
     {
         std::vector<std::pair<DeviceResourceHandle, ScreenshotInfo>> result;
@@ -645,7 +976,15 @@ namespace ramses::internal
         {
             const auto rtHandle = it.first;
             auto& screenshot = it.second;
-            if (!screenshot.pixelData.empty())
+            if (screenshot.asyncReadHandle.isValid())
+            {
+                // pixel data are empty if read back failed, screenshot is dispatched anyway to report the failure
+                if (!m_displayController->finishReadPixels(screenshot.asyncReadHandle, screenshot.pixelData))
+                    continue;
+                screenshot.asyncReadHandle = DeviceResourceHandle::Invalid();
+                result.emplace_back(rtHandle, std::move(screenshot));
+            }
+            else if (!screenshot.pixelData.empty())
                 result.emplace_back(rtHandle, std::move(screenshot));
         }
 
@@ -660,6 +999,15 @@ namespace ramses::internal
         return m_rendererInterruptState.isInterrupted();
     }
 
+    bool Renderer::hasPendingRendering() const
+    {
+        if (hasAnyBufferWithInterruptedRendering() || !m_screenshots.empty())
+            return true;
+
+        const auto& displayBuffers = m_displayBuffersSetup.getDisplayBuffers();
+        return std::any_of(displayBuffers.cbegin(), displayBuffers.cend(), [](const auto& buffer) { return buffer.second.needsRerender; });
+    }
+
     void Renderer::resetRenderInterruptState()
     {
         LOG_TRACE(CONTEXT_PROFILING, "Renderer::resetRenderInterruptState");
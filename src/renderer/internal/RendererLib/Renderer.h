@@ -15,10 +15,14 @@
 #include "internal/RendererLib/RendererInterruptState.h"
 #include "internal/RendererLib/DisplaySetup.h"
 #include "internal/RendererLib/DisplayEventHandler.h"
+#include "internal/RendererLib/ResolutionScalingController.h"
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/PlatformAbstraction/Collections/Vector.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/HashSet.h"
 
 #include <map>
+#include <deque>
 #include <unordered_map>
 #include <string_view>
 
@@ -33,6 +37,7 @@ namespace ramses::internal
     class RendererEventCollector;
     class FrameTimer;
     class SceneExpirationMonitor;
+    struct RenderingContext;
 
     class Renderer
     {
@@ -74,13 +79,24 @@ namespace ramses::internal
 
         virtual void                setClearFlags(DeviceResourceHandle bufferDeviceHandle, ClearFlags clearFlags);
         virtual void                setClearColor(DeviceResourceHandle bufferDeviceHandle, const glm::vec4& clearColor);
+        void                        setRenderRateDivisor(DeviceResourceHandle bufferDeviceHandle, uint32_t divisor);
+        // offscreen buffer with scaled render target is rendered at reduced resolution when GPU frame time exceeds threshold set in display config
+        void                        setScaledRenderTarget(DeviceResourceHandle bufferDeviceHandle, DeviceResourceHandle scaledRenderTarget);
         virtual bool                setExternallyOwnedWindowSize(uint32_t width, uint32_t height);
         void                        scheduleScreenshot(DeviceResourceHandle renderTargetHandle, ScreenshotInfo&& screenshot);
         std::vector<std::pair<DeviceResourceHandle, ScreenshotInfo>> dispatchProcessedScreenshots();
+        // non-interruptible offscreen buffers rendered (or cleared) in last render loop
+        [[nodiscard]] const std::vector<DeviceResourceHandle>& getOffscreenBuffersRenderedInLastLoop() const;
 
         [[nodiscard]] bool                        hasAnyBufferWithInterruptedRendering() const;
+        // true if any buffer is still to be rendered (e.g. due to render rate divisor) or a screenshot is pending
+        [[nodiscard]] bool                        hasPendingRendering() const;
         void                        resetRenderInterruptState();
 
+        void                        setGpuTimerQueriesEnabled(bool enable);
+        void                        setSkippingOfUnusedRenderingPasses(bool enable);
+        void                        setPartialRedrawEnabled(bool enable);
+
         [[nodiscard]] bool hasSystemCompositorController() const;
         void updateSystemCompositorController() const;
         void systemCompositorListIviSurfaces() const;
@@ -111,7 +127,15 @@ namespace ramses::internal
         void renderToOffscreenBuffers();
         void renderToInterruptibleOffscreenBuffers();
         void processScheduledScreenshots(DeviceResourceHandle renderTargetHandle);
+        void discardScreenshot(DeviceResourceHandle renderTargetHandle);
+        SceneRenderExecutionIterator renderScene(const RendererCachedScene& scene, RenderingContext& renderContext, const FrameTimer* frameTimer);
         void onSceneWasRendered(const RendererCachedScene& scene);
+        void collectGpuTimerQueryResults();
+        [[nodiscard]] bool isGpuTimeMeasured() const;
+        [[nodiscard]] Quad computeFramebufferRedrawRegion(const DisplayBufferInfo& displayBufferInfo) const;
+        static Quad GetSceneFramebufferRegion(const RendererCachedScene& scene);
+        void updateDirectScanoutCandidate(const DisplayBufferInfo& displayBufferInfo);
+        static StreamBufferHandle GetDirectScanoutCandidate(const RendererCachedScene& scene, const Viewport& viewport);
 
         DisplayHandle                          m_display;
         IPlatform&                             m_platform;
@@ -121,6 +145,7 @@ namespace ramses::internal
         DeviceResourceHandle                   m_frameBufferDeviceHandle;
         DisplaySetup                           m_displayBuffersSetup;
         std::unordered_map<DeviceResourceHandle, ScreenshotInfo> m_screenshots;
+        std::vector<DeviceResourceHandle>      m_offscreenBuffersRenderedInLastLoop;
 
         const RendererScenes&                  m_rendererScenes;
         DisplayEventHandler                    m_displayEventHandler;
@@ -132,7 +157,25 @@ namespace ramses::internal
         const FrameTimer&                      m_frameTimer;
         SceneExpirationMonitor&                m_expirationMonitor;
 
+        bool                                   m_gpuTimerQueriesEnabled = false;
+        // scenes for which device holds GPU timer queries, deleted when scene is unassigned
+        HashSet<SceneId>                       m_scenesWithGpuTimerQueries;
+        ResolutionScalingController            m_resolutionScaling{ std::chrono::microseconds{ 0 } };
+        bool                                   m_skipUnusedRenderingPasses = false;
+
+        // partial redraw: region covered by each scene in framebuffer when last marked for re-render
+        // and damaged regions of last swapped frames (most recent first) used to repair back buffers based on their age
+        bool                                   m_partialRedrawEnabled = false;
+        HashMap<SceneId, Quad>                 m_sceneFramebufferRegions;
+        std::deque<Quad>                       m_framebufferDamageHistory;
+        Quad                                   m_framebufferSwapDamage;
+        static constexpr size_t                MaxFramebufferDamageHistory = 3u;
+
+        // stream buffer which is the only content of framebuffer (if any), its client buffer could be presented without composition
+        StreamBufferHandle                     m_directScanoutCandidate;
+
         // temporary containers kept to avoid re-allocations
         std::vector<SceneId> m_tempScenesToRender;
+        std::vector<GpuTimerQueryResult> m_tempGpuTimerQueryResults;
     };
 }
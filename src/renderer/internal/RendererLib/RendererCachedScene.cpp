@@ -7,9 +7,18 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/SceneGraph/SceneAPI/RenderGroupUtils.h"
 #include "internal/RendererLib/RenderableComparator.h"
 #include "RenderingPassOrderComparator.h"
+#include "internal/SceneGraph/SceneAPI/TextureEnums.h"
+#include "internal/SceneGraph/SceneAPI/GeometryDataBuffer.h"
+#include "internal/SceneGraph/SceneAPI/TextureBuffer.h"
+#include "internal/Core/Math3d/CameraMatrixHelper.h"
+#include "internal/PlatformAbstraction/Hash.h"
 #include <algorithm>
+#include <limits>
+#include <array>
+#include <cstring>
 
 namespace ramses::internal
 {
@@ -19,10 +28,95 @@ namespace ramses::internal
     {
     }
 
+    static void SetFlag(std::vector<bool>& flags, size_t index)
+    {
+        if (index >= flags.size())
+            flags.resize(index + 1u, false);
+        flags[index] = true;
+    }
+
+    static bool IsFlagSet(const std::vector<bool>& flags, size_t index)
+    {
+        return index < flags.size() && flags[index];
+    }
+
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
+        const bool wasVisible = (getRenderable(renderableHandle).visibilityMode == EVisibilityMode::Visible);
         BaseT::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+        const bool isVisible = (visible == EVisibilityMode::Visible);
+        if (wasVisible == isVisible)
+            return;
+
+        // hidden renderable is just removed from passes, shown renderable requires rebuild of passes containing it
+        if (isVisible)
+        {
+            SetFlag(m_shownRenderables, renderableHandle.asMemoryHandle());
+            m_renderablesShown = true;
+        }
+        else
+        {
+            m_renderablesHidden = true;
+        }
+        m_renderPassContentDirty = true;
+    }
+
+    void RendererCachedScene::setRenderableRenderState(RenderableHandle renderableHandle, RenderStateHandle stateHandle)
+    {
+        BaseT::setRenderableRenderState(renderableHandle, stateHandle);
+        // render state is part of the sort key of state sorted passes
+        if (m_hasStateSortedPasses)
+            m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
+    {
+        BaseT::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        invalidateRecordedRenderPasses();
+        // effect, textures and vertex arrays are part of the sort key of state sorted passes,
+        // sampled render buffers define dependencies between rendering passes and lifetimes of aliased render targets
+        if (m_hasStateSortedPasses || slot == ERenderableDataSlotType_Uniforms)
+            m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::releaseRenderable(RenderableHandle renderableHandle)
+    {
+        BaseT::releaseRenderable(renderableHandle);
+        invalidateRecordedRenderPasses();
+        if (m_hasLevelOfDetailRenderables)
+        {
+            for (auto& passLevelsOfDetail : m_passLevelsOfDetail)
+                passLevelsOfDetail.remove(renderableHandle);
+        }
+    }
+
+    void RendererCachedScene::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        BaseT::setRenderableLevelsOfDetail(renderableHandle, levelsOfDetail);
+        if (levelsOfDetail.count > 0u)
+            m_hasLevelOfDetailRenderables = true;
+    }
+
+    void RendererCachedScene::releaseDataInstance(DataInstanceHandle dataInstanceHandle)
+    {
+        BaseT::releaseDataInstance(dataInstanceHandle);
+        invalidateRecordedRenderPasses();
+    }
+
+    void RendererCachedScene::setDataReference(DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef)
+    {
+        BaseT::setDataReference(containerHandle, field, dataRef);
+        invalidateRecordedRenderPasses();
+    }
+
+    void RendererCachedScene::setDataTextureSamplerHandle(DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
+    {
+        // samplers of render buffers define dependencies between rendering passes
+        const bool affectsPassDependencies = doesSamplerReferToRenderBuffer(getDataTextureSamplerHandle(containerHandle, field)) || doesSamplerReferToRenderBuffer(samplerHandle);
+        BaseT::setDataTextureSamplerHandle(containerHandle, field, samplerHandle);
+        // sampled textures are part of the sort key of state sorted passes
+        if (affectsPassDependencies || m_hasStateSortedPasses)
+            m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
@@ -34,18 +128,20 @@ namespace ramses::internal
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order)
     {
         BaseT::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+        markRenderGroupContentDirty(groupHandle);
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
         BaseT::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+        markRenderGroupContentDirty(groupHandle);
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
         m_renderOncePassesToRender.remove(passHandle);
+        if (passHandle.asMemoryHandle() < m_passLevelsOfDetail.size())
+            m_passLevelsOfDetail[passHandle.asMemoryHandle()].clear();
         BaseT::releaseRenderPass(passHandle);
         m_renderableOrderingDirty = true;
     }
@@ -56,6 +152,19 @@ namespace ramses::internal
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::setRenderPassRenderTarget(RenderPassHandle passHandle, RenderTargetHandle targetHandle)
+    {
+        BaseT::setRenderPassRenderTarget(passHandle, targetHandle);
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassClearFlag(RenderPassHandle passHandle, ClearFlags clearFlag)
+    {
+        BaseT::setRenderPassClearFlag(passHandle, clearFlag);
+        // only render target fully cleared by its pass can be aliased
+        m_renderableOrderingDirty = true;
+    }
+
     BlitPassHandle RendererCachedScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle)
     {
         const BlitPassHandle blitPass = BaseT::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
@@ -82,6 +191,64 @@ namespace ramses::internal
         m_renderableOrderingDirty = true;
     }
 
+    void RendererCachedScene::releaseRenderTarget(RenderTargetHandle targetHandle)
+    {
+        BaseT::releaseRenderTarget(targetHandle);
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::addRenderTargetRenderBuffer(RenderTargetHandle targetHandle, RenderBufferHandle bufferHandle)
+    {
+        BaseT::addRenderTargetRenderBuffer(targetHandle, bufferHandle);
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::releaseRenderBuffer(RenderBufferHandle handle)
+    {
+        BaseT::releaseRenderBuffer(handle);
+        m_renderableOrderingDirty = true;
+    }
+
+    DataBufferHandle RendererCachedScene::allocateDataBuffer(EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle)
+    {
+        const auto resultHandle = BaseT::allocateDataBuffer(dataBufferType, dataType, maximumSizeInBytes, handle);
+        m_dataBufferUpdates.resize(getDataBufferCount());
+        m_dataBufferUpdates[resultHandle.asMemoryHandle()] = {};
+        return resultHandle;
+    }
+
+    void RendererCachedScene::releaseDataBuffer(DataBufferHandle handle)
+    {
+        BaseT::releaseDataBuffer(handle);
+        m_dataBufferUpdates[handle.asMemoryHandle()] = {};
+    }
+
+    void RendererCachedScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data)
+    {
+        BaseT::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+        if (dataSizeInBytes == 0u)
+            return;
+
+        assert(handle.asMemoryHandle() < m_dataBufferUpdates.size());
+        auto& update = m_dataBufferUpdates[handle.asMemoryHandle()];
+        if (update.sizeInBytes == 0u)
+        {
+            update = { offsetInBytes, dataSizeInBytes };
+        }
+        else
+        {
+            const uint32_t begin = std::min(update.offsetInBytes, offsetInBytes);
+            const uint32_t end = std::max(update.offsetInBytes + update.sizeInBytes, offsetInBytes + dataSizeInBytes);
+            update = { begin, end - begin };
+        }
+    }
+
+    void RendererCachedScene::markDataBufferFullyDirty(DataBufferHandle handle) const
+    {
+        assert(handle.asMemoryHandle() < m_dataBufferUpdates.size());
+        m_dataBufferUpdates[handle.asMemoryHandle()] = { 0u, static_cast<uint32_t>(getDataBuffer(handle).data.size()) };
+    }
+
     TextureBufferHandle RendererCachedScene::allocateTextureBuffer(EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle)
     {
         auto resultHandle = BaseT::allocateTextureBuffer(textureFormat, mipMapDimensions, handle);
@@ -103,8 +270,52 @@ namespace ramses::internal
         assert(handle.asMemoryHandle() < m_textureBufferUpdates.size());
         auto& update = m_textureBufferUpdates[handle.asMemoryHandle()];
         assert(mipLevel < update.size());
-        auto& area = update[mipLevel];
-        area = area.getBoundingQuad(Quad{static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width), static_cast<int32_t>(height)});
+        AddTextureBufferMipUpdate(update[mipLevel], Quad{static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(width), static_cast<int32_t>(height)});
+    }
+
+    void RendererCachedScene::markTextureBufferFullyDirty(TextureBufferHandle handle) const
+    {
+        assert(handle.asMemoryHandle() < m_textureBufferUpdates.size());
+        const auto& mipMaps = getTextureBuffer(handle).mipMaps;
+        auto& update = m_textureBufferUpdates[handle.asMemoryHandle()];
+        assert(update.size() == mipMaps.size());
+        for (size_t mipLevel = 0u; mipLevel < mipMaps.size(); ++mipLevel)
+        {
+            const auto& mip = mipMaps[mipLevel];
+            update[mipLevel].assign(1u, Quad{ 0, 0, static_cast<int32_t>(mip.width), static_cast<int32_t>(mip.height) });
+        }
+    }
+
+    void RendererCachedScene::AddTextureBufferMipUpdate(TextureBufferMipUpdate& mipUpdate, const Quad& area)
+    {
+        if (area.getArea() == 0)
+            return;
+
+        // merge with all overlapping areas, merged area can overlap further areas so repeat until none left
+        Quad mergedArea = area;
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (auto it = mipUpdate.begin(); it != mipUpdate.end(); ++it)
+            {
+                if (it->getIntersection(mergedArea).getArea() != 0)
+                {
+                    mergedArea = mergedArea.getBoundingQuad(*it);
+                    mipUpdate.erase(it);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+
+        if (mipUpdate.size() >= MaxTextureBufferUpdateQuadsPerMip)
+        {
+            for (const auto& quad : mipUpdate)
+                mergedArea = mergedArea.getBoundingQuad(quad);
+            mipUpdate.clear();
+        }
+        mipUpdate.push_back(mergedArea);
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled)
@@ -145,28 +356,58 @@ namespace ramses::internal
         }
     }
 
+    void RendererCachedScene::setRenderPassStateSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassStateSorting(passHandle, enable);
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassFrontToBackSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassFrontToBackSorting(passHandle, enable);
+        m_renderableOrderingDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassBackToFrontSorting(RenderPassHandle passHandle, bool enable)
+    {
+        BaseT::setRenderPassBackToFrontSorting(passHandle, enable);
+        m_renderableOrderingDirty = true;
+    }
+
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         BaseT::addRenderGroupToRenderPass(passHandle, groupHandle, order);
-        m_renderableOrderingDirty = true;
+        markRenderPassContentDirty(passHandle);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         BaseT::removeRenderGroupFromRenderPass(passHandle, groupHandle);
-        m_renderableOrderingDirty = true;
+        markRenderPassContentDirty(passHandle);
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order)
     {
         BaseT::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+        markRenderGroupContentDirty(groupHandleParent);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         BaseT::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
-        m_renderableOrderingDirty = true;
+        markRenderGroupContentDirty(groupHandleParent);
+    }
+
+    void RendererCachedScene::markRenderGroupContentDirty(RenderGroupHandle groupHandle)
+    {
+        SetFlag(m_contentDirtyRenderGroups, groupHandle.asMemoryHandle());
+        m_renderPassContentDirty = true;
+    }
+
+    void RendererCachedScene::markRenderPassContentDirty(RenderPassHandle passHandle)
+    {
+        SetFlag(m_contentDirtyRenderPasses, passHandle.asMemoryHandle());
+        m_renderPassContentDirty = true;
     }
 
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
@@ -180,6 +421,60 @@ namespace ramses::internal
         return m_passRenderableOrder[pass.asMemoryHandle()];
     }
 
+    bool RendererCachedScene::isRenderingPassOutputUsed(size_t sortedPassIdx) const
+    {
+        assert(sortedPassIdx < m_sortedRenderingPassesOutputUsed.size());
+        return m_sortedRenderingPassesOutputUsed[sortedPassIdx];
+    }
+
+    bool RendererCachedScene::canDiscardRenderingPassColorBuffers(size_t sortedPassIdx) const
+    {
+        assert(sortedPassIdx < m_sortedRenderingPassesColorDiscard.size());
+        return m_sortedRenderingPassesColorDiscard[sortedPassIdx];
+    }
+
+    void RendererCachedScene::renderingPassSkipped() const
+    {
+        ++m_skippedRenderingPassesCount;
+    }
+
+    uint32_t RendererCachedScene::getAndResetSkippedRenderingPassesCount() const
+    {
+        return std::exchange(m_skippedRenderingPassesCount, 0u);
+    }
+
+    RecordedRenderPass& RendererCachedScene::getRecordedRenderPass(RenderPassHandle pass) const
+    {
+        assert(pass.asMemoryHandle() < m_recordedRenderPasses.size());
+        return m_recordedRenderPasses[pass.asMemoryHandle()];
+    }
+
+    bool RendererCachedScene::isRecordedRenderPassValid(RenderPassHandle pass) const
+    {
+        return getRecordedRenderPass(pass).recordingGeneration == m_renderPassRecordingGeneration;
+    }
+
+    void RendererCachedScene::markRecordedRenderPassValid(RenderPassHandle pass) const
+    {
+        getRecordedRenderPass(pass).recordingGeneration = m_renderPassRecordingGeneration;
+    }
+
+    void RendererCachedScene::renderableCulled() const
+    {
+        ++m_culledRenderablesCount;
+    }
+
+    uint32_t RendererCachedScene::getAndResetCulledRenderablesCount() const
+    {
+        return std::exchange(m_culledRenderablesCount, 0u);
+    }
+
+    void RendererCachedScene::invalidateRecordedRenderPasses() const
+    {
+        ++m_renderPassRecordingGeneration;
+        assert(m_renderPassRecordingGeneration != RecordedRenderPass::InvalidGeneration);
+    }
+
     void RendererCachedScene::updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor)
     {
         updateRenderableResources(resourceAccessor);
@@ -191,10 +486,16 @@ namespace ramses::internal
         if (m_renderableOrderingDirty)
         {
             m_sortedRenderingPasses.clear();
+            m_hasStateSortedPasses = false;
+            m_hasDepthSortedPasses = false;
 
             const uint32_t totalNumberOfRenderPasses = BaseT::getRenderPassCount();
             const uint32_t totalNumberOfBlitPasses = BaseT::getBlitPassCount();
 
+            // renderable order of passes changes, all recorded passes are outdated
+            invalidateRecordedRenderPasses();
+            m_recordedRenderPasses.resize(totalNumberOfRenderPasses);
+
             //add render passes
             m_passRenderableOrder.resize(totalNumberOfRenderPasses);
             for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
@@ -222,6 +523,7 @@ namespace ramses::internal
             //sort
             RenderingPassOrderComparator comparator(*this);
             std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
+            limitRenderOncePassesInSortedPasses();
 
             //update renderables according to sorted render passes
             for (const auto& pass : m_sortedRenderingPasses)
@@ -230,8 +532,99 @@ namespace ramses::internal
                     updateRenderablesInPass(pass.getRenderPassHandle());
             }
 
+            updateRenderingPassesOutputUsage();
+            collectRenderBuffersSampledByRenderPasses();
+            updateRenderTargetAliases();
+            updateRenderingPassesColorDiscard();
+
+            // world matrices are updated only when transformations change, sort rebuilt passes using the last known ones
+            sortDepthSortedPasses();
+
             m_renderableOrderingDirty = false;
         }
+        else if (m_renderPassContentDirty)
+        {
+            updateRenderablesInContentDirtyPasses();
+        }
+
+        if (m_renderPassContentDirty)
+        {
+            std::fill(m_contentDirtyRenderPasses.begin(), m_contentDirtyRenderPasses.end(), false);
+            std::fill(m_contentDirtyRenderGroups.begin(), m_contentDirtyRenderGroups.end(), false);
+            std::fill(m_shownRenderables.begin(), m_shownRenderables.end(), false);
+            m_renderablesShown = false;
+            m_renderablesHidden = false;
+            m_renderPassContentDirty = false;
+        }
+    }
+
+    void RendererCachedScene::updateRenderablesInContentDirtyPasses()
+    {
+        // Render group changes do not affect order of passes, only passes containing changed groups are rebuilt
+        // and only their recorded passes are invalidated. Hidden renderables are removed from other passes in place,
+        // removal keeps relative order of remaining renderables which is valid for every sorting mode.
+        bool anyPassChanged = false;
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+
+            const RenderPassHandle passHandle = pass.getRenderPassHandle();
+            if (IsFlagSet(m_contentDirtyRenderPasses, passHandle.asMemoryHandle()) || containsContentDirtyRenderGroup(getRenderPass(passHandle).renderGroups))
+            {
+                updateRenderablesInPass(passHandle);
+                if (getRenderPass(passHandle).isFrontToBackSorted || getRenderPass(passHandle).isBackToFrontSorted)
+                    sortRenderablesByDepth(passHandle);
+            }
+            else if (m_renderablesHidden)
+            {
+                RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+                const auto newEnd = std::remove_if(orderedRenderables.begin(), orderedRenderables.end(),
+                    [this](RenderableHandle renderable) { return getRenderable(renderable).visibilityMode != EVisibilityMode::Visible; });
+                if (newEnd == orderedRenderables.end())
+                    continue;
+                orderedRenderables.erase(newEnd, orderedRenderables.end());
+            }
+            else
+            {
+                continue;
+            }
+
+            getRecordedRenderPass(passHandle).clear();
+            anyPassChanged = true;
+        }
+
+        // renderables sampling render buffers define pass dependencies
+        if (anyPassChanged && getRenderBufferCount() > 0u)
+        {
+            updateRenderingPassesOutputUsage();
+            collectRenderBuffersSampledByRenderPasses();
+            updateRenderTargetAliases();
+            updateRenderingPassesColorDiscard();
+        }
+    }
+
+    bool RendererCachedScene::containsContentDirtyRenderGroup(const RenderGroupOrderVector& renderGroups) const
+    {
+        for (const auto& entry : renderGroups)
+        {
+            if (IsFlagSet(m_contentDirtyRenderGroups, entry.renderGroup.asMemoryHandle()))
+                return true;
+
+            const RenderGroup& renderGroup = getRenderGroup(entry.renderGroup);
+            if (m_renderablesShown)
+            {
+                for (const auto& renderableEntry : renderGroup.renderables)
+                {
+                    if (IsFlagSet(m_shownRenderables, renderableEntry.renderable.asMemoryHandle()))
+                        return true;
+                }
+            }
+
+            if (containsContentDirtyRenderGroup(renderGroup.renderGroups))
+                return true;
+        }
+        return false;
     }
 
     const glm::mat4& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
@@ -243,6 +636,7 @@ namespace ramses::internal
     void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
     {
         RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        orderedRenderables.clear();
 
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
@@ -253,6 +647,239 @@ namespace ramses::internal
         {
             addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
         }
+
+        if (getRenderPass(passHandle).isStateSorted)
+        {
+            m_hasStateSortedPasses = true;
+            sortRenderablesByState(orderedRenderables);
+        }
+
+        if (getRenderPass(passHandle).isFrontToBackSorted || getRenderPass(passHandle).isBackToFrontSorted)
+            m_hasDepthSortedPasses = true;
+    }
+
+    void RendererCachedScene::sortRenderablesByState(RenderableVector& orderedRenderables)
+    {
+        // Sort keys are computed only when render pass ordering gets dirty, otherwise the cached
+        // pass renderable order is used as is. Renderables are collected in the order given by render groups,
+        // stable sort keeps that order for renderables with equal key.
+        m_stateSortEffectIndices.clear();
+        m_stateSortTextureIndices.clear();
+        m_stateSortKeys.clear();
+        m_stateSortKeys.reserve(orderedRenderables.size());
+        for (const auto renderable : orderedRenderables)
+            m_stateSortKeys.emplace_back(computeRenderableStateSortKey(renderable), renderable);
+
+        std::stable_sort(m_stateSortKeys.begin(), m_stateSortKeys.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        std::transform(m_stateSortKeys.cbegin(), m_stateSortKeys.cend(), orderedRenderables.begin(), [](const auto& entry) { return entry.second; });
+    }
+
+    uint64_t RendererCachedScene::computeRenderableStateSortKey(RenderableHandle renderable)
+    {
+        // packed key [effect:16][render state:16][textures:16][geometry/vertex array:16]
+        // handles exceeding 16 bits are truncated, this can only make grouping less optimal but never breaks rendering
+        const Renderable& rend = getRenderable(renderable);
+        const DataInstanceHandle geometryInstance = rend.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataInstanceHandle uniformsInstance = rend.dataInstances[ERenderableDataSlotType_Uniforms];
+
+        uint64_t effectIndex = 0u;
+        if (geometryInstance.isValid())
+        {
+            const ResourceContentHash& effectHash = getDataLayout(getLayoutOfDataInstance(geometryInstance)).getEffectHash();
+            uint16_t* existingIndex = m_stateSortEffectIndices.get(effectHash);
+            if (existingIndex != nullptr)
+            {
+                effectIndex = *existingIndex;
+            }
+            else
+            {
+                const auto newIndex = static_cast<uint16_t>(m_stateSortEffectIndices.size());
+                m_stateSortEffectIndices.put(effectHash, newIndex);
+                effectIndex = newIndex;
+            }
+        }
+
+        constexpr uint64_t Mask16 = 0xFFFFu;
+        const uint64_t renderStateIndex = rend.renderState.isValid() ? rend.renderState.asMemoryHandle() & Mask16 : Mask16;
+        const uint64_t texturesIndex = uniformsInstance.isValid() ? computeStateSortTexturesIndex(uniformsInstance) : Mask16;
+        const uint64_t geometryIndex = geometryInstance.isValid() ? geometryInstance.asMemoryHandle() & Mask16 : Mask16;
+
+        return (effectIndex << 48u) | (renderStateIndex << 32u) | (texturesIndex << 16u) | geometryIndex;
+    }
+
+    uint16_t RendererCachedScene::computeStateSortTexturesIndex(DataInstanceHandle uniformsInstance)
+    {
+        // renderables sampling same textures with same sampler states get same index even if they use
+        // different uniform instances or sampler objects, hash collisions only merge groups
+        std::size_t texturesHash = 0u;
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(uniformsInstance));
+        const uint32_t fieldCount = layout.getFieldCount();
+        for (DataFieldHandle field(0u); field < fieldCount; ++field)
+        {
+            if (!IsTextureSamplerType(layout.getField(field).dataType))
+                continue;
+
+            const TextureSamplerHandle samplerHandle = getDataTextureSamplerHandle(uniformsInstance, field);
+            if (!samplerHandle.isValid() || !isTextureSamplerAllocated(samplerHandle))
+                continue;
+
+            const TextureSampler& sampler = getTextureSampler(samplerHandle);
+            HashCombine(texturesHash, static_cast<uint8_t>(sampler.contentType), sampler.textureResource, sampler.contentHandle, sampler.states.hash());
+        }
+
+        const uint16_t* existingIndex = m_stateSortTextureIndices.get(texturesHash);
+        if (existingIndex != nullptr)
+            return *existingIndex;
+
+        const auto newIndex = static_cast<uint16_t>(m_stateSortTextureIndices.size());
+        m_stateSortTextureIndices.put(texturesHash, newIndex);
+        return newIndex;
+    }
+
+    bool RendererCachedScene::IsDepthOrderIndependent(const RenderState& renderState)
+    {
+        if (renderState.depthWrite != EDepthWrite::Enabled)
+            return false;
+
+        switch (renderState.depthFunc)
+        {
+        case EDepthFunc::Less:
+        case EDepthFunc::LessEqual:
+        case EDepthFunc::Greater:
+        case EDepthFunc::GreaterEqual:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    bool RendererCachedScene::IsTransparent(const RenderState& renderState)
+    {
+        if (renderState.blendOperationColor == EBlendOperation::Disabled && renderState.blendOperationAlpha == EBlendOperation::Disabled)
+            return false;
+
+        // blended renderable which writes depth and uses ordered depth test is sorted with opaque ones
+        return !IsDepthOrderIndependent(renderState);
+    }
+
+    void RendererCachedScene::sortDepthSortedPasses()
+    {
+        if (!m_hasDepthSortedPasses)
+            return;
+
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+            const RenderPass& renderPass = getRenderPass(pass.getRenderPassHandle());
+            if (renderPass.isFrontToBackSorted || renderPass.isBackToFrontSorted)
+                sortRenderablesByDepth(pass.getRenderPassHandle());
+        }
+    }
+
+    void RendererCachedScene::sortRenderablesByDepth(RenderPassHandle passHandle)
+    {
+        const RenderPass& renderPass = getRenderPass(passHandle);
+        if (!renderPass.camera.isValid())
+            return;
+
+        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        const glm::mat4 viewMatrix = updateMatrixCacheWithLinks(ETransformationMatrixType_Object, getCamera(renderPass.camera).node);
+
+        bool orderChanged = false;
+        if (renderPass.isFrontToBackSorted)
+            orderChanged = sortRenderableSlotsByDepth(orderedRenderables, viewMatrix, false);
+        if (renderPass.isBackToFrontSorted)
+            orderChanged = sortRenderableSlotsByDepth(orderedRenderables, viewMatrix, true) || orderChanged;
+
+        // recording stores renderables in pass order
+        if (orderChanged)
+            getRecordedRenderPass(passHandle).clear();
+    }
+
+    bool RendererCachedScene::sortRenderableSlotsByDepth(RenderableVector& orderedRenderables, const glm::mat4& viewMatrix, bool transparent)
+    {
+        // Opaque renderables (writing depth and depth tested) are sorted nearest first, transparent (blended) ones farthest first.
+        // Sorted renderables keep the positions they occupy in pass order among other renderables (e.g. background without
+        // depth test is still rendered first). Order from previous sorting is stable sorted so that renderables with equal depth do not flicker.
+        m_depthSortKeys.clear();
+        m_depthSortSlots.clear();
+        for (size_t i = 0u; i < orderedRenderables.size(); ++i)
+        {
+            const RenderableHandle renderable = orderedRenderables[i];
+            const Renderable& rend = getRenderable(renderable);
+            if (!rend.renderState.isValid())
+                continue;
+            const RenderState& renderState = getRenderState(rend.renderState);
+            if (transparent ? !IsTransparent(renderState) : !IsDepthOrderIndependent(renderState))
+                continue;
+
+            // renderable added since last world matrix update has no matrix yet, it is sorted on next update
+            float depth = 0.f;
+            if (renderable.asMemoryHandle() < m_renderableMatrices.size())
+            {
+                const glm::vec4 origin = rend.boundingSphere.w >= 0.f ? glm::vec4(glm::vec3(rend.boundingSphere), 1.f) : glm::vec4(0.f, 0.f, 0.f, 1.f);
+                // camera looks along negative Z axis in view space
+                depth = -(viewMatrix * m_renderableMatrices[renderable.asMemoryHandle()] * origin).z;
+            }
+
+            // map float to unsigned key with same ordering (flip all bits of negative values, only sign bit of positive ones),
+            // descending order for transparent renderables is achieved by inverting the key
+            uint32_t key = 0u;
+            std::memcpy(&key, &depth, sizeof(key));
+            key = (key & 0x80000000u) != 0u ? ~key : (key | 0x80000000u);
+            m_depthSortKeys.emplace_back(transparent ? ~key : key, renderable);
+            m_depthSortSlots.push_back(i);
+        }
+
+        radixSortDepthKeys();
+
+        bool orderChanged = false;
+        for (size_t i = 0u; i < m_depthSortSlots.size(); ++i)
+        {
+            RenderableHandle& slot = orderedRenderables[m_depthSortSlots[i]];
+            if (slot != m_depthSortKeys[i].second)
+            {
+                slot = m_depthSortKeys[i].second;
+                orderChanged = true;
+            }
+        }
+
+        return orderChanged;
+    }
+
+    void RendererCachedScene::radixSortDepthKeys()
+    {
+        // stable LSD radix sort over 8 bit digits, digit passes where all keys share the same value are skipped,
+        // which is the common case for upper bits of depths in similar range
+        constexpr uint32_t RadixBits = 8u;
+        constexpr size_t RadixSize = 1u << RadixBits;
+        if (m_depthSortKeys.size() < 2u)
+            return;
+
+        m_depthSortScratch.resize(m_depthSortKeys.size());
+        for (uint32_t shift = 0u; shift < 32u; shift += RadixBits)
+        {
+            std::array<size_t, RadixSize> offsets{};
+            for (const auto& entry : m_depthSortKeys)
+                ++offsets[(entry.first >> shift) & (RadixSize - 1u)];
+
+            if (offsets[(m_depthSortKeys.front().first >> shift) & (RadixSize - 1u)] == m_depthSortKeys.size())
+                continue;
+
+            size_t offset = 0u;
+            for (auto& digitOffset : offsets)
+            {
+                const size_t count = digitOffset;
+                digitOffset = offset;
+                offset += count;
+            }
+
+            for (const auto& entry : m_depthSortKeys)
+                m_depthSortScratch[offsets[(entry.first >> shift) & (RadixSize - 1u)]++] = entry;
+            m_depthSortKeys.swap(m_depthSortScratch);
+        }
     }
 
     static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
@@ -275,6 +902,7 @@ namespace ramses::internal
         RenderableComparator renderableComp(*this);
         std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
         std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
+        RenderGroupUtils::UpdateIndices(renderGroup);
 
         auto renderablesIterator = orderedGroupRenderables.begin();
         auto renderGroupIterator = orderedRenderGroups.begin();
@@ -320,6 +948,9 @@ namespace ramses::internal
                 m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
             }
         }
+
+        sortDepthSortedPasses();
+        selectLevelsOfDetail();
     }
 
     void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
@@ -335,6 +966,421 @@ namespace ramses::internal
                 m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCacheWithLinks(ETransformationMatrixType_World, node);
             }
         }
+
+        sortDepthSortedPasses();
+        selectLevelsOfDetail();
+    }
+
+    void RendererCachedScene::selectLevelsOfDetail()
+    {
+        if (!m_hasLevelOfDetailRenderables)
+            return;
+
+        m_passLevelsOfDetail.resize(BaseT::getRenderPassCount());
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass == pass.getType())
+                selectLevelsOfDetailInPass(pass.getRenderPassHandle());
+        }
+    }
+
+    void RendererCachedScene::selectLevelsOfDetailInPass(RenderPassHandle passHandle)
+    {
+        const RenderPass& renderPass = getRenderPass(passHandle);
+        if (!renderPass.camera.isValid())
+            return;
+
+        const Camera& camera = getCamera(renderPass.camera);
+        const glm::mat4 viewMatrix = updateMatrixCacheWithLinks(ETransformationMatrixType_Object, camera.node);
+        const auto& frustumPlanes = getDataSingleVector4f(getDataReference(camera.dataInstance, Camera::FrustumPlanesField), DataFieldHandle{ 0 });
+        const auto& frustumNearFar = getDataSingleVector2f(getDataReference(camera.dataInstance, Camera::FrustumNearFarPlanesField), DataFieldHandle{ 0 });
+        const glm::mat4 projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
+            ProjectionParams::Frustum(camera.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
+        // projected diameter relative to viewport height (clip space height is 2) is radius * P[1][1] / w
+        const float projectionScale = std::abs(projectionMatrix[1][1]);
+
+        LevelsOfDetailSelection& passLevelsOfDetail = m_passLevelsOfDetail[passHandle.asMemoryHandle()];
+        for (const auto renderable : m_passRenderableOrder[passHandle.asMemoryHandle()])
+        {
+            const Renderable& rend = getRenderable(renderable);
+            if (rend.levelsOfDetail.count == 0u)
+                continue;
+
+            // full detail if size cannot be determined, i.e. without bounding sphere or with sphere center behind camera
+            float screenSize = std::numeric_limits<float>::max();
+            if (rend.boundingSphere.w >= 0.f && renderable.asMemoryHandle() < m_renderableMatrices.size())
+            {
+                const glm::mat4 modelViewMatrix = viewMatrix * m_renderableMatrices[renderable.asMemoryHandle()];
+                const float clipW = (projectionMatrix * modelViewMatrix * glm::vec4(glm::vec3(rend.boundingSphere), 1.f)).w;
+                if (clipW > 0.f)
+                {
+                    const float scale = std::max({ glm::length(glm::vec3(modelViewMatrix[0])), glm::length(glm::vec3(modelViewMatrix[1])), glm::length(glm::vec3(modelViewMatrix[2])) });
+                    screenSize = rend.boundingSphere.w * scale * projectionScale / clipW;
+                }
+            }
+
+            uint32_t& level = passLevelsOfDetail[renderable];
+            level = SelectLevelOfDetail(rend.levelsOfDetail, screenSize, level);
+        }
+    }
+
+    uint32_t RendererCachedScene::SelectLevelOfDetail(const RenderableLevelsOfDetail& levelsOfDetail, float screenSize, uint32_t previousLevel)
+    {
+        // level N is used below N-th threshold, thresholds are descending
+        uint32_t level = 0u;
+        while (level < levelsOfDetail.count && screenSize < levelsOfDetail.levels[level].screenSize)
+            ++level;
+
+        if (previousLevel == level || previousLevel > levelsOfDetail.count)
+            return level;
+
+        const uint32_t lowerLevel = std::min(level, previousLevel);
+        const uint32_t upperLevel = std::max(level, previousLevel);
+        for (uint32_t i = lowerLevel; i < upperLevel; ++i)
+        {
+            const float threshold = levelsOfDetail.levels[i].screenSize;
+            if (std::abs(screenSize - threshold) > LevelOfDetailHysteresis * threshold)
+                return level;
+        }
+
+        return previousLevel;
+    }
+
+    uint32_t RendererCachedScene::getRenderableLevelOfDetail(RenderPassHandle pass, RenderableHandle renderable) const
+    {
+        if (pass.asMemoryHandle() >= m_passLevelsOfDetail.size())
+            return 0u;
+
+        const uint32_t* level = m_passLevelsOfDetail[pass.asMemoryHandle()].get(renderable);
+        return level != nullptr ? *level : 0u;
+    }
+
+    void RendererCachedScene::updateRenderingPassesOutputUsage()
+    {
+        // Passes are nodes of dependency graph, render buffers are its edges. Output of pass is used if it renders into display buffer,
+        // if it is render once pass (its result must be kept for later) or if any buffer of its render target is consumed by a pass with used output.
+        // Pass consumes buffers it samples, blits from or shares in its render target (e.g. depth buffer used by several render targets).
+        // Graph is traversed from last pass backwards, repeated traversal resolves passes sampling buffers rendered later in frame (previous frame content).
+        const size_t numPasses = m_sortedRenderingPasses.size();
+        m_sortedRenderingPassesOutputUsed.assign(numPasses, false);
+        m_consumedRenderBuffers.assign(getRenderBufferCount(), false);
+
+        bool anyPassMarkedUsed = true;
+        while (anyPassMarkedUsed)
+        {
+            anyPassMarkedUsed = false;
+            for (size_t passIdx = numPasses; passIdx-- > 0u;)
+            {
+                if (m_sortedRenderingPassesOutputUsed[passIdx])
+                    continue;
+
+                const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+                if (ERenderingPassType::RenderPass == passInfo.getType())
+                {
+                    const RenderPass& renderPass = getRenderPass(passInfo.getRenderPassHandle());
+                    const RenderTargetHandle renderTarget = renderPass.renderTarget;
+                    if (renderTarget.isValid() && !renderPass.isRenderOnce && !isAnyRenderTargetBufferConsumed(renderTarget))
+                        continue;
+
+                    if (renderTarget.isValid())
+                        markRenderTargetBuffersConsumed(renderTarget);
+                    for (const auto renderable : getOrderedRenderablesForPass(passInfo.getRenderPassHandle()))
+                        markRenderBuffersSampledByRenderable(renderable);
+                }
+                else
+                {
+                    const BlitPass& blitPass = getBlitPass(passInfo.getBlitPassHandle());
+                    if (!m_consumedRenderBuffers[blitPass.destinationRenderBuffer.asMemoryHandle()])
+                        continue;
+
+                    m_consumedRenderBuffers[blitPass.sourceRenderBuffer.asMemoryHandle()] = true;
+                }
+
+                m_sortedRenderingPassesOutputUsed[passIdx] = true;
+                anyPassMarkedUsed = true;
+            }
+        }
+    }
+
+    bool RendererCachedScene::isAnyRenderTargetBufferConsumed(RenderTargetHandle renderTarget) const
+    {
+        const uint32_t bufferCount = getRenderTargetRenderBufferCount(renderTarget);
+        for (uint32_t i = 0u; i < bufferCount; ++i)
+        {
+            if (m_consumedRenderBuffers[getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle()])
+                return true;
+        }
+        return false;
+    }
+
+    void RendererCachedScene::markRenderTargetBuffersConsumed(RenderTargetHandle renderTarget)
+    {
+        const uint32_t bufferCount = getRenderTargetRenderBufferCount(renderTarget);
+        for (uint32_t i = 0u; i < bufferCount; ++i)
+            m_consumedRenderBuffers[getRenderTargetRenderBuffer(renderTarget, i).asMemoryHandle()] = true;
+    }
+
+    void RendererCachedScene::markRenderBuffersSampledByRenderable(RenderableHandle renderable)
+    {
+        const DataInstanceHandle uniformsInstance = getRenderable(renderable).dataInstances[ERenderableDataSlotType_Uniforms];
+        if (!uniformsInstance.isValid())
+            return;
+
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(uniformsInstance));
+        const uint32_t fieldCount = layout.getFieldCount();
+        for (DataFieldHandle field(0u); field < fieldCount; ++field)
+        {
+            if (!IsTextureSamplerType(layout.getField(field).dataType))
+                continue;
+
+            const TextureSamplerHandle sampler = getDataTextureSamplerHandle(uniformsInstance, field);
+            if (doesSamplerReferToRenderBuffer(sampler))
+                m_consumedRenderBuffers[getTextureSampler(sampler).contentHandle] = true;
+        }
+    }
+
+    bool RendererCachedScene::doesSamplerReferToRenderBuffer(TextureSamplerHandle sampler) const
+    {
+        return sampler.isValid() && isTextureSamplerAllocated(sampler) && getTextureSampler(sampler).isRenderBuffer();
+    }
+
+    const RenderTargetAliases& RendererCachedScene::getRenderTargetAliases() const
+    {
+        return m_renderTargetAliases;
+    }
+
+    bool RendererCachedScene::haveRenderTargetAliasesChanged() const
+    {
+        return std::exchange(m_renderTargetAliasesChanged, false);
+    }
+
+    void RendererCachedScene::updateRenderTargetAliases()
+    {
+        // Render target is transient if its content is produced and consumed within a frame: it is rendered into by a single pass
+        // which clears it completely and is not render once, its buffers belong to no other render target, are not used by any blit pass
+        // and are sampled only by passes executed after the producing pass (not previous frame content).
+        // Lifetime of transient render target within frame spans from its producing pass to the last pass sampling it,
+        // transient render targets with compatible buffers and disjoint lifetimes are assigned to same device memory (greedy interval partitioning).
+        constexpr size_t NoPass = std::numeric_limits<size_t>::max();
+        struct RenderBufferUsage
+        {
+            uint32_t renderTargetCount = 0u;
+            bool     usedByBlitPass = false;
+            size_t   firstSampled = NoPass;
+            size_t   lastSampled = 0u;
+        };
+        struct RenderTargetUsage
+        {
+            uint32_t producerCount = 0u;
+            bool     fullyClearedEveryFrame = true;
+            size_t   producer = NoPass;
+        };
+        std::vector<RenderBufferUsage> bufferUsage(getRenderBufferCount());
+        std::vector<RenderTargetUsage> targetUsage(getRenderTargetCount());
+
+        for (RenderTargetHandle rt(0u); rt < getRenderTargetCount(); ++rt)
+        {
+            if (!isRenderTargetAllocated(rt))
+                continue;
+            const uint32_t bufferCount = getRenderTargetRenderBufferCount(rt);
+            for (uint32_t i = 0u; i < bufferCount; ++i)
+                ++bufferUsage[getRenderTargetRenderBuffer(rt, i).asMemoryHandle()].renderTargetCount;
+        }
+
+        for (const auto& blitPass : getBlitPasses())
+        {
+            bufferUsage[blitPass.second->sourceRenderBuffer.asMemoryHandle()].usedByBlitPass = true;
+            bufferUsage[blitPass.second->destinationRenderBuffer.asMemoryHandle()].usedByBlitPass = true;
+        }
+
+        const size_t numPasses = m_sortedRenderingPasses.size();
+        for (size_t passIdx = 0u; passIdx < numPasses; ++passIdx)
+        {
+            const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+            if (ERenderingPassType::RenderPass != passInfo.getType())
+                continue;
+
+            const RenderPass& renderPass = getRenderPass(passInfo.getRenderPassHandle());
+            if (renderPass.renderTarget.isValid())
+            {
+                RenderTargetUsage& usage = targetUsage[renderPass.renderTarget.asMemoryHandle()];
+                ++usage.producerCount;
+                usage.producer = passIdx;
+                usage.fullyClearedEveryFrame = !renderPass.isRenderOnce && renderPass.clearFlags == EClearFlag::All;
+            }
+
+            for (const auto rb : m_renderBuffersSampledByPass[passIdx])
+            {
+                bufferUsage[rb.asMemoryHandle()].firstSampled = std::min(bufferUsage[rb.asMemoryHandle()].firstSampled, passIdx);
+                bufferUsage[rb.asMemoryHandle()].lastSampled = std::max(bufferUsage[rb.asMemoryHandle()].lastSampled, passIdx);
+            }
+        }
+
+        struct AliasGroup
+        {
+            RenderTargetHandle       hostRenderTarget;
+            RenderBufferHandleVector hostRenderBuffers;
+            size_t                   lastUse;
+        };
+        std::vector<AliasGroup> groups;
+        RenderTargetAliases newAliases;
+        RenderBufferHandleVector buffers;
+
+        for (size_t passIdx = 0u; passIdx < numPasses; ++passIdx)
+        {
+            const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+            if (ERenderingPassType::RenderPass != passInfo.getType())
+                continue;
+            const RenderTargetHandle rt = getRenderPass(passInfo.getRenderPassHandle()).renderTarget;
+            if (!rt.isValid())
+                continue;
+            const RenderTargetUsage& usage = targetUsage[rt.asMemoryHandle()];
+            if (usage.producerCount != 1u || !usage.fullyClearedEveryFrame)
+                continue;
+
+            buffers.clear();
+            bool isTransient = true;
+            size_t lastUse = passIdx;
+            const uint32_t bufferCount = getRenderTargetRenderBufferCount(rt);
+            for (uint32_t i = 0u; i < bufferCount && isTransient; ++i)
+            {
+                const RenderBufferHandle rb = getRenderTargetRenderBuffer(rt, i);
+                const RenderBufferUsage& rbUsage = bufferUsage[rb.asMemoryHandle()];
+                isTransient = rbUsage.renderTargetCount == 1u && !rbUsage.usedByBlitPass && (rbUsage.firstSampled == NoPass || rbUsage.firstSampled > passIdx);
+                if (rbUsage.firstSampled != NoPass)
+                    lastUse = std::max(lastUse, rbUsage.lastSampled);
+                buffers.push_back(rb);
+            }
+            if (!isTransient || buffers.empty())
+                continue;
+
+            auto groupIt = std::find_if(groups.begin(), groups.end(), [&](const AliasGroup& group) {
+                return group.lastUse < passIdx && areRenderTargetBuffersCompatible(group.hostRenderBuffers, buffers);
+            });
+            if (groupIt == groups.end())
+            {
+                groups.push_back({ rt, buffers, lastUse });
+            }
+            else
+            {
+                newAliases.push_back({ rt, buffers, groupIt->hostRenderTarget, groupIt->hostRenderBuffers });
+                groupIt->lastUse = lastUse;
+            }
+        }
+
+        if (newAliases != m_renderTargetAliases)
+        {
+            m_renderTargetAliases = std::move(newAliases);
+            m_renderTargetAliasesChanged = true;
+        }
+    }
+
+    void RendererCachedScene::collectRenderBuffersSampledByRenderPasses()
+    {
+        const size_t numPasses = m_sortedRenderingPasses.size();
+        m_renderBuffersSampledByPass.resize(numPasses);
+        for (size_t passIdx = 0u; passIdx < numPasses; ++passIdx)
+        {
+            RenderBufferHandleVector& sampledBuffers = m_renderBuffersSampledByPass[passIdx];
+            sampledBuffers.clear();
+            const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+            if (ERenderingPassType::RenderPass != passInfo.getType())
+                continue;
+
+            // reuses scratch container, buffers consumed by this pass only
+            m_consumedRenderBuffers.assign(getRenderBufferCount(), false);
+            for (const auto renderable : getOrderedRenderablesForPass(passInfo.getRenderPassHandle()))
+                markRenderBuffersSampledByRenderable(renderable);
+            const auto bufferCount = static_cast<uint32_t>(m_consumedRenderBuffers.size());
+            for (RenderBufferHandle rb(0u); rb < bufferCount; ++rb)
+            {
+                if (m_consumedRenderBuffers[rb.asMemoryHandle()])
+                    sampledBuffers.push_back(rb);
+            }
+        }
+    }
+
+    void RendererCachedScene::updateRenderingPassesColorDiscard()
+    {
+        const size_t numPasses = m_sortedRenderingPasses.size();
+        m_sortedRenderingPassesColorDiscard.assign(numPasses, false);
+        for (size_t passIdx = 0u; passIdx < numPasses; ++passIdx)
+        {
+            const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+            if (ERenderingPassType::RenderPass != passInfo.getType())
+                continue;
+
+            // content of render once pass must be kept for later frames
+            const RenderPass& renderPass = getRenderPass(passInfo.getRenderPassHandle());
+            if (!renderPass.renderTarget.isValid() || renderPass.isRenderOnce)
+                continue;
+
+            bool canDiscard = false;
+            const uint32_t bufferCount = getRenderTargetRenderBufferCount(renderPass.renderTarget);
+            for (uint32_t i = 0u; i < bufferCount; ++i)
+            {
+                const RenderBufferHandle rb = getRenderTargetRenderBuffer(renderPass.renderTarget, i);
+                if (IsDepthOrStencilFormat(getRenderBuffer(rb).format))
+                    continue;
+                canDiscard = !isColorBufferReadAfterPass(rb, passIdx);
+                if (!canDiscard)
+                    break;
+            }
+            m_sortedRenderingPassesColorDiscard[passIdx] = canDiscard;
+        }
+    }
+
+    bool RendererCachedScene::isColorBufferReadAfterPass(RenderBufferHandle buffer, size_t sortedPassIdx) const
+    {
+        // check each pass starting from next till this pass (across frame boundary, including this pass)
+        const size_t numPasses = m_sortedRenderingPasses.size();
+        for (size_t i = 0u; i < numPasses; ++i)
+        {
+            const size_t passIdx = (sortedPassIdx + 1u + i) % numPasses;
+            const RenderingPassInfo& passInfo = m_sortedRenderingPasses[passIdx];
+            if (ERenderingPassType::RenderPass == passInfo.getType())
+            {
+                const auto& sampledBuffers = m_renderBuffersSampledByPass[passIdx];
+                if (std::find(sampledBuffers.cbegin(), sampledBuffers.cend(), buffer) != sampledBuffers.cend())
+                    return true;
+
+                // next pass rendering into buffer decides based on clear, without clear it loads previous content
+                const RenderPass& renderPass = getRenderPass(passInfo.getRenderPassHandle());
+                if (renderPass.renderTarget.isValid())
+                {
+                    const uint32_t bufferCount = getRenderTargetRenderBufferCount(renderPass.renderTarget);
+                    for (uint32_t rbIdx = 0u; rbIdx < bufferCount; ++rbIdx)
+                    {
+                        if (getRenderTargetRenderBuffer(renderPass.renderTarget, rbIdx) == buffer)
+                            return renderPass.isRenderOnce || !renderPass.clearFlags.isSet(EClearFlag::Color);
+                    }
+                }
+            }
+            else
+            {
+                // blit reads source and overwrites only region of destination
+                const BlitPass& blitPass = getBlitPass(passInfo.getBlitPassHandle());
+                if (blitPass.sourceRenderBuffer == buffer || blitPass.destinationRenderBuffer == buffer)
+                    return true;
+            }
+        }
+
+        return true;
+    }
+
+    bool RendererCachedScene::areRenderTargetBuffersCompatible(const RenderBufferHandleVector& buffers1, const RenderBufferHandleVector& buffers2) const
+    {
+        if (buffers1.size() != buffers2.size())
+            return false;
+
+        for (size_t i = 0u; i < buffers1.size(); ++i)
+        {
+            const RenderBuffer& rb1 = getRenderBuffer(buffers1[i]);
+            const RenderBuffer& rb2 = getRenderBuffer(buffers2[i]);
+            if (rb1.width != rb2.width || rb1.height != rb2.height || rb1.format != rb2.format || rb1.accessMode != rb2.accessMode || rb1.sampleCount != rb2.sampleCount)
+                return false;
+        }
+        return true;
     }
 
     bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
@@ -377,8 +1423,96 @@ namespace ramses::internal
         {
             // some render once passes were rendered, remove them from list
             // and force update of cached render pass list for next update
-            m_renderOncePassesToRender.clear();
+            if (m_hasDeferredRenderOncePasses)
+            {
+                for (const auto pass : m_renderOncePassesScheduled)
+                    m_renderOncePassesToRender.remove(pass);
+            }
+            else
+            {
+                m_renderOncePassesToRender.clear();
+            }
+            m_renderableOrderingDirty = true;
+        }
+    }
+
+    void RendererCachedScene::setRenderOncePassesPerFrameLimit(uint32_t maxPasses)
+    {
+        if (m_renderOncePassesPerFrameLimit != maxPasses)
+        {
+            m_renderOncePassesPerFrameLimit = maxPasses;
+            m_renderableOrderingDirty = true;
+        }
+    }
+
+    void RendererCachedScene::setRenderOncePassesWarmUp(bool enable)
+    {
+        if (m_renderOncePassesWarmUp != enable)
+        {
+            m_renderOncePassesWarmUp = enable;
             m_renderableOrderingDirty = true;
         }
     }
+
+    bool RendererCachedScene::isRenderOncePassesWarmUp() const
+    {
+        return m_renderOncePassesWarmUp;
+    }
+
+    bool RendererCachedScene::hasRenderOncePassesToRender() const
+    {
+        return m_renderOncePassesToRender.size() > 0u;
+    }
+
+    bool RendererCachedScene::hasRenderOncePassesForLaterFrames() const
+    {
+        if (m_renderOncePassesPerFrameLimit == 0u || m_renderOncePassesToRender.size() <= m_renderOncePassesPerFrameLimit)
+            return false;
+
+        uint32_t numPassesToRender = 0u;
+        for (const auto pass : m_renderOncePassesToRender)
+        {
+            if (shouldRenderPassBeRendered(pass))
+                ++numPassesToRender;
+        }
+        return numPassesToRender > m_renderOncePassesPerFrameLimit;
+    }
+
+    void RendererCachedScene::limitRenderOncePassesInSortedPasses()
+    {
+        m_renderOncePassesScheduled.clear();
+        m_hasDeferredRenderOncePasses = false;
+        if (m_renderOncePassesPerFrameLimit == 0u)
+            return;
+
+        // passes are in render order, so render once passes rendering into render targets consumed by later render once passes
+        // are taken first and the consumers are rendered in the same or a later frame
+        const auto isDeferredRenderOncePass = [this](const RenderingPassInfo& pass) {
+            if (pass.getType() != ERenderingPassType::RenderPass || !BaseT::getRenderPass(pass.getRenderPassHandle()).isRenderOnce)
+                return false;
+            if (m_renderOncePassesScheduled.size() < m_renderOncePassesPerFrameLimit)
+            {
+                m_renderOncePassesScheduled.push_back(pass.getRenderPassHandle());
+                return false;
+            }
+            return true;
+        };
+        auto sortedPassesEnd = m_sortedRenderingPasses.begin();
+        for (auto it = m_sortedRenderingPasses.begin(); it != m_sortedRenderingPasses.end(); ++it)
+        {
+            if (isDeferredRenderOncePass(*it))
+                m_hasDeferredRenderOncePasses = true;
+            else
+                *sortedPassesEnd++ = *it;
+        }
+        m_sortedRenderingPasses.erase(sortedPassesEnd, m_sortedRenderingPasses.end());
+
+        // content of a scene which is not reported as shown yet is not rendered until all its render once passes are rendered
+        if (m_hasDeferredRenderOncePasses && m_renderOncePassesWarmUp)
+        {
+            m_sortedRenderingPasses.erase(std::remove_if(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), [this](const RenderingPassInfo& pass) {
+                return pass.getType() == ERenderingPassType::RenderPass && !BaseT::getRenderPass(pass.getRenderPassHandle()).isRenderOnce;
+            }), m_sortedRenderingPasses.end());
+        }
+    }
 }
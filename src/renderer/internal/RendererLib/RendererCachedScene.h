@@ -10,6 +10,12 @@
 
 #include "internal/RendererLib/ResourceCachedScene.h"
 #include "internal/RendererLib/RenderingPassInfo.h"
+#include "internal/RendererLib/RecordedRenderPass.h"
+#include "internal/RendererLib/RenderTargetAlias.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+
+#include <vector>
+#include <utility>
 
 namespace ramses::internal
 {
@@ -29,6 +35,15 @@ namespace ramses::internal
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
 
+        // pending render once passes over the limit are rendered in following frames, in render order, 0 means no limit
+        void setRenderOncePassesPerFrameLimit(uint32_t maxPasses);
+        // while warming up only render once passes are rendered as long as some of them are left for following frames
+        void setRenderOncePassesWarmUp(bool enable);
+        [[nodiscard]] bool isRenderOncePassesWarmUp() const;
+        [[nodiscard]] bool hasRenderOncePassesToRender() const;
+        // true if more render once passes are pending than can be rendered in next frame
+        [[nodiscard]] bool hasRenderOncePassesForLaterFrames() const;
+
         /**
          * The renderer sets this to true when it applies a semantic time uniform
          * that is supposed to enable a shader based animation
@@ -48,7 +63,22 @@ namespace ramses::internal
          */
         bool hasActiveShaderAnimation() const;
 
+        /**
+         * Same as setActiveShaderAnimation but for semantic time uniforms of data instances with animation end
+         * (IScene::setDataInstanceUniformTimeAnimationEnd), set if the end was not reached yet when rendering.
+         * The flag is reset whenever rendering of the scene starts from beginning, so that the scene
+         * stops being re-rendered once all such animations reached their end, even without new flush.
+         */
+        void setActiveFiniteShaderAnimation(bool hasAnimation) const;
+
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        void                        setRenderableRenderState        (RenderableHandle renderableHandle, RenderStateHandle stateHandle) override;
+        void                        setRenderableDataInstance       (RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance) override;
+        void                        releaseRenderable               (RenderableHandle renderableHandle) override;
+        void                        setRenderableLevelsOfDetail     (RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail) override;
+        void                        releaseDataInstance             (DataInstanceHandle dataInstanceHandle) override;
+        void                        setDataReference                (DataInstanceHandle containerHandle, DataFieldHandle field, DataInstanceHandle dataRef) override;
+        void                        setDataTextureSamplerHandle     (DataInstanceHandle containerHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle) override;
 
         void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order) override;
@@ -56,9 +86,14 @@ namespace ramses::internal
 
         void                        releaseRenderPass               (RenderPassHandle passHandle) override;
         void                        setRenderPassRenderOrder        (RenderPassHandle passHandle, int32_t renderOrder) override;
+        void                        setRenderPassRenderTarget       (RenderPassHandle passHandle, RenderTargetHandle targetHandle) override;
+        void                        setRenderPassClearFlag          (RenderPassHandle passHandle, ClearFlags clearFlag) override;
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
         void                        retriggerRenderPassRenderOnce   (RenderPassHandle passHandle) override;
+        void                        setRenderPassStateSorting       (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassFrontToBackSorting (RenderPassHandle passHandle, bool enable) override;
+        void                        setRenderPassBackToFrontSorting (RenderPassHandle passHandle, bool enable) override;
         void                        addRenderGroupToRenderPass      (RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order) override;
         void                        removeRenderGroupFromRenderPass (RenderPassHandle passHandle, RenderGroupHandle groupHandle) override;
         void                        addRenderGroupToRenderGroup     (RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order) override;
@@ -69,15 +104,91 @@ namespace ramses::internal
         void                        setBlitPassRenderOrder(BlitPassHandle passHandle, int32_t renderOrder) override;
         void                        setBlitPassEnabled(BlitPassHandle passHandle, bool isEnabled) override;
 
+        void                        releaseRenderTarget             (RenderTargetHandle targetHandle) override;
+        void                        addRenderTargetRenderBuffer     (RenderTargetHandle targetHandle, RenderBufferHandle bufferHandle) override;
+        void                        releaseRenderBuffer             (RenderBufferHandle handle) override;
+
+        DataBufferHandle            allocateDataBuffer              (EDataBufferType dataBufferType, EDataType dataType, uint32_t maximumSizeInBytes, DataBufferHandle handle) override;
+        void                        releaseDataBuffer               (DataBufferHandle handle) override;
+        void                        updateDataBuffer                (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+
         TextureBufferHandle         allocateTextureBuffer           (EPixelStorageFormat textureFormat, const MipMapDimensions& mipMapDimensions, TextureBufferHandle handle) override;
         void                        releaseTextureBuffer(TextureBufferHandle handle) override;
         void                        updateTextureBuffer             (TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const std::byte* data) override;
 
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
+
+        // Output of a rendering pass (indexed as in getSortedRenderingPasses) is unused if it renders into render target
+        // whose buffers are neither sampled nor blitted nor shared by any other pass with used output.
+        // Such pass can be skipped by RenderExecutor without affecting what ends up in display buffer.
+        [[nodiscard]] bool                  isRenderingPassOutputUsed       (size_t sortedPassIdx) const;
+        void                                renderingPassSkipped            () const;
+        // Color buffers of render target rendered by a pass (indexed as in getSortedRenderingPasses) can be discarded (invalidated)
+        // after the pass if their content is never read again: next pass accessing them (cyclically, i.e. also in next frame)
+        // clears them before rendering, no pass samples or blits from them meanwhile.
+        // Saves storing tile memory back to the buffers on tiled GPUs.
+        [[nodiscard]] bool                  canDiscardRenderingPassColorBuffers(size_t sortedPassIdx) const;
+        [[nodiscard]] uint32_t              getAndResetSkippedRenderingPassesCount() const;
         const glm::mat4&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
 
-        using TextureBufferUpdate = std::vector<Quad>;
+        // Recorded command stream of render pass, see RecordedRenderPass.
+        // Recording is invalidated whenever scene structure it depends on changes.
+        RecordedRenderPass&                 getRecordedRenderPass           (RenderPassHandle pass) const;
+        [[nodiscard]] bool                  isRecordedRenderPassValid       (RenderPassHandle pass) const;
+        void                                markRecordedRenderPassValid     (RenderPassHandle pass) const;
+        void                                invalidateRecordedRenderPasses  () const;
+
+        // Renderables with this render state write depth and their result does not depend on the order they are rendered in,
+        // they are reordered by front to back sorting and rendered in depth pre-pass
+        [[nodiscard]] static bool           IsDepthOrderIndependent         (const RenderState& renderState);
+        [[nodiscard]] static bool           IsTransparent                   (const RenderState& renderState);
+
+        // Render targets which can share device memory with another render target because their contents
+        // live only within a frame and lifetimes within the frame do not overlap, derived from pass order and dependencies.
+        // Updated together with pass order, changed flag is reset when queried.
+        [[nodiscard]] const RenderTargetAliases& getRenderTargetAliases   () const;
+        [[nodiscard]] bool                  haveRenderTargetAliasesChanged  () const;
+
+        // Level of detail of renderable selected for render pass with last world matrix update, using projected size of its bounding sphere
+        // by pass camera. 0 is full detail, level N is N-th entry of Renderable::levelsOfDetail (1-based).
+        [[nodiscard]] uint32_t              getRenderableLevelOfDetail      (RenderPassHandle pass, RenderableHandle renderable) const;
+        // Level for screen size (projected diameter of bounding sphere as fraction of viewport height), previously selected level
+        // is kept as long as screen size is within relative hysteresis band around all thresholds between the previous and new level
+        [[nodiscard]] static uint32_t       SelectLevelOfDetail             (const RenderableLevelsOfDetail& levelsOfDetail, float screenSize, uint32_t previousLevel);
+        static constexpr float              LevelOfDetailHysteresis = 0.1f;
+
+        // Number of renderables skipped by RenderExecutor because their bounding sphere was outside of camera frustum
+        void                                renderableCulled                () const;
+        [[nodiscard]] uint32_t              getAndResetCulledRenderablesCount() const;
+
+        // Byte range of data buffer modified since last upload, empty if nothing to upload
+        struct DataBufferUpdate
+        {
+            uint32_t offsetInBytes = 0u;
+            uint32_t sizeInBytes = 0u;
+        };
+
+        const DataBufferUpdate& getDataBufferUpdate(DataBufferHandle handle) const
+        {
+            assert(handle.asMemoryHandle() < m_dataBufferUpdates.size());
+            return m_dataBufferUpdates[handle.asMemoryHandle()];
+        }
+
+        void popDataBufferUpdate(DataBufferHandle handle) const
+        {
+            assert(handle.asMemoryHandle() < m_dataBufferUpdates.size());
+            m_dataBufferUpdates[handle.asMemoryHandle()] = {};
+        }
+
+        // Whole buffer has to be uploaded with next update, e.g. after (re-)creating its device resource
+        void markDataBufferFullyDirty(DataBufferHandle handle) const;
+
+        // Per mip level areas modified since last upload, overlapping areas are merged,
+        // too many areas in one mip are collapsed to their bounding quad
+        using TextureBufferMipUpdate = std::vector<Quad>;
+        using TextureBufferUpdate = std::vector<TextureBufferMipUpdate>;
+        static constexpr size_t MaxTextureBufferUpdateQuadsPerMip = 16u;
 
         const TextureBufferUpdate& getTextureBufferUpdate(TextureBufferHandle handle) const
         {
@@ -89,29 +200,104 @@ namespace ramses::internal
         {
             assert(handle.asMemoryHandle() < getTextureBufferCount());
             for (auto& mip : m_textureBufferUpdates[handle.asMemoryHandle()])
-                mip = {};
+                mip.clear();
         }
 
+        // All mip levels have to be uploaded completely with next update, e.g. after (re-)creating its device resource
+        void markTextureBufferFullyDirty(TextureBufferHandle handle) const;
+
     private:
         void updatePassRenderableSorting();
+        void limitRenderOncePassesInSortedPasses();
         void updateRenderablesInPass(RenderPassHandle passHandle);
+        void updateRenderablesInContentDirtyPasses();
+        [[nodiscard]] bool containsContentDirtyRenderGroup(const RenderGroupOrderVector& renderGroups) const;
+        void markRenderGroupContentDirty(RenderGroupHandle groupHandle);
+        void markRenderPassContentDirty(RenderPassHandle passHandle);
         void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        void sortRenderablesByState(RenderableVector& orderedRenderables);
+        uint64_t computeRenderableStateSortKey(RenderableHandle renderable);
+        uint16_t computeStateSortTexturesIndex(DataInstanceHandle uniformsInstance);
+        void sortDepthSortedPasses();
+        void sortRenderablesByDepth(RenderPassHandle passHandle);
+        bool sortRenderableSlotsByDepth(RenderableVector& orderedRenderables, const glm::mat4& viewMatrix, bool transparent);
+        void radixSortDepthKeys();
+        void selectLevelsOfDetail();
+        void selectLevelsOfDetailInPass(RenderPassHandle passHandle);
         bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void updateRenderingPassesOutputUsage();
+        [[nodiscard]] bool isAnyRenderTargetBufferConsumed(RenderTargetHandle renderTarget) const;
+        void markRenderTargetBuffersConsumed(RenderTargetHandle renderTarget);
+        void markRenderBuffersSampledByRenderable(RenderableHandle renderable);
+        [[nodiscard]] bool doesSamplerReferToRenderBuffer(TextureSamplerHandle sampler) const;
+        static void AddTextureBufferMipUpdate(TextureBufferMipUpdate& mipUpdate, const Quad& area);
+        void updateRenderTargetAliases();
+        void updateRenderingPassesColorDiscard();
+        void collectRenderBuffersSampledByRenderPasses();
+        [[nodiscard]] bool isColorBufferReadAfterPass(RenderBufferHandle buffer, size_t sortedPassIdx) const;
+        [[nodiscard]] bool areRenderTargetBuffersCompatible(const RenderBufferHandleVector& buffers1, const RenderBufferHandleVector& buffers2) const;
 
         RenderingPassInfoVector m_sortedRenderingPasses;
+        std::vector<bool>       m_sortedRenderingPassesOutputUsed;
+        std::vector<bool>       m_consumedRenderBuffers;
+        std::vector<bool>       m_sortedRenderingPassesColorDiscard;
+        // per sorted rendering pass, scratch used when pass order is updated
+        std::vector<RenderBufferHandleVector> m_renderBuffersSampledByPass;
+        RenderTargetAliases     m_renderTargetAliases;
+        mutable bool            m_renderTargetAliasesChanged = false;
         using PassRenderableOrder = std::vector<RenderableVector>;
         PassRenderableOrder     m_passRenderableOrder;
         mutable bool            m_renderableOrderingDirty;
+        bool                    m_hasStateSortedPasses = false;
+        bool                    m_hasDepthSortedPasses = false;
+
+        // changes of render group content which require rebuild only of passes containing them,
+        // flags are indexed by handle and reset after each update
+        bool                    m_renderPassContentDirty = false;
+        std::vector<bool>       m_contentDirtyRenderPasses;
+        std::vector<bool>       m_contentDirtyRenderGroups;
+        std::vector<bool>       m_shownRenderables;
+        bool                    m_renderablesShown = false;
+        bool                    m_renderablesHidden = false;
+
+        // scratch containers for state sorting, kept to avoid re-allocations
+        using StateSortKeys = std::vector<std::pair<uint64_t, RenderableHandle>>;
+        StateSortKeys                          m_stateSortKeys;
+        HashMap<ResourceContentHash, uint16_t> m_stateSortEffectIndices;
+        HashMap<std::size_t, uint16_t>         m_stateSortTextureIndices;
+
+        // scratch containers for depth sorting, radix key of depth per renderable and positions of sorted renderables in pass
+        using DepthSortKeys = std::vector<std::pair<uint32_t, RenderableHandle>>;
+        DepthSortKeys                          m_depthSortKeys;
+        DepthSortKeys                          m_depthSortScratch;
+        std::vector<size_t>                    m_depthSortSlots;
+
+        // selected level of detail per render pass (indexed by handle), only for renderables with levels of detail
+        using LevelsOfDetailSelection = HashMap<RenderableHandle, uint32_t>;
+        std::vector<LevelsOfDetailSelection>   m_passLevelsOfDetail;
+        bool                                   m_hasLevelOfDetailRenderables = false;
+
+        mutable std::vector<RecordedRenderPass> m_recordedRenderPasses;
+        mutable uint64_t                        m_renderPassRecordingGeneration = 0u;
+        mutable uint32_t                        m_culledRenderablesCount = 0u;
+        mutable uint32_t                        m_skippedRenderingPassesCount = 0u;
 
         using MatrixVector = std::vector<glm::mat4>;
         MatrixVector            m_renderableMatrices;
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
+        uint32_t m_renderOncePassesPerFrameLimit = 0u;
+        bool m_renderOncePassesWarmUp = false;
+        // render once passes in sorted passes, only these are marked as rendered if some are left for following frames
+        std::vector<RenderPassHandle> m_renderOncePassesScheduled;
+        bool m_hasDeferredRenderOncePasses = false;
 
+        mutable std::vector<DataBufferUpdate>    m_dataBufferUpdates;
         mutable std::vector<TextureBufferUpdate> m_textureBufferUpdates;
 
         bool m_hasActiveShaderAnimation = false;
+        mutable bool m_hasActiveFiniteShaderAnimation = false;
     };
 
     inline void RendererCachedScene::setActiveShaderAnimation(bool hasAnimation)
@@ -121,6 +307,11 @@ namespace ramses::internal
 
     inline bool RendererCachedScene::hasActiveShaderAnimation() const
     {
-        return m_hasActiveShaderAnimation;
+        return m_hasActiveShaderAnimation || m_hasActiveFiniteShaderAnimation;
+    }
+
+    inline void RendererCachedScene::setActiveFiniteShaderAnimation(bool hasAnimation) const
+    {
+        m_hasActiveFiniteShaderAnimation = hasAnimation;
     }
 }
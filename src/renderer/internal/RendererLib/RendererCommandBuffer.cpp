@@ -12,10 +12,21 @@ namespace ramses::internal
 {
     void RendererCommandBuffer::addAndConsumeCommandsFrom(RendererCommands& cmds)
     {
-        std::lock_guard<std::mutex> lock(m_lock);
-        m_commands.insert(m_commands.end(), std::make_move_iterator(cmds.begin()), std::make_move_iterator(cmds.end()));
+        if (cmds.empty())
+            return;
+
+        bool consumerWaiting = false;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            // batch is handed over as whole if consumer took all commands already (common case), no per command move
+            if (m_commands.empty())
+                m_commands.swap(cmds);
+            else
+                m_commands.insert(m_commands.end(), std::make_move_iterator(cmds.begin()), std::make_move_iterator(cmds.end()));
+            consumerWaiting = m_consumerWaiting;
+        }
         cmds.clear();
-        m_newCommandsCvar.notify_all();
+        notifyConsumerIfWaiting(consumerWaiting);
     }
 
     void RendererCommandBuffer::swapCommands(RendererCommands& cmds)
@@ -27,15 +38,26 @@ namespace ramses::internal
     void RendererCommandBuffer::blockingSwapCommands(RendererCommands& cmds, std::chrono::milliseconds timeout)
     {
         std::unique_lock<std::mutex> lock{m_lock};
+        m_consumerWaiting = true;
         m_newCommandsCvar.wait_for(lock, timeout, [&]() { return !m_commands.empty() || m_interruptBlockingSwapCommands; });
+        m_consumerWaiting = false;
         m_interruptBlockingSwapCommands = false;
         m_commands.swap(cmds);
     }
 
     void RendererCommandBuffer::interruptBlockingSwapCommands()
     {
-        std::unique_lock<std::mutex> lock{m_lock};
-        m_interruptBlockingSwapCommands = true;
+        {
+            std::lock_guard<std::mutex> lock{m_lock};
+            m_interruptBlockingSwapCommands = true;
+        }
         m_newCommandsCvar.notify_all();
     }
+
+    void RendererCommandBuffer::notifyConsumerIfWaiting(bool consumerWaiting)
+    {
+        // notified outside of lock so that woken up consumer does not block on it right away
+        if (consumerWaiting)
+            m_newCommandsCvar.notify_all();
+    }
 }
@@ -14,6 +14,8 @@
 
 namespace ramses::internal
 {
+    // Producers (API, framework logic, ramsh) and consumer (dispatcher) only exchange whole batches under the lock,
+    // commands are never constructed or processed while holding it. Consumer is woken up only if it waits for commands.
     class RendererCommandBuffer
     {
     public:
@@ -26,18 +28,26 @@ namespace ramses::internal
         void interruptBlockingSwapCommands();
 
     private:
+        void notifyConsumerIfWaiting(bool consumerWaiting);
+
         std::mutex m_lock;
         RendererCommands m_commands;
 
         std::condition_variable m_newCommandsCvar;
+        bool m_consumerWaiting = false;
         bool m_interruptBlockingSwapCommands = false;
     };
 
     template <typename T>
     void RendererCommandBuffer::enqueueCommand(T cmd)
     {
-        std::lock_guard<std::mutex> lock(m_lock);
-        m_commands.push_back(std::move(cmd));
-        m_newCommandsCvar.notify_all();
+        RendererCommand::Variant command{ std::move(cmd) };
+        bool consumerWaiting = false;
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_commands.push_back(std::move(command));
+            consumerWaiting = m_consumerWaiting;
+        }
+        notifyConsumerIfWaiting(consumerWaiting);
     }
 }
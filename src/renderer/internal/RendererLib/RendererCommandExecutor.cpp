@@ -182,6 +182,13 @@ namespace ramses::internal
         m_sceneUpdater.handleExternalBufferDestroyRequest(cmd.externalBuffer);
     }
 
+    void RendererCommandExecutor::operator()(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd)
+    {
+        // log debug only to reduce spam, commanded for every frame of the producer
+        LOG_DEBUG(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_sceneUpdater.handleExternalBufferDmaBufferUpdate(cmd.externalBuffer, cmd.frame);
+    }
+
     void RendererCommandExecutor::operator()(const RendererCommand::SetClearFlags& cmd)
     {
         LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
@@ -194,6 +201,24 @@ namespace ramses::internal
         m_sceneUpdater.handleSetClearColor(cmd.offscreenBuffer, cmd.clearColor);
     }
 
+    void RendererCommandExecutor::operator()(const RendererCommand::SetRenderRateDivisor& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_sceneUpdater.handleSetRenderRateDivisor(cmd.offscreenBuffer, cmd.divisor);
+    }
+
+    void RendererCommandExecutor::operator()(const RendererCommand::SetOffscreenBufferScalable& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_sceneUpdater.handleSetOffscreenBufferScalable(cmd.offscreenBuffer, cmd.scalable);
+    }
+
+    void RendererCommandExecutor::operator()(const RendererCommand::SetDmaOffscreenBufferSyncFence& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_sceneUpdater.handleSetDmaOffscreenBufferSyncFence(cmd.offscreenBuffer, cmd.enable);
+    }
+
     void RendererCommandExecutor::operator()(const RendererCommand::SetExterallyOwnedWindowSize& cmd)
     {
         LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
@@ -208,6 +233,7 @@ namespace ramses::internal
         screenshot.filename = std::move(cmd.filename);
         screenshot.sendViaDLT = cmd.sendViaDLT;
         screenshot.fullScreen = cmd.fullScreen;
+        screenshot.async = cmd.async;
         m_sceneUpdater.handleReadPixels(cmd.offscreenBuffer, std::move(screenshot));
     }
 
@@ -217,6 +243,30 @@ namespace ramses::internal
         m_sceneUpdater.setSkippingOfUnmodifiedScenes(cmd.enable);
     }
 
+    void RendererCommandExecutor::operator()(const RendererCommand::SetGpuTimerQueries& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_renderer.setGpuTimerQueriesEnabled(cmd.enable);
+    }
+
+    void RendererCommandExecutor::operator()(const RendererCommand::TrimMemory& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_sceneUpdater.handleTrimMemory();
+    }
+
+    void RendererCommandExecutor::operator()(const RendererCommand::SetSkippingOfUnusedRenderPasses& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_renderer.setSkippingOfUnusedRenderingPasses(cmd.enable);
+    }
+
+    void RendererCommandExecutor::operator()(const RendererCommand::SetPartialRedraw& cmd)
+    {
+        LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
+        m_renderer.setPartialRedrawEnabled(cmd.enable);
+    }
+
     void RendererCommandExecutor::operator()(const RendererCommand::LogStatistics& cmd)
     {
         LOG_INFO(CONTEXT_RENDERER, " - executing {}", RendererCommandUtils::ToString(cmd));
@@ -49,11 +49,19 @@ namespace ramses::internal
         void operator()(const RendererCommand::DestroyStreamBuffer& cmd);
         void operator()(const RendererCommand::CreateExternalBuffer& cmd);
         void operator()(const RendererCommand::DestroyExternalBuffer& cmd);
+        void operator()(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd);
         void operator()(const RendererCommand::SetClearFlags& cmd);
         void operator()(const RendererCommand::SetClearColor& cmd);
+        void operator()(const RendererCommand::SetRenderRateDivisor& cmd);
+        void operator()(const RendererCommand::SetOffscreenBufferScalable& cmd);
+        void operator()(const RendererCommand::SetDmaOffscreenBufferSyncFence& cmd);
         void operator()(const RendererCommand::SetExterallyOwnedWindowSize& cmd);
         void operator()(RendererCommand::ReadPixels& cmd);
         void operator()(const RendererCommand::SetSkippingOfUnmodifiedBuffers& cmd);
+        void operator()(const RendererCommand::SetGpuTimerQueries& cmd);
+        void operator()(const RendererCommand::TrimMemory& cmd);
+        void operator()(const RendererCommand::SetSkippingOfUnusedRenderPasses& cmd);
+        void operator()(const RendererCommand::SetPartialRedraw& cmd);
         void operator()(const RendererCommand::LogStatistics& cmd);
         void operator()(const RendererCommand::LogInfo& cmd);
         void operator()(const RendererCommand::SCListIviSurfaces& cmd);
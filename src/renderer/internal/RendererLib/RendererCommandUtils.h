@@ -40,12 +40,21 @@ namespace ramses::internal
         inline std::string ToString(const RendererCommand::DestroyStreamBuffer& cmd) { return fmt::format("DestroyStreamBuffer (displayId={} SB={})", cmd.display, cmd.streamBuffer); }
         inline std::string ToString(const RendererCommand::CreateExternalBuffer& cmd) { return fmt::format("CreateExternalBuffer (displayId={} EB={})", cmd.display, cmd.externalBuffer); }
         inline std::string ToString(const RendererCommand::DestroyExternalBuffer& cmd) { return fmt::format("DestroyExternalBuffer (displayId={} EB={})", cmd.display, cmd.externalBuffer); }
+        inline std::string ToString(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd) { return fmt::format("UpdateExternalBufferDmaBuffer (displayId={} EB={} fd={} res={}x{} format={} stride={} modifiers={})",
+            cmd.display, cmd.externalBuffer, cmd.frame.fd, cmd.frame.width, cmd.frame.height, cmd.frame.fourccFormat.getValue(), cmd.frame.stride, cmd.frame.modifiers.getValue()); }
         inline std::string ToString(const RendererCommand::SetClearFlags& cmd) { return fmt::format("SetClearEnabled (displayId={} OB={} flags={})", cmd.display, cmd.offscreenBuffer, cmd.clearFlags); }
         inline std::string ToString(const RendererCommand::SetClearColor& cmd) { return fmt::format("SetClearColor (displayId={} OB={} color={})", cmd.display, cmd.offscreenBuffer, cmd.clearColor); }
+        inline std::string ToString(const RendererCommand::SetRenderRateDivisor& cmd) { return fmt::format("SetRenderRateDivisor (displayId={} OB={} divisor={})", cmd.display, cmd.offscreenBuffer, cmd.divisor); }
+        inline std::string ToString(const RendererCommand::SetOffscreenBufferScalable& cmd) { return fmt::format("SetOffscreenBufferScalable (displayId={} OB={} scalable={})", cmd.display, cmd.offscreenBuffer, cmd.scalable); }
+        inline std::string ToString(const RendererCommand::SetDmaOffscreenBufferSyncFence& cmd) { return fmt::format("SetDmaOffscreenBufferSyncFence (displayId={} OB={} enable={})", cmd.display, cmd.offscreenBuffer, cmd.enable); }
         inline std::string ToString(const RendererCommand::SetExterallyOwnedWindowSize& cmd) { return fmt::format("SetExterallyOwnedWindowSize (displayId={} width={} height={})", cmd.display, cmd.width, cmd.height); }
         inline std::string ToString(const RendererCommand::ReadPixels& cmd) { return fmt::format("ReadPixels (displayId={} OB={})", cmd.display, cmd.offscreenBuffer); }
         inline std::string ToString(const RendererCommand::SetSkippingOfUnmodifiedBuffers& cmd) { return fmt::format("SetSkippingOfUnmodifiedBuffers (enable={})", cmd.enable); }
+        inline std::string ToString(const RendererCommand::SetGpuTimerQueries& cmd) { return fmt::format("SetGpuTimerQueries (enable={})", cmd.enable); }
+        inline std::string ToString(const RendererCommand::SetSkippingOfUnusedRenderPasses& cmd) { return fmt::format("SetSkippingOfUnusedRenderPasses (enable={})", cmd.enable); }
+        inline std::string ToString(const RendererCommand::SetPartialRedraw& cmd) { return fmt::format("SetPartialRedraw (enable={})", cmd.enable); }
         inline std::string ToString(const RendererCommand::LogStatistics& /*unused*/) { return "LogStatistics"; }
+        inline std::string ToString(const RendererCommand::TrimMemory& /*unused*/) { return "TrimMemory"; }
         inline std::string ToString(const RendererCommand::LogInfo& /*unused*/) { return "LogInfo"; }
         inline std::string ToString(const RendererCommand::SCListIviSurfaces& /*unused*/) { return "SCListIviSurfaces"; }
         inline std::string ToString(const RendererCommand::SCSetIviSurfaceVisibility& cmd) { return fmt::format("SCSetIviSurfaceVisibility (surfaceId={} visibility={})", cmd.surface, cmd.visibility); }
@@ -136,6 +145,17 @@ namespace ramses::internal
             return evt;
         }
         template <>
+        inline RendererEvent GenerateFailEventForCommand<RendererCommand::UpdateExternalBufferDmaBuffer>(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd)
+        {
+            // DMA buffer was never used, give it back to application right away
+            RendererEvent evt{ ERendererEventType::ExternalBufferDmaBufferReleased };
+            evt.displayHandle = cmd.display;
+            evt.externalBuffer = cmd.externalBuffer;
+            evt.dmaBufferFD = cmd.frame.fd;
+            evt.syncFenceFD = -1;
+            return evt;
+        }
+        template <>
         inline RendererEvent GenerateFailEventForCommand<RendererCommand::ReadPixels>(const RendererCommand::ReadPixels& cmd)
         {
             RendererEvent evt{ ERendererEventType::ReadPixelsFromFramebufferFailed };
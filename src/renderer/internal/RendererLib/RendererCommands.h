@@ -176,6 +176,13 @@ namespace ramses::internal
             ExternalBufferHandle externalBuffer;
         };
 
+        struct UpdateExternalBufferDmaBuffer
+        {
+            DisplayHandle display;
+            ExternalBufferHandle externalBuffer;
+            DmaBufferFrame frame;
+        };
+
         struct SetClearFlags
         {
             DisplayHandle display;
@@ -190,6 +197,27 @@ namespace ramses::internal
             glm::vec4 clearColor;
         };
 
+        struct SetRenderRateDivisor
+        {
+            DisplayHandle display;
+            OffscreenBufferHandle offscreenBuffer;
+            uint32_t divisor = 1u;
+        };
+
+        struct SetOffscreenBufferScalable
+        {
+            DisplayHandle display;
+            OffscreenBufferHandle offscreenBuffer;
+            bool scalable = false;
+        };
+
+        struct SetDmaOffscreenBufferSyncFence
+        {
+            DisplayHandle display;
+            OffscreenBufferHandle offscreenBuffer;
+            bool enable = false;
+        };
+
         struct SetExterallyOwnedWindowSize
         {
             DisplayHandle display;
@@ -208,6 +236,7 @@ namespace ramses::internal
             bool fullScreen;
             bool sendViaDLT;
             std::string filename;
+            bool async = false;
         };
 
         struct SetSkippingOfUnmodifiedBuffers
@@ -215,6 +244,26 @@ namespace ramses::internal
             bool enable;
         };
 
+        struct SetGpuTimerQueries
+        {
+            bool enable;
+        };
+
+        struct TrimMemory
+        {
+            bool _dummyValue = false; // work around unsolved gcc bug https://bugzilla.redhat.com/show_bug.cgi?id=1507359
+        };
+
+        struct SetSkippingOfUnusedRenderPasses
+        {
+            bool enable;
+        };
+
+        struct SetPartialRedraw
+        {
+            bool enable;
+        };
+
         struct LogStatistics
         {
             bool _dummyValue = false; // work around unsolved gcc bug https://bugzilla.redhat.com/show_bug.cgi?id=1507359
@@ -332,11 +381,19 @@ namespace ramses::internal
             DestroyStreamBuffer,
             CreateExternalBuffer,
             DestroyExternalBuffer,
+            UpdateExternalBufferDmaBuffer,
             SetClearFlags,
             SetClearColor,
+            SetRenderRateDivisor,
+            SetOffscreenBufferScalable,
+            SetDmaOffscreenBufferSyncFence,
             SetExterallyOwnedWindowSize,
             ReadPixels,
             SetSkippingOfUnmodifiedBuffers,
+            SetGpuTimerQueries,
+            TrimMemory,
+            SetSkippingOfUnusedRenderPasses,
+            SetPartialRedraw,
             LogStatistics,
             LogInfo,
             SCListIviSurfaces,
@@ -50,4 +50,24 @@ namespace ramses::internal
     {
         return m_renderThreadLoopTimingReportingPeriod;
     }
+
+    void RendererConfigData::setResourceDecompressionThreadScheduling(const ThreadScheduling& scheduling)
+    {
+        m_resourceDecompressionThreadScheduling = scheduling;
+    }
+
+    const ThreadScheduling& RendererConfigData::getResourceDecompressionThreadScheduling() const
+    {
+        return m_resourceDecompressionThreadScheduling;
+    }
+
+    void RendererConfigData::setDisplayRestartCacheEnabled(bool enabled)
+    {
+        m_displayRestartCacheEnabled = enabled;
+    }
+
+    bool RendererConfigData::isDisplayRestartCacheEnabled() const
+    {
+        return m_displayRestartCacheEnabled;
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/Types.h"
+#include "internal/PlatformAbstraction/ThreadScheduling.h"
 
 #include <chrono>
 #include <string>
@@ -29,10 +30,18 @@ namespace ramses::internal
         void setRenderthreadLooptimingReportingPeriod(std::chrono::milliseconds period);
         [[nodiscard]] std::chrono::milliseconds getRenderThreadLoopTimingReportingPeriod() const;
 
+        void setResourceDecompressionThreadScheduling(const ThreadScheduling& scheduling);
+        [[nodiscard]] const ThreadScheduling& getResourceDecompressionThreadScheduling() const;
+
+        void setDisplayRestartCacheEnabled(bool enabled);
+        [[nodiscard]] bool isDisplayRestartCacheEnabled() const;
+
     private:
         std::string m_waylandDisplayForSystemCompositorController;
         bool m_systemCompositorEnabled = false;
         std::chrono::microseconds m_frameCallbackMaxPollTime{10000u};
         std::chrono::milliseconds m_renderThreadLoopTimingReportingPeriod { 0 }; // zero deactivates reporting
+        ThreadScheduling m_resourceDecompressionThreadScheduling;
+        bool m_displayRestartCacheEnabled = false;
     };
 }
@@ -19,6 +19,8 @@
 #include "internal/RendererLib/Enums/EKeyCode.h"
 #include "internal/RendererLib/Enums/EKeyModifier.h"
 #include "internal/RendererLib/DisplayConfigData.h"
+#include "internal/RendererLib/GpuMemoryReport.h"
+#include "internal/Components/FlushTimeInformation.h"
 #include "internal/Core/Utils/LoggingUtils.h"
 #include <chrono>
 
@@ -63,6 +65,7 @@ namespace ramses::internal
         SceneHideFailed,
 
         SceneFlushed,
+        SceneResourcesComplete,
         SceneExpirationMonitoringEnabled,
         SceneExpirationMonitoringDisabled,
         SceneExpired,
@@ -87,6 +90,11 @@ namespace ramses::internal
         StreamSurfaceUnavailable,
         ObjectsPicked,
         FrameTimingReport,
+        GpuMemoryReport,
+        SceneFlushPresented,
+        MemoryTrimmed,
+        DmaOffscreenBufferRendered,
+        ExternalBufferDmaBufferReleased,
     };
 
     const std::array RendererEventTypeNames =
@@ -125,6 +133,7 @@ namespace ramses::internal
         "SceneHiddenAsResultOfUnpublish",
         "SceneHideFailed",
         "SceneFlushed",
+        "SceneResourcesComplete",
         "SceneExpirationMonitoringEnabled",
         "SceneExpirationMonitoringDisabled",
         "SceneExpired",
@@ -149,6 +158,11 @@ namespace ramses::internal
         "StreamSurfaceUnavailable",
         "ObjectsPicked",
         "FrameTimingReport",
+        "GpuMemoryReport",
+        "SceneFlushPresented",
+        "MemoryTrimmed",
+        "DmaOffscreenBufferRendered",
+        "ExternalBufferDmaBufferReleased",
     };
 
     struct MouseEvent
@@ -180,6 +194,17 @@ namespace ramses::internal
     {
         std::chrono::microseconds maximumLoopTimeWithinPeriod;
         std::chrono::microseconds averageLoopTimeWithinPeriod;
+        std::chrono::microseconds loopTimePercentile50{ 0 };
+        std::chrono::microseconds loopTimePercentile90{ 0 };
+        std::chrono::microseconds loopTimePercentile99{ 0 };
+    };
+
+    struct FlushPresentation
+    {
+        // time the frame containing the flush was presented on display, converted to flush time clock
+        FlushTime::Clock::time_point presentationTimestamp = FlushTime::InvalidTimestamp;
+        // from flush on client side to presentation
+        std::chrono::microseconds latency{ 0 };
     };
 
     struct RendererEvent
@@ -211,8 +236,12 @@ namespace ramses::internal
         WaylandIviSurfaceId         streamSourceId;
         PickableObjectIds           pickedObjectIds;
         FrameTimings                frameTimings{};
+        GpuMemoryReport             gpuMemoryReport;
+        FlushPresentation           flushPresentation;
+        uint64_t                    freedMemory = 0u;
         int                         dmaBufferFD = -1;
         uint32_t                    dmaBufferStride = 0u;
+        int                         syncFenceFD = -1;
         uint32_t                    textureGlId = 0u;
     };
     using RendererEventVector = std::vector<RendererEvent>;
@@ -225,4 +254,4 @@ namespace ramses::internal
     using InternalSceneStateEvents = std::vector<InternalSceneStateEvent>;
 }
 
-MAKE_ENUM_CLASS_PRINTABLE(ramses::internal::ERendererEventType, "ERendererEventType", ramses::internal::RendererEventTypeNames, ramses::internal::ERendererEventType::FrameTimingReport);
+MAKE_ENUM_CLASS_PRINTABLE(ramses::internal::ERendererEventType, "ERendererEventType", ramses::internal::RendererEventTypeNames, ramses::internal::ERendererEventType::ExternalBufferDmaBufferReleased);
@@ -13,11 +13,19 @@ namespace ramses::internal
 {
     void RendererEventCollector::appendAndConsumePendingEvents(RendererEventVector& rendererEvents, RendererEventVector& sceneControlEvents)
     {
-        rendererEvents.insert(rendererEvents.end(), m_rendererEvents.cbegin(), m_rendererEvents.cend());
-        m_rendererEvents.clear();
+        AppendAndConsume(rendererEvents, m_rendererEvents);
+        AppendAndConsume(sceneControlEvents, m_sceneControlEvents);
+    }
 
-        sceneControlEvents.insert(sceneControlEvents.end(), m_sceneControlEvents.cbegin(), m_sceneControlEvents.cend());
-        m_sceneControlEvents.clear();
+    void RendererEventCollector::AppendAndConsume(RendererEventVector& destination, RendererEventVector& source)
+    {
+        // events are moved (they can hold display config, pixel data, picked IDs), if destination holds no events
+        // both vectors are just swapped so that in steady state both keep their capacity and no allocation happens
+        if (destination.empty())
+            destination.swap(source);
+        else
+            destination.insert(destination.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+        source.clear();
     }
 
     void RendererEventCollector::dispatchInternalSceneStateEvents(InternalSceneStateEvents& resultEvents)
@@ -79,6 +87,15 @@ namespace ramses::internal
         pushToSceneControlEventQueue(std::move(event));
     }
 
+    void RendererEventCollector::addSceneResourcesEvent(ERendererEventType eventType, SceneId sceneId)
+    {
+        LOG_INFO(CONTEXT_RENDERER, "{} sceneId={}", eventType, sceneId);
+
+        RendererEvent event(eventType);
+        event.sceneId = sceneId;
+        pushToSceneControlEventQueue(std::move(event));
+    }
+
     void RendererEventCollector::addDataLinkEvent(ERendererEventType eventType, SceneId providerSceneId, SceneId consumerSceneId, DataSlotId providerdataId, DataSlotId consumerdataId)
     {
         LOG_INFO(CONTEXT_RENDERER, "{} providerSceneId={} providerDataId={} consumerSceneId={} consumerDataId={}", eventType, providerSceneId, providerdataId.getValue(), consumerSceneId, consumerdataId.getValue());
@@ -205,12 +222,59 @@ namespace ramses::internal
         pushToSceneControlEventQueue(std::move(event));
     }
 
-    void RendererEventCollector::addFrameTimingReport(DisplayHandle display, std::chrono::microseconds maxLoopTime, std::chrono::microseconds avgLooptime)
+    void RendererEventCollector::addFrameTimingReport(DisplayHandle display, const FrameTimings& frameTimings)
     {
         RendererEvent event{ ERendererEventType::FrameTimingReport };
-        event.frameTimings.maximumLoopTimeWithinPeriod = maxLoopTime;
-        event.frameTimings.averageLoopTimeWithinPeriod = avgLooptime;
+        event.frameTimings = frameTimings;
+        event.displayHandle = display;
+        pushToRendererEventQueue(std::move(event));
+    }
+
+    void RendererEventCollector::addGpuMemoryReport(DisplayHandle display, GpuMemoryReport&& gpuMemoryReport)
+    {
+        RendererEvent event{ ERendererEventType::GpuMemoryReport };
+        event.gpuMemoryReport = std::move(gpuMemoryReport);
+        event.displayHandle = display;
+        pushToRendererEventQueue(std::move(event));
+    }
+
+    void RendererEventCollector::addSceneFlushPresentedEvent(DisplayHandle display, SceneId sceneId, SceneVersionTag sceneVersionTag, const FlushPresentation& flushPresentation)
+    {
+        RendererEvent event{ ERendererEventType::SceneFlushPresented, sceneId };
+        event.sceneVersionTag = sceneVersionTag;
+        event.flushPresentation = flushPresentation;
+        event.displayHandle = display;
+        pushToRendererEventQueue(std::move(event));
+    }
+
+    void RendererEventCollector::addMemoryTrimmedEvent(DisplayHandle display, uint64_t freedMemory)
+    {
+        RendererEvent event{ ERendererEventType::MemoryTrimmed };
+        event.freedMemory = freedMemory;
+        event.displayHandle = display;
+        pushToRendererEventQueue(std::move(event));
+    }
+
+    void RendererEventCollector::addDmaOffscreenBufferRenderedEvent(DisplayHandle display, OffscreenBufferHandle buffer, int syncFenceFD)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "{} display={} bufferHandle={} syncFenceFD={}", ERendererEventType::DmaOffscreenBufferRendered, display, buffer, syncFenceFD);
+
+        RendererEvent event{ ERendererEventType::DmaOffscreenBufferRendered };
+        event.displayHandle = display;
+        event.offscreenBuffer = buffer;
+        event.syncFenceFD = syncFenceFD;
+        pushToRendererEventQueue(std::move(event));
+    }
+
+    void RendererEventCollector::addExternalBufferDmaBufferReleasedEvent(DisplayHandle display, ExternalBufferHandle externalBuffer, int dmaBufferFD, int releaseFenceFD)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "{} display={} externalBuffer={} dmaBufferFD={} releaseFenceFD={}", ERendererEventType::ExternalBufferDmaBufferReleased, display, externalBuffer, dmaBufferFD, releaseFenceFD);
+
+        RendererEvent event{ ERendererEventType::ExternalBufferDmaBufferReleased };
         event.displayHandle = display;
+        event.externalBuffer = externalBuffer;
+        event.dmaBufferFD = dmaBufferFD;
+        event.syncFenceFD = releaseFenceFD;
         pushToRendererEventQueue(std::move(event));
     }
 
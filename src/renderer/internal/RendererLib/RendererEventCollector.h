@@ -26,6 +26,7 @@ namespace ramses::internal
         void addInternalSceneEvent(ERendererEventType eventType, SceneId sceneId);
         void addSceneEvent(ERendererEventType eventType, SceneId sceneId, RendererSceneState state);
         void addSceneExpirationEvent(ERendererEventType eventType, SceneId sceneId);
+        void addSceneResourcesEvent(ERendererEventType eventType, SceneId sceneId);
         void addDataLinkEvent(ERendererEventType eventType, SceneId providerSceneId, SceneId consumerSceneId, DataSlotId providerdataId, DataSlotId consumerdataId);
         void addBufferEvent(ERendererEventType eventType, OffscreenBufferHandle providerBuffer, SceneId consumerSceneId, DataSlotId consumerdataId);
         void addBufferEvent(ERendererEventType eventType, StreamBufferHandle providerBuffer, SceneId consumerSceneId, DataSlotId consumerdataId);
@@ -39,9 +40,15 @@ namespace ramses::internal
         void addWindowEvent(ERendererEventType eventType, DisplayHandle display, WindowMoveEvent moveEvent);
         void addStreamSourceEvent(ERendererEventType eventType, WaylandIviSurfaceId streamSourceId);
         void addPickedEvent(ERendererEventType eventType, const SceneId& sceneId, PickableObjectIds&& pickedObjectIds);
-        void addFrameTimingReport(DisplayHandle display, std::chrono::microseconds maxLoopTime, std::chrono::microseconds avgLooptime);
+        void addFrameTimingReport(DisplayHandle display, const FrameTimings& frameTimings);
+        void addGpuMemoryReport(DisplayHandle display, GpuMemoryReport&& gpuMemoryReport);
+        void addSceneFlushPresentedEvent(DisplayHandle display, SceneId sceneId, SceneVersionTag sceneVersionTag, const FlushPresentation& flushPresentation);
+        void addMemoryTrimmedEvent(DisplayHandle display, uint64_t freedMemory);
+        void addDmaOffscreenBufferRenderedEvent(DisplayHandle display, OffscreenBufferHandle buffer, int syncFenceFD);
+        void addExternalBufferDmaBufferReleasedEvent(DisplayHandle display, ExternalBufferHandle externalBuffer, int dmaBufferFD, int releaseFenceFD);
 
     private:
+        static void AppendAndConsume(RendererEventVector& destination, RendererEventVector& source);
         void pushToRendererEventQueue(RendererEvent&& newEvent);
         void pushToSceneControlEventQueue(RendererEvent&& newEvent);
         void pushToInternalSceneStateEventQueue(InternalSceneStateEvent&& newEvent);
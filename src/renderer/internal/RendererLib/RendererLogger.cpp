@@ -34,6 +34,7 @@
 #include "internal/RendererLib/RendererEventCollector.h"
 #include "internal/RendererLib/PlatformBase/DeviceResourceMapper.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
 
 namespace ramses::internal
 {
@@ -82,6 +83,9 @@ namespace ramses::internal
         case ERendererLogTopic::MissingResources:
             LogMissingResources(updater, context);
             break;
+        case ERendererLogTopic::GpuMemory:
+            LogGpuMemory(updater, context);
+            break;
         case ERendererLogTopic::RenderQueue:
             LogRenderQueue(updater, context);
             break;
@@ -99,6 +103,7 @@ namespace ramses::internal
             LogSceneStates(updater, context);
             LogClientResources(updater, context);
             LogSceneResources(updater, context);
+            LogGpuMemory(updater, context);
             LogRenderQueue(updater, context);
             LogLinks(updater.m_rendererScenes, context);
             LogReferencedScenes(updater, context);
@@ -614,6 +619,39 @@ namespace ramses::internal
         EndSection("RENDERER MISSING RESOURCES", context);
     }
 
+    static void LogGpuMemoryUsage(RendererLogContext& context, const GpuMemoryReport::Usage& usage)
+    {
+        context << usage.getTotal() / 1024 << " KB (textures " << usage.textures / 1024 << " KB, buffers " << usage.buffers / 1024
+            << " KB, render targets " << usage.renderTargets / 1024 << " KB, shaders " << usage.shaders / 1024
+            << " KB, shared " << usage.shared / 1024 << " KB)" << RendererLogContext::NewLine;
+    }
+
+    void RendererLogger::LogGpuMemory(const RendererSceneUpdater& updater, RendererLogContext& context)
+    {
+        if (!updater.hasResourceManager())
+        {
+            context << RendererLogContext::NewLine << "Skipping GPU memory section due to missing resource manager!" << RendererLogContext::NewLine;
+            return;
+        }
+
+        StartSection("RENDERER GPU MEMORY", context);
+        const GpuMemoryReport report = updater.getGpuMemoryReport();
+        context << "Estimated GPU memory usage, GPU cache size " << report.gpuCacheSize / 1024 << " KB" << RendererLogContext::NewLine;
+        context.indent();
+        context << "Total: ";
+        LogGpuMemoryUsage(context, report.getTotal());
+        for (const auto& sceneUsage : report.scenes)
+        {
+            context << "Scene " << sceneUsage.first << ": ";
+            LogGpuMemoryUsage(context, sceneUsage.second);
+        }
+        context << "Unused resources: ";
+        LogGpuMemoryUsage(context, report.unusedResources);
+        context << "Offscreen buffers: " << report.offscreenBuffers / 1024 << " KB" << RendererLogContext::NewLine;
+        context.unindent();
+        EndSection("RENDERER GPU MEMORY", context);
+    }
+
     void RendererLogger::LogRenderQueue(const RendererSceneUpdater& updater, RendererLogContext& context)
     {
         if (!updater.m_renderer.hasDisplayController())
@@ -744,6 +782,16 @@ namespace ramses::internal
             }
             context << RendererLogContext::NewLine;
 
+            context << "- preloading scenes (Ids): ";
+            if (!masterInfo.preloadingSceneReferences.empty())
+            {
+                context << " [ ";
+                for (const auto& scene : masterInfo.preloadingSceneReferences)
+                    context << scene << " ";
+                context << "]";
+            }
+            context << RendererLogContext::NewLine;
+
             context << "- expiration states (Id/state): ";
             if (!masterInfo.expirationStates.empty())
             {
@@ -1090,6 +1138,20 @@ namespace ramses::internal
                 ec.logPeriodicInfo(sos);
             }
 
+            if (updater.hasResourceManager())
+            {
+                const GpuMemoryReport gpuMemory = updater.getGpuMemoryReport();
+                sos << "GPU memory (KB): total " << gpuMemory.getTotal().getTotal() / 1024 << " offscreenBuffers " << gpuMemory.offscreenBuffers / 1024
+                    << " unused " << gpuMemory.unusedResources.getTotal() / 1024 << " cache " << gpuMemory.gpuCacheSize / 1024;
+                for (const auto& sceneUsage : gpuMemory.scenes)
+                {
+                    const auto& usage = sceneUsage.second;
+                    sos << " " << sceneUsage.first << ":[tex " << usage.textures / 1024 << " buf " << usage.buffers / 1024
+                        << " rt " << usage.renderTargets / 1024 << " shd " << usage.shaders / 1024 << " shared " << usage.shared / 1024 << "]";
+                }
+                sos << "\n";
+            }
+
             updater.m_renderer.getStatistics().writeStatsToStream(sos);
             sos << "\nTime budgets:"
                 << " sceneResourceUpload " << int64_t(updater.m_frameTimer.getTimeBudgetForSection(EFrameTimerSectionBudget::SceneResourcesUpload).count()) << "us"
@@ -43,6 +43,7 @@ namespace ramses::internal
         static void LogClientResources(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogSceneResources(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogMissingResources(const RendererSceneUpdater& updater, RendererLogContext& context);
+        static void LogGpuMemory(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogRenderQueue(const RendererSceneUpdater& updater, RendererLogContext& context);
         static void LogRenderQueueOfScenesRenderedToBuffer(const RendererSceneUpdater& updater, RendererLogContext& context, DeviceResourceHandle buffer);
         static void LogLinks(const RendererScenes& scenes, RendererLogContext& context);
@@ -20,6 +20,7 @@
 #include "internal/Core/Utils/LogMacros.h"
 #include "internal/Core/Utils/TextureMathUtils.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include <algorithm>
 #include <memory>
 
 namespace ramses::internal
@@ -113,6 +114,9 @@ namespace ramses::internal
         {
             RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
+            // aliased render targets and buffers have no device resources of their own, they are skipped when unloading
+            m_sceneRenderTargetAliases.remove(sceneId);
+
             for (const auto& rt : sceneResources.getAll<RenderTargetHandle>())
                 unloadRenderTarget(rt, sceneId);
 
@@ -198,14 +202,29 @@ namespace ramses::internal
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
         const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
-        return sceneResources.get(handle);
+        const DeviceResourceHandle deviceHandle = sceneResources.get(handle);
+        if (!deviceHandle.isValid())
+        {
+            const RenderTargetAlias* alias = findRenderTargetAlias(sceneId, handle);
+            if (alias)
+                return sceneResources.get(alias->hostRenderTarget);
+        }
+        return deviceHandle;
     }
 
     DeviceResourceHandle RendererResourceManager::getRenderTargetBufferDeviceHandle(RenderBufferHandle bufferHandle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
         const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
-        return sceneResources.get(bufferHandle).deviceHandle;
+        const DeviceResourceHandle deviceHandle = sceneResources.get(bufferHandle).deviceHandle;
+        if (!deviceHandle.isValid())
+        {
+            size_t bufferIndex = 0u;
+            const RenderTargetAlias* alias = findRenderBufferAlias(sceneId, bufferHandle, bufferIndex);
+            if (alias)
+                return sceneResources.get(alias->hostRenderBuffers[bufferIndex]).deviceHandle;
+        }
+        return deviceHandle;
     }
 
     void RendererResourceManager::getBlitPassRenderTargetsDeviceHandle(BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const
@@ -234,6 +253,8 @@ namespace ramses::internal
     {
         assert(m_offscreenBuffers.isAllocated(bufferHandle));
         const auto& obDescriptor = *m_offscreenBuffers.getMemory(bufferHandle);
+        if (!obDescriptor.isDmaBuffer)
+            return -1;
         return m_renderBackend.getDevice().getDmaRenderBufferFD(obDescriptor.m_colorBufferHandle[0u]);
     }
 
@@ -244,6 +265,15 @@ namespace ramses::internal
         return m_renderBackend.getDevice().getDmaRenderBufferStride(obDescriptor.m_colorBufferHandle[0u]);
     }
 
+    int RendererResourceManager::createDmaOffscreenBufferSyncFence(OffscreenBufferHandle bufferHandle)
+    {
+        assert(m_offscreenBuffers.isAllocated(bufferHandle));
+        const auto& obDescriptor = *m_offscreenBuffers.getMemory(bufferHandle);
+        if (!obDescriptor.isDmaBuffer)
+            return -1;
+        return m_renderBackend.getDevice().createDmaRenderBufferSyncFence(obDescriptor.m_colorBufferHandle[0u]);
+    }
+
     OffscreenBufferHandle RendererResourceManager::getOffscreenBufferHandle(DeviceResourceHandle bufferDeviceHandle) const
     {
         for (OffscreenBufferHandle handle(0u); handle < m_offscreenBuffers.getTotalCount(); ++handle)
@@ -297,6 +327,82 @@ namespace ramses::internal
         return m_resourceRegistry;
     }
 
+    GpuMemoryReport RendererResourceManager::getGpuMemoryReport() const
+    {
+        GpuMemoryReport report;
+        report.gpuCacheSize = m_resourceUploadingManager.getResourceCacheSize();
+
+        for (const auto& descriptorIt : m_resourceRegistry.getAllResourceDescriptors())
+        {
+            const ResourceDescriptor& rd = descriptorIt.value;
+            if (rd.status != EResourceStatus::Uploaded)
+                continue;
+
+            GpuMemoryReport::Usage usage;
+            switch (rd.type)
+            {
+            case EResourceType::Texture2D:
+            case EResourceType::Texture3D:
+            case EResourceType::TextureCube:
+                usage.textures = rd.vramSize;
+                break;
+            case EResourceType::VertexArray:
+            case EResourceType::IndexArray:
+                usage.buffers = rd.vramSize;
+                break;
+            case EResourceType::Effect:
+                usage.shaders = rd.vramSize;
+                break;
+            case EResourceType::Invalid:
+                break;
+            }
+
+            if (rd.sceneUsage.empty())
+            {
+                report.unusedResources += usage;
+                continue;
+            }
+
+            // resource shared by multiple scenes is split evenly, so that sum over all scenes matches total usage,
+            // remainder of the division is attributed to the first scene
+            const auto sceneCount = static_cast<uint64_t>(rd.sceneUsage.size());
+            for (size_t i = 0u; i < rd.sceneUsage.size(); ++i)
+            {
+                GpuMemoryReport::Usage sceneShare;
+                const auto share = [&](uint64_t size) { return size / sceneCount + (i == 0u ? size % sceneCount : 0u); };
+                sceneShare.textures = share(usage.textures);
+                sceneShare.buffers = share(usage.buffers);
+                sceneShare.shaders = share(usage.shaders);
+                if (sceneCount > 1u)
+                    sceneShare.shared = sceneShare.getTotal();
+                report.scenes[rd.sceneUsage[i]] += sceneShare;
+            }
+        }
+
+        for (const auto& sceneResRegistryIt : m_sceneResourceRegistryMap)
+        {
+            const RendererSceneResourceRegistry& sceneResources = sceneResRegistryIt.value;
+            auto& sceneUsage = report.scenes[sceneResRegistryIt.key];
+            sceneUsage.renderTargets += sceneResources.getSceneResourceMemoryUsage(ESceneResourceType_RenderBuffer_WriteOnly);
+            sceneUsage.renderTargets += sceneResources.getSceneResourceMemoryUsage(ESceneResourceType_RenderBuffer_ReadWrite);
+            sceneUsage.buffers += sceneResources.getSceneResourceMemoryUsage(ESceneResourceType_DataBuffer);
+            sceneUsage.textures += sceneResources.getSceneResourceMemoryUsage(ESceneResourceType_TextureBuffer);
+        }
+
+        for (OffscreenBufferHandle handle{ 0u }; handle < m_offscreenBuffers.getTotalCount(); ++handle)
+        {
+            if (m_offscreenBuffers.isAllocated(handle))
+                report.offscreenBuffers += m_offscreenBuffers.getMemory(handle)->m_estimatedVRAMUsage;
+        }
+
+        return report;
+    }
+
+    uint64_t RendererResourceManager::trimMemory()
+    {
+        return m_resourceUploadingManager.unloadAllUnusedResources();
+    }
+
     void RendererResourceManager::uploadRenderTargetBuffer(RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer)
     {
         const uint32_t memSize = renderBuffer.width * renderBuffer.height * GetTexelSizeFromFormat(renderBuffer.format) * std::max(1u, renderBuffer.sampleCount);
@@ -322,10 +428,15 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::unloadRenderTargetBuffer sceneId={} handle={}", sceneId, renderBufferHandle);
 
         assert(m_sceneResourceRegistryMap.contains(sceneId));
+        restoreRenderTargetAliasesUsing(sceneId, RenderTargetHandle::Invalid(), renderBufferHandle);
         RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
-        IDevice& device = m_renderBackend.getDevice();
-        device.deleteRenderBuffer(sceneResources.get(renderBufferHandle).deviceHandle);
+        const DeviceResourceHandle deviceHandle = sceneResources.get(renderBufferHandle).deviceHandle;
+        if (deviceHandle.isValid())
+        {
+            IDevice& device = m_renderBackend.getDevice();
+            device.deleteRenderBuffer(deviceHandle);
+        }
         sceneResources.remove(renderBufferHandle);
     }
 
@@ -358,6 +469,9 @@ namespace ramses::internal
 
         assert(!rtBufferHandles.empty());
         assert(m_sceneResourceRegistryMap.contains(sceneId));
+        // buffers of aliased render target are being shared with new render target, they need their own device memory again
+        for (const auto& rb : rtBufferHandles)
+            restoreRenderTargetAliasesUsing(sceneId, RenderTargetHandle::Invalid(), rb);
         RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
         DeviceHandleVector rtBufferDeviceHandles;
@@ -380,11 +494,141 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::unloadRenderTarget sceneId={} handle={}", sceneId, renderTarget);
 
         assert(m_sceneResourceRegistryMap.contains(sceneId));
+        restoreRenderTargetAliasesUsing(sceneId, renderTarget, RenderBufferHandle::Invalid());
         RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
         const DeviceResourceHandle rtDeviceHandle = sceneResources.get(renderTarget);
+        if (rtDeviceHandle.isValid())
+        {
+            IDevice& device = m_renderBackend.getDevice();
+            device.deleteRenderTarget(rtDeviceHandle);
+        }
+        sceneResources.remove(renderTarget);
+    }
+
+    bool RendererResourceManager::updateRenderTargetAliases(SceneId sceneId, const RenderTargetAliases& aliases)
+    {
+        RenderTargetAliases& currentAliases = m_sceneRenderTargetAliases[sceneId];
+        if (currentAliases == aliases)
+            return false;
+
+        // restore aliases first, render target which was aliased can become host of another alias
+        for (const auto& alias : currentAliases)
+        {
+            if (std::find(aliases.cbegin(), aliases.cend(), alias) == aliases.cend())
+                restoreRenderTargetAlias(sceneId, alias);
+        }
+        for (const auto& alias : aliases)
+        {
+            if (std::find(currentAliases.cbegin(), currentAliases.cend(), alias) == currentAliases.cend())
+                applyRenderTargetAlias(sceneId, alias);
+        }
+        currentAliases = aliases;
+
+        return true;
+    }
+
+    void RendererResourceManager::applyRenderTargetAlias(SceneId sceneId, const RenderTargetAlias& alias)
+    {
+        RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
         IDevice& device = m_renderBackend.getDevice();
+
+        const DeviceResourceHandle rtDeviceHandle = sceneResources.get(alias.renderTarget);
+        assert(rtDeviceHandle.isValid());
         device.deleteRenderTarget(rtDeviceHandle);
-        sceneResources.remove(renderTarget);
+        sceneResources.remove(alias.renderTarget);
+        sceneResources.add(alias.renderTarget, DeviceResourceHandle::Invalid());
+
+        uint32_t savedMemSize = 0u;
+        for (const auto rb : alias.renderBuffers)
+        {
+            const auto rbEntry = sceneResources.get(rb);
+            assert(rbEntry.deviceHandle.isValid());
+            device.deleteRenderBuffer(rbEntry.deviceHandle);
+            savedMemSize += rbEntry.size;
+            sceneResources.remove(rb);
+            sceneResources.add(rb, DeviceResourceHandle::Invalid(), 0u, rbEntry.renderBufferProperties);
+        }
+
+        LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::applyRenderTargetAlias sceneId={} handle={} uses memory of render target {}, saved estimatedSize={}KB",
+            sceneId, alias.renderTarget, alias.hostRenderTarget, savedMemSize / 1024);
+    }
+
+    void RendererResourceManager::restoreRenderTargetAlias(SceneId sceneId, const RenderTargetAlias& alias)
+    {
+        LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::restoreRenderTargetAlias sceneId={} handle={} stops using memory of render target {}",
+            sceneId, alias.renderTarget, alias.hostRenderTarget);
+
+        RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
+        IDevice& device = m_renderBackend.getDevice();
+
+        DeviceHandleVector rtBufferDeviceHandles;
+        rtBufferDeviceHandles.reserve(alias.renderBuffers.size());
+        for (const auto rb : alias.renderBuffers)
+        {
+            const RenderBuffer renderBuffer = sceneResources.get(rb).renderBufferProperties;
+            const uint32_t memSize = renderBuffer.width * renderBuffer.height * GetTexelSizeFromFormat(renderBuffer.format) * std::max(1u, renderBuffer.sampleCount);
+            const DeviceResourceHandle deviceHandle = device.uploadRenderBuffer(renderBuffer.width, renderBuffer.height, renderBuffer.format, renderBuffer.accessMode, renderBuffer.sampleCount);
+            assert(deviceHandle.isValid());
+            sceneResources.remove(rb);
+            sceneResources.add(rb, deviceHandle, memSize, renderBuffer);
+            m_stats.sceneResourceUploaded(sceneId, memSize);
+            rtBufferDeviceHandles.push_back(deviceHandle);
+        }
+
+        const DeviceResourceHandle rtDeviceHandle = device.uploadRenderTarget(rtBufferDeviceHandles);
+        sceneResources.remove(alias.renderTarget);
+        sceneResources.add(alias.renderTarget, rtDeviceHandle);
+    }
+
+    void RendererResourceManager::restoreRenderTargetAliasesUsing(SceneId sceneId, RenderTargetHandle renderTarget, RenderBufferHandle renderBuffer)
+    {
+        RenderTargetAliases* aliases = m_sceneRenderTargetAliases.get(sceneId);
+        if (!aliases)
+            return;
+
+        const auto containsBuffer = [renderBuffer](const RenderBufferHandleVector& buffers) {
+            return std::find(buffers.cbegin(), buffers.cend(), renderBuffer) != buffers.cend();
+        };
+        for (auto it = aliases->begin(); it != aliases->end();)
+        {
+            const bool isUsed = (renderTarget.isValid() && (it->renderTarget == renderTarget || it->hostRenderTarget == renderTarget))
+                || (renderBuffer.isValid() && (containsBuffer(it->renderBuffers) || containsBuffer(it->hostRenderBuffers)));
+            if (isUsed)
+            {
+                restoreRenderTargetAlias(sceneId, *it);
+                it = aliases->erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    const RenderTargetAlias* RendererResourceManager::findRenderTargetAlias(SceneId sceneId, RenderTargetHandle renderTarget) const
+    {
+        const RenderTargetAliases* aliases = m_sceneRenderTargetAliases.get(sceneId);
+        if (!aliases)
+            return nullptr;
+
+        const auto it = std::find_if(aliases->cbegin(), aliases->cend(), [renderTarget](const RenderTargetAlias& alias) { return alias.renderTarget == renderTarget; });
+        return it != aliases->cend() ? &*it : nullptr;
+    }
+
+    const RenderTargetAlias* RendererResourceManager::findRenderBufferAlias(SceneId sceneId, RenderBufferHandle renderBuffer, size_t& bufferIndexOut) const
+    {
+        const RenderTargetAliases* aliases = m_sceneRenderTargetAliases.get(sceneId);
+        if (!aliases)
+            return nullptr;
+
+        for (const auto& alias : *aliases)
+        {
+            const auto it = std::find(alias.renderBuffers.cbegin(), alias.renderBuffers.cend(), renderBuffer);
+            if (it != alias.renderBuffers.cend())
+            {
+                bufferIndexOut = static_cast<size_t>(std::distance(alias.renderBuffers.cbegin(), it));
+                return &alias;
+            }
+        }
+        return nullptr;
     }
 
     void RendererResourceManager::uploadDmaOffscreenBuffer(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, DmaBufferFourccFormat dmaBufferFourccFormat, DmaBufferUsageFlags dmaBufferUsageFlags, DmaBufferModifiers dmaBufferModifiers)
@@ -497,9 +741,46 @@ namespace ramses::internal
                 device.deleteRenderBuffer(offscreenBufferDesc.m_colorBufferHandle[1]);
         }
 
+        if (offscreenBufferDesc.m_scaledRenderTargetHandle.isValid())
+        {
+            device.deleteRenderTarget(offscreenBufferDesc.m_scaledRenderTargetHandle);
+            device.deleteRenderBuffer(offscreenBufferDesc.m_scaledColorBufferHandle);
+            if (offscreenBufferDesc.m_scaledDepthBufferHandle.isValid())
+                device.deleteRenderBuffer(offscreenBufferDesc.m_scaledDepthBufferHandle);
+        }
+
         m_offscreenBuffers.release(bufferHandle);
     }
 
+    DeviceResourceHandle RendererResourceManager::uploadOffscreenBufferScaledRenderTarget(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height)
+    {
+        assert(m_offscreenBuffers.isAllocated(bufferHandle));
+        OffscreenBufferDescriptor& offscreenBufferDesc = *m_offscreenBuffers.getMemory(bufferHandle);
+        // content of DMA buffer is accessed externally, its resolution must not change
+        if (offscreenBufferDesc.isDmaBuffer)
+            return {};
+        if (offscreenBufferDesc.m_scaledRenderTargetHandle.isValid())
+            return offscreenBufferDesc.m_scaledRenderTargetHandle;
+
+        LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::uploadOffscreenBufferScaledRenderTarget handle={} {}x{}", bufferHandle, width, height);
+        IDevice& device = m_renderBackend.getDevice();
+
+        // scaled content is blitted to offscreen buffer, multisampling would have to be resolved anyway so it is not used here
+        offscreenBufferDesc.m_scaledColorBufferHandle = device.uploadRenderBuffer(width, height, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u);
+        uint32_t texelSize = GetTexelSizeFromFormat(EPixelStorageFormat::RGBA8);
+        DeviceHandleVector bufferDeviceHandles{ offscreenBufferDesc.m_scaledColorBufferHandle };
+        if (offscreenBufferDesc.m_depthBufferHandle.isValid())
+        {
+            offscreenBufferDesc.m_scaledDepthBufferHandle = device.uploadRenderBuffer(width, height, EPixelStorageFormat::Depth24_Stencil8, ERenderBufferAccessMode::WriteOnly, 0u);
+            texelSize += GetTexelSizeFromFormat(EPixelStorageFormat::Depth24_Stencil8);
+            bufferDeviceHandles.push_back(offscreenBufferDesc.m_scaledDepthBufferHandle);
+        }
+        offscreenBufferDesc.m_scaledRenderTargetHandle = device.uploadRenderTarget(bufferDeviceHandles);
+        offscreenBufferDesc.m_estimatedVRAMUsage += width * height * texelSize;
+
+        return offscreenBufferDesc.m_scaledRenderTargetHandle;
+    }
+
     void RendererResourceManager::uploadStreamBuffer(StreamBufferHandle bufferHandle, WaylandIviSurfaceId source)
     {
         LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::uploadStreamBuffer handle={} source={}", bufferHandle, source);
@@ -559,6 +840,24 @@ namespace ramses::internal
         m_renderBackend.getDevice().deleteTexture(deviceHandle);
     }
 
+    bool RendererResourceManager::importDmaBufferToExternalBuffer(ExternalBufferHandle bufferHandle, const DmaBufferFrame& frame, int& releaseFenceFD)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager::importDmaBufferToExternalBuffer handle={} fd={}", bufferHandle, frame.fd);
+
+        assert(m_externalBuffers.isAllocated(bufferHandle));
+        const auto deviceHandle = *m_externalBuffers.getMemory(bufferHandle);
+        return m_renderBackend.getDevice().importDmaBufferToExternalTexture(deviceHandle, frame, releaseFenceFD);
+    }
+
+    int RendererResourceManager::releaseDmaBufferOfExternalBuffer(ExternalBufferHandle bufferHandle)
+    {
+        LOG_TRACE(CONTEXT_RENDERER, "RendererResourceManager::releaseDmaBufferOfExternalBuffer handle={}", bufferHandle);
+
+        assert(m_externalBuffers.isAllocated(bufferHandle));
+        const auto deviceHandle = *m_externalBuffers.getMemory(bufferHandle);
+        return m_renderBackend.getDevice().releaseDmaBufferOfExternalTexture(deviceHandle);
+    }
+
     void RendererResourceManager::uploadBlitPassRenderTargets(BlitPassHandle blitPass, RenderBufferHandle sourceRenderBuffer, RenderBufferHandle destinationRenderBuffer, SceneId sceneId)
     {
         LOG_INFO(CONTEXT_RENDERER, "RendererResourceManager::uploadBlitPassRenderTargets sceneId={} handle={} srcBufferHandle={} dstBufferHandle={}", sceneId, blitPass, sourceRenderBuffer, destinationRenderBuffer);
@@ -566,6 +865,8 @@ namespace ramses::internal
         assert(blitPass.isValid());
         assert(sourceRenderBuffer.isValid());
         assert(destinationRenderBuffer.isValid());
+        restoreRenderTargetAliasesUsing(sceneId, RenderTargetHandle::Invalid(), sourceRenderBuffer);
+        restoreRenderTargetAliasesUsing(sceneId, RenderTargetHandle::Invalid(), destinationRenderBuffer);
         RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
 
         const DeviceResourceHandle sourceRenderBufferDeviceHandle = sceneResources.get(sourceRenderBuffer).deviceHandle;
@@ -613,15 +914,16 @@ namespace ramses::internal
 
         RendererSceneResourceRegistry& sceneResources = getSceneResourceRegistry(sceneId);
 
+        // unlike array resources, data buffers are meant to be updated by the client
         IDevice& device = m_renderBackend.getDevice();
         DeviceResourceHandle deviceHandle;
         switch (dataBufferType)
         {
         case EDataBufferType::IndexBuffer:
-            deviceHandle = device.allocateIndexBuffer(dataType, dataSizeInBytes);
+            deviceHandle = device.allocateIndexBuffer(dataType, dataSizeInBytes, EDeviceBufferUsage::Dynamic);
             break;
         case EDataBufferType::VertexBuffer:
-            deviceHandle = device.allocateVertexBuffer(dataSizeInBytes);
+            deviceHandle = device.allocateVertexBuffer(dataSizeInBytes, EDeviceBufferUsage::Dynamic);
             break;
         default:
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::uploadDataBuffer: can not upload data buffer with invalid type!");
@@ -666,23 +968,35 @@ namespace ramses::internal
         sceneResources.remove(dataBufferHandle);
     }
 
-    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId)
+    void RendererResourceManager::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId)
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
         const RendererSceneResourceRegistry& sceneResources = *m_sceneResourceRegistryMap.get(sceneId);
 
-        const DeviceResourceHandle deviceHandle = sceneResources.get(handle).deviceHandle;
+        const auto& entry = sceneResources.get(handle);
+        const DeviceResourceHandle deviceHandle = entry.deviceHandle;
         assert(deviceHandle.isValid());
-        const EDataBufferType dataBufferType = sceneResources.get(handle).dataBufferType;
+        assert(offsetInBytes + dataSizeInBytes <= entry.size);
+        const EDataBufferType dataBufferType = entry.dataBufferType;
+
+        // update of whole buffer re-specifies its storage (driver can orphan the old one still used by GPU),
+        // partial update keeps rest of the buffer content and uploads only the given range
+        const bool fullUpdate = (offsetInBytes == 0u && dataSizeInBytes == entry.size);
 
         IDevice& device = m_renderBackend.getDevice();
         switch (dataBufferType)
         {
         case EDataBufferType::IndexBuffer:
-            device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (fullUpdate)
+                device.uploadIndexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.uploadIndexBufferSubData(deviceHandle, offsetInBytes, data, dataSizeInBytes);
             break;
         case EDataBufferType::VertexBuffer:
-            device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            if (fullUpdate)
+                device.uploadVertexBufferData(deviceHandle, data, dataSizeInBytes);
+            else
+                device.uploadVertexBufferSubData(deviceHandle, offsetInBytes, data, dataSizeInBytes);
             break;
         default:
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::updateDataBuffer: can not updata data buffer with invalid type!");
@@ -836,8 +1150,9 @@ namespace ramses::internal
 
     DeviceResourceHandle RendererResourceManager::uploadUniformBuffer(SemanticUniformBufferHandle handle, uint32_t size, SceneId sceneId)
     {
+        // semantic uniform buffers (e.g. model/MVP matrices) are typically updated every frame
         auto& device = m_renderBackend.getDevice();
-        const auto deviceHandle = device.allocateUniformBuffer(size);
+        const auto deviceHandle = device.allocateStreamingUniformBuffer(size);
         if (!deviceHandle.isValid())
         {
             LOG_ERROR(CONTEXT_RENDERER, "RendererResourceManager::uploadUniformBuffer sceneId={} handle={} failed to allocate uniform buffer, this is fatal...",
@@ -65,23 +65,28 @@ namespace ramses::internal
 
         void                 uploadRenderTarget(RenderTargetHandle renderTarget, const RenderBufferHandleVector& rtBufferHandles, SceneId sceneId) override;
         void                 unloadRenderTarget(RenderTargetHandle renderTarget, SceneId sceneId) override;
+        bool                 updateRenderTargetAliases(SceneId sceneId, const RenderTargetAliases& aliases) override;
 
         void                 uploadOffscreenBuffer(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, uint32_t sampleCount, bool isDoubleBuffered, EDepthBufferType depthStencilBufferType) override;
         void                 uploadDmaOffscreenBuffer(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, DmaBufferFourccFormat dmaBufferFourccFormat, DmaBufferUsageFlags dmaBufferUsageFlags, DmaBufferModifiers dmaBufferModifiers) override;
         void                 unloadOffscreenBuffer(OffscreenBufferHandle bufferHandle) override;
+        int                  createDmaOffscreenBufferSyncFence(OffscreenBufferHandle bufferHandle) override;
+        DeviceResourceHandle uploadOffscreenBufferScaledRenderTarget(OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height) override;
 
         void                 uploadStreamBuffer(StreamBufferHandle bufferHandle, WaylandIviSurfaceId source) override;
         void                 unloadStreamBuffer(StreamBufferHandle bufferHandle) override;
 
         void                 uploadExternalBuffer(ExternalBufferHandle bufferHandle) override;
         void                 unloadExternalBuffer(ExternalBufferHandle bufferHandle) override;
+        bool                 importDmaBufferToExternalBuffer(ExternalBufferHandle bufferHandle, const DmaBufferFrame& frame, int& releaseFenceFD) override;
+        int                  releaseDmaBufferOfExternalBuffer(ExternalBufferHandle bufferHandle) override;
 
         void                 uploadBlitPassRenderTargets(BlitPassHandle blitPass, RenderBufferHandle sourceRenderBuffer, RenderBufferHandle destinationRenderBuffer, SceneId sceneId) override;
         void                 unloadBlitPassRenderTargets(BlitPassHandle blitPass, SceneId sceneId) override;
 
         void                 uploadDataBuffer(DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t dataSizeInBytes, SceneId sceneId) override;
         void                 unloadDataBuffer(DataBufferHandle dataBufferHandle, SceneId sceneId) override;
-        void                 updateDataBuffer(DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) override;
+        void                 updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId) override;
         [[nodiscard]] DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle dataBufferHandle, SceneId sceneId) const override;
 
         void                 uploadTextureBuffer(TextureBufferHandle textureBufferHandle, uint32_t width, uint32_t height, EPixelStorageFormat textureFormat, uint32_t mipLevelCount, SceneId sceneId) override;
@@ -120,13 +125,22 @@ namespace ramses::internal
 
         [[nodiscard]] const StreamUsage& getStreamUsage(WaylandIviSurfaceId source) const override;
 
+        [[nodiscard]] GpuMemoryReport getGpuMemoryReport() const override;
+        uint64_t trimMemory() override;
+
         [[nodiscard]] const RendererResourceRegistry& getRendererResourceRegistry() const;
 
     private:
         using SceneResourceRegistryMap = HashMap<SceneId, RendererSceneResourceRegistry>;
+        using SceneRenderTargetAliasesMap = HashMap<SceneId, RenderTargetAliases>;
 
         RendererSceneResourceRegistry& getSceneResourceRegistry(SceneId sceneId);
         void clearRenderTarget(DeviceResourceHandle handle);
+        void applyRenderTargetAlias(SceneId sceneId, const RenderTargetAlias& alias);
+        void restoreRenderTargetAlias(SceneId sceneId, const RenderTargetAlias& alias);
+        void restoreRenderTargetAliasesUsing(SceneId sceneId, RenderTargetHandle renderTarget, RenderBufferHandle renderBuffer);
+        [[nodiscard]] const RenderTargetAlias* findRenderTargetAlias(SceneId sceneId, RenderTargetHandle renderTarget) const;
+        [[nodiscard]] const RenderTargetAlias* findRenderBufferAlias(SceneId sceneId, RenderBufferHandle renderBuffer, size_t& bufferIndexOut) const;
 
         struct OffscreenBufferDescriptor
         {
@@ -134,6 +148,10 @@ namespace ramses::internal
             std::array<DeviceResourceHandle, 2> m_renderTargetHandle{};
             std::array<DeviceResourceHandle, 2> m_colorBufferHandle{};
             DeviceResourceHandle m_depthBufferHandle;
+            // render target with its own buffers used when offscreen buffer is rendered at reduced resolution
+            DeviceResourceHandle m_scaledRenderTargetHandle;
+            DeviceResourceHandle m_scaledColorBufferHandle;
+            DeviceResourceHandle m_scaledDepthBufferHandle;
             uint32_t m_estimatedVRAMUsage = 0;
             bool isDmaBuffer = false;
         };
@@ -149,6 +167,8 @@ namespace ramses::internal
         ExternalBufferMap              m_externalBuffers;
         RendererResourceRegistry       m_resourceRegistry;
         SceneResourceRegistryMap       m_sceneResourceRegistryMap;
+        // aliased render targets have no device resources of their own, they resolve to device resources of their host
+        SceneRenderTargetAliasesMap    m_sceneRenderTargetAliases;
         ResourceUploadingManager       m_resourceUploadingManager;
         RendererStatistics&            m_stats;
 
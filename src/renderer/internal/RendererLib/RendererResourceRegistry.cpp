@@ -92,6 +92,8 @@ namespace ramses::internal
         }
 
         rd.sceneUsage.erase(find_c(rd.sceneUsage, sceneId));
+        rd.lastSceneUsage = sceneId;
+        rd.lastUseFrame = m_currentFrame;
         if (!contains_c(rd.sceneUsage, sceneId))
         {
             assert(contains_c(m_resourcesUsedInScenes[sceneId], hash));
@@ -207,6 +209,16 @@ namespace ramses::internal
         return m_countResourcesScheduledForUpload > 0u;
     }
 
+    void RendererResourceRegistry::advanceFrame()
+    {
+        ++m_currentFrame;
+    }
+
+    uint64_t RendererResourceRegistry::getCurrentFrame() const
+    {
+        return m_currentFrame;
+    }
+
     void RendererResourceRegistry::updateCachedLists(const ResourceContentHash& hash, EResourceStatus currentStatus, EResourceStatus newStatus)
     {
         if (currentStatus == EResourceStatus::Provided)
@@ -38,6 +38,9 @@ namespace ramses::internal
         [[nodiscard]] const ResourceContentHashVector* getResourcesInUseByScene(SceneId sceneId) const;
         [[nodiscard]] bool hasAnyResourcesScheduledForUpload() const;
 
+        void                       advanceFrame();
+        [[nodiscard]] uint64_t     getCurrentFrame() const;
+
     private:
         void setResourceStatus(const ResourceContentHash& hash, EResourceStatus status);
         void updateCachedLists(const ResourceContentHash& hash, EResourceStatus currentStatus, EResourceStatus newStatus);
@@ -51,6 +54,7 @@ namespace ramses::internal
         ResourceContentHashVector m_resourcesNotInUseByScenes;
         std::unordered_map<SceneId, ResourceContentHashVector> m_resourcesUsedInScenes;
         uint32_t m_countResourcesScheduledForUpload = 0u;
+        uint64_t m_currentFrame = 0u;
 
         // For logging purposes only
         friend class RendererLogger;
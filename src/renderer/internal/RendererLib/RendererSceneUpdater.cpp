@@ -30,6 +30,7 @@
 #include "internal/RendererLib/ResourceUploader.h"
 #include "internal/RendererLib/RendererEventCollector.h"
 #include "internal/RendererLib/SceneResourceUploader.h"
+#include "internal/RendererLib/ResolutionScalingController.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/Components/SceneUpdate.h"
 #include "internal/Core/Utils/LogMacros.h"
@@ -121,7 +122,7 @@ namespace ramses::internal
 
             if (displayConfig.isAsyncEffectUploadEnabled())
             {
-                m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, m_display);
+                m_asyncEffectUploader = std::make_unique<AsyncEffectUploader>(m_platform, renderBackend, m_notifier, m_display, displayConfig.getEffectUploadThreadScheduling());
                 if (!m_asyncEffectUploader->createResourceUploadRenderBackendAndStartThread())
                 {
                     m_renderer.destroyDisplayContext();
@@ -134,6 +135,23 @@ namespace ramses::internal
                                                         embeddedCompositingManager,
                                                         displayConfig,
                                                         binaryShaderCache);
+            m_scenesToPrefetch = displayConfig.getPrefetchScenes();
+            m_progressiveMappingScenes = displayConfig.getProgressiveMappingScenes();
+            m_prefetchBatchSize = displayConfig.getResourceUploadBatchSize();
+            m_sceneBudgetScheduler = std::make_unique<SceneBudgetScheduler>(displayConfig.getScenePriorities(), m_frameTimer, m_renderer.getStatistics());
+            if (displayConfig.getFlushApplyThreadCount() > 0u)
+                m_flushApplyWorkers = std::make_unique<WorkerThreadPool>(displayConfig.getFlushApplyThreadCount(), m_notifier);
+            m_asyncFlushApplyThreshold = displayConfig.getAsyncFlushApplyThreshold();
+            m_renderOncePassesPerFrameLimit = displayConfig.getRenderOncePassesPerFrameLimit();
+            if (displayConfig.isAsyncPickingEnabled())
+                m_asyncPicker = std::make_unique<AsyncPicker>(m_notifier, m_display);
+            if (m_asyncFlushApplyThreshold > 0u)
+            {
+                m_asyncSceneActionApplier = std::make_unique<AsyncSceneActionApplier>(
+                    [this](RendererCachedScene& scene, PendingFlushes& pendingFlushes, const SceneSizeInformation& sizeInfo) {
+                        return applySceneActionsOfPendingFlushes(scene, pendingFlushes, sizeInfo); },
+                    m_notifier, m_display);
+            }
 
             m_rendererEventCollector.addDisplayEvent(ERendererEventType::DisplayCreated, m_display);
 
@@ -166,6 +184,11 @@ namespace ramses::internal
         return m_displayResourceManager != nullptr;
     }
 
+    GpuMemoryReport RendererSceneUpdater::getGpuMemoryReport() const
+    {
+        return m_displayResourceManager ? m_displayResourceManager->getGpuMemoryReport() : GpuMemoryReport{};
+    }
+
     void RendererSceneUpdater::destroyDisplayContext()
     {
         if (!m_renderer.hasDisplayController())
@@ -195,7 +218,26 @@ namespace ramses::internal
             m_asyncEffectUploader->destroyResourceUploadRenderBackendAndStopThread();
             m_asyncEffectUploader.reset();
         }
+        while (!m_prefetchedSceneResources.empty())
+            releasePrefetchedSceneResources(m_prefetchedSceneResources.begin()->first);
+        for (const auto& externalBufferDmaBuffer : m_externalBufferDmaBufferFDs)
+        {
+            const int releaseFenceFD = m_displayResourceManager->releaseDmaBufferOfExternalBuffer(externalBufferDmaBuffer.first);
+            m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, externalBufferDmaBuffer.first, externalBufferDmaBuffer.second, releaseFenceFD);
+        }
+        m_externalBufferDmaBufferFDs.clear();
         m_displayResourceManager.reset();
+        m_sceneBudgetScheduler.reset();
+        m_flushApplyWorkers.reset();
+        if (m_asyncSceneActionApplier)
+        {
+            // scenes stay subscribed, finish their flushes as if display was still there
+            m_asyncSceneActionApplier->waitUntilAllApplied();
+            finishAsynchronouslyAppliedFlushes();
+            m_asyncSceneActionApplier.reset();
+        }
+        m_asyncPicker.reset();
+        m_pendingPickEvents.clear();
 
         m_renderer.resetRenderInterruptState();
         m_renderer.destroyDisplayContext();
@@ -283,6 +325,12 @@ namespace ramses::internal
             updateScenesDataLinks();
         }
 
+        if (m_asyncPicker)
+        {
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes report picked objects and start picking of pending pick events");
+            processPendingPickEvents();
+        }
+
         {
             m_renderer.m_traceId = 13;
             LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update and upload semantic uniform buffers");
@@ -298,6 +346,16 @@ namespace ramses::internal
         }
         m_modifiedScenesToRerender.clear();
 
+        if (m_renderOncePassesPerFrameLimit > 0u)
+        {
+            // render once passes left from previous frame are rendered even if scene was not modified
+            for (const auto& scene : m_rendererScenes)
+            {
+                if (m_sceneStateExecutor.getSceneState(scene.key) == ESceneState::Rendered && scene.value.scene->hasRenderOncePassesToRender())
+                    m_renderer.markBufferWithSceneForRerender(scene.key);
+            }
+        }
+
         if (!m_skipUnmodifiedScenes)
         {
             // Mark all shown scenes for re-render regardless if modified or not
@@ -412,6 +470,17 @@ namespace ramses::internal
             // remove no more needed resources
             if (!pendingFlush.resourcesRemoved.empty())
             {
+                // and release them if they were prefetched already
+                const auto prefetchedIt = m_prefetchedSceneResources.find(sceneID);
+                if (prefetchedIt != m_prefetchedSceneResources.end())
+                {
+                    for (const auto& hash : pendingFlush.resourcesRemoved)
+                    {
+                        if (prefetchedIt->second.remove(hash))
+                            m_displayResourceManager->unreferenceResourcesForScene(sceneID, { hash });
+                    }
+                }
+
                 auto it = std::remove_if(resourcesForMapping.begin(), resourcesForMapping.end(), [&](const auto& mr)
                 {
                     const auto mrHash = mr->getHash();
@@ -494,6 +563,63 @@ namespace ramses::internal
         // if there are resources to upload, unload and upload pending resources
         if (m_displayResourceManager->hasResourcesToBeUploaded())
             m_displayResourceManager->uploadAndUnloadPendingResources();
+
+        if (!m_scenesToPrefetch.empty())
+            prefetchSceneResources();
+    }
+
+    void RendererSceneUpdater::prefetchSceneResources()
+    {
+        // prefetching yields to any scene being mapped and to any resources waiting for upload,
+        // it only uses time left in frame after those
+        if (!m_scenesToBeMapped.empty() ||
+            m_displayResourceManager->hasResourcesToBeUploaded() ||
+            m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ResourcesUpload))
+            return;
+
+        // provide at most one upload batch per frame, so that prefetching never occupies uploading for longer than one batch
+        size_t numResourcesToPrefetch = m_prefetchBatchSize;
+        for (const auto sceneID : m_scenesToPrefetch)
+        {
+            if (m_sceneStateExecutor.getSceneState(sceneID) != ESceneState::Subscribed)
+                continue;
+
+            const auto& resourcesForMapping = m_rendererScenes.getStagingInfo(sceneID).resourcesToUploadOnceMapping;
+            if (resourcesForMapping.empty())
+                continue;
+
+            auto& prefetchedResources = m_prefetchedSceneResources[sceneID];
+            for (const auto& mr : resourcesForMapping)
+            {
+                if (numResourcesToPrefetch == 0u)
+                    return;
+
+                const auto hash = mr->getHash();
+                if (prefetchedResources.contains(hash))
+                    continue;
+
+                // resources are referenced for the scene as if it was mapped, this makes them upload and prevents them from being unloaded
+                m_displayResourceManager->referenceResourcesForScene(sceneID, { hash });
+                m_displayResourceManager->provideResourceData(mr);
+                prefetchedResources.put(hash);
+                --numResourcesToPrefetch;
+            }
+        }
+    }
+
+    void RendererSceneUpdater::releasePrefetchedSceneResources(SceneId sceneID)
+    {
+        const auto it = m_prefetchedSceneResources.find(sceneID);
+        if (it == m_prefetchedSceneResources.end())
+            return;
+
+        assert(m_displayResourceManager);
+        ResourceContentHashVector prefetchedResources;
+        prefetchedResources.reserve(it->second.size());
+        for (const auto& hash : it->second)
+            prefetchedResources.push_back(hash);
+        m_displayResourceManager->unreferenceResourcesForScene(sceneID, prefetchedResources);
+        m_prefetchedSceneResources.erase(it);
     }
 
     void RendererSceneUpdater::uploadUpdatedECStreams()
@@ -511,7 +637,6 @@ namespace ramses::internal
                 embeddedCompositingManager.uploadResourcesAndGetUpdates(m_streamUpdates);
 
                 const auto& texLinks = m_rendererScenes.getSceneLinksManager().getTextureLinkManager();
-                StreamBufferLinkVector links;
                 for (const auto& updatedSource : m_streamUpdates)
                 {
                     m_renderer.getStatistics().streamTextureUpdated(updatedSource.first, updatedSource.second);
@@ -519,9 +644,9 @@ namespace ramses::internal
                     // mark all scenes linked as consumer to updated source as modified
                     for (const auto streamBuffer : streamUsage)
                     {
-                        links.clear();
-                        texLinks.getStreamBufferLinks().getLinkedConsumers(streamBuffer, links);
-                        for (const auto& link : links)
+                        m_tempStreamBufferLinks.clear();
+                        texLinks.getStreamBufferLinks().getLinkedConsumers(streamBuffer, m_tempStreamBufferLinks);
+                        for (const auto& link : m_tempStreamBufferLinks)
                             m_modifiedScenesToRerender.put(link.consumerSceneId);
                     }
                 }
@@ -531,18 +656,184 @@ namespace ramses::internal
 
     void RendererSceneUpdater::tryToApplyPendingFlushes()
     {
-        // check and try to apply pending flushes
+        if (m_asyncSceneActionApplier)
+            finishAsynchronouslyAppliedFlushes();
+
+        // check and try to apply pending flushes, in order of scene priority so that if frame budget gets exceeded
+        // it is the less prioritized scenes which get their flushes deferred
+        m_scenesWithPendingFlushes.clear();
         for(const auto& rendererScene : m_rendererScenes)
         {
-            const SceneId sceneID = rendererScene.key;
+            // flushes arriving while previous flushes are applied asynchronously wait for them to finish
+            if (m_asyncSceneActionApplier && m_asyncSceneActionApplier->hasScene(rendererScene.key))
+                continue;
+            if (!m_rendererScenes.getStagingInfo(rendererScene.key).pendingData.pendingFlushes.empty())
+                m_scenesWithPendingFlushes.push_back(rendererScene.key);
+        }
+
+        if (m_sceneBudgetScheduler)
+            m_sceneBudgetScheduler->sortByPriority(m_scenesWithPendingFlushes);
+
+        // deferring flushes of less prioritized scenes depends on time spent applying flushes of preceding scenes,
+        // scene priorities therefore always use serial application
+        if (m_flushApplyWorkers && !(m_sceneBudgetScheduler && m_sceneBudgetScheduler->hasScenePriorities()))
+        {
+            tryToApplyPendingFlushesInParallel();
+            return;
+        }
+
+        for (const auto sceneID : m_scenesWithPendingFlushes)
+            updateScenePendingFlushes(sceneID, m_rendererScenes.getStagingInfo(sceneID));
+    }
+
+    void RendererSceneUpdater::tryToApplyPendingFlushesInParallel()
+    {
+        // whether flushes of a scene can be applied does not depend on flushes applied to other scenes,
+        // all scenes are checked first and scene actions of independent scenes are then applied concurrently
+        m_scenesToApplyFlushes.clear();
+        m_scenesToApplyFlushesInParallel.clear();
+        for (const auto sceneID : m_scenesWithPendingFlushes)
+        {
             StagingInfo& stagingInfo = m_rendererScenes.getStagingInfo(sceneID);
+            if (!canApplyPendingFlushes(sceneID, stagingInfo))
+            {
+                m_renderer.getStatistics().flushBlocked(sceneID);
+                continue;
+            }
+            if (tryToStartAsyncFlushApplication(sceneID, stagingInfo))
+                continue;
 
-            if (!stagingInfo.pendingData.pendingFlushes.empty())
-                updateScenePendingFlushes(sceneID, stagingInfo);
+            stagingInfo.pendingData.allPendingFlushesApplied = true;
+            SceneToApplyFlushes sceneToApply;
+            sceneToApply.sceneId = sceneID;
+            sceneToApply.scene = &const_cast<RendererCachedScene&>(m_rendererScenes.getScene(sceneID));
+            sceneToApply.stagingInfo = &stagingInfo;
+            sceneToApply.applyInParallel = canApplySceneActionsConcurrently(sceneID, stagingInfo.pendingData.pendingFlushes);
+            if (sceneToApply.applyInParallel)
+                m_scenesToApplyFlushesInParallel.push_back(m_scenesToApplyFlushes.size());
+            m_scenesToApplyFlushes.push_back(sceneToApply);
+        }
+
+        if (m_scenesToApplyFlushesInParallel.size() > 1u)
+        {
+            m_flushApplyWorkers->execute(m_scenesToApplyFlushesInParallel.size(), [this](size_t idx) {
+                auto& sceneToApply = m_scenesToApplyFlushes[m_scenesToApplyFlushesInParallel[idx]];
+                const auto applyStart = std::chrono::steady_clock::now();
+                sceneToApply.hadActiveShaderAnimation = applySceneActionsOfPendingFlushes(*sceneToApply.scene, sceneToApply.stagingInfo->pendingData.pendingFlushes, sceneToApply.stagingInfo->sizeInformation);
+                // statistics are not thread safe, applying time is reported after all workers finished
+                sceneToApply.applyTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - applyStart);
+            });
+        }
+        else
+        {
+            for (const auto idx : m_scenesToApplyFlushesInParallel)
+                m_scenesToApplyFlushes[idx].applyInParallel = false;
+        }
+
+        // events, statistics and resource bookkeeping of all applied flushes in the original scene order
+        for (const auto& sceneToApply : m_scenesToApplyFlushes)
+        {
+            if (sceneToApply.applyInParallel)
+            {
+                m_renderer.getStatistics().sceneCpuTimeMeasured(sceneToApply.sceneId, ESceneCpuTime::FlushApplication, sceneToApply.applyTime);
+                finishAppliedPendingFlushes(sceneToApply.sceneId, sceneToApply.stagingInfo->pendingData, *sceneToApply.stagingInfo, sceneToApply.hadActiveShaderAnimation);
+            }
+            else
+                applyPendingFlushes(sceneToApply.sceneId, *sceneToApply.stagingInfo);
         }
     }
 
+    bool RendererSceneUpdater::canApplySceneActionsConcurrently(SceneId sceneID, const PendingFlushes& pendingFlushes) const
+    {
+        // linked scenes propagate changes to each other (e.g. transformation dirtiness or linked textures)
+        const auto& linksManager = m_rendererScenes.getSceneLinksManager();
+        if (linksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumerOrProvider(sceneID) ||
+            linksManager.getDataReferenceLinkManager().getDependencyChecker().hasDependencyAsConsumerOrProvider(sceneID) ||
+            linksManager.getTextureLinkManager().getDependencyChecker().hasDependencyAsConsumerOrProvider(sceneID))
+            return false;
+
+        // data slot changes are registered in links manager shared by all scenes
+        for (const auto& pendingFlush : pendingFlushes)
+        {
+            for (const auto& action : pendingFlush.sceneActions)
+            {
+                switch (action.type())
+                {
+                case ESceneActionId::AllocateDataSlot:
+                case ESceneActionId::SetDataSlotTexture:
+                case ESceneActionId::ReleaseDataSlot:
+                    return false;
+                default:
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
     void RendererSceneUpdater::updateScenePendingFlushes(SceneId sceneID, StagingInfo& stagingInfo)
+    {
+        if (canApplyPendingFlushes(sceneID, stagingInfo))
+        {
+            if (tryToStartAsyncFlushApplication(sceneID, stagingInfo))
+                return;
+            stagingInfo.pendingData.allPendingFlushesApplied = true;
+            applyPendingFlushes(sceneID, stagingInfo);
+        }
+        else
+            m_renderer.getStatistics().flushBlocked(sceneID);
+    }
+
+    bool RendererSceneUpdater::tryToStartAsyncFlushApplication(SceneId sceneID, StagingInfo& stagingInfo)
+    {
+        // scene which is not mapped is not accessed by rendering nor resource management,
+        // it can be modified in background until it is needed (mapping is delayed until all its flushes are applied)
+        if (!m_asyncSceneActionApplier || m_sceneStateExecutor.getSceneState(sceneID) != ESceneState::Subscribed)
+            return false;
+
+        PendingData& pendingData = stagingInfo.pendingData;
+        uint32_t numActions = 0u;
+        for (const auto& pendingFlush : pendingData.pendingFlushes)
+            numActions += pendingFlush.sceneActions.numberOfActions();
+        if (numActions < m_asyncFlushApplyThreshold || !canApplySceneActionsConcurrently(sceneID, pendingData.pendingFlushes))
+            return false;
+
+        LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::tryToStartAsyncFlushApplication: applying {} scene actions of scene {} asynchronously", numActions, sceneID);
+        // resource data of unmapped scene was already consolidated for mapping, applier takes over the flushes to finish them later,
+        // new flushes of scene are collected in staging info meanwhile
+        auto& rendererScene = const_cast<RendererCachedScene&>(m_rendererScenes.getScene(sceneID));
+        // links manager is modified on display thread meanwhile, scene has no links so there is nothing to query there
+        rendererScene.setTransformationLinksIgnored(true);
+        m_asyncSceneActionApplier->startApplying(sceneID, rendererScene, std::move(pendingData), stagingInfo.sizeInformation);
+        PendingData::Clear(pendingData);
+
+        return true;
+    }
+
+    void RendererSceneUpdater::finishAsynchronouslyAppliedFlushes()
+    {
+        m_asyncAppliedFlushes.clear();
+        m_asyncSceneActionApplier->collectApplied(m_asyncAppliedFlushes);
+        for (auto& applied : m_asyncAppliedFlushes)
+        {
+            LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::finishAsynchronouslyAppliedFlushes: {} flushes of scene {} applied", applied.pendingData.pendingFlushes.size(), applied.sceneId);
+            m_rendererScenes.getScene(applied.sceneId).setTransformationLinksIgnored(false);
+            finishAppliedPendingFlushes(applied.sceneId, applied.pendingData, m_rendererScenes.getStagingInfo(applied.sceneId), applied.hadActiveShaderAnimation);
+        }
+        m_asyncAppliedFlushes.clear();
+    }
+
+    void RendererSceneUpdater::waitForAsyncFlushApplication(SceneId sceneID)
+    {
+        if (m_asyncSceneActionApplier && m_asyncSceneActionApplier->hasScene(sceneID))
+        {
+            m_asyncSceneActionApplier->waitUntilApplied(sceneID);
+            finishAsynchronouslyAppliedFlushes();
+        }
+    }
+
+    bool RendererSceneUpdater::canApplyPendingFlushes(SceneId sceneID, const StagingInfo& stagingInfo)
     {
         const ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneID);
         const bool sceneIsRenderedOrRequested = (sceneState == ESceneState::Rendered || sceneState == ESceneState::RenderRequested); // requested can become rendered still in this frame
@@ -555,58 +846,90 @@ namespace ramses::internal
         if (sceneIsRenderedOrRequested && m_renderer.hasAnyBufferWithInterruptedRendering())
             canApplyFlushes &= !m_renderer.isSceneAssignedToInterruptibleOffscreenBuffer(sceneID);
 
+        // applying flushes and uploading scene resources they bring shares the scene resources upload budget,
+        // deferred flushes are still force applied below if there are too many pending
+        bool deferredByBudget = false;
+        if (canApplyFlushes && sceneIsMapped && m_sceneBudgetScheduler && m_sceneBudgetScheduler->deferSceneWork(sceneID, EFrameTimerSectionBudget::SceneResourcesUpload))
+        {
+            canApplyFlushes = false;
+            deferredByBudget = true;
+        }
+
         if (!canApplyFlushes && sceneIsMapped && stagingInfo.pendingData.pendingFlushes.size() > m_maximumPendingFlushes)
         {
             const auto numPendingFlushes = getNumberOfPendingNonEmptyFlushes(sceneID);
             if (numPendingFlushes > m_maximumPendingFlushes)
             {
-                LOG_ERROR(CONTEXT_RENDERER, "Force applying pending flushes! Scene {} has {} pending flushes, renderer cannot catch up with resource updates.", sceneID, numPendingFlushes);
-                logMissingResources(stagingInfo.pendingData, sceneID);
+                if (deferredByBudget)
+                {
+                    // resources are ready, scene was only deferred in favor of more prioritized scenes, expected under load
+                    LOG_WARN(CONTEXT_RENDERER, "Force applying pending flushes of scene {} deferred due to exceeded frame budget, {} pending flushes exceed limit {} (see RamsesRenderer::setPendingFlushLimits).",
+                        sceneID, numPendingFlushes, m_maximumPendingFlushes);
+                }
+                else
+                {
+                    LOG_ERROR(CONTEXT_RENDERER, "Force applying pending flushes! Scene {} has {} pending flushes, renderer cannot catch up with resource updates.", sceneID, numPendingFlushes);
+                    logMissingResources(stagingInfo.pendingData, sceneID);
+                }
 
                 canApplyFlushes = true;
                 m_renderer.resetRenderInterruptState();
             }
         }
 
-        if (canApplyFlushes)
-        {
-            stagingInfo.pendingData.allPendingFlushesApplied = true;
-            applyPendingFlushes(sceneID, stagingInfo);
-        }
-        else
-            m_renderer.getStatistics().flushBlocked(sceneID);
+        return canApplyFlushes;
     }
 
     void RendererSceneUpdater::applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo)
     {
         auto& rendererScene = const_cast<RendererCachedScene&>(m_rendererScenes.getScene(sceneID));
-        rendererScene.preallocateSceneSize(stagingInfo.sizeInformation);
+        bool hadActiveShaderAnimation = false;
+        {
+            SceneCpuTimeScope cpuTime{ m_renderer.getStatistics(), sceneID, ESceneCpuTime::FlushApplication };
+            hadActiveShaderAnimation = applySceneActionsOfPendingFlushes(rendererScene, stagingInfo.pendingData.pendingFlushes, stagingInfo.sizeInformation);
+        }
+        finishAppliedPendingFlushes(sceneID, stagingInfo.pendingData, stagingInfo, hadActiveShaderAnimation);
+    }
 
-        PendingData& pendingData = stagingInfo.pendingData;
-        PendingFlushes& pendingFlushes = pendingData.pendingFlushes;
+    bool RendererSceneUpdater::applySceneActionsOfPendingFlushes(RendererCachedScene& scene, PendingFlushes& pendingFlushes, const SceneSizeInformation& sizeInfo) const
+    {
+        // modifies only the given scene, can be executed for independent scenes concurrently or in background
+        scene.preallocateSceneSize(sizeInfo);
+
+        const bool hadActiveShaderAnimation = scene.hasActiveShaderAnimation();
         for (auto& pendingFlush : pendingFlushes)
         {
-            const auto hadActiveShaderAnimation = rendererScene.hasActiveShaderAnimation();
             // re-enable skub optimization
             // skub will be disabled again if a semantic time uniform is applied during first rendering after flush
-            rendererScene.setActiveShaderAnimation(false);
+            scene.setActiveShaderAnimation(false);
             if (pendingFlush.timeInfo.isEffectTimeSync)
             {
                 LOG_INFO(CONTEXT_RENDERER, "EffectTimeSync: {} for scene: {}",
                     std::chrono::time_point_cast<std::chrono::milliseconds>(pendingFlush.timeInfo.internalTimestamp).time_since_epoch().count(),
-                    rendererScene.getSceneId());
-                rendererScene.setEffectTimeSync(pendingFlush.timeInfo.internalTimestamp);
+                    scene.getSceneId());
+                scene.setEffectTimeSync(pendingFlush.timeInfo.internalTimestamp);
             }
-            applySceneActions(rendererScene, pendingFlush);
+            applySceneActions(scene, pendingFlush);
+        }
+
+        return hadActiveShaderAnimation;
+    }
 
+    void RendererSceneUpdater::finishAppliedPendingFlushes(SceneId sceneID, PendingData& pendingData, StagingInfo& stagingInfo, bool hadActiveShaderAnimation)
+    {
+        SceneCpuTimeScope cpuTime{ m_renderer.getStatistics(), sceneID, ESceneCpuTime::ResourceBookkeeping };
+        PendingFlushes& pendingFlushes = pendingData.pendingFlushes;
+        for (auto& pendingFlush : pendingFlushes)
+        {
             if (pendingFlush.versionTag.isValid())
             {
-                LOG_DEBUG(CONTEXT_SMOKETEST, "Named flush applied on scene {} with sceneVersionTag {}", rendererScene.getSceneId(), pendingFlush.versionTag);
+                LOG_DEBUG(CONTEXT_SMOKETEST, "Named flush applied on scene {} with sceneVersionTag {}", sceneID, pendingFlush.versionTag);
                 m_rendererEventCollector.addSceneFlushEvent(ERendererEventType::SceneFlushed, sceneID, pendingFlush.versionTag);
             }
             stagingInfo.lastAppliedVersionTag = pendingFlush.versionTag;
             m_expirationMonitor.onFlushApplied(sceneID, pendingFlush.timeInfo.expirationTimestamp, pendingFlush.versionTag, pendingFlush.flushIndex);
             m_renderer.getStatistics().flushApplied(sceneID);
+            m_renderer.getDisplayEventHandler().onFlushApplied(sceneID, pendingFlush.versionTag, pendingFlush.timeInfo.internalTimestamp);
 
             // mark scene as modified only if it received scene actions other than flush
             // also mark scene as modified if it had an active shader animation before (to not stop the animation with an empty flush)
@@ -622,6 +945,9 @@ namespace ramses::internal
                 // mark it as if rendered for expiration monitor so that it does not expire
                 m_expirationMonitor.onRendered(sceneID);
             }
+
+            // shader animation is deactivated when applying first flush and can become active again only when rendering
+            hadActiveShaderAnimation = false;
         }
 
         if (!pendingData.sceneReferenceActions.empty())
@@ -724,7 +1050,6 @@ namespace ramses::internal
             }
 
             auto& texLinks = m_rendererScenes.getSceneLinksManager().getTextureLinkManager();
-            StreamBufferLinkVector links;
 
             for (const auto changedStream : streamsWithAvailabilityChanged)
             {
@@ -732,9 +1057,9 @@ namespace ramses::internal
                 // mark renderables using samplers with linked to stream buffers with changed availability as dirty
                 for (const auto streamBuffer : streamUsage)
                 {
-                    links.clear();
-                    texLinks.getStreamBufferLinks().getLinkedConsumers(streamBuffer, links);
-                    for (const auto& link : links)
+                    m_tempStreamBufferLinks.clear();
+                    texLinks.getStreamBufferLinks().getLinkedConsumers(streamBuffer, m_tempStreamBufferLinks);
+                    for (const auto& link : m_tempStreamBufferLinks)
                     {
                         auto& scene = m_rendererScenes.getScene(link.consumerSceneId);
                         auto& dataSlot = scene.getDataSlot(link.consumerSlot);
@@ -812,8 +1137,21 @@ namespace ramses::internal
             // update resource cache only if scene is actually rendered
             if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
             {
+                SceneCpuTimeScope cpuTime{ m_renderer.getStatistics(), sceneId, ESceneCpuTime::ResourceBookkeeping };
                 RendererCachedScene& rendererScene = *(sceneIt.value.scene);
                 rendererScene.updateRenderablesAndResourceCache(*m_displayResourceManager);
+
+                // transient render targets share device memory, re-resolve cached device handles if aliasing changed
+                const bool aliasesChanged = rendererScene.haveRenderTargetAliasesChanged();
+                if (aliasesChanged || !rendererScene.getRenderTargetAliases().empty())
+                {
+                    const bool deviceHandlesChanged = m_displayResourceManager->updateRenderTargetAliases(sceneId, rendererScene.getRenderTargetAliases());
+                    if (aliasesChanged || deviceHandlesChanged)
+                    {
+                        rendererScene.invalidateRenderTargetResources();
+                        rendererScene.updateRenderablesAndResourceCache(*m_displayResourceManager);
+                    }
+                }
             }
         }
     }
@@ -831,10 +1169,16 @@ namespace ramses::internal
             {
             case ESceneState::MapRequested:
             {
+                // mapping reads scene content, wait until flushes applied in background are finished
+                if (m_asyncSceneActionApplier && m_asyncSceneActionApplier->hasScene(sceneId))
+                    break;
                 assert(m_rendererScenes.getStagingInfo(sceneId).pendingData.pendingFlushes.empty());
                 const IDisplayController& displayController = m_renderer.getDisplayController();
                 m_renderer.assignSceneToDisplayBuffer(sceneId, displayController.getDisplayBuffer(), 0);
                 m_sceneStateExecutor.setMappingAndUploading(sceneId);
+                // prefetched resources are referenced again by mapping below and in next frame before any upload/unload happens,
+                // so they stay uploaded
+                releasePrefetchedSceneResources(sceneId);
                 // mapping a scene needs re-request of all its resources at the new resource manager
                 if (!markClientAndSceneResourcesForReupload(sceneId))
                 {
@@ -846,17 +1190,14 @@ namespace ramses::internal
                 break;
             case ESceneState::MappingAndUploading:
             {
-                const IRendererResourceManager& resourceManager = *m_displayResourceManager;
                 const StagingInfo& stagingInfo = m_rendererScenes.getStagingInfo(sceneId);
+                const bool progressiveMapping = m_progressiveMappingScenes.count(sceneId) != 0u;
 
                 bool canBeMapped = false;
-                // allow map only if there are no pending flushes and all used resources uploaded
+                // allow map only if there are no pending flushes and all used resources uploaded,
+                // progressively mapped scene does not wait for resources, renderables with resources not uploaded yet are skipped when rendering
                 if (stagingInfo.pendingData.pendingFlushes.empty())
-                {
-                    const auto usedResources = resourceManager.getResourcesInUseByScene(sceneId);
-                    canBeMapped = usedResources == nullptr || std::all_of(usedResources->cbegin(), usedResources->cend(),
-                        [&](const auto& res) { return resourceManager.getResourceStatus(res) == EResourceStatus::Uploaded; });
-                }
+                    canBeMapped = progressiveMapping || areResourcesInUseUploaded(sceneId);
 
                 if (!canBeMapped)
                     canBeMapped = checkIfForceMapNeeded(sceneId);
@@ -865,8 +1206,11 @@ namespace ramses::internal
                 {
                     m_sceneStateExecutor.setMapped(sceneId);
                     scenesMapped.push_back(sceneId);
+                    if (progressiveMapping)
+                        m_progressivelyMappedScenesWithPendingResources.insert(sceneId);
                     // force retrigger all render once passes,
                     // if scene was rendered before and is remapped, render once passes need to be rendered again
+                    m_rendererScenes.getScene(sceneId).setRenderOncePassesPerFrameLimit(m_renderOncePassesPerFrameLimit);
                     m_rendererScenes.getScene(sceneId).retriggerAllRenderOncePasses();
                 }
             }
@@ -892,18 +1236,62 @@ namespace ramses::internal
             }
         }
 
+        updateProgressivelyMappedScenes();
+
         for (const auto& rendererScene : m_rendererScenes)
         {
             const SceneId sceneId = rendererScene.key;
+            RendererCachedScene& scene = *rendererScene.value.scene;
             if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::RenderRequested)
             {
                 m_renderer.resetRenderInterruptState();
                 m_renderer.setSceneShown(sceneId, true);
-                m_sceneStateExecutor.setRendered(sceneId);
+                // if render once passes do not fit into single frame only those are rendered
+                // in the following frames and scene is reported as shown once the last of them is rendered
+                const bool warmUp = scene.hasRenderOncePassesForLaterFrames();
+                scene.setRenderOncePassesWarmUp(warmUp);
+                m_sceneStateExecutor.setRendered(sceneId, warmUp);
                 // in case there are any scenes depending on this scene via OB link,
                 // mark it as modified so that OB link dependency checker re-renders all that need it
                 m_modifiedScenesToRerender.put(sceneId);
             }
+            else if (scene.isRenderOncePassesWarmUp() && !scene.hasRenderOncePassesForLaterFrames())
+            {
+                assert(m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered);
+                scene.setRenderOncePassesWarmUp(false);
+                m_sceneStateExecutor.reportDeferredShown(sceneId);
+                m_modifiedScenesToRerender.put(sceneId);
+            }
+        }
+    }
+
+    bool RendererSceneUpdater::areResourcesInUseUploaded(SceneId sceneId) const
+    {
+        const IRendererResourceManager& resourceManager = *m_displayResourceManager;
+        const auto usedResources = resourceManager.getResourcesInUseByScene(sceneId);
+        return usedResources == nullptr || std::all_of(usedResources->cbegin(), usedResources->cend(),
+            [&](const auto& res) { return resourceManager.getResourceStatus(res) == EResourceStatus::Uploaded; });
+    }
+
+    void RendererSceneUpdater::updateProgressivelyMappedScenes()
+    {
+        for (auto it = m_progressivelyMappedScenesWithPendingResources.begin(); it != m_progressivelyMappedScenesWithPendingResources.end();)
+        {
+            const SceneId sceneId = *it;
+            assert(SceneStateIsAtLeast(m_sceneStateExecutor.getSceneState(sceneId), ESceneState::Mapped));
+            if (areResourcesInUseUploaded(sceneId))
+            {
+                LOG_INFO(CONTEXT_RENDERER, "Progressively mapped scene {} has all its resources uploaded", sceneId);
+                m_rendererEventCollector.addSceneResourcesEvent(ERendererEventType::SceneResourcesComplete, sceneId);
+                it = m_progressivelyMappedScenesWithPendingResources.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+            // renderables become renderable as their resources get uploaded, which is not a scene modification,
+            // re-render the scene until it is complete (including the frame it becomes complete)
+            m_modifiedScenesToRerender.put(sceneId);
         }
     }
 
@@ -969,7 +1357,7 @@ namespace ramses::internal
         return false;
     }
 
-    void RendererSceneUpdater::applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo)
+    void RendererSceneUpdater::applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo) const
     {
         const SceneActionCollection& actionsForScene = flushInfo.sceneActions;
         const uint32_t numActions = actionsForScene.numberOfActions();
@@ -983,6 +1371,14 @@ namespace ramses::internal
     void RendererSceneUpdater::destroyScene(SceneId sceneID)
     {
         m_renderer.resetRenderInterruptState();
+        releasePrefetchedSceneResources(sceneID);
+        if (m_asyncSceneActionApplier)
+            m_asyncSceneActionApplier->discard(sceneID);
+        if (m_asyncPicker)
+        {
+            m_pendingPickEvents.erase(sceneID);
+            m_asyncPicker->discard(sceneID);
+        }
         const ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneID);
         switch (sceneState)
         {
@@ -1010,6 +1406,7 @@ namespace ramses::internal
             assert(sceneState == ESceneState::MapRequested || sceneState == ESceneState::MappingAndUploading);
             m_scenesToBeMapped.erase(sceneID);
         }
+        m_progressivelyMappedScenesWithPendingResources.erase(sceneID);
 
         m_expirationMonitor.onDestroyed(sceneID);
     }
@@ -1147,6 +1544,7 @@ namespace ramses::internal
             {
             case ESceneState::Mapped:
                 m_rendererScenes.getSceneLinksManager().handleSceneUnmapped(sceneId);
+                m_progressivelyMappedScenesWithPendingResources.erase(sceneId);
                 RFALLTHROUGH;
             case ESceneState::MappingAndUploading:
                 // scene was already internally mapped and needs unload/unreference of all its resources from its resource manager
@@ -1185,6 +1583,7 @@ namespace ramses::internal
             assert(m_rendererScenes.hasScene(sceneId));
             m_renderer.resetRenderInterruptState();
             m_renderer.setSceneShown(sceneId, false);
+            m_rendererScenes.getScene(sceneId).setRenderOncePassesWarmUp(false);
             m_sceneStateExecutor.setHidden(sceneId);
             m_expirationMonitor.onHidden(sceneId);
         }
@@ -1299,6 +1698,7 @@ namespace ramses::internal
         m_renderer.resetRenderInterruptState();
         m_renderer.unregisterOffscreenBuffer(bufferDeviceHandle);
         resourceManager.unloadOffscreenBuffer(buffer);
+        m_dmaOffscreenBuffersWithSyncFence.erase(buffer);
 
         return true;
     }
@@ -1351,6 +1751,13 @@ namespace ramses::internal
             {
                 m_rendererScenes.getSceneLinksManager().handleBufferDestroyed(buffer);
 
+                const auto dmaBufferIt = m_externalBufferDmaBufferFDs.find(buffer);
+                if (dmaBufferIt != m_externalBufferDmaBufferFDs.cend())
+                {
+                    const int releaseFenceFD = resourceManager.releaseDmaBufferOfExternalBuffer(buffer);
+                    m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, buffer, dmaBufferIt->second, releaseFenceFD);
+                    m_externalBufferDmaBufferFDs.erase(dmaBufferIt);
+                }
                 resourceManager.unloadExternalBuffer(buffer);
 
                 m_rendererEventCollector.addExternalBufferEvent(ERendererEventType::ExternalBufferDestroyed, m_display, buffer, 0u);
@@ -1362,6 +1769,47 @@ namespace ramses::internal
         return false;
     }
 
+    void RendererSceneUpdater::handleExternalBufferDmaBufferUpdate(ExternalBufferHandle buffer, const DmaBufferFrame& frame)
+    {
+        if (!m_renderer.hasDisplayController())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleExternalBufferDmaBufferUpdate cannot update external buffer on invalid display.");
+            m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, buffer, frame.fd, -1);
+            return;
+        }
+
+        assert(m_displayResourceManager);
+        IRendererResourceManager& resourceManager = *m_displayResourceManager;
+        if (!resourceManager.getExternalBufferDeviceHandle(buffer).isValid())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleExternalBufferDmaBufferUpdate could not find external buffer {}", buffer);
+            m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, buffer, frame.fd, -1);
+            return;
+        }
+
+        int releaseFenceFD = -1;
+        if (!resourceManager.importDmaBufferToExternalBuffer(buffer, frame, releaseFenceFD))
+        {
+            // previous frame stays in use
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleExternalBufferDmaBufferUpdate failed to import DMA buffer (fd={}) to external buffer {}", frame.fd, buffer);
+            m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, buffer, frame.fd, -1);
+            return;
+        }
+
+        auto& dmaBufferFD = m_externalBufferDmaBufferFDs.emplace(buffer, -1).first->second;
+        if (dmaBufferFD >= 0)
+            m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(m_display, buffer, dmaBufferFD, releaseFenceFD);
+        dmaBufferFD = frame.fd;
+
+        // all scenes sampling the external buffer have to be re-rendered with the new content
+        m_tempExternalBufferLinks.clear();
+        m_rendererScenes.getSceneLinksManager().getTextureLinkManager().getExternalBufferLinks().getLinkedConsumers(buffer, m_tempExternalBufferLinks);
+        for (const auto& link : m_tempExternalBufferLinks)
+            m_modifiedScenesToRerender.put(link.consumerSceneId);
+        if (!m_tempExternalBufferLinks.empty())
+            m_renderer.resetRenderInterruptState();
+    }
+
     bool RendererSceneUpdater::handleBufferCreateRequest(StreamBufferHandle buffer, WaylandIviSurfaceId source)
     {
         if (!m_renderer.hasDisplayController())
@@ -1458,6 +1906,92 @@ namespace ramses::internal
         m_renderer.setClearColor(bufferDeviceHandle, clearColor);
     }
 
+    void RendererSceneUpdater::handleSetRenderRateDivisor(OffscreenBufferHandle buffer, uint32_t divisor)
+    {
+        if (!m_renderer.hasDisplayController())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetRenderRateDivisor cannot set render rate on invalid display.");
+            return;
+        }
+
+        const auto bufferDeviceHandle = m_displayResourceManager->getOffscreenBufferDeviceHandle(buffer);
+        if (!bufferDeviceHandle.isValid())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetRenderRateDivisor cannot set render rate for unknown offscreen buffer {}", buffer);
+            return;
+        }
+
+        m_renderer.setRenderRateDivisor(bufferDeviceHandle, divisor);
+    }
+
+    void RendererSceneUpdater::handleSetOffscreenBufferScalable(OffscreenBufferHandle buffer, bool scalable)
+    {
+        if (!m_renderer.hasDisplayController())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetOffscreenBufferScalable cannot set scalable on invalid display.");
+            return;
+        }
+
+        const auto bufferDeviceHandle = m_displayResourceManager->getOffscreenBufferDeviceHandle(buffer);
+        if (!bufferDeviceHandle.isValid())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetOffscreenBufferScalable cannot set scalable for unknown offscreen buffer {}", buffer);
+            return;
+        }
+
+        if (!scalable)
+        {
+            m_renderer.setScaledRenderTarget(bufferDeviceHandle, {});
+            return;
+        }
+
+        const auto& bufferInfo = m_renderer.getDisplaySetup().getDisplayBuffer(bufferDeviceHandle);
+        if (bufferInfo.isInterruptible)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetOffscreenBufferScalable interruptible offscreen buffer {} cannot be scalable", buffer);
+            return;
+        }
+
+        const auto scaledRenderTarget = m_displayResourceManager->uploadOffscreenBufferScaledRenderTarget(buffer,
+            ResolutionScalingController::GetScaledSize(bufferInfo.viewport.width), ResolutionScalingController::GetScaledSize(bufferInfo.viewport.height));
+        if (!scaledRenderTarget.isValid())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetOffscreenBufferScalable DMA offscreen buffer {} cannot be scalable", buffer);
+            return;
+        }
+
+        m_renderer.setScaledRenderTarget(bufferDeviceHandle, scaledRenderTarget);
+    }
+
+    void RendererSceneUpdater::handleSetDmaOffscreenBufferSyncFence(OffscreenBufferHandle buffer, bool enable)
+    {
+        if (!m_renderer.hasDisplayController())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetDmaOffscreenBufferSyncFence cannot set sync fence on invalid display.");
+            return;
+        }
+
+        if (!m_displayResourceManager->getOffscreenBufferDeviceHandle(buffer).isValid())
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetDmaOffscreenBufferSyncFence cannot set sync fence for unknown offscreen buffer {}", buffer);
+            return;
+        }
+
+        if (!enable)
+        {
+            m_dmaOffscreenBuffersWithSyncFence.erase(buffer);
+            return;
+        }
+
+        if (m_displayResourceManager->getDmaOffscreenBufferFD(buffer) < 0)
+        {
+            LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::handleSetDmaOffscreenBufferSyncFence offscreen buffer {} is not a DMA offscreen buffer", buffer);
+            return;
+        }
+
+        m_dmaOffscreenBuffersWithSyncFence.insert(buffer);
+    }
+
     void RendererSceneUpdater::handleSetExternallyOwnedWindowSize(uint32_t width, uint32_t height)
     {
         if (!m_renderer.hasDisplayController())
@@ -1556,6 +2090,8 @@ namespace ramses::internal
 
     void RendererSceneUpdater::handleSceneDataLinkRequest(SceneId providerSceneId, DataSlotId providerId, SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForAsyncFlushApplication(providerSceneId);
+        waitForAsyncFlushApplication(consumerSceneId);
         if (m_rendererScenes.hasScene(providerSceneId) && m_rendererScenes.hasScene(consumerSceneId))
         {
             const DataSlotHandle providerSlotHandle = DataLinkUtils::GetDataSlotHandle(providerSceneId, providerId, m_rendererScenes);
@@ -1583,6 +2119,7 @@ namespace ramses::internal
 
     void RendererSceneUpdater::handleBufferToSceneDataLinkRequest(OffscreenBufferHandle buffer, SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForAsyncFlushApplication(consumerSceneId);
         if (!m_renderer.hasDisplayController() || !m_rendererScenes.hasScene(consumerSceneId))
         {
             LOG_ERROR(CONTEXT_RENDERER, "Link offscreen buffer to consumer scene {} failed, invalid display or scene not mapped.", consumerSceneId);
@@ -1606,6 +2143,7 @@ namespace ramses::internal
 
     void RendererSceneUpdater::handleBufferToSceneDataLinkRequest(StreamBufferHandle buffer, SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForAsyncFlushApplication(consumerSceneId);
         if (!m_renderer.hasDisplayController() || !m_rendererScenes.hasScene(consumerSceneId))
         {
             LOG_ERROR(CONTEXT_RENDERER, "Link stream buffer to consumer scene {} failed, invalid display or scene not mapped.", consumerSceneId);
@@ -1620,6 +2158,7 @@ namespace ramses::internal
 
     void RendererSceneUpdater::handleBufferToSceneDataLinkRequest(ExternalBufferHandle buffer, SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForAsyncFlushApplication(consumerSceneId);
         if (!m_renderer.hasDisplayController() || !m_rendererScenes.hasScene(consumerSceneId))
         {
             LOG_ERROR(CONTEXT_RENDERER, "Link external buffer to consumer scene {} failed, invalid display or scene not mapped.", consumerSceneId);
@@ -1643,6 +2182,7 @@ namespace ramses::internal
 
     void RendererSceneUpdater::handleDataUnlinkRequest(SceneId consumerSceneId, DataSlotId consumerId)
     {
+        waitForAsyncFlushApplication(consumerSceneId);
         m_rendererScenes.getSceneLinksManager().removeDataLink(consumerSceneId, consumerId);
         m_modifiedScenesToRerender.put(consumerSceneId);
         m_renderer.resetRenderInterruptState();
@@ -1663,6 +2203,13 @@ namespace ramses::internal
         const glm::ivec2 coordsInBufferSpace = { static_cast<int32_t>(std::lroundf((coordsNormalizedToBufferSize.x + 1.f) * width / 2.f)) ,
                                                 static_cast<int32_t>(std::lroundf((coordsNormalizedToBufferSize.y + 1.f) * height / 2.f)) };
 
+        if (m_asyncPicker)
+        {
+            // e.g. continuous drag results in pick event for every input event, only the latest is relevant
+            m_pendingPickEvents[sceneId] = coordsInBufferSpace;
+            return;
+        }
+
         PickableObjectIds pickedObjects;
         const TransformationLinkCachedScene& scene = m_rendererScenes.getScene(sceneId);
 
@@ -1672,11 +2219,72 @@ namespace ramses::internal
             m_rendererEventCollector.addPickedEvent(ERendererEventType::ObjectsPicked, sceneId, std::move(pickedObjects));
     }
 
+    void RendererSceneUpdater::processPendingPickEvents()
+    {
+        assert(m_asyncPicker);
+        m_asyncPickedObjects.clear();
+        m_asyncPicker->collectPicked(m_asyncPickedObjects);
+        for (auto& picked : m_asyncPickedObjects)
+            m_rendererEventCollector.addPickedEvent(ERendererEventType::ObjectsPicked, picked.sceneId, std::move(picked.pickedObjects));
+
+        for (const auto& pickEvent : m_pendingPickEvents)
+        {
+            const SceneId sceneId = pickEvent.first;
+            // scene could have been unmapped since pick event was handled
+            if (!m_renderer.getBufferSceneIsAssignedTo(sceneId).isValid())
+                continue;
+
+            // snapshot is taken after scene was updated in this frame, matrices therefore match content rendered in this frame
+            IntersectionUtils::PickableObjectSnapshots pickableObjects;
+            IntersectionUtils::CollectPickableObjects(m_rendererScenes.getScene(sceneId), pickEvent.second, pickableObjects);
+            if (!pickableObjects.empty())
+                m_asyncPicker->startPicking(sceneId, std::move(pickableObjects));
+        }
+        m_pendingPickEvents.clear();
+    }
+
     bool RendererSceneUpdater::hasPendingFlushes(SceneId sceneId) const
     {
+        if (m_asyncSceneActionApplier && m_asyncSceneActionApplier->hasScene(sceneId))
+            return true;
         return m_rendererScenes.hasScene(sceneId) && !m_rendererScenes.getStagingInfo(sceneId).pendingData.pendingFlushes.empty();
     }
 
+    bool RendererSceneUpdater::hasPendingWork() const
+    {
+        if (!m_scenesToBeMapped.empty() || !m_progressivelyMappedScenesWithPendingResources.empty())
+            return true;
+        if (m_asyncSceneActionApplier && !m_asyncSceneActionApplier->isEmpty())
+            return true;
+        if (!m_pendingPickEvents.empty() || (m_asyncPicker && !m_asyncPicker->isEmpty()))
+            return true;
+        if (m_displayResourceManager && m_displayResourceManager->hasResourcesToBeUploaded())
+            return true;
+
+        for (const auto& scene : m_rendererScenes)
+        {
+            const SceneId sceneID = scene.key;
+            if (!scene.value.stagingInfo->pendingData.pendingFlushes.empty())
+                return true;
+            if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered && scene.value.scene->hasActiveShaderAnimation())
+                return true;
+            if (m_sceneStateExecutor.getSceneState(sceneID) == ESceneState::Rendered && m_renderOncePassesPerFrameLimit > 0u && scene.value.scene->hasRenderOncePassesToRender())
+                return true;
+        }
+
+        for (const auto sceneID : m_scenesToPrefetch)
+        {
+            if (m_sceneStateExecutor.getSceneState(sceneID) != ESceneState::Subscribed)
+                continue;
+            const auto prefetchedIt = m_prefetchedSceneResources.find(sceneID);
+            const size_t numPrefetched = (prefetchedIt != m_prefetchedSceneResources.cend() ? prefetchedIt->second.size() : 0u);
+            if (m_rendererScenes.getStagingInfo(sceneID).resourcesToUploadOnceMapping.size() > numPrefetched)
+                return true;
+        }
+
+        return false;
+    }
+
     void RendererSceneUpdater::setLimitFlushesForceApply(size_t limitForPendingFlushesForceApply)
     {
         m_maximumPendingFlushes = limitForPendingFlushesForceApply;
@@ -1689,6 +2297,9 @@ namespace ramses::internal
 
     void RendererSceneUpdater::logRendererInfo(const RendererCommand::LogInfo& cmd) const
     {
+        // logger reads content of all scenes
+        if (m_asyncSceneActionApplier)
+            m_asyncSceneActionApplier->waitUntilAllApplied();
         RendererLogger::LogTopic(*this, cmd);
     }
 
@@ -1697,6 +2308,14 @@ namespace ramses::internal
         m_skipUnmodifiedScenes = enable;
     }
 
+    void RendererSceneUpdater::handleTrimMemory()
+    {
+        // display without resource manager has nothing to trim but still reports so that application gets a result for each display
+        const uint64_t freedMemory = (m_displayResourceManager ? m_displayResourceManager->trimMemory() : 0u);
+        LOG_INFO(CONTEXT_RENDERER, "RendererSceneUpdater::handleTrimMemory: display {} unloaded unused resources, freed {} KB", m_display, freedMemory / 1024u);
+        m_rendererEventCollector.addMemoryTrimmedEvent(m_display, freedMemory);
+    }
+
     void RendererSceneUpdater::setSceneReferenceLogicHandler(ISceneReferenceLogic& sceneRefLogic)
     {
         assert(m_sceneReferenceLogic == nullptr);
@@ -1748,6 +2367,7 @@ namespace ramses::internal
         {
             if (m_scenesNeedingTransformationCacheUpdate.contains(sceneId))
             {
+                SceneCpuTimeScope cpuTime{ m_renderer.getStatistics(), sceneId, ESceneCpuTime::Transformations };
                 RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
                 renderScene.updateRenderableWorldMatricesWithLinks();
                 m_scenesNeedingTransformationCacheUpdate.remove(sceneId);
@@ -1757,6 +2377,7 @@ namespace ramses::internal
         // update rest of scenes that have no dependencies
         for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
         {
+            SceneCpuTimeScope cpuTime{ m_renderer.getStatistics(), sceneId, ESceneCpuTime::Transformations };
             RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
             renderScene.updateRenderableWorldMatrices();
         }
@@ -1915,7 +2536,13 @@ namespace ramses::internal
             const DeviceResourceHandle renderTargetHandle = bufferScreenshot.first;
             auto& screenshot = bufferScreenshot.second;
 
-            if (!screenshot.filename.empty())
+            if (screenshot.pixelData.empty())
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "RendererSceneUpdater::processScreenshotResults: asynchronous read back of pixels failed (buffer={})", renderTargetHandle);
+                if (screenshot.filename.empty())
+                    m_rendererEventCollector.addReadPixelsEvent(ERendererEventType::ReadPixelsFromFramebufferFailed, m_display, resourceManager.getOffscreenBufferHandle(renderTargetHandle), {});
+            }
+            else if (!screenshot.filename.empty())
             {
                 // flip image vertically so that the layout read from frame buffer (bottom-up)
                 // is converted to layout normally used in image files (top-down)
@@ -1941,4 +2568,22 @@ namespace ramses::internal
             }
         }
     }
+
+    void RendererSceneUpdater::processRenderedDmaOffscreenBuffers()
+    {
+        if (m_dmaOffscreenBuffersWithSyncFence.empty() || !m_displayResourceManager)
+            return;
+
+        IRendererResourceManager& resourceManager = *m_displayResourceManager;
+        for (const auto bufferDeviceHandle : m_renderer.getOffscreenBuffersRenderedInLastLoop())
+        {
+            const OffscreenBufferHandle buffer = resourceManager.getOffscreenBufferHandle(bufferDeviceHandle);
+            if (m_dmaOffscreenBuffersWithSyncFence.count(buffer) == 0u)
+                continue;
+
+            // fence is created after whole frame was submitted, ownership of the FD is passed to application with the event
+            const int syncFenceFD = resourceManager.createDmaOffscreenBufferSyncFence(buffer);
+            m_rendererEventCollector.addDmaOffscreenBufferRenderedEvent(m_display, buffer, syncFenceFD);
+        }
+    }
 }
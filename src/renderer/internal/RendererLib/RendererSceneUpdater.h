@@ -17,10 +17,16 @@
 #include "internal/RendererLib/IRendererSceneUpdater.h"
 #include "internal/RendererLib/IRendererResourceManager.h"
 #include "internal/RendererLib/AsyncEffectUploader.h"
+#include "internal/RendererLib/SceneBudgetScheduler.h"
+#include "internal/RendererLib/WorkerThreadPool.h"
+#include "internal/RendererLib/AsyncSceneActionApplier.h"
+#include "internal/RendererLib/AsyncPicker.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "ramses/framework/EFeatureLevel.h"
+#include <chrono>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ramses::internal
 {
@@ -73,8 +79,12 @@ namespace ramses::internal
         bool handleBufferDestroyRequest(StreamBufferHandle buffer) override;
         bool handleExternalBufferCreateRequest(ExternalBufferHandle buffer) override;
         bool handleExternalBufferDestroyRequest(ExternalBufferHandle buffer) override;
+        void handleExternalBufferDmaBufferUpdate(ExternalBufferHandle buffer, const DmaBufferFrame& frame) override;
         void handleSetClearFlags(OffscreenBufferHandle buffer, ClearFlags clearFlags) override;
         void handleSetClearColor(OffscreenBufferHandle buffer, const glm::vec4& clearColor) override;
+        void handleSetRenderRateDivisor(OffscreenBufferHandle buffer, uint32_t divisor) override;
+        void handleSetOffscreenBufferScalable(OffscreenBufferHandle buffer, bool scalable) override;
+        void handleSetDmaOffscreenBufferSyncFence(OffscreenBufferHandle buffer, bool enable) override;
         void handleSetExternallyOwnedWindowSize(uint32_t width, uint32_t height) override;
         void handleReadPixels(OffscreenBufferHandle buffer, ScreenshotInfo&& screenshotInfo) override;
         void handlePickEvent(SceneId sceneId, glm::vec2 coordsNormalizedToBufferSize) override;
@@ -86,6 +96,7 @@ namespace ramses::internal
         void setLimitFlushesForceApply(size_t limitForPendingFlushesForceApply) override;
         void setLimitFlushesForceUnsubscribe(size_t limitForPendingFlushesForceUnsubscribe) override;
         void setSkippingOfUnmodifiedScenes(bool enable) override;
+        void handleTrimMemory() override;
         void logRendererInfo(const RendererCommand::LogInfo& cmd) const override;
 
         // IRendererSceneStateControl
@@ -100,9 +111,16 @@ namespace ramses::internal
         void updateScenes();
 
         void processScreenshotResults();
+        // creates sync fence and event for every DMA offscreen buffer with enabled sync fence rendered in last render loop
+        void processRenderedDmaOffscreenBuffers();
         [[nodiscard]] bool hasPendingFlushes(SceneId sceneId) const;
+        // true if there is anything progressing only with further updates, e.g. flushes waiting for resources or active shader animation
+        [[nodiscard]] bool hasPendingWork() const;
         void setSceneReferenceLogicHandler(ISceneReferenceLogic& sceneRefLogic);
 
+        [[nodiscard]] bool hasResourceManager() const;
+        [[nodiscard]] GpuMemoryReport getGpuMemoryReport() const;
+
     protected:
         virtual std::unique_ptr<IRendererResourceManager> createResourceManager(
             IRenderBackend& renderBackend,
@@ -110,8 +128,6 @@ namespace ramses::internal
             const DisplayConfigData& displayConfig,
             IBinaryShaderCache* binaryShaderCache);
 
-        [[nodiscard]] bool hasResourceManager() const;
-
         std::chrono::milliseconds m_maximumWaitingTimeToForceMap{ 2000 };
 
     private:
@@ -119,17 +135,29 @@ namespace ramses::internal
         void unloadSceneResourcesAndUnrefSceneResources(SceneId sceneId);
         bool markClientAndSceneResourcesForReupload(SceneId sceneId);
 
+        [[nodiscard]] bool canApplyPendingFlushes(SceneId sceneID, const StagingInfo& stagingInfo);
         void updateScenePendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
-        void applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo);
+        void applySceneActions(RendererCachedScene& scene, PendingFlush& flushInfo) const;
         void applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
+        bool applySceneActionsOfPendingFlushes(RendererCachedScene& scene, PendingFlushes& pendingFlushes, const SceneSizeInformation& sizeInfo) const;
+        void finishAppliedPendingFlushes(SceneId sceneID, PendingData& appliedData, StagingInfo& stagingInfo, bool hadActiveShaderAnimation);
+        void tryToApplyPendingFlushesInParallel();
+        [[nodiscard]] bool canApplySceneActionsConcurrently(SceneId sceneID, const PendingFlushes& pendingFlushes) const;
+        [[nodiscard]] bool tryToStartAsyncFlushApplication(SceneId sceneID, StagingInfo& stagingInfo);
+        void finishAsynchronouslyAppliedFlushes();
+        void waitForAsyncFlushApplication(SceneId sceneID);
         void processStagedResourceChanges(SceneId sceneID, StagingInfo& stagingInfo);
 
         [[nodiscard]] bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
+        [[nodiscard]] bool areResourcesInUseUploaded(SceneId sceneId) const;
+        void updateProgressivelyMappedScenes();
 
         void consolidatePendingSceneActions(SceneId sceneID, SceneUpdate&& sceneUpdate);
         void consolidateResourceDataForMapping(SceneId sceneID);
         void referenceAndProvidePendingResourceData(SceneId sceneID);
         void requestAndUploadAndUnloadResources();
+        void prefetchSceneResources();
+        void releasePrefetchedSceneResources(SceneId sceneID);
         void uploadUpdatedECStreams();
         void tryToApplyPendingFlushes();
         void collectDirtySemanticUniformBuffers();
@@ -140,6 +168,7 @@ namespace ramses::internal
         void updateScenesShaderAnimations();
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
+        void processPendingPickEvents();
         void updateAndUploadSemanticUniformBuffers();
         void updateScenesStates();
 
@@ -174,6 +203,48 @@ namespace ramses::internal
         };
         std::unordered_map<SceneId, SceneMapRequest> m_scenesToBeMapped;
 
+        // scenes whose resources are uploaded ahead of mapping while subscribed (see DisplayConfig::setScenePrefetch)
+        // and the resources already referenced for them by prefetching
+        std::unordered_set<SceneId> m_scenesToPrefetch;
+        std::unordered_map<SceneId, HashSet<ResourceContentHash>> m_prefetchedSceneResources;
+        size_t m_prefetchBatchSize = 10u;
+
+        // scenes mapped without waiting for their resources (see DisplayConfig::setSceneProgressiveMapping)
+        // and those of them mapped but still waiting for some of their resources to be uploaded
+        std::unordered_set<SceneId> m_progressiveMappingScenes;
+        std::unordered_set<SceneId> m_progressivelyMappedScenesWithPendingResources;
+
+        std::unique_ptr<SceneBudgetScheduler> m_sceneBudgetScheduler;
+        std::vector<SceneId> m_scenesWithPendingFlushes; //to avoid re-allocation each frame
+
+        // applies scene actions of independent scenes concurrently (see DisplayConfig::setFlushApplyThreadCount)
+        std::unique_ptr<WorkerThreadPool> m_flushApplyWorkers;
+        struct SceneToApplyFlushes
+        {
+            SceneId sceneId;
+            RendererCachedScene* scene = nullptr;
+            StagingInfo* stagingInfo = nullptr;
+            bool applyInParallel = false;
+            bool hadActiveShaderAnimation = false;
+            std::chrono::microseconds applyTime{ 0 };
+        };
+        std::vector<SceneToApplyFlushes> m_scenesToApplyFlushes; //to avoid re-allocation each frame
+        std::vector<size_t> m_scenesToApplyFlushesInParallel; //to avoid re-allocation each frame
+
+        // applies large flushes of scenes not used for rendering yet in background (see DisplayConfig::setAsyncFlushApplyThreshold)
+        std::unique_ptr<AsyncSceneActionApplier> m_asyncSceneActionApplier;
+        uint32_t m_asyncFlushApplyThreshold = 0u;
+
+        // see DisplayConfig::setRenderOncePassesPerFrameLimit
+        uint32_t m_renderOncePassesPerFrameLimit = 0u;
+
+        // checks pick events on background thread (see DisplayConfig::setAsyncPickingEnabled),
+        // pick events are collected till next update, only latest one per scene in buffer space coordinates
+        std::unique_ptr<AsyncPicker> m_asyncPicker;
+        std::unordered_map<SceneId, glm::ivec2> m_pendingPickEvents;
+        AsyncPicker::PickedObjectsVector m_asyncPickedObjects; //to avoid re-allocation each frame
+        AsyncSceneActionApplier::AppliedFlushesVector m_asyncAppliedFlushes; //to avoid re-allocation each frame
+
         // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
 
@@ -181,6 +252,10 @@ namespace ramses::internal
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
         std::vector<SceneId> m_offscreeenBufferModifiedScenesVisitingCache;
+        std::unordered_set<OffscreenBufferHandle> m_dmaOffscreenBuffersWithSyncFence;
+        // FD of application DMA buffer currently imported as content of external buffer, given back when replaced or buffer destroyed
+        std::unordered_map<ExternalBufferHandle, int> m_externalBufferDmaBufferFDs;
+        ExternalBufferLinkVector m_tempExternalBufferLinks;
         OffscreenBufferLinkVector m_offscreenBufferConsumerSceneLinksCache;
 
         size_t m_maximumPendingFlushes = 120u;
@@ -192,6 +267,7 @@ namespace ramses::internal
 
         // keep as members to avoid runtime re-allocs
         StreamSourceUpdates m_streamUpdates;
+        StreamBufferLinkVector m_tempStreamBufferLinks;
         RenderableVector m_tempRenderablesWithUpdatedVertexArrays;
     };
 }
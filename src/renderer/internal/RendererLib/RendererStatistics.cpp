@@ -9,6 +9,9 @@
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/PlatformAbstraction/Collections/StringOutputStream.h"
+#include <algorithm>
+#include <numeric>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -31,11 +34,43 @@ namespace ramses::internal
         m_sceneStatistics[sceneId].numRendered++;
     }
 
+    void RendererStatistics::renderablesCulled(SceneId sceneId, size_t numCulled)
+    {
+        m_sceneStatistics[sceneId].numRenderablesCulled += numCulled;
+    }
+
+    void RendererStatistics::renderingPassesSkipped(SceneId sceneId, size_t numSkipped)
+    {
+        m_sceneStatistics[sceneId].numRenderingPassesSkipped += numSkipped;
+    }
+
+    void RendererStatistics::sceneGpuTimeMeasured(SceneId sceneId, std::chrono::microseconds gpuTime)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.gpuTime.update(static_cast<int64_t>(gpuTime.count()));
+        sceneStats.numGpuTimeMeasurements++;
+    }
+
+    void RendererStatistics::sceneCpuTimeMeasured(SceneId sceneId, ESceneCpuTime category, std::chrono::microseconds cpuTime)
+    {
+        m_sceneStatistics[sceneId].cpuTime[static_cast<size_t>(category)] += cpuTime;
+    }
+
+    std::chrono::microseconds RendererStatistics::SceneStatistics::getTotalCpuTime() const
+    {
+        return std::accumulate(cpuTime.cbegin(), cpuTime.cend(), std::chrono::microseconds{ 0 });
+    }
+
     void RendererStatistics::offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible)
     {
         auto& obStat = m_displayStatistics.offscreenBufferStatistics[offscreenBuffer];
         obStat.numSwapped++;
         obStat.isInterruptible = isInterruptible;
+        if (isInterruptible)
+        {
+            obStat.swapLatency.update(obStat.frameFirstInterrupted < 0 ? 0u : static_cast<size_t>(m_frameNumber - obStat.frameFirstInterrupted));
+            obStat.frameFirstInterrupted = -1;
+        }
     }
 
     void RendererStatistics::offscreenBufferInterrupted(DeviceResourceHandle offscreenBuffer)
@@ -43,6 +78,8 @@ namespace ramses::internal
         auto& obStat = m_displayStatistics.offscreenBufferStatistics[offscreenBuffer];
         obStat.numInterrupted++;
         obStat.isInterruptible = true;
+        if (obStat.frameFirstInterrupted < 0)
+            obStat.frameFirstInterrupted = m_frameNumber;
     }
 
     void RendererStatistics::framebufferSwapped()
@@ -50,6 +87,11 @@ namespace ramses::internal
         m_displayStatistics.numFrameBufferSwapped++;
     }
 
+    void RendererStatistics::framebufferDirectScanoutCandidate()
+    {
+        m_displayStatistics.numFramesDirectScanoutCandidate++;
+    }
+
     void RendererStatistics::resourceUploaded(size_t byteSize)
     {
         m_resourcesUploaded++;
@@ -121,6 +163,13 @@ namespace ramses::internal
         }
     }
 
+    void RendererStatistics::flushPresented(SceneId sceneId, std::chrono::microseconds latency)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        sceneStats.numFlushesPresented++;
+        sceneStats.presentationLatency.update(static_cast<int64_t>(latency.count()));
+    }
+
     void RendererStatistics::flushBlocked(SceneId sceneId)
     {
         auto& sceneStats = m_sceneStatistics[sceneId];
@@ -140,6 +189,16 @@ namespace ramses::internal
         }
     }
 
+    void RendererStatistics::sceneBudgetExceeded(SceneId sceneId)
+    {
+        auto& sceneStats = m_sceneStatistics[sceneId];
+        if (sceneStats.lastFrameBudgetExceeded != m_frameNumber)
+        {
+            sceneStats.numFramesBudgetExceeded++;
+            sceneStats.lastFrameBudgetExceeded = m_frameNumber;
+        }
+    }
+
     void RendererStatistics::untrackScene(SceneId sceneId)
     {
         m_sceneStatistics.erase(sceneId);
@@ -228,19 +287,33 @@ namespace ramses::internal
             sceneStat.numResourcesRemovedPerFlush.reset();
             sceneStat.numSceneResourceActionsPerFlush.reset();
             sceneStat.flushLatency.reset();
+            sceneStat.presentationLatency.reset();
+            sceneStat.numFlushesPresented = 0u;
             sceneStat.expirationOffset.reset();
             sceneStat.numExpirationOffsets = 0u;
             sceneStat.numExpiredOffsets = 0u;
             sceneStat.sceneResourcesUploaded = 0u;
             sceneStat.sceneResourcesBytesUploaded = 0u;
             sceneStat.numRendered = 0u;
+            sceneStat.numRenderablesCulled = 0u;
+            sceneStat.numRenderingPassesSkipped = 0u;
+            sceneStat.gpuTime.reset();
+            sceneStat.numGpuTimeMeasurements = 0u;
+            sceneStat.numFramesBudgetExceeded = 0u;
+            sceneStat.lastFrameBudgetExceeded = -1;
+            sceneStat.cpuTime.fill(std::chrono::microseconds{ 0 });
         }
 
         m_displayStatistics.numFrameBufferSwapped = 0u;
+        m_displayStatistics.numFramesDirectScanoutCandidate = 0u;
         for (auto& obStat : m_displayStatistics.offscreenBufferStatistics)
         {
             obStat.second.numSwapped = 0u;
             obStat.second.numInterrupted = 0u;
+            obStat.second.swapLatency.reset();
+            // rendering interrupted in previous period and not swapped yet is measured from start of this period
+            if (obStat.second.frameFirstInterrupted >= 0)
+                obStat.second.frameFirstInterrupted = 0;
         }
 
         for (auto& strTexStat : m_streamTextureStatistics)
@@ -275,14 +348,39 @@ namespace ramses::internal
         str << "\n";
 
         str << "FB: " << m_displayStatistics.numFrameBufferSwapped;
+        if (m_displayStatistics.numFramesDirectScanoutCandidate > 0u)
+            str << " (scanoutCandidate " << m_displayStatistics.numFramesDirectScanoutCandidate << ")";
         for (const auto& obStat : m_displayStatistics.offscreenBufferStatistics)
         {
             str << "; OB" << obStat.first << ": " << obStat.second.numSwapped;
             if (obStat.second.isInterruptible)
+            {
                 str << " (intr: " << obStat.second.numInterrupted << ")";
+                const auto& swapLatency = obStat.second.swapLatency;
+                if (obStat.second.numSwapped > 0u)
+                    str << " latency (" << swapLatency.minValue << "/" << swapLatency.maxValue << "/" << static_cast<float>(swapLatency.sum) / static_cast<float>(obStat.second.numSwapped) << ")";
+            }
         }
         str << "\n";
 
+        // scenes which cost most render thread time within period
+        std::vector<std::pair<SceneId, std::chrono::microseconds>> scenesByCpuTime;
+        for (const auto& sceneStatsIt : m_sceneStatistics)
+        {
+            const auto cpuTime = sceneStatsIt.second.getTotalCpuTime();
+            if (cpuTime.count() > 0)
+                scenesByCpuTime.emplace_back(sceneStatsIt.first, cpuTime);
+        }
+        if (!scenesByCpuTime.empty())
+        {
+            const auto numTopScenes = std::min(scenesByCpuTime.size(), NumTopScenesByCpuTime);
+            std::partial_sort(scenesByCpuTime.begin(), scenesByCpuTime.begin() + numTopScenes, scenesByCpuTime.end(), [](const auto& a, const auto& b) { return a.second > b.second; });
+            str << "Top scenes by CPU time:";
+            for (size_t i = 0u; i < numTopScenes; ++i)
+                str << (i == 0u ? " " : ", ") << scenesByCpuTime[i].first << " (" << scenesByCpuTime[i].second.count() << "us, " << scenesByCpuTime[i].second.count() / m_frameNumber << "us/frame)";
+            str << "\n";
+        }
+
         for (const auto& sceneStatsIt : m_sceneStatistics)
         {
             const auto& sceneStats = sceneStatsIt.second;
@@ -310,11 +408,29 @@ namespace ramses::internal
                 str << ", RC-/F (" << numResourcesRemovedPerFlush.minValue << "/" << numResourcesRemovedPerFlush.maxValue << "/" << static_cast<float>(numResourcesRemovedPerFlush.sum) / static_cast<float>(sceneStats.numFlushesArrived) << ")";
                 str << ", RS/F (" << numSceneResourceActionsPerFlush.minValue << "/" << numSceneResourceActionsPerFlush.maxValue << "/" << static_cast<float>(numSceneResourceActionsPerFlush.sum) / static_cast<float>(sceneStats.numFlushesArrived) << ")";
             }
+            if (sceneStats.numFlushesPresented > 0u)
+                str << ", presentLatencyUs (" << sceneStats.presentationLatency.minValue << "/" << sceneStats.presentationLatency.maxValue << "/" << sceneStats.presentationLatency.sum / static_cast<int64_t>(sceneStats.numFlushesPresented) << ")";
             if (sceneStats.numExpirationOffsets > 0u)
                 str << ", Exp (" << sceneStats.numExpiredOffsets << "/" << sceneStats.numExpirationOffsets << ":" << expirationOffset.minValue << "/" << expirationOffset.maxValue << "/" << static_cast<float>(expirationOffset.sum) / static_cast<float>(sceneStats.numExpirationOffsets) << ")";
 
             if (sceneStats.sceneResourcesUploaded > 0u)
                 str << ", RSUploaded " << sceneStats.sceneResourcesUploaded << " (" << sceneStats.sceneResourcesBytesUploaded << " B)";
+            if (sceneStats.numRenderablesCulled > 0u)
+                str << ", culled " << sceneStats.numRenderablesCulled;
+            if (sceneStats.numRenderingPassesSkipped > 0u)
+                str << ", skippedPasses " << sceneStats.numRenderingPassesSkipped;
+            if (sceneStats.numGpuTimeMeasurements > 0u)
+                str << ", gpuTimeUs (" << sceneStats.gpuTime.minValue << "/" << sceneStats.gpuTime.maxValue << "/" << sceneStats.gpuTime.sum / static_cast<int64_t>(sceneStats.numGpuTimeMeasurements) << ")";
+            if (sceneStats.numFramesBudgetExceeded > 0u)
+                str << ", framesBudgetExceeded " << sceneStats.numFramesBudgetExceeded;
+            if (sceneStats.getTotalCpuTime().count() > 0)
+            {
+                const auto& cpuTime = sceneStats.cpuTime;
+                str << ", cpuTimeUs apply/res/transf/render (" << cpuTime[static_cast<size_t>(ESceneCpuTime::FlushApplication)].count()
+                    << "/" << cpuTime[static_cast<size_t>(ESceneCpuTime::ResourceBookkeeping)].count()
+                    << "/" << cpuTime[static_cast<size_t>(ESceneCpuTime::Transformations)].count()
+                    << "/" << cpuTime[static_cast<size_t>(ESceneCpuTime::Rendering)].count() << ")";
+            }
             str << "\n";
         }
 
@@ -14,6 +14,8 @@
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/Components/FlushTimeInformation.h"
 
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -23,20 +25,40 @@ namespace ramses::internal
 {
     class StringOutputStream;
 
+    // render thread work attributed to a scene
+    enum class ESceneCpuTime : uint8_t
+    {
+        FlushApplication = 0,
+        ResourceBookkeeping,
+        Transformations,
+        Rendering,
+        Count
+    };
+
     class RendererStatistics
     {
     public:
+        // number of scenes with highest CPU time listed in log
+        static constexpr size_t NumTopScenesByCpuTime = 3u;
+
         [[nodiscard]] float  getFps() const;
         [[nodiscard]] uint32_t getDrawCallsPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
+        void renderablesCulled(SceneId sceneId, size_t numCulled);
+        void renderingPassesSkipped(SceneId sceneId, size_t numSkipped);
+        void sceneGpuTimeMeasured(SceneId sceneId, std::chrono::microseconds gpuTime);
         void trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency);
         void flushApplied(SceneId sceneId);
         void flushBlocked(SceneId sceneId);
+        void flushPresented(SceneId sceneId, std::chrono::microseconds latency);
+        void sceneBudgetExceeded(SceneId sceneId);
+        void sceneCpuTimeMeasured(SceneId sceneId, ESceneCpuTime category, std::chrono::microseconds cpuTime);
 
         void offscreenBufferSwapped(DeviceResourceHandle offscreenBuffer, bool isInterruptible);
         void offscreenBufferInterrupted(DeviceResourceHandle offscreenBuffer);
         void framebufferSwapped();
+        void framebufferDirectScanoutCandidate();
 
         void resourceUploaded(size_t byteSize);
         void sceneResourceUploaded(SceneId sceneId, size_t byteSize);
@@ -91,6 +113,9 @@ namespace ramses::internal
             SummaryEntry<size_t> numResourcesRemovedPerFlush;
             SummaryEntry<size_t> numSceneResourceActionsPerFlush;
             SummaryEntry<int64_t> flushLatency;
+            // from flush on client side to presentation of frame which contains it (if provided by platform)
+            SummaryEntry<int64_t> presentationLatency;
+            size_t numFlushesPresented = 0u;
 
             // expiration offset in milliseconds, can be negative and zero (=healthy) or positive (=expired)
             SummaryEntry<int64_t> expirationOffset;
@@ -101,6 +126,18 @@ namespace ramses::internal
             size_t sceneResourcesBytesUploaded = 0u;
 
             size_t numRendered = 0u;
+            size_t numRenderablesCulled = 0u;
+            size_t numRenderingPassesSkipped = 0u;
+
+            SummaryEntry<int64_t> gpuTime;
+            size_t numGpuTimeMeasurements = 0u;
+
+            // frames where work of scene was deferred due to exceeded frame budget
+            size_t numFramesBudgetExceeded = 0u;
+            int32_t lastFrameBudgetExceeded = -1;
+
+            std::array<std::chrono::microseconds, static_cast<size_t>(ESceneCpuTime::Count)> cpuTime{};
+            [[nodiscard]] std::chrono::microseconds getTotalCpuTime() const;
         };
 
         struct OffscreenBufferStatistics
@@ -108,11 +145,16 @@ namespace ramses::internal
             size_t numSwapped = 0u;
             size_t numInterrupted = 0u;
             bool isInterruptible = false;
+
+            // frames from first interruption of rendering to swap, i.e. how many frames consumers sample older content
+            SummaryEntry<size_t> swapLatency;
+            int32_t frameFirstInterrupted = -1;
         };
 
         struct DisplayStatistics
         {
             size_t numFrameBufferSwapped = 0;
+            size_t numFramesDirectScanoutCandidate = 0;
             std::map<DeviceResourceHandle, OffscreenBufferStatistics> offscreenBufferStatistics;
         };
 
@@ -139,4 +181,31 @@ namespace ramses::internal
         DisplayStatistics m_displayStatistics;
         std::map< WaylandIviSurfaceId, StreamTextureStatistics, StronglyTypedValueComparator<WaylandIviSurfaceId> > m_streamTextureStatistics;
     };
+
+    // measures time spent on render thread for work of a scene and adds it to statistics when going out of scope
+    class SceneCpuTimeScope
+    {
+    public:
+        SceneCpuTimeScope(RendererStatistics& statistics, SceneId sceneId, ESceneCpuTime category)
+            : m_statistics{ statistics }
+            , m_sceneId{ sceneId }
+            , m_category{ category }
+            , m_start{ std::chrono::steady_clock::now() }
+        {
+        }
+
+        ~SceneCpuTimeScope()
+        {
+            m_statistics.sceneCpuTimeMeasured(m_sceneId, m_category, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start));
+        }
+
+        SceneCpuTimeScope(const SceneCpuTimeScope&) = delete;
+        SceneCpuTimeScope& operator=(const SceneCpuTimeScope&) = delete;
+
+    private:
+        RendererStatistics& m_statistics;
+        SceneId m_sceneId;
+        ESceneCpuTime m_category;
+        std::chrono::steady_clock::time_point m_start;
+    };
 }
@@ -12,6 +12,7 @@
 #include "internal/RendererLib/SceneRenderExecutionIterator.h"
 #include "internal/SceneGraph/SceneAPI/Viewport.h"
 #include "internal/SceneGraph/SceneAPI/RenderState.h"
+#include "internal/Core/Math3d/Quad.h"
 
 namespace ramses::internal
 {
@@ -25,5 +26,13 @@ namespace ramses::internal
         ClearFlags displayBufferClearPending = EClearFlag::None;
         glm::vec4 displayBufferClearColor{};
         bool displayBufferDepthDiscard = false;
+        // skip rendering passes whose output is not used, see RendererCachedScene::isRenderingPassOutputUsed
+        bool skipPassesWithUnusedOutput = false;
+        // if set, rendering into display buffer (clear included) is limited to redraw region, used for partial redraw of damaged region
+        bool limitToRedrawRegion = false;
+        Quad redrawRegion{};
+        // display buffer is rendered at reduced resolution, camera viewports and scissor regions of passes rendering into it are scaled by this factor,
+        // viewport size above is expected to be scaled already
+        float resolutionScale = 1.f;
     };
 }
@@ -0,0 +1,56 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResolutionScalingController.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    ResolutionScalingController::ResolutionScalingController(std::chrono::microseconds gpuFrameTimeThreshold)
+        : m_threshold(gpuFrameTimeThreshold)
+    {
+    }
+
+    bool ResolutionScalingController::update(std::chrono::microseconds gpuFrameTime)
+    {
+        if (!isEnabled())
+            return false;
+
+        const bool towardsStateChange = m_scaling ?
+            (static_cast<float>(gpuFrameTime.count()) < static_cast<float>(m_threshold.count()) * StopScalingThresholdFactor) :
+            (gpuFrameTime > m_threshold);
+        if (!towardsStateChange)
+        {
+            m_framesTowardsStateChange = 0u;
+            return false;
+        }
+
+        ++m_framesTowardsStateChange;
+        if (m_framesTowardsStateChange < (m_scaling ? FramesToStopScaling : FramesToStartScaling))
+            return false;
+
+        m_scaling = !m_scaling;
+        m_framesTowardsStateChange = 0u;
+        return true;
+    }
+
+    uint32_t ResolutionScalingController::GetScaledSize(uint32_t size)
+    {
+        return std::max(1u, static_cast<uint32_t>(static_cast<float>(size) * Scale));
+    }
+
+    bool ResolutionScalingController::isEnabled() const
+    {
+        return m_threshold.count() > 0;
+    }
+
+    bool ResolutionScalingController::isScaling() const
+    {
+        return m_scaling;
+    }
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Decides from measured GPU frame times whether scalable offscreen buffers are rendered at reduced resolution.
+    // Uses hysteresis so that the resolution does not flip with every frame whose GPU time is just around the threshold:
+    // scaling starts only after several consecutive frames over threshold and stops only after many frames clearly below it.
+    class ResolutionScalingController
+    {
+    public:
+        // zero threshold disables scaling
+        explicit ResolutionScalingController(std::chrono::microseconds gpuFrameTimeThreshold);
+
+        // returns true if scaling state changed
+        bool update(std::chrono::microseconds gpuFrameTime);
+
+        [[nodiscard]] bool isEnabled() const;
+        [[nodiscard]] bool isScaling() const;
+
+        // factor applied to width and height of scalable offscreen buffers while scaling
+        static constexpr float Scale = 0.5f;
+        [[nodiscard]] static uint32_t GetScaledSize(uint32_t size);
+        static constexpr uint32_t FramesToStartScaling = 3u;
+        static constexpr uint32_t FramesToStopScaling = 60u;
+        // GPU time has to be below this fraction of threshold to count towards stopping of scaling,
+        // rendering at full resolution again would otherwise likely exceed threshold right away
+        static constexpr float StopScalingThresholdFactor = 0.7f;
+
+    private:
+        std::chrono::microseconds m_threshold;
+        bool m_scaling = false;
+        uint32_t m_framesTowardsStateChange = 0u;
+    };
+}
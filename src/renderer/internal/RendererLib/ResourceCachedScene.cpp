@@ -714,4 +714,23 @@ namespace ramses::internal
         m_renderTargetsDirty = !m_renderTargetCache.empty();
         m_blitPassesDirty = !m_blitPassCache.empty();
     }
+
+    void ResourceCachedScene::invalidateRenderTargetResources()
+    {
+        // device handles of render targets and render buffers changed (e.g. render target memory aliasing),
+        // re-resolve render targets and all renderables sampling from render buffers
+        std::fill(m_renderTargetCache.begin(), m_renderTargetCache.end(), DeviceResourceHandle::Invalid());
+        m_renderTargetsDirty = !m_renderTargetCache.empty();
+
+        const uint32_t totalTextureSamplerCount = getTextureSamplerCount();
+        for (TextureSamplerHandle sampler(0u); sampler < totalTextureSamplerCount; ++sampler)
+        {
+            if (isTextureSamplerAllocated(sampler))
+            {
+                const auto contentType = getTextureSampler(sampler).contentType;
+                if (contentType == TextureSampler::ContentType::RenderBuffer || contentType == TextureSampler::ContentType::RenderBufferMS)
+                    setRenderableResourcesDirtyByTextureSampler(sampler);
+            }
+        }
+    }
 }
@@ -51,6 +51,7 @@ namespace ramses::internal
         BlitPassHandle              allocateBlitPass            (RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle) override;
 
         void                                resetResourceCache();
+        void                                invalidateRenderTargetResources();
 
         bool                                renderableResourcesDirty    (RenderableHandle handle) const;
         bool                                renderableResourcesDirty    (const RenderableVector& handles) const;
@@ -0,0 +1,120 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResourceDecompressionWorker.h"
+#include "internal/SceneGraph/Resource/IResource.h"
+#include "internal/Watchdog/IThreadAliveNotifier.h"
+#include "internal/Core/Utils/LogMacros.h"
+
+namespace ramses::internal
+{
+    ResourceDecompressionWorker::ResourceDecompressionWorker(IThreadAliveNotifier& notifier, ThreadScheduling scheduling)
+        : m_thread{ "ResDecompress" }
+        , m_notifier(notifier)
+        , m_aliveIdentifier(notifier.registerThread())
+        , m_scheduling(std::move(scheduling))
+    {
+        m_thread.start(*this);
+    }
+
+    ResourceDecompressionWorker::~ResourceDecompressionWorker()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            // cancel inside critical section to avoid missing the wake up in run()
+            m_thread.cancel();
+        }
+        m_sleepConditionVar.notify_one();
+        m_thread.join();
+        m_notifier.unregisterThread(m_aliveIdentifier);
+    }
+
+    void ResourceDecompressionWorker::shareAndScheduleDecompression(ManagedResourceVector& resources)
+    {
+        size_t numScheduled = 0u;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            for (auto& resource : resources)
+            {
+                auto& sharedResource = m_sharedResources[resource->getHash()];
+                if (auto existingResource = sharedResource.lock())
+                {
+                    // same content already dispatched, possibly to another display, use the existing instance
+                    resource = std::move(existingResource);
+                    continue;
+                }
+
+                sharedResource = resource;
+                if (!resource->isDeCompressedAvailable())
+                {
+                    m_resourcesToDecompress.push_back(resource);
+                    ++numScheduled;
+                }
+            }
+        }
+
+        if (numScheduled > 0u)
+            m_sleepConditionVar.notify_one();
+
+        // keep map size proportional to number of alive resources
+        if (m_sharedResources.size() > 2u * m_sharedResourcesCountAfterLastCleanup + 64u)
+            removeExpiredSharedResources();
+    }
+
+    size_t ResourceDecompressionWorker::getNumberOfResourcesScheduledForDecompression() const
+    {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        return m_resourcesToDecompress.size();
+    }
+
+    void ResourceDecompressionWorker::removeExpiredSharedResources()
+    {
+        for (auto it = m_sharedResources.begin(); it != m_sharedResources.end();)
+        {
+            if (it->second.expired())
+                it = m_sharedResources.erase(it);
+            else
+                ++it;
+        }
+        m_sharedResourcesCountAfterLastCleanup = m_sharedResources.size();
+    }
+
+    void ResourceDecompressionWorker::run()
+    {
+        if (!PlatformThread::SetCurrentThreadScheduling(m_scheduling))
+            LOG_WARN(CONTEXT_RENDERER, "ResourceDecompressionWorker: failed to apply thread scheduling {}", m_scheduling);
+        LOG_INFO(CONTEXT_RENDERER, "ResourceDecompressionWorker: running with thread scheduling {}", PlatformThread::GetCurrentThreadScheduling());
+
+        ManagedResourceVector resourcesToDecompress;
+        while (!isCancelRequested())
+        {
+            {
+                std::unique_lock<std::mutex> guard(m_mutex);
+                while (!m_sleepConditionVar.wait_for(guard, m_notifier.calculateTimeout(), [&]() { return !m_resourcesToDecompress.empty() || isCancelRequested(); }))
+                    m_notifier.notifyAlive(m_aliveIdentifier);
+                m_resourcesToDecompress.swap(resourcesToDecompress);
+            }
+            m_notifier.notifyAlive(m_aliveIdentifier);
+
+            for (auto& resource : resourcesToDecompress)
+            {
+                if (isCancelRequested())
+                    break;
+                // skip if display already uploaded and released it (worker holds the last reference)
+                // or decompressed it on demand, decompression itself is thread-safe
+                if (resource.use_count() > 1 && !resource->isDeCompressedAvailable())
+                {
+                    LOG_TRACE(CONTEXT_RENDERER, "ResourceDecompressionWorker: decompressing resource #{}", resource->getHash());
+                    resource->decompress();
+                }
+                resource.reset();
+            }
+            resourcesToDecompress.clear();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Components/ManagedResource.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "internal/PlatformAbstraction/PlatformThread.h"
+
+#include <unordered_map>
+#include <mutex>
+#include <condition_variable>
+
+namespace ramses::internal
+{
+    class IThreadAliveNotifier;
+
+    // Decompresses resources in a background thread shared by all display threads.
+    // Resources of same content dispatched to different displays are replaced by a single instance so that the content
+    // is decompressed only once and all displays upload from the same decompressed data.
+    // Display threads still decompress a resource on demand when uploading it if the worker did not get to it yet,
+    // this way a display thread with free frame budget takes over work from the worker instead of waiting for it.
+    class ResourceDecompressionWorker : private Runnable
+    {
+    public:
+        // scheduling is applied by the thread itself when started, see RendererConfig::setResourceDecompressionThreadScheduling
+        explicit ResourceDecompressionWorker(IThreadAliveNotifier& notifier, ThreadScheduling scheduling = {});
+        ~ResourceDecompressionWorker() override;
+
+        // Must be always called from the same thread (display dispatcher)
+        void shareAndScheduleDecompression(ManagedResourceVector& resources);
+
+        [[nodiscard]] size_t getNumberOfResourcesScheduledForDecompression() const;
+
+    private:
+        void run() override;
+        void removeExpiredSharedResources();
+
+        PlatformThread m_thread;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_sleepConditionVar;
+        ManagedResourceVector m_resourcesToDecompress;
+
+        // accessed only from dispatcher thread
+        std::unordered_map<ResourceContentHash, std::weak_ptr<const IResource>> m_sharedResources;
+        size_t m_sharedResourcesCountAfterLastCleanup = 0u;
+
+        IThreadAliveNotifier& m_notifier;
+        const uint64_t m_aliveIdentifier;
+        const ThreadScheduling m_scheduling;
+    };
+}
@@ -14,7 +14,7 @@
 #include "internal/SceneGraph/SceneAPI/SceneId.h"
 #include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
 #include "internal/Components/ManagedResource.h"
-#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
 
 namespace ramses::internal
 {
@@ -29,7 +29,11 @@ namespace ramses::internal
         uint32_t compressedSize = 0;
         uint32_t decompressedSize = 0;
         uint32_t vramSize = 0;
+        // scene which referenced the resource last and the frame when it stopped referencing it (see RendererResourceRegistry::advanceFrame),
+        // used to decide which unused resources to unload first
+        SceneId lastSceneUsage;
+        uint64_t lastUseFrame = 0u;
     };
 
-    using ResourceDescriptors = HashMap<ResourceContentHash, ResourceDescriptor>;
+    using ResourceDescriptors = FlatHashMap<ResourceContentHash, ResourceDescriptor>;
 }
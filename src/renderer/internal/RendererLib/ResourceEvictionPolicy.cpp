@@ -0,0 +1,27 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResourceEvictionPolicy.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    void DefaultResourceEvictionPolicy::rankForEviction(ResourceEvictionCandidates& candidates) const
+    {
+        const auto evictionScore = [](const ResourceEvictionCandidate& c) {
+            return static_cast<double>(c.framesSinceLastUse + 1u) / static_cast<double>(std::max<uint64_t>(c.reuploadCost, 1u));
+        };
+
+        // stable to keep order in which resources became unused if otherwise equal
+        std::stable_sort(candidates.begin(), candidates.end(), [&](const auto& c1, const auto& c2) {
+            if (c1.scenePriority != c2.scenePriority)
+                return c1.scenePriority > c2.scenePriority;
+            return evictionScore(c1) > evictionScore(c2);
+        });
+    }
+}
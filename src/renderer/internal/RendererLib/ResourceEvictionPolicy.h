@@ -0,0 +1,23 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/IResourceEvictionPolicy.h"
+
+namespace ramses::internal
+{
+    // Unloads resources of less prioritized scenes first, within same scene priority resources are ranked
+    // by how long they were not used relative to the cost of uploading them again (similar to GreedyDual-Size),
+    // i.e. a large texture of a recently hidden scene is kept longer than a small buffer not used for a long time.
+    class DefaultResourceEvictionPolicy final : public IResourceEvictionPolicy
+    {
+    public:
+        void rankForEviction(ResourceEvictionCandidates& candidates) const override;
+    };
+}
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResourceUploadCostEstimator.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses::internal
+{
+    namespace
+    {
+        // initial estimates before anything was measured, in microseconds per byte
+        constexpr double DefaultCostPerByte(EResourceType type)
+        {
+            switch (type)
+            {
+            case EResourceType::VertexArray:
+            case EResourceType::IndexArray:
+                return 0.0005;  // ~2 GB/s
+            case EResourceType::Texture2D:
+            case EResourceType::Texture3D:
+            case EResourceType::TextureCube:
+                return 0.001;   // ~1 GB/s, includes mipmap generation and format conversion in driver
+            case EResourceType::Effect:
+                return 0.5;     // shader compilation, ~5 ms for 10 kB of shader sources
+            case EResourceType::Invalid:
+                break;
+            }
+            return 0.001;
+        }
+    }
+
+    ResourceUploadCostEstimator::ResourceUploadCostEstimator()
+    {
+        for (size_t i = 0u; i < m_microsecondsPerByte.size(); ++i)
+            m_microsecondsPerByte[i] = DefaultCostPerByte(static_cast<EResourceType>(i));
+    }
+
+    std::chrono::microseconds ResourceUploadCostEstimator::estimate(EResourceType type, uint32_t sizeInBytes) const
+    {
+        const auto typeIdx = static_cast<size_t>(type);
+        assert(typeIdx < m_microsecondsPerByte.size());
+        const auto sizeCost = static_cast<int64_t>(m_microsecondsPerByte[typeIdx] * sizeInBytes);
+        return FixedCost + std::chrono::microseconds{ sizeCost };
+    }
+
+    void ResourceUploadCostEstimator::recordUpload(EResourceType type, uint32_t sizeInBytes, std::chrono::microseconds duration)
+    {
+        // tiny resources are dominated by fixed cost and timer resolution, they would not tell anything about throughput
+        if (sizeInBytes < MinSizeToMeasure)
+            return;
+
+        const auto typeIdx = static_cast<size_t>(type);
+        assert(typeIdx < m_microsecondsPerByte.size());
+        const auto sizeCost = std::max(duration - FixedCost, std::chrono::microseconds{ 0 });
+        const double measuredCostPerByte = static_cast<double>(sizeCost.count()) / sizeInBytes;
+        m_microsecondsPerByte[typeIdx] += MeasurementWeight * (measuredCostPerByte - m_microsecondsPerByte[typeIdx]);
+    }
+}
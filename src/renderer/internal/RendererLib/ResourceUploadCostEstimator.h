@@ -0,0 +1,39 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/SceneGraph/Resource/ResourceTypes.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+namespace ramses::internal
+{
+    // Estimates time needed to upload a resource (including its decompression) from its type and size.
+    // Estimates start with conservative defaults per resource type and adapt to upload times measured on the device,
+    // e.g. effects become cheap when they are uploaded asynchronously or loaded from binary shader cache.
+    class ResourceUploadCostEstimator
+    {
+    public:
+        ResourceUploadCostEstimator();
+
+        [[nodiscard]] std::chrono::microseconds estimate(EResourceType type, uint32_t sizeInBytes) const;
+        void recordUpload(EResourceType type, uint32_t sizeInBytes, std::chrono::microseconds duration);
+
+        // cost of any upload regardless of its size (device calls, bookkeeping)
+        static constexpr std::chrono::microseconds FixedCost{ 10 };
+        // weight of newly measured upload when adapting estimate of its resource type
+        static constexpr double MeasurementWeight = 0.25;
+        // uploads of smaller resources are not measured
+        static constexpr uint32_t MinSizeToMeasure = 4096u;
+
+    private:
+        std::array<double, EResourceTypeNames.size()> m_microsecondsPerByte{};
+    };
+}
@@ -39,20 +39,22 @@ namespace ramses::internal
         case EResourceType::VertexArray:
         {
             const auto* vertArray = resourceObject.convertTo<ArrayResource>();
-            const DeviceResourceHandle deviceHandle = device.allocateVertexBuffer(vertArray->getDecompressedDataSize());
+            const DeviceResourceHandle deviceHandle = device.allocateVertexBuffer(vertArray->getDecompressedDataSize(), EDeviceBufferUsage::Static);
             device.uploadVertexBufferData(deviceHandle, vertArray->getResourceData().data(), vertArray->getDecompressedDataSize());
             return deviceHandle;
         }
         case EResourceType::IndexArray:
         {
             const auto* indexArray = resourceObject.convertTo<ArrayResource>();
-            const DeviceResourceHandle deviceHandle = device.allocateIndexBuffer(indexArray->getElementType(), indexArray->getDecompressedDataSize());
+            const DeviceResourceHandle deviceHandle = device.allocateIndexBuffer(indexArray->getElementType(), indexArray->getDecompressedDataSize(), EDeviceBufferUsage::Static);
             device.uploadIndexBufferData(deviceHandle, indexArray->getResourceData().data(), indexArray->getDecompressedDataSize());
             return deviceHandle;
         }
         case EResourceType::Texture2D:
         case EResourceType::Texture3D:
         case EResourceType::TextureCube:
+            if (m_asyncEffectUploadEnabled && resourceObject.getDecompressedDataSize() > AsyncTextureUploadByteSizeThreshold)
+                return {};
             return UploadTexture(device, *resourceObject.convertTo<TextureResource>(), outVRAMSize);
         case EResourceType::Effect:
         {
@@ -28,8 +28,12 @@ namespace ramses::internal
         void                 unloadResource(IRenderBackend& renderBackend, EResourceType type, ResourceContentHash hash, DeviceResourceHandle handle) override;
         void                         storeShaderInBinaryShaderCache(IRenderBackend& renderBackend, DeviceResourceHandle deviceHandle, const ResourceContentHash& hash, SceneId sceneid) override;
 
-    private:
         static DeviceResourceHandle UploadTexture(IDevice& device, const TextureResource& texture, uint32_t& vramSize);
+
+        // textures above this size are uploaded asynchronously if async upload is enabled
+        static constexpr uint32_t AsyncTextureUploadByteSizeThreshold = 1024u * 1024u;
+
+    private:
         DeviceResourceHandle queryBinaryShaderCache(IRenderBackend& renderBackend, const EffectResource& effect, ResourceContentHash hash);
 
         static uint32_t EstimateGPUAllocatedSizeOfTexture(const TextureResource& texture, uint32_t numMipLevelsToAllocate);
@@ -12,12 +12,15 @@
 #include "internal/RendererLib/FrameTimer.h"
 #include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/DisplayConfigData.h"
+#include "internal/RendererLib/ResourceEvictionPolicy.h"
 #include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
 #include "internal/RendererLib/PlatformInterface/IEmbeddedCompositingManager.h"
 #include "internal/RendererLib/PlatformInterface/IDevice.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/Utils/TraceRecorder.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/TextureResource.h"
 #include <algorithm>
 #include <chrono>
 
@@ -37,12 +40,11 @@ namespace ramses::internal
         , m_asyncEffectUploader(asyncEffectUploader)
         , m_frameTimer(frameTimer)
         , m_resourceCacheSize(displayConfig.getGPUMemoryCacheSize())
-        , m_resourceUploadBatchSize(displayConfig.getResourceUploadBatchSize())
         , m_stats(stats)
-        , m_scenePriorities(displayConfig.getScenePriorities())
+        , m_scheduler(displayConfig.getScenePriorities(), frameTimer, stats)
+        , m_evictionPolicy(displayConfig.getResourceEvictionPolicy() ? displayConfig.getResourceEvictionPolicy() : std::make_shared<DefaultResourceEvictionPolicy>())
     {
         assert(m_uploader);
-        assert(m_resourceUploadBatchSize > 0u);
     }
 
     ResourceUploadingManager::~ResourceUploadingManager()
@@ -67,19 +69,34 @@ namespace ramses::internal
 
     void ResourceUploadingManager::uploadAndUnloadPendingResources()
     {
-        ResourceContentHashVector resourcesToUpload;
+        m_resourcesToUploadTemp.clear();
         uint64_t sizeToUpload = 0u;
-        getAndPrepareResourcesToUploadNext(resourcesToUpload, sizeToUpload);
+        getAndPrepareResourcesToUploadNext(m_resourcesToUploadTemp, sizeToUpload);
         const uint64_t sizeToBeFreed = getAmountOfMemoryToBeFreedForNewResources(sizeToUpload);
 
-        ResourceContentHashVector resourcesToUnload;
-        getResourcesToUnloadNext(resourcesToUnload, sizeToBeFreed);
+        m_resourcesToUnloadTemp.clear();
+        getResourcesToUnloadNext(m_resourcesToUnloadTemp, sizeToBeFreed);
 
-        unloadResources(resourcesToUnload);
-        uploadResources(resourcesToUpload);
+        unloadResources(m_resourcesToUnloadTemp);
+        uploadResources(m_resourcesToUploadTemp);
         syncEffects();
+        syncTextures();
 
         m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
+        m_resources.advanceFrame();
+    }
+
+    uint64_t ResourceUploadingManager::unloadAllUnusedResources()
+    {
+        ResourceContentHashVector resourcesToUnload;
+        getResourcesToUnloadNext(resourcesToUnload, std::numeric_limits<uint64_t>::max(), false);
+
+        const uint64_t sizeBefore = m_resourceTotalUploadedSize;
+        unloadResources(resourcesToUnload);
+        assert(sizeBefore >= m_resourceTotalUploadedSize);
+        m_stats.setVRAMUsage(m_resourceTotalUploadedSize, m_resourceCacheSize);
+
+        return sizeBefore - m_resourceTotalUploadedSize;
     }
 
     void ResourceUploadingManager::unloadResources(const ResourceContentHashVector& resourcesToUnload)
@@ -139,26 +156,80 @@ namespace ramses::internal
         m_effectsUploadedTemp.clear();
     }
 
+    void ResourceUploadingManager::syncTextures()
+    {
+        assert(m_asyncEffectUploader || m_texturesToUpload.empty());
+        if (!m_asyncEffectUploader)
+            return;
+        m_asyncEffectUploader->syncTextures(m_texturesToUpload, m_texturesUploadedTemp);
+        m_texturesToUpload.clear();
+
+        DeviceFence lastWaitedFence;
+        for (auto& t : m_texturesUploadedTemp)
+        {
+            // GPU waits for upload commands of the batch, render thread continues without blocking
+            if (t.fence.isValid() && t.fence != lastWaitedFence)
+            {
+                m_renderBackend.getDevice().waitFence(t.fence);
+                lastWaitedFence = t.fence;
+            }
+
+            if (!m_resources.containsResource(t.hash) || m_resources.getResourceStatus(t.hash) != EResourceStatus::ScheduledForUpload)
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncTextures unexpected texture uploaded, will be ignored #{}", t.hash);
+                assert(false);
+                // texture was already created by upload thread, release it like any unloaded texture
+                if (t.gpuResource)
+                    m_renderBackend.getDevice().deleteTexture(m_renderBackend.getDevice().registerTexture(std::move(t.gpuResource)));
+                continue;
+            }
+
+            if (t.gpuResource)
+            {
+                const auto& rd = m_resources.getResourceDescriptor(t.hash);
+                const auto deviceHandle = m_renderBackend.getDevice().registerTexture(std::move(t.gpuResource));
+                const auto resourceSize = rd.decompressedSize;
+                m_resourceSizes.put(t.hash, resourceSize);
+                m_resourceTotalUploadedSize += resourceSize;
+                m_resources.setResourceUploaded(t.hash, deviceHandle, t.vramSize);
+            }
+            else
+            {
+                LOG_ERROR(CONTEXT_RENDERER, "ResourceUploadingManager::syncTextures failed to upload texture #{}", t.hash);
+                m_resources.setResourceBroken(t.hash);
+            }
+        }
+
+        m_texturesUploadedTemp.clear();
+    }
+
     void ResourceUploadingManager::uploadResources(const ResourceContentHashVector& resourcesToUpload)
     {
-        assert(m_resourceUploadBatchSize > 0u);
         uint32_t sizeUploaded = 0u;
         for (size_t i = 0u; i < resourcesToUpload.size(); ++i)
         {
             const ResourceDescriptor& rd = m_resources.getResourceDescriptor(resourcesToUpload[i]);
             const uint32_t resourceSize = rd.resource->getDecompressedDataSize();
-            uploadResource(rd);
-            m_stats.resourceUploaded(resourceSize);
-            sizeUploaded += resourceSize;
 
-            const bool checkTimeLimit = (i % m_resourceUploadBatchSize == 0) || (resourceSize > LargeResourceByteSizeThreshold);
-            std::chrono::milliseconds sectionDuration{};
-            if (checkTimeLimit && m_frameTimer.isTimeBudgetExceededForSection(EFrameTimerSectionBudget::ResourcesUpload, &sectionDuration))
+            // upload is scheduled only if its estimated cost fits into time left in frame,
+            // first resource is always uploaded so that uploading makes progress even if budget is exceeded every frame
+            const auto estimatedCost = m_uploadCostEstimator.estimate(rd.type, resourceSize);
+            const auto remainingTime = m_frameTimer.getRemainingTimeForSection(EFrameTimerSectionBudget::ResourcesUpload);
+            // resources are sorted by priority, resources of highest priority scenes are never deferred
+            if (i > 0u && estimatedCost > remainingTime && !m_scheduler.isHighestPriority(getScenePriority(rd)))
             {
-                const auto numUploaded = i + 1;
+                const auto numUploaded = i;
                 const auto numRemaining = resourcesToUpload.size() - numUploaded;
-                LOG_INFO(CONTEXT_RENDERER, "ResourceUploadingManager::uploadResources: Interrupt: Exceeded time for resource upload (uploaded {} resources of size {} B, remaining {} resources to upload). dt {}ms",
-                    numUploaded, sizeUploaded, numRemaining, sectionDuration.count());
+
+                for (size_t j = numUploaded; j < resourcesToUpload.size(); ++j)
+                {
+                    const ResourceDescriptor& deferredRd = m_resources.getResourceDescriptor(resourcesToUpload[j]);
+                    if (!deferredRd.sceneUsage.empty())
+                        m_stats.sceneBudgetExceeded(deferredRd.sceneUsage.front());
+                }
+
+                LOG_INFO(CONTEXT_RENDERER, "ResourceUploadingManager::uploadResources: Interrupt: Not enough time left for resource upload (uploaded {} resources of size {} B, remaining {} resources to upload). Estimated next upload {}us, left {}us",
+                    numUploaded, sizeUploaded, numRemaining, estimatedCost.count(), remainingTime.count());
                 LOG_INFO_F(CONTEXT_RENDERER, [&](StringOutputStream& logger)
                 {
                     logger << "Remaining resources in queue to upload:";
@@ -173,11 +244,18 @@ namespace ramses::internal
 
                 break;
             }
+
+            const auto uploadStart = std::chrono::steady_clock::now();
+            uploadResource(rd);
+            m_uploadCostEstimator.recordUpload(rd.type, resourceSize, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - uploadStart));
+            m_stats.resourceUploaded(resourceSize);
+            sizeUploaded += resourceSize;
         }
     }
 
     void ResourceUploadingManager::uploadResource(const ResourceDescriptor& rd)
     {
+        RAMSES_TRACE_SCOPE("renderer", "UploadResource");
         assert(rd.resource);
         assert(!rd.deviceHandle.isValid());
         LOG_TRACE(CONTEXT_PROFILING, "        ResourceUploadingManager::uploadResource upload resource of type {}", EnumToString(rd.type));
@@ -207,14 +285,20 @@ namespace ramses::internal
                 m_resources.setResourceBroken(rd.hash);
             }
         }
-        else
+        else if (rd.type == EResourceType::Effect)
         {
             // effect not found in cache, schedule for upload in uploader thread
-            assert(rd.type == EResourceType::Effect);
             assert(std::find_if(std::cbegin(m_effectsToUpload), std::cend(m_effectsToUpload), [&](const auto& e){ return e->getHash() == rd.hash;}) == m_effectsToUpload.cend());
             m_effectsToUpload.push_back(pResource->convertTo<const EffectResource>());
             m_resources.setResourceScheduledForUpload(rd.hash);
         }
+        else
+        {
+            // large texture, schedule for upload in uploader thread
+            assert(rd.type == EResourceType::Texture2D || rd.type == EResourceType::Texture3D || rd.type == EResourceType::TextureCube);
+            m_texturesToUpload.push_back(pResource->convertTo<const TextureResource>());
+            m_resources.setResourceScheduledForUpload(rd.hash);
+        }
     }
 
     void ResourceUploadingManager::unloadResource(const ResourceDescriptor& rd)
@@ -239,26 +323,41 @@ namespace ramses::internal
     void ResourceUploadingManager::getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, uint64_t sizeToBeFreed, bool keepEffects) const
     {
         assert(resourcesToUnload.empty());
+        if (sizeToBeFreed == 0u)
+            return;
+
         const ResourceContentHashVector& unusedResources = m_resources.getAllResourcesNotInUseByScenes();
-        uint64_t sizeToUnload = 0u;
+        const uint64_t currentFrame = m_resources.getCurrentFrame();
+        m_evictionCandidates.clear();
+        for (const auto& hash : unusedResources)
+        {
+            const ResourceDescriptor& rd = m_resources.getResourceDescriptor(hash);
+            if (rd.status == EResourceStatus::Uploaded && !(keepEffects && rd.type == EResourceType::Effect))
+            {
+                assert(m_resourceSizes.contains(hash));
+                assert(currentFrame >= rd.lastUseFrame);
+                m_evictionCandidates.push_back({ hash, rd.type, *m_resourceSizes.get(hash), currentFrame - rd.lastUseFrame, getScenePriority(rd.lastSceneUsage), EstimateReuploadCost(rd) });
+            }
+        }
+
+        // if all would be unloaded anyway ranking is not needed
+        uint64_t totalCandidatesSize = 0u;
+        for (const auto& candidate : m_evictionCandidates)
+            totalCandidatesSize += candidate.size;
+        if (totalCandidatesSize > sizeToBeFreed)
+            m_evictionPolicy->rankForEviction(m_evictionCandidates);
 
         // collect unused resources to be unloaded
         // if total size of resources to be unloaded is enough
         // we stop adding more unused resources, they can be kept uploaded as long as not more memory is needed
-        for (const auto& hash : unusedResources)
+        uint64_t sizeToUnload = 0u;
+        for (const auto& candidate : m_evictionCandidates)
         {
             if (sizeToUnload >= sizeToBeFreed)
-            {
                 break;
-            }
 
-            const ResourceDescriptor& rd = m_resources.getResourceDescriptor(hash);
-            if (rd.status == EResourceStatus::Uploaded && !(keepEffects && rd.type == EResourceType::Effect))
-            {
-                resourcesToUnload.push_back(hash);
-                assert(m_resourceSizes.contains(hash));
-                sizeToUnload += *m_resourceSizes.get(hash);
-            }
+            resourcesToUnload.push_back(candidate.hash);
+            sizeToUnload += candidate.size;
         }
     }
 
@@ -274,7 +373,7 @@ namespace ramses::internal
             bucket.second.clear();
         }
 
-        if (m_scenePriorities.empty())
+        if (!m_scheduler.hasScenePriorities())
         {
             m_buckets[0].reserve(providedResources.size());
         }
@@ -306,17 +405,24 @@ namespace ramses::internal
 
     int32_t ResourceUploadingManager::getScenePriority(const ResourceDescriptor& rd) const
     {
-        if (!m_scenePriorities.empty() && !rd.sceneUsage.empty())
-        {
-            auto it = m_scenePriorities.find(rd.sceneUsage.front());
-            if (it != m_scenePriorities.end())
-            {
-                return it->second;
-            }
-        }
+        if (!rd.sceneUsage.empty())
+            return getScenePriority(rd.sceneUsage.front());
         return 0;
     }
 
+    int32_t ResourceUploadingManager::getScenePriority(SceneId sceneId) const
+    {
+        return m_scheduler.getScenePriority(sceneId);
+    }
+
+    uint64_t ResourceUploadingManager::EstimateReuploadCost(const ResourceDescriptor& rd)
+    {
+        // data has to be transferred to GPU (including mips generated there) and decompressed if compressed,
+        // every upload has also a fixed cost of resource creation in driver
+        constexpr uint64_t FixedUploadCost = 4096u;
+        return uint64_t{ std::max(rd.decompressedSize, rd.vramSize) } + rd.compressedSize + FixedUploadCost;
+    }
+
     uint64_t ResourceUploadingManager::getAmountOfMemoryToBeFreedForNewResources(uint64_t sizeToUpload) const
     {
         if (m_resourceCacheSize == 0u)
@@ -11,6 +11,9 @@
 #include "internal/RendererLib/ResourceDescriptor.h"
 #include "internal/RendererLib/IResourceUploader.h"
 #include "internal/RendererLib/AsyncEffectUploader.h"
+#include "internal/RendererLib/IResourceEvictionPolicy.h"
+#include "internal/RendererLib/SceneBudgetScheduler.h"
+#include "internal/RendererLib/ResourceUploadCostEstimator.h"
 #include "internal/PlatformAbstraction/Collections/HashMap.h"
 #include <map>
 
@@ -38,23 +41,26 @@ namespace ramses::internal
 
         [[nodiscard]] bool hasAnythingToUpload() const;
         void uploadAndUnloadPendingResources();
+        // unloads all uploaded resources not used by any scene regardless of cache size, returns size of unloaded resources
+        uint64_t unloadAllUnusedResources();
 
-        [[nodiscard]] uint32_t getResourceUploadBatchSize() const
+        [[nodiscard]] uint64_t getResourceCacheSize() const
         {
-            return m_resourceUploadBatchSize;
+            return m_resourceCacheSize;
         }
 
-        static const uint32_t LargeResourceByteSizeThreshold = 250000u;
-
     private:
         void unloadResources(const ResourceContentHashVector& resourcesToUnload);
         void uploadResources(const ResourceContentHashVector& resourcesToUpload);
         void syncEffects();
+        void syncTextures();
         void uploadResource(const ResourceDescriptor& rd);
         void unloadResource(const ResourceDescriptor& rd);
         void getResourcesToUnloadNext(ResourceContentHashVector& resourcesToUnload, uint64_t sizeToBeFreed, bool keepEffects = true) const;
         void getAndPrepareResourcesToUploadNext(ResourceContentHashVector& resourcesToUpload, uint64_t& totalSize) const;
         [[nodiscard]] int32_t getScenePriority(const ResourceDescriptor& rd) const;
+        [[nodiscard]] int32_t getScenePriority(SceneId sceneId) const;
+        [[nodiscard]] static uint64_t EstimateReuploadCost(const ResourceDescriptor& rd);
         [[nodiscard]] uint64_t getAmountOfMemoryToBeFreedForNewResources(uint64_t sizeToUpload) const;
 
         RendererResourceRegistry& m_resources;
@@ -63,18 +69,25 @@ namespace ramses::internal
         AsyncEffectUploader*            m_asyncEffectUploader;
         EffectsRawResources             m_effectsToUpload;
         EffectsGpuResources             m_effectsUploadedTemp; //to avoid re-allocation each frame
+        TexturesRawResources            m_texturesToUpload;
+        TexturesGpuResources            m_texturesUploadedTemp; //to avoid re-allocation each frame
 
         const FrameTimer& m_frameTimer;
+        ResourceUploadCostEstimator m_uploadCostEstimator;
 
         using SizeMap = HashMap<ResourceContentHash, uint32_t>;
         SizeMap       m_resourceSizes;
         uint64_t        m_resourceTotalUploadedSize = 0u;
         const uint64_t  m_resourceCacheSize = 0u;
-        const uint32_t  m_resourceUploadBatchSize   = 10u;
 
         RendererStatistics& m_stats;
 
-        std::unordered_map<SceneId, int32_t> m_scenePriorities;
+        SceneBudgetScheduler m_scheduler;
         mutable std::map<int32_t, ResourceContentHashVector> m_buckets;
+        ResourceContentHashVector m_resourcesToUploadTemp; //to avoid re-allocation each frame
+        ResourceContentHashVector m_resourcesToUnloadTemp; //to avoid re-allocation each frame
+
+        std::shared_ptr<const IResourceEvictionPolicy> m_evictionPolicy;
+        mutable ResourceEvictionCandidates m_evictionCandidates; //to avoid re-allocation each frame
     };
 }
@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SceneBudgetScheduler.h"
+#include "internal/RendererLib/RendererStatistics.h"
+
+#include <algorithm>
+
+namespace ramses::internal
+{
+    SceneBudgetScheduler::SceneBudgetScheduler(std::unordered_map<SceneId, int32_t> scenePriorities, const FrameTimer& frameTimer, RendererStatistics& stats)
+        : m_scenePriorities(std::move(scenePriorities))
+        , m_frameTimer(frameTimer)
+        , m_stats(stats)
+    {
+        // scenes without explicit priority have default priority 0
+        for (const auto& scenePriority : m_scenePriorities)
+            m_highestPriority = std::min(m_highestPriority, scenePriority.second);
+    }
+
+    bool SceneBudgetScheduler::hasScenePriorities() const
+    {
+        return !m_scenePriorities.empty();
+    }
+
+    int32_t SceneBudgetScheduler::getScenePriority(SceneId sceneId) const
+    {
+        const auto it = m_scenePriorities.find(sceneId);
+        return it != m_scenePriorities.cend() ? it->second : 0;
+    }
+
+    bool SceneBudgetScheduler::isHighestPriority(int32_t priority) const
+    {
+        return hasScenePriorities() && priority <= m_highestPriority;
+    }
+
+    bool SceneBudgetScheduler::isHighestPriority(SceneId sceneId) const
+    {
+        return isHighestPriority(getScenePriority(sceneId));
+    }
+
+    bool SceneBudgetScheduler::deferSceneWork(SceneId sceneId, EFrameTimerSectionBudget section)
+    {
+        if (!hasScenePriorities() || isHighestPriority(sceneId))
+            return false;
+
+        if (!m_frameTimer.isTimeBudgetExceededForSection(section))
+            return false;
+
+        m_stats.sceneBudgetExceeded(sceneId);
+        return true;
+    }
+
+    void SceneBudgetScheduler::sortByPriority(std::vector<SceneId>& scenes) const
+    {
+        std::stable_sort(scenes.begin(), scenes.end(), [this](SceneId a, SceneId b) { return getScenePriority(a) < getScenePriority(b); });
+    }
+}
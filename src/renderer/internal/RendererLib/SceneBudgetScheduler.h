@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/FrameTimer.h"
+#include "internal/SceneGraph/SceneAPI/SceneId.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace ramses::internal
+{
+    class RendererStatistics;
+
+    // Schedules per scene work within the frame timer section budgets based on scene priority
+    // (see DisplayConfig::setScenePriority, higher value means less priority).
+    // Work of scenes with the highest priority is never deferred, so that their content meets its deadline
+    // regardless of the load caused by other scenes. Work of less prioritized scenes is deferred to next frame
+    // once the corresponding section budget is exceeded, which is reported as budget overrun of that scene.
+    // Without any scene priorities configured all scenes are treated equally and nothing is deferred by priority.
+    class SceneBudgetScheduler
+    {
+    public:
+        SceneBudgetScheduler(std::unordered_map<SceneId, int32_t> scenePriorities, const FrameTimer& frameTimer, RendererStatistics& stats);
+
+        [[nodiscard]] bool hasScenePriorities() const;
+        [[nodiscard]] int32_t getScenePriority(SceneId sceneId) const;
+        [[nodiscard]] bool isHighestPriority(int32_t priority) const;
+        [[nodiscard]] bool isHighestPriority(SceneId sceneId) const;
+
+        // returns true if work of given scene is to be deferred to next frame because budget of section is exceeded
+        bool deferSceneWork(SceneId sceneId, EFrameTimerSectionBudget section);
+        // stable sort, scenes with same priority keep their order
+        void sortByPriority(std::vector<SceneId>& scenes) const;
+
+    private:
+        std::unordered_map<SceneId, int32_t> m_scenePriorities;
+        int32_t m_highestPriority = 0;
+        const FrameTimer& m_frameTimer;
+        RendererStatistics& m_stats;
+    };
+}
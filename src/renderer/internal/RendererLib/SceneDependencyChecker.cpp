@@ -8,6 +8,7 @@
 
 #include "internal/RendererLib/SceneDependencyChecker.h"
 #include "internal/RendererLib/Types.h"
+#include <algorithm>
 
 namespace ramses::internal
 {
@@ -20,32 +21,45 @@ namespace ramses::internal
             return false;
         }
 
-        auto providers = m_consumerToProvidersMap.get(consumerScene);
-        if (providers != nullptr)
+        const auto providerIt = find_c(m_sceneOrderList, providerScene);
+        const auto consumerIt = find_c(m_sceneOrderList, consumerScene);
+        const bool providerOrdered = (providerIt != m_sceneOrderList.end());
+        const bool consumerOrdered = (consumerIt != m_sceneOrderList.end());
+        const auto providerIdx = static_cast<size_t>(std::distance(m_sceneOrderList.begin(), providerIt));
+        const auto consumerIdx = static_cast<size_t>(std::distance(m_sceneOrderList.begin(), consumerIt));
+
+        m_consumerToProvidersMap[consumerScene].push_back(providerScene);
+        m_providerToConsumersMap[providerScene].push_back(consumerScene);
+
+        // scene new in order has no other dependency, it can be put on the side of order where it fulfills the new one
+        if (!providerOrdered)
         {
-            providers->push_back(providerScene);
+            m_sceneOrderList.insert(m_sceneOrderList.begin(), providerScene);
+            if (!consumerOrdered)
+                m_sceneOrderList.push_back(consumerScene);
         }
-        else
+        else if (!consumerOrdered)
         {
-            m_consumerToProvidersMap.put(consumerScene, SceneIdVector(1u, providerScene));
+            m_sceneOrderList.push_back(consumerScene);
+        }
+        else if (providerIdx > consumerIdx)
+        {
+            reorderAffectedRegion(providerScene, consumerScene, consumerIdx, providerIdx);
         }
 
-        m_dirty = true;
         return true;
     }
 
     void SceneDependencyChecker::removeDependency(SceneId providerScene, SceneId consumerScene)
     {
         assert(m_consumerToProvidersMap.contains(consumerScene));
-        auto& providers = *m_consumerToProvidersMap.get(consumerScene);
-        assert(contains_c(providers, providerScene));
-        providers.erase(find_c(providers, providerScene));
-        if (providers.empty())
-        {
-            m_consumerToProvidersMap.remove(consumerScene);
-        }
+        assert(contains_c(*m_consumerToProvidersMap.get(consumerScene), providerScene));
+        RemoveDependencyEntry(m_consumerToProvidersMap, consumerScene, providerScene);
+        RemoveDependencyEntry(m_providerToConsumersMap, providerScene, consumerScene);
 
-        m_dirty = true;
+        // removing dependency cannot break order of remaining scenes
+        removeFromOrderIfIndependent(providerScene);
+        removeFromOrderIfIndependent(consumerScene);
     }
 
     bool SceneDependencyChecker::hasDependencyAsConsumer(SceneId scene) const
@@ -53,40 +67,37 @@ namespace ramses::internal
         return m_consumerToProvidersMap.contains(scene);
     }
 
-    const SceneIdVector& SceneDependencyChecker::getDependentScenesInOrder() const
+    bool SceneDependencyChecker::hasDependencyAsConsumerOrProvider(SceneId scene) const
     {
-        if (m_dirty)
-        {
-            updateSceneOrder();
-        }
+        return hasDependencyAsConsumer(scene) || m_providerToConsumersMap.contains(scene);
+    }
 
+    const SceneIdVector& SceneDependencyChecker::getDependentScenesInOrder() const
+    {
         return m_sceneOrderList;
     }
 
     void SceneDependencyChecker::removeScene(SceneId scene)
     {
-        m_consumerToProvidersMap.remove(scene);
-
-        SceneIdVector consumersToRemove;
-        for (auto& it : m_consumerToProvidersMap)
+        SceneIdVector affectedScenes;
+        if (const auto* providers = m_consumerToProvidersMap.get(scene))
         {
-            auto& providers = it.value;
-            while (contains_c(providers, scene))
-            {
-                providers.erase(find_c(providers, scene));
-                if (providers.empty())
-                {
-                    consumersToRemove.push_back(it.key);
-                }
-            }
+            for (const auto provider : *providers)
+                RemoveDependencyEntry(m_providerToConsumersMap, provider, scene);
+            affectedScenes = *providers;
+            m_consumerToProvidersMap.remove(scene);
         }
-
-        for (const auto it : consumersToRemove)
+        if (const auto* consumers = m_providerToConsumersMap.get(scene))
         {
-            m_consumerToProvidersMap.remove(it);
+            for (const auto consumer : *consumers)
+                RemoveDependencyEntry(m_consumerToProvidersMap, consumer, scene);
+            affectedScenes.insert(affectedScenes.end(), consumers->cbegin(), consumers->cend());
+            m_providerToConsumersMap.remove(scene);
         }
 
-        m_dirty = true;
+        removeFromOrderIfIndependent(scene);
+        for (const auto affectedScene : affectedScenes)
+            removeFromOrderIfIndependent(affectedScene);
     }
 
     bool SceneDependencyChecker::hasDependencyAsConsumerToProvider(SceneId consumerScene, SceneId providerScene) const
@@ -115,64 +126,78 @@ namespace ramses::internal
         return false;
     }
 
-    void SceneDependencyChecker::updateSceneOrder() const
+    void SceneDependencyChecker::reorderAffectedRegion(SceneId providerScene, SceneId consumerScene, size_t consumerIdx, size_t providerIdx)
     {
-        // collect all scenes
-        SceneIdVector scenes;
-        for (const auto& it : m_consumerToProvidersMap)
-        {
-            if (!contains_c(scenes, it.key))
-            {
-                scenes.push_back(it.key);
-            }
-
-            for (const auto& provider : it.value)
-            {
-                if (!contains_c(scenes, provider))
-                {
-                    scenes.push_back(provider);
-                }
-            }
-        }
+        // New dependency contradicts current order, only scenes between consumer and provider can be affected (Pearce-Kelly):
+        // consumer and scenes depending on it must move behind provider and scenes it depends on.
+        // Both groups keep their relative order and are placed into the positions they occupied together.
+        std::vector<size_t> providerSideIndices;
+        std::vector<size_t> consumerSideIndices;
+        collectAffectedScenes(providerScene, m_consumerToProvidersMap, consumerIdx, providerIdx, providerSideIndices);
+        collectAffectedScenes(consumerScene, m_providerToConsumersMap, consumerIdx, providerIdx, consumerSideIndices);
+        std::sort(providerSideIndices.begin(), providerSideIndices.end());
+        std::sort(consumerSideIndices.begin(), consumerSideIndices.end());
+
+        SceneIdVector reorderedScenes;
+        reorderedScenes.reserve(providerSideIndices.size() + consumerSideIndices.size());
+        for (const auto idx : providerSideIndices)
+            reorderedScenes.push_back(m_sceneOrderList[idx]);
+        for (const auto idx : consumerSideIndices)
+            reorderedScenes.push_back(m_sceneOrderList[idx]);
+
+        std::vector<size_t> freedIndices;
+        freedIndices.reserve(reorderedScenes.size());
+        std::merge(providerSideIndices.cbegin(), providerSideIndices.cend(), consumerSideIndices.cbegin(), consumerSideIndices.cend(), std::back_inserter(freedIndices));
+        for (size_t i = 0u; i < freedIndices.size(); ++i)
+            m_sceneOrderList[freedIndices[i]] = reorderedScenes[i];
+    }
 
-        m_sceneOrderList.clear();
-        m_sceneOrderList.reserve(scenes.size());
+    void SceneDependencyChecker::collectAffectedScenes(SceneId startScene, const SceneToScenesMap& edges, size_t lowerIdx, size_t upperIdx, std::vector<size_t>& sceneIndices) const
+    {
+        // scenes outside of region are already ordered correctly relative to region and are not traversed further
+        const auto regionBegin = m_sceneOrderList.cbegin() + static_cast<std::ptrdiff_t>(lowerIdx);
+        const auto regionEnd = m_sceneOrderList.cbegin() + static_cast<std::ptrdiff_t>(upperIdx) + 1;
 
-        while (!scenes.empty())
+        SceneIdVector scenesToVisit{ startScene };
+        while (!scenesToVisit.empty())
         {
-            // pop scene from front
-            const SceneId currScene = scenes.front();
-            scenes.erase(scenes.begin());
+            const SceneId scene = scenesToVisit.back();
+            scenesToVisit.pop_back();
+
+            const auto it = std::find(regionBegin, regionEnd, scene);
+            if (it == regionEnd)
+                continue;
+            const auto idx = static_cast<size_t>(std::distance(m_sceneOrderList.cbegin(), it));
+            if (contains_c(sceneIndices, idx))
+                continue;
+            sceneIndices.push_back(idx);
+
+            if (const auto* nextScenes = edges.get(scene))
+                scenesToVisit.insert(scenesToVisit.end(), nextScenes->cbegin(), nextScenes->cend());
+        }
+    }
 
-            // check if has any dependency to the rest of the scenes
-            // (intersection of its providers list and rest of scenes is not empty)
-            bool dependsOnRestOfTheSet = false;
-            if (m_consumerToProvidersMap.contains(currScene))
-            {
-                const auto& providers = *m_consumerToProvidersMap.get(currScene);
-                for (const auto provider : providers)
-                {
-                    if (contains_c(scenes, provider))
-                    {
-                        dependsOnRestOfTheSet = true;
-                        break;
-                    }
-                }
-            }
+    void SceneDependencyChecker::removeFromOrderIfIndependent(SceneId scene)
+    {
+        if (hasDependencyAsConsumerOrProvider(scene))
+            return;
 
-            if (dependsOnRestOfTheSet)
-            {
-                // add back to scenes if has dependency - to be processed again later
-                scenes.push_back(currScene);
-            }
-            else
-            {
-                // has no dependency -> move to ordered list
-                m_sceneOrderList.push_back(currScene);
-            }
-        }
+        const auto it = find_c(m_sceneOrderList, scene);
+        if (it != m_sceneOrderList.cend())
+            m_sceneOrderList.erase(it);
+    }
 
-        m_dirty = false;
+    void SceneDependencyChecker::RemoveDependencyEntry(SceneToScenesMap& map, SceneId key, SceneId value)
+    {
+        auto* values = map.get(key);
+        if (values == nullptr)
+            return;
+
+        const auto it = find_c(*values, value);
+        if (it != values->cend())
+            values->erase(it);
+        if (values->empty())
+            map.remove(key);
     }
 
     bool SceneDependencyChecker::isEmpty() const
@@ -15,6 +15,8 @@
 namespace ramses::internal
 {
 
+    // Keeps scenes with dependencies in topological order (providers before consumers), the order is updated
+    // incrementally on every change so that frequent linking changes do not trigger full reorder.
     class SceneDependencyChecker
     {
     public:
@@ -23,18 +25,24 @@ namespace ramses::internal
         bool addDependency(SceneId providerScene, SceneId consumerScene);
         void removeDependency(SceneId providerScene, SceneId consumerScene);
         bool hasDependencyAsConsumer(SceneId scene) const;
+        bool hasDependencyAsConsumerOrProvider(SceneId scene) const;
         void removeScene(SceneId scene);
         const SceneIdVector& getDependentScenesInOrder() const;
         bool isEmpty() const;
 
     private:
+        // scene lists contain one entry per dependency, same pair of scenes can depend on each other multiple times (e.g. multiple links)
+        using SceneToScenesMap = HashMap<SceneId, SceneIdVector>;
+
         bool hasDependencyAsConsumerToProvider(SceneId consumerScene, SceneId providerScene) const;
-        void updateSceneOrder() const;
+        void reorderAffectedRegion(SceneId providerScene, SceneId consumerScene, size_t consumerIdx, size_t providerIdx);
+        void collectAffectedScenes(SceneId startScene, const SceneToScenesMap& edges, size_t lowerIdx, size_t upperIdx, std::vector<size_t>& sceneIndices) const;
+        void removeFromOrderIfIndependent(SceneId scene);
+        static void RemoveDependencyEntry(SceneToScenesMap& map, SceneId key, SceneId value);
 
-        using ConsumerToProvidersMap = HashMap<SceneId, SceneIdVector>;
-        ConsumerToProvidersMap m_consumerToProvidersMap;
+        SceneToScenesMap m_consumerToProvidersMap;
+        SceneToScenesMap m_providerToConsumersMap;
 
-        mutable SceneIdVector m_sceneOrderList;
-        mutable bool m_dirty{false};
+        SceneIdVector m_sceneOrderList;
     };
 }
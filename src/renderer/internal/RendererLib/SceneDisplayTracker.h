@@ -51,8 +51,12 @@ namespace ramses::internal
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::DestroyStreamBuffer& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::CreateExternalBuffer& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::DestroyExternalBuffer& cmd) { return cmd.display; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetClearFlags& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetClearColor& cmd) { return cmd.display; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetRenderRateDivisor& cmd) { return cmd.display; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetOffscreenBufferScalable& cmd) { return cmd.display; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetDmaOffscreenBufferSyncFence& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetExterallyOwnedWindowSize& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::ReadPixels& cmd) { return cmd.display; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::ConfirmationEcho& cmd) { return cmd.display; }
@@ -60,6 +64,10 @@ namespace ramses::internal
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::ScenePublished& /*unused*/) { return {}; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SceneUnpublished& /*unused*/) { return {}; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetSkippingOfUnmodifiedBuffers& /*unused*/) { return {}; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetGpuTimerQueries& /*unused*/) { return {}; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::TrimMemory& /*unused*/) { return {}; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetSkippingOfUnusedRenderPasses& /*unused*/) { return {}; }
+        [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SetPartialRedraw& /*unused*/) { return {}; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::LogStatistics& /*unused*/) { return {}; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::LogInfo& /*unused*/) { return {}; }
         [[nodiscard]] static std::optional<DisplayHandle> getDisplayOf(const RendererCommand::SCListIviSurfaces& /*unused*/) { return {}; }
@@ -73,6 +73,11 @@ namespace ramses::internal
         timestamps.inExpiredState = expired;
     }
 
+    bool SceneExpirationMonitor::hasMonitoredScenes() const
+    {
+        return !m_monitoredScenes.empty();
+    }
+
     void SceneExpirationMonitor::checkExpiredScenes(FlushTime::Clock::time_point currentTime)
     {
         if (m_monitoredScenes.empty()) // early out if there are no monitored scenes
@@ -35,6 +35,7 @@ namespace ramses::internal
         void onDestroyed(SceneId sceneId);
 
         [[nodiscard]] FlushTime::Clock::time_point getExpirationTimestampOfRenderedScene(SceneId sceneId) const;
+        [[nodiscard]] bool hasMonitoredScenes() const;
 
     private:
         struct TimeStampTag
@@ -35,6 +35,7 @@ namespace ramses::internal
     void SceneReferenceLogic::update()
     {
         updateReferencedScenes();
+        startPreloads();
         cleanupDestroyedMasterScenes();
         cleanupReleasedReferences();
         executePendingActions();
@@ -53,6 +54,7 @@ namespace ramses::internal
                 {
                     LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic: sending event scene reference (master {} / ref {}) state changed to {}", masterSceneId, evt.sceneId, EnumToString(evt.state));
                     m_eventSender.sendSceneStateChanged(masterSceneId, evt.sceneId, evt.state);
+                    m_referencedSceneStates[evt.sceneId] = evt.state;
                     if (evt.state == RendererSceneState::Unavailable)
                     {
                         m_masterScenes[masterSceneId].expirationStates.erase(evt.sceneId);
@@ -150,6 +152,9 @@ namespace ramses::internal
                 }
                 return masterSceneId.isValid();
             }
+            case ERendererEventType::SceneResourcesComplete:
+                // irrelevant - if for referenced scene, it must be removed from event queue but is not sent to master scene client
+                return findMasterSceneForReferencedScene(evt.sceneId).isValid();
             case ERendererEventType::SceneDataSlotProviderCreated:
             case ERendererEventType::SceneDataSlotProviderDestroyed:
                 // implicit or irrelevant - if for referenced scene, these must be removed from event queue but are not sent to master scene client
@@ -177,6 +182,7 @@ namespace ramses::internal
     void SceneReferenceLogic::updateReferencedScenes()
     {
         // check for any scene references, compare values stored in their master scenes and update states accordingly
+        m_referencedScenesInTransition = 0u;
         for (const auto& sceneIt : m_rendererScenes)
         {
             const auto& masterScene = *(sceneIt.value.scene);
@@ -206,6 +212,7 @@ namespace ramses::internal
                     {
                         LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic::updateReferencedScenes: discarding old scene reference ownership (master {} / ref {})", oldMaster, refSceneId);
                         m_masterScenes[oldMaster].sceneReferences.erase(refSceneId);
+                        m_masterScenes[oldMaster].preloadingSceneReferences.erase(refSceneId);
                     }
                     LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic::updateReferencedScenes: new scene reference ownership (master {} / ref {})", masterSceneId, refSceneId);
 
@@ -229,17 +236,33 @@ namespace ramses::internal
                     m_sceneLogic.setSceneDisplayBufferAssignment(refSceneId, masterOB, toBeRequestedRefRenderOrder);
                 }
 
-                if (refTargetState != refData.requestedState || refTargetState > masterTargetState)
+                // referenced scene can never have 'higher' state than its master scene
+                auto stateToRequest = std::min(refData.requestedState, masterTargetState);
+
+                // preload is only done ahead of requested state, queued candidates are started later within preload budget,
+                // once started the preload state is kept until the hint is removed or reached by requested state
+                const auto preloadState = std::min({ refData.preloadState, masterTargetState, RendererSceneState::Ready });
+                if (preloadState > stateToRequest)
                 {
-                    // referenced scene can never have 'higher' state than its master scene
-                    const auto stateToRequest = std::min(refData.requestedState, masterTargetState);
-                    if (refTargetState != stateToRequest)
-                    {
-                        LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic::updateReferencedScenes: setting state (master {} / ref {}) to {}", masterSceneId, refSceneId, EnumToString(stateToRequest));
-                        m_sceneLogic.setSceneState(refSceneId, stateToRequest);
-                    }
+                    if (masterSceneInfo.preloadingSceneReferences.count(refSceneId) != 0)
+                        stateToRequest = preloadState;
+                    else
+                        m_preloadQueue.push({ refData.preloadPriority, masterSceneId, refSceneId, preloadState });
+                }
+                else
+                    masterSceneInfo.preloadingSceneReferences.erase(refSceneId);
+
+                if (refTargetState != stateToRequest)
+                {
+                    LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic::updateReferencedScenes: setting state (master {} / ref {}) to {}", masterSceneId, refSceneId, EnumToString(stateToRequest));
+                    m_sceneLogic.setSceneState(refSceneId, stateToRequest);
                 }
 
+                // unavailable scene cannot change state until published, it does not use any of the preload budget
+                const auto refStateIt = m_referencedSceneStates.find(refSceneId);
+                if (refStateIt != m_referencedSceneStates.cend() && refStateIt->second != RendererSceneState::Unavailable && refStateIt->second != stateToRequest)
+                    ++m_referencedScenesInTransition;
+
                 // send scene version tag if flush notification just enabled
                 // later version tag notifications are sent when processing events
                 if (refData.flushNotifications)
@@ -266,6 +289,30 @@ namespace ramses::internal
         }
     }
 
+    void SceneReferenceLogic::startPreloads()
+    {
+        // preloads have lower priority than any explicitly requested state change and are started one by one
+        // by their priority, so that the resource uploads of the preloaded scenes do not compete with each other
+        while (!m_preloadQueue.empty())
+        {
+            const auto candidate = m_preloadQueue.top();
+            m_preloadQueue.pop();
+
+            if (m_referencedScenesInTransition >= MaxReferencedScenesInTransitionForPreload)
+                continue;
+
+            const auto refStateIt = m_referencedSceneStates.find(candidate.refSceneId);
+            if (refStateIt == m_referencedSceneStates.cend() || refStateIt->second == RendererSceneState::Unavailable)
+                continue;
+
+            LOG_INFO(CONTEXT_RENDERER, "SceneReferenceLogic: preloading scene reference (master {} / ref {}) to state {} with priority {}",
+                candidate.masterSceneId, candidate.refSceneId, EnumToString(candidate.preloadState), candidate.priority);
+            m_sceneLogic.setSceneState(candidate.refSceneId, candidate.preloadState);
+            m_masterScenes[candidate.masterSceneId].preloadingSceneReferences.insert(candidate.refSceneId);
+            ++m_referencedScenesInTransition;
+        }
+    }
+
     void SceneReferenceLogic::cleanupDestroyedMasterScenes()
     {
         // check for newly destroyed master scenes
@@ -285,6 +332,7 @@ namespace ramses::internal
                 }
                 masterInfo.pendingActions.clear();
                 masterInfo.sceneReferencesWithFlushNotification.clear();
+                masterInfo.preloadingSceneReferences.clear();
                 masterInfo.expirationStates.clear();
                 masterInfo.consolidatedExpirationState = ExpirationState::MonitoringDisabled;
                 masterInfo.destroyed = true;
@@ -320,7 +368,9 @@ namespace ramses::internal
                         masterInfo.sceneReferences.erase(sceneRefId);
                         m_sharedOwnership.setOwner(sceneRefId, SceneId::Invalid());
                         masterInfo.sceneReferencesWithFlushNotification.erase(sceneRefId);
+                        masterInfo.preloadingSceneReferences.erase(sceneRefId);
                         masterInfo.expirationStates.erase(sceneRefId);
+                        m_referencedSceneStates.erase(sceneRefId);
 
                         // remove actions for released reference
                         const auto it = std::remove_if(masterInfo.pendingActions.begin(), masterInfo.pendingActions.end(), [&, refHandle = releasedRef.second](const auto& action)
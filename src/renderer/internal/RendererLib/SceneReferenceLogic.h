@@ -14,6 +14,7 @@
 #include "internal/RendererLib/RendererEvent.h"
 #include <unordered_map>
 #include <unordered_set>
+#include <queue>
 
 namespace ramses::internal
 {
@@ -43,8 +44,12 @@ namespace ramses::internal
         void extractAndSendSceneReferenceEvents(RendererEventVector& events);
         [[nodiscard]] bool hasAnyReferencedScenes() const;
 
+        // preloads are started only if less than this number of referenced scenes are changing state
+        static constexpr size_t MaxReferencedScenesInTransitionForPreload = 1u;
+
     private:
         void updateReferencedScenes();
+        void startPreloads();
         void cleanupDestroyedMasterScenes();
         void cleanupReleasedReferences();
         void executePendingActions();
@@ -63,6 +68,8 @@ namespace ramses::internal
             std::unordered_map<SceneId, SceneReferenceHandle> sceneReferences;
             SceneReferenceActionVector pendingActions;
             std::unordered_set<SceneId> sceneReferencesWithFlushNotification;
+            // references brought towards their preload state ahead of requested state
+            std::unordered_set<SceneId> preloadingSceneReferences;
 
             // this set contains either references or master itself
             std::unordered_map<SceneId, ExpirationState> expirationStates;
@@ -86,6 +93,24 @@ namespace ramses::internal
 
         std::vector<SceneId> m_masterScenesWithChangedExpirationState;
 
+        struct PreloadCandidate
+        {
+            int32_t priority = 0;
+            SceneId masterSceneId;
+            SceneId refSceneId;
+            RendererSceneState preloadState = RendererSceneState::Available;
+
+            bool operator<(const PreloadCandidate& other) const
+            {
+                // higher priority first, lower scene ID first for equal priorities
+                return priority < other.priority || (priority == other.priority && refSceneId.getValue() > other.refSceneId.getValue());
+            }
+        };
+        std::priority_queue<PreloadCandidate> m_preloadQueue;
+        // last state of referenced scenes as reported in renderer events
+        std::unordered_map<SceneId, RendererSceneState> m_referencedSceneStates;
+        size_t m_referencedScenesInTransition = 0u;
+
         friend class RendererLogger;
     };
 }
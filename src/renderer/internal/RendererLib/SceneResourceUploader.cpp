@@ -64,8 +64,7 @@ namespace ramses::internal
         for (uint32_t mipLevel = 0u; mipLevel < static_cast<uint32_t>(mipMaps.size()); ++mipLevel)
         {
             const auto& mip = mipMaps[mipLevel];
-            const auto& quad = update[mipLevel];
-            if (quad.getArea() != 0)
+            for (const auto& quad : update[mipLevel])
                 resourceManager.updateTextureBuffer(textureBuffer, mipLevel, quad, mip.width, mip.data.data(), scene.getSceneId());
         }
         scene.popTextureBufferUpdate(textureBuffer);
@@ -60,7 +60,10 @@ namespace ramses::internal
         switch (sceneState)
         {
         case ESceneState::Rendered:
-            m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneHiddenIndirect, sceneId);
+            if (m_scenesWithDeferredShownEvent.erase(sceneId) != 0u)
+                m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneShowFailed, sceneId);
+            else
+                m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneHiddenIndirect, sceneId);
             RFALLTHROUGH;
 
         case ESceneState::RenderRequested:
@@ -172,19 +175,39 @@ namespace ramses::internal
         LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state RENDERED_REQUESTED", sceneId);
     }
 
-    void SceneStateExecutor::setRendered(SceneId sceneId)
+    void SceneStateExecutor::setRendered(SceneId sceneId, bool deferShownEvent)
     {
         assert(canBeShown(sceneId));
         m_scenesStateInfo.setSceneState(sceneId, ESceneState::Rendered);
+        if (deferShownEvent)
+        {
+            m_scenesWithDeferredShownEvent.insert(sceneId);
+            LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state RENDERED caused by command SHOW, reported as shown later", sceneId);
+            return;
+        }
         m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneShown, sceneId);
         LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state RENDERED caused by command SHOW", sceneId);
     }
 
+    void SceneStateExecutor::reportDeferredShown(SceneId sceneId)
+    {
+        if (m_scenesWithDeferredShownEvent.erase(sceneId) != 0u)
+        {
+            assert(getSceneState(sceneId) == ESceneState::Rendered);
+            m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneShown, sceneId);
+            LOG_INFO(CONTEXT_RENDERER, "Scene {} is reported as shown", sceneId);
+        }
+    }
+
     void SceneStateExecutor::setHidden(SceneId sceneId)
     {
         assert(canBeHidden(sceneId));
         m_scenesStateInfo.setSceneState(sceneId, ESceneState::Mapped);
-        m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneHidden, sceneId);
+        // hidden before reported as shown cancels the show command
+        if (m_scenesWithDeferredShownEvent.erase(sceneId) != 0u)
+            m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneShowFailed, sceneId);
+        else
+            m_rendererEventCollector.addInternalSceneEvent(ERendererEventType::SceneHidden, sceneId);
         LOG_INFO(CONTEXT_RENDERER, "Scene {} is in state MAPPED caused by command HIDE", sceneId);
     }
 
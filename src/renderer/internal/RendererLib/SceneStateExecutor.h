@@ -11,6 +11,8 @@
 #include "internal/RendererLib/SceneStateInfo.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
 
+#include <unordered_set>
+
 namespace ramses::internal
 {
     class Renderer;
@@ -35,7 +37,10 @@ namespace ramses::internal
         void setMapped                        (SceneId sceneId);
         void setUnmapped                      (SceneId sceneId);
         void setRenderedRequested             (SceneId sceneId);
-        void setRendered                      (SceneId sceneId);
+        // scene can be rendered without being reported as shown yet, e.g. while its render once passes are warmed up,
+        // if it is hidden or rolled back before reporting it is reported as failed to show
+        void setRendered                      (SceneId sceneId, bool deferShownEvent = false);
+        void reportDeferredShown              (SceneId sceneId);
         void setHidden                        (SceneId sceneId);
 
         [[nodiscard]] bool checkIfCanBePublished            (SceneId sceneId) const;
@@ -71,6 +76,7 @@ namespace ramses::internal
         RendererEventCollector&       m_rendererEventCollector;
         IRendererSceneEventSender&    m_rendererSceneEventSender;
         SceneStateInfo                m_scenesStateInfo;
+        std::unordered_set<SceneId>   m_scenesWithDeferredShownEvent;
 
         friend class RendererLogger;
     };
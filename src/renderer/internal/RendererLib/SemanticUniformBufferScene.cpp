@@ -95,13 +95,13 @@ namespace ramses::internal
     bool SemanticUniformBufferScene::checkRenderableDirtiness(const Renderable& renderable) const
     {
         return renderable.visibilityMode == EVisibilityMode::Visible
-            && getMatrixCacheEntry(renderable.node).m_matrixDirty[ETransformationMatrixType_World];
+            && isMatrixCacheDirty(ETransformationMatrixType_World, renderable.node);
     }
 
     bool SemanticUniformBufferScene::checkCameraDirtiness(CameraHandle cameraHandle) const
     {
         const auto& camera = getCamera(cameraHandle);
-        return getMatrixCacheEntry(camera.node).m_matrixDirty[ETransformationMatrixType_Object]
+        return isMatrixCacheDirty(ETransformationMatrixType_Object, camera.node)
             || getCameraProjection(camera) != *m_cameraProjectionParamsCache.getMemory(cameraHandle);
     }
 
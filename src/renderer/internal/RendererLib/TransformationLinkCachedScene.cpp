@@ -74,7 +74,8 @@ namespace ramses::internal
             m_dirtyPropagationTraversalBuffer.pop_back();
 
             const bool wasDirty = markDirty(node);
-            m_sceneLinksManager.getTransformationLinkManager().propagateTransformationDirtinessToConsumers(getSceneId(), node);
+            if (!m_transformationLinksIgnored)
+                m_sceneLinksManager.getTransformationLinkManager().propagateTransformationDirtinessToConsumers(getSceneId(), node);
 
             if (!wasDirty)
             {
@@ -84,6 +85,11 @@ namespace ramses::internal
         }
     }
 
+    void TransformationLinkCachedScene::setTransformationLinksIgnored(bool ignored)
+    {
+        m_transformationLinksIgnored = ignored;
+    }
+
     glm::mat4 TransformationLinkCachedScene::updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const
     {
         if (!m_sceneLinksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumer(getSceneId()))
@@ -99,7 +105,7 @@ namespace ramses::internal
         {
             const NodeHandle nodeToUpdate = m_dirtyNodes[i];
             getMatrixForNode(matrixType, nodeToUpdate, chainMatrix);
-            setMatrixCache(matrixType, getMatrixCacheEntry(nodeToUpdate), chainMatrix);
+            setMatrixCache(matrixType, nodeToUpdate, chainMatrix);
         }
 
         return chainMatrix;
@@ -121,4 +127,43 @@ namespace ramses::internal
     {
         chainMatrix = m_sceneLinksManager.getTransformationLinkManager().getLinkedTransformationFromDataProvider(matrixType, getSceneId(), node);
     }
+
+    void TransformationLinkCachedScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data)
+    {
+        m_pickableGeometryBVHs.erase(handle);
+        BaseT::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+    }
+
+    void TransformationLinkCachedScene::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        m_pickableGeometryBVHs.erase(handle);
+        BaseT::setDataBufferUsedSize(handle, usedSizeInBytes);
+    }
+
+    void TransformationLinkCachedScene::releaseDataBuffer(DataBufferHandle handle)
+    {
+        m_pickableGeometryBVHs.erase(handle);
+        BaseT::releaseDataBuffer(handle);
+    }
+
+    const TriangleBVH& TransformationLinkCachedScene::getPickableGeometryBVH(DataBufferHandle geometryHandle) const
+    {
+        return *getSharedPickableGeometryBVH(geometryHandle);
+    }
+
+    std::shared_ptr<const TriangleBVH> TransformationLinkCachedScene::getSharedPickableGeometryBVH(DataBufferHandle geometryHandle) const
+    {
+        auto it = m_pickableGeometryBVHs.find(geometryHandle);
+        if (it == m_pickableGeometryBVHs.end())
+        {
+            const GeometryDataBuffer& geometryBuffer = getDataBuffer(geometryHandle);
+            assert(geometryBuffer.bufferType == EDataBufferType::VertexBuffer);
+            assert(geometryBuffer.dataType == EDataType::Vector3F);
+            const auto* geometryBufferFloat = reinterpret_cast<const float*>(geometryBuffer.data.data());
+            const uint32_t geometrySize = geometryBuffer.usedSize / sizeof(float);
+            it = m_pickableGeometryBVHs.emplace(geometryHandle, std::make_shared<const TriangleBVH>(geometryBufferFloat, geometrySize)).first;
+        }
+
+        return it->second;
+    }
 }
@@ -9,6 +9,10 @@
 #pragma once
 
 #include "internal/RendererLib/SceneLinkScene.h"
+#include "internal/RendererLib/TriangleBVH.h"
+
+#include <unordered_map>
+#include <memory>
 
 namespace ramses::internal
 {
@@ -28,8 +32,19 @@ namespace ramses::internal
         void                    setScaling(TransformHandle transform, const glm::vec3& scaling) override;
 
         void                    releaseDataSlot(DataSlotHandle handle) override;
+        void                    updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data) override;
+        void                    setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes) override;
+        void                    releaseDataBuffer(DataBufferHandle handle) override;
+
         [[nodiscard]] glm::mat4 updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const;
         void      propagateDirtyToConsumers(NodeHandle node) const;
+        // scene which is not linked does not need to query links manager when propagating dirtiness,
+        // must be set while scene is modified outside of display thread where links manager cannot be accessed
+        void      setTransformationLinksIgnored(bool ignored);
+        // hierarchy over triangles of pickable geometry buffer, built on first use after the buffer changed
+        [[nodiscard]] const TriangleBVH& getPickableGeometryBVH(DataBufferHandle geometryHandle) const;
+        // same hierarchy shared with its user, stays valid when the buffer changes (e.g. for picking outside of display thread)
+        [[nodiscard]] std::shared_ptr<const TriangleBVH> getSharedPickableGeometryBVH(DataBufferHandle geometryHandle) const;
 
     private:
         void getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const;
@@ -38,5 +53,9 @@ namespace ramses::internal
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        mutable std::unordered_map<DataBufferHandle, std::shared_ptr<const TriangleBVH>> m_pickableGeometryBVHs;
+
+        bool m_transformationLinksIgnored = false;
     };
 }
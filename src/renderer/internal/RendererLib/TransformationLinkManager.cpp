@@ -11,6 +11,8 @@
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/DataLinkUtils.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     TransformationLinkManager::TransformationLinkManager(RendererScenes& rendererScenes)
@@ -28,7 +30,19 @@ namespace ramses::internal
             removeDataLink(link.consumerSceneId, link.consumerSlot);
         }
 
-        m_nodesToDataSlots.remove(sceneId);
+        // links to providers are removed without dirty propagation, scene is going to be removed
+        const NodeToProviderNodeMap* providerNodes = m_consumerNodesToProviderNodes.get(sceneId);
+        if (providerNodes != nullptr)
+        {
+            NodeHandleVector consumerNodes;
+            for (const auto& providerNode : *providerNodes)
+                consumerNodes.push_back(providerNode.key);
+            for (const auto consumerNode : consumerNodes)
+                removeLinkedNodes(sceneId, consumerNode);
+            m_consumerNodesToProviderNodes.remove(sceneId);
+        }
+        m_providerNodesToConsumerNodes.remove(sceneId);
+
         LinkManagerBase::removeSceneLinks(sceneId);
     }
 
@@ -47,17 +61,7 @@ namespace ramses::internal
         assert(providerNodeHandle.isValid());
         assert(consumerNodeHandle.isValid());
 
-        if (!m_nodesToDataSlots.contains(providerSceneId))
-        {
-            m_nodesToDataSlots.put(providerSceneId, NodeToSlotMap());
-        }
-        m_nodesToDataSlots.get(providerSceneId)->put(providerNodeHandle, providerSlotHandle);
-
-        if (!m_nodesToDataSlots.contains(consumerSceneId))
-        {
-            m_nodesToDataSlots.put(consumerSceneId, NodeToSlotMap());
-        }
-        m_nodesToDataSlots.get(consumerSceneId)->put(consumerNodeHandle, consumerSlotHandle);
+        addLinkedNodes(providerSceneId, providerNodeHandle, consumerSceneId, consumerNodeHandle);
 
         const TransformationLinkCachedScene& consumerScene = m_scenes.getScene(consumerSceneId);
         consumerScene.propagateDirtyToConsumers(consumerNodeHandle);
@@ -81,8 +85,7 @@ namespace ramses::internal
 
         if (LinkManagerBase::removeDataLink(consumerSceneId, consumerSlotHandle))
         {
-            assert(m_nodesToDataSlots.contains(consumerSceneId));
-            m_nodesToDataSlots.get(consumerSceneId)->remove(consumerNodeHandle);
+            removeLinkedNodes(consumerSceneId, consumerNodeHandle);
 
             return true;
         }
@@ -92,55 +95,76 @@ namespace ramses::internal
 
     bool TransformationLinkManager::nodeHasDataLinkToProvider(SceneId consumerSceneId, NodeHandle consumerNodeHandle) const
     {
-        const DataSlotHandle consumerSlotHandle = getDataSlotForNode(consumerSceneId, consumerNodeHandle);
-        return getSceneLinks().hasLinkedProvider(consumerSceneId, consumerSlotHandle);
+        return getLinkedProviderNode(consumerSceneId, consumerNodeHandle) != nullptr;
     }
 
     glm::mat4 TransformationLinkManager::getLinkedTransformationFromDataProvider(ETransformationMatrixType matrixType,
                                                                                  SceneId    consumerSceneId,
                                                                                  NodeHandle consumerNodeHandle) const
     {
-        const DataSlotHandle consumerSlotHandle = getDataSlotForNode(consumerSceneId, consumerNodeHandle);
-        const SceneLink&     link = getSceneLinks().getLinkedProvider(consumerSceneId, consumerSlotHandle);
-
-        const TransformationLinkCachedScene& providerScene      = m_scenes.getScene(link.providerSceneId);
-        const NodeHandle                     providerNodeHandle = providerScene.getDataSlot(link.providerSlot).attachedNode;
+        const LinkedNode* providerNode = getLinkedProviderNode(consumerSceneId, consumerNodeHandle);
+        assert(providerNode != nullptr);
 
-        return providerScene.updateMatrixCacheWithLinks(matrixType, providerNodeHandle);
+        const TransformationLinkCachedScene& providerScene = m_scenes.getScene(providerNode->sceneId);
+        return providerScene.updateMatrixCacheWithLinks(matrixType, providerNode->node);
     }
 
     void TransformationLinkManager::propagateTransformationDirtinessToConsumers(SceneId providerSceneId, NodeHandle providerNodeHandle) const
     {
-        const DataSlotHandle providerSlotHandle = getDataSlotForNode(providerSceneId, providerNodeHandle);
+        const NodeToConsumerNodesMap* consumerNodesMap = m_providerNodesToConsumerNodes.get(providerSceneId);
+        if (consumerNodesMap == nullptr)
+            return;
 
-        SceneLinkVector links;
-        getSceneLinks().getLinkedConsumers(providerSceneId, providerSlotHandle, links);
+        const std::vector<LinkedNode>* consumerNodes = consumerNodesMap->get(providerNodeHandle);
+        if (consumerNodes == nullptr)
+            return;
 
-        for(const auto& link : links)
+        for (const auto& consumerNode : *consumerNodes)
         {
-            assert(link.providerSceneId == providerSceneId);
-            assert(link.providerSlot == providerSlotHandle);
-            const TransformationLinkCachedScene& consumerScene = m_scenes.getScene(link.consumerSceneId);
-            const NodeHandle consumerNodeHandle = consumerScene.getDataSlot(link.consumerSlot).attachedNode;
-
-            consumerScene.propagateDirtyToConsumers(consumerNodeHandle);
+            const TransformationLinkCachedScene& consumerScene = m_scenes.getScene(consumerNode.sceneId);
+            consumerScene.propagateDirtyToConsumers(consumerNode.node);
         }
     }
 
-    DataSlotHandle TransformationLinkManager::getDataSlotForNode(SceneId sceneId, NodeHandle node) const
+    const TransformationLinkManager::LinkedNode* TransformationLinkManager::getLinkedProviderNode(SceneId consumerSceneId, NodeHandle consumerNodeHandle) const
     {
-        const NodeToSlotMap* nodeToSlotMap = m_nodesToDataSlots.get(sceneId);
-        if (nodeToSlotMap == nullptr)
+        const NodeToProviderNodeMap* providerNodes = m_consumerNodesToProviderNodes.get(consumerSceneId);
+        if (providerNodes == nullptr)
         {
-            return DataSlotHandle::Invalid();
+            return nullptr;
         }
 
-        DataSlotHandle* slotEntry = nodeToSlotMap->get(node);
-        if (slotEntry == nullptr)
+        return providerNodes->get(consumerNodeHandle);
+    }
+
+    void TransformationLinkManager::addLinkedNodes(SceneId providerSceneId, NodeHandle providerNodeHandle, SceneId consumerSceneId, NodeHandle consumerNodeHandle)
+    {
+        m_consumerNodesToProviderNodes[consumerSceneId].put(consumerNodeHandle, { providerSceneId, providerNodeHandle });
+        m_providerNodesToConsumerNodes[providerSceneId][providerNodeHandle].push_back({ consumerSceneId, consumerNodeHandle });
+    }
+
+    void TransformationLinkManager::removeLinkedNodes(SceneId consumerSceneId, NodeHandle consumerNodeHandle)
+    {
+        NodeToProviderNodeMap* providerNodes = m_consumerNodesToProviderNodes.get(consumerSceneId);
+        assert(providerNodes != nullptr);
+        LinkedNode providerNode;
+        if (!providerNodes->remove(consumerNodeHandle, &providerNode))
         {
-            return DataSlotHandle::Invalid();
+            assert(false && "tried to remove non-existent linked node");
+            return;
         }
 
-        return *slotEntry;
+        NodeToConsumerNodesMap* consumerNodesMap = m_providerNodesToConsumerNodes.get(providerNode.sceneId);
+        if (consumerNodesMap == nullptr)
+            return;
+        std::vector<LinkedNode>* consumerNodes = consumerNodesMap->get(providerNode.node);
+        if (consumerNodes == nullptr)
+            return;
+
+        consumerNodes->erase(std::remove_if(consumerNodes->begin(), consumerNodes->end(), [&](const LinkedNode& linkedNode) {
+            return linkedNode.sceneId == consumerSceneId && linkedNode.node == consumerNodeHandle;
+        }), consumerNodes->end());
+        if (consumerNodes->empty())
+            consumerNodesMap->remove(providerNode.node);
     }
 }
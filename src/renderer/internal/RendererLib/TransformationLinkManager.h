@@ -12,6 +12,8 @@
 #include "internal/SceneGraph/Scene/ETransformMatrixType.h"
 #include "impl/DataTypesImpl.h"
 
+#include <vector>
+
 namespace ramses::internal
 {
     class RendererScenes;
@@ -35,10 +37,21 @@ namespace ramses::internal
         using LinkManagerBase::getSceneLinks;
 
     private:
-        [[nodiscard]] DataSlotHandle getDataSlotForNode(SceneId sceneId, NodeHandle node) const;
-
-        using NodeToSlotMap = HashMap<NodeHandle, DataSlotHandle>;
-        using SceneToNodeSlotMap = HashMap<SceneId, NodeToSlotMap>;
-        SceneToNodeSlotMap m_nodesToDataSlots;
+        struct LinkedNode
+        {
+            SceneId sceneId;
+            NodeHandle node;
+        };
+
+        [[nodiscard]] const LinkedNode* getLinkedProviderNode(SceneId consumerSceneId, NodeHandle consumerNodeHandle) const;
+        void addLinkedNodes(SceneId providerSceneId, NodeHandle providerNodeHandle, SceneId consumerSceneId, NodeHandle consumerNodeHandle);
+        void removeLinkedNodes(SceneId consumerSceneId, NodeHandle consumerNodeHandle);
+
+        // links resolved to nodes in both directions, so that matrix cache update and dirtiness propagation
+        // (executed for every node visited) do not need to search through all scene links
+        using NodeToProviderNodeMap = HashMap<NodeHandle, LinkedNode>;
+        using NodeToConsumerNodesMap = HashMap<NodeHandle, std::vector<LinkedNode>>;
+        HashMap<SceneId, NodeToProviderNodeMap> m_consumerNodesToProviderNodes;
+        HashMap<SceneId, NodeToConsumerNodesMap> m_providerNodesToConsumerNodes;
     };
 }
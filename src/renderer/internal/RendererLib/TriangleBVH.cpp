@@ -0,0 +1,213 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/TriangleBVH.h"
+#include "internal/RendererLib/IntersectionUtils.h"
+#include "glm/common.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+
+namespace ramses::internal
+{
+    TriangleBVH::TriangleBVH(const float* geometry, size_t geometrySize)
+    {
+        assert(geometrySize % 9 == 0);
+        const auto triangleCount = static_cast<uint32_t>(geometrySize / 9);
+        if (triangleCount == 0u)
+            return;
+
+        m_vertices.resize(triangleCount * 3u);
+        std::vector<glm::vec3> centroids(triangleCount);
+        for (uint32_t tri = 0u; tri < triangleCount; ++tri)
+        {
+            for (uint32_t v = 0u; v < 3u; ++v)
+            {
+                const float* vertexData = &geometry[tri * 9u + v * 3u];
+                m_vertices[tri * 3u + v] = { vertexData[0], vertexData[1], vertexData[2] };
+            }
+            centroids[tri] = (m_vertices[tri * 3u] + m_vertices[tri * 3u + 1u] + m_vertices[tri * 3u + 2u]) / 3.f;
+        }
+
+        std::vector<uint32_t> triangleOrder(triangleCount);
+        std::iota(triangleOrder.begin(), triangleOrder.end(), 0u);
+        // median split yields at most 2 * triangleCount / MaxTrianglesInLeaf nodes
+        m_nodes.reserve(2u * (triangleCount / MaxTrianglesInLeaf + 1u));
+        buildNode(triangleOrder, 0u, triangleCount, centroids, 1u);
+
+        // reorder triangles so that leaves reference contiguous ranges
+        std::vector<glm::vec3> orderedVertices(m_vertices.size());
+        for (uint32_t i = 0u; i < triangleCount; ++i)
+        {
+            for (uint32_t v = 0u; v < 3u; ++v)
+                orderedVertices[i * 3u + v] = m_vertices[triangleOrder[i] * 3u + v];
+        }
+        m_vertices.swap(orderedVertices);
+    }
+
+    uint32_t TriangleBVH::buildNode(std::vector<uint32_t>& triangleOrder, uint32_t begin, uint32_t end, const std::vector<glm::vec3>& centroids, uint32_t depth)
+    {
+        m_depth = std::max(m_depth, depth);
+
+        const auto nodeIdx = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+
+        glm::vec3 boundsMin{ std::numeric_limits<float>::max() };
+        glm::vec3 boundsMax{ std::numeric_limits<float>::lowest() };
+        glm::vec3 centroidsMin{ std::numeric_limits<float>::max() };
+        glm::vec3 centroidsMax{ std::numeric_limits<float>::lowest() };
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t tri = triangleOrder[i];
+            for (uint32_t v = 0u; v < 3u; ++v)
+            {
+                boundsMin = glm::min(boundsMin, m_vertices[tri * 3u + v]);
+                boundsMax = glm::max(boundsMax, m_vertices[tri * 3u + v]);
+            }
+            centroidsMin = glm::min(centroidsMin, centroids[tri]);
+            centroidsMax = glm::max(centroidsMax, centroids[tri]);
+        }
+
+        // enlarge bounds slightly so that box test never rejects a hit accepted by triangle test at triangle edges
+        const glm::vec3 padding = glm::max(glm::abs(boundsMin), glm::abs(boundsMax)) * 1e-5f + glm::vec3{ std::numeric_limits<float>::epsilon() };
+        m_nodes[nodeIdx].boundsMin = boundsMin - padding;
+        m_nodes[nodeIdx].boundsMax = boundsMax + padding;
+
+        if (end - begin <= MaxTrianglesInLeaf)
+        {
+            m_nodes[nodeIdx].trianglesBegin = begin;
+            m_nodes[nodeIdx].trianglesCount = end - begin;
+            return nodeIdx;
+        }
+
+        // split at median of triangle centroids along the largest extent
+        const glm::vec3 extent = centroidsMax - centroidsMin;
+        const auto axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+        const uint32_t mid = begin + (end - begin) / 2u;
+        const auto orderBegin = triangleOrder.begin();
+        std::nth_element(orderBegin + static_cast<std::ptrdiff_t>(begin), orderBegin + static_cast<std::ptrdiff_t>(mid), orderBegin + static_cast<std::ptrdiff_t>(end),
+            [&centroids, axis](uint32_t a, uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+
+        buildNode(triangleOrder, begin, mid, centroids, depth + 1u);
+        const uint32_t rightChild = buildNode(triangleOrder, mid, end, centroids, depth + 1u);
+        m_nodes[nodeIdx].trianglesBegin = rightChild;
+
+        return nodeIdx;
+    }
+
+    bool TriangleBVH::empty() const
+    {
+        return m_nodes.empty();
+    }
+
+    uint32_t TriangleBVH::getTriangleCount() const
+    {
+        return static_cast<uint32_t>(m_vertices.size() / 3u);
+    }
+
+    uint32_t TriangleBVH::getNodeCount() const
+    {
+        return static_cast<uint32_t>(m_nodes.size());
+    }
+
+    uint32_t TriangleBVH::getDepth() const
+    {
+        return m_depth;
+    }
+
+    const glm::vec3& TriangleBVH::getBoundsMin() const
+    {
+        assert(!empty());
+        return m_nodes.front().boundsMin;
+    }
+
+    const glm::vec3& TriangleBVH::getBoundsMax() const
+    {
+        assert(!empty());
+        return m_nodes.front().boundsMax;
+    }
+
+    bool TriangleBVH::IntersectRayVsBox(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::vec3& rayOrigin, const glm::vec3& rayDir, float maxDistance)
+    {
+        float tMin = 0.f;
+        float tMax = maxDistance;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (rayDir[axis] == 0.f)
+            {
+                // ray parallel to slab, misses unless origin within slab
+                if (rayOrigin[axis] < boxMin[axis] || rayOrigin[axis] > boxMax[axis])
+                    return false;
+                continue;
+            }
+
+            const float invDir = 1.f / rayDir[axis];
+            float t0 = (boxMin[axis] - rayOrigin[axis]) * invDir;
+            float t1 = (boxMax[axis] - rayOrigin[axis]) * invDir;
+            if (t0 > t1)
+                std::swap(t0, t1);
+            tMin = std::max(tMin, t0);
+            tMax = std::min(tMax, t1);
+            if (tMin > tMax)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool TriangleBVH::intersectRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPoint, float& distanceRayOriginToIntersection) const
+    {
+        if (m_nodes.empty())
+            return false;
+
+        bool intersectionResult = false;
+        float nearestDistance = std::numeric_limits<float>::max();
+
+        // depth of median split tree is logarithmic, fixed size stack is sufficient for any buffer size
+        std::array<uint32_t, 64u> nodeStack{};
+        assert(m_depth <= nodeStack.size());
+        size_t stackSize = 0u;
+        nodeStack[stackSize++] = 0u;
+
+        while (stackSize > 0u)
+        {
+            const uint32_t nodeIdx = nodeStack[--stackSize];
+            const Node& node = m_nodes[nodeIdx];
+            if (!IntersectRayVsBox(node.boundsMin, node.boundsMax, rayOrigin, rayDir, nearestDistance))
+                continue;
+
+            if (node.trianglesCount == 0u)
+            {
+                nodeStack[stackSize++] = node.trianglesBegin;
+                nodeStack[stackSize++] = nodeIdx + 1u;
+                continue;
+            }
+
+            for (uint32_t tri = node.trianglesBegin; tri < node.trianglesBegin + node.trianglesCount; ++tri)
+            {
+                const IntersectionUtils::Triangle triangle{ m_vertices[tri * 3u], m_vertices[tri * 3u + 1u], m_vertices[tri * 3u + 2u] };
+                float distanceResult = 0.f;
+                glm::vec3 triangleIntersection;
+                if (IntersectionUtils::IntersectRayVsTriangle(triangle, rayOrigin, rayDir, triangleIntersection, distanceResult) && distanceResult < nearestDistance)
+                {
+                    intersectionResult = true;
+                    intersectionPoint = triangleIntersection;
+                    nearestDistance = distanceResult;
+                }
+            }
+        }
+
+        if (intersectionResult)
+            distanceRayOriginToIntersection = nearestDistance;
+        return intersectionResult;
+    }
+}
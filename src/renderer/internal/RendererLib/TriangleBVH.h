@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "glm/vec3.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace ramses::internal
+{
+    // Bounding volume hierarchy over triangles of pickable geometry (tightly packed vec3 positions, 3 per triangle),
+    // used to find the nearest triangle hit by a ray without testing every triangle.
+    // Nodes are stored depth-first, left child of an inner node directly follows it.
+    class TriangleBVH
+    {
+    public:
+        static constexpr uint32_t MaxTrianglesInLeaf = 4u;
+
+        TriangleBVH() = default;
+        TriangleBVH(const float* geometry, size_t geometrySize);
+
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] uint32_t getTriangleCount() const;
+        [[nodiscard]] uint32_t getNodeCount() const;
+        [[nodiscard]] uint32_t getDepth() const;
+        [[nodiscard]] const glm::vec3& getBoundsMin() const;
+        [[nodiscard]] const glm::vec3& getBoundsMax() const;
+
+        // rayDir must be normalized, returns intersection nearest to ray origin
+        bool intersectRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPoint, float& distanceRayOriginToIntersection) const;
+
+        // slab test, true if ray hits the box closer than maxDistance (or if ray origin is inside the box)
+        static bool IntersectRayVsBox(const glm::vec3& boxMin, const glm::vec3& boxMax, const glm::vec3& rayOrigin, const glm::vec3& rayDir, float maxDistance);
+
+    private:
+        struct Node
+        {
+            glm::vec3 boundsMin;
+            glm::vec3 boundsMax;
+            // leaf: range of triangles, inner node: trianglesCount is 0 and trianglesBegin is index of right child
+            uint32_t trianglesBegin = 0u;
+            uint32_t trianglesCount = 0u;
+        };
+
+        uint32_t buildNode(std::vector<uint32_t>& triangleOrder, uint32_t begin, uint32_t end, const std::vector<glm::vec3>& centroids, uint32_t depth);
+
+        std::vector<Node> m_nodes;
+        // each triangle 3 consecutive vertices, ordered so that every leaf references a contiguous range
+        std::vector<glm::vec3> m_vertices;
+        uint32_t m_depth = 0u;
+    };
+}
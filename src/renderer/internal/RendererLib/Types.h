@@ -44,6 +44,22 @@ namespace ramses::internal
     struct DmaBufferModifiersTag{};
     using DmaBufferModifiers = StronglyTypedValue<uint64_t, std::numeric_limits<uint64_t>::max(), DmaBufferModifiersTag>;
 
+    // single plane DMA buffer owned by application, e.g. a frame from camera or video decoder
+    struct DmaBufferFrame
+    {
+        int fd = -1;
+        uint32_t width = 0u;
+        uint32_t height = 0u;
+        DmaBufferFourccFormat fourccFormat;
+        uint32_t stride = 0u;
+        DmaBufferModifiers modifiers;
+
+        bool operator==(const DmaBufferFrame& other) const
+        {
+            return fd == other.fd && width == other.width && height == other.height && fourccFormat == other.fourccFormat && stride == other.stride && modifiers == other.modifiers;
+        }
+    };
+
     struct WaylandIviSurfaceIdTag {};
     using WaylandIviSurfaceId = StronglyTypedValue<uint32_t, std::numeric_limits<uint32_t>::max(), WaylandIviSurfaceIdTag>;
     using WaylandIviSurfaceIdSet = std::unordered_set<WaylandIviSurfaceId>;
@@ -62,6 +78,10 @@ namespace ramses::internal
     using DeviceResourceHandle = TypedMemoryHandle<DeviceResourceHandleTag>;
     using DeviceHandleVector = std::vector<DeviceResourceHandle>;
 
+    // sync object in command stream of a device, can be waited for in device of a shared context
+    struct DeviceFenceTag {};
+    using DeviceFence = StronglyTypedValue<void *, nullptr, DeviceFenceTag>;
+
     struct WaylandIviLayerIdTag {};
     using WaylandIviLayerId = StronglyTypedValue<uint32_t, std::numeric_limits<uint32_t>::max(), WaylandIviLayerIdTag>;
 
@@ -88,6 +108,9 @@ namespace ramses::internal
         std::string          filename;
         bool                 fullScreen{false};
         bool                 sendViaDLT{false};
+        // read back without stalling the pipeline, pixel data become available in a later frame
+        bool                 async{false};
+        DeviceResourceHandle asyncReadHandle;
         std::vector<uint8_t> pixelData;
     };
     using ScreenshotInfoVector = std::vector<ScreenshotInfo>;
@@ -124,6 +147,7 @@ namespace ramses::internal
         EventQueue,
         All,
         PeriodicLog,
+        GpuMemory,
     };
 
     const std::array RendererLogTopicNames =
@@ -137,7 +161,8 @@ namespace ramses::internal
         "EmbeddedCompositor",
         "EventQueue",
         "All",
-        "PeriodicLog"
+        "PeriodicLog",
+        "GpuMemory"
     };
 }
 
@@ -169,4 +194,4 @@ MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::internal::WindowsWindowHandle)
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::internal::AndroidNativeWindowPtr)
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::internal::IOSNativeWindowPtr)
 MAKE_STRONGLYTYPEDVALUE_PRINTABLE(ramses::internal::BinaryShaderFormatID)
-MAKE_ENUM_CLASS_PRINTABLE(ramses::internal::ERendererLogTopic, "ERendererLogTopic", ramses::internal::RendererLogTopicNames, ramses::internal::ERendererLogTopic::PeriodicLog);
+MAKE_ENUM_CLASS_PRINTABLE(ramses::internal::ERendererLogTopic, "ERendererLogTopic", ramses::internal::RendererLogTopicNames, ramses::internal::ERendererLogTopic::GpuMemory);
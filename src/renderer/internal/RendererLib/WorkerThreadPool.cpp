@@ -0,0 +1,116 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/WorkerThreadPool.h"
+#include "internal/Watchdog/IThreadAliveNotifier.h"
+
+namespace ramses::internal
+{
+    WorkerThreadPool::Worker::Worker(WorkerThreadPool& pool, uint64_t aliveIdentifier)
+        : m_thread{ "SceneWorker" }
+        , m_aliveIdentifier(aliveIdentifier)
+        , m_pool(pool)
+    {
+    }
+
+    void WorkerThreadPool::Worker::run()
+    {
+        m_pool.runWorker(*this);
+    }
+
+    WorkerThreadPool::WorkerThreadPool(uint32_t threadCount, IThreadAliveNotifier& notifier)
+        : m_notifier(notifier)
+    {
+        m_workers.reserve(threadCount);
+        for (uint32_t i = 0u; i < threadCount; ++i)
+        {
+            m_workers.push_back(std::make_unique<Worker>(*this, m_notifier.registerThread()));
+            m_workers.back()->m_thread.start(*m_workers.back());
+        }
+    }
+
+    WorkerThreadPool::~WorkerThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            // cancel inside critical section to avoid missing the wake up in runWorker()
+            for (auto& worker : m_workers)
+                worker->m_thread.cancel();
+        }
+        m_batchAvailable.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker->m_thread.join();
+            m_notifier.unregisterThread(worker->m_aliveIdentifier);
+        }
+    }
+
+    void WorkerThreadPool::execute(size_t jobCount, const std::function<void(size_t)>& job)
+    {
+        if (jobCount == 0u)
+            return;
+
+        {
+            // worker which woke up late for previous batch might still be leaving it
+            std::unique_lock<std::mutex> guard(m_mutex);
+            m_workersIdle.wait(guard, [&]() { return m_numActiveWorkers == 0u; });
+            m_job = &job;
+            m_jobCount = jobCount;
+            m_nextJob = 0u;
+            ++m_batchCounter;
+        }
+        if (jobCount > 1u)
+            m_batchAvailable.notify_all();
+
+        executeRemainingJobs();
+
+        // all jobs were picked up, wait for workers still executing theirs
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_workersIdle.wait(guard, [&]() { return m_numActiveWorkers == 0u; });
+        m_job = nullptr;
+        m_jobCount = 0u;
+    }
+
+    size_t WorkerThreadPool::getThreadCount() const
+    {
+        return m_workers.size();
+    }
+
+    void WorkerThreadPool::runWorker(Worker& worker)
+    {
+        uint64_t lastBatch = 0u;
+        while (!worker.isCancelRequested())
+        {
+            {
+                std::unique_lock<std::mutex> guard(m_mutex);
+                while (!m_batchAvailable.wait_for(guard, m_notifier.calculateTimeout(), [&]() { return m_batchCounter != lastBatch || worker.isCancelRequested(); }))
+                    m_notifier.notifyAlive(worker.m_aliveIdentifier);
+                if (worker.isCancelRequested())
+                    break;
+                lastBatch = m_batchCounter;
+                ++m_numActiveWorkers;
+            }
+            m_notifier.notifyAlive(worker.m_aliveIdentifier);
+
+            // a worker waking up late finds all jobs picked up already and leaves right away
+            executeRemainingJobs();
+
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                --m_numActiveWorkers;
+            }
+            m_workersIdle.notify_one();
+        }
+    }
+
+    void WorkerThreadPool::executeRemainingJobs()
+    {
+        for (size_t idx = m_nextJob++; idx < m_jobCount; idx = m_nextJob++)
+            (*m_job)(idx);
+    }
+}
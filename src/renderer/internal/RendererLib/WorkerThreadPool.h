@@ -0,0 +1,72 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/PlatformAbstraction/PlatformThread.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ramses::internal
+{
+    class IThreadAliveNotifier;
+
+    // Worker threads executing batches of independent jobs for a display thread.
+    // The calling thread takes part in executing the jobs of a batch, so a batch never waits on workers which did not wake up yet.
+    class WorkerThreadPool
+    {
+    public:
+        WorkerThreadPool(uint32_t threadCount, IThreadAliveNotifier& notifier);
+        ~WorkerThreadPool();
+
+        WorkerThreadPool(const WorkerThreadPool&) = delete;
+        WorkerThreadPool& operator=(const WorkerThreadPool&) = delete;
+
+        // Executes job for every index in range [0, jobCount) and returns after all of them finished,
+        // jobs can be executed in any order and concurrently. Must be always called from the same thread.
+        void execute(size_t jobCount, const std::function<void(size_t)>& job);
+
+        [[nodiscard]] size_t getThreadCount() const;
+
+    private:
+        class Worker : public Runnable
+        {
+        public:
+            Worker(WorkerThreadPool& pool, uint64_t aliveIdentifier);
+            void run() override;
+
+            PlatformThread m_thread;
+            const uint64_t m_aliveIdentifier;
+
+        private:
+            WorkerThreadPool& m_pool;
+        };
+
+        void runWorker(Worker& worker);
+        void executeRemainingJobs();
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_batchAvailable;
+        std::condition_variable m_workersIdle;
+        // batch data written under mutex before batch counter is increased, read by workers which joined the batch
+        const std::function<void(size_t)>* m_job = nullptr;
+        size_t m_jobCount = 0u;
+        std::atomic<size_t> m_nextJob{ 0u };
+        uint64_t m_batchCounter = 0u;
+        size_t m_numActiveWorkers = 0u;
+
+        IThreadAliveNotifier& m_notifier;
+    };
+}
@@ -0,0 +1,68 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "allocationcounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> gAllocationCount{ 0u };
+
+    void* CountedAllocate(std::size_t size)
+    {
+        gAllocationCount.fetch_add(1u, std::memory_order_relaxed);
+        void* ptr = std::malloc(size == 0u ? 1u : size);
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return ptr;
+    }
+}
+
+// default nothrow variants forward to these, over-aligned allocations are not counted
+// NOLINTBEGIN(cppcoreguidelines-no-malloc)
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc)
+
+namespace ramses
+{
+    uint64_t AllocationCounter::GetAllocationCount()
+    {
+        return gAllocationCount.load(std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,28 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "benchmark/benchmark.h"
+#include <cstdint>
+
+namespace ramses
+{
+    // counts heap allocations of the whole benchmark binary, global operator new is replaced in allocationcounter.cpp
+    class AllocationCounter
+    {
+    public:
+        [[nodiscard]] static uint64_t GetAllocationCount();
+
+        // reports allocations per iteration as 'allocs' counter of the benchmark
+        static void Report(benchmark::State& state, uint64_t allocationCount)
+        {
+            state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocationCount), benchmark::Counter::kAvgIterations);
+        }
+    };
+}
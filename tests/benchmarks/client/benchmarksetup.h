@@ -0,0 +1,55 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "benchmark/benchmark.h"
+#include "allocationcounter.h"
+#include "LargeSceneGenerator.h"
+#include "ramses/client/ramses-client.h"
+#include "ramses/client/logic/LogicEngine.h"
+#include "impl/RamsesLoggerImpl.h"
+
+namespace ramses
+{
+    class BenchmarkSetUp
+    {
+    public:
+        BenchmarkSetUp()
+        {
+            ramses::internal::GetRamsesLogger().setConsoleLogLevel(ELogLevel::Off);
+        }
+
+        RamsesFramework m_framework{ RamsesFrameworkConfig{EFeatureLevel_Latest} };
+        RamsesClient& m_client{ *m_framework.createClient("benchmarkClient") };
+        Scene& m_scene{ *m_client.createScene(SceneConfig(sceneId_t{ 123u })) };
+        LogicEngine& m_logicEngine{ *m_scene.createLogicEngine() };
+    };
+
+    // ARG scene size: 0 small, 1 medium, 2 large - same parameters as scenes of RL_GENERATE_LARGE_SCENES where they exist
+    inline LargeSceneConfig GetBenchmarkSceneConfig(int64_t sceneSize)
+    {
+        LargeSceneConfig config;
+        if (sceneSize >= 1)
+        {
+            config.nodeCount = 10000u;
+            config.treeDepth = 8u;
+            config.renderableCount = 1000u;
+            config.effectCount = 16u;
+            config.textureCount = 32u;
+            config.scriptCount = 1000u;
+        }
+        if (sceneSize >= 2)
+        {
+            config.nodeCount = 50000u;
+            config.renderableCount = 5000u;
+            config.scriptCount = 5000u;
+        }
+        return config;
+    }
+}
@@ -0,0 +1,83 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+
+#include <vector>
+
+namespace ramses
+{
+    static void BM_Scene_Flush(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        createLargeScene(setup.m_scene, setup.m_logicEngine, GetBenchmarkSceneConfig(state.range(0)));
+        const auto changeCount = static_cast<size_t>(state.range(1));
+
+        std::vector<Node*> changedNodes;
+        for (size_t i = 0u; i < changeCount; ++i)
+            changedNodes.push_back(setup.m_scene.createNode());
+        if (!setup.m_logicEngine.update() || !setup.m_scene.flush())
+            state.SkipWithError("failure preparing scene");
+
+        float offset = 0.f;
+        uint64_t allocations = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            state.PauseTiming();
+            offset += 1.f;
+            for (auto* node : changedNodes)
+                node->setTranslation({ offset, 0.f, 0.f });
+            state.ResumeTiming();
+
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            if (!setup.m_scene.flush())
+                state.SkipWithError("failure running flush()");
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(changeCount));
+    }
+
+    static void BM_Scene_ChangeAndFlush(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        createLargeScene(setup.m_scene, setup.m_logicEngine, GetBenchmarkSceneConfig(0));
+        const auto changeCount = static_cast<size_t>(state.range(0));
+
+        std::vector<Node*> changedNodes;
+        for (size_t i = 0u; i < changeCount; ++i)
+            changedNodes.push_back(setup.m_scene.createNode());
+        if (!setup.m_logicEngine.update() || !setup.m_scene.flush())
+            state.SkipWithError("failure preparing scene");
+
+        float offset = 0.f;
+        uint64_t allocations = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            offset += 1.f;
+            for (auto* node : changedNodes)
+                node->setTranslation({ offset, 0.f, 0.f });
+            if (!setup.m_scene.flush())
+                state.SkipWithError("failure running flush()");
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(changeCount));
+    }
+
+    // Measures Scene::flush with given number of changed nodes, excluding the cost of changing them
+    // ARGS: scene size (0 small, 1 medium, 2 large), number of nodes changed before every flush
+    BENCHMARK(BM_Scene_Flush)->ArgsProduct({ { 0, 1, 2 }, { 0, 10, 100, 1000, 10000 } })->Unit(benchmark::kMicrosecond);
+
+    // Measures changing translation of given number of nodes followed by Scene::flush, as done by application every frame
+    // ARG: number of nodes changed before every flush
+    BENCHMARK(BM_Scene_ChangeAndFlush)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,85 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+
+#include <cstring>
+#include <vector>
+
+namespace ramses
+{
+    static void BM_Scene_CreateArrayResource(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto vertexCount = static_cast<size_t>(state.range(0));
+        std::vector<vec3f> vertices(vertexCount, vec3f{ 1.f, 2.f, 3.f });
+
+        uint64_t allocations = 0u;
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // content differs for every created resource, so that it has to be hashed
+            state.PauseTiming();
+            value += 1.f;
+            vertices.front().x = value;
+            state.ResumeTiming();
+
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            auto* resource = setup.m_scene.createArrayResource(vertices.size(), vertices.data());
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+            if (resource == nullptr)
+                state.SkipWithError("failure creating resource");
+
+            state.PauseTiming();
+            setup.m_scene.destroy(*resource);
+            state.ResumeTiming();
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(vertexCount * sizeof(vec3f)));
+    }
+
+    static void BM_Scene_CreateTexture2D(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto size = static_cast<uint32_t>(state.range(0));
+        const bool generateMipChain = state.range(1) != 0;
+        std::vector<MipLevelData> mipLevels{ MipLevelData(size_t{ size } * size * 4u, std::byte{ 0x7f }) };
+
+        uint64_t allocations = 0u;
+        uint8_t value = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // content differs for every created resource, so that it has to be hashed
+            state.PauseTiming();
+            mipLevels.front().front() = std::byte{ ++value };
+            state.ResumeTiming();
+
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            auto* texture = setup.m_scene.createTexture2D(ETextureFormat::RGBA8, size, size, mipLevels, generateMipChain);
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+            if (texture == nullptr)
+                state.SkipWithError("failure creating texture");
+
+            state.PauseTiming();
+            setup.m_scene.destroy(*texture);
+            state.ResumeTiming();
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mipLevels.front().size()));
+    }
+
+    // Measures creation of vertex array resource including copying and hashing its data
+    // ARG: number of vec3f vertices
+    BENCHMARK(BM_Scene_CreateArrayResource)->Arg(100)->Arg(10000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+    // Measures creation of RGBA8 texture resource including copying and hashing its data
+    // ARGS: texture width and height, whether mip chain is generated
+    BENCHMARK(BM_Scene_CreateTexture2D)->ArgsProduct({ { 64, 512, 2048 }, { 0, 1 } })->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,156 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ramses
+{
+    // creates synthetic scene of given size and saves it, returns size of the file in bytes
+    static size_t CreateBenchmarkSceneFile(const std::string& fileName, int64_t sceneSize, bool compressed)
+    {
+        BenchmarkSetUp setup;
+        createLargeScene(setup.m_scene, setup.m_logicEngine, GetBenchmarkSceneConfig(sceneSize));
+        SaveFileConfig saveConfig;
+        saveConfig.setCompressionEnabled(compressed);
+        if (!setup.m_logicEngine.update() || !setup.m_scene.saveToFile(fileName, saveConfig))
+            std::abort();
+        return static_cast<size_t>(std::filesystem::file_size(fileName));
+    }
+
+    class BenchmarkLoadEventHandler : public IClientEventHandler
+    {
+    public:
+        void sceneFileLoadFailed(std::string_view /*filename*/) override
+        {
+            ++failedCount;
+        }
+
+        void sceneFileLoadSucceeded(std::string_view /*filename*/, Scene* loadedScene) override
+        {
+            loadedScenes.push_back(loadedScene);
+        }
+
+        void sceneReferenceStateChanged(SceneReference& /*sceneRef*/, RendererSceneState /*state*/) override {}
+        void sceneReferenceFlushed(SceneReference& /*sceneRef*/, sceneVersionTag_t /*versionTag*/) override {}
+        void dataLinked(sceneId_t /*providerScene*/, dataProviderId_t /*providerId*/, sceneId_t /*consumerScene*/, dataConsumerId_t /*consumerId*/, bool /*success*/) override {}
+        void dataUnlinked(sceneId_t /*consumerScene*/, dataConsumerId_t /*consumerId*/, bool /*success*/) override {}
+
+        std::vector<Scene*> loadedScenes;
+        size_t failedCount = 0u;
+    };
+
+    static void BM_Scene_SaveToFile(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        createLargeScene(setup.m_scene, setup.m_logicEngine, GetBenchmarkSceneConfig(state.range(0)));
+        SaveFileConfig saveConfig;
+        saveConfig.setCompressionEnabled(state.range(1) != 0);
+        if (!setup.m_logicEngine.update())
+            state.SkipWithError("failure running update()");
+
+        const std::string fileName = "clientBenchmarkSave.ramses";
+        uint64_t allocations = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            if (!setup.m_scene.saveToFile(fileName, saveConfig))
+                state.SkipWithError("failure saving scene");
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(std::filesystem::file_size(fileName)));
+        std::filesystem::remove(fileName);
+    }
+
+    static void BM_Client_LoadSceneFromFile(benchmark::State& state)
+    {
+        const std::string fileName = "clientBenchmarkLoad.ramses";
+        const size_t fileSize = CreateBenchmarkSceneFile(fileName, state.range(0), state.range(1) != 0);
+
+        BenchmarkSetUp setup;
+        uint64_t allocations = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const uint64_t allocationsBefore = AllocationCounter::GetAllocationCount();
+            // own scene id, file contains the id of scene existing in setup
+            Scene* scene = setup.m_client.loadSceneFromFile(fileName, SceneConfig(sceneId_t{ 1000u }));
+            allocations += AllocationCounter::GetAllocationCount() - allocationsBefore;
+            if (scene == nullptr)
+            {
+                state.SkipWithError("failure loading scene");
+                break;
+            }
+
+            state.PauseTiming();
+            setup.m_client.destroy(*scene);
+            state.ResumeTiming();
+        }
+
+        AllocationCounter::Report(state, allocations);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(fileSize));
+        std::filesystem::remove(fileName);
+    }
+
+    static void BM_Client_LoadSceneFromFileAsync(benchmark::State& state)
+    {
+        const auto parallelLoads = static_cast<uint64_t>(state.range(1));
+        const std::string fileName = "clientBenchmarkLoadAsync.ramses";
+        const size_t fileSize = CreateBenchmarkSceneFile(fileName, state.range(0), false);
+
+        BenchmarkSetUp setup;
+        BenchmarkLoadEventHandler handler;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // every load gets own scene id, so that all of them can exist at the same time
+            for (uint64_t i = 0u; i < parallelLoads; ++i)
+            {
+                if (!setup.m_client.loadSceneFromFileAsync(fileName, SceneConfig(sceneId_t{ 1000u + i })))
+                    state.SkipWithError("failure starting async load");
+            }
+            while (handler.loadedScenes.size() + handler.failedCount < parallelLoads)
+            {
+                setup.m_client.dispatchEvents(handler);
+                std::this_thread::sleep_for(std::chrono::microseconds{ 100u });
+            }
+            if (handler.failedCount > 0u)
+            {
+                state.SkipWithError("failure loading scene asynchronously");
+                break;
+            }
+
+            state.PauseTiming();
+            for (auto* scene : handler.loadedScenes)
+                setup.m_client.destroy(*scene);
+            handler.loadedScenes.clear();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * parallelLoads));
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * parallelLoads * fileSize));
+        std::filesystem::remove(fileName);
+    }
+
+    // Measures Scene::saveToFile of synthetic scene
+    // ARGS: scene size (0 small, 1 medium, 2 large), whether resources are compressed
+    BENCHMARK(BM_Scene_SaveToFile)->ArgsProduct({ { 0, 1, 2 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+    // Measures RamsesClient::loadSceneFromFile of synthetic scene
+    // ARGS: scene size (0 small, 1 medium, 2 large), whether resources are compressed
+    BENCHMARK(BM_Client_LoadSceneFromFile)->ArgsProduct({ { 0, 1, 2 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
+
+    // Measures RamsesClient::loadSceneFromFileAsync of several scenes loaded at the same time, until all of them are dispatched
+    // ARGS: scene size (0 small, 1 medium, 2 large), number of parallel loads
+    BENCHMARK(BM_Client_LoadSceneFromFileAsync)->ArgsProduct({ { 0, 1 }, { 1, 2, 4, 8 } })->Unit(benchmark::kMillisecond)->UseRealTime();
+}
@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Resource/LZ4CompressionUtils.h"
+
+#include <random>
+#include <vector>
+#include <cstring>
+
+namespace ramses::internal
+{
+    // ARG profile 0: vertex positions of a smooth surface, compresses reasonably like most mesh data
+    // ARG profile 1: random bytes, not compressible like already compressed texture data
+    static ResourceBlob CreateCompressionInput(size_t size, int64_t profile)
+    {
+        ResourceBlob blob(size);
+        std::mt19937 gen{ 1u };
+        if (profile == 0)
+        {
+            std::vector<float> values(size / sizeof(float));
+            for (size_t i = 0u; i < values.size(); ++i)
+                values[i] = static_cast<float>(i % 3u) + static_cast<float>(i / 300u) * 0.01f;
+            std::memcpy(blob.data(), values.data(), values.size() * sizeof(float));
+        }
+        else
+        {
+            std::uniform_int_distribution<uint32_t> dist{ 0u, 255u };
+            for (size_t i = 0u; i < size; ++i)
+                blob.data()[i] = static_cast<std::byte>(dist(gen));
+        }
+        return blob;
+    }
+
+    static void BM_LZ4Compression_Compress(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0)) * 1024u;
+        const ResourceBlob input = CreateCompressionInput(size, state.range(1));
+        const auto level = state.range(2) != 0 ? LZ4CompressionUtils::CompressionLevel::High : LZ4CompressionUtils::CompressionLevel::Fast;
+
+        size_t compressedSize = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const CompressedResourceBlob compressed = LZ4CompressionUtils::compress(input, level);
+            compressedSize = compressed.size();
+            benchmark::DoNotOptimize(compressed.data());
+        }
+
+        state.counters["ratio"] = static_cast<double>(compressedSize) / static_cast<double>(size);
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    static void BM_LZ4Compression_Decompress(benchmark::State& state)
+    {
+        const auto size = static_cast<size_t>(state.range(0)) * 1024u;
+        const ResourceBlob input = CreateCompressionInput(size, state.range(1));
+        const CompressedResourceBlob compressed = LZ4CompressionUtils::compress(input, LZ4CompressionUtils::CompressionLevel::Fast);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const ResourceBlob decompressed = LZ4CompressionUtils::decompress(compressed, static_cast<uint32_t>(size));
+            benchmark::DoNotOptimize(decompressed.data());
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+    }
+
+    // Measures resource compression, as done before sending and when saving scene files
+    // ARGS: input size in KiB, data profile (0 mesh-like, 1 random), compression level (0 fast, 1 high)
+    BENCHMARK(BM_LZ4Compression_Compress)->ArgsProduct({ { 64, 4096 }, { 0, 1 }, { 0, 1 } })->Unit(benchmark::kMicrosecond);
+
+    // Measures resource decompression, as done for every received or loaded compressed resource
+    // ARGS: uncompressed size in KiB, data profile (0 mesh-like, 1 random)
+    BENCHMARK(BM_LZ4Compression_Decompress)->ArgsProduct({ { 64, 4096 }, { 0, 1 } })->Unit(benchmark::kMicrosecond);
+}
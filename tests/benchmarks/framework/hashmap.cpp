@@ -0,0 +1,113 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/PlatformAbstraction/Collections/HashMap.h"
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+
+#include <vector>
+#include <random>
+#include <array>
+
+namespace ramses::internal
+{
+    // value similar in size to entries of resource registries
+    struct BenchmarkValue
+    {
+        std::array<uint64_t, 4u> data;
+    };
+
+    static std::vector<ResourceContentHash> CreateResourceHashes(size_t count, uint32_t seed)
+    {
+        std::mt19937_64 gen{ seed };
+        std::vector<ResourceContentHash> hashes(count);
+        for (auto& hash : hashes)
+            hash = ResourceContentHash{ gen(), gen() };
+        return hashes;
+    }
+
+    template <typename MapT>
+    static void BM_HashMap_LookupResourceHash(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const auto hashes = CreateResourceHashes(count, 1u);
+        const auto missingHashes = CreateResourceHashes(count, 2u);
+
+        MapT map;
+        for (const auto& hash : hashes)
+            map.put(hash, BenchmarkValue{});
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t i = 0u; i < count; ++i)
+            {
+                benchmark::DoNotOptimize(map.get(hashes[i]));
+                benchmark::DoNotOptimize(map.contains(missingHashes[i]));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(2u * count));
+    }
+
+    template <typename MapT>
+    static void BM_HashMap_InsertResourceHash(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const auto hashes = CreateResourceHashes(count, 1u);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            MapT map;
+            for (const auto& hash : hashes)
+                map.put(hash, BenchmarkValue{});
+            benchmark::DoNotOptimize(map.size());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(count));
+    }
+
+    template <typename MapT>
+    static void BM_HashMap_IterateResourceHash(benchmark::State& state)
+    {
+        const auto count = static_cast<size_t>(state.range(0));
+        const auto hashes = CreateResourceHashes(count, 1u);
+
+        MapT map;
+        for (const auto& hash : hashes)
+            map.put(hash, BenchmarkValue{});
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            uint64_t sum = 0u;
+            for (const auto& entry : map)
+                sum += entry.value.data[0];
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(count));
+    }
+
+    using ChainedMap = HashMap<ResourceContentHash, BenchmarkValue>;
+    using FlatMap = FlatHashMap<ResourceContentHash, BenchmarkValue>;
+
+    // Measures lookup of existing and missing resource hashes, as done by resource registries for every resource use
+    // ARG: number of entries in map
+    BENCHMARK_TEMPLATE(BM_HashMap_LookupResourceHash, ChainedMap)->Arg(100)->Arg(10000)->Arg(100000);
+    BENCHMARK_TEMPLATE(BM_HashMap_LookupResourceHash, FlatMap)->Arg(100)->Arg(10000)->Arg(100000);
+
+    // Measures filling map with resource hashes without reserving capacity upfront
+    // ARG: number of entries inserted
+    BENCHMARK_TEMPLATE(BM_HashMap_InsertResourceHash, ChainedMap)->Arg(100)->Arg(10000)->Arg(100000);
+    BENCHMARK_TEMPLATE(BM_HashMap_InsertResourceHash, FlatMap)->Arg(100)->Arg(10000)->Arg(100000);
+
+    // Measures iteration over all entries, as done by renderer resource logging and statistics
+    // ARG: number of entries in map
+    BENCHMARK_TEMPLATE(BM_HashMap_IterateResourceHash, ChainedMap)->Arg(100)->Arg(10000)->Arg(100000);
+    BENCHMARK_TEMPLATE(BM_HashMap_IterateResourceHash, FlatMap)->Arg(100)->Arg(10000)->Arg(100000);
+}
@@ -0,0 +1,85 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Core/Utils/MemoryPool.h"
+#include "internal/Core/Utils/MemoryPoolExplicit.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+
+#include <array>
+
+namespace ramses::internal
+{
+    // object similar in size to scene objects like transforms or renderables
+    struct BenchmarkPoolObject
+    {
+        std::array<float, 12u> data{};
+    };
+
+    template <typename PoolT>
+    static void BM_MemoryPool_Allocate(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        const bool preallocate = state.range(1) != 0;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            PoolT pool;
+            if (preallocate)
+                pool.preallocateSize(count);
+            for (uint32_t i = 0u; i < count; ++i)
+                pool.allocate(NodeHandle{ i });
+            benchmark::DoNotOptimize(pool.getTotalCount());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+    }
+
+    template <typename PoolT>
+    static void BM_MemoryPool_Iterate(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        const auto allocatedPercent = static_cast<uint32_t>(state.range(1));
+
+        // objects spread evenly over the pool, as left after releasing parts of a scene
+        PoolT pool;
+        pool.preallocateSize(count);
+        uint32_t allocatedCount = 0u;
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            if ((i * allocatedPercent) / 100u != ((i + 1u) * allocatedPercent) / 100u)
+            {
+                pool.allocate(NodeHandle{ i });
+                ++allocatedCount;
+            }
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            float sum = 0.f;
+            for (const auto& entry : pool)
+                sum += entry.second->data[0];
+            benchmark::DoNotOptimize(sum);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * allocatedCount);
+    }
+
+    using GrowingPool = MemoryPool<BenchmarkPoolObject, NodeHandle>;
+    using ExplicitPool = MemoryPoolExplicit<BenchmarkPoolObject, NodeHandle>;
+
+    // Measures allocation of objects with given handles, as done when scene actions of initial flush are applied
+    // ARGS: number of objects, whether pool is preallocated to final size (as done with scene size information)
+    BENCHMARK_TEMPLATE(BM_MemoryPool_Allocate, GrowingPool)->ArgsProduct({ { 100, 10000, 100000 }, { 0, 1 } });
+    BENCHMARK_TEMPLATE(BM_MemoryPool_Allocate, ExplicitPool)->ArgsProduct({ { 100, 10000, 100000 }, { 0, 1 } });
+
+    // Measures iteration over allocated objects, as done by scene describer and resource collection
+    // ARGS: pool size, percentage of allocated objects in pool
+    BENCHMARK_TEMPLATE(BM_MemoryPool_Iterate, GrowingPool)->ArgsProduct({ { 10000, 100000 }, { 10, 50, 100 } });
+    BENCHMARK_TEMPLATE(BM_MemoryPool_Iterate, ExplicitPool)->ArgsProduct({ { 10000, 100000 }, { 10, 50, 100 } });
+}
@@ -0,0 +1,218 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Scene/ActionCollectingScene.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/SceneAPI/SceneSizeInformation.h"
+
+#include <memory>
+#include <vector>
+
+namespace ramses::internal
+{
+    static constexpr DataFieldHandle BenchmarkColorField{ 0u };
+    static constexpr DataFieldHandle BenchmarkMatrixField{ 1u };
+
+    struct BenchmarkSceneObjects
+    {
+        std::vector<TransformHandle> transforms;
+        std::vector<DataInstanceHandle> dataInstances;
+    };
+
+    // creates given number of nodes under common root, each with transform and data instance with color and matrix uniform
+    static BenchmarkSceneObjects CreateSceneObjects(IScene& scene, uint32_t count)
+    {
+        BenchmarkSceneObjects objects;
+        const NodeHandle root = scene.allocateNode(0u, {});
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F }, DataFieldInfo{ EDataType::Matrix44F } }, ResourceContentHash::Invalid(), {});
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            const NodeHandle node = scene.allocateNode(0u, {});
+            scene.addChildToNode(root, node);
+            objects.transforms.push_back(scene.allocateTransform(node, {}));
+            objects.dataInstances.push_back(scene.allocateDataInstance(layout, {}));
+        }
+        return objects;
+    }
+
+    // writes actions of an update flush changing translation, rotation, color and matrix of every object,
+    // either interleaved per object or grouped in runs of the same setter
+    static void WriteUpdateFlush(SceneActionCollectionCreator& creator, const BenchmarkSceneObjects& objects, bool groupedBySetter)
+    {
+        const glm::vec3 translation{ 1.f, 2.f, -10.f };
+        const glm::vec4 rotation{ 0.f, 0.f, 0.f, 1.f };
+        const glm::vec4 color{ 0.f, 1.f, 0.f, 1.f };
+        const glm::mat4 matrix{ 1.f };
+        const size_t count = objects.transforms.size();
+        if (groupedBySetter)
+        {
+            for (size_t i = 0u; i < count; ++i)
+                creator.setTranslation(objects.transforms[i], translation);
+            for (size_t i = 0u; i < count; ++i)
+                creator.setRotation(objects.transforms[i], rotation, ERotationType::Quaternion);
+            for (size_t i = 0u; i < count; ++i)
+                creator.setDataVector4fArray(objects.dataInstances[i], BenchmarkColorField, 1u, &color);
+            for (size_t i = 0u; i < count; ++i)
+                creator.setDataMatrix44fArray(objects.dataInstances[i], BenchmarkMatrixField, 1u, &matrix);
+        }
+        else
+        {
+            for (size_t i = 0u; i < count; ++i)
+            {
+                creator.setTranslation(objects.transforms[i], translation);
+                creator.setRotation(objects.transforms[i], rotation, ERotationType::Quaternion);
+                creator.setDataVector4fArray(objects.dataInstances[i], BenchmarkColorField, 1u, &color);
+                creator.setDataMatrix44fArray(objects.dataInstances[i], BenchmarkMatrixField, 1u, &matrix);
+            }
+        }
+    }
+
+    static void BM_SceneActionCollection_Write(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        ActionCollectingScene stagingScene;
+        const BenchmarkSceneObjects objects = CreateSceneObjects(stagingScene, count);
+
+        SceneActionCollection actions;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // cleared collection keeps its capacity like the collection of a client scene does between flushes
+            actions.clear();
+            SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+            WriteUpdateFlush(creator, objects, false);
+            benchmark::DoNotOptimize(actions.collectionData().data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    static void BM_SceneActionCollection_Read(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        ActionCollectingScene stagingScene;
+        const BenchmarkSceneObjects objects = CreateSceneObjects(stagingScene, count);
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+        WriteUpdateFlush(creator, objects, false);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (auto& reader : actions)
+            {
+                switch (reader.type())
+                {
+                case ESceneActionId::SetTranslation:
+                {
+                    TransformHandle transform;
+                    glm::vec3 translation;
+                    reader.read(transform);
+                    reader.read(translation);
+                    benchmark::DoNotOptimize(translation);
+                    break;
+                }
+                case ESceneActionId::SetRotation:
+                {
+                    TransformHandle transform;
+                    glm::vec4 rotation;
+                    ERotationType rotationType = ERotationType::Quaternion;
+                    reader.read(transform);
+                    reader.read(rotation);
+                    reader.read(rotationType);
+                    benchmark::DoNotOptimize(rotation);
+                    break;
+                }
+                default:
+                {
+                    // data array setters
+                    DataInstanceHandle dataInstance;
+                    DataFieldHandle field;
+                    const std::byte* data = nullptr;
+                    uint32_t size = 0u;
+                    reader.read(dataInstance);
+                    reader.read(field);
+                    reader.readWithoutCopy(data, size);
+                    benchmark::DoNotOptimize(data);
+                    break;
+                }
+                }
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    static void BM_SceneActionApplier_ApplyInitialFlush(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        ActionCollectingScene stagingScene;
+        CreateSceneObjects(stagingScene, count);
+        const SceneActionCollection& actions = stagingScene.getSceneActionCollection();
+        const SceneSizeInformation sizeInfo = stagingScene.getSceneSizeInformation();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            state.PauseTiming();
+            auto scene = std::make_unique<Scene>();
+            state.ResumeTiming();
+
+            scene->preallocateSceneSize(sizeInfo);
+            SceneActionApplier::ApplyActionsOnScene(*scene, actions, EFeatureLevel_Latest);
+
+            state.PauseTiming();
+            scene.reset();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    static void BM_SceneActionApplier_ApplyUpdateFlush(benchmark::State& state)
+    {
+        const auto count = static_cast<uint32_t>(state.range(0));
+        const bool groupedBySetter = state.range(1) != 0;
+
+        ActionCollectingScene stagingScene;
+        const BenchmarkSceneObjects objects = CreateSceneObjects(stagingScene, count);
+        Scene scene;
+        SceneActionApplier::ApplyActionsOnScene(scene, stagingScene.getSceneActionCollection(), EFeatureLevel_Latest);
+
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+        WriteUpdateFlush(creator, objects, groupedBySetter);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            SceneActionApplier::ApplyActionsOnScene(scene, actions, EFeatureLevel_Latest);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    // Measures writing scene actions of an update flush, as client scene does for every changed value
+    // ARG: number of objects changing translation, rotation, color and matrix
+    BENCHMARK(BM_SceneActionCollection_Write)->Arg(100)->Arg(1000)->Arg(10000);
+
+    // Measures reading back all values of an update flush without applying them
+    // ARG: number of objects changing translation, rotation, color and matrix
+    BENCHMARK(BM_SceneActionCollection_Read)->Arg(100)->Arg(1000)->Arg(10000);
+
+    // Measures applying initial flush creating nodes, transforms and data instances on a framework scene
+    // ARG: number of objects in the scene
+    BENCHMARK(BM_SceneActionApplier_ApplyInitialFlush)->Arg(100)->Arg(1000)->Arg(10000);
+
+    // Measures applying an update flush on a framework scene
+    // ARGS: number of objects changing translation, rotation, color and matrix, whether actions are grouped by setter instead of by object
+    BENCHMARK(BM_SceneActionApplier_ApplyUpdateFlush)->ArgsProduct({ { 100, 1000, 10000 }, { 0, 1 } });
+}
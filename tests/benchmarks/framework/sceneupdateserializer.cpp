@@ -0,0 +1,105 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
+#include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/Core/Utils/StatisticCollection.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    // packet size similar to what TCP connections use for scene updates
+    static constexpr size_t BenchmarkPacketSize = 64u * 1024u;
+
+    static void FillSceneUpdate(SceneUpdate& update, uint32_t objectCount)
+    {
+        SceneActionCollectionCreator creator(update.actions, EFeatureLevel_Latest);
+        const glm::mat4 matrix{ 1.f };
+        for (uint32_t i = 0u; i < objectCount; ++i)
+        {
+            creator.setTranslation(TransformHandle{ i }, { static_cast<float>(i), 2.f, -10.f });
+            creator.setRotation(TransformHandle{ i }, { 0.f, 0.f, 0.f, 1.f }, ERotationType::Quaternion);
+            creator.setDataMatrix44fArray(DataInstanceHandle{ i }, DataFieldHandle{ 0u }, 1u, &matrix);
+        }
+        update.flushInfos.containsValidInformation = true;
+        update.flushInfos.flushCounter = 1u;
+    }
+
+    static std::vector<std::vector<std::byte>> SerializeSceneUpdate(const SceneUpdate& update, StatisticCollectionScene& statistics, bool compress)
+    {
+        std::vector<std::vector<std::byte>> packets;
+        std::vector<std::byte> packetMem(BenchmarkPacketSize);
+        SceneUpdateSerializer serializer(update, statistics, EFeatureLevel_Latest);
+        serializer.writeToPackets({ packetMem.data(), packetMem.size() }, [&](size_t size) {
+            packets.emplace_back(packetMem.begin(), packetMem.begin() + static_cast<std::ptrdiff_t>(size));
+            return true;
+        }, compress);
+        return packets;
+    }
+
+    static void BM_SceneUpdateSerializer_Serialize(benchmark::State& state)
+    {
+        const auto objectCount = static_cast<uint32_t>(state.range(0));
+        const bool compress = state.range(1) != 0;
+        SceneUpdate update;
+        FillSceneUpdate(update, objectCount);
+        StatisticCollectionScene statistics;
+
+        std::vector<std::byte> packetMem(BenchmarkPacketSize);
+        size_t serializedSize = 0u;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            serializedSize = 0u;
+            SceneUpdateSerializer serializer(update, statistics, EFeatureLevel_Latest);
+            serializer.writeToPackets({ packetMem.data(), packetMem.size() }, [&](size_t size) {
+                serializedSize += size;
+                benchmark::DoNotOptimize(packetMem.data());
+                return true;
+            }, compress);
+        }
+
+        state.counters["ratio"] = static_cast<double>(serializedSize) / static_cast<double>(update.actions.collectionData().size());
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * update.actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(update.actions.collectionData().size()));
+    }
+
+    static void BM_SceneUpdateSerializer_Deserialize(benchmark::State& state)
+    {
+        const auto objectCount = static_cast<uint32_t>(state.range(0));
+        const bool compress = state.range(1) != 0;
+        SceneUpdate update;
+        FillSceneUpdate(update, objectCount);
+        StatisticCollectionScene statistics;
+        const auto packets = SerializeSceneUpdate(update, statistics, compress);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            SceneUpdateStreamDeserializer deserializer{ EFeatureLevel_Latest };
+            for (const auto& packet : packets)
+            {
+                auto result = deserializer.processData(packet);
+                benchmark::DoNotOptimize(result.actions.numberOfActions());
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * update.actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(update.actions.collectionData().size()));
+    }
+
+    // Measures writing scene update into packets, as done for every flush sent to a remote renderer
+    // ARGS: number of objects changing translation, rotation and matrix uniform, whether scene actions are compressed
+    BENCHMARK(BM_SceneUpdateSerializer_Serialize)->ArgsProduct({ { 100, 1000, 10000 }, { 0, 1 } });
+
+    // Measures reading scene update from packets, as done by a remote renderer for every received flush
+    // ARGS: number of objects changing translation, rotation and matrix uniform, whether scene actions are compressed
+    BENCHMARK(BM_SceneUpdateSerializer_Deserialize)->ArgsProduct({ { 100, 1000, 10000 }, { 0, 1 } });
+}
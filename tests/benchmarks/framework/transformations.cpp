@@ -0,0 +1,125 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "internal/SceneGraph/Scene/TransformationCachedScene.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    enum class BenchmarkTreeShape : int64_t
+    {
+        Flat = 0,     // all nodes are children of root
+        Balanced = 1, // every node has up to 4 children
+        Chain = 2,    // every node is child of previous node
+    };
+
+    struct BenchmarkTree
+    {
+        NodeHandleVector nodes;
+        std::vector<TransformHandle> transforms;
+    };
+
+    // creates tree of given shape where every node has a transform, first node is root
+    static BenchmarkTree CreateTree(TransformationCachedScene& scene, BenchmarkTreeShape shape, uint32_t nodeCount)
+    {
+        BenchmarkTree tree;
+        constexpr uint32_t balancedChildCount = 4u;
+        for (uint32_t i = 0u; i < nodeCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode(0u, {});
+            if (i > 0u)
+            {
+                uint32_t parentIdx = 0u;
+                if (shape == BenchmarkTreeShape::Balanced)
+                    parentIdx = (i - 1u) / balancedChildCount;
+                else if (shape == BenchmarkTreeShape::Chain)
+                    parentIdx = i - 1u;
+                scene.addChildToNode(tree.nodes[parentIdx], node);
+            }
+            tree.nodes.push_back(node);
+            tree.transforms.push_back(scene.allocateTransform(node, {}));
+            scene.setTranslation(tree.transforms.back(), { 0.f, 1.f, 0.f });
+        }
+        return tree;
+    }
+
+    static void BM_TransformationCachedScene_UpdateAfterRootChange(benchmark::State& state)
+    {
+        const auto shape = static_cast<BenchmarkTreeShape>(state.range(0));
+        const auto nodeCount = static_cast<uint32_t>(state.range(1));
+        TransformationCachedScene scene;
+        const BenchmarkTree tree = CreateTree(scene, shape, nodeCount);
+
+        std::vector<glm::mat4> matrices;
+        float angle = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            angle += 1.f;
+            scene.setRotation(tree.transforms.front(), { 0.f, angle, 0.f, 1.f }, ERotationType::Euler_XYZ);
+            scene.updateMatrixCaches(ETransformationMatrixType_World, tree.nodes, matrices);
+            benchmark::DoNotOptimize(matrices.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+
+    static void BM_TransformationCachedScene_UpdateAfterSparseChanges(benchmark::State& state)
+    {
+        const auto shape = static_cast<BenchmarkTreeShape>(state.range(0));
+        const auto nodeCount = static_cast<uint32_t>(state.range(1));
+        TransformationCachedScene scene;
+        const BenchmarkTree tree = CreateTree(scene, shape, nodeCount);
+
+        std::vector<glm::mat4> matrices;
+        float offset = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            // every 10th node is animated, as typical for scenes with few moving parts
+            offset += 1.f;
+            for (size_t i = 0u; i < tree.transforms.size(); i += 10u)
+                scene.setTranslation(tree.transforms[i], { offset, 1.f, 0.f });
+            scene.updateMatrixCaches(ETransformationMatrixType_World, tree.nodes, matrices);
+            benchmark::DoNotOptimize(matrices.data());
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+
+    static void BM_TransformationCachedScene_UpdateSingleNodes(benchmark::State& state)
+    {
+        const auto shape = static_cast<BenchmarkTreeShape>(state.range(0));
+        const auto nodeCount = static_cast<uint32_t>(state.range(1));
+        TransformationCachedScene scene;
+        const BenchmarkTree tree = CreateTree(scene, shape, nodeCount);
+
+        float angle = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            angle += 1.f;
+            scene.setRotation(tree.transforms.front(), { 0.f, angle, 0.f, 1.f }, ERotationType::Euler_XYZ);
+            for (const auto node : tree.nodes)
+                benchmark::DoNotOptimize(scene.updateMatrixCache(ETransformationMatrixType_World, node));
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * nodeCount);
+    }
+
+    // Measures updating world matrices of all nodes after root transformation changed, as done by renderer for every rendered frame after scene update
+    // ARGS: tree shape (0 flat, 1 balanced, 2 chain), number of nodes
+    BENCHMARK(BM_TransformationCachedScene_UpdateAfterRootChange)->ArgsProduct({ { 0, 1, 2 }, { 100, 1000, 10000 } });
+
+    // Measures updating world matrices of all nodes after every 10th node changed its translation
+    // ARGS: tree shape (0 flat, 1 balanced, 2 chain), number of nodes
+    BENCHMARK(BM_TransformationCachedScene_UpdateAfterSparseChanges)->ArgsProduct({ { 0, 1, 2 }, { 100, 1000, 10000 } });
+
+    // Measures updating world matrices node by node instead of in bulk, as done when only few renderables are queried
+    // ARGS: tree shape (0 flat, 1 balanced, 2 chain), number of nodes
+    BENCHMARK(BM_TransformationCachedScene_UpdateSingleNodes)->ArgsProduct({ { 0, 1, 2 }, { 100, 1000, 10000 } });
+}
@@ -0,0 +1,228 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/NodeBinding.h"
+#include "ramses/client/logic/AppearanceBinding.h"
+#include "ramses/client/logic/CameraBinding.h"
+#include "ramses/client/logic/SkinBinding.h"
+#include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/RenderGroupBinding.h"
+#include "ramses/client/logic/RenderGroupBindingElements.h"
+#include "fmt/format.h"
+
+namespace ramses
+{
+    static const Effect& CreateSkinningEffect(Scene& scene)
+    {
+        // not capable of vertex skinning, benchmarks only need the joint matrices uniform
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader(R"(
+            #version 100
+            uniform highp mat4 jointMat[32];
+            uniform highp vec4 color;
+            attribute vec3 a_position;
+            void main()
+            {
+                gl_Position = vec4(a_position, 1.0) * jointMat[0] * jointMat[31] + color;
+            })");
+        effectDesc.setFragmentShader(R"(
+            #version 100
+            void main(void)
+            {
+                gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+            })");
+        return *scene.createEffect(effectDesc);
+    }
+
+    static void BM_Update_NodeBindings(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto bindingCount = static_cast<std::size_t>(state.range(0));
+        std::vector<Property*> translations;
+        std::vector<Property*> rotations;
+        for (std::size_t i = 0; i < bindingCount; ++i)
+        {
+            auto* nodeBinding = logicEngine.createNodeBinding(*setup.m_scene.createNode(), ERotationType::Euler_XYZ, fmt::format("node{}", i));
+            translations.push_back(nodeBinding->getInputs()->getChild("translation"));
+            rotations.push_back(nodeBinding->getInputs()->getChild("rotation"));
+        }
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 1.f;
+            for (std::size_t i = 0; i < bindingCount; ++i)
+            {
+                translations[i]->set(vec3f{ value, 0.f, 0.f });
+                rotations[i]->set(vec3f{ 0.f, value, 0.f });
+            }
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of node bindings when all of them have their inputs changed
+    // ARG: number of node bindings
+    BENCHMARK(BM_Update_NodeBindings)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_AppearanceBindings(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto bindingCount = static_cast<std::size_t>(state.range(0));
+        const Effect& effect = CreateSkinningEffect(setup.m_scene);
+        std::vector<Property*> colors;
+        for (std::size_t i = 0; i < bindingCount; ++i)
+        {
+            auto* appearanceBinding = logicEngine.createAppearanceBinding(*setup.m_scene.createAppearance(effect), fmt::format("appearance{}", i));
+            colors.push_back(appearanceBinding->getInputs()->getChild("color"));
+        }
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 1.f;
+            for (auto* color : colors)
+                color->set(vec4f{ value, 0.f, 0.f, 1.f });
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of appearance bindings when all of them have a uniform changed
+    // ARG: number of appearance bindings
+    BENCHMARK(BM_Update_AppearanceBindings)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_SkinBinding(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        constexpr std::size_t jointCount = 32u;
+        const auto skinCount = static_cast<std::size_t>(state.range(0));
+        const Effect& effect = CreateSkinningEffect(setup.m_scene);
+
+        std::vector<const NodeBinding*> joints;
+        std::vector<Property*> jointRotations;
+        Node* parent = nullptr;
+        for (std::size_t i = 0; i < jointCount; ++i)
+        {
+            Node* jointNode = setup.m_scene.createNode();
+            if (parent)
+                parent->addChild(*jointNode);
+            parent = jointNode;
+            auto* nodeBinding = logicEngine.createNodeBinding(*jointNode, ERotationType::Euler_XYZ, fmt::format("joint{}", i));
+            joints.push_back(nodeBinding);
+            jointRotations.push_back(nodeBinding->getInputs()->getChild("rotation"));
+        }
+        const std::vector<matrix44f> inverseBindMatrices(jointCount, matrix44f{ 1.f });
+
+        for (std::size_t i = 0; i < skinCount; ++i)
+        {
+            Appearance* appearance = setup.m_scene.createAppearance(effect);
+            auto* appearanceBinding = logicEngine.createAppearanceBinding(*appearance);
+            const auto jointMatInput = appearance->getEffect().findUniformInput("jointMat");
+            if (!logicEngine.createSkinBinding(joints, inverseBindMatrices, *appearanceBinding, *jointMatInput, fmt::format("skin{}", i)))
+            {
+                state.SkipWithError("SkinBinding creation failed");
+                return;
+            }
+        }
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 1.f;
+            for (auto* rotation : jointRotations)
+                rotation->set(vec3f{ value, 0.f, 0.f });
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of skin bindings sharing a joint hierarchy of 32 joints which all change every update
+    // ARG: number of skin bindings
+    BENCHMARK(BM_Update_SkinBinding)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_AnchorPoints(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto anchorCount = static_cast<std::size_t>(state.range(0));
+        auto* camera = setup.m_scene.createPerspectiveCamera();
+        camera->setFrustum(30.f, 1.f, 0.1f, 100.f);
+        camera->setViewport(0, 0, 1920u, 1080u);
+        auto* cameraBinding = logicEngine.createCameraBinding(*camera);
+        auto* cameraViewportOffset = cameraBinding->getInputs()->getChild("viewport")->getChild("offsetX");
+
+        std::vector<Property*> translations;
+        for (std::size_t i = 0; i < anchorCount; ++i)
+        {
+            auto* nodeBinding = logicEngine.createNodeBinding(*setup.m_scene.createNode());
+            translations.push_back(nodeBinding->getInputs()->getChild("translation"));
+            logicEngine.createAnchorPoint(*nodeBinding, *cameraBinding, fmt::format("anchor{}", i));
+        }
+
+        int32_t value = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            ++value;
+            cameraViewportOffset->set(value % 100);
+            for (auto* translation : translations)
+                translation->set(vec3f{ 0.f, static_cast<float>(value % 10), -10.f });
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of anchor points sharing a single camera, both camera and anchor nodes change every update
+    // ARG: number of anchor points
+    BENCHMARK(BM_Update_AnchorPoints)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    static void BM_Update_RenderGroupBinding(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const auto elementCount = static_cast<std::size_t>(state.range(0));
+        auto* renderGroup = setup.m_scene.createRenderGroup();
+        RenderGroupBindingElements elements;
+        for (std::size_t i = 0; i < elementCount; ++i)
+        {
+            auto* meshNode = setup.m_scene.createMeshNode(fmt::format("mesh{}", i));
+            renderGroup->addMeshNode(*meshNode, static_cast<int32_t>(i));
+            elements.addElement(*meshNode);
+        }
+        auto* renderGroupBinding = logicEngine.createRenderGroupBinding(*renderGroup, elements);
+        auto* renderOrders = renderGroupBinding->getInputs()->getChild("renderOrders");
+
+        int32_t value = 0;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            ++value;
+            // reverse order of all elements every other update
+            for (std::size_t i = 0; i < elementCount; ++i)
+            {
+                const auto order = static_cast<int32_t>((value % 2 == 0) ? i : elementCount - i);
+                renderOrders->getChild(i)->set(order);
+            }
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of render group binding when render order of all its elements changes
+    // ARG: number of elements in render group
+    BENCHMARK(BM_Update_RenderGroupBinding)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+}
@@ -15,13 +15,15 @@
 
 namespace ramses
 {
-    static void Run(benchmark::State& state, const std::string& src)
+    static void Run(benchmark::State& state, const std::string& src, bool trustedNumericConversions = false)
     {
         BenchmarkSetUp setup;
         auto& logicEngine = setup.m_logicEngine;
 
         LuaConfig config;
         config.addStandardModuleDependency(EStandardModule::Base);
+        if (trustedNumericConversions)
+            config.enableTrustedNumericConversions();
 
         logicEngine.createLuaScript(src, config);
         logicEngine.impl().disableTrackingDirtyNodes();
@@ -129,6 +131,27 @@ namespace ramses
         Run(state, scriptSrc);
     }
 
+    static void BM_GetSetPropertyVec(benchmark::State& state)
+    {
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.vec3f = Type:Vec3f()
+                IN.vec4i = Type:Vec4i()
+                OUT.vec3f = Type:Vec3f()
+                OUT.vec4i = Type:Vec4i()
+            end
+            function run(IN,OUT)
+                for i = 0,1000,1 do
+                    local v = IN.vec3f
+                    OUT.vec3f = { v[1] + i, v[2], v[3] }
+                    local w = IN.vec4i
+                    OUT.vec4i = { w[1] + i, w[2], w[3], w[4] }
+                end
+            end
+        )";
+        Run(state, scriptSrc, state.range(0) != 0);
+    }
+
     struct Userdata
     {
         inline static const char* const name = "Userdata";
@@ -401,6 +424,9 @@ namespace ramses
     BENCHMARK(BM_GetPropertyGlobal)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetProperty)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetPropertyNested)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
+    // Reads vector components and assigns vector tables to outputs
+    // ARG: 1 with trusted numeric conversions, 0 without
+    BENCHMARK(BM_GetSetPropertyVec)->Arg(0)->Arg(1)->Unit(benchmark::TimeUnit::kMillisecond);
     // for comparison: Simple userdata with pure sol
     BENCHMARK(BM_GetSolUserdataIndex)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetSolUserdataBind)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
@@ -0,0 +1,227 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "ramses/client/SceneObjectIterator.h"
+#include "ramses/client/logic/LuaScript.h"
+#include "ramses/client/logic/LuaInterface.h"
+#include "ramses/client/logic/LuaModule.h"
+#include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/NodeBinding.h"
+#include "ramses/client/logic/CameraBinding.h"
+#include "ramses/client/logic/AnchorPoint.h"
+#include "ramses/client/logic/TimerNode.h"
+#include "ramses/client/logic/AnimationNode.h"
+#include "ramses/client/logic/AnimationNodeConfig.h"
+#include "ramses/client/logic/AnimationTypes.h"
+#include "impl/RamsesLoggerImpl.h"
+#include "fmt/format.h"
+#include <filesystem>
+#include <tuple>
+
+namespace ramses
+{
+    const std::string_view leafScriptSrc = R"(
+        modules("helpers")
+        function interface(IN,OUT)
+            IN.time = Type:Float()
+            IN.offset = Type:Float()
+            OUT.translation = Type:Vec3f()
+            OUT.rotation = Type:Vec3f()
+        end
+        function run(IN,OUT)
+            OUT.translation = helpers.wave(IN.time, IN.offset)
+            OUT.rotation = { 0, IN.time * 10 + IN.offset, 0 }
+        end
+    )";
+
+    const std::string_view helpersModuleSrc = R"(
+        local helpers = {}
+        function helpers.wave(time, offset)
+            return { math.sin(time + offset), math.cos(time + offset), offset }
+        end
+        return helpers
+    )";
+
+    // Creates graph of an interface driving given number of scripts, each of them controlling a node,
+    // making 2 * leafCount + 1 logic nodes and 2 * leafCount links in total
+    static std::vector<LuaScript*> CreateLargeGraph(Scene& scene, LogicEngine& logicEngine, std::size_t leafCount, Property*& timeInput)
+    {
+        LuaConfig moduleConfig;
+        moduleConfig.addStandardModuleDependency(EStandardModule::Math);
+        auto* helpers = logicEngine.createLuaModule(helpersModuleSrc, moduleConfig, "helpers");
+
+        LuaConfig scriptConfig;
+        scriptConfig.addDependency("helpers", *helpers);
+
+        auto* intf = logicEngine.createLuaInterface(R"(
+            function interface(inout)
+                inout.time = Type:Float()
+            end
+        )", "timeInterface");
+        timeInput = intf->getInputs()->getChild("time");
+        Property* timeOutput = intf->getOutputs()->getChild("time");
+
+        std::vector<LuaScript*> scripts;
+        scripts.reserve(leafCount);
+        for (std::size_t i = 0; i < leafCount; ++i)
+        {
+            auto* script = logicEngine.createLuaScript(leafScriptSrc, scriptConfig, fmt::format("leaf{}", i));
+            script->getInputs()->getChild("offset")->set(static_cast<float>(i));
+            auto* nodeBinding = logicEngine.createNodeBinding(*scene.createNode(), ERotationType::Euler_XYZ, fmt::format("node{}", i));
+            logicEngine.link(*timeOutput, *script->getInputs()->getChild("time"));
+            logicEngine.link(*script->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation"));
+            logicEngine.link(*script->getOutputs()->getChild("rotation"), *nodeBinding->getInputs()->getChild("rotation"));
+            scripts.push_back(script);
+        }
+
+        return scripts;
+    }
+
+    static void BM_Update_LargeGraph_AllDirty(benchmark::State& state)
+    {
+        ramses::internal::GetRamsesLogger().setConsoleLogLevel(ELogLevel::Off);
+
+        BenchmarkSetUp setup;
+        Property* timeInput = nullptr;
+        std::ignore = CreateLargeGraph(setup.m_scene, setup.m_logicEngine, static_cast<std::size_t>(state.range(0)), timeInput);
+
+        float time = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            time += 0.016f;
+            timeInput->set(time);
+            if (!setup.m_logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures update of large graph where every node has to be updated
+    // ARG: number of scripts (each linked to a node binding)
+    BENCHMARK(BM_Update_LargeGraph_AllDirty)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    static void BM_Update_LargeGraph_SingleDirty(benchmark::State& state)
+    {
+        ramses::internal::GetRamsesLogger().setConsoleLogLevel(ELogLevel::Off);
+
+        BenchmarkSetUp setup;
+        Property* timeInput = nullptr;
+        const auto scripts = CreateLargeGraph(setup.m_scene, setup.m_logicEngine, static_cast<std::size_t>(state.range(0)), timeInput);
+        if (!setup.m_logicEngine.update())
+            state.SkipWithError("failure running update()");
+
+        Property* offsetInput = scripts[scripts.size() / 2]->getInputs()->getChild("offset");
+        float offset = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            offset += 1.f;
+            offsetInput->set(offset);
+            if (!setup.m_logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    // Measures overhead of large graph when only single script and its node binding have to be updated
+    // ARG: number of scripts (each linked to a node binding)
+    BENCHMARK(BM_Update_LargeGraph_SingleDirty)->Arg(1000)->Arg(5000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+    // Creates and saves scene resembling exported content - timer driven animations, scripts using a module,
+    // node bindings and anchor points of a camera
+    static void CreateLargeSceneFile(std::string_view fileName, std::size_t leafCount)
+    {
+        BenchmarkSetUp setup;
+        auto& scene = setup.m_scene;
+        auto& logicEngine = setup.m_logicEngine;
+
+        Property* timeInput = nullptr;
+        std::ignore = CreateLargeGraph(scene, logicEngine, leafCount, timeInput);
+
+        // timer drives time of graph and progress of animations
+        auto* timer = logicEngine.createTimerNode("timer");
+        auto* timeScript = logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.ticker_us = Type:Int64()
+                OUT.time = Type:Float()
+                OUT.progress = Type:Float()
+            end
+            function init()
+                GLOBAL.startTicker = 0
+            end
+            function run(IN,OUT)
+                if GLOBAL.startTicker == 0 then
+                    GLOBAL.startTicker = IN.ticker_us
+                end
+                local elapsed = (IN.ticker_us - GLOBAL.startTicker) / 1000000
+                OUT.time = elapsed
+                OUT.progress = (elapsed % 2) / 2
+            end
+        )", {}, "timeScript");
+        logicEngine.link(*timer->getOutputs()->getChild("ticker_us"), *timeScript->getInputs()->getChild("ticker_us"));
+        logicEngine.link(*timeScript->getOutputs()->getChild("time"), *timeInput);
+
+        const auto* timestamps = logicEngine.createDataArray(std::vector<float>{ 0.f, 0.5f, 1.f });
+        const auto* keyframes = logicEngine.createDataArray(std::vector<vec3f>{ {0.f, 0.f, 0.f}, {0.f, 180.f, 0.f}, {0.f, 360.f, 0.f} });
+        AnimationNodeConfig animConfig;
+        animConfig.addChannel({ "rotation", timestamps, keyframes, EInterpolationType::Linear });
+
+        auto* camera = scene.createPerspectiveCamera("camera");
+        camera->setFrustum(30.f, 1.f, 0.1f, 100.f);
+        camera->setViewport(0, 0, 1920u, 1080u);
+        auto* cameraBinding = logicEngine.createCameraBinding(*camera, "camera");
+
+        constexpr std::size_t animatedNodesRatio = 10u;
+        for (std::size_t i = 0; i < leafCount / animatedNodesRatio; ++i)
+        {
+            auto* animation = logicEngine.createAnimationNode(animConfig, fmt::format("animation{}", i));
+            auto* nodeBinding = logicEngine.createNodeBinding(*scene.createNode(), ERotationType::Euler_XYZ, fmt::format("animatedNode{}", i));
+            logicEngine.link(*timeScript->getOutputs()->getChild("progress"), *animation->getInputs()->getChild("progress"));
+            logicEngine.link(*animation->getOutputs()->getChild("rotation"), *nodeBinding->getInputs()->getChild("rotation"));
+            logicEngine.createAnchorPoint(*nodeBinding, *cameraBinding, fmt::format("anchor{}", i));
+        }
+
+        if (!logicEngine.update() || !scene.saveToFile(fileName, {}))
+            std::abort();
+    }
+
+    static void BM_LoadLargeSceneFileAndUpdate(benchmark::State& state, const std::filesystem::path& outputDirectory)
+    {
+        ramses::internal::GetRamsesLogger().setConsoleLogLevel(ELogLevel::Off);
+
+        const std::string fileName = (outputDirectory / "largeLogicScene.ramses").string();
+        CreateLargeSceneFile(fileName, static_cast<std::size_t>(state.range(0)));
+
+        RamsesFramework framework{ RamsesFrameworkConfig{ EFeatureLevel_Latest } };
+        RamsesClient& client = *framework.createClient("benchmarkClient");
+        constexpr int updateCount = 1000;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            Scene* scene = client.loadSceneFromFile(fileName);
+            RamsesObject* logicEngineObject = (scene ? SceneObjectIterator{ *scene, ERamsesObjectType::LogicEngine }.getNext() : nullptr);
+            auto* logicEngine = (logicEngineObject ? logicEngineObject->as<LogicEngine>() : nullptr);
+            if (!logicEngine)
+            {
+                state.SkipWithError("failed to load scene");
+                break;
+            }
+            for (int i = 0; i < updateCount; ++i)
+            {
+                if (!logicEngine->update())
+                    state.SkipWithError("failure running update()");
+            }
+            client.destroy(*scene);
+        }
+
+        std::error_code ec;
+        std::filesystem::remove(fileName, ec);
+    }
+
+    // Macro benchmark loading generated scene resembling exported content and running 1000 updates on it,
+    // scene file is written to given directory and removed afterwards
+    // ARG: number of scripts driving node bindings, additional 10% of nodes are animated and have anchor points
+    BENCHMARK_CAPTURE(BM_LoadLargeSceneFileAndUpdate, tempDirectory, std::filesystem::temp_directory_path())->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond)->Iterations(3);
+}
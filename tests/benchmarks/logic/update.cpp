@@ -200,6 +200,41 @@ namespace ramses
     }
 
     BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
+
+    static void BM_Update_TrivialScripts(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        auto& logicEngine = setup.m_logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function init()
+                GLOBAL.offset = 1
+            end
+            function interface(IN,OUT)
+                IN.param = Type:Int32()
+                OUT.param = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.param = IN.param + GLOBAL.offset
+            end
+        )";
+
+        for (int64_t i = 0; i < scriptCount; ++i)
+            logicEngine.createLuaScript(scriptSrc, {}, fmt::format("script{}", i));
+
+        logicEngine.impl().disableTrackingDirtyNodes();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.update();
+        }
+    }
+
+    // Measures fixed per-script cost of update() (calling run(), environment protection), the scripts themselves do almost nothing
+    // Dirty handling: off
+    // ARG: number of scripts
+    BENCHMARK(BM_Update_TrivialScripts)->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
 }
 
 
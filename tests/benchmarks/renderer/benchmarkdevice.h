@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/RendererLib/PlatformInterface/IDevice.h"
+
+namespace ramses::internal
+{
+    // Device which does nothing, so that benchmarks measure renderer logic only: neither GPU work nor (unlike DeviceMock)
+    // call recording and expectation matching contribute to the results, a device call costs just the virtual call.
+    // All allocations succeed and return the same handle.
+    class BenchmarkDevice final : public IDevice
+    {
+    public:
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const float* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::vec4* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const bool* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const int32_t* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::ivec4* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat2* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat3* /*value*/) override { return true; }
+        bool setConstant(DataFieldHandle /*field*/, uint32_t /*count*/, const glm::mat4* /*value*/) override { return true; }
+
+        void clear(ClearFlags /*clearFlags*/) override {}
+        void drawIndexedTriangles(int32_t /*startOffset*/, int32_t /*elementCount*/, uint32_t /*instanceCount*/) override {}
+        void drawTriangles(int32_t /*startOffset*/, int32_t /*elementCount*/, uint32_t /*instanceCount*/) override {}
+        void flush() override {}
+        DeviceFence insertFence() override { return {}; }
+        void waitFence(DeviceFence /*fence*/) override {}
+
+        void colorMask(bool /*r*/, bool /*g*/, bool /*b*/, bool /*a*/) override {}
+        void clearColor(const glm::vec4& /*clearColor*/) override {}
+        void clearDepth(float /*d*/) override {}
+        void clearStencil(int32_t /*s*/) override {}
+        void blendFactors(EBlendFactor /*sourceColor*/, EBlendFactor /*destinationColor*/, EBlendFactor /*sourceAlpha*/, EBlendFactor /*destinationAlpha*/) override {}
+        void blendOperations(EBlendOperation /*operationColor*/, EBlendOperation /*operationAlpha*/) override {}
+        void blendColor(const glm::vec4& /*color*/) override {}
+        void cullMode(ECullMode /*mode*/) override {}
+        void depthFunc(EDepthFunc /*func*/) override {}
+        void depthWrite(EDepthWrite /*flag*/) override {}
+        void scissorTest(EScissorTest /*flag*/, const RenderState::ScissorRegion& /*region*/) override {}
+        void stencilFunc(EStencilFunc /*func*/, uint8_t /*ref*/, uint8_t /*mask*/) override {}
+        void stencilOp(EStencilOp /*sfail*/, EStencilOp /*dpfail*/, EStencilOp /*dppass*/) override {}
+        void drawMode(EDrawMode /*mode*/) override {}
+        void setViewport(int32_t /*x*/, int32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+
+        DeviceResourceHandle allocateUniformBuffer(uint32_t /*totalSizeInBytes*/) override { return FakeDeviceHandle; }
+        void uploadUniformBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void activateUniformBuffer(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/) override {}
+        void deleteUniformBuffer(DeviceResourceHandle /*handle*/) override {}
+        DeviceResourceHandle allocateStreamingUniformBuffer(uint32_t /*totalSizeInBytes*/) override { return FakeDeviceHandle; }
+
+        DeviceResourceHandle allocateVertexBuffer(uint32_t /*totalSizeInBytes*/, EDeviceBufferUsage /*usage*/) override { return FakeDeviceHandle; }
+        void uploadVertexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void uploadVertexBufferSubData(DeviceResourceHandle /*handle*/, uint32_t /*offsetInBytes*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void deleteVertexBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateIndexBuffer(EDataType /*dataType*/, uint32_t /*sizeInBytes*/, EDeviceBufferUsage /*usage*/) override { return FakeDeviceHandle; }
+        void uploadIndexBufferData(DeviceResourceHandle /*handle*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void uploadIndexBufferSubData(DeviceResourceHandle /*handle*/, uint32_t /*offsetInBytes*/, const std::byte* /*data*/, uint32_t /*dataSize*/) override {}
+        void deleteIndexBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateVertexArray(const VertexArrayInfo& /*vertexArrayInfo*/) override { return FakeDeviceHandle; }
+        void activateVertexArray(DeviceResourceHandle /*handle*/) override {}
+        void deleteVertexArray(DeviceResourceHandle /*handle*/) override {}
+
+        std::unique_ptr<const GPUResource> uploadShader(const EffectResource& /*effect*/) override { return {}; }
+        std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& /*effects*/) override { return {}; }
+        DeviceResourceHandle registerShader(std::unique_ptr<const GPUResource> /*shaderResource*/) override { return FakeDeviceHandle; }
+        DeviceResourceHandle uploadBinaryShader(const EffectResource& /*effect*/, const std::byte* /*binaryShaderData*/, uint32_t /*binaryShaderDataSize*/, BinaryShaderFormatID /*binaryShaderFormat*/) override { return FakeDeviceHandle; }
+        bool getBinaryShader(DeviceResourceHandle /*handle*/, std::vector<std::byte>& /*binaryShader*/, BinaryShaderFormatID& /*binaryShaderFormat*/) override { return false; }
+        void deleteShader(DeviceResourceHandle /*handle*/) override {}
+        void activateShader(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle allocateTexture2D(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return FakeDeviceHandle; }
+        DeviceResourceHandle allocateTexture3D(uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, EPixelStorageFormat /*textureFormat*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return FakeDeviceHandle; }
+        DeviceResourceHandle allocateTextureCube(uint32_t /*faceSize*/, EPixelStorageFormat /*textureFormat*/, const TextureSwizzleArray& /*swizzle*/, uint32_t /*mipLevelCount*/, uint32_t /*totalSizeInBytes*/) override { return FakeDeviceHandle; }
+        DeviceResourceHandle allocateExternalTexture() override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getEmptyExternalTexture() const override { return FakeDeviceHandle; }
+
+        void bindTexture(DeviceResourceHandle /*handle*/) override {}
+        void generateMipmaps(DeviceResourceHandle /*handle*/) override {}
+        void uploadTextureData(DeviceResourceHandle /*handle*/, uint32_t /*mipLevel*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*z*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*depth*/, const std::byte* /*data*/, uint32_t /*dataSize*/, uint32_t /*stride*/) override {}
+        DeviceResourceHandle uploadStreamTexture2D(DeviceResourceHandle /*handle*/, uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, const std::byte* /*data*/, const TextureSwizzleArray& /*swizzle*/) override { return FakeDeviceHandle; }
+        void deleteTexture(DeviceResourceHandle /*handle*/) override {}
+        std::unique_ptr<const GPUResource> extractTexture(DeviceResourceHandle /*handle*/) override { return {}; }
+        DeviceResourceHandle registerTexture(std::unique_ptr<const GPUResource> /*textureResource*/) override { return FakeDeviceHandle; }
+        void activateTexture(DeviceResourceHandle /*handle*/, DataFieldHandle /*field*/) override {}
+        [[nodiscard]] uint32_t getTextureAddress(DeviceResourceHandle /*handle*/) const override { return 0u; }
+
+        DeviceResourceHandle uploadRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, EPixelStorageFormat /*format*/, ERenderBufferAccessMode /*accessMode*/, uint32_t /*sampleCount*/) override { return FakeDeviceHandle; }
+        void deleteRenderBuffer(DeviceResourceHandle /*handle*/) override {}
+
+        DeviceResourceHandle uploadDmaRenderBuffer(uint32_t /*width*/, uint32_t /*height*/, DmaBufferFourccFormat /*fourccFormat*/, DmaBufferUsageFlags /*usageFlags*/, DmaBufferModifiers /*modifiers*/) override { return FakeDeviceHandle; }
+        int getDmaRenderBufferFD(DeviceResourceHandle /*handle*/) override { return -1; }
+        uint32_t getDmaRenderBufferStride(DeviceResourceHandle /*handle*/) override { return 0u; }
+        int createDmaRenderBufferSyncFence(DeviceResourceHandle /*handle*/) override { return -1; }
+        void destroyDmaRenderBuffer(DeviceResourceHandle /*handle*/) override {}
+        bool importDmaBufferToExternalTexture(DeviceResourceHandle /*handle*/, const DmaBufferFrame& /*frame*/, int& /*releaseFenceFD*/) override { return false; }
+        int releaseDmaBufferOfExternalTexture(DeviceResourceHandle /*handle*/) override { return -1; }
+
+        void activateTextureSamplerObject(const TextureSamplerStates& /*samplerStates*/, DataFieldHandle /*field*/) override {}
+
+        [[nodiscard]] DeviceResourceHandle getFramebufferRenderTarget() const override { return FakeDeviceHandle; }
+        DeviceResourceHandle uploadRenderTarget(const DeviceHandleVector& /*renderBuffers*/) override { return FakeDeviceHandle; }
+        void activateRenderTarget(DeviceResourceHandle /*handle*/) override {}
+        void deleteRenderTarget(DeviceResourceHandle /*handle*/) override {}
+        void discardDepthStencil() override {}
+        void discardColorBuffers() override {}
+
+        void pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>& /*renderTargets*/, const std::array<DeviceResourceHandle, 2>& /*colorBuffers*/) override {}
+        void unpairRenderTargets(DeviceResourceHandle /*renderTarget*/) override {}
+        void swapDoubleBufferedRenderTarget(DeviceResourceHandle /*renderTarget*/) override {}
+
+        void blitRenderTargets(DeviceResourceHandle /*rtSrc*/, DeviceResourceHandle /*rtDst*/, const PixelRectangle& /*srcRect*/, const PixelRectangle& /*dstRect*/, bool /*colorOnly*/) override {}
+
+        void readPixels(uint8_t* /*buffer*/, uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override {}
+        DeviceResourceHandle startReadPixels(uint32_t /*x*/, uint32_t /*y*/, uint32_t /*width*/, uint32_t /*height*/) override { return FakeDeviceHandle; }
+        bool finishReadPixels(DeviceResourceHandle /*handle*/, std::vector<uint8_t>& /*dataOut*/) override { return false; }
+        void deleteReadPixels(DeviceResourceHandle /*handle*/) override {}
+
+        [[nodiscard]] uint32_t getTotalGpuMemoryUsageInKB() const override { return 0u; }
+        uint32_t getAndResetDrawCallCount() override { return 0u; }
+        void invalidateStateCache() override {}
+
+        bool beginGpuTimerQuery(uint64_t /*queryId*/) override { return false; }
+        void endGpuTimerQuery() override {}
+        void collectGpuTimerQueryResults(std::vector<GpuTimerQueryResult>& /*results*/) override {}
+        void deleteGpuTimerQueries(uint64_t /*queryId*/) override {}
+
+        void validateDeviceStatusHealthy() const override {}
+        [[nodiscard]] bool isDeviceStatusHealthy() const override { return true; }
+        void getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>& /*formats*/) const override {}
+        [[nodiscard]] bool isExternalTextureExtensionSupported() const override { return false; }
+
+        [[nodiscard]] uint32_t getGPUHandle(DeviceResourceHandle /*deviceHandle*/) const override { return 0u; }
+
+        static constexpr DeviceResourceHandle FakeDeviceHandle{ 1u };
+    };
+}
@@ -0,0 +1,114 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
+
+namespace ramses::internal
+{
+    BenchmarkSceneContent BenchmarkSetUp::CreateRenderables(IScene& scene, uint32_t renderableCount)
+    {
+        BenchmarkSceneContent content;
+
+        const DataLayoutHandle cameraLayout = scene.allocateDataLayout(DataFieldInfoVector(4u, DataFieldInfo{ EDataType::DataReference }), {}, {});
+        const DataInstanceHandle cameraData = scene.allocateDataInstance(cameraLayout, {});
+        const DataLayoutHandle vec2iLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2I } }, {}, {});
+        const DataLayoutHandle vec2fLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2F } }, {}, {});
+        const DataLayoutHandle vec4fLayout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F } }, {}, {});
+        const DataInstanceHandle viewportOffset = scene.allocateDataInstance(vec2iLayout, {});
+        const DataInstanceHandle viewportSize = scene.allocateDataInstance(vec2iLayout, {});
+        const DataInstanceHandle frustumPlanes = scene.allocateDataInstance(vec4fLayout, {});
+        const DataInstanceHandle frustumNearFar = scene.allocateDataInstance(vec2fLayout, {});
+        scene.setDataReference(cameraData, Camera::ViewportOffsetField, viewportOffset);
+        scene.setDataReference(cameraData, Camera::ViewportSizeField, viewportSize);
+        scene.setDataReference(cameraData, Camera::FrustumPlanesField, frustumPlanes);
+        scene.setDataReference(cameraData, Camera::FrustumNearFarPlanesField, frustumNearFar);
+        scene.setDataSingleVector2i(viewportOffset, DataFieldHandle{ 0u }, { 0, 0 });
+        scene.setDataSingleVector2i(viewportSize, DataFieldHandle{ 0u }, { 1280, 480 });
+        scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0u }, { -1.f, 1.f, -1.f, 1.f });
+        scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0u }, { 0.1f, 100.f });
+        const NodeHandle cameraNode = scene.allocateNode(0u, {});
+        scene.allocateTransform(cameraNode, {});
+        const CameraHandle camera = scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, cameraData, {});
+
+        const RenderGroupHandle renderGroup = scene.allocateRenderGroup(renderableCount, 0u, {});
+        content.renderPass = scene.allocateRenderPass(1u, {});
+        scene.setRenderPassCamera(content.renderPass, camera);
+        scene.addRenderGroupToRenderPass(content.renderPass, renderGroup, 0);
+
+        const DataFieldInfoVector uniformFields{
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelViewProjectionMatrix },
+            DataFieldInfo{ EDataType::Vector4F } };
+        const DataLayoutHandle uniformLayout = scene.allocateDataLayout(uniformFields, EffectHash, {});
+        const DataFieldInfoVector geometryFields{
+            DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+            DataFieldInfo{ EDataType::Vector3Buffer } };
+        const DataLayoutHandle geometryLayout = scene.allocateDataLayout(geometryFields, EffectHash, {});
+        const RenderStateHandle renderState = scene.allocateRenderState({});
+
+        content.nodes.reserve(renderableCount);
+        content.transforms.reserve(renderableCount);
+        content.renderables.reserve(renderableCount);
+        content.uniformInstances.reserve(renderableCount);
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+        {
+            const NodeHandle node = scene.allocateNode(0u, {});
+            const TransformHandle transform = scene.allocateTransform(node, {});
+            scene.setTranslation(transform, { static_cast<float>(i % 10u) - 5.f, static_cast<float>(i / 10u % 10u) - 5.f, -10.f });
+
+            const DataInstanceHandle uniforms = scene.allocateDataInstance(uniformLayout, {});
+            scene.setDataSingleVector4f(uniforms, ColorField, { 1.f, 0.f, 0.f, 1.f });
+            const DataInstanceHandle geometry = scene.allocateDataInstance(geometryLayout, {});
+            scene.setDataResource(geometry, DataFieldHandle{ 0u }, IndexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+            scene.setDataResource(geometry, DataFieldHandle{ 1u }, VertexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+
+            const RenderableHandle renderable = scene.allocateRenderable(node, {});
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            scene.setRenderableRenderState(renderable, renderState);
+            scene.setRenderableIndexCount(renderable, 36u);
+            scene.addRenderableToRenderGroup(renderGroup, renderable, static_cast<int32_t>(i));
+
+            content.nodes.push_back(node);
+            content.transforms.push_back(transform);
+            content.renderables.push_back(renderable);
+            content.uniformInstances.push_back(uniforms);
+        }
+
+        return content;
+    }
+
+    RendererCachedScene& BenchmarkSetUp::createRendererScene(const ActionCollectingScene& stagingScene)
+    {
+        RendererCachedScene& scene = m_rendererScenes.createScene(SceneInfo{ stagingScene.getSceneId() });
+        scene.preallocateSceneSize(stagingScene.getSceneSizeInformation());
+        SceneActionApplier::ApplyActionsOnScene(scene, stagingScene.getSceneActionCollection(), EFeatureLevel_Latest);
+        updateSceneCaches(scene);
+
+        return scene;
+    }
+
+    void BenchmarkSetUp::updateSceneCaches(RendererCachedScene& scene)
+    {
+        scene.updateRenderablesAndResourceCache(m_resourceAccessor);
+        if (scene.hasDirtyVertexArrays())
+        {
+            RenderableVector renderablesWithUpdatedVertexArrays;
+            const auto& vertexArraysDirtinessFlags = scene.getVertexArraysDirtinessFlags();
+            for (RenderableHandle renderable(0u); renderable < scene.getRenderableCount(); ++renderable)
+            {
+                if (vertexArraysDirtinessFlags[renderable.asMemoryHandle()] && scene.isRenderableAllocated(renderable))
+                    renderablesWithUpdatedVertexArrays.push_back(renderable);
+            }
+            scene.updateRenderableVertexArrays(m_resourceAccessor, renderablesWithUpdatedVertexArrays);
+            scene.markVertexArraysClean();
+        }
+        scene.updateRenderableWorldMatrices();
+    }
+}
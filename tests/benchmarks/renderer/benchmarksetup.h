@@ -0,0 +1,87 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "benchmark/benchmark.h"
+#include "internal/RendererLib/IResourceDeviceHandleAccessor.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/SceneGraph/Scene/ActionCollectingScene.h"
+#include "benchmarkdevice.h"
+
+#include <vector>
+
+namespace ramses::internal
+{
+    // Reports every resource as uploaded, so that all renderables of a benchmark scene are rendered
+    class BenchmarkResourceAccessor final : public IResourceDeviceHandleAccessor
+    {
+    public:
+        [[nodiscard]] DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& /*resourceHash*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle /*targetHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle /*bufferHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        void getBlitPassRenderTargetsDeviceHandle(BlitPassHandle /*blitPassHandle*/, SceneId /*sceneId*/, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const override
+        {
+            srcRT = FakeDeviceHandle;
+            dstRT = FakeDeviceHandle;
+        }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferColorBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] int getDmaOffscreenBufferFD(OffscreenBufferHandle /*bufferHandle*/) const override { return -1; }
+        [[nodiscard]] uint32_t getDmaOffscreenBufferStride(OffscreenBufferHandle /*bufferHandle*/) const override { return 0u; }
+        [[nodiscard]] OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle /*bufferDeviceHandle*/) const override { return OffscreenBufferHandle::Invalid(); }
+        [[nodiscard]] DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle /*bufferHandle*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getExternalBufferDeviceHandle(ExternalBufferHandle /*bufferHandle*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getEmptyExternalBufferDeviceHandle() const override { return FakeDeviceHandle; }
+        [[nodiscard]] uint32_t getExternalBufferGlId(ExternalBufferHandle /*externalTexHandle*/) const override { return 0u; }
+        [[nodiscard]] DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle /*dataBufferHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle /*textureBufferHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle /*renderableHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getUniformBufferDeviceHandle(UniformBufferHandle /*uniformBufferHandle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+        [[nodiscard]] DeviceResourceHandle getUniformBufferDeviceHandle(SemanticUniformBufferHandle /*handle*/, SceneId /*sceneId*/) const override { return FakeDeviceHandle; }
+
+        static constexpr DeviceResourceHandle FakeDeviceHandle = BenchmarkDevice::FakeDeviceHandle;
+    };
+
+    // Handles of benchmark scene content which benchmarks modify between iterations
+    struct BenchmarkSceneContent
+    {
+        RenderPassHandle renderPass;
+        std::vector<NodeHandle> nodes;
+        std::vector<TransformHandle> transforms;
+        std::vector<RenderableHandle> renderables;
+        std::vector<DataInstanceHandle> uniformInstances;
+    };
+
+    class BenchmarkSetUp
+    {
+    public:
+        // Creates renderables (each with own node, transform and data instances) rendered by single render pass,
+        // content resembles scene created by client from meshes sharing an effect and geometry
+        static BenchmarkSceneContent CreateRenderables(IScene& scene, uint32_t renderableCount);
+
+        // Creates renderer scene the same way as renderer does when receiving initial flush of given staging scene,
+        // i.e. size preallocated and all actions applied, then updates its caches as for rendering a frame
+        RendererCachedScene& createRendererScene(const ActionCollectingScene& stagingScene);
+        void updateSceneCaches(RendererCachedScene& scene);
+
+        RendererEventCollector m_rendererEventCollector;
+        RendererScenes m_rendererScenes{ m_rendererEventCollector };
+        // device calls are not executed but the executor logic and scene caches are, results are useful for comparing renderer versions
+        BenchmarkDevice m_device;
+        BenchmarkResourceAccessor m_resourceAccessor;
+
+        static constexpr ResourceContentHash EffectHash{ 0x11u, 0u };
+        static constexpr ResourceContentHash IndexArrayHash{ 0x12u, 0u };
+        static constexpr ResourceContentHash VertexArrayHash{ 0x13u, 0u };
+        static constexpr DataFieldHandle MvpField{ 0u };
+        static constexpr DataFieldHandle ColorField{ 1u };
+    };
+}
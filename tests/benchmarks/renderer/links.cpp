@@ -0,0 +1,104 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "internal/RendererLib/SceneLinksManager.h"
+#include "internal/RendererLib/DataReferenceLinkManager.h"
+#include "internal/SceneGraph/SceneAPI/DataSlot.h"
+
+namespace ramses::internal
+{
+    static constexpr SceneId ProviderSceneId{ 1u };
+    static constexpr SceneId ConsumerSceneId{ 2u };
+
+    static void BM_Links_ResolveDataLinks(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto linkCount = static_cast<uint32_t>(state.range(0));
+
+        RendererCachedScene& providerScene = setup.m_rendererScenes.createScene(SceneInfo{ ProviderSceneId });
+        RendererCachedScene& consumerScene = setup.m_rendererScenes.createScene(SceneInfo{ ConsumerSceneId });
+        const DataLayoutHandle providerLayout = providerScene.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, {}, {});
+        const DataLayoutHandle consumerLayout = consumerScene.allocateDataLayout({ DataFieldInfo{ EDataType::Float } }, {}, {});
+
+        SceneLinksManager& linksManager = setup.m_rendererScenes.getSceneLinksManager();
+        std::vector<DataInstanceHandle> providerDataRefs;
+        providerDataRefs.reserve(linkCount);
+        for (uint32_t i = 0u; i < linkCount; ++i)
+        {
+            const DataSlotId slotId{ i + 1u };
+            const DataInstanceHandle providerDataRef = providerScene.allocateDataInstance(providerLayout, {});
+            const DataInstanceHandle consumerDataRef = consumerScene.allocateDataInstance(consumerLayout, {});
+            providerScene.allocateDataSlot({ EDataSlotType::DataProvider, slotId, {}, providerDataRef, {}, {} }, {});
+            consumerScene.allocateDataSlot({ EDataSlotType::DataConsumer, slotId, {}, consumerDataRef, {}, {} }, {});
+            linksManager.createDataLink(ProviderSceneId, slotId, ConsumerSceneId, slotId);
+            providerDataRefs.push_back(providerDataRef);
+        }
+        RendererEventVector rendererEvents;
+        RendererEventVector sceneEvents;
+        setup.m_rendererEventCollector.appendAndConsumePendingEvents(rendererEvents, sceneEvents);
+
+        const DataReferenceLinkManager& dataReferenceLinkManager = linksManager.getDataReferenceLinkManager();
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 1.f;
+            for (const auto dataRef : providerDataRefs)
+                providerScene.setDataSingleFloat(dataRef, DataFieldHandle{ 0u }, value);
+            dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * linkCount);
+    }
+
+    // Measures time to resolve data links of consumer scene where all provided values changed since last resolve
+    // ARG: number of data links between provider and consumer scene
+    BENCHMARK(BM_Links_ResolveDataLinks)->Arg(10)->Arg(100)->Arg(1000);
+
+    static void BM_Links_ResolveTransformationLinks(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto linkCount = static_cast<uint32_t>(state.range(0));
+
+        RendererCachedScene& providerScene = setup.m_rendererScenes.createScene(SceneInfo{ ProviderSceneId });
+        ActionCollectingScene stagingConsumerScene{ SceneInfo{ ConsumerSceneId } };
+        const BenchmarkSceneContent consumerContent = BenchmarkSetUp::CreateRenderables(stagingConsumerScene, linkCount);
+        RendererCachedScene& consumerScene = setup.createRendererScene(stagingConsumerScene);
+
+        SceneLinksManager& linksManager = setup.m_rendererScenes.getSceneLinksManager();
+        std::vector<TransformHandle> providerTransforms;
+        providerTransforms.reserve(linkCount);
+        for (uint32_t i = 0u; i < linkCount; ++i)
+        {
+            const DataSlotId slotId{ i + 1u };
+            const NodeHandle providerNode = providerScene.allocateNode(0u, {});
+            providerTransforms.push_back(providerScene.allocateTransform(providerNode, {}));
+            providerScene.allocateDataSlot({ EDataSlotType::TransformationProvider, slotId, providerNode, {}, {}, {} }, {});
+            consumerScene.allocateDataSlot({ EDataSlotType::TransformationConsumer, slotId, consumerContent.nodes[i], {}, {}, {} }, {});
+            linksManager.createDataLink(ProviderSceneId, slotId, ConsumerSceneId, slotId);
+        }
+        RendererEventVector rendererEvents;
+        RendererEventVector sceneEvents;
+        setup.m_rendererEventCollector.appendAndConsumePendingEvents(rendererEvents, sceneEvents);
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 1.f;
+            for (const auto transform : providerTransforms)
+                providerScene.setTranslation(transform, { value, 0.f, 0.f });
+            consumerScene.updateRenderableWorldMatricesWithLinks();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * linkCount);
+    }
+
+    // Measures time to update world matrices of consumer scene renderables whose nodes are linked to provider nodes changing every frame
+    // ARG: number of transformation links between provider and consumer scene
+    BENCHMARK(BM_Links_ResolveTransformationLinks)->Arg(10)->Arg(100)->Arg(1000);
+}
@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "internal/RendererLib/RenderExecutor.h"
+#include "internal/RendererLib/RenderingContext.h"
+
+namespace ramses::internal
+{
+    static void BM_RenderExecutor_ExecuteScene(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+
+        ActionCollectingScene stagingScene{ SceneInfo{ SceneId{ 1u } } };
+        BenchmarkSetUp::CreateRenderables(stagingScene, renderableCount);
+        const RendererCachedScene& scene = setup.createRendererScene(stagingScene);
+
+        RenderingContext renderContext{ BenchmarkDevice::FakeDeviceHandle, 1280u, 480u, {}, EClearFlag::All, glm::vec4{ 0.f }, false };
+        const RenderExecutor executor(setup.m_device, renderContext);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            renderContext.displayBufferClearPending = EClearFlag::All;
+            benchmark::DoNotOptimize(executor.executeScene(scene));
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * renderableCount);
+    }
+
+    // Measures time to execute a scene with a single render pass, once per frame as renderer does.
+    // Pass is recorded in first iteration, the rest measures replay of recorded pass which is the common case for static content.
+    // ARG: number of renderables in the pass
+    BENCHMARK(BM_RenderExecutor_ExecuteScene)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+    static void BM_RenderExecutor_ExecuteSceneWithChangingUniforms(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+
+        ActionCollectingScene stagingScene{ SceneInfo{ SceneId{ 1u } } };
+        const BenchmarkSceneContent content = BenchmarkSetUp::CreateRenderables(stagingScene, renderableCount);
+        RendererCachedScene& scene = setup.createRendererScene(stagingScene);
+
+        RenderingContext renderContext{ BenchmarkDevice::FakeDeviceHandle, 1280u, 480u, {}, EClearFlag::All, glm::vec4{ 0.f }, false };
+        const RenderExecutor executor(setup.m_device, renderContext);
+
+        float value = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            value += 0.001f;
+            for (const auto uniforms : content.uniformInstances)
+                scene.setDataSingleVector4f(uniforms, BenchmarkSetUp::ColorField, { value, 0.f, 0.f, 1.f });
+            for (const auto transform : content.transforms)
+                scene.setTranslation(transform, { value, 0.f, -10.f });
+            setup.updateSceneCaches(scene);
+
+            renderContext.displayBufferClearPending = EClearFlag::All;
+            benchmark::DoNotOptimize(executor.executeScene(scene));
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * renderableCount);
+    }
+
+    // Measures time to update scene caches and execute a scene where all renderables change uniform value and transformation every frame,
+    // i.e. typical animated content.
+    // ARG: number of renderables in the pass
+    BENCHMARK(BM_RenderExecutor_ExecuteSceneWithChangingUniforms)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+}
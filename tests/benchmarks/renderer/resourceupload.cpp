@@ -0,0 +1,133 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "internal/RendererLib/RendererResourceManager.h"
+#include "internal/RendererLib/ResourceUploader.h"
+#include "internal/RendererLib/EmbeddedCompositingManager.h"
+#include "internal/RendererLib/DisplayConfigData.h"
+#include "internal/RendererLib/FrameTimer.h"
+#include "internal/RendererLib/RendererStatistics.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
+#include "internal/RendererLib/PlatformBase/TextureUploadingAdapter_Base.h"
+#include "EmbeddedCompositorMock.h"
+#include "WindowMock.h"
+#include "ContextMock.h"
+
+#include <array>
+
+namespace ramses::internal
+{
+    // Render backend with device doing nothing, the other components are not used by resource uploads
+    class BenchmarkRenderBackend final : public IRenderBackend
+    {
+    public:
+        [[nodiscard]] IWindow& getWindow() const override { return m_window; }
+        [[nodiscard]] IContext& getContext() const override { return m_context; }
+        [[nodiscard]] IDevice& getDevice() const override { return m_device; }
+        [[nodiscard]] IEmbeddedCompositor& getEmbeddedCompositor() const override { return m_embeddedCompositor; }
+        [[nodiscard]] ITextureUploadingAdapter& getTextureUploadingAdapter() const override { return m_textureUploadingAdapter; }
+
+        mutable BenchmarkDevice m_device;
+        mutable testing::NiceMock<WindowMock> m_window;
+        mutable testing::NiceMock<ContextMock> m_context;
+        mutable testing::NiceMock<EmbeddedCompositorMock> m_embeddedCompositor;
+        mutable TextureUploadingAdapter_Base m_textureUploadingAdapter{ m_device };
+    };
+
+    class ResourceUploadBenchmarkSetUp
+    {
+    public:
+        explicit ResourceUploadBenchmarkSetUp(uint32_t resourceCount)
+        {
+            m_resources.reserve(resourceCount);
+            m_resourceHashes.reserve(resourceCount);
+            for (uint32_t i = 0u; i < resourceCount; ++i)
+            {
+                // content differs so that every resource has unique hash
+                const std::array<float, 9u> vertices{ static_cast<float>(i), 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f };
+                auto resource = std::make_shared<ArrayResource>(EResourceType::VertexArray, 3u, EDataType::Vector3F, vertices.data(), std::string_view{});
+                m_resourceHashes.push_back(resource->getHash());
+                m_resources.push_back(std::move(resource));
+            }
+        }
+
+        ~ResourceUploadBenchmarkSetUp()
+        {
+            m_resourceManager.unloadAllSceneResourcesForScene(FakeSceneId);
+        }
+
+        ResourceUploadBenchmarkSetUp(const ResourceUploadBenchmarkSetUp&) = delete;
+        ResourceUploadBenchmarkSetUp& operator=(const ResourceUploadBenchmarkSetUp&) = delete;
+
+        void referenceAndUploadResources()
+        {
+            m_resourceManager.referenceResourcesForScene(FakeSceneId, m_resourceHashes);
+            for (const auto& resource : m_resources)
+                m_resourceManager.provideResourceData(resource);
+            while (m_resourceManager.hasResourcesToBeUploaded())
+                m_resourceManager.uploadAndUnloadPendingResources();
+        }
+
+        void unreferenceAndUnloadResources()
+        {
+            m_resourceManager.unreferenceResourcesForScene(FakeSceneId, m_resourceHashes);
+            m_resourceManager.uploadAndUnloadPendingResources();
+        }
+
+        static constexpr SceneId FakeSceneId{ 1u };
+
+        BenchmarkRenderBackend m_renderBackend;
+        FrameTimer m_frameTimer;
+        RendererStatistics m_stats;
+        EmbeddedCompositingManager m_embeddedCompositingManager{ m_renderBackend.m_device, m_renderBackend.m_embeddedCompositor, m_renderBackend.m_textureUploadingAdapter };
+        RendererResourceManager m_resourceManager{ m_renderBackend, std::make_unique<ResourceUploader>(false), nullptr, m_embeddedCompositingManager, {}, m_frameTimer, m_stats };
+
+        ManagedResourceVector m_resources;
+        ResourceContentHashVector m_resourceHashes;
+    };
+
+    static void BM_ResourceUpload_UploadAndUnload(benchmark::State& state)
+    {
+        const auto resourceCount = static_cast<uint32_t>(state.range(0));
+        ResourceUploadBenchmarkSetUp setup{ resourceCount };
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            setup.referenceAndUploadResources();
+            setup.unreferenceAndUnloadResources();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * resourceCount);
+    }
+
+    // Measures time to reference, provide, upload (in batches as configured by default) and then unreference and unload resources of a scene.
+    // No GPU cache is configured, so all resources get unloaded as soon as not used anymore.
+    // ARG: number of resources
+    BENCHMARK(BM_ResourceUpload_UploadAndUnload)->Arg(10)->Arg(100)->Arg(1000);
+
+    static void BM_ResourceUpload_NothingToUpload(benchmark::State& state)
+    {
+        const auto resourceCount = static_cast<uint32_t>(state.range(0));
+        ResourceUploadBenchmarkSetUp setup{ resourceCount };
+        setup.referenceAndUploadResources();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(setup.m_resourceManager.hasResourcesToBeUploaded());
+            setup.m_resourceManager.uploadAndUnloadPendingResources();
+        }
+
+        setup.unreferenceAndUnloadResources();
+    }
+
+    // Measures per frame overhead of resource upload scheduling when all resources in use are already uploaded
+    // ARG: number of uploaded resources
+    BENCHMARK(BM_ResourceUpload_NothingToUpload)->Arg(10)->Arg(100)->Arg(1000);
+}
@@ -0,0 +1,107 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmarksetup.h"
+#include "internal/SceneGraph/Scene/SceneActionApplier.h"
+
+namespace ramses::internal
+{
+    static void BM_SceneActions_ApplyInitialFlush(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+
+        ActionCollectingScene stagingScene{ SceneInfo{ SceneId{ 1u } } };
+        BenchmarkSetUp::CreateRenderables(stagingScene, renderableCount);
+        const SceneActionCollection& actions = stagingScene.getSceneActionCollection();
+        const SceneSizeInformation sizeInfo = stagingScene.getSceneSizeInformation();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            RendererCachedScene& scene = setup.m_rendererScenes.createScene(SceneInfo{ SceneId{ 2u } });
+            scene.preallocateSceneSize(sizeInfo);
+            SceneActionApplier::ApplyActionsOnScene(scene, actions, EFeatureLevel_Latest);
+
+            state.PauseTiming();
+            setup.m_rendererScenes.destroyScene(SceneId{ 2u });
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    // Measures time to apply scene actions of initial flush on a renderer scene, as RendererSceneUpdater::applySceneActions does when scene gets subscribed
+    // ARG: number of renderables in the scene (each with own node, transform and data instances)
+    BENCHMARK(BM_SceneActions_ApplyInitialFlush)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+    static void BM_SceneActions_ApplyUpdateFlush(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+
+        ActionCollectingScene stagingScene{ SceneInfo{ SceneId{ 1u } } };
+        const BenchmarkSceneContent content = BenchmarkSetUp::CreateRenderables(stagingScene, renderableCount);
+        RendererCachedScene& scene = setup.createRendererScene(stagingScene);
+
+        // actions of next flush, changing transformation and uniform value of every renderable
+        stagingScene.getSceneActionCollection().clear();
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+        {
+            stagingScene.setTranslation(content.transforms[i], { 1.f, 2.f, -10.f });
+            stagingScene.setDataSingleVector4f(content.uniformInstances[i], BenchmarkSetUp::ColorField, { 0.f, 1.f, 0.f, 1.f });
+        }
+        const SceneActionCollection& actions = stagingScene.getSceneActionCollection();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            SceneActionApplier::ApplyActionsOnScene(scene, actions, EFeatureLevel_Latest);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    // Measures time to apply scene actions of a flush updating already rendered scene, as RendererSceneUpdater::applySceneActions does for every flush
+    // ARG: number of renderables changing transformation and uniform value in the flush
+    BENCHMARK(BM_SceneActions_ApplyUpdateFlush)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+
+    static void BM_SceneActions_ApplyAnimationFlush(benchmark::State& state)
+    {
+        BenchmarkSetUp setup;
+        const auto renderableCount = static_cast<uint32_t>(state.range(0));
+
+        ActionCollectingScene stagingScene{ SceneInfo{ SceneId{ 1u } } };
+        const BenchmarkSceneContent content = BenchmarkSetUp::CreateRenderables(stagingScene, renderableCount);
+        RendererCachedScene& scene = setup.createRendererScene(stagingScene);
+
+        // actions of next flush grouped by setter as an animation typically produces them,
+        // each group is a run of actions of same type
+        stagingScene.getSceneActionCollection().clear();
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+            stagingScene.setTranslation(content.transforms[i], { 1.f, 2.f, -10.f });
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+            stagingScene.setRotation(content.transforms[i], { 0.f, 0.f, 0.f, 1.f }, ERotationType::Quaternion);
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+            stagingScene.setDataSingleVector4f(content.uniformInstances[i], BenchmarkSetUp::ColorField, { 0.f, 1.f, 0.f, 1.f });
+        const SceneActionCollection& actions = stagingScene.getSceneActionCollection();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            SceneActionApplier::ApplyActionsOnScene(scene, actions, EFeatureLevel_Latest);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * actions.numberOfActions());
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(actions.collectionData().size()));
+    }
+
+    // Measures time to apply scene actions of a flush consisting of runs of same setter, e.g. translations of all animated nodes
+    // followed by their rotations and uniform values, these runs are applied in a typed loop per run
+    // ARG: number of renderables changing translation, rotation and uniform value in the flush
+    BENCHMARK(BM_SceneActions_ApplyAnimationFlush)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+}
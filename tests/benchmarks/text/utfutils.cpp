@@ -0,0 +1,46 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+#include "ramses/client/text/UtfUtils.h"
+
+#include <string>
+
+namespace ramses::internal
+{
+    // Creates UTF8 string of given length where every n-th character (if n > 0) is a non-ASCII character, 0 means only ASCII
+    static std::string CreateUtf8String(size_t length, size_t nonAsciiEveryNth)
+    {
+        std::u32string utf32String;
+        utf32String.reserve(length);
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (nonAsciiEveryNth > 0u && i % nonAsciiEveryNth == 0u)
+                utf32String.push_back(U'ä');
+            else
+                utf32String.push_back(static_cast<char32_t>(U'a' + i % 26u));
+        }
+        return UtfUtils::ConvertStrUtf32ToUtf8(utf32String);
+    }
+
+    static void BM_ConvertUtf8ToUtf32(benchmark::State& state)
+    {
+        const std::string utf8String = CreateUtf8String(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            auto utf32String = UtfUtils::ConvertUtf8ToUtf32(utf8String);
+            benchmark::DoNotOptimize(utf32String);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(utf8String.size()));
+    }
+
+    // Measures conversion of strings with different ratio of non-ASCII characters
+    // ARG 0: number of characters
+    // ARG 1: every n-th character is non-ASCII, 0 for ASCII only
+    BENCHMARK(BM_ConvertUtf8ToUtf32)->Args({ 64, 0 })->Args({ 4096, 0 })->Args({ 4096, 64 })->Args({ 4096, 8 })->Args({ 4096, 1 })->Unit(benchmark::kMicrosecond);
+}
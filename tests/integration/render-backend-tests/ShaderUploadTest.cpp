@@ -15,6 +15,7 @@
 #include "RendererTestUtils.h"
 #include "WindowEventHandlerMock.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/glslEffectBlock/GlslEffect.h"
 #include "internal/SceneGraph/Resource/ResourceTypes.h"
 #include "internal/RendererLib/PlatformInterface/IRenderBackend.h"
 #include "internal/RendererLib/PlatformBase/Device_Base.h"
@@ -804,4 +805,88 @@ namespace ramses::internal
 
         testDevice->deleteShader(handle);
     }
+
+    class ADeviceUploadingEffectWithSPIRV : public ADevice
+    {
+    public:
+        static std::unique_ptr<EffectResource> CreateTestEffectResourceWithSPIRV()
+        {
+            const std::string vertexShader(R"SHADER(
+                #version 310 es
+
+                layout(location=1) in vec2 a_texCoords;
+                layout(location=0) in vec3 a_position;
+
+                void main(void)
+                {
+                    gl_Position = vec4(a_position.x + a_texCoords.x);
+                }
+                )SHADER");
+            const std::string fragmentShader(R"SHADER(
+                #version 310 es
+                layout(location=0) out highp vec4 fragColor;
+                void main(void)
+                {
+                    fragColor = vec4(1.0);
+                }
+                )SHADER");
+
+            GlslEffect glslEffect(vertexShader, fragmentShader, "", {}, {}, ERenderBackendCompatibility::VulkanAndOpenGL, "spirv test effect");
+            return glslEffect.createEffectResource(EFeatureLevel_Latest);
+        }
+
+        void expectAttributeLocationsOfTestEffect(const EffectResource& effect)
+        {
+            auto shaderGpuResource = testDevice->uploadShader(effect);
+            ASSERT_NE(nullptr, shaderGpuResource);
+            const DeviceResourceHandle handle = testDevice->registerShader(std::move(shaderGpuResource));
+            ASSERT_TRUE(handle.isValid());
+
+            // SPIR-V is used only if driver supports it, resulting program must behave the same as one created from source
+            testDevice->activateShader(handle);
+            const auto& shaderResource = renderBackend->getContext().getResources().getResourceAs<ShaderGPUResource_GL>(handle);
+            const DataFieldHandle texCoordsField = effect.getAttributeDataFieldHandleByName("a_texCoords");
+            const DataFieldHandle positionField = effect.getAttributeDataFieldHandleByName("a_position");
+            ASSERT_TRUE(texCoordsField.isValid());
+            ASSERT_TRUE(positionField.isValid());
+            EXPECT_EQ(1, shaderResource.getAttributeLocation(texCoordsField).getValue());
+            EXPECT_EQ(0, shaderResource.getAttributeLocation(positionField).getValue());
+            EXPECT_TRUE(testDevice->isDeviceStatusHealthy());
+
+            testDevice->deleteShader(handle);
+        }
+    };
+
+    TEST_F(ADeviceUploadingEffectWithSPIRV, CreatesShaderFromEffect)
+    {
+        ASSERT_TRUE(testDevice != nullptr);
+
+        const auto testEffect = CreateTestEffectResourceWithSPIRV();
+        ASSERT_TRUE(testEffect);
+        ASSERT_NE(0u, testEffect->getVertexShaderSPIRVSize());
+        ASSERT_NE(0u, testEffect->getFragmentShaderSPIRVSize());
+
+        expectAttributeLocationsOfTestEffect(*testEffect);
+    }
+
+    TEST_F(ADeviceUploadingEffectWithSPIRV, FallsBackToShaderSourceIfSPIRVIsInvalid)
+    {
+        ASSERT_TRUE(testDevice != nullptr);
+
+        const auto templateEffect = CreateTestEffectResourceWithSPIRV();
+        ASSERT_TRUE(templateEffect);
+
+        const SPIRVShaderBlob invalidSPIRV{ 0xdeadbeefu, 0u, 1u, 2u, 3u };
+        const EffectResource testEffect(
+            templateEffect->getVertexShader(),
+            templateEffect->getFragmentShader(),
+            "",
+            SPIRVShaders{ invalidSPIRV, invalidSPIRV, {} },
+            {},
+            templateEffect->getUniformInputs(),
+            templateEffect->getAttributeInputs(),
+            "invalid spirv test effect", EFeatureLevel_Latest);
+
+        expectAttributeLocationsOfTestEffect(testEffect);
+    }
 }
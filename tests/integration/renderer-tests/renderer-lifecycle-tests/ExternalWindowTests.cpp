@@ -57,6 +57,11 @@ namespace ramses::internal
                 (void)x;
                 (void)y;
             }
+            void onFramePresented(uint64_t frameIndex, FlushTime::Clock::time_point presentationTime) override
+            {
+                (void)frameIndex;
+                (void)presentationTime;
+            }
         };
 
         ramses::DisplayConfig dispConfigExternalWindow = RendererTestUtils::CreateTestDisplayConfig(0u, false);
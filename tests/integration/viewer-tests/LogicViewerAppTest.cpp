@@ -696,6 +696,46 @@ namespace ramses::internal
         EXPECT_EQ(ViewerApp::ExitCode::Ok, m_app->run());
     }
 
+    TEST_F(ALogicViewerHeadlessApp, benchmarkWritesReport)
+    {
+        EXPECT_EQ(0, createApp({ "--benchmark=10", "--benchmark-report=report.json", ramsesFile }));
+        EXPECT_EQ(ViewerApp::ExitCode::Ok, m_app->run());
+
+        std::ifstream ifs("report.json");
+        const std::string report{ std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>() };
+        EXPECT_THAT(report, testing::HasSubstr(R"("frames": 10)"));
+        EXPECT_THAT(report, testing::HasSubstr(R"("loadTime": )"));
+        EXPECT_THAT(report, testing::HasSubstr(R"("logicUpdate": { "min": )"));
+        EXPECT_THAT(report, testing::HasSubstr(R"("flush": { "min": )"));
+        EXPECT_THAT(report, testing::HasSubstr(R"("frame": { "min": )"));
+    }
+
+    TEST_F(ALogicViewerHeadlessApp, benchmarkFailsIfReportCannotBeWritten)
+    {
+        testing::internal::CaptureStderr();
+        EXPECT_EQ(0, createApp({ "--benchmark=10", "--benchmark-report=notExistingDirectory/report.json", ramsesFile }));
+        EXPECT_EQ(ViewerApp::ExitCode::ErrorBenchmark, m_app->run());
+        EXPECT_THAT(testing::internal::GetCapturedStderr(), testing::HasSubstr("Failed to write benchmark report to 'notExistingDirectory/report.json'"));
+    }
+
+    TEST_F(ALogicViewerHeadlessApp, benchmarkFailsIfFrameBudgetExceeded)
+    {
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+        EXPECT_EQ(0, createApp({ "--benchmark=10", "--frame-budget=1000000000", ramsesFile }));
+        EXPECT_EQ(ViewerApp::ExitCode::Ok, m_app->run());
+        EXPECT_THAT(testing::internal::GetCapturedStdout(), testing::HasSubstr(R"("frames": 10)"));
+        EXPECT_EQ("", testing::internal::GetCapturedStderr());
+
+        // cannot be fulfilled: frames take at least a microsecond with a logic update
+        testing::internal::CaptureStdout();
+        testing::internal::CaptureStderr();
+        EXPECT_EQ(0, createApp({ "--benchmark=10", "--frame-budget=1", ramsesFile }));
+        EXPECT_EQ(ViewerApp::ExitCode::ErrorFrameBudget, m_app->run());
+        testing::internal::GetCapturedStdout();
+        EXPECT_THAT(testing::internal::GetCapturedStderr(), testing::HasSubstr("Frame budget exceeded"));
+    }
+
     TYPED_TEST(ALogicViewerApp_T, exec_luaFileMissing)
     {
         // implicit filename
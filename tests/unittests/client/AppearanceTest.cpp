@@ -305,6 +305,37 @@ namespace ramses::internal
         EXPECT_TRUE(writeA);
     }
 
+    TEST_P(AAppearanceTest, setGetUniformTimeAnimationEnd)
+    {
+        if (GetParam() < EFeatureLevel_03)
+            GTEST_SKIP();
+
+        EXPECT_TRUE(m_appearance.setUniformTimeAnimationEnd(1500));
+        EXPECT_EQ(1500, m_appearance.getUniformTimeAnimationEnd());
+        EXPECT_EQ(1500, m_sharedTestState.getInternalScene().getDataInstanceUniformTimeAnimationEnd(m_appearance.impl().getUniformDataInstance()));
+        EXPECT_TRUE(m_appearance.setUniformTimeAnimationEnd(0));
+        EXPECT_EQ(0, m_appearance.getUniformTimeAnimationEnd());
+    }
+
+    TEST_P(AAppearanceTest, failsToSetNegativeUniformTimeAnimationEnd)
+    {
+        if (GetParam() < EFeatureLevel_03)
+            GTEST_SKIP();
+
+        EXPECT_TRUE(m_appearance.setUniformTimeAnimationEnd(1500));
+        EXPECT_FALSE(m_appearance.setUniformTimeAnimationEnd(-1));
+        EXPECT_EQ(1500, m_appearance.getUniformTimeAnimationEnd());
+    }
+
+    TEST_P(AAppearanceTest, failsToSetUniformTimeAnimationEndBelowFeatureLevel03)
+    {
+        if (GetParam() >= EFeatureLevel_03)
+            GTEST_SKIP();
+
+        EXPECT_FALSE(m_appearance.setUniformTimeAnimationEnd(1500));
+        EXPECT_EQ(std::numeric_limits<int32_t>::max(), m_appearance.getUniformTimeAnimationEnd());
+    }
+
     TEST_P(AAppearanceTest, reportsErrorWhenGetSetMismatchingInputTypeScalar)
     {
         const auto optUniform = m_sharedTestState.effect->findUniformInput("integerInput");
@@ -1503,6 +1534,11 @@ namespace ramses::internal
         EXPECT_TRUE(writeA);
     }
 
+    TEST_P(AAppearanceTest, defaultUniformTimeAnimationEndIsUnbounded)
+    {
+        EXPECT_EQ(std::numeric_limits<int32_t>::max(), m_appearance.getUniformTimeAnimationEnd());
+    }
+
     TEST_P(AAppearanceTest, defaultGetInputValue)
     {
         {
@@ -19,6 +19,7 @@
 #include "internal/Communication/TransportCommon/FakeConnectionSystem.h"
 #include "internal/Communication/TransportCommon/FakeConnectionStatusUpdateNotifier.h"
 #include "internal/Components/FileInputStreamContainer.h"
+#include <thread>
 
 namespace ramses::internal
 {
@@ -170,13 +171,37 @@ namespace ramses::internal
 
     TEST_F(AClientApplicationLogic, returnsReturnValueFromComponentOnFlush)
     {
+        EXPECT_CALL(scenegraphProviderComponent, handlePrepareFlush(sceneId));
         EXPECT_CALL(scenegraphProviderComponent, handleFlush(_, _, _)).WillOnce(Return(true));
         EXPECT_TRUE(logic.flush(sceneId, {}, {}));
 
+        EXPECT_CALL(scenegraphProviderComponent, handlePrepareFlush(sceneId));
         EXPECT_CALL(scenegraphProviderComponent, handleFlush(_, _, _)).WillOnce(Return(false));
         EXPECT_FALSE(logic.flush(sceneId, {}, {}));
     }
 
+    TEST_F(AClientApplicationLogic, preparesFlushWithoutHoldingFrameworkLock)
+    {
+        const auto isFrameworkLockFreeForOtherThread = [&]() {
+            bool locked = false;
+            std::thread otherThread([&]() {
+                locked = frameworkLock.try_lock();
+                if (locked)
+                    frameworkLock.unlock();
+            });
+            otherThread.join();
+            return locked;
+        };
+
+        InSequence seq;
+        EXPECT_CALL(scenegraphProviderComponent, handlePrepareFlush(sceneId)).WillOnce([&](auto /*unused*/) { EXPECT_TRUE(isFrameworkLockFreeForOtherThread()); });
+        EXPECT_CALL(scenegraphProviderComponent, handleFlush(sceneId, _, _)).WillOnce([&](auto /*unused*/, const auto& /*unused*/, auto /*unused*/) {
+            EXPECT_FALSE(isFrameworkLockFreeForOtherThread());
+            return true;
+        });
+        EXPECT_TRUE(logic.flush(sceneId, {}, {}));
+    }
+
     class AClientApplicationLogicWithRealComponents : public ::testing::Test
     {
     public:
@@ -0,0 +1,189 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/glslEffectBlock/EffectCompilationCache.h"
+#include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/Core/Utils/File.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace ramses::internal
+{
+    class AnEffectCompilationCache : public ::testing::Test
+    {
+    public:
+        AnEffectCompilationCache()
+        {
+            uniformInputs.emplace_back("u_a", 1u, EDataType::Float, EFixedSemantics::Invalid);
+            uniformInputs.emplace_back("u_mvp", 1u, EDataType::Matrix44F, EFixedSemantics::ModelViewProjectionMatrix);
+            attributeInputs.emplace_back("a_position", 1u, EDataType::Vector3Buffer, EFixedSemantics::Invalid);
+            semantics.emplace("u_mvp", EFixedSemantics::ModelViewProjectionMatrix);
+            removeCacheFile();
+        }
+
+        ~AnEffectCompilationCache() override
+        {
+            removeCacheFile();
+        }
+
+    protected:
+        void removeCacheFile()
+        {
+            File file(cacheFilePath);
+            if (file.exists())
+                file.remove();
+        }
+
+        [[nodiscard]] ResourceContentHash createKey(EFeatureLevel featureLevel = EFeatureLevel_Latest) const
+        {
+            return EffectCompilationCache::CreateKey("vs", "fs", "", defines, semantics, ERenderBackendCompatibility::OpenGL, featureLevel);
+        }
+
+        [[nodiscard]] EffectResource createEffect(std::string_view name) const
+        {
+            return EffectResource("vs", "fs", "", { SPIRVShaderBlob{ 1u, 2u }, SPIRVShaderBlob{ 3u }, {} }, {}, uniformInputs, attributeInputs, name, EFeatureLevel_Latest);
+        }
+
+        static void ExpectSameEffect(const EffectResource& expected, const EffectResource& actual)
+        {
+            EXPECT_EQ(expected.getHash(), actual.getHash());
+            EXPECT_STREQ(expected.getVertexShader(), actual.getVertexShader());
+            EXPECT_STREQ(expected.getFragmentShader(), actual.getFragmentShader());
+            EXPECT_EQ(expected.getVertexShaderSPIRVSize(), actual.getVertexShaderSPIRVSize());
+            EXPECT_EQ(expected.getUniformInputs(), actual.getUniformInputs());
+            EXPECT_EQ(expected.getAttributeInputs(), actual.getAttributeInputs());
+        }
+
+        const std::string cacheFilePath = "effectCompilationCacheTest.cache";
+        EffectInputInformationVector uniformInputs;
+        EffectInputInformationVector attributeInputs;
+        std::vector<std::string> defines{ "DEF_A", "DEF_B" };
+        SemanticsMap semantics;
+    };
+
+    TEST_F(AnEffectCompilationCache, isEmptyInitially)
+    {
+        EffectCompilationCache cache;
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+        EXPECT_FALSE(cache.getEffectResource(createKey(), "name", EFeatureLevel_Latest));
+    }
+
+    TEST_F(AnEffectCompilationCache, keyDependsOnAllInputsAffectingEffectResource)
+    {
+        const auto key = createKey();
+        EXPECT_EQ(key, createKey());
+        EXPECT_NE(key, createKey(EFeatureLevel_01));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs2", "fs", "", defines, semantics, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs", "fs2", "", defines, semantics, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs", "fs", "gs", defines, semantics, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs", "fs", "", { "DEF_A" }, semantics, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs", "fs", "", defines, {}, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+        EXPECT_NE(key, EffectCompilationCache::CreateKey("vs", "fs", "", defines, semantics, ERenderBackendCompatibility::VulkanAndOpenGL, EFeatureLevel_Latest));
+    }
+
+    TEST_F(AnEffectCompilationCache, keyDoesNotDependOnOrderOfSemantics)
+    {
+        SemanticsMap semantics1;
+        semantics1.emplace("u_a", EFixedSemantics::ModelMatrix);
+        semantics1.emplace(UniformBufferBinding{ 1u }, EFixedSemantics::ModelBlock);
+        semantics1.emplace("u_b", EFixedSemantics::ViewMatrix);
+        SemanticsMap semantics2;
+        semantics2.emplace("u_b", EFixedSemantics::ViewMatrix);
+        semantics2.emplace(UniformBufferBinding{ 1u }, EFixedSemantics::ModelBlock);
+        semantics2.emplace("u_a", EFixedSemantics::ModelMatrix);
+
+        EXPECT_EQ(EffectCompilationCache::CreateKey("vs", "fs", "", defines, semantics1, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest),
+            EffectCompilationCache::CreateKey("vs", "fs", "", defines, semantics2, ERenderBackendCompatibility::OpenGL, EFeatureLevel_Latest));
+    }
+
+    TEST_F(AnEffectCompilationCache, createsStoredEffectWithGivenName)
+    {
+        EffectCompilationCache cache;
+        const auto effect = createEffect("original");
+        cache.storeEffectResource(createKey(), effect);
+        EXPECT_EQ(1u, cache.getNumberOfEntries());
+
+        const auto cachedEffect = cache.getEffectResource(createKey(), "other", EFeatureLevel_Latest);
+        ASSERT_TRUE(cachedEffect);
+        EXPECT_EQ("other", cachedEffect->getName());
+        ExpectSameEffect(effect, *cachedEffect);
+
+        EXPECT_FALSE(cache.getEffectResource(createKey(EFeatureLevel_01), "other", EFeatureLevel_01));
+    }
+
+    TEST_F(AnEffectCompilationCache, canBeSavedToAndLoadedFromFile)
+    {
+        const auto effect = createEffect("original");
+        {
+            EffectCompilationCache cache;
+            cache.storeEffectResource(createKey(), effect);
+            EXPECT_TRUE(cache.saveToFile(cacheFilePath));
+        }
+
+        EffectCompilationCache cache;
+        EXPECT_TRUE(cache.loadFromFile(cacheFilePath));
+        EXPECT_EQ(1u, cache.getNumberOfEntries());
+        const auto cachedEffect = cache.getEffectResource(createKey(), "loaded", EFeatureLevel_Latest);
+        ASSERT_TRUE(cachedEffect);
+        EXPECT_EQ("loaded", cachedEffect->getName());
+        ExpectSameEffect(effect, *cachedEffect);
+    }
+
+    TEST_F(AnEffectCompilationCache, isPersistedInGivenFileIfModified)
+    {
+        {
+            EffectCompilationCache cache{ cacheFilePath };
+        }
+        EXPECT_FALSE(File(cacheFilePath).exists());
+
+        const auto effect = createEffect("original");
+        {
+            EffectCompilationCache cache{ cacheFilePath };
+            cache.storeEffectResource(createKey(), effect);
+        }
+        EXPECT_TRUE(File(cacheFilePath).exists());
+
+        EffectCompilationCache cache{ cacheFilePath };
+        EXPECT_EQ(1u, cache.getNumberOfEntries());
+        const auto cachedEffect = cache.getEffectResource(createKey(), "loaded", EFeatureLevel_Latest);
+        ASSERT_TRUE(cachedEffect);
+        ExpectSameEffect(effect, *cachedEffect);
+    }
+
+    TEST_F(AnEffectCompilationCache, failsToLoadCorruptFile)
+    {
+        {
+            EffectCompilationCache cache;
+            cache.storeEffectResource(createKey(), createEffect("original"));
+            EXPECT_TRUE(cache.saveToFile(cacheFilePath));
+        }
+
+        {
+            File file(cacheFilePath);
+            size_t fileSize = 0u;
+            ASSERT_TRUE(file.getSizeInBytes(fileSize));
+            ASSERT_TRUE(file.open(File::Mode::WriteExistingBinary));
+            ASSERT_TRUE(file.seek(static_cast<int64_t>(fileSize / 2u), File::SeekOrigin::BeginningOfFile));
+            const uint8_t garbage = 0xAB;
+            ASSERT_TRUE(file.write(&garbage, 1u));
+            file.close();
+        }
+
+        EffectCompilationCache cache;
+        EXPECT_FALSE(cache.loadFromFile(cacheFilePath));
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+    }
+
+    TEST_F(AnEffectCompilationCache, failsToLoadNonExistingFile)
+    {
+        EffectCompilationCache cache;
+        EXPECT_FALSE(cache.loadFromFile(cacheFilePath));
+        EXPECT_EQ(0u, cache.getNumberOfEntries());
+    }
+}
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "impl/EffectImpl.h"
+#include "impl/RamsesClientImpl.h"
 
 #include "TestEffectCreator.h"
 #include "ramses/client/UniformInput.h"
@@ -570,6 +571,38 @@ namespace ramses::internal
         EXPECT_EQ("", m_sharedTestState.getScene().getLastEffectErrorMessages());
     }
 
+    TEST_P(AnEffect, createsEffectWithSameSourcesAgainFromCacheKeepingItsOwnName)
+    {
+        EffectDescription effectDesc;
+        effectDesc.setVertexShader("#version 100\n"
+                                   "uniform highp float u_float;\n"
+                                   "attribute float inp;\n"
+                                   "void main(void)\n"
+                                   "{\n"
+                                   "    gl_Position = vec4(u_float * inp);\n"
+                                   "}\n");
+        effectDesc.setFragmentShader("precision highp float;"
+                                     "void main(void)\n"
+                                     "{"
+                                     "  gl_FragColor = vec4(1.0, 1.0, 1.0, 1.0);"
+                                     "}");
+        const auto& cache = m_sharedTestState.getClient().impl().getEffectCompilationCache();
+        const size_t numCachedEffects = cache.getNumberOfEntries();
+        const Effect* effect1 = m_sharedTestState.getScene().createEffect(effectDesc, "effect1");
+        ASSERT_NE(nullptr, effect1);
+        EXPECT_EQ(numCachedEffects + 1u, cache.getNumberOfEntries());
+        const Effect* effect2 = m_sharedTestState.getScene().createEffect(effectDesc, "effect2");
+        ASSERT_NE(nullptr, effect2);
+        EXPECT_EQ(numCachedEffects + 1u, cache.getNumberOfEntries());
+
+        EXPECT_EQ(effect1->getResourceId(), effect2->getResourceId());
+        EXPECT_EQ("effect1", effect1->getName());
+        EXPECT_EQ("effect2", effect2->getName());
+        EXPECT_EQ(effect1->getUniformInputCount(), effect2->getUniformInputCount());
+        EXPECT_EQ(effect1->getAttributeInputCount(), effect2->getAttributeInputCount());
+        EXPECT_TRUE(effect2->findUniformInput("u_float").has_value());
+    }
+
     TEST_P(AnEffect, canNotCreateEffectWhenTextTextureCoordinatesSemanticsHasWrongType)
     {
         EffectDescription effectDesc;
@@ -26,6 +26,7 @@
 #include "ramses/client/logic/CameraBinding.h"
 #include "ramses/client/logic/RenderBufferBinding.h"
 #include "ramses/client/PerspectiveCamera.h"
+#include "ramses/client/RenderPass.h"
 #include "ramses/client/UniformInput.h"
 
 namespace ramses::internal
@@ -213,12 +214,32 @@ namespace ramses::internal
             checkUniformBufferInput(false);
         }
 
+        void checkRenderPassStateSorting(bool enabled)
+        {
+            const auto renderPass = m_scene->findObject<ramses::RenderPass>("triangle render pass");
+            ASSERT_TRUE(renderPass);
+            EXPECT_EQ(enabled, renderPass->isStateSorting());
+        }
+
+        void expectFeatureLevel03Content()
+        {
+            checkRenderPassStateSorting(true);
+        }
+
+        void expectFeatureLevel03ContentNotPresent()
+        {
+            checkRenderPassStateSorting(false);
+        }
+
         void checkContents()
         {
             // check for content expected to exist
             // higher feature level always contains content supported by lower level
             switch (GetParam())
             {
+            case ramses::EFeatureLevel_03:
+                expectFeatureLevel03Content();
+                [[fallthrough]];
             case ramses::EFeatureLevel_02:
                 expectFeatureLevel02Content();
                 [[fallthrough]];
@@ -235,6 +256,9 @@ namespace ramses::internal
                 expectFeatureLevel02ContentNotPresent();
                 [[fallthrough]];
             case EFeatureLevel_02:
+                expectFeatureLevel03ContentNotPresent();
+                [[fallthrough]];
+            case EFeatureLevel_03:
                 break;
             }
         }
@@ -260,6 +284,9 @@ namespace ramses::internal
             case ramses::EFeatureLevel_02:
                 m_scene = &m_ramses.loadSceneFromFile("../res/testScene_02.ramses");
                 break;
+            case ramses::EFeatureLevel_03:
+                m_scene = &m_ramses.loadSceneFromFile("../res/testScene_03.ramses");
+                break;
             default:
                 assert(false);
                 break;
@@ -276,6 +303,8 @@ namespace ramses::internal
     // disabled until UBO isolated within FL02
     TEST_P(AFeatureLevelCompatibility, CanLoadExportedBinaryAndVerifyContent)
     {
+        if (GetParam() == EFeatureLevel_03)
+            GTEST_SKIP() << "testScene_03.ramses not exported yet, regenerate test assets with RL_REGEN_TEST_ASSETS";
         loadScene();
         checkContents();
         saveAndReloadAndCheckContents();
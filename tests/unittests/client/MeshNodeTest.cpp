@@ -11,12 +11,14 @@
 #include "ramses/client/MeshNode.h"
 #include "ramses/client/Geometry.h"
 #include "ramses/client/ArrayResource.h"
+#include "ramses/client/ArrayBuffer.h"
 
 #include "ClientTestUtils.h"
 #include "impl/GeometryImpl.h"
 #include "impl/AppearanceImpl.h"
 #include "impl/MeshNodeImpl.h"
 #include "impl/ArrayResourceImpl.h"
+#include "impl/ArrayBufferImpl.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
 #include "impl/EffectImpl.h"
 
@@ -359,6 +361,215 @@ namespace ramses::internal
         EXPECT_EQ(instanceCount, m_meshNode->getInstanceCount());
     }
 
+    class MeshNodeWithFeatureLevel02Test : public LocalTestClientWithScene, public testing::Test
+    {
+    protected:
+        MeshNodeWithFeatureLevel02Test()
+            : LocalTestClientWithScene(EFeatureLevel_02)
+            , m_meshNode(*m_scene.createMeshNode("node"))
+        {
+        }
+
+        MeshNode& m_meshNode;
+    };
+
+    TEST_F(MeshNodeWithFeatureLevel02Test, failsToSetBoundingSphere)
+    {
+        EXPECT_FALSE(m_meshNode.setBoundingSphere(vec3f{ 1.f, 2.f, 3.f }, 4.f));
+        EXPECT_FALSE(m_meshNode.removeBoundingSphere());
+
+        vec3f center;
+        float radius = 0.f;
+        EXPECT_FALSE(m_meshNode.getBoundingSphere(center, radius));
+    }
+
+    TEST_F(MeshNodeWithFeatureLevel02Test, failsToSetInstanceCullingPositions)
+    {
+        const auto positions = m_scene.createArrayBuffer(ramses::EDataType::Vector3F, 4u);
+        ASSERT_NE(nullptr, positions);
+        EXPECT_FALSE(m_meshNode.setInstanceCullingPositions(positions));
+        EXPECT_EQ(nullptr, m_meshNode.getInstanceCullingPositions());
+    }
+
+    TEST_F(MeshNodeWithFeatureLevel02Test, failsToAddLevelOfDetail)
+    {
+        EXPECT_FALSE(m_meshNode.addLevelOfDetail(10u, 6u, 0.3f));
+        EXPECT_FALSE(m_meshNode.removeLevelsOfDetail());
+        EXPECT_EQ(0u, m_meshNode.getLevelOfDetailCount());
+    }
+
+    TEST_F(MeshNodeTest, hasNoBoundingSphereByDefault)
+    {
+        vec3f center;
+        float radius = 0.f;
+        EXPECT_FALSE(m_meshNode->getBoundingSphere(center, radius));
+    }
+
+    TEST_F(MeshNodeTest, setsAndGetsBoundingSphere)
+    {
+        EXPECT_TRUE(m_meshNode->setBoundingSphere(vec3f{ 1.f, 2.f, 3.f }, 4.f));
+
+        vec3f center;
+        float radius = 0.f;
+        EXPECT_TRUE(m_meshNode->getBoundingSphere(center, radius));
+        EXPECT_EQ(vec3f(1.f, 2.f, 3.f), center);
+        EXPECT_FLOAT_EQ(4.f, radius);
+    }
+
+    TEST_F(MeshNodeTest, failsToSetBoundingSphereWithNegativeRadius)
+    {
+        EXPECT_FALSE(m_meshNode->setBoundingSphere(vec3f{ 1.f, 2.f, 3.f }, -1.f));
+
+        vec3f center;
+        float radius = 0.f;
+        EXPECT_FALSE(m_meshNode->getBoundingSphere(center, radius));
+    }
+
+    TEST_F(MeshNodeTest, removesBoundingSphere)
+    {
+        EXPECT_TRUE(m_meshNode->setBoundingSphere(vec3f{ 1.f, 2.f, 3.f }, 4.f));
+        EXPECT_TRUE(m_meshNode->removeBoundingSphere());
+
+        vec3f center;
+        float radius = 0.f;
+        EXPECT_FALSE(m_meshNode->getBoundingSphere(center, radius));
+    }
+
+    TEST_F(MeshNodeTest, hasNoInstanceCullingPositionsByDefault)
+    {
+        EXPECT_EQ(nullptr, m_meshNode->getInstanceCullingPositions());
+    }
+
+    TEST_F(MeshNodeTest, setsAndRemovesInstanceCullingPositions)
+    {
+        const ArrayBuffer* positions = m_scene.createArrayBuffer(ramses::EDataType::Vector3F, 10u);
+        ASSERT_NE(nullptr, positions);
+        EXPECT_TRUE(m_meshNode->setInstanceCullingPositions(positions));
+        EXPECT_EQ(positions, m_meshNode->getInstanceCullingPositions());
+        EXPECT_EQ(positions->impl().getDataBufferHandle(), m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).instancePositions);
+
+        EXPECT_TRUE(m_meshNode->setInstanceCullingPositions(nullptr));
+        EXPECT_EQ(nullptr, m_meshNode->getInstanceCullingPositions());
+        EXPECT_FALSE(m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).instancePositions.isValid());
+    }
+
+    TEST_F(MeshNodeTest, failsToSetInstanceCullingPositionsOfOtherThanVector3Type)
+    {
+        const ArrayBuffer* positions = m_scene.createArrayBuffer(ramses::EDataType::Vector4F, 10u);
+        ASSERT_NE(nullptr, positions);
+        EXPECT_FALSE(m_meshNode->setInstanceCullingPositions(positions));
+        EXPECT_EQ(nullptr, m_meshNode->getInstanceCullingPositions());
+    }
+
+    TEST_F(MeshNodeTest, removesInstanceCullingPositionsWhenTheirArrayBufferIsDestroyed)
+    {
+        setAnAppearanceForTesting();
+        setAGeometryForTesting();
+
+        ArrayBuffer* positions = m_scene.createArrayBuffer(ramses::EDataType::Vector3F, 10u);
+        ASSERT_NE(nullptr, positions);
+        EXPECT_TRUE(m_meshNode->setInstanceCullingPositions(positions));
+        EXPECT_TRUE(m_scene.destroy(*positions));
+
+        EXPECT_EQ(nullptr, m_meshNode->getInstanceCullingPositions());
+        EXPECT_FALSE(m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).instancePositions.isValid());
+
+        // data buffer handle can be reused by a buffer of other type, it must not be used as instance positions
+        const ArrayBuffer* otherBuffer = m_scene.createArrayBuffer(ramses::EDataType::Vector4F, 10u);
+        ASSERT_NE(nullptr, otherBuffer);
+        EXPECT_EQ(nullptr, m_meshNode->getInstanceCullingPositions());
+
+        ValidationReport report;
+        m_meshNode->validate(report);
+        EXPECT_FALSE(report.hasError());
+    }
+
+    TEST_F(MeshNodeTest, hasNoLevelsOfDetailByDefault)
+    {
+        EXPECT_EQ(0u, m_meshNode->getLevelOfDetailCount());
+        uint32_t startIndex = 0u;
+        uint32_t indexCount = 0u;
+        float screenSize = 0.f;
+        EXPECT_FALSE(m_meshNode->getLevelOfDetail(0u, startIndex, indexCount, screenSize));
+    }
+
+    TEST_F(MeshNodeTest, addsAndRemovesLevelsOfDetail)
+    {
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(10u, 6u, 0.3f));
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(16u, 3u, 0.1f));
+        EXPECT_EQ(2u, m_meshNode->getLevelOfDetailCount());
+
+        uint32_t startIndex = 0u;
+        uint32_t indexCount = 0u;
+        float screenSize = 0.f;
+        EXPECT_TRUE(m_meshNode->getLevelOfDetail(1u, startIndex, indexCount, screenSize));
+        EXPECT_EQ(16u, startIndex);
+        EXPECT_EQ(3u, indexCount);
+        EXPECT_FLOAT_EQ(0.1f, screenSize);
+
+        const RenderableLevelsOfDetail& levelsOfDetail = m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).levelsOfDetail;
+        ASSERT_EQ(2u, levelsOfDetail.count);
+        EXPECT_EQ((RenderableLevelOfDetail{ 10u, 6u, 0.3f }), levelsOfDetail.levels[0]);
+        EXPECT_EQ((RenderableLevelOfDetail{ 16u, 3u, 0.1f }), levelsOfDetail.levels[1]);
+
+        EXPECT_TRUE(m_meshNode->removeLevelsOfDetail());
+        EXPECT_EQ(0u, m_meshNode->getLevelOfDetailCount());
+        EXPECT_EQ(0u, m_internalScene.getRenderable(m_meshNode->impl().getRenderableHandle()).levelsOfDetail.count);
+    }
+
+    TEST_F(MeshNodeTest, failsToAddLevelOfDetailWithInvalidParameters)
+    {
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 0u, 0.5f));
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 3u, 0.f));
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 3u, -0.5f));
+        EXPECT_EQ(0u, m_meshNode->getLevelOfDetailCount());
+
+        // screen sizes must decrease
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 3u, 0.5f));
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 3u, 0.5f));
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 3u, 0.6f));
+        EXPECT_EQ(1u, m_meshNode->getLevelOfDetailCount());
+    }
+
+    TEST_F(MeshNodeTest, failsToAddMoreThanMaximumNumberOfLevelsOfDetail)
+    {
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 3u, 0.5f));
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 3u, 0.4f));
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 3u, 0.3f));
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 3u, 0.2f));
+        EXPECT_FALSE(m_meshNode->addLevelOfDetail(0u, 3u, 0.1f));
+        EXPECT_EQ(4u, m_meshNode->getLevelOfDetailCount());
+    }
+
+    TEST_F(MeshNodeTest, failsValidationIfLevelOfDetailExceedsSizeOfIndexArray)
+    {
+        setAnAppearanceForTesting();
+        setAGeometryForTesting();
+        EXPECT_TRUE(m_meshNode->setBoundingSphere({ 0.f, 0.f, 0.f }, 1.f));
+
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 1u, 0.5f));
+        ValidationReport report;
+        m_meshNode->validate(report);
+        EXPECT_FALSE(report.hasIssue());
+
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(1u, 1u, 0.1f));
+        ValidationReport report2;
+        m_meshNode->validate(report2);
+        EXPECT_TRUE(report2.hasError());
+    }
+
+    TEST_F(MeshNodeTest, reportsWarningIfLevelsOfDetailAreUsedWithoutBoundingSphere)
+    {
+        setAnAppearanceForTesting();
+        setAGeometryForTesting();
+        EXPECT_TRUE(m_meshNode->addLevelOfDetail(0u, 1u, 0.5f));
+
+        ValidationReport report;
+        m_meshNode->validate(report);
+        EXPECT_TRUE(report.hasIssue());
+        EXPECT_FALSE(report.hasError());
+    }
+
     TEST_F(MeshNodeTest, succeedsValidationIfNotUsingIndexArray)
     {
         setAnAppearanceForTesting();
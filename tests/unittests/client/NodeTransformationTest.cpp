@@ -17,6 +17,9 @@
 #include "RamsesObjectTestTypes.h"
 #include "TestEqualHelper.h"
 #include "internal/Core/Math3d/Rotation.h"
+#include "internal/SceneGraph/Scene/ESceneActionId.h"
+
+#include <array>
 
 namespace ramses::internal
 {
@@ -240,4 +243,103 @@ namespace ramses::internal
         this->m_scene.flush();
         EXPECT_EQ(0u, this->sceneActionsCollector.getNumberOfActions());  // flush empty and optimized away
     }
+
+    class ANodeBulkTransformation : public LocalTestClientWithScene, public testing::Test
+    {
+    protected:
+        std::array<Node*, 2u> m_nodes{ &createObject<Node>("node1"), &createObject<MeshNode>("node2") };
+    };
+
+    TEST_F(ANodeBulkTransformation, setsAllTransformationComponents)
+    {
+        const std::array<vec3f, 2u> translations{ vec3f{ 1.f, 2.f, 3.f }, vec3f{ 4.f, 5.f, 6.f } };
+        const std::array<quat, 2u> rotations{ glm::angleAxis(0.5f, vec3f{ 1.f, 0.f, 0.f }), glm::angleAxis(1.5f, vec3f{ 0.f, 1.f, 0.f }) };
+        const std::array<vec3f, 2u> scalings{ vec3f{ 7.f, 8.f, 9.f }, vec3f{ 10.f, 11.f, 12.f } };
+        EXPECT_TRUE(m_scene.setNodeTransforms(m_nodes.size(), m_nodes.data(), translations.data(), rotations.data(), scalings.data()));
+
+        for (size_t i = 0u; i < m_nodes.size(); ++i)
+        {
+            vec3f translation;
+            quat rotation;
+            vec3f scaling;
+            EXPECT_TRUE(m_nodes[i]->getTranslation(translation));
+            EXPECT_TRUE(m_nodes[i]->getRotation(rotation));
+            EXPECT_TRUE(m_nodes[i]->getScaling(scaling));
+            EXPECT_EQ(translations[i], translation);
+            EXPECT_EQ(rotations[i], rotation);
+            EXPECT_EQ(ERotationType::Quaternion, m_nodes[i]->getRotationType());
+            EXPECT_EQ(scalings[i], scaling);
+        }
+    }
+
+    TEST_F(ANodeBulkTransformation, keepsComponentsNotGiven)
+    {
+        EXPECT_TRUE(m_nodes[0]->setTranslation({ 1.f, 2.f, 3.f }));
+        const std::array<vec3f, 2u> scalings{ vec3f{ 7.f, 8.f, 9.f }, vec3f{ 10.f, 11.f, 12.f } };
+        EXPECT_TRUE(m_scene.setNodeTransforms(m_nodes.size(), m_nodes.data(), nullptr, nullptr, scalings.data()));
+
+        vec3f translation;
+        vec3f scaling;
+        EXPECT_TRUE(m_nodes[0]->getTranslation(translation));
+        EXPECT_EQ(vec3f(1.f, 2.f, 3.f), translation);
+        EXPECT_EQ(ERotationType::Euler_XYZ, m_nodes[0]->getRotationType());
+        EXPECT_TRUE(m_nodes[1]->getScaling(scaling));
+        EXPECT_EQ(scalings[1], scaling);
+    }
+
+    TEST_F(ANodeBulkTransformation, failsWithoutModifyingAnyNodeIfNodeFromOtherSceneGiven)
+    {
+        ramses::Scene* otherScene = client.createScene(SceneConfig(sceneId_t(12u)));
+        ASSERT_NE(nullptr, otherScene);
+        const std::array<Node*, 2u> nodes{ m_nodes[0], otherScene->createNode() };
+        const std::array<vec3f, 2u> translations{ vec3f{ 1.f, 2.f, 3.f }, vec3f{ 4.f, 5.f, 6.f } };
+        EXPECT_FALSE(m_scene.setNodeTransforms(nodes.size(), nodes.data(), translations.data(), nullptr, nullptr));
+
+        const std::array<Node*, 2u> nodesWithNull{ m_nodes[0], nullptr };
+        EXPECT_FALSE(m_scene.setNodeTransforms(nodesWithNull.size(), nodesWithNull.data(), translations.data(), nullptr, nullptr));
+
+        vec3f translation;
+        EXPECT_TRUE(m_nodes[0]->getTranslation(translation));
+        EXPECT_EQ(vec3f(0.f), translation);
+
+        EXPECT_TRUE(client.destroy(*otherScene));
+    }
+
+    class ANodeBulkTransformationWithFeatureLevel02 : public LocalTestClientWithScene, public testing::Test
+    {
+    protected:
+        ANodeBulkTransformationWithFeatureLevel02()
+            : LocalTestClientWithScene(EFeatureLevel_02)
+        {
+        }
+
+        std::array<Node*, 2u> m_nodes{ &createObject<Node>("node1"), &createObject<MeshNode>("node2") };
+    };
+
+    TEST_F(ANodeBulkTransformationWithFeatureLevel02, setsTransformationComponentsWithoutBulkSceneAction)
+    {
+        const std::array<vec3f, 2u> translations{ vec3f{ 1.f, 2.f, 3.f }, vec3f{ 4.f, 5.f, 6.f } };
+        const std::array<quat, 2u> rotations{ glm::angleAxis(0.5f, vec3f{ 1.f, 0.f, 0.f }), glm::angleAxis(1.5f, vec3f{ 0.f, 1.f, 0.f }) };
+        EXPECT_TRUE(m_scene.setNodeTransforms(m_nodes.size(), m_nodes.data(), translations.data(), rotations.data(), nullptr));
+
+        for (size_t i = 0u; i < m_nodes.size(); ++i)
+        {
+            vec3f translation;
+            quat rotation;
+            EXPECT_TRUE(m_nodes[i]->getTranslation(translation));
+            EXPECT_TRUE(m_nodes[i]->getRotation(rotation));
+            EXPECT_EQ(translations[i], translation);
+            EXPECT_EQ(rotations[i], rotation);
+            EXPECT_EQ(ERotationType::Quaternion, m_nodes[i]->getRotationType());
+        }
+
+        for (const auto& action : m_internalScene.getSceneActionCollection())
+            EXPECT_NE(ESceneActionId::SetTransformsBulk, action.type());
+    }
+
+    TEST_F(ANodeBulkTransformation, succeedsWithNothingToSet)
+    {
+        EXPECT_TRUE(m_scene.setNodeTransforms(0u, nullptr, nullptr, nullptr, nullptr));
+        EXPECT_TRUE(m_scene.setNodeTransforms(m_nodes.size(), m_nodes.data(), nullptr, nullptr, nullptr));
+    }
 }
@@ -10,6 +10,8 @@
 #include <gtest/gtest.h>
 #include "ramses/client/EffectDescription.h"
 #include "ramses/client/ramses-utils.h"
+#include "ramses/client/Scene.h"
+#include "ramses/client/Node.h"
 
 #include "impl/RamsesClientImpl.h"
 #include "impl/SceneConfigImpl.h"
@@ -22,6 +24,8 @@
 #include "ClientEventHandlerMock.h"
 
 #include "internal/SceneReferencing/SceneReferenceEvent.h"
+#include <array>
+#include <thread>
 
 namespace ramses::internal
 {
@@ -116,6 +120,33 @@ namespace ramses::internal
         EXPECT_TRUE(m_framework.isConnected());
     }
 
+    TEST_F(ARamsesClient, canBuildAndFlushDifferentScenesFromMultipleThreadsConcurrently)
+    {
+        constexpr uint64_t numThreads = 4u;
+        std::array<bool, numThreads> success{};
+        std::vector<std::thread> threads;
+        for (uint64_t t = 0u; t < numThreads; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                ramses::Scene* scene = m_client.createScene(sceneId_t{ 100u + t });
+                bool result = (scene != nullptr);
+                for (uint32_t flushIdx = 0u; result && flushIdx < 10u; ++flushIdx)
+                {
+                    for (uint32_t i = 0u; i < 100u; ++i)
+                        scene->createNode()->setTranslation({ float(i), float(flushIdx), 0.f });
+                    const std::array<uint16_t, 3u> indices{ uint16_t(t), uint16_t(flushIdx), 0u };
+                    result = (scene->createArrayResource(3u, indices.data()) != nullptr) && scene->flush();
+                }
+                success[t] = result && m_client.destroy(*scene);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto threadSuccess : success)
+            EXPECT_TRUE(threadSuccess);
+    }
+
     TEST(RamsesClient, canCreateClientWithNULLNameAndCmdLineArguments)
     {
         RamsesFrameworkConfig config{EFeatureLevel_Latest};
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include <gtest/gtest.h>
+#include <algorithm>
 
 #include "ramses/client/RenderBuffer.h"
 #include "ramses/client/RenderPass.h"
@@ -135,6 +136,34 @@ namespace ramses::internal
         EXPECT_THAT(report.getIssues()[0].message, ::testing::HasSubstr("is used in a TextureSampler or BlitPass for reading, but assigned RenderPass is not enabled"));
     }
 
+    TEST_F(RenderBufferTest, reportsWarningInSceneValidationAfterRenderPassUsingItWasDisabled)
+    {
+        const ramses::RenderBuffer* renderBuffer = m_scene.createRenderBuffer(400u, 400u, ERenderBufferFormat::RGBA8, ERenderBufferAccessMode::ReadWrite);
+        ASSERT_TRUE(renderBuffer != nullptr);
+        auto rp = useInRenderPass(*renderBuffer);
+        m_scene.createTextureSampler(ETextureAddressMode::Clamp, ETextureAddressMode::Clamp, ETextureSamplingMethod::Nearest, ETextureSamplingMethod::Nearest, *renderBuffer);
+
+        const auto hasRenderBufferIssue = [&](const ValidationReport& report) {
+            const auto& issues = report.getIssues();
+            return std::any_of(issues.cbegin(), issues.cend(), [&](const auto& issue) { return issue.object == renderBuffer; });
+        };
+
+        ValidationReport report;
+        m_scene.validate(report);
+        EXPECT_FALSE(hasRenderBufferIssue(report));
+
+        // only render pass is modified, render buffer must be validated again nevertheless
+        rp->setEnabled(false);
+        report.clear();
+        m_scene.validate(report);
+        EXPECT_TRUE(hasRenderBufferIssue(report));
+
+        rp->setEnabled(true);
+        report.clear();
+        m_scene.validate(report);
+        EXPECT_FALSE(hasRenderBufferIssue(report));
+    }
+
     TEST_F(RenderBufferTest, validatesWhenUsedInRenderPassAndReferencedBySampler)
     {
         const ramses::RenderBuffer* renderBuffer = m_scene.createRenderBuffer(400u, 400u, ERenderBufferFormat::RGBA8, ERenderBufferAccessMode::ReadWrite);
@@ -398,6 +398,18 @@ namespace ramses::internal
         expectRenderGroupContained(*nestedRenderGroup, 999, renderGroup);
     }
 
+    TEST_F(ARenderGroup, keepsMeshContainedOnceWhenReaddingItWithSameOrder)
+    {
+        MeshNode* mesh = m_scene.createMeshNode();
+
+        EXPECT_TRUE(renderGroup.addMeshNode(*mesh, 5));
+        EXPECT_TRUE(renderGroup.addMeshNode(*mesh, 5));
+
+        expectMeshContained(*mesh, 5, renderGroup);
+        EXPECT_EQ(1u, renderGroup.impl().getAllMeshes().size());
+        EXPECT_EQ(1u, m_internalScene.getRenderGroup(renderGroup.impl().getRenderGroupHandle()).renderables.size());
+    }
+
     TEST_F(ARenderGroup, canChangeMeshOrderByRemovingItAndAddingAgain)
     {
         MeshNode* mesh = m_scene.createMeshNode();
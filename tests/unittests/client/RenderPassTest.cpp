@@ -697,4 +697,88 @@ namespace ramses::internal
     {
         EXPECT_FALSE(renderpass.retriggerRenderOnce());
     }
+
+    class ARenderPassWithFeatureLevel02 : public LocalTestClientWithScene, public testing::Test
+    {
+    protected:
+        ARenderPassWithFeatureLevel02()
+            : LocalTestClientWithScene(EFeatureLevel_02)
+            , renderpass(*m_scene.createRenderPass("RenderPass"))
+        {
+        }
+
+        ramses::RenderPass& renderpass;
+    };
+
+    TEST_F(ARenderPassWithFeatureLevel02, failsToEnableStateSorting)
+    {
+        EXPECT_FALSE(renderpass.setStateSorting(true));
+        EXPECT_FALSE(renderpass.isStateSorting());
+    }
+
+    TEST_F(ARenderPassWithFeatureLevel02, failsToEnableFrontToBackSorting)
+    {
+        EXPECT_FALSE(renderpass.setFrontToBackSorting(true));
+        EXPECT_FALSE(renderpass.isFrontToBackSorting());
+    }
+
+    TEST_F(ARenderPassWithFeatureLevel02, failsToEnableBackToFrontSorting)
+    {
+        EXPECT_FALSE(renderpass.setBackToFrontSorting(true));
+        EXPECT_FALSE(renderpass.isBackToFrontSorting());
+    }
+
+    TEST_F(ARenderPassWithFeatureLevel02, failsToEnableDepthPrePass)
+    {
+        EXPECT_FALSE(renderpass.setDepthPrePass(true));
+        EXPECT_FALSE(renderpass.hasDepthPrePass());
+    }
+
+    TEST_F(ARenderPass, isNotStateSortingInitially)
+    {
+        EXPECT_FALSE(renderpass.isStateSorting());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableStateSorting)
+    {
+        EXPECT_TRUE(renderpass.setStateSorting(true));
+        EXPECT_TRUE(renderpass.isStateSorting());
+        EXPECT_TRUE(renderpass.setStateSorting(false));
+        EXPECT_FALSE(renderpass.isStateSorting());
+    }
+
+    TEST_F(ARenderPass, isNotFrontToBackSortingAndHasNoDepthPrePassInitially)
+    {
+        EXPECT_FALSE(renderpass.isFrontToBackSorting());
+        EXPECT_FALSE(renderpass.hasDepthPrePass());
+    }
+
+    TEST_F(ARenderPass, isNotBackToFrontSortingInitially)
+    {
+        EXPECT_FALSE(renderpass.isBackToFrontSorting());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableFrontToBackSorting)
+    {
+        EXPECT_TRUE(renderpass.setFrontToBackSorting(true));
+        EXPECT_TRUE(renderpass.isFrontToBackSorting());
+        EXPECT_TRUE(renderpass.setFrontToBackSorting(false));
+        EXPECT_FALSE(renderpass.isFrontToBackSorting());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableBackToFrontSorting)
+    {
+        EXPECT_TRUE(renderpass.setBackToFrontSorting(true));
+        EXPECT_TRUE(renderpass.isBackToFrontSorting());
+        EXPECT_TRUE(renderpass.setBackToFrontSorting(false));
+        EXPECT_FALSE(renderpass.isBackToFrontSorting());
+    }
+
+    TEST_F(ARenderPass, canEnableAndDisableDepthPrePass)
+    {
+        EXPECT_TRUE(renderpass.setDepthPrePass(true));
+        EXPECT_TRUE(renderpass.hasDepthPrePass());
+        EXPECT_TRUE(renderpass.setDepthPrePass(false));
+        EXPECT_FALSE(renderpass.hasDepthPrePass());
+    }
 }
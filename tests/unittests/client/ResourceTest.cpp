@@ -23,6 +23,7 @@
 #include "RamsesObjectTestTypes.h"
 #include "ClientTestUtils.h"
 #include "internal/SceneGraph/Resource/IResource.h"
+#include "internal/SceneGraph/Resource/TextureResource.h"
 #include "internal/PlatformAbstraction/PlatformMemory.h"
 #include "internal/Components/ManagedResource.h"
 #include "impl/RamsesClientImpl.h"
@@ -265,6 +266,105 @@ namespace ramses::internal
         EXPECT_EQ(data1, res->getResourceData().span().subspan(data0.size()));
     }
 
+    TEST_F(AResourceTestClient, createTextureWithGeneratedMipChain_storesMipChainComputedOnClient)
+    {
+        const auto data0 = make_byte_vector(0, 4, 8, 12, 8, 12, 16, 20);
+        const Texture2D* texture = m_scene.createTexture2D(ETextureFormat::R8, 4, 2, { data0 }, true, {}, {});
+        ASSERT_TRUE(nullptr != texture);
+
+        const ramses::internal::ManagedResource res = getCreatedResource(texture->impl().getLowlevelResourceHash());
+        const auto* texRes = res->convertTo<ramses::internal::TextureResource>();
+        ASSERT_TRUE(nullptr != texRes);
+        EXPECT_FALSE(texRes->getGenerateMipChainFlag());
+        EXPECT_EQ(MipDataSizeVector({ 8u, 2u, 1u }), texRes->getMipDataSizes());
+
+        // 2x2 box filter, last level clamps filter footprint to single row
+        const auto expectedData = make_byte_vector(0, 4, 8, 12, 8, 12, 16, 20, 6, 14, 10);
+        EXPECT_EQ(expectedData, res->getResourceData().span());
+    }
+
+    TEST_F(AResourceTestClient, createCubeTextureWithGeneratedMipChain_storesMipChainComputedOnClientForEachFace)
+    {
+        const auto data0 = make_byte_vector(10, 20, 30, 40);
+        const std::vector<CubeMipLevelData> mipLevelData{ { data0, data0, data0, data0, data0, data0 } };
+        const TextureCube* texture = m_scene.createTextureCube(ETextureFormat::R8, 2, mipLevelData, true, {}, {});
+        ASSERT_TRUE(nullptr != texture);
+
+        const ramses::internal::ManagedResource res = getCreatedResource(texture->impl().getLowlevelResourceHash());
+        const auto* texRes = res->convertTo<ramses::internal::TextureResource>();
+        ASSERT_TRUE(nullptr != texRes);
+        EXPECT_FALSE(texRes->getGenerateMipChainFlag());
+        EXPECT_EQ(MipDataSizeVector({ 4u, 1u }), texRes->getMipDataSizes());
+        EXPECT_EQ(6u * (4u + 1u), res->getDecompressedDataSize());
+    }
+
+    TEST_F(AResourceTestClient, createSrgbTextureWithGeneratedMipChain_leavesMipChainGenerationToRenderer)
+    {
+        const std::vector<MipLevelData> mipLevelData{ std::vector<std::byte>(4u * 4u * 3u) };
+        const Texture2D* texture = m_scene.createTexture2D(ETextureFormat::SRGB8, 4, 4, mipLevelData, true, {}, {});
+        ASSERT_TRUE(nullptr != texture);
+
+        const ramses::internal::ManagedResource res = getCreatedResource(texture->impl().getLowlevelResourceHash());
+        const auto* texRes = res->convertTo<ramses::internal::TextureResource>();
+        ASSERT_TRUE(nullptr != texRes);
+        EXPECT_TRUE(texRes->getGenerateMipChainFlag());
+        EXPECT_EQ(MipDataSizeVector({ 4u * 4u * 3u }), texRes->getMipDataSizes());
+    }
+
+    // NOLINTNEXTLINE(modernize-avoid-c-arrays)
+    std::unique_ptr<std::byte[], void (*)(const std::byte*)> MakeOwnedData(const std::vector<std::byte>& data)
+    {
+        auto* ownedData = new std::byte[data.size()];
+        std::copy(data.cbegin(), data.cend(), ownedData);
+        return { ownedData, [](const std::byte* ptr) { delete[] ptr; } };
+    }
+
+    TEST_F(AResourceTestClient, createTextureTakingOverDataWithoutCopy)
+    {
+        const auto data = make_byte_vector(1, 2, 3, 4, 5, 6, 7, 8);
+        auto ownedData = MakeOwnedData(data);
+        const auto* ownedDataPtr = ownedData.get();
+        Texture2D* texture = m_scene.createTexture2D(ETextureFormat::RGBA8, 2, 1, std::move(ownedData), data.size(), false, {}, "name");
+        ASSERT_TRUE(nullptr != texture);
+        EXPECT_EQ(2u, texture->getWidth());
+        EXPECT_EQ(1u, texture->getHeight());
+        EXPECT_EQ(ETextureFormat::RGBA8, texture->getTextureFormat());
+
+        const ramses::internal::ManagedResource res = getCreatedResource(texture->impl().getLowlevelResourceHash());
+        EXPECT_EQ(ownedDataPtr, res->getResourceData().data());
+        EXPECT_EQ(data, res->getResourceData().span());
+    }
+
+    TEST_F(AResourceTestClient, createTextureTakingOverDataHasSameHashAsCopiedTexture)
+    {
+        const auto data = make_byte_vector(1, 2, 3, 4, 5, 6, 7, 8);
+        const Texture2D* texture = m_scene.createTexture2D(ETextureFormat::RGBA8, 2, 1, { data }, false, {}, "name");
+        const Texture2D* ownedTexture = m_scene.createTexture2D(ETextureFormat::RGBA8, 2, 1, MakeOwnedData(data), data.size(), false, {}, "name");
+        ASSERT_TRUE(nullptr != texture);
+        ASSERT_TRUE(nullptr != ownedTexture);
+        EXPECT_EQ(texture->impl().getLowlevelResourceHash(), ownedTexture->impl().getLowlevelResourceHash());
+    }
+
+    TEST_F(AResourceTestClient, createTextureTakingOverDataKeepsMipGenerationForRenderer)
+    {
+        const std::vector<std::byte> data(4 * 4 * 4);
+        const Texture2D* texture = m_scene.createTexture2D(ETextureFormat::RGBA8, 4, 4, MakeOwnedData(data), data.size(), true, {}, "name");
+        ASSERT_TRUE(nullptr != texture);
+
+        const ramses::internal::ManagedResource res = getCreatedResource(texture->impl().getLowlevelResourceHash());
+        const auto* texRes = res->convertTo<ramses::internal::TextureResource>();
+        EXPECT_TRUE(texRes->getGenerateMipChainFlag());
+        EXPECT_EQ(1u, texRes->getMipDataSizes().size());
+    }
+
+    TEST_F(AResourceTestClient, createTextureTakingOverDataFailsWithInvalidData)
+    {
+        const std::vector<std::byte> data(4 * 2 * 2);
+        EXPECT_EQ(nullptr, m_scene.createTexture2D(ETextureFormat::RGBA8, 2, 3, MakeOwnedData(data), data.size(), false, {}, "name"));
+        EXPECT_EQ(nullptr, m_scene.createTexture2D(ETextureFormat::RGBA8, 0, 2, MakeOwnedData(data), data.size(), false, {}, "name"));
+        EXPECT_EQ(nullptr, m_scene.createTexture2D(ETextureFormat::RGBA8, 2, 2, { nullptr, [](const std::byte* ptr) { delete[] ptr; } }, data.size(), false, {}, "name"));
+    }
+
     //##############################################################
     //##############    Cube Texture tests #########################
     //##############################################################
@@ -794,6 +894,38 @@ namespace ramses::internal
         EXPECT_TRUE(nullptr == a);
     }
 
+    TEST_F(AResourceTestClient, createArrayTakingOverDataWithoutCopy)
+    {
+        const std::vector<std::byte> data(3 * sizeof(vec3f), std::byte{ 7u });
+        auto ownedData = MakeOwnedData(data);
+        const auto* ownedDataPtr = ownedData.get();
+        const auto a = m_scene.createArrayResource(ramses::EDataType::Vector3F, 3u, std::move(ownedData));
+        ASSERT_TRUE(nullptr != a);
+        EXPECT_EQ(3u, a->getNumberOfElements());
+        EXPECT_EQ(ramses::EDataType::Vector3F, a->getDataType());
+
+        const ramses::internal::ManagedResource res = client.impl().getResource(a->impl().getLowlevelResourceHash());
+        EXPECT_EQ(ownedDataPtr, res->getResourceData().data());
+    }
+
+    TEST_F(AResourceTestClient, createArrayTakingOverDataHasSameHashAsCopiedArray)
+    {
+        const uint16_t data[3] = { 1u, 2u, 3u };
+        const auto a = m_scene.createArrayResource(3u, data);
+        const auto b = m_scene.createArrayResource(ramses::EDataType::UInt16, 3u, MakeOwnedData({ reinterpret_cast<const std::byte*>(data), reinterpret_cast<const std::byte*>(data) + sizeof(data) }));
+        ASSERT_TRUE(nullptr != a);
+        ASSERT_TRUE(nullptr != b);
+        EXPECT_EQ(a->impl().getLowlevelResourceHash(), b->impl().getLowlevelResourceHash());
+    }
+
+    TEST_F(AResourceTestClient, createArrayTakingOverDataFailsWithInvalidParameters)
+    {
+        const std::vector<std::byte> data(16u);
+        EXPECT_EQ(nullptr, m_scene.createArrayResource(ramses::EDataType::Float, 0u, MakeOwnedData(data)));
+        EXPECT_EQ(nullptr, m_scene.createArrayResource(ramses::EDataType::Matrix44F, 1u, MakeOwnedData(data)));
+        EXPECT_EQ(nullptr, m_scene.createArrayResource(ramses::EDataType::Float, 2u, { nullptr, [](const std::byte* ptr) { delete[] ptr; } }));
+    }
+
     TEST_F(AResourceTestClient, createVector2fArray)
     {
         const vec2f data[2] = { vec2f{1.f,2.f}, vec2f{3.f,4.f} };
@@ -9,6 +9,8 @@
 #include "ClientTestUtils.h"
 #include "internal/Core/Utils/File.h"
 #include "ramses/client/UniformInput.h"
+#include "ramses/client/logic/LogicEngine.h"
+#include "internal/ClientCommands/LogMemoryUtils.h"
 
 #include <gtest/gtest.h>
 
@@ -192,4 +194,58 @@ namespace ramses::internal
         EXPECT_EQ(EDepthWrite::Disabled, depthWrite);
     }
 
+    class AMemoryProfile : public LocalTestClientWithScene, public ::testing::Test
+    {
+    protected:
+        const SceneMemoryProfileEntry* findEntry(const SceneMemoryProfile& profile, std::string_view name)
+        {
+            const auto it = std::find_if(profile.cbegin(), profile.cend(), [name](const auto& entry) { return entry.name == name; });
+            return it != profile.cend() ? &*it : nullptr;
+        }
+    };
+
+    TEST_F(AMemoryProfile, reportsObjectPoolsAndPendingSceneActions)
+    {
+        m_scene.createNode();
+        const auto profile = GetMemoryProfileFromScene(m_scene.impl());
+
+        const auto* nodes = findEntry(profile, "Nodes");
+        ASSERT_NE(nullptr, nodes);
+        EXPECT_EQ(1u, nodes->usedCount);
+        EXPECT_LE(nodes->usedBytes, nodes->capacityBytes);
+
+        const auto* actions = findEntry(profile, "PendingSceneActions");
+        ASSERT_NE(nullptr, actions);
+        EXPECT_LT(0u, actions->usedCount);
+        EXPECT_LE(actions->usedBytes, actions->capacityBytes);
+    }
+
+    TEST_F(AMemoryProfile, reportsResourceBlobs)
+    {
+        const std::array<uint16_t, 4u> indices{ 0u, 1u, 2u, 3u };
+        m_scene.createArrayResource(4u, indices.data());
+        const auto profile = GetMemoryProfileFromScene(m_scene.impl());
+
+        const auto* resources = findEntry(profile, "Resources.Decompressed");
+        ASSERT_NE(nullptr, resources);
+        EXPECT_LE(1u, resources->usedCount);
+        EXPECT_LE(sizeof(indices), resources->usedBytes);
+    }
+
+    TEST_F(AMemoryProfile, reportsLuaMemoryOfLogicEngines)
+    {
+        m_scene.createLogicEngine("logic");
+        const auto profile = GetMemoryProfileFromScene(m_scene.impl());
+
+        const auto* lua = findEntry(profile, "LogicEngine.logic.Lua");
+        ASSERT_NE(nullptr, lua);
+        EXPECT_LT(0u, lua->usedBytes);
+    }
+
+    TEST_F(AMemoryProfile, canBeLoggedWithRamshCommand)
+    {
+        EXPECT_FALSE(getFramework().executeRamshCommand("memprofile"));
+        EXPECT_TRUE(getFramework().executeRamshCommand(fmt::format("memprofile {}", m_scene.getSceneId())));
+        EXPECT_TRUE(m_scene.flush());
+    }
 }
@@ -109,6 +109,49 @@ namespace ramses::internal
         EXPECT_EQ(nullptr, m_registry.findObjectByName<SceneObject>("name"));
     }
 
+    TEST_F(ASceneObjectRegistry, findsObjectsWithSameNameUntilAllRenamedOrDeleted)
+    {
+        auto dummyObject1 = createAndRegisterDummyObject();
+        auto dummyObject2 = createAndRegisterDummyObject();
+        dummyObject1->setName("name");
+        dummyObject2->setName("name");
+        EXPECT_EQ(dummyObject1, m_registry.findObjectByName<SceneObject>("name"));
+
+        dummyObject1->setName("newName");
+        EXPECT_EQ(dummyObject2, m_registry.findObjectByName<SceneObject>("name"));
+        EXPECT_EQ(dummyObject1, m_registry.findObjectByName<SceneObject>("newName"));
+
+        m_registry.destroyAndUnregisterObject(*dummyObject2);
+        EXPECT_EQ(nullptr, m_registry.findObjectByName<SceneObject>("name"));
+        EXPECT_EQ(dummyObject1, m_registry.findObjectByName<SceneObject>("newName"));
+    }
+
+    TEST_F(ASceneObjectRegistry, findsObjectWithEmptyName)
+    {
+        auto dummyObject1 = createAndRegisterDummyObject();
+        auto dummyObject2 = createAndRegisterDummyObject();
+        dummyObject1->setName("name");
+        EXPECT_EQ(dummyObject2, m_registry.findObjectByName<SceneObject>(""));
+        dummyObject2->setName("name");
+        EXPECT_EQ(nullptr, m_registry.findObjectByName<SceneObject>(""));
+    }
+
+    TEST_F(ASceneObjectRegistry, findsMultipleObjectsByName)
+    {
+        auto dummyObject1 = createAndRegisterDummyObject();
+        auto dummyObject2 = createAndRegisterDummyObject();
+        dummyObject1->setName("name1");
+        dummyObject2->setName("name2");
+
+        std::vector<SceneObject*> objects;
+        m_registry.findObjectsByName<SceneObject>({ "name2", "unknown", "name1" }, objects);
+        EXPECT_EQ((std::vector<SceneObject*>{ dummyObject2, nullptr, dummyObject1 }), objects);
+
+        std::vector<Node*> nodes;
+        m_registry.findObjectsByName<Node>({ "name1" }, nodes);
+        EXPECT_EQ((std::vector<Node*>{ dummyObject1 }), nodes);
+    }
+
     TEST_F(ASceneObjectRegistry, cannotRetrieveObjectInfoAfterObjectDeleted)
     {
         auto dummyObject = createAndRegisterDummyObject();
@@ -54,6 +54,7 @@
 #include "impl/MeshNodeImpl.h"
 #include "impl/ArrayBufferImpl.h"
 #include "impl/Texture2DBufferImpl.h"
+#include "impl/SceneFileSectionIndex.h"
 
 #include "internal/Core/Utils/File.h"
 #include "internal/SceneGraph/SceneAPI/IScene.h"
@@ -97,6 +98,37 @@ namespace ramses::internal
         EXPECT_NE(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {}));
     }
 
+    TEST_P(ASceneLoadedFromFile, writesSectionIndexCoveringSceneFile)
+    {
+        m_scene.createNode("node");
+        m_scene.createMeshNode("meshNode");
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+
+        SceneFileSectionIndex index;
+        ASSERT_TRUE(RamsesClientImpl::ReadSceneFileSectionIndex("someTemporaryFile.ram", index));
+
+        const auto* metadata = index.findSection(ESceneFileSection::SceneMetadata);
+        const auto* llScene = index.findSection(ESceneFileSection::LowLevelScene);
+        const auto* sceneObjects = index.findSection(ESceneFileSection::SceneObjects);
+        const auto* resources = index.findSection(ESceneFileSection::LowLevelResources);
+        ASSERT_TRUE(metadata && llScene && sceneObjects && resources);
+
+        // sections are contiguous in file
+        EXPECT_EQ(metadata->offset + metadata->size, llScene->offset);
+        EXPECT_EQ(llScene->offset + llScene->size, sceneObjects->offset);
+        EXPECT_EQ(sceneObjects->offset + sceneObjects->size, resources->offset);
+
+        for (const auto type : { ERamsesObjectType::Node, ERamsesObjectType::MeshNode })
+        {
+            const auto* objectsOfType = index.findSection(ESceneFileSection::SceneObjectsOfType, type);
+            ASSERT_NE(nullptr, objectsOfType);
+            EXPECT_GE(objectsOfType->offset, sceneObjects->offset);
+            EXPECT_LE(objectsOfType->offset + objectsOfType->size, sceneObjects->offset + sceneObjects->size);
+        }
+
+        EXPECT_NE(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", {}));
+    }
+
     TEST_P(ASceneLoadedFromFile, logsExporterMetadata)
     {
         ramses::SaveFileConfig config;
@@ -186,6 +218,48 @@ namespace ramses::internal
         EXPECT_EQ(123u, scene->getSceneId().getValue());
     }
 
+    TEST_P(ASceneLoadedFromFile, canReadSceneFromFileMemoryMapped)
+    {
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+
+        SceneConfig config;
+        config.setMemoryMappedLoadingEnabled(true);
+        auto scene = m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", config);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(123u, scene->getSceneId().getValue());
+    }
+
+    TEST_P(ASceneLoadedFromFile, canReadSceneFromFileDescriptorWithOffsetMemoryMapped)
+    {
+        EXPECT_TRUE(m_scene.saveToFile("someTemporaryFile.ram", {}));
+
+        size_t fileSize = 0;
+        {
+            // write to a file with offset which is not page aligned
+            ramses::internal::File inFile("someTemporaryFile.ram");
+            EXPECT_TRUE(inFile.getSizeInBytes(fileSize));
+            std::vector<unsigned char> data(fileSize);
+            size_t numBytesRead = 0;
+            EXPECT_TRUE(inFile.open(ramses::internal::File::Mode::ReadOnlyBinary));
+            EXPECT_EQ(ramses::internal::EStatus::Ok, inFile.read(data.data(), fileSize, numBytesRead));
+
+            ramses::internal::File outFile("someTemporaryFileWithOffset.ram");
+            EXPECT_TRUE(outFile.open(ramses::internal::File::Mode::WriteOverWriteOldBinary));
+
+            uint32_t zeroData = 0;
+            EXPECT_TRUE(outFile.write(&zeroData, sizeof(zeroData)));
+            EXPECT_TRUE(outFile.write(data.data(), data.size()));
+            EXPECT_TRUE(outFile.write(&zeroData, sizeof(zeroData)));
+        }
+
+        SceneConfig config;
+        config.setMemoryMappedLoadingEnabled(true);
+        const int fd = ramses::internal::FileDescriptorHelper::OpenFileDescriptorBinary("someTemporaryFileWithOffset.ram");
+        auto scene = m_clientForLoading.loadSceneFromFileDescriptor(fd, 4, fileSize, config);
+        ASSERT_NE(nullptr, scene);
+        EXPECT_EQ(123u, scene->getSceneId().getValue());
+    }
+
     TEST_P(ASceneLoadedFromFile, canReadSceneFromFileDescriptorCustomSceneId)
     {
         const char* filename = "someTemporaryFile.ram";
@@ -895,11 +969,16 @@ namespace ramses::internal
     TEST_P(ASceneLoadedFromFile, canReadWriteABasicRenderPass)
     {
         const int32_t renderOrder = 1;
+        const bool hasFeatureLevel03 = (GetParam() >= EFeatureLevel_03);
 
         ramses::RenderPass* renderPass = this->m_scene.createRenderPass("a renderpass");
         EXPECT_TRUE(renderPass->setRenderOrder(renderOrder));
         EXPECT_TRUE(renderPass->setEnabled(false));
         EXPECT_TRUE(renderPass->setRenderOnce(true));
+        EXPECT_EQ(hasFeatureLevel03, renderPass->setStateSorting(true));
+        EXPECT_EQ(hasFeatureLevel03, renderPass->setFrontToBackSorting(true));
+        EXPECT_EQ(hasFeatureLevel03, renderPass->setBackToFrontSorting(true));
+        EXPECT_EQ(hasFeatureLevel03, renderPass->setDepthPrePass(true));
 
         doWriteReadCycle();
 
@@ -910,6 +989,10 @@ namespace ramses::internal
         EXPECT_EQ(renderOrder, loadedRenderPass->getRenderOrder());
         EXPECT_FALSE(loadedRenderPass->isEnabled());
         EXPECT_TRUE(loadedRenderPass->isRenderOnce());
+        EXPECT_EQ(hasFeatureLevel03, loadedRenderPass->isStateSorting());
+        EXPECT_EQ(hasFeatureLevel03, loadedRenderPass->isFrontToBackSorting());
+        EXPECT_EQ(hasFeatureLevel03, loadedRenderPass->isBackToFrontSorting());
+        EXPECT_EQ(hasFeatureLevel03, loadedRenderPass->hasDepthPrePass());
     }
 
     TEST_P(ASceneLoadedFromFile, canReadWriteARenderPassWithACamera)
@@ -28,6 +28,7 @@
 #include "internal/Core/Utils/File.h"
 
 #include <string_view>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -135,6 +136,7 @@ namespace ramses::internal
 
     TEST_F(ARamsesFileLoadedInSeveralThread, canAsyncLoadSceneFile)
     {
+        EXPECT_CALL(eventHandler, sceneFileLoadProgress(StrEq(sceneFile), _, _)).Times(AtLeast(1));
         EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _));
         EXPECT_TRUE(client.loadSceneFromFileAsync(sceneFile));
         ASSERT_TRUE(waitForNumClientEvents(1));
@@ -143,6 +145,40 @@ namespace ramses::internal
         EXPECT_EQ(sceneId_t(123u), loadedScene->getSceneId());
     }
 
+    TEST_F(ARamsesFileLoadedInSeveralThread, reportsProgressOfAllSceneDataBeforeLoadSucceeded)
+    {
+        size_t bytesLoaded = 0u;
+        size_t bytesTotal = 0u;
+        {
+            InSequence seq;
+            EXPECT_CALL(eventHandler, sceneFileLoadProgress(StrEq(sceneFile), _, _)).Times(AtLeast(1)).WillRepeatedly(DoAll(SaveArg<1>(&bytesLoaded), SaveArg<2>(&bytesTotal)));
+            EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _));
+        }
+        EXPECT_TRUE(client.loadSceneFromFileAsync(sceneFile));
+        ASSERT_TRUE(waitForNumClientEvents(1));
+
+        EXPECT_GT(bytesTotal, 0u);
+        EXPECT_EQ(bytesTotal, bytesLoaded);
+    }
+
+    TEST_F(ARamsesFileLoadedInSeveralThread, canAsyncLoadSeveralSceneFilesAtOnceIncludingBackgroundLoad)
+    {
+        std::vector<Scene*> loadedScenes;
+        EXPECT_CALL(eventHandler, sceneFileLoadProgress(_, _, _)).Times(AtLeast(2));
+        EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(sceneFile), _)).WillOnce(DoAll(Invoke([&](auto, Scene* scene) { loadedScenes.push_back(scene); }), InvokeWithoutArgs(this, &ARamsesFileLoadedInSeveralThread::incNumClientEvents)));
+        EXPECT_CALL(eventHandler, sceneFileLoadSucceeded(StrEq(otherSceneFile), _)).WillOnce(DoAll(Invoke([&](auto, Scene* scene) { loadedScenes.push_back(scene); }), InvokeWithoutArgs(this, &ARamsesFileLoadedInSeveralThread::incNumClientEvents)));
+
+        SceneConfig backgroundConfig;
+        backgroundConfig.setBackgroundLoadingEnabled(true);
+        EXPECT_TRUE(client.loadSceneFromFileAsync(otherSceneFile, backgroundConfig));
+        EXPECT_TRUE(client.loadSceneFromFileAsync(sceneFile));
+        ASSERT_TRUE(waitForNumClientEvents(2));
+
+        ASSERT_EQ(2u, loadedScenes.size());
+        EXPECT_NE(nullptr, client.getScene(sceneId_t(123u)));
+        EXPECT_NE(nullptr, client.getScene(sceneId_t(124u)));
+    }
+
     TEST_F(ARamsesFileLoadedInSeveralThread, asyncLoadSceneFileWithoutEverCallingDispatchDoesNotLeakMemory)
     {
         EXPECT_TRUE(client.loadSceneFromFileAsync(sceneFile));
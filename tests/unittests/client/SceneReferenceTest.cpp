@@ -90,6 +90,55 @@ namespace ramses::internal
         EXPECT_EQ(RendererSceneState::Ready, this->getInternalScene().getSceneReference(sceneRefHandle).requestedState);
     }
 
+    class ASceneReferenceWithFeatureLevel02 : public LocalTestClientWithScene, public ::testing::Test
+    {
+    protected:
+        ASceneReferenceWithFeatureLevel02()
+            : LocalTestClientWithScene(EFeatureLevel_02)
+        {
+        }
+    };
+
+    TEST_F(ASceneReferenceWithFeatureLevel02, failsToSetPreloadHint)
+    {
+        ramses::SceneReference* sceneReference = this->m_scene.createSceneReference(sceneId_t(444), "testSceneReference");
+        ASSERT_NE(nullptr, sceneReference);
+        EXPECT_FALSE(sceneReference->setPreloadHint(RendererSceneState::Ready, 7));
+        EXPECT_EQ(RendererSceneState::Available, sceneReference->getPreloadState());
+        EXPECT_EQ(0, sceneReference->getPreloadPriority());
+    }
+
+    TEST_F(ASceneReference, hasNoPreloadHintInitially)
+    {
+        ramses::SceneReference* sceneReference = this->m_scene.createSceneReference(sceneId_t(444), "testSceneReference");
+        EXPECT_EQ(RendererSceneState::Available, sceneReference->getPreloadState());
+        EXPECT_EQ(0, sceneReference->getPreloadPriority());
+    }
+
+    TEST_F(ASceneReference, canSetPreloadHint)
+    {
+        ramses::SceneReference* sceneReference = this->m_scene.createSceneReference(sceneId_t(444), "testSceneReference");
+        EXPECT_TRUE(sceneReference->setPreloadHint(RendererSceneState::Ready, 7));
+        EXPECT_EQ(RendererSceneState::Ready, sceneReference->getPreloadState());
+        EXPECT_EQ(7, sceneReference->getPreloadPriority());
+
+        const auto& sr = this->getInternalScene().getSceneReference(sceneReference->impl().getSceneReferenceHandle());
+        EXPECT_EQ(RendererSceneState::Ready, sr.preloadState);
+        EXPECT_EQ(7, sr.preloadPriority);
+
+        EXPECT_TRUE(sceneReference->setPreloadHint(RendererSceneState::Available));
+        EXPECT_EQ(RendererSceneState::Available, sceneReference->getPreloadState());
+        EXPECT_EQ(0, sceneReference->getPreloadPriority());
+    }
+
+    TEST_F(ASceneReference, rejectsPreloadHintOtherThanAvailableOrReady)
+    {
+        ramses::SceneReference* sceneReference = this->m_scene.createSceneReference(sceneId_t(444), "testSceneReference");
+        EXPECT_FALSE(sceneReference->setPreloadHint(RendererSceneState::Unavailable));
+        EXPECT_FALSE(sceneReference->setPreloadHint(RendererSceneState::Rendered));
+        EXPECT_EQ(RendererSceneState::Available, sceneReference->getPreloadState());
+    }
+
     TEST_F(ASceneReference, rejectsLinkDataIfSceneReferencesAreInWrongState)
     {
         auto reference1 = m_scene.createSceneReference(sceneId_t(111));
@@ -51,6 +51,7 @@
 #include "FileDescriptorHelper.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include "internal/Components/FileInputStreamContainer.h"
+#include "internal/Core/Utils/File.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 
 using namespace testing;
@@ -303,6 +304,47 @@ namespace ramses::internal
         m_scene.destroy(*cameraWithoutValidValues);
     }
 
+    TEST_F(AScene, reportsSameIssuesWhenValidatedRepeatedlyWithoutModification)
+    {
+        m_scene.createRenderPass();
+        m_scene.createPerspectiveCamera();
+        ValidationReport report;
+        m_scene.validate(report);
+        ASSERT_TRUE(report.hasError());
+        const auto issues = report.getIssues();
+
+        report.clear();
+        m_scene.validate(report);
+        EXPECT_EQ(issues, report.getIssues());
+    }
+
+    TEST_F(AScene, revalidatesSceneObjectsModifiedSinceLastValidation)
+    {
+        ramses::RenderPass* pass = m_scene.createRenderPass();
+        PerspectiveCamera* perspCam = m_scene.createPerspectiveCamera();
+        ValidationReport report;
+        m_scene.validate(report);
+        EXPECT_TRUE(report.hasError());
+
+        pass->setCamera(*perspCam);
+        report.clear();
+        m_scene.validate(report);
+        // camera is validated as dependency of render pass and still invalid
+        EXPECT_TRUE(report.hasError());
+
+        perspCam->setFrustum(0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f);
+        perspCam->setViewport(0, 0, 100, 200);
+        report.clear();
+        m_scene.validate(report);
+        EXPECT_FALSE(report.hasError());
+
+        m_scene.destroy(*pass);
+        m_scene.destroy(*perspCam);
+        report.clear();
+        m_scene.validate(report);
+        EXPECT_FALSE(report.hasIssue());
+    }
+
     TEST_F(AScene, doesNotDestroyCameraWhileItIsStillUsedByARenderPass)
     {
         ramses::RenderPass* pass = m_scene.createRenderPass();
@@ -1712,6 +1754,20 @@ namespace ramses::internal
         EXPECT_CALL(sceneActionsCollector, handleSceneBecameUnavailable(_, _));
     }
 
+    TEST_F(AScene, canFindMultipleObjectsByName)
+    {
+        auto node = m_scene.createNode("node");
+        auto camera = m_scene.createPerspectiveCamera("camera");
+        auto logicEngine = m_scene.createLogicEngine("logic");
+        const auto logicObject = logicEngine->createTimerNode("timer");
+
+        EXPECT_EQ((std::vector<SceneObject*>{ camera, node, nullptr, logicObject, logicEngine }), m_scene.findObjects({ "camera", "node", "unknown", "timer", "logic" }));
+        EXPECT_TRUE(m_scene.findObjects({}).empty());
+
+        EXPECT_TRUE(node->setName("renamed"));
+        EXPECT_EQ((std::vector<SceneObject*>{ nullptr, node }), m_scene.findObjects({ "node", "renamed" }));
+    }
+
     TEST_F(AScene, canFindByNameWithSameNameUsedForDifferentTypes)
     {
         auto node = m_scene.createNode("test");
@@ -1871,6 +1927,22 @@ namespace ramses::internal
         EXPECT_TRUE(m_scene.saveToFile("tmp.ramses"));
     }
 
+    TEST_F(AScene, failsToSaveToFileIfWriteFailsAndKeepsTargetWhichIsNoRegularFile)
+    {
+        // writes to this device always fail as if disk was full
+        const std::string fullDevice{ "/dev/full" };
+        if (!ramses::internal::File(fullDevice).exists())
+            GTEST_SKIP() << fullDevice << " not available";
+
+        EXPECT_FALSE(m_scene.saveToFile(fullDevice));
+        const auto err = framework.getLastError();
+        ASSERT_TRUE(err);
+        EXPECT_EQ(&m_scene, err->object);
+        EXPECT_THAT(err->message, StartsWith("Scene::saveToFile failed, "));
+        EXPECT_THAT(err->message, HasSubstr(fullDevice));
+        EXPECT_TRUE(ramses::internal::File(fullDevice).exists());
+    }
+
     TEST_F(AScene, failsToSaveToFileIfLogicEngineUpdateFails)
     {
         const std::string_view srcCode = R"(
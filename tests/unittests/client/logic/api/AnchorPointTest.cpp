@@ -261,6 +261,47 @@ namespace ramses::internal
         EXPECT_FLOAT_EQ(0.019886762f, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
     }
 
+    TEST_F(AnAnchorPoint_Math, CalculatesCoordsFromNodeTransformationSetByBindingInSameUpdate)
+    {
+        const auto& anchorPoint = *m_logicEngine->createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine->update());
+        const auto initialCoords = *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>();
+
+        m_nodeBinding.getInputs()->getChild("translation")->set(vec3f{ 10.f, 20.f, 30.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        const auto coords = *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>();
+        const auto depth = *anchorPoint.getOutputs()->getChild(1u)->get<float>();
+        EXPECT_NE(initialCoords, coords);
+
+        // anchor point is updated every time, repeated update must not change its outputs anymore
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(coords, *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>());
+        EXPECT_EQ(depth, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
+    }
+
+    TEST_F(AnAnchorPoint_Math, CalculatesCoordsOfAnchorPointsSharingCamera)
+    {
+        auto otherNode = m_scene->createNode();
+        otherNode->setTranslation({ 1.f, 2.f, 3.f });
+        const auto& anchorPoint1 = *m_logicEngine->createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor1");
+        const auto& anchorPoint2 = *m_logicEngine->createAnchorPoint(*m_logicEngine->createNodeBinding(*otherNode), m_perspCameraBinding, "anchor2");
+        const auto& anchorPoint3 = *m_logicEngine->createAnchorPoint(m_nodeBinding, m_orthoCameraBinding, "anchor3");
+        EXPECT_TRUE(m_logicEngine->update());
+
+        EXPECT_FLOAT_EQ(17.560308f, (*anchorPoint1.getOutputs()->getChild(0u)->get<vec2f>())[0]);
+        EXPECT_FLOAT_EQ(19.317562f, (*anchorPoint1.getOutputs()->getChild(0u)->get<vec2f>())[1]);
+        EXPECT_NE(*anchorPoint1.getOutputs()->getChild(0u)->get<vec2f>(), *anchorPoint2.getOutputs()->getChild(0u)->get<vec2f>());
+        EXPECT_FLOAT_EQ(21.281908f, (*anchorPoint3.getOutputs()->getChild(0u)->get<vec2f>())[0]);
+        EXPECT_FLOAT_EQ(12.63566f, (*anchorPoint3.getOutputs()->getChild(0u)->get<vec2f>())[1]);
+
+        // camera data shared by anchor points is not kept between updates
+        const auto coords2 = *anchorPoint2.getOutputs()->getChild(0u)->get<vec2f>();
+        m_perspCameraBinding.getInputs()->getChild("viewport")->getChild("width")->set(60);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_NE(coords2, *anchorPoint2.getOutputs()->getChild(0u)->get<vec2f>());
+        EXPECT_FLOAT_EQ(21.281908f, (*anchorPoint3.getOutputs()->getChild(0u)->get<vec2f>())[0]);
+    }
+
     class AnAnchorPoint_Dirtiness : public AnAnchorPoint_Math
     {
     protected:
@@ -584,6 +584,25 @@ namespace ramses::internal
         advanceAnimationAndExpectValues_twoChannels(*animNode, 100.f, { 1.f, 20.f }, { 1.f, 20.f }); // stays at last keyframe after animation end
     }
 
+    TEST_P(AnAnimationNode, InterpolatesChannelsSharingTimestamps_withAdvancingAndJumpingProgress)
+    {
+        const auto timeStamps = m_logicEngine->createDataArray(std::vector<float>{ 0.f, 1.f, 2.f, 3.f });
+        const auto data1 = m_logicEngine->createDataArray(std::vector<vec2f>{ { 0.f, 0.f }, { 1.f, 10.f }, { 2.f, 20.f }, { 3.f, 30.f } });
+        const auto data2 = m_logicEngine->createDataArray(std::vector<vec2f>{ { 0.f, 0.f }, { -1.f, -10.f }, { -2.f, -20.f }, { -3.f, -30.f } });
+        const auto animNode = createAnimationNode({
+            { "channel1", timeStamps, data1, EInterpolationType::Linear },
+            { "channel2", timeStamps, data2, EInterpolationType::Linear },
+            });
+
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.1f, { 0.3f, 3.f }, { -0.3f, -3.f }); // time 0.3
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.2f, { 0.6f, 6.f }, { -0.6f, -6.f }); // time 0.6, same keyframes
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.5f, { 1.5f, 15.f }, { -1.5f, -15.f }); // time 1.5, next keyframes
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.9f, { 2.7f, 27.f }, { -2.7f, -27.f }); // time 2.7, skips keyframes
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.2f, { 0.6f, 6.f }, { -0.6f, -6.f }); // time 0.6, jumps back
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 100.f, { 3.f, 30.f }, { -3.f, -30.f }); // after animation end
+        advanceAnimationAndExpectValues_twoChannels(*animNode, 0.f, { 0.f, 0.f }, { 0.f, 0.f });
+    }
+
     TEST_P(AnAnimationNode, InterpolatesKeyframeValues_cubic_vecvec)
     {
         if (GetParam())
@@ -680,6 +699,24 @@ namespace ramses::internal
         advanceAnimationAndExpectValues(*animNode, 0.75f, 17.5f);
     }
 
+    TEST_P(AnAnimationNode, AnimatesIndependentlyWhenSharingDataArraysWithOtherAnimationNode)
+    {
+        const auto timeStamps = m_logicEngine->createDataArray(std::vector<float>{ 0.f, 1.f });
+        const auto data = m_logicEngine->createDataArray(std::vector<float>{ { 10.f, 20.f } });
+        const auto animNode1 = createAnimationNode({ { "channel", timeStamps, data, EInterpolationType::Linear } });
+        const auto animNode2 = createAnimationNode({ { "channel", timeStamps, data, EInterpolationType::Linear } });
+
+        EXPECT_TRUE(animNode2->getInputs()->getChild("progress")->set(0.25f));
+        advanceAnimationAndExpectValues(*animNode1, 0.5f, 15.f);
+        EXPECT_FLOAT_EQ(12.5f, *animNode2->getOutputs()->getChild("channel")->get<float>());
+
+        advanceAnimationAndExpectValues(*animNode2, 1.f, 20.f);
+        EXPECT_FLOAT_EQ(15.f, *animNode1->getOutputs()->getChild("channel")->get<float>());
+
+        EXPECT_EQ((std::vector<float>{ 0.f, 1.f }), *timeStamps->getData<float>());
+        EXPECT_EQ((std::vector<float>{ 10.f, 20.f }), *data->getData<float>());
+    }
+
     TEST_P(AnAnimationNode, GivesStableResultsWithExtremelySmallTimestamps)
     {
         constexpr float Eps = std::numeric_limits<float>::epsilon();
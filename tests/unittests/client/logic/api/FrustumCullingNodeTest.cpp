@@ -0,0 +1,382 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "RamsesTestUtils.h"
+#include "SerializationTestUtils.h"
+
+#include "impl/logic/LogicEngineImpl.h"
+#include "impl/logic/FrustumCullingNodeImpl.h"
+#include "impl/logic/PropertyImpl.h"
+#include "impl/logic/MeshNodeBindingImpl.h"
+#include "impl/logic/CameraBindingImpl.h"
+#include "impl/ErrorReporting.h"
+#include "internal/logic/flatbuffers/generated/FrustumCullingNodeGen.h"
+
+#include "ramses/client/logic/FrustumCullingNode.h"
+#include "ramses/client/logic/MeshNodeBinding.h"
+#include "ramses/client/logic/CameraBinding.h"
+#include "ramses/client/logic/NodeBinding.h"
+#include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/LogicEngine.h"
+
+#include "ramses/client/MeshNode.h"
+#include "ramses/client/OrthographicCamera.h"
+
+namespace ramses::internal
+{
+    class AFrustumCullingNode : public ALogicEngine
+    {
+    protected:
+        void SetUp() override
+        {
+            // default camera looks along -z, frustum is x,y in [-1, 1] and z in [-0.1, -1]
+            m_meshNode->setTranslation({ 0.f, 0.f, -0.5f });
+            m_otherMeshNode.setTranslation({ 5.f, 0.f, -0.5f });
+        }
+
+        static void SetBoundingSphere(const FrustumCullingNode& cullingNode, size_t index, const vec3f& center, float radius)
+        {
+            auto* sphere = cullingNode.getInputs()->getChild("bounds")->getChild(index);
+            ASSERT_TRUE(sphere->getChild("center")->set(center));
+            ASSERT_TRUE(sphere->getChild("radius")->set(radius));
+        }
+
+        static bool IsVisible(const FrustumCullingNode& cullingNode, size_t index)
+        {
+            return *cullingNode.getOutputs()->getChild("visible")->getChild(index)->get<bool>();
+        }
+
+        static int32_t VisibleCount(const FrustumCullingNode& cullingNode)
+        {
+            return *cullingNode.getOutputs()->getChild("visibleCount")->get<int32_t>();
+        }
+
+        MeshNode& m_otherMeshNode{ *m_scene->createMeshNode("otherMeshNode") };
+        CameraBinding& m_cameraBinding{ *m_logicEngine->createCameraBinding(*m_camera) };
+        MeshNodeBinding& m_meshNodeBinding{ *m_logicEngine->createMeshNodeBinding(*m_meshNode, "meshBinding") };
+        MeshNodeBinding& m_otherMeshNodeBinding{ *m_logicEngine->createMeshNodeBinding(m_otherMeshNode, "otherMeshBinding") };
+    };
+
+    TEST_F(AFrustumCullingNode, ReferencesBindings)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+        EXPECT_EQ(&m_cameraBinding.getRamsesCamera(), &cullingNode.getRamsesCamera());
+        ASSERT_EQ(2u, cullingNode.getMeshNodeCount());
+        EXPECT_EQ(m_meshNode, &cullingNode.getRamsesMeshNode(0u));
+        EXPECT_EQ(&m_otherMeshNode, &cullingNode.getRamsesMeshNode(1u));
+        EXPECT_EQ(&m_cameraBinding.impl(), &cullingNode.impl().getCameraBinding());
+    }
+
+    TEST_F(AFrustumCullingNode, HasInputsAndOutputsForEveryMeshNode)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+        ASSERT_NE(nullptr, cullingNode.getInputs());
+        ASSERT_EQ(1u, cullingNode.getInputs()->getChildCount());
+        const auto* bounds = cullingNode.getInputs()->getChild("bounds");
+        ASSERT_NE(nullptr, bounds);
+        EXPECT_EQ(EPropertyType::Array, bounds->getType());
+        ASSERT_EQ(2u, bounds->getChildCount());
+        EXPECT_EQ(EPropertyType::Vec3f, bounds->getChild(1u)->getChild("center")->getType());
+        EXPECT_EQ(EPropertyType::Float, bounds->getChild(1u)->getChild("radius")->getType());
+
+        ASSERT_NE(nullptr, cullingNode.getOutputs());
+        ASSERT_EQ(2u, cullingNode.getOutputs()->getChildCount());
+        const auto* visible = cullingNode.getOutputs()->getChild("visible");
+        ASSERT_NE(nullptr, visible);
+        ASSERT_EQ(2u, visible->getChildCount());
+        EXPECT_EQ(EPropertyType::Bool, visible->getChild(0u)->getType());
+        EXPECT_EQ(EPropertyType::Int32, cullingNode.getOutputs()->getChild("visibleCount")->getType());
+    }
+
+    TEST_F(AFrustumCullingNode, FailsToCreateWithoutMeshNodeBindings)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine->createFrustumCullingNode(m_cameraBinding, {}, "culling"));
+        EXPECT_EQ(getLastErrorMessage(), "Failed to create FrustumCullingNode 'culling': number of mesh node bindings must be between 1 and 255.");
+    }
+
+    TEST_F(AFrustumCullingNode, FailsToCreateWithBindingsFromAnotherInstance)
+    {
+        auto& otherLogicEngine = *m_scene->createLogicEngine();
+        auto* otherCameraBinding = otherLogicEngine.createCameraBinding(*m_camera);
+        auto* otherMeshNodeBinding = otherLogicEngine.createMeshNodeBinding(*m_meshNode);
+
+        EXPECT_EQ(nullptr, m_logicEngine->createFrustumCullingNode(*otherCameraBinding, { &m_meshNodeBinding }, "culling"));
+        EXPECT_EQ(getLastErrorMessage(), "Failed to create FrustumCullingNode 'culling': provided Ramses camera binding and/or mesh node bindings were not found in this logic instance.");
+        EXPECT_EQ(nullptr, m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, otherMeshNodeBinding }, "culling"));
+        EXPECT_EQ(getLastErrorMessage(), "Failed to create FrustumCullingNode 'culling': provided Ramses camera binding and/or mesh node bindings were not found in this logic instance.");
+    }
+
+    TEST_F(AFrustumCullingNode, SetsVisibilityOfMeshNodesInsideAndOutsideOfFrustum)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+        EXPECT_TRUE(m_logicEngine->update());
+
+        EXPECT_TRUE(IsVisible(cullingNode, 0u));
+        EXPECT_FALSE(IsVisible(cullingNode, 1u));
+        EXPECT_EQ(1, VisibleCount(cullingNode));
+        EXPECT_EQ(EVisibilityMode::Visible, m_meshNode->getVisibility());
+        EXPECT_EQ(EVisibilityMode::Invisible, m_otherMeshNode.getVisibility());
+    }
+
+    TEST_F(AFrustumCullingNode, KeepsMeshNodeVisibleIfBoundingSphereIntersectsFrustum)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+        SetBoundingSphere(cullingNode, 1u, { 0.f, 0.f, 0.f }, 4.5f);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(IsVisible(cullingNode, 1u));
+        EXPECT_EQ(2, VisibleCount(cullingNode));
+        EXPECT_EQ(EVisibilityMode::Visible, m_otherMeshNode.getVisibility());
+
+        // sphere center is given in local space of mesh node
+        SetBoundingSphere(cullingNode, 1u, { 10.f, 0.f, 0.f }, 4.5f);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_FALSE(IsVisible(cullingNode, 1u));
+        EXPECT_EQ(EVisibilityMode::Invisible, m_otherMeshNode.getVisibility());
+    }
+
+    TEST_F(AFrustumCullingNode, TakesScalingOfMeshNodeIntoAccountForRadius)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_otherMeshNodeBinding }, "culling");
+        SetBoundingSphere(cullingNode, 0u, { 0.f, 0.f, 0.f }, 1.f);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_FALSE(IsVisible(cullingNode, 0u));
+
+        m_otherMeshNode.setScaling({ 1.f, 5.f, 1.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(IsVisible(cullingNode, 0u));
+    }
+
+    TEST_F(AFrustumCullingNode, UpdatesVisibilityFromNodeTransformationSetByBindingInSameUpdate)
+    {
+        auto& nodeBinding = *m_logicEngine->createNodeBinding(m_otherMeshNode);
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_otherMeshNodeBinding }, "culling");
+        nodeBinding.getInputs()->getChild("translation")->set(vec3f{ 5.f, 0.f, -0.5f });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_FALSE(IsVisible(cullingNode, 0u));
+
+        nodeBinding.getInputs()->getChild("translation")->set(vec3f{ 0.5f, 0.f, -0.5f });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(IsVisible(cullingNode, 0u));
+        EXPECT_EQ(EVisibilityMode::Visible, m_otherMeshNode.getVisibility());
+    }
+
+    TEST_F(AFrustumCullingNode, UpdatesVisibilityWhenCameraChanges)
+    {
+        const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1, VisibleCount(cullingNode));
+
+        m_camera->setTranslation({ 5.f, 0.f, 0.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_FALSE(IsVisible(cullingNode, 0u));
+        EXPECT_TRUE(IsVisible(cullingNode, 1u));
+        EXPECT_EQ(EVisibilityMode::Invisible, m_meshNode->getVisibility());
+        EXPECT_EQ(EVisibilityMode::Visible, m_otherMeshNode.getVisibility());
+    }
+
+    TEST_F(AFrustumCullingNode, SetsVisibilityToRamsesOnlyWhenCullingResultChanges)
+    {
+        m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding }, "culling");
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(EVisibilityMode::Visible, m_meshNode->getVisibility());
+
+        // visibility changed by user is kept as long as culling result stays same
+        m_meshNode->setVisibility(EVisibilityMode::Off);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(EVisibilityMode::Off, m_meshNode->getVisibility());
+
+        m_meshNode->setTranslation({ 0.f, 0.f, 5.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(EVisibilityMode::Invisible, m_meshNode->getVisibility());
+    }
+
+    TEST_F(AFrustumCullingNode, ProducesErrorOnUpdateIfCameraNotInitialized)
+    {
+        const auto uninitializedCamera = m_scene->createOrthographicCamera();
+        m_logicEngine->createFrustumCullingNode(*m_logicEngine->createCameraBinding(*uninitializedCamera), { &m_meshNodeBinding }, "culling");
+        EXPECT_FALSE(m_logicEngine->update());
+        EXPECT_EQ(getLastErrorMessage(), "Failed to retrieve projection matrix from Ramses camera!");
+    }
+
+    TEST_F(AFrustumCullingNode, CannotDestroyBindingsUsedByFrustumCullingNode)
+    {
+        auto* cullingNode = m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+
+        EXPECT_FALSE(m_logicEngine->destroy(m_cameraBinding));
+        EXPECT_EQ(getLastErrorMessage(), "Failed to destroy Ramses camera binding '', it is used in frustum culling node 'culling'");
+        EXPECT_FALSE(m_logicEngine->destroy(m_otherMeshNodeBinding));
+        EXPECT_EQ(getLastErrorMessage(), "Failed to destroy Ramses mesh node binding 'otherMeshBinding', it is used in frustum culling node 'culling'");
+
+        EXPECT_TRUE(m_logicEngine->destroy(*cullingNode));
+        EXPECT_TRUE(m_logicEngine->destroy(m_otherMeshNodeBinding));
+        EXPECT_TRUE(m_logicEngine->destroy(m_cameraBinding));
+    }
+
+    TEST_F(AFrustumCullingNode, ExtractsNormalizedPlanesPointingInsideOfFrustum)
+    {
+        const auto planes = FrustumCullingNodeImpl::ExtractFrustumPlanes(glm::identity<matrix44f>());
+        EXPECT_EQ(vec4f(1.f, 0.f, 0.f, 1.f), planes[0]);
+        EXPECT_EQ(vec4f(-1.f, 0.f, 0.f, 1.f), planes[1]);
+        EXPECT_EQ(vec4f(0.f, 1.f, 0.f, 1.f), planes[2]);
+        EXPECT_EQ(vec4f(0.f, -1.f, 0.f, 1.f), planes[3]);
+        EXPECT_EQ(vec4f(0.f, 0.f, 1.f, 1.f), planes[4]);
+        EXPECT_EQ(vec4f(0.f, 0.f, -1.f, 1.f), planes[5]);
+    }
+
+    TEST_F(AFrustumCullingNode, KeepsCullingAfterSaveAndLoad)
+    {
+        {
+            const auto& cullingNode = *m_logicEngine->createFrustumCullingNode(m_cameraBinding, { &m_meshNodeBinding, &m_otherMeshNodeBinding }, "culling");
+            SetBoundingSphere(cullingNode, 1u, { -4.f, 0.f, 0.f }, 0.5f);
+            ASSERT_TRUE(saveToFile("culling.tmp"));
+        }
+
+        ASSERT_TRUE(recreateFromFile("culling.tmp"));
+        const auto* cullingNode = m_logicEngine->findObject<FrustumCullingNode>("culling");
+        ASSERT_NE(nullptr, cullingNode);
+        ASSERT_EQ(2u, cullingNode->getMeshNodeCount());
+        EXPECT_EQ(m_meshNode, &cullingNode->getRamsesMeshNode(0u));
+        EXPECT_EQ("otherMeshNode", cullingNode->getRamsesMeshNode(1u).getName());
+        EXPECT_EQ(m_camera, &cullingNode->getRamsesCamera());
+
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(IsVisible(*cullingNode, 0u));
+        EXPECT_TRUE(IsVisible(*cullingNode, 1u));
+        EXPECT_EQ(2, VisibleCount(*cullingNode));
+    }
+
+    class AFrustumCullingNode_Serialization : public AFrustumCullingNode
+    {
+    protected:
+        enum class ESerializationIssue
+        {
+            AllValid,
+            MissingName,
+            MissingRootInput,
+            MissingMeshNodeBindings,
+            PropertyInvalid,
+            CannotResolveCameraBinding,
+            CannotResolveMeshNodeBinding
+        };
+
+        std::unique_ptr<FrustumCullingNodeImpl> deserializeSerializedDataWithIssue(ESerializationIssue issue)
+        {
+            {
+                FrustumCullingNodeImpl cullingNode(m_scene->impl(), m_cameraBinding.impl(), { &m_meshNodeBinding.impl() }, "name", sceneObjectId_t{ 1u });
+                cullingNode.createRootProperties();
+
+                const EPropertyType visibleCountType = (issue == ESerializationIssue::PropertyInvalid ? EPropertyType::Float : EPropertyType::Int32);
+                auto outputs = std::make_unique<PropertyImpl>(HierarchicalTypeData({ "", EPropertyType::Struct }, {
+                        MakeArray("visible", 1u, EPropertyType::Bool),
+                        MakeType("visibleCount", visibleCountType)
+                    }), EPropertySemantics::ScriptOutput);
+
+                const std::vector<uint64_t> meshNodeBindingIds{ m_meshNodeBinding.getSceneObjectId().getValue() };
+                auto fbCullingNode = rlogic_serialization::CreateFrustumCullingNode(
+                    m_flatBufferBuilder,
+                    rlogic_serialization::CreateLogicObject(m_flatBufferBuilder, (issue == ESerializationIssue::MissingName ? 0 : m_flatBufferBuilder.CreateString("name")), 1u),
+                    m_cameraBinding.getSceneObjectId().getValue(),
+                    (issue == ESerializationIssue::MissingMeshNodeBindings ? 0 : m_flatBufferBuilder.CreateVector(meshNodeBindingIds)),
+                    (issue == ESerializationIssue::MissingRootInput ? 0 : PropertyImpl::Serialize(cullingNode.getInputs()->impl(), m_flatBufferBuilder, m_serializationMap)),
+                    PropertyImpl::Serialize(*outputs, m_flatBufferBuilder, m_serializationMap));
+                m_flatBufferBuilder.Finish(fbCullingNode);
+            }
+
+            if (issue != ESerializationIssue::CannotResolveCameraBinding)
+                m_deserializationMap.storeLogicObject(m_cameraBinding.getSceneObjectId(), m_cameraBinding.impl());
+            if (issue != ESerializationIssue::CannotResolveMeshNodeBinding)
+                m_deserializationMap.storeLogicObject(m_meshNodeBinding.getSceneObjectId(), m_meshNodeBinding.impl());
+
+            const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::FrustumCullingNode>(m_flatBufferBuilder.GetBufferPointer());
+            return FrustumCullingNodeImpl::Deserialize(serialized, m_errorReporting, m_deserializationMap);
+        }
+
+        flatbuffers::FlatBufferBuilder m_flatBufferBuilder;
+        ErrorReporting m_errorReporting;
+        SerializationMap m_serializationMap;
+        DeserializationMap m_deserializationMap{ m_scene->impl() };
+    };
+
+    TEST_F(AFrustumCullingNode_Serialization, DeserializesAllData)
+    {
+        {
+            FrustumCullingNodeImpl cullingNode(m_scene->impl(), m_cameraBinding.impl(), { &m_meshNodeBinding.impl(), &m_otherMeshNodeBinding.impl() }, "name", sceneObjectId_t{ 1u });
+            cullingNode.createRootProperties();
+            (void)FrustumCullingNodeImpl::Serialize(cullingNode, m_flatBufferBuilder, m_serializationMap);
+        }
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::FrustumCullingNode>(m_flatBufferBuilder.GetBufferPointer());
+
+        m_deserializationMap.storeLogicObject(m_cameraBinding.getSceneObjectId(), m_cameraBinding.impl());
+        m_deserializationMap.storeLogicObject(m_meshNodeBinding.getSceneObjectId(), m_meshNodeBinding.impl());
+        m_deserializationMap.storeLogicObject(m_otherMeshNodeBinding.getSceneObjectId(), m_otherMeshNodeBinding.impl());
+
+        std::unique_ptr<FrustumCullingNodeImpl> deserialized = FrustumCullingNodeImpl::Deserialize(serialized, m_errorReporting, m_deserializationMap);
+        ASSERT_TRUE(deserialized);
+        EXPECT_FALSE(m_errorReporting.getError().has_value());
+
+        EXPECT_EQ(deserialized->getName(), "name");
+        EXPECT_EQ(deserialized->getSceneObjectId().getValue(), 1u);
+        ASSERT_TRUE(deserialized->getInputs());
+        EXPECT_EQ(2u, deserialized->getInputs()->getChild("bounds")->getChildCount());
+        ASSERT_TRUE(deserialized->getOutputs());
+        EXPECT_EQ(2u, deserialized->getOutputs()->getChild("visible")->getChildCount());
+        EXPECT_EQ(&m_cameraBinding.impl(), &deserialized->getCameraBinding());
+        const std::vector<MeshNodeBindingImpl*> expectedMeshNodeBindings{ &m_meshNodeBinding.impl(), &m_otherMeshNodeBinding.impl() };
+        EXPECT_EQ(expectedMeshNodeBindings, deserialized->getMeshNodeBindings());
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, CanSerializeWithNoIssue)
+    {
+        EXPECT_TRUE(deserializeSerializedDataWithIssue(ESerializationIssue::AllValid));
+        EXPECT_FALSE(m_errorReporting.getError().has_value());
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_MissingName)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::MissingName));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode from serialized data: missing name and/or ID!");
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_MissingRootInput)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::MissingRootInput));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode from serialized data: missing root input and/or output!");
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_MissingMeshNodeBindings)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::MissingMeshNodeBindings));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode from serialized data: missing or corrupted mesh node bindings!");
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_PropertyInvalid)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::PropertyInvalid));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode: missing or invalid properties!");
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_UnresolvedCameraBinding)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::CannotResolveCameraBinding));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode: could not resolve CameraBinding!");
+    }
+
+    TEST_F(AFrustumCullingNode_Serialization, ReportsSerializationError_UnresolvedMeshNodeBinding)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::CannotResolveMeshNodeBinding));
+        ASSERT_TRUE(m_errorReporting.getError().has_value());
+        EXPECT_EQ(m_errorReporting.getError()->message, "Fatal error during loading of FrustumCullingNode: could not resolve MeshNodeBinding!");
+    }
+}
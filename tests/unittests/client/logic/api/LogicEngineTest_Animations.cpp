@@ -19,7 +19,9 @@
 #include "ramses/client/RamsesClient.h"
 #include "ramses/client/Scene.h"
 #include "ramses/client/Node.h"
+#include "impl/logic/LogicEngineImpl.h"
 #include "LogicEngineTest_Base.h"
+#include "fmt/format.h"
 #include <thread>
 
 namespace ramses::internal
@@ -293,4 +295,76 @@ namespace ramses::internal
         setTickerAndUpdate(1000000);
         expectNodeValues(1.f, 0.f);
     }
+
+    TEST_F(ALogicEngine_Animations, ParallelUpdateIsDisabledByDefault)
+    {
+        EXPECT_FALSE(m_logicEngine->isParallelUpdateEnabled());
+        m_logicEngine->enableParallelUpdate(true);
+        EXPECT_TRUE(m_logicEngine->isParallelUpdateEnabled());
+        m_logicEngine->enableParallelUpdate(false);
+        EXPECT_FALSE(m_logicEngine->isParallelUpdateEnabled());
+    }
+
+    TEST_F(ALogicEngine_Animations, UpdatesIndependentAnimationsInParallelAndPropagatesTheirOutputs)
+    {
+        constexpr size_t NumAnimations = 2u * LogicEngineImpl::MinAnimationNodesForParallelUpdate;
+
+        const auto sumScript = m_logicEngine->createLuaScript(fmt::format(R"(
+            function interface(IN,OUT)
+                IN.values = Type:Array({}, Type:Float())
+                OUT.sum = Type:Float()
+            end
+            function run(IN,OUT)
+                local sum = 0
+                for i = 1, rl_len(IN.values) do
+                    sum = sum + IN.values[i]
+                end
+                OUT.sum = sum
+            end
+            )", NumAnimations));
+        ASSERT_NE(nullptr, sumScript);
+
+        std::vector<AnimationNode*> animations;
+        const auto timestamps = m_logicEngine->createDataArray(std::vector<float>{ 0.f, 1.f });
+        for (size_t i = 0u; i < NumAnimations; ++i)
+        {
+            const auto keyframes = m_logicEngine->createDataArray(std::vector<float>{ 0.f, static_cast<float>(i) });
+            AnimationNodeConfig config;
+            config.addChannel({ "channel", timestamps, keyframes, EInterpolationType::Linear });
+            animations.push_back(m_logicEngine->createAnimationNode(config));
+            ASSERT_TRUE(m_logicEngine->link(*animations.back()->getOutputs()->getChild("channel"), *sumScript->getInputs()->getChild("values")->getChild(i)));
+        }
+
+        m_logicEngine->enableParallelUpdate(true);
+
+        float expectedSum = 0.f;
+        for (size_t i = 0u; i < NumAnimations; ++i)
+        {
+            animations[i]->getInputs()->getChild("progress")->set(0.5f);
+            expectedSum += 0.5f * static_cast<float>(i);
+        }
+        ASSERT_TRUE(m_logicEngine->update());
+        for (size_t i = 0u; i < NumAnimations; ++i)
+        {
+            EXPECT_FLOAT_EQ(0.5f * static_cast<float>(i), *animations[i]->getOutputs()->getChild("channel")->get<float>());
+        }
+        EXPECT_FLOAT_EQ(expectedSum, *sumScript->getOutputs()->getChild("sum")->get<float>());
+
+        // only some of animations changed
+        animations[1]->getInputs()->getChild("progress")->set(1.f);
+        animations[3]->getInputs()->getChild("progress")->set(0.f);
+        expectedSum += 0.5f * 1.f - 0.5f * 3.f;
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_FLOAT_EQ(1.f, *animations[1]->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(0.f, *animations[3]->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(expectedSum, *sumScript->getOutputs()->getChild("sum")->get<float>());
+
+        // same results when updated serially
+        m_logicEngine->enableParallelUpdate(false);
+        for (size_t i = 0u; i < NumAnimations; ++i)
+            animations[i]->getInputs()->getChild("progress")->set(0.25f);
+        ASSERT_TRUE(m_logicEngine->update());
+        EXPECT_FLOAT_EQ(0.25f * static_cast<float>(NumAnimations * (NumAnimations - 1u) / 2u), *sumScript->getOutputs()->getChild("sum")->get<float>());
+    }
 }
+
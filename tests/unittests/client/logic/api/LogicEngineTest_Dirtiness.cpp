@@ -421,6 +421,103 @@ namespace ramses::internal
         EXPECT_EQ(15, *script2->getOutputs()->getChild("data")->get<int32_t>());
     }
 
+    TEST_F(ALogicEngine_Dirtiness, CollectsNodesWhichBecomeDirty)
+    {
+        LuaScript* script1 = m_logicEngine->createLuaScript(m_minimal_script);
+        LuaScript* script2 = m_logicEngine->createLuaScript(m_minimal_script);
+        const NodeSet& dirtyNodes = m_apiObjects.getLogicNodeDependencies().getDirtyNodes();
+        EXPECT_EQ((NodeSet{ &script1->impl(), &script2->impl() }), dirtyNodes);
+
+        m_logicEngine->update();
+        EXPECT_TRUE(dirtyNodes.empty());
+
+        script2->getInputs()->getChild("data")->set<int32_t>(3);
+        EXPECT_EQ((NodeSet{ &script2->impl() }), dirtyNodes);
+
+        EXPECT_TRUE(m_logicEngine->destroy(*script2));
+        EXPECT_TRUE(dirtyNodes.empty());
+    }
+
+    TEST_F(ALogicEngine_Dirtiness, UpdatesDirtyNodesAndNodesDirtiedViaLinksInTopologicalOrder)
+    {
+        // created in reverse order of links so that creation order differs from topological order
+        LuaScript* script3 = m_logicEngine->createLuaScript(m_minimal_script);
+        LuaScript* script2 = m_logicEngine->createLuaScript(m_minimal_script);
+        LuaScript* script1 = m_logicEngine->createLuaScript(m_minimal_script);
+        LuaScript* unrelatedScript = m_logicEngine->createLuaScript(m_minimal_script);
+        ASSERT_TRUE(m_logicEngine->link(*script2->getOutputs()->getChild("data"), *script3->getInputs()->getChild("data")));
+        ASSERT_TRUE(m_logicEngine->link(*script1->getOutputs()->getChild("data"), *script2->getInputs()->getChild("data")));
+        EXPECT_TRUE(m_logicEngine->update());
+
+        script1->getInputs()->getChild("data")->set<int32_t>(5);
+        EXPECT_FALSE(unrelatedScript->impl().isDirty());
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(5, *script3->getOutputs()->getChild("data")->get<int32_t>());
+        EXPECT_FALSE(script1->impl().isDirty());
+        EXPECT_FALSE(script2->impl().isDirty());
+        EXPECT_FALSE(script3->impl().isDirty());
+        EXPECT_TRUE(m_apiObjects.getLogicNodeDependencies().getDirtyNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_Dirtiness, UpdatesTargetOfWeakLinkInNextUpdate)
+    {
+        const std::string_view incrementingScript = R"(
+            function interface(IN,OUT)
+                IN.data = Type:Int32()
+                OUT.data = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.data = IN.data + 1
+            end
+        )";
+        LuaScript* script1 = m_logicEngine->createLuaScript(m_minimal_script);
+        LuaScript* script2 = m_logicEngine->createLuaScript(incrementingScript);
+        ASSERT_TRUE(m_logicEngine->link(*script1->getOutputs()->getChild("data"), *script2->getInputs()->getChild("data")));
+        ASSERT_TRUE(m_logicEngine->linkWeak(*script2->getOutputs()->getChild("data"), *script1->getInputs()->getChild("data")));
+
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1, *script2->getOutputs()->getChild("data")->get<int32_t>());
+        EXPECT_TRUE(script1->impl().isDirty());
+        EXPECT_FALSE(script2->impl().isDirty());
+
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(2, *script2->getOutputs()->getChild("data")->get<int32_t>());
+        EXPECT_TRUE(script1->impl().isDirty());
+    }
+
+    TEST_F(ALogicEngine_Dirtiness, KeepsNodesNotUpdatedDueToErrorDirtyForNextUpdate)
+    {
+        const std::string_view scriptWithFixableError = R"(
+            function interface(IN,OUT)
+                IN.triggerError = Type:Bool()
+                OUT.data = Type:Int32()
+            end
+            function run(IN,OUT)
+                if IN.triggerError then
+                    error("Snag!")
+                end
+                OUT.data = 7
+            end
+        )";
+        LuaScript* script1 = m_logicEngine->createLuaScript(scriptWithFixableError);
+        LuaScript* script2 = m_logicEngine->createLuaScript(m_minimal_script);
+        ASSERT_TRUE(m_logicEngine->link(*script1->getOutputs()->getChild("data"), *script2->getInputs()->getChild("data")));
+        LuaScript* script3 = m_logicEngine->createLuaScript(m_minimal_script);
+        ASSERT_TRUE(m_logicEngine->link(*script2->getOutputs()->getChild("data"), *script3->getInputs()->getChild("data")));
+
+        script1->getInputs()->getChild("triggerError")->set<bool>(true);
+        EXPECT_FALSE(m_logicEngine->update());
+        EXPECT_TRUE(script1->impl().isDirty());
+        EXPECT_TRUE(script2->impl().isDirty());
+        EXPECT_TRUE(script3->impl().isDirty());
+
+        script1->getInputs()->getChild("triggerError")->set<bool>(false);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(7, *script3->getOutputs()->getChild("data")->get<int32_t>());
+        EXPECT_FALSE(script2->impl().isDirty());
+        EXPECT_FALSE(script3->impl().isDirty());
+    }
+
     class ALogicEngine_BindingDirtiness : public ALogicEngine_Dirtiness
     {
     protected:
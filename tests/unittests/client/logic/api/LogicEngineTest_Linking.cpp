@@ -281,6 +281,25 @@ namespace ramses::internal
             " Create a loop-free link graph before calling update()!", getLastErrorMessage());
     }
 
+    TEST_F(ALogicEngine_Linking, UpdatesAgainAfterLinkCycleWasRemoved)
+    {
+        LuaScript& loopScript = *m_logicEngine->createLuaScript(m_minimalLinkScript);
+        Property* sourceInput = m_sourceScript.getInputs()->getChild("target");
+        Property* sourceOutput = m_sourceScript.getOutputs()->getChild("source");
+        Property* targetInput = m_targetScript.getInputs()->getChild("target");
+        Property* targetOutput = m_targetScript.getOutputs()->getChild("source");
+        Property* loopInput = loopScript.getInputs()->getChild("target");
+        Property* loopOutput = loopScript.getOutputs()->getChild("source");
+
+        EXPECT_TRUE(m_logicEngine->link(*sourceOutput, *targetInput));
+        EXPECT_TRUE(m_logicEngine->link(*targetOutput, *loopInput));
+        EXPECT_TRUE(m_logicEngine->link(*loopOutput, *sourceInput));
+        EXPECT_FALSE(m_logicEngine->update());
+
+        EXPECT_TRUE(m_logicEngine->unlink(*loopOutput, *sourceInput));
+        EXPECT_TRUE(m_logicEngine->update());
+    }
+
     TEST_F(ALogicEngine_Linking, PropagatesValuesAcrossMultipleLinksInAChain)
     {
         auto scriptSource = R"(
@@ -0,0 +1,111 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include <gmock/gmock.h>
+#include "LogicEngineTest_Base.h"
+#include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/LuaScript.h"
+#include "ramses/client/logic/NodeBinding.h"
+
+#include <sstream>
+
+namespace ramses::internal
+{
+    class ALogicEngine_Profiling : public ALogicEngine
+    {
+    protected:
+        static std::vector<std::string> GetStacks(const std::string& foldedStacks)
+        {
+            std::vector<std::string> stacks;
+            std::istringstream lines{ foldedStacks };
+            for (std::string line; std::getline(lines, line);)
+            {
+                const auto valueSeparator = line.rfind(' ');
+                EXPECT_NE(std::string::npos, valueSeparator) << line;
+                stacks.push_back(line.substr(0u, valueSeparator));
+            }
+            return stacks;
+        }
+
+        const std::string_view m_scriptSource = R"(
+            function interface(IN,OUT)
+                IN.count = Type:Int32()
+                OUT.sum = Type:Int32()
+            end
+            local function accumulate(count)
+                local sum = 0
+                for i = 1, count do
+                    sum = sum + i
+                end
+                return sum
+            end
+            function run(IN,OUT)
+                OUT.sum = accumulate(IN.count)
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_Profiling, HasNoResultsIfProfilingNotEnabled)
+    {
+        ASSERT_NE(nullptr, m_logicEngine->createLuaScript(m_scriptSource, {}, "script"));
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(m_logicEngine->getProfilingResults().empty());
+    }
+
+    TEST_F(ALogicEngine_Profiling, AggregatesNativeLogicNodesPerType)
+    {
+        ramses::Node* otherNode = m_scene->createNode();
+        NodeBinding* nodeBinding1 = m_logicEngine->createNodeBinding(*m_node);
+        NodeBinding* nodeBinding2 = m_logicEngine->createNodeBinding(*otherNode);
+        nodeBinding1->getInputs()->getChild("translation")->set(vec3f{ 1.f, 2.f, 3.f });
+        nodeBinding2->getInputs()->getChild("translation")->set(vec3f{ 4.f, 5.f, 6.f });
+
+        m_logicEngine->enableProfiling(true);
+        EXPECT_TRUE(m_logicEngine->update());
+
+        EXPECT_THAT(GetStacks(m_logicEngine->getProfilingResults()), ::testing::ElementsAre("NodeBinding"));
+    }
+
+    TEST_F(ALogicEngine_Profiling, SamplesLuaFunctionsOfScripts)
+    {
+        LuaScript* script = m_logicEngine->createLuaScript(m_scriptSource, {}, "my script");
+        ASSERT_NE(nullptr, script);
+        script->getInputs()->getChild("count")->set(1000);
+
+        m_logicEngine->enableProfiling(true, 10u);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(500500, *script->getOutputs()->getChild("sum")->get<int32_t>());
+
+        const auto stacks = GetStacks(m_logicEngine->getProfilingResults());
+        ASSERT_FALSE(stacks.empty());
+        for (const auto& stack : stacks)
+            EXPECT_THAT(stack, ::testing::StartsWith("LuaScript;my_script;")) << stack;
+        EXPECT_THAT(stacks, ::testing::Contains(::testing::HasSubstr(";accumulate:6")));
+    }
+
+    TEST_F(ALogicEngine_Profiling, DiscardsResultsWhenEnabledAgainAndKeepsThemWhenDisabled)
+    {
+        LuaScript* script = m_logicEngine->createLuaScript(m_scriptSource, {}, "script");
+        ASSERT_NE(nullptr, script);
+        script->getInputs()->getChild("count")->set(10);
+
+        m_logicEngine->enableProfiling(true);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_FALSE(m_logicEngine->getProfilingResults().empty());
+
+        m_logicEngine->enableProfiling(false);
+        const auto results = m_logicEngine->getProfilingResults();
+        EXPECT_FALSE(results.empty());
+        script->getInputs()->getChild("count")->set(20);
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(results, m_logicEngine->getProfilingResults());
+
+        m_logicEngine->enableProfiling(true);
+        EXPECT_TRUE(m_logicEngine->getProfilingResults().empty());
+    }
+}
@@ -28,6 +28,8 @@
 #include "impl/logic/LogicNodeImpl.h"
 #include "impl/logic/LogicEngineImpl.h"
 #include "impl/logic/LuaScriptImpl.h"
+#include "internal/logic/SolState.h"
+#include "internal/logic/SolWrapper.h"
 
 #include "fmt/format.h"
 
@@ -463,4 +465,127 @@ namespace ramses::internal
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    TEST_F(ALogicEngine_Update, UpdatesOnlyNodesReachableFromSubgraphRoots)
+    {
+        m_logicEngine->enableUpdateReport(true);
+
+        auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.inFloat = Type:Float()
+                OUT.outFloat = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.outFloat = IN.inFloat
+            end
+        )";
+
+        auto source1 = m_logicEngine->createLuaScript(scriptSource, {});
+        auto target1 = m_logicEngine->createLuaScript(scriptSource, {});
+        auto source2 = m_logicEngine->createLuaScript(scriptSource, {});
+        auto target2 = m_logicEngine->createLuaScript(scriptSource, {});
+        ASSERT_TRUE(m_logicEngine->link(*source1->getOutputs()->getChild("outFloat"), *target1->getInputs()->getChild("inFloat")));
+        ASSERT_TRUE(m_logicEngine->link(*source2->getOutputs()->getChild("outFloat"), *target2->getInputs()->getChild("inFloat")));
+        ASSERT_TRUE(m_logicEngine->update());
+
+        source1->getInputs()->getChild("inFloat")->set(1.f);
+        source2->getInputs()->getChild("inFloat")->set(2.f);
+        ASSERT_TRUE(m_logicEngine->updateSubgraph({ source1 }));
+
+        auto executedNodes = m_logicEngine->getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(2u, executedNodes.size());
+        EXPECT_EQ(source1, executedNodes[0].first);
+        EXPECT_EQ(target1, executedNodes[1].first);
+        EXPECT_FLOAT_EQ(1.f, *target1->getOutputs()->getChild("outFloat")->get<float>());
+        EXPECT_FLOAT_EQ(0.f, *target2->getOutputs()->getChild("outFloat")->get<float>());
+
+        // change outside of updated subgraph is kept until the node is updated
+        EXPECT_TRUE(source2->impl().isDirty());
+        ASSERT_TRUE(m_logicEngine->updateSubgraph({ target2 }));
+        EXPECT_TRUE(m_logicEngine->getLastUpdateReport().getNodesExecuted().empty());
+
+        ASSERT_TRUE(m_logicEngine->update());
+        executedNodes = m_logicEngine->getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(2u, executedNodes.size());
+        EXPECT_EQ(source2, executedNodes[0].first);
+        EXPECT_EQ(target2, executedNodes[1].first);
+        EXPECT_FLOAT_EQ(2.f, *target2->getOutputs()->getChild("outFloat")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_Update, FailsToUpdateSubgraphWithRootFromOtherLogicEngine)
+    {
+        auto otherEngine = m_scene->createLogicEngine("other");
+        auto otherScript = otherEngine->createLuaScript(m_valid_empty_script, {}, "otherScript");
+
+        EXPECT_FALSE(m_logicEngine->updateSubgraph({ otherScript }));
+        expectError("Failed to update subgraph, root node 'otherScript' does not belong to this logic engine!", otherScript);
+
+        EXPECT_FALSE(m_logicEngine->updateSubgraph({ nullptr }));
+        expectError("Failed to update subgraph, null root node given!", m_logicEngine);
+    }
+
+    TEST_F(ALogicEngine_Update, KeepsScriptsWorkingWithAllGarbageCollectorSettings)
+    {
+        constexpr auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.count = Type:Int32()
+                OUT.sum = Type:Int32()
+            end
+            function run(IN,OUT)
+                local temporaries = {}
+                for i = 1, IN.count do
+                    temporaries[i] = { value = i }
+                end
+                local sum = 0
+                for _, t in ipairs(temporaries) do
+                    sum = sum + t.value
+                end
+                OUT.sum = sum
+            end
+        )";
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        LuaScript* script = m_logicEngine->createLuaScript(scriptSource, config);
+        ASSERT_NE(nullptr, script);
+
+        const auto updateWithCount = [&](int32_t count) {
+            script->getInputs()->getChild("count")->set(count);
+            EXPECT_TRUE(m_logicEngine->update());
+            EXPECT_EQ(count * (count + 1) / 2, *script->getOutputs()->getChild("sum")->get<int32_t>());
+        };
+
+        EXPECT_TRUE(m_logicEngine->setLuaGarbageCollectorMode(ELuaGarbageCollectorMode::Incremental, 150u, 300u));
+        updateWithCount(100);
+        m_logicEngine->setLuaGarbageCollectorStepBudget(64u);
+        updateWithCount(200);
+#if LUA_VERSION_NUM >= 504
+        EXPECT_TRUE(m_logicEngine->setLuaGarbageCollectorMode(ELuaGarbageCollectorMode::Generational, 20u, 100u));
+        updateWithCount(300);
+        m_logicEngine->setLuaGarbageCollectorStepBudget(0u);
+        updateWithCount(400);
+#else
+        EXPECT_FALSE(m_logicEngine->setLuaGarbageCollectorMode(ELuaGarbageCollectorMode::Generational));
+        expectError("Failed to set Lua garbage collector mode, generational mode is not supported by the Lua version used!", m_logicEngine);
+#endif
+    }
+
+    TEST_F(ALogicEngine_Update, SavesGarbageCollectorSettingsToFile)
+    {
+        withTempDirectory();
+        EXPECT_TRUE(m_logicEngine->impl().getApiObjects().getSolState().isAutomaticGarbageCollectionRunning());
+
+        EXPECT_TRUE(m_logicEngine->setLuaGarbageCollectorMode(ELuaGarbageCollectorMode::Incremental, 150u, 300u));
+        m_logicEngine->setLuaGarbageCollectorStepBudget(64u);
+        EXPECT_FALSE(m_logicEngine->impl().getApiObjects().getSolState().isAutomaticGarbageCollectionRunning());
+        ASSERT_TRUE(saveToFile("logic_gcSettings.bin"));
+
+        ASSERT_TRUE(recreateFromFile("logic_gcSettings.bin"));
+        expectNoError();
+        EXPECT_FALSE(m_logicEngine->impl().getApiObjects().getSolState().isAutomaticGarbageCollectionRunning());
+
+        m_logicEngine->setLuaGarbageCollectorStepBudget(0u);
+        ASSERT_TRUE(saveToFile("logic_gcSettings.bin"));
+        ASSERT_TRUE(recreateFromFile("logic_gcSettings.bin"));
+        EXPECT_TRUE(m_logicEngine->impl().getApiObjects().getSolState().isAutomaticGarbageCollectionRunning());
+    }
 }
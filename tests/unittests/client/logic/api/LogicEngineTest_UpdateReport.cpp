@@ -9,6 +9,7 @@
 #include <gmock/gmock.h>
 #include "LogicEngineTest_Base.h"
 #include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/LuaModule.h"
 #include <numeric>
 
 namespace ramses::internal
@@ -289,4 +290,64 @@ namespace ramses::internal
             EXPECT_GE(report.getTotalUpdateExecutionTime(), report.getTopologySortExecutionTime() + nodesUpdatesTime);
         }
     }
+
+    TEST_F(ALogicEngine_UpdateReport, HasLuaMemoryOfScriptsAndModules)
+    {
+        constexpr auto scriptSource = R"(
+            local cache = {}
+            function interface(IN,OUT)
+                IN.count = Type:Int32()
+                OUT.size = Type:Int32()
+            end
+            function run(IN,OUT)
+                for i = 1, IN.count do
+                    cache[#cache + 1] = { value = i }
+                end
+                OUT.size = #cache
+            end
+        )";
+
+        LuaModule* module = m_logicEngine->createLuaModule(R"(
+            local mymath = {}
+            mymath.values = {}
+            for i = 1, 100 do
+                mymath.values[i] = { value = i }
+            end
+            return mymath
+        )", {}, "module");
+        ASSERT_NE(nullptr, module);
+        LuaScript* script = m_logicEngine->createLuaScript(scriptSource);
+        ASSERT_NE(nullptr, script);
+
+        // no automatic collection so memory kept by script is not reduced by freeing garbage
+        m_logicEngine->setLuaGarbageCollectorStepBudget(1u);
+        m_logicEngine->enableUpdateReport(true);
+        script->getInputs()->getChild("count")->set(1000);
+        EXPECT_TRUE(m_logicEngine->update());
+
+        const auto report = m_logicEngine->getLastUpdateReport();
+        ASSERT_EQ(1u, report.getLuaMemoryChangePerScript().size());
+        EXPECT_EQ(script, report.getLuaMemoryChangePerScript()[0].first);
+        EXPECT_GT(report.getLuaMemoryChangePerScript()[0].second, 1000 * 16);
+
+        ASSERT_EQ(1u, report.getLuaMemoryPerModule().size());
+        EXPECT_EQ(module, report.getLuaMemoryPerModule()[0].first);
+        EXPECT_GT(report.getLuaMemoryPerModule()[0].second, 100u * 16u);
+
+        EXPECT_GT(report.getLuaMemoryUsage(), static_cast<size_t>(report.getLuaMemoryChangePerScript()[0].second) + report.getLuaMemoryPerModule()[0].second);
+    }
+
+    TEST_F(ALogicEngine_UpdateReport, HasNoLuaMemoryIfNoScriptExecuted)
+    {
+        LuaScript* script = m_logicEngine->createLuaScript(m_valid_empty_script);
+        ASSERT_NE(nullptr, script);
+        EXPECT_TRUE(m_logicEngine->update());
+
+        m_logicEngine->enableUpdateReport(true);
+        EXPECT_TRUE(m_logicEngine->update());
+        const auto report = m_logicEngine->getLastUpdateReport();
+        EXPECT_TRUE(report.getLuaMemoryChangePerScript().empty());
+        EXPECT_TRUE(report.getLuaMemoryPerModule().empty());
+        EXPECT_GT(report.getLuaMemoryUsage(), 0u);
+    }
 }
@@ -45,6 +45,17 @@ namespace ramses::internal
         LuaConfig config;
         EXPECT_TRUE(config.impl().getModuleMapping().empty());
         EXPECT_FALSE(config.impl().hasDebugLogFunctionsEnabled());
+        EXPECT_FALSE(config.impl().hasTrustedNumericConversionsEnabled());
+    }
+
+    TEST_F(ALuaConfig, EnablesTrustedNumericConversions)
+    {
+        LuaConfig config;
+        config.enableTrustedNumericConversions();
+        EXPECT_TRUE(config.impl().hasTrustedNumericConversionsEnabled());
+
+        LuaConfig configCopy(config);
+        EXPECT_TRUE(configCopy.impl().hasTrustedNumericConversionsEnabled());
     }
 
     TEST_F(ALuaConfig, IsCopied)
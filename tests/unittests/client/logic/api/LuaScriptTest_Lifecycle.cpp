@@ -421,4 +421,52 @@ namespace ramses::internal
         loadedScript = *m_logicEngine->getCollection<LuaScript>().begin();
         EXPECT_EQ(42, *loadedScript->getInputs()->getChild("data")->get<int32_t>());
     }
+
+    TEST_F(ALuaScript_LifecycleWithFiles, LoadsScriptsAndModulesSavedAsSourceCodeOnly)
+    {
+        {
+            LuaModule* module = m_logicEngine->createLuaModule(R"(
+                local mymath = {}
+                function mymath.double(x)
+                    return x * 2
+                end
+                return mymath
+            )", {}, "mymath");
+            ASSERT_NE(nullptr, module);
+
+            for (const auto* name : { "script1", "script2", "script3" })
+            {
+                auto script = m_logicEngine->createLuaScript(R"(
+                    modules("mymath")
+                    function interface(IN,OUT)
+                        IN.value = Type:Int32()
+                        OUT.value = Type:Int32()
+                    end
+                    function run(IN,OUT)
+                        OUT.value = mymath.double(IN.value)
+                    end
+                )", CreateDeps({ { "mymath", module } }), name);
+                ASSERT_NE(nullptr, script);
+            }
+
+            SaveFileConfig config;
+            config.setLuaSavingMode(ELuaSavingMode::SourceCodeOnly);
+            EXPECT_TRUE(saveToFile("source_only.bin", config));
+        }
+
+        EXPECT_TRUE(recreateFromFile("source_only.bin"));
+        expectNoError();
+        int32_t value = 1;
+        for (const auto* name : { "script1", "script2", "script3" })
+        {
+            auto* script = m_logicEngine->findObject<LuaScript>(name);
+            ASSERT_NE(nullptr, script);
+            EXPECT_TRUE(script->getInputs()->getChild("value")->set<int32_t>(value++));
+        }
+        EXPECT_TRUE(m_logicEngine->update());
+
+        EXPECT_EQ(2, *m_logicEngine->findObject<LuaScript>("script1")->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(4, *m_logicEngine->findObject<LuaScript>("script2")->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(6, *m_logicEngine->findObject<LuaScript>("script3")->getOutputs()->getChild("value")->get<int32_t>());
+    }
 }
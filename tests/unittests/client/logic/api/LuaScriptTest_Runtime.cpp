@@ -1216,6 +1216,54 @@ namespace ramses::internal
         EXPECT_EQ(1, *int64Output->get<int64_t>());
     }
 
+    TEST_F(ALuaScript_Runtime, SkipsRangeChecksOfNumericOutputsWithTrustedNumericConversions)
+    {
+        LuaConfig config;
+        config.enableTrustedNumericConversions();
+        auto* script = m_logicEngine->createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.float = Type:Float()
+                OUT.int = Type:Int32()
+                OUT.int64 = Type:Int64()
+                OUT.vec3i = Type:Vec3i()
+                OUT.nested = { vec4f = Type:Vec4f() }
+            end
+            function run(IN,OUT)
+                OUT.int = IN.float
+                OUT.int64 = IN.float
+                OUT.vec3i = { IN.float, 1, -IN.float }
+                OUT.nested.vec4f = { IN.float, 1, 2, 3 }
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        script->getInputs()->getChild("float")->set<float>(2.5f);
+        EXPECT_TRUE(m_logicEngine->update());
+        expectNoError();
+        EXPECT_EQ(3, *script->getOutputs()->getChild("int")->get<int32_t>());
+        EXPECT_EQ(3, *script->getOutputs()->getChild("int64")->get<int64_t>());
+        EXPECT_EQ(vec3i(3, 1, -3), *script->getOutputs()->getChild("vec3i")->get<vec3i>());
+        EXPECT_EQ(vec4f(2.5f, 1.f, 2.f, 3.f), *script->getOutputs()->getChild("nested")->getChild("vec4f")->get<vec4f>());
+    }
+
+    TEST_F(ALuaScript_Runtime, ChecksTypesOfNumericOutputsWithTrustedNumericConversions)
+    {
+        LuaConfig config;
+        config.enableTrustedNumericConversions();
+        auto* script = m_logicEngine->createLuaScript(R"(
+            function interface(IN,OUT)
+                OUT.vec2f = Type:Vec2f()
+            end
+            function run(IN,OUT)
+                OUT.vec2f = { 1, "two" }
+            end
+        )", config);
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_FALSE(m_logicEngine->update());
+        EXPECT_THAT(getLastErrorMessage(), ::testing::HasSubstr("unexpected value (type: 'string') at array element # 2!"));
+    }
+
     TEST_F(ALuaScript_Runtime, ProducesErrorWhenAssigningNilToIntOutputs)
     {
         auto* script = m_logicEngine->createLuaScript(R"(
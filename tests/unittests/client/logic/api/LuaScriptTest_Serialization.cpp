@@ -184,6 +184,69 @@ namespace ramses::internal
         EXPECT_FALSE(deserializedScript->hasDebugLogFunctions());
     }
 
+    TEST_P(ALuaScript_Serialization, CompilesLazilyDeserializedScriptOnFirstUpdate)
+    {
+        {
+            std::unique_ptr<LuaScriptImpl> script = createTestScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+
+                function run(IN,OUT)
+                    OUT.value = IN.value * 2
+                end
+            )", "name");
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::ByteCodeOnly);
+        }
+
+        const auto& serializedScript = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(m_solState, serializedScript, m_errorReporting, m_deserializationMap, true);
+        ASSERT_TRUE(deserializedScript);
+        EXPECT_FALSE(m_errorReporting.getError().has_value());
+
+        // interface is available right away, script does not need to run until inputs change
+        EXPECT_TRUE(deserializedScript->isCompilationPending());
+        EXPECT_FALSE(deserializedScript->isDirty());
+        ASSERT_NE(nullptr, deserializedScript->getInputs()->getChild("value"));
+        ASSERT_NE(nullptr, deserializedScript->getOutputs()->getChild("value"));
+
+        EXPECT_TRUE(deserializedScript->getInputs()->getChild("value")->set(21));
+        EXPECT_TRUE(deserializedScript->isDirty());
+        EXPECT_FALSE(deserializedScript->update().has_value());
+        EXPECT_FALSE(deserializedScript->isCompilationPending());
+        EXPECT_EQ(42, *deserializedScript->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_P(ALuaScript_Serialization, ReportsErrorOfLazilyDeserializedScriptOnFirstUpdate)
+    {
+        {
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                rlogic_serialization::CreateLogicObject(m_flatBufferBuilder,
+                    m_flatBufferBuilder.CreateString("name"),
+                    1u),
+                m_flatBufferBuilder.CreateString("this is not a valid Lua script"),
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_testUtils.serializeTestProperty(""),
+                m_testUtils.serializeTestProperty(""),
+                0 // no byte code
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, true);
+        ASSERT_TRUE(deserialized);
+        EXPECT_FALSE(m_errorReporting.getError().has_value());
+
+        const auto runtimeError = deserialized->update();
+        ASSERT_TRUE(runtimeError.has_value());
+        EXPECT_THAT(runtimeError->message, ::testing::HasSubstr("[name] Error while loading script"));
+        EXPECT_TRUE(deserialized->isCompilationPending());
+    }
+
     TEST_P(ALuaScript_Serialization, ProducesErrorWhenNameMissing)
     {
         {
@@ -21,6 +21,7 @@
 #include "impl/logic/PropertyImpl.h"
 #include "impl/logic/LogicEngineImpl.h"
 #include "impl/ErrorReporting.h"
+#include "impl/NodeImpl.h"
 
 #include "ramses/client/Node.h"
 #include "ramses/client/MeshNode.h"
@@ -337,6 +338,43 @@ namespace ramses::internal
         EXPECT_EQ(m_node->getVisibility(), EVisibilityMode::Invisible);
     }
 
+    TEST_F(ANodeBinding, PropagatesInputsOfMultipleBindingsToRamsesNodesInOneUpdate)
+    {
+        ramses::Node& otherNode = *m_scene->createNode();
+        NodeBinding& nodeBinding = *m_logicEngine->createNodeBinding(*m_node, ERotationType::Euler_XYZ, "NodeBinding");
+        NodeBinding& otherNodeBinding = *m_logicEngine->createNodeBinding(otherNode, ERotationType::Quaternion, "OtherNodeBinding");
+
+        nodeBinding.getInputs()->getChild("rotation")->set<vec3f>(vec3f{ 0.1f, 0.2f, 0.3f });
+        nodeBinding.getInputs()->getChild("translation")->set<vec3f>(vec3f{ 2.1f, 2.2f, 2.3f });
+        otherNodeBinding.getInputs()->getChild("rotation")->set<vec4f>(vec4f{ 0.5f, 0.5f, -0.5f, 0.5f });
+        otherNodeBinding.getInputs()->getChild("translation")->set<vec3f>(vec3f{ 3.1f, 3.2f, 3.3f });
+        otherNodeBinding.getInputs()->getChild("scaling")->set<vec3f>(vec3f{ 1.1f, 1.2f, 1.3f });
+
+        EXPECT_TRUE(m_logicEngine->update());
+
+        ExpectValues(*m_node, ENodePropertyStaticIndex::Rotation, vec3f{ 0.1f, 0.2f, 0.3f });
+        ExpectValues(*m_node, ENodePropertyStaticIndex::Translation, vec3f{ 2.1f, 2.2f, 2.3f });
+        ExpectDefaultValues(*m_node, ENodePropertyStaticIndex::Scaling);
+        EXPECT_EQ(ERotationType::Quaternion, otherNode.getRotationType());
+        ExpectQuat(otherNode, vec4f{ 0.5f, 0.5f, -0.5f, 0.5f });
+        ExpectValues(otherNode, ENodePropertyStaticIndex::Translation, vec3f{ 3.1f, 3.2f, 3.3f });
+        ExpectValues(otherNode, ENodePropertyStaticIndex::Scaling, vec3f{ 1.1f, 1.2f, 1.3f });
+    }
+
+    TEST_F(ANodeBinding, DoesNotCreateTransformOfRamsesNodeWhenUpdatingWithDefaultValues)
+    {
+        NodeBinding& nodeBinding = *m_logicEngine->createNodeBinding(*m_node, ERotationType::Quaternion, "NodeBinding");
+        ASSERT_FALSE(m_node->impl().getTransformHandle().isValid());
+
+        nodeBinding.getInputs()->getChild("rotation")->set<vec4f>(vec4f{ 0.f, 0.f, 0.f, 1.f });
+        nodeBinding.getInputs()->getChild("translation")->set<vec3f>(vec3f{ 0.f, 0.f, 0.f });
+        nodeBinding.getInputs()->getChild("scaling")->set<vec3f>(vec3f{ 1.f, 1.f, 1.f });
+        EXPECT_TRUE(m_logicEngine->update());
+
+        EXPECT_FALSE(m_node->impl().getTransformHandle().isValid());
+        ExpectDefaultValues(*m_node);
+    }
+
     TEST_F(ANodeBinding, DoesNotOverrideExistingValuesAfterRamsesNodeIsAssignedToBinding)
     {
         m_node->setVisibility(EVisibilityMode::Off);
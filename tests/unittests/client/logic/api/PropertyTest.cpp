@@ -298,6 +298,39 @@ namespace ramses::internal
         EXPECT_TRUE(linkTarget->impl().checkForBindingInputNewValueAndReset());
     }
 
+    TEST_F(AProperty, SetsValueFromOtherPropertyOfSameType)
+    {
+        auto vec3fSource = CreateOutputProperty(EPropertyType::Vec3f);
+        auto vec3fTarget = CreateInputProperty(EPropertyType::Vec3f);
+        auto stringSource = CreateOutputProperty(EPropertyType::String);
+        auto stringTarget = CreateInputProperty(EPropertyType::String);
+
+        vec3fSource->impl().setValue(vec3f{ 1.f, 2.f, 3.f });
+        stringSource->impl().setValue(std::string("42"));
+
+        EXPECT_TRUE(vec3fTarget->impl().setValueFrom(vec3fSource->impl()));
+        EXPECT_TRUE(stringTarget->impl().setValueFrom(stringSource->impl()));
+        EXPECT_EQ(vec3f(1.f, 2.f, 3.f), *vec3fTarget->get<vec3f>());
+        EXPECT_EQ("42", *stringTarget->get<std::string>());
+
+        // same value again reports no change
+        EXPECT_FALSE(vec3fTarget->impl().setValueFrom(vec3fSource->impl()));
+        EXPECT_FALSE(stringTarget->impl().setValueFrom(stringSource->impl()));
+    }
+
+    TEST_F(AProperty, BindingInputHasNewUserValueAfterValueIsSetFromOtherProperty_whenNewValueSameAsOldValue)
+    {
+        auto linkTarget(CreateBindingInput(EPropertyType::Float));
+        auto linkSource(CreateOutputProperty(EPropertyType::Float));
+
+        linkTarget->set<float>(.5f);
+        EXPECT_TRUE(linkTarget->impl().checkForBindingInputNewValueAndReset());
+        linkSource->impl().setValue(.5f);
+
+        EXPECT_FALSE(linkTarget->impl().setValueFrom(linkSource->impl()));
+        EXPECT_TRUE(linkTarget->impl().checkForBindingInputNewValueAndReset());
+    }
+
     TEST_F(AProperty, BindingInputHasNoUserValueAnymore_WhenConsumed)
     {
         auto prop(CreateBindingInput(EPropertyType::Float));
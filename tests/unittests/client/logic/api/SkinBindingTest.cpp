@@ -163,6 +163,37 @@ namespace ramses::internal
             EXPECT_NEAR(expectedMat2[i/4][i%4], mat2[i/4][i%4], 1e-4f) << i;
     }
 
+    TEST_F(ASkinBinding, UpdatesBoundUniformOnlyForChangedJointInSubsequentUpdates)
+    {
+        EXPECT_TRUE(m_logicEngine->update());
+
+        const matrix44f identityMat = glm::identity<matrix44f>();
+        const matrix44f translatedMat = {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            -1.f, -2.f, -3.f, 1.f
+        };
+
+        const auto expectUniformData = [&](const matrix44f& expectedMat1, const matrix44f& expectedMat2) {
+            std::array<matrix44f, 2u> uniformData{};
+            m_appearance->getInputValue(*m_uniform, 2u, uniformData.data());
+            for (glm::length_t i = 0u; i < 16; ++i)
+            {
+                EXPECT_NEAR(expectedMat1[i/4][i%4], uniformData[0][i/4][i%4], 1e-4f) << i;
+                EXPECT_NEAR(expectedMat2[i/4][i%4], uniformData[1][i/4][i%4], 1e-4f) << i;
+            }
+        };
+
+        m_jointNodes[1]->setTranslation({ -1.f, -2.f, -3.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        expectUniformData(identityMat, translatedMat);
+
+        m_jointNodes[1]->setTranslation({ 0.f, 0.f, 0.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        expectUniformData(identityMat, identityMat);
+    }
+
     TEST_F(ASkinBinding, UpdatesBoundUniformOnNodeBindingChange)
     {
         // This is the same setup as regular tests, only recreated locally, since with the regular setup (by chance) the nodes are ordered differently.
@@ -221,6 +252,44 @@ namespace ramses::internal
             EXPECT_NEAR(expectedMat2[i/4][i%4], mat2[i/4][i%4], 1e-4f) << i;
     }
 
+    TEST_F(ASkinBinding, SharesJointMatricesWithSkinBindingOfSameSkin)
+    {
+        auto appearance = m_scene->createAppearance(createTestEffect(), "skinAppearance2");
+        auto uniform = appearance->getEffect().findUniformInput("jointMat");
+        AppearanceBinding* appearanceBinding{ m_logicEngine->createAppearanceBinding(*appearance) };
+
+        std::vector<matrix44f> inverseMats;
+        inverseMats.resize(2u);
+        m_jointNodes[0]->getInverseModelMatrix(inverseMats[0]);
+        m_jointNodes[1]->getInverseModelMatrix(inverseMats[1]);
+        auto skin = m_logicEngine->createSkinBinding(m_joints, inverseMats, *appearanceBinding, *uniform, "skin2");
+        ASSERT_NE(nullptr, skin);
+        EXPECT_TRUE(skin->impl().hasSameSkin(m_skin->impl()));
+
+        const auto expectUniformsEqual = [&]() {
+            std::array<matrix44f, 2u> expectedData{};
+            m_appearance->getInputValue(*m_uniform, 2u, expectedData.data());
+            std::array<matrix44f, 2u> uniformData{};
+            appearance->getInputValue(*uniform, 2u, uniformData.data());
+            EXPECT_EQ(expectedData, uniformData);
+        };
+
+        m_jointNodes[1]->setTranslation({ -1.f, -2.f, -3.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        expectUniformsEqual();
+
+        std::array<matrix44f, 2u> uniformData{};
+        appearance->getInputValue(*uniform, 2u, uniformData.data());
+        EXPECT_NEAR(-1.f, uniformData[1][3][0], 1e-4f);
+
+        // remaining skin binding calculates joint matrices itself after its source is destroyed
+        EXPECT_TRUE(m_logicEngine->destroy(*m_skin));
+        m_jointNodes[1]->setTranslation({ -2.f, -2.f, -3.f });
+        EXPECT_TRUE(m_logicEngine->update());
+        appearance->getInputValue(*uniform, 2u, uniformData.data());
+        EXPECT_NEAR(-2.f, uniformData[1][3][0], 1e-4f);
+    }
+
     TEST_F(ASkinBinding, CalculatesSameValuesAfterLoadingFromFile)
     {
         withTempDirectory();
@@ -135,6 +135,69 @@ namespace ramses::internal
         EXPECT_GT(ticker, initialTicker);
     }
 
+    TEST_F(ATimerNode, OutputsTickerInFixedTimesteps)
+    {
+        const auto timerNode = m_logicEngine->createTimerNode("timerNode");
+        EXPECT_TRUE(timerNode->setFixedTimestep(100, 3u));
+        const auto updateAndGetTicker = [&](int64_t ticker) {
+            EXPECT_TRUE(timerNode->getInputs()->getChild(0u)->set<int64_t>(ticker));
+            EXPECT_TRUE(m_logicEngine->update());
+            return *timerNode->getOutputs()->getChild(0u)->get<int64_t>();
+        };
+
+        EXPECT_EQ(1000, updateAndGetTicker(1000));
+        // less than a step elapsed
+        EXPECT_EQ(1000, updateAndGetTicker(1050));
+        // accumulated time makes a step
+        EXPECT_EQ(1100, updateAndGetTicker(1120));
+        // several steps
+        EXPECT_EQ(1300, updateAndGetTicker(1330));
+        // catch-up limited to 3 steps, excess whole steps are dropped, remainder of 10 is kept
+        EXPECT_EQ(1600, updateAndGetTicker(2010));
+        EXPECT_EQ(1700, updateAndGetTicker(2100));
+        // source going back restarts stepping
+        EXPECT_EQ(500, updateAndGetTicker(500));
+    }
+
+    TEST_F(ATimerNode, OutputsInterpolatedTickerInFixedTimesteps)
+    {
+        const auto timerNode = m_logicEngine->createTimerNode("timerNode");
+        EXPECT_TRUE(timerNode->setFixedTimestep(100, 2u, true));
+        const auto updateAndGetTicker = [&](int64_t ticker) {
+            EXPECT_TRUE(timerNode->getInputs()->getChild(0u)->set<int64_t>(ticker));
+            EXPECT_TRUE(m_logicEngine->update());
+            return *timerNode->getOutputs()->getChild(0u)->get<int64_t>();
+        };
+
+        EXPECT_EQ(1000, updateAndGetTicker(1000));
+        EXPECT_EQ(1050, updateAndGetTicker(1050));
+        EXPECT_EQ(1120, updateAndGetTicker(1120));
+        // catch-up limited to 2 steps, output falls behind source
+        EXPECT_EQ(1340, updateAndGetTicker(1540));
+    }
+
+    TEST_F(ATimerNode, FollowsTickerAgainWhenFixedTimestepDisabled)
+    {
+        const auto timerNode = m_logicEngine->createTimerNode("timerNode");
+        EXPECT_TRUE(timerNode->setFixedTimestep(100, 2u));
+        EXPECT_TRUE(timerNode->getInputs()->getChild(0u)->set<int64_t>(1000));
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_TRUE(timerNode->getInputs()->getChild(0u)->set<int64_t>(1050));
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1000, *timerNode->getOutputs()->getChild(0u)->get<int64_t>());
+
+        EXPECT_TRUE(timerNode->setFixedTimestep(0, 1u));
+        EXPECT_TRUE(m_logicEngine->update());
+        EXPECT_EQ(1050, *timerNode->getOutputs()->getChild(0u)->get<int64_t>());
+    }
+
+    TEST_F(ATimerNode, FailsToSetInvalidFixedTimestep)
+    {
+        const auto timerNode = m_logicEngine->createTimerNode("timerNode");
+        EXPECT_FALSE(timerNode->setFixedTimestep(-1, 1u));
+        EXPECT_FALSE(timerNode->setFixedTimestep(100, 0u));
+    }
+
     TEST_F(ATimerNode, OutputsTickerInAutoModeWhenConnectedToInterface)
     {
         const std::string_view interfaceSrc = R"(
@@ -516,6 +516,68 @@ namespace ramses::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, DetectsCycleNotReachableFromRootNode)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2, N3 -> N4 -> N3 .... (infinity)
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N4, N3);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ComputesOrderAgainAfterCycleIsRemoved)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N1 -> .... (infinity)
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        // N2 -> N3 -> N1
+        m_graph.removeEdge(N1, N2);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N2, &N3, &N1));
+
+        // new edges are handled again after recovery, including new cycles
+        m_graph.addEdge(N2, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N2, &N3, &N1));
+        m_graph.addEdge(N1, N2);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReordersOnlyAffectedNodesWhenEdgeContradictsCurrentOrder)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2 -> N3    N4 -> N5    N6
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N4, N5);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3, &N4, &N5, &N6));
+
+        // N4 -> N5 -> N2 -> N3
+        // N1 ---------^
+        m_graph.addEdge(N5, N2);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N4, &N5, &N2, &N3, &N6));
+
+        // consistent edge does not change order
+        m_graph.addEdge(N1, N6);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N4, &N5, &N2, &N3, &N6));
+
+        // N6 -> N4 moves N6 and nodes reachable from N4 only, N1 keeps its place
+        m_graph.addEdge(N6, N4);
+        updateOrdering();
+        EXPECT_EQ(0u, getRank(N1));
+        EXPECT_LT(getRank(N6), getRank(N4));
+        EXPECT_LT(getRank(N4), getRank(N5));
+        EXPECT_LT(getRank(N5), getRank(N2));
+        EXPECT_LT(getRank(N2), getRank(N3));
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
@@ -574,4 +636,69 @@ namespace ramses::internal
 
         EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N2, &N1));
     }
+
+    TEST_F(ADirectedAcyclicGraph, GroupsSortedNodesIntoLevelsOfIndependentNodes)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+        * N1 -> N2 -> N3
+        *   \          \
+        *    -> N4 ----> N5      N6
+        */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N1, N4);
+        m_graph.addEdge(N4, N5);
+        m_graph.addEdge(N3, N5);
+
+        const auto levels = m_graph.getTopologicalLevels(getSortedTestNodes());
+        ASSERT_EQ(4u, levels.size());
+        EXPECT_THAT(levels[0], ::testing::UnorderedElementsAre(&N1, &N6));
+        EXPECT_THAT(levels[1], ::testing::UnorderedElementsAre(&N2, &N4));
+        EXPECT_THAT(levels[2], ::testing::ElementsAre(&N3));
+        EXPECT_THAT(levels[3], ::testing::ElementsAre(&N5));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, PutsAllNodesWithoutEdgesIntoSingleLevel)
+    {
+        addTestNodesToGraph(3);
+
+        const auto levels = m_graph.getTopologicalLevels(getSortedTestNodes());
+        ASSERT_EQ(1u, levels.size());
+        EXPECT_EQ(getSortedTestNodes(), levels[0]);
+
+        EXPECT_TRUE(m_graph.getTopologicalLevels({}).empty());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, CollectsNodesReachableFromStartNodesInSortedOrder)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+        * N1 -> N2 -> N3
+        *             ^
+        * N4 -> N5 ---+      N6
+        */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N4, N5);
+        m_graph.addEdge(N5, N3);
+
+        const auto sortedNodes = getSortedTestNodes();
+        updateOrdering();
+
+        auto reachable = m_graph.getReachableNodes(sortedNodes, { &N2 });
+        EXPECT_THAT(reachable, ::testing::ElementsAre(&N2, &N3));
+
+        reachable = m_graph.getReachableNodes(sortedNodes, { &N5, &N1 });
+        EXPECT_THAT(reachable, ::testing::UnorderedElementsAre(&N1, &N2, &N5, &N3));
+        ASSERT_EQ(4u, reachable.size());
+        EXPECT_LT(getRank(*reachable[0]), getRank(*reachable[1]));
+        EXPECT_LT(getRank(*reachable[1]), getRank(*reachable[2]));
+        EXPECT_LT(getRank(*reachable[2]), getRank(*reachable[3]));
+
+        EXPECT_THAT(m_graph.getReachableNodes(sortedNodes, { &N6, &N6 }), ::testing::ElementsAre(&N6));
+        EXPECT_TRUE(m_graph.getReachableNodes(sortedNodes, {}).empty());
+    }
 }
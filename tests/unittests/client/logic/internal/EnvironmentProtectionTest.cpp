@@ -764,6 +764,39 @@ namespace ramses::internal
             ::testing::HasSubstr("Trying to override the GLOBAL table in run()! You can only read data, but not overwrite the table!"));
     }
 
+    TEST_F(AEnvironmentProtection_RunFunction, ReadsGlobalsTableSetBeforeProtectionWithoutExposingOtherSymbols)
+    {
+        getInternalEnvironment()["GLOBAL"] = m_solState.createTable();
+        getInternalEnvironment()["GLOBAL"]["data"] = 5;
+        getInternalEnvironment()["hidden"] = 1;
+        EnvironmentProtection::SetEnvironmentProtectionLevel(m_protEnv, EEnvProtectionFlag::RunFunction);
+
+        sol::protected_function readGlobal = m_solState.loadScript("return GLOBAL.data", "test script");
+        m_protEnv.set_on(readGlobal);
+        sol::protected_function readHidden = m_solState.loadScript("return hidden", "test script");
+        m_protEnv.set_on(readHidden);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            getInternalEnvironment()["GLOBAL"]["data"] = i;
+            sol::protected_function_result result = readGlobal();
+            ASSERT_TRUE(result.valid());
+            const int resultData = result;
+            EXPECT_EQ(i, resultData);
+
+            sol::protected_function_result hiddenResult = readHidden();
+            ASSERT_FALSE(hiddenResult.valid());
+            sol::error error = hiddenResult;
+            EXPECT_THAT(error.what(), ::testing::HasSubstr("Unexpected global access to key 'hidden' in run()! Only 'GLOBAL' is allowed as a key"));
+        }
+
+        // protection can be switched to another level afterwards
+        EnvironmentProtection::SetEnvironmentProtectionLevel(m_protEnv, EEnvProtectionFlag::None);
+        sol::protected_function_result unprotectedResult = readHidden();
+        ASSERT_TRUE(unprotectedResult.valid());
+        EXPECT_EQ(sol::type::lua_nil, unprotectedResult.get_type());
+    }
+
     class AEnvironmentProtection_Module: public AEnvironmentProtection
     {
     protected:
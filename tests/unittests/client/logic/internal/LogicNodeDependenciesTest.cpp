@@ -371,6 +371,27 @@ namespace ramses::internal
         expectNoLinks(*m_nestedInputB);
     }
 
+    TEST_F(ALogicNodeDependencies_NestedLinks, CompilesOutgoingLinksOfNestedOutputsIntoFlatList)
+    {
+        EXPECT_TRUE(m_dependencies.getOutgoingLinkCopies(*m_nodeANested).empty());
+
+        EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, false, m_errorReporting));
+        EXPECT_TRUE(m_dependencies.link(*m_arrayOutputA, *m_arrayInputB, true, m_errorReporting));
+
+        const auto& linkCopies = m_dependencies.getOutgoingLinkCopies(*m_nodeANested);
+        ASSERT_EQ(2u, linkCopies.size());
+        EXPECT_EQ(m_nestedOutputA, linkCopies[0].source);
+        EXPECT_EQ(m_nestedInputB, linkCopies[0].target);
+        EXPECT_EQ(m_arrayOutputA, linkCopies[1].source);
+        EXPECT_EQ(m_arrayInputB, linkCopies[1].target);
+        EXPECT_TRUE(m_dependencies.getOutgoingLinkCopies(*m_nodeBNested).empty());
+
+        // recompiled after links change
+        EXPECT_TRUE(m_dependencies.unlink(*m_nestedOutputA, *m_nestedInputB, m_errorReporting));
+        ASSERT_EQ(1u, m_dependencies.getOutgoingLinkCopies(*m_nodeANested).size());
+        EXPECT_EQ(m_arrayOutputA, m_dependencies.getOutgoingLinkCopies(*m_nodeANested)[0].source);
+    }
+
     TEST_F(ALogicNodeDependencies_NestedLinks, RemovingSourceNode_RemovesLinks)
     {
         EXPECT_TRUE(m_dependencies.link(*m_nestedOutputA, *m_nestedInputB, false, m_errorReporting));
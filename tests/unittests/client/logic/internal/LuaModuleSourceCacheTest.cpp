@@ -0,0 +1,94 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/logic/LuaModuleSourceCache.h"
+#include "ramses/client/logic/LuaModule.h"
+#include "ramses/client/logic/LuaScript.h"
+#include "ramses/client/logic/Property.h"
+#include "LogicEngineTest_Base.h"
+
+namespace ramses::internal
+{
+    class ALuaModuleSourceCache : public ALogicEngine
+    {
+    protected:
+        const std::string m_moduleSource = R"(
+            local mytestmodule = {}
+            mytestmodule.value = 42
+            return mytestmodule
+        )";
+
+        const std::string m_scriptSource = R"(
+            modules("mymodule")
+            function interface(IN,OUT)
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = mymodule.value
+            end
+        )";
+    };
+
+    TEST_F(ALuaModuleSourceCache, ReturnsStoredEntryAsLongAsItIsUsed)
+    {
+        const std::string source = "return { cacheTest = 1 }";
+        EXPECT_EQ(nullptr, LuaModuleSourceCache::Find(source));
+
+        auto entry = LuaModuleSourceCache::Store({ source, {}, { "dep" } });
+        ASSERT_NE(nullptr, entry);
+        EXPECT_EQ(entry, LuaModuleSourceCache::Find(source));
+        EXPECT_EQ(std::vector<std::string>{ "dep" }, LuaModuleSourceCache::Find(source)->declaredModules);
+        // storing same source again keeps the first entry
+        EXPECT_EQ(entry, LuaModuleSourceCache::Store({ source, {}, {} }));
+
+        entry.reset();
+        EXPECT_EQ(nullptr, LuaModuleSourceCache::Find(source));
+    }
+
+    TEST_F(ALuaModuleSourceCache, SharesCompiledModuleSourceBetweenLogicEngines)
+    {
+        LuaModule* module1 = m_logicEngine->createLuaModule(m_moduleSource, {}, "module");
+        ASSERT_NE(nullptr, module1);
+        EXPECT_NE(nullptr, LuaModuleSourceCache::Find(m_moduleSource));
+
+        auto& otherEngine = *m_scene->createLogicEngine();
+        LuaModule* module2 = otherEngine.createLuaModule(m_moduleSource, {}, "module");
+        ASSERT_NE(nullptr, module2);
+
+        LuaConfig config;
+        config.addDependency("mymodule", *module2);
+        LuaScript* script = otherEngine.createLuaScript(m_scriptSource, config, "script");
+        ASSERT_NE(nullptr, script);
+        EXPECT_TRUE(otherEngine.update());
+        EXPECT_EQ(42, *script->getOutputs()->getChild("value")->get<int32_t>());
+
+        EXPECT_TRUE(otherEngine.destroy(*script));
+        EXPECT_TRUE(otherEngine.destroy(*module2));
+        EXPECT_NE(nullptr, LuaModuleSourceCache::Find(m_moduleSource));
+        EXPECT_TRUE(m_logicEngine->destroy(*module1));
+        EXPECT_EQ(nullptr, LuaModuleSourceCache::Find(m_moduleSource));
+    }
+
+    TEST_F(ALuaModuleSourceCache, ChecksDependenciesOfCachedModule)
+    {
+        const std::string moduleWithDependency = R"(
+            modules("dep")
+            return { dependentValue = dep.value }
+        )";
+        LuaModule* dependency = m_logicEngine->createLuaModule(m_moduleSource, {}, "dep");
+        ASSERT_NE(nullptr, dependency);
+        LuaConfig config;
+        config.addDependency("dep", *dependency);
+        ASSERT_NE(nullptr, m_logicEngine->createLuaModule(moduleWithDependency, config, "module1"));
+        ASSERT_NE(nullptr, LuaModuleSourceCache::Find(moduleWithDependency));
+
+        // same source loaded from cache still has to get its declared dependencies provided
+        EXPECT_EQ(nullptr, m_logicEngine->createLuaModule(moduleWithDependency, {}, "module2"));
+    }
+}
@@ -275,6 +275,45 @@ namespace ramses::internal
         EXPECT_EQ(-1, intsArray.getData()[2]);
     }
 
+    TEST_F(TheLuaTypeConversions, ExtractsTableOfNumbersWithTrustedConversions)
+    {
+        m_sol.script(R"(
+            ints = {11, -12, 2.5}
+            floats = {0.1, 10000.42}
+        )");
+
+        const DataOrError<std::array<int32_t, 3>> intsArray = LuaTypeConversions::ExtractArray<int32_t, 3>(m_sol["ints"], true);
+        ASSERT_FALSE(intsArray.hasError());
+        EXPECT_EQ(11, intsArray.getData()[0]);
+        EXPECT_EQ(-12, intsArray.getData()[1]);
+        EXPECT_EQ(3, intsArray.getData()[2]);
+
+        const DataOrError<std::array<float, 2>> floatArray = LuaTypeConversions::ExtractArray<float, 2>(m_sol["floats"], true);
+        ASSERT_FALSE(floatArray.hasError());
+        EXPECT_FLOAT_EQ(0.1f, floatArray.getData()[0]);
+        EXPECT_FLOAT_EQ(10000.42f, floatArray.getData()[1]);
+    }
+
+    TEST_F(TheLuaTypeConversions, ChecksTypesOfTableEntriesWithTrustedConversions)
+    {
+        m_sol.script(R"(
+            notOnlyNumbers = {11, "12", 13}
+            withHole = {11, nil, 13}
+        )");
+
+        EXPECT_THAT(LuaTypeConversions::ExtractArray<int32_t, 3>(m_sol["notOnlyNumbers"], true).getError(),
+            ::testing::HasSubstr("Error while extracting array: unexpected value (type: 'string') at array element # 2! Reason: Error while extracting integer: expected a number, received 'string'"));
+        EXPECT_TRUE(LuaTypeConversions::ExtractArray<int32_t, 3>(m_sol["withHole"], true).hasError());
+    }
+
+    TEST_F(TheLuaTypeConversions, ConvertsTrustedNumbersWithoutChecks)
+    {
+        EXPECT_EQ(2, LuaTypeConversions::ConvertNumberTrusted<int32_t>(1.6));
+        EXPECT_EQ(-2, LuaTypeConversions::ConvertNumberTrusted<int32_t>(-1.5));
+        EXPECT_EQ(int64_t(1) << 40, LuaTypeConversions::ConvertNumberTrusted<int64_t>(double(int64_t(1) << 40)));
+        EXPECT_FLOAT_EQ(0.1f, LuaTypeConversions::ConvertNumberTrusted<float>(0.1));
+    }
+
     TEST_F(TheLuaTypeConversions, FailsValueExtractionWhenSymbolDoesNotExist)
     {
         EXPECT_THAT(LuaTypeConversions::ExtractSpecificType<int32_t>(m_sol["noSuchSymbol"]).getError(), ::testing::HasSubstr("Error while extracting integer: expected a number, received 'nil'"));
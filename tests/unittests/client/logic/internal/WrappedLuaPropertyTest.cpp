@@ -255,6 +255,32 @@ namespace ramses::internal
         EXPECT_EQ(12, assignExpressionToValue<int32_t>("12", "ROOT.Int"));
     }
 
+    TEST_F(AWrappedLuaProperty_Assignment, AssignsAllPrimitiveFieldsOfStructRepeatedly)
+    {
+        PropertyImpl outputAllPrimitives = makeTestProperty(m_structWithAllPrimitiveTypes, EPropertySemantics::ScriptOutput);
+        WrappedLuaProperty wrapped(outputAllPrimitives);
+        m_sol["ROOT"] = std::ref(wrapped);
+
+        const sol::protected_function_result result = run_WithResult(R"(
+            for i = 1,100 do
+                ROOT.Float = i + 0.5
+                ROOT.Int32 = i
+                ROOT.Int64 = i * 2
+                ROOT.String = "str" .. i
+                ROOT.Bool = (i % 2 == 0)
+            end
+            lastInt32 = ROOT.Int32
+        )");
+        ASSERT_TRUE(result.valid());
+
+        EXPECT_FLOAT_EQ(100.5f, *outputAllPrimitives.getChild("Float")->get<float>());
+        EXPECT_EQ(100, *outputAllPrimitives.getChild("Int32")->get<int32_t>());
+        EXPECT_EQ(200, *outputAllPrimitives.getChild("Int64")->get<int64_t>());
+        EXPECT_EQ("str100", *outputAllPrimitives.getChild("String")->get<std::string>());
+        EXPECT_TRUE(*outputAllPrimitives.getChild("Bool")->get<bool>());
+        EXPECT_EQ(100, m_sol["lastInt32"].get<int32_t>());
+    }
+
     TEST_F(AWrappedLuaProperty_Assignment, CatchesErrorWhenTryingToAssignPrimitiveInputFields)
     {
         PropertyImpl input = makeTestProperty(MakeStruct("ROOT", {TypeData{"Int32", EPropertyType::Int32}}), EPropertySemantics::ScriptInput);
@@ -9,6 +9,9 @@
 #include "impl/text/Freetype2FontInstance.h"
 #include "ramses/client/text/FontRegistry.h"
 #include "impl/text/Quad.h"
+#include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
+#include "internal/Core/Utils/File.h"
+#include "FileDescriptorHelper.h"
 #include "gtest/gtest.h"
 
 namespace ramses::internal
@@ -168,6 +171,76 @@ namespace ramses::internal
         EXPECT_EQ(it2, positionedGlyphs2.cend());
     }
 
+    TEST_F(AFreetype2FontInstance, RasterizesSameGlyphBitmapsInParallelAsOneByOne)
+    {
+        FontRegistry registry;
+        const auto fontId = registry.createFreetype2Font("res/ramses-text-WenQuanYi-Micro-Hei.ttf");
+        auto& parallelFontInstance = static_cast<Freetype2FontInstance&>(*registry.getFontInstance(registry.createFreetype2FontInstance(fontId, 20)));
+        auto& fontInstance = static_cast<Freetype2FontInstance&>(*registry.getFontInstance(registry.createFreetype2FontInstance(fontId, 20)));
+
+        std::vector<GlyphId> glyphIds;
+        for (char32_t character = U'\u4E00'; character < U'\u4E00' + 100; ++character)
+            glyphIds.push_back(fontInstance.getGlyphId(character));
+
+        ThreadedTaskExecutor taskExecutor(2);
+        parallelFontInstance.loadGlyphBitmapsInParallel(glyphIds, taskExecutor);
+
+        for (const auto glyphId : glyphIds)
+        {
+            QuadSize expectedSize;
+            const GlyphData expectedData = fontInstance.loadGlyphBitmapData(glyphId, expectedSize.x, expectedSize.y);
+            QuadSize size;
+            const GlyphData data = parallelFontInstance.loadGlyphBitmapData(glyphId, size.x, size.y);
+            EXPECT_EQ(expectedSize, size);
+            EXPECT_EQ(expectedData, data);
+        }
+    }
+
+    TEST_F(AFreetype2FontInstance, RasterizesSameGlyphBitmapsInParallelFromFileDescriptorAsOneByOne)
+    {
+        const char* path = "res/ramses-text-WenQuanYi-Micro-Hei.ttf";
+        size_t fileSize = 0;
+        ASSERT_TRUE(File(path).getSizeInBytes(fileSize));
+        FontRegistry registry;
+        const auto fontId = registry.createFreetype2Font(path);
+        const auto fdFontId = registry.createFreetype2FontFromFileDescriptor(FileDescriptorHelper::OpenFileDescriptorBinary(path), 0, fileSize);
+        ASSERT_TRUE(fdFontId.isValid());
+        auto& parallelFontInstance = static_cast<Freetype2FontInstance&>(*registry.getFontInstance(registry.createFreetype2FontInstance(fdFontId, 20)));
+        auto& fontInstance = static_cast<Freetype2FontInstance&>(*registry.getFontInstance(registry.createFreetype2FontInstance(fontId, 20)));
+
+        // two batches, second one uses rasterization contexts kept from first one
+        std::vector<GlyphId> glyphIds1;
+        std::vector<GlyphId> glyphIds2;
+        for (char32_t character = U'\u4E00'; character < U'\u4E00' + 50; ++character)
+            glyphIds1.push_back(fontInstance.getGlyphId(character));
+        for (char32_t character = U'\u4E00' + 50; character < U'\u4E00' + 100; ++character)
+            glyphIds2.push_back(fontInstance.getGlyphId(character));
+
+        ThreadedTaskExecutor taskExecutor(2);
+        parallelFontInstance.loadGlyphBitmapsInParallel(glyphIds1, taskExecutor);
+        parallelFontInstance.loadGlyphBitmapsInParallel(glyphIds2, taskExecutor);
+
+        glyphIds1.insert(glyphIds1.end(), glyphIds2.cbegin(), glyphIds2.cend());
+        for (const auto glyphId : glyphIds1)
+        {
+            QuadSize expectedSize;
+            const GlyphData expectedData = fontInstance.loadGlyphBitmapData(glyphId, expectedSize.x, expectedSize.y);
+            QuadSize size;
+            const GlyphData data = parallelFontInstance.loadGlyphBitmapData(glyphId, size.x, size.y);
+            EXPECT_EQ(expectedSize, size);
+            EXPECT_EQ(expectedData, data);
+        }
+
+        // reading font data for parallel rasterization does not disturb the face loading glyphs one by one
+        const GlyphId otherGlyphId = fontInstance.getGlyphId(U'\u4E00' + 100);
+        QuadSize expectedSize;
+        const GlyphData expectedData = fontInstance.loadGlyphBitmapData(otherGlyphId, expectedSize.x, expectedSize.y);
+        QuadSize size;
+        const GlyphData data = parallelFontInstance.loadGlyphBitmapData(otherGlyphId, size.x, size.y);
+        EXPECT_EQ(expectedSize, size);
+        EXPECT_EQ(expectedData, data);
+    }
+
     TEST_F(AFreetype2FontInstance, CanLoadACharacterGlyphBitmapData)
     {
         QuadSize glyphBitmapSize;
@@ -284,4 +357,34 @@ namespace ramses::internal
         ExpectGlyphMetricsEq({ { GlyphId(171u), FontInstanceIdLatin }, 3u, 3u, -4, 6, 0 }, *it++); //U+0309
         EXPECT_EQ(it, positionedGlyphs.end());
     }
+
+    TEST_F(AFreetype2FontInstance, ExtendsGlyphMetricsAndBitmapsBySpreadForDistanceField)
+    {
+        FontRegistry registry;
+        const auto fontId = registry.createFreetype2Font("res/ramses-text-Roboto-Bold.ttf");
+        const auto distanceFieldFontInstanceId = registry.createFreetype2FontInstanceWithDistanceField(fontId, 10, 3u);
+        auto& distanceFieldFontInstance = static_cast<Freetype2FontInstance&>(*registry.getFontInstance(distanceFieldFontInstanceId));
+
+        const GlyphMetricsVector glyphs = GetPositionedGlyphs(U"a a", *FontInstanceLatin);
+        const GlyphMetricsVector distanceFieldGlyphs = GetPositionedGlyphs(U"a a", distanceFieldFontInstance);
+        ASSERT_EQ(3u, distanceFieldGlyphs.size());
+
+        ExpectGlyphMetricsEq({ { glyphs[0].key.identifier, distanceFieldFontInstanceId }, glyphs[0].width + 6u, glyphs[0].height + 6u, glyphs[0].posX - 3, glyphs[0].posY - 3, glyphs[0].advance }, distanceFieldGlyphs[0]);
+        // empty glyph stays empty
+        ExpectGlyphMetricsEq({ { glyphs[1].key.identifier, distanceFieldFontInstanceId }, 0u, 0u, glyphs[1].posX, glyphs[1].posY, glyphs[1].advance }, distanceFieldGlyphs[1]);
+
+        QuadSize size;
+        const GlyphData data = FontInstanceLatin->loadGlyphBitmapData(glyphs[0].key.identifier, size.x, size.y);
+        QuadSize distanceFieldSize;
+        const GlyphData distanceFieldData = distanceFieldFontInstance.loadGlyphBitmapData(glyphs[0].key.identifier, distanceFieldSize.x, distanceFieldSize.y);
+        EXPECT_EQ(size.x + 6u, distanceFieldSize.x);
+        EXPECT_EQ(size.y + 6u, distanceFieldSize.y);
+        ASSERT_EQ(distanceFieldSize.getArea(), distanceFieldData.size());
+        // border of distance field is outside of glyph
+        EXPECT_EQ(0u, distanceFieldData.front());
+        EXPECT_EQ(0u, distanceFieldData.back());
+        EXPECT_NE(data, distanceFieldData);
+
+        EXPECT_FALSE(registry.createFreetype2FontInstanceWithDistanceField(fontId, 10, 0u).isValid());
+    }
 }
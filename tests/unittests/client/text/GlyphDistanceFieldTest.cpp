@@ -0,0 +1,51 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/text/GlyphDistanceField.h"
+#include "gtest/gtest.h"
+#include <cmath>
+
+namespace ramses::internal
+{
+    TEST(AGlyphDistanceField, isEmptyForEmptyGlyph)
+    {
+        EXPECT_TRUE(GlyphDistanceField::CreateFromCoverage({}, 0u, 0u, 2u).empty());
+    }
+
+    TEST(AGlyphDistanceField, extendsGlyphBySpreadOnEachSide)
+    {
+        const GlyphData coverage(4u * 2u, 255u);
+        EXPECT_EQ(8u * 6u, GlyphDistanceField::CreateFromCoverage(coverage, 4u, 2u, 2u).size());
+    }
+
+    TEST(AGlyphDistanceField, storesDistanceToOutlineClampedToSpread)
+    {
+        // 4x2 glyph with covered 2x1 center in the top row
+        const GlyphData coverage = {
+            0u,   200u, 128u, 0u,
+            0u,   127u, 0u,   0u };
+        constexpr uint32_t spread = 2u;
+        const GlyphData field = GlyphDistanceField::CreateFromCoverage(coverage, 4u, 2u, spread);
+        constexpr size_t fieldWidth = 8u;
+        ASSERT_EQ(fieldWidth * 6u, field.size());
+        const auto at = [&](size_t x, size_t y) { return field[(y + spread) * fieldWidth + x + spread]; };
+
+        // inside texels half a texel from outline
+        EXPECT_EQ(159u, at(1u, 0u));
+        EXPECT_EQ(159u, at(2u, 0u));
+        // outside texels adjacent to glyph
+        EXPECT_EQ(96u, at(0u, 0u));
+        EXPECT_EQ(96u, at(1u, 1u));
+        EXPECT_EQ(96u, at(3u, 0u));
+        // diagonal neighbor
+        EXPECT_EQ(static_cast<uint8_t>(std::lround((0.5f + 0.5f * (0.5f - std::sqrt(2.f)) / spread) * 255.f)), at(0u, 1u));
+        // distance beyond spread is clamped
+        EXPECT_EQ(0u, field.front());
+        EXPECT_EQ(0u, field.back());
+    }
+}
@@ -331,8 +331,7 @@ namespace ramses::internal
         };
         const auto geometry = createTestGlyphGeometry(glyphs);
 
-        // TODO(Violin) does not work yet
-        // EXPECT_EQ(geometry.atlasPage, 0u);
+        EXPECT_EQ(0u, geometry.atlasPage);
     }
 
     TEST_F(AGlyphTextureAtlas, DoesNotReleaseGlyphAfterMappingItMoreThanUnmappingIt)
@@ -357,8 +356,7 @@ namespace ramses::internal
         const auto geometry1 = createTestGlyphGeometry(glyph1);
         const auto geometry2 = createTestGlyphGeometry(glyph2);
 
-        // TODO(Violin) does not work yet
-        //EXPECT_EQ(geometry1.atlasPage, 0u);
+        EXPECT_EQ(0u, geometry1.atlasPage);
         EXPECT_EQ(1u, geometry2.atlasPage);
     }
 
@@ -442,7 +440,31 @@ namespace ramses::internal
         m_atlas.unmapGlyphsFromPage(glyphs1, 0u);
 
         const auto geometry4 = createTestGlyphGeometry(glyphs4);
-        // TODO(Violin) does not work yet
-        //EXPECT_EQ(0u, geometry4.atlasPage);
+        EXPECT_EQ(0u, geometry4.atlasPage);
+    }
+
+    TEST_F(AGlyphTextureAtlas, ReportsOccupancyOfPages)
+    {
+        EXPECT_EQ(0u, m_atlas.getPageCount());
+
+        const GlyphMetricsVector glyphs1 = { { GlyphKey(GlyphId('a'), FakeFontId), 10, 8, 0, 0, 0 } };
+        const GlyphMetricsVector glyphs2 = { { GlyphKey(GlyphId('b'), FakeFontId), 10, 4, 0, 0, 0 } };
+        const auto geometry1 = createTestGlyphGeometry(glyphs1);
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+        EXPECT_FLOAT_EQ(0.5f, m_atlas.getPageOccupancy(0u));
+
+        const auto geometry2 = createTestGlyphGeometry(glyphs2);
+        EXPECT_EQ(0u, geometry2.atlasPage);
+        EXPECT_FLOAT_EQ(0.8f, m_atlas.getPageOccupancy(0u));
+
+        // unused glyph keeps its space until it is needed for other glyphs
+        m_atlas.unmapGlyphsFromPage(glyphs1, 0u);
+        EXPECT_FLOAT_EQ(0.8f, m_atlas.getPageOccupancy(0u));
+
+        const GlyphMetricsVector glyphs3 = { { GlyphKey(GlyphId('c'), FakeFontId), 10, 6, 0, 0, 0 } };
+        const auto geometry3 = createTestGlyphGeometry(glyphs3);
+        EXPECT_EQ(0u, geometry3.atlasPage);
+        EXPECT_EQ(1u, m_atlas.getPageCount());
+        EXPECT_FLOAT_EQ(0.7f, m_atlas.getPageOccupancy(0u));
     }
 }
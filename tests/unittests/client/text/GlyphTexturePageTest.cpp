@@ -272,6 +272,19 @@ namespace ramses::internal
         EXPECT_EQ(m_glyphPage->getFreeSpace().size(), 1u);
     }
 
+    TEST_F(AGlyphTexturePage, reportsOccupiedAreaOfClaimedSpace)
+    {
+        EXPECT_EQ(PageWidth * PageHeight, m_glyphPage->getArea());
+        EXPECT_EQ(0u, m_glyphPage->getOccupiedArea());
+
+        auto claimedSpace = QuadSize(3, 3);
+        auto offset = m_glyphPage->claimSpace(0, claimedSpace);
+        EXPECT_EQ(claimedSpace.getArea(), m_glyphPage->getOccupiedArea());
+
+        m_glyphPage->releaseSpace(Quad(offset, claimedSpace));
+        EXPECT_EQ(0u, m_glyphPage->getOccupiedArea());
+    }
+
     TEST_F(AGlyphTexturePage, claimingSpaceTwiceWithSameWidthOrHeightLeadsToMergeOnRevert)
     {
         uint32_t fullArea = PageWidth * PageHeight;
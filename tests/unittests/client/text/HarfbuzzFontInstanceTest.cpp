@@ -354,6 +354,39 @@ namespace ramses::internal
         EXPECT_EQ(it, positionedGlyphs.end());
     }
 
+    TEST_F(AHarfbuzzFontInstance, ReusesShapingResultsOfRepeatedStrings)
+    {
+        auto& fontInstance = static_cast<HarfbuzzFontInstance&>(*FontInstanceArabic);
+        const std::u32string str = U"\uFEB3\uFEE0\uFE8E\uFEE1 12:34";
+
+        const GlyphMetricsVector positionedGlyphs = GetPositionedGlyphs(str, fontInstance);
+        const size_t cacheSize = fontInstance.getShapingCacheSize();
+        EXPECT_GE(cacheSize, 1u);
+
+        // same result when shaped again without storing it once more
+        EXPECT_EQ(positionedGlyphs, GetPositionedGlyphs(str, fontInstance));
+        EXPECT_EQ(cacheSize, fontInstance.getShapingCacheSize());
+
+        // cached result is appended to already present glyphs
+        GlyphMetricsVector appendedGlyphs = positionedGlyphs;
+        fontInstance.loadAndAppendGlyphMetrics(str.cbegin(), str.cend(), appendedGlyphs);
+        ASSERT_EQ(2 * positionedGlyphs.size(), appendedGlyphs.size());
+        EXPECT_TRUE(std::equal(positionedGlyphs.cbegin(), positionedGlyphs.cend(), appendedGlyphs.cbegin() + positionedGlyphs.size()));
+    }
+
+    TEST_F(AHarfbuzzFontInstance, LimitsNumberOfCachedShapingResults)
+    {
+        auto& fontInstance = static_cast<HarfbuzzFontInstance&>(*FontInstanceJapanese);
+        for (size_t i = 0u; i < HarfbuzzFontInstance::ShapingCacheCapacity + 10u; ++i)
+        {
+            // unique string for every iteration
+            std::u32string str(i / 26u + 1u, U'0');
+            str.push_back(static_cast<char32_t>(U'a' + i % 26u));
+            std::ignore = GetPositionedGlyphs(str, fontInstance);
+        }
+        EXPECT_EQ(HarfbuzzFontInstance::ShapingCacheCapacity, fontInstance.getShapingCacheSize());
+    }
+
     TEST_F(AHarfbuzzFontInstance, ProducesEmptyListOfGlyphsWhenGivenEmptyString)
     {
         const std::u32string str = {}; //U""; empty string
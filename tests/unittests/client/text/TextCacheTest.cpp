@@ -16,6 +16,7 @@
 #include "ramses/client/UniformInput.h"
 #include "ramses/client/MeshNode.h"
 #include "ramses/client/ArrayBuffer.h"
+#include "ramses/client/Effect.h"
 #include "ramses/client/EffectDescription.h"
 #include "ramses/client/ramses-utils.h"
 #include "gtest/gtest.h"
@@ -399,6 +400,26 @@ namespace ramses::internal
         EXPECT_EQ(16u, textLine->textureCoordinates->getUsedNumberOfElements());
     }
 
+    TEST_F(ATextCache, createsTextLineWithDistanceFieldGlyphsAndDefaultDistanceFieldEffect)
+    {
+        const auto fontInstance = FRegistry->createFreetype2FontInstanceWithDistanceField(LatinFont, 12, 2u);
+        ASSERT_TRUE(fontInstance.isValid());
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"test", fontInstance);
+
+        Effect* textEffect = m_scene.createEffect(TextCache::CreateDistanceFieldTextEffectDescription());
+        ASSERT_TRUE(textEffect != nullptr);
+        EXPECT_TRUE(textEffect->findUniformInput("u_color").has_value());
+
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        EXPECT_TRUE(textLineId.isValid());
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        EXPECT_EQ(24u, textLine->meshNode->getIndexCount());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+        EXPECT_TRUE(FRegistry->deleteFontInstance(fontInstance));
+    }
+
     TEST_F(ATextCache, createsMultipleTextLines)
     {
         const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
@@ -444,6 +465,68 @@ namespace ramses::internal
         EXPECT_EQ(24u, textLine2->textureCoordinates->getUsedNumberOfElements());
     }
 
+    TEST_F(ATextCache, updatesTextLineKeepingItsSceneObjects)
+    {
+        Effect* textEffect = CreateTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextLineId textLineId = m_textCache.createTextLine(m_textCache.getPositionedGlyphs(U"12:34", LatinFontInstance12), *textEffect);
+        ASSERT_TRUE(textLineId.isValid());
+        const TextLine textLineBeforeUpdate = *m_textCache.getTextLine(textLineId);
+
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"5:6", LatinFontInstance12);
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, positionedGlyphs));
+
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        ASSERT_TRUE(textLine != nullptr);
+        EXPECT_EQ(positionedGlyphs, textLine->glyphs);
+        EXPECT_EQ(textLineBeforeUpdate.meshNode, textLine->meshNode);
+        EXPECT_EQ(textLineBeforeUpdate.indices, textLine->indices);
+        EXPECT_EQ(textLineBeforeUpdate.positions, textLine->positions);
+        EXPECT_EQ(textLineBeforeUpdate.textureCoordinates, textLine->textureCoordinates);
+        EXPECT_EQ(18u, textLine->meshNode->getIndexCount());
+        // used size of buffers shrinks with text
+        EXPECT_EQ(18u, textLine->indices->getUsedNumberOfElements());
+        EXPECT_EQ(12u, textLine->positions->getUsedNumberOfElements());
+        EXPECT_EQ(12u, textLine->textureCoordinates->getUsedNumberOfElements());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+    }
+
+    TEST_F(ATextCache, updatesTextLineWithLongerTextUsingNewBuffers)
+    {
+        Effect* textEffect = CreateTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const TextLineId textLineId = m_textCache.createTextLine(m_textCache.getPositionedGlyphs(U"12", LatinFontInstance12), *textEffect);
+        ASSERT_TRUE(textLineId.isValid());
+        const MeshNode* meshNode = m_textCache.getTextLine(textLineId)->meshNode;
+
+        EXPECT_TRUE(m_textCache.updateTextLine(textLineId, m_textCache.getPositionedGlyphs(U"12345", LatinFontInstance12)));
+
+        const TextLine* textLine = m_textCache.getTextLine(textLineId);
+        EXPECT_EQ(meshNode, textLine->meshNode);
+        EXPECT_EQ(30u, textLine->meshNode->getIndexCount());
+        EXPECT_EQ(30u, textLine->indices->getUsedNumberOfElements());
+        EXPECT_EQ(20u, textLine->positions->getUsedNumberOfElements());
+        EXPECT_EQ(20u, textLine->textureCoordinates->getUsedNumberOfElements());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId));
+    }
+
+    TEST_F(ATextCache, failsToUpdateNonExistingTextLineOrWithNonRenderableGlyphs)
+    {
+        EXPECT_FALSE(m_textCache.updateTextLine(TextLineId(1u), m_textCache.getPositionedGlyphs(U"1", LatinFontInstance12)));
+
+        Effect* textEffect = CreateTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"12", LatinFontInstance12);
+        const TextLineId textLineId = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        ASSERT_TRUE(textLineId.isValid());
+
+        EXPECT_FALSE(m_textCache.updateTextLine(textLineId, m_textCache.getPositionedGlyphs(U"  ", LatinFontInstance12)));
+        EXPECT_EQ(positionedGlyphs, m_textCache.getTextLine(textLineId)->glyphs);
+        EXPECT_EQ(12u, m_textCache.getTextLine(textLineId)->meshNode->getIndexCount());
+    }
+
     TEST_F(ATextCache, deletesTextLine)
     {
         const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
@@ -240,4 +240,29 @@ namespace ramses::internal
         EXPECT_EQ(0u, result.inputCharsConsumed);
         EXPECT_EQ(0u, result.codePoint);
     }
+
+    TEST(UtfUtils, ConvertsLongAsciiAndMixedStringsToUTF32)
+    {
+        std::u32string utf32String;
+        for (char32_t i = 0; i < 100; ++i)
+            utf32String.push_back(U'a' + (i % 26));
+        EXPECT_EQ(utf32String, UtfUtils::ConvertUtf8ToUtf32(UtfUtils::ConvertStrUtf32ToUtf8(utf32String)));
+
+        // non-ASCII characters at different offsets within and between ASCII runs
+        utf32String[0] = 0xa2;
+        utf32String[15] = 0xc0b;
+        utf32String[16] = 0x10425;
+        utf32String[50] = 0xa2;
+        utf32String[99] = 0xc0b;
+        EXPECT_EQ(utf32String, UtfUtils::ConvertUtf8ToUtf32(UtfUtils::ConvertStrUtf32ToUtf8(utf32String)));
+    }
+
+    TEST(UtfUtils, SkipsInvalidUTF8BytesWithinLongAsciiRuns)
+    {
+        std::string utf8String(40u, 'x');
+        utf8String[5] = static_cast<char>(0xff);
+        utf8String[20] = static_cast<char>(0x80);
+        utf8String[33] = static_cast<char>(0xc2);
+        EXPECT_EQ(std::u32string(37u, U'x'), UtfUtils::ConvertUtf8ToUtf32(utf8String));
+    }
 }
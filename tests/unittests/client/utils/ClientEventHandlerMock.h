@@ -24,6 +24,7 @@ namespace ramses::internal
 
         MOCK_METHOD(void, sceneFileLoadFailed, (std::string_view filename), (override));
         MOCK_METHOD(void, sceneFileLoadSucceeded, (std::string_view filename, ramses::Scene* loadedScene), (override));
+        MOCK_METHOD(void, sceneFileLoadProgress, (std::string_view filename, size_t bytesLoaded, size_t bytesTotal), (override));
         MOCK_METHOD(void, sceneReferenceStateChanged, (ramses::SceneReference& sceneRef, RendererSceneState state), (override));
         MOCK_METHOD(void, sceneReferenceFlushed, (ramses::SceneReference& sceneRef, sceneVersionTag_t versionTag), (override));
         MOCK_METHOD(void, dataLinked, (sceneId_t providerScene, dataProviderId_t providerId, sceneId_t consumerScene, dataConsumerId_t consumerId, bool success), (override));
@@ -36,10 +36,12 @@ namespace ramses::internal
         MOCK_METHOD(bool, sendUnsubscribeScene, (const Guid& to, const SceneId& sceneId), (override));
 
         MOCK_METHOD(bool, sendInitializeScene, (const Guid& to, const SceneId& sceneId), (override));
-        MOCK_METHOD(bool, sendSceneUpdate, (const Guid& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer), (override));
+        MOCK_METHOD(bool, sendSceneUpdate, (const std::vector<Guid>& to, const SceneId& sceneId, const ISceneUpdateSerializer& serializer), (override));
 
         MOCK_METHOD(bool, sendRendererEvent, (const Guid& to, const SceneId& sceneId, const std::vector<std::byte>& data), (override));
 
+        MOCK_METHOD(void, setHighPriorityScene, (const SceneId& sceneId, bool highPriority), (override));
+
         MOCK_METHOD(void, logConnectionInfo, (), (override));
         MOCK_METHOD(void, triggerLogMessageForPeriodicLog, (), (override));
 
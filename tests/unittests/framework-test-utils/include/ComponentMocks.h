@@ -13,7 +13,9 @@
 #include "internal/SceneGraph/Resource/IResource.h"
 #include "internal/SceneGraph/Scene/ClientScene.h"
 #include "internal/SceneGraph/Scene/EScenePublicationMode.h"
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
 #include "internal/Components/ISceneGraphProviderComponent.h"
+#include "internal/Components/AsyncSceneUpdateSender.h"
 #include "internal/Components/ManagedResource.h"
 #include "internal/Components/ISceneGraphConsumerComponent.h"
 #include "internal/Components/IResourceProviderComponent.h"
@@ -55,8 +57,13 @@ namespace ramses::internal
         MOCK_METHOD(void, handleCreateScene, (ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& consumer), (override));
         MOCK_METHOD(void, handlePublishScene, (SceneId sceneId, EScenePublicationMode publicationMode), (override));
         MOCK_METHOD(void, handleUnpublishScene, (SceneId sceneId), (override));
+        MOCK_METHOD(void, handlePrepareFlush, (SceneId sceneId), (override));
         MOCK_METHOD(bool, handleFlush, (SceneId sceneId, const FlushTimeInformation&, SceneVersionTag), (override));
         MOCK_METHOD(void, handleRemoveScene, (SceneId sceneId), (override));
+        MOCK_METHOD(void, handleEnableAsyncFlush, (SceneId sceneId, AsyncSceneUpdateSender& sender), (override));
+        MOCK_METHOD(void, handleEnableHighPriorityUpdates, (SceneId sceneId), (override));
+        MOCK_METHOD(void, handleEnableSceneActionDeltaEncoding, (SceneId sceneId, uint32_t transformQuantizationBits), (override));
+        MOCK_METHOD(void, collectSceneMemoryProfile, (SceneId sceneId, SceneMemoryProfile& profile), (const, override));
     };
 
     class SceneGraphConsumerComponentMock : public ISceneGraphConsumerComponent
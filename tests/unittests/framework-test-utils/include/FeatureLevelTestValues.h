@@ -16,11 +16,11 @@ namespace ramses::internal
     // List of test values for all supported feature levels.
     // Usage: derive test class from ::testing::TestWithParam<ramses::EFeatureLevel>
     //        and use RAMSES_INSTANTIATE_FEATURELEVEL_TEST_SUITE below to instantiate them
-    [[nodiscard]] inline ::testing::internal::ValueArray<ramses::EFeatureLevel, ramses::EFeatureLevel>
+    [[nodiscard]] inline ::testing::internal::ValueArray<ramses::EFeatureLevel, ramses::EFeatureLevel, ramses::EFeatureLevel>
         GetFeatureLevelTestValues()
     {
-        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_02, "Update this list!");
-        return ::testing::Values(ramses::EFeatureLevel_01, ramses::EFeatureLevel_02);
+        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_03, "Update this list!");
+        return ::testing::Values(ramses::EFeatureLevel_01, ramses::EFeatureLevel_02, ramses::EFeatureLevel_03);
     }
 
     // List of test values for feature level templated tests but containing only the latest feature level.
@@ -37,12 +37,12 @@ namespace ramses::internal
         _testName ## Tests, \
         _testName, \
         ramses::internal::GetFeatureLevelTestValues()); \
-        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_02, "Re-evaluate which tests need to be instantiated for all feature levels");
+        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_03, "Re-evaluate which tests need to be instantiated for all feature levels");
 
 #define RAMSES_INSTANTIATE_LATEST_FEATURELEVEL_ONLY_TEST_SUITE(_testName) \
     INSTANTIATE_TEST_SUITE_P( \
         _testName ## Tests, \
         _testName, \
         ramses::internal::GetLatestFeatureLevelOnlyTestValues()); \
-        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_02, "Re-evaluate which tests need to be instantiated for all feature levels");
+        static_assert(ramses::EFeatureLevel_Latest == ramses::EFeatureLevel_03, "Re-evaluate which tests need to be instantiated for all feature levels");
 }
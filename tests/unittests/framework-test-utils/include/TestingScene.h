@@ -94,6 +94,12 @@ namespace ramses::internal
             scene.setRenderableVisibility(renderable, EVisibilityMode::Invisible);
             scene.setRenderableInstanceCount(renderable, renderableInstanceCount);
             scene.setRenderableStartVertex(renderable, startVertex);
+            if (featureLevel >= EFeatureLevel_03)
+            {
+                scene.setRenderableBoundingSphere(renderable, boundingSphere);
+                scene.setRenderableInstancePositions(renderable, vertexDataBuffer);
+                scene.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+            }
             scene.allocateRenderable(child, renderable2);
 
             DataFieldInfoVector uniformLayoutDataFields{
@@ -142,6 +148,8 @@ namespace ramses::internal
             scene.setDataSingleBoolean(uniformData, DataFieldHandle(8), false);
             if (featureLevel >= EFeatureLevel_02)
                 scene.setDataUniformBuffer(uniformData, DataFieldHandle(9), uniformBuffer);
+            if (featureLevel >= EFeatureLevel_03)
+                scene.setDataInstanceUniformTimeAnimationEnd(uniformData, 2500);
 
             scene.allocateDataInstance(vertexLayout, geometryData);
             scene.setDataResource(geometryData, DataFieldHandle(0u), indexArrayHash, DataBufferHandle::Invalid(), indexArrayDivisor, 0u, 0u);
@@ -181,6 +189,13 @@ namespace ramses::internal
             scene.setRenderPassRenderOrder(renderPass, 1);
             scene.setRenderPassEnabled(renderPass, false);
             scene.setRenderPassRenderOnce(renderPass, true);
+            if (featureLevel >= EFeatureLevel_03)
+            {
+                scene.setRenderPassStateSorting(renderPass, true);
+                scene.setRenderPassFrontToBackSorting(renderPass, true);
+                scene.setRenderPassBackToFrontSorting(renderPass, true);
+                scene.setRenderPassDepthPrePass(renderPass, true);
+            }
 
             scene.addRenderGroupToRenderPass(renderPass, renderGroup, 15);
             scene.addRenderGroupToRenderPass(renderPass, renderGroup2, 5);
@@ -213,6 +228,8 @@ namespace ramses::internal
             scene.requestSceneReferenceState(sceneRef, RendererSceneState::Ready);
             scene.requestSceneReferenceFlushNotifications(sceneRef, true);
             scene.setSceneReferenceRenderOrder(sceneRef, -13);
+            if (featureLevel >= EFeatureLevel_03)
+                scene.setSceneReferencePreload(sceneRef, RendererSceneState::Ready, 5);
         }
 
         void VerifyContent(const IScene& otherScene) const
@@ -312,6 +329,9 @@ namespace ramses::internal
             EXPECT_EQ(EVisibilityMode::Invisible, renderableData.visibilityMode);
             EXPECT_EQ(renderableInstanceCount, renderableData.instanceCount);
             EXPECT_EQ(startVertex, renderableData.startVertex);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? boundingSphere : Renderable{}.boundingSphere, renderableData.boundingSphere);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? getMappedHandle(vertexDataBuffer) : DataBufferHandle::Invalid(), renderableData.instancePositions);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? levelsOfDetail : RenderableLevelsOfDetail{}, renderableData.levelsOfDetail);
         }
 
         void CheckStatesEquivalentTo(const IScene& otherScene) const
@@ -442,6 +462,8 @@ namespace ramses::internal
             EXPECT_EQ(getMappedHandle(dataRef), otherScene.getDataReference(uniformData, DataFieldHandle(5u)));
             EXPECT_EQ(getMappedHandle(samplerWithExternalTexture), otherScene.getDataTextureSamplerHandle(uniformData, DataFieldHandle(6u)));
             EXPECT_EQ(TextureSampler::ContentType::ExternalTexture, otherScene.getTextureSampler(samplerWithExternalTexture).contentType);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? 2500 : DataInstance::UnboundedUniformTimeAnimationEnd, otherScene.getDataInstanceUniformTimeAnimationEnd(uniformData));
+            EXPECT_EQ(DataInstance::UnboundedUniformTimeAnimationEnd, otherScene.getDataInstanceUniformTimeAnimationEnd(geometryData));
         }
 
         void CheckTextureSamplersEquivalentTo(const IScene& otherScene) const
@@ -512,6 +534,10 @@ namespace ramses::internal
             EXPECT_EQ(EClearFlag::None, rp.clearFlags);
             EXPECT_FALSE(rp.isEnabled);
             EXPECT_TRUE(rp.isRenderOnce);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03, rp.isStateSorted);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03, rp.isFrontToBackSorted);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03, rp.isBackToFrontSorted);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03, rp.hasDepthPrePass);
 
             ASSERT_TRUE(RenderGroupUtils::ContainsRenderGroup(getMappedHandle(renderGroup), rp));
             EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(getMappedHandle(renderGroup2), rp));
@@ -638,6 +664,8 @@ namespace ramses::internal
             EXPECT_EQ(RendererSceneState::Ready, sr.requestedState);
             EXPECT_EQ(-13, sr.renderOrder);
             EXPECT_TRUE(sr.flushNotifications);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? RendererSceneState::Ready : RendererSceneState::Available, sr.preloadState);
+            EXPECT_EQ(m_featureLevel >= EFeatureLevel_03 ? 5 : 0, sr.preloadPriority);
         }
 
         void CheckSceneUniformBuffersEquivalentTo(const IScene& otherScene) const
@@ -657,6 +685,8 @@ namespace ramses::internal
         const uint32_t                startIndex                      = 12u;
         const uint32_t                indexCount                      = 13u;
         const uint32_t                startVertex                     = 14u;
+        const glm::vec4               boundingSphere                  { 1.f, 2.f, 3.f, 4.f };
+        const RenderableLevelsOfDetail levelsOfDetail                 { { RenderableLevelOfDetail{ 25u, 7u, 0.5f }, RenderableLevelOfDetail{ 32u, 3u, 0.1f } }, 2u };
         const glm::vec3               t1Translation                   {1, 2, 3};
         const glm::vec3               t1Rotation                      {4, 5, 6};
         const glm::vec3               t1Scaling                       {7,8, 9};
@@ -8,6 +8,8 @@
 
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 #include "internal/Communication/TransportCommon/SceneUpdateStreamDeserializer.h"
+#include "internal/Communication/TransportCommon/SingleSceneUpdateWriter.h"
+#include "internal/Core/Utils/RawBinaryOutputStream.h"
 #include "internal/Components/SceneUpdate.h"
 #include "internal/SceneGraph/Scene/SceneActionCollection.h"
 #include "gtest/gtest.h"
@@ -24,7 +26,7 @@ namespace ramses::internal
     class ASceneUpdateSerialization : public ::testing::Test
     {
     public:
-        bool serialize(size_t pktSize)
+        bool serialize(size_t pktSize, bool compressSceneActions = false)
         {
             SceneUpdateSerializer sus(update, sceneStatistics, EFeatureLevel_Latest);
             std::vector<std::byte> vec(pktSize);
@@ -32,7 +34,7 @@ namespace ramses::internal
                 data.push_back(vec);
                 data.back().resize(s);
                 return true;
-            });
+            }, compressSceneActions);
         }
 
         void addTestActions()
@@ -134,6 +136,47 @@ namespace ramses::internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeCompressedSceneActions)
+    {
+        for (size_t i = 0; i < 2000; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(1000, false));
+        const size_t uncompressedPackets = data.size();
+        data.clear();
+
+        EXPECT_TRUE(serialize(1000, true));
+        EXPECT_LT(data.size(), uncompressedPackets);
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, failsDeserializeCompressedSceneActionsWithDecompressedSizeAboveLimit)
+    {
+        for (size_t i = 0; i < 2000; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(1000, true));
+
+        // packet header (number, flag), block header (type, size), decompressed description size, decompressed data size
+        constexpr size_t dataSizeOffset = sizeof(uint32_t) * 5;
+        RawBinaryOutputStream os(data[0].data() + dataSizeOffset, sizeof(uint32_t));
+        os << static_cast<uint32_t>(SingleSceneUpdateWriter::MaxDecompressedSceneActionSize);
+
+        const auto result = deserialize();
+        EXPECT_EQ(SceneUpdateStreamDeserializer::ResultType::Failed, result.result);
+    }
+
+    TEST_F(ASceneUpdateSerialization, doesNotCompressSceneActionsBelowThreshold)
+    {
+        for (size_t i = 0; i < 10; ++i)
+            addTestActions();
+        EXPECT_TRUE(serialize(1000, false));
+        const auto uncompressedData = data;
+        data.clear();
+
+        EXPECT_TRUE(serialize(1000, true));
+        EXPECT_EQ(uncompressedData, data);
+        expectDeserializeToSame();
+    }
+
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenPacketTooSmall)
     {
         EXPECT_FALSE(serialize(49));
@@ -209,7 +252,7 @@ namespace ramses::internal
         std::vector<std::byte> vec(60);
         EXPECT_FALSE(sus.writeToPackets({vec.data(), vec.size()}, [&](size_t) {
             return false;
-        }));
+        }, false));
     }
 
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnLaterPacketInResource)
@@ -222,7 +265,7 @@ namespace ramses::internal
             if (++cnt == 10)
                 return false;
             return true;
-        }));
+        }, false));
     }
 
     TEST_F(ASceneUpdateSerialization, failsSerializeWhenWriteFunctionFailsOnLaterPacketInSceneActions)
@@ -236,7 +279,7 @@ namespace ramses::internal
             if (++cnt == 5)
                 return false;
             return true;
-        }));
+        }, false));
     }
 
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeSceneActionsWithoutData)
@@ -287,6 +330,30 @@ namespace ramses::internal
         expectDeserializeToSame();
     }
 
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeComplexUpdateInSinglePacket)
+    {
+        update.resources.push_back(CreateTestResource(100));
+        update.resources.push_back(CreateTestResource(200));
+        for (size_t i = 0; i < 100; ++i)
+            addTestActions();
+        addFlushInformation();
+        EXPECT_TRUE(serialize(100000));
+        EXPECT_EQ(1u, data.size());
+        expectDeserializeToSame();
+    }
+
+    TEST_F(ASceneUpdateSerialization, canSerializeDeserializeMixOfFragmentedAndNonFragmentedBlocks)
+    {
+        update.resources.push_back(CreateTestResource(10));
+        update.resources.push_back(CreateTestResource(5000));
+        update.resources.push_back(CreateTestResource(10));
+        addTestActions();
+        addFlushInformation();
+        EXPECT_TRUE(serialize(1000));
+        EXPECT_LT(1u, data.size());
+        expectDeserializeToSame();
+    }
+
     TEST_F(ASceneUpdateSerialization, canSerializeDeserializeSameUpdateMultipleTimesWithSameDeserializer)
     {
         update.resources.push_back(CreateTestResource(100));
@@ -313,7 +380,7 @@ namespace ramses::internal
             expectDeserializeToSame();
         }
         data.clear();
-        update = { SceneActionCollection{}, {}, {}};
+        update = { SceneActionCollection{}, {}, {}, {} };
         {
             update.resources.push_back(CreateTestResource(5));
             update.resources.push_back(CreateTestResource(120));
@@ -370,7 +437,7 @@ namespace ramses::internal
         for (int run = 0; run < 500; ++run)
         {
             data.clear();
-            update = { SceneActionCollection{}, {}, {} };
+            update = { SceneActionCollection{}, {}, {}, {} };
             const uint32_t numActions = rnd(0, 200);
             for (uint32_t i = 0; i < numActions; ++i)
             {
@@ -0,0 +1,91 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Components/AsyncSceneUpdateSender.h"
+#include "ManuallyExecutedTaskQueue.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ramses::internal
+{
+    class AnAsyncSceneUpdateSender : public ::testing::Test
+    {
+    protected:
+        ~AnAsyncSceneUpdateSender() override
+        {
+            taskQueue.executeAll();
+        }
+
+        ManuallyExecutedTaskQueue taskQueue;
+        AsyncSceneUpdateSender sender{ taskQueue, 2u };
+    };
+
+    TEST_F(AnAsyncSceneUpdateSender, hasNoPendingSendsInitially)
+    {
+        EXPECT_EQ(0u, sender.getPendingSendCount());
+        EXPECT_EQ(2u, sender.getMaxPendingSends());
+        sender.waitForFreeSlot();
+        sender.waitForPendingSends();
+    }
+
+    TEST_F(AnAsyncSceneUpdateSender, limitsMaxPendingSendsToAtLeastOne)
+    {
+        AsyncSceneUpdateSender otherSender(taskQueue, 0u);
+        EXPECT_EQ(1u, otherSender.getMaxPendingSends());
+    }
+
+    TEST_F(AnAsyncSceneUpdateSender, executesSendsOnTaskQueueInEnqueueOrder)
+    {
+        std::vector<int> sent;
+        sender.enqueue([&]() { sent.push_back(1); });
+        sender.enqueue([&]() { sent.push_back(2); });
+        sender.enqueue([&]() { sent.push_back(3); });
+        EXPECT_TRUE(sent.empty());
+        EXPECT_EQ(3u, sender.getPendingSendCount());
+
+        // only one send is handed over to task queue at a time
+        EXPECT_TRUE(taskQueue.executeNext());
+        EXPECT_EQ((std::vector<int>{ 1 }), sent);
+        EXPECT_EQ(2u, sender.getPendingSendCount());
+
+        taskQueue.executeAll();
+        EXPECT_EQ((std::vector<int>{ 1, 2, 3 }), sent);
+        EXPECT_EQ(0u, sender.getPendingSendCount());
+    }
+
+    TEST_F(AnAsyncSceneUpdateSender, releasesCapturedDataAfterSend)
+    {
+        auto data = std::make_shared<int>(1);
+        sender.enqueue([data]() {});
+        EXPECT_EQ(2, data.use_count());
+        taskQueue.executeAll();
+        EXPECT_EQ(1, data.use_count());
+    }
+
+    TEST_F(AnAsyncSceneUpdateSender, waitsForFreeSlotUntilSendFinished)
+    {
+        std::atomic<int> sentCount{ 0 };
+        sender.enqueue([&]() { ++sentCount; });
+        sender.enqueue([&]() { ++sentCount; });
+
+        std::thread worker([&]() { taskQueue.executeNext(); });
+        sender.waitForFreeSlot();
+        EXPECT_GE(sentCount, 1);
+        worker.join();
+
+        worker = std::thread([&]() { taskQueue.executeAll(); });
+        sender.waitForPendingSends();
+        EXPECT_EQ(2, sentCount);
+        EXPECT_EQ(0u, sender.getPendingSendCount());
+        worker.join();
+    }
+}
@@ -113,6 +113,7 @@ public:
         EXPECT_CALL(this->m_resourceComponent, resolveResources(_)).Times(AnyNumber()).WillRepeatedly(Return(ManagedResourceVector{}));
         EXPECT_CALL(this->m_resourceComponent, knowsResource(_)).Times(AnyNumber()).WillRepeatedly(Return(true));
         EXPECT_CALL(this->m_resourceComponent, getResourceInfo(_)).Times(AnyNumber()).WillRepeatedly(ReturnRef(this->m_resInfo[0]));
+        EXPECT_CALL(this->m_resourceComponent, getResource(_)).Times(AnyNumber()).WillRepeatedly(Return(ManagedResource{}));
         this->m_arrayResourceRaw->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
         this->m_textureResourceRaw->setResourceData(ResourceBlob{ 1 }, { 2u, 2u });
     }
@@ -179,7 +180,8 @@ protected:
         EXPECT_CALL(m_sceneGraphProviderComponent, sendUnpublishScene(m_sceneId, _));
     }
 
-    void expectResourceQueries(ManagedResourceVector const& newResources = {}, ManagedResourceVector allResources = {}, bool otherResChanges = false, bool expectResolveAllResourcesForDirect = false, bool expectResolveAllResourcesForShadowCopy = true)
+    void expectResourceQueries(ManagedResourceVector const& newResources = {}, ManagedResourceVector allResources = {}, bool otherResChanges = false, bool expectResolveAllResourcesForDirect = false, bool expectResolveAllResourcesForShadowCopy = true,
+        bool expectResolveNewResources = true)
     {
         Mock::VerifyAndClearExpectations(&this->m_resourceComponent);
 
@@ -200,7 +202,18 @@ protected:
             std::sort(newHashes.begin(), newHashes.end());
 
             if (!newResources.empty())
-                EXPECT_CALL(this->m_resourceComponent, resolveResources(newHashes)).WillOnce(Return(newResources));
+            {
+                // without active subscriber new resources are only checked to be known, but not loaded
+                if (expectResolveNewResources)
+                {
+                    EXPECT_CALL(this->m_resourceComponent, resolveResources(newHashes)).WillOnce(Return(newResources));
+                }
+                else
+                {
+                    for (auto const& hash : newHashes)
+                        EXPECT_CALL(this->m_resourceComponent, knowsResource(hash)).WillOnce(Return(true));
+                }
+            }
 
             for (auto const& hash : allHashes)
             {
@@ -218,7 +231,21 @@ protected:
         // shadow scene logic will do an additional resolve for all resources when resources changed to keep them alive
         // direct scene logic will do an additional resolve if there was a subscriber since last flush
         if ((expectResolveAllResourcesForShadowCopy && std::is_same<T, ClientSceneLogicShadowCopy>()) || (expectResolveAllResourcesForDirect && std::is_same<T, ClientSceneLogicDirect>()))
+        {
             EXPECT_CALL(this->m_resourceComponent, resolveResources(allHashes)).WillOnce(Return(allResources));
+        }
+        // without subscriber shadow scene logic keeps only resources alive which are already loaded
+        else if (std::is_same<T, ClientSceneLogicShadowCopy>() && (!newResources.empty() || otherResChanges))
+        {
+            for (auto const& hash : allHashes)
+            {
+                EXPECT_CALL(this->m_resourceComponent, getResource(hash)).WillOnce([this](auto const& hash_)
+                    {
+                        auto it = std::find_if(this->m_resourcesInMemory.begin(), this->m_resourcesInMemory.end(), [&hash_](auto const& res) { return res->getHash() == hash_; });
+                        return it != this->m_resourcesInMemory.end() ? *it : ManagedResource{};
+                    });
+            }
+        }
     }
 
     void expectStatistics(EResourceStatisticIndex index, std::vector<uint64_t> cmp)
@@ -245,6 +272,7 @@ protected:
     ManagedResource m_effectResource;
     ManagedResource m_textureResource;
     std::vector<ResourceInfo> m_resInfo;
+    ManagedResourceVector m_resourcesInMemory; // returned by getResource, others are not loaded yet
 };
 
 class AClientSceneLogic_ShadowCopy : public AClientSceneLogic_All<ClientSceneLogicShadowCopy>
@@ -374,6 +402,28 @@ TYPED_TEST(AClientSceneLogic_All, flushesPendingActionsIfSceneDistributedAndHasP
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, sendsActionsTakenOverWhenPreparingFlushTogetherWithActionsCollectedAfterwards)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    this->m_scene.allocateNode(0, {});
+    this->m_sceneLogic.prepareFlush();
+    EXPECT_TRUE(this->m_scene.getSceneActionCollection().empty());
+    this->m_scene.allocateTransform(NodeHandle{ 0u }, {});
+
+    SceneActionCollection receivedActions;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _))
+        .WillOnce([&](const auto&, const SceneUpdate& update, auto, auto, auto&) { receivedActions = update.actions.copy(); });
+    this->m_sceneLogic.flushSceneActions({}, {});
+
+    ASSERT_EQ(2u, receivedActions.numberOfActions());
+    EXPECT_EQ(ESceneActionId::AllocateNode, receivedActions[0].type());
+    EXPECT_EQ(ESceneActionId::AllocateTransform, receivedActions[1].type());
+    EXPECT_TRUE(this->m_scene.getSceneActionCollection().empty());
+
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_Direct, unskippableEmptyFlushesGeneratesSceneActionSentToSubscriber)
 {
     // has and checks first flush
@@ -885,6 +935,124 @@ TEST_F(AClientSceneLogic_ShadowCopy, canSubscribeToSceneEvenWithPendingActions)
     this->expectSceneUnpublish();
 }
 
+TEST_F(AClientSceneLogic_ShadowCopy, sendsStateOfAllPreviousFlushesToNewSubscriber)
+{
+    // add some active subscriber so actions are flushed
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, _, _, _)).Times(3);
+    const NodeHandle node = this->m_scene.allocateNode(0, {});
+    const TransformHandle transform = this->m_scene.allocateTransform(node, {});
+    this->flush();
+    this->m_scene.setTranslation(transform, { 1.f, 2.f, 3.f });
+    this->flush();
+    this->m_scene.setTranslation(transform, { 4.f, 5.f, 6.f });
+    this->flush();
+
+    const Guid newRendererID("12345678-1234-5678-0000-123456789012");
+    SceneActionCollection receivedActions;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, this->m_sceneInfo));
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ newRendererID }, _, _, _, _)).WillOnce([&](const auto&, const SceneUpdate& update, auto, auto, auto&) { receivedActions = update.actions.copy(); });
+    this->m_sceneLogic.addSubscriber(newRendererID);
+
+    Scene receivedScene;
+    SceneActionApplier::ApplyActionsOnScene(receivedScene, receivedActions, EFeatureLevel_Latest);
+    ASSERT_TRUE(receivedScene.isTransformAllocated(transform));
+    EXPECT_EQ(node, receivedScene.getTransformNode(transform));
+    EXPECT_EQ(glm::vec3(4.f, 5.f, 6.f), receivedScene.getTranslation(transform));
+
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_ShadowCopy, defersSceneDescriptionForNewSubscriberToSendOfUpdateWhenEnabled)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+    this->m_sceneLogic.enableAsyncSceneDescription();
+
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, _, _, _)).Times(2);
+    const NodeHandle node = this->m_scene.allocateNode(0, {});
+    const TransformHandle transform = this->m_scene.allocateTransform(node, {});
+    this->flush();
+    this->m_scene.setTranslation(transform, { 1.f, 2.f, 3.f });
+    this->flush();
+
+    const Guid newRendererID("12345678-1234-5678-0000-123456789012");
+    std::function<void(SceneUpdate&)> sceneDescription;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, this->m_sceneInfo));
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ newRendererID }, _, _, _, _)).WillOnce([&](const auto&, const SceneUpdate& update, auto, auto, auto&) {
+        EXPECT_TRUE(update.actions.empty());
+        EXPECT_EQ(3u, update.flushInfos.flushCounter);
+        EXPECT_TRUE(update.flushInfos.hasSizeInfo);
+        sceneDescription = update.sceneDescription;
+    });
+    this->m_sceneLogic.addSubscriber(newRendererID);
+    ASSERT_TRUE(sceneDescription);
+
+    const auto actionsSentBefore = this->m_scene.getStatisticCollection().statSceneActionsSent.getCounterValue();
+    SceneUpdate update;
+    sceneDescription(update);
+    EXPECT_FALSE(update.actions.empty());
+    EXPECT_EQ(actionsSentBefore + update.actions.numberOfActions(), this->m_scene.getStatisticCollection().statSceneActionsSent.getCounterValue());
+
+    Scene receivedScene;
+    SceneActionApplier::ApplyActionsOnScene(receivedScene, update.actions, EFeatureLevel_Latest);
+    ASSERT_TRUE(receivedScene.isTransformAllocated(transform));
+    EXPECT_EQ(node, receivedScene.getTransformNode(transform));
+    EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), receivedScene.getTranslation(transform));
+
+    this->expectSceneUnpublish();
+}
+
+TEST_F(AClientSceneLogic_ShadowCopy, deferredSceneDescriptionContainsStateOfFlushBeforeSubscriptionOnly)
+{
+    this->publishAndAddSubscriberWithoutPendingActions();
+    this->m_sceneLogic.enableAsyncSceneDescription();
+
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, _, _, _));
+    const NodeHandle node = this->m_scene.allocateNode(0, {});
+    const TransformHandle transform = this->m_scene.allocateTransform(node, {});
+    this->m_scene.setTranslation(transform, { 1.f, 2.f, 3.f });
+    this->flush();
+
+    const Guid newRendererID("12345678-1234-5678-0000-123456789012");
+    std::function<void(SceneUpdate&)> sceneDescription;
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(newRendererID, this->m_sceneInfo));
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ newRendererID }, _, _, _, _)).WillOnce([&](const auto&, const SceneUpdate& update, auto, auto, auto&) {
+        sceneDescription = update.sceneDescription;
+    });
+    this->m_sceneLogic.addSubscriber(newRendererID);
+    ASSERT_TRUE(sceneDescription);
+
+    // flushed while description is pending, sent to new subscriber as regular update after the scene
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID, newRendererID }, _, _, _, _));
+    this->m_scene.setTranslation(transform, { 4.f, 5.f, 6.f });
+    this->flush();
+
+    SceneUpdate update;
+    sceneDescription(update);
+    Scene receivedScene;
+    SceneActionApplier::ApplyActionsOnScene(receivedScene, update.actions, EFeatureLevel_Latest);
+    ASSERT_TRUE(receivedScene.isTransformAllocated(transform));
+    EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), receivedScene.getTranslation(transform));
+
+    // later flushes are applied to shadow copy again once description ran
+    const Guid thirdRendererID("12345678-1234-5678-0000-123456789013");
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendCreateScene(thirdRendererID, this->m_sceneInfo));
+    EXPECT_CALL(m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ thirdRendererID }, _, _, _, _)).WillOnce([&](const auto&, const SceneUpdate& sentUpdate, auto, auto, auto&) {
+        sceneDescription = sentUpdate.sceneDescription;
+    });
+    this->m_sceneLogic.addSubscriber(thirdRendererID);
+    ASSERT_TRUE(sceneDescription);
+
+    SceneUpdate thirdUpdate;
+    sceneDescription(thirdUpdate);
+    Scene thirdReceivedScene;
+    SceneActionApplier::ApplyActionsOnScene(thirdReceivedScene, thirdUpdate.actions, EFeatureLevel_Latest);
+    EXPECT_EQ(glm::vec3(4.f, 5.f, 6.f), thirdReceivedScene.getTranslation(transform));
+
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_Direct, canSubscribeToSceneEvenWithPendingActions)
 {
     // add some active subscriber so actions are queued
@@ -1290,7 +1458,7 @@ TEST_F(AClientSceneLogic_ShadowCopy, sendsSceneToNewlySubscribedRendererWithNewR
     auto layoutHandle = this->m_scene.allocateDataLayout({}, hash, {});
     auto instanceHandle = this->m_scene.allocateDataInstance(layoutHandle, {});
     this->m_scene.setRenderableDataInstance(rendHandle, ERenderableDataSlotType_Geometry, instanceHandle);
-    this->expectResourceQueries({ this->m_textureResource });
+    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, false, false);
     this->m_sceneLogic.flushSceneActions({}, {});
 
     this->m_scene.allocateNode(0, {}); // action not flushed
@@ -1368,7 +1536,7 @@ TEST_F(AClientSceneLogic_Direct, sendsSceneToNewlySubscribedRendererWithNewResou
     const ResourceContentHash hash = this->m_textureResource->getHash();
     auto layoutHandle = this->m_scene.allocateDataLayout({}, hash, {});
     auto instanceHandle = this->m_scene.allocateDataInstance(layoutHandle, {});
-    expectResourceQueries({ this->m_textureResource });
+    expectResourceQueries({ this->m_textureResource }, {}, false, false, false, false);
     this->m_scene.setRenderableDataInstance(rendHandle, ERenderableDataSlotType_Geometry, instanceHandle);
     this->m_sceneLogic.flushSceneActions({}, {});
 
@@ -1751,17 +1919,17 @@ TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushing)
     this->expectSceneUnpublish();
 }
 
-TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushingUnpublishedScene)
+TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesOfUnpublishedSceneOnlyWhenSentToSubscriber)
 {
     Mock::VerifyAndClearExpectations(&this->m_resourceComponent); // strict behavior for this test
 
     this->m_scene.allocateNode(0, {});
     this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), {}, {}, this->m_textureResource->getHash(), {} }, {});
-    this->expectResourceQueries({ this->m_textureResource });
+    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, false, false);
     this->flush();
     this->m_scene.allocateNode(0, {});
     this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(1u), {}, {}, this->m_arrayResource->getHash(), {} }, {});
-    this->expectResourceQueries({ this->m_arrayResource }, { this->m_arrayResource, this->m_textureResource });
+    this->expectResourceQueries({ this->m_arrayResource }, { this->m_arrayResource, this->m_textureResource }, false, false, false, false);
     this->flush();
     this->publish();
 
@@ -1779,6 +1947,18 @@ TYPED_TEST(AClientSceneLogic_All, resolvesClientResourcesWhenFlushingUnpublished
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, failsFlushWithoutSubscriberIfResourceIsUnknown)
+{
+    Mock::VerifyAndClearExpectations(&this->m_resourceComponent); // strict behavior for this test
+    this->publish();
+
+    this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), {}, {}, this->m_textureResource->getHash(), {} }, {});
+    EXPECT_CALL(this->m_resourceComponent, knowsResource(this->m_textureResource->getHash())).WillOnce(Return(false));
+    EXPECT_FALSE(this->m_sceneLogic.flushSceneActions({}, {}));
+
+    this->expectSceneUnpublish();
+}
+
 TYPED_TEST(AClientSceneLogic_All, doesNotTryToResolveResourcesWhenNoSceneChanges)
 {
     Mock::VerifyAndClearExpectations(&this->m_resourceComponent); // strict behavior for this test
@@ -1817,7 +1997,7 @@ TYPED_TEST(AClientSceneLogic_All, resolvesOldResourcesForNewSubscriber)
     this->publish();
     this->m_scene.allocateNode(0, {});
     this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), {}, {}, this->m_textureResource->getHash(), {} }, {});
-    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, true);
+    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, false, false);
     this->flush();
     this->m_scene.allocateNode(0, {});
     this->expectResourceQueries({}, { this->m_textureResource }, false, false, false);
@@ -1834,6 +2014,24 @@ TYPED_TEST(AClientSceneLogic_All, resolvesOldResourcesForNewSubscriber)
     this->expectSceneUnpublish();
 }
 
+TEST_F(AClientSceneLogic_ShadowCopy, keepsLoadedResourcesAliveWithoutSubscriberForLaterSubscriber)
+{
+    this->publish();
+    this->m_scene.allocateNode(0, {});
+    this->m_scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), {}, {}, this->m_textureResource->getHash(), {} }, {});
+    this->m_resourcesInMemory = { this->m_textureResource };
+    this->expectResourceQueries({ this->m_textureResource }, {}, false, false, false, false);
+    const auto useCountBeforeFlush = this->m_textureResource.use_count();
+    this->flush();
+    EXPECT_EQ(useCountBeforeFlush + 1, this->m_textureResource.use_count());
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _));
+    this->expectSceneSend();
+    this->expectResourceQueries({}, { this->m_textureResource }, false, false, true);
+    this->m_sceneLogic.addSubscriber(this->m_rendererID);
+    this->expectSceneUnpublish();
+}
+
 TYPED_TEST(AClientSceneLogic_All, succeedsASecondFlushContainingAllSceneActionsAfterAddingResourcesMissingFromFailedFirstFlush)
 {
     this->publish();
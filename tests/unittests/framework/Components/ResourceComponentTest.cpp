@@ -124,7 +124,7 @@ namespace ramses::internal
 
         std::vector<std::vector<std::byte>> serializeResources(const ManagedResourceVector& resVec, uint32_t chunkSize = 100000)
         {
-            SceneUpdate update{SceneActionCollection(), resVec, {}};
+            SceneUpdate update{SceneActionCollection(), resVec, {}, {}};
             return TestSerializeSceneUpdateToVectorChunked(SceneUpdateSerializer(update, sceneStatistics, EFeatureLevel_Latest), chunkSize);
         }
 
@@ -18,6 +18,7 @@
 #include "internal/Core/Utils/BinaryFileOutputStream.h"
 #include "internal/Core/Utils/BinaryFileInputStream.h"
 #include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
 #include "ResourceMock.h"
 #include "InputStreamMock.h"
 #include "UnsafeTestMemoryHelpers.h"
@@ -328,6 +329,48 @@ namespace ramses::internal
         }
     }
 
+    TEST(ResourcePersistation, compressesResourcesInParallelOnTaskQueueAndReadsThemBack)
+    {
+        NiceMock<ManagedResourceDeleterCallbackMock> managedResourceDeleter;
+        ResourceDeleterCallingCallback dummyManagedResourceCallback(managedResourceDeleter);
+
+        constexpr uint32_t NumResources = 10u;
+        constexpr uint32_t NumElements = 3000u;
+        std::vector<std::vector<float>> data(NumResources);
+        std::vector<std::unique_ptr<ArrayResource>> resourceStorage;
+        ManagedResourceVector resources;
+        for (uint32_t r = 0u; r < NumResources; ++r)
+        {
+            data[r].resize(NumElements * 3u);
+            for (size_t i = 0u; i < data[r].size(); ++i)
+                data[r][i] = static_cast<float>((i + r) % 17u);
+            resourceStorage.push_back(std::make_unique<ArrayResource>(EResourceType::VertexArray, NumElements, EDataType::Vector3F, data[r].data(), "res"));
+            resources.push_back(ManagedResource{ resourceStorage.back().get(), dummyManagedResourceCallback });
+        }
+
+        ThreadedTaskExecutor taskExecutor(2);
+        File tempFile("parallelCompressedResourceFile");
+        BinaryFileOutputStream out(tempFile);
+        ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, true, &taskExecutor);
+        tempFile.close();
+
+        for (const auto& res : resources)
+            EXPECT_TRUE(res->isCompressedAvailable());
+
+        ResourceTableOfContents loadedTOC;
+        BinaryFileInputStream instream(tempFile);
+        loadedTOC.readTOCPosAndTOCFromStream(instream);
+        for (uint32_t r = 0u; r < NumResources; ++r)
+        {
+            const ResourceContentHash hash = resources[r]->getHash();
+            ASSERT_TRUE(loadedTOC.containsResource(hash));
+            auto loadedResource = ResourcePersistation::RetrieveResourceFromStream(instream, loadedTOC.getEntryForHash(hash), EFeatureLevel_Latest);
+            ASSERT_TRUE(loadedResource);
+            loadedResource->decompress();
+            EXPECT_TRUE(UnsafeTestMemoryHelpers::CompareMemoryBlobToSpan(data[r].data(), data[r].size() * sizeof(float), loadedResource->getResourceData().span()));
+        }
+    }
+
     static std::pair<std::vector<std::byte>, ResourceFileEntry> getDummyResourceData()
     {
         BinaryOutputStream outStream;
@@ -15,10 +15,13 @@
 #include "SceneRendererHandlerMock.h"
 #include "internal/Communication/TransportCommon/SceneUpdateSerializer.h"
 #include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
 #include "SceneUpdateSerializerTestHelper.h"
 #include "internal/SceneGraph/Resource/ArrayResource.h"
 #include "internal/SceneGraph/Resource/TextureResource.h"
 #include "internal/Components/ClientSceneLogicBase.h"
+#include "internal/Components/AsyncSceneUpdateSender.h"
+#include "ManuallyExecutedTaskQueue.h"
 
 #include <string_view>
 
@@ -50,13 +53,13 @@ public:
 
     std::vector<std::vector<std::byte>> actionsToChunks(const SceneActionCollection& actions, uint32_t chunkSize = 100000, const ManagedResourceVector& resources = {}, const FlushInformation& flushinfo = {})
     {
-        SceneUpdate update{actions.copy(), resources, flushinfo.copy()};
+        SceneUpdate update{actions.copy(), resources, flushinfo.copy(), {}};
         return TestSerializeSceneUpdateToVectorChunked(SceneUpdateSerializer(update, sceneStatistics, EFeatureLevel_Latest), chunkSize);
     }
 
     void expectSendSceneActionsToNetwork(Guid remote, SceneId sceneId, const SceneActionCollection& expectedActions)
     {
-        EXPECT_CALL(communicationSystem, sendSceneUpdate(remote, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remote }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
             // grab actions directly out of serializer
             const auto actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions.copy();
             EXPECT_EQ(expectedActions, actions);
@@ -354,7 +357,7 @@ TEST_F(ASceneGraphComponent, sendsResourcesCompressedToRemoteProvider)
         std::make_shared<const ArrayResource>(EResourceType::VertexArray, 1024u, EDataType::Float, blob.data(), "fl")
     };
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         // grab resources directly out of serializer
         const auto resources = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().resources;
         EXPECT_EQ(resourcesToSend, resources);
@@ -434,6 +437,21 @@ TEST_F(ASceneGraphComponent, canSendSceneActionsToLocalAndRemote)
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
 }
 
+TEST_F(ASceneGraphComponent, sendsSceneUpdateToAllRemotesAtOnce)
+{
+    const SceneId sceneId(456);
+    const Guid otherRemoteParticipantID(4567);
+    SceneActionCollection list(CreateFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID, otherRemoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        const auto actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions.copy();
+        EXPECT_EQ(list, actions);
+        return true;
+    });
+    SceneUpdate update;
+    update.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, otherRemoteParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+}
+
 TEST_F(ASceneGraphComponent, canRepublishALocalOnlySceneToBeDistributedRemotely)
 {
     sceneGraphComponent.setSceneRendererHandler(&consumer);
@@ -537,7 +555,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.handleSubscribeScene(SceneId(1), localParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _));
 
     EXPECT_CALL(consumer, handleInitializeScene(sceneInfo, _));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _,  _));
@@ -560,12 +578,12 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     sceneGraphComponent.newParticipantHasConnected(remoteParticipantID);
 
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _));
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     sceneGraphComponent.handleSubscribeScene(SceneId(1), remoteParticipantID);
 
     // flush again
     flushTimesWithExpirationToPreventFlushOptimizazion.expirationTimestamp += std::chrono::milliseconds{ 1 };
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, SceneId(1), _)).WillOnce(Return(1));
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, SceneId(1), _)).WillOnce(Return(1));
     EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(1), _, _));
     EXPECT_TRUE(sceneGraphComponent.handleFlush(SceneId(1), flushTimesWithExpirationToPreventFlushOptimizazion, {}));
 
@@ -953,6 +971,55 @@ TEST_F(ASceneGraphComponent, forwardsSceneActionListFromRemote)
     sceneGraphComponent.handleSceneUpdate(SceneId(2), actionBlobs_2[0], Guid(22));
 }
 
+TEST_F(ASceneGraphComponent, decodesDeltaEncodedSceneActionsFromRemote)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+
+    SceneInfo info_22{ SceneId(2), "", EScenePublicationMode::LocalAndRemote };
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({info_22}, Guid(22), ramses::EFeatureLevel_Latest);
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    SceneActionDeltaEncoder encoder;
+    for (float value : { 1.f, 2.f })
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator(actions, EFeatureLevel_Latest).setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value);
+        SceneActionCollection encodedActions;
+        ASSERT_TRUE(encoder.encode(actions, encodedActions));
+
+        EXPECT_CALL(consumer, handleSceneUpdate_rvr(SceneId(2), _, Guid(22))).WillOnce([&](const auto& /*unused*/, const auto& update, const auto& /*unused*/) {
+            EXPECT_EQ(actions, update.actions);
+        });
+        sceneGraphComponent.handleSceneUpdate(SceneId(2), actionsToChunks(encodedActions)[0], Guid(22));
+    }
+}
+
+TEST_F(ASceneGraphComponent, dropsDeltaEncodedSceneActionsFromRemoteWithoutReferenceValues)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    sceneGraphComponent.newParticipantHasConnected(Guid(22));
+
+    SceneInfo info_22{ SceneId(2), "", EScenePublicationMode::LocalAndRemote };
+    EXPECT_CALL(consumer, handleNewSceneAvailable(info_22, Guid(22)));
+    sceneGraphComponent.handleNewScenesAvailable({info_22}, Guid(22), ramses::EFeatureLevel_Latest);
+    EXPECT_CALL(consumer, handleInitializeScene(info_22, Guid(22)));
+    sceneGraphComponent.handleInitializeScene(SceneId(2), Guid(22));
+
+    const float value = 1.f;
+    SceneActionCollection actions;
+    SceneActionCollectionCreator(actions, EFeatureLevel_Latest).setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value);
+    SceneActionDeltaEncoder encoder;
+    SceneActionCollection encodedActions;
+    ASSERT_TRUE(encoder.encode(actions, encodedActions));
+    ASSERT_TRUE(encoder.encode(actions, encodedActions));
+
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(_, _, _)).Times(0);
+    sceneGraphComponent.handleSceneUpdate(SceneId(2), actionsToChunks(encodedActions)[0], Guid(22));
+}
+
 TEST_F(ASceneGraphComponent, ignoreSceneActionsFromRemoteForUnpublishedScene)
 {
     sceneGraphComponent.setSceneRendererHandler(&consumer);
@@ -1273,7 +1340,7 @@ TEST_F(ASceneGraphComponent, sendSceneUpdatePassesSceneStatisticsToSerializer)
     EXPECT_CALL(communicationSystem, sendInitializeScene(_, _)).Times(1);
     sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ localSceneId, "", EScenePublicationMode::LocalAndRemote });
 
-    EXPECT_CALL(communicationSystem, sendSceneUpdate(remoteParticipantID, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, sceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
         const auto& stats = static_cast<const SceneUpdateSerializer&>(serializer).getStatisticCollection();
         EXPECT_EQ(&sceneStatistics, &stats);
         return true;
@@ -1282,4 +1349,88 @@ TEST_F(ASceneGraphComponent, sendSceneUpdatePassesSceneStatisticsToSerializer)
     SceneUpdate update;
     sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), sceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
 }
+
+TEST_F(ASceneGraphComponent, sendsCreateSceneAndSceneUpdatesOfAsyncFlushedSceneOnTaskQueueInOrder)
+{
+    ClientScene scene(SceneInfo{ localSceneId, "foo" });
+    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+    ManuallyExecutedTaskQueue taskQueue;
+    AsyncSceneUpdateSender asyncSender(taskQueue, 2u);
+    sceneGraphComponent.handleEnableAsyncFlush(localSceneId, asyncSender);
+
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ localSceneId, "", EScenePublicationMode::LocalAndRemote });
+    SceneActionCollection list(CreateFakeSceneActionCollectionFromTypes({ ESceneActionId::TestAction }));
+    SceneUpdate update;
+    update.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(update), localSceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+    // nothing sent until worker executes tasks
+    EXPECT_EQ(2u, asyncSender.getPendingSendCount());
+
+    {
+        InSequence seq;
+        EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, localSceneId));
+        expectSendSceneActionsToNetwork(remoteParticipantID, localSceneId, list);
+    }
+    taskQueue.executeAll();
+    EXPECT_EQ(0u, asyncSender.getPendingSendCount());
+
+    // sent directly again after scene removed
+    sceneGraphComponent.handleRemoveScene(localSceneId);
+    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, localSceneId));
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ localSceneId, "", EScenePublicationMode::LocalAndRemote });
+}
+
+TEST_F(ASceneGraphComponent, setsHighPriorityOfSceneInCommunicationSystemUntilSceneRemoved)
+{
+    ClientScene scene(SceneInfo{ localSceneId, "foo" });
+    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+
+    EXPECT_CALL(communicationSystem, setHighPriorityScene(localSceneId, true));
+    sceneGraphComponent.handleEnableHighPriorityUpdates(localSceneId);
+
+    EXPECT_CALL(communicationSystem, setHighPriorityScene(localSceneId, false));
+    sceneGraphComponent.handleRemoveScene(localSceneId);
+}
+
+TEST_F(ASceneGraphComponent, doesNotTouchPriorityInCommunicationSystemWhenRemovingSceneWithNormalPriority)
+{
+    ClientScene scene(SceneInfo{ localSceneId, "foo" });
+    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+
+    EXPECT_CALL(communicationSystem, setHighPriorityScene(_, _)).Times(0);
+    sceneGraphComponent.handleRemoveScene(localSceneId);
+}
+
+TEST_F(ASceneGraphComponent, sendsSceneDumpPlainAndFollowingSettersDeltaEncodedToRemoteOnly)
+{
+    sceneGraphComponent.setSceneRendererHandler(&consumer);
+    ClientScene scene(SceneInfo{ localSceneId, "foo" });
+    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleEnableSceneActionDeltaEncoding(localSceneId, 0u);
+
+    EXPECT_CALL(communicationSystem, sendInitializeScene(remoteParticipantID, localSceneId));
+    sceneGraphComponent.sendCreateScene(remoteParticipantID, SceneInfo{ localSceneId, "", EScenePublicationMode::LocalAndRemote });
+
+    SceneActionCollection list;
+    SceneActionCollectionCreator(list, EFeatureLevel_Latest).setTranslation(TransformHandle{ 1u }, { 1.f, 2.f, 3.f });
+
+    expectSendSceneActionsToNetwork(remoteParticipantID, localSceneId, list);
+    SceneUpdate dump;
+    dump.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID }, std::move(dump), localSceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+
+    InSequence seq;
+    EXPECT_CALL(communicationSystem, sendSceneUpdate(std::vector<Guid>{ remoteParticipantID }, localSceneId, _)).WillOnce([&](auto /*unused*/, auto /*unused*/, auto& serializer) {
+        const auto& actions = static_cast<const SceneUpdateSerializer&>(serializer).getUpdate().actions;
+        EXPECT_EQ(1u, actions.numberOfActions());
+        EXPECT_EQ(ESceneActionId::SetValueDeltaEncoded, actions[0].type());
+        return true;
+    });
+    EXPECT_CALL(consumer, handleSceneUpdate_rvr(localSceneId, _, localParticipantID)).WillOnce([&](auto /*unused*/, const auto& update, auto /*unused*/) {
+        EXPECT_EQ(list, update.actions);
+    });
+    SceneUpdate update;
+    update.actions = list.copy();
+    sceneGraphComponent.sendSceneUpdate({ remoteParticipantID, localParticipantID }, std::move(update), localSceneId, EScenePublicationMode::LocalAndRemote, sceneStatistics);
+}
 }
@@ -127,4 +127,21 @@ namespace ramses::internal
         const auto result2 = quad2.getBoundingQuad(quad1);
         EXPECT_EQ(result, result2);
     }
+
+    TEST(QuadTest, CanGetIntersection_OverlappingQuads)
+    {
+        const Quad quad1{ 1, 1, 3, 3 };
+        const Quad quad2{ 2, 2, 5, 5 };
+        const auto result = quad1.getIntersection(quad2);
+        EXPECT_EQ(Quad(2, 2, 2, 2), result);
+        EXPECT_EQ(result, quad2.getIntersection(quad1));
+    }
+
+    TEST(QuadTest, GetsEmptyIntersection_NonOverlappingQuads)
+    {
+        const Quad quad1{ 1, 1, 3, 3 };
+        const Quad quad2{ 5, 0, 5, 5 };
+        EXPECT_EQ(Quad{}, quad1.getIntersection(quad2));
+        EXPECT_EQ(Quad{}, quad2.getIntersection(quad1));
+    }
 }
@@ -0,0 +1,42 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "TestEqualHelper.h"
+#include "internal/Core/Math3d/Transform.h"
+#include "internal/Core/Math3d/Rotation.h"
+#include "glm/gtx/transform.hpp"
+
+namespace ramses::internal
+{
+    class ATransform : public ::testing::Test
+    {
+    protected:
+        const glm::vec3 translation{ 1.5f, -2.f, 30.f };
+        const glm::mat4 rotation = Math3d::Rotation(glm::vec4(10.f, -45.f, 170.f, 1.f), ERotationType::Euler_XYZ);
+        const glm::vec3 scaling{ 2.f, 0.5f, -3.f };
+    };
+
+    TEST_F(ATransform, composesSameMatrixAsMultiplyingTranslationRotationAndScaling)
+    {
+        const glm::mat4 expected = glm::translate(translation) * rotation * glm::scale(scaling);
+        expectMatrixFloatEqual(expected, Math3d::Transform(translation, rotation, scaling));
+    }
+
+    TEST_F(ATransform, composesSameInverseMatrixAsMultiplyingInverseScalingRotationAndTranslation)
+    {
+        const glm::mat4 expected = glm::scale(glm::vec3(1.f) / scaling) * glm::transpose(rotation) * glm::translate(-translation);
+        expectMatrixFloatEqual(expected, Math3d::InverseTransform(translation, rotation, scaling));
+    }
+
+    TEST_F(ATransform, isIdentityForDefaultValues)
+    {
+        expectMatrixFloatEqual(glm::identity<glm::mat4>(), Math3d::Transform(glm::vec3(0.f), glm::identity<glm::mat4>(), glm::vec3(1.f)));
+        expectMatrixFloatEqual(glm::identity<glm::mat4>(), Math3d::InverseTransform(glm::vec3(0.f), glm::identity<glm::mat4>(), glm::vec3(1.f)));
+    }
+}
@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internal/Core/TaskFramework/ITask.h"
+#include "internal/Core/TaskFramework/ITaskQueue.h"
+
+#include <deque>
+#include <mutex>
+
+namespace ramses::internal
+{
+    // executes enqueued tasks only when test asks for it, can be called from other thread
+    class ManuallyExecutedTaskQueue : public ITaskQueue
+    {
+    public:
+        bool enqueue(ITask& task) override
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            task.addRef();
+            m_tasks.push_back(&task);
+            return true;
+        }
+
+        void disableAcceptingTasksAfterExecutingCurrentQueue() override
+        {
+        }
+
+        bool executeNext()
+        {
+            ITask* task = nullptr;
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                if (m_tasks.empty())
+                    return false;
+                task = m_tasks.front();
+                m_tasks.pop_front();
+            }
+            task->execute();
+            task->release();
+            return true;
+        }
+
+        void executeAll()
+        {
+            while (executeNext())
+                ;
+        }
+
+    private:
+        std::mutex m_lock;
+        std::deque<ITask*> m_tasks;
+    };
+}
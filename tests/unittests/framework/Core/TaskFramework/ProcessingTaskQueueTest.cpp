@@ -10,6 +10,9 @@
 #include "gmock/gmock.h"
 #include "internal/PlatformAbstraction/PlatformTime.h"
 
+#include <thread>
+#include <vector>
+
 using namespace testing;
 
 namespace ramses::internal
@@ -17,7 +20,20 @@ namespace ramses::internal
     class MockTask : public ITask
     {
     public:
+        explicit MockTask(ETaskPriority priority = ETaskPriority::Normal)
+            : m_priority(priority)
+        {
+        }
+
         void execute() override {};
+
+        [[nodiscard]] ETaskPriority getPriority() const override
+        {
+            return m_priority;
+        }
+
+    private:
+        ETaskPriority m_priority;
     };
 
     TEST(ProcessingTaskQueueTest, addAndPopTask)
@@ -74,4 +90,78 @@ namespace ramses::internal
         EXPECT_EQ(q.popTask(timeout), nullptr);
         EXPECT_GE(std::chrono::steady_clock::now() - start, timeout - tolerance);
     }
+
+    TEST(ProcessingTaskQueueTest, popsTasksOfHigherPriorityFirst)
+    {
+        ProcessingTaskQueue q;
+        MockTask low1(ETaskPriority::Low);
+        MockTask normal1(ETaskPriority::Normal);
+        MockTask high1(ETaskPriority::High);
+        MockTask normal2(ETaskPriority::Normal);
+        MockTask high2(ETaskPriority::High);
+        for (auto* task : { &low1, &normal1, &high1, &normal2, &high2 })
+            q.addTask(task);
+
+        EXPECT_EQ(&high1, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&high2, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&normal1, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&normal2, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_EQ(&low1, q.popTask(std::chrono::milliseconds{20}));
+        EXPECT_TRUE(q.isEmpty());
+    }
+
+    TEST(ProcessingTaskQueueTest, anyWorkerCanPopTasksDistributedToOtherWorkers)
+    {
+        ProcessingTaskQueue q(3u);
+        EXPECT_EQ(3u, q.getWorkerCount());
+        MockTask t1;
+        MockTask t2;
+        MockTask t3;
+        q.addTask(&t1);
+        q.addTask(&t2);
+        q.addTask(&t3);
+
+        std::vector<ITask*> popped;
+        for (int i = 0; i < 3; ++i)
+            popped.push_back(q.popTask(2u, std::chrono::milliseconds{20}));
+        EXPECT_TRUE(q.isEmpty());
+        EXPECT_THAT(popped, UnorderedElementsAre(&t1, &t2, &t3));
+        EXPECT_EQ(nullptr, q.popTask(0u, std::chrono::milliseconds{1}));
+    }
+
+    TEST(ProcessingTaskQueueTest, tasksAddedFromWorkerThreadArePoppedByItFirstAndCanBeStolenByOthers)
+    {
+        ProcessingTaskQueue q(2u);
+        MockTask t1;
+        MockTask t2;
+        MockTask t3;
+
+        std::thread worker([&]()
+            {
+                q.registerWorkerThread(1u);
+                q.addTask(&t1);
+                q.addTask(&t2);
+                q.addTask(&t3);
+                EXPECT_EQ(&t1, q.popTask(std::chrono::milliseconds{20}));
+                q.unregisterWorkerThread();
+            });
+        worker.join();
+
+        // other worker steals most recently added task
+        EXPECT_EQ(&t3, q.popTask(0u, std::chrono::milliseconds{20}));
+        EXPECT_EQ(&t2, q.popTask(1u, std::chrono::milliseconds{20}));
+        EXPECT_TRUE(q.isEmpty());
+    }
+
+    TEST(ProcessingTaskQueueTest, wakesUpWaitingWorkerWhenTaskIsAdded)
+    {
+        ProcessingTaskQueue q(2u);
+        MockTask t;
+        ITask* popped = nullptr;
+        std::thread worker([&]() { popped = q.popTask(1u, std::chrono::milliseconds{0}); });
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        q.addTask(&t);
+        worker.join();
+        EXPECT_EQ(&t, popped);
+    }
 }
@@ -50,4 +50,19 @@ namespace ramses::internal
         EXPECT_EQ(1U, Task.getReferenceCount());
         EXPECT_CALL(Task, destructor());
     }
+
+    TEST_F(TaskFinishHandlerDecoratorTest, ForwardsPriorityOfWatchedTask)
+    {
+        class LowPriorityTask : public ITask
+        {
+        public:
+            void execute() override {}
+            [[nodiscard]] ETaskPriority getPriority() const override { return ETaskPriority::Low; }
+        };
+
+        MockTaskFinishHandler finishHandler;
+        LowPriorityTask task;
+        const TaskFinishHandlerDecorator decorator(finishHandler, task);
+        EXPECT_EQ(ETaskPriority::Low, decorator.getPriority());
+    }
 }
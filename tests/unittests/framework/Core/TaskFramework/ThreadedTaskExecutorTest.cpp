@@ -16,6 +16,8 @@
 
 #include <thread>
 #include <chrono>
+#include <mutex>
+#include <vector>
 
 using namespace testing;
 
@@ -205,6 +207,86 @@ namespace ramses::internal
         taskBlockingLock.unlock();
     }
 
+    class PriorityRecordingTask : public ITask
+    {
+    public:
+        PriorityRecordingTask(ETaskPriority priority, std::vector<ETaskPriority>& executionOrder, std::mutex& executionOrderLock)
+            : m_priority(priority)
+            , m_executionOrder(executionOrder)
+            , m_executionOrderLock(executionOrderLock)
+        {
+        }
+
+        void execute() override
+        {
+            std::lock_guard<std::mutex> g(m_executionOrderLock);
+            m_executionOrder.push_back(m_priority);
+        }
+
+        [[nodiscard]] ETaskPriority getPriority() const override
+        {
+            return m_priority;
+        }
+
+    private:
+        ETaskPriority m_priority;
+        std::vector<ETaskPriority>& m_executionOrder;
+        std::mutex& m_executionOrderLock;
+    };
+
+    TEST(AThreadedTaskExecutor, executesQueuedTasksOfHigherPriorityFirst)
+    {
+        ThreadedTaskExecutor ex(1);
+
+        PlatformLock taskBlockingLock;
+        taskBlockingLock.lock();
+        PlatformEvent taskIsBeingWorkedEvent;
+        BlockingTask blockingTask(taskBlockingLock, taskIsBeingWorkedEvent);
+        ex.enqueue(blockingTask);
+        taskIsBeingWorkedEvent.wait();
+
+        std::vector<ETaskPriority> executionOrder;
+        std::mutex executionOrderLock;
+        PriorityRecordingTask lowTask(ETaskPriority::Low, executionOrder, executionOrderLock);
+        PriorityRecordingTask normalTask(ETaskPriority::Normal, executionOrder, executionOrderLock);
+        PriorityRecordingTask highTask(ETaskPriority::High, executionOrder, executionOrderLock);
+        ex.enqueue(lowTask);
+        ex.enqueue(normalTask);
+        ex.enqueue(highTask);
+
+        taskBlockingLock.unlock();
+        ex.disableAcceptingTasksAfterExecutingCurrentQueue();
+        ex.stop();
+
+        const std::vector<ETaskPriority> expectedOrder{ ETaskPriority::High, ETaskPriority::Normal, ETaskPriority::Low };
+        EXPECT_EQ(expectedOrder, executionOrder);
+    }
+
+    TEST(AThreadedTaskExecutor, otherThreadsStealTasksEnqueuedByBlockedTask)
+    {
+        ThreadedTaskExecutor ex(3);
+
+        std::atomic<uint32_t> executedCount{ 0u };
+        NiceMock<TaskMock> fastTask;
+        ON_CALL(fastTask, execute()).WillByDefault([&]() { executedCount++; });
+
+        PlatformEvent allExecuted;
+        TaskMock blockingTask;
+        EXPECT_CALL(blockingTask, execute()).WillOnce([&]()
+            {
+                // tasks go to deque of this worker which is busy until they are executed by the others
+                for (int i = 0; i < 20; ++i)
+                    ex.enqueue(fastTask);
+                while (executedCount < 20u)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                allExecuted.signal();
+            });
+        ex.enqueue(blockingTask);
+
+        EXPECT_TRUE(allExecuted.wait(5000));
+        ex.disableAcceptingTasksAfterExecutingCurrentQueue();
+    }
+
     TEST(AnEnqueueOnlyOneAtATimeQueue, waitForAllTasksExecutionWhenAskedToShutDown)
     {
         ThreadedTaskExecutor ex(1);
@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/AsyncLogQueue.h"
+#include "internal/Core/Utils/LogContext.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <string>
+#include <vector>
+
+namespace ramses::internal
+{
+    class AnAsyncLogQueue : public ::testing::Test
+    {
+    protected:
+        LogMessage createMessage(std::string text) const
+        {
+            return LogMessage{ context, ELogLevel::Info, std::move(text) };
+        }
+
+        std::vector<std::string> drain(AsyncLogQueue& queue)
+        {
+            std::vector<std::string> messages;
+            queue.drain([&](const LogMessage& msg) {
+                EXPECT_EQ(&context, &msg.m_context);
+                messages.push_back(msg.m_message);
+            });
+            return messages;
+        }
+
+        LogContext context{ "test context", "TEST" };
+    };
+
+    TEST_F(AnAsyncLogQueue, drainsNothingInitially)
+    {
+        AsyncLogQueue queue(4u, ELogOverflowPolicy::Drop);
+        EXPECT_TRUE(drain(queue).empty());
+        EXPECT_EQ(0u, queue.takeDroppedCount());
+    }
+
+    TEST_F(AnAsyncLogQueue, drainsMessagesInLoggingOrder)
+    {
+        AsyncLogQueue queue(4u, ELogOverflowPolicy::Drop);
+        EXPECT_TRUE(queue.push(createMessage("a")));
+        EXPECT_TRUE(queue.push(createMessage("b")));
+        EXPECT_EQ((std::vector<std::string>{ "a", "b" }), drain(queue));
+
+        EXPECT_TRUE(queue.push(createMessage("c")));
+        EXPECT_EQ((std::vector<std::string>{ "c" }), drain(queue));
+        EXPECT_TRUE(drain(queue).empty());
+    }
+
+    TEST_F(AnAsyncLogQueue, dropsAndCountsMessagesWhenFull)
+    {
+        AsyncLogQueue queue(2u, ELogOverflowPolicy::Drop);
+        EXPECT_TRUE(queue.push(createMessage("a")));
+        EXPECT_TRUE(queue.push(createMessage("b")));
+        EXPECT_FALSE(queue.push(createMessage("c")));
+        EXPECT_FALSE(queue.push(createMessage("d")));
+
+        EXPECT_EQ(2u, queue.takeDroppedCount());
+        EXPECT_EQ(0u, queue.takeDroppedCount());
+        EXPECT_EQ(2u, queue.getTotalDroppedCount());
+        EXPECT_EQ((std::vector<std::string>{ "a", "b" }), drain(queue));
+
+        // space available again after draining
+        EXPECT_TRUE(queue.push(createMessage("e")));
+        EXPECT_EQ((std::vector<std::string>{ "e" }), drain(queue));
+    }
+
+    TEST_F(AnAsyncLogQueue, mergesMessagesOfMultipleThreadsInLoggingOrder)
+    {
+        AsyncLogQueue queue(8u, ELogOverflowPolicy::Drop);
+        queue.push(createMessage("1"));
+        std::thread([&]() { queue.push(createMessage("2")); }).join();
+        queue.push(createMessage("3"));
+        std::thread([&]() { queue.push(createMessage("4")); }).join();
+
+        EXPECT_EQ((std::vector<std::string>{ "1", "2", "3", "4" }), drain(queue));
+    }
+
+    TEST_F(AnAsyncLogQueue, blockingPolicyDeliversAllMessagesOfConcurrentThreads)
+    {
+        AsyncLogQueue queue(4u, ELogOverflowPolicy::Block);
+        constexpr size_t NumThreads = 4u;
+        constexpr size_t NumMessagesPerThread = 1000u;
+
+        std::vector<std::thread> producers;
+        for (size_t t = 0u; t < NumThreads; ++t)
+        {
+            producers.emplace_back([&, t]() {
+                for (size_t i = 0u; i < NumMessagesPerThread; ++i)
+                    queue.push(createMessage(std::to_string(t)));
+            });
+        }
+
+        std::vector<size_t> received(NumThreads, 0u);
+        size_t total = 0u;
+        while (total < NumThreads * NumMessagesPerThread)
+        {
+            for (const auto& msg : drain(queue))
+            {
+                ++received[std::stoul(msg)];
+                ++total;
+            }
+        }
+        for (auto& producer : producers)
+            producer.join();
+
+        EXPECT_EQ(std::vector<size_t>(NumThreads, NumMessagesPerThread), received);
+        EXPECT_EQ(0u, queue.getTotalDroppedCount());
+    }
+}
@@ -0,0 +1,121 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/BinaryMappedFileInputStream.h"
+#include "internal/PlatformAbstraction/Collections/IInputStream.h"
+#include "FileDescriptorHelper.h"
+#include "internal/Core/Utils/File.h"
+#include "gtest/gtest.h"
+#include <fcntl.h>
+#include <vector>
+
+// memory mapping is not supported on windows
+#ifndef _WIN32
+namespace ramses::internal
+{
+    class ABinaryMappedFileInputStream : public ::testing::Test
+    {
+    public:
+        void TearDown() override
+        {
+            File(testFileName).remove();
+        }
+
+        void writeFile(std::initializer_list<uint8_t> data)
+        {
+            File f(testFileName);
+            ASSERT_TRUE(f.open(File::Mode::WriteNewBinary));
+            ASSERT_TRUE(f.write(data.begin(), data.size()));
+        }
+
+        static std::vector<std::byte> readData(BinaryMappedFileInputStream& is, size_t size)
+        {
+            std::vector<std::byte> data(size);
+            is.read(data.data(), size);
+            return data;
+        }
+
+        template <typename... Ts>
+        static std::vector<std::byte> MakeByteVector(Ts&&... args) noexcept
+        {
+            return {std::byte(std::forward<Ts>(args))...};
+        }
+
+        const char* testFileName = "testfile.bin";
+    };
+
+    TEST_F(ABinaryMappedFileInputStream, readsWholeFileByName)
+    {
+        writeFile({3, 2, 1});
+        BinaryMappedFileInputStream is(testFileName);
+        EXPECT_TRUE(is.isMapped());
+        EXPECT_EQ(MakeByteVector(3, 2), readData(is, 2));
+        EXPECT_EQ(MakeByteVector(1), readData(is, 1));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, failsForNonExistingFile)
+    {
+        BinaryMappedFileInputStream is("doesNotExist.bin");
+        EXPECT_FALSE(is.isMapped());
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, readsWithOffsetAndClosesFileDescriptor)
+    {
+        writeFile({0, 0, 3, 2, 1, 0, 0});
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary(testFileName);
+        ASSERT_NE(-1, fd);
+        BinaryMappedFileInputStream is(fd, 2, 3);
+        EXPECT_TRUE(is.isMapped());
+        EXPECT_EQ(-1, ::close(fd));
+        EXPECT_EQ(MakeByteVector(3, 2, 1), readData(is, 3));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, keepsFileDescriptorOpenIfMappingFails)
+    {
+        writeFile({3, 2, 1});
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary(testFileName, O_WRONLY);
+        ASSERT_NE(-1, fd);
+        BinaryMappedFileInputStream is(fd, 0, 3);
+        EXPECT_FALSE(is.isMapped());
+        EXPECT_EQ(EStatus::Error, is.getState());
+        EXPECT_EQ(0, ::close(fd));
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, readOutsideRangeFails)
+    {
+        writeFile({0, 0, 3, 2, 1, 0, 0});
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary(testFileName);
+        BinaryMappedFileInputStream is(fd, 2, 3);
+        readData(is, 4);
+        EXPECT_EQ(EStatus::Eof, is.getState());
+    }
+
+    TEST_F(ABinaryMappedFileInputStream, canSeekWithinRangeOnly)
+    {
+        writeFile({0, 1, 2, 3, 0});
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary(testFileName);
+        BinaryMappedFileInputStream is(fd, 1, 3);
+
+        EXPECT_EQ(EStatus::Ok, is.seek(2, IInputStream::Seek::FromBeginning));
+        EXPECT_EQ(MakeByteVector(3), readData(is, 1));
+        EXPECT_EQ(EStatus::Ok, is.seek(-2, IInputStream::Seek::Relative));
+        EXPECT_EQ(MakeByteVector(2), readData(is, 1));
+
+        EXPECT_EQ(EStatus::Error, is.seek(-3, IInputStream::Seek::Relative));
+        EXPECT_EQ(EStatus::Error, is.seek(4, IInputStream::Seek::FromBeginning));
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(2u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+}
+#endif
@@ -402,6 +402,21 @@ namespace ramses::internal
         tempFile.remove();
     }
 
+    TEST_F(AFile, TestIsRegularFile)
+    {
+        addForCleanup({"temp.txt"});
+
+        File tempFile("temp.txt");
+        EXPECT_FALSE(tempFile.isRegularFile());
+        tempFile.createFile();
+        EXPECT_TRUE(tempFile.isRegularFile());
+
+        File directory(".");
+        EXPECT_FALSE(directory.isRegularFile());
+
+        tempFile.remove();
+    }
+
     TEST_F(AFile, CreateAndRemoveDirectory)
     {
         addForCleanup({"temp"});
@@ -0,0 +1,147 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "internal/Core/Utils/MemoryPoolDense.h"
+#include "internal/Core/Utils/MemoryPool.h"
+#include <algorithm>
+
+using namespace testing;
+
+namespace ramses::internal
+{
+    namespace
+    {
+        struct DummyMemoryHandleTag {};
+        using DummyMemoryHandle = TypedMemoryHandle<DummyMemoryHandleTag>;
+    }
+
+    template <typename T>
+    class AMemoryPoolDense : public testing::Test
+    {
+    protected:
+        using HandleT = typename T::handle_type;
+
+        std::vector<HandleT> iteratedHandles() const
+        {
+            std::vector<HandleT> handles;
+            for (const auto& it : memoryPool)
+                handles.push_back(it.first);
+            std::sort(handles.begin(), handles.end());
+            return handles;
+        }
+
+        T memoryPool;
+    };
+
+    using MemoryPoolTypes = ::testing::Types <
+        MemoryPoolDense<int, uint32_t>,
+        MemoryPoolDense<int, uint16_t>,
+        MemoryPoolDense<int, DummyMemoryHandle>
+    >;
+
+    TYPED_TEST_SUITE(AMemoryPoolDense, MemoryPoolTypes);
+
+    TYPED_TEST(AMemoryPoolDense, IsEmptyInitially)
+    {
+        EXPECT_EQ(0u, this->memoryPool.getTotalCount());
+        EXPECT_EQ(0u, this->memoryPool.getActualCount());
+        EXPECT_EQ(this->memoryPool.begin(), this->memoryPool.end());
+        EXPECT_EQ(this->memoryPool.cbegin(), this->memoryPool.cend());
+    }
+
+    TYPED_TEST(AMemoryPoolDense, AssignsHandlesSameAsMemoryPool)
+    {
+        MemoryPool<int, typename TypeParam::handle_type> referencePool;
+        for (uint32_t i = 0u; i < 6u; ++i)
+            EXPECT_EQ(referencePool.allocate(), this->memoryPool.allocate());
+
+        for (const auto handle : { 2u, 0u, 4u })
+        {
+            referencePool.release(typename TypeParam::handle_type(handle));
+            this->memoryPool.release(typename TypeParam::handle_type(handle));
+            EXPECT_EQ(referencePool.allocate(), this->memoryPool.allocate());
+        }
+
+        EXPECT_EQ(referencePool.allocate(typename TypeParam::handle_type(10u)), this->memoryPool.allocate(typename TypeParam::handle_type(10u)));
+        EXPECT_EQ(referencePool.getTotalCount(), this->memoryPool.getTotalCount());
+        EXPECT_EQ(referencePool.getActualCount(), this->memoryPool.getActualCount());
+    }
+
+    TYPED_TEST(AMemoryPoolDense, KeepsObjectsOfOtherHandlesWhenReleasing)
+    {
+        using HandleT = typename TypeParam::handle_type;
+        for (uint32_t i = 0u; i < 5u; ++i)
+            *this->memoryPool.getMemory(this->memoryPool.allocate(HandleT(i))) = static_cast<int>(i) * 10;
+
+        this->memoryPool.release(HandleT(1u));
+        this->memoryPool.release(HandleT(3u));
+
+        EXPECT_FALSE(this->memoryPool.isAllocated(HandleT(1u)));
+        EXPECT_FALSE(this->memoryPool.isAllocated(HandleT(3u)));
+        EXPECT_EQ(0, *this->memoryPool.getMemory(HandleT(0u)));
+        EXPECT_EQ(20, *this->memoryPool.getMemory(HandleT(2u)));
+        EXPECT_EQ(40, *this->memoryPool.getMemory(HandleT(4u)));
+        EXPECT_EQ(3u, this->memoryPool.getActualCount());
+        EXPECT_EQ(5u, this->memoryPool.getTotalCount());
+    }
+
+    TYPED_TEST(AMemoryPoolDense, ReallocatedHandleGetsDefaultConstructedObject)
+    {
+        using HandleT = typename TypeParam::handle_type;
+        *this->memoryPool.getMemory(this->memoryPool.allocate(HandleT(0u))) = 5;
+        this->memoryPool.release(HandleT(0u));
+        EXPECT_EQ(0, *this->memoryPool.getMemory(this->memoryPool.allocate(HandleT(0u))));
+    }
+
+    TYPED_TEST(AMemoryPoolDense, IteratesOnlyAllocatedObjects)
+    {
+        using HandleT = typename TypeParam::handle_type;
+        this->memoryPool.preallocateSize(100u);
+        for (uint32_t i = 0u; i < 100u; ++i)
+            *this->memoryPool.getMemory(this->memoryPool.allocate(HandleT(i))) = static_cast<int>(i);
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            if (i != 7u && i != 50u && i != 99u)
+                this->memoryPool.release(HandleT(i));
+        }
+
+        uint32_t numIterated = 0u;
+        for (const auto& it : this->memoryPool)
+        {
+            EXPECT_EQ(static_cast<int>(AsMemoryHandle(it.first)), *it.second);
+            ++numIterated;
+        }
+        EXPECT_EQ(3u, numIterated);
+
+        const std::vector<HandleT> expectedHandles{ HandleT(7u), HandleT(50u), HandleT(99u) };
+        EXPECT_EQ(expectedHandles, this->iteratedHandles());
+    }
+
+    TYPED_TEST(AMemoryPoolDense, CanUpdateObjectsUsingNonConstIterator)
+    {
+        using HandleT = typename TypeParam::handle_type;
+        this->memoryPool.allocate(HandleT(2u));
+        this->memoryPool.allocate(HandleT(4u));
+
+        for (auto it = this->memoryPool.begin(); it != this->memoryPool.end(); ++it)
+            *it->second = static_cast<int>(AsMemoryHandle(it->first)) + 1;
+
+        EXPECT_EQ(3, *this->memoryPool.getMemory(HandleT(2u)));
+        EXPECT_EQ(5, *this->memoryPool.getMemory(HandleT(4u)));
+    }
+
+    TYPED_TEST(AMemoryPoolDense, PreallocationDoesNotAllocateObjectsAndNeverShrinks)
+    {
+        this->memoryPool.preallocateSize(9u);
+        this->memoryPool.preallocateSize(3u);
+        EXPECT_EQ(9u, this->memoryPool.getTotalCount());
+        EXPECT_EQ(0u, this->memoryPool.getActualCount());
+        EXPECT_EQ(this->memoryPool.begin(), this->memoryPool.end());
+    }
+}
@@ -0,0 +1,97 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/Core/Utils/RamsesLogger.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ramses::internal
+{
+    class ARamsesLoggerWithAsyncLogging : public ::testing::Test
+    {
+    protected:
+        ARamsesLoggerWithAsyncLogging()
+        {
+            RamsesLoggerConfig config;
+            config.logLevelConsole = ELogLevel::Off;
+            config.asyncLogging = true;
+            config.asyncLogQueueCapacity = 16u;
+            logger.initialize(config, true, false);
+            logger.setLogHandler([this](ELogLevel /*level*/, std::string_view contextId, std::string_view message) {
+                if (contextId == "TEST")
+                    messages.emplace_back(message);
+            });
+        }
+
+        void log(const std::string& text)
+        {
+            logger.log(LogMessage{ context, ELogLevel::Info, text });
+        }
+
+        RamsesLogger logger;
+        LogContext& context = logger.createContext("test context", "TEST");
+        // only accessed by log handler (serialized by logger) and after stopping async logging
+        std::vector<std::string> messages;
+    };
+
+    TEST_F(ARamsesLoggerWithAsyncLogging, dispatchesMessagesInLoggingOrderOnFlush)
+    {
+        EXPECT_TRUE(logger.isAsyncLoggingActive());
+        for (int i = 0; i < 100; ++i)
+            log(std::to_string(i));
+        logger.flush();
+
+        ASSERT_EQ(100u, messages.size());
+        for (size_t i = 0u; i < messages.size(); ++i)
+            EXPECT_NE(std::string::npos, messages[i].find(std::to_string(i)));
+    }
+
+    TEST_F(ARamsesLoggerWithAsyncLogging, dispatchesQueuedMessagesWhenStopped)
+    {
+        for (int i = 0; i < 10; ++i)
+            log(std::to_string(i));
+        logger.stopAsyncLogging();
+
+        EXPECT_FALSE(logger.isAsyncLoggingActive());
+        EXPECT_EQ(10u, messages.size());
+
+        log("sync");
+        EXPECT_EQ(11u, messages.size());
+    }
+
+    TEST_F(ARamsesLoggerWithAsyncLogging, doesNotLoseMessagesLoggedWhileStopping)
+    {
+        constexpr size_t NumThreads = 4u;
+        constexpr size_t NumMessagesPerThread = 2000u;
+
+        std::atomic<size_t> numThreadsStarted{0u};
+        std::vector<std::thread> threads;
+        for (size_t t = 0u; t < NumThreads; ++t)
+        {
+            threads.emplace_back([&]() {
+                ++numThreadsStarted;
+                for (size_t i = 0u; i < NumMessagesPerThread; ++i)
+                    log("msg");
+            });
+        }
+
+        while (numThreadsStarted != NumThreads)
+            std::this_thread::yield();
+        logger.stopAsyncLogging();
+
+        for (auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQ(NumThreads * NumMessagesPerThread, messages.size());
+        EXPECT_EQ(0u, logger.getDroppedMessageCount());
+    }
+}
@@ -9,6 +9,8 @@
 #include "gtest/gtest.h"
 #include "internal/Core/Utils/TextureMathUtils.h"
 
+#include <array>
+
 namespace ramses::internal
 {
     TEST(TextureMathUtilsTest, getsCorrectLowerMipSize)
@@ -90,4 +92,23 @@ namespace ramses::internal
         EXPECT_EQ(3u, TextureMathUtils::GetMipLevelCount(7u, 1u, 2u));
         EXPECT_EQ(4u, TextureMathUtils::GetMipLevelCount(8u, 1u, 1u));
     }
+
+    TEST(TextureMathUtilsTest, generatesLowerMipLevelUsingBoxFilter)
+    {
+        // 2x2 RG texture
+        const std::array<std::byte, 8u> src{ std::byte{0}, std::byte{100}, std::byte{10}, std::byte{100}, std::byte{20}, std::byte{200}, std::byte{30}, std::byte{201} };
+        std::array<std::byte, 2u> dst{};
+        TextureMathUtils::GenerateLowerMipLevel(src.data(), 2u, 2u, 2u, dst.data());
+        EXPECT_EQ(std::byte{15}, dst[0]);
+        EXPECT_EQ(std::byte{150}, dst[1]);
+    }
+
+    TEST(TextureMathUtilsTest, generatesLowerMipLevelOfOddSizedTexture)
+    {
+        // 3x1 R texture, last column is clamped
+        const std::array<std::byte, 3u> src{ std::byte{10}, std::byte{20}, std::byte{40} };
+        std::array<std::byte, 1u> dst{};
+        TextureMathUtils::GenerateLowerMipLevel(src.data(), 3u, 1u, 1u, dst.data());
+        EXPECT_EQ(std::byte{15}, dst[0]);
+    }
 }
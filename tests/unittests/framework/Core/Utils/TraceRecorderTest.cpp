@@ -0,0 +1,166 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+
+#include "gmock/gmock.h"
+#include "internal/Core/Utils/TraceRecorder.h"
+
+#include <future>
+#include <sstream>
+#include <thread>
+
+namespace ramses::internal
+{
+    class ATraceRecorder : public testing::Test
+    {
+    protected:
+        ATraceRecorder()
+        {
+            m_recorder.enable(true);
+        }
+
+        TraceRecorder m_recorder{ 4u };
+    };
+
+    TEST_F(ATraceRecorder, isDisabledByDefault)
+    {
+        TraceRecorder recorder;
+        EXPECT_FALSE(recorder.isEnabled());
+        recorder.addEvent("cat", "event", 1u, 2u);
+        EXPECT_TRUE(recorder.getEvents().empty());
+    }
+
+    TEST_F(ATraceRecorder, recordsEventsWithDuration)
+    {
+        m_recorder.addEvent("cat", "event1", 10u, 15u);
+        m_recorder.addEvent("cat", "event2", 20u, 20u);
+
+        const auto events = m_recorder.getEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_STREQ("cat", events[0].category);
+        EXPECT_STREQ("event1", events[0].name);
+        EXPECT_EQ(10u, events[0].startTime);
+        EXPECT_EQ(5u, events[0].duration);
+        EXPECT_STREQ("event2", events[1].name);
+        EXPECT_EQ(0u, events[1].duration);
+    }
+
+    TEST_F(ATraceRecorder, keepsMostRecentEventsWhenRingBufferOverflows)
+    {
+        for (uint64_t i = 0u; i < 6u; ++i)
+            m_recorder.addEvent("cat", "event", i, i + 1u);
+
+        const auto events = m_recorder.getEvents();
+        ASSERT_EQ(4u, events.size());
+        for (uint64_t i = 0u; i < 4u; ++i)
+            EXPECT_EQ(i + 2u, events[i].startTime);
+    }
+
+    TEST_F(ATraceRecorder, stopsRecordingWhenDisabledAndCanBeCleared)
+    {
+        m_recorder.addEvent("cat", "event", 1u, 2u);
+        m_recorder.enable(false);
+        m_recorder.addEvent("cat", "event", 3u, 4u);
+        EXPECT_EQ(1u, m_recorder.getEvents().size());
+
+        m_recorder.clear();
+        EXPECT_TRUE(m_recorder.getEvents().empty());
+    }
+
+    TEST_F(ATraceRecorder, recordsEventsOfMultipleThreadsInSeparateBuffers)
+    {
+        std::thread thread1([&]() { m_recorder.addEvent("cat", "thread1", 1u, 2u); });
+        std::thread thread2([&]() { m_recorder.addEvent("cat", "thread2", 3u, 4u); });
+        thread1.join();
+        thread2.join();
+
+        std::ostringstream trace;
+        m_recorder.writeChromeTrace(trace);
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("name":"thread1","cat":"cat","ph":"X","ts":1,"dur":1,)"));
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("name":"thread2","cat":"cat","ph":"X","ts":3,"dur":1,)"));
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("tid":1})"));
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("tid":2})"));
+    }
+
+    TEST_F(ATraceRecorder, keepsEventsOfExitedThreadsUntilCleared)
+    {
+        std::thread([&]() { m_recorder.addEvent("cat", "exitedThread", 1u, 2u); }).join();
+        EXPECT_EQ(1u, m_recorder.getNumberOfThreadBuffers());
+        ASSERT_EQ(1u, m_recorder.getEvents().size());
+        EXPECT_STREQ("exitedThread", m_recorder.getEvents()[0].name);
+
+        m_recorder.clear();
+        EXPECT_EQ(0u, m_recorder.getNumberOfThreadBuffers());
+        EXPECT_TRUE(m_recorder.getEvents().empty());
+    }
+
+    TEST_F(ATraceRecorder, reusesEmptyBufferOfExitedThread)
+    {
+        std::promise<void> recorded;
+        std::promise<void> cleared;
+        std::thread thread1([&]() {
+            m_recorder.addEvent("cat", "thread1", 1u, 2u);
+            recorded.set_value();
+            cleared.get_future().wait();
+        });
+        recorded.get_future().wait();
+        m_recorder.clear();
+        cleared.set_value();
+        thread1.join();
+        EXPECT_EQ(1u, m_recorder.getNumberOfThreadBuffers());
+
+        std::thread([&]() { m_recorder.addEvent("cat", "thread2", 3u, 4u); }).join();
+        EXPECT_EQ(1u, m_recorder.getNumberOfThreadBuffers());
+
+        std::ostringstream trace;
+        m_recorder.writeChromeTrace(trace);
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("name":"thread2","cat":"cat","ph":"X","ts":3,"dur":1,)"));
+        EXPECT_THAT(trace.str(), testing::HasSubstr(R"("tid":2})"));
+    }
+
+    TEST_F(ATraceRecorder, releasesOldestBuffersOfExitedThreads)
+    {
+        constexpr uint64_t numThreads = TraceRecorder::MaxExitedThreadBuffers + 2u;
+        for (uint64_t i = 0u; i < numThreads; ++i)
+            std::thread([&]() { m_recorder.addEvent("cat", "event", i, i + 1u); }).join();
+
+        EXPECT_EQ(TraceRecorder::MaxExitedThreadBuffers, m_recorder.getNumberOfThreadBuffers());
+        const auto events = m_recorder.getEvents();
+        ASSERT_EQ(TraceRecorder::MaxExitedThreadBuffers, events.size());
+        for (size_t i = 0u; i < events.size(); ++i)
+            EXPECT_EQ(i + 2u, events[i].startTime);
+    }
+
+    TEST_F(ATraceRecorder, writesEmptyChromeTrace)
+    {
+        std::ostringstream trace;
+        m_recorder.writeChromeTrace(trace);
+        EXPECT_EQ("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n", trace.str());
+    }
+
+    TEST(ScopedTraceEvent, recordsScopeInGlobalRecorderOnlyIfEnabled)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        recorder.clear();
+        {
+            RAMSES_TRACE_SCOPE("test", "disabledScope");
+        }
+        EXPECT_TRUE(recorder.getEvents().empty());
+
+        recorder.enable(true);
+        {
+            RAMSES_TRACE_SCOPE("test", "enabledScope");
+        }
+        recorder.enable(false);
+
+        const auto events = recorder.getEvents();
+        ASSERT_EQ(1u, events.size());
+        EXPECT_STREQ("enabledScope", events[0].name);
+        recorder.clear();
+    }
+}
@@ -0,0 +1,191 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/PlatformAbstraction/Collections/FlatHashMap.h"
+#include "internal/SceneGraph/SceneAPI/ResourceContentHash.h"
+#include "ComplexTestType.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <vector>
+
+namespace ramses::internal
+{
+    using RCKey = ComplexTestType<struct FlatKeyTag>;
+    using RCValue = ComplexTestType<struct FlatValueTag>;
+
+    class AFlatHashMap : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            RCKey::Reset();
+            RCValue::Reset();
+        }
+
+    protected:
+        FlatHashMap<uint32_t, int32_t> map;
+    };
+
+    TEST_F(AFlatHashMap, isEmptyInitially)
+    {
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_EQ(nullptr, map.get(1u));
+    }
+
+    TEST_F(AFlatHashMap, putsAndGetsValues)
+    {
+        map.put(1u, 10);
+        map.put(2u, 20);
+        EXPECT_EQ(2u, map.size());
+        ASSERT_NE(nullptr, map.get(1u));
+        EXPECT_EQ(10, *map.get(1u));
+
+        int32_t value = 0;
+        EXPECT_EQ(EStatus::Ok, map.get(2u, value));
+        EXPECT_EQ(20, value);
+        EXPECT_EQ(EStatus::NotExist, map.get(3u, value));
+    }
+
+    TEST_F(AFlatHashMap, putOverwritesExistingValue)
+    {
+        map.put(1u, 10);
+        const auto it = map.put(1u, 11);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(1u, it->key);
+        EXPECT_EQ(11, it->value);
+        EXPECT_EQ(11, *map.get(1u));
+    }
+
+    TEST_F(AFlatHashMap, subscriptOperatorAddsDefaultValueOrReturnsExisting)
+    {
+        EXPECT_EQ(0, map[5u]);
+        EXPECT_EQ(1u, map.size());
+        map[5u] = 3;
+        EXPECT_EQ(3, map[5u]);
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, canModifyValueThroughFindAndGet)
+    {
+        map.put(1u, 10);
+        map.find(1u)->value = 12;
+        EXPECT_EQ(12, *map.get(1u));
+        *map.get(1u) = 13;
+        EXPECT_EQ(13, map.find(1u)->value);
+        EXPECT_EQ(map.end(), map.find(2u));
+    }
+
+    TEST_F(AFlatHashMap, removesByKey)
+    {
+        map.put(1u, 10);
+        map.put(2u, 20);
+
+        int32_t oldValue = 0;
+        EXPECT_TRUE(map.remove(1u, &oldValue));
+        EXPECT_EQ(10, oldValue);
+        EXPECT_FALSE(map.remove(1u));
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_TRUE(map.contains(2u));
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, removesAllEntriesWhileIterating)
+    {
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, static_cast<int32_t>(i));
+
+        uint32_t numRemoved = 0u;
+        for (auto it = map.begin(); it != map.end();)
+        {
+            it = map.remove(it);
+            ++numRemoved;
+        }
+        EXPECT_EQ(100u, numRemoved);
+        EXPECT_EQ(0u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, iteratesAllEntries)
+    {
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, static_cast<int32_t>(i) * 2);
+
+        std::vector<uint32_t> keys;
+        const auto& constMap = map;
+        for (const auto& entry : constMap)
+        {
+            EXPECT_EQ(static_cast<int32_t>(entry.key) * 2, entry.value);
+            keys.push_back(entry.key);
+        }
+        std::sort(keys.begin(), keys.end());
+        ASSERT_EQ(100u, keys.size());
+        for (uint32_t i = 0u; i < 100u; ++i)
+            EXPECT_EQ(i, keys[i]);
+    }
+
+    TEST_F(AFlatHashMap, reservesCapacity)
+    {
+        map.reserve(1000u);
+        EXPECT_GE(map.capacity(), 1000u);
+        const FlatHashMap<uint32_t, int32_t> otherMap(500u);
+        EXPECT_GE(otherMap.capacity(), 500u);
+    }
+
+    TEST_F(AFlatHashMap, copiesAndSwaps)
+    {
+        map.put(1u, 10);
+        FlatHashMap<uint32_t, int32_t> copy(map);
+        copy.put(2u, 20);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(2u, copy.size());
+
+        swap(map, copy);
+        EXPECT_EQ(2u, map.size());
+        EXPECT_EQ(1u, copy.size());
+    }
+
+    TEST_F(AFlatHashMap, constructsAndDestructsObjects)
+    {
+        {
+            FlatHashMap<RCKey, RCValue> objectMap;
+            for (uint32_t i = 0u; i < 50u; ++i)
+                objectMap.put(RCKey(i), RCValue(i));
+            EXPECT_EQ(50, RCKey::RefCnt());
+            EXPECT_EQ(50, RCValue::RefCnt());
+
+            objectMap.remove(RCKey(3u));
+            EXPECT_EQ(49, RCKey::RefCnt());
+            EXPECT_EQ(49, RCValue::RefCnt());
+
+            objectMap.clear();
+            EXPECT_EQ(0, RCKey::RefCnt());
+            EXPECT_EQ(0, RCValue::RefCnt());
+
+            objectMap.put(RCKey(1u), RCValue(1u));
+        }
+        EXPECT_EQ(0, RCKey::RefCnt());
+        EXPECT_EQ(0, RCValue::RefCnt());
+    }
+
+    TEST_F(AFlatHashMap, worksWithResourceContentHashKeys)
+    {
+        FlatHashMap<ResourceContentHash, uint32_t> resourceMap;
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            resourceMap.put(ResourceContentHash{ i * 0x9e3779b97f4a7c15u, i }, i);
+
+        EXPECT_EQ(1000u, resourceMap.size());
+        for (uint32_t i = 0u; i < 1000u; ++i)
+        {
+            const uint32_t* value = resourceMap.get(ResourceContentHash{ i * 0x9e3779b97f4a7c15u, i });
+            ASSERT_NE(nullptr, value);
+            EXPECT_EQ(i, *value);
+        }
+        EXPECT_FALSE(resourceMap.contains(ResourceContentHash{ 1u, 1u }));
+    }
+}
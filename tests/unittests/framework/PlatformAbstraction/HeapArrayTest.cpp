@@ -43,6 +43,30 @@ namespace ramses::internal
         EXPECT_EQ(data, a.span());
     }
 
+    TYPED_TEST(AHeapArray, TakesOwnershipOfDataWithoutCopyingAndReleasesItWithItsDeleter)
+    {
+        static bool deleted = false;
+        deleted = false;
+        TypeParam* data = new TypeParam[4]{1, 2, 3, 4};
+        {
+            HeapArray<TypeParam> a(4, typename HeapArray<TypeParam>::OwnedData(data, [](const TypeParam* ptr) { deleted = true; delete[] ptr; }));
+            EXPECT_EQ(data, a.data());
+            EXPECT_EQ(4u, a.size());
+
+            HeapArray<TypeParam> b(std::move(a));
+            EXPECT_EQ(data, b.data());
+            EXPECT_FALSE(deleted);
+        }
+        EXPECT_TRUE(deleted);
+    }
+
+    TYPED_TEST(AHeapArray, IsEmptyWhenTakingOwnershipOfNoData)
+    {
+        HeapArray<TypeParam> a(4, typename HeapArray<TypeParam>::OwnedData(nullptr, [](const TypeParam* ptr) { delete[] ptr; }));
+        EXPECT_TRUE(a.data() == nullptr);
+        EXPECT_EQ(0u, a.size());
+    }
+
     TYPED_TEST(AHeapArray, CanGetConstData)
     {
         HeapArray<TypeParam> a(4);
@@ -213,4 +213,16 @@ namespace ramses::internal
 
         GetRamsesLogger().setLogHandler(nullptr);
     }
+
+    TEST(PlatformThreadScheduling, appliesDefaultSchedulingAndReportsIt)
+    {
+        // run in own thread to keep scheduling of test thread unchanged
+        std::thread t([] {
+            EXPECT_TRUE(PlatformThread::SetCurrentThreadScheduling(ThreadScheduling{}));
+            const auto scheduling = PlatformThread::GetCurrentThreadScheduling();
+            EXPECT_EQ(EThreadSchedulingPolicy::Default, scheduling.policy);
+            EXPECT_EQ(0, scheduling.priority);
+            });
+        t.join();
+    }
 }
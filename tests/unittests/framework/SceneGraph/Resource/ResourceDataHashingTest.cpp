@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Resource/ResourceDataHashing.h"
+#include "internal/Core/TaskFramework/ThreadedTaskExecutor.h"
+#include "ManuallyExecutedTaskQueue.h"
+#include "gtest/gtest.h"
+#include <city.h>
+#include <vector>
+
+namespace ramses::internal
+{
+    class AResourceDataHashing : public ::testing::Test
+    {
+    protected:
+        static std::vector<std::byte> CreateData(size_t size)
+        {
+            std::vector<std::byte> data(size);
+            for (size_t i = 0u; i < size; ++i)
+                data[i] = static_cast<std::byte>((i * 31u) ^ (i >> 8u));
+            return data;
+        }
+    };
+
+    TEST_F(AResourceDataHashing, hashesDataUpToChunkSizeWithPlainCityhash)
+    {
+        for (size_t size : { size_t{ 1u }, size_t{ 1000u }, ResourceDataHashing::ChunkSize })
+        {
+            const auto data = CreateData(size);
+            const auto expected = cityhash::CityHash128(reinterpret_cast<const char*>(data.data()), data.size());
+            const auto hash = ResourceDataHashing::HashData(data);
+            EXPECT_EQ(cityhash::Uint128Low64(expected), hash.lowPart);
+            EXPECT_EQ(cityhash::Uint128High64(expected), hash.highPart);
+        }
+    }
+
+    TEST_F(AResourceDataHashing, hashOfLargeDataDoesNotDependOnTaskQueue)
+    {
+        ThreadedTaskExecutor executor(3);
+        ManuallyExecutedTaskQueue manualQueue;
+
+        for (size_t size : { ResourceDataHashing::ChunkSize + 1u, 3u * ResourceDataHashing::ChunkSize, 7u * ResourceDataHashing::ChunkSize + 13u })
+        {
+            const auto data = CreateData(size);
+            const auto hash = ResourceDataHashing::HashData(data);
+            EXPECT_EQ(hash, ResourceDataHashing::HashData(data, &executor));
+            EXPECT_EQ(hash, ResourceDataHashing::HashData(data, &manualQueue));
+        }
+
+        // tasks executed after calling thread hashed all chunks find nothing left to do
+        manualQueue.executeAll();
+    }
+
+    TEST_F(AResourceDataHashing, hashOfLargeDataChangesWithContentOfAnyChunk)
+    {
+        auto data = CreateData(3u * ResourceDataHashing::ChunkSize);
+        const auto hash = ResourceDataHashing::HashData(data);
+
+        for (size_t chunk = 0u; chunk < 3u; ++chunk)
+        {
+            auto modified = data;
+            modified[chunk * ResourceDataHashing::ChunkSize + 5u] ^= std::byte{ 1u };
+            EXPECT_NE(hash, ResourceDataHashing::HashData(modified));
+        }
+    }
+}
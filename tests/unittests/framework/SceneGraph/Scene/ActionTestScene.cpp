@@ -119,6 +119,24 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderableBoundingSphere(RenderableHandle renderableHandle, const glm::vec4& boundingSphere)
+    {
+        m_actionCollector.setRenderableBoundingSphere(renderableHandle, boundingSphere);
+        flushPendingSceneActions();
+    }
+
+    void ActionTestScene::setRenderableInstancePositions(RenderableHandle renderableHandle, DataBufferHandle instancePositions)
+    {
+        m_actionCollector.setRenderableInstancePositions(renderableHandle, instancePositions);
+        flushPendingSceneActions();
+    }
+
+    void ActionTestScene::setRenderableLevelsOfDetail(RenderableHandle renderableHandle, const RenderableLevelsOfDetail& levelsOfDetail)
+    {
+        m_actionCollector.setRenderableLevelsOfDetail(renderableHandle, levelsOfDetail);
+        flushPendingSceneActions();
+    }
+
     const Renderable& ActionTestScene::getRenderable(RenderableHandle renderableHandle) const
     {
         return m_scene.getRenderable(renderableHandle);
@@ -493,6 +511,11 @@ namespace ramses::internal
         return m_scene.getDataUniformBuffer(containerHandle, field);
     }
 
+    int32_t ActionTestScene::getDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle) const
+    {
+        return m_scene.getDataInstanceUniformTimeAnimationEnd(containerHandle);
+    }
+
     float ActionTestScene::getDataSingleFloat(DataInstanceHandle containerHandle, DataFieldHandle field) const
     {
         return m_scene.getDataSingleFloat(containerHandle, field);
@@ -649,6 +672,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setDataInstanceUniformTimeAnimationEnd(DataInstanceHandle containerHandle, int32_t endTimeMs)
+    {
+        m_actionCollector.setDataInstanceUniformTimeAnimationEnd(containerHandle, endTimeMs);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::setDataSingleFloat(DataInstanceHandle containerHandle, DataFieldHandle field, float data)
     {
         m_actionCollector.setDataSingleFloat(containerHandle, field, data);
@@ -922,6 +951,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setDataBufferUsedSize(DataBufferHandle handle, uint32_t usedSizeInBytes)
+    {
+        m_actionCollector.setDataBufferUsedSize(handle, usedSizeInBytes);
+        flushPendingSceneActions();
+    }
+
     bool ActionTestScene::isDataBufferAllocated(DataBufferHandle handle) const
     {
         return m_scene.isDataBufferAllocated(handle);
@@ -1065,6 +1100,12 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setSceneReferencePreload(SceneReferenceHandle handle, RendererSceneState preloadState, int32_t preloadPriority)
+    {
+        m_actionCollector.setSceneReferencePreload(handle, preloadState, preloadPriority);
+        flushPendingSceneActions();
+    }
+
     bool ActionTestScene::isSceneReferenceAllocated(SceneReferenceHandle handle) const
     {
         return m_scene.isSceneReferenceAllocated(handle);
@@ -1122,6 +1163,30 @@ namespace ramses::internal
         flushPendingSceneActions();
     }
 
+    void ActionTestScene::setRenderPassStateSorting(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassStateSorting(pass, enable);
+        flushPendingSceneActions();
+    }
+
+    void ActionTestScene::setRenderPassFrontToBackSorting(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassFrontToBackSorting(pass, enable);
+        flushPendingSceneActions();
+    }
+
+    void ActionTestScene::setRenderPassBackToFrontSorting(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassBackToFrontSorting(pass, enable);
+        flushPendingSceneActions();
+    }
+
+    void ActionTestScene::setRenderPassDepthPrePass(RenderPassHandle pass, bool enable)
+    {
+        m_actionCollector.setRenderPassDepthPrePass(pass, enable);
+        flushPendingSceneActions();
+    }
+
     void ActionTestScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         m_actionCollector.addRenderGroupToRenderPass(passHandle, groupHandle, order);
@@ -0,0 +1,125 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/DataLayout.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "gtest/gtest.h"
+#include <cstring>
+
+namespace ramses::internal
+{
+    TEST(ADataLayout, placesFieldsWithNativeAlignmentByDefault)
+    {
+        DataLayout layout;
+        layout.setDataFields({ DataFieldInfo{ EDataType::Float }, DataFieldInfo{ EDataType::Vector3F }, DataFieldInfo{ EDataType::Float, 2u } });
+
+        EXPECT_EQ(0u, layout.getFieldOffset(DataFieldHandle{ 0u }));
+        EXPECT_EQ(4u, layout.getFieldOffset(DataFieldHandle{ 1u }));
+        EXPECT_EQ(16u, layout.getFieldOffset(DataFieldHandle{ 2u }));
+        EXPECT_EQ(24u, layout.getTotalSize());
+        EXPECT_EQ(0u, layout.getUniformBlockSize());
+    }
+
+    TEST(ADataLayout, placesValueFieldsUsingStd140Rules)
+    {
+        DataLayout layout;
+        layout.setDataFields({
+            DataFieldInfo{ EDataType::Float },
+            DataFieldInfo{ EDataType::Vector3F },
+            DataFieldInfo{ EDataType::Float },
+            DataFieldInfo{ EDataType::Vector2F },
+            DataFieldInfo{ EDataType::Matrix44F },
+            DataFieldInfo{ EDataType::Vector4F, 3u },
+            DataFieldInfo{ EDataType::Int32 } },
+            EDataLayoutPacking::Std140UniformBlock);
+
+        EXPECT_EQ(0u, layout.getFieldOffset(DataFieldHandle{ 0u }));
+        EXPECT_EQ(16u, layout.getFieldOffset(DataFieldHandle{ 1u }));
+        EXPECT_EQ(28u, layout.getFieldOffset(DataFieldHandle{ 2u }));
+        EXPECT_EQ(32u, layout.getFieldOffset(DataFieldHandle{ 3u }));
+        EXPECT_EQ(48u, layout.getFieldOffset(DataFieldHandle{ 4u }));
+        EXPECT_EQ(112u, layout.getFieldOffset(DataFieldHandle{ 5u }));
+        EXPECT_EQ(160u, layout.getFieldOffset(DataFieldHandle{ 6u }));
+        EXPECT_EQ(176u, layout.getUniformBlockSize());
+        EXPECT_EQ(176u, layout.getTotalSize());
+    }
+
+    TEST(ADataLayout, placesNonValueFieldsAfterStd140Block)
+    {
+        DataLayout layout;
+        layout.setDataFields({
+            DataFieldInfo{ EDataType::TextureSampler2D },
+            DataFieldInfo{ EDataType::Float },
+            DataFieldInfo{ EDataType::DataReference },
+            DataFieldInfo{ EDataType::Vector4F } },
+            EDataLayoutPacking::Std140UniformBlock);
+
+        EXPECT_EQ(0u, layout.getFieldOffset(DataFieldHandle{ 1u }));
+        EXPECT_EQ(16u, layout.getFieldOffset(DataFieldHandle{ 3u }));
+        EXPECT_EQ(32u, layout.getUniformBlockSize());
+        EXPECT_LE(32u, layout.getFieldOffset(DataFieldHandle{ 0u }));
+        EXPECT_LT(layout.getFieldOffset(DataFieldHandle{ 0u }), layout.getFieldOffset(DataFieldHandle{ 2u }));
+        EXPECT_EQ(layout.getFieldOffset(DataFieldHandle{ 2u }) + EnumToSize(EDataType::DataReference), layout.getTotalSize());
+    }
+
+    TEST(ADataLayout, fallsBackToNativePackingIfValueFieldCannotBeRepresentedAsStd140)
+    {
+        for (const auto& field : { DataFieldInfo{ EDataType::Bool }, DataFieldInfo{ EDataType::Matrix33F }, DataFieldInfo{ EDataType::Float, 4u }, DataFieldInfo{ EDataType::Vector3F, 2u } })
+        {
+            DataLayout nativeLayout;
+            nativeLayout.setDataFields({ DataFieldInfo{ EDataType::Vector4F }, field, DataFieldInfo{ EDataType::Vector2F } });
+            DataLayout layout;
+            layout.setDataFields({ DataFieldInfo{ EDataType::Vector4F }, field, DataFieldInfo{ EDataType::Vector2F } }, EDataLayoutPacking::Std140UniformBlock);
+
+            EXPECT_EQ(0u, layout.getUniformBlockSize());
+            EXPECT_EQ(nativeLayout.getTotalSize(), layout.getTotalSize());
+            for (DataFieldHandle i{ 0u }; i < 3u; ++i)
+                EXPECT_EQ(nativeLayout.getFieldOffset(i), layout.getFieldOffset(i));
+        }
+    }
+
+    TEST(ADataLayout, hasNoStd140BlockIfThereAreNoValueFields)
+    {
+        DataLayout layout;
+        layout.setDataFields({ DataFieldInfo{ EDataType::TextureSampler2D }, DataFieldInfo{ EDataType::DataReference } }, EDataLayoutPacking::Std140UniformBlock);
+        EXPECT_EQ(0u, layout.getUniformBlockSize());
+        EXPECT_EQ(0u, layout.getFieldOffset(DataFieldHandle{ 0u }));
+    }
+
+    TEST(ADataLayout, isCreatedWithNativePackingBySceneByDefault)
+    {
+        Scene scene;
+        EXPECT_EQ(EDataLayoutPacking::Native, scene.getDataLayoutPacking());
+        const DataLayoutHandle dataLayout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Float), DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u), {});
+        EXPECT_EQ(0u, scene.getDataLayout(dataLayout).getUniformBlockSize());
+
+        const DataInstanceHandle dataInstance = scene.allocateDataInstance(dataLayout, {});
+        EXPECT_EQ(nullptr, scene.getDataUniformBlock(dataInstance));
+    }
+
+    TEST(ADataLayout, providesValuesOfDataInstanceAsStd140UniformBlockIfEnabledInScene)
+    {
+        Scene scene;
+        scene.setDataLayoutPacking(EDataLayoutPacking::Std140UniformBlock);
+        const DataLayoutHandle dataLayout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Float), DataFieldInfo(EDataType::TextureSampler2D), DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u), {});
+        ASSERT_EQ(32u, scene.getDataLayout(dataLayout).getUniformBlockSize());
+
+        const DataInstanceHandle dataInstance = scene.allocateDataInstance(dataLayout, {});
+        const float floatValue = 3.f;
+        const glm::vec4 vecValue{ 1.f, 2.f, 3.f, 4.f };
+        scene.setDataSingleFloat(dataInstance, DataFieldHandle(0u), floatValue);
+        scene.setDataSingleVector4f(dataInstance, DataFieldHandle(2u), vecValue);
+        EXPECT_EQ(TextureSamplerHandle::Invalid(), scene.getDataTextureSamplerHandle(dataInstance, DataFieldHandle(1u)));
+        EXPECT_EQ(floatValue, scene.getDataSingleFloat(dataInstance, DataFieldHandle(0u)));
+
+        const std::byte* block = scene.getDataUniformBlock(dataInstance);
+        ASSERT_NE(nullptr, block);
+        EXPECT_EQ(0, std::memcmp(block, &floatValue, sizeof(floatValue)));
+        EXPECT_EQ(0, std::memcmp(block + 16u, &vecValue, sizeof(vecValue)));
+    }
+}
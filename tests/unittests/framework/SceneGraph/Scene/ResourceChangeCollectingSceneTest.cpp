@@ -62,6 +62,32 @@ namespace ramses::internal
             return geometryData;
         }
 
+        void expectClientResourceUsageChanges(const ResourceContentHashVector& expectedAdded, const ResourceContentHashVector& expectedRemoved)
+        {
+            ResourceContentHashVector added;
+            ResourceContentHashVector removed;
+            scene.getClientResourceUsageChanges(added, removed);
+            EXPECT_EQ(expectedAdded, added);
+            EXPECT_EQ(expectedRemoved, removed);
+
+            // tracked changes must match the full scan of scene
+            ResourceContentHashVector resourcesInUse;
+            ResourceUtils::GetAllResourcesFromScene(resourcesInUse, scene);
+            ResourceChanges changes;
+            changes.m_resourcesAdded = added;
+            changes.m_resourcesRemoved = removed;
+            ResourceContentHashVector resourcesFromChanges;
+            ResourceUtils::ApplyResourceChanges(m_resourcesInUseAtLastReset, changes, resourcesFromChanges);
+            EXPECT_EQ(resourcesInUse, resourcesFromChanges);
+        }
+
+        void resetClientResourceUsageChanges()
+        {
+            scene.resetResourceChanges();
+            m_resourcesInUseAtLastReset.clear();
+            ResourceUtils::GetAllResourcesFromScene(m_resourcesInUseAtLastReset, scene);
+        }
+
         void expectSameSceneResourceChangesWhenExtractedFromScene(size_t expectedSceneResourcesByteSize = 0u)
         {
             SceneResourceActionVector fromScene;
@@ -76,6 +102,7 @@ namespace ramses::internal
 
         ResourceChangeCollectingScene scene;
         const SceneResourceActionVector& sceneResourceActions;
+        ResourceContentHashVector m_resourcesInUseAtLastReset;
 
         const DataLayoutHandle testUniformLayout;
         const DataLayoutHandle testGeometryLayout;
@@ -506,4 +533,93 @@ namespace ramses::internal
         scene.releaseDataSlot(dataSlot);
         EXPECT_FALSE(scene.haveResourcesChanged());
     }
+
+    TEST_F(AResourceChangeCollectingScene, tracksClientResourcesOfRenderableDataInstances)
+    {
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle geometryData = createVertexDataInstance(renderable);
+        createUniformDataInstanceWithSampler(renderable, { 789, 0 });
+        scene.setDataResource(geometryData, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectClientResourceUsageChanges({ { 123, 0 }, { 789, 0 } }, {});
+        resetClientResourceUsageChanges();
+        expectClientResourceUsageChanges({}, {});
+
+        scene.setDataResource(geometryData, vertAttribField, { 456, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectClientResourceUsageChanges({ { 456, 0 } }, { { 123, 0 } });
+        resetClientResourceUsageChanges();
+
+        scene.releaseRenderable(renderable);
+        expectClientResourceUsageChanges({}, { { 456, 0 }, { 789, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, doesNotTrackClientResourcesOfDataInstanceNotUsedByVisibleRenderable)
+    {
+        const DataInstanceHandle geometryData = scene.allocateDataInstance(testGeometryLayout, {});
+        scene.setDataResource(geometryData, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectClientResourceUsageChanges({}, {});
+
+        const RenderableHandle renderable = createRenderable();
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Off);
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometryData);
+        expectClientResourceUsageChanges({}, {});
+
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Invisible);
+        expectClientResourceUsageChanges({ { 123, 0 } }, {});
+        resetClientResourceUsageChanges();
+
+        scene.setRenderableVisibility(renderable, EVisibilityMode::Off);
+        expectClientResourceUsageChanges({}, { { 123, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, tracksClientResourceUsedMultipleTimesUntilLastUsageRemoved)
+    {
+        const RenderableHandle renderable1 = createRenderable();
+        const RenderableHandle renderable2 = createRenderable();
+        createUniformDataInstanceWithSampler(renderable1, { 789, 0 });
+        createUniformDataInstanceWithSampler(renderable2, { 789, 0 });
+        const DataSlotHandle dataSlot = scene.allocateDataSlot({ EDataSlotType::TextureProvider, DataSlotId(0u), NodeHandle(), DataInstanceHandle(), { 789, 0 }, TextureSamplerHandle() }, {});
+        expectClientResourceUsageChanges({ { 789, 0 } }, {});
+        resetClientResourceUsageChanges();
+
+        scene.releaseRenderable(renderable1);
+        scene.releaseDataSlot(dataSlot);
+        expectClientResourceUsageChanges({}, {});
+
+        scene.releaseRenderable(renderable2);
+        expectClientResourceUsageChanges({}, { { 789, 0 } });
+    }
+
+    TEST_F(AResourceChangeCollectingScene, reportsNoChangeForClientResourceRemovedAndAddedBackBeforeReset)
+    {
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle geometryData = createVertexDataInstance(renderable);
+        scene.setDataResource(geometryData, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        resetClientResourceUsageChanges();
+
+        scene.setDataResource(geometryData, vertAttribField, { 456, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setDataResource(geometryData, vertAttribField, { 123, 0 }, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        expectClientResourceUsageChanges({}, {});
+    }
+
+    TEST_F(AResourceChangeCollectingScene, tracksClientResourcesOfObjectsReleasedAndAllocatedWhileReferenced)
+    {
+        const RenderableHandle renderable = createRenderable();
+        const DataInstanceHandle uniformData = createUniformDataInstanceWithSampler(renderable, { 789, 0 });
+        const TextureSamplerHandle sampler = scene.getDataTextureSamplerHandle(uniformData, samplerField);
+        resetClientResourceUsageChanges();
+
+        // sampler released and allocated again with same handle while still assigned to data instance
+        scene.releaseTextureSampler(sampler);
+        expectClientResourceUsageChanges({}, { { 789, 0 } });
+        scene.allocateTextureSampler({ {}, { 321, 0 } }, sampler);
+        expectClientResourceUsageChanges({ { 321, 0 } }, { { 789, 0 } });
+        resetClientResourceUsageChanges();
+
+        // data instance released and allocated again with same handle while still assigned to renderable
+        scene.releaseDataInstance(uniformData);
+        expectClientResourceUsageChanges({}, { { 321, 0 } });
+        scene.allocateDataInstance(testUniformLayout, uniformData);
+        scene.setDataTextureSamplerHandle(uniformData, samplerField, sampler);
+        expectClientResourceUsageChanges({}, {});
+    }
 }
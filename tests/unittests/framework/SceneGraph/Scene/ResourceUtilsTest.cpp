@@ -424,4 +424,33 @@ namespace ramses::internal
         EXPECT_EQ(resultAdded, changes.m_resourcesAdded);
         EXPECT_EQ(resultRemoved, changes.m_resourcesRemoved);
     }
+
+    TEST(ASceneResourceUtilsApplyChangesFunction, restoresCurrentFromOldAndDiff)
+    {
+        const ResourceContentHashVector old{ {0, 111}, {0, 222}, {0, 333}, {0, 444}, {0, 555}, {0, 999} };
+        const ResourceContentHashVector current{ {0, 333}, {0, 555}, {0, 666}, {0, 777}, {0, 888}, {0, 999} };
+        ResourceChanges changes;
+        ResourceUtils::DiffResources(old, current, changes);
+
+        ResourceContentHashVector result;
+        ResourceUtils::ApplyResourceChanges(old, changes, result);
+        EXPECT_EQ(current, result);
+    }
+
+    TEST(ASceneResourceUtilsApplyChangesFunction, addsToAndRemovesFromEmptyOrEmptiedList)
+    {
+        const ResourceContentHashVector resources{ {0, 111}, {0, 222} };
+        ResourceChanges changes;
+        changes.m_resourcesAdded = resources;
+
+        ResourceContentHashVector result;
+        ResourceUtils::ApplyResourceChanges({}, changes, result);
+        EXPECT_EQ(resources, result);
+
+        changes.clear();
+        changes.m_resourcesRemoved = resources;
+        ResourceContentHashVector emptied;
+        ResourceUtils::ApplyResourceChanges(result, changes, emptied);
+        EXPECT_TRUE(emptied.empty());
+    }
 }
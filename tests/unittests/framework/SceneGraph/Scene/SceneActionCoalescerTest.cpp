@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionCoalescer.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include <gtest/gtest.h>
+#include <array>
+
+namespace ramses::internal
+{
+    class ASceneActionCoalescer : public ::testing::Test
+    {
+    public:
+        ASceneActionCoalescer()
+            : creator(collection, EFeatureLevel_Latest)
+        {
+        }
+
+        glm::vec3 readTranslation(uint32_t actionIndex) const
+        {
+            auto action = collection[actionIndex];
+            TransformHandle transform;
+            glm::vec3 value;
+            action.read(transform);
+            action.read(value);
+            return value;
+        }
+
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator;
+    };
+
+    TEST_F(ASceneActionCoalescer, keepsOnlyLastValueSetToSameTransform)
+    {
+        creator.setTranslation(TransformHandle{ 1u }, { 1.f, 0.f, 0.f });
+        creator.setTranslation(TransformHandle{ 1u }, { 2.f, 0.f, 0.f });
+        creator.setTranslation(TransformHandle{ 1u }, { 3.f, 0.f, 0.f });
+
+        EXPECT_EQ(2u, SceneActionCoalescer::CoalesceActions(collection));
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId::SetTranslation, collection[0].type());
+        EXPECT_EQ(glm::vec3(3.f, 0.f, 0.f), readTranslation(0u));
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsValuesSetToDifferentObjectsOrProperties)
+    {
+        creator.setTranslation(TransformHandle{ 1u }, { 1.f, 0.f, 0.f });
+        creator.setTranslation(TransformHandle{ 2u }, { 2.f, 0.f, 0.f });
+        creator.setScaling(TransformHandle{ 1u }, { 1.f, 1.f, 1.f });
+        const float value = 1.f;
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value);
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 1u }, 1u, &value);
+
+        EXPECT_EQ(0u, SceneActionCoalescer::CoalesceActions(collection));
+        EXPECT_EQ(5u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOrderOfRemainingActions)
+    {
+        const float value1 = 1.f;
+        const float value2 = 2.f;
+        creator.setTranslation(TransformHandle{ 1u }, { 1.f, 0.f, 0.f });
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value1);
+        creator.setRenderableVisibility(RenderableHandle{ 1u }, EVisibilityMode::Off);
+        creator.setTranslation(TransformHandle{ 1u }, { 2.f, 0.f, 0.f });
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value2);
+
+        EXPECT_EQ(2u, SceneActionCoalescer::CoalesceActions(collection));
+        ASSERT_EQ(3u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId::SetRenderableVisibility, collection[0].type());
+        EXPECT_EQ(ESceneActionId::SetTranslation, collection[1].type());
+        EXPECT_EQ(ESceneActionId::SetDataFloatArray, collection[2].type());
+        EXPECT_EQ(glm::vec3(2.f, 0.f, 0.f), readTranslation(1u));
+
+        auto dataAction = collection[2];
+        DataInstanceHandle instance;
+        DataFieldHandle field;
+        float data = 0.f;
+        uint32_t numElements = 0u;
+        dataAction.read(instance);
+        dataAction.read(field);
+        dataAction.read(&data, numElements);
+        ASSERT_EQ(1u, numElements);
+        EXPECT_EQ(value2, data);
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNotCoalesceAcrossOtherActions)
+    {
+        creator.setTranslation(TransformHandle{ 1u }, { 1.f, 0.f, 0.f });
+        creator.releaseTransform(TransformHandle{ 1u });
+        creator.allocateTransform(NodeHandle{ 1u }, TransformHandle{ 1u });
+        creator.setTranslation(TransformHandle{ 1u }, { 2.f, 0.f, 0.f });
+
+        EXPECT_EQ(0u, SceneActionCoalescer::CoalesceActions(collection));
+        EXPECT_EQ(4u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNotCoalesceDataArraysOfDifferentSize)
+    {
+        const std::array<float, 2u> values{ 1.f, 2.f };
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 2u, values.data());
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, values.data());
+
+        EXPECT_EQ(0u, SceneActionCoalescer::CoalesceActions(collection));
+        EXPECT_EQ(2u, collection.numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, doesNothingForEmptyCollection)
+    {
+        EXPECT_EQ(0u, SceneActionCoalescer::CoalesceActions(collection));
+        EXPECT_TRUE(collection.empty());
+    }
+}
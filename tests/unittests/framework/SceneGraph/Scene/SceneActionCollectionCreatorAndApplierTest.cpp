@@ -8,9 +8,11 @@
 
 #include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
+#include "internal/SceneGraph/Scene/Scene.h"
 #include "internal/Components/FlushTimeInformation.h"
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <array>
 
 namespace ramses::internal
 {
@@ -22,8 +24,15 @@ namespace ramses::internal
         {
         }
 
+        // writes raw bulk array the same way as creator does, allows creating malformed actions
+        void writeBulkArray(const std::vector<uint32_t>& values)
+        {
+            collection.write(reinterpret_cast<const std::byte*>(values.data()), static_cast<uint32_t>(values.size() * sizeof(uint32_t)));
+        }
+
         SceneActionCollection collection;
         SceneActionCollectionCreator creator;
+        Scene scene;
     };
 
     TEST_F(ASceneActionCollectionCreatorAndApplier, createsExpectedNumberAndTypeOfActions)
@@ -36,4 +45,181 @@ namespace ramses::internal
         EXPECT_EQ(ESceneActionId::AllocateRenderState, collection[1].type());
     }
 
+    TEST_F(ASceneActionCollectionCreatorAndApplier, appliesBulkAllocationOfNodesAndTransforms)
+    {
+        const std::array nodes{ NodeHandle(1u), NodeHandle(2u) };
+        const std::array childCounts{ 1u, 0u };
+        const std::array children{ NodeHandle(2u) };
+        const std::array transforms{ TransformHandle(3u) };
+        creator.allocateNodesBulk(2u, nodes.data(), childCounts.data(), children.data());
+        creator.allocateTransformsBulk(1u, transforms.data(), &nodes[1]);
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        ASSERT_TRUE(scene.isNodeAllocated(nodes[0]));
+        ASSERT_TRUE(scene.isNodeAllocated(nodes[1]));
+        EXPECT_EQ(nodes[0], scene.getParent(nodes[1]));
+        ASSERT_TRUE(scene.isTransformAllocated(transforms[0]));
+        EXPECT_EQ(nodes[1], scene.getTransformNode(transforms[0]));
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresBulkNodeAllocationWithArraysNotMatchingCount)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::AllocateNodesBulk);
+        collection.write(2u);
+        writeBulkArray({ 1u });
+        writeBulkArray({ 0u, 0u });
+        writeBulkArray({});
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(0u, scene.getNodeCount());
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresBulkNodeAllocationWithChildCountsNotMatchingChildren)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::AllocateNodesBulk);
+        collection.write(2u);
+        writeBulkArray({ 1u, 2u });
+        writeBulkArray({ 2u, 0u });
+        writeBulkArray({ 2u });
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(0u, scene.getNodeCount());
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresBulkNodeAllocationWithArrayNotMadeOfHandles)
+    {
+        const std::array<std::byte, 3u> truncatedHandle{};
+        collection.beginWriteSceneAction(ESceneActionId::AllocateNodesBulk);
+        collection.write(1u);
+        collection.write(truncatedHandle.data(), static_cast<uint32_t>(truncatedHandle.size()));
+        writeBulkArray({ 0u });
+        writeBulkArray({});
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(0u, scene.getNodeCount());
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresBulkTransformAllocationWithArraysNotMatchingCount)
+    {
+        creator.allocateNode(0u, NodeHandle(1u));
+        collection.beginWriteSceneAction(ESceneActionId::AllocateTransformsBulk);
+        collection.write(2u);
+        writeBulkArray({ 3u, 4u });
+        writeBulkArray({ 1u });
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_TRUE(scene.isNodeAllocated(NodeHandle(1u)));
+        EXPECT_EQ(0u, scene.getTransformCount());
+    }
+
+    class ASceneActionCollectionCreatorAndApplierWithDataInstance : public ASceneActionCollectionCreatorAndApplier
+    {
+    public:
+        ASceneActionCollectionCreatorAndApplierWithDataInstance()
+        {
+            const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Float, 2u } }, ResourceContentHash::Invalid(), {});
+            dataInstance = scene.allocateDataInstance(layout, {});
+            scene.setDataFloatArray(dataInstance, field, 2u, initialValues.data());
+        }
+
+        void expectInitialValues() const
+        {
+            const float* values = scene.getDataFloatArray(dataInstance, field);
+            EXPECT_FLOAT_EQ(initialValues[0], values[0]);
+            EXPECT_FLOAT_EQ(initialValues[1], values[1]);
+        }
+
+        const DataFieldHandle field{ 0u };
+        const std::array<float, 2u> initialValues{ 1.f, 2.f };
+        DataInstanceHandle dataInstance;
+    };
+
+    TEST_F(ASceneActionCollectionCreatorAndApplierWithDataInstance, appliesRunOfDataArrayActions)
+    {
+        const std::array values1{ 3.f, 4.f };
+        const std::array values2{ 5.f };
+        creator.setDataFloatArray(dataInstance, field, 2u, values1.data());
+        creator.setDataFloatArray(dataInstance, field, 1u, values2.data());
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        const float* values = scene.getDataFloatArray(dataInstance, field);
+        EXPECT_FLOAT_EQ(5.f, values[0]);
+        EXPECT_FLOAT_EQ(4.f, values[1]);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplierWithDataInstance, ignoresDataArrayActionWithMoreElementsThanField)
+    {
+        const std::array values{ 3.f, 4.f, 5.f, 6.f };
+        creator.setDataFloatArray(dataInstance, field, 4u, values.data());
+        creator.setDataFloatArray(dataInstance, field, 4u, values.data());
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        expectInitialValues();
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplierWithDataInstance, ignoresDataArrayActionWithSizeNotMatchingElementCount)
+    {
+        collection.beginWriteSceneAction(ESceneActionId::SetDataFloatArray);
+        collection.write(dataInstance);
+        collection.write(field);
+        collection.write(2u);
+        collection.write(3.f);
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        expectInitialValues();
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplierWithDataInstance, ignoresDataArrayActionForUnknownDataInstanceOrField)
+    {
+        const std::array values{ 3.f, 4.f };
+        creator.setDataFloatArray(DataInstanceHandle{ dataInstance.asMemoryHandle() + 1u }, field, 2u, values.data());
+        creator.setDataFloatArray(dataInstance, DataFieldHandle{ 1u }, 2u, values.data());
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        expectInitialValues();
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, appliesRenderableLevelsOfDetail)
+    {
+        const RenderableHandle renderable = scene.allocateRenderable(scene.allocateNode(0u, {}), {});
+        RenderableLevelsOfDetail levelsOfDetail;
+        levelsOfDetail.count = 2u;
+        levelsOfDetail.levels[0] = { 0u, 30u, 0.5f };
+        levelsOfDetail.levels[1] = { 30u, 9u, 0.f };
+        creator.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(levelsOfDetail, scene.getRenderable(renderable).levelsOfDetail);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresRenderableLevelsOfDetailExceedingMaximumCount)
+    {
+        const RenderableHandle renderable = scene.allocateRenderable(scene.allocateNode(0u, {}), {});
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableLevelsOfDetail);
+        collection.write(renderable);
+        collection.write(MaxRenderableLevelsOfDetail + 1u);
+        for (uint32_t i = 0u; i < MaxRenderableLevelsOfDetail + 1u; ++i)
+        {
+            collection.write(0u);
+            collection.write(3u);
+            collection.write(0.f);
+        }
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(0u, scene.getRenderable(renderable).levelsOfDetail.count);
+    }
+
+    TEST_F(ASceneActionCollectionCreatorAndApplier, ignoresRenderableLevelsOfDetailWithCountNotMatchingContent)
+    {
+        const RenderableHandle renderable = scene.allocateRenderable(scene.allocateNode(0u, {}), {});
+        collection.beginWriteSceneAction(ESceneActionId::SetRenderableLevelsOfDetail);
+        collection.write(renderable);
+        collection.write(2u);
+        collection.write(0u);
+        collection.write(3u);
+        collection.write(0.f);
+
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+        EXPECT_EQ(0u, scene.getRenderable(renderable).levelsOfDetail.count);
+    }
 }
@@ -0,0 +1,191 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneActionDeltaEncoder.h"
+#include "internal/SceneGraph/Scene/SceneActionCollectionCreator.h"
+#include "internal/SceneGraph/SceneAPI/Handles.h"
+#include <gtest/gtest.h>
+#include <array>
+
+namespace ramses::internal
+{
+    class ASceneActionDeltaEncoder : public ::testing::Test
+    {
+    public:
+        // encodes and decodes a flush, expects the decoded actions to be the original ones
+        void expectRoundTrip(const SceneActionCollection& actions, SceneActionCollection& encoded)
+        {
+            ASSERT_TRUE(encoder.encode(actions, encoded));
+            EXPECT_EQ(actions.numberOfActions(), encoded.numberOfActions());
+            SceneActionCollection decoded = encoded.copy();
+            EXPECT_TRUE(decoder.decode(decoded));
+            EXPECT_EQ(actions, decoded);
+        }
+
+        SceneActionDeltaEncoder encoder;
+        SceneActionDeltaDecoder decoder;
+    };
+
+    TEST_F(ASceneActionDeltaEncoder, doesNotEncodeActionsWithoutSupportedSetter)
+    {
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+        creator.allocateNode(0u, NodeHandle{ 1u });
+        const std::array<bool, 2u> values{ true, false };
+        creator.setDataBooleanArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 2u, values.data());
+
+        SceneActionCollection encoded;
+        EXPECT_FALSE(encoder.encode(actions, encoded));
+        EXPECT_TRUE(encoded.empty());
+
+        // nothing to decode, collection kept as it is
+        SceneActionCollection decoded = actions.copy();
+        EXPECT_TRUE(decoder.decode(decoded));
+        EXPECT_EQ(actions, decoded);
+    }
+
+    TEST_F(ASceneActionDeltaEncoder, restoresOriginalSettersOverMultipleFlushes)
+    {
+        std::array<glm::mat4, 2u> matrices{ glm::mat4(1.f), glm::mat4(2.f) };
+        for (uint32_t flush = 0u; flush < 5u; ++flush)
+        {
+            SceneActionCollection actions;
+            SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+            const auto f = static_cast<float>(flush);
+            creator.allocateNode(0u, NodeHandle{ flush });
+            creator.setTranslation(TransformHandle{ 1u }, { 1.f + f * 0.01f, 2.f, -3.f });
+            creator.setRotation(TransformHandle{ 1u }, { 0.f, 90.f + f, 0.f, 1.f }, ERotationType::Euler_XYZ);
+            creator.setScaling(TransformHandle{ 1u }, { 1.f, 1.f, 1.f });
+            matrices[1][3][0] = f;
+            creator.setDataMatrix44fArray(DataInstanceHandle{ 2u }, DataFieldHandle{ 1u }, 2u, matrices.data());
+            const std::array<int32_t, 3u> ints{ 1, static_cast<int32_t>(flush) * 1000, -1 };
+            creator.setDataIntegerArray(DataInstanceHandle{ 2u }, DataFieldHandle{ 2u }, 3u, ints.data());
+            const glm::vec4 color{ 1.f, 0.5f, f, 1.f };
+            creator.setDataVector4fArray(DataInstanceHandle{ 3u }, DataFieldHandle{ 0u }, 1u, &color);
+
+            SceneActionCollection encoded;
+            expectRoundTrip(actions, encoded);
+            EXPECT_EQ(ESceneActionId::AllocateNode, encoded[0].type());
+            for (uint32_t i = 1u; i < encoded.numberOfActions(); ++i)
+                EXPECT_EQ(ESceneActionId::SetValueDeltaEncoded, encoded[i].type());
+        }
+    }
+
+    TEST_F(ASceneActionDeltaEncoder, sendsOnlyChangedPartOfMatrixAfterFirstFlush)
+    {
+        glm::mat4 matrix(1.f);
+        matrix[3] = glm::vec4{ 10.f, 20.f, 30.f, 1.f };
+        SceneActionCollection full;
+        SceneActionCollectionCreator(full, EFeatureLevel_Latest).setDataMatrix44fArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &matrix);
+        SceneActionCollection encodedFull;
+        expectRoundTrip(full, encodedFull);
+
+        matrix[3][0] = 10.5f;
+        SceneActionCollection update;
+        SceneActionCollectionCreator(update, EFeatureLevel_Latest).setDataMatrix44fArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &matrix);
+        SceneActionCollection encodedUpdate;
+        expectRoundTrip(update, encodedUpdate);
+
+        // type, flags, header, 2 bytes mask, 1 descriptor and at most 4 bytes of the single changed word
+        EXPECT_LE(encodedUpdate.collectionData().size(), 2u + 12u + 2u + 1u + 4u);
+        EXPECT_LT(encodedUpdate.collectionData().size(), encodedFull.collectionData().size());
+        EXPECT_LT(encodedFull.collectionData().size(), full.collectionData().size());
+    }
+
+    TEST_F(ASceneActionDeltaEncoder, encodesKeyframeAfterResetAndWhenElementCountChanges)
+    {
+        const std::array<float, 3u> values{ 1.f, 2.f, 3.f };
+        const auto createActions = [&](uint32_t count) {
+            SceneActionCollection actions;
+            SceneActionCollectionCreator(actions, EFeatureLevel_Latest).setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, count, values.data());
+            return actions;
+        };
+
+        SceneActionCollection encoded;
+        expectRoundTrip(createActions(2u), encoded);
+        expectRoundTrip(createActions(3u), encoded);
+
+        // decoder which did not see previous actions can decode keyframe
+        encoder.reset();
+        decoder = SceneActionDeltaDecoder{};
+        expectRoundTrip(createActions(3u), encoded);
+        expectRoundTrip(createActions(3u), encoded);
+    }
+
+    TEST_F(ASceneActionDeltaEncoder, failsToDecodeDeltaWithoutReferenceValue)
+    {
+        const float value = 1.f;
+        SceneActionCollection actions;
+        SceneActionCollectionCreator(actions, EFeatureLevel_Latest).setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &value);
+
+        SceneActionCollection encoded;
+        ASSERT_TRUE(encoder.encode(actions, encoded));
+        ASSERT_TRUE(encoder.encode(actions, encoded));
+
+        // second encoding refers to first one which this decoder never got
+        EXPECT_FALSE(decoder.decode(encoded));
+        EXPECT_TRUE(encoded.empty());
+    }
+
+    TEST_F(ASceneActionDeltaEncoder, failsToDecodeTruncatedAction)
+    {
+        const glm::vec3 translation{ 1.f, 2.f, 3.f };
+        SceneActionCollection actions;
+        SceneActionCollectionCreator(actions, EFeatureLevel_Latest).setTranslation(TransformHandle{ 1u }, translation);
+
+        SceneActionCollection encoded;
+        ASSERT_TRUE(encoder.encode(actions, encoded));
+        SceneActionCollection truncated;
+        truncated.addRawSceneActionInformation(ESceneActionId::SetValueDeltaEncoded, 0u);
+        truncated.appendRawData(encoded.collectionData().data(), encoded.collectionData().size() - 1u);
+
+        EXPECT_FALSE(decoder.decode(truncated));
+        EXPECT_TRUE(truncated.empty());
+    }
+
+    TEST(ASceneActionDeltaEncoderWithQuantization, roundsTransformValuesButKeepsDataValuesExact)
+    {
+        SceneActionDeltaEncoder encoder(8u);
+        SceneActionDeltaDecoder decoder;
+
+        const glm::vec3 translation{ 1.2345678f, -100.12345f, 0.f };
+        const float dataValue = 1.2345678f;
+        SceneActionCollection actions;
+        SceneActionCollectionCreator creator(actions, EFeatureLevel_Latest);
+        creator.setTranslation(TransformHandle{ 1u }, translation);
+        creator.setDataFloatArray(DataInstanceHandle{ 1u }, DataFieldHandle{ 0u }, 1u, &dataValue);
+
+        SceneActionCollection encoded;
+        ASSERT_TRUE(encoder.encode(actions, encoded));
+        ASSERT_TRUE(decoder.decode(encoded));
+        ASSERT_EQ(2u, encoded.numberOfActions());
+
+        auto translationAction = encoded[0];
+        EXPECT_EQ(ESceneActionId::SetTranslation, translationAction.type());
+        TransformHandle transform;
+        glm::vec3 decodedTranslation;
+        translationAction.read(transform);
+        translationAction.read(decodedTranslation);
+        EXPECT_EQ(TransformHandle{ 1u }, transform);
+        EXPECT_NE(translation, decodedTranslation);
+        for (glm::length_t i = 0; i < 3; ++i)
+            EXPECT_NEAR(translation[i], decodedTranslation[i], std::abs(translation[i]) * 1e-4f);
+
+        auto dataAction = encoded[1];
+        EXPECT_EQ(ESceneActionId::SetDataFloatArray, dataAction.type());
+        DataInstanceHandle dataInstance;
+        DataFieldHandle field;
+        std::array<float, 1u> decodedData{};
+        uint32_t count = 0u;
+        dataAction.read(dataInstance);
+        dataAction.read(field);
+        dataAction.read(decodedData.data(), count);
+        EXPECT_EQ(1u, count);
+        EXPECT_EQ(dataValue, decodedData[0]);
+    }
+}
@@ -14,6 +14,8 @@
 #include "internal/SceneGraph/Scene/SceneActionApplier.h"
 #include "internal/SceneGraph/Resource/IResource.h"
 
+#include <array>
+
 using namespace testing;
 
 namespace ramses::internal
@@ -46,6 +48,10 @@ namespace ramses::internal
         MOCK_METHOD(void , setRenderStateColorWriteMask, (RenderStateHandle, ColorWriteMask), (override));
 
         MOCK_METHOD(TextureSamplerHandle, allocateTextureSampler, (const TextureSampler& sampler, TextureSamplerHandle handle), (override));
+
+        MOCK_METHOD(void, setTranslation, (TransformHandle, const glm::vec3&), (override));
+        MOCK_METHOD(void, setRotation, (TransformHandle, const glm::vec4&, ERotationType), (override));
+        MOCK_METHOD(void, setScaling, (TransformHandle, const glm::vec3&), (override));
     };
 
     class ASceneActionCreatorAndApplier : public ::testing::Test
@@ -214,4 +220,82 @@ namespace ramses::internal
 
         SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
     }
+
+    TEST_F(ASceneActionCreatorAndApplier, CanSerializeBulkTransformsWithAllComponents)
+    {
+        const std::array<TransformHandle, 2u> transforms{ TransformHandle{ 3u }, TransformHandle{ 7u } };
+        const std::array<glm::vec3, 2u> translations{ glm::vec3{ 1.f, 2.f, 3.f }, glm::vec3{ 4.f, 5.f, 6.f } };
+        const std::array<glm::vec4, 2u> rotations{ glm::vec4{ .1f, .2f, .3f, .4f }, glm::vec4{ .5f, .6f, .7f, .8f } };
+        const std::array<glm::vec3, 2u> scalings{ glm::vec3{ 7.f, 8.f, 9.f }, glm::vec3{ 10.f, 11.f, 12.f } };
+
+        creator.setTransformsBulk(2u, transforms.data(), translations.data(), rotations.data(), scalings.data());
+        ASSERT_EQ(1u, collection.numberOfActions());
+        EXPECT_EQ(ESceneActionId::SetTransformsBulk, collection[0].type());
+
+        InSequence seq;
+        for (size_t i = 0u; i < transforms.size(); ++i)
+        {
+            EXPECT_CALL(scene, setTranslation(transforms[i], translations[i]));
+            EXPECT_CALL(scene, setRotation(transforms[i], rotations[i], ERotationType::Quaternion));
+            EXPECT_CALL(scene, setScaling(transforms[i], scalings[i]));
+        }
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+    }
+
+    TEST_F(ASceneActionCreatorAndApplier, CanSerializeBulkTransformsWithOnlySomeComponents)
+    {
+        const std::array<TransformHandle, 2u> transforms{ TransformHandle{ 3u }, TransformHandle{ 7u } };
+        const std::array<glm::vec3, 2u> scalings{ glm::vec3{ 7.f, 8.f, 9.f }, glm::vec3{ 10.f, 11.f, 12.f } };
+
+        creator.setTransformsBulk(2u, transforms.data(), nullptr, nullptr, scalings.data());
+        const size_t expectedSize{ sizeof(uint32_t) + sizeof(uint8_t) + 2u * (sizeof(TransformHandle) + sizeof(glm::vec3)) };
+        EXPECT_EQ(expectedSize, collection.collectionData().size());
+
+        EXPECT_CALL(scene, setScaling(transforms[0], scalings[0]));
+        EXPECT_CALL(scene, setScaling(transforms[1], scalings[1]));
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+    }
+
+    TEST_F(ASceneActionCreatorAndApplier, AppliesRunsOfSameTransformSetterInOrder)
+    {
+        const TransformHandle t1{ 1u };
+        const TransformHandle t2{ 2u };
+        creator.setTranslation(t1, { 1.f, 2.f, 3.f });
+        creator.setTranslation(t2, { 4.f, 5.f, 6.f });
+        creator.setRotation(t1, { .1f, .2f, .3f, .4f }, ERotationType::Quaternion);
+        creator.setRotation(t2, { 10.f, 20.f, 30.f, 1.f }, ERotationType::Euler_XYZ);
+        creator.setTranslation(t1, { 7.f, 8.f, 9.f });
+        creator.setScaling(t2, { 2.f, 2.f, 2.f });
+
+        InSequence seq;
+        EXPECT_CALL(scene, setTranslation(t1, glm::vec3{ 1.f, 2.f, 3.f }));
+        EXPECT_CALL(scene, setTranslation(t2, glm::vec3{ 4.f, 5.f, 6.f }));
+        EXPECT_CALL(scene, setRotation(t1, glm::vec4{ .1f, .2f, .3f, .4f }, ERotationType::Quaternion));
+        EXPECT_CALL(scene, setRotation(t2, glm::vec4{ 10.f, 20.f, 30.f, 1.f }, ERotationType::Euler_XYZ));
+        EXPECT_CALL(scene, setTranslation(t1, glm::vec3{ 7.f, 8.f, 9.f }));
+        EXPECT_CALL(scene, setScaling(t2, glm::vec3{ 2.f, 2.f, 2.f }));
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+    }
+
+    TEST_F(ASceneActionCreatorAndApplier, AppliesRunsOfDataArraySetters)
+    {
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F, 2u }, DataFieldInfo{ EDataType::Float, 1u } }, ResourceContentHash::Invalid(), {});
+        const DataInstanceHandle instance1 = scene.allocateDataInstance(layout, {});
+        const DataInstanceHandle instance2 = scene.allocateDataInstance(layout, {});
+
+        const std::array<glm::vec4, 2u> vectors1{ glm::vec4{ 1.f, 2.f, 3.f, 4.f }, glm::vec4{ 5.f, 6.f, 7.f, 8.f } };
+        const std::array<glm::vec4, 2u> vectors2{ glm::vec4{ -1.f, -2.f, -3.f, -4.f }, glm::vec4{ -5.f, -6.f, -7.f, -8.f } };
+        const float value = 42.f;
+        creator.setDataVector4fArray(instance1, DataFieldHandle{ 0u }, 2u, vectors1.data());
+        creator.setDataVector4fArray(instance2, DataFieldHandle{ 0u }, 2u, vectors2.data());
+        creator.setDataFloatArray(instance2, DataFieldHandle{ 1u }, 1u, &value);
+        SceneActionApplier::ApplyActionsOnScene(scene, collection, EFeatureLevel_Latest);
+
+        for (size_t i = 0u; i < 2u; ++i)
+        {
+            EXPECT_EQ(vectors1[i], scene.getDataVector4fArray(instance1, DataFieldHandle{ 0u })[i]);
+            EXPECT_EQ(vectors2[i], scene.getDataVector4fArray(instance2, DataFieldHandle{ 0u })[i]);
+        }
+        EXPECT_EQ(value, scene.getDataSingleFloat(instance2, DataFieldHandle{ 1u }));
+    }
 }
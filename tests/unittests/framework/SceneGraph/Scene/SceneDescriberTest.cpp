@@ -404,4 +404,54 @@ namespace ramses::internal
         ExpectSetBlitPassRenderOrderAction(actions[actionIdx++], blitPassHandle, renderOrder);
         ExpectSetBlitPassEnabledAction(actions[actionIdx++], blitPassHandle, blitPassEnabled);
     }
+
+    TEST_F(SceneDescriberTest, describesTopologyAndTransformationsWithBulkActions)
+    {
+        const NodeHandle parent = m_scene.allocateNode(0, {});
+        const NodeHandle child1 = m_scene.allocateNode(0, {});
+        const NodeHandle child2 = m_scene.allocateNode(0, {});
+        const NodeHandle unused = m_scene.allocateNode(0, {});
+        const NodeHandle grandChild = m_scene.allocateNode(0, {});
+        m_scene.releaseNode(unused);
+        m_scene.addChildToNode(parent, child2);
+        m_scene.addChildToNode(parent, child1);
+        m_scene.addChildToNode(child1, grandChild);
+
+        const TransformHandle transform1 = m_scene.allocateTransform(child1, {});
+        const TransformHandle transform2 = m_scene.allocateTransform(child2, {});
+        const TransformHandle transform3 = m_scene.allocateTransform(grandChild, {});
+        m_scene.setTranslation(transform1, { 1.f, 2.f, 3.f });
+        m_scene.setRotation(transform1, { 0.f, 0.f, 0.5f, 0.5f }, ERotationType::Quaternion);
+        m_scene.setRotation(transform2, { 10.f, 20.f, 30.f, 1.f }, ERotationType::Euler_ZYX);
+        m_scene.setScaling(transform3, { 2.f, 2.f, 2.f });
+
+        SceneDescriber::describeScene<IScene>(m_scene, creator, true);
+
+        // nodes, transforms, translations, rotation (euler), rotations (quaternion), scalings
+        ASSERT_EQ(6u, actions.numberOfActions());
+        EXPECT_EQ(ESceneActionId::AllocateNodesBulk, actions[0].type());
+        EXPECT_EQ(ESceneActionId::AllocateTransformsBulk, actions[1].type());
+
+        Scene newScene;
+        SceneActionApplier::ApplyActionsOnScene(newScene, actions, EFeatureLevel_Latest);
+
+        EXPECT_TRUE(newScene.isNodeAllocated(grandChild));
+        EXPECT_FALSE(newScene.isNodeAllocated(unused));
+        ASSERT_EQ(2u, newScene.getChildCount(parent));
+        EXPECT_EQ(child2, newScene.getChild(parent, 0u));
+        EXPECT_EQ(child1, newScene.getChild(parent, 1u));
+        EXPECT_EQ(grandChild, newScene.getChild(child1, 0u));
+        EXPECT_EQ(parent, newScene.getParent(child1));
+
+        EXPECT_EQ(child1, newScene.getTransformNode(transform1));
+        EXPECT_EQ(child2, newScene.getTransformNode(transform2));
+        EXPECT_EQ(grandChild, newScene.getTransformNode(transform3));
+        EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), newScene.getTranslation(transform1));
+        EXPECT_EQ(glm::vec4(0.f, 0.f, 0.5f, 0.5f), newScene.getRotation(transform1));
+        EXPECT_EQ(ERotationType::Quaternion, newScene.getRotationType(transform1));
+        EXPECT_EQ(glm::vec4(10.f, 20.f, 30.f, 1.f), newScene.getRotation(transform2));
+        EXPECT_EQ(ERotationType::Euler_ZYX, newScene.getRotationType(transform2));
+        EXPECT_EQ(glm::vec3(2.f, 2.f, 2.f), newScene.getScaling(transform3));
+        EXPECT_EQ(IScene::IdentityScaling, newScene.getScaling(transform1));
+    }
 }
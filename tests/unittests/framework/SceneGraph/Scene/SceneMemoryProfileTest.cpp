@@ -0,0 +1,88 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/SceneGraph/Scene/SceneMemoryProfile.h"
+#include "internal/SceneGraph/Scene/Scene.h"
+#include "internal/SceneGraph/Scene/SceneActionCollection.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    class ASceneMemoryProfile : public ::testing::Test
+    {
+    protected:
+        const SceneMemoryProfileEntry& getEntry(std::string_view name)
+        {
+            const auto it = std::find_if(m_profile.cbegin(), m_profile.cend(), [name](const auto& entry) { return entry.name == name; });
+            EXPECT_NE(m_profile.cend(), it);
+            return *it;
+        }
+
+        Scene m_scene;
+        SceneMemoryProfile m_profile;
+    };
+
+    TEST_F(ASceneMemoryProfile, reportsAllocatedObjectsAsUsedAndPreallocatedAsCapacity)
+    {
+        SceneSizeInformation sizeInfo;
+        sizeInfo.nodeCount = 10u;
+        m_scene.preallocateSceneSize(sizeInfo);
+        m_scene.allocateNode(0u, {});
+        m_scene.allocateNode(0u, {});
+
+        SceneMemoryProfileUtils::AddScenePools(m_scene, "", m_profile);
+        const auto& nodes = getEntry("Nodes");
+        EXPECT_EQ(2u, nodes.usedCount);
+        EXPECT_EQ(10u, nodes.capacityCount);
+        EXPECT_EQ(2u * sizeof(TopologyNode), nodes.usedBytes);
+        EXPECT_EQ(10u * sizeof(TopologyNode), nodes.capacityBytes);
+    }
+
+    TEST_F(ASceneMemoryProfile, reportsDynamicContentOfObjects)
+    {
+        const auto dataBuffer = m_scene.allocateDataBuffer(EDataBufferType::IndexBuffer, EDataType::UInt16, 100u, {});
+        m_scene.updateDataBuffer(dataBuffer, 0u, 10u, std::vector<std::byte>(10u).data());
+
+        SceneMemoryProfileUtils::AddScenePools(m_scene, "prefix.", m_profile);
+        const auto& dataBuffers = getEntry("prefix.DataBuffers");
+        EXPECT_EQ(1u, dataBuffers.usedCount);
+        EXPECT_EQ(sizeof(GeometryDataBuffer) + 100u, dataBuffers.usedBytes);
+        EXPECT_LE(dataBuffers.usedBytes, dataBuffers.capacityBytes);
+    }
+
+    TEST_F(ASceneMemoryProfile, reportsReservedMemoryOfSceneActions)
+    {
+        SceneActionCollection actions(1000u, 10u);
+        actions.beginWriteSceneAction(ESceneActionId::TestAction);
+        actions.write(uint32_t{ 1u });
+
+        SceneMemoryProfileUtils::AddSceneActions(actions, "actions", m_profile);
+        const auto& entry = getEntry("actions");
+        EXPECT_EQ(1u, entry.usedCount);
+        EXPECT_EQ(actions.getUsedMemorySize(), entry.usedBytes);
+        EXPECT_EQ(actions.getReservedMemorySize(), entry.capacityBytes);
+        EXPECT_LT(entry.usedBytes, entry.capacityBytes);
+        EXPECT_LE(1000u, entry.capacityBytes);
+
+        actions.clear();
+        EXPECT_EQ(0u, actions.getUsedMemorySize());
+        EXPECT_EQ(entry.capacityBytes, actions.getReservedMemorySize());
+    }
+
+    TEST_F(ASceneMemoryProfile, sumsUpAllEntriesInTotal)
+    {
+        m_profile.push_back({ "a", 1u, 2u, 10u, 20u });
+        m_profile.push_back({ "b", 3u, 4u, 30u, 40u });
+        const auto total = SceneMemoryProfileUtils::GetTotal(m_profile);
+        EXPECT_EQ(4u, total.usedCount);
+        EXPECT_EQ(6u, total.capacityCount);
+        EXPECT_EQ(40u, total.usedBytes);
+        EXPECT_EQ(60u, total.capacityBytes);
+    }
+}
@@ -77,4 +77,21 @@ namespace ramses::internal
         auto returnedHandle = mapping.getMapping(handle);
         EXPECT_FALSE(returnedHandle.isValid());
     }
+
+    TEST(ASceneMergeHandleMapping, keepsMappingsOfHandlesAddedInAnyOrder)
+    {
+        SceneMergeHandleMapping mapping;
+        SceneSizeInformation sizeInfo;
+        sizeInfo.nodeCount = 10u;
+        mapping.reserve(sizeInfo);
+
+        mapping.addMapping(NodeHandle{ 20u }, NodeHandle{ 120u });
+        mapping.addMapping(NodeHandle{ 3u }, NodeHandle{ 103u });
+
+        EXPECT_EQ(NodeHandle{ 120u }, mapping.getMapping(NodeHandle{ 20u }));
+        EXPECT_EQ(NodeHandle{ 103u }, mapping.getMapping(NodeHandle{ 3u }));
+        EXPECT_FALSE(mapping.hasMapping(NodeHandle{ 4u }));
+        EXPECT_FALSE(mapping.getMapping(NodeHandle{ 21u }).isValid());
+        EXPECT_FALSE(mapping.hasMapping(TransformHandle{ 3u }));
+    }
 }
@@ -20,7 +20,9 @@ namespace ramses::internal
 {
     using SceneTypes = ::testing::Types<
         Scene,
+        SceneWithDenseMemory,
         TransformationCachedScene,
+        TransformationCachedSceneWithDenseMemory,
         ActionCollectingScene,
         ResourceChangeCollectingScene,
         DataLayoutCachedScene,
@@ -79,4 +79,28 @@ namespace ramses::internal
         EXPECT_EQ(std::byte{0xAB}, this->m_scene.getDataBuffer(dataBuffer).data[2]);
         EXPECT_EQ(std::byte{0x3D}, this->m_scene.getDataBuffer(dataBuffer).data[3]); //stays same
     }
+
+    TYPED_TEST(AScene, UpdateOfDataBufferDoesNotDecreaseItsUsedSize)
+    {
+        const DataBufferHandle dataBuffer = this->m_scene.allocateDataBuffer(EDataBufferType::IndexBuffer, EDataType::UInt32, 10u, {});
+        EXPECT_EQ(0u, this->m_scene.getDataBuffer(dataBuffer).usedSize);
+        this->m_scene.updateDataBuffer(dataBuffer, 0u, 4u, make_byte_array(0x0A, 0x1B, 0x2C, 0x3D).data());
+        EXPECT_EQ(4u, this->m_scene.getDataBuffer(dataBuffer).usedSize);
+        this->m_scene.updateDataBuffer(dataBuffer, 0u, 2u, make_byte_array(0x77, 0xAB).data());
+        EXPECT_EQ(4u, this->m_scene.getDataBuffer(dataBuffer).usedSize);
+    }
+
+    TYPED_TEST(AScene, CanSetUsedSizeOfDataBuffer)
+    {
+        const DataBufferHandle dataBuffer = this->m_scene.allocateDataBuffer(EDataBufferType::IndexBuffer, EDataType::UInt32, 10u, {});
+        this->m_scene.updateDataBuffer(dataBuffer, 0u, 4u, make_byte_array(0x0A, 0x1B, 0x2C, 0x3D).data());
+        this->m_scene.setDataBufferUsedSize(dataBuffer, 2u);
+        EXPECT_EQ(2u, this->m_scene.getDataBuffer(dataBuffer).usedSize);
+        EXPECT_EQ(std::byte{0x0A}, this->m_scene.getDataBuffer(dataBuffer).data[0]);
+        EXPECT_EQ(std::byte{0x1B}, this->m_scene.getDataBuffer(dataBuffer).data[1]);
+        EXPECT_EQ(10u, this->m_scene.getDataBuffer(dataBuffer).data.size());
+
+        this->m_scene.setDataBufferUsedSize(dataBuffer, 0u);
+        EXPECT_EQ(0u, this->m_scene.getDataBuffer(dataBuffer).usedSize);
+    }
 }
@@ -178,6 +178,28 @@ namespace ramses::internal
         EXPECT_EQ(1u, this->m_scene.getDataInstanceCount());
     }
 
+    TYPED_TEST(AScene, DataInstanceHasUnboundedUniformTimeAnimationByDefault)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Int32, 1u, EFixedSemantics::TimeMs) }, ResourceContentHash(123u, 0u), {});
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout, {});
+
+        EXPECT_EQ(DataInstance::UnboundedUniformTimeAnimationEnd, this->m_scene.getDataInstanceUniformTimeAnimationEnd(instance));
+    }
+
+    TYPED_TEST(AScene, CanSetUniformTimeAnimationEndOfDataInstance)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Int32, 1u, EFixedSemantics::TimeMs) }, ResourceContentHash(123u, 0u), {});
+        const DataInstanceHandle instance = this->m_scene.allocateDataInstance(dataLayout, {});
+        const DataInstanceHandle otherInstance = this->m_scene.allocateDataInstance(dataLayout, {});
+
+        this->m_scene.setDataInstanceUniformTimeAnimationEnd(instance, 1500);
+        EXPECT_EQ(1500, this->m_scene.getDataInstanceUniformTimeAnimationEnd(instance));
+        EXPECT_EQ(DataInstance::UnboundedUniformTimeAnimationEnd, this->m_scene.getDataInstanceUniformTimeAnimationEnd(otherInstance));
+
+        this->m_scene.setDataInstanceUniformTimeAnimationEnd(instance, 0);
+        EXPECT_EQ(0, this->m_scene.getDataInstanceUniformTimeAnimationEnd(instance));
+    }
+
     TYPED_TEST(AScene, DataInstanceWithFieldWithElementCountGreaterOneReturnsSameValue)
     {
         const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Int32, 4u) }, ResourceContentHash(123u, 0u), {});
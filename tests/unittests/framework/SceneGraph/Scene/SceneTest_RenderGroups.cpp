@@ -141,4 +141,45 @@ namespace ramses::internal
         EXPECT_EQ(renderGroupChild, rg.renderGroups[0].renderGroup);
         EXPECT_EQ(15, rg.renderGroups[0].order);
     }
+
+    TYPED_TEST(AScene, findsRenderableEntriesAfterRemovingEntryInTheMiddle)
+    {
+        const RenderGroupHandle renderGroup = this->m_scene.allocateRenderGroup(0, 0, {});
+        const RenderableHandle renderable1 = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        const RenderableHandle renderable2 = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        const RenderableHandle renderable3 = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        this->m_scene.addRenderableToRenderGroup(renderGroup, renderable1, 1);
+        this->m_scene.addRenderableToRenderGroup(renderGroup, renderable2, 2);
+        this->m_scene.addRenderableToRenderGroup(renderGroup, renderable3, 3);
+
+        this->m_scene.removeRenderableFromRenderGroup(renderGroup, renderable2);
+
+        const RenderGroup& rg = this->m_scene.getRenderGroup(renderGroup);
+        EXPECT_FALSE(RenderGroupUtils::ContainsRenderable(renderable2, rg));
+        EXPECT_EQ(rg.renderables.cend(), RenderGroupUtils::FindRenderableEntry(renderable2, rg));
+        ASSERT_NE(rg.renderables.cend(), RenderGroupUtils::FindRenderableEntry(renderable1, rg));
+        ASSERT_NE(rg.renderables.cend(), RenderGroupUtils::FindRenderableEntry(renderable3, rg));
+        EXPECT_EQ(1, RenderGroupUtils::FindRenderableEntry(renderable1, rg)->order);
+        EXPECT_EQ(3, RenderGroupUtils::FindRenderableEntry(renderable3, rg)->order);
+    }
+
+    TYPED_TEST(AScene, findsRenderGroupEntriesAfterRemovingEntryInTheMiddle)
+    {
+        const RenderGroupHandle renderGroupParent = this->m_scene.allocateRenderGroup(0, 0, {});
+        const RenderGroupHandle renderGroupChild1 = this->m_scene.allocateRenderGroup(0, 0, {});
+        const RenderGroupHandle renderGroupChild2 = this->m_scene.allocateRenderGroup(0, 0, {});
+        const RenderGroupHandle renderGroupChild3 = this->m_scene.allocateRenderGroup(0, 0, {});
+        this->m_scene.addRenderGroupToRenderGroup(renderGroupParent, renderGroupChild1, 1);
+        this->m_scene.addRenderGroupToRenderGroup(renderGroupParent, renderGroupChild2, 2);
+        this->m_scene.addRenderGroupToRenderGroup(renderGroupParent, renderGroupChild3, 3);
+
+        this->m_scene.removeRenderGroupFromRenderGroup(renderGroupParent, renderGroupChild1);
+
+        const RenderGroup& rg = this->m_scene.getRenderGroup(renderGroupParent);
+        EXPECT_FALSE(RenderGroupUtils::ContainsRenderGroup(renderGroupChild1, rg));
+        ASSERT_NE(rg.renderGroups.cend(), RenderGroupUtils::FindRenderGroupEntry(renderGroupChild2, rg));
+        ASSERT_NE(rg.renderGroups.cend(), RenderGroupUtils::FindRenderGroupEntry(renderGroupChild3, rg));
+        EXPECT_EQ(2, RenderGroupUtils::FindRenderGroupEntry(renderGroupChild2, rg)->order);
+        EXPECT_EQ(3, RenderGroupUtils::FindRenderGroupEntry(renderGroupChild3, rg)->order);
+    }
 }
@@ -38,6 +38,9 @@ namespace ramses::internal
         EXPECT_FALSE(rp.renderTarget.isValid());
         EXPECT_EQ(0, rp.renderOrder);
         EXPECT_FALSE(rp.isRenderOnce);
+        EXPECT_FALSE(rp.isStateSorted);
+        EXPECT_FALSE(rp.isFrontToBackSorted);
+        EXPECT_FALSE(rp.hasDepthPrePass);
     }
 
     TYPED_TEST(AScene, RenderPassReleased)
@@ -171,4 +174,40 @@ namespace ramses::internal
         this->m_scene.setRenderPassRenderOnce(pass, false);
         EXPECT_FALSE(this->m_scene.getRenderPass(pass).isRenderOnce);
     }
+
+    TYPED_TEST(AScene, canSetStateSorting)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass(0, {});
+        this->m_scene.setRenderPassStateSorting(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isStateSorted);
+        this->m_scene.setRenderPassStateSorting(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isStateSorted);
+    }
+
+    TYPED_TEST(AScene, canSetFrontToBackSorting)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass(0, {});
+        this->m_scene.setRenderPassFrontToBackSorting(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isFrontToBackSorted);
+        this->m_scene.setRenderPassFrontToBackSorting(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isFrontToBackSorted);
+    }
+
+    TYPED_TEST(AScene, canSetBackToFrontSorting)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass(0, {});
+        this->m_scene.setRenderPassBackToFrontSorting(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).isBackToFrontSorted);
+        this->m_scene.setRenderPassBackToFrontSorting(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).isBackToFrontSorted);
+    }
+
+    TYPED_TEST(AScene, canSetDepthPrePass)
+    {
+        const RenderPassHandle pass = this->m_scene.allocateRenderPass(0, {});
+        this->m_scene.setRenderPassDepthPrePass(pass, true);
+        EXPECT_TRUE(this->m_scene.getRenderPass(pass).hasDepthPrePass);
+        this->m_scene.setRenderPassDepthPrePass(pass, false);
+        EXPECT_FALSE(this->m_scene.getRenderPass(pass).hasDepthPrePass);
+    }
 }
@@ -122,4 +122,39 @@ namespace ramses::internal
         this->m_scene.setRenderableStartVertex(renderable, 132u);
         EXPECT_EQ(132u, this->m_scene.getRenderable(renderable).startVertex);
     }
+
+    TYPED_TEST(AScene, SetsBoundingSphereOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        EXPECT_GT(0.f, this->m_scene.getRenderable(renderable).boundingSphere.w);
+
+        this->m_scene.setRenderableBoundingSphere(renderable, glm::vec4(1.f, 2.f, 3.f, 4.f));
+        EXPECT_EQ(glm::vec4(1.f, 2.f, 3.f, 4.f), this->m_scene.getRenderable(renderable).boundingSphere);
+    }
+
+    TYPED_TEST(AScene, SetsInstancePositionsOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        EXPECT_FALSE(this->m_scene.getRenderable(renderable).instancePositions.isValid());
+
+        const DataBufferHandle instancePositions = this->m_scene.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, 36u, {});
+        this->m_scene.setRenderableInstancePositions(renderable, instancePositions);
+        EXPECT_EQ(instancePositions, this->m_scene.getRenderable(renderable).instancePositions);
+    }
+
+    TYPED_TEST(AScene, SetsLevelsOfDetailOfRenderable)
+    {
+        const RenderableHandle renderable = this->m_scene.allocateRenderable(this->m_scene.allocateNode(0, {}), {});
+        EXPECT_EQ(0u, this->m_scene.getRenderable(renderable).levelsOfDetail.count);
+
+        RenderableLevelsOfDetail levelsOfDetail;
+        levelsOfDetail.levels[0] = { 10u, 6u, 0.3f };
+        levelsOfDetail.levels[1] = { 16u, 3u, 0.1f };
+        levelsOfDetail.count = 2u;
+        this->m_scene.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+        EXPECT_EQ(levelsOfDetail, this->m_scene.getRenderable(renderable).levelsOfDetail);
+
+        this->m_scene.setRenderableLevelsOfDetail(renderable, {});
+        EXPECT_EQ(0u, this->m_scene.getRenderable(renderable).levelsOfDetail.count);
+    }
 }
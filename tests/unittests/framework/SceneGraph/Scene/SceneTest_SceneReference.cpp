@@ -69,6 +69,20 @@ namespace ramses::internal
         EXPECT_EQ(-8, sr.renderOrder);
     }
 
+    TYPED_TEST(AScene, SetsSceneReferencePreload)
+    {
+        constexpr SceneId sceneId{ 123 };
+
+        const auto handle = this->m_scene.allocateSceneReference(sceneId, {});
+        const SceneReference& sr = this->m_scene.getSceneReference(handle);
+        EXPECT_EQ(RendererSceneState::Available, sr.preloadState);
+        EXPECT_EQ(0, sr.preloadPriority);
+
+        this->m_scene.setSceneReferencePreload(handle, RendererSceneState::Ready, -3);
+        EXPECT_EQ(RendererSceneState::Ready, sr.preloadState);
+        EXPECT_EQ(-3, sr.preloadPriority);
+    }
+
     TYPED_TEST(AScene, RequestsSceneReferenceFlushNotifications)
     {
         constexpr SceneId sceneId{ 123 };
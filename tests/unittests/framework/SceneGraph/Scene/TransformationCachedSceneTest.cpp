@@ -49,6 +49,23 @@ namespace ramses::internal
         TransformHandle transform;
     };
 
+    TEST_F(ATransformationCachedScene, GivesMatricesOfMultipleNodesInBulk)
+    {
+        const auto child = this->scene.allocateNode(0, {});
+        this->scene.addChildToNode(this->nodeWithTransform, child);
+        this->scene.setTranslation(this->transform, glm::vec3(1.f, 2.f, 3.f));
+
+        std::vector<glm::mat4> matrices(5u);
+        this->scene.updateMatrixCaches(ETransformationMatrixType_World, { this->nodeWithoutTransform, child, this->nodeWithTransform }, matrices);
+        ASSERT_EQ(3u, matrices.size());
+        expectMatrixFloatEqual(glm::identity<glm::mat4>(), matrices[0]);
+        expectMatrixFloatEqual(glm::translate(glm::vec3(1.f, 2.f, 3.f)), matrices[1]);
+        expectMatrixFloatEqual(glm::translate(glm::vec3(1.f, 2.f, 3.f)), matrices[2]);
+
+        this->scene.updateMatrixCaches(ETransformationMatrixType_World, {}, matrices);
+        EXPECT_TRUE(matrices.empty());
+    }
+
     TEST_F(ATransformationCachedScene, GivesIdentityMatricesForNodesWithoutTransform)
     {
         this->expectIdentityMatrices(this->nodeWithoutTransform);
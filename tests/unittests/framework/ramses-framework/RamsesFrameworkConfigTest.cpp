@@ -210,6 +210,62 @@ namespace ramses::internal
         EXPECT_EQ(std::chrono::milliseconds(9000), frameworkConfig.impl().m_tcpConfig.getAliveTimeout());
     }
 
+    TEST_F(ARamsesFrameworkConfig, CanEnableTCPSceneUpdateCompression)
+    {
+        EXPECT_FALSE(frameworkConfig.impl().m_tcpConfig.getSceneUpdateCompression());
+        frameworkConfig.setSceneUpdateCompressionForTCPCommunication(true);
+        EXPECT_TRUE(frameworkConfig.impl().m_tcpConfig.getSceneUpdateCompression());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetTCPSendQueueLimit)
+    {
+        EXPECT_EQ(0u, frameworkConfig.impl().m_tcpConfig.getSendQueueLimit());
+        frameworkConfig.setSendQueueLimitForTCPCommunication(64u * 1024u * 1024u);
+        EXPECT_EQ(64u * 1024u * 1024u, frameworkConfig.impl().m_tcpConfig.getSendQueueLimit());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetWorkerThreadCount)
+    {
+        EXPECT_EQ(3u, frameworkConfig.impl().getWorkerThreadCount());
+        EXPECT_TRUE(frameworkConfig.setWorkerThreadCount(8u));
+        EXPECT_EQ(8u, frameworkConfig.impl().getWorkerThreadCount());
+        EXPECT_TRUE(frameworkConfig.setWorkerThreadCount(256u));
+        EXPECT_EQ(256u, frameworkConfig.impl().getWorkerThreadCount());
+        EXPECT_FALSE(frameworkConfig.setWorkerThreadCount(0u));
+        EXPECT_FALSE(frameworkConfig.setWorkerThreadCount(257u));
+        EXPECT_EQ(256u, frameworkConfig.impl().getWorkerThreadCount());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetWorkerThreadCpuAffinity)
+    {
+        EXPECT_TRUE(frameworkConfig.impl().getWorkerThreadCpuAffinity().empty());
+        frameworkConfig.setWorkerThreadCpuAffinity({ 1u, 3u });
+        EXPECT_EQ((std::vector<uint32_t>{ 1u, 3u }), frameworkConfig.impl().getWorkerThreadCpuAffinity());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetEffectCompilationCacheFile)
+    {
+        EXPECT_TRUE(frameworkConfig.impl().getEffectCompilationCacheFile().empty());
+        frameworkConfig.setEffectCompilationCacheFile("effects.cache");
+        EXPECT_EQ("effects.cache", frameworkConfig.impl().getEffectCompilationCacheFile());
+    }
+
+    TEST_F(ARamsesFrameworkConfig, CanSetAsynchronousLogging)
+    {
+        EXPECT_FALSE(frameworkConfig.impl().loggerConfig.asyncLogging);
+        EXPECT_TRUE(frameworkConfig.setAsynchronousLogging(true, 128u, true));
+        EXPECT_TRUE(frameworkConfig.impl().loggerConfig.asyncLogging);
+        EXPECT_EQ(128u, frameworkConfig.impl().loggerConfig.asyncLogQueueCapacity);
+        EXPECT_EQ(ELogOverflowPolicy::Drop, frameworkConfig.impl().loggerConfig.asyncLogOverflowPolicy);
+
+        EXPECT_FALSE(frameworkConfig.setAsynchronousLogging(true, 0u, false));
+        EXPECT_EQ(128u, frameworkConfig.impl().loggerConfig.asyncLogQueueCapacity);
+
+        EXPECT_TRUE(frameworkConfig.setAsynchronousLogging(false, 16u, false));
+        EXPECT_FALSE(frameworkConfig.impl().loggerConfig.asyncLogging);
+        EXPECT_EQ(ELogOverflowPolicy::Block, frameworkConfig.impl().loggerConfig.asyncLogOverflowPolicy);
+    }
+
     TEST_F(ARamsesFrameworkConfig, CanSetWatchdogInterval)
     {
         EXPECT_EQ(1000u, frameworkConfig.impl().m_watchdogConfig.getWatchdogNotificationInterval(ERamsesThreadIdentifier::Workers));
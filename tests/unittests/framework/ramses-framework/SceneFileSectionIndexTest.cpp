@@ -0,0 +1,99 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/SceneFileSectionIndex.h"
+#include "internal/Core/Utils/BinaryOutputStream.h"
+#include "internal/Core/Utils/BinaryInputStream.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class ASceneFileSectionIndex : public ::testing::Test
+    {
+    protected:
+        ASceneFileSectionIndex()
+        {
+            // some dummy content the sections refer to
+            for (uint32_t i = 0u; i < 16u; ++i)
+                outStream << i;
+        }
+
+        bool writeAndRead(const SceneFileSectionIndex& index, SceneFileSectionIndex& readIndex)
+        {
+            index.writeToStream(outStream);
+            data = outStream.release();
+            BinaryInputStream inStream(data.data());
+            inStream.seek(4, IInputStream::Seek::FromBeginning);
+            const bool result = SceneFileSectionIndex::ReadFromStream(inStream, data.size(), readIndex);
+
+            // position of stream is unchanged
+            size_t position = 0u;
+            EXPECT_EQ(EStatus::Ok, inStream.getPos(position));
+            EXPECT_EQ(4u, position);
+            return result;
+        }
+
+        BinaryOutputStream outStream;
+        std::vector<std::byte> data;
+    };
+
+    TEST_F(ASceneFileSectionIndex, findsAddedSections)
+    {
+        SceneFileSectionIndex index;
+        index.addSection(ESceneFileSection::LowLevelScene, 8u, 16u);
+        index.addSection(ESceneFileSection::SceneObjectsOfType, 24u, 8u, ERamsesObjectType::Node);
+
+        ASSERT_NE(nullptr, index.findSection(ESceneFileSection::LowLevelScene));
+        EXPECT_EQ(16u, index.findSection(ESceneFileSection::LowLevelScene)->size);
+        ASSERT_NE(nullptr, index.findSection(ESceneFileSection::SceneObjectsOfType, ERamsesObjectType::Node));
+        EXPECT_EQ(24u, index.findSection(ESceneFileSection::SceneObjectsOfType, ERamsesObjectType::Node)->offset);
+        EXPECT_EQ(nullptr, index.findSection(ESceneFileSection::SceneObjectsOfType, ERamsesObjectType::MeshNode));
+        EXPECT_EQ(nullptr, index.findSection(ESceneFileSection::LowLevelResources));
+    }
+
+    TEST_F(ASceneFileSectionIndex, canBeWrittenAndReadBack)
+    {
+        SceneFileSectionIndex index;
+        index.addSection(ESceneFileSection::SceneMetadata, 0u, 8u);
+        index.addSection(ESceneFileSection::LowLevelScene, 8u, 16u);
+        index.addSection(ESceneFileSection::SceneObjectsOfType, 24u, 40u, ERamsesObjectType::LogicEngine);
+        index.addSection(ESceneFileSection::LowLevelResources, 64u, 0u);
+
+        SceneFileSectionIndex readIndex;
+        EXPECT_TRUE(writeAndRead(index, readIndex));
+        EXPECT_EQ(index.getSections(), readIndex.getSections());
+    }
+
+    TEST_F(ASceneFileSectionIndex, canReadEmptyIndex)
+    {
+        SceneFileSectionIndex readIndex;
+        EXPECT_TRUE(writeAndRead({}, readIndex));
+        EXPECT_TRUE(readIndex.getSections().empty());
+    }
+
+    TEST_F(ASceneFileSectionIndex, failsToReadFromDataWithoutIndex)
+    {
+        data = outStream.release();
+        BinaryInputStream inStream(data.data());
+        SceneFileSectionIndex readIndex;
+        readIndex.addSection(ESceneFileSection::LowLevelScene, 0u, 4u);
+        EXPECT_FALSE(SceneFileSectionIndex::ReadFromStream(inStream, data.size(), readIndex));
+        EXPECT_TRUE(readIndex.getSections().empty());
+        EXPECT_FALSE(SceneFileSectionIndex::ReadFromStream(inStream, SceneFileSectionIndex::TrailerSize - 1u, readIndex));
+    }
+
+    TEST_F(ASceneFileSectionIndex, failsToReadIndexWithSectionBeyondIndexStart)
+    {
+        SceneFileSectionIndex index;
+        index.addSection(ESceneFileSection::LowLevelScene, 8u, 100u);
+
+        SceneFileSectionIndex readIndex;
+        EXPECT_FALSE(writeAndRead(index, readIndex));
+        EXPECT_TRUE(readIndex.getSections().empty());
+    }
+}
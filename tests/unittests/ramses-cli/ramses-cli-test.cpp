@@ -326,6 +326,13 @@ namespace ramses::internal
         EXPECT_EQ(0744u, config.impl().getWaylandSocketEmbeddedPermissions());
     }
 
+    TEST_F(ADisplayConfig, cliEcEventThread)
+    {
+        EXPECT_THROW(cli.parse(std::vector<std::string>{"--ec-event-thread"}), CLI::RequiresError);
+        cli.parse(std::vector<std::string>{"--ec-event-thread", "--ec-display=wse"});
+        EXPECT_TRUE(config.impl().isWaylandEmbeddedCompositingEventThreadEnabled());
+    }
+
     TEST_F(ARendererConfig, cliIviControl)
     {
         EXPECT_FALSE(config.impl().getInternalRendererConfig().getSystemCompositorControlEnabled());
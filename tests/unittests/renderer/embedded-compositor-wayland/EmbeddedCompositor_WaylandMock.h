@@ -22,6 +22,7 @@ namespace ramses::internal
     {
     public:
         MOCK_METHOD(void, handleBufferDestroyed, (IWaylandBuffer& buffer), (override));
+        MOCK_METHOD(void, releaseBufferWhenUnusedByGpu, (IWaylandBuffer& buffer), (override));
         MOCK_METHOD(void, addWaylandSurface, (IWaylandSurface& waylandSurface), (override));
         MOCK_METHOD(void, removeWaylandSurface, (IWaylandSurface& waylandSurface), (override));
         MOCK_METHOD(IWaylandBuffer&, getOrCreateBuffer, (WaylandBufferResource& bufferResource), (override));
@@ -155,7 +155,7 @@ namespace ramses::internal
     class AEmbeddedCompositor_Wayland : public TestWithWaylandEnvironment
     {
     public:
-        bool init(const std::string& ecSocketName, const std::string& ecSocketGroup = "", int ecSocketFD = -1, bool xdgRuntimeDirSet = true, uint32_t ecSocketPermissions = 0)
+        bool init(const std::string& ecSocketName, const std::string& ecSocketGroup = "", int ecSocketFD = -1, bool xdgRuntimeDirSet = true, uint32_t ecSocketPermissions = 0, bool eventThread = false)
         {
             if (xdgRuntimeDirSet)
             {
@@ -172,6 +172,7 @@ namespace ramses::internal
             displayConfig.setWaylandEmbeddedCompositingSocketFD(ecSocketFD);
             if (ecSocketPermissions != 0)
                 displayConfig.setWaylandEmbeddedCompositingSocketPermissions(ecSocketPermissions);
+            displayConfig.setWaylandEmbeddedCompositingEventThread(eventThread);
 
             embeddedCompositor = std::make_unique<EmbeddedCompositor_Wayland>(displayConfig, context);
             return embeddedCompositor->init();
@@ -226,6 +227,28 @@ namespace ramses::internal
         EXPECT_TRUE(clientCanConnectViaSocket("wayland-10"));
     }
 
+    TEST_F(AEmbeddedCompositor_Wayland, DispatchesClientRequestsInEventThreadIfEnabled)
+    {
+        EXPECT_TRUE(init("wayland-10", "", -1, true, 0, true));
+        // starts event thread
+        embeddedCompositor->handleRequestsFromClients();
+
+        ConnectToDisplayRunnable client("wayland-10");
+        PlatformThread clientThread("ClientApp");
+        clientThread.start(client);
+
+        // render thread does not handle client requests anymore, roundtrip of client must be answered by event thread
+        for (int i = 0; i < 500 && !client.hasEnded(); ++i)
+            PlatformThread::Sleep(10);
+        EXPECT_TRUE(client.hasEnded());
+
+        embeddedCompositor->stopEventThread();
+        // unblocks client if its roundtrip was not answered
+        embeddedCompositor.reset();
+        clientThread.join();
+        EXPECT_TRUE(client.couldConnectToEmbeddedCompositor());
+    }
+
     TEST_F(AEmbeddedCompositor_Wayland, InitializeWorksWithSocketNameAndGroupSet_ClientConnectionTest)
     {
         WaylandEnvironmentUtils::SetVariable(WaylandEnvironmentVariable::XDGRuntimeDir, m_initialValueOfXdgRuntimeDir);
@@ -712,4 +735,28 @@ namespace ramses::internal
 
         delete &waylandBuffer;
     }
+
+    TEST_F(AEmbeddedCompositor_Wayland, ReleasesBufferReadByGpuImmediatelyIfFenceSyncNotSupported)
+    {
+        EXPECT_TRUE(init("wayland-10"));
+
+        StrictMock<WaylandBufferResourceMock>  bufferResource;
+        auto* bufferResourceCloned = new StrictMock<WaylandBufferResourceMock>;
+
+        EXPECT_CALL(bufferResource, clone()).WillOnce(Return(bufferResourceCloned));
+        EXPECT_CALL(*bufferResourceCloned, addDestroyListener(_));
+        IWaylandBuffer& waylandBuffer = embeddedCompositor->getOrCreateBuffer(bufferResource);
+
+        waylandBuffer.reference();
+        EXPECT_CALL(*bufferResourceCloned, bufferGetSharedMemoryData()).WillOnce(Return(nullptr));
+        waylandBuffer.release();
+        EXPECT_FALSE(waylandBuffer.isReferenced());
+
+        // released to client when render thread handles clients next time
+        EXPECT_CALL(*bufferResourceCloned, bufferSendRelease());
+        embeddedCompositor->handleRequestsFromClients();
+
+        embeddedCompositor->handleBufferDestroyed(waylandBuffer);
+        delete &waylandBuffer;
+    }
 }
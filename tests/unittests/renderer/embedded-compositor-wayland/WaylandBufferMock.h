@@ -19,6 +19,7 @@ namespace ramses::internal
         MOCK_METHOD(WaylandBufferResource&, getResource, (), (const, override));
         MOCK_METHOD(void, reference, (), (override));
         MOCK_METHOD(void, release, (), (override));
+        MOCK_METHOD(bool, isReferenced, (), (const, override));
         MOCK_METHOD(bool, isSharedMemoryBuffer, (), (const, override));
         MOCK_METHOD(void, logInfos, (RendererLogContext&, const WaylandEGLExtensionProcs&), (const, override));
     };
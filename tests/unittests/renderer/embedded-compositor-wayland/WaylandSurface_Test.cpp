@@ -673,4 +673,73 @@ namespace ramses::internal
         EXPECT_CALL(m_waylandBuffer1, release());
         deleteWaylandSurface();
     }
+
+    TEST_F(AWaylandSurface, ReportsWholeBufferDamage_IfFirstBufferCommitted)
+    {
+        createWaylandSurface();
+
+        WaylandBufferResourceMock bufferResource;
+        attachBuffer(bufferResource, m_waylandBuffer1, {{m_waylandBuffer1, true}});
+        m_waylandSurface->surfaceDamageBuffer(m_client, 0, 0, 10, 10);
+        commitBuffer(m_waylandBuffer1);
+
+        EXPECT_TRUE(m_waylandSurface->dispatchBufferDamage().wholeBuffer);
+        //damage gets reset after dispatch
+        EXPECT_TRUE(m_waylandSurface->dispatchBufferDamage().isEmpty());
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, AccumulatesDamageOfCommittedBuffers)
+    {
+        createWaylandSurface();
+
+        WaylandBufferResourceMock bufferResource1;
+        WaylandBufferResourceMock bufferResource2;
+
+        attachBuffer(bufferResource1, m_waylandBuffer1, {{m_waylandBuffer1, true}});
+        commitBuffer(m_waylandBuffer1);
+        expectSurfaceBufferTypeChanged(true);
+        m_waylandSurface->dispatchBufferDamage();
+
+        attachBuffer(bufferResource2, m_waylandBuffer2, {{m_waylandBuffer2, true}, {m_waylandBuffer1, true}});
+        m_waylandSurface->surfaceDamageBuffer(m_client, 10, 20, 5, 5);
+        commitBuffer(m_waylandBuffer2, &m_waylandBuffer1);
+
+        attachBuffer(bufferResource1, m_waylandBuffer1, {{m_waylandBuffer1, true}, {m_waylandBuffer2, true}});
+        m_waylandSurface->surfaceDamage(m_client, 30, 25, 5, 10);
+        commitBuffer(m_waylandBuffer1, &m_waylandBuffer2);
+
+        const auto damage = m_waylandSurface->dispatchBufferDamage();
+        EXPECT_FALSE(damage.wholeBuffer);
+        EXPECT_EQ(10, damage.x);
+        EXPECT_EQ(20, damage.y);
+        EXPECT_EQ(25, damage.width);
+        EXPECT_EQ(15, damage.height);
+
+        EXPECT_CALL(m_waylandBuffer1, release());
+        deleteWaylandSurface();
+    }
+
+    TEST_F(AWaylandSurface, ReportsWholeBufferDamage_IfBufferCommittedWithoutDamage)
+    {
+        createWaylandSurface();
+
+        WaylandBufferResourceMock bufferResource1;
+        WaylandBufferResourceMock bufferResource2;
+
+        attachBuffer(bufferResource1, m_waylandBuffer1, {{m_waylandBuffer1, true}});
+        commitBuffer(m_waylandBuffer1);
+        expectSurfaceBufferTypeChanged(true);
+        m_waylandSurface->dispatchBufferDamage();
+
+        attachBuffer(bufferResource2, m_waylandBuffer2, {{m_waylandBuffer2, true}, {m_waylandBuffer1, true}});
+        commitBuffer(m_waylandBuffer2, &m_waylandBuffer1);
+
+        EXPECT_TRUE(m_waylandSurface->dispatchBufferDamage().wholeBuffer);
+
+        EXPECT_CALL(m_waylandBuffer2, release());
+        deleteWaylandSurface();
+    }
 }
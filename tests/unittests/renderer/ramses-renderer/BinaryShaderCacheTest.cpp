@@ -106,17 +106,21 @@ namespace ramses::internal
         }
 
         void corruptVersionInTestFile()
+        {
+            corruptHeaderFieldInTestFile(offsetof(BinaryShaderCacheImpl::FileHeader, transportVersion));
+        }
+
+        void corruptHeaderFieldInTestFile(size_t fieldOffset)
         {
             ramses::internal::File file(m_binaryShaderFilePath);
             size_t fileSize(0);
             EXPECT_TRUE(file.getSizeInBytes(fileSize));
             EXPECT_TRUE(file.open(File::Mode::WriteExistingBinary));
-            const auto transportVersionOffset = offsetof(BinaryShaderCacheImpl::FileHeader, transportVersion);
-            EXPECT_TRUE(file.seek(transportVersionOffset, File::SeekOrigin::BeginningOfFile));
+            EXPECT_TRUE(file.seek(fieldOffset, File::SeekOrigin::BeginningOfFile));
             char data = 0;
             size_t numBytesRead = 0u;
             EXPECT_EQ(EStatus::Ok, file.read(&data, sizeof(data), numBytesRead));
-            EXPECT_TRUE(file.seek(transportVersionOffset, File::SeekOrigin::BeginningOfFile));
+            EXPECT_TRUE(file.seek(fieldOffset, File::SeekOrigin::BeginningOfFile));
             data++;
             EXPECT_TRUE(file.write(&data, sizeof(data)));
         }
@@ -281,6 +285,20 @@ namespace ramses::internal
         EXPECT_FALSE(m_cache.loadFromFile(m_binaryShaderFilePath.c_str()));
     }
 
+    TEST_F(ABinaryShaderCache, reportsFailOnFileOfOtherFormat)
+    {
+        createTestFile();
+        corruptHeaderFieldInTestFile(offsetof(BinaryShaderCacheImpl::FileHeader, magic));
+        EXPECT_FALSE(m_cache.loadFromFile(m_binaryShaderFilePath.c_str()));
+    }
+
+    TEST_F(ABinaryShaderCache, reportsFailOnOtherFileFormatVersion)
+    {
+        createTestFile();
+        corruptHeaderFieldInTestFile(offsetof(BinaryShaderCacheImpl::FileHeader, formatVersion));
+        EXPECT_FALSE(m_cache.loadFromFile(m_binaryShaderFilePath.c_str()));
+    }
+
     TEST_F(ABinaryShaderCache, handlesDoubleStoreProperly)
     {
         const auto shaderData = make_byte_array(12u, 34u, 56u, 78u);
@@ -293,4 +311,86 @@ namespace ramses::internal
         m_cache.storeBinaryShader(effectHash1, ramses::sceneId_t(1u), shaderData.data(), shaderDataSize, format);
         EXPECT_TRUE(m_cache.hasBinaryShader(effectHash1));
     }
+
+    TEST_F(ABinaryShaderCache, savesPersistentCacheOnDestructionAndLoadsItWithWarmUp)
+    {
+        const auto shaderData = make_byte_array(12u, 34u, 56u, 78u);
+        const ramses::binaryShaderFormatId_t format{ 123u };
+        const ramses::effectId_t effectHash = { 11u, 0 };
+        {
+            ramses::BinaryShaderCache cache;
+            EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, true));
+            cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+            EXPECT_FALSE(cache.hasBinaryShader(effectHash));
+            cache.storeBinaryShader(effectHash, ramses::sceneId_t(1u), shaderData.data(), static_cast<uint32_t>(shaderData.size()), format);
+        }
+        EXPECT_TRUE(File(m_binaryShaderFilePath).exists());
+        EXPECT_FALSE(File(m_binaryShaderFilePath + ".tmp").exists());
+
+        ramses::BinaryShaderCache cache;
+        EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, true));
+        cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+        EXPECT_TRUE(cache.hasBinaryShader(effectHash));
+        EXPECT_EQ(static_cast<uint32_t>(shaderData.size()), cache.getBinaryShaderSize(effectHash));
+    }
+
+    TEST_F(ABinaryShaderCache, loadsPersistentCacheWithoutWarmUpWhenDeviceFormatsReported)
+    {
+        const auto shaderData = make_byte_array(12u, 34u, 56u, 78u);
+        const ramses::binaryShaderFormatId_t format{ 123u };
+        const ramses::effectId_t effectHash = { 11u, 0 };
+        {
+            ramses::BinaryShaderCache cache;
+            EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, false));
+            cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+            cache.storeBinaryShader(effectHash, ramses::sceneId_t(1u), shaderData.data(), static_cast<uint32_t>(shaderData.size()), format);
+        }
+
+        ramses::BinaryShaderCache cache;
+        EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, false));
+        cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+        EXPECT_TRUE(cache.hasBinaryShader(effectHash));
+    }
+
+    TEST_F(ABinaryShaderCache, evictsPersistedShadersCreatedOnDeviceWithDifferentFormats)
+    {
+        const auto shaderData = make_byte_array(12u, 34u, 56u, 78u);
+        const ramses::binaryShaderFormatId_t format{ 123u };
+        const ramses::effectId_t effectHash = { 11u, 0 };
+        {
+            ramses::BinaryShaderCache cache;
+            EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, true));
+            cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+            cache.storeBinaryShader(effectHash, ramses::sceneId_t(1u), shaderData.data(), static_cast<uint32_t>(shaderData.size()), format);
+        }
+
+        // format of cached shader still supported but device is different
+        const std::array<ramses::binaryShaderFormatId_t, 2> otherDeviceFormats = { format, ramses::binaryShaderFormatId_t{ 124u } };
+        ramses::BinaryShaderCache cache;
+        EXPECT_TRUE(cache.enablePersistence(m_binaryShaderFilePath, true));
+        cache.deviceSupportsBinaryShaderFormats(otherDeviceFormats.data(), uint32_t(otherDeviceFormats.size()));
+        EXPECT_FALSE(cache.hasBinaryShader(effectHash));
+    }
+
+    TEST_F(ABinaryShaderCache, evictsBinaryShaderWhichFailedToUpload)
+    {
+        const auto shaderData = make_byte_array(12u, 34u, 56u, 78u);
+        const ramses::binaryShaderFormatId_t format{ 123u };
+        const ramses::effectId_t effectHash = { 11u, 0 };
+        m_cache.storeBinaryShader(effectHash, ramses::sceneId_t(1u), shaderData.data(), static_cast<uint32_t>(shaderData.size()), format);
+        m_cache.deviceSupportsBinaryShaderFormats(&format, 1u);
+        EXPECT_TRUE(m_cache.hasBinaryShader(effectHash));
+
+        m_cache.binaryShaderUploaded(effectHash, true);
+        EXPECT_TRUE(m_cache.hasBinaryShader(effectHash));
+        m_cache.binaryShaderUploaded(effectHash, false);
+        EXPECT_FALSE(m_cache.hasBinaryShader(effectHash));
+    }
+
+    TEST_F(ABinaryShaderCache, failsToEnablePersistenceTwiceOrWithEmptyPath)
+    {
+        EXPECT_FALSE(m_cache.enablePersistence("", false));
+        EXPECT_TRUE(m_cache.enablePersistence(m_binaryShaderFilePath, false));
+        EXPECT_FALSE(m_cache.enablePersistence(m_binaryShaderFilePath, false));
+    }
 }
@@ -389,6 +389,13 @@ namespace ramses::internal
         EXPECT_EQ(0660u, config.impl().getWaylandSocketEmbeddedPermissions());
     }
 
+    TEST_F(ADisplayConfig, canEnableEmbeddedCompositingEventThread)
+    {
+        EXPECT_FALSE(config.impl().isWaylandEmbeddedCompositingEventThreadEnabled());
+        EXPECT_TRUE(config.setWaylandEmbeddedCompositingEventThread(true));
+        EXPECT_TRUE(config.impl().isWaylandEmbeddedCompositingEventThreadEnabled());
+    }
+
     TEST_F(ADisplayConfig, cannotSetInvalidEmbeddedCompositingSocketPermissions)
     {
         EXPECT_FALSE(config.setWaylandEmbeddedCompositingSocketPermissions(0));
@@ -426,6 +433,24 @@ namespace ramses::internal
         EXPECT_EQ(4, config.impl().getScenePriority(ramses::sceneId_t(551)));
     }
 
+    TEST_F(ADisplayConfig, canSetScenePrefetch)
+    {
+        EXPECT_FALSE(config.impl().isScenePrefetchEnabled(ramses::sceneId_t(551)));
+        EXPECT_TRUE(config.setScenePrefetch(ramses::sceneId_t(551), true));
+        EXPECT_TRUE(config.impl().isScenePrefetchEnabled(ramses::sceneId_t(551)));
+        EXPECT_TRUE(config.setScenePrefetch(ramses::sceneId_t(551), false));
+        EXPECT_FALSE(config.impl().isScenePrefetchEnabled(ramses::sceneId_t(551)));
+    }
+
+    TEST_F(ADisplayConfig, canSetSceneProgressiveMapping)
+    {
+        EXPECT_FALSE(config.impl().isSceneProgressiveMappingEnabled(ramses::sceneId_t(551)));
+        EXPECT_TRUE(config.setSceneProgressiveMapping(ramses::sceneId_t(551), true));
+        EXPECT_TRUE(config.impl().isSceneProgressiveMappingEnabled(ramses::sceneId_t(551)));
+        EXPECT_TRUE(config.setSceneProgressiveMapping(ramses::sceneId_t(551), false));
+        EXPECT_FALSE(config.impl().isSceneProgressiveMappingEnabled(ramses::sceneId_t(551)));
+    }
+
     TEST_F(ADisplayConfig, canSetResourceUploadBatchSize)
     {
         EXPECT_EQ(10u, config.impl().getResourceUploadBatchSize());
@@ -434,4 +459,94 @@ namespace ramses::internal
         EXPECT_FALSE(config.setResourceUploadBatchSize(0));
         EXPECT_EQ(1u, config.impl().getResourceUploadBatchSize());
     }
+
+    TEST_F(ADisplayConfig, canSetMaxFramesInFlight)
+    {
+        EXPECT_EQ(0u, config.impl().getMaxFramesInFlight());
+        EXPECT_TRUE(config.setMaxFramesInFlight(2u));
+        EXPECT_EQ(2u, config.impl().getMaxFramesInFlight());
+        EXPECT_TRUE(config.setMaxFramesInFlight(0u));
+        EXPECT_EQ(0u, config.impl().getMaxFramesInFlight());
+    }
+
+    TEST_F(ADisplayConfig, canSetFlushApplyThreadCount)
+    {
+        EXPECT_EQ(0u, config.impl().getFlushApplyThreadCount());
+        EXPECT_TRUE(config.setFlushApplyThreadCount(4u));
+        EXPECT_EQ(4u, config.impl().getFlushApplyThreadCount());
+        EXPECT_TRUE(config.setFlushApplyThreadCount(0u));
+        EXPECT_EQ(0u, config.impl().getFlushApplyThreadCount());
+    }
+
+    TEST_F(ADisplayConfig, canSetAsyncFlushApplyThreshold)
+    {
+        EXPECT_EQ(0u, config.impl().getAsyncFlushApplyThreshold());
+        EXPECT_TRUE(config.setAsyncFlushApplyThreshold(1000u));
+        EXPECT_EQ(1000u, config.impl().getAsyncFlushApplyThreshold());
+        EXPECT_TRUE(config.setAsyncFlushApplyThreshold(0u));
+        EXPECT_EQ(0u, config.impl().getAsyncFlushApplyThreshold());
+    }
+
+    TEST_F(ADisplayConfig, canSetOffscreenBufferScalingGpuTimeThreshold)
+    {
+        EXPECT_EQ(std::chrono::microseconds{ 0 }, config.impl().getOffscreenBufferScalingGpuTimeThreshold());
+        EXPECT_TRUE(config.setOffscreenBufferScalingGpuTimeThreshold(12000u));
+        EXPECT_EQ(std::chrono::microseconds{ 12000 }, config.impl().getOffscreenBufferScalingGpuTimeThreshold());
+        EXPECT_TRUE(config.setOffscreenBufferScalingGpuTimeThreshold(0u));
+        EXPECT_EQ(std::chrono::microseconds{ 0 }, config.impl().getOffscreenBufferScalingGpuTimeThreshold());
+    }
+
+    TEST_F(ADisplayConfig, canEnableIdleWait)
+    {
+        EXPECT_FALSE(config.impl().isIdleWaitEnabled());
+        EXPECT_TRUE(config.setIdleWaitEnabled(true));
+        EXPECT_TRUE(config.impl().isIdleWaitEnabled());
+        EXPECT_TRUE(config.setIdleWaitEnabled(false));
+        EXPECT_FALSE(config.impl().isIdleWaitEnabled());
+    }
+
+    TEST_F(ADisplayConfig, canSetRenderOncePassesPerFrameLimit)
+    {
+        EXPECT_EQ(0u, config.impl().getRenderOncePassesPerFrameLimit());
+        EXPECT_TRUE(config.setRenderOncePassesPerFrameLimit(2u));
+        EXPECT_EQ(2u, config.impl().getRenderOncePassesPerFrameLimit());
+        EXPECT_TRUE(config.setRenderOncePassesPerFrameLimit(0u));
+        EXPECT_EQ(0u, config.impl().getRenderOncePassesPerFrameLimit());
+    }
+
+    TEST_F(ADisplayConfig, canEnableAsyncPicking)
+    {
+        EXPECT_FALSE(config.impl().isAsyncPickingEnabled());
+        EXPECT_TRUE(config.setAsyncPickingEnabled(true));
+        EXPECT_TRUE(config.impl().isAsyncPickingEnabled());
+        EXPECT_TRUE(config.setAsyncPickingEnabled(false));
+        EXPECT_FALSE(config.impl().isAsyncPickingEnabled());
+    }
+
+    TEST_F(ADisplayConfig, canSetDisplayThreadScheduling)
+    {
+        EXPECT_TRUE(config.impl().getDisplayThreadScheduling().isDefault());
+        EXPECT_TRUE(config.setDisplayThreadScheduling(ramses::EThreadSchedulingPolicy::Fifo, 20, { 1u, 2u }));
+        const ramses::internal::ThreadScheduling expectedScheduling{ ramses::EThreadSchedulingPolicy::Fifo, 20, { 1u, 2u } };
+        EXPECT_EQ(expectedScheduling, config.impl().getDisplayThreadScheduling());
+        EXPECT_TRUE(config.setDisplayThreadScheduling(ramses::EThreadSchedulingPolicy::Default, 0, {}));
+        EXPECT_TRUE(config.impl().getDisplayThreadScheduling().isDefault());
+    }
+
+    TEST_F(ADisplayConfig, canSetEffectUploadThreadScheduling)
+    {
+        EXPECT_TRUE(config.impl().getEffectUploadThreadScheduling().isDefault());
+        EXPECT_TRUE(config.setEffectUploadThreadScheduling(ramses::EThreadSchedulingPolicy::RoundRobin, 1, { 3u }));
+        const ramses::internal::ThreadScheduling expectedScheduling{ ramses::EThreadSchedulingPolicy::RoundRobin, 1, { 3u } };
+        EXPECT_EQ(expectedScheduling, config.impl().getEffectUploadThreadScheduling());
+    }
+
+    TEST_F(ADisplayConfig, failsToSetThreadSchedulingWithInvalidPriority)
+    {
+        EXPECT_FALSE(config.setDisplayThreadScheduling(ramses::EThreadSchedulingPolicy::Default, 1, {}));
+        EXPECT_FALSE(config.setDisplayThreadScheduling(ramses::EThreadSchedulingPolicy::Fifo, 0, {}));
+        EXPECT_FALSE(config.setEffectUploadThreadScheduling(ramses::EThreadSchedulingPolicy::RoundRobin, 100, {}));
+        EXPECT_TRUE(config.impl().getDisplayThreadScheduling().isDefault());
+        EXPECT_TRUE(config.impl().getEffectUploadThreadScheduling().isDefault());
+    }
 }
@@ -10,6 +10,7 @@
 #include "gmock/gmock.h"
 #include "ramses/renderer/RamsesRenderer.h"
 #include "ramses/renderer/DisplayConfig.h"
+#include "ramses/renderer/BinaryShaderCache.h"
 #include "ramses/renderer/IRendererEventHandler.h"
 #include "ramses/framework/RamsesFrameworkConfig.h"
 #include "ramses/framework/RamsesFramework.h"
@@ -18,6 +19,7 @@
 #include "ramses/client/Scene.h"
 
 #include "internal/RendererLib/RendererCommands.h"
+#include "internal/RendererLib/PlatformInterface/IBinaryShaderCache.h"
 #include "impl/RamsesRendererImpl.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/PlatformAbstraction/PlatformEvent.h"
@@ -25,6 +27,8 @@
 #include "PlatformFactoryMock.h"
 #include "internal/SceneGraph/SceneAPI/RenderState.h"
 #include "ramses/renderer/IRendererSceneControlEventHandler.h"
+#include <unordered_set>
+#include <array>
 
 
 namespace ramses::internal
@@ -169,6 +173,62 @@ WARNINGS_POP
         cmdVisitor.visit(commandBuffer);
     }
 
+    TEST_F(ARamsesRenderer, createsDisplaysWithoutBinaryShaderCacheByDefault)
+    {
+        EXPECT_NE(ramses::displayId_t::Invalid(), addDisplay());
+        EXPECT_NE(ramses::displayId_t::Invalid(), addDisplay());
+
+        EXPECT_CALL(cmdVisitor, createDisplayContext(_, _, nullptr)).Times(2);
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRenderer, sharesCompiledShadersBetweenDisplaysIfCrossDisplayShaderSharingEnabled)
+    {
+        ramses::RamsesFramework ramsesFramework{ ramses::RamsesFrameworkConfig{ ramses::EFeatureLevel_Latest } };
+        ramses::RendererConfig config;
+        EXPECT_TRUE(config.enableCrossDisplayShaderSharing(true));
+        ramses::RamsesRenderer* ramsesRenderer = CreateRenderer(ramsesFramework, config);
+        EXPECT_NE(ramses::displayId_t::Invalid(), ramsesRenderer->createDisplay({}));
+        EXPECT_NE(ramses::displayId_t::Invalid(), ramsesRenderer->createDisplay({}));
+
+        IBinaryShaderCache* cacheOfDisplay1 = nullptr;
+        IBinaryShaderCache* cacheOfDisplay2 = nullptr;
+        EXPECT_CALL(cmdVisitor, createDisplayContext(_, _, _)).WillOnce(SaveArg<2>(&cacheOfDisplay1)).WillOnce(SaveArg<2>(&cacheOfDisplay2));
+        cmdVisitor.visit(ramsesRenderer->impl().getPendingCommands());
+        ASSERT_NE(nullptr, cacheOfDisplay1);
+        ASSERT_EQ(cacheOfDisplay1, cacheOfDisplay2);
+
+        // shader stored when compiled on one display is available to the other display
+        const ResourceContentHash effectHash{ 123u, 0u };
+        const std::array<std::byte, 4u> binary{ std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4} };
+        EXPECT_FALSE(cacheOfDisplay2->hasBinaryShader(effectHash));
+        cacheOfDisplay1->storeBinaryShader(effectHash, SceneId{ 1u }, binary.data(), uint32_t(binary.size()), BinaryShaderFormatID{ 7u });
+        EXPECT_TRUE(cacheOfDisplay2->hasBinaryShader(effectHash));
+        EXPECT_EQ(uint32_t(binary.size()), cacheOfDisplay2->getBinaryShaderSize(effectHash));
+        EXPECT_EQ(BinaryShaderFormatID{ 7u }, cacheOfDisplay2->getBinaryShaderFormat(effectHash));
+    }
+
+    TEST_F(ARamsesRenderer, usesBinaryShaderCacheSetByUserEvenIfCrossDisplayShaderSharingEnabled)
+    {
+        ramses::BinaryShaderCache userCache;
+        ramses::RamsesFramework ramsesFramework{ ramses::RamsesFrameworkConfig{ ramses::EFeatureLevel_Latest } };
+        ramses::RendererConfig config;
+        EXPECT_TRUE(config.setBinaryShaderCache(userCache));
+        EXPECT_TRUE(config.enableCrossDisplayShaderSharing(true));
+        ramses::RamsesRenderer* ramsesRenderer = CreateRenderer(ramsesFramework, config);
+        EXPECT_NE(ramses::displayId_t::Invalid(), ramsesRenderer->createDisplay({}));
+
+        IBinaryShaderCache* cacheOfDisplay = nullptr;
+        EXPECT_CALL(cmdVisitor, createDisplayContext(_, _, _)).WillOnce(SaveArg<2>(&cacheOfDisplay));
+        cmdVisitor.visit(ramsesRenderer->impl().getPendingCommands());
+        ASSERT_NE(nullptr, cacheOfDisplay);
+
+        const ResourceContentHash effectHash{ 123u, 0u };
+        const std::array<std::byte, 1u> binary{ std::byte{1} };
+        cacheOfDisplay->storeBinaryShader(effectHash, SceneId{ 1u }, binary.data(), uint32_t(binary.size()), BinaryShaderFormatID{ 7u });
+        EXPECT_TRUE(userCache.hasBinaryShader(ramses::effectId_t{ effectHash.lowPart, effectHash.highPart }));
+    }
+
     TEST_F(ARamsesRendererWithDisplay, createsCommandForDisplayDestruction)
     {
         EXPECT_TRUE(renderer.destroyDisplay(displayId));
@@ -427,6 +487,68 @@ WARNINGS_POP
         cmdVisitor.visit(commandBuffer);
     }
 
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForUpdatingExternalBufferFromDmaBuffer)
+    {
+        ramses::externalBufferId_t externalBuffer{ 123u };
+        EXPECT_TRUE(renderer.updateExternalBufferFromDmaBuffer(displayId, externalBuffer, 11, 64u, 32u, 456u, 256u, 789u));
+        const ramses::internal::DmaBufferFrame expectedFrame{ 11, 64u, 32u, ramses::internal::DmaBufferFourccFormat{ 456u }, 256u, ramses::internal::DmaBufferModifiers{ 789u } };
+        EXPECT_CALL(cmdVisitor, handleExternalBufferDmaBufferUpdate(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::ExternalBufferHandle{ externalBuffer.getValue() }, expectedFrame));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfUpdatingExternalBufferFromInvalidDmaBuffer)
+    {
+        ramses::externalBufferId_t externalBuffer{ 123u };
+        EXPECT_FALSE(renderer.updateExternalBufferFromDmaBuffer(displayId, externalBuffer, -1, 64u, 32u, 456u, 256u, 789u));
+        EXPECT_FALSE(renderer.updateExternalBufferFromDmaBuffer(displayId, externalBuffer, 11, 0u, 32u, 456u, 256u, 789u));
+        EXPECT_FALSE(renderer.updateExternalBufferFromDmaBuffer(displayId, externalBuffer, 11, 64u, 0u, 456u, 256u, 789u));
+        EXPECT_FALSE(renderer.updateExternalBufferFromDmaBuffer(displayId, externalBuffer, 11, 64u, 32u, 456u, 0u, 789u));
+        EXPECT_FALSE(renderer.updateExternalBufferFromDmaBuffer(ramses::displayId_t{ 999u }, externalBuffer, 11, 64u, 32u, 456u, 256u, 789u));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, linksDmaOffscreenBufferToExternalBufferOfOtherDisplay)
+    {
+        const auto consumerDisplay = addDisplay();
+        const auto offscreenBuffer = renderer.createDmaOffscreenBuffer(displayId, 64u, 32u, 456u, 0u, 789u);
+        ASSERT_TRUE(offscreenBuffer.isValid());
+
+        ramses::internal::RendererEvent event;
+        event.eventType = ramses::internal::ERendererEventType::OffscreenBufferCreated;
+        event.displayHandle = ramses::internal::DisplayHandle{ displayId.getValue() };
+        event.offscreenBuffer = ramses::internal::OffscreenBufferHandle{ offscreenBuffer.getValue() };
+        event.dmaBufferFD = 11;
+        event.dmaBufferStride = 256u;
+        renderer.impl().getDisplayDispatcher().injectRendererEvent(std::move(event));
+        ramses::RendererEventHandlerEmpty dummyHandler;
+        renderer.dispatchEvents(dummyHandler);
+
+        const ramses::externalBufferId_t externalBuffer{ 123u };
+        EXPECT_TRUE(renderer.linkDmaOffscreenBufferToExternalBuffer(displayId, offscreenBuffer, consumerDisplay, externalBuffer));
+
+        const ramses::internal::DmaBufferFrame expectedFrame{ 11, 64u, 32u, ramses::internal::DmaBufferFourccFormat{ 456u }, 256u, ramses::internal::DmaBufferModifiers{ 789u } };
+        EXPECT_CALL(cmdVisitor, createDisplayContext(_, ramses::internal::DisplayHandle{ consumerDisplay.getValue() }, _));
+        EXPECT_CALL(cmdVisitor, handleDmaBufferCreateRequest(_, _, _, _, _, _, _));
+        EXPECT_CALL(cmdVisitor, handleExternalBufferDmaBufferUpdate(ramses::internal::DisplayHandle{ consumerDisplay.getValue() }, ramses::internal::ExternalBufferHandle{ externalBuffer.getValue() }, expectedFrame));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, failsToLinkDmaOffscreenBufferNotCreatedYet)
+    {
+        const auto offscreenBuffer = renderer.createDmaOffscreenBuffer(displayId, 64u, 32u, 456u, 0u, 789u);
+        EXPECT_FALSE(renderer.linkDmaOffscreenBufferToExternalBuffer(displayId, offscreenBuffer, displayId, ramses::externalBufferId_t{ 123u }));
+        EXPECT_FALSE(renderer.linkDmaOffscreenBufferToExternalBuffer(displayId, ramses::displayBufferId_t{ 999u }, displayId, ramses::externalBufferId_t{ 123u }));
+
+        EXPECT_CALL(cmdVisitor, handleDmaBufferCreateRequest(_, _, _, _, _, _, _));
+        EXPECT_CALL(cmdVisitor, handleExternalBufferDmaBufferUpdate(_, _, _)).Times(0);
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, failsToLinkDmaOffscreenBufferToExternalBufferOfUnknownDisplay)
+    {
+        EXPECT_FALSE(renderer.linkDmaOffscreenBufferToExternalBuffer(displayId, ramses::displayBufferId_t{ 10u }, ramses::displayId_t{ 999u }, ramses::externalBufferId_t{ 123u }));
+        EXPECT_FALSE(renderer.linkDmaOffscreenBufferToExternalBuffer(ramses::displayId_t{ 999u }, ramses::displayBufferId_t{ 10u }, displayId, ramses::externalBufferId_t{ 123u }));
+    }
+
     /*
     * Read Pixels
     */
@@ -434,7 +556,15 @@ WARNINGS_POP
     {
         ramses::displayBufferId_t bufferId{ 123u };
         EXPECT_TRUE(renderer.readPixels(displayId, bufferId, 1u, 2u, 3u, 4u));
-        EXPECT_CALL(cmdVisitor, handleReadPixels(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ bufferId.getValue() }, 1u, 2u, 3u, 4u, false, std::string_view{}));
+        EXPECT_CALL(cmdVisitor, handleReadPixels(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ bufferId.getValue() }, 1u, 2u, 3u, 4u, false, std::string_view{}, false));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForNonBlockingReadPixels)
+    {
+        ramses::displayBufferId_t bufferId{ 123u };
+        EXPECT_TRUE(renderer.readPixelsNonBlocking(displayId, bufferId, 1u, 2u, 3u, 4u));
+        EXPECT_CALL(cmdVisitor, handleReadPixels(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ bufferId.getValue() }, 1u, 2u, 3u, 4u, false, std::string_view{}, true));
         cmdVisitor.visit(commandBuffer);
     }
 
@@ -715,6 +845,46 @@ WARNINGS_POP
         framework.destroyRenderer(renderer);
     }
 
+    class GpuMemoryUsageNotification final : public ramses::RendererEventHandlerEmpty
+    {
+    public:
+        void displayGpuMemoryUsage(ramses::displayId_t displayId, const ramses::GpuMemoryUsage& /*totalUsage*/, uint64_t /*gpuCacheSize*/) override
+        {
+            m_reportedDisplays.insert(displayId);
+        }
+
+        [[nodiscard]] bool displayReported(ramses::displayId_t display) const
+        {
+            return m_reportedDisplays.count(display) != 0u;
+        }
+
+    private:
+        std::unordered_set<ramses::displayId_t> m_reportedDisplays;
+    };
+
+    TEST(ARamsesRendererNonThreaded, reportsGpuMemoryUsageTogetherWithFrameTimings)
+    {
+        ramses::RamsesFrameworkConfig frameworkConfig{ramses::EFeatureLevel_Latest};
+        ramses::RamsesFramework framework{frameworkConfig};
+        ramses::RendererConfig rConfig;
+        rConfig.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds{ 50 });
+        ramses::RamsesRenderer& renderer(*CreateRenderer(framework, rConfig));
+
+        const auto display = renderer.createDisplay({});
+        renderer.flush();
+
+        GpuMemoryUsageNotification eventHandler;
+        const auto startTS = std::chrono::steady_clock::now();
+        while (!eventHandler.displayReported(display) && std::chrono::steady_clock::now() - startTS < std::chrono::minutes{ 1 })
+        {
+            renderer.doOneLoop();
+            renderer.dispatchEvents(eventHandler);
+        }
+        EXPECT_TRUE(eventHandler.displayReported(display));
+
+        framework.destroyRenderer(renderer);
+    }
+
     TEST(ARamsesRendererWithSeparateRendererThread, willNotReportsFrameTimingsIfDisabled)
     {
         ramses::RamsesFrameworkConfig frameworkConfig{ramses::EFeatureLevel_Latest};
@@ -795,6 +965,13 @@ WARNINGS_POP
         cmdVisitor.visit(commandBuffer);
     }
 
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForTrimmingMemory)
+    {
+        EXPECT_TRUE(renderer.trimMemory());
+        EXPECT_CALL(cmdVisitor, trimMemory());
+        cmdVisitor.visit(commandBuffer);
+    }
+
     TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingClearFlags_FB)
     {
         EXPECT_TRUE(renderer.setDisplayBufferClearFlags(displayId, renderer.getDisplayFramebuffer(displayId), ramses::EClearFlag::Color));
@@ -847,6 +1024,65 @@ WARNINGS_POP
         EXPECT_FALSE(renderer.setDisplayBufferClearColor(ramses::displayId_t{999u}, {}, {1, 2, 3, 4}));
     }
 
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingRenderRateDivisor)
+    {
+        EXPECT_TRUE(renderer.setOffscreenBufferRenderRateDivisor(displayId, ramses::displayBufferId_t{ 666u }, 4u));
+        EXPECT_CALL(cmdVisitor, handleSetRenderRateDivisor(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ 666u }, 4u));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfSettingRenderRateDivisorForFramebuffer)
+    {
+        EXPECT_FALSE(renderer.setOffscreenBufferRenderRateDivisor(displayId, renderer.getDisplayFramebuffer(displayId), 4u));
+        EXPECT_FALSE(renderer.setOffscreenBufferRenderRateDivisor(displayId, ramses::displayBufferId_t::Invalid(), 4u));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfSettingZeroRenderRateDivisor)
+    {
+        EXPECT_FALSE(renderer.setOffscreenBufferRenderRateDivisor(displayId, ramses::displayBufferId_t{ 666u }, 0u));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfSettingRenderRateDivisorForUnknownDisplay)
+    {
+        EXPECT_FALSE(renderer.setOffscreenBufferRenderRateDivisor(ramses::displayId_t{ 999u }, ramses::displayBufferId_t{ 666u }, 4u));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingOffscreenBufferScalable)
+    {
+        EXPECT_TRUE(renderer.setOffscreenBufferScalable(displayId, ramses::displayBufferId_t{ 666u }, true));
+        EXPECT_CALL(cmdVisitor, handleSetOffscreenBufferScalable(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ 666u }, true));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfSettingFramebufferScalable)
+    {
+        EXPECT_FALSE(renderer.setOffscreenBufferScalable(displayId, renderer.getDisplayFramebuffer(displayId), true));
+        EXPECT_FALSE(renderer.setOffscreenBufferScalable(displayId, ramses::displayBufferId_t::Invalid(), true));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfSettingOffscreenBufferScalableForUnknownDisplay)
+    {
+        EXPECT_FALSE(renderer.setOffscreenBufferScalable(ramses::displayId_t{ 999u }, ramses::displayBufferId_t{ 666u }, true));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingDmaOffscreenBufferSyncFence)
+    {
+        EXPECT_TRUE(renderer.setDmaOffscreenBufferSyncFenceEnabled(displayId, ramses::displayBufferId_t{ 666u }, true));
+        EXPECT_CALL(cmdVisitor, handleSetDmaOffscreenBufferSyncFence(ramses::internal::DisplayHandle{ displayId.getValue() }, ramses::internal::OffscreenBufferHandle{ 666u }, true));
+        cmdVisitor.visit(commandBuffer);
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfEnablingSyncFenceForFramebuffer)
+    {
+        EXPECT_FALSE(renderer.setDmaOffscreenBufferSyncFenceEnabled(displayId, renderer.getDisplayFramebuffer(displayId), true));
+        EXPECT_FALSE(renderer.setDmaOffscreenBufferSyncFenceEnabled(displayId, ramses::displayBufferId_t::Invalid(), true));
+    }
+
+    TEST_F(ARamsesRendererWithDisplay, reportsErrorIfEnablingSyncFenceForUnknownDisplay)
+    {
+        EXPECT_FALSE(renderer.setDmaOffscreenBufferSyncFenceEnabled(ramses::displayId_t{ 999u }, ramses::displayBufferId_t{ 666u }, true));
+    }
+
     TEST_F(ARamsesRendererWithDisplay, createsCommandForSettingExternallyOwnedWindowSize)
     {
         EXPECT_TRUE(renderer.setExternallyOwnedWindowSize(displayId, 123u, 456u));
@@ -18,6 +18,8 @@ namespace ramses::internal
         const RendererConfigData defaultConfig;
         ramses::RendererConfig config;
         EXPECT_EQ(nullptr, config.impl().getBinaryShaderCache());
+        EXPECT_FALSE(config.isCrossDisplayShaderSharingEnabled());
+        EXPECT_FALSE(config.isDisplayRestartCacheEnabled());
 
         const auto& internalConfig = config.impl().getInternalRendererConfig();
 
@@ -26,6 +28,25 @@ namespace ramses::internal
         EXPECT_EQ(defaultConfig.getSystemCompositorControlEnabled(), internalConfig.getSystemCompositorControlEnabled());
     }
 
+    TEST(ARendererConfig, canEnableCrossDisplayShaderSharing)
+    {
+        ramses::RendererConfig config;
+        EXPECT_TRUE(config.enableCrossDisplayShaderSharing(true));
+        EXPECT_TRUE(config.isCrossDisplayShaderSharingEnabled());
+        EXPECT_TRUE(config.enableCrossDisplayShaderSharing(false));
+        EXPECT_FALSE(config.isCrossDisplayShaderSharingEnabled());
+    }
+
+    TEST(ARendererConfig, canEnableDisplayRestartCache)
+    {
+        ramses::RendererConfig config;
+        EXPECT_TRUE(config.enableDisplayRestartCache(true));
+        EXPECT_TRUE(config.isDisplayRestartCacheEnabled());
+        EXPECT_TRUE(config.impl().getInternalRendererConfig().isDisplayRestartCacheEnabled());
+        EXPECT_TRUE(config.enableDisplayRestartCache(false));
+        EXPECT_FALSE(config.isDisplayRestartCacheEnabled());
+    }
+
     TEST(ARendererConfig, canEnableSystemCompositor)
     {
         ramses::RendererConfig config;
@@ -108,4 +129,16 @@ WARNINGS_POP
         EXPECT_TRUE(config.setRenderThreadLoopTimingReportingPeriod(std::chrono::milliseconds(1234)));
         EXPECT_EQ(std::chrono::milliseconds(1234), config.getRenderThreadLoopTimingReportingPeriod());
     }
+
+    TEST(ARendererConfig, canSetResourceDecompressionThreadScheduling)
+    {
+        ramses::RendererConfig config;
+        EXPECT_TRUE(config.impl().getResourceDecompressionThreadScheduling().isDefault());
+        EXPECT_TRUE(config.setResourceDecompressionThreadScheduling(ramses::EThreadSchedulingPolicy::Default, 0, { 0u, 1u }));
+        const ramses::internal::ThreadScheduling expectedScheduling{ ramses::EThreadSchedulingPolicy::Default, 0, { 0u, 1u } };
+        EXPECT_EQ(expectedScheduling, config.impl().getResourceDecompressionThreadScheduling());
+
+        EXPECT_FALSE(config.setResourceDecompressionThreadScheduling(ramses::EThreadSchedulingPolicy::Fifo, 0, {}));
+        EXPECT_EQ(expectedScheduling, config.impl().getResourceDecompressionThreadScheduling());
+    }
 }
@@ -31,6 +31,7 @@ namespace ramses::internal
         MOCK_METHOD(void, dataConsumerCreated, (sceneId_t, dataConsumerId_t), (override));
         MOCK_METHOD(void, dataConsumerDestroyed, (sceneId_t, dataConsumerId_t), (override));
         MOCK_METHOD(void, sceneFlushed, (sceneId_t, sceneVersionTag_t), (override));
+        MOCK_METHOD(void, sceneResourcesComplete, (sceneId_t), (override));
         MOCK_METHOD(void, sceneExpirationMonitoringEnabled, (sceneId_t), (override));
         MOCK_METHOD(void, sceneExpirationMonitoringDisabled, (sceneId_t), (override));
         MOCK_METHOD(void, sceneExpired, (sceneId_t), (override));
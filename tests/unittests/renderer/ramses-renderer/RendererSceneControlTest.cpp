@@ -509,6 +509,17 @@ namespace ramses::internal
         dispatchSceneControlEvents();
     }
 
+    TEST_F(ARendererSceneControl, dispatchesSceneResourcesCompleteEventFromRenderer)
+    {
+        constexpr sceneId_t scene{ 3 };
+
+        EXPECT_CALL(m_eventHandler, sceneResourcesComplete(scene));
+        m_eventsFromRenderer.addSceneResourcesEvent(ERendererEventType::SceneResourcesComplete, SceneId{ scene.getValue() });
+
+        submitEventsFromRenderer();
+        dispatchSceneControlEvents();
+    }
+
     TEST_F(ARendererSceneControl, dispatchesSceneExpirationEventFromRenderer)
     {
         constexpr sceneId_t scene{ 3 };
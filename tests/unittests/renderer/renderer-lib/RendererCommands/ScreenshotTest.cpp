@@ -26,10 +26,10 @@ namespace ramses::internal
         }
 
     protected:
-        void expectScreenshotCommand(const std::string& filename, const DisplayHandle& displayHandle = DisplayHandle(0u), bool autoSize = true, const OffscreenBufferHandle& obHandle = OffscreenBufferHandle::Invalid())
+        void expectScreenshotCommand(const std::string& filename, const DisplayHandle& displayHandle = DisplayHandle(0u), bool autoSize = true, const OffscreenBufferHandle& obHandle = OffscreenBufferHandle::Invalid(), bool async = false)
         {
             StrictMock<RendererCommandVisitorMock> cmdVisitor;
-            EXPECT_CALL(cmdVisitor, handleReadPixels(displayHandle, obHandle, _, _, _, _, autoSize, std::string_view(filename)));
+            EXPECT_CALL(cmdVisitor, handleReadPixels(displayHandle, obHandle, _, _, _, _, autoSize, std::string_view(filename), async));
             cmdVisitor.visit(m_rendererCommandBuffer);
         }
 
@@ -58,6 +58,12 @@ namespace ramses::internal
         expectScreenshotCommand(filename, DisplayHandle(0), true, OffscreenBufferHandle(42));
     }
 
+    TEST_F(AScreenshot, executesAsynchronousScreenshot)
+    {
+        EXPECT_TRUE(m_cmd.executeInput({"-async"}));
+        expectScreenshotCommand(m_defaultFilename, DisplayHandle(0), true, OffscreenBufferHandle::Invalid(), true);
+    }
+
     TEST_F(AScreenshot, executesScreenshotWithDisplay)
     {
         const DisplayHandle displayHandle(23u);
@@ -9,6 +9,7 @@
 
 #include "internal/RendererLib/AsyncEffectUploader.h"
 #include "internal/SceneGraph/Resource/EffectResource.h"
+#include "internal/SceneGraph/Resource/TextureResource.h"
 #include "PlatformMock.h"
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
 
@@ -193,6 +194,45 @@ namespace ramses::internal
         destroyResourceUploadingRenderBackend();
     }
 
+    TEST_F(AnAsyncEffectUploader, UploadsTextureAndHandsOverGpuResourceExtractedFromUploadDeviceWithFenceOfUpload)
+    {
+        createResourceUploadingRenderBackend();
+
+        const TextureMetaInfo texDesc(2u, 2u, 1u, EPixelStorageFormat::R8, false, DefaultTextureSwizzleArray, { 4u });
+        const TextureResource texture(EResourceType::Texture2D, texDesc, {});
+
+        auto& deviceMock = platformMock.resourceUploadRenderBackendMock.deviceMock;
+        const DeviceResourceHandle uploadDeviceHandle{ 123u };
+        EXPECT_CALL(deviceMock, allocateTexture2D(2u, 2u, EPixelStorageFormat::R8, DefaultTextureSwizzleArray, 1u, 4u)).WillOnce(Return(uploadDeviceHandle));
+        EXPECT_CALL(deviceMock, uploadTextureData(uploadDeviceHandle, 0u, 0u, 0u, 0u, 2u, 2u, 1u, _, _, 0u));
+        EXPECT_CALL(deviceMock, extractTexture(uploadDeviceHandle)).WillOnce([](auto) { return std::make_unique<const GPUResource>(7u, 4u); });
+        // upload thread does not wait for GPU, fence is handed over instead
+        int fenceObject = 0;
+        const DeviceFence fence{ &fenceObject };
+        EXPECT_CALL(deviceMock, insertFence()).WillOnce(Return(fence));
+
+        TexturesGpuResources uploadedTextures;
+        asyncEffectUploader.syncTextures({ &texture }, uploadedTextures);
+        EXPECT_TRUE(uploadedTextures.empty());
+
+        constexpr std::chrono::seconds timeoutTime{ 2u };
+        const auto startTime = std::chrono::steady_clock::now();
+        while (uploadedTextures.empty() && timeoutTime > (std::chrono::steady_clock::now() - startTime))
+        {
+            asyncEffectUploader.syncTextures({}, uploadedTextures);
+            std::this_thread::sleep_for(5ms);
+        }
+
+        ASSERT_EQ(1u, uploadedTextures.size());
+        EXPECT_EQ(texture.getHash(), uploadedTextures.front().hash);
+        ASSERT_TRUE(uploadedTextures.front().gpuResource);
+        EXPECT_EQ(7u, uploadedTextures.front().gpuResource->getGPUAddress());
+        EXPECT_EQ(4u, uploadedTextures.front().vramSize);
+        EXPECT_EQ(fence, uploadedTextures.front().fence);
+
+        destroyResourceUploadingRenderBackend();
+    }
+
     TEST_F(AnAsyncEffectUploader, SyncReturnsEmptyResultIfNoWorkToDo)
     {
         createResourceUploadingRenderBackend();
@@ -254,16 +294,17 @@ namespace ramses::internal
         destroyResourceUploadingRenderBackend();
     }
 
-    TEST_F(AnAsyncEffectUploader, notifiesWatchdogInbetweenEveryShaderUpload)
+    TEST_F(AnAsyncEffectUploader, notifiesWatchdogInbetweenEveryShaderUploadBatch)
     {
-        EXPECT_CALL(notifier, notifyAlive(ThreadAliveNotifierMock::dummyThreadId)).Times(AtLeast(5)).WillRepeatedly([this](auto /*unused*/) { notifyCounter++; });
+        constexpr uint32_t effectCount = 2u * AsyncEffectUploader::MaxEffectsInUploadBatch + 1u;
+        EXPECT_CALL(notifier, notifyAlive(ThreadAliveNotifierMock::dummyThreadId)).Times(AtLeast(3)).WillRepeatedly([this](auto /*unused*/) { notifyCounter++; });
         EXPECT_CALL(notifier, calculateTimeout()).Times(AtLeast(0)).WillRepeatedly([this]() { timeoutCounter++; return 20ms; });
         createResourceUploadingRenderBackend(false);
 
-        uploadShadersAndExpectSuccess(5u);
+        uploadShadersAndExpectSuccess(effectCount);
 
         destroyResourceUploadingRenderBackend();
-        EXPECT_EQ(notifyCounter, timeoutCounter + 5u);
+        EXPECT_EQ(notifyCounter, timeoutCounter + 3u);
     }
 
     TEST_F(AnAsyncEffectUploader, notifiesWatchdogRegularlyWithNoWorkToDo)
@@ -0,0 +1,138 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/AsyncSceneActionApplier.h"
+#include "internal/RendererLib/RendererScenes.h"
+#include "internal/RendererLib/RendererCachedScene.h"
+#include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/Watchdog/ThreadAliveNotifierMock.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <future>
+
+using namespace testing;
+namespace ramses::internal
+{
+    class AnAsyncSceneActionApplier : public ::testing::Test
+    {
+    public:
+        AnAsyncSceneActionApplier()
+            : rendererScenes(eventCollector)
+            , scene1(rendererScenes.createScene(SceneInfo{ SceneId{ 1u } }))
+            , scene2(rendererScenes.createScene(SceneInfo{ SceneId{ 2u } }))
+        {
+        }
+
+    protected:
+        static PendingData CreatePendingData(uint32_t numFlushes)
+        {
+            PendingData pendingData;
+            for (uint32_t i = 0u; i < numFlushes; ++i)
+            {
+                pendingData.pendingFlushes.emplace_back();
+                pendingData.pendingFlushes.back().flushIndex = i;
+            }
+            return pendingData;
+        }
+
+        RendererEventCollector eventCollector;
+        RendererScenes rendererScenes;
+        RendererCachedScene& scene1;
+        RendererCachedScene& scene2;
+        NiceMock<ThreadAliveNotifierMock> notifier;
+        std::atomic<uint32_t> appliedFlushes{ 0u };
+        std::promise<void> unblockApplying;
+        std::shared_future<void> applyingUnblocked{ unblockApplying.get_future().share() };
+    };
+
+    TEST_F(AnAsyncSceneActionApplier, appliesFlushesOfSceneAndHandsThemOverWhenCollected)
+    {
+        AsyncSceneActionApplier applier{ [&](RendererCachedScene& scene, PendingFlushes& flushes, const SceneSizeInformation& /*unused*/) {
+            EXPECT_EQ(&scene1, &scene);
+            appliedFlushes += static_cast<uint32_t>(flushes.size());
+            return true;
+        }, notifier, DisplayHandle{ 1u } };
+
+        applier.startApplying(SceneId{ 1u }, scene1, CreatePendingData(3u), {});
+        EXPECT_TRUE(applier.hasScene(SceneId{ 1u }));
+        EXPECT_FALSE(applier.hasScene(SceneId{ 2u }));
+
+        applier.waitUntilApplied(SceneId{ 1u });
+        EXPECT_EQ(3u, appliedFlushes);
+        EXPECT_TRUE(applier.hasScene(SceneId{ 1u }));
+
+        AsyncSceneActionApplier::AppliedFlushesVector applied;
+        applier.collectApplied(applied);
+        ASSERT_EQ(1u, applied.size());
+        EXPECT_EQ(SceneId{ 1u }, applied[0].sceneId);
+        EXPECT_EQ(3u, applied[0].pendingData.pendingFlushes.size());
+        EXPECT_TRUE(applied[0].hadActiveShaderAnimation);
+        EXPECT_FALSE(applier.hasScene(SceneId{ 1u }));
+        EXPECT_TRUE(applier.isEmpty());
+    }
+
+    TEST_F(AnAsyncSceneActionApplier, doesNotHandOverFlushesStillBeingApplied)
+    {
+        AsyncSceneActionApplier applier{ [&](RendererCachedScene& /*unused*/, PendingFlushes& /*unused*/, const SceneSizeInformation& /*unused*/) {
+            applyingUnblocked.wait();
+            return false;
+        }, notifier, DisplayHandle{ 1u } };
+
+        applier.startApplying(SceneId{ 1u }, scene1, CreatePendingData(1u), {});
+        AsyncSceneActionApplier::AppliedFlushesVector applied;
+        applier.collectApplied(applied);
+        EXPECT_TRUE(applied.empty());
+        EXPECT_TRUE(applier.hasScene(SceneId{ 1u }));
+
+        unblockApplying.set_value();
+        applier.waitUntilAllApplied();
+        applier.collectApplied(applied);
+        ASSERT_EQ(1u, applied.size());
+        EXPECT_FALSE(applied[0].hadActiveShaderAnimation);
+    }
+
+    TEST_F(AnAsyncSceneActionApplier, appliesScenesInOrderOfStart)
+    {
+        std::vector<RendererCachedScene*> appliedScenes;
+        AsyncSceneActionApplier applier{ [&](RendererCachedScene& scene, PendingFlushes& /*unused*/, const SceneSizeInformation& /*unused*/) {
+            appliedScenes.push_back(&scene);
+            return false;
+        }, notifier, DisplayHandle{ 1u } };
+
+        applier.startApplying(SceneId{ 2u }, scene2, CreatePendingData(1u), {});
+        applier.startApplying(SceneId{ 1u }, scene1, CreatePendingData(1u), {});
+        applier.waitUntilAllApplied();
+
+        AsyncSceneActionApplier::AppliedFlushesVector applied;
+        applier.collectApplied(applied);
+        ASSERT_EQ(2u, applied.size());
+        EXPECT_EQ(SceneId{ 2u }, applied[0].sceneId);
+        EXPECT_EQ(SceneId{ 1u }, applied[1].sceneId);
+        EXPECT_EQ((std::vector<RendererCachedScene*>{ &scene2, &scene1 }), appliedScenes);
+    }
+
+    TEST_F(AnAsyncSceneActionApplier, discardsFlushesOfSceneAfterTheyAreApplied)
+    {
+        AsyncSceneActionApplier applier{ [&](RendererCachedScene& /*unused*/, PendingFlushes& flushes, const SceneSizeInformation& /*unused*/) {
+            applyingUnblocked.wait();
+            appliedFlushes += static_cast<uint32_t>(flushes.size());
+            return false;
+        }, notifier, DisplayHandle{ 1u } };
+
+        applier.startApplying(SceneId{ 1u }, scene1, CreatePendingData(2u), {});
+        auto discarded = std::async(std::launch::async, [&]() { applier.discard(SceneId{ 1u }); });
+        unblockApplying.set_value();
+        discarded.get();
+
+        EXPECT_EQ(2u, appliedFlushes);
+        EXPECT_TRUE(applier.isEmpty());
+        AsyncSceneActionApplier::AppliedFlushesVector applied;
+        applier.collectApplied(applied);
+        EXPECT_TRUE(applied.empty());
+    }
+}
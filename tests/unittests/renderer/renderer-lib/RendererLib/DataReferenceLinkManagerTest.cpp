@@ -315,6 +315,41 @@ namespace ramses::internal
         ExpectDataValue(providerDataRef, providerScene, 123.f);
     }
 
+    TEST_F(ADataReferenceLinkManager, resolvesLinkAgainOnlyIfProviderOrConsumerValueChanged)
+    {
+        SetDataValue(providerDataRef, providerScene, 666.f);
+        sceneLinksManager.createDataLink(providerSceneId, providerId, consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataLinked, providerSceneId, providerId, consumerSceneId, consumerId);
+
+        const auto& provider = rendererScenes.getScene(providerSceneId);
+        const auto isResolved = [&]() {
+            return consumerScene.isDataLinkResolved(consumerDataRef, providerSceneId, providerDataRef, provider.getSlotDataReferenceVersion(providerDataRef));
+        };
+
+        EXPECT_FALSE(isResolved());
+        dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+        EXPECT_TRUE(isResolved());
+        ExpectDataValue(consumerDataRef, consumerScene, 666.f);
+
+        SetDataValue(providerDataRef, providerScene, 123.f);
+        EXPECT_FALSE(isResolved());
+        dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+        EXPECT_TRUE(isResolved());
+        ExpectDataValue(consumerDataRef, consumerScene, 123.f);
+
+        // value set to consumer is overridden by linked value again
+        SetDataValue(consumerDataRef, consumerScene, -1.f);
+        EXPECT_FALSE(isResolved());
+        dataReferenceLinkManager.resolveLinksForConsumerScene(consumerScene);
+        EXPECT_TRUE(isResolved());
+        ExpectDataValue(consumerDataRef, consumerScene, 123.f);
+
+        sceneLinksManager.removeDataLink(consumerSceneId, consumerId);
+        expectRendererEvent(ERendererEventType::SceneDataUnlinked, consumerSceneId, consumerId, providerSceneId);
+        EXPECT_FALSE(isResolved());
+        ExpectDataValue(consumerDataRef, consumerScene, -1.f);
+    }
+
     template <typename T>
     class ADataReferenceLinkManagerTyped : public ADataReferenceLinkManager
     {
@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/DeviceResourceMapper.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class ADeviceResourceMapper : public ::testing::Test
+    {
+    protected:
+        DeviceResourceMapper mapper;
+    };
+
+    TEST_F(ADeviceResourceMapper, registersResourcesAndProvidesTheirGPUAddress)
+    {
+        const auto handle1 = mapper.registerResource(std::make_unique<GPUResource>(11u, 1024u));
+        const auto handle2 = mapper.registerResource(std::make_unique<GPUResource>(12u, 2048u));
+
+        EXPECT_NE(handle1, handle2);
+        EXPECT_TRUE(mapper.containsResource(handle1));
+        EXPECT_TRUE(mapper.containsResource(handle2));
+        EXPECT_EQ(11u, mapper.getGPUAddress(handle1));
+        EXPECT_EQ(12u, mapper.getGPUAddress(handle2));
+        EXPECT_EQ(2048u, mapper.getResource(handle2).getTotalSizeInBytes());
+        EXPECT_EQ(3u, mapper.getTotalGpuMemoryUsageInKB());
+    }
+
+    TEST_F(ADeviceResourceMapper, doesNotContainUnknownOrDeletedResource)
+    {
+        EXPECT_FALSE(mapper.containsResource(DeviceResourceHandle(0u)));
+        EXPECT_FALSE(mapper.containsResource(DeviceResourceHandle::Invalid()));
+
+        const auto handle = mapper.registerResource(std::make_unique<GPUResource>(11u, 1024u));
+        mapper.deleteResource(handle);
+        EXPECT_FALSE(mapper.containsResource(handle));
+        EXPECT_EQ(0u, mapper.getTotalGpuMemoryUsageInKB());
+    }
+
+    TEST_F(ADeviceResourceMapper, reusesHandleOfDeletedResource)
+    {
+        const auto handle1 = mapper.registerResource(std::make_unique<GPUResource>(11u, 0u));
+        const auto handle2 = mapper.registerResource(std::make_unique<GPUResource>(12u, 0u));
+        mapper.deleteResource(handle1);
+
+        const auto handle3 = mapper.registerResource(std::make_unique<GPUResource>(13u, 0u));
+        EXPECT_EQ(handle1, handle3);
+        EXPECT_EQ(13u, mapper.getGPUAddress(handle3));
+        EXPECT_EQ(12u, mapper.getGPUAddress(handle2));
+    }
+
+    TEST_F(ADeviceResourceMapper, releasesOwnershipOfResource)
+    {
+        const auto handle = mapper.registerResource(std::make_unique<GPUResource>(11u, 1024u));
+        const auto resource = mapper.releaseResource(handle);
+
+        ASSERT_TRUE(resource);
+        EXPECT_EQ(11u, resource->getGPUAddress());
+        EXPECT_FALSE(mapper.containsResource(handle));
+        EXPECT_EQ(0u, mapper.getTotalGpuMemoryUsageInKB());
+    }
+}
@@ -30,6 +30,8 @@ namespace ramses::internal
         MOCK_METHOD(IEmbeddedCompositingManager&, getECManager, (), (override));
         MOCK_METHOD(IEmbeddedCompositor&, getEC, (), (override));
         MOCK_METHOD(bool, hasSystemCompositorController, (), (const, override));
+        MOCK_METHOD(void, setWakeUpListener, (std::function<void()> listener), (override));
+        MOCK_METHOD(bool, isIdle, (), (const, override));
         MOCK_METHOD(std::atomic_int&, traceId, (), (override));
     };
 }
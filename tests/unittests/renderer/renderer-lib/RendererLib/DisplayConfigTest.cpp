@@ -41,7 +41,18 @@ namespace ramses::internal
         EXPECT_EQ(-1, m_config.getSwapInterval());
         EXPECT_EQ(0, m_config.getScenePriority(ramses::internal::SceneId()));
         EXPECT_EQ(0, m_config.getScenePriority(ramses::internal::SceneId(15562)));
+        EXPECT_FALSE(m_config.isScenePrefetchEnabled(ramses::internal::SceneId(15562)));
+        EXPECT_TRUE(m_config.getPrefetchScenes().empty());
+        EXPECT_FALSE(m_config.isSceneProgressiveMappingEnabled(ramses::internal::SceneId(15562)));
+        EXPECT_TRUE(m_config.getProgressiveMappingScenes().empty());
         EXPECT_EQ(10u, m_config.getResourceUploadBatchSize());
+        EXPECT_EQ(0u, m_config.getMaxFramesInFlight());
+        EXPECT_EQ(0u, m_config.getFlushApplyThreadCount());
+        EXPECT_EQ(0u, m_config.getAsyncFlushApplyThreshold());
+        EXPECT_EQ(std::chrono::microseconds{ 0 }, m_config.getOffscreenBufferScalingGpuTimeThreshold());
+        EXPECT_FALSE(m_config.isIdleWaitEnabled());
+        EXPECT_TRUE(m_config.getDisplayThreadScheduling().isDefault());
+        EXPECT_TRUE(m_config.getEffectUploadThreadScheduling().isDefault());
     }
 
     TEST_F(AInternalDisplayConfig, setAndGetValues)
@@ -107,6 +118,9 @@ namespace ramses::internal
         m_config.setWaylandEmbeddedCompositingSocketPermissions(0654);
         EXPECT_EQ(0654u, m_config.getWaylandSocketEmbeddedPermissions());
 
+        m_config.setWaylandEmbeddedCompositingEventThread(true);
+        EXPECT_TRUE(m_config.isWaylandEmbeddedCompositingEventThreadEnabled());
+
         m_config.setPlatformRenderNode("/some/render/node");
         EXPECT_EQ(std::string("/some/render/node"), m_config.getPlatformRenderNode());
 
@@ -116,11 +130,48 @@ namespace ramses::internal
         m_config.setResourceUploadBatchSize(3);
         EXPECT_EQ(3u, m_config.getResourceUploadBatchSize());
 
+        m_config.setMaxFramesInFlight(2);
+        EXPECT_EQ(2u, m_config.getMaxFramesInFlight());
+
+        m_config.setFlushApplyThreadCount(4);
+        EXPECT_EQ(4u, m_config.getFlushApplyThreadCount());
+
+        m_config.setAsyncFlushApplyThreshold(1000);
+        EXPECT_EQ(1000u, m_config.getAsyncFlushApplyThreshold());
+
+        m_config.setOffscreenBufferScalingGpuTimeThreshold(std::chrono::microseconds{ 12000 });
+        EXPECT_EQ(std::chrono::microseconds{ 12000 }, m_config.getOffscreenBufferScalingGpuTimeThreshold());
+
+        m_config.setIdleWaitEnabled(true);
+        EXPECT_TRUE(m_config.isIdleWaitEnabled());
+
+        const ramses::internal::ThreadScheduling displayThreadScheduling{ ramses::EThreadSchedulingPolicy::Fifo, 10, { 2u, 3u } };
+        m_config.setDisplayThreadScheduling(displayThreadScheduling);
+        EXPECT_EQ(displayThreadScheduling, m_config.getDisplayThreadScheduling());
+
+        const ramses::internal::ThreadScheduling effectUploadThreadScheduling{ ramses::EThreadSchedulingPolicy::Default, 0, { 1u } };
+        m_config.setEffectUploadThreadScheduling(effectUploadThreadScheduling);
+        EXPECT_EQ(effectUploadThreadScheduling, m_config.getEffectUploadThreadScheduling());
+
         m_config.setScenePriority(ramses::internal::SceneId(15562), -1);
         EXPECT_EQ(-1, m_config.getScenePriority(ramses::internal::SceneId(15562)));
         EXPECT_EQ(0, m_config.getScenePriority(ramses::internal::SceneId(15562 + 1)));
         EXPECT_EQ(1u, m_config.getScenePriorities().size());
         EXPECT_EQ(-1, m_config.getScenePriorities().at(ramses::internal::SceneId(15562)));
+
+        m_config.setScenePrefetch(ramses::internal::SceneId(15562), true);
+        EXPECT_TRUE(m_config.isScenePrefetchEnabled(ramses::internal::SceneId(15562)));
+        EXPECT_FALSE(m_config.isScenePrefetchEnabled(ramses::internal::SceneId(15562 + 1)));
+        EXPECT_EQ(1u, m_config.getPrefetchScenes().size());
+        m_config.setScenePrefetch(ramses::internal::SceneId(15562), false);
+        EXPECT_FALSE(m_config.isScenePrefetchEnabled(ramses::internal::SceneId(15562)));
+
+        m_config.setSceneProgressiveMapping(ramses::internal::SceneId(15562), true);
+        EXPECT_TRUE(m_config.isSceneProgressiveMappingEnabled(ramses::internal::SceneId(15562)));
+        EXPECT_FALSE(m_config.isSceneProgressiveMappingEnabled(ramses::internal::SceneId(15562 + 1)));
+        EXPECT_EQ(1u, m_config.getProgressiveMappingScenes().size());
+        m_config.setSceneProgressiveMapping(ramses::internal::SceneId(15562), false);
+        EXPECT_FALSE(m_config.isSceneProgressiveMappingEnabled(ramses::internal::SceneId(15562)));
     }
 
     TEST_F(AInternalDisplayConfig, canBeCompared)
@@ -10,6 +10,7 @@
 
 #include "internal/RendererLib/PlatformInterface/IDisplayController.h"
 #include "internal/Core/Math3d/CameraMatrixHelper.h"
+#include "internal/Core/Math3d/Quad.h"
 #include "gmock/gmock.h"
 
 namespace ramses::internal{
@@ -27,10 +28,14 @@ namespace ramses::internal{
         MOCK_METHOD(bool, canRenderNewFrame, (), (const, override));
         MOCK_METHOD(void, enableContext, (), (override));
         MOCK_METHOD(void, swapBuffers, (), (override));
+        MOCK_METHOD(void, swapBuffersWithDamage, (const Quad& damagedRegion), (override));
         MOCK_METHOD(void, clearBuffer, (DeviceResourceHandle, ClearFlags clearFlags, const glm::vec4&), (override));
         MOCK_METHOD(SceneRenderExecutionIterator, renderScene, (const RendererCachedScene&, RenderingContext&, const FrameTimer*), (override));
         MOCK_METHOD(DeviceResourceHandle, getDisplayBuffer, (), (const, override));
         MOCK_METHOD(void, readPixels, (DeviceResourceHandle framebufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut), (override));
+        MOCK_METHOD(DeviceResourceHandle, startReadPixels, (DeviceResourceHandle framebufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height), (override));
+        MOCK_METHOD(bool, finishReadPixels, (DeviceResourceHandle readPixelsHandle, std::vector<uint8_t>& dataOut), (override));
+        MOCK_METHOD(void, deleteReadPixels, (DeviceResourceHandle readPixelsHandle), (override));
         MOCK_METHOD(uint32_t, getDisplayWidth, (), (const, override));
         MOCK_METHOD(uint32_t, getDisplayHeight, (), (const, override));
         MOCK_METHOD(IRenderBackend&, getRenderBackend, (), (const, override));
@@ -167,4 +167,32 @@ namespace ramses::internal
 
         DestroyDisplayController(displayController);
     }
+
+    TEST_F(ADisplayController, readsPixelsAsynchronously)
+    {
+        IDisplayController& displayController = createDisplayController();
+
+        const uint32_t x = 1u;
+        const uint32_t y = 2u;
+        const uint32_t width = WindowMock::FakeWidth - 2u;
+        const uint32_t height = WindowMock::FakeHeight - 3u;
+        const DeviceResourceHandle readPixelsHandle{ 7800u };
+
+        InSequence seq;
+        EXPECT_CALL(m_renderBackend.deviceMock, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle));
+        EXPECT_CALL(m_renderBackend.deviceMock, startReadPixels(x, y, width, height)).WillOnce(Return(readPixelsHandle));
+        EXPECT_EQ(readPixelsHandle, displayController.startReadPixels(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, x, y, width, height));
+
+        std::vector<uint8_t> pixels;
+        EXPECT_CALL(m_renderBackend.deviceMock, finishReadPixels(readPixelsHandle, _)).WillOnce(Return(false));
+        EXPECT_FALSE(displayController.finishReadPixels(readPixelsHandle, pixels));
+        EXPECT_CALL(m_renderBackend.deviceMock, finishReadPixels(readPixelsHandle, _)).WillOnce(Invoke([](auto, auto& data) { data = { 1u, 2u, 3u, 4u }; return true; }));
+        EXPECT_TRUE(displayController.finishReadPixels(readPixelsHandle, pixels));
+        EXPECT_EQ(4u, pixels.size());
+
+        EXPECT_CALL(m_renderBackend.deviceMock, deleteReadPixels(readPixelsHandle));
+        displayController.deleteReadPixels(readPixelsHandle);
+
+        DestroyDisplayController(displayController);
+    }
 }
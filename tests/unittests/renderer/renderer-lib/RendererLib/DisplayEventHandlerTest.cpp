@@ -10,6 +10,7 @@
 #include "internal/RendererLib/Types.h"
 #include "internal/RendererLib/DisplayEventHandler.h"
 #include "internal/RendererLib/RendererEventCollector.h"
+#include "internal/RendererLib/RendererStatistics.h"
 #include "internal/RendererLib/Enums/EKeyEvent.h"
 #include "internal/RendererLib/Enums/EKeyModifier.h"
 
@@ -22,7 +23,7 @@ namespace ramses::internal
     protected:
         ADisplayEventHandler()
             : m_displayHandle(5110u)
-            , m_displayEventHandler(m_displayHandle, m_eventCollector)
+            , m_displayEventHandler(m_displayHandle, m_eventCollector, m_statistics)
         {
         }
 
@@ -36,7 +37,16 @@ namespace ramses::internal
             return events[index];
         }
 
+        RendererEventVector consumeRendererEvents()
+        {
+            RendererEventVector events;
+            RendererEventVector dummy;
+            m_eventCollector.appendAndConsumePendingEvents(events, dummy);
+            return events;
+        }
+
         RendererEventCollector m_eventCollector;
+        RendererStatistics m_statistics;
         DisplayHandle m_displayHandle;
         DisplayEventHandler m_displayEventHandler;
     };
@@ -144,4 +154,81 @@ namespace ramses::internal
         EXPECT_EQ(1280, event.moveEvent.posX);
         EXPECT_EQ(480, event.moveEvent.posY);
     }
+
+    TEST_F(ADisplayEventHandler, createsFlushPresentedEventsForFlushesAppliedBeforeSwapOfPresentedFrame)
+    {
+        const FlushTime::Clock::time_point flushTime{ std::chrono::milliseconds{ 1000 } };
+        m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag{ 11u }, flushTime);
+        m_displayEventHandler.onFlushApplied(SceneId{ 2u }, SceneVersionTag{ 22u }, flushTime + std::chrono::milliseconds{ 5 });
+        m_displayEventHandler.onFrameSwapped();
+        m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag{ 12u }, flushTime + std::chrono::milliseconds{ 10 });
+        m_displayEventHandler.onFrameSwapped();
+
+        m_displayEventHandler.onFramePresented(0u, flushTime + std::chrono::milliseconds{ 20 });
+        const auto events = consumeRendererEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_EQ(ERendererEventType::SceneFlushPresented, events[0].eventType);
+        EXPECT_EQ(m_displayHandle, events[0].displayHandle);
+        EXPECT_EQ(SceneId{ 1u }, events[0].sceneId);
+        EXPECT_EQ(SceneVersionTag{ 11u }, events[0].sceneVersionTag);
+        EXPECT_EQ(flushTime + std::chrono::milliseconds{ 20 }, events[0].flushPresentation.presentationTimestamp);
+        EXPECT_EQ(std::chrono::milliseconds{ 20 }, events[0].flushPresentation.latency);
+        EXPECT_EQ(ERendererEventType::SceneFlushPresented, events[1].eventType);
+        EXPECT_EQ(SceneId{ 2u }, events[1].sceneId);
+        EXPECT_EQ(SceneVersionTag{ 22u }, events[1].sceneVersionTag);
+        EXPECT_EQ(std::chrono::milliseconds{ 15 }, events[1].flushPresentation.latency);
+
+        m_displayEventHandler.onFramePresented(1u, flushTime + std::chrono::milliseconds{ 36 });
+        const auto events2 = consumeRendererEvents();
+        ASSERT_EQ(1u, events2.size());
+        EXPECT_EQ(SceneVersionTag{ 12u }, events2[0].sceneVersionTag);
+        EXPECT_EQ(std::chrono::milliseconds{ 26 }, events2[0].flushPresentation.latency);
+    }
+
+    TEST_F(ADisplayEventHandler, reportsFlushesOfFramesWithoutFeedbackTogetherWithNextPresentedFrame)
+    {
+        const FlushTime::Clock::time_point flushTime{ std::chrono::milliseconds{ 1000 } };
+        m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag{ 11u }, flushTime);
+        m_displayEventHandler.onFrameSwapped();
+        m_displayEventHandler.onFrameSwapped();
+        m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag{ 12u }, flushTime);
+        m_displayEventHandler.onFrameSwapped();
+
+        // frame 0 discarded, frame 2 presented
+        m_displayEventHandler.onFramePresented(2u, flushTime + std::chrono::milliseconds{ 50 });
+        const auto events = consumeRendererEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_EQ(SceneVersionTag{ 11u }, events[0].sceneVersionTag);
+        EXPECT_EQ(SceneVersionTag{ 12u }, events[1].sceneVersionTag);
+        EXPECT_EQ(flushTime + std::chrono::milliseconds{ 50 }, events[0].flushPresentation.presentationTimestamp);
+        EXPECT_EQ(flushTime + std::chrono::milliseconds{ 50 }, events[1].flushPresentation.presentationTimestamp);
+
+        // nothing left to report
+        m_displayEventHandler.onFramePresented(3u, flushTime + std::chrono::milliseconds{ 66 });
+        EXPECT_TRUE(consumeRendererEvents().empty());
+    }
+
+    TEST_F(ADisplayEventHandler, doesNotCreateFlushPresentedEventForFlushWithoutVersionTag)
+    {
+        m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag::Invalid(), FlushTime::Clock::time_point{ std::chrono::milliseconds{ 1000 } });
+        m_displayEventHandler.onFrameSwapped();
+        m_displayEventHandler.onFramePresented(0u, FlushTime::Clock::time_point{ std::chrono::milliseconds{ 1016 } });
+        EXPECT_TRUE(consumeRendererEvents().empty());
+    }
+
+    TEST_F(ADisplayEventHandler, keepsOnlyLimitedNumberOfFramesWaitingForPresentation)
+    {
+        const FlushTime::Clock::time_point flushTime{ std::chrono::milliseconds{ 1000 } };
+        for (uint64_t i = 0u; i < 100u; ++i)
+        {
+            m_displayEventHandler.onFlushApplied(SceneId{ 1u }, SceneVersionTag{ i }, flushTime);
+            m_displayEventHandler.onFrameSwapped();
+        }
+
+        m_displayEventHandler.onFramePresented(99u, flushTime);
+        const auto events = consumeRendererEvents();
+        ASSERT_FALSE(events.empty());
+        EXPECT_GT(100u, events.size());
+        EXPECT_EQ(SceneVersionTag{ 99u }, events.back().sceneVersionTag);
+    }
 }
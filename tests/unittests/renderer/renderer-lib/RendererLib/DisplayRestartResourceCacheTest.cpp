@@ -0,0 +1,150 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/DisplayRestartResourceCache.h"
+#include "internal/Components/SceneUpdate.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "gtest/gtest.h"
+#include <array>
+
+namespace ramses::internal
+{
+    class ADisplayRestartResourceCache : public testing::Test
+    {
+    protected:
+        static ManagedResource CreateResource(float value)
+        {
+            const std::array<float, 16> data{ value };
+            return std::make_shared<ArrayResource>(EResourceType::VertexArray, uint32_t(data.size()), EDataType::Float, data.data(), std::string_view{});
+        }
+
+        static SceneUpdate CreateUpdate(ManagedResourceVector resources, ResourceContentHashVector removed = {})
+        {
+            SceneUpdate update;
+            update.resources = std::move(resources);
+            update.flushInfos.resourceChanges.m_resourcesRemoved = std::move(removed);
+            return update;
+        }
+
+        void restartScene(SceneId sceneId, ManagedResourceVector resources)
+        {
+            cache.onSceneReceived(sceneId);
+            auto update = CreateUpdate(std::move(resources));
+            cache.cacheAndShareResources(sceneId, update);
+        }
+
+        DisplayRestartResourceCache cache;
+        const SceneId scene1{ 12u };
+        const SceneId scene2{ 13u };
+    };
+
+    TEST_F(ADisplayRestartResourceCache, isEmptyInitially)
+    {
+        EXPECT_EQ(0u, cache.getNumberOfCachedResources());
+    }
+
+    TEST_F(ADisplayRestartResourceCache, keepsReceivedResources)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(2.f);
+        auto update = CreateUpdate({ res1, res2 });
+        cache.cacheAndShareResources(scene1, update);
+
+        EXPECT_EQ(2u, cache.getNumberOfCachedResources());
+        EXPECT_TRUE(cache.hasResource(res1->getHash()));
+        EXPECT_TRUE(cache.hasResource(res2->getHash()));
+        EXPECT_EQ(res1, update.resources[0]);
+        EXPECT_EQ(res2, update.resources[1]);
+    }
+
+    TEST_F(ADisplayRestartResourceCache, replacesResourceReceivedAgainAfterResubscriptionByCachedInstance)
+    {
+        const auto res1 = CreateResource(1.f);
+        restartScene(scene1, { res1 });
+
+        cache.onSceneReceived(scene1);
+        auto update = CreateUpdate({ CreateResource(1.f) });
+        cache.cacheAndShareResources(scene1, update);
+        EXPECT_EQ(res1, update.resources[0]);
+        EXPECT_EQ(1u, cache.getNumberOfCachedResources());
+    }
+
+    TEST_F(ADisplayRestartResourceCache, sharesResourceWithSameContentBetweenScenes)
+    {
+        const auto res1 = CreateResource(1.f);
+        restartScene(scene1, { res1 });
+
+        auto update = CreateUpdate({ CreateResource(1.f) });
+        cache.cacheAndShareResources(scene2, update);
+        EXPECT_EQ(res1, update.resources[0]);
+        EXPECT_EQ(1u, cache.getNumberOfCachedResources());
+    }
+
+    TEST_F(ADisplayRestartResourceCache, releasesResourceRemovedFromScene)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(2.f);
+        restartScene(scene1, { res1, res2 });
+
+        auto update = CreateUpdate({}, { res1->getHash() });
+        cache.cacheAndShareResources(scene1, update);
+        EXPECT_FALSE(cache.hasResource(res1->getHash()));
+        EXPECT_TRUE(cache.hasResource(res2->getHash()));
+    }
+
+    TEST_F(ADisplayRestartResourceCache, keepsResourceRemovedFromOneSceneIfUsedByOther)
+    {
+        const auto res1 = CreateResource(1.f);
+        restartScene(scene1, { res1 });
+        restartScene(scene2, { res1 });
+
+        auto update = CreateUpdate({}, { res1->getHash() });
+        cache.cacheAndShareResources(scene1, update);
+        EXPECT_TRUE(cache.hasResource(res1->getHash()));
+
+        cache.cacheAndShareResources(scene2, update);
+        EXPECT_FALSE(cache.hasResource(res1->getHash()));
+    }
+
+    TEST_F(ADisplayRestartResourceCache, releasesResourcesNotUsedAnymoreInInitialContentOfResubscribedScene)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(2.f);
+        restartScene(scene1, { res1, res2 });
+
+        restartScene(scene1, { res2 });
+        EXPECT_FALSE(cache.hasResource(res1->getHash()));
+        EXPECT_TRUE(cache.hasResource(res2->getHash()));
+    }
+
+    TEST_F(ADisplayRestartResourceCache, doesNotReleaseResourcesNotListedInFollowingUpdates)
+    {
+        const auto res1 = CreateResource(1.f);
+        restartScene(scene1, { res1 });
+
+        auto update = CreateUpdate({ CreateResource(2.f) });
+        cache.cacheAndShareResources(scene1, update);
+        EXPECT_EQ(2u, cache.getNumberOfCachedResources());
+        EXPECT_TRUE(cache.hasResource(res1->getHash()));
+    }
+
+    TEST_F(ADisplayRestartResourceCache, releasesResourcesOfUnpublishedScene)
+    {
+        const auto res1 = CreateResource(1.f);
+        const auto res2 = CreateResource(2.f);
+        restartScene(scene1, { res1, res2 });
+        restartScene(scene2, { res2 });
+
+        cache.onSceneUnpublished(scene1);
+        EXPECT_FALSE(cache.hasResource(res1->getHash()));
+        EXPECT_TRUE(cache.hasResource(res2->getHash()));
+
+        cache.onSceneUnpublished(scene2);
+        EXPECT_EQ(0u, cache.getNumberOfCachedResources());
+    }
+}
@@ -177,6 +177,38 @@ namespace ramses::internal
         EXPECT_EQ(DeviceHandleVector{ bufferHandleOBint }, displaySetup.getInterruptibleOffscreenBuffersToRender(DeviceResourceHandle::Invalid()));
     }
 
+    TEST_F(ADisplaySetup, accumulatesDamagedRegionOfBufferUntilRendered)
+    {
+        const DeviceResourceHandle bufferHandle(33u);
+        displaySetup.registerDisplayBuffer(bufferHandle, viewport, clearColor, false, 0u, false);
+        displaySetup.setDisplayBufferToBeRerendered(bufferHandle, false);
+
+        displaySetup.addDisplayBufferDamage(bufferHandle, { 0, 0, 2, 2 });
+        displaySetup.addDisplayBufferDamage(bufferHandle, { 4, 4, 2, 2 });
+        EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandle).needsRerender);
+        EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandle).partiallyDamaged);
+        EXPECT_EQ(Quad(0, 0, 6, 6), displaySetup.getDisplayBuffer(bufferHandle).damagedRegion);
+
+        displaySetup.setDisplayBufferToBeRerendered(bufferHandle, false);
+        EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandle).needsRerender);
+        EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandle).partiallyDamaged);
+    }
+
+    TEST_F(ADisplaySetup, damagedRegionDoesNotLimitBufferMarkedToBeFullyRerendered)
+    {
+        const DeviceResourceHandle bufferHandle(33u);
+        displaySetup.registerDisplayBuffer(bufferHandle, viewport, clearColor, false, 0u, false);
+        displaySetup.setDisplayBufferToBeRerendered(bufferHandle, false);
+
+        displaySetup.addDisplayBufferDamage(bufferHandle, { 0, 0, 2, 2 });
+        displaySetup.setClearColor(bufferHandle, clearColor);
+        EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandle).needsRerender);
+        EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandle).partiallyDamaged);
+
+        displaySetup.addDisplayBufferDamage(bufferHandle, { 0, 0, 2, 2 });
+        EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandle).partiallyDamaged);
+    }
+
     TEST_F(ADisplaySetup, canMapAndUnmapSceneToBuffer)
     {
         const SceneId scene1(12u);
@@ -502,6 +534,83 @@ namespace ramses::internal
         EXPECT_EQ(expectedBuffersToRerender, displaySetup.getInterruptibleOffscreenBuffersToRender(bufferHandle2));
     }
 
+    TEST_F(ADisplaySetup, rendersBufferWithRenderRateDivisorOnlyEveryNthFrame)
+    {
+        const DeviceResourceHandle bufferHandle(33u);
+        displaySetup.registerDisplayBuffer(bufferHandle, viewport, clearColor, true, 0u, false);
+        displaySetup.setRenderRateDivisor(bufferHandle, 4u);
+        EXPECT_EQ(4u, displaySetup.getDisplayBuffer(bufferHandle).renderRateDivisor);
+
+        // buffer stays marked to re-render in frames it is not allowed to render
+        std::vector<uint32_t> renderFrames;
+        for (uint32_t frame = 0u; frame < 12u; ++frame)
+        {
+            displaySetup.advanceFrame();
+            if (!displaySetup.getNonInterruptibleOffscreenBuffersToRender().empty())
+                renderFrames.push_back(frame);
+            EXPECT_TRUE(displaySetup.getDisplayBuffer(bufferHandle).needsRerender);
+        }
+        ASSERT_EQ(3u, renderFrames.size());
+        EXPECT_EQ(4u, renderFrames[1] - renderFrames[0]);
+        EXPECT_EQ(4u, renderFrames[2] - renderFrames[1]);
+    }
+
+    TEST_F(ADisplaySetup, spreadsRenderFramesOfBuffersWithSameRenderRateDivisor)
+    {
+        const DeviceResourceHandle bufferHandle1(33u);
+        const DeviceResourceHandle bufferHandle2(34u);
+        displaySetup.registerDisplayBuffer(bufferHandle1, viewport, clearColor, true, 0u, false);
+        displaySetup.registerDisplayBuffer(bufferHandle2, viewport, clearColor, true, 0u, false);
+        displaySetup.setRenderRateDivisor(bufferHandle1, 2u);
+        displaySetup.setRenderRateDivisor(bufferHandle2, 2u);
+
+        for (uint32_t frame = 0u; frame < 4u; ++frame)
+        {
+            displaySetup.advanceFrame();
+            EXPECT_EQ(1u, displaySetup.getNonInterruptibleOffscreenBuffersToRender().size());
+        }
+    }
+
+    TEST_F(ADisplaySetup, doesNotRenderBufferWithRenderRateDivisorInItsRenderFrameIfNotMarkedToRerender)
+    {
+        const DeviceResourceHandle bufferHandle(33u);
+        displaySetup.registerDisplayBuffer(bufferHandle, viewport, clearColor, true, 0u, false);
+        displaySetup.setRenderRateDivisor(bufferHandle, 2u);
+        displaySetup.setDisplayBufferToBeRerendered(bufferHandle, false);
+
+        for (uint32_t frame = 0u; frame < 4u; ++frame)
+        {
+            displaySetup.advanceFrame();
+            EXPECT_TRUE(displaySetup.getNonInterruptibleOffscreenBuffersToRender().empty());
+        }
+    }
+
+    TEST_F(ADisplaySetup, offscreenBufferHasNoScaledRenderTargetByDefaultAndCanSetIt)
+    {
+        const DeviceResourceHandle bufferHandle(33u);
+        displaySetup.registerDisplayBuffer(bufferHandle, viewport, clearColor, true, 0u, false);
+        EXPECT_FALSE(displaySetup.getDisplayBuffer(bufferHandle).scaledRenderTarget.isValid());
+
+        displaySetup.setScaledRenderTarget(bufferHandle, DeviceResourceHandle{ 55u });
+        EXPECT_EQ(DeviceResourceHandle{ 55u }, displaySetup.getDisplayBuffer(bufferHandle).scaledRenderTarget);
+    }
+
+    TEST_F(ADisplaySetup, alwaysContinuesRenderingOfInterruptedBufferRegardlessOfItsRenderRateDivisor)
+    {
+        const DeviceResourceHandle bufferHandle1(33u);
+        const DeviceResourceHandle bufferHandle2(34u);
+        displaySetup.registerDisplayBuffer(bufferHandle1, viewport, clearColor, true, 0u, true);
+        displaySetup.registerDisplayBuffer(bufferHandle2, viewport, clearColor, true, 0u, true);
+        displaySetup.setRenderRateDivisor(bufferHandle1, 1000u);
+        displaySetup.setRenderRateDivisor(bufferHandle2, 1000u);
+
+        for (uint32_t frame = 0u; frame < 4u; ++frame)
+        {
+            displaySetup.advanceFrame();
+            EXPECT_EQ(DeviceHandleVector{ bufferHandle1 }, displaySetup.getInterruptibleOffscreenBuffersToRender(bufferHandle1));
+        }
+    }
+
     TEST_F(ADisplaySetup, canAssignAnAlreadyAssignedSceneToAnotherBufferAndPreserveShowState)
     {
         const SceneId scene1(12u);
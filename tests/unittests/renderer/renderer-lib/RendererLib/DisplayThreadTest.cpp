@@ -149,4 +149,77 @@ namespace ramses::internal
         while (m_loopCount < 10)
             std::this_thread::sleep_for(1ms);
     }
+
+    class ADisplayThreadWithIdleWait : public ::testing::Test
+    {
+    public:
+        ADisplayThreadWithIdleWait()
+            : m_displayBundleMock{ static_cast<StrictMock<DisplayBundleMock>&>(*m_sharedDisplayBundle) }
+        {
+            // listener is set by thread and cleared when thread exits
+            EXPECT_CALL(m_displayBundleMock, setWakeUpListener(_)).WillOnce([this](auto listener) { m_wakeUpListener = std::move(listener); }).WillOnce(Return());
+            m_displayThread = std::make_unique<DisplayThread>(m_sharedDisplayBundle, DisplayHandle{ 1u }, m_aliveHandlerMock, false, true);
+            m_displayThread->setMinFrameDuration(1000us);
+
+            EXPECT_CALL(m_aliveHandlerMock, notifyAlive(ThreadAliveNotifierMock::dummyThreadId)).Times(AnyNumber());
+            // long watchdog interval so that it never interrupts idle wait within test
+            EXPECT_CALL(m_aliveHandlerMock, calculateTimeout()).Times(AnyNumber()).WillRepeatedly(Return(10s));
+            EXPECT_CALL(m_displayBundleMock, doOneLoop(ELoopMode::UpdateAndRender, _)).Times(AnyNumber()).WillRepeatedly([this](auto /*unused*/, auto /*unused*/) { m_loopCount++; });
+        }
+
+        void waitForLoops(uint32_t loopCount)
+        {
+            while (m_loopCount < loopCount)
+                std::this_thread::sleep_for(1ms);
+        }
+
+    protected:
+        DisplayBundleShared m_sharedDisplayBundle{ std::make_unique<StrictMock<DisplayBundleMock>>() };
+        StrictMock<DisplayBundleMock>& m_displayBundleMock;
+        AThreadAliveHandlerExpectingOneRegisterAndUnregister m_aliveHandlerMock;
+
+        std::function<void()> m_wakeUpListener;
+        std::atomic_uint32_t m_loopCount{ 0 }; // must outlive thread if used in its mock
+        std::unique_ptr<DisplayThread> m_displayThread;
+    };
+
+    TEST_F(ADisplayThreadWithIdleWait, waitsWhileIdleUntilWokenUp)
+    {
+        EXPECT_CALL(m_displayBundleMock, isIdle()).WillRepeatedly(Return(true));
+        ASSERT_TRUE(m_wakeUpListener);
+
+        m_displayThread->startUpdating();
+        waitForLoops(1u);
+        std::this_thread::sleep_for(50ms);
+        EXPECT_EQ(1u, m_loopCount.load());
+
+        m_wakeUpListener();
+        waitForLoops(2u);
+        std::this_thread::sleep_for(50ms);
+        EXPECT_EQ(2u, m_loopCount.load());
+
+        // thread can be destroyed while waiting
+        m_displayThread.reset();
+    }
+
+    TEST_F(ADisplayThreadWithIdleWait, keepsLoopingWhileNotIdle)
+    {
+        EXPECT_CALL(m_displayBundleMock, isIdle()).WillRepeatedly(Return(false));
+
+        m_displayThread->startUpdating();
+        waitForLoops(10u);
+        m_displayThread.reset();
+    }
+
+    TEST_F(ADisplayThreadWithIdleWait, wakesUpWhenLoopModeChanges)
+    {
+        EXPECT_CALL(m_displayBundleMock, isIdle()).WillRepeatedly(Return(true));
+        EXPECT_CALL(m_displayBundleMock, doOneLoop(ELoopMode::UpdateOnly, _)).WillOnce([this](auto /*unused*/, auto /*unused*/) { m_loopCount++; });
+
+        m_displayThread->startUpdating();
+        waitForLoops(1u);
+        m_displayThread->setLoopMode(ELoopMode::UpdateOnly);
+        waitForLoops(2u);
+        m_displayThread.reset();
+    }
 }
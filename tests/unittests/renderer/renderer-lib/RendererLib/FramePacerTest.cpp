@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/FramePacer.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    using namespace std::chrono_literals;
+
+    class AFramePacer : public ::testing::Test
+    {
+    protected:
+        FramePacer pacer;
+    };
+
+    TEST_F(AFramePacer, delaysFrameByPeriodMinusSafetyMarginIfNoFrameMeasured)
+    {
+        EXPECT_EQ(0us, pacer.getEstimatedFrameCost());
+        EXPECT_EQ(16000us - FramePacer::SafetyMargin, pacer.getDelayBeforeNextFrame(16000us));
+    }
+
+    TEST_F(AFramePacer, followsMoreExpensiveFrameImmediately)
+    {
+        pacer.frameFinished(3000us);
+        EXPECT_EQ(3000us, pacer.getEstimatedFrameCost());
+        pacer.frameFinished(8000us);
+        EXPECT_EQ(8000us, pacer.getEstimatedFrameCost());
+        EXPECT_EQ(16000us - 8000us - FramePacer::SafetyMargin, pacer.getDelayBeforeNextFrame(16000us));
+    }
+
+    TEST_F(AFramePacer, decaysEstimateSlowlyWithCheaperFrames)
+    {
+        pacer.frameFinished(8000us);
+        pacer.frameFinished(0us);
+        EXPECT_EQ(7000us, pacer.getEstimatedFrameCost());
+
+        for (int i = 0; i < 100; ++i)
+            pacer.frameFinished(1000us);
+        EXPECT_LT(pacer.getEstimatedFrameCost(), 1100us);
+        EXPECT_GE(pacer.getEstimatedFrameCost(), 1000us);
+    }
+
+    TEST_F(AFramePacer, doesNotDelayIfFrameCostExceedsPeriod)
+    {
+        pacer.frameFinished(20000us);
+        EXPECT_EQ(0us, pacer.getDelayBeforeNextFrame(16000us));
+        EXPECT_EQ(0us, pacer.getDelayBeforeNextFrame(0us));
+    }
+
+    TEST_F(AFramePacer, ignoresInvalidFrameDuration)
+    {
+        pacer.frameFinished(5000us);
+        pacer.frameFinished(-1us);
+        EXPECT_EQ(5000us, pacer.getEstimatedFrameCost());
+    }
+}
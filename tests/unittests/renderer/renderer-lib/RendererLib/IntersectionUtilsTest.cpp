@@ -370,6 +370,33 @@ namespace ramses::internal
         checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceMiss3, dispResolution, {});
     }
 
+    TEST(IntersectionUtilsTest, picksUpdatedGeometryAfterGeometryBufferChanged)
+    {
+        RendererEventCollector rendererEventCollector;
+        RendererScenes rendererScenes(rendererEventCollector);
+        TransformationLinkCachedScene scene(rendererScenes.getSceneLinksManager(), {});
+        SceneAllocateHelper sceneAllocator(scene);
+        float vertexPositionsTriangle[] = { -1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f };
+        const glm::ivec2 dispResolution = { 1280, 480 };
+
+        const CameraHandle cameraHandle = preparePickableCamera(scene, sceneAllocator, { 0, 0 }, dispResolution, { -4.f, 0.f, 11.f }, { 0.f, -40.f, 0.f }, { 1.f, 1.f, 1.f });
+        DataBufferHandle geometryBuffer = prepareGeometryBuffer(scene, sceneAllocator, vertexPositionsTriangle, sizeof(vertexPositionsTriangle));
+        PickableObjectId pickableId(341u);
+        preparePickableObject(scene, sceneAllocator, geometryBuffer, cameraHandle, pickableId, { 0.1f, 1.0f, -1.0f }, { -70.0f, 0.0f, 0.0f }, { 10.0f, 10.0f, 10.0f });
+
+        const glm::vec2 coordsInViewportSpaceHit = { 0.310937f, 0.354166f };
+        checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, { pickableId });
+        EXPECT_EQ(1u, scene.getPickableGeometryBVH(geometryBuffer).getTriangleCount());
+
+        // move triangle away, cached hierarchy must not be used anymore
+        const float movedVertexPositionsTriangle[] = { 9.f, 0.f, 0.f, 11.f, 0.f, 0.f, 10.f, 1.f, 0.f };
+        scene.updateDataBuffer(geometryBuffer, 0, sizeof(movedVertexPositionsTriangle), reinterpret_cast<const std::byte*>(movedVertexPositionsTriangle));
+        checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, {});
+
+        scene.updateDataBuffer(geometryBuffer, 0, sizeof(vertexPositionsTriangle), reinterpret_cast<const std::byte*>(vertexPositionsTriangle));
+        checkSceneForIntersectedPickableObjects(scene, coordsInViewportSpaceHit, dispResolution, { pickableId });
+    }
+
     TEST(IntersectionUtilsTest, findsMultiplePickedObjectsNotOverlappingInSceneWhenIntersected)
     {
         RendererEventCollector rendererEventCollector;
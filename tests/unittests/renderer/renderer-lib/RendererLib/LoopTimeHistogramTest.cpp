@@ -0,0 +1,63 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/LoopTimeHistogram.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    using namespace std::chrono_literals;
+
+    class ALoopTimeHistogram : public ::testing::Test
+    {
+    protected:
+        LoopTimeHistogram histogram;
+    };
+
+    TEST_F(ALoopTimeHistogram, reportsZeroIfNoSamples)
+    {
+        EXPECT_EQ(0u, histogram.getSampleCount());
+        EXPECT_EQ(0us, histogram.getPercentile(50u));
+        EXPECT_EQ(0us, histogram.getPercentile(100u));
+    }
+
+    TEST_F(ALoopTimeHistogram, reportsUpperBoundOfBucketLimitedByMaximumSample)
+    {
+        for (int i = 0; i < 90; ++i)
+            histogram.addSample(16000us);
+        for (int i = 0; i < 9; ++i)
+            histogram.addSample(20100us);
+        histogram.addSample(33000us);
+
+        EXPECT_EQ(100u, histogram.getSampleCount());
+        EXPECT_EQ(16250us, histogram.getPercentile(50u));
+        EXPECT_EQ(16250us, histogram.getPercentile(90u));
+        EXPECT_EQ(20250us, histogram.getPercentile(99u));
+        EXPECT_EQ(33000us, histogram.getPercentile(100u));
+    }
+
+    TEST_F(ALoopTimeHistogram, reportsMaximumSampleForSamplesOutOfRange)
+    {
+        histogram.addSample(1000us);
+        histogram.addSample(150ms);
+
+        EXPECT_EQ(1250us, histogram.getPercentile(50u));
+        EXPECT_EQ(150ms, histogram.getPercentile(99u));
+    }
+
+    TEST_F(ALoopTimeHistogram, canBeReset)
+    {
+        histogram.addSample(5ms);
+        histogram.reset();
+        EXPECT_EQ(0u, histogram.getSampleCount());
+        EXPECT_EQ(0us, histogram.getPercentile(90u));
+
+        histogram.addSample(1ms);
+        EXPECT_EQ(1ms, histogram.getPercentile(90u));
+    }
+}
@@ -121,7 +121,7 @@ namespace ramses::internal {
         EXPECT_CALL(resourceManager, uploadRenderTarget(renderTargetHandle, _, sceneID));
         EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, _, _, sceneID));
         EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, _, _, _, _, sceneID)).Times(3u); // 3 mips
         EXPECT_CALL(resourceManager, uploadUniformBuffer(uniformBufferHandle, 123u, sceneID));
@@ -167,7 +167,7 @@ namespace ramses::internal {
         EXPECT_CALL(resourceManager, uploadRenderTarget(renderTargetHandle, _, sceneID));
         EXPECT_CALL(resourceManager, uploadBlitPassRenderTargets(blitPassHandle, RenderBufferHandle(81), RenderBufferHandle(82), sceneID));
         EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, _, sceneID));
-        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, sceneID));
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, _, _, _, sceneID));
 
         EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
         EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{0u, 0u, 32, 32}, 32, _, sceneID));
@@ -374,12 +374,95 @@ namespace ramses::internal {
         scene.updateTextureBuffer(textureBufferHandle, 1, 0, 0, 3, 4, data.data());
         PendingSceneResourcesUtils::ConsolidateSceneResourceActions(actionsNew, actions);
 
-        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{1, 1, 12, 13}, 32, _, sceneID));
+        // overlapping areas are merged, disjoint ones uploaded separately
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{1, 1, 6, 5}, 32, _, sceneID));
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{11, 12, 2, 2}, 32, _, sceneID));
         EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 1u, Quad{0, 0, 3, 4}, 16, _, sceneID));
         EXPECT_EQ(actions.size(), 1u);
         PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
     }
 
+    TEST_F(APendingSceneResourcesUtils, textureBufferMergesAreasConnectedByLaterUpdate)
+    {
+        SceneResourceActionVector actions;
+        actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+
+        const std::array<std::byte, 10 * 2> data{};
+        scene.updateTextureBuffer(textureBufferHandle, 0, 0, 0, 2, 2, data.data());
+        scene.updateTextureBuffer(textureBufferHandle, 0, 8, 0, 2, 2, data.data());
+        scene.updateTextureBuffer(textureBufferHandle, 0, 20, 20, 2, 2, data.data());
+        scene.updateTextureBuffer(textureBufferHandle, 0, 1, 1, 8, 1, data.data());
+
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{0, 0, 10, 2}, 32, _, sceneID));
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{20, 20, 2, 2}, 32, _, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+    }
+
+    TEST_F(APendingSceneResourcesUtils, textureBufferCollapsesTooManyDisjointAreasToBoundingQuad)
+    {
+        SceneResourceActionVector actions;
+        actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+
+        const std::array<std::byte, 1> data{};
+        for (int32_t i = 0; i <= int32_t(RendererCachedScene::MaxTextureBufferUpdateQuadsPerMip); ++i)
+            scene.updateTextureBuffer(textureBufferHandle, 0, 2 * (i % 8), 4 * (i / 8), 1, 1, data.data());
+
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{0, 0, 15, 9}, 32, _, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+    }
+
+    TEST_F(APendingSceneResourcesUtils, textureBufferUploadsAllMipsCompletelyAfterCreation)
+    {
+        SceneResourceActionVector actions;
+        actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_CreateTextureBuffer));
+        actions.push_back(SceneResourceAction(textureBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+
+        const std::array<std::byte, 1> data{};
+        scene.updateTextureBuffer(textureBufferHandle, 0, 1, 1, 1, 1, data.data());
+
+        InSequence seq;
+        EXPECT_CALL(resourceManager, uploadTextureBuffer(textureBufferHandle, _, _, _, _, sceneID));
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 0u, Quad{0, 0, 32, 32}, 32, _, sceneID));
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 1u, Quad{0, 0, 16, 16}, 16, _, sceneID));
+        EXPECT_CALL(resourceManager, updateTextureBuffer(textureBufferHandle, 2u, Quad{0, 0, 8, 8}, 8, _, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+    }
+
+    TEST_F(APendingSceneResourcesUtils, dataBufferUploadsOnlyModifiedRange)
+    {
+        SceneResourceActionVector actions;
+        actions.push_back(SceneResourceAction(dataBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer));
+
+        const std::array<std::byte, 2> data{};
+        scene.updateDataBuffer(dataBufferHandle, 5u, 2u, data.data());
+        scene.updateDataBuffer(dataBufferHandle, 2u, 1u, data.data());
+        const auto& dataBuffer = scene.getDataBuffer(dataBufferHandle);
+
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 2u, 5u, dataBuffer.data.data() + 2u, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+
+        // range is reset after upload
+        EXPECT_EQ(0u, scene.getDataBufferUpdate(dataBufferHandle).sizeInBytes);
+        scene.updateDataBuffer(dataBufferHandle, 8u, 2u, data.data());
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 8u, 2u, dataBuffer.data.data() + 8u, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+    }
+
+    TEST_F(APendingSceneResourcesUtils, dataBufferUploadsWholeBufferAfterCreation)
+    {
+        SceneResourceActionVector actions;
+        actions.push_back(SceneResourceAction(dataBufferHandle.asMemoryHandle(), ESceneResourceAction_CreateDataBuffer));
+        actions.push_back(SceneResourceAction(dataBufferHandle.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer));
+
+        const std::array<std::byte, 2> data{};
+        scene.updateDataBuffer(dataBufferHandle, 5u, 2u, data.data());
+
+        InSequence seq;
+        EXPECT_CALL(resourceManager, uploadDataBuffer(dataBufferHandle, _, _, 10u, sceneID));
+        EXPECT_CALL(resourceManager, updateDataBuffer(dataBufferHandle, 0u, 10u, _, sceneID));
+        PendingSceneResourcesUtils::ApplySceneResourceActions(actions, scene, resourceManager);
+    }
+
     TEST_F(APendingSceneResourcesUtils, consolidatesAndAppliesRenderBufferPropertiesUpdate)
     {
         SceneResourceActionVector actions;
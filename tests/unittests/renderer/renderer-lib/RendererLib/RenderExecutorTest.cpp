@@ -263,6 +263,7 @@ namespace ramses::internal {
         DataInstanceHandle dataRef2;
         DataInstanceHandle dataRefBool;
         DataInstanceHandle dataRefMatrix22f;
+        float expectedDataRef2Value = -666.f;
 
         DataLayoutHandle uniformLayout;
         DataLayoutHandle geometryLayout;
@@ -500,7 +501,7 @@ namespace ramses::internal {
             EXPECT_CALL(device, activateTextureSamplerObject(Property(&TextureSamplerStates::hash, Eq(expectedSamplerStates.hash())), textureField)).InSequence(deviceSequence);
             EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureFieldMS))                                                                         .InSequence(deviceSequence);
 
-            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const float*>(Pointee(Eq(-666.f)))))                                     .InSequence(deviceSequence);
+            EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField2, 1, Matcher<const float*>(Pointee(Eq(expectedDataRef2Value)))))                      .InSequence(deviceSequence);
             EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefFieldMatrix22f, 1, Matcher<const glm::mat2*>(Pointee(Eq(glm::mat2(1,2,3,4))))))             .InSequence(deviceSequence);
 
             EXPECT_CALL(device, activateTexture(fakeExternalTextureDeviceHandle, textureFieldExternal)).InSequence(deviceSequence);
@@ -566,6 +567,11 @@ namespace ramses::internal {
             EXPECT_CALL(device, discardDepthStencil()).InSequence(deviceSequence);
         }
 
+        void expectColorBuffersDiscard()
+        {
+            EXPECT_CALL(device, discardColorBuffers()).InSequence(deviceSequence);
+        }
+
         void updateScenes(const RenderableVector& renderablesWithUpdatedVAOs)
         {
             // simulate order of commands done by RendererSceneUpdater
@@ -651,6 +657,20 @@ namespace ramses::internal {
         executeScene();
     }
 
+    TEST_F(ARenderExecutor, SkipsRenderPassIntoRenderTargetWhichIsNotSampledIfEnabled)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        const RenderTargetHandle targetHandle = createRenderTarget(16, 20);
+        scene.setRenderPassClearFlag(pass, EClearFlag::None);
+        scene.setRenderPassRenderTarget(pass, targetHandle);
+        updateScenes({ renderable });
+
+        renderContext.skipPassesWithUnusedOutput = true;
+        executeScene();
+        EXPECT_EQ(1u, scene.getAndResetSkippedRenderingPassesCount());
+    }
+
     TEST_F(ARenderExecutor, RenderRenderableWithoutIndexArray)
     {
         const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -702,7 +722,9 @@ namespace ramses::internal {
             expectClearRenderTarget();
             expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
+            // no color discard after first pass as second pass does not clear and loads color content
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
         }
 
         executeScene();
@@ -742,10 +764,12 @@ namespace ramses::internal {
             expectClearRenderTarget();
             expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix1);
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
             expectActivateRenderTarget(renderTargetDeviceHandle2, true, fakeVp2);
             expectClearRenderTarget();
             expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix2, false, EExpectedRenderStateChange::CausedByClear);
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
         }
 
         executeScene();
@@ -781,6 +805,7 @@ namespace ramses::internal {
             //render states are set again but shader and index buffer do not have to be set again
             expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::CausedByClear);
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
         }
 
         executeScene();
@@ -839,15 +864,19 @@ namespace ramses::internal {
             InSequence seq;
             expectActivateRenderTarget(renderTargetDeviceHandle);
             expectClearRenderTarget(EClearFlag::All);                         // pass 1
+            expectColorBuffersDiscard();                                      // pass 2 clears color
             expectClearRenderTarget(EClearFlag::Color);                       // pass 2
             expectClearRenderTarget(EClearFlag::Depth);                       // pass 3
             expectClearRenderTarget(EClearFlag::Stencil);                     // pass 4
+            expectColorBuffersDiscard();                                      // pass 5 clears color
             expectClearRenderTarget(EClearFlag::Color | EClearFlag::Depth);   // pass 5
+            expectColorBuffersDiscard();                                      // pass 6 clears color
             expectClearRenderTarget(EClearFlag::Color | EClearFlag::Stencil); // pass 6
             expectDepthStencilDiscard();
             expectClearRenderTarget(EClearFlag::Depth | EClearFlag::Stencil); // pass 7
             // pass 8 no clear expectation
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();                                      // pass 1 in next frame clears color
         }
 
         executeScene();
@@ -896,6 +925,175 @@ namespace ramses::internal {
         executeScene();
     }
 
+    TEST_F(ARenderExecutor, DoesNotRenderRenderableWithBoundingSphereOutsideOfFrustum)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams());
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        // camera looks towards negative Z, sphere is behind it
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 10.f, 1.f));
+
+        updateScenes({ renderable });
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        // empty frame
+
+        executeScene();
+        EXPECT_EQ(1u, scene.getAndResetCulledRenderablesCount());
+        EXPECT_EQ(0u, scene.getAndResetCulledRenderablesCount());
+    }
+
+    TEST_F(ARenderExecutor, RendersRenderableWithBoundingSphereIntersectingFrustum)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        // sphere center is behind camera but sphere reaches into frustum
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 1.f, 2.f));
+
+        updateScenes({ renderable });
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        EXPECT_EQ(0u, scene.getAndResetCulledRenderablesCount());
+    }
+
+    TEST_F(ARenderExecutor, CullsRenderableWhenReplayingRecordedRenderPass)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, -10.f, 1.f));
+
+        updateScenes({ renderable });
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+
+        // move camera so that renderable ends up behind it
+        const NodeHandle cameraNode = scene.getCamera(scene.getRenderPass(pass).camera).node;
+        const TransformHandle cameraTransform = findTransformForNode(cameraNode);
+        scene.setTranslation(cameraTransform, glm::vec3(0.f, 0.f, -20.f));
+
+        updateScenes({});
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+        expectActivateFramebufferRenderTarget();
+        if (renderContext.displayBufferClearPending != EClearFlag::None)
+            expectClearRenderTarget(renderContext.displayBufferClearPending);
+        executeScene();
+        EXPECT_EQ(1u, scene.getAndResetCulledRenderablesCount());
+    }
+
+    TEST_F(ARenderExecutor, DrawsInstancesOnlyUpToLastInstanceWithinFrustum)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 0.f, 1.f));
+        scene.setRenderableInstanceCount(renderable, 4u);
+
+        // camera looks towards negative Z, second and last instance are behind it
+        const std::array<glm::vec3, 4u> positions{ glm::vec3{ 0.f, 0.f, -10.f }, glm::vec3{ 0.f, 0.f, 10.f }, glm::vec3{ 0.f, 0.f, -10.f }, glm::vec3{ 0.f, 0.f, 10.f } };
+        const DataBufferHandle instancePositions = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, uint32_t(sizeof(positions)));
+        scene.updateDataBuffer(instancePositions, 0u, uint32_t(sizeof(positions)), reinterpret_cast<const std::byte*>(positions.data()));
+        scene.setRenderableInstancePositions(renderable, instancePositions);
+
+        updateScenes({ renderable });
+        expectActivateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, true);
+        if (renderContext.displayBufferClearPending != EClearFlag::None)
+            expectClearRenderTarget(renderContext.displayBufferClearPending);
+        expectFrameRenderCommands(renderable, glm::mat4(1.f), glm::mat4(1.f), CameraMatrixHelper::ProjectionMatrix(projParams), true, EExpectedRenderStateChange::All, 3u);
+        executeScene();
+        EXPECT_EQ(0u, scene.getAndResetCulledRenderablesCount());
+    }
+
+    TEST_F(ARenderExecutor, DoesNotRenderRenderableWithAllInstancesOutsideOfFrustum)
+    {
+        const RenderPassHandle pass = createRenderPassWithCamera(GetDefaultProjectionParams());
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        // sphere itself would be within frustum, instances are moved behind camera
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, -10.f, 1.f));
+        scene.setRenderableInstanceCount(renderable, 2u);
+
+        const std::array<glm::vec3, 2u> positions{ glm::vec3{ 0.f, 0.f, 20.f }, glm::vec3{ 0.f, 0.f, 30.f } };
+        const DataBufferHandle instancePositions = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, uint32_t(sizeof(positions)));
+        scene.updateDataBuffer(instancePositions, 0u, uint32_t(sizeof(positions)), reinterpret_cast<const std::byte*>(positions.data()));
+        scene.setRenderableInstancePositions(renderable, instancePositions);
+
+        updateScenes({ renderable });
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        // empty frame
+
+        executeScene();
+        EXPECT_EQ(1u, scene.getAndResetCulledRenderablesCount());
+    }
+
+    TEST_F(ARenderExecutor, DrawsAllInstancesIfNotAllInstancePositionsAreProvided)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 0.f, 1.f));
+        scene.setRenderableInstanceCount(renderable, 3u);
+
+        const std::array<glm::vec3, 2u> positions{ glm::vec3{ 0.f, 0.f, -10.f }, glm::vec3{ 0.f, 0.f, 10.f } };
+        const DataBufferHandle instancePositions = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, 3u * uint32_t(sizeof(glm::vec3)));
+        scene.updateDataBuffer(instancePositions, 0u, uint32_t(sizeof(positions)), reinterpret_cast<const std::byte*>(positions.data()));
+        scene.setRenderableInstancePositions(renderable, instancePositions);
+
+        updateScenes({ renderable });
+        expectActivateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, true);
+        if (renderContext.displayBufferClearPending != EClearFlag::None)
+            expectClearRenderTarget(renderContext.displayBufferClearPending);
+        expectFrameRenderCommands(renderable, glm::mat4(1.f), glm::mat4(1.f), CameraMatrixHelper::ProjectionMatrix(projParams), true, EExpectedRenderStateChange::All, 3u);
+        executeScene();
+    }
+
+    TEST_F(ARenderExecutor, DrawsAllInstancesIfInstancePositionsReferToBufferOfOtherType)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 0.f, 1.f));
+        scene.setRenderableInstanceCount(renderable, 2u);
+
+        const std::array<glm::vec4, 2u> data{ glm::vec4{ 0.f, 0.f, 10.f, 0.f }, glm::vec4{ 0.f, 0.f, 10.f, 0.f } };
+        const DataBufferHandle otherBuffer = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector4F, uint32_t(sizeof(data)));
+        scene.updateDataBuffer(otherBuffer, 0u, uint32_t(sizeof(data)), reinterpret_cast<const std::byte*>(data.data()));
+        scene.setRenderableInstancePositions(renderable, otherBuffer);
+
+        updateScenes({ renderable });
+        expectActivateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, true);
+        if (renderContext.displayBufferClearPending != EClearFlag::None)
+            expectClearRenderTarget(renderContext.displayBufferClearPending);
+        expectFrameRenderCommands(renderable, glm::mat4(1.f), glm::mat4(1.f), CameraMatrixHelper::ProjectionMatrix(projParams), true, EExpectedRenderStateChange::All, 2u);
+        executeScene();
+    }
+
+    TEST_F(ARenderExecutor, DrawsIndexRangeOfLevelOfDetailSelectedForPass)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+        // full detail has different range, level of detail has the range expected by render commands
+        scene.setRenderableStartIndex(renderable, 0u);
+        scene.setRenderableIndexCount(renderable, 100u);
+        RenderableLevelsOfDetail levelsOfDetail;
+        levelsOfDetail.levels[0] = { startIndex, indexCount, 0.5f };
+        levelsOfDetail.count = 1u;
+        scene.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+        // small sphere far from camera covers only a small fraction of viewport
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, -10.f, 0.1f));
+
+        updateScenes({ renderable });
+        EXPECT_EQ(1u, scene.getRenderableLevelOfDetail(pass, renderable));
+        expectActivateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, true);
+        if (renderContext.displayBufferClearPending != EClearFlag::None)
+            expectClearRenderTarget(renderContext.displayBufferClearPending);
+        expectFrameRenderCommands(renderable, glm::mat4(1.f), glm::mat4(1.f), CameraMatrixHelper::ProjectionMatrix(projParams));
+        executeScene();
+    }
+
     TEST_F(ARenderExecutor, expectUpdateSceneDefaultMatricesIdentity)
     {
         const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -930,6 +1128,73 @@ namespace ramses::internal {
         Mock::VerifyAndClearExpectations(&device);
     }
 
+    TEST_F(ARenderExecutor, ReplaysRecordedRenderPassWithSameCommandsIfSceneStructureDidNotChange)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+
+        updateScenes({ renderable });
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass));
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+
+        updateScenes({});
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+    }
+
+    TEST_F(ARenderExecutor, ReplaysRecordedRenderPassWithCurrentUniformValues)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(pass));
+
+        updateScenes({ renderable });
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+
+        // value change does not invalidate recording, recorded setter reads new value
+        scene.setDataSingleFloat(dataRef2, DataFieldHandle(0u), 42.f);
+        expectedDataRef2Value = 42.f;
+        updateScenes({});
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+    }
+
+    TEST_F(ARenderExecutor, InvalidatesRecordedRenderPassWhenDataReferenceChanges)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const DataInstances dataInstances = createTestDataInstance();
+        const RenderableHandle renderable = createTestRenderable(dataInstances, createRenderGroup(pass));
+
+        updateScenes({ renderable });
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+
+        scene.setDataReference(dataInstances.first, fakeEffectInputs.dataRefField1, dataRef1);
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass));
+
+        updateScenes({});
+        expectFrameWithSinglePass(renderable, projParams);
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+    }
+
     TEST_F(ARenderExecutor, RendersRenderableWithRendererProjection)
     {
         const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -1060,6 +1325,79 @@ namespace ramses::internal {
         Mock::VerifyAndClearExpectations(&device);
     }
 
+    TEST_F(ARenderExecutor, RendersDepthOnlyPrePassAndShadesWithEqualDepthFunc)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+        scene.setRenderPassDepthPrePass(renderPass, true);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+
+        updateScenes({ renderable });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+
+        // depth only pre-pass
+        expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        // shading pass, only states overridden by pre-pass change
+        EXPECT_CALL(device, depthFunc(EDepthFunc::Equal)).InSequence(deviceSequence);
+        EXPECT_CALL(device, depthWrite(EDepthWrite::Disabled)).InSequence(deviceSequence);
+        EXPECT_CALL(device, colorMask(true, true, true, true)).InSequence(deviceSequence);
+        expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
+    TEST_F(ARenderExecutor, DoesNotWriteStencilInDepthPrePass)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+        scene.setRenderPassDepthPrePass(renderPass, true);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+        const RenderStateHandle state = scene.getRenderable(renderable).renderState;
+        scene.setRenderStateStencilFunc(state, EStencilFunc::Always, 1u, 0xffu);
+        scene.setRenderStateStencilOps(state, EStencilOp::Increment, EStencilOp::Increment, EStencilOp::Increment);
+
+        updateScenes({ renderable });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+
+        // depth only pre-pass
+        expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+        // shading pass applies stencil operations which were disabled in pre-pass
+        EXPECT_CALL(device, depthFunc(EDepthFunc::Equal)).InSequence(deviceSequence);
+        EXPECT_CALL(device, depthWrite(EDepthWrite::Disabled)).InSequence(deviceSequence);
+        EXPECT_CALL(device, stencilOp(EStencilOp::Increment, EStencilOp::Increment, EStencilOp::Increment)).InSequence(deviceSequence);
+        EXPECT_CALL(device, colorMask(true, true, true, true)).InSequence(deviceSequence);
+        expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
+    TEST_F(ARenderExecutor, DoesNotRenderRenderableWithoutDepthWriteInDepthPrePass)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+        scene.setRenderPassDepthPrePass(renderPass, true);
+        const RenderableHandle renderable = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass));
+        scene.setRenderStateDepthWrite(scene.getRenderable(renderable).renderState, EDepthWrite::Disabled);
+
+        updateScenes({ renderable });
+
+        const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+        expectActivateFramebufferRenderTarget();
+        expectClearRenderTarget();
+        expectFrameRenderCommands(renderable, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+
+        executeScene();
+        Mock::VerifyAndClearExpectations(&device);
+    }
+
     TEST_F(ARenderExecutor, UpdatesModelMatrixWhenChangingTranslationRotationOrScalingOfNode)
     {
         const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -1202,6 +1540,7 @@ namespace ramses::internal {
             expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
             expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::None);
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
 
             expectActivateFramebufferRenderTarget(false);
             expectClearRenderTarget();
@@ -1322,6 +1661,7 @@ namespace ramses::internal {
             // even though there are no more renderables to render
             expectActivateRenderTarget(renderTargetDeviceHandle);
             expectDepthStencilDiscard();
+            expectColorBuffersDiscard();
 
             expectActivateFramebufferRenderTarget(false);
             expectClearRenderTarget();
@@ -1395,6 +1735,7 @@ namespace ramses::internal {
         expectClearRenderTarget(EClearFlag::All);
         expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         expectActivateFramebufferRenderTarget(false);
         expectClearRenderTarget(EClearFlag::All);
@@ -1406,6 +1747,38 @@ namespace ramses::internal {
         EXPECT_EQ(EClearFlag::None, renderContext.displayBufferClearPending);
     }
 
+    TEST_F(ARenderExecutor, ScalesViewportOnlyForPassRenderingIntoDisplayBufferWithReducedResolution)
+    {
+        const RenderPassHandle passRT = createRenderPassWithCamera(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
+        const RenderPassHandle passMain = createRenderPassWithCamera(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
+        const RenderableHandle renderable1 = createTestRenderable(createTestDataInstance(), createRenderGroup(passRT));
+        const RenderableHandle renderable2 = createTestRenderable(createTestDataInstance(), createRenderGroup(passMain));
+        const RenderTargetHandle rt = createRenderTarget(16, 20);
+        scene.setRenderPassRenderTarget(passRT, rt);
+        scene.setRenderPassRenderOrder(passRT, 1);
+        scene.setRenderPassRenderOrder(passMain, 2);
+        renderContext.resolutionScale = 0.5f;
+
+        const auto expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(fakeFieldOfView, fakeAspectRatio, fakeNearPlane, fakeFarPlane));
+        updateScenes({ renderable1, renderable2 });
+        const DeviceResourceHandle renderTargetDeviceHandle = resourceManager.getRenderTargetDeviceHandle(rt, scene.getSceneId());
+
+        // render target of scene keeps its resolution
+        expectActivateRenderTarget(renderTargetDeviceHandle);
+        expectClearRenderTarget(EClearFlag::All);
+        expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
+        expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
+
+        // both cameras have same viewport, it is set again scaled for display buffer
+        EXPECT_CALL(device, activateRenderTarget(DeviceMock::FakeFrameBufferRenderTargetDeviceHandle)).InSequence(deviceSequence);
+        EXPECT_CALL(device, setViewport(fakeViewportX / 2, fakeViewportY / 2, fakeViewportWidth / 2u, fakeViewportHeight / 2u)).InSequence(deviceSequence);
+        expectClearRenderTarget(EClearFlag::All);
+        expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, ARenderExecutor::EExpectedRenderStateChange::CausedByClear);
+
+        executeScene();
+    }
+
     TEST_F(ARenderExecutor, ClearsDispBufferBeforeRenderingIntoIt_MainThenRenderTarget)
     {
         const RenderPassHandle passMain = createRenderPassWithCamera(GetDefaultProjectionParams(ECameraProjectionType::Perspective));
@@ -1428,6 +1801,7 @@ namespace ramses::internal {
         expectClearRenderTarget(EClearFlag::All);
         expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, ARenderExecutor::EExpectedRenderStateChange::CausedByClear);
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         executeScene();
 
@@ -1450,6 +1824,7 @@ namespace ramses::internal {
         expectClearRenderTarget(EClearFlag::All);
         expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         executeScene();
 
@@ -1503,6 +1878,7 @@ namespace ramses::internal {
 
         expectActivateRenderTarget(renderTargetDeviceHandle); // will be activated to finish previous pass (although no more renderables to render in it)
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         expectActivateFramebufferRenderTarget(false);
         expectClearRenderTarget(EClearFlag::All);
@@ -1599,6 +1975,7 @@ namespace ramses::internal {
         expectClearRenderTarget();
         expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix, false, EExpectedRenderStateChange::CausedByClear);
         expectDepthStencilDiscard(); // discard for RT
+        expectColorBuffersDiscard();
 
         // pass3
         expectActivateFramebufferRenderTarget(false);
@@ -1626,6 +2003,7 @@ namespace ramses::internal {
         expectClearRenderTarget();
         expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         executeScene();
     }
@@ -1649,6 +2027,7 @@ namespace ramses::internal {
         expectClearRenderTarget();
         expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), expectedProjectionMatrix);
         // dicard would be here if there was a depth component to discard
+        expectColorBuffersDiscard();
 
         executeScene();
     }
@@ -1699,10 +2078,13 @@ namespace ramses::internal {
         const DeviceResourceHandle renderTargetDeviceHandle = resourceManager.getRenderTargetDeviceHandle(targetHandle, scene.getSceneId());
         expectActivateRenderTarget(renderTargetDeviceHandle);
         // pass 1, no clear
+        expectColorBuffersDiscard();                                      // pass 2 clears color
         expectClearRenderTarget(EClearFlag::Color);                       // pass 2
         expectClearRenderTarget(EClearFlag::Depth);                       // pass 3
         expectClearRenderTarget(EClearFlag::Stencil);                     // pass 4
+        expectColorBuffersDiscard();                                      // pass 5 clears color
         expectClearRenderTarget(EClearFlag::Color | EClearFlag::Depth);   // pass 5
+        expectColorBuffersDiscard();                                      // pass 6 clears color
         expectClearRenderTarget(EClearFlag::Color | EClearFlag::Stencil); // pass 6
         expectDepthStencilDiscard(); // next pass (pass8) rendering to RT clears depth+stencil, can discard
 
@@ -1746,7 +2128,8 @@ namespace ramses::internal {
         const DeviceResourceHandle renderTargetDeviceHandle = resourceManager.getRenderTargetDeviceHandle(targetHandle, scene.getSceneId());
         expectActivateRenderTarget(renderTargetDeviceHandle);
         expectClearRenderTarget();
-        // no discard due to blit using depth as source next
+        // no depth discard due to blit using depth as source next, color buffer is not blitted
+        expectColorBuffersDiscard();
 
         // pass2 blit
         EXPECT_CALL(device, blitRenderTargets(_, _, _, _, _)).InSequence(deviceSequence);
@@ -1755,6 +2138,7 @@ namespace ramses::internal {
         expectActivateRenderTarget(renderTargetDeviceHandle, false);
         expectClearRenderTarget();
         expectDepthStencilDiscard();
+        expectColorBuffersDiscard();
 
         executeScene();
     }
@@ -1820,4 +2204,76 @@ namespace ramses::internal {
 
         executeScene();
     }
+
+    TEST_F(ARenderExecutorTimeMs, SetsActiveShaderAnimationFlagUntilUniformTimeAnimationEnd)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const DataInstances dataInstances = createTestDataInstance(true, false);
+        const RenderableHandle renderable = createTestRenderable(dataInstances, createRenderGroup(pass));
+        scene.setRenderPassClearFlag(pass, EClearFlag::None);
+        scene.setDataInstanceUniformTimeAnimationEnd(dataInstances.first, 1000000);
+        const auto expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+
+        scene.setEffectTimeSync(FlushTime::Clock::now());
+
+        updateScenes({ renderable });
+
+        {
+            InSequence seq;
+
+            expectActivateFramebufferRenderTarget();
+            expectClearRenderTarget();
+            expectFrameRenderCommands(renderable,
+                                    glm::identity<glm::mat4>(),
+                                    glm::identity<glm::mat4>(),
+                                    expectedProjectionMatrix,
+                                    true,
+                                    EExpectedRenderStateChange::All,
+                                    1,
+                                    false,
+                                    0);
+        }
+
+        EXPECT_FALSE(scene.hasActiveShaderAnimation());
+        executeScene();
+        EXPECT_TRUE(scene.hasActiveShaderAnimation());
+    }
+
+    TEST_F(ARenderExecutorTimeMs, ClampsUniformTimeAndStopsShaderAnimationAfterUniformTimeAnimationEnd)
+    {
+        const auto projParams = GetDefaultProjectionParams(ECameraProjectionType::Perspective);
+        const RenderPassHandle pass = createRenderPassWithCamera(projParams);
+        const DataInstances dataInstances = createTestDataInstance(true, false);
+        const RenderableHandle renderable = createTestRenderable(dataInstances, createRenderGroup(pass));
+        scene.setRenderPassClearFlag(pass, EClearFlag::None);
+        scene.setDataInstanceUniformTimeAnimationEnd(dataInstances.first, 20000);
+        const auto expectedProjectionMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+
+        scene.setEffectTimeSync(FlushTime::Clock::now() - std::chrono::seconds(60));
+
+        updateScenes({ renderable });
+
+        {
+            InSequence seq;
+
+            expectActivateFramebufferRenderTarget();
+            expectClearRenderTarget();
+            expectFrameRenderCommands(renderable,
+                                    glm::identity<glm::mat4>(),
+                                    glm::identity<glm::mat4>(),
+                                    expectedProjectionMatrix,
+                                    true,
+                                    EExpectedRenderStateChange::All,
+                                    1,
+                                    false,
+                                    20000);
+        }
+
+        // animation still running in previous frame
+        scene.setActiveFiniteShaderAnimation(true);
+        EXPECT_TRUE(scene.hasActiveShaderAnimation());
+        executeScene();
+        EXPECT_FALSE(scene.hasActiveShaderAnimation());
+    }
 }
@@ -11,6 +11,8 @@
 #include "internal/RendererLib/RendererScenes.h"
 #include "internal/RendererLib/RendererEventCollector.h"
 
+#include <array>
+
 namespace ramses::internal
 {
     class ARendererCachedScene : public testing::Test
@@ -1054,6 +1056,458 @@ namespace ramses::internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, stateSortedPassOrdersRenderablesWithSameEffectTogetherAcrossRenderGroups)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group2);
+
+        const ResourceContentHash effect1{ 1, 0 };
+        const ResourceContentHash effect2{ 2, 0 };
+        const DataLayoutHandle layout1 = sceneAllocator.allocateDataLayout({}, effect1);
+        const DataLayoutHandle layout2 = sceneAllocator.allocateDataLayout({}, effect2);
+        scene.setRenderableDataInstance(rend1, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(layout1));
+        scene.setRenderableDataInstance(rend2, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(layout2));
+        scene.setRenderableDataInstance(rend3, ERenderableDataSlotType_Geometry, sceneAllocator.allocateDataInstance(layout1));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        // rend1 and rend3 share effect, state sorting ignores render group boundaries
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, stateSortedPassOrdersRenderablesByRenderStateAndKeepsOrderForSameState)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        const RenderableHandle rend4 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 2);
+        scene.addRenderableToRenderGroup(group, rend3, 3);
+        scene.addRenderableToRenderGroup(group, rend4, 4);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state2);
+        scene.setRenderableRenderState(rend2, state1);
+        scene.setRenderableRenderState(rend3, state2);
+        scene.setRenderableRenderState(rend4, state1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend4, rend1, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, stateSortedPassIsResortedWhenRenderStateOfRenderableChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 2);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state1);
+        scene.setRenderableRenderState(rend2, state2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        scene.setRenderableRenderState(rend1, state2);
+        scene.setRenderableRenderState(rend2, state1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, stateSortedPassOrdersRenderablesSamplingSameTextureTogether)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 2);
+        scene.addRenderableToRenderGroup(group, rend3, 3);
+
+        // rend1 and rend3 use different uniform instances and sampler objects but sample same texture
+        const ResourceContentHash texture1{ 11u, 0u };
+        const ResourceContentHash texture2{ 12u, 0u };
+        sceneHelper.createAndAssignUniformDataInstance(rend1, sceneHelper.createTextureSampler(texture1));
+        sceneHelper.createAndAssignUniformDataInstance(rend2, sceneHelper.createTextureSampler(texture2));
+        sceneHelper.createAndAssignUniformDataInstance(rend3, sceneHelper.createTextureSampler(texture1));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, stateSortedPassIsResortedWhenSampledTextureOfRenderableChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 2);
+        scene.addRenderableToRenderGroup(group, rend3, 3);
+
+        const TextureSamplerHandle sampler1 = sceneHelper.createTextureSampler(ResourceContentHash{ 11u, 0u });
+        const TextureSamplerHandle sampler2 = sceneHelper.createTextureSampler(ResourceContentHash{ 12u, 0u });
+        sceneHelper.createAndAssignUniformDataInstance(rend1, sampler1);
+        sceneHelper.createAndAssignUniformDataInstance(rend2, sampler2);
+        const DataInstanceHandle uniforms3 = sceneHelper.createAndAssignUniformDataInstance(rend3, sampler2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+
+        scene.setDataTextureSamplerHandle(uniforms3, sceneHelper.samplerField, sampler1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, disablingStateSortingRestoresRenderGroupOrder)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassStateSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 2);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state2);
+        scene.setRenderableRenderState(rend2, state1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+
+        scene.setRenderPassStateSorting(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, frontToBackSortedPassOrdersDepthWritingRenderablesByDistanceToCamera)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrontToBackSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderStateHandle opaqueState = sceneAllocator.allocateRenderState();
+        const RenderStateHandle transparentState = sceneAllocator.allocateRenderState();
+        scene.setRenderStateDepthWrite(transparentState, EDepthWrite::Disabled);
+
+        std::array<RenderableHandle, 4u> renderables;
+        std::array<TransformHandle, 4u> transforms;
+        for (size_t i = 0u; i < renderables.size(); ++i)
+        {
+            renderables[i] = sceneHelper.createRenderable();
+            scene.addRenderableToRenderGroup(group, renderables[i], static_cast<int32_t>(i));
+            scene.setRenderableRenderState(renderables[i], opaqueState);
+            const NodeHandle transformNode = sceneAllocator.allocateNode();
+            transforms[i] = sceneAllocator.allocateTransform(transformNode);
+            scene.addChildToNode(transformNode, scene.getRenderable(renderables[i]).node);
+        }
+        // transparent renderable keeps its position in pass order
+        scene.setRenderableRenderState(renderables[1], transparentState);
+
+        // camera looks along negative Z
+        scene.setTranslation(transforms[0], glm::vec3(0.f, 0.f, -5.f));
+        scene.setTranslation(transforms[1], glm::vec3(0.f, 0.f, -9.f));
+        scene.setTranslation(transforms[2], glm::vec3(0.f, 0.f, -1.f));
+        scene.setTranslation(transforms[3], glm::vec3(0.f, 0.f, -3.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[2], renderables[1], renderables[3], renderables[0] });
+
+        // resorted when transformations change
+        scene.setTranslation(transforms[2], glm::vec3(0.f, 0.f, -7.f));
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[3], renderables[1], renderables[0], renderables[2] });
+
+        scene.setRenderPassFrontToBackSorting(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[0], renderables[1], renderables[2], renderables[3] });
+    }
+
+    TEST_F(ARendererCachedScene, backToFrontSortedPassOrdersBlendedRenderablesByDistanceToCameraFarthestFirst)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassBackToFrontSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderStateHandle opaqueState = sceneAllocator.allocateRenderState();
+        const RenderStateHandle transparentState = sceneAllocator.allocateRenderState();
+        scene.setRenderStateBlendOperations(transparentState, EBlendOperation::Add, EBlendOperation::Add);
+        scene.setRenderStateDepthWrite(transparentState, EDepthWrite::Disabled);
+
+        std::array<RenderableHandle, 5u> renderables;
+        std::array<TransformHandle, 5u> transforms;
+        for (size_t i = 0u; i < renderables.size(); ++i)
+        {
+            renderables[i] = sceneHelper.createRenderable();
+            scene.addRenderableToRenderGroup(group, renderables[i], static_cast<int32_t>(i));
+            scene.setRenderableRenderState(renderables[i], transparentState);
+            const NodeHandle transformNode = sceneAllocator.allocateNode();
+            transforms[i] = sceneAllocator.allocateTransform(transformNode);
+            scene.addChildToNode(transformNode, scene.getRenderable(renderables[i]).node);
+        }
+        // opaque renderable keeps its position in pass order
+        scene.setRenderableRenderState(renderables[1], opaqueState);
+
+        // camera looks along negative Z, renderables 3 and 4 have equal depth and keep their relative order
+        scene.setTranslation(transforms[0], glm::vec3(0.f, 0.f, -5.f));
+        scene.setTranslation(transforms[1], glm::vec3(0.f, 0.f, -1.f));
+        scene.setTranslation(transforms[2], glm::vec3(0.f, 0.f, -9.f));
+        scene.setTranslation(transforms[3], glm::vec3(0.f, 0.f, -3.f));
+        scene.setTranslation(transforms[4], glm::vec3(1.f, 0.f, -3.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[2], renderables[1], renderables[0], renderables[3], renderables[4] });
+
+        // resorted when transformations change, also behind camera
+        scene.setTranslation(transforms[4], glm::vec3(0.f, 0.f, 2.f));
+        scene.setTranslation(transforms[0], glm::vec3(0.f, 0.f, -20.f));
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[0], renderables[1], renderables[2], renderables[3], renderables[4] });
+
+        scene.setTranslation(transforms[4], glm::vec3(0.f, 0.f, -30.f));
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[4], renderables[1], renderables[0], renderables[2], renderables[3] });
+
+        scene.setRenderPassBackToFrontSorting(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { renderables[0], renderables[1], renderables[2], renderables[3], renderables[4] });
+    }
+
+    TEST_F(ARendererCachedScene, backToFrontSortingCanBeCombinedWithFrontToBackSorting)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrontToBackSorting(pass, true);
+        scene.setRenderPassBackToFrontSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderStateHandle opaqueState = sceneAllocator.allocateRenderState();
+        const RenderStateHandle transparentState = sceneAllocator.allocateRenderState();
+        const RenderStateHandle backgroundState = sceneAllocator.allocateRenderState();
+        scene.setRenderStateBlendOperations(transparentState, EBlendOperation::Add, EBlendOperation::Add);
+        scene.setRenderStateDepthWrite(transparentState, EDepthWrite::Disabled);
+        scene.setRenderStateDepthWrite(backgroundState, EDepthWrite::Disabled);
+
+        const std::array<RenderStateHandle, 5u> states{ backgroundState, opaqueState, opaqueState, transparentState, transparentState };
+        std::array<RenderableHandle, 5u> renderables;
+        for (size_t i = 0u; i < renderables.size(); ++i)
+        {
+            renderables[i] = sceneHelper.createRenderable();
+            scene.addRenderableToRenderGroup(group, renderables[i], static_cast<int32_t>(i));
+            scene.setRenderableRenderState(renderables[i], states[i]);
+            const NodeHandle transformNode = sceneAllocator.allocateNode();
+            const TransformHandle transform = sceneAllocator.allocateTransform(transformNode);
+            scene.addChildToNode(transformNode, scene.getRenderable(renderables[i]).node);
+            scene.setTranslation(transform, glm::vec3(0.f, 0.f, -static_cast<float>(i + 1u)));
+        }
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        // background without blending keeps its slot, opaque nearest first, transparent farthest first
+        expectOrderedRenderablesInPass(pass, { renderables[0], renderables[1], renderables[2], renderables[4], renderables[3] });
+    }
+
+    TEST_F(ARendererCachedScene, selectsLevelOfDetailByScreenSizeWithHysteresis)
+    {
+        RenderableLevelsOfDetail levelsOfDetail;
+        levelsOfDetail.levels[0] = { 10u, 6u, 0.5f };
+        levelsOfDetail.levels[1] = { 16u, 3u, 0.1f };
+        levelsOfDetail.count = 2u;
+
+        EXPECT_EQ(0u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.8f, 0u));
+        EXPECT_EQ(1u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.3f, 0u));
+        EXPECT_EQ(2u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.05f, 0u));
+
+        // previous level is kept within hysteresis band around threshold
+        EXPECT_EQ(0u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.48f, 0u));
+        EXPECT_EQ(1u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.44f, 0u));
+        EXPECT_EQ(1u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.52f, 1u));
+        EXPECT_EQ(0u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.56f, 1u));
+        // not kept if more levels are crossed and not all thresholds are within band
+        EXPECT_EQ(2u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.095f, 0u));
+        // previous level which does not exist anymore is ignored
+        EXPECT_EQ(1u, RendererCachedScene::SelectLevelOfDetail(levelsOfDetail, 0.48f, 3u));
+    }
+
+    TEST_F(ARendererCachedScene, selectsLevelOfDetailPerPassUsingPassCameraAndWorldMatrix)
+    {
+        // camera with near plane at 0.1 and vertical extent 2 at near plane, projected diameter of sphere is radius * 0.1 / distance
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle renderable = sceneHelper.createRenderable(group);
+        const RenderableHandle renderableWithoutSphere = sceneHelper.createRenderable(group);
+
+        RenderableLevelsOfDetail levelsOfDetail;
+        levelsOfDetail.levels[0] = { 10u, 6u, 0.5f };
+        levelsOfDetail.levels[1] = { 16u, 3u, 0.1f };
+        levelsOfDetail.count = 2u;
+        scene.setRenderableLevelsOfDetail(renderable, levelsOfDetail);
+        scene.setRenderableLevelsOfDetail(renderableWithoutSphere, levelsOfDetail);
+        scene.setRenderableBoundingSphere(renderable, glm::vec4(0.f, 0.f, 0.f, 1.f));
+
+        const NodeHandle transformNode = sceneAllocator.allocateNode();
+        const TransformHandle transform = sceneAllocator.allocateTransform(transformNode);
+        scene.addChildToNode(transformNode, scene.getRenderable(renderable).node);
+
+        // screen size 1.0
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, -0.1f));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(0u, scene.getRenderableLevelOfDetail(pass, renderable));
+        EXPECT_EQ(0u, scene.getRenderableLevelOfDetail(pass, renderableWithoutSphere));
+
+        // screen size 0.25
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, -0.4f));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(1u, scene.getRenderableLevelOfDetail(pass, renderable));
+
+        // scaled sphere, screen size 0.5 is within hysteresis band
+        scene.setScaling(transform, glm::vec3(2.f));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(1u, scene.getRenderableLevelOfDetail(pass, renderable));
+
+        // screen size 0.05
+        scene.setScaling(transform, glm::vec3(1.f));
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, -2.f));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(2u, scene.getRenderableLevelOfDetail(pass, renderable));
+        EXPECT_EQ(0u, scene.getRenderableLevelOfDetail(pass, renderableWithoutSphere));
+
+        // sphere center behind camera
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, 2.f));
+        scene.updateRenderableWorldMatrices();
+        EXPECT_EQ(0u, scene.getRenderableLevelOfDetail(pass, renderable));
+    }
+
+    TEST_F(ARendererCachedScene, frontToBackSortingInvalidatesRecordedPassOnlyIfOrderChanges)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassFrontToBackSorting(pass, true);
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderStateHandle state = sceneAllocator.allocateRenderState();
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        scene.setRenderableRenderState(rend1, state);
+        scene.setRenderableRenderState(rend2, state);
+        const NodeHandle transformNode = sceneAllocator.allocateNode();
+        const TransformHandle transform = sceneAllocator.allocateTransform(transformNode);
+        scene.addChildToNode(transformNode, scene.getRenderable(rend1).node);
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, -2.f));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { rend2, rend1 });
+
+        scene.markRecordedRenderPassValid(pass);
+        scene.updateRenderableWorldMatrices();
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass));
+
+        scene.setTranslation(transform, glm::vec3(0.f, 0.f, 2.f));
+        scene.updateRenderableWorldMatrices();
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass));
+    }
+
+    TEST_F(ARendererCachedScene, rebuildsOnlyPassesContainingChangedRenderGroup)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass1);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass2);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        scene.addRenderGroupToRenderGroup(group1, nestedGroup, 1);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group1, group2);
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.markRecordedRenderPassValid(pass1);
+        scene.markRecordedRenderPassValid(pass2);
+
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, { rend1 });
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass1));
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass2));
+
+        scene.markRecordedRenderPassValid(pass1);
+        scene.removeRenderGroupFromRenderPass(pass2, group2);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2 });
+        expectOrderedRenderablesInPass(pass2, {});
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass1));
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass2));
+    }
+
+    TEST_F(ARendererCachedScene, removesHiddenRenderableInPlaceAndRebuildsOnlyPassesContainingShownRenderable)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass1);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass2);
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group1, rend1, 1);
+        scene.addRenderableToRenderGroup(group1, rend2, 2);
+        scene.addRenderableToRenderGroup(group1, rend3, 3);
+        scene.addRenderableToRenderGroup(group2, rend3, 0);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.markRecordedRenderPassValid(pass1);
+        scene.markRecordedRenderPassValid(pass2);
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        expectOrderedRenderablesInPass(pass1, { rend1, rend3 });
+        expectOrderedRenderablesInPass(pass2, { rend3 });
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass1));
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass2));
+
+        scene.markRecordedRenderPassValid(pass1);
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        expectOrderedRenderablesInPass(pass1, { rend1, rend2, rend3 });
+        expectOrderedRenderablesInPass(pass2, { rend3 });
+        EXPECT_FALSE(scene.isRecordedRenderPassValid(pass1));
+        EXPECT_TRUE(scene.isRecordedRenderPassValid(pass2));
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1293,6 +1747,66 @@ namespace ramses::internal
         EXPECT_TRUE(orderedPasses.empty());
     }
 
+    TEST_F(ARendererCachedScene, spreadsRenderOncePassesOverFramesInRenderOrderIfLimited)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass3 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderOrder(pass1, 2);
+        scene.setRenderPassRenderOrder(pass2, 1);
+        scene.setRenderPassRenderOrder(pass3, 0);
+        scene.setRenderPassRenderOnce(pass1, true);
+        scene.setRenderPassRenderOnce(pass2, true);
+        scene.setRenderPassRenderOnce(pass3, true);
+        scene.setRenderOncePassesPerFrameLimit(2u);
+        EXPECT_TRUE(scene.hasRenderOncePassesForLaterFrames());
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(2u, orderedPasses.size());
+        EXPECT_EQ(pass3, orderedPasses[0].getRenderPassHandle());
+        EXPECT_EQ(pass2, orderedPasses[1].getRenderPassHandle());
+
+        scene.markAllRenderOncePassesAsRendered();
+        EXPECT_FALSE(scene.hasRenderOncePassesForLaterFrames());
+        EXPECT_TRUE(scene.hasRenderOncePassesToRender());
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(pass1, orderedPasses[0].getRenderPassHandle());
+
+        scene.markAllRenderOncePassesAsRendered();
+        EXPECT_FALSE(scene.hasRenderOncePassesToRender());
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(orderedPasses.empty());
+    }
+
+    TEST_F(ARendererCachedScene, rendersOnlyRenderOncePassesDuringWarmUpTillLastFrameOfThem)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle renderOncePass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle renderOncePass2 = sceneHelper.createRenderPassWithCamera();
+        scene.setRenderPassRenderOrder(renderOncePass1, 0);
+        scene.setRenderPassRenderOrder(renderOncePass2, 1);
+        scene.setRenderPassRenderOrder(pass, 2);
+        scene.setRenderPassRenderOnce(renderOncePass1, true);
+        scene.setRenderPassRenderOnce(renderOncePass2, true);
+        scene.setRenderOncePassesPerFrameLimit(1u);
+        scene.setRenderOncePassesWarmUp(true);
+        EXPECT_TRUE(scene.isRenderOncePassesWarmUp());
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        const RenderingPassInfoVector& orderedPasses = scene.getSortedRenderingPasses();
+        ASSERT_EQ(1u, orderedPasses.size());
+        EXPECT_EQ(renderOncePass1, orderedPasses[0].getRenderPassHandle());
+
+        // last render once pass fits into frame, regular content is rendered with it
+        scene.markAllRenderOncePassesAsRendered();
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        ASSERT_EQ(2u, orderedPasses.size());
+        EXPECT_EQ(renderOncePass2, orderedPasses[0].getRenderPassHandle());
+        EXPECT_EQ(pass, orderedPasses[1].getRenderPassHandle());
+    }
+
     TEST_F(ARendererCachedScene, doesNotCacheDisabledRenderOncePass)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1434,4 +1948,317 @@ namespace ramses::internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    class ARendererCachedSceneWithOffscreenPasses : public ARendererCachedScene
+    {
+    protected:
+        RenderPassHandle createPassRenderingInto(RenderTargetHandle renderTarget, int32_t renderOrder)
+        {
+            const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+            scene.setRenderPassRenderTarget(pass, renderTarget);
+            scene.setRenderPassRenderOrder(pass, renderOrder);
+            return pass;
+        }
+
+        RenderTargetHandle createRenderTargetWithBuffer(RenderBufferHandle buffer)
+        {
+            const RenderTargetHandle renderTarget = sceneAllocator.allocateRenderTarget();
+            scene.addRenderTargetRenderBuffer(renderTarget, buffer);
+            return renderTarget;
+        }
+
+        RenderBufferHandle createRenderBuffer()
+        {
+            return sceneAllocator.allocateRenderBuffer({ 16u, 12u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u });
+        }
+
+        void sampleBufferInPass(RenderPassHandle pass, RenderBufferHandle buffer)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable(sceneHelper.createRenderGroup(pass));
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSampler(buffer));
+        }
+
+        bool isOutputUsed(RenderPassHandle pass) const
+        {
+            const auto& passes = scene.getSortedRenderingPasses();
+            const auto it = std::find_if(passes.cbegin(), passes.cend(), [pass](const auto& p) { return p.getType() == ERenderingPassType::RenderPass && p.getRenderPassHandle() == pass; });
+            EXPECT_TRUE(it != passes.cend());
+            return scene.isRenderingPassOutputUsed(static_cast<size_t>(std::distance(passes.cbegin(), it)));
+        }
+    };
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassRenderingIntoFramebuffer)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(pass));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUnusedOutputOfPassRenderingIntoRenderTargetNotSampledByAnyPass)
+    {
+        const RenderPassHandle pass = createPassRenderingInto(createRenderTargetWithBuffer(createRenderBuffer()), 0);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(isOutputUsed(pass));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfRenderOncePassEvenIfNotSampled)
+    {
+        const RenderPassHandle pass = createPassRenderingInto(createRenderTargetWithBuffer(createRenderBuffer()), 0);
+        scene.setRenderPassRenderOnce(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(pass));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassOnlyIfSampledByPassWithUsedOutput)
+    {
+        const RenderBufferHandle buffer = createRenderBuffer();
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(buffer), 0);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 1);
+        sampleBufferInPass(consumer, buffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(producer));
+        EXPECT_TRUE(isOutputUsed(consumer));
+
+        // consumer renders into render target which is not sampled, so its input is not needed either
+        scene.setRenderPassRenderTarget(consumer, createRenderTargetWithBuffer(createRenderBuffer()));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(isOutputUsed(producer));
+        EXPECT_FALSE(isOutputUsed(consumer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUnusedOutputOfPassWhenConsumerPassDisabled)
+    {
+        const RenderBufferHandle buffer = createRenderBuffer();
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(buffer), 0);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 1);
+        sampleBufferInPass(consumer, buffer);
+
+        scene.setRenderPassEnabled(consumer, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(isOutputUsed(producer));
+
+        scene.setRenderPassEnabled(consumer, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(producer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassOnceConsumerSwitchesToUniformsSamplingIt)
+    {
+        const RenderBufferHandle buffer = createRenderBuffer();
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(buffer), 0);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 1);
+        const RenderableHandle renderable = sceneHelper.createRenderable(sceneHelper.createRenderGroup(consumer));
+        const DataInstanceHandle samplingUniforms = sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSampler(buffer));
+        const DataInstanceHandle otherUniforms = sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSampler(createRenderBuffer()));
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(isOutputUsed(producer));
+
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, samplingUniforms);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(producer));
+
+        scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, otherUniforms);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(isOutputUsed(producer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassSampledByConsumerRenderedBeforeIt)
+    {
+        // consumer samples result of previous frame
+        const RenderBufferHandle buffer = createRenderBuffer();
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 0);
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(buffer), 1);
+        sampleBufferInPass(consumer, buffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(producer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassBlittedIntoSampledBuffer)
+    {
+        const RenderBufferHandle renderedBuffer = createRenderBuffer();
+        const RenderBufferHandle blittedBuffer = createRenderBuffer();
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(renderedBuffer), 0);
+        const BlitPassHandle blitPass = sceneAllocator.allocateBlitPass(renderedBuffer, blittedBuffer);
+        scene.setBlitPassRenderOrder(blitPass, 1);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 2);
+        sampleBufferInPass(consumer, blittedBuffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        ASSERT_EQ(3u, scene.getSortedRenderingPasses().size());
+        EXPECT_TRUE(scene.isRenderingPassOutputUsed(1u));
+        EXPECT_TRUE(isOutputUsed(producer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, hasUsedOutputOfPassSharingDepthBufferWithUsedRenderTarget)
+    {
+        const RenderBufferHandle depthBuffer = sceneAllocator.allocateRenderBuffer({ 16u, 12u, EPixelStorageFormat::Depth24, ERenderBufferAccessMode::WriteOnly, 0u });
+        const RenderBufferHandle sampledBuffer = createRenderBuffer();
+        const RenderTargetHandle renderTarget1 = createRenderTargetWithBuffer(createRenderBuffer());
+        scene.addRenderTargetRenderBuffer(renderTarget1, depthBuffer);
+        const RenderTargetHandle renderTarget2 = createRenderTargetWithBuffer(sampledBuffer);
+        scene.addRenderTargetRenderBuffer(renderTarget2, depthBuffer);
+
+        const RenderPassHandle depthPrePass = createPassRenderingInto(renderTarget1, 0);
+        const RenderPassHandle producer = createPassRenderingInto(renderTarget2, 1);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 2);
+        sampleBufferInPass(consumer, sampledBuffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(isOutputUsed(depthPrePass));
+        EXPECT_TRUE(isOutputUsed(producer));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, canDiscardColorOfRenderTargetAfterLastSamplingUntilNextClear)
+    {
+        const RenderBufferHandle buffer = createRenderBuffer();
+        const RenderPassHandle producer = createPassRenderingInto(createRenderTargetWithBuffer(buffer), 0);
+        const RenderPassHandle consumer = createPassRenderingInto(RenderTargetHandle::Invalid(), 1);
+        sampleBufferInPass(consumer, buffer);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(0u));
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(1u)); // framebuffer is never discarded
+
+        // consumer samples result of previous frame, next access to buffer is clear by producer
+        scene.setRenderPassRenderOrder(consumer, -1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(1u));
+
+        scene.setRenderPassEnabled(consumer, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.canDiscardRenderingPassColorBuffers(0u));
+        ASSERT_EQ(producer, scene.getSortedRenderingPasses()[0u].getRenderPassHandle());
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, cannotDiscardColorOfRenderTargetLoadedByNextPassOrRenderedOnce)
+    {
+        const RenderTargetHandle renderTarget = createRenderTargetWithBuffer(createRenderBuffer());
+        const RenderPassHandle pass1 = createPassRenderingInto(renderTarget, 0);
+        const RenderPassHandle pass2 = createPassRenderingInto(renderTarget, 1);
+        scene.setRenderPassClearFlag(pass2, EClearFlag::Depth);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(0u));
+        EXPECT_TRUE(scene.canDiscardRenderingPassColorBuffers(1u));
+
+        scene.setRenderPassRenderOnce(pass2, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(0u));
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(1u));
+
+        scene.setRenderPassRenderOnce(pass2, false);
+        scene.setRenderPassClearFlag(pass1, EClearFlag::None);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(0u));
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(1u));
+    }
+
+    TEST_F(ARendererCachedSceneWithOffscreenPasses, cannotDiscardColorOfRenderTargetUsedAsBlitSource)
+    {
+        const RenderBufferHandle buffer = createRenderBuffer();
+        createPassRenderingInto(createRenderTargetWithBuffer(buffer), 0);
+        const BlitPassHandle blitPass = sceneAllocator.allocateBlitPass(buffer, createRenderBuffer());
+        scene.setBlitPassRenderOrder(blitPass, 1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_FALSE(scene.canDiscardRenderingPassColorBuffers(0u));
+    }
+
+    class ARendererCachedSceneWithTransientRenderTargets : public ARendererCachedSceneWithOffscreenPasses
+    {
+    protected:
+        // chain of passes, each sampling output of previous one (e.g. blur chain), last one renders into framebuffer
+        void createPassChain(std::initializer_list<RenderBufferHandle> buffers)
+        {
+            int32_t renderOrder = 0;
+            RenderBufferHandle previousBuffer;
+            for (const auto buffer : buffers)
+            {
+                const RenderTargetHandle renderTarget = createRenderTargetWithBuffer(buffer);
+                renderTargets.push_back(renderTarget);
+                passes.push_back(createPassRenderingInto(renderTarget, renderOrder++));
+                if (previousBuffer.isValid())
+                    sampleBufferInPass(passes.back(), previousBuffer);
+                previousBuffer = buffer;
+            }
+            passes.push_back(createPassRenderingInto(RenderTargetHandle::Invalid(), renderOrder));
+            sampleBufferInPass(passes.back(), previousBuffer);
+        }
+
+        std::vector<RenderTargetHandle> renderTargets;
+        std::vector<RenderPassHandle> passes;
+    };
+
+    TEST_F(ARendererCachedSceneWithTransientRenderTargets, aliasesRenderTargetsWithDisjointLifetimesWithinFrame)
+    {
+        const RenderBufferHandle buffer1 = createRenderBuffer();
+        const RenderBufferHandle buffer2 = createRenderBuffer();
+        const RenderBufferHandle buffer3 = createRenderBuffer();
+        createPassChain({ buffer1, buffer2, buffer3 });
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        const RenderTargetAliases expectedAliases{ { renderTargets[2], { buffer3 }, renderTargets[0], { buffer1 } } };
+        EXPECT_EQ(expectedAliases, scene.getRenderTargetAliases());
+        EXPECT_TRUE(scene.haveRenderTargetAliasesChanged());
+        EXPECT_FALSE(scene.haveRenderTargetAliasesChanged());
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_EQ(expectedAliases, scene.getRenderTargetAliases());
+        EXPECT_FALSE(scene.haveRenderTargetAliasesChanged());
+    }
+
+    TEST_F(ARendererCachedSceneWithTransientRenderTargets, doesNotAliasRenderTargetWithIncompatibleBuffers)
+    {
+        const RenderBufferHandle buffer1 = createRenderBuffer();
+        const RenderBufferHandle buffer2 = createRenderBuffer();
+        const RenderBufferHandle buffer3 = sceneAllocator.allocateRenderBuffer({ 8u, 6u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u });
+        createPassChain({ buffer1, buffer2, buffer3 });
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getRenderTargetAliases().empty());
+        EXPECT_FALSE(scene.haveRenderTargetAliasesChanged());
+    }
+
+    TEST_F(ARendererCachedSceneWithTransientRenderTargets, doesNotAliasRenderTargetSampledBeforeItIsRendered)
+    {
+        const RenderBufferHandle buffer1 = createRenderBuffer();
+        const RenderBufferHandle buffer2 = createRenderBuffer();
+        const RenderBufferHandle buffer3 = createRenderBuffer();
+        createPassChain({ buffer1, buffer2, buffer3 });
+        // content of previous frame is sampled
+        sampleBufferInPass(passes[0], buffer3);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getRenderTargetAliases().empty());
+    }
+
+    TEST_F(ARendererCachedSceneWithTransientRenderTargets, stopsAliasingRenderTargetWhichIsNotFullyClearedOrRenderedOnce)
+    {
+        const RenderBufferHandle buffer1 = createRenderBuffer();
+        const RenderBufferHandle buffer2 = createRenderBuffer();
+        const RenderBufferHandle buffer3 = createRenderBuffer();
+        createPassChain({ buffer1, buffer2, buffer3 });
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_EQ(1u, scene.getRenderTargetAliases().size());
+        EXPECT_TRUE(scene.haveRenderTargetAliasesChanged());
+
+        scene.setRenderPassClearFlag(passes[2], EClearFlag::Color);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getRenderTargetAliases().empty());
+        EXPECT_TRUE(scene.haveRenderTargetAliasesChanged());
+
+        scene.setRenderPassClearFlag(passes[2], EClearFlag::All);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_EQ(1u, scene.getRenderTargetAliases().size());
+        EXPECT_TRUE(scene.haveRenderTargetAliasesChanged());
+
+        scene.setRenderPassRenderOnce(passes[0], true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getRenderTargetAliases().empty());
+        EXPECT_TRUE(scene.haveRenderTargetAliasesChanged());
+    }
 }
@@ -147,6 +147,23 @@ namespace ramses::internal {
         visitor.visit(destinationContainer);
     }
 
+    TEST_F(ARendererCommandBuffer, consumesAddedCommandsRegardlessOfPendingCommands)
+    {
+        RendererCommandBuffer buffer;
+        RendererCommands cmds;
+        cmds.push_back(RendererCommand::SceneUnpublished{ sceneId });
+        buffer.addAndConsumeCommandsFrom(cmds);
+        EXPECT_TRUE(cmds.empty());
+
+        cmds.push_back(RendererCommand::SceneUnpublished{ sceneId });
+        buffer.addAndConsumeCommandsFrom(cmds);
+        EXPECT_TRUE(cmds.empty());
+
+        RendererCommands result;
+        buffer.swapCommands(result);
+        EXPECT_EQ(2u, result.size());
+    }
+
     TEST_F(ARendererCommandBuffer, addCommandsFromVariousContainersToContainerInAnotherThread)
     {
         // 2 threads providing commands (e.g. scene control and renderer HL cmd queues)
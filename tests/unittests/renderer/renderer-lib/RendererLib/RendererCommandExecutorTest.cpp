@@ -147,6 +147,7 @@ namespace ramses::internal {
             EXPECT_EQ(std::string("file"), info.filename);
             EXPECT_TRUE(info.fullScreen);
             EXPECT_TRUE(info.sendViaDLT);
+            EXPECT_FALSE(info.async);
         }));
         doCommandExecutorLoop();
 
@@ -273,6 +274,17 @@ namespace ramses::internal {
         doCommandExecutorLoop();
     }
 
+    TEST_F(ARendererCommandExecutor, updatesExternalBufferFromDmaBuffer)
+    {
+        constexpr ExternalBufferHandle buffer{ 123u };
+        constexpr DisplayHandle display{ 1 };
+        const DmaBufferFrame frame{ 11, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } };
+
+        m_commandBuffer.enqueueCommand(RendererCommand::UpdateExternalBufferDmaBuffer{ display, buffer, frame });
+        EXPECT_CALL(m_sceneUpdater, handleExternalBufferDmaBufferUpdate(buffer, frame));
+        doCommandExecutorLoop();
+    }
+
     TEST_F(ARendererCommandExecutor, linkExternalBufferToConsumer)
     {
         constexpr ExternalBufferHandle buffer{ 1u };
@@ -451,6 +463,36 @@ namespace ramses::internal {
         doCommandExecutorLoop();
     }
 
+    TEST_F(ARendererCommandExecutor, setRenderRateDivisor)
+    {
+        constexpr DisplayHandle display{ 1 };
+        constexpr OffscreenBufferHandle buffer{ 2 };
+
+        m_commandBuffer.enqueueCommand(RendererCommand::SetRenderRateDivisor{ display, buffer, 4u });
+        EXPECT_CALL(m_sceneUpdater, handleSetRenderRateDivisor(buffer, 4u));
+        doCommandExecutorLoop();
+    }
+
+    TEST_F(ARendererCommandExecutor, setOffscreenBufferScalable)
+    {
+        constexpr DisplayHandle display{ 1 };
+        constexpr OffscreenBufferHandle buffer{ 2 };
+
+        m_commandBuffer.enqueueCommand(RendererCommand::SetOffscreenBufferScalable{ display, buffer, true });
+        EXPECT_CALL(m_sceneUpdater, handleSetOffscreenBufferScalable(buffer, true));
+        doCommandExecutorLoop();
+    }
+
+    TEST_F(ARendererCommandExecutor, setDmaOffscreenBufferSyncFence)
+    {
+        constexpr DisplayHandle display{ 1 };
+        constexpr OffscreenBufferHandle buffer{ 2 };
+
+        m_commandBuffer.enqueueCommand(RendererCommand::SetDmaOffscreenBufferSyncFence{ display, buffer, true });
+        EXPECT_CALL(m_sceneUpdater, handleSetDmaOffscreenBufferSyncFence(buffer, true));
+        doCommandExecutorLoop();
+    }
+
     TEST_F(ARendererCommandExecutor, resizeDisplayWindowExterally)
     {
         constexpr DisplayHandle display{ 1 };
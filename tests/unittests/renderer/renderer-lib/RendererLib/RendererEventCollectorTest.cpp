@@ -57,6 +57,21 @@ namespace ramses::internal
         EXPECT_EQ(ERendererEventType::DisplayCreated, resultEvents[0].eventType);
     }
 
+    TEST_F(ARendererEventCollector, AppendsEventsToNotYetDispatchedEventsInOrder)
+    {
+        RendererEventVector resultEvents;
+        RendererEventVector dummy;
+        m_rendererEventCollector.addDisplayEvent(ERendererEventType::DisplayCreated, m_displayHandle);
+        m_rendererEventCollector.appendAndConsumePendingEvents(resultEvents, dummy);
+        m_rendererEventCollector.addDisplayEvent(ERendererEventType::DisplayDestroyed, m_displayHandle);
+        m_rendererEventCollector.appendAndConsumePendingEvents(resultEvents, dummy);
+
+        ASSERT_EQ(2u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::DisplayCreated, resultEvents[0].eventType);
+        EXPECT_EQ(ERendererEventType::DisplayDestroyed, resultEvents[1].eventType);
+        EXPECT_TRUE(consumeRendererEvents().empty());
+    }
+
     TEST_F(ARendererEventCollector, CanAddRendererEventWithPixelData)
     {
         std::vector<uint8_t> pixelData;
@@ -303,13 +318,88 @@ namespace ramses::internal
         constexpr std::chrono::microseconds maxTime{ 123 };
         constexpr std::chrono::microseconds avgTime{ 321 };
         const DisplayHandle displayHandle(124u);
-        m_rendererEventCollector.addFrameTimingReport(displayHandle, maxTime, avgTime);
+        constexpr std::chrono::microseconds percentile90{ 250 };
+        FrameTimings frameTimings{ maxTime, avgTime };
+        frameTimings.loopTimePercentile90 = percentile90;
+        m_rendererEventCollector.addFrameTimingReport(displayHandle, frameTimings);
         const RendererEventVector resultEvents = consumeRendererEvents();
         ASSERT_EQ(1u, resultEvents.size());
         EXPECT_EQ(ERendererEventType::FrameTimingReport, resultEvents[0].eventType);
         EXPECT_EQ(maxTime, resultEvents[0].frameTimings.maximumLoopTimeWithinPeriod);
         EXPECT_EQ(avgTime, resultEvents[0].frameTimings.averageLoopTimeWithinPeriod);
+        EXPECT_EQ(percentile90, resultEvents[0].frameTimings.loopTimePercentile90);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+    }
+
+    TEST_F(ARendererEventCollector, CanAddGpuMemoryReportEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        GpuMemoryReport report;
+        report.scenes[SceneId{ 12u }].textures = 1024u;
+        report.gpuCacheSize = 2048u;
+        m_rendererEventCollector.addGpuMemoryReport(displayHandle, std::move(report));
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::GpuMemoryReport, resultEvents[0].eventType);
+        ASSERT_EQ(1u, resultEvents[0].gpuMemoryReport.scenes.size());
+        EXPECT_EQ(1024u, resultEvents[0].gpuMemoryReport.scenes.at(SceneId{ 12u }).textures);
+        EXPECT_EQ(2048u, resultEvents[0].gpuMemoryReport.gpuCacheSize);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+    }
+
+    TEST_F(ARendererEventCollector, CanAddSceneFlushPresentedEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        FlushPresentation flushPresentation;
+        flushPresentation.presentationTimestamp = FlushTime::Clock::time_point{ std::chrono::milliseconds{ 1016 } };
+        flushPresentation.latency = std::chrono::microseconds{ 16000 };
+        m_rendererEventCollector.addSceneFlushPresentedEvent(displayHandle, SceneId{ 12u }, SceneVersionTag{ 33u }, flushPresentation);
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::SceneFlushPresented, resultEvents[0].eventType);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+        EXPECT_EQ(SceneId{ 12u }, resultEvents[0].sceneId);
+        EXPECT_EQ(SceneVersionTag{ 33u }, resultEvents[0].sceneVersionTag);
+        EXPECT_EQ(flushPresentation.presentationTimestamp, resultEvents[0].flushPresentation.presentationTimestamp);
+        EXPECT_EQ(flushPresentation.latency, resultEvents[0].flushPresentation.latency);
+    }
+
+    TEST_F(ARendererEventCollector, CanAddMemoryTrimmedEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        m_rendererEventCollector.addMemoryTrimmedEvent(displayHandle, 4096u);
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::MemoryTrimmed, resultEvents[0].eventType);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+        EXPECT_EQ(4096u, resultEvents[0].freedMemory);
+    }
+
+    TEST_F(ARendererEventCollector, CanAddDmaOffscreenBufferRenderedEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        const OffscreenBufferHandle bufferHandle(3u);
+        m_rendererEventCollector.addDmaOffscreenBufferRenderedEvent(displayHandle, bufferHandle, 17);
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::DmaOffscreenBufferRendered, resultEvents[0].eventType);
+        EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+        EXPECT_EQ(bufferHandle, resultEvents[0].offscreenBuffer);
+        EXPECT_EQ(17, resultEvents[0].syncFenceFD);
+    }
+
+    TEST_F(ARendererEventCollector, CanAddExternalBufferDmaBufferReleasedEvent)
+    {
+        const DisplayHandle displayHandle(124u);
+        const ExternalBufferHandle bufferHandle(3u);
+        m_rendererEventCollector.addExternalBufferDmaBufferReleasedEvent(displayHandle, bufferHandle, 21, 17);
+        const RendererEventVector resultEvents = consumeRendererEvents();
+        ASSERT_EQ(1u, resultEvents.size());
+        EXPECT_EQ(ERendererEventType::ExternalBufferDmaBufferReleased, resultEvents[0].eventType);
         EXPECT_EQ(displayHandle, resultEvents[0].displayHandle);
+        EXPECT_EQ(bufferHandle, resultEvents[0].externalBuffer);
+        EXPECT_EQ(21, resultEvents[0].dmaBufferFD);
+        EXPECT_EQ(17, resultEvents[0].syncFenceFD);
     }
 
     TEST_F(ARendererEventCollector, CanAddStreamSurfaceUnavailableEvent)
@@ -52,16 +52,19 @@ namespace ramses::internal{
         MOCK_METHOD(void, updateRenderTargetBufferProperties, (RenderBufferHandle renderBufferHandle, SceneId sceneId, const RenderBuffer& renderBuffer), (override));
         MOCK_METHOD(void, uploadRenderTarget, (RenderTargetHandle renderTarget, const RenderBufferHandleVector& rtBufferHandles, SceneId sceneId), (override));
         MOCK_METHOD(void, unloadRenderTarget, (RenderTargetHandle renderTarget, SceneId sceneId), (override));
+        MOCK_METHOD(bool, updateRenderTargetAliases, (SceneId sceneId, const RenderTargetAliases& aliases), (override));
         MOCK_METHOD(void, uploadOffscreenBuffer, (OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, uint32_t sampleCount, bool isDoubleBuffered, EDepthBufferType depthStencilBufferType), (override));
         MOCK_METHOD(void, uploadDmaOffscreenBuffer, (OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height, DmaBufferFourccFormat dmaBufferFourccFormat, DmaBufferUsageFlags dmaBufferUsageFlags, DmaBufferModifiers dmaBufferModifiers), (override));
+        MOCK_METHOD(int, createDmaOffscreenBufferSyncFence, (OffscreenBufferHandle bufferHandle), (override));
         MOCK_METHOD(void, unloadOffscreenBuffer, (OffscreenBufferHandle bufferHandle), (override));
+        MOCK_METHOD(DeviceResourceHandle, uploadOffscreenBufferScaledRenderTarget, (OffscreenBufferHandle bufferHandle, uint32_t width, uint32_t height), (override));
         MOCK_METHOD(void, uploadStreamBuffer, (StreamBufferHandle bufferHandle, WaylandIviSurfaceId surfaceId), (override));
         MOCK_METHOD(void, unloadStreamBuffer, (StreamBufferHandle bufferHandle), (override));
         MOCK_METHOD(void, uploadBlitPassRenderTargets, (BlitPassHandle, RenderBufferHandle, RenderBufferHandle, SceneId), (override));
         MOCK_METHOD(void, unloadBlitPassRenderTargets, (BlitPassHandle, SceneId), (override));
         MOCK_METHOD(void, uploadDataBuffer, (DataBufferHandle dataBufferHandle, EDataBufferType dataBufferType, EDataType dataType, uint32_t elementCount, SceneId sceneId), (override));
         MOCK_METHOD(void, unloadDataBuffer, (DataBufferHandle dataBufferHandle, SceneId sceneId), (override));
-        MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId), (override));
+        MOCK_METHOD(void, updateDataBuffer, (DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const std::byte* data, SceneId sceneId), (override));
 
         MOCK_METHOD(void, uploadUniformBuffer, (UniformBufferHandle uniformBufferHandle, uint32_t size, SceneId sceneId), (override));
         MOCK_METHOD(void, unloadUniformBuffer, (UniformBufferHandle uniformBufferHandle, SceneId sceneId), (override));
@@ -80,8 +83,12 @@ namespace ramses::internal{
 
         MOCK_METHOD(void, uploadExternalBuffer, (ExternalBufferHandle), (override));
         MOCK_METHOD(void, unloadExternalBuffer, (ExternalBufferHandle), (override));
+        MOCK_METHOD(bool, importDmaBufferToExternalBuffer, (ExternalBufferHandle, const DmaBufferFrame&, int&), (override));
+        MOCK_METHOD(int, releaseDmaBufferOfExternalBuffer, (ExternalBufferHandle), (override));
 
         MOCK_METHOD(const StreamUsage&, getStreamUsage, (WaylandIviSurfaceId source), (const, override));
+        MOCK_METHOD(GpuMemoryReport, getGpuMemoryReport, (), (const, override));
+        MOCK_METHOD(uint64_t, trimMemory, (), (override));
     };
 
     class RendererResourceManagerRefCountMock : public RendererResourceManagerMock
@@ -366,20 +366,81 @@ namespace ramses::internal {
         resourceManager.uploadAndUnloadPendingResources();
     }
 
+    TEST_F(ARendererResourceManager, reportsGpuMemoryPerSceneAndSplitsResourcesSharedByScenes)
+    {
+        const ResourceContentHash vertResource = MockResourceHash::VertArrayHash;
+        const ResourceContentHash indexResource = MockResourceHash::IndexArrayHash;
+        const SceneId fakeSceneId2(4u);
+
+        referenceResource(vertResource, fakeSceneId);
+        referenceResource(indexResource, fakeSceneId);
+        referenceResource(indexResource, fakeSceneId2);
+        resourceManager.provideResourceData(MockResourceHash::GetManagedResource(vertResource));
+        resourceManager.provideResourceData(MockResourceHash::GetManagedResource(indexResource));
+
+        EXPECT_CALL(*resUploader, uploadResource(Ref(platform.renderBackendMock), _, _)).Times(2u).WillRepeatedly(Invoke([&](auto& /*unused*/, const auto& rd, uint32_t& vramSize) {
+            vramSize = (rd.hash == vertResource ? 1000u : 301u);
+            return ResourceUploaderMock::FakeResourceDeviceHandle;
+        }));
+        resourceManager.uploadAndUnloadPendingResources();
+
+        const RenderBuffer colorBuffer{ 10u, 10u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u };
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(10u, 10u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u));
+        resourceManager.uploadRenderTargetBuffer(RenderBufferHandle{ 1u }, fakeSceneId2, colorBuffer);
+
+        const GpuMemoryReport report = resourceManager.getGpuMemoryReport();
+        ASSERT_EQ(2u, report.scenes.size());
+        const auto& scene1 = report.scenes.at(fakeSceneId);
+        EXPECT_EQ(1000u + 151u, scene1.buffers);
+        EXPECT_EQ(151u, scene1.shared);
+        EXPECT_EQ(0u, scene1.textures);
+        EXPECT_EQ(0u, scene1.renderTargets);
+        const auto& scene2 = report.scenes.at(fakeSceneId2);
+        EXPECT_EQ(150u, scene2.buffers);
+        EXPECT_EQ(150u, scene2.shared);
+        EXPECT_EQ(400u, scene2.renderTargets);
+        EXPECT_EQ(550u, scene2.getTotal());
+        EXPECT_EQ(0u, report.unusedResources.getTotal());
+        EXPECT_EQ(0u, report.offscreenBuffers);
+        EXPECT_EQ(1000u + 301u + 400u, report.getTotal().getTotal());
+
+        // unused resources stay uploaded in cache and are reported separately
+        resourceManager.unreferenceResourcesForScene(fakeSceneId, { vertResource, indexResource });
+        resourceManager.unreferenceResourcesForScene(fakeSceneId2, { indexResource });
+        const GpuMemoryReport reportUnused = resourceManager.getGpuMemoryReport();
+        EXPECT_EQ(1000u + 301u, reportUnused.unusedResources.buffers);
+        EXPECT_EQ(0u, reportUnused.unusedResources.shared);
+        ASSERT_EQ(1u, reportUnused.scenes.size());
+        EXPECT_EQ(400u, reportUnused.scenes.at(fakeSceneId2).getTotal());
+
+        expectResourceUnloaded(vertResource, EResourceType::VertexArray);
+        expectResourceUnloaded(indexResource, EResourceType::IndexArray);
+        resourceManager.uploadAndUnloadPendingResources();
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_));
+        resourceManager.unloadRenderTargetBuffer(RenderBufferHandle{ 1u }, fakeSceneId2);
+        resourceManager.unloadAllSceneResourcesForScene(fakeSceneId2);
+    }
+
     TEST_F(ARendererResourceManager, canUploadAndUpdateAndUnloadDataBuffer_IndexBuffer)
     {
         const DataBufferHandle dataBuffer(1u);
         const EDataBufferType dataBufferType = EDataBufferType::IndexBuffer;
         const EDataType dataType = EDataType::UInt32;
         const uint32_t sizeInBytes = 1024u;
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateIndexBuffer(dataType, sizeInBytes));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateIndexBuffer(dataType, sizeInBytes, EDeviceBufferUsage::Dynamic));
         resourceManager.uploadDataBuffer(dataBuffer, dataBufferType, dataType, sizeInBytes, fakeSceneId);
 
         EXPECT_EQ(DeviceMock::FakeIndexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-        const std::byte dummyData[10] = {};
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, 7u));
-        resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+        const std::byte dummyData[sizeInBytes] = {};
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferData(DeviceMock::FakeIndexBufferDeviceHandle, dummyData, sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 0u, sizeInBytes, dummyData, fakeSceneId);
+
+        // partial update uploads only given range
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferSubData(DeviceMock::FakeIndexBufferDeviceHandle, 12u, dummyData + 12u, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 12u, 7u, dummyData + 12u, fakeSceneId);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadIndexBufferSubData(DeviceMock::FakeIndexBufferDeviceHandle, 0u, dummyData, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 0u, 7u, dummyData, fakeSceneId);
 
         EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteIndexBuffer(DeviceMock::FakeIndexBufferDeviceHandle));
         resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
@@ -391,14 +452,20 @@ namespace ramses::internal {
         const EDataBufferType dataBufferType = EDataBufferType::VertexBuffer;
         const EDataType dataType = EDataType::UInt32;
         const uint32_t sizeInBytes = 1024u;
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateVertexBuffer(sizeInBytes));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateVertexBuffer(sizeInBytes, EDeviceBufferUsage::Dynamic));
         resourceManager.uploadDataBuffer(dataBuffer, dataBufferType, dataType, sizeInBytes, fakeSceneId);
 
         EXPECT_EQ(DeviceMock::FakeVertexBufferDeviceHandle, resourceManager.getDataBufferDeviceHandle(dataBuffer, fakeSceneId));
 
-        const std::byte dummyData[10] = {};
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, 7u));
-        resourceManager.updateDataBuffer(dataBuffer, 7u, dummyData, fakeSceneId);
+        const std::byte dummyData[sizeInBytes] = {};
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferData(DeviceMock::FakeVertexBufferDeviceHandle, dummyData, sizeInBytes));
+        resourceManager.updateDataBuffer(dataBuffer, 0u, sizeInBytes, dummyData, fakeSceneId);
+
+        // partial update uploads only given range
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferSubData(DeviceMock::FakeVertexBufferDeviceHandle, 12u, dummyData + 12u, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 12u, 7u, dummyData + 12u, fakeSceneId);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadVertexBufferSubData(DeviceMock::FakeVertexBufferDeviceHandle, 0u, dummyData, 7u));
+        resourceManager.updateDataBuffer(dataBuffer, 0u, 7u, dummyData, fakeSceneId);
 
         EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteVertexBuffer(DeviceMock::FakeVertexBufferDeviceHandle));
         resourceManager.unloadDataBuffer(dataBuffer, fakeSceneId);
@@ -554,6 +621,75 @@ namespace ramses::internal {
         resourceManager.unloadRenderTarget(targetHandle, fakeSceneId);
     }
 
+    TEST_F(ARendererResourceManager, aliasedRenderTargetUsesDeviceResourcesOfHostUntilAliasIsRemoved)
+    {
+        const RenderTargetHandle hostTarget(1u);
+        const RenderTargetHandle aliasedTarget(2u);
+        const RenderBufferHandle hostBuffer(1u);
+        const RenderBufferHandle aliasedBuffer(2u);
+        const RenderBuffer colorBuffer{ 800u, 600u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u };
+
+        const DeviceResourceHandle hostBufferDeviceHandle(201u);
+        const DeviceResourceHandle aliasedBufferDeviceHandle(202u);
+        const DeviceResourceHandle hostTargetDeviceHandle(203u);
+        const DeviceResourceHandle aliasedTargetDeviceHandle(204u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(800u, 600u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u))
+            .WillOnce(Return(hostBufferDeviceHandle)).WillOnce(Return(aliasedBufferDeviceHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(_)).WillOnce(Return(hostTargetDeviceHandle)).WillOnce(Return(aliasedTargetDeviceHandle));
+        resourceManager.uploadRenderTargetBuffer(hostBuffer, fakeSceneId, colorBuffer);
+        resourceManager.uploadRenderTargetBuffer(aliasedBuffer, fakeSceneId, colorBuffer);
+        resourceManager.uploadRenderTarget(hostTarget, { hostBuffer }, fakeSceneId);
+        resourceManager.uploadRenderTarget(aliasedTarget, { aliasedBuffer }, fakeSceneId);
+
+        const RenderTargetAliases aliases{ { aliasedTarget, { aliasedBuffer }, hostTarget, { hostBuffer } } };
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(aliasedTargetDeviceHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(aliasedBufferDeviceHandle));
+        EXPECT_TRUE(resourceManager.updateRenderTargetAliases(fakeSceneId, aliases));
+        EXPECT_FALSE(resourceManager.updateRenderTargetAliases(fakeSceneId, aliases));
+
+        EXPECT_EQ(hostTargetDeviceHandle, resourceManager.getRenderTargetDeviceHandle(aliasedTarget, fakeSceneId));
+        EXPECT_EQ(hostBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(aliasedBuffer, fakeSceneId));
+
+        // alias removed, device resources are created again
+        const DeviceResourceHandle restoredBufferDeviceHandle(205u);
+        const DeviceResourceHandle restoredTargetDeviceHandle(206u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(800u, 600u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u)).WillOnce(Return(restoredBufferDeviceHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(DeviceHandleVector{ restoredBufferDeviceHandle })).WillOnce(Return(restoredTargetDeviceHandle));
+        EXPECT_TRUE(resourceManager.updateRenderTargetAliases(fakeSceneId, {}));
+        EXPECT_EQ(restoredTargetDeviceHandle, resourceManager.getRenderTargetDeviceHandle(aliasedTarget, fakeSceneId));
+        EXPECT_EQ(restoredBufferDeviceHandle, resourceManager.getRenderTargetBufferDeviceHandle(aliasedBuffer, fakeSceneId));
+        EXPECT_EQ(hostTargetDeviceHandle, resourceManager.getRenderTargetDeviceHandle(hostTarget, fakeSceneId));
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_)).Times(2);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_)).Times(2);
+        resourceManager.unloadAllSceneResourcesForScene(fakeSceneId);
+    }
+
+    TEST_F(ARendererResourceManager, doesNotDeleteDeviceResourcesOfAliasedRenderTargetWhenUnloadingScene)
+    {
+        const RenderTargetHandle hostTarget(1u);
+        const RenderTargetHandle aliasedTarget(2u);
+        const RenderBufferHandle hostBuffer(1u);
+        const RenderBufferHandle aliasedBuffer(2u);
+        const RenderBuffer colorBuffer{ 800u, 600u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u };
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(_, _, _, _, _)).Times(2);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(_)).Times(2);
+        resourceManager.uploadRenderTargetBuffer(hostBuffer, fakeSceneId, colorBuffer);
+        resourceManager.uploadRenderTargetBuffer(aliasedBuffer, fakeSceneId, colorBuffer);
+        resourceManager.uploadRenderTarget(hostTarget, { hostBuffer }, fakeSceneId);
+        resourceManager.uploadRenderTarget(aliasedTarget, { aliasedBuffer }, fakeSceneId);
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_));
+        EXPECT_TRUE(resourceManager.updateRenderTargetAliases(fakeSceneId, { { aliasedTarget, { aliasedBuffer }, hostTarget, { hostBuffer } } }));
+
+        // only host resources left to delete
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_));
+        resourceManager.unloadAllSceneResourcesForScene(fakeSceneId);
+    }
+
     TEST_F(ARendererResourceManager, canUploadAndUnloadVertexArray)
     {
         VertexArrayInfo vaInfo;
@@ -788,6 +924,8 @@ namespace ramses::internal {
         EXPECT_EQ(123, resourceManager.getDmaOffscreenBufferFD(bufferHandle));
         EXPECT_CALL(platform.renderBackendMock.deviceMock, getDmaRenderBufferStride(DeviceMock::FakeDmaRenderBufferDeviceHandle)).WillOnce(Return(432u));
         EXPECT_EQ(432u, resourceManager.getDmaOffscreenBufferStride(bufferHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, createDmaRenderBufferSyncFence(DeviceMock::FakeDmaRenderBufferDeviceHandle)).WillOnce(Return(55));
+        EXPECT_EQ(55, resourceManager.createDmaOffscreenBufferSyncFence(bufferHandle));
 
         EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_));
         EXPECT_CALL(platform.renderBackendMock.deviceMock, destroyDmaRenderBuffer(_));
@@ -814,6 +952,32 @@ namespace ramses::internal {
         EXPECT_FALSE(resourceManager.getOffscreenBufferDeviceHandle(bufferHandle).isValid());
     }
 
+    TEST_F(ARendererResourceManager, ProvidesNoDmaFDOrSyncFenceForNonDmaOffscreenBuffer)
+    {
+        const OffscreenBufferHandle bufferHandle(1u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(_, _, _, _, _));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, activateRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, colorMask(true, true, true, true));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, clearColor(glm::vec4{ 0.f, 0.f, 0.f, 1.f }));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, depthWrite(EDepthWrite::Enabled));
+        RenderState::ScissorRegion scissorRegion{};
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, scissorTest(EScissorTest::Disabled, scissorRegion));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, clear(_));
+        resourceManager.uploadOffscreenBuffer(bufferHandle, 1u, 1u, 0u, false, EDepthBufferType::None);
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, getDmaRenderBufferFD(_)).Times(0);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, createDmaRenderBufferSyncFence(_)).Times(0);
+        EXPECT_EQ(-1, resourceManager.getDmaOffscreenBufferFD(bufferHandle));
+        EXPECT_EQ(-1, resourceManager.createDmaOffscreenBufferSyncFence(bufferHandle));
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_));
+        resourceManager.unloadOffscreenBuffer(bufferHandle);
+
+        EXPECT_FALSE(resourceManager.getOffscreenBufferDeviceHandle(bufferHandle).isValid());
+    }
+
     TEST_F(ARendererResourceManager, CanUnloadOffscreenBuffer_WithColorAndDepthStencilBuffers)
     {
         const OffscreenBufferHandle bufferHandle(1u);
@@ -835,6 +999,35 @@ namespace ramses::internal {
         EXPECT_FALSE(resourceManager.getOffscreenBufferDeviceHandle(bufferHandle).isValid());
     }
 
+    TEST_F(ARendererResourceManager, UploadsScaledRenderTargetOfOffscreenBufferOnlyOnceAndUnloadsItWithBuffer)
+    {
+        const OffscreenBufferHandle bufferHandle(1u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(_, _, _, _, _)).Times(2u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, activateRenderTarget(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, colorMask(true, true, true, true));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, clearColor(glm::vec4{ 0.f, 0.f, 0.f, 1.f }));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, depthWrite(EDepthWrite::Enabled));
+        RenderState::ScissorRegion scissorRegion{};
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, scissorTest(EScissorTest::Disabled, scissorRegion));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, clear(_));
+        resourceManager.uploadOffscreenBuffer(bufferHandle, 4u, 2u, 4u, false, EDepthBufferType::DepthStencil);
+
+        {
+            InSequence seq;
+            EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(2u, 1u, EPixelStorageFormat::RGBA8, ERenderBufferAccessMode::ReadWrite, 0u));
+            EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderBuffer(2u, 1u, EPixelStorageFormat::Depth24_Stencil8, ERenderBufferAccessMode::WriteOnly, 0u));
+            EXPECT_CALL(platform.renderBackendMock.deviceMock, uploadRenderTarget(_));
+        }
+        EXPECT_EQ(DeviceMock::FakeRenderTargetDeviceHandle, resourceManager.uploadOffscreenBufferScaledRenderTarget(bufferHandle, 2u, 1u));
+        // already uploaded
+        EXPECT_EQ(DeviceMock::FakeRenderTargetDeviceHandle, resourceManager.uploadOffscreenBufferScaledRenderTarget(bufferHandle, 2u, 1u));
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderTarget(_)).Times(2u);
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteRenderBuffer(_)).Times(4u);
+        resourceManager.unloadOffscreenBuffer(bufferHandle);
+    }
+
     TEST_F(ARendererResourceManager, CanUnloadDoubleBufferedOffscreenBuffer_WithColorBuffer)
     {
         const OffscreenBufferHandle bufferHandle(1u);
@@ -958,6 +1151,27 @@ namespace ramses::internal {
         resourceManager.unloadExternalBuffer(ebHandle2);
     }
 
+    TEST_F(ARendererResourceManager, ImportsAndReleasesDmaBufferOfExternalBuffer)
+    {
+        constexpr ExternalBufferHandle ebHandle{ 1u };
+        constexpr DeviceResourceHandle deviceHandle{ 11111u };
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, isExternalTextureExtensionSupported()).WillOnce(Return(true));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateExternalTexture()).WillOnce(Return(deviceHandle));
+        resourceManager.uploadExternalBuffer(ebHandle);
+
+        const DmaBufferFrame frame{ 33, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } };
+        int releaseFenceFD = -1;
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, importDmaBufferToExternalTexture(deviceHandle, frame, _)).WillOnce(DoAll(SetArgReferee<2>(44), Return(true)));
+        EXPECT_TRUE(resourceManager.importDmaBufferToExternalBuffer(ebHandle, frame, releaseFenceFD));
+        EXPECT_EQ(44, releaseFenceFD);
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, releaseDmaBufferOfExternalTexture(deviceHandle)).WillOnce(Return(55));
+        EXPECT_EQ(55, resourceManager.releaseDmaBufferOfExternalBuffer(ebHandle));
+
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, deleteTexture(deviceHandle));
+        resourceManager.unloadExternalBuffer(ebHandle);
+    }
+
     TEST_F(ARendererResourceManager, FailsUploadingExternalBuffersIfExtensionNotSupported)
     {
         constexpr ExternalBufferHandle ebHandle{ 1u };
@@ -1064,7 +1278,7 @@ namespace ramses::internal {
         constexpr SemanticUniformBufferHandle ubHandle{ RenderableHandle{ 1u } };
         constexpr DeviceResourceHandle deviceHandle{ 11111u };
         constexpr uint32_t uniformBufferSize{ 123u };
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateUniformBuffer(uniformBufferSize)).WillOnce(Return(deviceHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateStreamingUniformBuffer(uniformBufferSize)).WillOnce(Return(deviceHandle));
         EXPECT_EQ(deviceHandle, resourceManager.uploadUniformBuffer(ubHandle, uniformBufferSize, fakeSceneId));
 
         std::vector<std::byte> dummyData{ uniformBufferSize, std::byte{ 1 } };
@@ -1080,7 +1294,7 @@ namespace ramses::internal {
         constexpr SemanticUniformBufferHandle ubHandle{ RenderableHandle{ 1u } };
         constexpr DeviceResourceHandle deviceHandle{ 11111u };
         constexpr uint32_t uniformBufferSize{ 123u };
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateUniformBuffer(uniformBufferSize)).WillOnce(Return(deviceHandle));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateStreamingUniformBuffer(uniformBufferSize)).WillOnce(Return(deviceHandle));
         EXPECT_EQ(deviceHandle, resourceManager.uploadUniformBuffer(ubHandle, uniformBufferSize, fakeSceneId));
 
         EXPECT_EQ(deviceHandle, resourceManager.getUniformBufferDeviceHandle(ubHandle, fakeSceneId));
@@ -1273,12 +1487,12 @@ namespace ramses::internal {
 
         //upload index data buffer
         const DataBufferHandle indexDataBufferHandle(123u);
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateIndexBuffer(_, _));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateIndexBuffer(_, _, _));
         resourceManager.uploadDataBuffer(indexDataBufferHandle, EDataBufferType::IndexBuffer, EDataType::Float, 10u, fakeSceneId);
 
         //upload vertex data buffer
         const DataBufferHandle vertexDataBufferHandle(777u);
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateVertexBuffer(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateVertexBuffer(_, _));
         resourceManager.uploadDataBuffer(vertexDataBufferHandle, EDataBufferType::VertexBuffer, EDataType::Float, 10u, fakeSceneId);
 
         //upload texture buffer
@@ -1303,7 +1517,7 @@ namespace ramses::internal {
 
         //upload semantic uniform buffer
         constexpr SemanticUniformBufferHandle subHandle{ RenderableHandle{ 777u } };
-        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateUniformBuffer(_));
+        EXPECT_CALL(platform.renderBackendMock.deviceMock, allocateStreamingUniformBuffer(_));
         resourceManager.uploadUniformBuffer(subHandle, 123u, fakeSceneId);
 
         // unload all scene resources
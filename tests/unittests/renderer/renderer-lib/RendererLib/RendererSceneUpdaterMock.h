@@ -37,6 +37,10 @@ namespace ramses::internal
         MOCK_METHOD(bool, handleExternalBufferDestroyRequest, (ExternalBufferHandle), (override));
         MOCK_METHOD(void, handleSetClearFlags, (OffscreenBufferHandle buffer, ClearFlags), (override));
         MOCK_METHOD(void, handleSetClearColor, (OffscreenBufferHandle buffer, const glm::vec4& clearColor), (override));
+        MOCK_METHOD(void, handleSetRenderRateDivisor, (OffscreenBufferHandle buffer, uint32_t divisor), (override));
+        MOCK_METHOD(void, handleSetOffscreenBufferScalable, (OffscreenBufferHandle buffer, bool scalable), (override));
+        MOCK_METHOD(void, handleSetDmaOffscreenBufferSyncFence, (OffscreenBufferHandle buffer, bool enable), (override));
+        MOCK_METHOD(void, handleExternalBufferDmaBufferUpdate, (ExternalBufferHandle buffer, const DmaBufferFrame& frame), (override));
         MOCK_METHOD(void, handleSetExternallyOwnedWindowSize, (uint32_t, uint32_t), (override));
         MOCK_METHOD(void, handleReadPixels, (OffscreenBufferHandle buffer, ScreenshotInfo&& screenshotInfo), (override));
         MOCK_METHOD(void, handlePickEvent, (SceneId sceneId, glm::vec2 coordsNormalizedToBufferSize), (override));
@@ -48,6 +52,7 @@ namespace ramses::internal
         MOCK_METHOD(void, setLimitFlushesForceApply, (size_t limitForPendingFlushesForceApply), (override));
         MOCK_METHOD(void, setLimitFlushesForceUnsubscribe, (size_t limitForPendingFlushesForceUnsubscribe), (override));
         MOCK_METHOD(void, setSkippingOfUnmodifiedScenes, (bool enable), (override));
+        MOCK_METHOD(void, handleTrimMemory, (), (override));
         MOCK_METHOD(void, logRendererInfo, (const RendererCommand::LogInfo& cmd), (const, override));
     };
 }
@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "RendererSceneUpdaterTest.h"
+#include "internal/RendererLib/ResolutionScalingController.h"
 #include <array>
 
 namespace ramses::internal {
@@ -495,6 +496,92 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, createsSyncFenceEventForRenderedDmaOffscreenBufferWithEnabledSyncFence)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr OffscreenBufferHandle buffer(1u);
+        expectDmaOffscreenBufferUploaded(buffer, DeviceMock::FakeRenderTargetDeviceHandle, DmaBufferFourccFormat{ 1u }, DmaBufferUsageFlags{ 2u }, DmaBufferModifiers{ 3u });
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getDmaOffscreenBufferFD(buffer)).WillRepeatedly(Return(111));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getDmaOffscreenBufferStride(buffer));
+        EXPECT_TRUE(rendererSceneUpdater->handleDmaBufferCreateRequest(buffer, 1u, 1u, DmaBufferFourccFormat{ 1u }, DmaBufferUsageFlags{ 2u }, DmaBufferModifiers{ 3u }));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        rendererSceneUpdater->handleSetDmaOffscreenBufferSyncFence(buffer, true);
+
+        constexpr int syncFenceFD = 42;
+        doRenderLoop();
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, createDmaOffscreenBufferSyncFence(buffer)).WillOnce(Return(syncFenceFD));
+        rendererSceneUpdater->processRenderedDmaOffscreenBuffers();
+
+        RendererEventVector rendererEvents;
+        RendererEventVector sceneEvents;
+        rendererEventCollector.appendAndConsumePendingEvents(rendererEvents, sceneEvents);
+        ASSERT_EQ(rendererEvents.size(), 1u);
+        EXPECT_EQ(ERendererEventType::DmaOffscreenBufferRendered, rendererEvents.front().eventType);
+        EXPECT_EQ(Display, rendererEvents.front().displayHandle);
+        EXPECT_EQ(buffer, rendererEvents.front().offscreenBuffer);
+        EXPECT_EQ(syncFenceFD, rendererEvents.front().syncFenceFD);
+
+        // buffer not rendered again without changes
+        doRenderLoop();
+        rendererSceneUpdater->processRenderedDmaOffscreenBuffers();
+        expectNoEvent();
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotCreateSyncFenceForRenderedDmaOffscreenBufferIfNotEnabled)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr OffscreenBufferHandle buffer(1u);
+        expectDmaOffscreenBufferUploaded(buffer, DeviceMock::FakeRenderTargetDeviceHandle, DmaBufferFourccFormat{ 1u }, DmaBufferUsageFlags{ 2u }, DmaBufferModifiers{ 3u });
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getDmaOffscreenBufferFD(buffer)).WillRepeatedly(Return(111));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getDmaOffscreenBufferStride(buffer));
+        EXPECT_TRUE(rendererSceneUpdater->handleDmaBufferCreateRequest(buffer, 1u, 1u, DmaBufferFourccFormat{ 1u }, DmaBufferUsageFlags{ 2u }, DmaBufferModifiers{ 3u }));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        rendererSceneUpdater->handleSetDmaOffscreenBufferSyncFence(buffer, true);
+        rendererSceneUpdater->handleSetDmaOffscreenBufferSyncFence(buffer, false);
+
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, createDmaOffscreenBufferSyncFence(_)).Times(0);
+        doRenderLoop();
+        rendererSceneUpdater->processRenderedDmaOffscreenBuffers();
+        expectNoEvent();
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotEnableSyncFenceForNonDmaOffscreenBuffer)
+    {
+        createDisplayAndExpectSuccess();
+
+        const OffscreenBufferHandle buffer(1u);
+        expectOffscreenBufferUploaded(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, 1u, 1u, 0u, false, EDepthBufferType::DepthStencil));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getDmaOffscreenBufferFD(buffer)).WillOnce(Return(-1));
+        rendererSceneUpdater->handleSetDmaOffscreenBufferSyncFence(buffer, true);
+
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, createDmaOffscreenBufferSyncFence(_)).Times(0);
+        doRenderLoop();
+        rendererSceneUpdater->processRenderedDmaOffscreenBuffers();
+        expectNoEvent();
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, failsToCreateOffscreenBufferOnUnknownDisplay)
     {
         const OffscreenBufferHandle buffer(1u);
@@ -727,6 +814,78 @@ namespace ramses::internal {
         rendererSceneUpdater->handleSetClearFlags({}, EClearFlag::Color);
     }
 
+    TEST_F(ARendererSceneUpdater, setsRenderRateDivisorForOB)
+    {
+        createDisplayAndExpectSuccess();
+
+        const OffscreenBufferHandle buffer(1u);
+        expectOffscreenBufferUploaded(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, 1u, 1u, 0u, false, EDepthBufferType::DepthStencil));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        rendererSceneUpdater->handleSetRenderRateDivisor(buffer, 4u);
+        EXPECT_EQ(4u, renderer.getDisplaySetup().getDisplayBuffer(DeviceMock::FakeRenderTargetDeviceHandle).renderRateDivisor);
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotSetRenderRateDivisorIfOBNotFound)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr OffscreenBufferHandle invalidOB{ 1234u };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getOffscreenBufferDeviceHandle(invalidOB)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+        rendererSceneUpdater->handleSetRenderRateDivisor(invalidOB, 4u);
+        EXPECT_EQ(1u, renderer.getDisplaySetup().getDisplayBuffer(renderer.getDisplayController().getDisplayBuffer()).renderRateDivisor);
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, uploadsScaledRenderTargetWhenSettingOBScalable)
+    {
+        createDisplayAndExpectSuccess();
+
+        const OffscreenBufferHandle buffer(1u);
+        expectOffscreenBufferUploaded(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, 64u, 32u, 0u, false, EDepthBufferType::DepthStencil));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        constexpr DeviceResourceHandle scaledRenderTarget{ 777u };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, uploadOffscreenBufferScaledRenderTarget(buffer,
+            ResolutionScalingController::GetScaledSize(64u), ResolutionScalingController::GetScaledSize(32u))).WillOnce(Return(scaledRenderTarget));
+        rendererSceneUpdater->handleSetOffscreenBufferScalable(buffer, true);
+        EXPECT_EQ(scaledRenderTarget, renderer.getDisplaySetup().getDisplayBuffer(DeviceMock::FakeRenderTargetDeviceHandle).scaledRenderTarget);
+
+        rendererSceneUpdater->handleSetOffscreenBufferScalable(buffer, false);
+        EXPECT_FALSE(renderer.getDisplaySetup().getDisplayBuffer(DeviceMock::FakeRenderTargetDeviceHandle).scaledRenderTarget.isValid());
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotSetInterruptibleOBScalable)
+    {
+        createDisplayAndExpectSuccess();
+
+        const OffscreenBufferHandle buffer(1u);
+        expectOffscreenBufferUploaded(buffer, DeviceMock::FakeRenderTargetDeviceHandle, true);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferCreateRequest(buffer, 64u, 32u, 0u, true, EDepthBufferType::DepthStencil));
+        expectEvent(ERendererEventType::OffscreenBufferCreated);
+
+        rendererSceneUpdater->handleSetOffscreenBufferScalable(buffer, true);
+        EXPECT_FALSE(renderer.getDisplaySetup().getDisplayBuffer(DeviceMock::FakeRenderTargetDeviceHandle).scaledRenderTarget.isValid());
+
+        expectOffscreenBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleBufferDestroyRequest(buffer));
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, setsClearColorForOB)
     {
         createDisplayAndExpectSuccess();
@@ -819,6 +978,42 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, readPixelsAsynchronouslyFromDisplayFramebuffer)
+    {
+        createDisplayAndExpectSuccess();
+
+        const DeviceResourceHandle readHandle{ 901u };
+        readPixels({}, 1u, 2u, 3u, 4u, false, false, {}, true);
+        EXPECT_CALL(*renderer.m_displayController, startReadPixels(DisplayControllerMock::FakeFrameBufferHandle, 1u, 2u, 3u, 4u)).WillOnce(Return(readHandle));
+        doRenderLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(readHandle, _)).WillOnce(Return(false));
+        rendererSceneUpdater->processScreenshotResults();
+        expectNoEvent();
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(readHandle, _)).WillOnce(Invoke([](auto, auto& data) { data.resize(3u * 4u * 4u); return true; }));
+        rendererSceneUpdater->processScreenshotResults();
+        expectReadPixelsEvents({ {OffscreenBufferHandle::Invalid(), true} });
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, createsReadPixelsFailedEventIfAsynchronousReadBackFailed)
+    {
+        createDisplayAndExpectSuccess();
+
+        const DeviceResourceHandle readHandle{ 901u };
+        readPixels({}, 1u, 2u, 3u, 4u, false, false, {}, true);
+        EXPECT_CALL(*renderer.m_displayController, startReadPixels(DisplayControllerMock::FakeFrameBufferHandle, 1u, 2u, 3u, 4u)).WillOnce(Return(readHandle));
+        doRenderLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(readHandle, _)).WillOnce(Invoke([](auto, auto& data) { data.clear(); return true; }));
+        rendererSceneUpdater->processScreenshotResults();
+        expectReadPixelsEvents({ {OffscreenBufferHandle::Invalid(), false} });
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, readPixelsFromOffscreenbuffer)
     {
         createDisplayAndExpectSuccess();
@@ -1144,6 +1339,93 @@ namespace ramses::internal {
         expectEvent(ERendererEventType::ExternalBufferDestroyFailed);
     }
 
+    TEST_F(ARendererSceneUpdater, importsDmaBufferToExternalBufferAndReleasesItWhenReplaced)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr ExternalBufferHandle buffer{ 1u };
+        expectExternalBufferUploaded(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleExternalBufferCreateRequest(buffer));
+        expectEvent(ERendererEventType::ExternalBufferCreated);
+
+        const DmaBufferFrame frame1{ 11, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } };
+        const DmaBufferFrame frame2{ 12, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, importDmaBufferToExternalBuffer(buffer, frame1, _)).WillOnce(DoAll(SetArgReferee<2>(-1), Return(true)));
+        rendererSceneUpdater->handleExternalBufferDmaBufferUpdate(buffer, frame1);
+        expectNoEvent();
+
+        constexpr int releaseFenceFD1 = 42;
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, importDmaBufferToExternalBuffer(buffer, frame2, _)).WillOnce(DoAll(SetArgReferee<2>(releaseFenceFD1), Return(true)));
+        rendererSceneUpdater->handleExternalBufferDmaBufferUpdate(buffer, frame2);
+
+        RendererEventVector rendererEvents;
+        RendererEventVector sceneEvents;
+        rendererEventCollector.appendAndConsumePendingEvents(rendererEvents, sceneEvents);
+        ASSERT_EQ(1u, rendererEvents.size());
+        EXPECT_EQ(ERendererEventType::ExternalBufferDmaBufferReleased, rendererEvents[0].eventType);
+        EXPECT_EQ(buffer, rendererEvents[0].externalBuffer);
+        EXPECT_EQ(frame1.fd, rendererEvents[0].dmaBufferFD);
+        EXPECT_EQ(releaseFenceFD1, rendererEvents[0].syncFenceFD);
+
+        // last imported buffer released with external buffer
+        constexpr int releaseFenceFD2 = 43;
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, releaseDmaBufferOfExternalBuffer(buffer)).WillOnce(Return(releaseFenceFD2));
+        expectExternalBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleExternalBufferDestroyRequest(buffer));
+
+        rendererEvents.clear();
+        rendererEventCollector.appendAndConsumePendingEvents(rendererEvents, sceneEvents);
+        ASSERT_EQ(2u, rendererEvents.size());
+        EXPECT_EQ(ERendererEventType::ExternalBufferDmaBufferReleased, rendererEvents[0].eventType);
+        EXPECT_EQ(frame2.fd, rendererEvents[0].dmaBufferFD);
+        EXPECT_EQ(releaseFenceFD2, rendererEvents[0].syncFenceFD);
+        EXPECT_EQ(ERendererEventType::ExternalBufferDestroyed, rendererEvents[1].eventType);
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, releasesDmaBufferRightAwayIfImportToExternalBufferFails)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr ExternalBufferHandle buffer{ 1u };
+        expectExternalBufferUploaded(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleExternalBufferCreateRequest(buffer));
+        expectEvent(ERendererEventType::ExternalBufferCreated);
+
+        const DmaBufferFrame frame{ 11, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, importDmaBufferToExternalBuffer(buffer, frame, _)).WillOnce(Return(false));
+        rendererSceneUpdater->handleExternalBufferDmaBufferUpdate(buffer, frame);
+        expectEvent(ERendererEventType::ExternalBufferDmaBufferReleased);
+
+        // nothing to release when destroyed
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, releaseDmaBufferOfExternalBuffer(_)).Times(0);
+        expectExternalBufferDeleted(buffer);
+        EXPECT_TRUE(rendererSceneUpdater->handleExternalBufferDestroyRequest(buffer));
+        expectEvent(ERendererEventType::ExternalBufferDestroyed);
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, releasesDmaBufferRightAwayIfUpdatingUnknownExternalBuffer)
+    {
+        createDisplayAndExpectSuccess();
+
+        constexpr ExternalBufferHandle buffer{ 1u };
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, getExternalBufferDeviceHandle(buffer)).WillOnce(Return(DeviceResourceHandle::Invalid()));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, importDmaBufferToExternalBuffer(_, _, _)).Times(0);
+        rendererSceneUpdater->handleExternalBufferDmaBufferUpdate(buffer, DmaBufferFrame{ 11, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } });
+        expectEvent(ERendererEventType::ExternalBufferDmaBufferReleased);
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, releasesDmaBufferRightAwayIfUpdatingExternalBufferOnUnknownDisplay)
+    {
+        rendererSceneUpdater->handleExternalBufferDmaBufferUpdate(ExternalBufferHandle{ 1u }, DmaBufferFrame{ 11, 64u, 32u, DmaBufferFourccFormat{ 123u }, 256u, DmaBufferModifiers{ 0u } });
+        expectEvent(ERendererEventType::ExternalBufferDmaBufferReleased);
+    }
+
     ///////////////////////////
     // Data linking tests
     ///////////////////////////
@@ -1749,6 +2031,118 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, defersFlushesOfLessPrioritizedSceneIfFrameBudgetExceeded)
+    {
+        DisplayConfigData config;
+        config.setScenePriority(SceneId(0u), -1);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+        createPublishAndSubscribeScene();
+        mapScene(0u);
+        mapScene(1u);
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, 0u);
+        performFlushWithCreateNodeAction(0u);
+        performFlushWithCreateNodeAction(1u);
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(0u));
+        EXPECT_FALSE(lastFlushWasAppliedOnRendererScene(1u));
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, std::numeric_limits<uint64_t>::max());
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(1u));
+
+        unmapScene(0u);
+        unmapScene(1u);
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotDeferFlushesIfFrameBudgetExceededWithoutScenePriorities)
+    {
+        createDisplayAndExpectSuccess();
+        createPublishAndSubscribeScene();
+        createPublishAndSubscribeScene();
+        mapScene(0u);
+        mapScene(1u);
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, 0u);
+        performFlushWithCreateNodeAction(0u);
+        performFlushWithCreateNodeAction(1u);
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(0u));
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(1u));
+
+        unmapScene(0u);
+        unmapScene(1u);
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, appliesFlushesOfAllScenesWithFlushApplyWorkers)
+    {
+        DisplayConfigData config;
+        config.setFlushApplyThreadCount(2u);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+        createPublishAndSubscribeScene();
+        createPublishAndSubscribeScene();
+        mapScene(0u);
+        mapScene(1u);
+        mapScene(2u);
+
+        for (uint32_t i = 0u; i < 5u; ++i)
+        {
+            performFlushWithCreateNodeAction(0u, 100u);
+            performFlushWithCreateNodeAction(1u, 100u);
+            performFlushWithCreateNodeAction(2u, 100u);
+            update();
+            EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(0u));
+            EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(1u));
+            EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(2u));
+        }
+
+        unmapScene(0u);
+        unmapScene(1u);
+        unmapScene(2u);
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, appliesLargeFlushOfSubscribedSceneAsynchronouslyAndMapsSceneAfterwards)
+    {
+        DisplayConfigData config;
+        config.setAsyncFlushApplyThreshold(100u);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        performFlushWithCreateNodeAction(0u, 1000u);
+        update();
+        for (int i = 0; i < 1000 && !lastFlushWasAppliedOnRendererScene(); ++i)
+        {
+            PlatformThread::Sleep(1u);
+            update();
+        }
+        ASSERT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(1000u, rendererScenes.getScene(getSceneId()).getNodeCount());
+
+        mapScene();
+        unmapScene();
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, appliesSmallFlushOfSubscribedSceneWithinUpdateIfAsyncFlushApplyEnabled)
+    {
+        DisplayConfigData config;
+        config.setAsyncFlushApplyThreshold(100u);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        performFlushWithCreateNodeAction(0u, 10u);
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(10u, rendererScenes.getScene(getSceneId()).getNodeCount());
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, appliesBigPendingWithinOneUpdate)
     {
         createPublishAndSubscribeScene();
@@ -3108,6 +3502,39 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, HasPendingWork_WhilePendingFlushOrActiveShaderAnimation)
+    {
+        const auto hasPendingWork = [&]() {
+            EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, hasResourcesToBeUploaded()).Times(AtMost(1)).WillRepeatedly(Return(false)).RetiresOnSaturation();
+            return rendererSceneUpdater->hasPendingWork();
+        };
+
+        createDisplayAndExpectSuccess();
+        createPublishAndSubscribeScene();
+        mapScene();
+        showScene();
+        EXPECT_FALSE(hasPendingWork());
+
+        performFlush();
+        EXPECT_TRUE(hasPendingWork());
+        update();
+        EXPECT_FALSE(hasPendingWork());
+
+        auto& rendererScene = rendererScenes.getScene(stagingScene[0]->getSceneId());
+        rendererScene.setActiveShaderAnimation(true);
+        EXPECT_TRUE(hasPendingWork());
+
+        // flush resets shader animation
+        performFlush();
+        expectModifiedScenesReportedToRenderer();
+        update();
+        EXPECT_FALSE(hasPendingWork());
+
+        hideScene();
+        unmapScene();
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, MarksSceneAsModified_IfEffectTimeIsSynced)
     {
         createDisplayAndExpectSuccess();
@@ -5049,46 +5476,10 @@ namespace ramses::internal {
         const auto sceneIdx = createPublishAndSubscribeScene();
         mapScene();
 
-        // create scene with 2 pickable triangles around origin
-        IScene& iscene = *stagingScene[sceneIdx];
-        SceneAllocateHelper sceneAllocator(iscene);
-        const NodeHandle nodeHandle(0u);
-        sceneAllocator.allocateNode(0u, nodeHandle);
-        const std::array<float, 9> geomData{ -1.f, 0.f, -0.5f, 0.f, 1.f, -0.5f, 0.f, 0.f, -0.5f };
-        const auto geomHandle = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, uint32_t(geomData.size() * sizeof(float)));
-        iscene.updateDataBuffer(geomHandle, 0, uint32_t(geomData.size() * sizeof(float)), reinterpret_cast<const std::byte*>(geomData.data()));
-
-        const auto dataLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
-        const auto dataInstance = sceneAllocator.allocateDataInstance(dataLayout);
-        const auto vpDataRefLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
-        const auto vpOffsetInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
-        const auto vpSizeInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
-        const auto frustumPlanesLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {});
-        const auto frustumPlanes = sceneAllocator.allocateDataInstance(frustumPlanesLayout);
-        const auto frustumNearFarLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {});
-        const auto frustumNearFar = sceneAllocator.allocateDataInstance(frustumNearFarLayout);
-        iscene.setDataReference(dataInstance, Camera::ViewportOffsetField, vpOffsetInstance);
-        iscene.setDataReference(dataInstance, Camera::ViewportSizeField, vpSizeInstance);
-        iscene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
-        iscene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
-        const auto cameraHandle = sceneAllocator.allocateCamera(ECameraProjectionType::Orthographic, nodeHandle, dataInstance);
-
-        iscene.setDataSingleVector2i(vpOffsetInstance, DataFieldHandle{ 0 }, { 0, 0 });
-        iscene.setDataSingleVector2i(vpSizeInstance, DataFieldHandle{ 0 }, { 1280, 480 });
-        const ProjectionParams params = ProjectionParams::Frustum(ECameraProjectionType::Orthographic, -1.f, 1.f, -1.f, 1.f, 0.1f, 100.f);
-        iscene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { params.leftPlane, params.rightPlane, params.bottomPlane, params.topPlane });
-        iscene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { params.nearPlane, params.farPlane });
-
-        const PickableObjectId id1{ 666u };
-        const PickableObjectId id2{ 667u };
-        const auto pickableHandle1 = sceneAllocator.allocatePickableObject(geomHandle, nodeHandle, id1);
-        const auto pickableHandle2 = sceneAllocator.allocatePickableObject(geomHandle, nodeHandle, id2);
-        iscene.setPickableObjectCamera(pickableHandle1, cameraHandle);
-        iscene.setPickableObjectCamera(pickableHandle2, cameraHandle);
-        performFlush();
+        performFlushWithPickableTriangles(sceneIdx);
 
         EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, uploadDataBuffer(_, _, _, _, _));
-        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, updateDataBuffer(_, _, _, _));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, updateDataBuffer(_, _, _, _, _));
         update();
 
         EXPECT_CALL(*rendererSceneUpdater, handlePickEvent(_, _));
@@ -5099,6 +5490,47 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, reportsPickedObjectsOfLatestPickEventInFrameAsynchronouslyIfEnabled)
+    {
+        DisplayConfigData config;
+        config.setDesiredWindowWidth(1280u);
+        config.setDesiredWindowHeight(480u);
+        config.setAsyncPickingEnabled(true);
+        createDisplayAndExpectSuccess(config);
+        const auto sceneIdx = createPublishAndSubscribeScene();
+        mapScene();
+
+        performFlushWithPickableTriangles(sceneIdx);
+
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, uploadDataBuffer(_, _, _, _, _));
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, updateDataBuffer(_, _, _, _, _));
+        update();
+
+        EXPECT_CALL(*rendererSceneUpdater, handlePickEvent(_, _)).Times(2u);
+        rendererSceneUpdater->handlePickEvent(getSceneId(), { -0.375000f, 0.250000f });
+        rendererSceneUpdater->handlePickEvent(getSceneId(), { -0.375000f, 0.250000f });
+        expectNoEvent();
+        EXPECT_TRUE(rendererSceneUpdater->hasPendingWork());
+
+        RendererEventVector events;
+        RendererEventVector sceneEvents;
+        for (int i = 0; i < 1000 && rendererSceneUpdater->hasPendingWork(); ++i)
+        {
+            PlatformThread::Sleep(1u);
+            update();
+            rendererEventCollector.appendAndConsumePendingEvents(events, sceneEvents);
+        }
+        EXPECT_TRUE(events.empty());
+        // both pick events handled within same frame result in single pick
+        ASSERT_EQ(1u, sceneEvents.size());
+        EXPECT_EQ(ERendererEventType::ObjectsPicked, sceneEvents[0].eventType);
+        EXPECT_EQ(getSceneId(), sceneEvents[0].sceneId);
+        EXPECT_EQ(2u, sceneEvents[0].pickedObjectIds.size());
+
+        unmapScene();
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, emitsSequenceOfSceneStateChangesWhenRepublished_fromSubscribed)
     {
         createPublishAndSubscribeScene();
@@ -34,6 +34,7 @@
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
 
 #include <cstdint>
+#include <array>
 #include <unordered_set>
 #include <memory>
 #include <string_view>
@@ -67,13 +68,13 @@ namespace ramses::internal {
         }
 
     protected:
-        void update()
+        void update(int numChecksForResourcesToBeUploaded = 1)
         {
             frameTimer.startFrame();
             renderer.getProfilerStatistics().markFrameFinished(std::chrono::microseconds{ 0u });
             EXPECT_CALL(sceneReferenceLogic, update());
             if (rendererSceneUpdater->m_resourceManagerMock)
-                EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, hasResourcesToBeUploaded());
+                EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, hasResourcesToBeUploaded()).Times(numChecksForResourcesToBeUploaded);
             rendererSceneUpdater->updateScenes();
         }
 
@@ -340,6 +341,47 @@ namespace ramses::internal {
             return nodeHandle;
         }
 
+        // 2 pickable triangles around origin rendered with camera covering viewport of 1280x480
+        void performFlushWithPickableTriangles(uint32_t sceneIndex)
+        {
+            IScene& iscene = *stagingScene[sceneIndex];
+            SceneAllocateHelper sceneAllocator(iscene);
+            const NodeHandle nodeHandle(0u);
+            sceneAllocator.allocateNode(0u, nodeHandle);
+            const std::array<float, 9> geomData{ -1.f, 0.f, -0.5f, 0.f, 1.f, -0.5f, 0.f, 0.f, -0.5f };
+            const auto geomHandle = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3F, uint32_t(geomData.size() * sizeof(float)));
+            iscene.updateDataBuffer(geomHandle, 0, uint32_t(geomData.size() * sizeof(float)), reinterpret_cast<const std::byte*>(geomData.data()));
+
+            const auto dataLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
+            const auto dataInstance = sceneAllocator.allocateDataInstance(dataLayout);
+            const auto vpDataRefLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
+            const auto vpOffsetInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
+            const auto vpSizeInstance = sceneAllocator.allocateDataInstance(vpDataRefLayout);
+            const auto frustumPlanesLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {});
+            const auto frustumPlanes = sceneAllocator.allocateDataInstance(frustumPlanesLayout);
+            const auto frustumNearFarLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {});
+            const auto frustumNearFar = sceneAllocator.allocateDataInstance(frustumNearFarLayout);
+            iscene.setDataReference(dataInstance, Camera::ViewportOffsetField, vpOffsetInstance);
+            iscene.setDataReference(dataInstance, Camera::ViewportSizeField, vpSizeInstance);
+            iscene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
+            iscene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
+            const auto cameraHandle = sceneAllocator.allocateCamera(ECameraProjectionType::Orthographic, nodeHandle, dataInstance);
+
+            iscene.setDataSingleVector2i(vpOffsetInstance, DataFieldHandle{ 0 }, { 0, 0 });
+            iscene.setDataSingleVector2i(vpSizeInstance, DataFieldHandle{ 0 }, { 1280, 480 });
+            const ProjectionParams params = ProjectionParams::Frustum(ECameraProjectionType::Orthographic, -1.f, 1.f, -1.f, 1.f, 0.1f, 100.f);
+            iscene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { params.leftPlane, params.rightPlane, params.bottomPlane, params.topPlane });
+            iscene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { params.nearPlane, params.farPlane });
+
+            const PickableObjectId id1{ 666u };
+            const PickableObjectId id2{ 667u };
+            const auto pickableHandle1 = sceneAllocator.allocatePickableObject(geomHandle, nodeHandle, id1);
+            const auto pickableHandle2 = sceneAllocator.allocatePickableObject(geomHandle, nodeHandle, id2);
+            iscene.setPickableObjectCamera(pickableHandle1, cameraHandle);
+            iscene.setPickableObjectCamera(pickableHandle2, cameraHandle);
+            performFlush(sceneIndex);
+        }
+
         void expectReadPixelsEvents(const std::initializer_list<std::tuple<OffscreenBufferHandle, bool /*success*/>>& expectedEvents)
         {
             RendererEventVector events;
@@ -1018,7 +1060,7 @@ namespace ramses::internal {
             renderer.doOneRenderLoop();
         }
 
-        void readPixels(OffscreenBufferHandle obHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool fullscreen, bool sendViaDLT, std::string_view filename)
+        void readPixels(OffscreenBufferHandle obHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool fullscreen, bool sendViaDLT, std::string_view filename, bool async = false)
         {
             ScreenshotInfo screenshotInfo;
             screenshotInfo.rectangle.x = x;
@@ -1028,6 +1070,7 @@ namespace ramses::internal {
             screenshotInfo.fullScreen = fullscreen;
             screenshotInfo.sendViaDLT = sendViaDLT;
             screenshotInfo.filename = filename;
+            screenshotInfo.async = async;
 
             rendererSceneUpdater->handleReadPixels(obHandle, std::move(screenshotInfo));
         }
@@ -33,6 +33,74 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, prefetchesResourcesOfSubscribedSceneAndKeepsThemReferencedWhenMapped)
+    {
+        DisplayConfigData config;
+        config.setScenePrefetch(SceneId(0u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        // resources are referenced and provided even though scene is not mapped
+        expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        update(2);
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+        // nothing new to prefetch
+        update(2);
+
+        // prefetch references are replaced by scene mapping references
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, unreferenceResourcesForScene(getSceneId(), UnorderedElementsAre(MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash)));
+        expectResourcesReferencedAndProvided_altogether({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        mapScene();
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+        EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+        unmapScene();
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotPrefetchResourcesOfSceneWithoutPrefetchEnabled)
+    {
+        DisplayConfigData config;
+        config.setScenePrefetch(SceneId(1u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        update(2);
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+        EXPECT_EQ(0, getResourceRefCount(MockResourceHash::EffectHash));
+        EXPECT_EQ(0, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, releasesPrefetchedResourcesWhenSceneUnsubscribed)
+    {
+        DisplayConfigData config;
+        config.setScenePrefetch(SceneId(0u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        update(2);
+
+        EXPECT_CALL(*rendererSceneUpdater->m_resourceManagerMock, unreferenceResourcesForScene(getSceneId(), UnorderedElementsAre(MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash)));
+        EXPECT_CALL(sceneEventSender, sendUnsubscribeScene(getSceneId()));
+        rendererSceneUpdater->handleSceneUnsubscriptionRequest(getSceneId(), false);
+        expectInternalSceneStateEvent(ERendererEventType::SceneUnsubscribed);
+        expectNoResourceReferencedByScene();
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, referencesAndProvidesOnlyResourcesInUseWhenSceneMapped)
     {
         createDisplayAndExpectSuccess();
@@ -1191,6 +1259,88 @@ namespace ramses::internal {
         destroyDisplay();
     }
 
+    TEST_F(ARendererSceneUpdater, mapsProgressivelyMappedSceneBeforeAllResourcesUploadedAndReportsWhenComplete)
+    {
+        DisplayConfigData config;
+        config.setSceneProgressiveMapping(SceneId(0u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        update();
+        EXPECT_TRUE(lastFlushWasAppliedOnRendererScene());
+
+        reportResourceAs(MockResourceHash::EffectHash, EResourceStatus::Provided);
+        expectResourcesReferencedAndProvided_altogether({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        requestMapScene();
+        update();
+        EXPECT_EQ(ESceneState::MappingAndUploading, sceneStateExecutor.getSceneState(getSceneId()));
+
+        // mapped even though effect is not uploaded yet
+        update();
+        EXPECT_EQ(ESceneState::Mapped, sceneStateExecutor.getSceneState(getSceneId()));
+        expectInternalSceneStateEvent(ERendererEventType::SceneMapped);
+        update();
+        expectNoEvent();
+
+        // simulate upload
+        reportResourceAs(MockResourceHash::EffectHash, EResourceStatus::Uploaded);
+        update();
+        expectSceneEvent(ERendererEventType::SceneResourcesComplete);
+
+        // reported only once
+        update();
+        expectNoEvent();
+
+        unmapScene();
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, reportsProgressivelyMappedSceneCompleteRightAfterMappingIfAllResourcesUploaded)
+    {
+        DisplayConfigData config;
+        config.setSceneProgressiveMapping(SceneId(0u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        update();
+
+        expectResourcesReferencedAndProvided_altogether({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        mapScene();
+        expectSceneEvent(ERendererEventType::SceneResourcesComplete);
+
+        unmapScene();
+        destroyDisplay();
+    }
+
+    TEST_F(ARendererSceneUpdater, doesNotReportProgressivelyMappedSceneCompleteIfUnmappedBefore)
+    {
+        DisplayConfigData config;
+        config.setSceneProgressiveMapping(SceneId(0u), true);
+        createDisplayAndExpectSuccess(config);
+        createPublishAndSubscribeScene();
+
+        createRenderable();
+        setRenderableResources();
+        update();
+
+        reportResourceAs(MockResourceHash::EffectHash, EResourceStatus::Provided);
+        expectResourcesReferencedAndProvided_altogether({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash });
+        mapScene();
+        update();
+        expectNoEvent();
+
+        unmapScene();
+        reportResourceAs(MockResourceHash::EffectHash, EResourceStatus::Uploaded);
+        update();
+        expectNoEvent();
+
+        destroyDisplay();
+    }
+
     TEST_F(ARendererSceneUpdater, onlyMapsASceneIfAllNeededResourcesAreUploaded_WithTwoDifferentBlockingResources)
     {
         createDisplayAndExpectSuccess();
@@ -109,6 +109,40 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), HasSubstr("Scene 22: rendered 1"));
     }
 
+    TEST_F(ARendererStatistics, tracksSceneCpuTime)
+    {
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::FlushApplication, std::chrono::microseconds{ 10 });
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::FlushApplication, std::chrono::microseconds{ 5 });
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::ResourceBookkeeping, std::chrono::microseconds{ 2 });
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::Transformations, std::chrono::microseconds{ 3 });
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::Rendering, std::chrono::microseconds{ 40 });
+        stats.sceneRendered(sceneId2);
+        stats.frameFinished(0u);
+
+        EXPECT_THAT(logOutput(), HasSubstr("Scene 11: rendered 0"));
+        EXPECT_THAT(logOutput(), HasSubstr("cpuTimeUs apply/res/transf/render (15/2/3/40)"));
+        EXPECT_THAT(logOutput(), Not(HasSubstr("Scene 22: rendered 1, cpuTimeUs")));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("cpuTimeUs")));
+        EXPECT_THAT(logOutput(), Not(HasSubstr("Top scenes by CPU time")));
+    }
+
+    TEST_F(ARendererStatistics, listsTopScenesByCpuTime)
+    {
+        const SceneId sceneId3{ 33 };
+        const SceneId sceneId4{ 44 };
+        stats.sceneCpuTimeMeasured(sceneId1, ESceneCpuTime::Rendering, std::chrono::microseconds{ 20 });
+        stats.sceneCpuTimeMeasured(sceneId2, ESceneCpuTime::FlushApplication, std::chrono::microseconds{ 100 });
+        stats.sceneCpuTimeMeasured(sceneId3, ESceneCpuTime::Transformations, std::chrono::microseconds{ 10 });
+        stats.sceneCpuTimeMeasured(sceneId4, ESceneCpuTime::ResourceBookkeeping, std::chrono::microseconds{ 60 });
+        stats.frameFinished(0u);
+        stats.frameFinished(0u);
+
+        EXPECT_THAT(logOutput(), HasSubstr("Top scenes by CPU time: 22 (100us, 50us/frame), 44 (60us, 30us/frame), 11 (20us, 10us/frame)\n"));
+    }
+
     TEST_F(ARendererStatistics, tracksSceneArrivedFlushesIndependentlyFromFrames)
     {
         stats.trackArrivedFlush(sceneId1, 1, 2, 3, 4, std::chrono::milliseconds{0});
@@ -236,7 +270,23 @@ namespace ramses::internal
         stats.offscreenBufferSwapped(ob1, true);
         stats.frameFinished(0u);
 
-        EXPECT_THAT(logOutput(), HasSubstr("OB11: 2 (intr: 2)"));
+        EXPECT_THAT(logOutput(), HasSubstr("OB11: 2 (intr: 2) latency (1/1/1)"));
+    }
+
+    TEST_F(ARendererStatistics, tracksFramesFromInterruptionToSwapOfInterruptibleOffscreenBuffer)
+    {
+        // swapped without being interrupted
+        stats.offscreenBufferSwapped(ob1, true);
+        stats.frameFinished(0u);
+        // interrupted twice before swapped
+        stats.offscreenBufferInterrupted(ob1);
+        stats.frameFinished(0u);
+        stats.offscreenBufferInterrupted(ob1);
+        stats.frameFinished(0u);
+        stats.offscreenBufferSwapped(ob1, true);
+        stats.frameFinished(0u);
+
+        EXPECT_THAT(logOutput(), HasSubstr("OB11: 2 (intr: 2) latency (0/2/1)"));
     }
 
     TEST_F(ARendererStatistics, untracksOffscreenBuffer)
@@ -384,6 +434,58 @@ namespace ramses::internal
         EXPECT_THAT(logOutput(), Not(HasSubstr("Exp (")));
     }
 
+    TEST_F(ARendererStatistics, tracksSkippedRenderingPasses)
+    {
+        stats.renderingPassesSkipped(sceneId1, 3u);
+        stats.renderingPassesSkipped(sceneId1, 2u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("skippedPasses 5"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("skippedPasses")));
+    }
+
+    TEST_F(ARendererStatistics, tracksSceneGpuTime)
+    {
+        stats.sceneGpuTimeMeasured(sceneId1, std::chrono::microseconds{ 100 });
+        stats.sceneGpuTimeMeasured(sceneId1, std::chrono::microseconds{ 300 });
+        stats.sceneGpuTimeMeasured(sceneId2, std::chrono::microseconds{ 50 });
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("gpuTimeUs (100/300/200)"));
+        EXPECT_THAT(logOutput(), HasSubstr("gpuTimeUs (50/50/50)"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("gpuTimeUs")));
+    }
+
+    TEST_F(ARendererStatistics, tracksFlushPresentationLatency)
+    {
+        stats.flushPresented(sceneId1, std::chrono::microseconds{ 16000 });
+        stats.flushPresented(sceneId1, std::chrono::microseconds{ 32000 });
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("presentLatencyUs (16000/32000/24000)"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("presentLatencyUs")));
+    }
+
+    TEST_F(ARendererStatistics, tracksFramesWhereSceneBudgetExceeded)
+    {
+        stats.sceneBudgetExceeded(sceneId1);
+        stats.sceneBudgetExceeded(sceneId1);
+        stats.frameFinished(0u);
+        stats.sceneBudgetExceeded(sceneId1);
+        stats.frameFinished(0u);
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), HasSubstr("framesBudgetExceeded 2"));
+
+        stats.reset();
+        stats.frameFinished(0u);
+        EXPECT_THAT(logOutput(), Not(HasSubstr("framesBudgetExceeded")));
+    }
 
     TEST_F(ARendererStatistics, confidenceTest_fullLogOutput)
     {
@@ -7,6 +7,10 @@
 //  -------------------------------------------------------------------------
 
 #include "internal/RendererLib/RendererConfigData.h"
+#include "internal/RendererLib/DisplayConfigData.h"
+#include "internal/RendererLib/ResolutionScalingController.h"
+#include "internal/SceneGraph/SceneAPI/PixelRectangle.h"
+#include "internal/SceneGraph/SceneAPI/Camera.h"
 #include "RenderBackendMock.h"
 #include "PlatformMock.h"
 #include "internal/RendererLib/RenderingContext.h"
@@ -220,10 +224,11 @@ namespace ramses::internal
             }
         }
 
-        void scheduleScreenshot(const DeviceResourceHandle bufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+        void scheduleScreenshot(const DeviceResourceHandle bufferHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, bool async = false)
         {
             ScreenshotInfo screenshot;
             screenshot.rectangle = { x, y, width, height };
+            screenshot.async = async;
             renderer.scheduleScreenshot(bufferHandle, std::move(screenshot));
         }
 
@@ -775,6 +780,39 @@ namespace ramses::internal
         unassignScene(sceneId);
     }
 
+    TEST_P(ARenderer, measuresGpuTimeOfRenderedSceneIfGpuTimerQueriesEnabled)
+    {
+        createDisplayController();
+        renderer.setGpuTimerQueriesEnabled(true);
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+        showScene(sceneId);
+
+        auto& deviceMock = renderer.m_platform.renderBackendMock.deviceMock;
+        EXPECT_CALL(*renderer.m_displayController, getRenderBackend()).Times(AnyNumber());
+        EXPECT_CALL(deviceMock, collectGpuTimerQueryResults(_)).WillOnce([&](auto& results) {
+            results.push_back({ sceneId.getValue(), std::chrono::microseconds{ 150 } });
+        });
+        EXPECT_CALL(deviceMock, beginGpuTimerQuery(sceneId.getValue())).WillOnce(Return(true));
+        expectSceneRendered(sceneId);
+        EXPECT_CALL(deviceMock, endGpuTimerQuery());
+        expectFrameBufferRendered(true, EClearFlag::None);
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        renderer.getStatistics().frameFinished(0u);
+        StringOutputStream str;
+        renderer.getStatistics().writeStatsToStream(str);
+        EXPECT_THAT(str.release(), HasSubstr("gpuTimeUs (150/150/150)"));
+
+        // queries of scene are deleted when scene is unassigned
+        hideScene(sceneId);
+        EXPECT_CALL(deviceMock, deleteGpuTimerQueries(sceneId.getValue()));
+        unassignScene(sceneId);
+    }
+
     TEST_P(ARenderer, rendersTwoMappedAndShownScenes)
     {
         createDisplayController();
@@ -1005,6 +1043,57 @@ namespace ramses::internal
         ASSERT_EQ(0u, screenshots1.size());
     }
 
+    TEST_P(ARenderer, dispatchesAsynchronousScreenshotOnlyAfterReadBackFinished)
+    {
+        createDisplayController();
+
+        scheduleScreenshot(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u, true);
+
+        const DeviceResourceHandle readHandle{ 901u };
+        EXPECT_CALL(*renderer.m_displayController, readPixels(_, _, _, _, _, _)).Times(0);
+        EXPECT_CALL(*renderer.m_displayController, startReadPixels(DisplayControllerMock::FakeFrameBufferHandle, 20u, 30u, 100u, 100u)).WillOnce(Return(readHandle));
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(readHandle, _)).WillOnce(Return(false));
+        EXPECT_TRUE(renderer.dispatchProcessedScreenshots().empty());
+
+        // read back is started only once
+        expectFrameBufferRendered(false);
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(readHandle, _)).WillOnce(Invoke([](auto, auto& data) { data.resize(100u * 100u * 4u); return true; }));
+        auto screenshots = renderer.dispatchProcessedScreenshots();
+        ASSERT_EQ(1u, screenshots.size());
+        EXPECT_EQ(DisplayControllerMock::FakeFrameBufferHandle, screenshots.front().first);
+        EXPECT_EQ(100u * 100u * 4u, screenshots.front().second.pixelData.size());
+
+        EXPECT_TRUE(renderer.dispatchProcessedScreenshots().empty());
+    }
+
+    TEST_P(ARenderer, deletesPendingAsynchronousScreenshotWhenOffscreenBufferUnregistered)
+    {
+        createDisplayController();
+        const DeviceResourceHandle obDeviceHandle{ 567u };
+        renderer.registerOffscreenBuffer(obDeviceHandle, 10u, 20u, 0u, false);
+
+        scheduleScreenshot(obDeviceHandle, 1u, 2u, 3u, 4u, true);
+
+        const DeviceResourceHandle readHandle{ 901u };
+        EXPECT_CALL(*renderer.m_displayController, startReadPixels(obDeviceHandle, 1u, 2u, 3u, 4u)).WillOnce(Return(readHandle));
+        expectOffscreenBufferCleared(obDeviceHandle);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        EXPECT_CALL(*renderer.m_displayController, deleteReadPixels(readHandle));
+        renderer.unregisterOffscreenBuffer(obDeviceHandle);
+
+        EXPECT_CALL(*renderer.m_displayController, finishReadPixels(_, _)).Times(0);
+        EXPECT_TRUE(renderer.dispatchProcessedScreenshots().empty());
+    }
+
     TEST_P(ARenderer, marksRenderOncePassesAsRenderedAfterRenderingScene)
     {
         createDisplayController();
@@ -1190,6 +1279,105 @@ namespace ramses::internal
         unassignScene(sceneId);
     }
 
+    TEST_P(ARenderer, rerendersOffscreenBufferWithRenderRateDivisorOnlyInItsRenderFramesAndRerendersFramebufferAfterwards)
+    {
+        createDisplayController();
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+
+        const DeviceResourceHandle fakeOffscreenBuffer(313u);
+        renderer.registerOffscreenBuffer(fakeOffscreenBuffer, 1u, 2u, 0u, false);
+        renderer.setRenderRateDivisor(fakeOffscreenBuffer, 2u);
+        assignSceneToDisplayBuffer(sceneId, 0, fakeOffscreenBuffer);
+        showScene(sceneId);
+
+        expectSceneRendered(sceneId, fakeOffscreenBuffer, EDiscardDepth::Allowed);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // change is deferred to next render frame of OB
+        renderer.markBufferWithSceneForRerender(sceneId);
+        expectFrameBufferRendered(false);
+        doOneRendererLoop();
+
+        expectSceneRendered(sceneId, fakeOffscreenBuffer, EDiscardDepth::Allowed);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // no change
+        expectFrameBufferRendered(false);
+        doOneRendererLoop();
+        expectFrameBufferRendered(false);
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+    }
+
+    TEST_P(ARenderer, rendersScalableOffscreenBufferIntoScaledRenderTargetAndScalesItUpWhenGpuFrameTimeExceedsThreshold)
+    {
+        DisplayConfigData displayConfig;
+        displayConfig.setOffscreenBufferScalingGpuTimeThreshold(std::chrono::microseconds{ 1000 });
+        renderer.createDisplayContext(displayConfig);
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+
+        const DeviceResourceHandle fakeOffscreenBuffer(313u);
+        const DeviceResourceHandle fakeScaledRenderTarget(314u);
+        renderer.registerOffscreenBuffer(fakeOffscreenBuffer, 64u, 32u, 0u, false);
+        renderer.setScaledRenderTarget(fakeOffscreenBuffer, fakeScaledRenderTarget);
+        assignSceneToDisplayBuffer(sceneId, 0, fakeOffscreenBuffer);
+        showScene(sceneId);
+
+        // GPU time is measured even with GPU timer queries not enabled explicitly
+        auto& deviceMock = renderer.m_platform.renderBackendMock.deviceMock;
+        EXPECT_CALL(*renderer.m_displayController, getRenderBackend()).Times(AnyNumber());
+        EXPECT_CALL(deviceMock, collectGpuTimerQueryResults(_)).WillRepeatedly([&](auto& results) {
+            results.push_back({ sceneId.getValue(), std::chrono::microseconds{ 2000 } });
+        });
+        EXPECT_CALL(deviceMock, beginGpuTimerQuery(sceneId.getValue())).WillRepeatedly(Return(true));
+        EXPECT_CALL(deviceMock, endGpuTimerQuery()).Times(AnyNumber());
+
+        expectSceneRendered(sceneId, fakeOffscreenBuffer, EDiscardDepth::Allowed);
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        for (uint32_t i = 1u; i < ResolutionScalingController::FramesToStartScaling - 1u; ++i)
+        {
+            expectFrameBufferRendered(false);
+            doOneRendererLoop();
+        }
+
+        // scaling starts, all buffers are re-rendered
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(rendererScenes.getScene(sceneId)), _, nullptr))
+            .WillOnce([&](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_EQ(fakeScaledRenderTarget, renderContext.displayBufferDeviceHandle);
+            EXPECT_EQ(32u, renderContext.viewportWidth);
+            EXPECT_EQ(16u, renderContext.viewportHeight);
+            EXPECT_FLOAT_EQ(ResolutionScalingController::Scale, renderContext.resolutionScale);
+            return sceneRenderBegin;
+        });
+        EXPECT_CALL(deviceMock, blitRenderTargets(fakeScaledRenderTarget, fakeOffscreenBuffer, _, _, true))
+            .WillOnce([](auto /*unused*/, auto /*unused*/, const PixelRectangle& srcRect, const PixelRectangle& dstRect, auto /*unused*/) {
+            EXPECT_EQ(32, srcRect.width);
+            EXPECT_EQ(16, srcRect.height);
+            EXPECT_EQ(64, dstRect.width);
+            EXPECT_EQ(32, dstRect.height);
+        });
+        expectFrameBufferRendered();
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        EXPECT_CALL(deviceMock, deleteGpuTimerQueries(sceneId.getValue()));
+        unassignScene(sceneId);
+    }
+
     TEST_P(ARenderer, clearAndRerenderBothFramebufferAndOffscreenBufferIfSceneAssignedFromOneToTheOther)
     {
         createDisplayController();
@@ -2658,4 +2846,165 @@ namespace ramses::internal
         unassignScene(sceneIdFB);
         unassignScene(sceneIdOBint);
     }
+
+    TEST_P(ARenderer, redrawsAndSwapsOnlyRegionDamagedBySceneWithPartialRedrawEnabled)
+    {
+        createDisplayController();
+        renderer.setPartialRedrawEnabled(true);
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+        showScene(sceneId);
+
+        auto& scene = rendererScenes.getScene(sceneId);
+        TestSceneHelper sceneHelper(scene);
+        const RenderPassHandle pass = sceneHelper.m_sceneAllocator.allocateRenderPass();
+        scene.setRenderPassCamera(pass, sceneHelper.createCamera(ECameraProjectionType::Orthographic, { 0.1f, 1.f }, { -1.f, 1.f, -1.f, 1.f }, { 10, 20 }, { 30, 40 }));
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        const Quad sceneRegion{ 10, 20, 30, 40 };
+
+        // newly shown scene is rendered fully
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _)).WillOnce([](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_FALSE(renderContext.limitToRedrawRegion);
+            return SceneRenderExecutionIterator{};
+        });
+        expectFrameBufferRendered(true, EClearFlag::None);
+        EXPECT_CALL(*renderer.m_displayController, swapBuffersWithDamage(_)).InSequence(SeqRender);
+        EXPECT_CALL(*renderer.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(renderer.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+        doOneRendererLoop();
+
+        // modified scene damages only its viewport, back buffer with age 1 needs only that region to be redrawn
+        renderer.markBufferWithSceneForRerender(sceneId);
+        EXPECT_CALL(renderer.m_platform.renderBackendMock.contextMock, getBufferAge()).WillOnce(Return(1u));
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _)).WillOnce([&](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_TRUE(renderContext.limitToRedrawRegion);
+            EXPECT_EQ(sceneRegion, renderContext.redrawRegion);
+            return SceneRenderExecutionIterator{};
+        });
+        expectFrameBufferRendered(true, EClearFlag::None);
+        EXPECT_CALL(*renderer.m_displayController, swapBuffersWithDamage(sceneRegion)).InSequence(SeqRender);
+        EXPECT_CALL(*renderer.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(renderer.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+        doOneRendererLoop();
+
+        // back buffer with age 3 was last rendered before the full frame, it has to be redrawn fully
+        renderer.markBufferWithSceneForRerender(sceneId);
+        EXPECT_CALL(renderer.m_platform.renderBackendMock.contextMock, getBufferAge()).WillOnce(Return(3u));
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _)).WillOnce([](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_FALSE(renderContext.limitToRedrawRegion);
+            return SceneRenderExecutionIterator{};
+        });
+        expectFrameBufferRendered(true, EClearFlag::None);
+        EXPECT_CALL(*renderer.m_displayController, swapBuffersWithDamage(sceneRegion)).InSequence(SeqRender);
+        EXPECT_CALL(*renderer.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(renderer.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+    }
+
+    TEST_P(ARenderer, damagesRegionWhereSceneWasRenderedBeforePartialRedrawWasEnabled)
+    {
+        createDisplayController();
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+
+        auto& scene = rendererScenes.getScene(sceneId);
+        TestSceneHelper sceneHelper(scene);
+        const RenderPassHandle pass = sceneHelper.m_sceneAllocator.allocateRenderPass();
+        const CameraHandle camera = sceneHelper.createCamera(ECameraProjectionType::Orthographic, { 0.1f, 1.f }, { -1.f, 1.f, -1.f, 1.f }, { 10, 20 }, { 30, 40 });
+        scene.setRenderPassCamera(pass, camera);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        showScene(sceneId);
+
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _));
+        expectFrameBufferRendered(true, EClearFlag::None);
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // enabling redraws framebuffer fully
+        renderer.setPartialRedrawEnabled(true);
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _)).WillOnce([](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_FALSE(renderContext.limitToRedrawRegion);
+            return SceneRenderExecutionIterator{};
+        });
+        expectFrameBufferRendered(true, EClearFlag::None);
+        EXPECT_CALL(*renderer.m_displayController, swapBuffersWithDamage(_)).InSequence(SeqRender);
+        EXPECT_CALL(*renderer.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(renderer.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+        doOneRendererLoop();
+
+        // moving viewport damages both region it was rendered to and region it is moved to
+        const auto vpOffsetRef = scene.getDataReference(scene.getCamera(camera).dataInstance, Camera::ViewportOffsetField);
+        scene.setDataSingleVector2i(vpOffsetRef, DataFieldHandle{ 0 }, { 50, 60 });
+        renderer.markBufferWithSceneForRerender(sceneId);
+        const Quad damagedRegion{ 10, 20, 70, 80 };
+        EXPECT_CALL(renderer.m_platform.renderBackendMock.contextMock, getBufferAge()).WillOnce(Return(1u));
+        EXPECT_CALL(*renderer.m_displayController, renderScene(Ref(scene), _, _)).WillOnce([&](const auto& /*unused*/, RenderingContext& renderContext, const auto* /*unused*/) {
+            EXPECT_TRUE(renderContext.limitToRedrawRegion);
+            EXPECT_EQ(damagedRegion, renderContext.redrawRegion);
+            return SceneRenderExecutionIterator{};
+        });
+        expectFrameBufferRendered(true, EClearFlag::None);
+        EXPECT_CALL(*renderer.m_displayController, swapBuffersWithDamage(damagedRegion)).InSequence(SeqRender);
+        EXPECT_CALL(*renderer.m_displayController, getEmbeddedCompositingManager()).InSequence(SeqRender);
+        EXPECT_CALL(renderer.m_embeddedCompositingManager, notifyClients()).InSequence(SeqRender);
+        doOneRendererLoop();
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+    }
+
+    TEST_P(ARenderer, reportsFramebufferShowingOnlyOpaqueStreamBufferAsDirectScanoutCandidate)
+    {
+        createDisplayController();
+
+        const SceneId sceneId(12u);
+        createScene(sceneId);
+        assignSceneToDisplayBuffer(sceneId, 0);
+        showScene(sceneId);
+
+        auto& scene = rendererScenes.getScene(sceneId);
+        TestSceneHelper sceneHelper(scene);
+        const RenderPassHandle pass = sceneHelper.m_sceneAllocator.allocateRenderPass();
+        scene.setRenderPassCamera(pass, sceneHelper.createCamera(ECameraProjectionType::Orthographic, { 0.1f, 1.f }, { -1.f, 1.f, -1.f, 1.f }, { 0, 0 },
+            { float(WindowMock::FakeWidth), float(WindowMock::FakeHeight) }));
+        const RenderableHandle renderable = sceneHelper.createRenderable(sceneHelper.createRenderGroup(pass));
+        const RenderStateHandle renderState = sceneHelper.m_sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(renderable, renderState);
+        const TextureSamplerHandle sampler = sceneHelper.createTextureSamplerWithFakeTexture();
+        sceneHelper.createAndAssignUniformDataInstance(renderable, sampler);
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        sceneHelper.m_sceneAllocator.allocateDataSlot({ EDataSlotType::TextureConsumer, DataSlotId{ 11u }, NodeHandle(), DataInstanceHandle::Invalid(), ResourceContentHash::Invalid(), sampler });
+        scene.setTextureSamplerContentSource(sampler, StreamBufferHandle{ 3u });
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+
+        expectSceneRendered(sceneId);
+        expectFrameBufferRendered(true, EClearFlag::None);
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        // blending makes content depend on what is below it
+        scene.setRenderStateBlendOperations(renderState, EBlendOperation::Add, EBlendOperation::Add);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        renderer.markBufferWithSceneForRerender(sceneId);
+        expectSceneRendered(sceneId);
+        expectFrameBufferRendered(true, EClearFlag::None);
+        expectSwapBuffers();
+        doOneRendererLoop();
+
+        renderer.getStatistics().frameFinished(0u);
+        StringOutputStream str;
+        renderer.getStatistics().writeStatsToStream(str);
+        EXPECT_THAT(str.release(), HasSubstr("FB: 2 (scanoutCandidate 1)"));
+
+        hideScene(sceneId);
+        unassignScene(sceneId);
+    }
 }
@@ -0,0 +1,94 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResolutionScalingController.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AResolutionScalingController : public testing::Test
+    {
+    protected:
+        void updateOverThreshold(uint32_t frames)
+        {
+            for (uint32_t i = 0u; i < frames; ++i)
+                controller.update(OverThreshold);
+        }
+
+        static constexpr std::chrono::microseconds Threshold{ 10000 };
+        static constexpr std::chrono::microseconds OverThreshold{ 12000 };
+        static constexpr std::chrono::microseconds ClearlyUnderThreshold{ 5000 };
+        ResolutionScalingController controller{ Threshold };
+    };
+
+    TEST_F(AResolutionScalingController, isDisabledWithZeroThresholdAndNeverScales)
+    {
+        ResolutionScalingController disabledController{ std::chrono::microseconds{ 0 } };
+        EXPECT_FALSE(disabledController.isEnabled());
+        for (uint32_t i = 0u; i < 100u; ++i)
+            EXPECT_FALSE(disabledController.update(OverThreshold));
+        EXPECT_FALSE(disabledController.isScaling());
+    }
+
+    TEST_F(AResolutionScalingController, doesNotScaleInitially)
+    {
+        EXPECT_TRUE(controller.isEnabled());
+        EXPECT_FALSE(controller.isScaling());
+    }
+
+    TEST_F(AResolutionScalingController, startsScalingAfterConsecutiveFramesOverThreshold)
+    {
+        updateOverThreshold(ResolutionScalingController::FramesToStartScaling - 1u);
+        EXPECT_FALSE(controller.isScaling());
+        EXPECT_TRUE(controller.update(OverThreshold));
+        EXPECT_TRUE(controller.isScaling());
+    }
+
+    TEST_F(AResolutionScalingController, doesNotStartScalingIfFramesOverThresholdAreInterrupted)
+    {
+        for (uint32_t i = 0u; i < 10u; ++i)
+        {
+            updateOverThreshold(ResolutionScalingController::FramesToStartScaling - 1u);
+            EXPECT_FALSE(controller.update(Threshold));
+        }
+        EXPECT_FALSE(controller.isScaling());
+    }
+
+    TEST_F(AResolutionScalingController, stopsScalingOnlyAfterManyFramesClearlyUnderThreshold)
+    {
+        updateOverThreshold(ResolutionScalingController::FramesToStartScaling);
+        ASSERT_TRUE(controller.isScaling());
+
+        // just under threshold is not enough
+        for (uint32_t i = 0u; i < 2u * ResolutionScalingController::FramesToStopScaling; ++i)
+            EXPECT_FALSE(controller.update(Threshold - std::chrono::microseconds{ 1 }));
+        EXPECT_TRUE(controller.isScaling());
+
+        for (uint32_t i = 0u; i < ResolutionScalingController::FramesToStopScaling - 1u; ++i)
+            EXPECT_FALSE(controller.update(ClearlyUnderThreshold));
+        EXPECT_TRUE(controller.isScaling());
+        EXPECT_TRUE(controller.update(ClearlyUnderThreshold));
+        EXPECT_FALSE(controller.isScaling());
+    }
+
+    TEST_F(AResolutionScalingController, restartsCountingTowardsStopOfScalingAfterFrameOverThreshold)
+    {
+        updateOverThreshold(ResolutionScalingController::FramesToStartScaling);
+        for (uint32_t i = 0u; i < ResolutionScalingController::FramesToStopScaling - 1u; ++i)
+            controller.update(ClearlyUnderThreshold);
+        controller.update(OverThreshold);
+        controller.update(ClearlyUnderThreshold);
+        EXPECT_TRUE(controller.isScaling());
+    }
+
+    TEST(AResolutionScalingControllerScaledSize, scalesSizeButNeverToZero)
+    {
+        EXPECT_EQ(static_cast<uint32_t>(640.f * ResolutionScalingController::Scale), ResolutionScalingController::GetScaledSize(640u));
+        EXPECT_EQ(1u, ResolutionScalingController::GetScaledSize(1u));
+    }
+}
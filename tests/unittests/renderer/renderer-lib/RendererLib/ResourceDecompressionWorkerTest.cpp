@@ -0,0 +1,97 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResourceDecompressionWorker.h"
+#include "internal/SceneGraph/Resource/ArrayResource.h"
+#include "internal/Watchdog/ThreadAliveNotifierMock.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <thread>
+
+using namespace testing;
+using namespace std::chrono_literals;
+namespace ramses::internal
+{
+    class AResourceDecompressionWorker : public testing::Test
+    {
+    protected:
+        static ManagedResource CreateCompressedResource(float value)
+        {
+            const std::array<float, 256> data{ value };
+            ArrayResource dataResource(EResourceType::VertexArray, uint32_t(data.size()), EDataType::Float, data.data(), {});
+            dataResource.compress(IResource::CompressionLevel::Realtime);
+            const auto& compressedData = dataResource.getCompressedResourceData();
+
+            auto resource = std::make_shared<ArrayResource>(EResourceType::VertexArray, uint32_t(data.size()), EDataType::Float, nullptr, std::string_view{});
+            resource->setCompressedResourceData(CompressedResourceBlob(compressedData.size(), compressedData.data()), IResource::CompressionLevel::Realtime,
+                dataResource.getDecompressedDataSize(), dataResource.getHash());
+            return resource;
+        }
+
+        static bool WaitUntilDecompressed(const IResource& resource)
+        {
+            for (int i = 0; i < 500 && !resource.isDeCompressedAvailable(); ++i)
+                std::this_thread::sleep_for(10ms);
+            return resource.isDeCompressedAvailable();
+        }
+
+        NiceMock<ThreadAliveNotifierMock> notifier;
+        ResourceDecompressionWorker worker{ notifier };
+    };
+
+    TEST_F(AResourceDecompressionWorker, decompressesScheduledResourcesInBackground)
+    {
+        ManagedResourceVector resources{ CreateCompressedResource(1.f), CreateCompressedResource(2.f) };
+        ASSERT_FALSE(resources[0]->isDeCompressedAvailable());
+        ASSERT_FALSE(resources[1]->isDeCompressedAvailable());
+
+        worker.shareAndScheduleDecompression(resources);
+        EXPECT_TRUE(WaitUntilDecompressed(*resources[0]));
+        EXPECT_TRUE(WaitUntilDecompressed(*resources[1]));
+    }
+
+    TEST_F(AResourceDecompressionWorker, replacesResourceWithSameContentByAlreadyDispatchedInstance)
+    {
+        ManagedResourceVector resourcesForDisplay1{ CreateCompressedResource(1.f) };
+        ManagedResourceVector resourcesForDisplay2{ CreateCompressedResource(1.f), CreateCompressedResource(2.f) };
+        const auto otherResource = resourcesForDisplay2[1];
+        ASSERT_NE(resourcesForDisplay1[0], resourcesForDisplay2[0]);
+        ASSERT_EQ(resourcesForDisplay1[0]->getHash(), resourcesForDisplay2[0]->getHash());
+
+        worker.shareAndScheduleDecompression(resourcesForDisplay1);
+        worker.shareAndScheduleDecompression(resourcesForDisplay2);
+        EXPECT_EQ(resourcesForDisplay1[0], resourcesForDisplay2[0]);
+        EXPECT_EQ(otherResource, resourcesForDisplay2[1]);
+        EXPECT_TRUE(WaitUntilDecompressed(*resourcesForDisplay2[0]));
+    }
+
+    TEST_F(AResourceDecompressionWorker, doesNotKeepSharedResourcesAlive)
+    {
+        ManagedResourceVector resources{ CreateCompressedResource(1.f) };
+        worker.shareAndScheduleDecompression(resources);
+        std::weak_ptr<const IResource> dispatchedResource = resources[0];
+        resources.clear();
+
+        for (int i = 0; i < 500 && !dispatchedResource.expired(); ++i)
+            std::this_thread::sleep_for(10ms);
+        EXPECT_TRUE(dispatchedResource.expired());
+
+        ManagedResourceVector newResources{ CreateCompressedResource(1.f) };
+        const auto newResource = newResources[0];
+        worker.shareAndScheduleDecompression(newResources);
+        EXPECT_EQ(newResource, newResources[0]);
+    }
+
+    TEST_F(AResourceDecompressionWorker, doesNotScheduleAlreadyDecompressedResource)
+    {
+        const std::array<float, 4> data{ 1.f };
+        ManagedResourceVector resources{ std::make_shared<ArrayResource>(EResourceType::VertexArray, uint32_t(data.size()), EDataType::Float, data.data(), std::string_view{}) };
+        worker.shareAndScheduleDecompression(resources);
+        EXPECT_EQ(0u, worker.getNumberOfResourcesScheduledForDecompression());
+    }
+}
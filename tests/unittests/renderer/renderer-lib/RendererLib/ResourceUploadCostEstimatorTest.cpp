@@ -0,0 +1,69 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/ResourceUploadCostEstimator.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AResourceUploadCostEstimator : public testing::Test
+    {
+    protected:
+        ResourceUploadCostEstimator estimator;
+    };
+
+    TEST_F(AResourceUploadCostEstimator, estimatesAtLeastFixedCostForEmptyResource)
+    {
+        EXPECT_EQ(ResourceUploadCostEstimator::FixedCost, estimator.estimate(EResourceType::IndexArray, 0u));
+        EXPECT_EQ(ResourceUploadCostEstimator::FixedCost, estimator.estimate(EResourceType::Texture2D, 0u));
+    }
+
+    TEST_F(AResourceUploadCostEstimator, estimatesHigherCostForLargerResource)
+    {
+        EXPECT_LT(estimator.estimate(EResourceType::VertexArray, 10000u), estimator.estimate(EResourceType::VertexArray, 1000000u));
+        EXPECT_LT(estimator.estimate(EResourceType::Texture2D, 10000u), estimator.estimate(EResourceType::Texture2D, 1000000u));
+    }
+
+    TEST_F(AResourceUploadCostEstimator, estimatesEffectsAsMoreExpensiveThanBuffersOfSameSize)
+    {
+        EXPECT_GT(estimator.estimate(EResourceType::Effect, 10000u), estimator.estimate(EResourceType::IndexArray, 10000u));
+    }
+
+    TEST_F(AResourceUploadCostEstimator, adaptsEstimateTowardsMeasuredUploadTime)
+    {
+        constexpr uint32_t size = 1000000u;
+        const std::chrono::microseconds measured{ 20000 };
+        const auto initialEstimate = estimator.estimate(EResourceType::Texture2D, size);
+        ASSERT_LT(initialEstimate, measured);
+
+        estimator.recordUpload(EResourceType::Texture2D, size, measured);
+        const auto adaptedEstimate = estimator.estimate(EResourceType::Texture2D, size);
+        EXPECT_GT(adaptedEstimate, initialEstimate);
+        EXPECT_LT(adaptedEstimate, measured);
+
+        for (int i = 0; i < 100; ++i)
+            estimator.recordUpload(EResourceType::Texture2D, size, measured);
+        EXPECT_NEAR(double(measured.count()), double(estimator.estimate(EResourceType::Texture2D, size).count()), 10.0);
+    }
+
+    TEST_F(AResourceUploadCostEstimator, adaptsEstimateOnlyForMeasuredResourceType)
+    {
+        const auto initialEstimate = estimator.estimate(EResourceType::VertexArray, 100000u);
+        ASSERT_EQ(initialEstimate, estimator.estimate(EResourceType::IndexArray, 100000u));
+        estimator.recordUpload(EResourceType::IndexArray, 100000u, std::chrono::microseconds{ 0 });
+        EXPECT_EQ(initialEstimate, estimator.estimate(EResourceType::VertexArray, 100000u));
+        EXPECT_LT(estimator.estimate(EResourceType::IndexArray, 100000u), initialEstimate);
+    }
+
+    TEST_F(AResourceUploadCostEstimator, ignoresUploadsOfSmallResources)
+    {
+        const auto initialEstimate = estimator.estimate(EResourceType::Effect, 1000u);
+        estimator.recordUpload(EResourceType::Effect, ResourceUploadCostEstimator::MinSizeToMeasure - 1u, std::chrono::microseconds{ 0 });
+        EXPECT_EQ(initialEstimate, estimator.estimate(EResourceType::Effect, 1000u));
+    }
+}
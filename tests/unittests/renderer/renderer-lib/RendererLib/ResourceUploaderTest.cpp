@@ -104,7 +104,7 @@ namespace ramses::internal
         resourceObject.resource = managedRes;
         EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
 
-        EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize())).WillOnce(Return(DeviceResourceHandle(123)));
+        EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize(), EDeviceBufferUsage::Static)).WillOnce(Return(DeviceResourceHandle(123)));
         EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(DeviceResourceHandle(123), res.getResourceData().data(), res.getDecompressedDataSize()));
         EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
         EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
@@ -118,7 +118,7 @@ namespace ramses::internal
         resourceObject.resource = managedRes;
         EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
 
-        EXPECT_CALL(renderer.deviceMock, allocateIndexBuffer(res.getElementType(), res.getDecompressedDataSize())).WillOnce(Return(DeviceResourceHandle(123)));
+        EXPECT_CALL(renderer.deviceMock, allocateIndexBuffer(res.getElementType(), res.getDecompressedDataSize(), EDeviceBufferUsage::Static)).WillOnce(Return(DeviceResourceHandle(123)));
         EXPECT_CALL(renderer.deviceMock, uploadIndexBufferData(DeviceResourceHandle(123), res.getResourceData().data(), res.getDecompressedDataSize()));
         EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
         EXPECT_EQ(res.getDecompressedDataSize(), vramSize);
@@ -141,6 +141,34 @@ namespace ramses::internal
         EXPECT_EQ(2u * 2 + 1, vramSize);
     }
 
+    TEST_F(AResourceUploader, doesNotReturnDeviceHandleForLargeTextureIfAsyncUploadEnabled)
+    {
+        const TextureMetaInfo texDesc(2048u, 1024u, 1u, EPixelStorageFormat::R8, false, DefaultTextureSwizzleArray, { 2048u * 1024u });
+        TextureResource res(EResourceType::Texture2D, texDesc, {});
+        ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+        ResourceDescriptor resourceObject;
+        resourceObject.resource = managedRes;
+        EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+
+        EXPECT_FALSE(uploader.uploadResource(renderer, resourceObject, vramSize).has_value());
+    }
+
+    TEST_F(AResourceUploader, uploadsLargeTextureIfAsyncUploadDisabled)
+    {
+        ResourceUploader uploaderWithoutAsyncUpload(false);
+
+        const TextureMetaInfo texDesc(2048u, 1024u, 1u, EPixelStorageFormat::R8, false, DefaultTextureSwizzleArray, { 2048u * 1024u });
+        TextureResource res(EResourceType::Texture2D, texDesc, {});
+        ManagedResource managedRes{ &res, dummyManagedResourceCallback };
+        ResourceDescriptor resourceObject;
+        resourceObject.resource = managedRes;
+        EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
+
+        EXPECT_CALL(renderer.deviceMock, allocateTexture2D(2048u, 1024u, EPixelStorageFormat::R8, DefaultTextureSwizzleArray, 1u, 2048u * 1024u)).WillOnce(Return(DeviceResourceHandle(123)));
+        EXPECT_CALL(renderer.deviceMock, uploadTextureData(DeviceResourceHandle(123), 0u, 0u, 0u, 0u, 2048u, 1024u, 1u, _, _, 0u));
+        EXPECT_EQ(123u, uploaderWithoutAsyncUpload.uploadResource(renderer, resourceObject, vramSize));
+    }
+
     TEST_F(AResourceUploader, uploadsTexture2DResourceWithNonDefaultTextureSwizzleArray)
     {
         const uint32_t mipCount = 1u;
@@ -563,11 +591,11 @@ namespace ramses::internal
         resourceObject.resource = managedRes;
         EXPECT_CALL(managedResourceDeleter, managedResourceDeleted(_)).Times(1);
 
-        EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize())).WillOnce(Return(DeviceResourceHandle(123)));
+        EXPECT_CALL(renderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize(), EDeviceBufferUsage::Static)).WillOnce(Return(DeviceResourceHandle(123)));
         EXPECT_CALL(renderer.deviceMock, uploadVertexBufferData(DeviceResourceHandle(123), res.getResourceData().data(), res.getDecompressedDataSize()));
         EXPECT_EQ(123u, uploader.uploadResource(renderer, resourceObject, vramSize));
 
-        EXPECT_CALL(additionalRenderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize())).WillOnce(Return(DeviceResourceHandle(123)));
+        EXPECT_CALL(additionalRenderer.deviceMock, allocateVertexBuffer(res.getDecompressedDataSize(), EDeviceBufferUsage::Static)).WillOnce(Return(DeviceResourceHandle(123)));
         EXPECT_CALL(additionalRenderer.deviceMock, uploadVertexBufferData(DeviceResourceHandle(123), res.getResourceData().data(), res.getDecompressedDataSize()));
         EXPECT_EQ(123u, uploader.uploadResource(additionalRenderer, resourceObject, vramSize));
     }
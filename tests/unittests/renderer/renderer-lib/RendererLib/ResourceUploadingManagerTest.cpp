@@ -19,6 +19,7 @@
 #include "MockResourceHash.h"
 #include "internal/Components/ResourceDeleterCallingCallback.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
+#include "internal/PlatformAbstraction/Collections/StringOutputStream.h"
 #include "internal/Watchdog/ThreadAliveNotifierMock.h"
 
 namespace ramses::internal
@@ -26,6 +27,9 @@ namespace ramses::internal
 
     namespace
     {
+        // large enough for upload to be measured by upload cost estimator
+        constexpr uint32_t LargeResourceSize = 250000u;
+
         DisplayConfigData makeConfig(uint64_t resourceCacheSize, SceneId preferredScene, SceneId deprivedScene)
         {
             DisplayConfigData cfg;
@@ -191,6 +195,34 @@ namespace ramses::internal
         }
     };
 
+    class AResourceUploadingManager_WithLargeVRAMCache : public AResourceUploadingManager
+    {
+    public:
+        AResourceUploadingManager_WithLargeVRAMCache()
+            : AResourceUploadingManager(makeConfig(100000u, {}, {}))
+        {
+        }
+    };
+
+    class AResourceUploadingManager_WithVRAMCacheAndScenePriority : public AResourceUploadingManager
+    {
+    public:
+        AResourceUploadingManager_WithVRAMCacheAndScenePriority()
+            : AResourceUploadingManager(makeConfig(30u, getPreferredScene(), getDeprivedScene()))
+        {
+        }
+
+        static SceneId getPreferredScene()
+        {
+            return SceneId{113114};
+        }
+
+        static SceneId getDeprivedScene()
+        {
+            return SceneId{551122};
+        }
+    };
+
     class AResourceUploadingManager_ScenePriority : public AResourceUploadingManager
     {
     public:
@@ -418,38 +450,67 @@ namespace ramses::internal
         EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2u);
     }
 
-    TEST_F(AResourceUploadingManager, uploadsBatchOfResourceBeforeCheckingIfOutOfTimeBudget)
+    TEST_F(AResourceUploadingManager, checksTimeBudgetBeforeEachResourceUpload)
     {
-        // first resource is always uploaded so batch is check frequency constant + 1
-        const auto numResourcesInBatch = static_cast<int>(rendererResourceUploader.getResourceUploadBatchSize()) + 1;
-        // create resources to fill one batch and extra resource in addition
-        std::vector<ResourceContentHash> resList(numResourcesInBatch + 1);
-        uint64_t hash = 1234u;
-        for (auto& res : resList)
-        {
-            res = ResourceContentHash(hash++, 0u);
-            registerAndProvideResource(res, false);
-        }
+        const ResourceContentHash res1(1234u, 0u);
+        const ResourceContentHash res2(1235u, 0u);
+        const ResourceContentHash res3(1236u, 0u);
+        const ResourceContentHash res4(1237u, 0u);
+        registerAndProvideResource(res1, false);
+        registerAndProvideResource(res2, false);
+        registerAndProvideResource(res3, false);
+        registerAndProvideResource(res4, false);
 
-        // set budget to infinite to make sure the batch gets to be processed
-        // then right after set budget to 0 and expect rest of batch to be uploaded till next budget check
-        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(numResourcesInBatch)
+        // set budget to infinite to make sure more than just first resource is processed
+        // then right after set budget to 0 and expect no other resource uploaded regardless of how small they are
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2)
             .WillOnce(InvokeWithoutArgs([this]() { frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, std::numeric_limits<uint64_t>::max()); return ResourceUploaderMock::FakeResourceDeviceHandle; }))
-            .WillOnce(InvokeWithoutArgs([this]() { frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u); return ResourceUploaderMock::FakeResourceDeviceHandle; }))
-            .WillRepeatedly(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+            .WillOnce(InvokeWithoutArgs([this]() { frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u); return ResourceUploaderMock::FakeResourceDeviceHandle; }));
 
         frameTimer.startFrame();
         rendererResourceUploader.uploadAndUnloadPendingResources();
-        for (int i = 0; i < numResourcesInBatch; ++i)
-            expectResourceUploaded(resList[i]);
+        expectResourceUploaded(res1);
+        expectResourceUploaded(res2);
+        expectResourceStatus(res3, EResourceStatus::Provided);
+        expectResourceStatus(res4, EResourceStatus::Provided);
 
-        // last resource is outside of batch and was skipped for uploading
-        expectResourceStatus(resList.back(), EResourceStatus::Provided);
+        makeResourceUnused(res1);
+        makeResourceUnused(res2);
+        makeResourceUnused(res3);
+        makeResourceUnused(res4);
 
-        for (const auto& res : resList)
-            makeResourceUnused(res);
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2);
+    }
 
-        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(numResourcesInBatch);
+    TEST_F(AResourceUploadingManager, defersResourceWhoseEstimatedUploadCostDoesNotFitIntoRemainingTimeBudget)
+    {
+        const ResourceContentHash res1(1234u, 0u);
+        const ResourceContentHash res2(1235u, 0u);
+        NiceMock<ResourceMock> hugeResource{ res2, EResourceType::IndexArray };
+        // estimated to take tens of milliseconds
+        ON_CALL(hugeResource, getDecompressedDataSize()).WillByDefault(Return(100000000u));
+        ON_CALL(hugeResource, isDeCompressedAvailable()).WillByDefault(Return(true));
+        registerAndProvideResource(res1, false);
+        registerAndProvideResource(res2, false, &hugeResource);
+
+        // there is time left after first upload but not enough for the estimated cost of the huge resource
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 1000u);
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        expectResourceUploaded(res1);
+        expectResourceStatus(res2, EResourceStatus::Provided);
+
+        // huge resource is uploaded as first resource of next frame
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        expectResourceUploaded(res2);
+
+        makeResourceUnused(res1);
+        makeResourceUnused(res2);
+
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2);
     }
 
     TEST_F(AResourceUploadingManager, checksTimeBudgetForEachLargeResourceWhenUploading)
@@ -458,7 +519,7 @@ namespace ramses::internal
         const ResourceContentHash res2(1235u, 0u);
         const ResourceContentHash res3(1236u, 0u);
 
-        const std::vector<uint32_t> dummyData(ResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
+        const std::vector<uint32_t> dummyData(LargeResourceSize / 4 + 1, 0u);
         const ArrayResource largeResource(EResourceType::IndexArray, static_cast<uint32_t>(dummyData.size()), EDataType::UInt32, dummyData.data(), "");
 
         registerAndProvideResource(res1, false, &largeResource);
@@ -475,7 +536,7 @@ namespace ramses::internal
         rendererResourceUploader.uploadAndUnloadPendingResources();
         expectResourceUploaded(res1);
         expectResourceUploaded(res2);
-        // last resource was skipped because even though within batch it is large resources and those are checked for time budget separately
+        // last resource was skipped because budget is checked before each upload
         expectResourceStatus(res3, EResourceStatus::Provided);
 
         makeResourceUnused(res1);
@@ -487,10 +548,10 @@ namespace ramses::internal
 
     TEST_F(AResourceUploadingManager, uploadsOnlyResourcesFittingIntoTimeBudgetInOneUpdate_uploadSlow)
     {
-        const std::vector<uint32_t> dummyData(ResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
+        const std::vector<uint32_t> dummyData(LargeResourceSize / 4 + 1, 0u);
         const ArrayResource largeResource(EResourceType::IndexArray, static_cast<uint32_t>(dummyData.size()), EDataType::UInt32, dummyData.data(), "");
 
-        // using large resources so that time budget checks happen on every resources, not just once per batch
+        // using large resources so that their upload time is measured and used to estimate next uploads
         const ResourceContentHash res1(1234u, 0u);
         const ResourceContentHash res2(1235u, 0u);
         const ResourceContentHash res3(1236u, 0u);
@@ -543,11 +604,11 @@ namespace ramses::internal
         NiceMock<ResourceMock> resource3{ res3, EResourceType::IndexArray };
         NiceMock<ResourceMock> resource4{ res4, EResourceType::IndexArray };
 
-        // simulate large resources so that time budget checks happen on every resources, not just once per batch
-        ON_CALL(resource1, getDecompressedDataSize()).WillByDefault(Return(ResourceUploadingManager::LargeResourceByteSizeThreshold + 1));
-        ON_CALL(resource2, getDecompressedDataSize()).WillByDefault(Return(ResourceUploadingManager::LargeResourceByteSizeThreshold + 1));
-        ON_CALL(resource3, getDecompressedDataSize()).WillByDefault(Return(ResourceUploadingManager::LargeResourceByteSizeThreshold + 1));
-        ON_CALL(resource4, getDecompressedDataSize()).WillByDefault(Return(ResourceUploadingManager::LargeResourceByteSizeThreshold + 1));
+        // simulate large resources so that their upload time is measured and used to estimate next uploads
+        ON_CALL(resource1, getDecompressedDataSize()).WillByDefault(Return(LargeResourceSize + 1));
+        ON_CALL(resource2, getDecompressedDataSize()).WillByDefault(Return(LargeResourceSize + 1));
+        ON_CALL(resource3, getDecompressedDataSize()).WillByDefault(Return(LargeResourceSize + 1));
+        ON_CALL(resource4, getDecompressedDataSize()).WillByDefault(Return(LargeResourceSize + 1));
         ON_CALL(resource1, isDeCompressedAvailable()).WillByDefault(Return(true));
         ON_CALL(resource2, isDeCompressedAvailable()).WillByDefault(Return(true));
         ON_CALL(resource3, isDeCompressedAvailable()).WillByDefault(Return(true));
@@ -766,6 +827,43 @@ namespace ramses::internal
         EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
     }
 
+    TEST_F(AResourceUploadingManager_WithVRAMCache, unloadsAllUnusedCachedResourcesWhenRequestedRegardlessOfCacheSize)
+    {
+        // test resource has size of 10 bytes
+        // cache is set to 30 bytes
+
+        const ResourceContentHash res1(1234u, 0u);
+        const ResourceContentHash res2(1235u, 0u);
+        const ResourceContentHash res3(1236u, 0u);
+
+        registerAndProvideResource(res1);
+        registerAndProvideResource(res2);
+        registerAndProvideResource(res3);
+
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(3u);
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+
+        // unused resources fit into cache and would be kept
+        makeResourceUnused(res2);
+        makeResourceUnused(res3);
+
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2u);
+        EXPECT_EQ(20u, rendererResourceUploader.unloadAllUnusedResources());
+        Mock::VerifyAndClearExpectations(&uploader);
+
+        expectResourceUploaded(res1);
+        expectResourceUnloaded(res2);
+        expectResourceUnloaded(res3);
+
+        // nothing left to trim
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(0u);
+        EXPECT_EQ(0u, rendererResourceUploader.unloadAllUnusedResources());
+        Mock::VerifyAndClearExpectations(&uploader);
+
+        makeResourceUnused(res1);
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(1u);
+    }
+
     TEST_F(AResourceUploadingManager_WithVRAMCache, willUnloadResourcesOfSameOrGreaterSizeOfResourcesToBeUploaded_AlreadyUsingMoreThanCacheSize)
     {
         // test resource has size of 10 bytes
@@ -814,12 +912,93 @@ namespace ramses::internal
         EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
     }
 
+    TEST_F(AResourceUploadingManager_WithVRAMCacheAndScenePriority, unloadsUnusedResourceOfLessPrioritizedSceneFirst)
+    {
+        // test resource has size of 10 bytes
+        // cache is set to 30 bytes
+
+        const ResourceContentHash res1(1234u, 0u);
+        const ResourceContentHash res2(1235u, 0u);
+        const ResourceContentHash res3(1236u, 0u);
+        const ResourceContentHash res4(1237u, 0u);
+
+        registerAndProvideResource(res1, false, nullptr, getPreferredScene());
+        registerAndProvideResource(res2, false, nullptr, getDeprivedScene());
+        registerAndProvideResource(res3);
+
+        // cache is full
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(3u);
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+
+        // resource of preferred scene becomes unused first
+        makeResourceUnused(res1, getPreferredScene());
+        makeResourceUnused(res2, getDeprivedScene());
+
+        // 10 bytes needed, resource of deprived scene is unloaded
+        registerAndProvideResource(res4);
+        EXPECT_CALL(*uploader, unloadResource(_, _, res2, _));
+        EXPECT_CALL(*uploader, uploadResource(_, _, _));
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+
+        expectResourceUploaded(res1);
+        expectResourceUnloaded(res2);
+        expectResourceUploaded(res3);
+        expectResourceUploaded(res4);
+        Mock::VerifyAndClearExpectations(&uploader);
+
+        makeResourceUnused(res3);
+        makeResourceUnused(res4);
+
+        // destructor will unload kept resources
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3u);
+    }
+
+    TEST_F(AResourceUploadingManager_WithLargeVRAMCache, keepsRecentlyUnusedLargeResourceLongerThanSmallResource)
+    {
+        // cache is set to 100000 bytes
+        const std::vector<uint32_t> largeData(10000u, 0u);
+        const ArrayResource largeResource(EResourceType::IndexArray, static_cast<uint32_t>(largeData.size()), EDataType::UInt32, largeData.data(), "");
+        const std::vector<uint32_t> newData(15000u, 0u);
+        const ArrayResource newResource(EResourceType::IndexArray, static_cast<uint32_t>(newData.size()), EDataType::UInt32, newData.data(), "");
+
+        const ResourceContentHash resLarge(1234u, 0u);
+        const ResourceContentHash resSmall(1235u, 0u);
+        const ResourceContentHash resNew(1236u, 0u);
+
+        registerAndProvideResource(resLarge, false, &largeResource);
+        registerAndProvideResource(resSmall);
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2u);
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+
+        // large resource is unused for longer but it is much more expensive to upload it again
+        makeResourceUnused(resLarge);
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(0u);
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        makeResourceUnused(resSmall);
+
+        // new resource needs 10 bytes to be freed
+        registerAndProvideResource(resNew, false, &newResource);
+        EXPECT_CALL(*uploader, unloadResource(_, _, resSmall, _));
+        EXPECT_CALL(*uploader, uploadResource(_, _, _));
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+
+        expectResourceUploaded(resLarge);
+        expectResourceUnloaded(resSmall);
+        expectResourceUploaded(resNew);
+        Mock::VerifyAndClearExpectations(&uploader);
+
+        makeResourceUnused(resNew);
+
+        // destructor will unload kept resources
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(2u);
+    }
+
     TEST_F(AResourceUploadingManager_ScenePriority, uploadsPreferredResourcesFirst)
     {
-        const std::vector<uint32_t> dummyData(ResourceUploadingManager::LargeResourceByteSizeThreshold / 4 + 1, 0u);
+        const std::vector<uint32_t> dummyData(LargeResourceSize / 4 + 1, 0u);
         const ArrayResource largeResource(EResourceType::IndexArray, static_cast<uint32_t>(dummyData.size()), EDataType::UInt32, dummyData.data(), "");
 
-        // using large resources so that time budget checks happen on every resource, not just once per batch
+        // using large resources so that their upload time is measured and used to estimate next uploads
         const ResourceContentHash res1(1234u, 0u);
         const ResourceContentHash res2(1235u, 0u);
         const ResourceContentHash res3(1236u, 0u);
@@ -871,4 +1050,43 @@ namespace ramses::internal
         EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(4);
     }
 
+    TEST_F(AResourceUploadingManager_ScenePriority, uploadsAllResourcesOfHighestPrioritySceneEvenIfOutOfTimeBudget)
+    {
+        const std::vector<uint32_t> dummyData(LargeResourceSize / 4 + 1, 0u);
+        const ArrayResource largeResource(EResourceType::IndexArray, static_cast<uint32_t>(dummyData.size()), EDataType::UInt32, dummyData.data(), "");
+
+        const ResourceContentHash res1(1234u, 0u);
+        const ResourceContentHash res2(1235u, 0u);
+        const ResourceContentHash res3(1236u, 0u);
+
+        registerAndProvideResource(res1, false, &largeResource, getDeprivedScene());
+        registerAndProvideResource(res2, false, &largeResource, getPreferredScene());
+        registerAndProvideResource(res3, false, &largeResource, getPreferredScene());
+
+        // budget is exceeded by every upload, resources of preferred scene are still all uploaded in same frame
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u);
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).Times(2).WillRepeatedly(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        expectResourceUploaded(res2);
+        expectResourceUploaded(res3);
+        expectResourceStatus(res1, EResourceStatus::Provided);
+
+        stats.frameFinished(0u);
+        StringOutputStream str;
+        stats.writeStatsToStream(str);
+        EXPECT_THAT(str.release(), HasSubstr("framesBudgetExceeded 1"));
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, std::numeric_limits<uint64_t>::max());
+        EXPECT_CALL(*uploader, uploadResource(_, _, _)).WillOnce(Return(ResourceUploaderMock::FakeResourceDeviceHandle));
+        frameTimer.startFrame();
+        rendererResourceUploader.uploadAndUnloadPendingResources();
+        expectResourceUploaded(res1);
+
+        makeResourceUnused(res1, getDeprivedScene());
+        makeResourceUnused(res2, getPreferredScene());
+        makeResourceUnused(res3, getPreferredScene());
+
+        EXPECT_CALL(*uploader, unloadResource(_, _, _, _)).Times(3);
+    }
 }
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/SceneBudgetScheduler.h"
+#include "internal/RendererLib/RendererStatistics.h"
+#include "internal/PlatformAbstraction/Collections/StringOutputStream.h"
+#include "gmock/gmock.h"
+
+using namespace testing;
+
+namespace ramses::internal
+{
+    class ASceneBudgetScheduler : public ::testing::Test
+    {
+    public:
+        ASceneBudgetScheduler()
+        {
+            frameTimer.startFrame();
+        }
+
+        [[nodiscard]] std::string statsOutput()
+        {
+            stats.frameFinished(0u);
+            StringOutputStream str;
+            stats.writeStatsToStream(str);
+            return str.release();
+        }
+
+    protected:
+        FrameTimer frameTimer;
+        RendererStatistics stats;
+        const SceneId preferredScene{ 1u };
+        const SceneId defaultScene{ 2u };
+        const SceneId deprivedScene{ 3u };
+    };
+
+    TEST_F(ASceneBudgetScheduler, treatsAllScenesEquallyWithoutPriorities)
+    {
+        SceneBudgetScheduler scheduler{ {}, frameTimer, stats };
+        EXPECT_FALSE(scheduler.hasScenePriorities());
+        EXPECT_FALSE(scheduler.isHighestPriority(defaultScene));
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, 0u);
+        EXPECT_FALSE(scheduler.deferSceneWork(defaultScene, EFrameTimerSectionBudget::SceneResourcesUpload));
+        EXPECT_THAT(statsOutput(), Not(HasSubstr("framesBudgetExceeded")));
+    }
+
+    TEST_F(ASceneBudgetScheduler, neverDefersWorkOfHighestPriorityScene)
+    {
+        SceneBudgetScheduler scheduler{ { { preferredScene, -1 }, { deprivedScene, 5 } }, frameTimer, stats };
+        EXPECT_TRUE(scheduler.isHighestPriority(preferredScene));
+        EXPECT_FALSE(scheduler.isHighestPriority(defaultScene));
+        EXPECT_FALSE(scheduler.isHighestPriority(deprivedScene));
+
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::SceneResourcesUpload, 0u);
+        EXPECT_FALSE(scheduler.deferSceneWork(preferredScene, EFrameTimerSectionBudget::SceneResourcesUpload));
+        EXPECT_TRUE(scheduler.deferSceneWork(defaultScene, EFrameTimerSectionBudget::SceneResourcesUpload));
+        EXPECT_TRUE(scheduler.deferSceneWork(deprivedScene, EFrameTimerSectionBudget::SceneResourcesUpload));
+
+        const auto output = statsOutput();
+        EXPECT_THAT(output, HasSubstr("Scene 2: "));
+        EXPECT_THAT(output, HasSubstr("Scene 3: "));
+        EXPECT_THAT(output, Not(HasSubstr("Scene 1: ")));
+    }
+
+    TEST_F(ASceneBudgetScheduler, defersWorkOfLessPrioritizedSceneOnlyIfBudgetExceeded)
+    {
+        SceneBudgetScheduler scheduler{ { { preferredScene, -1 } }, frameTimer, stats };
+
+        EXPECT_FALSE(scheduler.deferSceneWork(defaultScene, EFrameTimerSectionBudget::ResourcesUpload));
+        frameTimer.setSectionTimeBudget(EFrameTimerSectionBudget::ResourcesUpload, 0u);
+        EXPECT_TRUE(scheduler.deferSceneWork(defaultScene, EFrameTimerSectionBudget::ResourcesUpload));
+        EXPECT_THAT(statsOutput(), HasSubstr("framesBudgetExceeded 1"));
+    }
+
+    TEST_F(ASceneBudgetScheduler, sortsScenesByPriorityKeepingOrderOfScenesWithSamePriority)
+    {
+        const SceneId otherDefaultScene{ 4u };
+        SceneBudgetScheduler scheduler{ { { preferredScene, -1 }, { deprivedScene, 5 } }, frameTimer, stats };
+
+        std::vector<SceneId> scenes{ deprivedScene, defaultScene, preferredScene, otherDefaultScene };
+        scheduler.sortByPriority(scenes);
+        EXPECT_THAT(scenes, ElementsAre(preferredScene, defaultScene, otherDefaultScene, deprivedScene));
+    }
+}
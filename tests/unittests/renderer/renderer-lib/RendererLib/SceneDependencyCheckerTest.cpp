@@ -82,6 +82,24 @@ namespace ramses::internal
         EXPECT_TRUE(dependencyChecker.isEmpty());
     }
 
+    TEST_F(ASceneDependencyChecker, reportsDependencyOfBothProviderAndConsumer)
+    {
+        SceneId scene1(3u);
+        SceneId scene2(5u);
+        SceneId scene3(7u);
+
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene2));
+
+        EXPECT_TRUE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene1));
+        EXPECT_TRUE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene2));
+        EXPECT_FALSE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene3));
+
+        dependencyChecker.removeDependency(scene1, scene2);
+
+        EXPECT_FALSE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene1));
+        EXPECT_FALSE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene2));
+    }
+
     TEST_F(ASceneDependencyChecker, returnsCorrectDependencyListForOneDependency)
     {
         SceneId scene1(3u);
@@ -340,6 +358,64 @@ namespace ramses::internal
         EXPECT_TRUE(dependencyChecker.isEmpty());
     }
 
+    TEST_F(ASceneDependencyChecker, reordersScenesWhenNewDependencyContradictsCurrentOrder)
+    {
+        const SceneId scene1(1u);
+        const SceneId scene2(2u);
+        const SceneId scene3(3u);
+        const SceneId scene4(4u);
+        const SceneId scene5(5u);
+
+        EXPECT_TRUE(dependencyChecker.addDependency(scene3, scene4));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene4, scene5));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene2));
+        // scene5 and its providers have to move before scene1 and its consumers
+        EXPECT_TRUE(dependencyChecker.addDependency(scene5, scene1));
+
+        const auto& orderedScenes = dependencyChecker.getDependentScenesInOrder();
+        ASSERT_EQ(5u, orderedScenes.size());
+        EXPECT_TRUE(CheckSceneOrder(scene3, scene4, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene4, scene5, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene5, scene1, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene1, scene2, orderedScenes));
+    }
+
+    TEST_F(ASceneDependencyChecker, keepsOrderOfRemainingScenesWhenDependencyRemoved)
+    {
+        const SceneId scene1(1u);
+        const SceneId scene2(2u);
+        const SceneId scene3(3u);
+
+        EXPECT_TRUE(dependencyChecker.addDependency(scene2, scene3));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene2));
+        EXPECT_TRUE(dependencyChecker.addDependency(scene1, scene3));
+        const SceneIdVector orderBeforeRemoval = dependencyChecker.getDependentScenesInOrder();
+
+        dependencyChecker.removeDependency(scene1, scene2);
+        EXPECT_EQ(orderBeforeRemoval, dependencyChecker.getDependentScenesInOrder());
+
+        dependencyChecker.removeDependency(scene1, scene3);
+        const auto& orderedScenes = dependencyChecker.getDependentScenesInOrder();
+        ASSERT_EQ(2u, orderedScenes.size());
+        EXPECT_TRUE(CheckSceneOrder(scene2, scene3, orderedScenes));
+        EXPECT_FALSE(dependencyChecker.hasDependencyAsConsumerOrProvider(scene1));
+    }
+
+    TEST_F(ASceneDependencyChecker, keepsValidOrderForManyDependenciesAddedInReverseOrder)
+    {
+        constexpr uint64_t sceneCount = 20u;
+        for (uint64_t i = sceneCount - 1u; i > 0u; --i)
+            EXPECT_TRUE(dependencyChecker.addDependency(SceneId(i), SceneId(i + 1u)));
+        // dependencies skipping scenes in between are consistent with the chain
+        for (uint64_t i = 1u; i + 2u <= sceneCount; i += 3u)
+            EXPECT_TRUE(dependencyChecker.addDependency(SceneId(i), SceneId(i + 2u)));
+
+        const auto& orderedScenes = dependencyChecker.getDependentScenesInOrder();
+        ASSERT_EQ(sceneCount, orderedScenes.size());
+        for (uint64_t i = 0u; i < sceneCount; ++i)
+            EXPECT_EQ(SceneId(i + 1u), orderedScenes[i]);
+    }
+
     TEST_F(ASceneDependencyChecker, confidenceTest_complexDependencyHierarchy)
     {
         const SceneId scene1(1u);
@@ -375,13 +451,15 @@ namespace ramses::internal
         // get ordered list of scenes
         const auto& orderedScenes = dependencyChecker.getDependentScenesInOrder();
         ASSERT_EQ(7u, orderedScenes.size());
-        EXPECT_EQ(scene6, orderedScenes[0]);
-        EXPECT_EQ(scene3, orderedScenes[1]);
-        EXPECT_EQ(scene1, orderedScenes[2]);
-        EXPECT_EQ(scene7, orderedScenes[3]);
-        EXPECT_EQ(scene2, orderedScenes[4]);
-        EXPECT_EQ(scene5, orderedScenes[5]);
-        EXPECT_EQ(scene4, orderedScenes[6]);
+        EXPECT_TRUE(CheckSceneOrder(scene1, scene5, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene2, scene5, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene3, scene2, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene3, scene5, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene3, scene7, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene5, scene4, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene6, scene1, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene6, scene2, orderedScenes));
+        EXPECT_TRUE(CheckSceneOrder(scene7, scene2, orderedScenes));
 
         // remove dependencies
         dependencyChecker.removeDependency(scene1, scene5);
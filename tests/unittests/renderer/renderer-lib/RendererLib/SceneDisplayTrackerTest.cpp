@@ -79,8 +79,12 @@ namespace ramses::internal
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::DestroyStreamBuffer{ cmdDisplay, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::CreateExternalBuffer{ cmdDisplay, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::DestroyExternalBuffer{ cmdDisplay, {} }));
+        EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::UpdateExternalBufferDmaBuffer{ cmdDisplay, {}, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetClearFlags{ cmdDisplay, {}, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetClearColor{ cmdDisplay, {}, {} }));
+        EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetRenderRateDivisor{ cmdDisplay, {}, {} }));
+        EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetOffscreenBufferScalable{ cmdDisplay, {}, {} }));
+        EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetDmaOffscreenBufferSyncFence{ cmdDisplay, {}, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::SetExterallyOwnedWindowSize{ cmdDisplay, {}, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::ReadPixels{ cmdDisplay, {}, {}, {}, {}, {}, {}, {}, {} }));
         EXPECT_EQ(cmdDisplay, tracker.determineDisplayFromRendererCommand(RendererCommand::ConfirmationEcho{ cmdDisplay, {} }));
@@ -88,6 +92,10 @@ namespace ramses::internal
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::ScenePublished{ sceneId, EScenePublicationMode::LocalOnly }));
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SceneUnpublished{ sceneId }));
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SetSkippingOfUnmodifiedBuffers{}));
+        EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SetGpuTimerQueries{}));
+        EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::TrimMemory{}));
+        EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SetSkippingOfUnusedRenderPasses{}));
+        EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SetPartialRedraw{}));
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::LogStatistics{}));
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::LogInfo{}));
         EXPECT_FALSE(tracker.determineDisplayFromRendererCommand(RendererCommand::SCListIviSurfaces{}));
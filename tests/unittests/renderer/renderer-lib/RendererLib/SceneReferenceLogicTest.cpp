@@ -72,6 +72,29 @@ namespace ramses::internal
             m_logic.extractAndSendSceneReferenceEvents(events);
         }
 
+        void reportRefSceneState(SceneId refScene, SceneId masterScene, RendererSceneState state)
+        {
+            RendererEventVector events;
+            RendererEvent event{ ERendererEventType::SceneStateChanged };
+            event.sceneId = refScene;
+            event.state = state;
+            events.push_back(event);
+
+            EXPECT_CALL(m_eventSender, sendSceneStateChanged(masterScene, refScene, state));
+            m_logic.extractAndSendSceneReferenceEvents(events);
+            EXPECT_TRUE(events.empty());
+        }
+
+        void simulateTargetStates(const std::unordered_map<SceneId, RendererSceneState>& targetStates)
+        {
+            // scenes not listed have target state Available
+            EXPECT_CALL(m_sceneLogic, getSceneInfo(_, _, _, _)).WillRepeatedly([targetStates](auto sceneId, auto& targetState, auto& /*unused*/, auto& /*unused*/)
+            {
+                const auto it = targetStates.find(sceneId);
+                targetState = (it != targetStates.cend() ? it->second : RendererSceneState::Available);
+            });
+        }
+
         RendererEventCollector m_eventCollector;
         RendererScenes m_scenes;
         StrictMock<RendererSceneControlLogicMock> m_sceneLogic;
@@ -630,6 +653,23 @@ namespace ramses::internal
         }
     }
 
+    TEST_F(ASceneReferenceLogic, extractsButDoesNotSendSceneResourcesCompleteEventOfReferencedScene)
+    {
+        updateLogicAndVerifyExpectations();
+        EXPECT_TRUE(m_logic.hasAnyReferencedScenes());
+
+        RendererEventVector events{ { ERendererEventType::SceneResourcesComplete }, { ERendererEventType::SceneResourcesComplete } };
+        events[0].sceneId = RefSceneId12;
+        events[1].sceneId = MasterSceneId1;
+
+        m_logic.extractAndSendSceneReferenceEvents(events);
+
+        // only event of master scene is kept
+        ASSERT_EQ(1u, events.size());
+        EXPECT_EQ(ERendererEventType::SceneResourcesComplete, events[0].eventType);
+        EXPECT_EQ(MasterSceneId1, events[0].sceneId);
+    }
+
     TEST_F(ASceneReferenceLogic, extractsButDoesNotSendSceneRefEventsOfUnusedDataLinkingTypes)
     {
         updateLogicAndVerifyExpectations();
@@ -1680,4 +1720,85 @@ namespace ramses::internal
         // expect nothing
         m_logic.update();
     }
+
+    TEST_F(ASceneReferenceLogic, preloadsReferencedScenesOneByOneByPriority)
+    {
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle11, RendererSceneState::Ready, 1);
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle12, RendererSceneState::Ready, 2);
+
+        // no preload while master scene is not ready
+        updateLogicAndVerifyExpectations();
+        reportRefSceneState(RefSceneId11, MasterSceneId1, RendererSceneState::Available);
+        reportRefSceneState(RefSceneId12, MasterSceneId1, RendererSceneState::Available);
+        updateLogicAndVerifyExpectations();
+
+        // higher priority first
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId12, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+
+        // next one waits until first preload is finished
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { RefSceneId12, RendererSceneState::Ready } });
+        updateLogicAndVerifyExpectations();
+
+        reportRefSceneState(RefSceneId12, MasterSceneId1, RendererSceneState::Ready);
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { RefSceneId12, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId11, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+
+        // preloaded state is kept even though requested state is lower
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { RefSceneId11, RendererSceneState::Ready }, { RefSceneId12, RendererSceneState::Ready } });
+        updateLogicAndVerifyExpectations();
+    }
+
+    TEST_F(ASceneReferenceLogic, doesNotStartPreloadWhileRequestedStateChangeOfReferencedSceneInProgress)
+    {
+        updateLogicAndVerifyExpectations();
+        reportRefSceneState(RefSceneId11, MasterSceneId1, RendererSceneState::Available);
+        reportRefSceneState(RefSceneId21, MasterSceneId2, RendererSceneState::Available);
+
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle11, RendererSceneState::Ready, 100);
+        m_scenes.getScene(MasterSceneId2).requestSceneReferenceState(RefSceneHandle21, RendererSceneState::Ready);
+
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { MasterSceneId2, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId21, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { MasterSceneId2, RendererSceneState::Ready }, { RefSceneId21, RendererSceneState::Ready } });
+        updateLogicAndVerifyExpectations();
+
+        reportRefSceneState(RefSceneId21, MasterSceneId2, RendererSceneState::Ready);
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { MasterSceneId2, RendererSceneState::Ready }, { RefSceneId21, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId11, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+    }
+
+    TEST_F(ASceneReferenceLogic, doesNotPreloadUnavailableReferencedScene)
+    {
+        updateLogicAndVerifyExpectations();
+        reportRefSceneState(RefSceneId12, MasterSceneId1, RendererSceneState::Available);
+
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle11, RendererSceneState::Ready, 5);
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle12, RendererSceneState::Ready, 1);
+
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId12, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+    }
+
+    TEST_F(ASceneReferenceLogic, bringsPreloadedReferencedSceneBackToRequestedStateWhenPreloadDisabled)
+    {
+        updateLogicAndVerifyExpectations();
+        reportRefSceneState(RefSceneId11, MasterSceneId1, RendererSceneState::Available);
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle11, RendererSceneState::Ready, 0);
+
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId11, RendererSceneState::Ready));
+        updateLogicAndVerifyExpectations();
+
+        m_scenes.getScene(MasterSceneId1).setSceneReferencePreload(RefSceneHandle11, RendererSceneState::Available, 0);
+        simulateTargetStates({ { MasterSceneId1, RendererSceneState::Ready }, { RefSceneId11, RendererSceneState::Ready } });
+        EXPECT_CALL(m_sceneLogic, setSceneState(RefSceneId11, RendererSceneState::Available));
+        updateLogicAndVerifyExpectations();
+    }
 }
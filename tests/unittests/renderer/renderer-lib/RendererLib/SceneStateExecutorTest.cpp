@@ -1354,6 +1354,51 @@ namespace ramses::internal
         destroyDisplay();
     }
 
+    TEST_F(ASceneStateExecutor, reportsDeferredShownEventOfRenderedScene)
+    {
+        createDisplay();
+
+        publishScene();
+        subscribeScene();
+        receiveScene();
+        receiveFlush();
+        requestMapScene();
+        setSceneMappingAndUploading();
+        setSceneMapped();
+        setSceneRenderedRequested();
+        sceneStateExecutor.setRendered(sceneId, true);
+        expectNoRendererEvent();
+        EXPECT_EQ(ESceneState::Rendered, sceneStateExecutor.getSceneState(sceneId));
+
+        sceneStateExecutor.reportDeferredShown(sceneId);
+        expectRendererEvent(ERendererEventType::SceneShown);
+        setSceneHidden();
+
+        destroyDisplay();
+    }
+
+    TEST_F(ASceneStateExecutor, reportsShowFailedWhenHidingRenderedSceneWithDeferredShownEvent)
+    {
+        createDisplay();
+
+        publishScene();
+        subscribeScene();
+        receiveScene();
+        receiveFlush();
+        requestMapScene();
+        setSceneMappingAndUploading();
+        setSceneMapped();
+        setSceneRenderedRequested();
+        sceneStateExecutor.setRendered(sceneId, true);
+        expectNoRendererEvent();
+
+        sceneStateExecutor.setHidden(sceneId);
+        expectRendererEvent(ERendererEventType::SceneShowFailed);
+        EXPECT_EQ(ESceneState::Mapped, sceneStateExecutor.getSceneState(sceneId));
+
+        destroyDisplay();
+    }
+
     TEST_F(ASceneStateExecutor, unmapsMappedScene)
     {
         createDisplay();
@@ -0,0 +1,109 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/StaticBufferPool.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AStaticBufferPool : public ::testing::Test
+    {
+    protected:
+        StaticBufferPool pool;
+    };
+
+    TEST_F(AStaticBufferPool, rejectsEmptyAndLargeBuffers)
+    {
+        EXPECT_FALSE(StaticBufferPool::CanAllocate(0u));
+        EXPECT_TRUE(StaticBufferPool::CanAllocate(1u));
+        EXPECT_TRUE(StaticBufferPool::CanAllocate(StaticBufferPool::MaxAllocationSizeInBytes));
+        EXPECT_FALSE(StaticBufferPool::CanAllocate(StaticBufferPool::MaxAllocationSizeInBytes + 1u));
+    }
+
+    TEST_F(AStaticBufferPool, allocatesBlocksOfPowerOfTwoSizesNextToEachOther)
+    {
+        const auto allocation1 = pool.allocate(100u);
+        const auto allocation2 = pool.allocate(300u);
+        const auto allocation3 = pool.allocate(StaticBufferPool::MinBlockSizeInBytes);
+
+        EXPECT_EQ(0u, allocation1.chunk);
+        EXPECT_EQ(0u, allocation1.offset);
+        EXPECT_EQ(0u, allocation1.order);
+
+        EXPECT_EQ(0u, allocation2.chunk);
+        EXPECT_EQ(2u * StaticBufferPool::MinBlockSizeInBytes, allocation2.offset);
+        EXPECT_EQ(1u, allocation2.order);
+
+        EXPECT_EQ(0u, allocation3.chunk);
+        EXPECT_EQ(StaticBufferPool::MinBlockSizeInBytes, allocation3.offset);
+
+        EXPECT_EQ(1u, pool.getChunkCount());
+        EXPECT_EQ(3u, pool.getAllocationCount());
+    }
+
+    TEST_F(AStaticBufferPool, addsChunkWhenFull)
+    {
+        const uint32_t allocationsPerChunk = StaticBufferPool::ChunkSizeInBytes / StaticBufferPool::MaxAllocationSizeInBytes;
+        for (uint32_t i = 0u; i < allocationsPerChunk; ++i)
+            EXPECT_EQ(0u, pool.allocate(StaticBufferPool::MaxAllocationSizeInBytes).chunk);
+
+        const auto allocation = pool.allocate(1u);
+        EXPECT_EQ(1u, allocation.chunk);
+        EXPECT_EQ(0u, allocation.offset);
+        EXPECT_EQ(2u, pool.getChunkCount());
+    }
+
+    TEST_F(AStaticBufferPool, mergesReleasedBlocksSoThatLargerBufferFitsAgain)
+    {
+        std::vector<StaticBufferPool::Allocation> allocations;
+        const uint32_t allocationsPerChunk = StaticBufferPool::ChunkSizeInBytes / StaticBufferPool::MinBlockSizeInBytes;
+        for (uint32_t i = 0u; i < allocationsPerChunk; ++i)
+            allocations.push_back(pool.allocate(1u));
+        EXPECT_EQ(1u, pool.getChunkCount());
+
+        // release every other block first, then the remaining ones in reverse order
+        for (size_t i = 0u; i < allocations.size(); i += 2u)
+            EXPECT_FALSE(pool.release(allocations[i]));
+        for (size_t i = allocations.size() - 1u; i > 1u; i -= 2u)
+            EXPECT_FALSE(pool.release(allocations[i]));
+        EXPECT_TRUE(pool.release(allocations[1u]));
+        EXPECT_EQ(0u, pool.getAllocationCount());
+
+        // whole chunk is a single free block again
+        const auto allocation = pool.allocate(StaticBufferPool::MaxAllocationSizeInBytes);
+        EXPECT_EQ(0u, allocation.chunk);
+        EXPECT_EQ(0u, allocation.offset);
+        EXPECT_EQ(1u, pool.getChunkCount());
+    }
+
+    TEST_F(AStaticBufferPool, reportsChunkWithoutAllocationsOnRelease)
+    {
+        const auto allocation1 = pool.allocate(1000u);
+        const auto allocation2 = pool.allocate(1000u);
+        EXPECT_EQ(2u, pool.getAllocationCount(0u));
+
+        EXPECT_FALSE(pool.release(allocation2));
+        EXPECT_EQ(1u, pool.getAllocationCount(0u));
+        EXPECT_TRUE(pool.release(allocation1));
+        EXPECT_EQ(0u, pool.getAllocationCount(0u));
+    }
+
+    TEST_F(AStaticBufferPool, reusesFreeBlockInFirstChunk)
+    {
+        const uint32_t allocationsPerChunk = StaticBufferPool::ChunkSizeInBytes / StaticBufferPool::MaxAllocationSizeInBytes;
+        std::vector<StaticBufferPool::Allocation> allocations;
+        for (uint32_t i = 0u; i < allocationsPerChunk + 1u; ++i)
+            allocations.push_back(pool.allocate(StaticBufferPool::MaxAllocationSizeInBytes));
+        EXPECT_EQ(2u, pool.getChunkCount());
+
+        EXPECT_FALSE(pool.release(allocations[3u]));
+        const auto allocation = pool.allocate(StaticBufferPool::MinBlockSizeInBytes);
+        EXPECT_EQ(0u, allocation.chunk);
+        EXPECT_EQ(allocations[3u].offset, allocation.offset);
+    }
+}
@@ -358,4 +358,32 @@ namespace ramses::internal
 
         EXPECT_TRUE(consumerScene.isMatrixCacheDirty(ETransformationMatrixType_World, consumerNode));
     }
+
+    TEST_F(ATransformationLinkManager, propagatesTransformationDirtinessOnlyToRemainingConsumersAfterConsumerSceneDestroyed)
+    {
+        const SceneId consumerSceneId2(5u);
+        TransformationLinkCachedScene& consumerScene2 = rendererScenes.createScene(SceneInfo{ consumerSceneId2 });
+        SceneAllocateHelper consumerSceneAllocator2(consumerScene2);
+        const NodeHandle consumerNode2 = consumerSceneAllocator2.allocateNode();
+        const DataSlotHandle slotHandle2(654u);
+        consumerSceneAllocator2.allocateDataSlot({ EDataSlotType::TransformationConsumer, consumerId, consumerNode2, DataInstanceHandle::Invalid(), ResourceContentHash::Invalid(), TextureSamplerHandle() }, slotHandle2);
+        expectRendererEvent(ERendererEventType::SceneDataSlotConsumerCreated, SceneId(0u), DataSlotId(0u), consumerSceneId2, consumerId);
+
+        EXPECT_TRUE(transformationLinkManager.createDataLink(providerSceneId, providerSlotHandle, consumerSceneId, consumerSlotHandle));
+        EXPECT_TRUE(transformationLinkManager.createDataLink(providerSceneId, providerSlotHandle, consumerSceneId2, slotHandle2));
+        markNodeTransformationClean(consumerScene, consumerNode);
+        markNodeTransformationClean(consumerScene2, consumerNode2);
+
+        transformationLinkManager.propagateTransformationDirtinessToConsumers(providerSceneId, providerNode);
+        EXPECT_TRUE(consumerScene.isMatrixCacheDirty(ETransformationMatrixType_World, consumerNode));
+        EXPECT_TRUE(consumerScene2.isMatrixCacheDirty(ETransformationMatrixType_World, consumerNode2));
+
+        rendererScenes.destroyScene(consumerSceneId);
+        markNodeTransformationClean(consumerScene2, consumerNode2);
+        EXPECT_TRUE(transformationLinkManager.nodeHasDataLinkToProvider(consumerSceneId2, consumerNode2));
+        EXPECT_FALSE(transformationLinkManager.nodeHasDataLinkToProvider(consumerSceneId, consumerNode));
+
+        transformationLinkManager.propagateTransformationDirtinessToConsumers(providerSceneId, providerNode);
+        EXPECT_TRUE(consumerScene2.isMatrixCacheDirty(ETransformationMatrixType_World, consumerNode2));
+    }
 }
@@ -0,0 +1,140 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/TriangleBVH.h"
+#include "internal/RendererLib/IntersectionUtils.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class ATriangleBVH : public ::testing::Test
+    {
+    protected:
+        // grid of quads (2 triangles each) in plane z, covering [0, gridSize] in x and y
+        static void AddGrid(std::vector<float>& geometry, uint32_t gridSize, float z)
+        {
+            for (uint32_t y = 0u; y < gridSize; ++y)
+            {
+                for (uint32_t x = 0u; x < gridSize; ++x)
+                {
+                    const auto fx = static_cast<float>(x);
+                    const auto fy = static_cast<float>(y);
+                    geometry.insert(geometry.end(), { fx, fy, z, fx + 1.f, fy, z, fx, fy + 1.f, z });
+                    geometry.insert(geometry.end(), { fx + 1.f, fy, z, fx + 1.f, fy + 1.f, z, fx, fy + 1.f, z });
+                }
+            }
+        }
+
+        static bool IntersectLinear(const std::vector<float>& geometry, const glm::vec3& rayOrigin, const glm::vec3& rayDir, float& nearestDistance)
+        {
+            bool result = false;
+            nearestDistance = std::numeric_limits<float>::max();
+            for (size_t i = 0u; i < geometry.size(); i += 9u)
+            {
+                const IntersectionUtils::Triangle triangle{ { geometry[i], geometry[i + 1], geometry[i + 2] }, { geometry[i + 3], geometry[i + 4], geometry[i + 5] }, { geometry[i + 6], geometry[i + 7], geometry[i + 8] } };
+                glm::vec3 intersection;
+                float distance = 0.f;
+                if (IntersectionUtils::IntersectRayVsTriangle(triangle, rayOrigin, rayDir, intersection, distance) && distance < nearestDistance)
+                {
+                    result = true;
+                    nearestDistance = distance;
+                }
+            }
+            return result;
+        }
+    };
+
+    TEST_F(ATriangleBVH, isEmptyWithoutGeometry)
+    {
+        const TriangleBVH bvh{ nullptr, 0u };
+        EXPECT_TRUE(bvh.empty());
+        EXPECT_EQ(0u, bvh.getTriangleCount());
+
+        glm::vec3 intersection;
+        float distance = 0.f;
+        EXPECT_FALSE(bvh.intersectRay({ 0.f, 0.f, 1.f }, { 0.f, 0.f, -1.f }, intersection, distance));
+    }
+
+    TEST_F(ATriangleBVH, hasLogarithmicDepth)
+    {
+        std::vector<float> geometry;
+        AddGrid(geometry, 32u, 0.f);
+        const TriangleBVH bvh{ geometry.data(), geometry.size() };
+
+        EXPECT_EQ(2048u, bvh.getTriangleCount());
+        // 2048 triangles in leaves of at most 4 triangles need 9 levels of splits
+        EXPECT_EQ(10u, bvh.getDepth());
+        EXPECT_LE(bvh.getNodeCount(), 2u * 2048u / TriangleBVH::MaxTrianglesInLeaf);
+        EXPECT_LE(bvh.getBoundsMin().x, 0.f);
+        EXPECT_GE(bvh.getBoundsMax().x, 32.f);
+    }
+
+    TEST_F(ATriangleBVH, findsSameIntersectionsAsLinearTest)
+    {
+        std::vector<float> geometry;
+        AddGrid(geometry, 16u, 0.f);
+        const TriangleBVH bvh{ geometry.data(), geometry.size() };
+
+        for (float y = -1.3f; y < 17.f; y += 0.7f)
+        {
+            for (float x = -1.3f; x < 17.f; x += 0.7f)
+            {
+                const glm::vec3 rayOrigin{ x, y, 5.f };
+                const glm::vec3 rayDir = glm::normalize(glm::vec3{ 0.1f, -0.05f, -1.f });
+
+                float expectedDistance = 0.f;
+                const bool expectedHit = IntersectLinear(geometry, rayOrigin, rayDir, expectedDistance);
+
+                glm::vec3 intersection;
+                float distance = 0.f;
+                ASSERT_EQ(expectedHit, bvh.intersectRay(rayOrigin, rayDir, intersection, distance)) << x << " " << y;
+                if (expectedHit)
+                {
+                    EXPECT_FLOAT_EQ(expectedDistance, distance);
+                    EXPECT_NEAR(0.f, intersection.z, 1e-5f);
+                }
+            }
+        }
+    }
+
+    TEST_F(ATriangleBVH, findsNearestIntersection)
+    {
+        std::vector<float> geometry;
+        AddGrid(geometry, 8u, -3.f);
+        AddGrid(geometry, 8u, 2.f);
+        AddGrid(geometry, 8u, -1.f);
+        const TriangleBVH bvh{ geometry.data(), geometry.size() };
+
+        glm::vec3 intersection;
+        float distance = 0.f;
+        EXPECT_TRUE(bvh.intersectRay({ 4.5f, 4.2f, 10.f }, { 0.f, 0.f, -1.f }, intersection, distance));
+        EXPECT_FLOAT_EQ(8.f, distance);
+        EXPECT_FLOAT_EQ(2.f, intersection.z);
+
+        EXPECT_TRUE(bvh.intersectRay({ 4.5f, 4.2f, -10.f }, { 0.f, 0.f, 1.f }, intersection, distance));
+        EXPECT_FLOAT_EQ(7.f, distance);
+        EXPECT_FLOAT_EQ(-3.f, intersection.z);
+
+        // geometry behind ray
+        EXPECT_FALSE(bvh.intersectRay({ 4.5f, 4.2f, 10.f }, { 0.f, 0.f, 1.f }, intersection, distance));
+    }
+
+    TEST_F(ATriangleBVH, intersectsRayWithBox)
+    {
+        const glm::vec3 boxMin{ -1.f, -1.f, -1.f };
+        const glm::vec3 boxMax{ 1.f, 1.f, 1.f };
+        const float maxDistance = std::numeric_limits<float>::max();
+
+        EXPECT_TRUE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { 0.f, 0.f, 5.f }, { 0.f, 0.f, -1.f }, maxDistance));
+        EXPECT_TRUE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { 0.f, 0.f, 0.f }, { 0.f, 0.f, -1.f }, maxDistance));
+        EXPECT_FALSE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { 0.f, 0.f, 5.f }, { 0.f, 0.f, 1.f }, maxDistance));
+        EXPECT_FALSE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { 2.f, 0.f, 5.f }, { 0.f, 0.f, -1.f }, maxDistance));
+        EXPECT_FALSE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { 0.f, 0.f, 5.f }, { 0.f, 0.f, -1.f }, 3.f));
+        EXPECT_TRUE(TriangleBVH::IntersectRayVsBox(boxMin, boxMax, { -5.f, -5.f, 0.f }, glm::normalize(glm::vec3{ 1.f, 1.f, 0.f }), maxDistance));
+    }
+}
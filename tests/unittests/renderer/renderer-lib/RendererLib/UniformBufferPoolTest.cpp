@@ -0,0 +1,101 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/PlatformBase/UniformBufferPool.h"
+#include "gtest/gtest.h"
+
+namespace ramses::internal
+{
+    class AUniformBufferPool : public ::testing::Test
+    {
+    protected:
+        static constexpr uint32_t OffsetAlignment = 256u;
+        UniformBufferPool pool{ OffsetAlignment };
+    };
+
+    TEST_F(AUniformBufferPool, allocatesCopiesAlignedToOffsetAlignment)
+    {
+        const auto allocation1 = pool.allocate(192u);
+        const auto allocation2 = pool.allocate(64u);
+        const auto allocation3 = pool.allocate(192u);
+
+        EXPECT_EQ(OffsetAlignment, allocation1.copyStride);
+        EXPECT_EQ(0u, allocation1.offset);
+        EXPECT_EQ(0u, allocation1.chunk);
+        EXPECT_EQ(0u, allocation2.chunk);
+        EXPECT_EQ(OffsetAlignment * UniformBufferPool::BufferingCount, allocation2.offset);
+        EXPECT_EQ(2u * OffsetAlignment * UniformBufferPool::BufferingCount, allocation3.offset);
+
+        EXPECT_EQ(1u, pool.getChunkCount());
+        EXPECT_EQ(3u, pool.getAllocationCount());
+    }
+
+    TEST_F(AUniformBufferPool, addsChunkWhenFull)
+    {
+        const uint32_t allocationsPerChunk = UniformBufferPool::ChunkSizeInBytes / (OffsetAlignment * UniformBufferPool::BufferingCount);
+        for (uint32_t i = 0u; i < allocationsPerChunk; ++i)
+            EXPECT_EQ(0u, pool.allocate(100u).chunk);
+
+        const auto allocation = pool.allocate(100u);
+        EXPECT_EQ(1u, allocation.chunk);
+        EXPECT_EQ(0u, allocation.offset);
+        EXPECT_EQ(2u, pool.getChunkCount());
+    }
+
+    TEST_F(AUniformBufferPool, rejectsBuffersNotFittingIntoChunk)
+    {
+        EXPECT_FALSE(pool.canAllocate(0u));
+        EXPECT_TRUE(pool.canAllocate(UniformBufferPool::ChunkSizeInBytes / UniformBufferPool::BufferingCount - OffsetAlignment));
+        EXPECT_FALSE(pool.canAllocate(UniformBufferPool::ChunkSizeInBytes / UniformBufferPool::BufferingCount));
+    }
+
+    TEST_F(AUniformBufferPool, writesEveryBatchToNextCopy)
+    {
+        auto allocation = pool.allocate(64u);
+
+        pool.beginUpdateBatch();
+        EXPECT_EQ(0u, pool.selectCopyForUpdate(allocation));
+        // same batch, copy was not read yet and is overwritten
+        EXPECT_EQ(0u, pool.selectCopyForUpdate(allocation));
+        EXPECT_EQ(0u, UniformBufferPool::GetActiveCopyOffset(allocation));
+
+        pool.beginUpdateBatch();
+        EXPECT_EQ(OffsetAlignment, pool.selectCopyForUpdate(allocation));
+        pool.beginUpdateBatch();
+        EXPECT_EQ(2u * OffsetAlignment, pool.selectCopyForUpdate(allocation));
+        pool.beginUpdateBatch();
+        EXPECT_EQ(0u, pool.selectCopyForUpdate(allocation));
+
+        // batches without update of this buffer keep its active copy
+        pool.beginUpdateBatch();
+        pool.beginUpdateBatch();
+        EXPECT_EQ(0u, UniformBufferPool::GetActiveCopyOffset(allocation));
+        EXPECT_EQ(OffsetAlignment, pool.selectCopyForUpdate(allocation));
+    }
+
+    TEST_F(AUniformBufferPool, reusesReleasedAllocationOnlyAfterGpuCannotReadItAnymore)
+    {
+        const auto allocation1 = pool.allocate(64u);
+        pool.release(allocation1);
+        EXPECT_EQ(0u, pool.getAllocationCount());
+
+        for (uint32_t i = 0u; i < UniformBufferPool::BufferingCount - 1u; ++i)
+        {
+            pool.beginUpdateBatch();
+            const auto allocation = pool.allocate(64u);
+            EXPECT_NE(allocation1.offset, allocation.offset);
+            pool.release(allocation);
+        }
+
+        pool.beginUpdateBatch();
+        const auto allocation2 = pool.allocate(64u);
+        EXPECT_EQ(allocation1.chunk, allocation2.chunk);
+        EXPECT_EQ(allocation1.offset, allocation2.offset);
+        EXPECT_EQ(1u, pool.getChunkCount());
+    }
+}
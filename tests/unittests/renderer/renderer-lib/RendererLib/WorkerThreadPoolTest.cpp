@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internal/RendererLib/WorkerThreadPool.h"
+#include "internal/Watchdog/ThreadAliveNotifierMock.h"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+
+using namespace testing;
+namespace ramses::internal
+{
+    class AWorkerThreadPool : public testing::Test
+    {
+    protected:
+        NiceMock<ThreadAliveNotifierMock> notifier;
+        WorkerThreadPool pool{ 3u, notifier };
+    };
+
+    TEST_F(AWorkerThreadPool, hasGivenNumberOfThreads)
+    {
+        EXPECT_EQ(3u, pool.getThreadCount());
+    }
+
+    TEST_F(AWorkerThreadPool, executesEveryJobExactlyOnce)
+    {
+        std::vector<std::atomic<int>> executions(100u);
+        pool.execute(executions.size(), [&](size_t idx) { ++executions[idx]; });
+        for (const auto& count : executions)
+            EXPECT_EQ(1, count);
+    }
+
+    TEST_F(AWorkerThreadPool, completesAllJobsBeforeReturningWhenJobsTakeTime)
+    {
+        // distribution of jobs to threads depends on scheduling, only completion is guaranteed
+        std::mutex mutex;
+        std::set<std::thread::id> threads;
+        std::atomic<size_t> completed{ 0u };
+        pool.execute(200u, [&](size_t /*unused*/) {
+            std::this_thread::sleep_for(std::chrono::microseconds{ 100 });
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+            ++completed;
+        });
+        EXPECT_EQ(200u, completed);
+        EXPECT_LE(threads.size(), pool.getThreadCount() + 1u);
+    }
+
+    TEST_F(AWorkerThreadPool, canExecuteManyBatchesInSequence)
+    {
+        std::atomic<size_t> total{ 0u };
+        for (size_t batch = 0u; batch < 1000u; ++batch)
+            pool.execute(batch % 7u, [&](size_t /*unused*/) { ++total; });
+
+        size_t expected = 0u;
+        for (size_t batch = 0u; batch < 1000u; ++batch)
+            expected += batch % 7u;
+        EXPECT_EQ(expected, total);
+    }
+
+    TEST(AWorkerThreadPoolWithoutThreads, executesAllJobsOnCallingThread)
+    {
+        NiceMock<ThreadAliveNotifierMock> notifier;
+        WorkerThreadPool pool{ 0u, notifier };
+        std::vector<std::thread::id> threads;
+        pool.execute(5u, [&](size_t /*unused*/) { threads.push_back(std::this_thread::get_id()); });
+        ASSERT_EQ(5u, threads.size());
+        for (const auto& id : threads)
+            EXPECT_EQ(std::this_thread::get_id(), id);
+    }
+}
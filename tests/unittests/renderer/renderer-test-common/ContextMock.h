@@ -9,6 +9,7 @@
 #pragma once
 
 #include "internal/RendererLib/PlatformInterface/IContext.h"
+#include "internal/Core/Math3d/Quad.h"
 #include "gmock/gmock.h"
 
 
@@ -23,6 +24,8 @@ namespace ramses::internal
         MOCK_METHOD(bool, init, ()); // Does not exist in IContext, needed for only for testing
 
         MOCK_METHOD(bool,  swapBuffers, (), (override));
+        MOCK_METHOD(bool,  swapBuffersWithDamage, (const Quad& damagedRegion), (override));
+        MOCK_METHOD(uint32_t, getBufferAge, (), (const, override));
         MOCK_METHOD(bool,  enable, (), (override));
         MOCK_METHOD(bool,  disable, (), (override));
 
@@ -46,8 +46,8 @@ namespace ramses::internal
         EXPECT_CALL(*this, getTextureAddress(_)).Times(AnyNumber());
 
         // fake uploads
-        ON_CALL(*this, allocateVertexBuffer(_)).WillByDefault(Return(FakeVertexBufferDeviceHandle));
-        ON_CALL(*this, allocateIndexBuffer(_, _)).WillByDefault(Return(FakeIndexBufferDeviceHandle));
+        ON_CALL(*this, allocateVertexBuffer(_, _)).WillByDefault(Return(FakeVertexBufferDeviceHandle));
+        ON_CALL(*this, allocateIndexBuffer(_, _, _)).WillByDefault(Return(FakeIndexBufferDeviceHandle));
         ON_CALL(*this, allocateVertexArray(_)).WillByDefault(Return(FakeVertexArrayDeviceHandle));
         ON_CALL(*this, uploadShader(_)).WillByDefault(Invoke([](const auto& /*unused*/){return std::make_unique<const GPUResource>(1u, 2u);}));
         ON_CALL(*this, registerShader(_)).WillByDefault(Return(FakeShaderDeviceHandle));
@@ -57,6 +57,7 @@ namespace ramses::internal
         ON_CALL(*this, uploadDmaRenderBuffer(_, _, _, _, _)).WillByDefault(Return(FakeDmaRenderBufferDeviceHandle));
         ON_CALL(*this, uploadRenderTarget(_)).WillByDefault(Return(FakeRenderTargetDeviceHandle));
         ON_CALL(*this, allocateUniformBuffer(_)).WillByDefault(Return(FakeUniformBufferDeviceHandle));
+        ON_CALL(*this, allocateStreamingUniformBuffer(_)).WillByDefault(Return(FakeUniformBufferDeviceHandle));
         ON_CALL(*this, getFramebufferRenderTarget()).WillByDefault(Return(FakeFrameBufferRenderTargetDeviceHandle));
 
         EXPECT_CALL(*this, getSupportedBinaryProgramFormats(_)).Times(AnyNumber());
@@ -66,4 +67,12 @@ namespace ramses::internal
         ON_CALL(*this, getTextureAddress(FakeExternalTextureDeviceHandle)).WillByDefault(Return(FakeExternalTextureGlId));
         ON_CALL(*this, getEmptyExternalTexture()).WillByDefault(Return(FakeEmptyExternalTextureDeviceHandle));
     }
+
+    std::vector<std::unique_ptr<const GPUResource>> DeviceMock::uploadShaders(const std::vector<const EffectResource*>& effects)
+    {
+        std::vector<std::unique_ptr<const GPUResource>> shaderResources;
+        for (const auto effect : effects)
+            shaderResources.push_back(uploadShader(*effect));
+        return shaderResources;
+    }
 }
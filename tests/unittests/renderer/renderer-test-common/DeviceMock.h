@@ -61,17 +61,22 @@ namespace ramses::internal
         MOCK_METHOD(void, uploadUniformBufferData, (DeviceResourceHandle, const std::byte*, uint32_t), (override));
         MOCK_METHOD(void, activateUniformBuffer, (DeviceResourceHandle, DataFieldHandle), (override));
         MOCK_METHOD(void, deleteUniformBuffer, (DeviceResourceHandle), (override));
-        MOCK_METHOD(DeviceResourceHandle, allocateVertexBuffer, (uint32_t), (override));
+        MOCK_METHOD(DeviceResourceHandle, allocateStreamingUniformBuffer, (uint32_t), (override));
+        MOCK_METHOD(DeviceResourceHandle, allocateVertexBuffer, (uint32_t, EDeviceBufferUsage), (override));
         MOCK_METHOD(void, uploadVertexBufferData, (DeviceResourceHandle, const std::byte*, uint32_t), (override));
+        MOCK_METHOD(void, uploadVertexBufferSubData, (DeviceResourceHandle, uint32_t, const std::byte*, uint32_t), (override));
         MOCK_METHOD(void, deleteVertexBuffer, (DeviceResourceHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, allocateVertexArray, (const VertexArrayInfo&), (override));
         MOCK_METHOD(void, activateVertexArray, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(void, deleteVertexArray, (DeviceResourceHandle handle), (override));
-        MOCK_METHOD(DeviceResourceHandle, allocateIndexBuffer, (EDataType, uint32_t), (override));
+        MOCK_METHOD(DeviceResourceHandle, allocateIndexBuffer, (EDataType, uint32_t, EDeviceBufferUsage), (override));
         MOCK_METHOD(void, uploadIndexBufferData, (DeviceResourceHandle, const std::byte*, uint32_t), (override));
+        MOCK_METHOD(void, uploadIndexBufferSubData, (DeviceResourceHandle, uint32_t, const std::byte*, uint32_t), (override));
         MOCK_METHOD(void, deleteIndexBuffer, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(std::unique_ptr<const GPUResource>, uploadShader, (const EffectResource&), (override));
+        // not mocked, forwards to mocked uploadShader so that expectations can be set per effect
+        std::vector<std::unique_ptr<const GPUResource>> uploadShaders(const std::vector<const EffectResource*>& effects) override;
         MOCK_METHOD(DeviceResourceHandle, registerShader, (std::unique_ptr<const GPUResource>), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadBinaryShader, (const EffectResource&, const std::byte* binaryShaderData, uint32_t binaryShaderDataSize, BinaryShaderFormatID binaryShaderFormat), (override));
         MOCK_METHOD(bool, getBinaryShader, (DeviceResourceHandle, std::vector<std::byte>&, BinaryShaderFormatID&), (override));
@@ -88,19 +93,25 @@ namespace ramses::internal
         MOCK_METHOD(void, uploadTextureData, (DeviceResourceHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t z, uint32_t width, uint32_t height, uint32_t depth, const std::byte* data, uint32_t dataSize, uint32_t stride), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadStreamTexture2D, (DeviceResourceHandle handle, uint32_t width, uint32_t height, EPixelStorageFormat format, const std::byte* data, const TextureSwizzleArray& swizzle), (override));
         MOCK_METHOD(void, deleteTexture, (DeviceResourceHandle), (override));
+        MOCK_METHOD(std::unique_ptr<const GPUResource>, extractTexture, (DeviceResourceHandle), (override));
+        MOCK_METHOD(DeviceResourceHandle, registerTexture, (std::unique_ptr<const GPUResource>), (override));
         MOCK_METHOD(void, activateTexture, (DeviceResourceHandle, DataFieldHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadRenderBuffer, (uint32_t, uint32_t, EPixelStorageFormat, ERenderBufferAccessMode, uint32_t), (override));
         MOCK_METHOD(void, deleteRenderBuffer, (DeviceResourceHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, uploadDmaRenderBuffer, (uint32_t, uint32_t, DmaBufferFourccFormat, DmaBufferUsageFlags, DmaBufferModifiers), (override));
         MOCK_METHOD(int, getDmaRenderBufferFD, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(uint32_t, getDmaRenderBufferStride, (DeviceResourceHandle handle), (override));
+        MOCK_METHOD(int, createDmaRenderBufferSyncFence, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(void, destroyDmaRenderBuffer, (DeviceResourceHandle handle), (override));
+        MOCK_METHOD(bool, importDmaBufferToExternalTexture, (DeviceResourceHandle handle, const DmaBufferFrame& frame, int& releaseFenceFD), (override));
+        MOCK_METHOD(int, releaseDmaBufferOfExternalTexture, (DeviceResourceHandle handle), (override));
         MOCK_METHOD(void, activateTextureSamplerObject, (const TextureSamplerStates&, DataFieldHandle), (override));
         MOCK_METHOD(DeviceResourceHandle, getFramebufferRenderTarget, (), (const, override));
         MOCK_METHOD(DeviceResourceHandle, uploadRenderTarget, (const DeviceHandleVector&), (override));
         MOCK_METHOD(void, activateRenderTarget, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, deleteRenderTarget, (DeviceResourceHandle), (override));
         MOCK_METHOD(void, discardDepthStencil, (), (override));
+        MOCK_METHOD(void, discardColorBuffers, (), (override));
         MOCK_METHOD(void, blitRenderTargets, (DeviceResourceHandle, DeviceResourceHandle, const PixelRectangle&, const PixelRectangle&, bool), (override));
 
         MOCK_METHOD(void, pairRenderTargetsForDoubleBuffering, ((const std::array<DeviceResourceHandle, 2>&), (const std::array<DeviceResourceHandle, 2>&)), (override));
@@ -108,9 +119,17 @@ namespace ramses::internal
         MOCK_METHOD(void, swapDoubleBufferedRenderTarget, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(void, readPixels, (uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t), (override));
+        MOCK_METHOD(DeviceResourceHandle, startReadPixels, (uint32_t, uint32_t, uint32_t, uint32_t), (override));
+        MOCK_METHOD(bool, finishReadPixels, (DeviceResourceHandle, std::vector<uint8_t>&), (override));
+        MOCK_METHOD(void, deleteReadPixels, (DeviceResourceHandle), (override));
 
         MOCK_METHOD(uint32_t, getTotalGpuMemoryUsageInKB, (), (const, override));
         MOCK_METHOD(uint32_t, getAndResetDrawCallCount, (), (override));
+        MOCK_METHOD(void, invalidateStateCache, (), (override));
+        MOCK_METHOD(bool, beginGpuTimerQuery, (uint64_t queryId), (override));
+        MOCK_METHOD(void, endGpuTimerQuery, (), (override));
+        MOCK_METHOD(void, collectGpuTimerQueryResults, (std::vector<GpuTimerQueryResult>& results), (override));
+        MOCK_METHOD(void, deleteGpuTimerQueries, (uint64_t queryId), (override));
 
         MOCK_METHOD(void, validateDeviceStatusHealthy, (), (const, override));
         MOCK_METHOD(bool, isDeviceStatusHealthy, (), (const, override));
@@ -118,6 +137,8 @@ namespace ramses::internal
         MOCK_METHOD(bool, isExternalTextureExtensionSupported, (), (const, override));
 
         MOCK_METHOD(void, flush, (), (override));
+        MOCK_METHOD(DeviceFence, insertFence, (), (override));
+        MOCK_METHOD(void, waitFence, (DeviceFence), (override));
 
         MOCK_METHOD(uint32_t, getTextureAddress, (DeviceResourceHandle), (const, override));
         MOCK_METHOD(uint32_t, getGPUHandle, (DeviceResourceHandle), (const, override));
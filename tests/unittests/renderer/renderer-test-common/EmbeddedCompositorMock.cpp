@@ -19,6 +19,7 @@ namespace ramses::internal
         ON_CALL(*this, dispatchObsoleteStreamTextureSourceIds()).WillByDefault(Return(WaylandIviSurfaceIdSet()));
 
         EXPECT_CALL(*this, isRealCompositor()).Times(AnyNumber()).WillRepeatedly(Return(true));
+        EXPECT_CALL(*this, stopEventThread()).Times(AnyNumber());
     }
 
     EmbeddedCompositorMock::~EmbeddedCompositorMock() = default;
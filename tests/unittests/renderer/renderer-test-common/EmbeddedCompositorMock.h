@@ -35,6 +35,9 @@ namespace ramses::internal
         MOCK_METHOD(std::string, getTitleOfWaylandIviSurface, (WaylandIviSurfaceId), (const, override));
         MOCK_METHOD(void, logInfos, (RendererLogContext&), (const, override));
         MOCK_METHOD(void, logPeriodicInfo, (StringOutputStream&), (const, override));
+        MOCK_METHOD(void, stopEventThread, (), (override));
+        MOCK_METHOD(void, setClientRequestsListener, (std::function<void()>), (override));
+        MOCK_METHOD(bool, isEventThreadRunning, (), (const, override));
         MOCK_METHOD(bool, isRealCompositor, (), (const, override));
     };
 }
@@ -133,6 +133,11 @@ namespace ramses::internal
             handleExternalBufferDestroyRequest(cmd.externalBuffer, cmd.display);
         }
 
+        void operator()(const RendererCommand::UpdateExternalBufferDmaBuffer& cmd)
+        {
+            handleExternalBufferDmaBufferUpdate(cmd.display, cmd.externalBuffer, cmd.frame);
+        }
+
         void operator()(const RendererCommand::SetClearFlags& cmd)
         {
             handleSetClearFlags(cmd.display, cmd.offscreenBuffer, cmd.clearFlags);
@@ -143,6 +148,21 @@ namespace ramses::internal
             handleSetClearColor(cmd.display, cmd.offscreenBuffer, cmd.clearColor);
         }
 
+        void operator()(const RendererCommand::SetRenderRateDivisor& cmd)
+        {
+            handleSetRenderRateDivisor(cmd.display, cmd.offscreenBuffer, cmd.divisor);
+        }
+
+        void operator()(const RendererCommand::SetOffscreenBufferScalable& cmd)
+        {
+            handleSetOffscreenBufferScalable(cmd.display, cmd.offscreenBuffer, cmd.scalable);
+        }
+
+        void operator()(const RendererCommand::SetDmaOffscreenBufferSyncFence& cmd)
+        {
+            handleSetDmaOffscreenBufferSyncFence(cmd.display, cmd.offscreenBuffer, cmd.enable);
+        }
+
         void operator()(const RendererCommand::SetExterallyOwnedWindowSize& cmd)
         {
             handleSetExternallyOwnedWindowSize(cmd.display, cmd.width, cmd.height);
@@ -155,7 +175,7 @@ namespace ramses::internal
 
         void operator()(const RendererCommand::ReadPixels& cmd)
         {
-            handleReadPixels(cmd.display, cmd.offscreenBuffer, cmd.offsetX, cmd.offsetY, cmd.width, cmd.height, cmd.fullScreen, cmd.filename);
+            handleReadPixels(cmd.display, cmd.offscreenBuffer, cmd.offsetX, cmd.offsetY, cmd.width, cmd.height, cmd.fullScreen, cmd.filename, cmd.async);
         }
 
         void operator()(const RendererCommand::SCListIviSurfaces& /*unused*/)
@@ -218,6 +238,11 @@ namespace ramses::internal
             setSkippingOfUnmodifiedBuffers(cmd.enable);
         }
 
+        void operator()(const RendererCommand::TrimMemory& /*unused*/)
+        {
+            trimMemory();
+        }
+
         void operator()(const RendererCommand::ConfirmationEcho& cmd)
         {
             handleConfirmationEcho(cmd.display, cmd.text);
@@ -242,6 +267,10 @@ namespace ramses::internal
         MOCK_METHOD(void, handleDataUnlinkRequest, (SceneId, DataSlotId));
         MOCK_METHOD(void, handleSetClearFlags, (DisplayHandle, OffscreenBufferHandle, ClearFlags));
         MOCK_METHOD(void, handleSetClearColor, (DisplayHandle, OffscreenBufferHandle, const glm::vec4&));
+        MOCK_METHOD(void, handleSetRenderRateDivisor, (DisplayHandle, OffscreenBufferHandle, uint32_t));
+        MOCK_METHOD(void, handleSetOffscreenBufferScalable, (DisplayHandle, OffscreenBufferHandle, bool));
+        MOCK_METHOD(void, handleSetDmaOffscreenBufferSyncFence, (DisplayHandle, OffscreenBufferHandle, bool));
+        MOCK_METHOD(void, handleExternalBufferDmaBufferUpdate, (DisplayHandle, ExternalBufferHandle, const DmaBufferFrame&));
         MOCK_METHOD(void, handleSetExternallyOwnedWindowSize, (DisplayHandle, uint32_t, uint32_t));
         MOCK_METHOD(void, handlePick, (SceneId, const glm::vec2&));
         MOCK_METHOD(void, handleBufferCreateRequest, (OffscreenBufferHandle, DisplayHandle, uint32_t, uint32_t, uint32_t, bool, EDepthBufferType));
@@ -254,7 +283,7 @@ namespace ramses::internal
         MOCK_METHOD(void, handleBufferToSceneDataLinkRequest, (OffscreenBufferHandle, SceneId, DataSlotId));
         MOCK_METHOD(void, handleBufferToSceneDataLinkRequest, (StreamBufferHandle, SceneId, DataSlotId));
         MOCK_METHOD(void, handleBufferToSceneDataLinkRequest, (ExternalBufferHandle, SceneId, DataSlotId));
-        MOCK_METHOD(void, handleReadPixels, (DisplayHandle, OffscreenBufferHandle, uint32_t, uint32_t, uint32_t, uint32_t, bool, std::string_view));
+        MOCK_METHOD(void, handleReadPixels, (DisplayHandle, OffscreenBufferHandle, uint32_t, uint32_t, uint32_t, uint32_t, bool, std::string_view, bool));
         MOCK_METHOD(void, systemCompositorListIviSurfaces, ());
         MOCK_METHOD(void, systemCompositorSetIviSurfaceVisibility, (WaylandIviSurfaceId, bool));
         MOCK_METHOD(void, systemCompositorSetIviSurfaceOpacity, (WaylandIviSurfaceId, float));
@@ -267,6 +296,7 @@ namespace ramses::internal
         MOCK_METHOD(void, logInfo, (ERendererLogTopic, bool, NodeHandle));
         MOCK_METHOD(void, setLimitsFrameBudgets, (uint64_t, uint64_t, uint64_t));
         MOCK_METHOD(void, setSkippingOfUnmodifiedBuffers, (bool));
+        MOCK_METHOD(void, trimMemory, ());
         MOCK_METHOD(void, handleConfirmationEcho, (DisplayHandle, std::string_view));
     };
 }
@@ -24,5 +24,6 @@ namespace ramses::internal
         MOCK_METHOD(void, onMouseEvent, (EMouseEvent event, int32_t posX, int32_t posY), (override));
         MOCK_METHOD(void, onClose, (), (override));
         MOCK_METHOD(void, onWindowMove, (int32_t posX, int32_t posY), (override));
+        MOCK_METHOD(void, onFramePresented, (uint64_t frameIndex, FlushTime::Clock::time_point presentationTime), (override));
     };
 }
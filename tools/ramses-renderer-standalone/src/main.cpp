@@ -12,6 +12,7 @@
 #include "ramses/renderer/DisplayConfig.h"
 #include "ramses/renderer/IRendererSceneControlEventHandler.h"
 #include "internal/Core/Utils/LogMacros.h"
+#include "internal/Core/Utils/TraceRecorder.h"
 #include "impl/RendererMate.h"
 #include "internal/PlatformAbstraction/PlatformThread.h"
 #include "internal/Ramsh/RamshCommandExit.h"
@@ -20,6 +21,7 @@
 #include <unordered_set>
 #include <thread>
 #include <sstream>
+#include <string>
 
 struct MappingCommand
 {
@@ -78,6 +80,7 @@ int32_t main(int32_t argc, char * argv[])
     uint32_t numDisplays = 1u;
     bool     disableAutoMapping = false;
     bool     skub               = false;
+    std::string traceFile;
     std::vector<MappingCommand> mappingCommands;
     ramses::RamsesFrameworkConfig config{ramses::EFeatureLevel_Latest};
     // enable console mode by default to be able to use Ramsh commands
@@ -92,6 +95,7 @@ int32_t main(int32_t argc, char * argv[])
         cli.add_option("-m,--scene-mapping", mappingCommands, "scene mappings: displayIdx,sceneId,renderOrder");
         cli.add_flag("--no-auto-show", disableAutoMapping, "disables automatic mapping and showing of published scenes");
         cli.add_flag("--skub", skub, "Enable renderer optimization: skip unmodified buffers");
+        cli.add_option("--trace", traceFile, "Records timing events from start and writes them as Chrome trace to given file on exit");
         ramses::registerOptions(cli, config);
         ramses::registerOptions(cli, rendererConfig);
         ramses::registerOptions(cli, displayConfig);
@@ -104,6 +108,9 @@ int32_t main(int32_t argc, char * argv[])
     }
     CLI11_PARSE(cli, argc, argv);
 
+    if (!traceFile.empty())
+        ramses::internal::GetTraceRecorder().enable(true);
+
     ramses::RamsesFramework framework(config);
     auto commandExit = std::make_shared<ramses::internal::RamshCommandExit>();
     framework.impl().getRamsh().add(commandExit);
@@ -144,5 +151,8 @@ int32_t main(int32_t argc, char * argv[])
 
     renderer.stopThread();
 
+    if (!traceFile.empty() && !ramses::internal::GetTraceRecorder().writeChromeTraceToFile(traceFile))
+        return 1;
+
     return 0;
 }
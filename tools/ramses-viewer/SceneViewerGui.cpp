@@ -1076,6 +1076,18 @@ namespace ramses::internal
             if (ImGui::Button("Refresh"))
                 obj.retriggerRenderOnce();
         }
+        bool stateSorting = obj.isStateSorting();
+        if (ImGui::Checkbox("StateSorting", &stateSorting))
+            obj.setStateSorting(stateSorting);
+        bool frontToBackSorting = obj.isFrontToBackSorting();
+        if (ImGui::Checkbox("FrontToBackSorting", &frontToBackSorting))
+            obj.setFrontToBackSorting(frontToBackSorting);
+        bool backToFrontSorting = obj.isBackToFrontSorting();
+        if (ImGui::Checkbox("BackToFrontSorting", &backToFrontSorting))
+            obj.setBackToFrontSorting(backToFrontSorting);
+        bool depthPrePass = obj.hasDepthPrePass();
+        if (ImGui::Checkbox("DepthPrePass", &depthPrePass))
+            obj.setDepthPrePass(depthPrePass);
 
         if (obj.getCamera())
             draw(obj.getCamera()->impl());
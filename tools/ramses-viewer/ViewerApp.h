@@ -48,6 +48,8 @@ namespace ramses::internal
             ErrorScreenshot = 5,
             ErrorDisplay    = 6,
             ErrorLoadLua    = 7,
+            ErrorFrameBudget = 8,
+            ErrorBenchmark  = 9,
             ErrorUnknown    = -1,
         };
 
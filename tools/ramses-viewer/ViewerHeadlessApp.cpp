@@ -8,6 +8,14 @@
 #include "ViewerHeadlessApp.h"
 #include "ImguiWrapper.h"
 #include "CLI/CLI.hpp"
+#include "ramses/client/Scene.h"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <vector>
 
 namespace ramses::internal
 {
@@ -23,15 +31,71 @@ namespace ramses::internal
         io.Fonts->GetTexDataAsRGBA32(&pixels, &texturewidth, &textureheight);
     }
 
+    namespace
+    {
+        using Durations = std::vector<std::chrono::microseconds>;
+
+        // selects nearest rank percentile of sorted values
+        std::chrono::microseconds GetPercentile(const Durations& sortedDurations, uint32_t percentile)
+        {
+            const auto rank = (sortedDurations.size() * percentile + 99u) / 100u;
+            return sortedDurations[std::max<size_t>(rank, 1u) - 1u];
+        }
+
+        std::string FormatDurations(Durations durations)
+        {
+            std::sort(durations.begin(), durations.end());
+            const auto total = std::accumulate(durations.cbegin(), durations.cend(), std::chrono::microseconds{ 0 });
+            return fmt::format(R"({{ "min": {}, "p50": {}, "p90": {}, "p95": {}, "p99": {}, "max": {}, "mean": {} }})",
+                durations.front().count(),
+                GetPercentile(durations, 50u).count(),
+                GetPercentile(durations, 90u).count(),
+                GetPercentile(durations, 95u).count(),
+                GetPercentile(durations, 99u).count(),
+                durations.back().count(),
+                total.count() / static_cast<int64_t>(durations.size()));
+        }
+
+        std::string EscapeJsonString(const std::string& str)
+        {
+            std::string escaped;
+            for (const char c : str)
+            {
+                if (c == '"' || c == '\\')
+                    escaped.push_back('\\');
+                escaped.push_back(c);
+            }
+            return escaped;
+        }
+
+        template <typename F>
+        std::chrono::microseconds MeasureDuration(F&& func)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            func();
+            return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        }
+    }
+
     void ViewerHeadlessApp::registerOptions(CLI::App& cli)
     {
         ViewerApp::registerOptions(cli);
         cli.get_option("scene")->required();
+        auto* benchmark = cli.add_option("--benchmark", m_benchmarkFrames, "Runs given number of frames (logic update and flush) and reports timings in microseconds as JSON")
+            ->check(CLI::PositiveNumber)
+            ->excludes("--exec")
+            ->excludes("--exec-lua")
+            ->excludes("--write-config");
+        cli.add_option("--benchmark-report", m_benchmarkReportFile, "Writes the benchmark report to the given file instead of stdout")->needs(benchmark);
+        cli.add_option("--frame-budget", m_frameBudget, "Fails with an error if the 99th percentile of frame times (logic update and flush) exceeds the budget in microseconds")
+            ->check(CLI::PositiveNumber)
+            ->needs(benchmark);
     }
 
     ViewerHeadlessApp::ExitCode ViewerHeadlessApp::run()
     {
-        auto exitCode = loadScene();
+        auto exitCode = ExitCode::Ok;
+        const auto loadTime = MeasureDuration([&]() { exitCode = loadScene(); });
         if (exitCode != ExitCode::Ok)
             return exitCode;
 
@@ -39,6 +103,81 @@ namespace ramses::internal
         if (exitCode != ExitCode::Ok)
             return exitCode;
 
+        if (m_benchmarkFrames > 0u)
+            return runBenchmark(loadTime);
+
+        return ExitCode::Ok;
+    }
+
+    ViewerHeadlessApp::ExitCode ViewerHeadlessApp::runBenchmark(std::chrono::microseconds loadTime)
+    {
+        // headless viewer has no renderer, so a frame consists of logic update and flush of the scene
+        Durations logicUpdateTimes;
+        Durations flushTimes;
+        Durations frameTimes;
+        logicUpdateTimes.reserve(m_benchmarkFrames);
+        flushTimes.reserve(m_benchmarkFrames);
+        frameTimes.reserve(m_benchmarkFrames);
+
+        auto* logicViewer = getLogicViewer();
+        for (uint32_t frame = 0u; frame < m_benchmarkFrames; ++frame)
+        {
+            Result updateResult;
+            logicUpdateTimes.push_back(MeasureDuration([&]() {
+                if (logicViewer)
+                    updateResult = logicViewer->update();
+            }));
+            if (!updateResult.ok())
+            {
+                std::cerr << fmt::format("Benchmark failed in frame {}: {}", frame, updateResult.getMessage()) << std::endl;
+                return ExitCode::ErrorBenchmark;
+            }
+            flushTimes.push_back(MeasureDuration([&]() { getScene()->flush(); }));
+            frameTimes.push_back(logicUpdateTimes.back() + flushTimes.back());
+        }
+
+        const std::string report = fmt::format(R"({{
+    "scene": "{}",
+    "frames": {},
+    "loadTime": {},
+    "logicUpdate": {},
+    "flush": {},
+    "frame": {}
+}})",
+            EscapeJsonString(getSceneFile()),
+            m_benchmarkFrames,
+            loadTime.count(),
+            FormatDurations(logicUpdateTimes),
+            FormatDurations(flushTimes),
+            FormatDurations(frameTimes));
+
+        if (m_benchmarkReportFile.empty())
+        {
+            std::cout << report << std::endl;
+        }
+        else
+        {
+            std::ofstream os(m_benchmarkReportFile);
+            os << report << std::endl;
+            os.close();
+            if (!os)
+            {
+                std::cerr << fmt::format("Failed to write benchmark report to '{}'", m_benchmarkReportFile) << std::endl;
+                return ExitCode::ErrorBenchmark;
+            }
+        }
+
+        if (m_frameBudget > 0u)
+        {
+            std::sort(frameTimes.begin(), frameTimes.end());
+            const auto p99 = GetPercentile(frameTimes, 99u);
+            if (p99 > std::chrono::microseconds{ m_frameBudget })
+            {
+                std::cerr << fmt::format("Frame budget exceeded: 99th percentile of frame times is {}us, budget is {}us", p99.count(), m_frameBudget) << std::endl;
+                return ExitCode::ErrorFrameBudget;
+            }
+        }
+
         return ExitCode::Ok;
     }
 }
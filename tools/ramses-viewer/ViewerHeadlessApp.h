@@ -10,6 +10,9 @@
 
 #include "ViewerApp.h"
 
+#include <chrono>
+#include <string>
+
 namespace ramses::internal
 {
 
@@ -21,5 +24,12 @@ namespace ramses::internal
         void registerOptions(CLI::App& cli);
 
         [[nodiscard]] ExitCode run();
+
+    private:
+        [[nodiscard]] ExitCode runBenchmark(std::chrono::microseconds loadTime);
+
+        uint32_t    m_benchmarkFrames = 0u;
+        std::string m_benchmarkReportFile;
+        uint32_t    m_frameBudget = 0u;
     };
 }
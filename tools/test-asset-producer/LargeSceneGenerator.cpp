@@ -0,0 +1,215 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LargeSceneGenerator.h"
+
+#include "ramses/client/logic/LogicEngine.h"
+#include "ramses/client/logic/Property.h"
+#include "ramses/client/logic/LuaScript.h"
+#include "ramses/client/logic/LuaInterface.h"
+#include "ramses/client/logic/NodeBinding.h"
+
+#include "ramses/client/ramses-client.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::vector<ramses::Node*> createNodeTree(ramses::Scene& scene, const LargeSceneConfig& config)
+    {
+        std::vector<ramses::Node*> nodes;
+        nodes.reserve(config.nodeCount);
+
+        const uint32_t depth = std::clamp(config.treeDepth, 1u, std::max(config.nodeCount, 1u));
+        const uint32_t nodesPerLevel = std::max(config.nodeCount / depth, 1u);
+        size_t previousLevelBegin = 0u;
+        size_t currentLevelBegin = 0u;
+        for (uint32_t i = 0u; i < config.nodeCount; ++i)
+        {
+            // last level takes the remainder
+            const uint32_t level = std::min(i / nodesPerLevel, depth - 1u);
+            if (level > 0u && i == level * nodesPerLevel)
+            {
+                previousLevelBegin = currentLevelBegin;
+                currentLevelBegin = i;
+            }
+
+            auto* node = scene.createNode(std::string("node") + std::to_string(i));
+            if (level > 0u)
+            {
+                const size_t previousLevelSize = currentLevelBegin - previousLevelBegin;
+                nodes[previousLevelBegin + (i - currentLevelBegin) % previousLevelSize]->addChild(*node);
+            }
+            nodes.push_back(node);
+        }
+
+        return nodes;
+    }
+
+    std::vector<ramses::Effect*> createEffects(ramses::Scene& scene, const LargeSceneConfig& config)
+    {
+        const bool textured = (config.textureCount > 0u);
+        std::vector<ramses::Effect*> effects;
+        for (uint32_t i = 0u; i < config.effectCount; ++i)
+        {
+            // effects differ by a constant in the shader source, so that each of them is a separate resource
+            const std::string vertShader = std::string(R"(
+                #version 100
+
+                uniform highp mat4 mvpMatrix;
+                attribute vec3 a_position;
+                attribute vec2 a_texcoord;
+                varying vec2 v_texcoord;
+
+                void main()
+                {
+                    v_texcoord = a_texcoord;
+                    gl_Position = mvpMatrix * vec4(a_position, 1.0);
+                })");
+
+            const std::string fragShader = std::string(R"(
+                #version 100
+                precision mediump float;
+
+                uniform vec4 u_color;
+                )") + (textured ? "uniform sampler2D u_texture;\n" : "") + R"(
+                varying vec2 v_texcoord;
+
+                void main(void)
+                {
+                    const float variant = )" + std::to_string(i) + R"(.0;
+                    gl_FragColor = u_color * (1.0 + variant * 0.001))" + (textured ? " * texture2D(u_texture, v_texcoord)" : "") + R"(;
+                })";
+
+            ramses::EffectDescription effectDesc;
+            effectDesc.setUniformSemantic("mvpMatrix", ramses::EEffectUniformSemantic::ModelViewProjectionMatrix);
+            effectDesc.setVertexShader(vertShader);
+            effectDesc.setFragmentShader(fragShader);
+            effects.push_back(scene.createEffect(effectDesc, std::string("effect") + std::to_string(i)));
+        }
+
+        return effects;
+    }
+
+    std::vector<ramses::TextureSampler*> createTextureSamplers(ramses::Scene& scene, const LargeSceneConfig& config)
+    {
+        std::vector<ramses::TextureSampler*> samplers;
+        for (uint32_t i = 0u; i < config.textureCount; ++i)
+        {
+            // each texture gets different content, otherwise they would be deduplicated as the same resource
+            ramses::MipLevelData texels(size_t{ config.textureSize } * config.textureSize * 4u);
+            for (size_t t = 0u; t < texels.size(); ++t)
+                texels[t] = static_cast<std::byte>((t / 4u) ^ (t % 4u) ^ (i * 37u));
+
+            auto* texture = scene.createTexture2D(ramses::ETextureFormat::RGBA8, config.textureSize, config.textureSize, { texels }, false, {}, std::string("texture") + std::to_string(i));
+            samplers.push_back(scene.createTextureSampler(ramses::ETextureAddressMode::Repeat, ramses::ETextureAddressMode::Repeat,
+                ramses::ETextureSamplingMethod::Linear, ramses::ETextureSamplingMethod::Linear, *texture, 1u, std::string("sampler") + std::to_string(i)));
+        }
+
+        return samplers;
+    }
+
+    void createRenderables(ramses::Scene& scene, const LargeSceneConfig& config, const std::vector<ramses::Node*>& nodes)
+    {
+        if (config.renderableCount == 0u || config.effectCount == 0u)
+            return;
+
+        const auto effects = createEffects(scene, config);
+        const auto samplers = createTextureSamplers(scene, config);
+
+        // vertex data is shared by all renderables, geometry is shared by renderables using same effect
+        const std::array<ramses::vec3f, 4u> positionData{ ramses::vec3f{-1.f, -1.f, 0.f}, ramses::vec3f{1.f, -1.f, 0.f}, ramses::vec3f{1.f, 1.f, 0.f}, ramses::vec3f{-1.f, 1.f, 0.f} };
+        const std::array<ramses::vec2f, 4u> texCoordData{ ramses::vec2f{0.f, 0.f}, ramses::vec2f{1.f, 0.f}, ramses::vec2f{1.f, 1.f}, ramses::vec2f{0.f, 1.f} };
+        const std::array<uint16_t, 6u> indexData{ 0u, 1u, 2u, 2u, 3u, 0u };
+        const auto* positions = scene.createArrayResource(4u, positionData.data(), "positions");
+        const auto* texCoords = scene.createArrayResource(4u, texCoordData.data(), "texCoords");
+        const auto* indices = scene.createArrayResource(6u, indexData.data(), "indices");
+
+        std::vector<ramses::Geometry*> geometries;
+        for (auto* effect : effects)
+        {
+            auto* geometry = scene.createGeometry(*effect, effect->getName());
+            geometry->setInputBuffer(*effect->findAttributeInput("a_position"), *positions);
+            geometry->setInputBuffer(*effect->findAttributeInput("a_texcoord"), *texCoords);
+            geometry->setIndices(*indices);
+            geometries.push_back(geometry);
+        }
+
+        auto* camera = scene.createPerspectiveCamera("camera");
+        camera->setViewport(0, 0, 1280u, 480u);
+        camera->setFrustum(19.f, 1280.f / 480.f, 0.1f, 1500.f);
+        camera->setTranslation({ 0.f, 0.f, 100.f });
+        auto* renderPass = scene.createRenderPass("renderPass");
+        renderPass->setCamera(*camera);
+        auto* renderGroup = scene.createRenderGroup("renderGroup");
+        renderPass->addRenderGroup(*renderGroup);
+
+        for (uint32_t i = 0u; i < config.renderableCount; ++i)
+        {
+            const size_t effectIdx = i % effects.size();
+            const auto& effect = *effects[effectIdx];
+            auto* appearance = scene.createAppearance(effect, std::string("appearance") + std::to_string(i));
+            appearance->setInputValue(*effect.findUniformInput("u_color"), ramses::vec4f{ 1.f, static_cast<float>(i % 256u) / 255.f, 0.f, 1.f });
+            if (!samplers.empty())
+                appearance->setInputTexture(*effect.findUniformInput("u_texture"), *samplers[i % samplers.size()]);
+
+            auto* meshNode = scene.createMeshNode(std::string("mesh") + std::to_string(i));
+            meshNode->setAppearance(*appearance);
+            meshNode->setGeometry(*geometries[effectIdx]);
+            meshNode->setIndexCount(static_cast<uint32_t>(indexData.size()));
+            meshNode->setTranslation({ static_cast<float>(i % 32u) - 16.f, static_cast<float>((i / 32u) % 32u) - 16.f, 0.f });
+            if (!nodes.empty())
+                nodes[i % nodes.size()]->addChild(*meshNode);
+            renderGroup->addMeshNode(*meshNode, static_cast<int32_t>(i));
+        }
+    }
+
+    void createLogic(ramses::LogicEngine& logicEngine, const LargeSceneConfig& config, const std::vector<ramses::Node*>& nodes)
+    {
+        if (config.scriptCount == 0u || nodes.empty())
+            return;
+
+        auto* intf = logicEngine.createLuaInterface(R"(
+            function interface(inout)
+                inout.time = Type:Float()
+            end
+        )", "timeInterface");
+        auto* timeOutput = intf->getOutputs()->getChild("time");
+
+        // script i drives node binding of node i, so that all bindings have distinct nodes
+        const size_t scriptCount = std::min<size_t>(config.scriptCount, nodes.size());
+        for (size_t i = 0u; i < scriptCount; ++i)
+        {
+            auto* script = logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.time = Type:Float()
+                    IN.offset = Type:Float()
+                    OUT.rotation = Type:Vec3f()
+                end
+                function run(IN,OUT)
+                    OUT.rotation = { 0, IN.time * 10 + IN.offset, 0 }
+                end
+            )", {}, std::string("script") + std::to_string(i));
+            script->getInputs()->getChild("offset")->set(static_cast<float>(i));
+
+            auto* nodeBinding = logicEngine.createNodeBinding(*nodes[i], ramses::ERotationType::Euler_XYZ, std::string("nodeBinding") + std::to_string(i));
+            logicEngine.link(*timeOutput, *script->getInputs()->getChild("time"));
+            logicEngine.link(*script->getOutputs()->getChild("rotation"), *nodeBinding->getInputs()->getChild("rotation"));
+        }
+    }
+}
+
+void createLargeScene(ramses::Scene& scene, ramses::LogicEngine& logicEngine, const LargeSceneConfig& config)
+{
+    const auto nodes = createNodeTree(scene, config);
+    createRenderables(scene, config, nodes);
+    createLogic(logicEngine, config, nodes);
+}
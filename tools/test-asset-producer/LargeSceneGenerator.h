@@ -0,0 +1,36 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2024 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace ramses
+{
+    class Scene;
+    class LogicEngine;
+}
+
+// Parameters of synthetic scene used as input for scaling benchmarks (renderer, logic, loading)
+struct LargeSceneConfig
+{
+    // nodes distributed evenly to tree levels, each node parented to a node of previous level
+    uint32_t nodeCount = 1000u;
+    uint32_t treeDepth = 5u;
+    // mesh nodes attached to the node tree, using effects and textures in round robin
+    uint32_t renderableCount = 100u;
+    uint32_t effectCount = 4u;
+    uint32_t textureCount = 4u;
+    uint32_t textureSize = 256u;
+    // scripts driven by single interface, each script linked to a node binding of a distinct node
+    uint32_t scriptCount = 100u;
+    // number of scenes referenced by the master scene, each generated with the same parameters
+    uint32_t sceneReferenceCount = 0u;
+};
+
+void createLargeScene(ramses::Scene& scene, ramses::LogicEngine& logicEngine, const LargeSceneConfig& config);
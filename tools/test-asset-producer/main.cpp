@@ -24,6 +24,9 @@
 #include "ramses/client/ramses-client.h"
 #include "ramses/client/ramses-utils.h"
 
+#include "LargeSceneGenerator.h"
+#include "CLI/CLI.hpp"
+
 #include <iostream>
 
 ramses::Appearance* createTestAppearance(ramses::Scene& scene)
@@ -133,6 +136,7 @@ void createTriangle(ramses::Scene& scene, ramses::EFeatureLevel featureLevel)
         effectDesc.setFragmentShader(fragShader_FL01.data());
         break;
     case ramses::EFeatureLevel_02:
+    case ramses::EFeatureLevel_03:
         effectDesc.setUniformSemantic("modelCameraBlock", ramses::EEffectUniformSemantic::ModelCameraBlock);
         effectDesc.setVertexShader(vertShader_FL02.data());
         effectDesc.setFragmentShader(fragShader_FL02.data());
@@ -159,6 +163,8 @@ void createTriangle(ramses::Scene& scene, ramses::EFeatureLevel featureLevel)
     ramses::RenderPass* renderPass = scene.createRenderPass("triangle render pass");
     renderPass->setClearFlags(ramses::EClearFlag::None);
     renderPass->setCamera(*camera);
+    if (featureLevel >= ramses::EFeatureLevel_03)
+        renderPass->setStateSorting(true);
     ramses::RenderGroup* renderGroup = scene.createRenderGroup();
     renderGroup->addMeshNode(*meshNode);
     renderPass->addRenderGroup(*renderGroup);
@@ -211,55 +217,86 @@ void createTriangleLogic(ramses::LogicEngine& logic, ramses::Scene& scene)
     appearanceBinding->getInputs()->getChild("colorBlock.color[1].c2")->set(1.f);
 }
 
-int main(int argc, char* argv[])
+int produceLargeScenes(ramses::RamsesClient& client, const LargeSceneConfig& config, const std::string& basePath, const std::string& ramsesFilename)
 {
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds are checked
-    const std::vector<const char*> args(argv, argv + argc);
+    ramses::SaveFileConfig saveConfig;
+    saveConfig.setMetadataString("test-asset-producer large scene");
+
+    const auto saveScene = [&](ramses::Scene& scene, const std::string& fileName) {
+        const auto filePath = basePath + "/" + fileName;
+        std::cout << "Saving to " << filePath << std::endl;
+        return scene.saveToFile(filePath, saveConfig);
+    };
+
+    const auto createScene = [&](ramses::sceneId_t sceneId) -> ramses::Scene& {
+        ramses::Scene& scene = *client.createScene(sceneId, "");
+        createLargeScene(scene, *scene.createLogicEngine("largeSceneLogic"), config);
+        return scene;
+    };
+
+    constexpr ramses::sceneId_t masterSceneId{ 1000u };
+    ramses::Scene& masterScene = createScene(masterSceneId);
+
+    // referenced scenes are saved next to the master scene, more than one level of referencing is not supported by ramses
+    const auto baseName = ramsesFilename.substr(0u, ramsesFilename.rfind(".ramses"));
+    for (uint32_t i = 0u; i < config.sceneReferenceCount; ++i)
+    {
+        const ramses::sceneId_t refSceneId{ masterSceneId.getValue() + 1u + i };
+        ramses::Scene& refScene = createScene(refSceneId);
+        if (!refScene.getLogicEngine()->update() || !saveScene(refScene, baseName + "_ref" + std::to_string(i) + ".ramses"))
+            return EXIT_FAILURE;
+#ifndef _MSC_VER
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+        masterScene.createSceneReference(refSceneId, std::string("sceneReference") + std::to_string(i));
+#ifndef _MSC_VER
+#pragma GCC diagnostic pop
+#endif
+    }
 
+    if (!masterScene.getLogicEngine()->update() || !saveScene(masterScene, ramsesFilename))
+        return EXIT_FAILURE;
 
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
     ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_Latest;
     std::string basePath {"."};
-    std::string ramsesFilename = std::string("testScene_0") + std::to_string(featureLevel) + ".ramses";
-
-    if (args.size() >= 2u)
-        basePath = args[1];
-
-    if (args.size() >= 3u)
-        ramsesFilename = args[2];
-
-    if (args.size() == 4u)
-    {
-        auto featureLevelAsInt = std::stoi(args[3]);
-        switch (featureLevelAsInt)
-        {
-        case 1:
-            featureLevel = ramses::EFeatureLevel_01;
-            break;
-        case 2:
-            featureLevel = ramses::EFeatureLevel_02;
-            break;
-        default:
-            std::cerr << "Invalid feature level.\n\n";
-            return 1;
-        }
-    }
-
-    if (args.size() > 4u)
-    {
-        std::cerr
-            << "Generator of ramses and ramses logic test content.\n\n"
-            << "Synopsis:\n"
-            << "  test-asset-producer\n"
-            << "  test-asset-producer <basePath>\n"
-            << "  test-asset-producer <basePath> <ramsesFileName>\n\n"
-            << "  test-asset-producer <basePath> <ramsesFileName> <featureLevel>\n\n";
-        return 1;
-    }
+    std::string ramsesFilename;
+    bool largeScene = false;
+    LargeSceneConfig largeSceneConfig;
+
+    CLI::App cli{ "Generator of ramses and ramses logic test content." };
+    cli.add_option("basePath", basePath, "Directory to save the scene file(s) to")->default_val(basePath);
+    cli.add_option("ramsesFileName", ramsesFilename, "File name of the (master) scene, default is testScene_0<featureLevel>.ramses or largeScene.ramses");
+    cli.add_option("featureLevel", featureLevel, "Feature level")->check(CLI::Range(static_cast<int>(ramses::EFeatureLevel_01), static_cast<int>(ramses::EFeatureLevel_Latest)));
+
+    auto* largeGroup = cli.add_option_group("Large scene", "Synthetic scene with configurable size, e.g. as input for benchmarks");
+    largeGroup->add_flag("--large", largeScene, "Generate large scene instead of test content");
+    largeGroup->add_option("--nodes", largeSceneConfig.nodeCount, "Number of nodes")->default_val(largeSceneConfig.nodeCount);
+    largeGroup->add_option("--depth", largeSceneConfig.treeDepth, "Depth of the node tree")->default_val(largeSceneConfig.treeDepth)->check(CLI::PositiveNumber);
+    largeGroup->add_option("--renderables", largeSceneConfig.renderableCount, "Number of mesh nodes")->default_val(largeSceneConfig.renderableCount);
+    largeGroup->add_option("--effects", largeSceneConfig.effectCount, "Number of effects shared by mesh nodes")->default_val(largeSceneConfig.effectCount);
+    largeGroup->add_option("--textures", largeSceneConfig.textureCount, "Number of textures shared by mesh nodes")->default_val(largeSceneConfig.textureCount);
+    largeGroup->add_option("--texture-size", largeSceneConfig.textureSize, "Width and height of textures")->default_val(largeSceneConfig.textureSize)->check(CLI::PositiveNumber);
+    largeGroup->add_option("--scripts", largeSceneConfig.scriptCount, "Number of scripts, each with 2 links (limited by number of nodes)")->default_val(largeSceneConfig.scriptCount);
+    largeGroup->add_option("--scene-references", largeSceneConfig.sceneReferenceCount, "Number of referenced scenes, generated with same parameters")->default_val(largeSceneConfig.sceneReferenceCount);
+
+    CLI11_PARSE(cli, argc, argv);
+
+    if (ramsesFilename.empty())
+        ramsesFilename = largeScene ? std::string("largeScene.ramses") : std::string("testScene_0") + std::to_string(featureLevel) + ".ramses";
 
     ramses::RamsesFrameworkConfig frameworkConfig{ featureLevel };
     ramses::RamsesFramework ramsesFramework{frameworkConfig};
     ramses::RamsesClient* ramsesClient = ramsesFramework.createClient("");
 
+    if (largeScene)
+        return produceLargeScenes(*ramsesClient, largeSceneConfig, basePath, ramsesFilename);
+
     ramses::Scene* scene = ramsesClient->createScene(ramses::sceneId_t(123u), "");
     scene->flush();
     ramses::LogicEngine& logicEngine{ *scene->createLogicEngine("testAssetLogic") };